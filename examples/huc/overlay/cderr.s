@@ -0,0 +1,108 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (8ab091f, 2026-10-17)
+; on Sat Oct 17 10:20:38 2026
+;
+
+HUC	= 1
+                                                                           
+SMALL	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+
+	.bss
+_vram_loaded:		.ds	1
+
+	.code
+	.code
+	.proc _main
+	__ldwi	328
+	__stw	__ax
+	  call	_set_xres.1
+	__ldwi	0
+	__stw	color_reg
+	__ldwi	0
+	__stw	color_data
+	__ldwi	1
+	__stw	color_reg
+	__ldwi	511
+	__stw	color_data
+	__ldwi	LL0+0
+	__stw	__si
+	__ldwi	8
+	  stx	__bl
+	__ldwi	2
+	  call	_put_string.3
+	__ldwi	LL0+18
+	__stw	__si
+	__ldwi	8
+	  stx	__bl
+	__ldwi	3
+	  call	_put_string.3
+	__ldwi	LL0+29
+	__stw	__si
+	__ldwi	2
+	  stx	__bl
+	__ldwi	5
+	  call	_put_string.3
+LL2:
+
+	__ldwi	1
+	__tstw
+	__lbeqn	LL3
+	__lbran	LL2
+LL3:
+
+LL1:
+
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+LL0:
+	.db	68,101,109,111,32,84,101,115
+	.db	116,32,79,118,101,114,108,97
+	.db	121,0,80,114,111,103,114,97
+	.db	109,32,35,52,0,83,117,112
+	.db	101,114,32,83,121,115,116,101
+	.db	109,32,67,97,114,100,32,51
+	.db	32,114,101,113,117,105,114,101
+	.db	100,33,0
+_dave_init:
+	.db	0
+	.db	1
+	.db	2
+	.db	3
+	.db	4
+	.db	5
+	.db	6
+	.db	7
+	.db	8
+	.db	9
+	.db	10
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:59
+;	constant pool:11
+;	global pool:25
+;	Macro pool:87
+huc_rodata:
+__huc_rodata:
+huc_rodata_end:
+__huc_rodata_end:
+huc_data:
+__huc_data:
+huc_data_end:
+__huc_data_end:
+__heap_start:
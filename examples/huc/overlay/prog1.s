@@ -0,0 +1,124 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (8ab091f, 2026-10-17)
+; on Sat Oct 17 10:20:38 2026
+;
+
+HUC	= 1
+                                                                           
+SMALL	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+
+	.bss
+_vram_loaded:		.ds	1
+
+	.code
+	.code
+	.proc _main
+	__addmi	-8,__stack
+	__ldwi	328
+	__stw	__ax
+	  call	_set_xres.1
+	__ldwi	0
+	__stw	color_reg
+	__ldwi	0
+	__stw	color_data
+	__ldwi	1
+	__stw	color_reg
+	__ldwi	511
+	__stw	color_data
+	__ldwi	LL0+0
+	__stw	__si
+	__ldwi	8
+	  stx	__bl
+	__ldwi	2
+	  call	_put_string.3
+	__ldwi	LL0+18
+	__stw	__si
+	__ldwi	8
+	  stx	__bl
+	__ldwi	3
+	  call	_put_string.3
+	__ldwi	LL0+29
+	__stw	__si
+	__ldwi	4
+	  stx	__bl
+	__ldwi	4
+	  call	_put_string.3
+	__ldwi	LL0+60
+	__stw	__si
+	__ldwi	4
+	  stx	__bl
+	__ldwi	5
+	  call	_put_string.3
+LL2:
+
+	__ldwi	1
+	__tstw
+	__lbeq	LL3
+LL4:
+
+	__ldwi	0
+	  call	_joytrg
+	__cmpwi_ne	8
+	__lbeq	LL5
+	__ldwi	0
+	  call	_vsync.1
+	__lbra	LL4
+LL5:
+
+	__ldwi	0
+	  call	_vsync.1
+	__ldwi	2
+	  call	_cd_execoverlay
+	__lbra	LL2
+LL3:
+
+LL1:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+LL0:
+	.db	68,101,109,111,32,84,101,115
+	.db	116,32,79,118,101,114,108,97
+	.db	121,0,80,114,111,103,114,97
+	.db	109,32,35,49,0,80,114,101
+	.db	115,115,32,60,83,84,65,82
+	.db	84,62,32,102,111,114,32,110
+	.db	101,120,116,32,112,114,111,103
+	.db	114,97,109,0,32,32,32,32
+	.db	32,32,32,32,32,32,32,32
+	.db	32,32,32,32,32,32,32,32
+	.db	32,32,32,32,32,32,32,32
+	.db	32,32,32,32,32,32,32,32
+	.db	32,32,0
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:99
+;	constant pool:0
+;	global pool:26
+;	Macro pool:87
+huc_rodata:
+__huc_rodata:
+huc_rodata_end:
+__huc_rodata_end:
+huc_data:
+__huc_data:
+huc_data_end:
+__huc_data_end:
+__heap_start:
@@ -0,0 +1,218 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (8ab091f, 2026-10-17)
+; on Sat Oct 17 10:20:38 2026
+;
+
+HUC	= 1
+                                                                           
+SMALL	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+
+	.bss
+_vram_loaded:		.ds	1
+
+	.code
+	.code
+	.proc _main
+	__addmi	-8,__stack
+	__ldwi	328
+	__stw	__ax
+	  call	_set_xres.1
+	__ldwi	0
+	__stw	color_reg
+	__ldwi	0
+	__stw	color_data
+	__ldwi	1
+	__stw	color_reg
+	__ldwi	511
+	__stw	color_data
+	__ldwi	LL0+0
+	__stw	__si
+	__ldwi	8
+	  stx	__bl
+	__ldwi	2
+	  call	_put_string.3
+	__ldwi	LL0+18
+	__stw	__si
+	__ldwi	8
+	  stx	__bl
+	__ldwi	3
+	  call	_put_string.3
+	__ldwi	LL0+29
+	__stw	__si
+	__ldwi	4
+	  stx	__bl
+	__ldwi	4
+	  call	_put_string.3
+	__ldwi	LL0+60
+	__stw	__si
+	__ldwi	4
+	  stx	__bl
+	__ldwi	5
+	  call	_put_string.3
+LL2:
+
+	__ldwi	1
+	__tstw
+	__lbeq	LL3
+	__stwi_s	0,2
+LL4:
+
+	__ldw_s	2
+	__stw	<__temp
+	__ldwi	10
+	  jsr	ltzp
+	__lbnen	LL6
+	__lbra	LL7
+LL5:
+
+	__ldw_s	2
+	__incw_s	2
+	__lbra	LL4
+LL6:
+
+	__ldwi	_dave_init
+	__addw_s	2
+	__ldub_p
+	__stw	__dx
+	__ldwi	2
+	  stx	__cl
+	__ldwi	3
+	__pushw
+	__ldw_s	4
+	  jsr	smul
+	  stx	__bl
+	__ldwi	15
+	  call	_put_hex.4
+	__lbra	LL5
+LL7:
+
+	__ldub	_vram_loaded
+	__cmpwi_eq	1
+	__lbeq	LL8
+	__ldwi	LL0+93
+	__stw	__si
+	__ldwi	0
+	  stx	__bl
+	__ldwi	17
+	  call	_put_string.3
+	__lbra	LL9
+LL8:
+
+	__ldwi	LL0+129
+	__stw	__si
+	__ldwi	0
+	  stx	__bl
+	__ldwi	17
+	  call	_put_string.3
+LL9:
+
+	__stwi_s	0,0
+LL10:
+
+	__ldw_s	0
+	__cmpwi_ne	8
+	__lbeqn	LL12
+	__ldw_s	0
+	__cmpwi_ne	4
+LL12:
+
+	__tstw
+	__lbeqn	LL11
+	__ldwi	0
+	  call	_joytrg
+	__stw_s	0
+	__lbra	LL10
+LL11:
+
+	__ldwi	0
+	  call	_vsync.1
+	__ldw_s	0
+	__cmpwi_eq	8
+	__lbeqn	LL13
+	__ldwi	1
+	  call	_cd_execoverlay
+	__lbra	LL14
+LL13:
+
+	__ldwi	5
+	__stw	__di
+	__ldwi	0
+	__stw	__si
+	__farptr	_dave_init,__bl,__bp
+	__ldwi	10
+	  call	_cd_loaddata.4
+LL14:
+
+	__lbra	LL2
+LL3:
+
+LL1:
+
+	__addmi	8,__stack
+	  rts
+	.endp
+
+	.data
+	.bank CONST_BANK
+LL0:
+	.db	68,101,109,111,32,84,101,115
+	.db	116,32,79,118,101,114,108,97
+	.db	121,0,80,114,111,103,114,97
+	.db	109,32,35,51,0,80,114,101
+	.db	115,115,32,60,83,84,65,82
+	.db	84,62,32,102,111,114,32,110
+	.db	101,120,116,32,112,114,111,103
+	.db	114,97,109,0,80,114,101,115
+	.db	115,32,60,83,69,76,62,32
+	.db	116,111,32,108,111,97,100,32
+	.db	68,65,84,65,32,102,114,111
+	.db	109,32,67,68,0,89,111,117
+	.db	32,112,114,101,115,115,101,100
+	.db	32,60,83,69,76,62,32,105
+	.db	110,32,112,114,111,103,114,97
+	.db	109,32,50,32,32,32,32,32
+	.db	0,89,111,117,32,100,105,100
+	.db	110,39,116,32,112,114,101,115
+	.db	115,32,60,83,69,76,62,32
+	.db	105,110,32,112,114,111,103,114
+	.db	97,109,32,50,0
+_dave_init:
+	.db	0
+	.db	1
+	.db	2
+	.db	3
+	.db	4
+	.db	5
+	.db	6
+	.db	7
+	.db	8
+	.db	9
+	.db	10
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:165
+;	constant pool:11
+;	global pool:29
+;	Macro pool:87
+huc_rodata:
+__huc_rodata:
+huc_rodata_end:
+__huc_rodata_end:
+huc_data:
+__huc_data:
+huc_data_end:
+__huc_data_end:
+__heap_start:
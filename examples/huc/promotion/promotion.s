@@ -0,0 +1,145 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (8ab091f, 2026-10-17)
+; on Sat Oct 17 10:20:38 2026
+;
+
+HUC	= 1
+                                                                           
+SMALL	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.data
+_testpal:
+	.incpal "tilemap#tiles.png"
+	.code
+	.data
+_testtiles:
+	.inctile "tilemap#tiles.png"
+	.code
+	.data
+_testtable:
+	.inctilepal "tilemap#tiles.png"
+	.code
+	.data
+_testmap:
+	.incbin "tilemap.pmp#layer~Layer 1#map001.stm"
+
+	.code
+	.proc _main
+	__stwi	__main_lend-2, 0
+	  call	_disp_off
+	__ldwi	0
+	  call	_set_screen_size
+	  call	_cls
+	__farptr	_testmap,__bl,__si
+	__ldwi	16
+	__stw	__ax
+	__ldwi	16
+	  call	_set_map_data.3
+	__farptr	_testtiles,__bl,__si
+	__ldwi	256
+	__stw	__cx
+	__farptr	_testtable,__al,__dx
+	__ldwi	16
+	  stx	__ah
+	  call	_set_tile_data.4
+	__ldwi	4096
+	  call	_load_tile
+	__ldwi	0
+	  stx	__al
+	__ldwi	0
+	  stx	__ah
+	__ldwi	0
+	__stw	__di
+	__ldwi	0
+	__stw	__bx
+	__ldwi	16
+	  stx	__dl
+	__ldwi	16
+	  stx	__dh
+	  call	_load_map.6
+	__ldwi	0
+	  stx	__al
+	__farptr	_testpal,__bl,__si
+	__ldwi	16
+	  stx	__cl
+	  call	_load_palette.3
+	__ldwi	0
+	__pushw
+	__ldwi	0
+	__pushw
+	__ldw	__main_lend-2
+	__asrwi	1
+	__pushw
+	__ldwi	0
+	__pushw
+	__ldwi	223
+	__pushw
+	__ldwi	192
+	  call	_scroll
+	  call	_disp_on
+	  call	_vsync
+LL2:
+
+LL3:
+
+LL4:
+
+	__ldwi	__main_lend-2
+	incw	__main_lend-2
+	__ldw	__main_lend-2
+	__andwi	511
+	__stw	__main_lend-2
+	__ldwi	0
+	__pushw
+	__ldwi	0
+	__pushw
+	__ldw	__main_lend-2
+	__asrwi	1
+	__pushw
+	__ldwi	0
+	__pushw
+	__ldwi	223
+	__pushw
+	__ldwi	192
+	  call	_scroll
+	  call	_vsync
+	__lbra	LL4
+LL5:
+
+LL1:
+
+	  rts
+	.endp
+	.data
+	.bss
+	__main_loc: .ds 2
+	__main_lend:
+	.code
+
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:34
+;	Macro pool:84
+huc_rodata:
+__huc_rodata:
+huc_rodata_end:
+__huc_rodata_end:
+huc_data:
+__huc_data:
+huc_data_end:
+__huc_data_end:
+__heap_start:
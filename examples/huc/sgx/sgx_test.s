@@ -0,0 +1,271 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (8ab091f, 2026-10-17)
+; on Sat Oct 17 10:20:38 2026
+;
+
+HUC	= 1
+                                                                           
+_SGX = 1
+SMALL	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.data
+_map:
+	.incbin "pce_bat1.bin"
+
+	.code
+	.data
+_tile:
+	.incbin "pce_tile1.bin"
+
+	.code
+	.data
+_pal:
+	.incbin "pce_pal1.bin"
+
+	.code
+	.proc _main
+	  call	_disp_off
+	  call	_vsync
+	  call	_spr_set
+	  call	_spr_hide
+	  call	_load_default_font
+	__ldwi	0
+	  call	_set_screen_size
+	  call	_disp_on
+	  call	_sgx_detect
+	__notw
+	__lbeq	LL2
+	__ldwi	LL0+0
+	__stw	__si
+	__ldwi	2
+	  stx	__bl
+	__ldwi	13
+	  call	_put_string.3
+LL3:
+
+LL4:
+
+LL5:
+
+	__lbran	LL5
+LL6:
+
+LL2:
+
+	__ldwi	0
+	  stx	__al
+	__ldwi	511
+	__stw	__bx
+	  call	_vpc_win_size.2
+	__ldwi	1
+	  stx	__al
+	__ldwi	511
+	__stw	__bx
+	  call	_vpc_win_size.2
+	__ldwi	0
+	  stx	__al
+	__ldwi	3
+	  stx	__bl
+	  call	_vpc_win_reg.2
+	__ldwi	1
+	  stx	__al
+	__ldwi	3
+	  stx	__bl
+	  call	_vpc_win_reg.2
+	__ldwi	2
+	  stx	__al
+	__ldwi	3
+	  stx	__bl
+	  call	_vpc_win_reg.2
+	__ldwi	3
+	  stx	__al
+	__ldwi	3
+	  stx	__bl
+	  call	_vpc_win_reg.2
+	__ldwi	4
+	  call	_set_font_pal
+	__ldwi	14
+	  stx	__al
+	__ldwi	0
+	  call	_set_font_color.2
+	__ldwi	LL0+29
+	__stw	__si
+	__ldwi	2
+	  stx	__bl
+	__ldwi	3
+	  call	_put_string.3
+	__ldwi	0
+	  call	_sgx_set_screen_size.1
+	__ldwi	0
+	__stw	__di
+	__farptr	_map,__bl,__si
+	__ldwi	1024
+	__stw	__cx
+	  call	_sgx_load_vram.3
+	__ldwi	4096
+	__stw	__di
+	__farptr	_tile,__bl,__si
+	__ldwi	16384
+	__stw	__cx
+	  call	_sgx_load_vram.3
+	__ldwi	0
+	  stx	__al
+	__farptr	_pal,__bl,__si
+	__ldwi	16
+	  stx	__cl
+	  call	_load_palette.3
+	  call	_sgx_spr_hide
+	__ldwi	1
+	  call	_sgx_spr_set.1
+	  call	_sgx_disp_on
+	__ldwi	LL0+48
+	__stw	__si
+	__ldwi	2
+	  stx	__bl
+	__ldwi	6
+	  call	_put_string.3
+	__ldwi	LL0+69
+	__stw	__si
+	__ldwi	2
+	  stx	__bl
+	__ldwi	8
+	  call	_put_string.3
+	__ldwi	LL0+96
+	__stw	__si
+	__ldwi	2
+	  stx	__bl
+	__ldwi	9
+	  call	_put_string.3
+	__ldwi	__main_lend-2
+	__stbi	__main_lend-3, 1
+	  stx	__main_lend-2
+LL7:
+
+LL8:
+
+LL9:
+
+	__stbi	__main_lend-5, 0
+LL11:
+
+	__ldub	__main_lend-5
+	__stw	<__temp
+	__ldwi	255
+	  jsr	ltzp
+	__lbnen	LL13
+	__lbra	LL14
+LL12:
+
+	__ldub	__main_lend-5
+	inc	__main_lend-5
+	__lbra	LL11
+LL13:
+
+	  call	_vsync
+	__ldub	__main_lend-5
+	__stw	__ax
+	__ldub	__main_lend-5
+	__stw	__bx
+	  call	_sgx_scroll.2
+	__ldwi	0
+	  call	_joytrg
+	  stx	__main_lend-1
+	__ldub	__main_lend-1
+	__andwi	1
+	__tstw
+	__lbeq	LL15
+	__ldub	__main_lend-2
+	__notw
+	  stx	__main_lend-2
+	__ldub	__main_lend-2
+	__tstw
+	__lbeqn	LL16
+	  call	_disp_on
+	__lbran	LL17
+LL16:
+
+	  call	_disp_off
+LL17:
+
+LL15:
+
+	__ldub	__main_lend-1
+	__andwi	2
+	__tstw
+	__lbeq	LL18
+	__ldub	__main_lend-3
+	__notw
+	  stx	__main_lend-3
+	__ldub	__main_lend-3
+	__tstw
+	__lbeqn	LL19
+	  call	_sgx_disp_on
+	__lbran	LL20
+LL19:
+
+	  call	_sgx_disp_off
+LL20:
+
+LL18:
+
+	__lbra	LL12
+LL14:
+
+	__lbra	LL9
+LL10:
+
+LL1:
+
+	  rts
+	.endp
+	.data
+	.bss
+	__main_loc: .ds 9
+	__main_lend:
+	.code
+
+	.data
+	.bank CONST_BANK
+LL0:
+	.db	72,97,108,116,58,32,83,71
+	.db	88,32,110,111,116,32,104,97
+	.db	114,100,119,97,114,101,32,102
+	.db	111,117,110,100,0,83,71,88
+	.db	32,104,97,114,100,119,97,114
+	.db	101,32,102,111,117,110,100,0
+	.db	83,99,114,111,108,108,105,110
+	.db	103,32,83,71,88,32,108,97
+	.db	121,101,114,32,0,73,32,32
+	.db	61,32,84,111,103,103,108,101
+	.db	32,110,111,114,109,97,108,32
+	.db	100,105,115,112,108,97,121,0
+	.db	73,73,32,61,32,84,111,103
+	.db	103,108,101,32,83,71,88,32
+	.db	100,105,115,112,108,97,121,0
+
+	.bss
+
+;0 error(s) in compilation
+;	literal pool:120
+;	constant pool:0
+;	global pool:52
+;	Macro pool:96
+huc_rodata:
+__huc_rodata:
+huc_rodata_end:
+__huc_rodata_end:
+huc_data:
+__huc_data:
+huc_data_end:
+__huc_data_end:
+__heap_start:
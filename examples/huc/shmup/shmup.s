@@ -0,0 +1,1092 @@
+; Small C HuC6280 (v0.2, 08/Nov/97)
+;
+; Taken to HuC (22/Feb/00)
+;
+;
+; This file generated by HuC (8ab091f, 2026-10-17)
+; on Sat Oct 17 10:20:38 2026
+;
+
+HUC	= 1
+                                                                           
+SMALL	= 1
+
+	.include "startup.asm"
+	.data
+	.bank DATA_BANK
+
+	.code
+
+	.data
+_bonk:
+	.incspr "charwalk.pcx",0,0,2,8
+	.code
+	.data
+_bonkpal:
+	.incpal "charwalk.pcx"
+	.code
+	.data
+_bullet:
+	.incspr "bullet.pcx",0,0,1,1
+	.code
+	.data
+_bulletpal:
+	.incpal "bullet.pcx"
+	.code
+	.data
+_ship:
+	.incspr "ship.pcx",0,0,2,8
+	.code
+	.data
+_shippal:
+	.incpal "ship.pcx"
+	.code
+	.data
+_explosion:
+	.incspr "explosion.pcx",0,0,2,16
+	.code
+	.data
+_explosionpal:
+	.incpal "explosion.pcx"
+	.code
+	.data
+_scene_chr:
+	.incchr "scene.png"
+	.code
+	.data
+_scene_pal:
+	.incpal "scene.png"
+	.code
+	.data
+_scene_bat:
+	.incbat "scene.png",4096,32,28
+	.code
+	.proc _do_ships
+	__ldwi	__do_ships_lend-5
+	  call	_rand
+	  stx	__do_ships_lend-5
+	__ldub	__do_ships_lend-5
+	__andwi	126
+	__cmpwi_eq	2
+	__lbeq	LL2
+	__stwz	__do_ships_lend-2
+	__stwi	__do_ships_lend-7, _ships
+LL3:
+
+	__ldw	__do_ships_lend-2
+	__stw	<__temp
+	__ldwi	5
+	  jsr	ultzp
+	__lbnen	LL5
+	__lbra	LL6
+LL4:
+
+	incw	__do_ships_lend-2
+	__ldw	__do_ships_lend-7
+	__addwi	7
+	__stw	__do_ships_lend-7
+	__lbra	LL3
+LL5:
+
+	__ldw	__do_ships_lend-7
+	__addwi	4
+	__ldb_p
+	__notw
+	__lbeq	LL7
+	__ldw	__do_ships_lend-7
+	__addwi	4
+	__stbip	1
+	__ldwi	11
+	__addw	__do_ships_lend-2
+	  call	_spr_set
+	__ldub	__do_ships_lend-5
+	__andwi	1
+	__tstw
+	__lbeq	LL8
+	__ldwi	185
+	  stx	__al
+	__ldwi	25
+	  call	_spr_ctrl.2
+	__ldw	__do_ships_lend-7
+	__addwi	5
+	__stbip	1
+	__ldw	__do_ships_lend-7
+	__addwi	6
+	__stbip	0
+	__ldw	__do_ships_lend-7
+	__stwip	-32
+	__lbra	LL9
+LL8:
+
+	__ldwi	185
+	  stx	__al
+	__ldwi	17
+	  call	_spr_ctrl.2
+	__ldw	__do_ships_lend-7
+	__addwi	5
+	__stbip	-1
+	__ldw	__do_ships_lend-7
+	__addwi	6
+	__stbip	0
+	__ldw	__do_ships_lend-7
+	__stwip	256
+LL9:
+
+	__ldw	__do_ships_lend-7
+	__addwi	2
+	__pushw
+	  call	_rand
+	__pushw
+	__ldwi	210
+	  jsr	smod
+	__stwps
+	__lbran	LL6
+LL7:
+
+	__lbra	LL4
+LL6:
+
+LL2:
+
+	__stwz	__do_ships_lend-2
+	__stwi	__do_ships_lend-7, _ships
+LL10:
+
+	__ldw	__do_ships_lend-2
+	__stw	<__temp
+	__ldwi	5
+	  jsr	ultzp
+	__lbnen	LL12
+	__lbra	LL13
+LL11:
+
+	incw	__do_ships_lend-2
+	__ldw	__do_ships_lend-7
+	__addwi	7
+	__stw	__do_ships_lend-7
+	__lbra	LL10
+LL12:
+
+	__ldw	__do_ships_lend-7
+	__addwi	4
+	__ldb_p
+	__tstw
+	__lbeq	LL14
+	__ldwi	11
+	__addw	__do_ships_lend-2
+	  call	_spr_set
+	__ldw	__do_ships_lend-7
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_spr_x
+	__ldw	__do_ships_lend-7
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_spr_y
+	__ldw	__do_ships_lend-7
+	__addwi	4
+	__ldb_p
+	__stw	<__temp
+	__ldwi	1
+	  jsr	gtzp
+	__lbeq	LL15
+	__ldw	__do_ships_lend-7
+	__addwi	4
+	__ldb_p
+	__asrwi	3
+	__aslwi	8
+	__addwi	22784
+	  call	_spr_pattern
+	__ldwi	3
+	  call	_spr_pal
+	__ldw	__do_ships_lend-7
+	__addwi	4
+	__addbi_p	1
+	__ldw	__do_ships_lend-7
+	__addwi	4
+	__ldb_p
+	__cmpwi_eq	64
+	__lbeq	LL16
+	__ldw	__do_ships_lend-7
+	__addwi	4
+	__stbip	0
+	__ldwi	-32
+	  call	_spr_x
+	__ldwi	16
+	  call	_spr_y
+	__ldwi	2
+	  call	_spr_pal
+LL16:
+
+	__lbra	LL17
+LL15:
+
+	__ldw	_frames
+	__lsrwi	4
+	__andwi	3
+	__aslwi	8
+	__addwi	21760
+	  call	_spr_pattern
+	__stwz	__do_ships_lend-4
+	__stwi	__do_ships_lend-9, _bullets
+LL18:
+
+	__ldw	__do_ships_lend-4
+	__stw	<__temp
+	__ldwi	10
+	  jsr	ultzp
+	__lbnen	LL20
+	__lbra	LL21
+LL19:
+
+	incw	__do_ships_lend-4
+	__ldw	__do_ships_lend-9
+	__addwi	5
+	__stw	__do_ships_lend-9
+	__lbra	LL18
+LL20:
+
+	__ldw	__do_ships_lend-9
+	__addwi	4
+	__ldb_p
+	__tstw
+	__lbeq	LL22
+	__ldw	__do_ships_lend-9
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__do_ships_lend-7
+	__stw	<__ptr
+	__ldwp	__ptr
+	__subwi	4
+	  jsr	gt
+	__lbeq	LL24
+	__ldw	__do_ships_lend-9
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__do_ships_lend-7
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	20
+	  jsr	lt
+LL24:
+
+	__tstw
+	__lbeq	LL25
+	__ldw	__do_ships_lend-9
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__do_ships_lend-7
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__subwi	3
+	  jsr	gt
+LL25:
+
+	__tstw
+	__lbeq	LL26
+	__ldw	__do_ships_lend-9
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__do_ships_lend-7
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__addwi	16
+	  jsr	lt
+LL26:
+
+	__tstw
+	__lbeq	LL23
+	__ldw	__do_ships_lend-7
+	__addwi	4
+	__stbip	2
+	__ldw	__do_ships_lend-7
+	__addwi	5
+	__stbip	0
+	__ldw	__do_ships_lend-7
+	__addwi	6
+	__stbip	0
+	__ldw	__do_ships_lend-9
+	__addwi	4
+	__stbip	0
+	__ldwi	1
+	__addw	__do_ships_lend-4
+	  call	_spr_set
+	__ldwi	-16
+	  call	_spr_x
+	__ldwi	0
+	  call	_spr_y
+	__ldw	_score
+	__addwi	100
+	__stw	_score
+LL23:
+
+LL22:
+
+	__lbra	LL19
+LL21:
+
+LL17:
+
+	__ldw	__do_ships_lend-7
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__do_ships_lend-7
+	__addwi	5
+	__ldb_p
+	__addws
+	__stwps
+	__ldw	__do_ships_lend-7
+	__addwi	2
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__do_ships_lend-7
+	__addwi	6
+	__ldb_p
+	__addws
+	__stwps
+	__ldw	__do_ships_lend-7
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	<__temp
+	__ldwi	256
+	  jsr	gtzp
+	__lbnen	LL28
+	__ldw	__do_ships_lend-7
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	<__temp
+	__ldwi	-32
+	  jsr	ltzp
+LL28:
+
+	__tstw
+	__lbeqn	LL27
+	__ldw	__do_ships_lend-7
+	__addwi	4
+	__stbip	0
+	__ldwi	-32
+	  call	_spr_x
+	__ldwi	16
+	  call	_spr_y
+LL27:
+
+LL14:
+
+	__lbra	LL11
+LL13:
+
+LL1:
+
+	  rts
+	.endp
+	.data
+	.bss
+	__do_ships_loc: .ds 9
+	__do_ships_lend:
+	.code
+
+	.proc _main
+	__ldwi	0
+	__stw	_hiscore
+LL30:
+
+LL31:
+
+LL32:
+
+	__stwz	__main_lend-8
+	__ldwi	0
+	__stw	_frames
+	__ldwi	0
+	__stw	_score
+	stz	__main_lend-14
+	__stwi	__main_lend-4, 104
+	__stwi	__main_lend-6, 153
+	stz	__main_lend-11
+	__stbi	__main_lend-12, 1
+	  call	_init_satb
+	__ldwi	0
+	  call	_spr_set
+	__ldw	__main_lend-4
+	  call	_spr_x
+	__ldw	__main_lend-6
+	  call	_spr_y
+	__ldwi	20480
+	  call	_spr_pattern
+	__ldwi	185
+	  stx	__al
+	__ldwi	25
+	  call	_spr_ctrl.2
+	__ldwi	0
+	  call	_spr_pal
+	__ldwi	1
+	  call	_spr_pri
+	__stbi	__main_lend-9, 0
+LL34:
+
+	__ldub	__main_lend-9
+	__stw	<__temp
+	__ldwi	10
+	  jsr	ltzp
+	__lbnen	LL36
+	__lbra	LL37
+LL35:
+
+	__ldub	__main_lend-9
+	inc	__main_lend-9
+	__lbra	LL34
+LL36:
+
+	__ldwi	1
+	__addub	__main_lend-9
+	  call	_spr_set
+	__ldwi	-16
+	  call	_spr_x
+	__ldwi	0
+	  call	_spr_y
+	__ldwi	21504
+	  call	_spr_pattern
+	__ldwi	185
+	  stx	__al
+	__ldwi	0
+	  call	_spr_ctrl.2
+	__ldwi	1
+	  call	_spr_pal
+	__ldwi	1
+	  call	_spr_pri
+	__ldub	__main_lend-9
+	__mulwi	5
+	__addwi_sym	_bullets
+	__addwi	4
+	__stbip	0
+	__lbra	LL35
+LL37:
+
+	__stbi	__main_lend-9, 0
+LL38:
+
+	__ldub	__main_lend-9
+	__stw	<__temp
+	__ldwi	5
+	  jsr	ltzp
+	__lbnen	LL40
+	__lbra	LL41
+LL39:
+
+	__ldub	__main_lend-9
+	inc	__main_lend-9
+	__lbra	LL38
+LL40:
+
+	__ldwi	11
+	__addub	__main_lend-9
+	  call	_spr_set
+	__ldwi	-32
+	  call	_spr_x
+	__ldwi	16
+	  call	_spr_y
+	__ldwi	21760
+	  call	_spr_pattern
+	__ldwi	185
+	  stx	__al
+	__ldwi	17
+	  call	_spr_ctrl.2
+	__ldwi	2
+	  call	_spr_pal
+	__ldwi	1
+	  call	_spr_pri
+	__ldub	__main_lend-9
+	__mulwi	7
+	__addwi_sym	_ships
+	__addwi	4
+	__stbip	0
+	__lbra	LL39
+LL41:
+
+	__ldwi	16
+	  stx	__al
+	__farptr	_bonkpal,__bl,__si
+	__ldwi	1
+	  stx	__cl
+	  call	_load_palette.3
+	__ldwi	17
+	  stx	__al
+	__farptr	_bulletpal,__bl,__si
+	__ldwi	1
+	  stx	__cl
+	  call	_load_palette.3
+	__ldwi	18
+	  stx	__al
+	__farptr	_shippal,__bl,__si
+	__ldwi	1
+	  stx	__cl
+	  call	_load_palette.3
+	__ldwi	19
+	  stx	__al
+	__farptr	_explosionpal,__bl,__si
+	__ldwi	1
+	  stx	__cl
+	  call	_load_palette.3
+	__ldwi	20480
+	__stw	__di
+	__farptr	_bonk,__bl,__si
+	__ldwi	1024
+	__stw	__cx
+	  call	_load_vram.3
+	__ldwi	21504
+	__stw	__di
+	__farptr	_bullet,__bl,__si
+	__ldwi	64
+	__stw	__cx
+	  call	_load_vram.3
+	__ldwi	21760
+	__stw	__di
+	__farptr	_ship,__bl,__si
+	__ldwi	1024
+	__stw	__cx
+	  call	_load_vram.3
+	__ldwi	22784
+	__stw	__di
+	__farptr	_explosion,__bl,__si
+	__ldwi	2048
+	__stw	__cx
+	  call	_load_vram.3
+	  call	_satb_update
+	_load_background	_scene_chr,_scene_pal,_scene_bat,#32,#28
+	__ldwi	15
+	  stx	__al
+	__ldwi	6
+	  call	_set_font_color.2
+	  call	_load_default_font
+LL42:
+
+	__ldub	__main_lend-14
+	__notw
+	__lbeq	LL43
+	  call	_vsync
+	__ldwi	0
+	  call	_joy
+	__stw	__main_lend-2
+	__ldwi	0
+	  call	_joytrg
+	__andwi	8
+	__tstw
+	__lbeq	LL44
+	  call	_vsync
+LL45:
+
+	__ldwi	0
+	  call	_joytrg
+	__andwi	8
+	__notw
+	__lbeq	LL46
+	  call	_vsync
+	__lbra	LL45
+LL46:
+
+LL44:
+
+	__ldw	__main_lend-2
+	__andwi	128
+	__tstw
+	__lbeq	LL47
+	__ldwi	8
+	  stx	__al
+	__ldwi	0
+	  call	_spr_ctrl.2
+	__ldw	__main_lend-4
+	__stw	<__temp
+	__ldwi	-8
+	  jsr	gtzp
+	__lbeqn	LL48
+	__ldw	__main_lend-4
+	__subwi	2
+	__stw	__main_lend-4
+LL48:
+
+	__ldw	__main_lend-8
+	incw	__main_lend-8
+	__stbi	__main_lend-12, -1
+LL47:
+
+	__ldw	__main_lend-2
+	__andwi	32
+	__tstw
+	__lbeq	LL49
+	__ldwi	8
+	  stx	__al
+	__ldwi	8
+	  call	_spr_ctrl.2
+	__ldw	__main_lend-4
+	__stw	<__temp
+	__ldwi	232
+	  jsr	ltzp
+	__lbeqn	LL50
+	__ldw	__main_lend-4
+	__addwi	2
+	__stw	__main_lend-4
+LL50:
+
+	__ldw	__main_lend-8
+	incw	__main_lend-8
+	__stbi	__main_lend-12, 1
+LL49:
+
+	__ldw	__main_lend-2
+	__andwi	16
+	__tstw
+	__lbeq	LL51
+	__ldw	__main_lend-6
+	__stw	<__temp
+	__ldwi	-8
+	  jsr	gtzp
+	__lbeqn	LL52
+	__ldw	__main_lend-6
+	__subwi	2
+	__stw	__main_lend-6
+LL52:
+
+LL51:
+
+	__ldw	__main_lend-2
+	__andwi	64
+	__tstw
+	__lbeq	LL53
+	__ldw	__main_lend-6
+	__stw	<__temp
+	__ldwi	212
+	  jsr	ltzp
+	__lbeqn	LL54
+	__ldw	__main_lend-6
+	__addwi	2
+	__stw	__main_lend-6
+LL54:
+
+LL53:
+
+	__ldw	__main_lend-2
+	__andwi	2
+	__tstw
+	__lbeqn	LL56
+	__ldub	__main_lend-11
+	__notw
+LL56:
+
+	__tstw
+	__lbeq	LL55
+	__stwi	__main_lend-18, _bullets
+	__stbi	__main_lend-9, 0
+LL57:
+
+	__ldub	__main_lend-9
+	__stw	<__temp
+	__ldwi	10
+	  jsr	ltzp
+	__lbnen	LL59
+	__lbra	LL60
+LL58:
+
+	inc	__main_lend-9
+	__ldw	__main_lend-18
+	__addwi	5
+	__stw	__main_lend-18
+	__lbra	LL57
+LL59:
+
+	__ldw	__main_lend-18
+	__addwi	4
+	__ldb_p
+	__notw
+	__lbeq	LL61
+	__ldw	__main_lend-18
+	__addwi	4
+	__pushw
+	__ldb	__main_lend-12
+	__stbps
+	__ldw	__main_lend-18
+	__pushw
+	__ldw	__main_lend-4
+	__addwi	8
+	__pushw
+	__ldb	__main_lend-12
+	__aslwi	4
+	__addws
+	__stwps
+	__ldw	__main_lend-18
+	__addwi	2
+	__pushw
+	__ldw	__main_lend-6
+	__addwi	10
+	__stwps
+	__stbi	__main_lend-11, 10
+	__ldwi	1
+	__addub	__main_lend-9
+	  call	_spr_set
+	__ldb	__main_lend-12
+	__stw	<__temp
+	__ldwi	0
+	  jsr	gtzp
+	__lbeq	LL62
+	__ldwi	8
+	  stx	__al
+	__ldwi	8
+	  call	_spr_ctrl.2
+	__lbra	LL63
+LL62:
+
+	__ldwi	8
+	  stx	__al
+	__ldwi	0
+	  call	_spr_ctrl.2
+LL63:
+
+	__lbran	LL60
+LL61:
+
+	__lbra	LL58
+LL60:
+
+LL55:
+
+	__ldub	__main_lend-11
+	__tstw
+	__lbeqn	LL64
+	__ldub	__main_lend-11
+	__subwi	1
+	  stx	__main_lend-11
+	__addwi	1
+LL64:
+
+	__stwi	__main_lend-18, _bullets
+	__stbi	__main_lend-9, 0
+LL65:
+
+	__ldub	__main_lend-9
+	__stw	<__temp
+	__ldwi	10
+	  jsr	ltzp
+	__lbnen	LL67
+	__lbra	LL68
+LL66:
+
+	__ldub	__main_lend-9
+	inc	__main_lend-9
+	__lbra	LL65
+LL67:
+
+	__ldw	__main_lend-18
+	__addwi	4
+	__ldb_p
+	__tstw
+	__lbeq	LL69
+	__ldwi	1
+	__addub	__main_lend-9
+	  call	_spr_set
+	__ldw	__main_lend-18
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_spr_x
+	__ldw	__main_lend-18
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	  call	_spr_y
+	__ldw	__main_lend-18
+	__pushw
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__main_lend-18
+	__addwi	4
+	__ldb_p
+	__aslwi	2
+	__addws
+	__stwps
+	__ldw	__main_lend-18
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	<__temp
+	__ldwi	256
+	  jsr	gtzp
+	__lbnen	LL71
+	__ldw	__main_lend-18
+	__stw	<__ptr
+	__ldwp	__ptr
+	__stw	<__temp
+	__ldwi	-16
+	  jsr	ltzp
+LL71:
+
+	__tstw
+	__lbeqn	LL70
+	__ldw	__main_lend-18
+	__addwi	4
+	__stbip	0
+	__ldwi	-16
+	  call	_spr_x
+	__ldwi	0
+	  call	_spr_y
+LL70:
+
+LL69:
+
+	__ldw	__main_lend-18
+	__addwi	5
+	__stw	__main_lend-18
+	__lbra	LL66
+LL68:
+
+	  call	_do_ships
+	__stwi	__main_lend-16, _ships
+	__stbi	__main_lend-9, 0
+LL72:
+
+	__ldub	__main_lend-9
+	__stw	<__temp
+	__ldwi	5
+	  jsr	ltzp
+	__lbnen	LL74
+	__lbra	LL75
+LL73:
+
+	__ldub	__main_lend-9
+	inc	__main_lend-9
+	__lbra	LL72
+LL74:
+
+	__ldw	__main_lend-16
+	__addwi	4
+	__ldb_p
+	__cmpwi_eq	1
+	__lbeq	LL77
+	__ldw	__main_lend-16
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__main_lend-4
+	__subwi	24
+	  jsr	gt
+	__lbeqn	LL78
+	__ldw	__main_lend-16
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__main_lend-4
+	__addwi	24
+	  jsr	lt
+LL78:
+
+	__tstw
+	__lbeqn	LL79
+	__ldw	__main_lend-16
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__main_lend-6
+	__subwi	20
+	  jsr	gt
+LL79:
+
+	__tstw
+	__lbeqn	LL80
+	__ldw	__main_lend-16
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__main_lend-6
+	__addwi	9
+	  jsr	lt
+LL80:
+
+	__tstw
+	__lbne	LL81
+	__ldw	__main_lend-16
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__main_lend-4
+	__subwi	18
+	  jsr	gt
+	__lbeqn	LL82
+	__ldw	__main_lend-16
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__main_lend-4
+	__addwi	18
+	  jsr	lt
+LL82:
+
+	__tstw
+	__lbeqn	LL83
+	__ldw	__main_lend-16
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__main_lend-6
+	__addwi	8
+	  jsr	gt
+LL83:
+
+	__tstw
+	__lbeqn	LL84
+	__ldw	__main_lend-16
+	__addwi	2
+	__stw	<__ptr
+	__ldwp	__ptr
+	__pushw
+	__ldw	__main_lend-6
+	__addwi	25
+	  jsr	lt
+LL84:
+
+	__boolw
+LL81:
+
+	__boolw
+LL77:
+
+	__tstw
+	__lbeq	LL76
+	__ldwi	LL0+0
+	__stw	__si
+	__ldwi	11
+	  stx	__bl
+	__ldwi	12
+	  call	_put_string.3
+	__stbi	__main_lend-10, 0
+LL85:
+
+	__ldub	__main_lend-10
+	__stw	<__temp
+	__ldwi	100
+	  jsr	ltzp
+	__lbnen	LL87
+	__lbra	LL88
+LL86:
+
+	__ldub	__main_lend-10
+	inc	__main_lend-10
+	__lbra	LL85
+LL87:
+
+	  call	_vsync
+	__lbra	LL86
+LL88:
+
+	__stbi	__main_lend-14, 1
+	__ldw	_score
+	__stw	<__temp
+	__ldw	_hiscore
+	  jsr	ugtzp
+	__lbeqn	LL89
+	__ldw	_score
+	__stw	_hiscore
+LL89:
+
+LL76:
+
+	__ldw	__main_lend-16
+	__addwi	7
+	__stw	__main_lend-16
+	__subwi	7
+	__lbra	LL73
+LL75:
+
+	__ldwi	0
+	  call	_spr_set
+	__ldw	__main_lend-4
+	  call	_spr_x
+	__ldw	__main_lend-6
+	  call	_spr_y
+	__ldw	__main_lend-8
+	__lsrwi	2
+	__andwi	3
+	__aslwi	8
+	__addwi	20480
+	  call	_spr_pattern
+	  call	_satb_update
+	__ldw	_score
+	__stw	__dx
+	__ldwi	5
+	  stx	__cl
+	__ldwi	26
+	  stx	__bl
+	__ldwi	1
+	  call	_put_number.4
+	__ldwi	LL0+10
+	__stw	__si
+	__ldwi	1
+	  stx	__bl
+	__ldwi	1
+	  call	_put_string.3
+	__ldw	_hiscore
+	__stw	__dx
+	__ldwi	5
+	  stx	__cl
+	__ldwi	4
+	  stx	__bl
+	__ldwi	1
+	  call	_put_number.4
+	__ldw	_frames
+	incw	_frames
+	__lbra	LL42
+LL43:
+
+	__lbra	LL32
+LL33:
+
+LL29:
+
+	  rts
+	.endp
+	.data
+	.bss
+	__main_loc: .ds 18
+	__main_lend:
+	.code
+
+	.data
+	.bank CONST_BANK
+LL0:
+	.db	71,65,77,69,32,79,86,69
+	.db	82,0,72,73,0
+
+	.bss
+_bullets:		.ds	50
+_ships:		.ds	35
+_frames:		.ds	2
+_score:		.ds	2
+_hiscore:		.ds	2
+
+
+;0 error(s) in compilation
+;	literal pool:13
+;	constant pool:0
+;	global pool:55
+;	Macro pool:89
+huc_rodata:
+__huc_rodata:
+huc_rodata_end:
+__huc_rodata_end:
+huc_data:
+__huc_data:
+huc_data_end:
+__huc_data_end:
+__heap_start:
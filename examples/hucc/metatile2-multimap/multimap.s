@@ -0,0 +1,1858 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (b16933f, 2026-10-17)
+; on Sat Oct 17 10:20:37 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"../../../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 3; //
+	.dbg	line,	"../../../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"../../../include/hucc/globals.h", 5; //
+	.dbg	line,	"../../../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 8; //
+	.dbg	line,	"../../../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"../../../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"../../../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"../../../include/hucc/globals.h", 12; //
+	.dbg	line,	"../../../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"../../../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"../../../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"../../../include/hucc/globals.h", 16; //
+	.dbg	line,	"../../../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"multimap.c", 1; /****************************************************************************
+	.dbg	line,	"multimap.c", 2; ; ***************************************************************************
+	.dbg	line,	"multimap.c", 3; ;
+	.dbg	line,	"multimap.c", 4; ; multimap.c
+	.dbg	line,	"multimap.c", 5; ;
+	.dbg	line,	"multimap.c", 6; ; An example of building and scrolling a multi-screen block map.
+	.dbg	line,	"multimap.c", 7; ;
+	.dbg	line,	"multimap.c", 8; ; Copyright John Brandwood 2025.
+	.dbg	line,	"multimap.c", 9; ;
+	.dbg	line,	"multimap.c", 10; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"multimap.c", 11; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"multimap.c", 12; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"multimap.c", 13; ;
+	.dbg	line,	"multimap.c", 14; ; ***************************************************************************
+	.dbg	line,	"multimap.c", 15; ; ***************************************************************************
+	.dbg	line,	"multimap.c", 16; ;
+	.dbg	line,	"multimap.c", 17; ; This expands upon the previous example and shows how to use a multi-screen
+	.dbg	line,	"multimap.c", 18; ; map to work around the limited 128x128 block dimensions of normal maps.
+	.dbg	line,	"multimap.c", 19; ;
+	.dbg	line,	"multimap.c", 20; ; This works by splitting a large map (up to 32768 pixels wide or high) into
+	.dbg	line,	"multimap.c", 21; ; smaller areas, each the same size as the PC Engine's BAT, which can be set
+	.dbg	line,	"multimap.c", 22; ; from 32x32 to 128x64 characters in size, with 64x32 or 32x32 as the normal
+	.dbg	line,	"multimap.c", 23; ; choices.
+	.dbg	line,	"multimap.c", 24; ;
+	.dbg	line,	"multimap.c", 25; ; Each of the smaller areas is called a "screen", and a multi-screen map can
+	.dbg	line,	"multimap.c", 26; ; use up to 1024 screens in order to build very large maps.
+	.dbg	line,	"multimap.c", 27; ;
+	.dbg	line,	"multimap.c", 28; ; While the previous example showed how to force certain 8x8 characters into
+	.dbg	line,	"multimap.c", 29; ; VRAM at specific addresses in order to perform background anbimation, this
+	.dbg	line,	"multimap.c", 30; ; expands upon the technique to show how to force specific block graphics to
+	.dbg	line,	"multimap.c", 31; ; use specific block numbers, so that the game can detect them in the map if
+	.dbg	line,	"multimap.c", 32; ; a player touches them.
+	.dbg	line,	"multimap.c", 33; ;
+	.dbg	line,	"multimap.c", 34; ; ***************************************************************************
+	.dbg	line,	"multimap.c", 35; ; ***************************************************************************
+	.dbg	line,	"multimap.c", 36; ;
+	.dbg	line,	"multimap.c", 37; ; This uses the Seran Village map from Falcom's "Legend of Xanadu 2" game.
+	.dbg	line,	"multimap.c", 38; ;
+	.dbg	line,	"multimap.c", 39; ; See the README.md file in the "../seran/" directory for more information.
+	.dbg	line,	"multimap.c", 40; ;
+	.dbg	line,	"multimap.c", 41; ; ***************************************************************************
+	.dbg	line,	"multimap.c", 42; ; **************************************************************************/
+	.dbg	line,	"multimap.c", 44; #include "huc.h"
+	.dbg	line,	"../../../include/hucc/huc.h", 1; #ifndef _hucc_legacy_h
+	.dbg	line,	"../../../include/hucc/huc.h", 2; #define _hucc_legacy_h
+	.dbg	line,	"../../../include/hucc/huc.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 6; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 7; ; huc.h
+	.dbg	line,	"../../../include/hucc/huc.h", 8; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 9; ; HuCC wrapper file to include a default set of HuC-compatible functions.
+	.dbg	line,	"../../../include/hucc/huc.h", 10; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/huc.h", 12; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/huc.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/huc.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/huc.h", 16; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 19; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 20; ; When the HuCC compiler is invoked with the "--legacy" option to compile old
+	.dbg	line,	"../../../include/hucc/huc.h", 21; ; projects, then this "huc.h" file is automatically included.
+	.dbg	line,	"../../../include/hucc/huc.h", 22; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 23; ; This file includes a set of the individual HuCC headers which correspond to
+	.dbg	line,	"../../../include/hucc/huc.h", 24; ; HuC's built-in functions and MagicKit library.
+	.dbg	line,	"../../../include/hucc/huc.h", 25; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 26; ; New HuCC projects should, preferably, include the specific headers that are
+	.dbg	line,	"../../../include/hucc/huc.h", 27; ; needed, which will then allow them to replace parts of the standard library
+	.dbg	line,	"../../../include/hucc/huc.h", 28; ; with newer functions, or they can just manually include this "huc.h" file.
+	.dbg	line,	"../../../include/hucc/huc.h", 29; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 30; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 31; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/huc.h", 33; #include "hucc-systemcard.h"
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 1; #ifndef _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 2; #define _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 7; ; hucc-systemcard.h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 9; ; Macros and library functions for using the System Card.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 20; ; Because these are mainly macros, and so must be included before being used
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 21; ; in compiled code, the actual functions here are written to avoid using any
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 22; ; BSS memory so that HuCC's overlay global-shared-variables are not effected.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 23; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 24; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 25; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 27; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 28; // Backup RAM defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 29; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 31; #define  BM_OK             0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 32; #define  BM_NOT_FOUND      1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 33; #define  BM_BAD_CHECKSUM   2
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 34; #define  BM_DIR_CORRUPTED  3
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 35; #define  BM_FILE_EMPTY     4
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 36; #define  BM_FULL           5
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 37; #define  BM_NOT_FORMATED   0xFF			// HuC incorrect spelling.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 38; #define  BM_NOT_FORMATTED  0xFF			// HuCC can use a dictionary!
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 40; #define  BRAM_STARTPTR     0x8010
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 42; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 43; // CD defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 44; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 46; #define	CDPLAY_MUTE		0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 47; #define	CDPLAY_REPEAT		1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 48; #define	CDPLAY_NORMAL		2
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 49; #define	CDPLAY_ENDOFDISC	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 51; #define	CDFADE_CANCEL	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 52; #define	CDFADE_PCM6	8
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 53; #define	CDFADE_ADPCM6	10
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 54; #define	CDFADE_PCM2	12
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 55; #define	CDFADE_ADPCM2	14
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 57; #define CDTRK_AUDIO	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 58; #define CDTRK_DATA	4
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 61; // ADPCM defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 62; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 64; #define	ADPLAY_AUTOSTOP		0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 65; #define	ADPLAY_REPEAT		0x80
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 67; #define ADPLAY_FREQ_16KHZ	0xE
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 68; #define ADPLAY_FREQ_10KHZ	0xD
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 69; #define ADPLAY_FREQ_8KHZ	0xC
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 70; #define ADPLAY_FREQ_6KHZ	0xB
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 71; #define ADPLAY_FREQ_5KHZ	0xA
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 73; #define ADREAD_RAM	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 74; #define ADREAD_VRAM	0xFF
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 76; #define ADWRITE_RAM	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 77; #define ADWRITE_VRAM	0xFF
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 79; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 80; // Functions in hucc-systemcard.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 81; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 83; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 85; #asmdef	HUCC_USES_SYSTEMCARD 1
+HUCC_USES_SYSTEMCARD = 1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 87; extern void __fastcall __macro cd_boot( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 88; extern unsigned int __fastcall __macro cd_getver( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 89; extern void __fastcall __macro cd_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 90; extern unsigned char __fastcall __macro cd_pause( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 91; extern unsigned char __fastcall cd_unpause( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 92; extern void __fastcall __macro cd_fade( unsigned char type<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 93; extern unsigned char __fastcall cd_playtrk( unsigned char start_track<_bx>, unsigned char end_track<_cx>, unsigned char mode<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 94; extern unsigned char __fastcall cd_playmsf( unsigned char start_minute<_al>,  unsigned char start_second<_ah>,  unsigned char start_frame<_bl>, unsigned char end_minute<_cl>,  unsigned char end_second<_ch>,  unsigned char end_frame<_dl>,  unsigned char mode<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 95; extern unsigned char __fastcall cd_fastvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int sectors<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 96; extern unsigned char __fastcall cd_loadvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 97; extern unsigned char __fastcall cd_loaddata( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char __far *buffer<_bp_bank:_bp>, unsigned int bytes<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 98; extern unsigned char __fastcall cd_loadbank( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char bank<_bl>, unsigned int sectors<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 99; extern unsigned char __fastcall __macro cd_status( unsigned char mode<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 101; extern void __fastcall __macro ad_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 102; extern unsigned char __fastcall __macro ad_trans( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char nb_sectors<_dh>, unsigned int ad_addr<_bx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 103; extern void __fastcall __macro ad_read( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 104; extern void __fastcall __macro ad_write( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 105; extern unsigned char __fastcall __macro ad_play( unsigned int ad_addr<_bx>, unsigned int bytes<_ax>, unsigned char freq<_dh>, unsigned char mode<_dl> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 106; extern unsigned char __fastcall __macro ad_cplay( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int nb_sectors<_bx>, unsigned char freq<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 107; extern void __fastcall __macro ad_stop( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 108; extern unsigned char __fastcall __macro ad_stat( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 110; extern unsigned char __fastcall bm_check( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 111; extern unsigned char __fastcall bm_format( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 112; extern unsigned int __fastcall __macro bm_free( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 113; extern unsigned char __fastcall __macro bm_read( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 114; extern unsigned char __fastcall __macro bm_write( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 115; extern unsigned char __fastcall __macro bm_delete( unsigned char *name<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 117; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 119; extern unsigned char __fastcall __macro bm_exist( unsigned char *name<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 120; extern unsigned char __fastcall __macro bm_create( unsigned char *name<_ax>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 122; // void __fastcall _xsafe add_sectors( unsigned int sector_offset<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 124; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 126; #endif // _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/huc.h", 34; #include "hucc-baselib.h"
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 1; #ifndef _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 2; #define _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 7; ; hucc-baselib.h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 9; ; Basic library functions provided as macros.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 18; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 20; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 21; // Joypad defines ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 22; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 24; #define	JOY_A		0x01
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 25; #define	JOY_I		0x01
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 26; #define	JOY_B		0x02
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 27; #define	JOY_II		0x02
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 28; #define	JOY_SLCT	0x04
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 29; #define	JOY_SEL		0x04
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 30; #define	JOY_STRT	0x08
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 31; #define	JOY_RUN		0x08
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 32; #define	JOY_UP		0x10
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 33; #define	JOY_RGHT	0x20
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 34; #define	JOY_RIGHT	0x20
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 35; #define	JOY_DOWN	0x40
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 36; #define	JOY_LEFT	0x80
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 38; #define	JOY_C		0x0100
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 39; #define	JOY_III		0x0100
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 40; #define	JOY_D		0x0200
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 41; #define	JOY_IV		0x0200
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 42; #define	JOY_E		0x0400
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 43; #define	JOY_V		0x0400
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 44; #define	JOY_F		0x0800
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 45; #define	JOY_VI		0x0800
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 47; #define JOY_SIXBUT	0x8000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 48; #define JOY_TYPE6	0x8000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 50; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 51; // SuperGRAFX VPC settings for set_vpc_ctl() ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 52; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 54; #define VPC_SPR1_BKG1_SPR2_BKG2	0x3000 // same as SGX_PARALLAX=0
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 55; #define VPC_SPR1_SPR2_BKG1_BKG2	0x7000 // same as SGX_PARALLAX=1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 56; #define VPC_BKG1_BKG2_SPR1_SPR2	0xB000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 58; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 59; // System Card variables ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 62; extern unsigned int si;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 63; extern unsigned int di;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 64; extern unsigned int bp;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 66; extern unsigned int ax;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 67; extern unsigned int bx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 68; extern unsigned int cx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 69; extern unsigned int dx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 71; extern unsigned char al;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 72; extern unsigned char ah;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 73; extern unsigned char bl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 74; extern unsigned char bh;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 75; extern unsigned char cl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 76; extern unsigned char ch;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 77; extern unsigned char dl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 78; extern unsigned char dh;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 80; extern unsigned char irq_cnt;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 81; extern unsigned char joynow[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 82; extern unsigned char joytrg[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 83; extern unsigned char joy6now[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 84; extern unsigned char joy6trg[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 85; extern unsigned int  bg_x1;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 86; extern unsigned int  bg_y1;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 87; extern unsigned int  bg_x2;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 88; extern unsigned int  bg_y2;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 90; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 91; // Special macros to get information from PCEAS ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 92; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 94; #define BANK( datasym ) ((unsigned) (&__bank__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 95; #define SIZEOF( datasym ) ((unsigned) (&__sizeof__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 96; #define COUNTOF( datasym ) ((unsigned) (&__countof__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 97; #define OVERLAY( datasym ) ((unsigned) (&__overlay__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 100; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 101; // Functions in hucc-baselib.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 102; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 104; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 106; #asmdef	HUCC_USES_BASELIB 1
+HUCC_USES_BASELIB = 1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 108; #define	_OPTIMIZE 1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 111; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 112; // Hardware Detection
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 113; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 115; extern unsigned char __fastcall __macro sgx_detect( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 116; extern unsigned char __fastcall __macro ac_exists( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 119; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 120; // Memory Access
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 121; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 123; extern unsigned char __fastcall __macro peek( unsigned int addr<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 124; extern unsigned int  __fastcall __macro peekw( unsigned int addr<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 126; extern void __fastcall __macro poke( unsigned int addr<__poke>, unsigned char with<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 127; extern void __fastcall __macro pokew( unsigned int addr<__poke>, unsigned int with<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 129; extern unsigned char __fastcall farpeek( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 130; extern unsigned int  __fastcall farpeekw( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 132; extern void __fastcall __nop set_far_base( unsigned char data_bank<_bp_bank>, unsigned char *data_addr<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 133; extern void __fastcall set_far_offset( unsigned int offset<_bp>, unsigned char data_bank<_bp_bank>, unsigned char *data_addr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 135; extern unsigned char __fastcall far_peek( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 136; extern unsigned int  __fastcall far_peekw( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 138; extern void __fastcall __macro reset_mpr2( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 139; extern void __fastcall __macro reset_mpr34( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 141; extern void * __fastcall __macro farset_mpr2( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 142; extern void * __fastcall __macro farset_mpr34( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 144; extern void * __fastcall __macro far_set_mpr2( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 145; extern void * __fastcall __macro far_set_mpr34( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 148; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 149; // Clock Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 150; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 152; extern unsigned char __fastcall __macro clock_hh( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 153; extern unsigned char __fastcall __macro clock_mm( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 154; extern unsigned char __fastcall __macro clock_ss( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 155; extern unsigned char __fastcall __macro clock_tt( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 156; extern void __fastcall __macro clock_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 159; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 160; // Joypad Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 161; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 163; extern unsigned int __fastcall __macro joy( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 164; extern unsigned int __fastcall __macro joytrg( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 167; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 168; // Number Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 169; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 171; extern void __fastcall __macro srand( unsigned char seed<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 172; extern unsigned int __fastcall rand( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 173; extern unsigned char __fastcall rand8( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 175; // Note: "limit" is 0..255.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 176; extern unsigned char __fastcall random8( unsigned char limit<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 178; // Note: "limit" is 0..128, 129..255 are treated as 128!
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 179; extern unsigned char __fastcall random( unsigned char limit<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 182; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 183; // Overlay Execution
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 184; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 186; extern unsigned char __fastcall __macro cd_execoverlay( unsigned char ovl_index<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 189; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 190; // Functions that are only optionally available if configured in your hucc-config.inc
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 191; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 193; extern unsigned int __fastcall __macro joybuf( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 194; extern unsigned int __fastcall __macro get_joy_events( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 195; extern void __fastcall __macro clear_joy_events( unsigned char mask<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 198; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 199; // Functions that are only implemented in the TGEMU emulator for unit-testing
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 200; // the compiler, and which should never be used in normal HuCC projects ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 201; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 203; extern void __fastcall dump_screen( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 205; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 207; #endif // _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/huc.h", 35; #include "hucc-gfx.h"
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 1; #ifndef _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 2; #define _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 7; ; huc-gfx.h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 22; // Screen defines ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 25; #define	SCR_SIZE_32x32	0
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 26; #define	SCR_SIZE_64x32	1
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 27; #define	SCR_SIZE_128x32	2
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 28; #define	SCR_SIZE_32x64	4
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 29; #define	SCR_SIZE_64x64	5
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 30; #define	SCR_SIZE_128x64	6
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 32; #define	XRES_SHARP	0
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 33; #define	XRES_SOFT	4
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 34; #define	XRES_KEEP	128
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 36; #define VPC_WIN_A	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 37; #define VPC_WIN_B	0x01
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 38; #define	VPC_WIN_AB	0x02
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 39; #define	VPC_WIN_NONE	0x03
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 40; #define	VPC_NORM	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 41; #define	VPC_SPR		0x04
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 42; #define	VPC_INV_SPR	0x08
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 43; #define VDC1_ON		0x01
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 44; #define	VDC1_OFF	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 45; #define VDC2_ON		0x02
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 46; #define	VDC2_OFF	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 47; #define VDC_ON		0x03
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 48; #define	VDC_OFF		0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 50; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 51; // Functions in hucc-gfx.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 52; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 54; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 56; #asmdef	HUCC_USES_GFX 1
+HUCC_USES_GFX = 1
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 58; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 59; // Color and Palette Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 62; extern void __fastcall clear_palette( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 64; extern void __fastcall __nop set_color( unsigned int index<VCE_CTA>, unsigned int value<VCE_CTW> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 65; extern void __fastcall set_color_rgb( unsigned int index<VCE_CTA>, unsigned char r<_al>, unsigned char g<_ah>, unsigned char b<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 66; extern unsigned int __fastcall __macro get_color( unsigned int index<VCE_CTA> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 68; extern void __fastcall load_palette( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 69; extern void __fastcall far_load_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 71; extern void __fastcall read_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah>, unsigned int *destination<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 73; extern void __fastcall __macro fade_to_black( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 74; extern void __fastcall __macro fade_to_white( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 75; extern void __fastcall __macro cross_fade_to( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 77; extern void __fastcall __macro far_fade_to_black( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 78; extern void __fastcall __macro far_fade_to_white( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 79; extern void __fastcall __macro far_cross_fade_to( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 83; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 84; // Video Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 85; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 87; extern void __fastcall init_240x208( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 88; extern void __fastcall init_256x224( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 90; extern void __fastcall vsync( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 91; extern void __fastcall vsync( unsigned char count<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 93; extern void __fastcall disp_on( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 94; extern void __fastcall disp_off( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 96; extern void __fastcall set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 98; extern void __fastcall set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 100; extern void __fastcall cls( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 101; extern void __fastcall cls( unsigned int tile<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 103; extern unsigned int __fastcall __macro vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 104; extern unsigned int __fastcall __macro get_vram( unsigned int address<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 105; extern void __fastcall __macro put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 107; extern void __fastcall __macro load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 108; extern void __fastcall __macro far_load_vram( unsigned int vram<_di>,  unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 110; extern void __fastcall load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 111; extern void __fastcall far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 113; extern void __fastcall __macro load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 114; extern void __fastcall __macro far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 116; extern void __fastcall vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 119; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 120; // SuperGRAFX Video Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 121; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 123; extern void __fastcall __nop vpc_set_ctl( unsigned int bits<VPC_CR> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 124; extern void __fastcall __nop vpc_set_win1( unsigned int width<VPC_WINDOW1> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 125; extern void __fastcall __nop vpc_set_win2( unsigned int width<VPC_WINDOW2> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 127; extern void __fastcall sgx_set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 129; extern void __fastcall sgx_set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 131; extern void __fastcall sgx_cls( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 132; extern void __fastcall sgx_cls( unsigned int tile<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 134; extern unsigned int __fastcall __macro sgx_vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 135; extern unsigned int __fastcall __macro sgx_get_vram( unsigned int address<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 136; extern void __fastcall __macro sgx_put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 138; extern void __fastcall __macro sgx_load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 139; extern void __fastcall __macro sgx_far_load_vram( unsigned int vram<_di>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 141; extern void __fastcall sgx_load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 142; extern void __fastcall sgx_far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 144; extern void __fastcall __macro sgx_load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 145; extern void __fastcall __macro sgx_far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 147; extern void __fastcall sgx_vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 150; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 151; // Font Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 152; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 154; extern void __fastcall set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 155; extern void __fastcall set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 157; extern void __fastcall load_font( unsigned char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 158; extern void __fastcall far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 160; extern void __fastcall __nop set_font_color( unsigned char foreground<monofont_fg>, unsigned char background<monofont_bg> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 161; extern void __fastcall __macro load_default_font( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 164; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 165; // SuperGRAFX Font Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 166; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 168; extern void __fastcall sgx_set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 169; extern void __fastcall sgx_set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 171; extern void __fastcall sgx_load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 172; extern void __fastcall sgx_far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 174; extern void __fastcall __macro sgx_load_default_font( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 177; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 178; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 179; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 181; extern void __fastcall __macro set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 182; extern void __fastcall __macro sgx_set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 184; extern void __fastcall load_background( unsigned char __far *tiles<_bp_bank:_bp>, unsigned char __far *palettes<__fbank:__fptr>, unsigned char __far *bat<_cl:_bx>, unsigned char w<_dl>, unsigned char h<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 186; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 187; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 188; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 189; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 191; extern void __fastcall load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 193; extern void __fastcall put_string( unsigned char *string<_bp>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 195; extern void __fastcall put_char( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 196; extern void __fastcall put_digit( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 197; extern void __fastcall put_hex( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 198; extern void __fastcall put_number( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 199; extern void __fastcall put_raw( unsigned int data<_bx>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 201; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 203; #endif // _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/huc.h", 36; #include "hucc-old-scroll.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 1; #ifndef _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 2; #define _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 7; ; hucc-old-scroll.h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 19; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 20; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 21; ; HuC's old scrolling library is provided for use with existing HuC projects,
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 22; ; but it should preferably be avoided in new projects because it is slow and
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 23; ; forever limited by its choice to handle gaps between areas, and sorting.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 24; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 25; ; HuCC's new scrolling library puts the responibility for defining both gaps
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 26; ; and the display order into the project's hands, but in return it runs much
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 27; ; faster, using less than 1/6 of the processing time in VBLANK, and far less
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 28; ; time in the RCR interrputs themselves. It also supports the 2nd SuperGRAFX
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 29; ; screen layer, which HuC's old scrolling library ignores.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 30; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 31; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 32; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 34; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 35; // Functions in hucc-old-scroll.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 36; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 38; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 40; #asmdef	HUCC_USES_OLD_SCROLL 1
+HUCC_USES_OLD_SCROLL = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 42; extern void __fastcall scroll( unsigned char num<_al>, unsigned int x<_cx>, unsigned int y<_dx>, unsigned char top<_ah>, unsigned char bottom<_bl>, unsigned char disp<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 43; extern void __fastcall scroll_disable( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 45; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 47; #endif // _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/huc.h", 37; #include "hucc-old-spr.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 1; #ifndef _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 2; #define _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 7; ; hucc-old-spr.h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 22; // Sprite defines ...
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 25; #define FLIP_X_MASK 0x08
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 26; #define FLIP_Y_MASK 0x80
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 27; #define FLIP_MAS    0x88
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 28; #define SIZE_MAS    0x31
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 30; #define NO_FLIP     0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 31; #define NO_FLIP_X   0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 32; #define NO_FLIP_Y   0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 33; #define FLIP_X      0x08
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 34; #define FLIP_Y      0x80
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 35; #define SZ_16x16    0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 36; #define SZ_16x32    0x10
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 37; #define SZ_16x64    0x30
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 38; #define SZ_32x16    0x01
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 39; #define SZ_32x32    0x11
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 40; #define	SZ_32x64    0x31
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 42; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 43; // Functions in hucc-old-spr.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 44; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 46; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 48; #asmdef	HUCC_USES_OLD_SPR 1
+HUCC_USES_OLD_SPR = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 50; extern void __fastcall init_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 51; extern void __fastcall reset_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 52; extern void __fastcall satb_update( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 53; extern void __fastcall spr_set( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 54; extern void __fastcall spr_hide( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 55; extern void __fastcall spr_show( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 56; extern void __fastcall spr_x( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 57; extern void __fastcall spr_y( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 58; extern void __fastcall spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 59; extern void __fastcall spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 60; extern void __fastcall spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 61; extern void __fastcall spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 63; extern unsigned int __fastcall spr_get_x( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 64; extern unsigned int __fastcall spr_get_y( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 66; extern void __fastcall sgx_init_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 67; extern void __fastcall sgx_reset_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 68; extern void __fastcall sgx_satb_update( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 69; extern void __fastcall sgx_spr_set( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 70; extern void __fastcall sgx_spr_hide( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 71; extern void __fastcall sgx_spr_show( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 72; extern void __fastcall sgx_spr_x( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 73; extern void __fastcall sgx_spr_y( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 74; extern void __fastcall sgx_spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 75; extern void __fastcall sgx_spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 76; extern void __fastcall sgx_spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 77; extern void __fastcall sgx_spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 79; extern unsigned int __fastcall sgx_spr_get_x( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 80; extern unsigned int __fastcall sgx_spr_get_y( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 82; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 84; #endif // _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/huc.h", 38; #include "hucc-old-map.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 1; #ifndef _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 2; #define _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 7; ; hucc-old-map.h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 22; // Functions in hucc-old-map.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 25; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 27; #asmdef	HUCC_USES_OLD_MAP 1
+HUCC_USES_OLD_MAP = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 29; extern void __fastcall set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 30; extern void __fastcall sgx_set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 32; extern void __fastcall __nop set_tile_data( unsigned char __far *tiles<vdc_tile_bank:vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 33; extern void __fastcall __nop sgx_set_tile_data( unsigned char __far *tiles<sgx_tile_bank:sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 35; extern void __fastcall __nop set_far_tile_data( unsigned char tile_bank<vdc_tile_bank>, unsigned char *tile_addr<vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char palette_table_bank<vdc_attr_bank>, unsigned char *palette_table_addr<vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 36; extern void __fastcall __nop sgx_set_far_tile_data( unsigned char tile_bank<sgx_tile_bank>, unsigned char *tile_addr<sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char palette_table_bank<sgx_attr_bank>, unsigned char *palette_table_addr<sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 38; extern void __fastcall __nop set_map_data( unsigned char __far *map<vdc_map_bank:vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 39; extern void __fastcall __nop sgx_set_map_data( unsigned char __far *map<sgx_map_bank:sgx_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 41; extern void __fastcall __nop set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 42; extern void __fastcall __nop sgx_set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 44; extern void __fastcall load_tile( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 45; extern void __fastcall sgx_load_tile( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 47; extern void __fastcall load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 48; extern void __fastcall sgx_load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 50; extern unsigned char __fastcall map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 51; extern unsigned char __fastcall sgx_map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 53; extern void __fastcall map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 54; extern void __fastcall sgx_map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 56; extern void __fastcall put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 57; extern void __fastcall sgx_put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 59; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 61; extern void __fastcall set_tile_data( unsigned char *tile_ex<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 63; extern void __fastcall __nop set_map_pals( unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 64; extern void __fastcall __nop set_map_tile_type( unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 66; extern void __fastcall __nop sgx_set_map_pals( unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 67; extern void __fastcall __nop sgx_set_map_tile_type( unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 69; extern void __fastcall set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 70; extern void __fastcall sgx_set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 72; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 74; #endif // _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/huc.h", 39; #include "hucc-old-line.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 1; #ifndef _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 2; #define _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 7; ; hucc-old-line.h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 22; // Functions in hucc-old-line.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 25; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 27; #asmdef	HUCC_USES_OLD_LINE 1
+HUCC_USES_OLD_LINE = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 29; extern void __fastcall gfx_init( unsigned int start_vram_addr<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 30; extern void __fastcall gfx_clear( unsigned int start_vram_addr<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 31; extern void __fastcall gfx_plot( unsigned int x<_gfx_x1>, unsigned int y<_gfx_y1>, char color<_gfx_color> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 32; extern void __fastcall gfx_line( unsigned int x1<_gfx_x1>, unsigned int y1<_gfx_y1>, unsigned int x2<_gfx_x2>, unsigned int y2<_gfx_y2>, unsigned char color<_gfx_color> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 34; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 36; #endif // _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/huc.h", 41; #include <stdlib.h>
+	.dbg	line,	"../../../include/hucc/stdlib.h", 1; #ifndef _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/stdlib.h", 2; #define _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/stdlib.h", 4; #define RAND_MAX 32767
+	.dbg	line,	"../../../include/hucc/stdlib.h", 6; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/stdlib.h", 7; extern int __fastcall abs( int value<acc> );
+	.dbg	line,	"../../../include/hucc/stdlib.h", 8; #endif
+	.dbg	line,	"../../../include/hucc/stdlib.h", 10; #endif // _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/huc.h", 42; #include <string.h>
+	.dbg	line,	"../../../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"../../../include/hucc/string.h", 3; #endif
+	.dbg	line,	"../../../include/hucc/huc.h", 44; #endif // _hucc_legacy_h
+	.dbg	line,	"multimap.c", 45; #include "hucc-scroll.h"
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 1; #ifndef _hucc_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 2; #define _hucc_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 7; ; hucc-scroll.h
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 9; ; Routines for a fast split-screen scrolling system.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 20; ; The maximum number of splits for each screen layer is set in your project's
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 21; ; "hucc-config.inc" file, with the library having a limit of 128-per-layer.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 22; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 23; ; Your first active split must be defined to start at screen line 0, and then
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 24; ; the rest of the active splits must be in increasing line order to match the
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 25; ; way that the PC Engine displays the output image.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 26; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 27; ; You can have disabled splits interleaved with your active splits.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 28; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 29; ; Splits that are normally disabled can be used to create full screen effects
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 30; ; such as bouncing the screen up and down by adding blank areas at the top or
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 31; ; bottom of the screen, and then rapidly changing the height of those areas.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 32; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 33; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 34; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 36; // *************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 37; // VDC bits for display_flags ...
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 38; // *************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 40; #ifndef BKG_OFF
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 41; #define BKG_OFF 0x00
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 42; #endif
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 44; #ifndef SPR_OFF
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 45; #define SPR_OFF 0x00
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 46; #endif
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 48; #ifndef BKG_ON
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 49; #define BKG_ON 0x80
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 50; #endif
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 52; #ifndef SPR_ON
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 53; #define SPR_ON 0x40
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 54; #endif
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 56; // *************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 57; // Functions in hucc-scroll.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 58; // *************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 60; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 62; #asmdef	HUCC_USES_NEW_SCROLL 1
+HUCC_USES_NEW_SCROLL = 1
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 64; extern void __fastcall scroll_split( unsigned char index<_al>, unsigned char screen_line<_ah>, unsigned int bat_x<_bx>, unsigned int bat_y<_cx>, unsigned char display_flags<_dl> );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 65; extern void __fastcall sgx_scroll_split( unsigned char index<_al>, unsigned char screen_line<_ah>, unsigned int bat_x<_bx>, unsigned int bat_y<_cx>, unsigned char display_flags<_dl> );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 67; extern void __fastcall disable_split( unsigned char index<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 68; extern void __fastcall sgx_disable_split( unsigned char index<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 70; extern void __fastcall __macro disable_all_splits( void );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 71; extern void __fastcall __macro sgx_disable_all_splits( void );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 73; #asm
+	.dbg	clear
+		.macro	_disable_all_splits
+		ldy	#HUCC_PCE_SPLITS - 1
+!loop:		tya
+		call	_disable_split.1
+		dey
+		bpl	!loop-
+		.endm
+		.macro	_sgx_disable_all_splits
+		ldy	#HUCC_SGX_SPLITS - 1
+!loop:		tya
+		call	_sgx_disable_split.1
+		dey
+		bpl	!loop-
+		.endm
+
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 89; #endasm
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 91; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 93; #endif // _hucc_scroll_h
+	.dbg	line,	"multimap.c", 46; #include "hucc-blkmap.h"
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 1; #ifndef _hucc_blkmap_h
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 2; #define _hucc_blkmap_h
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 7; ; hucc-blkmap.h
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 9; ; A map system based on 16x16 meta-tiles (aka "blocks", aka CHR/BLK/MAP).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 11; ; Copyright John Brandwood 2025.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 20; ; The maximum X and Y size for blkmaps is 128 blocks (2048 pixels).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 21; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 22; ; The maximum total size for a blkmap is 16KBytes, which allows for maps up
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 23; ; to 128x128 blocks (2048x2048 pixels).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 24; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 25; ; Huge multi-screen blkmaps are also supported (optionally).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 26; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 27; ; The maximum X and Y for multi-screen maps is 128 screens (32768 pixels).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 28; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 29; ; The maximum total size for a multi-screen map is 8KBytes, which allows for
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 30; ; a total of 1024 screens.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 31; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 32; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 33; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 35; // *************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 36; // Functions in blkmap.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 37; // *************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 39; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 41; #asmdef	HUCC_USES_BLKMAP 1
+HUCC_USES_BLKMAP = 1
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 43; // Current top-left of drawn map in pixels.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 44; extern unsigned int   vdc_map_pxl_x;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 45; extern unsigned int   vdc_map_pxl_y;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 47; // Width and height to draw/scroll in characters (not tiles).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 48; extern unsigned char  vdc_map_draw_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 49; extern unsigned char  vdc_map_draw_h;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 51; // Width of map (or multi-screen BAT) in tiles.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 52; extern unsigned char  vdc_map_line_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 54; // Width of map in screens (if multi-screen map).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 55; extern unsigned char  vdc_map_scrn_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 57; // Extra information returned by get_map_block() and sgx_get_map_block(),
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 58; // which are the collision flags and the mask/overlay sprite for the BLK.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 59; extern unsigned char  map_blk_flag;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 60; extern unsigned char  map_blk_mask;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 62; extern unsigned char  vdc_scr_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 63; extern unsigned char *vdc_scr_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 65; extern unsigned char  vdc_map_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 66; extern unsigned char *vdc_map_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 68; extern unsigned char  vdc_blk_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 69; extern unsigned char *vdc_blk_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 71; extern unsigned char  vdc_tbl_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 72; extern unsigned char *vdc_tbl_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 74; extern void __fastcall set_blocks( unsigned char __far *blk_def<vdc_blk_bank:vdc_blk_addr>, unsigned char __far *flg_def<vdc_tbl_bank:vdc_tbl_addr>, unsigned char number_of_blocks<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 75; extern void __fastcall __macro set_blkmap( unsigned char __far *blk_map<vdc_map_bank:vdc_map_addr>, unsigned char blocks_w<vdc_map_line_w> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 76; extern void __fastcall __macro set_multimap( unsigned char __far *multi_map<vdc_scr_bank:vdc_scr_addr>, unsigned char screens_w<vdc_map_scrn_w> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 78; extern void __fastcall draw_map( void );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 79; extern void __fastcall scroll_map( void );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 81; extern void __fastcall blit_map( unsigned char tile_x<map_bat_x>, unsigned char tile_y<map_bat_y>, unsigned char tile_w<map_draw_x>, unsigned char tile_h<map_draw_y> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 83; extern unsigned char __fastcall get_map_block( unsigned int x<map_pxl_x>, unsigned int y<map_pxl_y> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 85; #asm
+	.dbg	clear
+		.macro	_set_blkmap.2
+		stz	vdc_scr_bank
+		.endm
+		.macro	_set_multimap.2
+		lda	vdc_bat_width
+		lsr	a
+		sta	vdc_map_line_w
+		.endm
+		.macro	SCREEN
+		db	(((\1) & $1FFF) | $6000) >> 8, bank(\1)
+		db	(((\2) & $1FFF) | $4000) >> 8, bank(\2)
+		db	(((\3) & $1FFF) | $6000) >> 8, bank(\3)
+		dw	(\4)
+		.endm
+
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 102; #endasm
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 104; #ifdef _SGX
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 106; // Current top-left of drawn map in pixels.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 107; extern unsigned int   sgx_map_pxl_x;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 108; extern unsigned int   sgx_map_pxl_y;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 110; // Width and height to draw/scroll in characters (not tiles).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 111; extern unsigned char  sgx_map_draw_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 112; extern unsigned char  sgx_map_draw_h;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 114; // Width of map (or multi-screen BAT) in tiles.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 115; extern unsigned char  sgx_map_line_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 117; // Width of map in screens (if multi-screen map).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 118; extern unsigned char  sgx_map_scrn_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 120; extern unsigned char  sgx_scr_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 121; extern unsigned char *sgx_scr_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 123; extern unsigned char  sgx_map_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 124; extern unsigned char *sgx_map_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 126; extern unsigned char  sgx_blk_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 127; extern unsigned char *sgx_blk_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 129; extern unsigned char  sgx_tbl_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 130; extern unsigned char *sgx_tbl_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 132; extern void __fastcall sgx_set_blocks( unsigned char __far *blk_def<sgx_blk_bank:sgx_blk_addr>, unsigned char __far *flg_def<sgx_tbl_bank:sgx_tbl_addr>, unsigned char number_of_blocks<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 133; extern void __fastcall __macro sgx_set_blkmap( unsigned char __far *blk_map<sgx_map_bank:sgx_map_addr>, unsigned char blocks_w<sgx_map_line_w> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 134; extern void __fastcall __macro sgx_set_multimap( unsigned char __far *multi_map<sgx_scr_bank:sgx_scr_addr>, unsigned char screens_w<sgx_map_scrn_w> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 136; extern void __fastcall sgx_draw_map( void );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 137; extern void __fastcall sgx_scroll_map( void );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 139; extern void __fastcall sgx_blit_map( unsigned char tile_x<map_bat_x>, unsigned char tile_y<map_bat_y>, unsigned char tile_w<map_draw_x>, unsigned char tile_h<map_draw_y> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 141; extern unsigned char __fastcall sgx_get_map_block( unsigned int x<map_pxl_x>, unsigned int y<map_pxl_y> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 143; #asm
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 144; .macro	_sgx_set_blkmap.2
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 145; stz	sgx_scr_bank
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 146; .endm
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 148; .macro	_sgx_set_multimap.2
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 149; lda	sgx_bat_width
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 150; lsr	a
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 151; sta	sgx_map_line_w
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 152; .endm
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 153; #endasm
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 155; #endif
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 157; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 159; #endif // _hucc_blkmap_h
+	.dbg	line,	"multimap.c", 49; // **************************************************************************
+	.dbg	line,	"multimap.c", 50; // **************************************************************************
+	.dbg	line,	"multimap.c", 51; //
+	.dbg	line,	"multimap.c", 52; // An example of scrolling a block map (a map with 16x16 meta-tiles).
+	.dbg	line,	"multimap.c", 53; //
+	.dbg	line,	"multimap.c", 54; // This also shows one way to animate background characters in the map.
+	.dbg	line,	"multimap.c", 55; //
+	.dbg	line,	"multimap.c", 56; // **************************************************************************
+	.dbg	line,	"multimap.c", 57; // **************************************************************************
+	.dbg	line,	"multimap.c", 60; // Get the full 256-color palette from the bitmap.
+	.dbg	line,	"multimap.c", 62; #incpal( seran_pal, "../seran/seran-map.png" );
+	.data
+_seran_pal:	.incpal		"../seran/seran-map.png"
+	.code
+	.dbg	line,	"multimap.c", 65; // Extract all of the 8x8 characters for the 8 frames of 32x32 pixel water animation.
+	.dbg	line,	"multimap.c", 67; #incchr( water_chr, "../seran/seran-water.png", 4, 4*8 ); /* Animated characters. */
+	.data
+_water_chr: 	.incchr		"../seran/seran-water.png", 4, 32
+	.code
+	.dbg	line,	"multimap.c", 70; // Extract all of the 8x8 characters for the 4 frames of 64x8 pixel shore animation.
+	.dbg	line,	"multimap.c", 72; #incchr( shore_chr, "../seran/seran-shore.png", 8, 1*4 ); /* Animated characters. */
+	.data
+_shore_chr: 	.incchr		"../seran/seran-shore.png", 8, 4
+	.code
+	.dbg	line,	"multimap.c", 75; // Extract all of the 8x8 characters (a.k.a. tiles) that are used in the
+	.dbg	line,	"multimap.c", 76; // bitmap, removing the repeated characters.
+	.dbg	line,	"multimap.c", 77; //
+	.dbg	line,	"multimap.c", 78; // This uses PCEAS's ability to add multiple images to a character set, which
+	.dbg	line,	"multimap.c", 79; // requires that they are all put one-after-the-other with no labels or blank
+	.dbg	line,	"multimap.c", 80; // lines or different commands between the multiple .inchr/.padchr statements.
+	.dbg	line,	"multimap.c", 81; //
+	.dbg	line,	"multimap.c", 82; // The characters that we're going to animate must be included somewhere that
+	.dbg	line,	"multimap.c", 83; // we can find them later on. In this case it is easiest to just include them
+	.dbg	line,	"multimap.c", 84; // first so that they're at the start of the character set, but that is not a
+	.dbg	line,	"multimap.c", 85; // a general requirement for background animation to work.
+	.dbg	line,	"multimap.c", 87; #asm
+	.dbg	clear
+OPTIMIZE	=	1
+		.data
+_seran_chr:	incchr	"../seran/seran-water.png", 4, 4 ; 1st frame of the animation.
+		incchr	"../seran/seran-shore.png", 8, 1 ; 1st frame of the animation.
+		incchr	"../seran/seran-map.png", 128, 128, OPTIMIZE
+		.code
+
+	.dbg	line,	"multimap.c", 94; #endasm
+	.dbg	line,	"multimap.c", 96; extern unsigned char seran_chr[];
+	.dbg	line,	"multimap.c", 99; // Extract 16x16 pixel blocks (a.k.a. meta-tiles) from the bitmap using
+	.dbg	line,	"multimap.c", 100; // the optimized character set that has already been extracted.
+	.dbg	line,	"multimap.c", 101; //
+	.dbg	line,	"multimap.c", 102; // There are a maximum of 256 blocks in a BLK map, and the definitiuons
+	.dbg	line,	"multimap.c", 103; // are always 2KByte long and 2KByte aligned in memory.
+	.dbg	line,	"multimap.c", 104; //
+	.dbg	line,	"multimap.c", 105; // You need to tell the converter where in VRAM you are going to upload
+	.dbg	line,	"multimap.c", 106; // the character set, which is usually 0x1000 for the map graphics.
+	.dbg	line,	"multimap.c", 107; //
+	.dbg	line,	"multimap.c", 108; // This uses PCEAS's ability to add multiple images to a block set in order to
+	.dbg	line,	"multimap.c", 109; // put the two blocks that make up the entrance to each house at the beginning
+	.dbg	line,	"multimap.c", 110; // of the set of blocks so that they can be detected as BLK 0 and 1 in the map
+	.dbg	line,	"multimap.c", 111; // when the player tries to enter a building.
+	.dbg	line,	"multimap.c", 112; //
+	.dbg	line,	"multimap.c", 113; // This show how to force specific BLK graphics to use specific BLK numbers so
+	.dbg	line,	"multimap.c", 114; // the programmer can write their game code to detect them.
+	.dbg	line,	"multimap.c", 116; #asm
+	.dbg	clear
+		.data
+_seran_blk:	incblk	"../seran/seran-enter.png", 0x1000, _seran_chr ; House entrance.
+		incblk	"../seran/seran-map.png", 0x1000, _seran_chr
+		.code
+
+	.dbg	line,	"multimap.c", 121; #endasm
+	.dbg	line,	"multimap.c", 123; extern unsigned char seran_blk[];
+	.dbg	line,	"multimap.c", 126; // Extract the map in BLK format.
+	.dbg	line,	"multimap.c", 127; //
+	.dbg	line,	"multimap.c", 128; // This is used for medium sized scrolling backgrounds, and is also the
+	.dbg	line,	"multimap.c", 129; // format for the individual screens in a huge multi-screen background.
+	.dbg	line,	"multimap.c", 130; //
+	.dbg	line,	"multimap.c", 131; // A map can be transformed later on for use as a multi-screen map with
+	.dbg	line,	"multimap.c", 132; // the ".SWIZZLE" command even if it is larger than the normal limit of
+	.dbg	line,	"multimap.c", 133; // 128x128 blocks in size.
+	.dbg	line,	"multimap.c", 134; //
+	.dbg	line,	"multimap.c", 135; // Note that the map data for a multi-screen map *must* be aligned to a
+	.dbg	line,	"multimap.c", 136; // 256-byte boundary in memory.
+	.dbg	line,	"multimap.c", 137; //
+	.dbg	line,	"multimap.c", 138; // This shows how to accomplish that in HuCC, but as you must be seeing
+	.dbg	line,	"multimap.c", 139; // by now all of these separate "#asm/#endasm" sections are a sign that
+	.dbg	line,	"multimap.c", 140; // it is usually simpler to handle all of this map data conversion in a
+	.dbg	line,	"multimap.c", 141; // large "#asm/#endasm" section, or in a separate asm file.
+	.dbg	line,	"multimap.c", 143; #asm
+	.dbg	clear
+		.data
+		.align	256
+		.code
+
+	.dbg	line,	"multimap.c", 147; #endasm
+	.dbg	line,	"multimap.c", 149; #incmap( seran_map, "../seran/seran-map.png", seran_blk );
+	.data
+_seran_map:	.incmap		"../seran/seran-map.png", _seran_blk
+	.code
+	.dbg	line,	"multimap.c", 152; // Convert the map into BAT-sized chunks so that it can be used as parts
+	.dbg	line,	"multimap.c", 153; // of a multi-screen map.
+	.dbg	line,	"multimap.c", 154; //
+	.dbg	line,	"multimap.c", 155; // Since this example uses a BAT size of 32x32 characters instead of the
+	.dbg	line,	"multimap.c", 156; // HuCC default of 64x32 characters, the width and height parameters are
+	.dbg	line,	"multimap.c", 157; // both 16 (i.e. 32 characters / 2 characters-per-16x16-block).
+	.dbg	line,	"multimap.c", 158; //
+	.dbg	line,	"multimap.c", 159; // Each resulting BAT-sized "screen" is therefore 256 bytes long (16x16)
+	.dbg	line,	"multimap.c", 160; // or 512 bytes long (32x16) for the most common BAT sizes, which allows
+	.dbg	line,	"multimap.c", 161; // for the easy calculation of the offsets to each screen's map data.
+	.dbg	line,	"multimap.c", 162; //
+	.dbg	line,	"multimap.c", 163; // Note that the .SWIZZLE command is only available in a "#asm" section!
+	.dbg	line,	"multimap.c", 165; #asm
+	.dbg	clear
+		swizzle	_seran_map, 16, 16
+
+	.dbg	line,	"multimap.c", 167; #endasm
+	.dbg	line,	"multimap.c", 171; // Define a 4x4 multi-screen map using the 16 BAT-sized chunks that were
+	.dbg	line,	"multimap.c", 172; // created by the .SWIZZLE command, together with the "SCREEN" macro.
+	.dbg	line,	"multimap.c", 173; //
+	.dbg	line,	"multimap.c", 174; // Each screen's data in the multi-screen map tells the map library code
+	.dbg	line,	"multimap.c", 175; // where to find the map chunk, the BLK data, and the 256-byte MASK/OVER
+	.dbg	line,	"multimap.c", 176; // table used to associate mask or overlay sprites with the BLK.
+	.dbg	line,	"multimap.c", 177; //
+	.dbg	line,	"multimap.c", 178; // The final parameter is not used yet at this time, so set it to zero.
+	.dbg	line,	"multimap.c", 179; //
+	.dbg	line,	"multimap.c", 180; // A map this small does not need to be a multi-screen map, but it shows
+	.dbg	line,	"multimap.c", 181; // how to build up a multi-screen map data structure.
+	.dbg	line,	"multimap.c", 182; //
+	.dbg	line,	"multimap.c", 183; // Both the map data and the MASK/OVER table must be 256-byte aligned in
+	.dbg	line,	"multimap.c", 184; // memory, and BLK definitions must be 2048-byte aligned.
+	.dbg	line,	"multimap.c", 185; //
+	.dbg	line,	"multimap.c", 186; // The multi-screen map data structure can hold a limit of 1024 screens,
+	.dbg	line,	"multimap.c", 187; // and it does not need any particular alignment.
+	.dbg	line,	"multimap.c", 188; //
+	.dbg	line,	"multimap.c", 189; // It is stored as an array of lines of screens from the top the bottom,
+	.dbg	line,	"multimap.c", 190; // with each line defining the screens in left to the right order.
+	.dbg	line,	"multimap.c", 192; #asm
+	.dbg	clear
+		.data
+_multi_map:	; 1st line of 4 screens, left-to-right, each screen is 16x16=$0100 bytes long.
+		SCREEN	_seran_map + $0000, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0100, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0200, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0300, _seran_blk, _seran_msk, 0
+		; 2nd line of 4 screens, left-to-right, each screen is 16x16=$0100 bytes long.
+		SCREEN	_seran_map + $0400, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0500, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0600, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0700, _seran_blk, _seran_msk, 0
+		; 3rd line of 4 screens, left-to-right, each screen is 16x16=$0100 bytes long.
+		SCREEN	_seran_map + $0800, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0900, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0A00, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0B00, _seran_blk, _seran_msk, 0
+		; 4th line of 4 screens, left-to-right, each screen is 16x16=$0100 bytes long.
+		SCREEN	_seran_map + $0C00, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0D00, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0E00, _seran_blk, _seran_msk, 0
+		SCREEN	_seran_map + $0F00, _seran_blk, _seran_msk, 0
+		.code
+
+	.dbg	line,	"multimap.c", 215; #endasm
+	.dbg	line,	"multimap.c", 217; extern unsigned char multi_map[];
+	.dbg	line,	"multimap.c", 220; // This example doesn't use the extra .MASKMAP/.OVERMAP lookup table for
+	.dbg	line,	"multimap.c", 221; // the BLK, but the library routines expect *something* to be specified.
+	.dbg	line,	"multimap.c", 222; //
+	.dbg	line,	"multimap.c", 223; // This just gives the code an array of blank data to keep it happy.
+	.dbg	line,	"multimap.c", 225; const unsigned char seran_msk[256];
+	.dbg	line,	"multimap.c", 228; // Define the screen size that we're going to use to reduce the number of
+	.dbg	line,	"multimap.c", 229; // unexplained "magic" numbers later on.
+	.dbg	line,	"multimap.c", 231; #define VIEW_W 240
+	.dbg	line,	"multimap.c", 232; #define VIEW_H 208
+	.dbg	line,	"multimap.c", 234; #define BAT_W 256
+	.dbg	line,	"multimap.c", 235; #define BAT_H 256
+	.dbg	line,	"multimap.c", 238; // Define where the map's original copies of the animated characters are in VRAM
+	.dbg	line,	"multimap.c", 239; // so that they can be swapped out with the animated versions of the characters.
+	.dbg	line,	"multimap.c", 240; //
+	.dbg	line,	"multimap.c", 241; // We know what the VRAM addresses are because we specifically put the 1st frame
+	.dbg	line,	"multimap.c", 242; // of each animation at the start of the character set.
+	.dbg	line,	"multimap.c", 244; #define WATER_CHR 0x1000
+	.dbg	line,	"multimap.c", 245; #define SHORE_CHR 0x1100
+	.dbg	line,	"multimap.c", 248; // Define where to upload the animation characters in VRAM so that they're
+	.dbg	line,	"multimap.c", 249; // all in VRAM and can be used for the VDC chip's vram2vram DMA.
+	.dbg	line,	"multimap.c", 251; #define WATER_ANIM 0x3000
+	.dbg	line,	"multimap.c", 252; #define SHORE_ANIM 0x3800
+	.dbg	line,	"multimap.c", 255; // Define the size of each frame of the animation, an 8x8 character is 16 words.
+	.dbg	line,	"multimap.c", 256; //
+	.dbg	line,	"multimap.c", 257; // HuCC users please note ... putting the constant math in parentheses helps the
+	.dbg	line,	"multimap.c", 258; // compiler optimize it to a single number when the #defines are used.
+	.dbg	line,	"multimap.c", 260; #define TILE_WORDS 16
+	.dbg	line,	"multimap.c", 261; #define WATER_SIZE (4 * 4 * TILE_WORDS)
+	.dbg	line,	"multimap.c", 262; #define SHORE_SIZE (8 * 1 * TILE_WORDS)
+	.dbg	line,	"multimap.c", 265; // Variables for the animation.
+	.dbg	line,	"multimap.c", 267; unsigned char water_delay;
+	.dbg	line,	"multimap.c", 268; unsigned char water_cycle;
+	.dbg	line,	"multimap.c", 269; unsigned char water_frame;
+	.dbg	line,	"multimap.c", 270; unsigned char shore_frame;
+	.dbg	line,	"multimap.c", 273; //
+	.dbg	line,	"multimap.c", 275; test_multimap()
+	.dbg	line,	"multimap.c", 276; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test_multimap
+	__enter		_test_multimap
+
+	.dbg	line,	"multimap.c", 277; // Use a reduced screen size and 32x32 BAT size to save VRAM.
+
+	.dbg	line,	"multimap.c", 278; // This also clears the palettes and VRAM and disables the display.
+
+	.dbg	line,	"multimap.c", 280; init_240x208();
+	__call		_init_240x208
+
+	.dbg	line,	"multimap.c", 282; // Upload the default HuCC font.
+
+	.dbg	line,	"multimap.c", 284; set_font_color( 4, 0 );
+	__st.umiq	4, monofont_fg
+	__st.umiq	0, monofont_bg
+
+	.dbg	line,	"multimap.c", 285; set_font_pal( 15 );
+	__ld.uiq	15
+	__call		_set_font_pal.1
+
+	.dbg	line,	"multimap.c", 286; load_default_font();
+	 _load_default_font
+
+	.dbg	line,	"multimap.c", 288; // You can use COUNTOF() to get the number of palettes in a .incpal.
+
+	.dbg	line,	"multimap.c", 290; load_palette( 0, seran_pal, COUNTOF(seran_pal) );
+	__st.umiq	0, _al
+	__farptr	_seran_pal, _bp_bank, _bp
+	__ld.wi		___countof__seran_pal
+	__st.umq	_ah
+	__call		_load_palette.3
+
+	.dbg	line,	"multimap.c", 292; // You can use SIZEOF() to get the number of bytes in a .incchr.
+
+	.dbg	line,	"multimap.c", 294; load_vram( 0x1000, seran_chr, SIZEOF(seran_chr) >> 1 );
+	__st.wmiq	4096, _di
+	__farptr	_seran_chr, _bp_bank, _bp
+	__ld.wi		___sizeof__seran_chr
+	__lsr.wi	1
+	__st.wmq	_ax
+	 _load_vram.3
+
+	.dbg	line,	"multimap.c", 296; // The animations need to be in VRAM to use vram2vram() DMA.
+
+	.dbg	line,	"multimap.c", 298; load_vram( WATER_ANIM, water_chr, SIZEOF(water_chr) >> 1 );
+	__st.wmiq	12288, _di
+	__farptr	_water_chr, _bp_bank, _bp
+	__ld.wi		___sizeof__water_chr
+	__lsr.wi	1
+	__st.wmq	_ax
+	 _load_vram.3
+
+	.dbg	line,	"multimap.c", 299; load_vram( SHORE_ANIM, shore_chr, SIZEOF(shore_chr) >> 1 );
+	__st.wmiq	14336, _di
+	__farptr	_shore_chr, _bp_bank, _bp
+	__ld.wi		___sizeof__shore_chr
+	__lsr.wi	1
+	__st.wmq	_ax
+	 _load_vram.3
+
+	.dbg	line,	"multimap.c", 301; // We built the multi-screen map earlier, so we know that it is 4 screens wide.
+
+	.dbg	line,	"multimap.c", 302; //
+
+	.dbg	line,	"multimap.c", 303; // A multi-screen map defines the BLK used, so no call to "set_blocks()".
+
+	.dbg	line,	"multimap.c", 305; set_multimap( multi_map, 4 );
+	__farptr	_multi_map, vdc_scr_bank, vdc_scr_addr
+	__st.umiq	4, vdc_map_scrn_w
+	 _set_multimap.2
+
+	.dbg	line,	"multimap.c", 307; // The multi-screen map is drawn using global variables for the top-left
+
+	.dbg	line,	"multimap.c", 308; // coordinate in pixels, and the width and height in 8x8 characters.
+
+	.dbg	line,	"multimap.c", 310; vdc_map_pxl_x = 0;
+	__st.wmiq	0, _vdc_map_pxl_x
+
+	.dbg	line,	"multimap.c", 311; vdc_map_pxl_y = 0;
+	__st.wmiq	0, _vdc_map_pxl_y
+
+	.dbg	line,	"multimap.c", 312; vdc_map_draw_w = (VIEW_W / 8) + 1; // + 1 to allow for scrolling.
+	__st.umiq	31, _vdc_map_draw_w
+
+	.dbg	line,	"multimap.c", 313; vdc_map_draw_h = (VIEW_H / 8) + 1; // + 1 to allow for scrolling.
+	__st.umiq	27, _vdc_map_draw_h
+
+	.dbg	line,	"multimap.c", 315; draw_map();
+	__call		_draw_map
+
+	.dbg	line,	"multimap.c", 317; put_string( "How to use a Multi-Screen map.", 0, 0 );
+	__ld.wi		__const1+0
+	__st.wmq	_bp
+	__st.umiq	0, _dil
+	__st.umiq	0, _dih
+	__call		_put_string.3
+
+	.dbg	line,	"multimap.c", 318; put_string( "LRUD to scroll.  RUN for next.", 0, 1 );
+	__ld.wi		__const1+31
+	__st.wmq	_bp
+	__st.umiq	0, _dil
+	__st.umiq	1, _dih
+	__call		_put_string.3
+
+	.dbg	line,	"multimap.c", 320; scroll_split( 0, 0, vdc_map_pxl_x & (BAT_W - 1), vdc_map_pxl_y & (BAT_H - 1), BKG_ON | SPR_ON );
+	__st.umiq	0, _al
+	__st.umiq	0, _ah
+	__ld.wm		_vdc_map_pxl_x
+	__and.wi	255
+	__st.wmq	_bx
+	__ld.wm		_vdc_map_pxl_y
+	__and.wi	255
+	__st.wmq	_cx
+	__st.umiq	192, _dl
+	__call		_scroll_split.5
+
+	.dbg	line,	"multimap.c", 322; vsync();
+	__call		_vsync
+
+	.dbg	line,	"multimap.c", 324; disp_on();
+	__call		_disp_on
+
+	.dbg	line,	"multimap.c", 326; // Demo main loop.
+
+	.dbg	line,	"multimap.c", 328; for (;;)
+.LL3:
+.LL4:
+.LL5:
+
+	.dbg	line,	"multimap.c", 329; {
+
+	.dbg	line,	"multimap.c", 330; // It is usually best to put vsync() at the top of the game loop.
+
+	.dbg	line,	"multimap.c", 332; vsync();
+	__call		_vsync
+
+	.dbg	line,	"multimap.c", 334; // Finish when START is pressed.
+
+	.dbg	line,	"multimap.c", 336; if (joytrg(0) & JOY_STRT) {
+	__ld.uiq	0
+	 _joytrg.1
+	__tand.wi	8
+	__bfalse	.LL7
+
+	.dbg	line,	"multimap.c", 337; break;
+	__bra		.LL6
+
+	.dbg	line,	"multimap.c", 338; }
+
+	.dbg	line,	"multimap.c", 340; // Get movement direction.
+
+	.dbg	line,	"multimap.c", 342; if (joy(0) & JOY_LEFT) {
+.LL7:
+	__ld.uiq	0
+	 _joy.1
+	__tand.wi	128
+	__bfalse	.LL8
+
+	.dbg	line,	"multimap.c", 343; if (vdc_map_pxl_x > 0)
+	__ld.wm		_vdc_map_pxl_x
+	__ugt_w.wi	0
+	__bfalse	.LL9
+
+	.dbg	line,	"multimap.c", 344; vdc_map_pxl_x -= 2;
+	__sub_st.wmiq	2, _vdc_map_pxl_x
+
+	.dbg	line,	"multimap.c", 345; }
+.LL9	.alias		.LL10
+
+	.dbg	line,	"multimap.c", 346; else
+	__bra		.LL10
+.LL8:
+
+	.dbg	line,	"multimap.c", 347; if (joy(0) & JOY_RIGHT) {
+	__ld.uiq	0
+	 _joy.1
+	__tand.wi	32
+	__bfalse	.LL11
+
+	.dbg	line,	"multimap.c", 348; if (vdc_map_pxl_x < (1024 - VIEW_W))
+	__ld.wm		_vdc_map_pxl_x
+	__ult_w.wi	784
+	__bfalse	.LL12
+
+	.dbg	line,	"multimap.c", 349; vdc_map_pxl_x += 2;
+	__add_st.wmiq	2, _vdc_map_pxl_x
+
+	.dbg	line,	"multimap.c", 350; }
+.LL12:
+
+	.dbg	line,	"multimap.c", 352; if (joy(0) & JOY_UP) {
+.LL11:
+.LL10:
+	__ld.uiq	0
+	 _joy.1
+	__tand.wi	16
+	__bfalse	.LL13
+
+	.dbg	line,	"multimap.c", 353; if (vdc_map_pxl_y > 0)
+	__ld.wm		_vdc_map_pxl_y
+	__ugt_w.wi	0
+	__bfalse	.LL14
+
+	.dbg	line,	"multimap.c", 354; vdc_map_pxl_y -= 2;
+	__sub_st.wmiq	2, _vdc_map_pxl_y
+
+	.dbg	line,	"multimap.c", 355; }
+.LL14	.alias		.LL15
+
+	.dbg	line,	"multimap.c", 356; else
+	__bra		.LL15
+.LL13:
+
+	.dbg	line,	"multimap.c", 357; if (joy(0) & JOY_DOWN) {
+	__ld.uiq	0
+	 _joy.1
+	__tand.wi	64
+	__bfalse	.LL16
+
+	.dbg	line,	"multimap.c", 358; if (vdc_map_pxl_y < (1024 - VIEW_H))
+	__ld.wm		_vdc_map_pxl_y
+	__ult_w.wi	816
+	__bfalse	.LL17
+
+	.dbg	line,	"multimap.c", 359; vdc_map_pxl_y += 2;
+	__add_st.wmiq	2, _vdc_map_pxl_y
+
+	.dbg	line,	"multimap.c", 360; }
+.LL17:
+
+	.dbg	line,	"multimap.c", 362; // Update the newly-visible edges of the map.
+
+	.dbg	line,	"multimap.c", 364; scroll_map();
+.LL16:
+.LL15:
+	__call		_scroll_map
+
+	.dbg	line,	"multimap.c", 366; scroll_split( 0, 0, vdc_map_pxl_x & (BAT_W - 1), vdc_map_pxl_y & (BAT_H - 1), BKG_ON | SPR_ON );
+	__st.umiq	0, _al
+	__st.umiq	0, _ah
+	__ld.wm		_vdc_map_pxl_x
+	__and.wi	255
+	__st.wmq	_bx
+	__ld.wm		_vdc_map_pxl_y
+	__and.wi	255
+	__st.wmq	_cx
+	__st.umiq	192, _dl
+	__call		_scroll_split.5
+
+	.dbg	line,	"multimap.c", 368; // Animate the Seran water by overwriting background characters (tiles) from
+
+	.dbg	line,	"multimap.c", 369; // copies of the animation that are already in VRAM using VRAM-to-VRAM DMA.
+
+	.dbg	line,	"multimap.c", 371; if (++water_delay == 6) {
+	__incld.um	_water_delay
+	__equ_b.uiq	6
+	__bfalse	.LL18
+
+	.dbg	line,	"multimap.c", 372; water_delay = 0;
+	__st.umiq	0, _water_delay
+
+	.dbg	line,	"multimap.c", 374; // Use vram2vram DMA to update the background animation in the next vblank.
+
+	.dbg	line,	"multimap.c", 376; if (water_cycle ^= 1) {
+	__ld.wi		1
+	__eor.um	_water_cycle
+	__st.um		_water_cycle
+	__tst.wr
+	__bfalse	.LL19
+
+	.dbg	line,	"multimap.c", 377; // 4 animation frames of 8x1 characters per frame,
+
+	.dbg	line,	"multimap.c", 378; vram2vram( SHORE_CHR, SHORE_ANIM + (shore_frame * SHORE_SIZE), ( 8 * TILE_WORDS) );
+	__st.wmiq	4352, _ax
+	__ld.um		_shore_frame
+	__asl.wi	7
+	__add.wi	14336
+	__st.wmq	_bx
+	__st.wmiq	128, _cx
+	__call		_vram2vram.3
+
+	.dbg	line,	"multimap.c", 379; shore_frame = ++shore_frame & 3;
+	__incld.um	_shore_frame
+	__and.uiq	3
+	__st.umq	_shore_frame
+
+	.dbg	line,	"multimap.c", 380; } else {
+	__bra		.LL20
+.LL19:
+
+	.dbg	line,	"multimap.c", 381; // 8 animation frames of 4x4 characters per frame,
+
+	.dbg	line,	"multimap.c", 382; vram2vram( WATER_CHR, WATER_ANIM + (water_frame * WATER_SIZE), (16 * TILE_WORDS) );
+	__st.wmiq	4096, _ax
+	__ld.um		_water_frame
+	__asl.wi	8
+	__add.wi	12288
+	__st.wmq	_bx
+	__st.wmiq	256, _cx
+	__call		_vram2vram.3
+
+	.dbg	line,	"multimap.c", 383; water_frame = ++water_frame & 7;
+	__incld.um	_water_frame
+	__and.uiq	7
+	__st.umq	_water_frame
+
+	.dbg	line,	"multimap.c", 384; }
+.LL20	.alias		.LL5
+
+	.dbg	line,	"multimap.c", 385; }
+
+	.dbg	line,	"multimap.c", 386; }
+.LL18	.alias		.LL5
+	__bra		.LL5
+.LL6:
+
+	.dbg	line,	"multimap.c", 387; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"multimap.c", 390; // **************************************************************************
+	.dbg	line,	"multimap.c", 391; // **************************************************************************
+	.dbg	line,	"multimap.c", 392; //
+	.dbg	line,	"multimap.c", 393; // Switch between different demos (if there are different demos) ...
+	.dbg	line,	"multimap.c", 394; //
+	.dbg	line,	"multimap.c", 395; // **************************************************************************
+	.dbg	line,	"multimap.c", 396; // **************************************************************************
+	.dbg	line,	"multimap.c", 398; main()
+	.dbg	line,	"multimap.c", 399; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"multimap.c", 400; for (;;)
+.LL22:
+.LL23:
+.LL24:
+
+	.dbg	line,	"multimap.c", 401; {
+
+	.dbg	line,	"multimap.c", 402; // An example of scrolling a block map with animation.
+
+	.dbg	line,	"multimap.c", 404; test_multimap();
+	__call		_test_multimap
+
+	.dbg	line,	"multimap.c", 405; }
+	__bra		.LL24
+.LL25:
+
+	.dbg	line,	"multimap.c", 406; }
+.LL21:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'H','o','w',' ','t','o',' ','u'
+		db	's','e',' ','a',' ','M','u','l'
+		db	't','i','-','S','c','r','e','e'
+		db	'n',' ','m','a','p','.',$00,'L'
+		db	'R','U','D',' ','t','o',' ','s'
+		db	'c','r','o','l','l','.',' ',' '
+		db	'R','U','N',' ','f','o','r',' '
+		db	'n','e','x','t','.',$00
+_seran_msk:
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+		db	0
+
+	.bss
+_water_delay:
+		ds	1
+_water_cycle:
+		ds	1
+_water_frame:
+		ds	1
+_shore_frame:
+		ds	1
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:62
+;	constant pool:256
+;	global pool:279
+;	Macro pool:130
@@ -0,0 +1,1765 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (b16933f, 2026-10-17)
+; on Sat Oct 17 10:20:38 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"../../../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 3; //
+	.dbg	line,	"../../../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"../../../include/hucc/globals.h", 5; //
+	.dbg	line,	"../../../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 8; //
+	.dbg	line,	"../../../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"../../../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"../../../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"../../../include/hucc/globals.h", 12; //
+	.dbg	line,	"../../../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"../../../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"../../../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"../../../include/hucc/globals.h", 16; //
+	.dbg	line,	"../../../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"multiblk.c", 1; /****************************************************************************
+	.dbg	line,	"multiblk.c", 2; ; ***************************************************************************
+	.dbg	line,	"multiblk.c", 3; ;
+	.dbg	line,	"multiblk.c", 4; ; multiblk.c
+	.dbg	line,	"multiblk.c", 5; ;
+	.dbg	line,	"multiblk.c", 6; ; An example of using multiple sets of blocks in a multi-screen block map.
+	.dbg	line,	"multiblk.c", 7; ;
+	.dbg	line,	"multiblk.c", 8; ; Copyright John Brandwood 2025.
+	.dbg	line,	"multiblk.c", 9; ;
+	.dbg	line,	"multiblk.c", 10; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"multiblk.c", 11; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"multiblk.c", 12; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"multiblk.c", 13; ;
+	.dbg	line,	"multiblk.c", 14; ; ***************************************************************************
+	.dbg	line,	"multiblk.c", 15; ; ***************************************************************************
+	.dbg	line,	"multiblk.c", 16; ;
+	.dbg	line,	"multiblk.c", 17; ; This expands upon the previous example to show how to use two map sections
+	.dbg	line,	"multiblk.c", 18; ; in a multi-screen map in order to work around the limited number of blocks
+	.dbg	line,	"multiblk.c", 19; ; (256 at most) in a single map section.
+	.dbg	line,	"multiblk.c", 20; ;
+	.dbg	line,	"multiblk.c", 21; ; This example also shows how to do background animation using color-cycling
+	.dbg	line,	"multiblk.c", 22; ; instead of uploading animated 8x8 characters.
+	.dbg	line,	"multiblk.c", 23; ;
+	.dbg	line,	"multiblk.c", 24; ; It also shows how to put a project's graphics conversion steps into a .ASM
+	.dbg	line,	"multiblk.c", 25; ; file in order to keep the C source code cleaner and easier to follow.
+	.dbg	line,	"multiblk.c", 26; ;
+	.dbg	line,	"multiblk.c", 27; ; Don't worry, you do not need to learn how to program in assembly-language!
+	.dbg	line,	"multiblk.c", 28; ;
+	.dbg	line,	"multiblk.c", 29; ; Finally, this example adds palette fading at the start and end of the demo
+	.dbg	line,	"multiblk.c", 30; ; to show how to create faded palettes from a reference palette.
+	.dbg	line,	"multiblk.c", 31; ;
+	.dbg	line,	"multiblk.c", 32; ; ***************************************************************************
+	.dbg	line,	"multiblk.c", 33; ; ***************************************************************************
+	.dbg	line,	"multiblk.c", 34; ;
+	.dbg	line,	"multiblk.c", 35; ; This uses the Seran Village map from Falcom's "Legend of Xanadu 2" game.
+	.dbg	line,	"multiblk.c", 36; ;
+	.dbg	line,	"multiblk.c", 37; ; See the README.md file in the "../seran/" directory for more information.
+	.dbg	line,	"multiblk.c", 38; ;
+	.dbg	line,	"multiblk.c", 39; ; ***************************************************************************
+	.dbg	line,	"multiblk.c", 40; ; **************************************************************************/
+	.dbg	line,	"multiblk.c", 42; #include "huc.h"
+	.dbg	line,	"../../../include/hucc/huc.h", 1; #ifndef _hucc_legacy_h
+	.dbg	line,	"../../../include/hucc/huc.h", 2; #define _hucc_legacy_h
+	.dbg	line,	"../../../include/hucc/huc.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 6; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 7; ; huc.h
+	.dbg	line,	"../../../include/hucc/huc.h", 8; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 9; ; HuCC wrapper file to include a default set of HuC-compatible functions.
+	.dbg	line,	"../../../include/hucc/huc.h", 10; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/huc.h", 12; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/huc.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/huc.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/huc.h", 16; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 19; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 20; ; When the HuCC compiler is invoked with the "--legacy" option to compile old
+	.dbg	line,	"../../../include/hucc/huc.h", 21; ; projects, then this "huc.h" file is automatically included.
+	.dbg	line,	"../../../include/hucc/huc.h", 22; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 23; ; This file includes a set of the individual HuCC headers which correspond to
+	.dbg	line,	"../../../include/hucc/huc.h", 24; ; HuC's built-in functions and MagicKit library.
+	.dbg	line,	"../../../include/hucc/huc.h", 25; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 26; ; New HuCC projects should, preferably, include the specific headers that are
+	.dbg	line,	"../../../include/hucc/huc.h", 27; ; needed, which will then allow them to replace parts of the standard library
+	.dbg	line,	"../../../include/hucc/huc.h", 28; ; with newer functions, or they can just manually include this "huc.h" file.
+	.dbg	line,	"../../../include/hucc/huc.h", 29; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 30; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 31; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/huc.h", 33; #include "hucc-systemcard.h"
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 1; #ifndef _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 2; #define _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 7; ; hucc-systemcard.h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 9; ; Macros and library functions for using the System Card.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 20; ; Because these are mainly macros, and so must be included before being used
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 21; ; in compiled code, the actual functions here are written to avoid using any
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 22; ; BSS memory so that HuCC's overlay global-shared-variables are not effected.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 23; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 24; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 25; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 27; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 28; // Backup RAM defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 29; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 31; #define  BM_OK             0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 32; #define  BM_NOT_FOUND      1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 33; #define  BM_BAD_CHECKSUM   2
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 34; #define  BM_DIR_CORRUPTED  3
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 35; #define  BM_FILE_EMPTY     4
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 36; #define  BM_FULL           5
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 37; #define  BM_NOT_FORMATED   0xFF			// HuC incorrect spelling.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 38; #define  BM_NOT_FORMATTED  0xFF			// HuCC can use a dictionary!
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 40; #define  BRAM_STARTPTR     0x8010
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 42; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 43; // CD defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 44; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 46; #define	CDPLAY_MUTE		0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 47; #define	CDPLAY_REPEAT		1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 48; #define	CDPLAY_NORMAL		2
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 49; #define	CDPLAY_ENDOFDISC	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 51; #define	CDFADE_CANCEL	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 52; #define	CDFADE_PCM6	8
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 53; #define	CDFADE_ADPCM6	10
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 54; #define	CDFADE_PCM2	12
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 55; #define	CDFADE_ADPCM2	14
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 57; #define CDTRK_AUDIO	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 58; #define CDTRK_DATA	4
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 61; // ADPCM defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 62; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 64; #define	ADPLAY_AUTOSTOP		0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 65; #define	ADPLAY_REPEAT		0x80
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 67; #define ADPLAY_FREQ_16KHZ	0xE
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 68; #define ADPLAY_FREQ_10KHZ	0xD
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 69; #define ADPLAY_FREQ_8KHZ	0xC
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 70; #define ADPLAY_FREQ_6KHZ	0xB
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 71; #define ADPLAY_FREQ_5KHZ	0xA
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 73; #define ADREAD_RAM	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 74; #define ADREAD_VRAM	0xFF
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 76; #define ADWRITE_RAM	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 77; #define ADWRITE_VRAM	0xFF
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 79; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 80; // Functions in hucc-systemcard.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 81; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 83; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 85; #asmdef	HUCC_USES_SYSTEMCARD 1
+HUCC_USES_SYSTEMCARD = 1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 87; extern void __fastcall __macro cd_boot( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 88; extern unsigned int __fastcall __macro cd_getver( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 89; extern void __fastcall __macro cd_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 90; extern unsigned char __fastcall __macro cd_pause( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 91; extern unsigned char __fastcall cd_unpause( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 92; extern void __fastcall __macro cd_fade( unsigned char type<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 93; extern unsigned char __fastcall cd_playtrk( unsigned char start_track<_bx>, unsigned char end_track<_cx>, unsigned char mode<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 94; extern unsigned char __fastcall cd_playmsf( unsigned char start_minute<_al>,  unsigned char start_second<_ah>,  unsigned char start_frame<_bl>, unsigned char end_minute<_cl>,  unsigned char end_second<_ch>,  unsigned char end_frame<_dl>,  unsigned char mode<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 95; extern unsigned char __fastcall cd_fastvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int sectors<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 96; extern unsigned char __fastcall cd_loadvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 97; extern unsigned char __fastcall cd_loaddata( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char __far *buffer<_bp_bank:_bp>, unsigned int bytes<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 98; extern unsigned char __fastcall cd_loadbank( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char bank<_bl>, unsigned int sectors<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 99; extern unsigned char __fastcall __macro cd_status( unsigned char mode<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 101; extern void __fastcall __macro ad_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 102; extern unsigned char __fastcall __macro ad_trans( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char nb_sectors<_dh>, unsigned int ad_addr<_bx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 103; extern void __fastcall __macro ad_read( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 104; extern void __fastcall __macro ad_write( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 105; extern unsigned char __fastcall __macro ad_play( unsigned int ad_addr<_bx>, unsigned int bytes<_ax>, unsigned char freq<_dh>, unsigned char mode<_dl> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 106; extern unsigned char __fastcall __macro ad_cplay( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int nb_sectors<_bx>, unsigned char freq<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 107; extern void __fastcall __macro ad_stop( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 108; extern unsigned char __fastcall __macro ad_stat( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 110; extern unsigned char __fastcall bm_check( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 111; extern unsigned char __fastcall bm_format( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 112; extern unsigned int __fastcall __macro bm_free( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 113; extern unsigned char __fastcall __macro bm_read( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 114; extern unsigned char __fastcall __macro bm_write( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 115; extern unsigned char __fastcall __macro bm_delete( unsigned char *name<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 117; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 119; extern unsigned char __fastcall __macro bm_exist( unsigned char *name<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 120; extern unsigned char __fastcall __macro bm_create( unsigned char *name<_ax>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 122; // void __fastcall _xsafe add_sectors( unsigned int sector_offset<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 124; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 126; #endif // _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/huc.h", 34; #include "hucc-baselib.h"
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 1; #ifndef _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 2; #define _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 7; ; hucc-baselib.h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 9; ; Basic library functions provided as macros.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 18; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 20; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 21; // Joypad defines ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 22; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 24; #define	JOY_A		0x01
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 25; #define	JOY_I		0x01
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 26; #define	JOY_B		0x02
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 27; #define	JOY_II		0x02
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 28; #define	JOY_SLCT	0x04
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 29; #define	JOY_SEL		0x04
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 30; #define	JOY_STRT	0x08
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 31; #define	JOY_RUN		0x08
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 32; #define	JOY_UP		0x10
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 33; #define	JOY_RGHT	0x20
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 34; #define	JOY_RIGHT	0x20
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 35; #define	JOY_DOWN	0x40
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 36; #define	JOY_LEFT	0x80
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 38; #define	JOY_C		0x0100
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 39; #define	JOY_III		0x0100
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 40; #define	JOY_D		0x0200
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 41; #define	JOY_IV		0x0200
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 42; #define	JOY_E		0x0400
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 43; #define	JOY_V		0x0400
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 44; #define	JOY_F		0x0800
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 45; #define	JOY_VI		0x0800
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 47; #define JOY_SIXBUT	0x8000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 48; #define JOY_TYPE6	0x8000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 50; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 51; // SuperGRAFX VPC settings for set_vpc_ctl() ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 52; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 54; #define VPC_SPR1_BKG1_SPR2_BKG2	0x3000 // same as SGX_PARALLAX=0
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 55; #define VPC_SPR1_SPR2_BKG1_BKG2	0x7000 // same as SGX_PARALLAX=1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 56; #define VPC_BKG1_BKG2_SPR1_SPR2	0xB000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 58; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 59; // System Card variables ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 62; extern unsigned int si;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 63; extern unsigned int di;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 64; extern unsigned int bp;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 66; extern unsigned int ax;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 67; extern unsigned int bx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 68; extern unsigned int cx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 69; extern unsigned int dx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 71; extern unsigned char al;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 72; extern unsigned char ah;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 73; extern unsigned char bl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 74; extern unsigned char bh;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 75; extern unsigned char cl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 76; extern unsigned char ch;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 77; extern unsigned char dl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 78; extern unsigned char dh;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 80; extern unsigned char irq_cnt;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 81; extern unsigned char joynow[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 82; extern unsigned char joytrg[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 83; extern unsigned char joy6now[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 84; extern unsigned char joy6trg[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 85; extern unsigned int  bg_x1;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 86; extern unsigned int  bg_y1;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 87; extern unsigned int  bg_x2;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 88; extern unsigned int  bg_y2;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 90; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 91; // Special macros to get information from PCEAS ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 92; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 94; #define BANK( datasym ) ((unsigned) (&__bank__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 95; #define SIZEOF( datasym ) ((unsigned) (&__sizeof__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 96; #define COUNTOF( datasym ) ((unsigned) (&__countof__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 97; #define OVERLAY( datasym ) ((unsigned) (&__overlay__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 100; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 101; // Functions in hucc-baselib.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 102; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 104; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 106; #asmdef	HUCC_USES_BASELIB 1
+HUCC_USES_BASELIB = 1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 108; #define	_OPTIMIZE 1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 111; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 112; // Hardware Detection
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 113; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 115; extern unsigned char __fastcall __macro sgx_detect( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 116; extern unsigned char __fastcall __macro ac_exists( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 119; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 120; // Memory Access
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 121; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 123; extern unsigned char __fastcall __macro peek( unsigned int addr<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 124; extern unsigned int  __fastcall __macro peekw( unsigned int addr<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 126; extern void __fastcall __macro poke( unsigned int addr<__poke>, unsigned char with<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 127; extern void __fastcall __macro pokew( unsigned int addr<__poke>, unsigned int with<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 129; extern unsigned char __fastcall farpeek( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 130; extern unsigned int  __fastcall farpeekw( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 132; extern void __fastcall __nop set_far_base( unsigned char data_bank<_bp_bank>, unsigned char *data_addr<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 133; extern void __fastcall set_far_offset( unsigned int offset<_bp>, unsigned char data_bank<_bp_bank>, unsigned char *data_addr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 135; extern unsigned char __fastcall far_peek( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 136; extern unsigned int  __fastcall far_peekw( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 138; extern void __fastcall __macro reset_mpr2( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 139; extern void __fastcall __macro reset_mpr34( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 141; extern void * __fastcall __macro farset_mpr2( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 142; extern void * __fastcall __macro farset_mpr34( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 144; extern void * __fastcall __macro far_set_mpr2( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 145; extern void * __fastcall __macro far_set_mpr34( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 148; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 149; // Clock Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 150; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 152; extern unsigned char __fastcall __macro clock_hh( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 153; extern unsigned char __fastcall __macro clock_mm( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 154; extern unsigned char __fastcall __macro clock_ss( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 155; extern unsigned char __fastcall __macro clock_tt( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 156; extern void __fastcall __macro clock_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 159; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 160; // Joypad Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 161; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 163; extern unsigned int __fastcall __macro joy( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 164; extern unsigned int __fastcall __macro joytrg( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 167; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 168; // Number Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 169; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 171; extern void __fastcall __macro srand( unsigned char seed<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 172; extern unsigned int __fastcall rand( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 173; extern unsigned char __fastcall rand8( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 175; // Note: "limit" is 0..255.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 176; extern unsigned char __fastcall random8( unsigned char limit<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 178; // Note: "limit" is 0..128, 129..255 are treated as 128!
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 179; extern unsigned char __fastcall random( unsigned char limit<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 182; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 183; // Overlay Execution
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 184; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 186; extern unsigned char __fastcall __macro cd_execoverlay( unsigned char ovl_index<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 189; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 190; // Functions that are only optionally available if configured in your hucc-config.inc
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 191; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 193; extern unsigned int __fastcall __macro joybuf( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 194; extern unsigned int __fastcall __macro get_joy_events( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 195; extern void __fastcall __macro clear_joy_events( unsigned char mask<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 198; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 199; // Functions that are only implemented in the TGEMU emulator for unit-testing
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 200; // the compiler, and which should never be used in normal HuCC projects ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 201; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 203; extern void __fastcall dump_screen( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 205; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 207; #endif // _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/huc.h", 35; #include "hucc-gfx.h"
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 1; #ifndef _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 2; #define _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 7; ; huc-gfx.h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 22; // Screen defines ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 25; #define	SCR_SIZE_32x32	0
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 26; #define	SCR_SIZE_64x32	1
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 27; #define	SCR_SIZE_128x32	2
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 28; #define	SCR_SIZE_32x64	4
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 29; #define	SCR_SIZE_64x64	5
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 30; #define	SCR_SIZE_128x64	6
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 32; #define	XRES_SHARP	0
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 33; #define	XRES_SOFT	4
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 34; #define	XRES_KEEP	128
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 36; #define VPC_WIN_A	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 37; #define VPC_WIN_B	0x01
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 38; #define	VPC_WIN_AB	0x02
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 39; #define	VPC_WIN_NONE	0x03
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 40; #define	VPC_NORM	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 41; #define	VPC_SPR		0x04
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 42; #define	VPC_INV_SPR	0x08
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 43; #define VDC1_ON		0x01
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 44; #define	VDC1_OFF	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 45; #define VDC2_ON		0x02
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 46; #define	VDC2_OFF	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 47; #define VDC_ON		0x03
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 48; #define	VDC_OFF		0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 50; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 51; // Functions in hucc-gfx.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 52; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 54; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 56; #asmdef	HUCC_USES_GFX 1
+HUCC_USES_GFX = 1
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 58; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 59; // Color and Palette Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 62; extern void __fastcall clear_palette( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 64; extern void __fastcall __nop set_color( unsigned int index<VCE_CTA>, unsigned int value<VCE_CTW> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 65; extern void __fastcall set_color_rgb( unsigned int index<VCE_CTA>, unsigned char r<_al>, unsigned char g<_ah>, unsigned char b<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 66; extern unsigned int __fastcall __macro get_color( unsigned int index<VCE_CTA> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 68; extern void __fastcall load_palette( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 69; extern void __fastcall far_load_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 71; extern void __fastcall read_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah>, unsigned int *destination<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 73; extern void __fastcall __macro fade_to_black( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 74; extern void __fastcall __macro fade_to_white( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 75; extern void __fastcall __macro cross_fade_to( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 77; extern void __fastcall __macro far_fade_to_black( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 78; extern void __fastcall __macro far_fade_to_white( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 79; extern void __fastcall __macro far_cross_fade_to( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 83; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 84; // Video Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 85; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 87; extern void __fastcall init_240x208( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 88; extern void __fastcall init_256x224( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 90; extern void __fastcall vsync( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 91; extern void __fastcall vsync( unsigned char count<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 93; extern void __fastcall disp_on( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 94; extern void __fastcall disp_off( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 96; extern void __fastcall set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 98; extern void __fastcall set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 100; extern void __fastcall cls( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 101; extern void __fastcall cls( unsigned int tile<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 103; extern unsigned int __fastcall __macro vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 104; extern unsigned int __fastcall __macro get_vram( unsigned int address<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 105; extern void __fastcall __macro put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 107; extern void __fastcall __macro load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 108; extern void __fastcall __macro far_load_vram( unsigned int vram<_di>,  unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 110; extern void __fastcall load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 111; extern void __fastcall far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 113; extern void __fastcall __macro load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 114; extern void __fastcall __macro far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 116; extern void __fastcall vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 119; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 120; // SuperGRAFX Video Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 121; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 123; extern void __fastcall __nop vpc_set_ctl( unsigned int bits<VPC_CR> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 124; extern void __fastcall __nop vpc_set_win1( unsigned int width<VPC_WINDOW1> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 125; extern void __fastcall __nop vpc_set_win2( unsigned int width<VPC_WINDOW2> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 127; extern void __fastcall sgx_set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 129; extern void __fastcall sgx_set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 131; extern void __fastcall sgx_cls( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 132; extern void __fastcall sgx_cls( unsigned int tile<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 134; extern unsigned int __fastcall __macro sgx_vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 135; extern unsigned int __fastcall __macro sgx_get_vram( unsigned int address<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 136; extern void __fastcall __macro sgx_put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 138; extern void __fastcall __macro sgx_load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 139; extern void __fastcall __macro sgx_far_load_vram( unsigned int vram<_di>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 141; extern void __fastcall sgx_load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 142; extern void __fastcall sgx_far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 144; extern void __fastcall __macro sgx_load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 145; extern void __fastcall __macro sgx_far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 147; extern void __fastcall sgx_vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 150; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 151; // Font Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 152; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 154; extern void __fastcall set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 155; extern void __fastcall set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 157; extern void __fastcall load_font( unsigned char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 158; extern void __fastcall far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 160; extern void __fastcall __nop set_font_color( unsigned char foreground<monofont_fg>, unsigned char background<monofont_bg> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 161; extern void __fastcall __macro load_default_font( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 164; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 165; // SuperGRAFX Font Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 166; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 168; extern void __fastcall sgx_set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 169; extern void __fastcall sgx_set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 171; extern void __fastcall sgx_load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 172; extern void __fastcall sgx_far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 174; extern void __fastcall __macro sgx_load_default_font( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 177; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 178; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 179; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 181; extern void __fastcall __macro set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 182; extern void __fastcall __macro sgx_set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 184; extern void __fastcall load_background( unsigned char __far *tiles<_bp_bank:_bp>, unsigned char __far *palettes<__fbank:__fptr>, unsigned char __far *bat<_cl:_bx>, unsigned char w<_dl>, unsigned char h<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 186; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 187; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 188; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 189; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 191; extern void __fastcall load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 193; extern void __fastcall put_string( unsigned char *string<_bp>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 195; extern void __fastcall put_char( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 196; extern void __fastcall put_digit( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 197; extern void __fastcall put_hex( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 198; extern void __fastcall put_number( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 199; extern void __fastcall put_raw( unsigned int data<_bx>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 201; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 203; #endif // _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/huc.h", 36; #include "hucc-old-scroll.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 1; #ifndef _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 2; #define _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 7; ; hucc-old-scroll.h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 19; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 20; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 21; ; HuC's old scrolling library is provided for use with existing HuC projects,
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 22; ; but it should preferably be avoided in new projects because it is slow and
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 23; ; forever limited by its choice to handle gaps between areas, and sorting.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 24; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 25; ; HuCC's new scrolling library puts the responibility for defining both gaps
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 26; ; and the display order into the project's hands, but in return it runs much
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 27; ; faster, using less than 1/6 of the processing time in VBLANK, and far less
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 28; ; time in the RCR interrputs themselves. It also supports the 2nd SuperGRAFX
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 29; ; screen layer, which HuC's old scrolling library ignores.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 30; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 31; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 32; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 34; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 35; // Functions in hucc-old-scroll.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 36; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 38; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 40; #asmdef	HUCC_USES_OLD_SCROLL 1
+HUCC_USES_OLD_SCROLL = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 42; extern void __fastcall scroll( unsigned char num<_al>, unsigned int x<_cx>, unsigned int y<_dx>, unsigned char top<_ah>, unsigned char bottom<_bl>, unsigned char disp<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 43; extern void __fastcall scroll_disable( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 45; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 47; #endif // _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/huc.h", 37; #include "hucc-old-spr.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 1; #ifndef _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 2; #define _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 7; ; hucc-old-spr.h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 22; // Sprite defines ...
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 25; #define FLIP_X_MASK 0x08
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 26; #define FLIP_Y_MASK 0x80
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 27; #define FLIP_MAS    0x88
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 28; #define SIZE_MAS    0x31
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 30; #define NO_FLIP     0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 31; #define NO_FLIP_X   0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 32; #define NO_FLIP_Y   0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 33; #define FLIP_X      0x08
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 34; #define FLIP_Y      0x80
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 35; #define SZ_16x16    0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 36; #define SZ_16x32    0x10
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 37; #define SZ_16x64    0x30
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 38; #define SZ_32x16    0x01
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 39; #define SZ_32x32    0x11
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 40; #define	SZ_32x64    0x31
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 42; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 43; // Functions in hucc-old-spr.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 44; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 46; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 48; #asmdef	HUCC_USES_OLD_SPR 1
+HUCC_USES_OLD_SPR = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 50; extern void __fastcall init_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 51; extern void __fastcall reset_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 52; extern void __fastcall satb_update( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 53; extern void __fastcall spr_set( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 54; extern void __fastcall spr_hide( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 55; extern void __fastcall spr_show( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 56; extern void __fastcall spr_x( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 57; extern void __fastcall spr_y( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 58; extern void __fastcall spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 59; extern void __fastcall spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 60; extern void __fastcall spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 61; extern void __fastcall spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 63; extern unsigned int __fastcall spr_get_x( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 64; extern unsigned int __fastcall spr_get_y( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 66; extern void __fastcall sgx_init_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 67; extern void __fastcall sgx_reset_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 68; extern void __fastcall sgx_satb_update( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 69; extern void __fastcall sgx_spr_set( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 70; extern void __fastcall sgx_spr_hide( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 71; extern void __fastcall sgx_spr_show( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 72; extern void __fastcall sgx_spr_x( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 73; extern void __fastcall sgx_spr_y( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 74; extern void __fastcall sgx_spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 75; extern void __fastcall sgx_spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 76; extern void __fastcall sgx_spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 77; extern void __fastcall sgx_spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 79; extern unsigned int __fastcall sgx_spr_get_x( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 80; extern unsigned int __fastcall sgx_spr_get_y( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 82; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 84; #endif // _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/huc.h", 38; #include "hucc-old-map.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 1; #ifndef _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 2; #define _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 7; ; hucc-old-map.h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 22; // Functions in hucc-old-map.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 25; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 27; #asmdef	HUCC_USES_OLD_MAP 1
+HUCC_USES_OLD_MAP = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 29; extern void __fastcall set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 30; extern void __fastcall sgx_set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 32; extern void __fastcall __nop set_tile_data( unsigned char __far *tiles<vdc_tile_bank:vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 33; extern void __fastcall __nop sgx_set_tile_data( unsigned char __far *tiles<sgx_tile_bank:sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 35; extern void __fastcall __nop set_far_tile_data( unsigned char tile_bank<vdc_tile_bank>, unsigned char *tile_addr<vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char palette_table_bank<vdc_attr_bank>, unsigned char *palette_table_addr<vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 36; extern void __fastcall __nop sgx_set_far_tile_data( unsigned char tile_bank<sgx_tile_bank>, unsigned char *tile_addr<sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char palette_table_bank<sgx_attr_bank>, unsigned char *palette_table_addr<sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 38; extern void __fastcall __nop set_map_data( unsigned char __far *map<vdc_map_bank:vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 39; extern void __fastcall __nop sgx_set_map_data( unsigned char __far *map<sgx_map_bank:sgx_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 41; extern void __fastcall __nop set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 42; extern void __fastcall __nop sgx_set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 44; extern void __fastcall load_tile( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 45; extern void __fastcall sgx_load_tile( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 47; extern void __fastcall load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 48; extern void __fastcall sgx_load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 50; extern unsigned char __fastcall map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 51; extern unsigned char __fastcall sgx_map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 53; extern void __fastcall map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 54; extern void __fastcall sgx_map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 56; extern void __fastcall put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 57; extern void __fastcall sgx_put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 59; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 61; extern void __fastcall set_tile_data( unsigned char *tile_ex<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 63; extern void __fastcall __nop set_map_pals( unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 64; extern void __fastcall __nop set_map_tile_type( unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 66; extern void __fastcall __nop sgx_set_map_pals( unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 67; extern void __fastcall __nop sgx_set_map_tile_type( unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 69; extern void __fastcall set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 70; extern void __fastcall sgx_set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 72; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 74; #endif // _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/huc.h", 39; #include "hucc-old-line.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 1; #ifndef _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 2; #define _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 7; ; hucc-old-line.h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 22; // Functions in hucc-old-line.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 25; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 27; #asmdef	HUCC_USES_OLD_LINE 1
+HUCC_USES_OLD_LINE = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 29; extern void __fastcall gfx_init( unsigned int start_vram_addr<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 30; extern void __fastcall gfx_clear( unsigned int start_vram_addr<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 31; extern void __fastcall gfx_plot( unsigned int x<_gfx_x1>, unsigned int y<_gfx_y1>, char color<_gfx_color> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 32; extern void __fastcall gfx_line( unsigned int x1<_gfx_x1>, unsigned int y1<_gfx_y1>, unsigned int x2<_gfx_x2>, unsigned int y2<_gfx_y2>, unsigned char color<_gfx_color> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 34; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 36; #endif // _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/huc.h", 41; #include <stdlib.h>
+	.dbg	line,	"../../../include/hucc/stdlib.h", 1; #ifndef _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/stdlib.h", 2; #define _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/stdlib.h", 4; #define RAND_MAX 32767
+	.dbg	line,	"../../../include/hucc/stdlib.h", 6; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/stdlib.h", 7; extern int __fastcall abs( int value<acc> );
+	.dbg	line,	"../../../include/hucc/stdlib.h", 8; #endif
+	.dbg	line,	"../../../include/hucc/stdlib.h", 10; #endif // _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/huc.h", 42; #include <string.h>
+	.dbg	line,	"../../../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"../../../include/hucc/string.h", 3; #endif
+	.dbg	line,	"../../../include/hucc/huc.h", 44; #endif // _hucc_legacy_h
+	.dbg	line,	"multiblk.c", 43; #include "hucc-scroll.h"
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 1; #ifndef _hucc_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 2; #define _hucc_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 7; ; hucc-scroll.h
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 9; ; Routines for a fast split-screen scrolling system.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 20; ; The maximum number of splits for each screen layer is set in your project's
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 21; ; "hucc-config.inc" file, with the library having a limit of 128-per-layer.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 22; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 23; ; Your first active split must be defined to start at screen line 0, and then
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 24; ; the rest of the active splits must be in increasing line order to match the
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 25; ; way that the PC Engine displays the output image.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 26; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 27; ; You can have disabled splits interleaved with your active splits.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 28; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 29; ; Splits that are normally disabled can be used to create full screen effects
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 30; ; such as bouncing the screen up and down by adding blank areas at the top or
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 31; ; bottom of the screen, and then rapidly changing the height of those areas.
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 32; ;
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 33; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 34; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 36; // *************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 37; // VDC bits for display_flags ...
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 38; // *************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 40; #ifndef BKG_OFF
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 41; #define BKG_OFF 0x00
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 42; #endif
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 44; #ifndef SPR_OFF
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 45; #define SPR_OFF 0x00
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 46; #endif
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 48; #ifndef BKG_ON
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 49; #define BKG_ON 0x80
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 50; #endif
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 52; #ifndef SPR_ON
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 53; #define SPR_ON 0x40
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 54; #endif
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 56; // *************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 57; // Functions in hucc-scroll.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 58; // *************
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 60; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 62; #asmdef	HUCC_USES_NEW_SCROLL 1
+HUCC_USES_NEW_SCROLL = 1
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 64; extern void __fastcall scroll_split( unsigned char index<_al>, unsigned char screen_line<_ah>, unsigned int bat_x<_bx>, unsigned int bat_y<_cx>, unsigned char display_flags<_dl> );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 65; extern void __fastcall sgx_scroll_split( unsigned char index<_al>, unsigned char screen_line<_ah>, unsigned int bat_x<_bx>, unsigned int bat_y<_cx>, unsigned char display_flags<_dl> );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 67; extern void __fastcall disable_split( unsigned char index<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 68; extern void __fastcall sgx_disable_split( unsigned char index<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 70; extern void __fastcall __macro disable_all_splits( void );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 71; extern void __fastcall __macro sgx_disable_all_splits( void );
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 73; #asm
+	.dbg	clear
+		.macro	_disable_all_splits
+		ldy	#HUCC_PCE_SPLITS - 1
+!loop:		tya
+		call	_disable_split.1
+		dey
+		bpl	!loop-
+		.endm
+		.macro	_sgx_disable_all_splits
+		ldy	#HUCC_SGX_SPLITS - 1
+!loop:		tya
+		call	_sgx_disable_split.1
+		dey
+		bpl	!loop-
+		.endm
+
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 89; #endasm
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 91; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-scroll.h", 93; #endif // _hucc_scroll_h
+	.dbg	line,	"multiblk.c", 44; #include "hucc-blkmap.h"
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 1; #ifndef _hucc_blkmap_h
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 2; #define _hucc_blkmap_h
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 7; ; hucc-blkmap.h
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 9; ; A map system based on 16x16 meta-tiles (aka "blocks", aka CHR/BLK/MAP).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 11; ; Copyright John Brandwood 2025.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 20; ; The maximum X and Y size for blkmaps is 128 blocks (2048 pixels).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 21; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 22; ; The maximum total size for a blkmap is 16KBytes, which allows for maps up
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 23; ; to 128x128 blocks (2048x2048 pixels).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 24; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 25; ; Huge multi-screen blkmaps are also supported (optionally).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 26; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 27; ; The maximum X and Y for multi-screen maps is 128 screens (32768 pixels).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 28; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 29; ; The maximum total size for a multi-screen map is 8KBytes, which allows for
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 30; ; a total of 1024 screens.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 31; ;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 32; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 33; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 35; // *************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 36; // Functions in blkmap.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 37; // *************
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 39; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 41; #asmdef	HUCC_USES_BLKMAP 1
+HUCC_USES_BLKMAP = 1
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 43; // Current top-left of drawn map in pixels.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 44; extern unsigned int   vdc_map_pxl_x;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 45; extern unsigned int   vdc_map_pxl_y;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 47; // Width and height to draw/scroll in characters (not tiles).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 48; extern unsigned char  vdc_map_draw_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 49; extern unsigned char  vdc_map_draw_h;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 51; // Width of map (or multi-screen BAT) in tiles.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 52; extern unsigned char  vdc_map_line_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 54; // Width of map in screens (if multi-screen map).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 55; extern unsigned char  vdc_map_scrn_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 57; // Extra information returned by get_map_block() and sgx_get_map_block(),
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 58; // which are the collision flags and the mask/overlay sprite for the BLK.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 59; extern unsigned char  map_blk_flag;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 60; extern unsigned char  map_blk_mask;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 62; extern unsigned char  vdc_scr_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 63; extern unsigned char *vdc_scr_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 65; extern unsigned char  vdc_map_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 66; extern unsigned char *vdc_map_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 68; extern unsigned char  vdc_blk_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 69; extern unsigned char *vdc_blk_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 71; extern unsigned char  vdc_tbl_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 72; extern unsigned char *vdc_tbl_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 74; extern void __fastcall set_blocks( unsigned char __far *blk_def<vdc_blk_bank:vdc_blk_addr>, unsigned char __far *flg_def<vdc_tbl_bank:vdc_tbl_addr>, unsigned char number_of_blocks<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 75; extern void __fastcall __macro set_blkmap( unsigned char __far *blk_map<vdc_map_bank:vdc_map_addr>, unsigned char blocks_w<vdc_map_line_w> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 76; extern void __fastcall __macro set_multimap( unsigned char __far *multi_map<vdc_scr_bank:vdc_scr_addr>, unsigned char screens_w<vdc_map_scrn_w> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 78; extern void __fastcall draw_map( void );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 79; extern void __fastcall scroll_map( void );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 81; extern void __fastcall blit_map( unsigned char tile_x<map_bat_x>, unsigned char tile_y<map_bat_y>, unsigned char tile_w<map_draw_x>, unsigned char tile_h<map_draw_y> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 83; extern unsigned char __fastcall get_map_block( unsigned int x<map_pxl_x>, unsigned int y<map_pxl_y> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 85; #asm
+	.dbg	clear
+		.macro	_set_blkmap.2
+		stz	vdc_scr_bank
+		.endm
+		.macro	_set_multimap.2
+		lda	vdc_bat_width
+		lsr	a
+		sta	vdc_map_line_w
+		.endm
+		.macro	SCREEN
+		db	(((\1) & $1FFF) | $6000) >> 8, bank(\1)
+		db	(((\2) & $1FFF) | $4000) >> 8, bank(\2)
+		db	(((\3) & $1FFF) | $6000) >> 8, bank(\3)
+		dw	(\4)
+		.endm
+
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 102; #endasm
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 104; #ifdef _SGX
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 106; // Current top-left of drawn map in pixels.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 107; extern unsigned int   sgx_map_pxl_x;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 108; extern unsigned int   sgx_map_pxl_y;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 110; // Width and height to draw/scroll in characters (not tiles).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 111; extern unsigned char  sgx_map_draw_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 112; extern unsigned char  sgx_map_draw_h;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 114; // Width of map (or multi-screen BAT) in tiles.
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 115; extern unsigned char  sgx_map_line_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 117; // Width of map in screens (if multi-screen map).
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 118; extern unsigned char  sgx_map_scrn_w;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 120; extern unsigned char  sgx_scr_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 121; extern unsigned char *sgx_scr_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 123; extern unsigned char  sgx_map_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 124; extern unsigned char *sgx_map_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 126; extern unsigned char  sgx_blk_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 127; extern unsigned char *sgx_blk_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 129; extern unsigned char  sgx_tbl_bank;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 130; extern unsigned char *sgx_tbl_addr;
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 132; extern void __fastcall sgx_set_blocks( unsigned char __far *blk_def<sgx_blk_bank:sgx_blk_addr>, unsigned char __far *flg_def<sgx_tbl_bank:sgx_tbl_addr>, unsigned char number_of_blocks<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 133; extern void __fastcall __macro sgx_set_blkmap( unsigned char __far *blk_map<sgx_map_bank:sgx_map_addr>, unsigned char blocks_w<sgx_map_line_w> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 134; extern void __fastcall __macro sgx_set_multimap( unsigned char __far *multi_map<sgx_scr_bank:sgx_scr_addr>, unsigned char screens_w<sgx_map_scrn_w> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 136; extern void __fastcall sgx_draw_map( void );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 137; extern void __fastcall sgx_scroll_map( void );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 139; extern void __fastcall sgx_blit_map( unsigned char tile_x<map_bat_x>, unsigned char tile_y<map_bat_y>, unsigned char tile_w<map_draw_x>, unsigned char tile_h<map_draw_y> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 141; extern unsigned char __fastcall sgx_get_map_block( unsigned int x<map_pxl_x>, unsigned int y<map_pxl_y> );
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 143; #asm
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 144; .macro	_sgx_set_blkmap.2
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 145; stz	sgx_scr_bank
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 146; .endm
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 148; .macro	_sgx_set_multimap.2
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 149; lda	sgx_bat_width
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 150; lsr	a
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 151; sta	sgx_map_line_w
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 152; .endm
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 153; #endasm
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 155; #endif
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 157; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-blkmap.h", 159; #endif // _hucc_blkmap_h
+	.dbg	line,	"multiblk.c", 47; // **************************************************************************
+	.dbg	line,	"multiblk.c", 48; // **************************************************************************
+	.dbg	line,	"multiblk.c", 49; //
+	.dbg	line,	"multiblk.c", 50; // An example of scrolling a block map (a map with 16x16 meta-tiles).
+	.dbg	line,	"multiblk.c", 51; //
+	.dbg	line,	"multiblk.c", 52; // This also shows one way to animate background characters in the map.
+	.dbg	line,	"multiblk.c", 53; //
+	.dbg	line,	"multiblk.c", 54; // **************************************************************************
+	.dbg	line,	"multiblk.c", 55; // **************************************************************************
+	.dbg	line,	"multiblk.c", 58; // Do all of the graphics conversion in a separate file.
+	.dbg	line,	"multiblk.c", 60; #asm
+	.dbg	clear
+.include "graphics.asm"
+
+	.dbg	line,	"multiblk.c", 62; #endasm
+	.dbg	line,	"multiblk.c", 65; // Inform the C compiler about the data that was created in "graphics.asm".
+	.dbg	line,	"multiblk.c", 67; extern unsigned char waves_pal[];
+	.dbg	line,	"multiblk.c", 68; extern unsigned char seran_pal[];
+	.dbg	line,	"multiblk.c", 69; extern unsigned char seran_water[];
+	.dbg	line,	"multiblk.c", 70; extern unsigned char seran_shore[];
+	.dbg	line,	"multiblk.c", 71; extern unsigned char seran_chr[];
+	.dbg	line,	"multiblk.c", 72; extern unsigned char multi_map[];
+	.dbg	line,	"multiblk.c", 75; // Define the screen size that we're going to use to reduce the number of
+	.dbg	line,	"multiblk.c", 76; // unexplained "magic" numbers later on.
+	.dbg	line,	"multiblk.c", 78; #define VIEW_W 256
+	.dbg	line,	"multiblk.c", 79; #define VIEW_H 224
+	.dbg	line,	"multiblk.c", 81; #define BAT_W 512
+	.dbg	line,	"multiblk.c", 82; #define BAT_H 256
+	.dbg	line,	"multiblk.c", 84; #define SPEED 2
+	.dbg	line,	"multiblk.c", 87; // Define where the map's original copies of the animated characters are in VRAM
+	.dbg	line,	"multiblk.c", 88; // so that they can be swapped out with the animated versions of the characters.
+	.dbg	line,	"multiblk.c", 89; //
+	.dbg	line,	"multiblk.c", 90; // We know what the VRAM addresses are because we specifically put the 1st frame
+	.dbg	line,	"multiblk.c", 91; // of each animation at the start of the character set.
+	.dbg	line,	"multiblk.c", 93; #define WATER_CHR 0x1000
+	.dbg	line,	"multiblk.c", 94; #define SHORE_CHR 0x1100
+	.dbg	line,	"multiblk.c", 97; // Define where to upload the animation characters in VRAM so that they are all
+	.dbg	line,	"multiblk.c", 98; // in VRAM and can be used for the VDC chip's vram2vram DMA.
+	.dbg	line,	"multiblk.c", 99; //
+	.dbg	line,	"multiblk.c", 100; // Using 2 sets of blocks in a single character set has increased the number of
+	.dbg	line,	"multiblk.c", 101; // of characters to just over 0x300 so we're moving the animations around a bit
+	.dbg	line,	"multiblk.c", 102; // so that the total usage is 32KBytes (VRAM $1000..$4FFF).
+	.dbg	line,	"multiblk.c", 104; #define SHORE_ANIM 0x4600
+	.dbg	line,	"multiblk.c", 105; #define WATER_ANIM 0x4800
+	.dbg	line,	"multiblk.c", 108; // Define the size of each frame of the animation, an 8x8 character is 16 words.
+	.dbg	line,	"multiblk.c", 109; //
+	.dbg	line,	"multiblk.c", 110; // HuCC users please note ... putting the constant math in parentheses helps the
+	.dbg	line,	"multiblk.c", 111; // compiler optimize it to a single number when the #defines are used.
+	.dbg	line,	"multiblk.c", 113; #define PALETTE_BYTES 32
+	.dbg	line,	"multiblk.c", 114; #define TILE_WORDS 16
+	.dbg	line,	"multiblk.c", 115; #define WATER_SIZE (4 * 4 * TILE_WORDS)
+	.dbg	line,	"multiblk.c", 116; #define SHORE_SIZE (8 * 1 * TILE_WORDS)
+	.dbg	line,	"multiblk.c", 119; // Variables for the animation.
+	.dbg	line,	"multiblk.c", 121; unsigned char water_delay;
+	.dbg	line,	"multiblk.c", 122; unsigned char water_cycle;
+	.dbg	line,	"multiblk.c", 123; unsigned char water_frame;
+	.dbg	line,	"multiblk.c", 124; unsigned char shore_frame;
+	.dbg	line,	"multiblk.c", 126; unsigned char waves_delay;
+	.dbg	line,	"multiblk.c", 127; unsigned int  waves_frame;
+	.dbg	line,	"multiblk.c", 129; // Buffers for fading palettes.
+	.dbg	line,	"multiblk.c", 131; unsigned char fade_val;      // 0..7
+	.dbg	line,	"multiblk.c", 132; unsigned int  fade_pal[256]; // Buffer for 256 faded colors.
+	.dbg	line,	"multiblk.c", 133; unsigned int  base_pal[256]; // Buffer for the original un-faded colors.
+	.dbg	line,	"multiblk.c", 135; //
+	.dbg	line,	"multiblk.c", 137; test_multiblk()
+	.dbg	line,	"multiblk.c", 138; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test_multiblk
+	__enter		_test_multiblk
+
+	.dbg	line,	"multiblk.c", 139; //	// This is the HuCC default, so it isn't actually needed.
+
+	.dbg	line,	"multiblk.c", 140; //
+
+	.dbg	line,	"multiblk.c", 141; //	init_256x224();
+
+	.dbg	line,	"multiblk.c", 143; // So just disable the display and clear the palette before uploading the graphics.
+
+	.dbg	line,	"multiblk.c", 145; disp_off();
+	__call		_disp_off
+
+	.dbg	line,	"multiblk.c", 146; vsync();
+	__call		_vsync
+
+	.dbg	line,	"multiblk.c", 147; clear_palette();
+	__call		_clear_palette
+
+	.dbg	line,	"multiblk.c", 149; // Upload the default HuCC font.
+
+	.dbg	line,	"multiblk.c", 151; set_font_color( 4, 0 );
+	__st.umiq	4, monofont_fg
+	__st.umiq	0, monofont_bg
+
+	.dbg	line,	"multiblk.c", 152; set_font_pal( 15 );
+	__ld.uiq	15
+	__call		_set_font_pal.1
+
+	.dbg	line,	"multiblk.c", 153; load_default_font();
+	 _load_default_font
+
+	.dbg	line,	"multiblk.c", 155; // You can use SIZEOF() to get the number of bytes in a .incchr.
+
+	.dbg	line,	"multiblk.c", 157; load_vram( 0x1000, seran_chr, SIZEOF(seran_chr) >> 1 );
+	__st.wmiq	4096, _di
+	__farptr	_seran_chr, _bp_bank, _bp
+	__ld.wi		___sizeof__seran_chr
+	__lsr.wi	1
+	__st.wmq	_ax
+	 _load_vram.3
+
+	.dbg	line,	"multiblk.c", 159; // The animations need to be in VRAM to use vram2vram() DMA.
+
+	.dbg	line,	"multiblk.c", 161; load_vram( WATER_ANIM, seran_water, SIZEOF(seran_water) >> 1 );
+	__st.wmiq	18432, _di
+	__farptr	_seran_water, _bp_bank, _bp
+	__ld.wi		___sizeof__seran_water
+	__lsr.wi	1
+	__st.wmq	_ax
+	 _load_vram.3
+
+	.dbg	line,	"multiblk.c", 162; load_vram( SHORE_ANIM, seran_shore, SIZEOF(seran_shore) >> 1 );
+	__st.wmiq	17920, _di
+	__farptr	_seran_shore, _bp_bank, _bp
+	__ld.wi		___sizeof__seran_shore
+	__lsr.wi	1
+	__st.wmq	_ax
+	 _load_vram.3
+
+	.dbg	line,	"multiblk.c", 164; // We built the multi-screen map earlier, so we know that it is 2 screens wide.
+
+	.dbg	line,	"multiblk.c", 165; //
+
+	.dbg	line,	"multiblk.c", 166; // A multi-screen map defines the BLK used, so no call to "set_blocks()".
+
+	.dbg	line,	"multiblk.c", 168; set_multimap( multi_map, 2 );
+	__farptr	_multi_map, vdc_scr_bank, vdc_scr_addr
+	__st.umiq	2, vdc_map_scrn_w
+	 _set_multimap.2
+
+	.dbg	line,	"multiblk.c", 170; // The multi-screen map is drawn using global variables for the top-left
+
+	.dbg	line,	"multiblk.c", 171; // coordinate in pixels, and the width and height in 8x8 characters.
+
+	.dbg	line,	"multiblk.c", 173; vdc_map_pxl_x = 0;
+	__st.wmiq	0, _vdc_map_pxl_x
+
+	.dbg	line,	"multiblk.c", 174; vdc_map_pxl_y = 0;
+	__st.wmiq	0, _vdc_map_pxl_y
+
+	.dbg	line,	"multiblk.c", 175; vdc_map_draw_w = (VIEW_W / 8) + 1; // + 1 to allow for scrolling.
+	__st.umiq	33, _vdc_map_draw_w
+
+	.dbg	line,	"multiblk.c", 176; vdc_map_draw_h = (VIEW_H / 8) + 1; // + 1 to allow for scrolling.
+	__st.umiq	29, _vdc_map_draw_h
+
+	.dbg	line,	"multiblk.c", 178; draw_map();
+	__call		_draw_map
+
+	.dbg	line,	"multiblk.c", 180; put_string( " Use 2 sets of blocks in a map. ", 0, 0 );
+	__ld.wi		__const1+0
+	__st.wmq	_bp
+	__st.umiq	0, _dil
+	__st.umiq	0, _dih
+	__call		_put_string.3
+
+	.dbg	line,	"multiblk.c", 181; put_string( " LRUD to scroll.  RUN for next. ", 0, 1 );
+	__ld.wi		__const1+33
+	__st.wmq	_bp
+	__st.umiq	0, _dil
+	__st.umiq	1, _dih
+	__call		_put_string.3
+
+	.dbg	line,	"multiblk.c", 183; #ifdef _OVERLAY // Defined by HuCC when building a CD overlay file.
+
+	.dbg	line,	"multiblk.c", 185; // This bit shows how to load a data file into memory from the CD. It really
+
+	.dbg	line,	"multiblk.c", 186; // has nothing to do with the multiblk example, but it was convenient to add
+
+	.dbg	line,	"multiblk.c", 187; // it here. Sorry if this is confusing! ;-)
+
+	.dbg	line,	"multiblk.c", 188; //
+
+	.dbg	line,	"multiblk.c", 189; // Load 1 sector (i.e. 2048 bytes) of CD file 2 into bank $87 which is known
+
+	.dbg	line,	"multiblk.c", 190; // to be unused because this example is so short!
+
+	.dbg	line,	"multiblk.c", 192; cd_loadbank( 2, 0, 0x87, 1 );
+	__st.umiq	2, _cl
+	__st.wmiq	0, _si
+	__st.umiq	135, _bl
+	__st.wmiq	1, _al
+	__call		_cd_loadbank.4
+
+	.dbg	line,	"multiblk.c", 194; // Bank $87 is automatically mapped into MPR2 (address $4000-$5FFF) at start
+
+	.dbg	line,	"multiblk.c", 195; // and this just prints that memory as a string.
+
+	.dbg	line,	"multiblk.c", 197; set_font_pal( 8 );
+	__ld.uiq	8
+	__call		_set_font_pal.1
+
+	.dbg	line,	"multiblk.c", 198; put_string( 0x4000, 1, 3 );
+	__st.wmiq	16384, _bp
+	__st.umiq	1, _dil
+	__st.umiq	3, _dih
+	__call		_put_string.3
+
+	.dbg	line,	"multiblk.c", 200; #endif
+
+	.dbg	line,	"multiblk.c", 202; scroll_split( 0, 0, vdc_map_pxl_x & (BAT_W - 1), vdc_map_pxl_y & (BAT_H - 1), BKG_ON | SPR_ON );
+	__st.umiq	0, _al
+	__st.umiq	0, _ah
+	__ld.wm		_vdc_map_pxl_x
+	__and.wi	511
+	__st.wmq	_bx
+	__ld.wm		_vdc_map_pxl_y
+	__and.wi	255
+	__st.wmq	_cx
+	__st.umiq	192, _dl
+	__call		_scroll_split.5
+
+	.dbg	line,	"multiblk.c", 204; vsync();
+	__call		_vsync
+
+	.dbg	line,	"multiblk.c", 206; disp_on();
+	__call		_disp_on
+
+	.dbg	line,	"multiblk.c", 208; // Fade in the screen before starting the main loop, ending at -1 which is 255 as unsigned.
+
+	.dbg	line,	"multiblk.c", 210; for (fade_val = 7; fade_val != 255; --fade_val)
+	__st.umiq	7, _fade_val
+.LL3:
+	__ld.umq	_fade_val
+	__neq_b.uiq	255
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__dec.umq	_fade_val
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"multiblk.c", 211; {
+
+	.dbg	line,	"multiblk.c", 212; // Create a 256 color faded palette in the fade_pal[] array by subtracting
+
+	.dbg	line,	"multiblk.c", 213; // the fade_val (7..0) from each of the RGB color components in seran_pal.
+
+	.dbg	line,	"multiblk.c", 215; fade_to_black( seran_pal, fade_pal, 256, fade_val );
+	__farptr	_seran_pal, _bp_bank, _bp
+	__ld.wi		_fade_pal
+	__st.wmq	_di
+	__st.umiq	256, _al
+	__ld.um		_fade_val
+	__st.umq	_ah
+	 _fade_to_black.4
+
+	.dbg	line,	"multiblk.c", 217; // Load the background palette from the fade_pal[] arrary.
+
+	.dbg	line,	"multiblk.c", 219; load_palette( 0, fade_pal, 16 );
+	__st.umiq	0, _al
+	__farptr	_fade_pal, _bp_bank, _bp
+	__st.umiq	16, _ah
+	__call		_load_palette.3
+
+	.dbg	line,	"multiblk.c", 221; // Don't go too fast, there are only 8 steps!
+
+	.dbg	line,	"multiblk.c", 223; vsync( 5 );
+	__st.umiq	5, _al
+	__call		_vsync.1
+
+	.dbg	line,	"multiblk.c", 224; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"multiblk.c", 226; // Demo main loop.
+
+	.dbg	line,	"multiblk.c", 228; for (;;)
+.LL7:
+.LL8:
+.LL9:
+
+	.dbg	line,	"multiblk.c", 229; {
+
+	.dbg	line,	"multiblk.c", 230; // It is usually best to put vsync() at the top of the game loop.
+
+	.dbg	line,	"multiblk.c", 232; vsync();
+	__call		_vsync
+
+	.dbg	line,	"multiblk.c", 234; // Finish when START is pressed.
+
+	.dbg	line,	"multiblk.c", 236; if (joytrg(0) & JOY_STRT) {
+	__ld.uiq	0
+	 _joytrg.1
+	__tand.wi	8
+	__bfalse	.LL11
+
+	.dbg	line,	"multiblk.c", 237; break;
+	__bra		.LL10
+
+	.dbg	line,	"multiblk.c", 238; }
+
+	.dbg	line,	"multiblk.c", 240; // Get movement direction.
+
+	.dbg	line,	"multiblk.c", 242; if (joy(0) & JOY_LEFT) {
+.LL11:
+	__ld.uiq	0
+	 _joy.1
+	__tand.wi	128
+	__bfalse	.LL12
+
+	.dbg	line,	"multiblk.c", 243; if (vdc_map_pxl_x > 0)
+	__ld.wm		_vdc_map_pxl_x
+	__ugt_w.wi	0
+	__bfalse	.LL13
+
+	.dbg	line,	"multiblk.c", 244; vdc_map_pxl_x -= SPEED;
+	__sub_st.wmiq	2, _vdc_map_pxl_x
+
+	.dbg	line,	"multiblk.c", 245; }
+.LL13	.alias		.LL14
+
+	.dbg	line,	"multiblk.c", 246; else
+	__bra		.LL14
+.LL12:
+
+	.dbg	line,	"multiblk.c", 247; if (joy(0) & JOY_RIGHT) {
+	__ld.uiq	0
+	 _joy.1
+	__tand.wi	32
+	__bfalse	.LL15
+
+	.dbg	line,	"multiblk.c", 248; if (vdc_map_pxl_x < (1024 - VIEW_W))
+	__ld.wm		_vdc_map_pxl_x
+	__ult_w.wi	768
+	__bfalse	.LL16
+
+	.dbg	line,	"multiblk.c", 249; vdc_map_pxl_x += SPEED;
+	__add_st.wmiq	2, _vdc_map_pxl_x
+
+	.dbg	line,	"multiblk.c", 250; }
+.LL16:
+
+	.dbg	line,	"multiblk.c", 252; if (joy(0) & JOY_UP) {
+.LL15:
+.LL14:
+	__ld.uiq	0
+	 _joy.1
+	__tand.wi	16
+	__bfalse	.LL17
+
+	.dbg	line,	"multiblk.c", 253; if (vdc_map_pxl_y > 0)
+	__ld.wm		_vdc_map_pxl_y
+	__ugt_w.wi	0
+	__bfalse	.LL18
+
+	.dbg	line,	"multiblk.c", 254; vdc_map_pxl_y -= SPEED;
+	__sub_st.wmiq	2, _vdc_map_pxl_y
+
+	.dbg	line,	"multiblk.c", 255; }
+.LL18	.alias		.LL19
+
+	.dbg	line,	"multiblk.c", 256; else
+	__bra		.LL19
+.LL17:
+
+	.dbg	line,	"multiblk.c", 257; if (joy(0) & JOY_DOWN) {
+	__ld.uiq	0
+	 _joy.1
+	__tand.wi	64
+	__bfalse	.LL20
+
+	.dbg	line,	"multiblk.c", 258; if (vdc_map_pxl_y < (1792 - VIEW_H))
+	__ld.wm		_vdc_map_pxl_y
+	__ult_w.wi	1568
+	__bfalse	.LL21
+
+	.dbg	line,	"multiblk.c", 259; vdc_map_pxl_y += SPEED;
+	__add_st.wmiq	2, _vdc_map_pxl_y
+
+	.dbg	line,	"multiblk.c", 260; }
+.LL21:
+
+	.dbg	line,	"multiblk.c", 262; // Update the newly-visible edges of the map.
+
+	.dbg	line,	"multiblk.c", 264; scroll_map();
+.LL20:
+.LL19:
+	__call		_scroll_map
+
+	.dbg	line,	"multiblk.c", 266; scroll_split( 0, 0, vdc_map_pxl_x & (BAT_W - 1), vdc_map_pxl_y & (BAT_H - 1), BKG_ON | SPR_ON );
+	__st.umiq	0, _al
+	__st.umiq	0, _ah
+	__ld.wm		_vdc_map_pxl_x
+	__and.wi	511
+	__st.wmq	_bx
+	__ld.wm		_vdc_map_pxl_y
+	__and.wi	255
+	__st.wmq	_cx
+	__st.umiq	192, _dl
+	__call		_scroll_split.5
+
+	.dbg	line,	"multiblk.c", 268; // Animate the Seran water by overwriting background characters (tiles) from
+
+	.dbg	line,	"multiblk.c", 269; // copies of the animation that are already in VRAM using VRAM-to-VRAM DMA.
+
+	.dbg	line,	"multiblk.c", 271; if (++water_delay == 6) {
+	__incld.um	_water_delay
+	__equ_b.uiq	6
+	__bfalse	.LL22
+
+	.dbg	line,	"multiblk.c", 272; water_delay = 0;
+	__st.umiq	0, _water_delay
+
+	.dbg	line,	"multiblk.c", 274; // Use vram2vram DMA to update the background animation in the next vblank.
+
+	.dbg	line,	"multiblk.c", 276; if (water_cycle ^= 1) {
+	__ld.wi		1
+	__eor.um	_water_cycle
+	__st.um		_water_cycle
+	__tst.wr
+	__bfalse	.LL23
+
+	.dbg	line,	"multiblk.c", 277; // 4 animation frames of 8x1 characters per frame,
+
+	.dbg	line,	"multiblk.c", 278; vram2vram( SHORE_CHR, SHORE_ANIM + (shore_frame * SHORE_SIZE), ( 8 * TILE_WORDS) );
+	__st.wmiq	4352, _ax
+	__ld.um		_shore_frame
+	__asl.wi	7
+	__add.wi	17920
+	__st.wmq	_bx
+	__st.wmiq	128, _cx
+	__call		_vram2vram.3
+
+	.dbg	line,	"multiblk.c", 279; shore_frame = ++shore_frame & 3;
+	__incld.um	_shore_frame
+	__and.uiq	3
+	__st.umq	_shore_frame
+
+	.dbg	line,	"multiblk.c", 280; } else {
+	__bra		.LL24
+.LL23:
+
+	.dbg	line,	"multiblk.c", 281; // 8 animation frames of 4x4 characters per frame,
+
+	.dbg	line,	"multiblk.c", 282; vram2vram( WATER_CHR, WATER_ANIM + (water_frame * WATER_SIZE), (16 * TILE_WORDS) );
+	__st.wmiq	4096, _ax
+	__ld.um		_water_frame
+	__asl.wi	8
+	__add.wi	18432
+	__st.wmq	_bx
+	__st.wmiq	256, _cx
+	__call		_vram2vram.3
+
+	.dbg	line,	"multiblk.c", 283; water_frame = ++water_frame & 7;
+	__incld.um	_water_frame
+	__and.uiq	7
+	__st.umq	_water_frame
+
+	.dbg	line,	"multiblk.c", 284; }
+.LL24:
+
+	.dbg	line,	"multiblk.c", 285; }
+
+	.dbg	line,	"multiblk.c", 287; // Animate the Beach waves using color-cycled palette data.
+
+	.dbg	line,	"multiblk.c", 288; //
+
+	.dbg	line,	"multiblk.c", 289; // The wave characters are drawn in palettes 12 and 13, and the color-cycle is
+
+	.dbg	line,	"multiblk.c", 290; // stored in memory as 16 frames of 2 palettes for each frame.
+
+	.dbg	line,	"multiblk.c", 292; if (++waves_delay == 8)
+.LL22:
+	__incld.um	_waves_delay
+	__equ_b.uiq	8
+	__bfalse	.LL25
+
+	.dbg	line,	"multiblk.c", 293; {
+
+	.dbg	line,	"multiblk.c", 294; waves_delay = 0;
+	__st.umiq	0, _waves_delay
+
+	.dbg	line,	"multiblk.c", 295; set_far_offset( waves_frame, BANK(waves_pal), waves_pal );
+	__ld.wm		_waves_frame
+	__st.wmq	_bp
+	__ld.wi		___bank__waves_pal
+	__st.umq	_bp_bank
+	__ld.wi		_waves_pal
+	__call		_set_far_offset.3
+
+	.dbg	line,	"multiblk.c", 296; far_load_palette( 12, 2 );
+	__st.umiq	12, _al
+	__st.umiq	2, _ah
+	__call		_far_load_palette.2
+
+	.dbg	line,	"multiblk.c", 297; waves_frame = (waves_frame + PALETTE_BYTES * 2) & (PALETTE_BYTES * 2 * 16 - 1);
+	__ld.wm		_waves_frame
+	__add.wi	64
+	__and.wi	1023
+	__st.wmq	_waves_frame
+
+	.dbg	line,	"multiblk.c", 298; }
+
+	.dbg	line,	"multiblk.c", 299; }
+.LL25	.alias		.LL9
+	__bra		.LL9
+.LL10:
+
+	.dbg	line,	"multiblk.c", 301; // We could just use "seran_pal" as the reference for fading out the 
+
+	.dbg	line,	"multiblk.c", 302; // screen since in contains the entire background palette, but it is
+
+	.dbg	line,	"multiblk.c", 303; // useful to show how to read the existing VCE palette contents into
+
+	.dbg	line,	"multiblk.c", 304; // a buffer in RAM instead.
+
+	.dbg	line,	"multiblk.c", 306; read_palette( 0, 16, base_pal );
+	__st.umiq	0, _al
+	__st.umiq	16, _ah
+	__ld.wi		_base_pal
+	__st.wmq	_di
+	__call		_read_palette.3
+
+	.dbg	line,	"multiblk.c", 308; // Flash the screen to white, but stop before the final step (7) because that is
+
+	.dbg	line,	"multiblk.c", 309; // the first step of the next fade.
+
+	.dbg	line,	"multiblk.c", 311; for (fade_val = 0; fade_val != 7; ++fade_val)
+	__st.umiq	0, _fade_val
+.LL26:
+	__ld.umq	_fade_val
+	__neq_b.uiq	7
+	__btrue		.LL28
+	__bra		.LL29
+.LL27:
+	__inc.umq	_fade_val
+	__bra		.LL26
+.LL28:
+
+	.dbg	line,	"multiblk.c", 312; {
+
+	.dbg	line,	"multiblk.c", 313; // Create a 256 color faded palette in the fade_pal[] array by adding the
+
+	.dbg	line,	"multiblk.c", 314; // fade_val (0..6) to each of the RGB color components in base_pal[].
+
+	.dbg	line,	"multiblk.c", 316; fade_to_white( base_pal, fade_pal, 256, fade_val );
+	__farptr	_base_pal, _bp_bank, _bp
+	__ld.wi		_fade_pal
+	__st.wmq	_di
+	__st.umiq	256, _al
+	__ld.um		_fade_val
+	__st.umq	_ah
+	 _fade_to_white.4
+
+	.dbg	line,	"multiblk.c", 318; // Load the background palette from the fade_pal[] arrary.
+
+	.dbg	line,	"multiblk.c", 320; load_palette( 0, fade_pal, 16 );
+	__st.umiq	0, _al
+	__farptr	_fade_pal, _bp_bank, _bp
+	__st.umiq	16, _ah
+	__call		_load_palette.3
+
+	.dbg	line,	"multiblk.c", 322; // Don't go too fast, there are only 8 steps!
+
+	.dbg	line,	"multiblk.c", 324; vsync( 5 );
+	__st.umiq	5, _al
+	__call		_vsync.1
+
+	.dbg	line,	"multiblk.c", 325; }
+	__bra		.LL27
+.LL29:
+
+	.dbg	line,	"multiblk.c", 327; // Fade back down from white, but stop before the final step (0) because that is
+
+	.dbg	line,	"multiblk.c", 328; // the first step of the next fade.
+
+	.dbg	line,	"multiblk.c", 330; for (fade_val = 7; fade_val != 0; --fade_val)
+	__st.umiq	7, _fade_val
+.LL30:
+	__tst.um	_fade_val
+	__btrue		.LL32
+	__bra		.LL33
+.LL31:
+	__dec.umq	_fade_val
+	__bra		.LL30
+.LL32:
+
+	.dbg	line,	"multiblk.c", 331; {
+
+	.dbg	line,	"multiblk.c", 332; // Create a 256 color faded palette in the fade_pal[] array by adding the
+
+	.dbg	line,	"multiblk.c", 333; // fade_val (7..1) to each of the RGB color components in base_pal[].
+
+	.dbg	line,	"multiblk.c", 335; fade_to_white( base_pal, fade_pal, 256, fade_val );
+	__farptr	_base_pal, _bp_bank, _bp
+	__ld.wi		_fade_pal
+	__st.wmq	_di
+	__st.umiq	256, _al
+	__ld.um		_fade_val
+	__st.umq	_ah
+	 _fade_to_white.4
+
+	.dbg	line,	"multiblk.c", 337; // Load the background palette from the fade_pal[] arrary.
+
+	.dbg	line,	"multiblk.c", 339; load_palette( 0, fade_pal, 16 );
+	__st.umiq	0, _al
+	__farptr	_fade_pal, _bp_bank, _bp
+	__st.umiq	16, _ah
+	__call		_load_palette.3
+
+	.dbg	line,	"multiblk.c", 341; // Don't go too fast, there are only 8 steps!
+
+	.dbg	line,	"multiblk.c", 343; vsync( 5 );
+	__st.umiq	5, _al
+	__call		_vsync.1
+
+	.dbg	line,	"multiblk.c", 344; }
+	__bra		.LL31
+.LL33:
+
+	.dbg	line,	"multiblk.c", 346; // Finally fade down from the regular palette to black.
+
+	.dbg	line,	"multiblk.c", 348; for (fade_val = 0; fade_val != 8; ++fade_val)
+	__st.umiq	0, _fade_val
+.LL34:
+	__ld.umq	_fade_val
+	__neq_b.uiq	8
+	__btrue		.LL36
+	__bra		.LL37
+.LL35:
+	__inc.umq	_fade_val
+	__bra		.LL34
+.LL36:
+
+	.dbg	line,	"multiblk.c", 349; {
+
+	.dbg	line,	"multiblk.c", 350; // Create a 256 color faded palette in the fade_pal[] array by subtracting
+
+	.dbg	line,	"multiblk.c", 351; // the fade_val (0..7) from each of the RGB color components in base_pal[].
+
+	.dbg	line,	"multiblk.c", 353; fade_to_black( base_pal, fade_pal, 256, fade_val );
+	__farptr	_base_pal, _bp_bank, _bp
+	__ld.wi		_fade_pal
+	__st.wmq	_di
+	__st.umiq	256, _al
+	__ld.um		_fade_val
+	__st.umq	_ah
+	 _fade_to_black.4
+
+	.dbg	line,	"multiblk.c", 355; // Load the background palette from the fade_pal[] arrary.
+
+	.dbg	line,	"multiblk.c", 357; load_palette( 0, fade_pal, 16 );
+	__st.umiq	0, _al
+	__farptr	_fade_pal, _bp_bank, _bp
+	__st.umiq	16, _ah
+	__call		_load_palette.3
+
+	.dbg	line,	"multiblk.c", 359; // Don't go too fast, there are only 8 steps!
+
+	.dbg	line,	"multiblk.c", 361; vsync( 5 );
+	__st.umiq	5, _al
+	__call		_vsync.1
+
+	.dbg	line,	"multiblk.c", 362; }
+	__bra		.LL35
+.LL37:
+
+	.dbg	line,	"multiblk.c", 364; // Leave the screen black for 1/2 second, just to create a pause before the next demo.
+
+	.dbg	line,	"multiblk.c", 366; vsync( 30 );
+	__st.umiq	30, _al
+	__call		_vsync.1
+
+	.dbg	line,	"multiblk.c", 367; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"multiblk.c", 370; // **************************************************************************
+	.dbg	line,	"multiblk.c", 371; // **************************************************************************
+	.dbg	line,	"multiblk.c", 372; //
+	.dbg	line,	"multiblk.c", 373; // Switch between different demos (if there are different demos) ...
+	.dbg	line,	"multiblk.c", 374; //
+	.dbg	line,	"multiblk.c", 375; // **************************************************************************
+	.dbg	line,	"multiblk.c", 376; // **************************************************************************
+	.dbg	line,	"multiblk.c", 378; main()
+	.dbg	line,	"multiblk.c", 379; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"multiblk.c", 380; for (;;)
+.LL39:
+.LL40:
+.LL41:
+
+	.dbg	line,	"multiblk.c", 381; {
+
+	.dbg	line,	"multiblk.c", 382; test_multiblk();
+	__call		_test_multiblk
+
+	.dbg	line,	"multiblk.c", 383; }
+	__bra		.LL41
+.LL42:
+
+	.dbg	line,	"multiblk.c", 384; }
+.LL38:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	' ','U','s','e',' ','2',' ','s'
+		db	'e','t','s',' ','o','f',' ','b'
+		db	'l','o','c','k','s',' ','i','n'
+		db	' ','a',' ','m','a','p','.',' '
+		db	$00,' ','L','R','U','D',' ','t'
+		db	'o',' ','s','c','r','o','l','l'
+		db	'.',' ',' ','R','U','N',' ','f'
+		db	'o','r',' ','n','e','x','t','.'
+		db	' ',$00
+
+	.bss
+_water_delay:
+		ds	1
+_water_cycle:
+		ds	1
+_water_frame:
+		ds	1
+_shore_frame:
+		ds	1
+_waves_delay:
+		ds	1
+_waves_frame:
+		ds	2
+_fade_val:
+		ds	1
+_fade_pal:
+		ds	512
+_base_pal:
+		ds	512
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:66
+;	constant pool:0
+;	global pool:282
+;	Macro pool:133
@@ -0,0 +1,105 @@
+/*
+ *  mulbench.c
+ *
+ *  Show how many cycles HuCC's 16-bit "*" operator takes.
+ *
+ *  This is built twice, as "mulbench.pce" with the normal shift-and-add
+ *  multiply, and as "mulfast.pce" with FAST_MULTIPLY set, which uses the
+ *  table of squares at the cost of a 2KByte table in the HOME_BANK.
+ *
+ *  Each multiply is run 16384 times, and the frames that it takes are
+ *  compared with the same loop doing an add, so the result is the cost
+ *  of the multiply over the cost of an add.
+ */
+
+#include "huc.h"
+
+/* there are 119665 cycles in a frame, which is 467 * 256 */
+#define FRAME_CYCLES_256 467
+
+/* the number of times to repeat the 256 iterations */
+#define PASSES 64
+
+unsigned int a, b, r;
+
+unsigned char row;
+
+unsigned int time_mul(void)
+{
+	unsigned char i, j, last, now;
+	unsigned int frames;
+
+	frames = 0;
+	vsync();
+	last = irq_cnt;
+	for (j = 0; j < PASSES; ++j) {
+		i = 0;
+		do {
+			r = a * b;
+		} while (++i);
+		now = irq_cnt;
+		frames += (unsigned char)(now - last);
+		last = now;
+	}
+	return frames;
+}
+
+unsigned int time_add(void)
+{
+	unsigned char i, j, last, now;
+	unsigned int frames;
+
+	frames = 0;
+	vsync();
+	last = irq_cnt;
+	for (j = 0; j < PASSES; ++j) {
+		i = 0;
+		do {
+			r = a + b;
+		} while (++i);
+		now = irq_cnt;
+		frames += (unsigned char)(now - last);
+		last = now;
+	}
+	return frames;
+}
+
+void measure(unsigned int x, unsigned int y)
+{
+	unsigned int frames;
+
+	a = x;
+	b = y;
+	frames = time_mul() - time_add();
+
+	put_number(x, 5, 2, row);
+	put_string("*", 8, row);
+	put_number(y, 5, 10, row);
+	put_number(frames * FRAME_CYCLES_256 / PASSES, 5, 20, row);
+	put_string("cycles", 26, row);
+	row += 2;
+}
+
+main()
+{
+	set_color_rgb(1, 7, 7, 7);
+	set_font_color(1, 0);
+	set_font_pal(0);
+	load_default_font();
+
+#ifdef FAST_MULTIPLY
+	put_string("Table-of-squares multiply", 2, 2);
+#else
+	put_string("Shift-and-add multiply", 2, 2);
+#endif
+
+	row = 5;
+	measure(12, 34);
+	measure(1234, 56);
+	measure(12, 3456);
+	measure(1234, 5678);
+	measure(65535, 65535);
+
+	for (;;)
+		vsync();
+}
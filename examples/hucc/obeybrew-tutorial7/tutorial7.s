@@ -0,0 +1,2236 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (b16933f, 2026-10-17)
+; on Sat Oct 17 10:20:38 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"../../../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 3; //
+	.dbg	line,	"../../../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"../../../include/hucc/globals.h", 5; //
+	.dbg	line,	"../../../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 8; //
+	.dbg	line,	"../../../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"../../../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"../../../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"../../../include/hucc/globals.h", 12; //
+	.dbg	line,	"../../../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"../../../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"../../../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"../../../include/hucc/globals.h", 16; //
+	.dbg	line,	"../../../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tutorial7.c", 1; #include "huc.h"
+	.dbg	line,	"../../../include/hucc/huc.h", 1; #ifndef _hucc_legacy_h
+	.dbg	line,	"../../../include/hucc/huc.h", 2; #define _hucc_legacy_h
+	.dbg	line,	"../../../include/hucc/huc.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 6; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 7; ; huc.h
+	.dbg	line,	"../../../include/hucc/huc.h", 8; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 9; ; HuCC wrapper file to include a default set of HuC-compatible functions.
+	.dbg	line,	"../../../include/hucc/huc.h", 10; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/huc.h", 12; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/huc.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/huc.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/huc.h", 16; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 19; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 20; ; When the HuCC compiler is invoked with the "--legacy" option to compile old
+	.dbg	line,	"../../../include/hucc/huc.h", 21; ; projects, then this "huc.h" file is automatically included.
+	.dbg	line,	"../../../include/hucc/huc.h", 22; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 23; ; This file includes a set of the individual HuCC headers which correspond to
+	.dbg	line,	"../../../include/hucc/huc.h", 24; ; HuC's built-in functions and MagicKit library.
+	.dbg	line,	"../../../include/hucc/huc.h", 25; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 26; ; New HuCC projects should, preferably, include the specific headers that are
+	.dbg	line,	"../../../include/hucc/huc.h", 27; ; needed, which will then allow them to replace parts of the standard library
+	.dbg	line,	"../../../include/hucc/huc.h", 28; ; with newer functions, or they can just manually include this "huc.h" file.
+	.dbg	line,	"../../../include/hucc/huc.h", 29; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 30; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 31; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/huc.h", 33; #include "hucc-systemcard.h"
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 1; #ifndef _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 2; #define _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 7; ; hucc-systemcard.h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 9; ; Macros and library functions for using the System Card.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 20; ; Because these are mainly macros, and so must be included before being used
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 21; ; in compiled code, the actual functions here are written to avoid using any
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 22; ; BSS memory so that HuCC's overlay global-shared-variables are not effected.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 23; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 24; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 25; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 27; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 28; // Backup RAM defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 29; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 31; #define  BM_OK             0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 32; #define  BM_NOT_FOUND      1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 33; #define  BM_BAD_CHECKSUM   2
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 34; #define  BM_DIR_CORRUPTED  3
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 35; #define  BM_FILE_EMPTY     4
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 36; #define  BM_FULL           5
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 37; #define  BM_NOT_FORMATED   0xFF			// HuC incorrect spelling.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 38; #define  BM_NOT_FORMATTED  0xFF			// HuCC can use a dictionary!
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 40; #define  BRAM_STARTPTR     0x8010
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 42; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 43; // CD defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 44; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 46; #define	CDPLAY_MUTE		0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 47; #define	CDPLAY_REPEAT		1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 48; #define	CDPLAY_NORMAL		2
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 49; #define	CDPLAY_ENDOFDISC	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 51; #define	CDFADE_CANCEL	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 52; #define	CDFADE_PCM6	8
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 53; #define	CDFADE_ADPCM6	10
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 54; #define	CDFADE_PCM2	12
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 55; #define	CDFADE_ADPCM2	14
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 57; #define CDTRK_AUDIO	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 58; #define CDTRK_DATA	4
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 61; // ADPCM defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 62; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 64; #define	ADPLAY_AUTOSTOP		0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 65; #define	ADPLAY_REPEAT		0x80
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 67; #define ADPLAY_FREQ_16KHZ	0xE
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 68; #define ADPLAY_FREQ_10KHZ	0xD
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 69; #define ADPLAY_FREQ_8KHZ	0xC
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 70; #define ADPLAY_FREQ_6KHZ	0xB
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 71; #define ADPLAY_FREQ_5KHZ	0xA
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 73; #define ADREAD_RAM	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 74; #define ADREAD_VRAM	0xFF
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 76; #define ADWRITE_RAM	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 77; #define ADWRITE_VRAM	0xFF
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 79; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 80; // Functions in hucc-systemcard.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 81; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 83; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 85; #asmdef	HUCC_USES_SYSTEMCARD 1
+HUCC_USES_SYSTEMCARD = 1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 87; extern void __fastcall __macro cd_boot( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 88; extern unsigned int __fastcall __macro cd_getver( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 89; extern void __fastcall __macro cd_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 90; extern unsigned char __fastcall __macro cd_pause( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 91; extern unsigned char __fastcall cd_unpause( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 92; extern void __fastcall __macro cd_fade( unsigned char type<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 93; extern unsigned char __fastcall cd_playtrk( unsigned char start_track<_bx>, unsigned char end_track<_cx>, unsigned char mode<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 94; extern unsigned char __fastcall cd_playmsf( unsigned char start_minute<_al>,  unsigned char start_second<_ah>,  unsigned char start_frame<_bl>, unsigned char end_minute<_cl>,  unsigned char end_second<_ch>,  unsigned char end_frame<_dl>,  unsigned char mode<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 95; extern unsigned char __fastcall cd_fastvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int sectors<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 96; extern unsigned char __fastcall cd_loadvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 97; extern unsigned char __fastcall cd_loaddata( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char __far *buffer<_bp_bank:_bp>, unsigned int bytes<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 98; extern unsigned char __fastcall cd_loadbank( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char bank<_bl>, unsigned int sectors<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 99; extern unsigned char __fastcall __macro cd_status( unsigned char mode<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 101; extern void __fastcall __macro ad_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 102; extern unsigned char __fastcall __macro ad_trans( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char nb_sectors<_dh>, unsigned int ad_addr<_bx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 103; extern void __fastcall __macro ad_read( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 104; extern void __fastcall __macro ad_write( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 105; extern unsigned char __fastcall __macro ad_play( unsigned int ad_addr<_bx>, unsigned int bytes<_ax>, unsigned char freq<_dh>, unsigned char mode<_dl> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 106; extern unsigned char __fastcall __macro ad_cplay( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int nb_sectors<_bx>, unsigned char freq<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 107; extern void __fastcall __macro ad_stop( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 108; extern unsigned char __fastcall __macro ad_stat( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 110; extern unsigned char __fastcall bm_check( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 111; extern unsigned char __fastcall bm_format( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 112; extern unsigned int __fastcall __macro bm_free( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 113; extern unsigned char __fastcall __macro bm_read( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 114; extern unsigned char __fastcall __macro bm_write( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 115; extern unsigned char __fastcall __macro bm_delete( unsigned char *name<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 117; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 119; extern unsigned char __fastcall __macro bm_exist( unsigned char *name<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 120; extern unsigned char __fastcall __macro bm_create( unsigned char *name<_ax>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 122; // void __fastcall _xsafe add_sectors( unsigned int sector_offset<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 124; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 126; #endif // _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/huc.h", 34; #include "hucc-baselib.h"
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 1; #ifndef _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 2; #define _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 7; ; hucc-baselib.h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 9; ; Basic library functions provided as macros.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 18; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 20; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 21; // Joypad defines ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 22; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 24; #define	JOY_A		0x01
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 25; #define	JOY_I		0x01
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 26; #define	JOY_B		0x02
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 27; #define	JOY_II		0x02
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 28; #define	JOY_SLCT	0x04
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 29; #define	JOY_SEL		0x04
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 30; #define	JOY_STRT	0x08
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 31; #define	JOY_RUN		0x08
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 32; #define	JOY_UP		0x10
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 33; #define	JOY_RGHT	0x20
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 34; #define	JOY_RIGHT	0x20
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 35; #define	JOY_DOWN	0x40
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 36; #define	JOY_LEFT	0x80
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 38; #define	JOY_C		0x0100
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 39; #define	JOY_III		0x0100
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 40; #define	JOY_D		0x0200
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 41; #define	JOY_IV		0x0200
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 42; #define	JOY_E		0x0400
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 43; #define	JOY_V		0x0400
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 44; #define	JOY_F		0x0800
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 45; #define	JOY_VI		0x0800
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 47; #define JOY_SIXBUT	0x8000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 48; #define JOY_TYPE6	0x8000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 50; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 51; // SuperGRAFX VPC settings for set_vpc_ctl() ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 52; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 54; #define VPC_SPR1_BKG1_SPR2_BKG2	0x3000 // same as SGX_PARALLAX=0
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 55; #define VPC_SPR1_SPR2_BKG1_BKG2	0x7000 // same as SGX_PARALLAX=1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 56; #define VPC_BKG1_BKG2_SPR1_SPR2	0xB000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 58; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 59; // System Card variables ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 62; extern unsigned int si;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 63; extern unsigned int di;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 64; extern unsigned int bp;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 66; extern unsigned int ax;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 67; extern unsigned int bx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 68; extern unsigned int cx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 69; extern unsigned int dx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 71; extern unsigned char al;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 72; extern unsigned char ah;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 73; extern unsigned char bl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 74; extern unsigned char bh;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 75; extern unsigned char cl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 76; extern unsigned char ch;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 77; extern unsigned char dl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 78; extern unsigned char dh;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 80; extern unsigned char irq_cnt;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 81; extern unsigned char joynow[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 82; extern unsigned char joytrg[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 83; extern unsigned char joy6now[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 84; extern unsigned char joy6trg[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 85; extern unsigned int  bg_x1;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 86; extern unsigned int  bg_y1;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 87; extern unsigned int  bg_x2;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 88; extern unsigned int  bg_y2;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 90; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 91; // Special macros to get information from PCEAS ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 92; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 94; #define BANK( datasym ) ((unsigned) (&__bank__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 95; #define SIZEOF( datasym ) ((unsigned) (&__sizeof__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 96; #define COUNTOF( datasym ) ((unsigned) (&__countof__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 97; #define OVERLAY( datasym ) ((unsigned) (&__overlay__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 100; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 101; // Functions in hucc-baselib.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 102; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 104; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 106; #asmdef	HUCC_USES_BASELIB 1
+HUCC_USES_BASELIB = 1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 108; #define	_OPTIMIZE 1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 111; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 112; // Hardware Detection
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 113; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 115; extern unsigned char __fastcall __macro sgx_detect( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 116; extern unsigned char __fastcall __macro ac_exists( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 119; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 120; // Memory Access
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 121; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 123; extern unsigned char __fastcall __macro peek( unsigned int addr<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 124; extern unsigned int  __fastcall __macro peekw( unsigned int addr<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 126; extern void __fastcall __macro poke( unsigned int addr<__poke>, unsigned char with<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 127; extern void __fastcall __macro pokew( unsigned int addr<__poke>, unsigned int with<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 129; extern unsigned char __fastcall farpeek( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 130; extern unsigned int  __fastcall farpeekw( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 132; extern void __fastcall __nop set_far_base( unsigned char data_bank<_bp_bank>, unsigned char *data_addr<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 133; extern void __fastcall set_far_offset( unsigned int offset<_bp>, unsigned char data_bank<_bp_bank>, unsigned char *data_addr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 135; extern unsigned char __fastcall far_peek( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 136; extern unsigned int  __fastcall far_peekw( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 138; extern void __fastcall __macro reset_mpr2( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 139; extern void __fastcall __macro reset_mpr34( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 141; extern void * __fastcall __macro farset_mpr2( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 142; extern void * __fastcall __macro farset_mpr34( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 144; extern void * __fastcall __macro far_set_mpr2( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 145; extern void * __fastcall __macro far_set_mpr34( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 148; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 149; // Clock Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 150; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 152; extern unsigned char __fastcall __macro clock_hh( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 153; extern unsigned char __fastcall __macro clock_mm( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 154; extern unsigned char __fastcall __macro clock_ss( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 155; extern unsigned char __fastcall __macro clock_tt( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 156; extern void __fastcall __macro clock_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 159; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 160; // Joypad Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 161; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 163; extern unsigned int __fastcall __macro joy( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 164; extern unsigned int __fastcall __macro joytrg( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 167; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 168; // Number Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 169; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 171; extern void __fastcall __macro srand( unsigned char seed<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 172; extern unsigned int __fastcall rand( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 173; extern unsigned char __fastcall rand8( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 175; // Note: "limit" is 0..255.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 176; extern unsigned char __fastcall random8( unsigned char limit<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 178; // Note: "limit" is 0..128, 129..255 are treated as 128!
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 179; extern unsigned char __fastcall random( unsigned char limit<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 182; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 183; // Overlay Execution
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 184; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 186; extern unsigned char __fastcall __macro cd_execoverlay( unsigned char ovl_index<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 189; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 190; // Functions that are only optionally available if configured in your hucc-config.inc
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 191; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 193; extern unsigned int __fastcall __macro joybuf( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 194; extern unsigned int __fastcall __macro get_joy_events( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 195; extern void __fastcall __macro clear_joy_events( unsigned char mask<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 198; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 199; // Functions that are only implemented in the TGEMU emulator for unit-testing
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 200; // the compiler, and which should never be used in normal HuCC projects ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 201; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 203; extern void __fastcall dump_screen( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 205; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 207; #endif // _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/huc.h", 35; #include "hucc-gfx.h"
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 1; #ifndef _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 2; #define _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 7; ; huc-gfx.h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 22; // Screen defines ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 25; #define	SCR_SIZE_32x32	0
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 26; #define	SCR_SIZE_64x32	1
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 27; #define	SCR_SIZE_128x32	2
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 28; #define	SCR_SIZE_32x64	4
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 29; #define	SCR_SIZE_64x64	5
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 30; #define	SCR_SIZE_128x64	6
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 32; #define	XRES_SHARP	0
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 33; #define	XRES_SOFT	4
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 34; #define	XRES_KEEP	128
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 36; #define VPC_WIN_A	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 37; #define VPC_WIN_B	0x01
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 38; #define	VPC_WIN_AB	0x02
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 39; #define	VPC_WIN_NONE	0x03
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 40; #define	VPC_NORM	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 41; #define	VPC_SPR		0x04
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 42; #define	VPC_INV_SPR	0x08
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 43; #define VDC1_ON		0x01
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 44; #define	VDC1_OFF	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 45; #define VDC2_ON		0x02
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 46; #define	VDC2_OFF	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 47; #define VDC_ON		0x03
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 48; #define	VDC_OFF		0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 50; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 51; // Functions in hucc-gfx.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 52; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 54; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 56; #asmdef	HUCC_USES_GFX 1
+HUCC_USES_GFX = 1
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 58; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 59; // Color and Palette Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 62; extern void __fastcall clear_palette( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 64; extern void __fastcall __nop set_color( unsigned int index<VCE_CTA>, unsigned int value<VCE_CTW> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 65; extern void __fastcall set_color_rgb( unsigned int index<VCE_CTA>, unsigned char r<_al>, unsigned char g<_ah>, unsigned char b<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 66; extern unsigned int __fastcall __macro get_color( unsigned int index<VCE_CTA> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 68; extern void __fastcall load_palette( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 69; extern void __fastcall far_load_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 71; extern void __fastcall read_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah>, unsigned int *destination<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 73; extern void __fastcall __macro fade_to_black( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 74; extern void __fastcall __macro fade_to_white( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 75; extern void __fastcall __macro cross_fade_to( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 77; extern void __fastcall __macro far_fade_to_black( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 78; extern void __fastcall __macro far_fade_to_white( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 79; extern void __fastcall __macro far_cross_fade_to( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 83; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 84; // Video Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 85; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 87; extern void __fastcall init_240x208( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 88; extern void __fastcall init_256x224( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 90; extern void __fastcall vsync( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 91; extern void __fastcall vsync( unsigned char count<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 93; extern void __fastcall disp_on( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 94; extern void __fastcall disp_off( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 96; extern void __fastcall set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 98; extern void __fastcall set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 100; extern void __fastcall cls( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 101; extern void __fastcall cls( unsigned int tile<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 103; extern unsigned int __fastcall __macro vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 104; extern unsigned int __fastcall __macro get_vram( unsigned int address<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 105; extern void __fastcall __macro put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 107; extern void __fastcall __macro load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 108; extern void __fastcall __macro far_load_vram( unsigned int vram<_di>,  unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 110; extern void __fastcall load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 111; extern void __fastcall far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 113; extern void __fastcall __macro load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 114; extern void __fastcall __macro far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 116; extern void __fastcall vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 119; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 120; // SuperGRAFX Video Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 121; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 123; extern void __fastcall __nop vpc_set_ctl( unsigned int bits<VPC_CR> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 124; extern void __fastcall __nop vpc_set_win1( unsigned int width<VPC_WINDOW1> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 125; extern void __fastcall __nop vpc_set_win2( unsigned int width<VPC_WINDOW2> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 127; extern void __fastcall sgx_set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 129; extern void __fastcall sgx_set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 131; extern void __fastcall sgx_cls( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 132; extern void __fastcall sgx_cls( unsigned int tile<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 134; extern unsigned int __fastcall __macro sgx_vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 135; extern unsigned int __fastcall __macro sgx_get_vram( unsigned int address<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 136; extern void __fastcall __macro sgx_put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 138; extern void __fastcall __macro sgx_load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 139; extern void __fastcall __macro sgx_far_load_vram( unsigned int vram<_di>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 141; extern void __fastcall sgx_load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 142; extern void __fastcall sgx_far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 144; extern void __fastcall __macro sgx_load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 145; extern void __fastcall __macro sgx_far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 147; extern void __fastcall sgx_vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 150; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 151; // Font Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 152; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 154; extern void __fastcall set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 155; extern void __fastcall set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 157; extern void __fastcall load_font( unsigned char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 158; extern void __fastcall far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 160; extern void __fastcall __nop set_font_color( unsigned char foreground<monofont_fg>, unsigned char background<monofont_bg> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 161; extern void __fastcall __macro load_default_font( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 164; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 165; // SuperGRAFX Font Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 166; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 168; extern void __fastcall sgx_set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 169; extern void __fastcall sgx_set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 171; extern void __fastcall sgx_load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 172; extern void __fastcall sgx_far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 174; extern void __fastcall __macro sgx_load_default_font( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 177; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 178; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 179; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 181; extern void __fastcall __macro set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 182; extern void __fastcall __macro sgx_set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 184; extern void __fastcall load_background( unsigned char __far *tiles<_bp_bank:_bp>, unsigned char __far *palettes<__fbank:__fptr>, unsigned char __far *bat<_cl:_bx>, unsigned char w<_dl>, unsigned char h<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 186; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 187; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 188; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 189; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 191; extern void __fastcall load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 193; extern void __fastcall put_string( unsigned char *string<_bp>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 195; extern void __fastcall put_char( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 196; extern void __fastcall put_digit( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 197; extern void __fastcall put_hex( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 198; extern void __fastcall put_number( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 199; extern void __fastcall put_raw( unsigned int data<_bx>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 201; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 203; #endif // _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/huc.h", 36; #include "hucc-old-scroll.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 1; #ifndef _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 2; #define _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 7; ; hucc-old-scroll.h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 19; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 20; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 21; ; HuC's old scrolling library is provided for use with existing HuC projects,
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 22; ; but it should preferably be avoided in new projects because it is slow and
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 23; ; forever limited by its choice to handle gaps between areas, and sorting.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 24; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 25; ; HuCC's new scrolling library puts the responibility for defining both gaps
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 26; ; and the display order into the project's hands, but in return it runs much
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 27; ; faster, using less than 1/6 of the processing time in VBLANK, and far less
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 28; ; time in the RCR interrputs themselves. It also supports the 2nd SuperGRAFX
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 29; ; screen layer, which HuC's old scrolling library ignores.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 30; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 31; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 32; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 34; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 35; // Functions in hucc-old-scroll.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 36; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 38; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 40; #asmdef	HUCC_USES_OLD_SCROLL 1
+HUCC_USES_OLD_SCROLL = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 42; extern void __fastcall scroll( unsigned char num<_al>, unsigned int x<_cx>, unsigned int y<_dx>, unsigned char top<_ah>, unsigned char bottom<_bl>, unsigned char disp<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 43; extern void __fastcall scroll_disable( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 45; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 47; #endif // _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/huc.h", 37; #include "hucc-old-spr.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 1; #ifndef _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 2; #define _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 7; ; hucc-old-spr.h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 22; // Sprite defines ...
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 25; #define FLIP_X_MASK 0x08
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 26; #define FLIP_Y_MASK 0x80
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 27; #define FLIP_MAS    0x88
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 28; #define SIZE_MAS    0x31
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 30; #define NO_FLIP     0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 31; #define NO_FLIP_X   0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 32; #define NO_FLIP_Y   0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 33; #define FLIP_X      0x08
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 34; #define FLIP_Y      0x80
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 35; #define SZ_16x16    0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 36; #define SZ_16x32    0x10
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 37; #define SZ_16x64    0x30
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 38; #define SZ_32x16    0x01
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 39; #define SZ_32x32    0x11
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 40; #define	SZ_32x64    0x31
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 42; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 43; // Functions in hucc-old-spr.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 44; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 46; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 48; #asmdef	HUCC_USES_OLD_SPR 1
+HUCC_USES_OLD_SPR = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 50; extern void __fastcall init_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 51; extern void __fastcall reset_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 52; extern void __fastcall satb_update( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 53; extern void __fastcall spr_set( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 54; extern void __fastcall spr_hide( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 55; extern void __fastcall spr_show( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 56; extern void __fastcall spr_x( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 57; extern void __fastcall spr_y( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 58; extern void __fastcall spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 59; extern void __fastcall spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 60; extern void __fastcall spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 61; extern void __fastcall spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 63; extern unsigned int __fastcall spr_get_x( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 64; extern unsigned int __fastcall spr_get_y( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 66; extern void __fastcall sgx_init_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 67; extern void __fastcall sgx_reset_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 68; extern void __fastcall sgx_satb_update( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 69; extern void __fastcall sgx_spr_set( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 70; extern void __fastcall sgx_spr_hide( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 71; extern void __fastcall sgx_spr_show( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 72; extern void __fastcall sgx_spr_x( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 73; extern void __fastcall sgx_spr_y( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 74; extern void __fastcall sgx_spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 75; extern void __fastcall sgx_spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 76; extern void __fastcall sgx_spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 77; extern void __fastcall sgx_spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 79; extern unsigned int __fastcall sgx_spr_get_x( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 80; extern unsigned int __fastcall sgx_spr_get_y( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 82; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 84; #endif // _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/huc.h", 38; #include "hucc-old-map.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 1; #ifndef _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 2; #define _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 7; ; hucc-old-map.h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 22; // Functions in hucc-old-map.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 25; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 27; #asmdef	HUCC_USES_OLD_MAP 1
+HUCC_USES_OLD_MAP = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 29; extern void __fastcall set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 30; extern void __fastcall sgx_set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 32; extern void __fastcall __nop set_tile_data( unsigned char __far *tiles<vdc_tile_bank:vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 33; extern void __fastcall __nop sgx_set_tile_data( unsigned char __far *tiles<sgx_tile_bank:sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 35; extern void __fastcall __nop set_far_tile_data( unsigned char tile_bank<vdc_tile_bank>, unsigned char *tile_addr<vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char palette_table_bank<vdc_attr_bank>, unsigned char *palette_table_addr<vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 36; extern void __fastcall __nop sgx_set_far_tile_data( unsigned char tile_bank<sgx_tile_bank>, unsigned char *tile_addr<sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char palette_table_bank<sgx_attr_bank>, unsigned char *palette_table_addr<sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 38; extern void __fastcall __nop set_map_data( unsigned char __far *map<vdc_map_bank:vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 39; extern void __fastcall __nop sgx_set_map_data( unsigned char __far *map<sgx_map_bank:sgx_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 41; extern void __fastcall __nop set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 42; extern void __fastcall __nop sgx_set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 44; extern void __fastcall load_tile( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 45; extern void __fastcall sgx_load_tile( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 47; extern void __fastcall load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 48; extern void __fastcall sgx_load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 50; extern unsigned char __fastcall map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 51; extern unsigned char __fastcall sgx_map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 53; extern void __fastcall map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 54; extern void __fastcall sgx_map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 56; extern void __fastcall put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 57; extern void __fastcall sgx_put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 59; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 61; extern void __fastcall set_tile_data( unsigned char *tile_ex<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 63; extern void __fastcall __nop set_map_pals( unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 64; extern void __fastcall __nop set_map_tile_type( unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 66; extern void __fastcall __nop sgx_set_map_pals( unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 67; extern void __fastcall __nop sgx_set_map_tile_type( unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 69; extern void __fastcall set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 70; extern void __fastcall sgx_set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 72; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 74; #endif // _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/huc.h", 39; #include "hucc-old-line.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 1; #ifndef _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 2; #define _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 7; ; hucc-old-line.h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 22; // Functions in hucc-old-line.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 25; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 27; #asmdef	HUCC_USES_OLD_LINE 1
+HUCC_USES_OLD_LINE = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 29; extern void __fastcall gfx_init( unsigned int start_vram_addr<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 30; extern void __fastcall gfx_clear( unsigned int start_vram_addr<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 31; extern void __fastcall gfx_plot( unsigned int x<_gfx_x1>, unsigned int y<_gfx_y1>, char color<_gfx_color> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 32; extern void __fastcall gfx_line( unsigned int x1<_gfx_x1>, unsigned int y1<_gfx_y1>, unsigned int x2<_gfx_x2>, unsigned int y2<_gfx_y2>, unsigned char color<_gfx_color> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 34; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 36; #endif // _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/huc.h", 41; #include <stdlib.h>
+	.dbg	line,	"../../../include/hucc/stdlib.h", 1; #ifndef _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/stdlib.h", 2; #define _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/stdlib.h", 4; #define RAND_MAX 32767
+	.dbg	line,	"../../../include/hucc/stdlib.h", 6; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/stdlib.h", 7; extern int __fastcall abs( int value<acc> );
+	.dbg	line,	"../../../include/hucc/stdlib.h", 8; #endif
+	.dbg	line,	"../../../include/hucc/stdlib.h", 10; #endif // _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/huc.h", 42; #include <string.h>
+	.dbg	line,	"../../../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"../../../include/hucc/string.h", 3; #endif
+	.dbg	line,	"../../../include/hucc/huc.h", 44; #endif // _hucc_legacy_h
+	.dbg	line,	"tutorial7.c", 3; /* defines make life easier and code more readable... */
+	.dbg	line,	"tutorial7.c", 4; #define DIR_LEFT 1
+	.dbg	line,	"tutorial7.c", 5; #define DIR_RIGHT 2
+	.dbg	line,	"tutorial7.c", 6; #define SCR_W 33
+	.dbg	line,	"tutorial7.c", 7; #define SCR_H 32
+	.dbg	line,	"tutorial7.c", 8; #define CHAR_LEFT_THRESHOLD 96
+	.dbg	line,	"tutorial7.c", 9; #define CHAR_RIGHT_THRESHOLD 128
+	.dbg	line,	"tutorial7.c", 11; /* our new Bonk sprites! */
+	.dbg	line,	"tutorial7.c", 12; #incspr(bonk,"bonksprites.png",0,0,2,18);
+	.data
+_bonk:	.incspr		"bonksprites.png", 0, 0, 2, 18
+	.code
+	.dbg	line,	"tutorial7.c", 13; #incpal(bonkpal,"bonksprites.png",0);
+	.data
+_bonkpal:	.incpal		"bonksprites.png", 0
+	.code
+	.dbg	line,	"tutorial7.c", 15; /* Welcome to Bonk's world! */
+	.dbg	line,	"tutorial7.c", 16; #incbin(levelmap,"tut7map.stm");
+	.data
+_levelmap:	.incbin		"tut7map.stm"
+
+	.code
+	.dbg	line,	"tutorial7.c", 17; #incchr(leveltiles,"tut7chr.png");
+	.data
+_leveltiles: 	.incchr		"tut7chr.png"
+	.code
+	.dbg	line,	"tutorial7.c", 18; #incchrpal(tilecolors,"tut7chr.png");
+	.data
+_tilecolors:	.incchrpal	"tut7chr.png"
+	.code
+	.dbg	line,	"tutorial7.c", 19; #incpal(levelpal,"tut7chr.png",0,2);
+	.data
+_levelpal:	.incpal		"tut7chr.png", 0, 2
+	.code
+	.dbg	line,	"tutorial7.c", 21; /* Globals ftw */
+	.dbg	line,	"tutorial7.c", 22; int bonkx, bonky, j1, j2, mapx, mapy, vmapx, vmapy, lastmapx, lastmapy, t3, jumpspeed, jumpdelta;
+	.dbg	line,	"tutorial7.c", 23; int MAP_X_THRESHOLD,MAP_X_LOW_THRESHOLD;
+	.dbg	line,	"tutorial7.c", 24; char tics, frame, state, direction;
+	.dbg	line,	"tutorial7.c", 26; void main(void)
+	.dbg	line,	"tutorial7.c", 27; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tutorial7.c", 28; /* set up Bonk! */
+
+	.dbg	line,	"tutorial7.c", 29; init_satb();
+	__call		_init_satb
+
+	.dbg	line,	"tutorial7.c", 30; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 31; frame = 0;
+	__st.umiq	0, _frame
+
+	.dbg	line,	"tutorial7.c", 32; bonkx = 104;
+	__st.wmiq	104, _bonkx
+
+	.dbg	line,	"tutorial7.c", 33; bonky = 153;
+	__st.wmiq	153, _bonky
+
+	.dbg	line,	"tutorial7.c", 34; spr_make(0,bonkx,bonky,0x5100,FLIP_MAS|SIZE_MAS,NO_FLIP|SZ_32x32,0,1);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wm		_bonkx
+	__pusharg.wr
+	__ld.wm		_bonky
+	__pusharg.wr
+	__ld.wi		20736
+	__pusharg.wr
+	__ld.wi		185
+	__pusharg.wr
+	__ld.wi		17
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__call		_spr_make
+
+	.dbg	line,	"tutorial7.c", 35; load_palette(16,bonkpal,1);
+	__st.umiq	16, _al
+	__farptr	_bonkpal, _bp_bank, _bp
+	__st.umiq	1, _ah
+	__call		_load_palette.3
+
+	.dbg	line,	"tutorial7.c", 36; set_color(256,0);
+	__st.wmiq	256, VCE_CTA
+	__st.wmiq	0, VCE_CTW
+
+	.dbg	line,	"tutorial7.c", 37; load_vram(0x5000,bonk,0x900);
+	__st.wmiq	20480, _di
+	__farptr	_bonk, _bp_bank, _bp
+	__st.wmiq	2304, _ax
+	 _load_vram.3
+
+	.dbg	line,	"tutorial7.c", 38; satb_update();
+	__call		_satb_update
+
+	.dbg	line,	"tutorial7.c", 39; /* set up Bonk's world! */
+
+	.dbg	line,	"tutorial7.c", 40; MAP_X_THRESHOLD = 1055;
+	__st.wmiq	1055, _MAP_X_THRESHOLD
+
+	.dbg	line,	"tutorial7.c", 41; MAP_X_LOW_THRESHOLD = 0;
+	__st.wmiq	0, _MAP_X_LOW_THRESHOLD
+
+	.dbg	line,	"tutorial7.c", 42; set_map_data(levelmap,164,28);
+	__farptr	_levelmap, vdc_map_bank, vdc_map_addr
+	__st.umiq	164, vdc_map_width
+	__st.umiq	28, vdc_map_height
+
+	.dbg	line,	"tutorial7.c", 43; set_tile_data(leveltiles,COUNTOF(leveltiles),tilecolors,8);
+	__farptr	_leveltiles, vdc_tile_bank, vdc_tile_addr
+	__ld.wi		___countof__leveltiles
+	__st.umq	vdc_num_tiles
+	__farptr	_tilecolors, vdc_attr_bank, vdc_attr_addr
+	__st.umiq	8, vdc_tile_type
+
+	.dbg	line,	"tutorial7.c", 44; load_tile(0x1000);
+	__st.wmiq	4096, _di
+	__call		_load_tile.1
+
+	.dbg	line,	"tutorial7.c", 45; load_map(0,0,0,0,34,28);
+	__st.umiq	0, _al
+	__st.umiq	0, _ah
+	__st.wmiq	0, _bx
+	__st.wmiq	0, _dx
+	__st.umiq	34, _cl
+	__st.umiq	28, _ch
+	__call		_load_map.6
+
+	.dbg	line,	"tutorial7.c", 46; load_palette(0,levelpal,2);
+	__st.umiq	0, _al
+	__farptr	_levelpal, _bp_bank, _bp
+	__st.umiq	2, _ah
+	__call		_load_palette.3
+
+	.dbg	line,	"tutorial7.c", 47; /* stuff for handling the map scrollie thingo */
+
+	.dbg	line,	"tutorial7.c", 48; mapx = 0;
+	__st.wmiq	0, _mapx
+
+	.dbg	line,	"tutorial7.c", 49; lastmapx = 0;
+	__st.wmiq	0, _lastmapx
+
+	.dbg	line,	"tutorial7.c", 50; mapy = 0;
+	__st.wmiq	0, _mapy
+
+	.dbg	line,	"tutorial7.c", 51; lastmapy = 0;
+	__st.wmiq	0, _lastmapy
+
+	.dbg	line,	"tutorial7.c", 52; vmapx = 0;
+	__st.wmiq	0, _vmapx
+
+	.dbg	line,	"tutorial7.c", 53; vmapy = 0;
+	__st.wmiq	0, _vmapy
+
+	.dbg	line,	"tutorial7.c", 54; /* main game loop! */
+
+	.dbg	line,	"tutorial7.c", 55; for (;;)
+.LL3:
+.LL4:
+.LL5:
+
+	.dbg	line,	"tutorial7.c", 56; {
+
+	.dbg	line,	"tutorial7.c", 57; j1 = joy(0);
+	__ld.uiq	0
+	 _joy.1
+	__st.wmq	_j1
+
+	.dbg	line,	"tutorial7.c", 58; j2 = joytrg(0);
+	__ld.uiq	0
+	 _joytrg.1
+	__st.wmq	_j2
+
+	.dbg	line,	"tutorial7.c", 59; if (j2 & JOY_STRT)
+	__tand.wi	8
+	__bfalse	.LL7
+
+	.dbg	line,	"tutorial7.c", 60; {
+
+	.dbg	line,	"tutorial7.c", 61; pause();
+	__call		_pause
+
+	.dbg	line,	"tutorial7.c", 62; } else {
+	__bra		.LL8
+.LL7:
+
+	.dbg	line,	"tutorial7.c", 63; bonk_state_machine();
+	__call		_bonk_state_machine
+
+	.dbg	line,	"tutorial7.c", 64; }
+.LL8:
+
+	.dbg	line,	"tutorial7.c", 65; satb_update();
+	__call		_satb_update
+
+	.dbg	line,	"tutorial7.c", 66; vsync();
+	__call		_vsync
+
+	.dbg	line,	"tutorial7.c", 67; }
+	__bra		.LL5
+.LL6:
+
+	.dbg	line,	"tutorial7.c", 68; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 70; void spr_make(int spriteno,int spritex,int spritey,int spritepattern,int ctrl1,int ctrl2,int sprpal,int sprpri)
+	.dbg	line,	"tutorial7.c", 71; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_spr_make
+	__enter		_spr_make
+
+	.dbg	line,	"tutorial7.c", 72; spr_set(spriteno);
+	__ld.wsq	14  /* spriteno */
+	__call		_spr_set.1
+
+	.dbg	line,	"tutorial7.c", 73; spr_x(spritex);
+	__ld.ws		12  /* spritex */
+	__call		_spr_x.1
+
+	.dbg	line,	"tutorial7.c", 74; spr_y(spritey);
+	__ld.ws		10  /* spritey */
+	__call		_spr_y.1
+
+	.dbg	line,	"tutorial7.c", 75; spr_pattern(spritepattern);
+	__ld.ws		8  /* spritepattern */
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 76; spr_ctrl(ctrl1,ctrl2);
+	__ld.ws		6  /* ctrl1 */
+	__st.umq	_al
+	__ld.wsq	4  /* ctrl2 */
+	__call		_spr_ctrl.2
+
+	.dbg	line,	"tutorial7.c", 77; spr_pal(sprpal);
+	__ld.wsq	2  /* sprpal */
+	__call		_spr_pal.1
+
+	.dbg	line,	"tutorial7.c", 78; spr_pri(sprpri);
+	__ld.wsq	0  /* sprpri */
+	__call		_spr_pri.1
+
+	.dbg	line,	"tutorial7.c", 79; }
+.LL9:
+	__modsp		16
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 81; void pause(void)
+	.dbg	line,	"tutorial7.c", 82; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_pause
+	__enter		_pause
+
+	.dbg	line,	"tutorial7.c", 83; for (;;)
+.LL11:
+.LL12:
+.LL13:
+
+	.dbg	line,	"tutorial7.c", 84; {
+
+	.dbg	line,	"tutorial7.c", 85; vsync();
+	__call		_vsync
+
+	.dbg	line,	"tutorial7.c", 86; if (joytrg(0) & JOY_STRT) return;
+	__ld.uiq	0
+	 _joytrg.1
+	__tand.wi	8
+	__bfalse	.LL15
+	__bra		.LL10
+
+	.dbg	line,	"tutorial7.c", 87; }
+.LL15	.alias		.LL13
+	__bra		.LL13
+.LL14:
+
+	.dbg	line,	"tutorial7.c", 88; }
+.LL10:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 90; void bonk_state_machine(void)
+	.dbg	line,	"tutorial7.c", 91; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bonk_state_machine
+	__enter		_bonk_state_machine
+
+	.dbg	line,	"tutorial7.c", 92; /*
+
+	.dbg	line,	"tutorial7.c", 93; Bonk's State Machine:
+
+	.dbg	line,	"tutorial7.c", 94; 0 - Idle (all buttons available)
+
+	.dbg	line,	"tutorial7.c", 95; 1 - Walking (all buttons available)
+
+	.dbg	line,	"tutorial7.c", 96; 2 - About to jump (all buttons disabled)
+
+	.dbg	line,	"tutorial7.c", 97; 3 - Jumping (directions available only)
+
+	.dbg	line,	"tutorial7.c", 98; 4 - Jumping down (directions available only)
+
+	.dbg	line,	"tutorial7.c", 99; 5 - Landing (all buttons disabled)
+
+	.dbg	line,	"tutorial7.c", 100; 6 - Bonking (all buttons disabled)
+
+	.dbg	line,	"tutorial7.c", 101; */
+
+	.dbg	line,	"tutorial7.c", 102; if (state == 0) bonk_state_0();
+	__not.um	_state
+	__bfalse	.LL17
+	__call		_bonk_state_0
+
+	.dbg	line,	"tutorial7.c", 103; if (state == 1) bonk_state_1();
+.LL17:
+	__ld.umq	_state
+	__equ_b.uiq	1
+	__bfalse	.LL18
+	__call		_bonk_state_1
+
+	.dbg	line,	"tutorial7.c", 104; if (state == 2) bonk_state_2();
+.LL18:
+	__ld.umq	_state
+	__equ_b.uiq	2
+	__bfalse	.LL19
+	__call		_bonk_state_2
+
+	.dbg	line,	"tutorial7.c", 105; if (state == 3) bonk_state_3();
+.LL19:
+	__ld.umq	_state
+	__equ_b.uiq	3
+	__bfalse	.LL20
+	__call		_bonk_state_3
+
+	.dbg	line,	"tutorial7.c", 106; if (state == 4) bonk_state_4();
+.LL20:
+	__ld.umq	_state
+	__equ_b.uiq	4
+	__bfalse	.LL21
+	__call		_bonk_state_4
+
+	.dbg	line,	"tutorial7.c", 107; if (state == 5) bonk_state_5();
+.LL21:
+	__ld.umq	_state
+	__equ_b.uiq	5
+	__bfalse	.LL22
+	__call		_bonk_state_5
+
+	.dbg	line,	"tutorial7.c", 108; if (state == 6) bonk_state_6();
+.LL22:
+	__ld.umq	_state
+	__equ_b.uiq	6
+	__bfalse	.LL23
+	__call		_bonk_state_6
+
+	.dbg	line,	"tutorial7.c", 109; }
+.LL23:
+.LL16:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 111; void bonk_state_0(void)
+	.dbg	line,	"tutorial7.c", 112; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bonk_state_0
+	__enter		_bonk_state_0
+
+	.dbg	line,	"tutorial7.c", 113; /* this is Bonk's idle stance... if the tics are equal to 0, set his frame to default and his tic counter to 1 */
+
+	.dbg	line,	"tutorial7.c", 114; if (tics == 0) spr_pattern(0x5100);
+	__not.um	_tics
+	__bfalse	.LL25
+	__ld.wi		20736
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 115; tics = 1;
+.LL25:
+	__st.umiq	1, _tics
+
+	.dbg	line,	"tutorial7.c", 116; /* most other states can be set in this state */
+
+	.dbg	line,	"tutorial7.c", 117; if (j1 & JOY_LEFT)
+	__ld.wm		_j1
+	__tand.wi	128
+	__bfalse	.LL26
+
+	.dbg	line,	"tutorial7.c", 118; {
+
+	.dbg	line,	"tutorial7.c", 119; /* start Bonk moving to the left! */
+
+	.dbg	line,	"tutorial7.c", 120; spr_ctrl(FLIP_MAS,FLIP_X);
+	__st.umiq	136, _al
+	__ld.uiq	8
+	__call		_spr_ctrl.2
+
+	.dbg	line,	"tutorial7.c", 121; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 122; frame = 0;
+	__st.umiq	0, _frame
+
+	.dbg	line,	"tutorial7.c", 123; state = 1;
+	__st.umiq	1, _state
+
+	.dbg	line,	"tutorial7.c", 124; spr_pattern(0x5000);
+	__ld.wi		20480
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 125; direction = DIR_LEFT;
+	__st.umiq	1, _direction
+
+	.dbg	line,	"tutorial7.c", 126; }
+
+	.dbg	line,	"tutorial7.c", 127; if (j1 & JOY_RGHT)
+.LL26:
+	__ld.wm		_j1
+	__tand.wi	32
+	__bfalse	.LL27
+
+	.dbg	line,	"tutorial7.c", 128; {
+
+	.dbg	line,	"tutorial7.c", 129; /* start Bonk moving to the right! */
+
+	.dbg	line,	"tutorial7.c", 130; spr_ctrl(FLIP_MAS,NO_FLIP);
+	__st.umiq	136, _al
+	__ld.uiq	0
+	__call		_spr_ctrl.2
+
+	.dbg	line,	"tutorial7.c", 131; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 132; frame = 0;
+	__st.umiq	0, _frame
+
+	.dbg	line,	"tutorial7.c", 133; state = 1;
+	__st.umiq	1, _state
+
+	.dbg	line,	"tutorial7.c", 134; spr_pattern(0x5000);
+	__ld.wi		20480
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 135; direction = DIR_RIGHT;
+	__st.umiq	2, _direction
+
+	.dbg	line,	"tutorial7.c", 136; }
+
+	.dbg	line,	"tutorial7.c", 137; if (j2 & JOY_B)
+.LL27:
+	__ld.wm		_j2
+	__tand.wi	2
+	__bfalse	.LL28
+
+	.dbg	line,	"tutorial7.c", 138; {
+
+	.dbg	line,	"tutorial7.c", 139; /* set Bonk in bonking state! */
+
+	.dbg	line,	"tutorial7.c", 140; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 141; frame = 0;
+	__st.umiq	0, _frame
+
+	.dbg	line,	"tutorial7.c", 142; state = 6;
+	__st.umiq	6, _state
+
+	.dbg	line,	"tutorial7.c", 143; spr_pattern(0x5700);
+	__ld.wi		22272
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 144; }
+
+	.dbg	line,	"tutorial7.c", 145; if (j2 & JOY_A)
+.LL28:
+	__ld.wm		_j2
+	__tand.wi	1
+	__bfalse	.LL29
+
+	.dbg	line,	"tutorial7.c", 146; {
+
+	.dbg	line,	"tutorial7.c", 147; /* make Bonk jump! */
+
+	.dbg	line,	"tutorial7.c", 148; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 149; frame = 0;
+	__st.umiq	0, _frame
+
+	.dbg	line,	"tutorial7.c", 150; state = 2;
+	__st.umiq	2, _state
+
+	.dbg	line,	"tutorial7.c", 151; spr_pattern(0x5400);
+	__ld.wi		21504
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 152; }
+
+	.dbg	line,	"tutorial7.c", 153; }
+.LL29:
+.LL24:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 155; void bonk_state_1(void)
+	.dbg	line,	"tutorial7.c", 156; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bonk_state_1
+	__enter		_bonk_state_1
+
+	.dbg	line,	"tutorial7.c", 157; /* Bonk's walking state! */
+
+	.dbg	line,	"tutorial7.c", 158; char stillwalking;
+
+	.dbg	line,	"tutorial7.c", 159; stillwalking = 0;
+	__st.umiq	0, __bonk_state_1_end - 1  /* stillwalking */
+
+	.dbg	line,	"tutorial7.c", 160; tics++;
+	__inc.umq	_tics
+
+	.dbg	line,	"tutorial7.c", 161; if (tics > 4)
+	__ld.umq	_tics
+	__ugt_b.uiq	4
+	__bfalse	.LL31
+
+	.dbg	line,	"tutorial7.c", 162; {
+
+	.dbg	line,	"tutorial7.c", 163; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 164; frame++;
+	__inc.umq	_frame
+
+	.dbg	line,	"tutorial7.c", 165; if (frame > 5) frame = 0;
+	__ld.umq	_frame
+	__ugt_b.uiq	5
+	__bfalse	.LL32
+	__st.umiq	0, _frame
+
+	.dbg	line,	"tutorial7.c", 166; if (frame == 0) spr_pattern(0x5100);
+.LL32:
+	__not.um	_frame
+	__bfalse	.LL33
+	__ld.wi		20736
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 167; if (frame == 1) spr_pattern(0x5200);
+.LL33:
+	__ld.umq	_frame
+	__equ_b.uiq	1
+	__bfalse	.LL34
+	__ld.wi		20992
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 168; if (frame == 2) spr_pattern(0x5300);
+.LL34:
+	__ld.umq	_frame
+	__equ_b.uiq	2
+	__bfalse	.LL35
+	__ld.wi		21248
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 169; if (frame == 3) spr_pattern(0x5200);
+.LL35:
+	__ld.umq	_frame
+	__equ_b.uiq	3
+	__bfalse	.LL36
+	__ld.wi		20992
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 170; if (frame == 4) spr_pattern(0x5100);
+.LL36:
+	__ld.umq	_frame
+	__equ_b.uiq	4
+	__bfalse	.LL37
+	__ld.wi		20736
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 171; if (frame == 5) spr_pattern(0x5000);
+.LL37:
+	__ld.umq	_frame
+	__equ_b.uiq	5
+	__bfalse	.LL38
+	__ld.wi		20480
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 172; }
+.LL38:
+
+	.dbg	line,	"tutorial7.c", 173; if (j1 & JOY_LEFT)
+.LL31:
+	__ld.wm		_j1
+	__tand.wi	128
+	__bfalse	.LL39
+
+	.dbg	line,	"tutorial7.c", 174; {
+
+	.dbg	line,	"tutorial7.c", 175; stillwalking = 1;
+	__st.umiq	1, __bonk_state_1_end - 1  /* stillwalking */
+
+	.dbg	line,	"tutorial7.c", 176; }
+
+	.dbg	line,	"tutorial7.c", 177; if (j1 & JOY_RGHT)
+.LL39:
+	__ld.wm		_j1
+	__tand.wi	32
+	__bfalse	.LL40
+
+	.dbg	line,	"tutorial7.c", 178; {
+
+	.dbg	line,	"tutorial7.c", 179; stillwalking = 1;
+	__st.umiq	1, __bonk_state_1_end - 1  /* stillwalking */
+
+	.dbg	line,	"tutorial7.c", 180; }
+
+	.dbg	line,	"tutorial7.c", 181; if (j2 & JOY_B)
+.LL40:
+	__ld.wm		_j2
+	__tand.wi	2
+	__bfalse	.LL41
+
+	.dbg	line,	"tutorial7.c", 182; {
+
+	.dbg	line,	"tutorial7.c", 183; /* set Bonk in bonking state! */
+
+	.dbg	line,	"tutorial7.c", 184; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 185; frame = 0;
+	__st.umiq	0, _frame
+
+	.dbg	line,	"tutorial7.c", 186; state = 6;
+	__st.umiq	6, _state
+
+	.dbg	line,	"tutorial7.c", 187; spr_pattern(0x5700);
+	__ld.wi		22272
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 188; }
+
+	.dbg	line,	"tutorial7.c", 189; if (j2 & JOY_A)
+.LL41:
+	__ld.wm		_j2
+	__tand.wi	1
+	__bfalse	.LL42
+
+	.dbg	line,	"tutorial7.c", 190; {
+
+	.dbg	line,	"tutorial7.c", 191; /* make Bonk jump! */
+
+	.dbg	line,	"tutorial7.c", 192; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 193; frame = 0;
+	__st.umiq	0, _frame
+
+	.dbg	line,	"tutorial7.c", 194; state = 2;
+	__st.umiq	2, _state
+
+	.dbg	line,	"tutorial7.c", 195; spr_pattern(0x5400);
+	__ld.wi		21504
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 196; }
+
+	.dbg	line,	"tutorial7.c", 198; if (stillwalking == 0)
+.LL42:
+	__not.um	__bonk_state_1_end - 1  /* stillwalking */
+	__bfalse	.LL43
+
+	.dbg	line,	"tutorial7.c", 199; {
+
+	.dbg	line,	"tutorial7.c", 200; state = 0;
+	__st.umiq	0, _state
+
+	.dbg	line,	"tutorial7.c", 201; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 202; frame = 0;
+	__st.umiq	0, _frame
+
+	.dbg	line,	"tutorial7.c", 203; } else {
+	__bra		.LL44
+.LL43:
+
+	.dbg	line,	"tutorial7.c", 204; move_in_world();
+	__call		_move_in_world
+
+	.dbg	line,	"tutorial7.c", 205; }
+.LL44:
+
+	.dbg	line,	"tutorial7.c", 206; }
+.LL30:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+		ds	1
+__bonk_state_1_end:
+	.code
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 208; void bonk_state_2(void)
+	.dbg	line,	"tutorial7.c", 209; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bonk_state_2
+	__enter		_bonk_state_2
+
+	.dbg	line,	"tutorial7.c", 210; /* Bonk's pre-jump prep state! all controls are disabled in this one */
+
+	.dbg	line,	"tutorial7.c", 211; tics++;
+	__inc.umq	_tics
+
+	.dbg	line,	"tutorial7.c", 212; if (tics > 4)
+	__ld.umq	_tics
+	__ugt_b.uiq	4
+	__bfalse	.LL46
+
+	.dbg	line,	"tutorial7.c", 213; {
+
+	.dbg	line,	"tutorial7.c", 214; jumpspeed = 4;
+	__st.wmiq	4, _jumpspeed
+
+	.dbg	line,	"tutorial7.c", 215; jumpdelta = 70;
+	__st.wmiq	70, _jumpdelta
+
+	.dbg	line,	"tutorial7.c", 216; tics = 0; /* tics is going to be used in a different way in state 3... you'll see! */
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 217; spr_pattern(0x5500);
+	__ld.wi		21760
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 218; state = 3;	
+	__st.umiq	3, _state
+
+	.dbg	line,	"tutorial7.c", 219; }
+
+	.dbg	line,	"tutorial7.c", 220; }
+.LL46:
+.LL45:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 222; void bonk_state_3(void)
+	.dbg	line,	"tutorial7.c", 223; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bonk_state_3
+	__enter		_bonk_state_3
+
+	.dbg	line,	"tutorial7.c", 224; /* Bonk's jumping up state! */
+
+	.dbg	line,	"tutorial7.c", 225; bonky-=jumpspeed;
+	__ld.wm		_jumpspeed
+	__isub_st.wmq	_bonky
+
+	.dbg	line,	"tutorial7.c", 226; /* here, we're going to use tics to determine how high Bonk has jumped, and compare it to the jump delta */
+
+	.dbg	line,	"tutorial7.c", 227; tics+=jumpspeed;
+	__ld.wm		_jumpspeed
+	__add_st.umq	_tics
+
+	.dbg	line,	"tutorial7.c", 228; if (tics > jumpdelta)
+	__ld.um		_tics
+	__sgt_w.wm	_jumpdelta
+	__bfalse	.LL48
+
+	.dbg	line,	"tutorial7.c", 229; {
+
+	.dbg	line,	"tutorial7.c", 230; /* if the total jump distance exceeds the jump delta, reduce the upward motion until it reaches zero */
+
+	.dbg	line,	"tutorial7.c", 231; /* the reduction in upward motion makes the jump appear a little more natural than just immediately changing directions */
+
+	.dbg	line,	"tutorial7.c", 232; spr_pattern(0x5600);
+	__ld.wi		22016
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 233; jumpspeed--;
+	__dec.wmq	_jumpspeed
+
+	.dbg	line,	"tutorial7.c", 234; if (jumpspeed<0)
+	__ld.wm		_jumpspeed
+	__slt_w.wi	0
+	__bfalse	.LL49
+
+	.dbg	line,	"tutorial7.c", 235; {
+
+	.dbg	line,	"tutorial7.c", 236; /* when the jump speed decreases past 0, we will need to set Bonk in state 4 */
+
+	.dbg	line,	"tutorial7.c", 237; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 238; state = 4;
+	__st.umiq	4, _state
+
+	.dbg	line,	"tutorial7.c", 239; jumpspeed = 1;
+	__st.wmiq	1, _jumpspeed
+
+	.dbg	line,	"tutorial7.c", 240; }
+
+	.dbg	line,	"tutorial7.c", 241; }
+.LL49:
+
+	.dbg	line,	"tutorial7.c", 242; if (j1 & JOY_LEFT)
+.LL48:
+	__ld.wm		_j1
+	__tand.wi	128
+	__bfalse	.LL50
+
+	.dbg	line,	"tutorial7.c", 243; {
+
+	.dbg	line,	"tutorial7.c", 244; spr_ctrl(FLIP_MAS,FLIP_X);
+	__st.umiq	136, _al
+	__ld.uiq	8
+	__call		_spr_ctrl.2
+
+	.dbg	line,	"tutorial7.c", 245; direction = DIR_LEFT;
+	__st.umiq	1, _direction
+
+	.dbg	line,	"tutorial7.c", 246; move_in_world();
+	__call		_move_in_world
+
+	.dbg	line,	"tutorial7.c", 247; }
+
+	.dbg	line,	"tutorial7.c", 248; if (j1 & JOY_RGHT)
+.LL50:
+	__ld.wm		_j1
+	__tand.wi	32
+	__bfalse	.LL51
+
+	.dbg	line,	"tutorial7.c", 249; {
+
+	.dbg	line,	"tutorial7.c", 250; spr_ctrl(FLIP_MAS,NO_FLIP);
+	__st.umiq	136, _al
+	__ld.uiq	0
+	__call		_spr_ctrl.2
+
+	.dbg	line,	"tutorial7.c", 251; direction = DIR_RIGHT;
+	__st.umiq	2, _direction
+
+	.dbg	line,	"tutorial7.c", 252; move_in_world();
+	__call		_move_in_world
+
+	.dbg	line,	"tutorial7.c", 253; }
+
+	.dbg	line,	"tutorial7.c", 254; spr_y(bonky);
+.LL51:
+	__ld.wm		_bonky
+	__call		_spr_y.1
+
+	.dbg	line,	"tutorial7.c", 255; }
+.LL47:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 257; void bonk_state_4(void)
+	.dbg	line,	"tutorial7.c", 258; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bonk_state_4
+	__enter		_bonk_state_4
+
+	.dbg	line,	"tutorial7.c", 259; /* Bonk's falling down state! */
+
+	.dbg	line,	"tutorial7.c", 260; bonky+=jumpspeed;
+	__ld.wm		_jumpspeed
+	__add_st.wmq	_bonky
+
+	.dbg	line,	"tutorial7.c", 261; if (jumpspeed < 4) jumpspeed++;
+	__ld.wm		_jumpspeed
+	__slt_w.wi	4
+	__bfalse	.LL53
+	__inc.wmq	_jumpspeed
+
+	.dbg	line,	"tutorial7.c", 262; if (bonky > 152)
+.LL53:
+	__ld.wm		_bonky
+	__sgt_w.wi	152
+	__bfalse	.LL54
+
+	.dbg	line,	"tutorial7.c", 263; {
+
+	.dbg	line,	"tutorial7.c", 264; bonky = 153;
+	__st.wmiq	153, _bonky
+
+	.dbg	line,	"tutorial7.c", 265; frame = 0;
+	__st.umiq	0, _frame
+
+	.dbg	line,	"tutorial7.c", 266; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 267; state = 5;
+	__st.umiq	5, _state
+
+	.dbg	line,	"tutorial7.c", 268; spr_pattern(0x5400);
+	__ld.wi		21504
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 269; }
+
+	.dbg	line,	"tutorial7.c", 270; if (j1 & JOY_LEFT)
+.LL54:
+	__ld.wm		_j1
+	__tand.wi	128
+	__bfalse	.LL55
+
+	.dbg	line,	"tutorial7.c", 271; {
+
+	.dbg	line,	"tutorial7.c", 272; spr_ctrl(FLIP_MAS,FLIP_X);
+	__st.umiq	136, _al
+	__ld.uiq	8
+	__call		_spr_ctrl.2
+
+	.dbg	line,	"tutorial7.c", 273; direction = DIR_LEFT;
+	__st.umiq	1, _direction
+
+	.dbg	line,	"tutorial7.c", 274; move_in_world();
+	__call		_move_in_world
+
+	.dbg	line,	"tutorial7.c", 275; }
+
+	.dbg	line,	"tutorial7.c", 276; if (j1 & JOY_RGHT)
+.LL55:
+	__ld.wm		_j1
+	__tand.wi	32
+	__bfalse	.LL56
+
+	.dbg	line,	"tutorial7.c", 277; {
+
+	.dbg	line,	"tutorial7.c", 278; spr_ctrl(FLIP_MAS,NO_FLIP);
+	__st.umiq	136, _al
+	__ld.uiq	0
+	__call		_spr_ctrl.2
+
+	.dbg	line,	"tutorial7.c", 279; direction = DIR_RIGHT;
+	__st.umiq	2, _direction
+
+	.dbg	line,	"tutorial7.c", 280; move_in_world();
+	__call		_move_in_world
+
+	.dbg	line,	"tutorial7.c", 281; }
+
+	.dbg	line,	"tutorial7.c", 282; spr_y(bonky);
+.LL56:
+	__ld.wm		_bonky
+	__call		_spr_y.1
+
+	.dbg	line,	"tutorial7.c", 283; }
+.LL52:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 285; void bonk_state_5(void)
+	.dbg	line,	"tutorial7.c", 286; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bonk_state_5
+	__enter		_bonk_state_5
+
+	.dbg	line,	"tutorial7.c", 287; /* Bonk's landing state; same frame as state 2, but reverts to state 0 when finished rather than state 3 */
+
+	.dbg	line,	"tutorial7.c", 288; tics++;
+	__inc.umq	_tics
+
+	.dbg	line,	"tutorial7.c", 289; if (tics > 4)
+	__ld.umq	_tics
+	__ugt_b.uiq	4
+	__bfalse	.LL58
+
+	.dbg	line,	"tutorial7.c", 290; {
+
+	.dbg	line,	"tutorial7.c", 291; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 292; state = 0;
+	__st.umiq	0, _state
+
+	.dbg	line,	"tutorial7.c", 293; frame = 0;
+	__st.umiq	0, _frame
+
+	.dbg	line,	"tutorial7.c", 294; }
+
+	.dbg	line,	"tutorial7.c", 295; }
+.LL58:
+.LL57:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 297; void bonk_state_6(void)
+	.dbg	line,	"tutorial7.c", 298; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bonk_state_6
+	__enter		_bonk_state_6
+
+	.dbg	line,	"tutorial7.c", 299; /* Bonk's bonking state! all controls are disabled in this one; this is just an animation handler/state controller */
+
+	.dbg	line,	"tutorial7.c", 300; tics++;
+	__inc.umq	_tics
+
+	.dbg	line,	"tutorial7.c", 301; if (tics == 5)
+	__ld.umq	_tics
+	__equ_b.uiq	5
+	__bfalse	.LL60
+
+	.dbg	line,	"tutorial7.c", 302; {
+
+	.dbg	line,	"tutorial7.c", 303; spr_pattern(0x5800);
+	__ld.wi		22528
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 304; /* we need to adjust Bonk's position, as this sprite is a few pixels to the left normally... this is why we need 'direction'! */
+
+	.dbg	line,	"tutorial7.c", 305; if (direction == DIR_LEFT)
+	__ld.umq	_direction
+	__equ_b.uiq	1
+	__bfalse	.LL61
+
+	.dbg	line,	"tutorial7.c", 306; {
+
+	.dbg	line,	"tutorial7.c", 307; spr_x(bonkx-8);
+	__ld.wm		_bonkx
+	__sub.wi	8
+	__call		_spr_x.1
+
+	.dbg	line,	"tutorial7.c", 308; } else {
+	__bra		.LL62
+.LL61:
+
+	.dbg	line,	"tutorial7.c", 309; spr_x(bonkx+8);
+	__ld.wm		_bonkx
+	__add.wi	8
+	__call		_spr_x.1
+
+	.dbg	line,	"tutorial7.c", 310; }
+.LL62:
+
+	.dbg	line,	"tutorial7.c", 311; }
+
+	.dbg	line,	"tutorial7.c", 312; if (tics > 10)
+.LL60:
+	__ld.umq	_tics
+	__ugt_b.uiq	10
+	__bfalse	.LL63
+
+	.dbg	line,	"tutorial7.c", 313; {
+
+	.dbg	line,	"tutorial7.c", 314; /* as this animation ends, restore the sprite to its normal posision and set the state back to 0 */
+
+	.dbg	line,	"tutorial7.c", 315; spr_pattern(0x5100);
+	__ld.wi		20736
+	__call		_spr_pattern.1
+
+	.dbg	line,	"tutorial7.c", 316; spr_x(bonkx);
+	__ld.wm		_bonkx
+	__call		_spr_x.1
+
+	.dbg	line,	"tutorial7.c", 317; tics = 0;
+	__st.umiq	0, _tics
+
+	.dbg	line,	"tutorial7.c", 318; state = 0;
+	__st.umiq	0, _state
+
+	.dbg	line,	"tutorial7.c", 319; }
+
+	.dbg	line,	"tutorial7.c", 320; }
+.LL63:
+.LL59:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 322; void move_in_world(void)
+	.dbg	line,	"tutorial7.c", 323; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_move_in_world
+	__enter		_move_in_world
+
+	.dbg	line,	"tutorial7.c", 324; char map_scroll_dir;
+
+	.dbg	line,	"tutorial7.c", 325; map_scroll_dir = 0;
+	__st.umiq	0, __move_in_world_end - 1  /* map_scroll_dir */
+
+	.dbg	line,	"tutorial7.c", 326; /*
+
+	.dbg	line,	"tutorial7.c", 327; how this should work:
+
+	.dbg	line,	"tutorial7.c", 328; -if character is at a direction threshhold but not at the map threshhold, scroll the map
+
+	.dbg	line,	"tutorial7.c", 329; -move character's sprite otherwise
+
+	.dbg	line,	"tutorial7.c", 330; */
+
+	.dbg	line,	"tutorial7.c", 331; /* are we moving left? */
+
+	.dbg	line,	"tutorial7.c", 332; if (direction == DIR_LEFT)
+	__ld.umq	_direction
+	__equ_b.uiq	1
+	__bfalse	.LL65
+
+	.dbg	line,	"tutorial7.c", 333; {
+
+	.dbg	line,	"tutorial7.c", 334; /* check for map threshhold */
+
+	.dbg	line,	"tutorial7.c", 335; if (vmapx > MAP_X_LOW_THRESHOLD)
+	__ld.wm		_vmapx
+	__sgt_w.wm	_MAP_X_LOW_THRESHOLD
+	__bfalse	.LL66
+
+	.dbg	line,	"tutorial7.c", 336; {
+
+	.dbg	line,	"tutorial7.c", 337; /* map threshhold has not been reached, so check for screen threshhold */
+
+	.dbg	line,	"tutorial7.c", 338; if (bonkx < CHAR_LEFT_THRESHOLD)
+	__ld.wm		_bonkx
+	__slt_w.wi	96
+	__bfalse	.LL67
+
+	.dbg	line,	"tutorial7.c", 339; {
+
+	.dbg	line,	"tutorial7.c", 340; /* we're at the screen threshhold, so we'll be scrolling the map now! */
+
+	.dbg	line,	"tutorial7.c", 341; map_scroll_dir = DIR_LEFT;
+	__st.umiq	1, __move_in_world_end - 1  /* map_scroll_dir */
+
+	.dbg	line,	"tutorial7.c", 342; } else {
+	__bra		.LL68
+.LL67:
+
+	.dbg	line,	"tutorial7.c", 343; /* just move */
+
+	.dbg	line,	"tutorial7.c", 344; bonkx--;
+	__dec.wmq	_bonkx
+
+	.dbg	line,	"tutorial7.c", 345; }
+.LL68	.alias		.LL69
+
+	.dbg	line,	"tutorial7.c", 346; } else {
+	__bra		.LL69
+.LL66:
+
+	.dbg	line,	"tutorial7.c", 347; /* we're at the map threshhold...no scrolling allowed! */
+
+	.dbg	line,	"tutorial7.c", 348; bonkx--;
+	__dec.wmq	_bonkx
+
+	.dbg	line,	"tutorial7.c", 349; }
+.LL69:
+
+	.dbg	line,	"tutorial7.c", 350; }
+
+	.dbg	line,	"tutorial7.c", 351; /* are we moving right? */
+
+	.dbg	line,	"tutorial7.c", 352; if (direction == DIR_RIGHT)
+.LL65:
+	__ld.umq	_direction
+	__equ_b.uiq	2
+	__bfalse	.LL70
+
+	.dbg	line,	"tutorial7.c", 353; {
+
+	.dbg	line,	"tutorial7.c", 354; /* check for map threshhold */
+
+	.dbg	line,	"tutorial7.c", 355; if (vmapx < MAP_X_THRESHOLD)
+	__ld.wm		_vmapx
+	__slt_w.wm	_MAP_X_THRESHOLD
+	__bfalse	.LL71
+
+	.dbg	line,	"tutorial7.c", 356; {
+
+	.dbg	line,	"tutorial7.c", 357; /* map threshhold has not been reached, so check for screen threshhold */
+
+	.dbg	line,	"tutorial7.c", 358; if (bonkx > CHAR_RIGHT_THRESHOLD)
+	__ld.wm		_bonkx
+	__sgt_w.wi	128
+	__bfalse	.LL72
+
+	.dbg	line,	"tutorial7.c", 359; {
+
+	.dbg	line,	"tutorial7.c", 360; /* we're at the screen threshhold, so we'll be scrolling the map now! */
+
+	.dbg	line,	"tutorial7.c", 361; map_scroll_dir = DIR_RIGHT;
+	__st.umiq	2, __move_in_world_end - 1  /* map_scroll_dir */
+
+	.dbg	line,	"tutorial7.c", 362; } else {
+	__bra		.LL73
+.LL72:
+
+	.dbg	line,	"tutorial7.c", 363; /* just move */
+
+	.dbg	line,	"tutorial7.c", 364; bonkx++;
+	__inc.wmq	_bonkx
+
+	.dbg	line,	"tutorial7.c", 365; }
+.LL73	.alias		.LL74
+
+	.dbg	line,	"tutorial7.c", 366; } else {
+	__bra		.LL74
+.LL71:
+
+	.dbg	line,	"tutorial7.c", 367; /* we're at the map threshhold...no scrolling allowed! */
+
+	.dbg	line,	"tutorial7.c", 368; bonkx++;
+	__inc.wmq	_bonkx
+
+	.dbg	line,	"tutorial7.c", 369; }
+.LL74:
+
+	.dbg	line,	"tutorial7.c", 370; }
+
+	.dbg	line,	"tutorial7.c", 371; spr_x(bonkx);
+.LL70:
+	__ld.wm		_bonkx
+	__call		_spr_x.1
+
+	.dbg	line,	"tutorial7.c", 372; move_map(map_scroll_dir);
+	__ld.um		__move_in_world_end - 1  /* map_scroll_dir */
+	__pusharg.wr
+	__call		_move_map
+
+	.dbg	line,	"tutorial7.c", 373; }
+.LL64:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+		ds	1
+__move_in_world_end:
+	.code
+	.pceas
+
+	.dbg	line,	"tutorial7.c", 375; void move_map(char whichway)
+	.dbg	line,	"tutorial7.c", 376; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_move_map
+	__enter		_move_map
+
+	.dbg	line,	"tutorial7.c", 377; if (whichway == 0) return;
+	__not.us	0  /* whichway */
+	__bfalse	.LL76
+	__bra		.LL75
+
+	.dbg	line,	"tutorial7.c", 378; if (whichway == DIR_RIGHT) vmapx++;
+.LL76:
+	__ld.usq	0  /* whichway */
+	__equ_b.uiq	2
+	__bfalse	.LL77
+	__inc.wmq	_vmapx
+
+	.dbg	line,	"tutorial7.c", 379; if (whichway == DIR_LEFT) vmapx--;
+.LL77:
+	__ld.usq	0  /* whichway */
+	__equ_b.uiq	1
+	__bfalse	.LL78
+	__dec.wmq	_vmapx
+
+	.dbg	line,	"tutorial7.c", 381; mapx = vmapx >> 3;
+.LL78:
+	__ld.wm		_vmapx
+	__asr.wi	3
+	__st.wmq	_mapx
+
+	.dbg	line,	"tutorial7.c", 382; mapy = vmapy >> 3;
+	__ld.wm		_vmapy
+	__asr.wi	3
+	__st.wmq	_mapy
+
+	.dbg	line,	"tutorial7.c", 383; 
+
+	.dbg	line,	"tutorial7.c", 384; if (whichway == DIR_RIGHT)
+	__ld.usq	0  /* whichway */
+	__equ_b.uiq	2
+	__bfalse	.LL79
+
+	.dbg	line,	"tutorial7.c", 385; {
+
+	.dbg	line,	"tutorial7.c", 386; if ((lastmapx != mapx) || (lastmapy != mapy))
+	__ld.wm		_lastmapx
+	__neq_w.wm	_mapx
+	__btrue		.LL81
+	__ld.wm		_lastmapy
+	__neq_w.wm	_mapy
+.LL81:
+	__bfalse	.LL80
+
+	.dbg	line,	"tutorial7.c", 387; {
+
+	.dbg	line,	"tutorial7.c", 388; t3 = (mapx+32) & 0xFF;
+	__ld.wm		_mapx
+	__add.wi	32
+	__and.wi	255
+	__st.wmq	_t3
+
+	.dbg	line,	"tutorial7.c", 389; load_map(t3,mapy,t3,mapy,1,SCR_H);
+	__st.umq	_al
+	__ld.wm		_mapy
+	__st.umq	_ah
+	__ld.wm		_t3
+	__st.wmq	_bx
+	__ld.wm		_mapy
+	__st.wmq	_dx
+	__st.umiq	1, _cl
+	__st.umiq	32, _ch
+	__call		_load_map.6
+
+	.dbg	line,	"tutorial7.c", 390; }
+
+	.dbg	line,	"tutorial7.c", 391; }
+.LL80:
+
+	.dbg	line,	"tutorial7.c", 392; if (whichway == DIR_LEFT)
+.LL79:
+	__ld.usq	0  /* whichway */
+	__equ_b.uiq	1
+	__bfalse	.LL82
+
+	.dbg	line,	"tutorial7.c", 393; {
+
+	.dbg	line,	"tutorial7.c", 394; if ((lastmapx != mapx) || (lastmapy != mapy))
+	__ld.wm		_lastmapx
+	__neq_w.wm	_mapx
+	__btrue		.LL84
+	__ld.wm		_lastmapy
+	__neq_w.wm	_mapy
+.LL84:
+	__bfalse	.LL83
+
+	.dbg	line,	"tutorial7.c", 395; load_map(mapx,mapy,mapx,mapy,1,SCR_H);
+	__ld.wm		_mapx
+	__st.umq	_al
+	__ld.wm		_mapy
+	__st.umq	_ah
+	__ld.wm		_mapx
+	__st.wmq	_bx
+	__ld.wm		_mapy
+	__st.wmq	_dx
+	__st.umiq	1, _cl
+	__st.umiq	32, _ch
+	__call		_load_map.6
+
+	.dbg	line,	"tutorial7.c", 396; }
+.LL83:
+
+	.dbg	line,	"tutorial7.c", 397; scroll(0,vmapx,vmapy,0,223,0xC0);
+.LL82:
+	__st.umiq	0, _al
+	__ld.wm		_vmapx
+	__st.wmq	_cx
+	__ld.wm		_vmapy
+	__st.wmq	_dx
+	__st.umiq	0, _ah
+	__st.umiq	223, _bl
+	__ld.uiq	192
+	__call		_scroll.6
+
+	.dbg	line,	"tutorial7.c", 398; lastmapx = mapx;
+	__ld.wm		_mapx
+	__st.wmq	_lastmapx
+
+	.dbg	line,	"tutorial7.c", 399; lastmapy = mapy;
+	__ld.wm		_mapy
+	__st.wmq	_lastmapy
+
+	.dbg	line,	"tutorial7.c", 400; }
+.LL75:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_bonkx:
+		ds	2
+_bonky:
+		ds	2
+_j1:
+		ds	2
+_j2:
+		ds	2
+_mapx:
+		ds	2
+_mapy:
+		ds	2
+_vmapx:
+		ds	2
+_vmapy:
+		ds	2
+_lastmapx:
+		ds	2
+_lastmapy:
+		ds	2
+_t3:
+		ds	2
+_jumpspeed:
+		ds	2
+_jumpdelta:
+		ds	2
+_MAP_X_THRESHOLD:
+		ds	2
+_MAP_X_LOW_THRESHOLD:
+		ds	2
+_tics:
+		ds	1
+_frame:
+		ds	1
+_state:
+		ds	1
+_direction:
+		ds	1
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:271
+;	Macro pool:119
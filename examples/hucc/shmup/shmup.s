@@ -0,0 +1,2053 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (b16933f, 2026-10-17)
+; on Sat Oct 17 10:20:37 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+_SGX		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"../../../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 3; //
+	.dbg	line,	"../../../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"../../../include/hucc/globals.h", 5; //
+	.dbg	line,	"../../../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 8; //
+	.dbg	line,	"../../../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"../../../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"../../../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"../../../include/hucc/globals.h", 12; //
+	.dbg	line,	"../../../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"../../../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"../../../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"../../../include/hucc/globals.h", 16; //
+	.dbg	line,	"../../../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"../../../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"shmup.c", 1; /* Sample game for HuC, using new language features (and NOT SimpleTracker).
+	.dbg	line,	"shmup.c", 2; * Based on the sample game at http://obeybrew.com/tutorials.html
+	.dbg	line,	"shmup.c", 3; */
+	.dbg	line,	"shmup.c", 5; #include <huc.h>
+	.dbg	line,	"../../../include/hucc/huc.h", 1; #ifndef _hucc_legacy_h
+	.dbg	line,	"../../../include/hucc/huc.h", 2; #define _hucc_legacy_h
+	.dbg	line,	"../../../include/hucc/huc.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 6; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 7; ; huc.h
+	.dbg	line,	"../../../include/hucc/huc.h", 8; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 9; ; HuCC wrapper file to include a default set of HuC-compatible functions.
+	.dbg	line,	"../../../include/hucc/huc.h", 10; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/huc.h", 12; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/huc.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/huc.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/huc.h", 16; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 19; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 20; ; When the HuCC compiler is invoked with the "--legacy" option to compile old
+	.dbg	line,	"../../../include/hucc/huc.h", 21; ; projects, then this "huc.h" file is automatically included.
+	.dbg	line,	"../../../include/hucc/huc.h", 22; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 23; ; This file includes a set of the individual HuCC headers which correspond to
+	.dbg	line,	"../../../include/hucc/huc.h", 24; ; HuC's built-in functions and MagicKit library.
+	.dbg	line,	"../../../include/hucc/huc.h", 25; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 26; ; New HuCC projects should, preferably, include the specific headers that are
+	.dbg	line,	"../../../include/hucc/huc.h", 27; ; needed, which will then allow them to replace parts of the standard library
+	.dbg	line,	"../../../include/hucc/huc.h", 28; ; with newer functions, or they can just manually include this "huc.h" file.
+	.dbg	line,	"../../../include/hucc/huc.h", 29; ;
+	.dbg	line,	"../../../include/hucc/huc.h", 30; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/huc.h", 31; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/huc.h", 33; #include "hucc-systemcard.h"
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 1; #ifndef _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 2; #define _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 7; ; hucc-systemcard.h
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 9; ; Macros and library functions for using the System Card.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 20; ; Because these are mainly macros, and so must be included before being used
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 21; ; in compiled code, the actual functions here are written to avoid using any
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 22; ; BSS memory so that HuCC's overlay global-shared-variables are not effected.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 23; ;
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 24; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 25; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 27; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 28; // Backup RAM defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 29; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 31; #define  BM_OK             0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 32; #define  BM_NOT_FOUND      1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 33; #define  BM_BAD_CHECKSUM   2
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 34; #define  BM_DIR_CORRUPTED  3
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 35; #define  BM_FILE_EMPTY     4
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 36; #define  BM_FULL           5
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 37; #define  BM_NOT_FORMATED   0xFF			// HuC incorrect spelling.
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 38; #define  BM_NOT_FORMATTED  0xFF			// HuCC can use a dictionary!
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 40; #define  BRAM_STARTPTR     0x8010
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 42; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 43; // CD defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 44; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 46; #define	CDPLAY_MUTE		0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 47; #define	CDPLAY_REPEAT		1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 48; #define	CDPLAY_NORMAL		2
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 49; #define	CDPLAY_ENDOFDISC	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 51; #define	CDFADE_CANCEL	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 52; #define	CDFADE_PCM6	8
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 53; #define	CDFADE_ADPCM6	10
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 54; #define	CDFADE_PCM2	12
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 55; #define	CDFADE_ADPCM2	14
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 57; #define CDTRK_AUDIO	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 58; #define CDTRK_DATA	4
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 61; // ADPCM defines ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 62; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 64; #define	ADPLAY_AUTOSTOP		0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 65; #define	ADPLAY_REPEAT		0x80
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 67; #define ADPLAY_FREQ_16KHZ	0xE
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 68; #define ADPLAY_FREQ_10KHZ	0xD
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 69; #define ADPLAY_FREQ_8KHZ	0xC
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 70; #define ADPLAY_FREQ_6KHZ	0xB
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 71; #define ADPLAY_FREQ_5KHZ	0xA
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 73; #define ADREAD_RAM	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 74; #define ADREAD_VRAM	0xFF
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 76; #define ADWRITE_RAM	0
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 77; #define ADWRITE_VRAM	0xFF
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 79; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 80; // Functions in hucc-systemcard.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 81; // *************
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 83; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 85; #asmdef	HUCC_USES_SYSTEMCARD 1
+HUCC_USES_SYSTEMCARD = 1
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 87; extern void __fastcall __macro cd_boot( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 88; extern unsigned int __fastcall __macro cd_getver( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 89; extern void __fastcall __macro cd_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 90; extern unsigned char __fastcall __macro cd_pause( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 91; extern unsigned char __fastcall cd_unpause( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 92; extern void __fastcall __macro cd_fade( unsigned char type<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 93; extern unsigned char __fastcall cd_playtrk( unsigned char start_track<_bx>, unsigned char end_track<_cx>, unsigned char mode<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 94; extern unsigned char __fastcall cd_playmsf( unsigned char start_minute<_al>,  unsigned char start_second<_ah>,  unsigned char start_frame<_bl>, unsigned char end_minute<_cl>,  unsigned char end_second<_ch>,  unsigned char end_frame<_dl>,  unsigned char mode<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 95; extern unsigned char __fastcall cd_fastvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int sectors<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 96; extern unsigned char __fastcall cd_loadvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 97; extern unsigned char __fastcall cd_loaddata( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char __far *buffer<_bp_bank:_bp>, unsigned int bytes<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 98; extern unsigned char __fastcall cd_loadbank( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char bank<_bl>, unsigned int sectors<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 99; extern unsigned char __fastcall __macro cd_status( unsigned char mode<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 101; extern void __fastcall __macro ad_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 102; extern unsigned char __fastcall __macro ad_trans( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char nb_sectors<_dh>, unsigned int ad_addr<_bx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 103; extern void __fastcall __macro ad_read( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 104; extern void __fastcall __macro ad_write( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 105; extern unsigned char __fastcall __macro ad_play( unsigned int ad_addr<_bx>, unsigned int bytes<_ax>, unsigned char freq<_dh>, unsigned char mode<_dl> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 106; extern unsigned char __fastcall __macro ad_cplay( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int nb_sectors<_bx>, unsigned char freq<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 107; extern void __fastcall __macro ad_stop( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 108; extern unsigned char __fastcall __macro ad_stat( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 110; extern unsigned char __fastcall bm_check( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 111; extern unsigned char __fastcall bm_format( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 112; extern unsigned int __fastcall __macro bm_free( void );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 113; extern unsigned char __fastcall __macro bm_read( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 114; extern unsigned char __fastcall __macro bm_write( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 115; extern unsigned char __fastcall __macro bm_delete( unsigned char *name<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 117; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 119; extern unsigned char __fastcall __macro bm_exist( unsigned char *name<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 120; extern unsigned char __fastcall __macro bm_create( unsigned char *name<_ax>, unsigned int length<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 122; // void __fastcall _xsafe add_sectors( unsigned int sector_offset<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 124; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-systemcard.h", 126; #endif // _hucc_systemcard_h
+	.dbg	line,	"../../../include/hucc/huc.h", 34; #include "hucc-baselib.h"
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 1; #ifndef _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 2; #define _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 7; ; hucc-baselib.h
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 9; ; Basic library functions provided as macros.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 18; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 20; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 21; // Joypad defines ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 22; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 24; #define	JOY_A		0x01
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 25; #define	JOY_I		0x01
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 26; #define	JOY_B		0x02
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 27; #define	JOY_II		0x02
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 28; #define	JOY_SLCT	0x04
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 29; #define	JOY_SEL		0x04
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 30; #define	JOY_STRT	0x08
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 31; #define	JOY_RUN		0x08
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 32; #define	JOY_UP		0x10
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 33; #define	JOY_RGHT	0x20
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 34; #define	JOY_RIGHT	0x20
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 35; #define	JOY_DOWN	0x40
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 36; #define	JOY_LEFT	0x80
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 38; #define	JOY_C		0x0100
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 39; #define	JOY_III		0x0100
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 40; #define	JOY_D		0x0200
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 41; #define	JOY_IV		0x0200
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 42; #define	JOY_E		0x0400
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 43; #define	JOY_V		0x0400
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 44; #define	JOY_F		0x0800
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 45; #define	JOY_VI		0x0800
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 47; #define JOY_SIXBUT	0x8000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 48; #define JOY_TYPE6	0x8000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 50; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 51; // SuperGRAFX VPC settings for set_vpc_ctl() ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 52; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 54; #define VPC_SPR1_BKG1_SPR2_BKG2	0x3000 // same as SGX_PARALLAX=0
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 55; #define VPC_SPR1_SPR2_BKG1_BKG2	0x7000 // same as SGX_PARALLAX=1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 56; #define VPC_BKG1_BKG2_SPR1_SPR2	0xB000
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 58; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 59; // System Card variables ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 62; extern unsigned int si;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 63; extern unsigned int di;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 64; extern unsigned int bp;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 66; extern unsigned int ax;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 67; extern unsigned int bx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 68; extern unsigned int cx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 69; extern unsigned int dx;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 71; extern unsigned char al;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 72; extern unsigned char ah;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 73; extern unsigned char bl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 74; extern unsigned char bh;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 75; extern unsigned char cl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 76; extern unsigned char ch;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 77; extern unsigned char dl;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 78; extern unsigned char dh;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 80; extern unsigned char irq_cnt;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 81; extern unsigned char joynow[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 82; extern unsigned char joytrg[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 83; extern unsigned char joy6now[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 84; extern unsigned char joy6trg[5];
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 85; extern unsigned int  bg_x1;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 86; extern unsigned int  bg_y1;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 87; extern unsigned int  bg_x2;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 88; extern unsigned int  bg_y2;
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 90; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 91; // Special macros to get information from PCEAS ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 92; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 94; #define BANK( datasym ) ((unsigned) (&__bank__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 95; #define SIZEOF( datasym ) ((unsigned) (&__sizeof__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 96; #define COUNTOF( datasym ) ((unsigned) (&__countof__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 97; #define OVERLAY( datasym ) ((unsigned) (&__overlay__ ## datasym))
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 100; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 101; // Functions in hucc-baselib.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 102; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 104; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 106; #asmdef	HUCC_USES_BASELIB 1
+HUCC_USES_BASELIB = 1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 108; #define	_OPTIMIZE 1
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 111; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 112; // Hardware Detection
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 113; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 115; extern unsigned char __fastcall __macro sgx_detect( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 116; extern unsigned char __fastcall __macro ac_exists( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 119; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 120; // Memory Access
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 121; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 123; extern unsigned char __fastcall __macro peek( unsigned int addr<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 124; extern unsigned int  __fastcall __macro peekw( unsigned int addr<__ptr> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 126; extern void __fastcall __macro poke( unsigned int addr<__poke>, unsigned char with<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 127; extern void __fastcall __macro pokew( unsigned int addr<__poke>, unsigned int with<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 129; extern unsigned char __fastcall farpeek( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 130; extern unsigned int  __fastcall farpeekw( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 132; extern void __fastcall __nop set_far_base( unsigned char data_bank<_bp_bank>, unsigned char *data_addr<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 133; extern void __fastcall set_far_offset( unsigned int offset<_bp>, unsigned char data_bank<_bp_bank>, unsigned char *data_addr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 135; extern unsigned char __fastcall far_peek( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 136; extern unsigned int  __fastcall far_peekw( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 138; extern void __fastcall __macro reset_mpr2( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 139; extern void __fastcall __macro reset_mpr34( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 141; extern void * __fastcall __macro farset_mpr2( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 142; extern void * __fastcall __macro farset_mpr34( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 144; extern void * __fastcall __macro far_set_mpr2( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 145; extern void * __fastcall __macro far_set_mpr34( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 148; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 149; // Clock Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 150; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 152; extern unsigned char __fastcall __macro clock_hh( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 153; extern unsigned char __fastcall __macro clock_mm( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 154; extern unsigned char __fastcall __macro clock_ss( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 155; extern unsigned char __fastcall __macro clock_tt( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 156; extern void __fastcall __macro clock_reset( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 159; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 160; // Joypad Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 161; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 163; extern unsigned int __fastcall __macro joy( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 164; extern unsigned int __fastcall __macro joytrg( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 167; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 168; // Number Functions
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 169; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 171; extern void __fastcall __macro srand( unsigned char seed<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 172; extern unsigned int __fastcall rand( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 173; extern unsigned char __fastcall rand8( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 175; // Note: "limit" is 0..255.
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 176; extern unsigned char __fastcall random8( unsigned char limit<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 178; // Note: "limit" is 0..128, 129..255 are treated as 128!
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 179; extern unsigned char __fastcall random( unsigned char limit<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 182; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 183; // Overlay Execution
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 184; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 186; extern unsigned char __fastcall __macro cd_execoverlay( unsigned char ovl_index<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 189; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 190; // Functions that are only optionally available if configured in your hucc-config.inc
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 191; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 193; extern unsigned int __fastcall __macro joybuf( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 194; extern unsigned int __fastcall __macro get_joy_events( unsigned char which<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 195; extern void __fastcall __macro clear_joy_events( unsigned char mask<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 198; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 199; // Functions that are only implemented in the TGEMU emulator for unit-testing
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 200; // the compiler, and which should never be used in normal HuCC projects ...
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 201; // *************
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 203; extern void __fastcall dump_screen( void );
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 205; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-baselib.h", 207; #endif // _hucc_baselib_h
+	.dbg	line,	"../../../include/hucc/huc.h", 35; #include "hucc-gfx.h"
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 1; #ifndef _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 2; #define _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 7; ; huc-gfx.h
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 22; // Screen defines ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 25; #define	SCR_SIZE_32x32	0
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 26; #define	SCR_SIZE_64x32	1
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 27; #define	SCR_SIZE_128x32	2
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 28; #define	SCR_SIZE_32x64	4
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 29; #define	SCR_SIZE_64x64	5
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 30; #define	SCR_SIZE_128x64	6
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 32; #define	XRES_SHARP	0
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 33; #define	XRES_SOFT	4
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 34; #define	XRES_KEEP	128
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 36; #define VPC_WIN_A	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 37; #define VPC_WIN_B	0x01
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 38; #define	VPC_WIN_AB	0x02
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 39; #define	VPC_WIN_NONE	0x03
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 40; #define	VPC_NORM	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 41; #define	VPC_SPR		0x04
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 42; #define	VPC_INV_SPR	0x08
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 43; #define VDC1_ON		0x01
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 44; #define	VDC1_OFF	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 45; #define VDC2_ON		0x02
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 46; #define	VDC2_OFF	0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 47; #define VDC_ON		0x03
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 48; #define	VDC_OFF		0x00
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 50; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 51; // Functions in hucc-gfx.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 52; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 54; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 56; #asmdef	HUCC_USES_GFX 1
+HUCC_USES_GFX = 1
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 58; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 59; // Color and Palette Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 60; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 62; extern void __fastcall clear_palette( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 64; extern void __fastcall __nop set_color( unsigned int index<VCE_CTA>, unsigned int value<VCE_CTW> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 65; extern void __fastcall set_color_rgb( unsigned int index<VCE_CTA>, unsigned char r<_al>, unsigned char g<_ah>, unsigned char b<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 66; extern unsigned int __fastcall __macro get_color( unsigned int index<VCE_CTA> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 68; extern void __fastcall load_palette( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 69; extern void __fastcall far_load_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 71; extern void __fastcall read_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah>, unsigned int *destination<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 73; extern void __fastcall __macro fade_to_black( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 74; extern void __fastcall __macro fade_to_white( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 75; extern void __fastcall __macro cross_fade_to( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 77; extern void __fastcall __macro far_fade_to_black( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 78; extern void __fastcall __macro far_fade_to_white( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 79; extern void __fastcall __macro far_cross_fade_to( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 83; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 84; // Video Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 85; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 87; extern void __fastcall init_240x208( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 88; extern void __fastcall init_256x224( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 90; extern void __fastcall vsync( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 91; extern void __fastcall vsync( unsigned char count<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 93; extern void __fastcall disp_on( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 94; extern void __fastcall disp_off( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 96; extern void __fastcall set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 98; extern void __fastcall set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 100; extern void __fastcall cls( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 101; extern void __fastcall cls( unsigned int tile<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 103; extern unsigned int __fastcall __macro vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 104; extern unsigned int __fastcall __macro get_vram( unsigned int address<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 105; extern void __fastcall __macro put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 107; extern void __fastcall __macro load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 108; extern void __fastcall __macro far_load_vram( unsigned int vram<_di>,  unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 110; extern void __fastcall load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 111; extern void __fastcall far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 113; extern void __fastcall __macro load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 114; extern void __fastcall __macro far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 116; extern void __fastcall vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 119; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 120; // SuperGRAFX Video Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 121; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 123; extern void __fastcall __nop vpc_set_ctl( unsigned int bits<VPC_CR> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 124; extern void __fastcall __nop vpc_set_win1( unsigned int width<VPC_WINDOW1> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 125; extern void __fastcall __nop vpc_set_win2( unsigned int width<VPC_WINDOW2> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 127; extern void __fastcall sgx_set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 129; extern void __fastcall sgx_set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 131; extern void __fastcall sgx_cls( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 132; extern void __fastcall sgx_cls( unsigned int tile<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 134; extern unsigned int __fastcall __macro sgx_vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 135; extern unsigned int __fastcall __macro sgx_get_vram( unsigned int address<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 136; extern void __fastcall __macro sgx_put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 138; extern void __fastcall __macro sgx_load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 139; extern void __fastcall __macro sgx_far_load_vram( unsigned int vram<_di>, unsigned int num_words<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 141; extern void __fastcall sgx_load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 142; extern void __fastcall sgx_far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 144; extern void __fastcall __macro sgx_load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 145; extern void __fastcall __macro sgx_far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 147; extern void __fastcall sgx_vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 150; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 151; // Font Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 152; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 154; extern void __fastcall set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 155; extern void __fastcall set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 157; extern void __fastcall load_font( unsigned char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 158; extern void __fastcall far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 160; extern void __fastcall __nop set_font_color( unsigned char foreground<monofont_fg>, unsigned char background<monofont_bg> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 161; extern void __fastcall __macro load_default_font( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 164; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 165; // SuperGRAFX Font Functions
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 166; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 168; extern void __fastcall sgx_set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 169; extern void __fastcall sgx_set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 171; extern void __fastcall sgx_load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 172; extern void __fastcall sgx_far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 174; extern void __fastcall __macro sgx_load_default_font( void );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 177; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 178; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 179; // *************
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 181; extern void __fastcall __macro set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 182; extern void __fastcall __macro sgx_set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 184; extern void __fastcall load_background( unsigned char __far *tiles<_bp_bank:_bp>, unsigned char __far *palettes<__fbank:__fptr>, unsigned char __far *bat<_cl:_bx>, unsigned char w<_dl>, unsigned char h<_dh> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 186; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 187; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 188; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 189; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 191; extern void __fastcall load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 193; extern void __fastcall put_string( unsigned char *string<_bp>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 195; extern void __fastcall put_char( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 196; extern void __fastcall put_digit( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 197; extern void __fastcall put_hex( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 198; extern void __fastcall put_number( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 199; extern void __fastcall put_raw( unsigned int data<_bx>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 201; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-gfx.h", 203; #endif // _hucc_gfx_h
+	.dbg	line,	"../../../include/hucc/huc.h", 36; #include "hucc-old-scroll.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 1; #ifndef _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 2; #define _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 7; ; hucc-old-scroll.h
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 19; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 20; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 21; ; HuC's old scrolling library is provided for use with existing HuC projects,
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 22; ; but it should preferably be avoided in new projects because it is slow and
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 23; ; forever limited by its choice to handle gaps between areas, and sorting.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 24; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 25; ; HuCC's new scrolling library puts the responibility for defining both gaps
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 26; ; and the display order into the project's hands, but in return it runs much
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 27; ; faster, using less than 1/6 of the processing time in VBLANK, and far less
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 28; ; time in the RCR interrputs themselves. It also supports the 2nd SuperGRAFX
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 29; ; screen layer, which HuC's old scrolling library ignores.
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 30; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 31; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 32; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 34; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 35; // Functions in hucc-old-scroll.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 36; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 38; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 40; #asmdef	HUCC_USES_OLD_SCROLL 1
+HUCC_USES_OLD_SCROLL = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 42; extern void __fastcall scroll( unsigned char num<_al>, unsigned int x<_cx>, unsigned int y<_dx>, unsigned char top<_ah>, unsigned char bottom<_bl>, unsigned char disp<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 43; extern void __fastcall scroll_disable( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 45; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-scroll.h", 47; #endif // _hucc_old_scroll_h
+	.dbg	line,	"../../../include/hucc/huc.h", 37; #include "hucc-old-spr.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 1; #ifndef _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 2; #define _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 7; ; hucc-old-spr.h
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 22; // Sprite defines ...
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 25; #define FLIP_X_MASK 0x08
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 26; #define FLIP_Y_MASK 0x80
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 27; #define FLIP_MAS    0x88
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 28; #define SIZE_MAS    0x31
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 30; #define NO_FLIP     0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 31; #define NO_FLIP_X   0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 32; #define NO_FLIP_Y   0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 33; #define FLIP_X      0x08
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 34; #define FLIP_Y      0x80
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 35; #define SZ_16x16    0x00
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 36; #define SZ_16x32    0x10
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 37; #define SZ_16x64    0x30
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 38; #define SZ_32x16    0x01
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 39; #define SZ_32x32    0x11
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 40; #define	SZ_32x64    0x31
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 42; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 43; // Functions in hucc-old-spr.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 44; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 46; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 48; #asmdef	HUCC_USES_OLD_SPR 1
+HUCC_USES_OLD_SPR = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 50; extern void __fastcall init_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 51; extern void __fastcall reset_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 52; extern void __fastcall satb_update( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 53; extern void __fastcall spr_set( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 54; extern void __fastcall spr_hide( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 55; extern void __fastcall spr_show( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 56; extern void __fastcall spr_x( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 57; extern void __fastcall spr_y( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 58; extern void __fastcall spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 59; extern void __fastcall spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 60; extern void __fastcall spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 61; extern void __fastcall spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 63; extern unsigned int __fastcall spr_get_x( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 64; extern unsigned int __fastcall spr_get_y( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 66; extern void __fastcall sgx_init_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 67; extern void __fastcall sgx_reset_satb( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 68; extern void __fastcall sgx_satb_update( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 69; extern void __fastcall sgx_spr_set( unsigned char num<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 70; extern void __fastcall sgx_spr_hide( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 71; extern void __fastcall sgx_spr_show( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 72; extern void __fastcall sgx_spr_x( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 73; extern void __fastcall sgx_spr_y( unsigned int value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 74; extern void __fastcall sgx_spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 75; extern void __fastcall sgx_spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 76; extern void __fastcall sgx_spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 77; extern void __fastcall sgx_spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 79; extern unsigned int __fastcall sgx_spr_get_x( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 80; extern unsigned int __fastcall sgx_spr_get_y( void );
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 82; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-spr.h", 84; #endif // _hucc_old_spr_h
+	.dbg	line,	"../../../include/hucc/huc.h", 38; #include "hucc-old-map.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 1; #ifndef _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 2; #define _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 7; ; hucc-old-map.h
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 22; // Functions in hucc-old-map.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 25; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 27; #asmdef	HUCC_USES_OLD_MAP 1
+HUCC_USES_OLD_MAP = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 29; extern void __fastcall set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 30; extern void __fastcall sgx_set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 32; extern void __fastcall __nop set_tile_data( unsigned char __far *tiles<vdc_tile_bank:vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 33; extern void __fastcall __nop sgx_set_tile_data( unsigned char __far *tiles<sgx_tile_bank:sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 35; extern void __fastcall __nop set_far_tile_data( unsigned char tile_bank<vdc_tile_bank>, unsigned char *tile_addr<vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char palette_table_bank<vdc_attr_bank>, unsigned char *palette_table_addr<vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 36; extern void __fastcall __nop sgx_set_far_tile_data( unsigned char tile_bank<sgx_tile_bank>, unsigned char *tile_addr<sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char palette_table_bank<sgx_attr_bank>, unsigned char *palette_table_addr<sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 38; extern void __fastcall __nop set_map_data( unsigned char __far *map<vdc_map_bank:vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 39; extern void __fastcall __nop sgx_set_map_data( unsigned char __far *map<sgx_map_bank:sgx_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 41; extern void __fastcall __nop set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 42; extern void __fastcall __nop sgx_set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 44; extern void __fastcall load_tile( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 45; extern void __fastcall sgx_load_tile( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 47; extern void __fastcall load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 48; extern void __fastcall sgx_load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 50; extern unsigned char __fastcall map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 51; extern unsigned char __fastcall sgx_map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 53; extern void __fastcall map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 54; extern void __fastcall sgx_map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 56; extern void __fastcall put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 57; extern void __fastcall sgx_put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 59; // Deprecated functions ...
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 61; extern void __fastcall set_tile_data( unsigned char *tile_ex<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 63; extern void __fastcall __nop set_map_pals( unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 64; extern void __fastcall __nop set_map_tile_type( unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 66; extern void __fastcall __nop sgx_set_map_pals( unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 67; extern void __fastcall __nop sgx_set_map_tile_type( unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 69; extern void __fastcall set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 70; extern void __fastcall sgx_set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 72; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-map.h", 74; #endif // _hucc_old_map_h
+	.dbg	line,	"../../../include/hucc/huc.h", 39; #include "hucc-old-line.h"
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 1; #ifndef _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 2; #define _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 7; ; hucc-old-line.h
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 10; ; other original HuC developers.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 11; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 13; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 17; ;
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 19; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 21; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 22; // Functions in hucc-old-line.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 23; // *************
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 25; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 27; #asmdef	HUCC_USES_OLD_LINE 1
+HUCC_USES_OLD_LINE = 1
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 29; extern void __fastcall gfx_init( unsigned int start_vram_addr<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 30; extern void __fastcall gfx_clear( unsigned int start_vram_addr<_di> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 31; extern void __fastcall gfx_plot( unsigned int x<_gfx_x1>, unsigned int y<_gfx_y1>, char color<_gfx_color> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 32; extern void __fastcall gfx_line( unsigned int x1<_gfx_x1>, unsigned int y1<_gfx_y1>, unsigned int x2<_gfx_x2>, unsigned int y2<_gfx_y2>, unsigned char color<_gfx_color> );
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 34; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-old-line.h", 36; #endif // _hucc_old_line_h
+	.dbg	line,	"../../../include/hucc/huc.h", 41; #include <stdlib.h>
+	.dbg	line,	"../../../include/hucc/stdlib.h", 1; #ifndef _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/stdlib.h", 2; #define _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/stdlib.h", 4; #define RAND_MAX 32767
+	.dbg	line,	"../../../include/hucc/stdlib.h", 6; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/stdlib.h", 7; extern int __fastcall abs( int value<acc> );
+	.dbg	line,	"../../../include/hucc/stdlib.h", 8; #endif
+	.dbg	line,	"../../../include/hucc/stdlib.h", 10; #endif // _hucc_stdlib_h
+	.dbg	line,	"../../../include/hucc/huc.h", 42; #include <string.h>
+	.dbg	line,	"../../../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"../../../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"../../../include/hucc/string.h", 3; #endif
+	.dbg	line,	"../../../include/hucc/huc.h", 44; #endif // _hucc_legacy_h
+	.dbg	line,	"shmup.c", 7; #incspr(bonk,"charwalk.pcx",0,0,2,8)
+	.data
+_bonk:	.incspr		"charwalk.pcx", 0, 0, 2, 8
+	.code
+	.dbg	line,	"shmup.c", 8; #incpal(bonkpal,"charwalk.pcx")
+	.data
+_bonkpal:	.incpal		"charwalk.pcx"
+	.code
+	.dbg	line,	"shmup.c", 9; #incspr(bullet,"bullet.pcx",0,0,1,1)
+	.data
+_bullet:	.incspr		"bullet.pcx", 0, 0, 1, 1
+	.code
+	.dbg	line,	"shmup.c", 10; #incpal(bulletpal,"bullet.pcx")
+	.data
+_bulletpal:	.incpal		"bullet.pcx"
+	.code
+	.dbg	line,	"shmup.c", 11; #incspr(ship,"ship.pcx",0,0,2,8)
+	.data
+_ship:	.incspr		"ship.pcx", 0, 0, 2, 8
+	.code
+	.dbg	line,	"shmup.c", 12; #incpal(shippal,"ship.pcx")
+	.data
+_shippal:	.incpal		"ship.pcx"
+	.code
+	.dbg	line,	"shmup.c", 13; #incspr(explosion,"explosion.pcx",0,0,2,16)
+	.data
+_explosion:	.incspr		"explosion.pcx", 0, 0, 2, 16
+	.code
+	.dbg	line,	"shmup.c", 14; #incpal(explosionpal,"explosion.pcx")
+	.data
+_explosionpal:	.incpal		"explosion.pcx"
+	.code
+	.dbg	line,	"shmup.c", 16; const unsigned char * aSpriteDataAddr[] = {
+	.dbg	line,	"shmup.c", 17; &bonk, &bullet, &ship, &explosion };
+	.dbg	line,	"shmup.c", 19; const unsigned char aSpriteDataBank[] = {
+	.dbg	line,	"shmup.c", 20; ^bonk, ^bullet, ^ship, ^explosion };
+	.dbg	line,	"shmup.c", 22; #incchr(scene_chr,"scene.png")
+	.data
+_scene_chr: 	.incchr		"scene.png"
+	.code
+	.dbg	line,	"shmup.c", 23; #incpal(scene_pal,"scene.png")
+	.data
+_scene_pal:	.incpal		"scene.png"
+	.code
+	.dbg	line,	"shmup.c", 24; #incbat(scene_bat,"scene.png",0x1000,32,28)
+	.data
+_scene_bat:	.incbat		"scene.png", 4096, 32, 28
+	.code
+	.dbg	line,	"shmup.c", 26; #define SPEED_X 2
+	.dbg	line,	"shmup.c", 27; #define SPEED_Y 2
+	.dbg	line,	"shmup.c", 29; #define SPEED_BULLET 4
+	.dbg	line,	"shmup.c", 30; #define MAX_BULLETS 10
+	.dbg	line,	"shmup.c", 31; #define BULLET_SPRITE 1
+	.dbg	line,	"shmup.c", 33; struct bullet {
+	.dbg	line,	"shmup.c", 34; int x, y;
+	.dbg	line,	"shmup.c", 35; signed char active;
+	.dbg	line,	"shmup.c", 36; };
+	.dbg	line,	"shmup.c", 38; struct bullet bullets[MAX_BULLETS];
+	.dbg	line,	"shmup.c", 40; #define MAX_SHIPS 5
+	.dbg	line,	"shmup.c", 41; #define SPEED_SHIP 1
+	.dbg	line,	"shmup.c", 42; #define SHIP_SPRITE (BULLET_SPRITE + MAX_BULLETS)
+	.dbg	line,	"shmup.c", 43; #define SCORE_SHIP 100
+	.dbg	line,	"shmup.c", 45; struct ship {
+	.dbg	line,	"shmup.c", 46; int x, y;
+	.dbg	line,	"shmup.c", 47; char active;
+	.dbg	line,	"shmup.c", 48; char vx, vy;
+	.dbg	line,	"shmup.c", 49; };
+	.dbg	line,	"shmup.c", 51; struct ship ships[MAX_SHIPS];
+	.dbg	line,	"shmup.c", 53; /* put some of these variables into zero-page memory */
+	.dbg	line,	"shmup.c", 54; unsigned int frames;
+	.dbg	line,	"shmup.c", 55; __zp unsigned int score, hiscore;
+	.dbg	line,	"shmup.c", 56; __zp struct ship *pship;
+	.dbg	line,	"shmup.c", 57; static __zp struct bullet *pshot;
+	.dbg	line,	"shmup.c", 59; void do_ships(void)
+	.dbg	line,	"shmup.c", 60; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_do_ships
+	__enter		_do_ships
+
+	.dbg	line,	"shmup.c", 61; unsigned int i,j;
+
+	.dbg	line,	"shmup.c", 62; unsigned char r;
+
+	.dbg	line,	"shmup.c", 63; static __zp struct ship *sp;
+
+	.dbg	line,	"shmup.c", 64; static __zp struct bullet *bp;
+
+	.dbg	line,	"shmup.c", 66; r = rand();
+	__call		_rand
+	__st.umq	__do_ships_end - 5  /* r */
+
+	.dbg	line,	"shmup.c", 67; if ((r & 0x7e) == 2) {
+	__ld.um		__do_ships_end - 5  /* r */
+	__and.uiq	126
+	__equ_b.uiq	2
+	__bfalse	.LL5
+
+	.dbg	line,	"shmup.c", 68; for (i = 0, sp = ships; i < MAX_SHIPS; ++i, ++sp) {
+	__st.wmiq	0, __do_ships_end - 2  /* i */
+	__ld.wi		_ships
+	__st.wmq	SL3  /* sp */
+.LL6:
+	__ld.wm		__do_ships_end - 2  /* i */
+	__ult_w.wi	5
+	__btrue		.LL8
+	__bra		.LL9
+.LL7:
+	__inc.wmq	__do_ships_end - 2  /* i */
+	__ld.wm		SL3  /* sp */
+	__add.wi	7
+	__st.wmq	SL3  /* sp */
+	__bra		.LL6
+.LL8:
+
+	.dbg	line,	"shmup.c", 69; if (!sp->active) {
+	__not.upf	SL3  /* sp */, 4
+	__bfalse	.LL10
+
+	.dbg	line,	"shmup.c", 70; sp->active = 1;
+	__ld.wi		1
+	__st.upfq	SL3  /* sp */, 4
+
+	.dbg	line,	"shmup.c", 71; sgx_spr_set(SHIP_SPRITE + i);
+	__ld.wi		11
+	__add.wm	__do_ships_end - 2  /* i */
+	__call		_sgx_spr_set.1
+
+	.dbg	line,	"shmup.c", 72; if (r & 1) {
+	__ld.um		__do_ships_end - 5  /* r */
+	__tand.wi	1
+	__bfalse	.LL11
+
+	.dbg	line,	"shmup.c", 73; sgx_spr_ctrl(FLIP_MAS|SIZE_MAS,FLIP_X|SZ_32x32);
+	__st.umiq	185, _al
+	__ld.uiq	25
+	__call		_sgx_spr_ctrl.2
+
+	.dbg	line,	"shmup.c", 74; sp->vx = SPEED_SHIP;
+	__ld.wi		1
+	__st.upfq	SL3  /* sp */, 5
+
+	.dbg	line,	"shmup.c", 75; sp->vy = 0;
+	__ld.wi		0
+	__st.upfq	SL3  /* sp */, 6
+
+	.dbg	line,	"shmup.c", 76; sp->x = -32;
+	__ld.wi		-32
+	__st.wpq	SL3  /* sp */
+
+	.dbg	line,	"shmup.c", 77; }
+
+	.dbg	line,	"shmup.c", 78; else {
+	__bra		.LL12
+.LL11:
+
+	.dbg	line,	"shmup.c", 79; sgx_spr_ctrl(FLIP_MAS|SIZE_MAS,NO_FLIP_X|SZ_32x32);
+	__st.umiq	185, _al
+	__ld.uiq	17
+	__call		_sgx_spr_ctrl.2
+
+	.dbg	line,	"shmup.c", 80; sp->vx = -SPEED_SHIP;
+	__ld.wi		-1
+	__st.upfq	SL3  /* sp */, 5
+
+	.dbg	line,	"shmup.c", 81; sp->vy = 0;
+	__ld.wi		0
+	__st.upfq	SL3  /* sp */, 6
+
+	.dbg	line,	"shmup.c", 82; sp->x = 256;
+	__ld.wi		256
+	__st.wpq	SL3  /* sp */
+
+	.dbg	line,	"shmup.c", 83; }
+.LL12:
+
+	.dbg	line,	"shmup.c", 84; sp->y = rand() % 210;
+	__call		_rand
+	__umod.wi	210
+	__st.wpfq	SL3  /* sp */, 2
+
+	.dbg	line,	"shmup.c", 85; break;
+	__bra		.LL9
+
+	.dbg	line,	"shmup.c", 86; }
+
+	.dbg	line,	"shmup.c", 87; }
+.LL10	.alias		.LL7
+	__bra		.LL7
+.LL9:
+
+	.dbg	line,	"shmup.c", 88; }
+
+	.dbg	line,	"shmup.c", 90; for (i = 0, sp = ships; i < MAX_SHIPS; ++i, ++sp) {
+.LL5:
+	__st.wmiq	0, __do_ships_end - 2  /* i */
+	__ld.wi		_ships
+	__st.wmq	SL3  /* sp */
+.LL13:
+	__ld.wm		__do_ships_end - 2  /* i */
+	__ult_w.wi	5
+	__btrue		.LL15
+	__bra		.LL16
+.LL14:
+	__inc.wmq	__do_ships_end - 2  /* i */
+	__ld.wm		SL3  /* sp */
+	__add.wi	7
+	__st.wmq	SL3  /* sp */
+	__bra		.LL13
+.LL15:
+
+	.dbg	line,	"shmup.c", 91; if (sp->active) {
+	__tst.upf	SL3  /* sp */, 4
+	__bfalse	.LL17
+
+	.dbg	line,	"shmup.c", 92; sgx_spr_set(SHIP_SPRITE + i);
+	__ld.wi		11
+	__add.wm	__do_ships_end - 2  /* i */
+	__call		_sgx_spr_set.1
+
+	.dbg	line,	"shmup.c", 93; sgx_spr_x(sp->x);
+	__ld.wp		SL3  /* sp */
+	__call		_sgx_spr_x.1
+
+	.dbg	line,	"shmup.c", 94; sgx_spr_y(sp->y);
+	__ld.wpf	SL3  /* sp */, 2
+	__call		_sgx_spr_y.1
+
+	.dbg	line,	"shmup.c", 95; if (sp->active > 1) {
+	__ld.upfq	SL3  /* sp */, 4
+	__ugt_b.uiq	1
+	__bfalse	.LL18
+
+	.dbg	line,	"shmup.c", 96; sgx_spr_pattern(0x5900 + (sp->active >> 3) * 0x100);
+	__ld.upf	SL3  /* sp */, 4
+	__lsr.uiq	3
+	__asl.wi	8
+	__add.wi	22784
+	__call		_sgx_spr_pattern.1
+
+	.dbg	line,	"shmup.c", 97; sgx_spr_pal(3);
+	__ld.uiq	3
+	__call		_sgx_spr_pal.1
+
+	.dbg	line,	"shmup.c", 98; sp->active++;
+	__ld.upf	SL3  /* sp */, 4
+	__add.wi	1
+	__st.upf	SL3  /* sp */, 4
+
+	.dbg	line,	"shmup.c", 99; if (sp->active == 64) {
+	__ld.upfq	SL3  /* sp */, 4
+	__equ_b.uiq	64
+	__bfalse	.LL19
+
+	.dbg	line,	"shmup.c", 100; sp->active = 0;
+	__ld.wi		0
+	__st.upfq	SL3  /* sp */, 4
+
+	.dbg	line,	"shmup.c", 101; sgx_spr_x(-32);
+	__ld.wi		-32
+	__call		_sgx_spr_x.1
+
+	.dbg	line,	"shmup.c", 102; sgx_spr_y(16);
+	__ld.wi		16
+	__call		_sgx_spr_y.1
+
+	.dbg	line,	"shmup.c", 103; sgx_spr_pal(2);
+	__ld.uiq	2
+	__call		_sgx_spr_pal.1
+
+	.dbg	line,	"shmup.c", 104; }
+
+	.dbg	line,	"shmup.c", 105; }
+.LL19	.alias		.LL20
+
+	.dbg	line,	"shmup.c", 106; else {
+	__bra		.LL20
+.LL18:
+
+	.dbg	line,	"shmup.c", 107; sgx_spr_pattern(0x5500 + (((frames >> 4) & 3) * 0x100));
+	__ld.wm		_frames
+	__lsr.wi	4
+	__and.wi	3
+	__asl.wi	8
+	__add.wi	21760
+	__call		_sgx_spr_pattern.1
+
+	.dbg	line,	"shmup.c", 108; for (j = 0, bp = bullets; j < MAX_BULLETS; ++j, ++bp) {
+	__st.wmiq	0, __do_ships_end - 4  /* j */
+	__ld.wi		_bullets
+	__st.wmq	SL4  /* bp */
+.LL21:
+	__ld.wm		__do_ships_end - 4  /* j */
+	__ult_w.wi	10
+	__btrue		.LL23
+	__bra		.LL24
+.LL22:
+	__inc.wmq	__do_ships_end - 4  /* j */
+	__ld.wm		SL4  /* bp */
+	__add.wi	5
+	__st.wmq	SL4  /* bp */
+	__bra		.LL21
+.LL23:
+
+	.dbg	line,	"shmup.c", 109; if (bp->active) {
+	__tst.upf	SL4  /* bp */, 4
+	__bfalse	.LL25
+
+	.dbg	line,	"shmup.c", 110; if (bp->x > sp->x - 4 &&
+	__ld.wp		SL3  /* sp */
+	__sub.wi	4
+	__slt_w.wp	SL4  /* bp */
+	__bfalse	.LL27
+
+	.dbg	line,	"shmup.c", 111; bp->x < sp->x + 20 &&
+	__ld.wp		SL3  /* sp */
+	__add.wi	20
+	__sgt_w.wp	SL4  /* bp */
+.LL27:
+	__bfalse	.LL28
+
+	.dbg	line,	"shmup.c", 112; bp->y > sp->y - 3 &&
+	__ld.wpf	SL3  /* sp */, 2
+	__sub.wi	3
+	__slt_w.wpf	SL4  /* bp */, 2
+.LL28:
+	__bfalse	.LL29
+
+	.dbg	line,	"shmup.c", 113; bp->y < sp->y + 16) {
+	__ld.wpf	SL3  /* sp */, 2
+	__add.wi	16
+	__sgt_w.wpf	SL4  /* bp */, 2
+.LL29:
+	__bfalse	.LL26
+
+	.dbg	line,	"shmup.c", 114; /* explosion */
+
+	.dbg	line,	"shmup.c", 115; sp->active = 2;
+	__ld.wi		2
+	__st.upfq	SL3  /* sp */, 4
+
+	.dbg	line,	"shmup.c", 116; sp->vx = 0;
+	__ld.wi		0
+	__st.upfq	SL3  /* sp */, 5
+
+	.dbg	line,	"shmup.c", 117; sp->vy = 0;
+	__ld.wi		0
+	__st.upfq	SL3  /* sp */, 6
+
+	.dbg	line,	"shmup.c", 118; bp->active = 0;
+	__ld.wi		0
+	__st.upfq	SL4  /* bp */, 4
+
+	.dbg	line,	"shmup.c", 119; sgx_spr_set(BULLET_SPRITE + j);
+	__ld.wi		1
+	__add.wm	__do_ships_end - 4  /* j */
+	__call		_sgx_spr_set.1
+
+	.dbg	line,	"shmup.c", 120; sgx_spr_x(-16);
+	__ld.wi		-16
+	__call		_sgx_spr_x.1
+
+	.dbg	line,	"shmup.c", 121; sgx_spr_y(0);
+	__ld.wi		0
+	__call		_sgx_spr_y.1
+
+	.dbg	line,	"shmup.c", 122; score += SCORE_SHIP;
+	__add_st.wmiq	100, _score
+
+	.dbg	line,	"shmup.c", 123; }
+
+	.dbg	line,	"shmup.c", 124; }
+.LL26	.alias		.LL22
+
+	.dbg	line,	"shmup.c", 125; }
+.LL25	.alias		.LL22
+	__bra		.LL22
+.LL24:
+
+	.dbg	line,	"shmup.c", 126; }
+.LL20:
+
+	.dbg	line,	"shmup.c", 127; sp->x += sp->vx;
+	__ld.wp		SL3  /* sp */
+	__add.upf	SL3  /* sp */, 5
+	__st.wpq	SL3  /* sp */
+
+	.dbg	line,	"shmup.c", 128; sp->y += sp->vy;
+	__ld.wpf	SL3  /* sp */, 2
+	__add.upf	SL3  /* sp */, 6
+	__st.wpfq	SL3  /* sp */, 2
+
+	.dbg	line,	"shmup.c", 129; if (sp->x > 256 || sp->x < -32) {
+	__ld.wp		SL3  /* sp */
+	__sgt_w.wi	256
+	__btrue		.LL31
+	__ld.wp		SL3  /* sp */
+	__slt_w.wi	-32
+.LL31:
+	__bfalse	.LL30
+
+	.dbg	line,	"shmup.c", 130; sp->active = 0;
+	__ld.wi		0
+	__st.upfq	SL3  /* sp */, 4
+
+	.dbg	line,	"shmup.c", 131; sgx_spr_x(-32);
+	__ld.wi		-32
+	__call		_sgx_spr_x.1
+
+	.dbg	line,	"shmup.c", 132; sgx_spr_y(16);
+	__ld.wi		16
+	__call		_sgx_spr_y.1
+
+	.dbg	line,	"shmup.c", 133; }
+
+	.dbg	line,	"shmup.c", 134; }
+.LL30	.alias		.LL14
+
+	.dbg	line,	"shmup.c", 135; }
+.LL17	.alias		.LL14
+	__bra		.LL14
+.LL16:
+
+	.dbg	line,	"shmup.c", 136; #ifdef DEBUG
+
+	.dbg	line,	"shmup.c", 137; for (i = 0, sp = ships; i < MAX_SHIPS; ++i, ++sp) {
+
+	.dbg	line,	"shmup.c", 138; if (sp->active) {
+
+	.dbg	line,	"shmup.c", 139; put_number(sp->x, 4, 1, 4+i);
+
+	.dbg	line,	"shmup.c", 140; put_number(sp->y, 4, 5, 4+i);
+
+	.dbg	line,	"shmup.c", 141; }
+
+	.dbg	line,	"shmup.c", 142; }
+
+	.dbg	line,	"shmup.c", 143; #endif
+
+	.dbg	line,	"shmup.c", 144; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__do_ships_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"shmup.c", 146; void main(void)
+	.dbg	line,	"shmup.c", 147; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"shmup.c", 148; unsigned int j1;
+
+	.dbg	line,	"shmup.c", 149; int bonkx, bonky;
+
+	.dbg	line,	"shmup.c", 150; unsigned int tic;
+
+	.dbg	line,	"shmup.c", 151; unsigned char i, j;
+
+	.dbg	line,	"shmup.c", 152; unsigned char bullet_wait;
+
+	.dbg	line,	"shmup.c", 153; signed char bonk_dir;
+
+	.dbg	line,	"shmup.c", 154; char r;
+
+	.dbg	line,	"shmup.c", 155; unsigned char dead;
+
+	.dbg	line,	"shmup.c", 157; hiscore = 0;
+	__st.wmiq	0, _hiscore
+
+	.dbg	line,	"shmup.c", 159; /* no goto yet, so we have to use this instead */
+
+	.dbg	line,	"shmup.c", 160; for (;;) {
+.LL33:
+.LL34:
+.LL35:
+
+	.dbg	line,	"shmup.c", 162; tic = 0;
+	__st.wmiq	0, __main_end - 8  /* tic */
+
+	.dbg	line,	"shmup.c", 163; frames = 0;
+	__st.wmiq	0, _frames
+
+	.dbg	line,	"shmup.c", 164; score = 0;
+	__st.wmiq	0, _score
+
+	.dbg	line,	"shmup.c", 165; dead = 0;
+	__st.umiq	0, __main_end - 14  /* dead */
+
+	.dbg	line,	"shmup.c", 166; bonkx = 104;
+	__st.wmiq	104, __main_end - 4  /* bonkx */
+
+	.dbg	line,	"shmup.c", 167; bonky = 153;
+	__st.wmiq	153, __main_end - 6  /* bonky */
+
+	.dbg	line,	"shmup.c", 168; bullet_wait = 0;
+	__st.umiq	0, __main_end - 11  /* bullet_wait */
+
+	.dbg	line,	"shmup.c", 169; bonk_dir = 1;
+	__st.umiq	1, __main_end - 12  /* bonk_dir */
+
+	.dbg	line,	"shmup.c", 171; sgx_init_satb();
+	__call		_sgx_init_satb
+
+	.dbg	line,	"shmup.c", 172; sgx_spr_set(0);
+	__ld.uiq	0
+	__call		_sgx_spr_set.1
+
+	.dbg	line,	"shmup.c", 173; sgx_spr_x(bonkx);
+	__ld.wm		__main_end - 4  /* bonkx */
+	__call		_sgx_spr_x.1
+
+	.dbg	line,	"shmup.c", 174; sgx_spr_y(bonky);
+	__ld.wm		__main_end - 6  /* bonky */
+	__call		_sgx_spr_y.1
+
+	.dbg	line,	"shmup.c", 175; sgx_spr_pattern(0x5000);
+	__ld.wi		20480
+	__call		_sgx_spr_pattern.1
+
+	.dbg	line,	"shmup.c", 176; sgx_spr_ctrl(FLIP_MAS|SIZE_MAS,FLIP_X|SZ_32x32);
+	__st.umiq	185, _al
+	__ld.uiq	25
+	__call		_sgx_spr_ctrl.2
+
+	.dbg	line,	"shmup.c", 177; sgx_spr_pal(0);
+	__ld.uiq	0
+	__call		_sgx_spr_pal.1
+
+	.dbg	line,	"shmup.c", 178; sgx_spr_pri(1);
+	__ld.uiq	1
+	__call		_sgx_spr_pri.1
+
+	.dbg	line,	"shmup.c", 180; for (i = 0; i < MAX_BULLETS; i++) {
+	__st.umiq	0, __main_end - 9  /* i */
+.LL37:
+	__ld.umq	__main_end - 9  /* i */
+	__ult_b.uiq	10
+	__btrue		.LL39
+	__bra		.LL40
+.LL38:
+	__inc.umq	__main_end - 9  /* i */
+	__bra		.LL37
+.LL39:
+
+	.dbg	line,	"shmup.c", 181; sgx_spr_set(BULLET_SPRITE + i);
+	__ld.wi		1
+	__add.um	__main_end - 9  /* i */
+	__call		_sgx_spr_set.1
+
+	.dbg	line,	"shmup.c", 182; sgx_spr_x(-16);
+	__ld.wi		-16
+	__call		_sgx_spr_x.1
+
+	.dbg	line,	"shmup.c", 183; sgx_spr_y(0);
+	__ld.wi		0
+	__call		_sgx_spr_y.1
+
+	.dbg	line,	"shmup.c", 184; sgx_spr_pattern(0x5400);
+	__ld.wi		21504
+	__call		_sgx_spr_pattern.1
+
+	.dbg	line,	"shmup.c", 185; sgx_spr_ctrl(FLIP_MAS|SIZE_MAS,NO_FLIP|SZ_16x16);
+	__st.umiq	185, _al
+	__ld.uiq	0
+	__call		_sgx_spr_ctrl.2
+
+	.dbg	line,	"shmup.c", 186; sgx_spr_pal(1);
+	__ld.uiq	1
+	__call		_sgx_spr_pal.1
+
+	.dbg	line,	"shmup.c", 187; sgx_spr_pri(1);
+	__ld.uiq	1
+	__call		_sgx_spr_pri.1
+
+	.dbg	line,	"shmup.c", 188; bullets[i].active = 0;
+	__ld.umq	__main_end - 9  /* i */
+	__mul.uiq	5
+	__index.ur	_bullets + 4
+	__st.uatiq	0, _bullets + 4
+
+	.dbg	line,	"shmup.c", 189; }
+	__bra		.LL38
+.LL40:
+
+	.dbg	line,	"shmup.c", 191; for (i = 0; i < MAX_SHIPS; i++) {
+	__st.umiq	0, __main_end - 9  /* i */
+.LL41:
+	__ld.umq	__main_end - 9  /* i */
+	__ult_b.uiq	5
+	__btrue		.LL43
+	__bra		.LL44
+.LL42:
+	__inc.umq	__main_end - 9  /* i */
+	__bra		.LL41
+.LL43:
+
+	.dbg	line,	"shmup.c", 192; sgx_spr_set(SHIP_SPRITE + i);
+	__ld.wi		11
+	__add.um	__main_end - 9  /* i */
+	__call		_sgx_spr_set.1
+
+	.dbg	line,	"shmup.c", 193; sgx_spr_x(-32);
+	__ld.wi		-32
+	__call		_sgx_spr_x.1
+
+	.dbg	line,	"shmup.c", 194; sgx_spr_y(16);
+	__ld.wi		16
+	__call		_sgx_spr_y.1
+
+	.dbg	line,	"shmup.c", 195; sgx_spr_pattern(0x5500);
+	__ld.wi		21760
+	__call		_sgx_spr_pattern.1
+
+	.dbg	line,	"shmup.c", 196; sgx_spr_ctrl(FLIP_MAS|SIZE_MAS,NO_FLIP|SZ_32x32);
+	__st.umiq	185, _al
+	__ld.uiq	17
+	__call		_sgx_spr_ctrl.2
+
+	.dbg	line,	"shmup.c", 197; sgx_spr_pal(2);
+	__ld.uiq	2
+	__call		_sgx_spr_pal.1
+
+	.dbg	line,	"shmup.c", 198; sgx_spr_pri(1);
+	__ld.uiq	1
+	__call		_sgx_spr_pri.1
+
+	.dbg	line,	"shmup.c", 199; ships[i].active = 0;
+	__ld.umq	__main_end - 9  /* i */
+	__mul.uiq	7
+	__index.ur	_ships + 4
+	__st.uatiq	0, _ships + 4
+
+	.dbg	line,	"shmup.c", 200; }
+	__bra		.LL42
+.LL44:
+
+	.dbg	line,	"shmup.c", 201; load_palette(16,bonkpal,1);
+	__st.umiq	16, _al
+	__farptr	_bonkpal, _bp_bank, _bp
+	__st.umiq	1, _ah
+	__call		_load_palette.3
+
+	.dbg	line,	"shmup.c", 202; load_palette(17,bulletpal,1);
+	__st.umiq	17, _al
+	__farptr	_bulletpal, _bp_bank, _bp
+	__st.umiq	1, _ah
+	__call		_load_palette.3
+
+	.dbg	line,	"shmup.c", 203; load_palette(18,shippal,1);
+	__st.umiq	18, _al
+	__farptr	_shippal, _bp_bank, _bp
+	__st.umiq	1, _ah
+	__call		_load_palette.3
+
+	.dbg	line,	"shmup.c", 204; load_palette(19,explosionpal,1);
+	__st.umiq	19, _al
+	__farptr	_explosionpal, _bp_bank, _bp
+	__st.umiq	1, _ah
+	__call		_load_palette.3
+
+	.dbg	line,	"shmup.c", 206; // you can either load vram using the label
+
+	.dbg	line,	"shmup.c", 207; sgx_load_vram(0x5000,bonk,0x400);
+	__st.wmiq	20480, _di
+	__farptr	_bonk, _bp_bank, _bp
+	__st.wmiq	1024, _ax
+	 _sgx_load_vram.3
+
+	.dbg	line,	"shmup.c", 209; // or by using using the bank and address
+
+	.dbg	line,	"shmup.c", 210; set_far_base(aSpriteDataBank[0],aSpriteDataAddr[0]);
+	__ld.um		_aSpriteDataBank
+	__st.umq	_bp_bank
+	__ld.wm		_aSpriteDataAddr
+	__st.wmq	_bp
+
+	.dbg	line,	"shmup.c", 211; sgx_far_load_vram(0x5000,0x400);
+	__st.wmiq	20480, _di
+	__st.wmiq	1024, _ax
+	 _sgx_far_load_vram.2
+
+	.dbg	line,	"shmup.c", 213; // or by using using the bank and address with an offset
+
+	.dbg	line,	"shmup.c", 214; set_far_offset(0,aSpriteDataBank[0],aSpriteDataAddr[0]);
+	__st.wmiq	0, _bp
+	__ld.um		_aSpriteDataBank
+	__st.umq	_bp_bank
+	__ld.wm		_aSpriteDataAddr
+	__call		_set_far_offset.3
+
+	.dbg	line,	"shmup.c", 215; sgx_far_load_vram(0x5000,0x400);
+	__st.wmiq	20480, _di
+	__st.wmiq	1024, _ax
+	 _sgx_far_load_vram.2
+
+	.dbg	line,	"shmup.c", 217; sgx_load_vram(0x5400,bullet,0x40);
+	__st.wmiq	21504, _di
+	__farptr	_bullet, _bp_bank, _bp
+	__st.wmiq	64, _ax
+	 _sgx_load_vram.3
+
+	.dbg	line,	"shmup.c", 218; sgx_load_vram(0x5500,ship,0x400);
+	__st.wmiq	21760, _di
+	__farptr	_ship, _bp_bank, _bp
+	__st.wmiq	1024, _ax
+	 _sgx_load_vram.3
+
+	.dbg	line,	"shmup.c", 219; sgx_load_vram(0x5900,explosion,0x800);
+	__st.wmiq	22784, _di
+	__farptr	_explosion, _bp_bank, _bp
+	__st.wmiq	2048, _ax
+	 _sgx_load_vram.3
+
+	.dbg	line,	"shmup.c", 221; sgx_satb_update();
+	__call		_sgx_satb_update
+
+	.dbg	line,	"shmup.c", 223; load_background(scene_chr,scene_pal,scene_bat,32,28);
+	__farptr	_scene_chr, _bp_bank, _bp
+	__farptr	_scene_pal, __fbank, __fptr
+	__farptr	_scene_bat, _cl, _bx
+	__st.umiq	32, _dl
+	__st.umiq	28, _dh
+	__call		_load_background.5
+
+	.dbg	line,	"shmup.c", 225; set_font_color(15, 6);
+	__st.umiq	15, monofont_fg
+	__st.umiq	6, monofont_bg
+
+	.dbg	line,	"shmup.c", 226; load_default_font();
+	 _load_default_font
+
+	.dbg	line,	"shmup.c", 228; while(!dead)
+.LL45:
+	__not.um	__main_end - 14  /* dead */
+	__bfalse	.LL46
+
+	.dbg	line,	"shmup.c", 229; {
+
+	.dbg	line,	"shmup.c", 230; vsync();
+	__call		_vsync
+
+	.dbg	line,	"shmup.c", 231; j1 = joy(0);
+	__ld.uiq	0
+	 _joy.1
+	__st.wmq	__main_end - 2  /* j1 */
+
+	.dbg	line,	"shmup.c", 232; if (joytrg(0) & JOY_RUN) {
+	__ld.uiq	0
+	 _joytrg.1
+	__tand.wi	8
+	__bfalse	.LL47
+
+	.dbg	line,	"shmup.c", 233; vsync();
+	__call		_vsync
+
+	.dbg	line,	"shmup.c", 234; while (!(joytrg(0) & JOY_RUN))
+.LL48:
+	__ld.uiq	0
+	 _joytrg.1
+	__nand.wi	8
+	__bfalse	.LL49
+
+	.dbg	line,	"shmup.c", 235; vsync();
+	__call		_vsync
+	__bra		.LL48
+.LL49:
+
+	.dbg	line,	"shmup.c", 236; }
+
+	.dbg	line,	"shmup.c", 237; if (j1 & JOY_LEFT)
+.LL47:
+	__ld.wm		__main_end - 2  /* j1 */
+	__tand.wi	128
+	__bfalse	.LL50
+
+	.dbg	line,	"shmup.c", 238; {
+
+	.dbg	line,	"shmup.c", 239; sgx_spr_ctrl(FLIP_X_MASK,NO_FLIP_X);
+	__st.umiq	8, _al
+	__ld.uiq	0
+	__call		_sgx_spr_ctrl.2
+
+	.dbg	line,	"shmup.c", 240; if (bonkx > -8) bonkx -= SPEED_X;
+	__ld.wm		__main_end - 4  /* bonkx */
+	__sgt_w.wi	-8
+	__bfalse	.LL51
+	__sub_st.wmiq	2, __main_end - 4  /* bonkx */
+
+	.dbg	line,	"shmup.c", 241; tic++;
+.LL51:
+	__inc.wmq	__main_end - 8  /* tic */
+
+	.dbg	line,	"shmup.c", 242; bonk_dir = -1;
+	__st.umiq	-1, __main_end - 12  /* bonk_dir */
+
+	.dbg	line,	"shmup.c", 243; }
+
+	.dbg	line,	"shmup.c", 244; if (j1 & JOY_RIGHT)
+.LL50:
+	__ld.wm		__main_end - 2  /* j1 */
+	__tand.wi	32
+	__bfalse	.LL52
+
+	.dbg	line,	"shmup.c", 245; {
+
+	.dbg	line,	"shmup.c", 246; sgx_spr_ctrl(FLIP_X_MASK,FLIP_X);
+	__st.umiq	8, _al
+	__ld.uiq	8
+	__call		_sgx_spr_ctrl.2
+
+	.dbg	line,	"shmup.c", 247; if (bonkx < 232) bonkx += SPEED_X;
+	__ld.wm		__main_end - 4  /* bonkx */
+	__slt_w.wi	232
+	__bfalse	.LL53
+	__add_st.wmiq	2, __main_end - 4  /* bonkx */
+
+	.dbg	line,	"shmup.c", 248; tic++;
+.LL53:
+	__inc.wmq	__main_end - 8  /* tic */
+
+	.dbg	line,	"shmup.c", 249; bonk_dir = 1;
+	__st.umiq	1, __main_end - 12  /* bonk_dir */
+
+	.dbg	line,	"shmup.c", 250; }
+
+	.dbg	line,	"shmup.c", 251; if (j1 & JOY_UP)
+.LL52:
+	__ld.wm		__main_end - 2  /* j1 */
+	__tand.wi	16
+	__bfalse	.LL54
+
+	.dbg	line,	"shmup.c", 252; {
+
+	.dbg	line,	"shmup.c", 253; if (bonky > -8) bonky -= SPEED_Y;
+	__ld.wm		__main_end - 6  /* bonky */
+	__sgt_w.wi	-8
+	__bfalse	.LL55
+	__sub_st.wmiq	2, __main_end - 6  /* bonky */
+
+	.dbg	line,	"shmup.c", 254; }
+.LL55:
+
+	.dbg	line,	"shmup.c", 255; if (j1 & JOY_DOWN)
+.LL54:
+	__ld.wm		__main_end - 2  /* j1 */
+	__tand.wi	64
+	__bfalse	.LL56
+
+	.dbg	line,	"shmup.c", 256; {
+
+	.dbg	line,	"shmup.c", 257; if (bonky < 212) bonky += SPEED_Y;
+	__ld.wm		__main_end - 6  /* bonky */
+	__slt_w.wi	212
+	__bfalse	.LL57
+	__add_st.wmiq	2, __main_end - 6  /* bonky */
+
+	.dbg	line,	"shmup.c", 258; }
+.LL57:
+
+	.dbg	line,	"shmup.c", 259; if ((j1 & JOY_II) && !bullet_wait) {
+.LL56:
+	__ld.wm		__main_end - 2  /* j1 */
+	__tand.wi	2
+	__bfalse	.LL59
+	__not.um	__main_end - 11  /* bullet_wait */
+.LL59:
+	__bfalse	.LL58
+
+	.dbg	line,	"shmup.c", 260; for (pshot = bullets, i = 0; i < MAX_BULLETS; ++i, ++pshot) {
+	__ld.wi		_bullets
+	__st.wmq	_pshot
+	__st.umiq	0, __main_end - 9  /* i */
+.LL60:
+	__ld.umq	__main_end - 9  /* i */
+	__ult_b.uiq	10
+	__btrue		.LL62
+	__bra		.LL63
+.LL61:
+	__inc.umq	__main_end - 9  /* i */
+	__ld.wm		_pshot
+	__add.wi	5
+	__st.wmq	_pshot
+	__bra		.LL60
+.LL62:
+
+	.dbg	line,	"shmup.c", 261; if (!pshot->active) {
+	__not.upf	_pshot, 4
+	__bfalse	.LL64
+
+	.dbg	line,	"shmup.c", 262; pshot->active = bonk_dir;
+	__ld.bm		__main_end - 12  /* bonk_dir */
+	__st.upfq	_pshot, 4
+
+	.dbg	line,	"shmup.c", 263; pshot->x = bonkx + 8 + bonk_dir * 16;
+	__ld.wm		__main_end - 4  /* bonkx */
+	__add.wi	8
+	__push.wr
+	__ld.bm		__main_end - 12  /* bonk_dir */
+	__asl.wi	4
+	__add.wt
+	__st.wpq	_pshot
+
+	.dbg	line,	"shmup.c", 264; pshot->y = bonky + 10;
+	__ld.wm		__main_end - 6  /* bonky */
+	__add.wi	10
+	__st.wpfq	_pshot, 2
+
+	.dbg	line,	"shmup.c", 265; bullet_wait = 10;
+	__st.umiq	10, __main_end - 11  /* bullet_wait */
+
+	.dbg	line,	"shmup.c", 266; sgx_spr_set(BULLET_SPRITE + i);
+	__ld.wi		1
+	__add.um	__main_end - 9  /* i */
+	__call		_sgx_spr_set.1
+
+	.dbg	line,	"shmup.c", 267; if (bonk_dir > 0)
+	__ld.bm		__main_end - 12  /* bonk_dir */
+	__sgt_w.wi	0
+	__bfalse	.LL65
+
+	.dbg	line,	"shmup.c", 268; sgx_spr_ctrl(FLIP_X_MASK, FLIP_X);
+	__st.umiq	8, _al
+	__ld.uiq	8
+	__call		_sgx_spr_ctrl.2
+
+	.dbg	line,	"shmup.c", 269; else
+	__bra		.LL66
+.LL65:
+
+	.dbg	line,	"shmup.c", 270; sgx_spr_ctrl(FLIP_X_MASK, NO_FLIP_X);
+	__st.umiq	8, _al
+	__ld.uiq	0
+	__call		_sgx_spr_ctrl.2
+.LL66	.alias		.LL63
+
+	.dbg	line,	"shmup.c", 271; break;
+	__bra		.LL63
+
+	.dbg	line,	"shmup.c", 272; }
+
+	.dbg	line,	"shmup.c", 273; }
+.LL64	.alias		.LL61
+	__bra		.LL61
+.LL63:
+
+	.dbg	line,	"shmup.c", 274; }
+
+	.dbg	line,	"shmup.c", 276; if (bullet_wait)
+.LL58:
+	__tst.um	__main_end - 11  /* bullet_wait */
+	__bfalse	.LL67
+
+	.dbg	line,	"shmup.c", 277; bullet_wait--;
+	__dec.umq	__main_end - 11  /* bullet_wait */
+
+	.dbg	line,	"shmup.c", 279; pshot = bullets;
+.LL67:
+	__ld.wi		_bullets
+	__st.wmq	_pshot
+
+	.dbg	line,	"shmup.c", 280; for (i = 0; i < MAX_BULLETS; i++) {
+	__st.umiq	0, __main_end - 9  /* i */
+.LL68:
+	__ld.umq	__main_end - 9  /* i */
+	__ult_b.uiq	10
+	__btrue		.LL70
+	__bra		.LL71
+.LL69:
+	__inc.umq	__main_end - 9  /* i */
+	__bra		.LL68
+.LL70:
+
+	.dbg	line,	"shmup.c", 281; if (pshot->active) {
+	__tst.upf	_pshot, 4
+	__bfalse	.LL72
+
+	.dbg	line,	"shmup.c", 282; sgx_spr_set(BULLET_SPRITE + i);
+	__ld.wi		1
+	__add.um	__main_end - 9  /* i */
+	__call		_sgx_spr_set.1
+
+	.dbg	line,	"shmup.c", 283; sgx_spr_x(pshot->x);
+	__ld.wp		_pshot
+	__call		_sgx_spr_x.1
+
+	.dbg	line,	"shmup.c", 284; sgx_spr_y(pshot->y);
+	__ld.wpf	_pshot, 2
+	__call		_sgx_spr_y.1
+
+	.dbg	line,	"shmup.c", 285; pshot->x += pshot->active * SPEED_BULLET;
+	__ld.bpf	_pshot, 4
+	__asl.wi	2
+	__add_st.wpq	_pshot
+
+	.dbg	line,	"shmup.c", 286; //put_number(pshot->x, 4, 0, 0);
+
+	.dbg	line,	"shmup.c", 287; if (pshot->x > 256 || pshot->x < -16) {
+	__ld.wp		_pshot
+	__sgt_w.wi	256
+	__btrue		.LL74
+	__ld.wp		_pshot
+	__slt_w.wi	-16
+.LL74:
+	__bfalse	.LL73
+
+	.dbg	line,	"shmup.c", 288; pshot->active = 0;
+	__ld.wi		0
+	__st.upfq	_pshot, 4
+
+	.dbg	line,	"shmup.c", 289; sgx_spr_x(-16);
+	__ld.wi		-16
+	__call		_sgx_spr_x.1
+
+	.dbg	line,	"shmup.c", 290; sgx_spr_y(0);
+	__ld.wi		0
+	__call		_sgx_spr_y.1
+
+	.dbg	line,	"shmup.c", 291; }
+
+	.dbg	line,	"shmup.c", 292; }
+.LL73:
+
+	.dbg	line,	"shmup.c", 293; ++pshot;
+.LL72:
+	__ld.wm		_pshot
+	__add.wi	5
+	__st.wmq	_pshot
+
+	.dbg	line,	"shmup.c", 294; }
+	__bra		.LL69
+.LL71:
+
+	.dbg	line,	"shmup.c", 296; do_ships();
+	__call		_do_ships
+
+	.dbg	line,	"shmup.c", 298; pship = ships;
+	__ld.wi		_ships
+	__st.wmq	_pship
+
+	.dbg	line,	"shmup.c", 299; for (i = 0; i < MAX_SHIPS; i++) {
+	__st.umiq	0, __main_end - 9  /* i */
+.LL75:
+	__ld.umq	__main_end - 9  /* i */
+	__ult_b.uiq	5
+	__btrue		.LL77
+	__bra		.LL78
+.LL76:
+	__inc.umq	__main_end - 9  /* i */
+	__bra		.LL75
+.LL77:
+
+	.dbg	line,	"shmup.c", 300; if (pship->active == 1 &&
+	__ld.upfq	_pship, 4
+	__equ_b.uiq	1
+	__bfalse	.LL80
+
+	.dbg	line,	"shmup.c", 301; ((pship->x > bonkx - 24 &&
+	__ld.wm		__main_end - 4  /* bonkx */
+	__sub.wi	24
+	__slt_w.wp	_pship
+	__bfalse	.LL81
+
+	.dbg	line,	"shmup.c", 302; pship->x < bonkx + 24 &&
+	__ld.wm		__main_end - 4  /* bonkx */
+	__add.wi	24
+	__sgt_w.wp	_pship
+.LL81:
+	__bfalse	.LL82
+
+	.dbg	line,	"shmup.c", 303; pship->y > bonky - 20 &&
+	__ld.wm		__main_end - 6  /* bonky */
+	__sub.wi	20
+	__slt_w.wpf	_pship, 2
+.LL82:
+	__bfalse	.LL83
+
+	.dbg	line,	"shmup.c", 304; pship->y < bonky + 9) ||
+	__ld.wm		__main_end - 6  /* bonky */
+	__add.wi	9
+	__sgt_w.wpf	_pship, 2
+.LL83:
+	__btrue		.LL84
+
+	.dbg	line,	"shmup.c", 305; (pship->x > bonkx - 18 &&
+	__ld.wm		__main_end - 4  /* bonkx */
+	__sub.wi	18
+	__slt_w.wp	_pship
+	__bfalse	.LL85
+
+	.dbg	line,	"shmup.c", 306; pship->x < bonkx + 18 &&
+	__ld.wm		__main_end - 4  /* bonkx */
+	__add.wi	18
+	__sgt_w.wp	_pship
+.LL85:
+	__bfalse	.LL86
+
+	.dbg	line,	"shmup.c", 307; pship->y > bonky + 8 &&
+	__ld.wm		__main_end - 6  /* bonky */
+	__add.wi	8
+	__slt_w.wpf	_pship, 2
+.LL86:
+	__bfalse	.LL87
+
+	.dbg	line,	"shmup.c", 308; pship->y < bonky + 25))) {
+	__ld.wm		__main_end - 6  /* bonky */
+	__add.wi	25
+	__sgt_w.wpf	_pship, 2
+.LL87:
+.LL84:
+.LL80:
+	__bfalse	.LL79
+
+	.dbg	line,	"shmup.c", 309; put_string("GAME OVER", 11, 12);
+	__ld.wi		__const1+0
+	__st.wmq	_bp
+	__st.umiq	11, _dil
+	__st.umiq	12, _dih
+	__call		_put_string.3
+
+	.dbg	line,	"shmup.c", 310; for (j = 0; j < 100; j++)
+	__st.umiq	0, __main_end - 10  /* j */
+.LL88:
+	__ld.umq	__main_end - 10  /* j */
+	__ult_b.uiq	100
+	__btrue		.LL90
+	__bra		.LL91
+.LL89:
+	__inc.umq	__main_end - 10  /* j */
+	__bra		.LL88
+.LL90:
+
+	.dbg	line,	"shmup.c", 311; vsync();
+	__call		_vsync
+	__bra		.LL89
+.LL91:
+
+	.dbg	line,	"shmup.c", 312; dead = 1;
+	__st.umiq	1, __main_end - 14  /* dead */
+
+	.dbg	line,	"shmup.c", 313; if (score > hiscore)
+	__ld.wm		_score
+	__ugt_w.wm	_hiscore
+	__bfalse	.LL92
+
+	.dbg	line,	"shmup.c", 314; hiscore = score;
+	__ld.wm		_score
+	__st.wmq	_hiscore
+
+	.dbg	line,	"shmup.c", 315; }
+.LL92:
+
+	.dbg	line,	"shmup.c", 316; pship++;
+.LL79:
+	__ld.wm		_pship
+	__add.wi	7
+	__st.wm		_pship
+
+	.dbg	line,	"shmup.c", 317; }
+	__bra		.LL76
+.LL78:
+
+	.dbg	line,	"shmup.c", 318; sgx_spr_set(0);
+	__ld.uiq	0
+	__call		_sgx_spr_set.1
+
+	.dbg	line,	"shmup.c", 319; sgx_spr_x(bonkx);
+	__ld.wm		__main_end - 4  /* bonkx */
+	__call		_sgx_spr_x.1
+
+	.dbg	line,	"shmup.c", 320; //put_number(bonkx, 4, 0, 1);
+
+	.dbg	line,	"shmup.c", 321; sgx_spr_y(bonky);
+	__ld.wm		__main_end - 6  /* bonky */
+	__call		_sgx_spr_y.1
+
+	.dbg	line,	"shmup.c", 322; sgx_spr_pattern(0x5000 + (((tic >> 2) & 3) * 0x100));
+	__ld.wm		__main_end - 8  /* tic */
+	__lsr.wi	2
+	__and.wi	3
+	__asl.wi	8
+	__add.wi	20480
+	__call		_sgx_spr_pattern.1
+
+	.dbg	line,	"shmup.c", 323; sgx_satb_update();
+	__call		_sgx_satb_update
+
+	.dbg	line,	"shmup.c", 324; put_number(score, 5, 26, 1);
+	__ld.wm		_score
+	__st.wmq	_bx
+	__st.umiq	5, _cl
+	__st.umiq	26, _dil
+	__st.umiq	1, _dih
+	__call		_put_number.4
+
+	.dbg	line,	"shmup.c", 325; put_string("HI", 1, 1);
+	__ld.wi		__const1+10
+	__st.wmq	_bp
+	__st.umiq	1, _dil
+	__st.umiq	1, _dih
+	__call		_put_string.3
+
+	.dbg	line,	"shmup.c", 326; put_number(hiscore, 5, 4, 1);
+	__ld.wm		_hiscore
+	__st.wmq	_bx
+	__st.umiq	5, _cl
+	__st.umiq	4, _dil
+	__st.umiq	1, _dih
+	__call		_put_number.4
+
+	.dbg	line,	"shmup.c", 327; frames++;
+	__inc.wmq	_frames
+
+	.dbg	line,	"shmup.c", 328; }
+	__bra		.LL45
+.LL46	.alias		.LL35
+
+	.dbg	line,	"shmup.c", 329; }
+	__bra		.LL35
+.LL36:
+
+	.dbg	line,	"shmup.c", 330; }
+.LL32:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+		ds	14
+__main_end:
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'G','A','M','E',' ','O','V','E'
+		db	'R',$00,'H','I',$00
+_aSpriteDataAddr:
+		dw	_bonk
+		dw	_bullet
+		dw	_ship
+		dw	_explosion
+_aSpriteDataBank:
+		db	^_bonk
+		db	^_bullet
+		db	^_ship
+		db	^_explosion
+
+	.zp
+_score:
+		ds	2
+_hiscore:
+		ds	2
+_pship:
+		ds	2
+_pshot:
+		ds	2
+SL3:
+		ds	2
+SL4:
+		ds	2
+
+	.bss
+_bullets:
+		ds	50
+_ships:
+		ds	35
+_frames:
+		ds	2
+
+	.code
+	.if		leaf_needs < 5
+leaf_needs	.set	5
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:13
+;	constant pool:12
+;	global pool:256
+;	Macro pool:123
@@ -520,6 +520,32 @@ __switch_r.ur	.macro
 ;		dw	jmp4		; +67 x=(\2 - \1)
 ;		dw	jmpdefault	; +89 x=(\2 - \1)+1
 
+; **************
+; Y:A is the value to check for.
+; \1 is the case value that splits the tree (unsigned compare)
+; \2 is the label of the subtree for values >= \1
+
+__switch_t.wr	.macro
+		cpy.h	#\1
+		bne	!+
+		cmp.l	#\1
+!:		bcc	!+
+		jmp	\2
+!:
+		.endm
+
+; **************
+; A is the value to check for.
+; \1 is the case value that splits the tree (unsigned compare)
+; \2 is the label of the subtree for values >= \1
+
+__switch_t.ur	.macro
+		cmp	#\1
+		bcc	!+
+		jmp	\2
+!:
+		.endm
+
 ; **************
 ; the start of a "default" statement
 
@@ -3922,6 +3948,20 @@ __ldy.umq	.macro
 		ldy	\1
 		.endm
 
+; **************
+; copy the byte in the primary register to X, when X is known to need it
+
+__tax		.macro
+		tax
+		.endm
+
+; **************
+; copy the byte in X to the primary register, when X is known to hold it
+
+__txa		.macro
+		txa
+		.endm
+
 ; **************
 
 __ld.wp		.macro
@@ -5552,6 +5592,128 @@ __st.usq	.macro	; __STACK
 
 
 
+; ***************************************************************************
+; ***************************************************************************
+; i-codes for copying memory
+; ***************************************************************************
+; ***************************************************************************
+
+; **************
+; Copy a struct from the address in the primary register to the address on
+; the hardware stack, and leave the destination in the primary register.
+
+__copy.wt	.macro	; __STACK
+		sta.l	ram_tii_src
+		sty.h	ram_tii_src
+		pla
+		sta.l	ram_tii_dst
+		ply
+		sty.h	ram_tii_dst
+		phy
+		pha
+		lda.l	#\1
+		sta.l	<__temp
+		lda.h	#\1
+		sta.h	<__temp
+		call	__copy_mem
+		pla
+		ply
+		.endm
+
+; **************
+
+__copy.wtq	.macro	; __STACK
+		sta.l	ram_tii_src
+		sty.h	ram_tii_src
+		pla
+		sta.l	ram_tii_dst
+		pla
+		sta.h	ram_tii_dst
+		lda.l	#\1
+		sta.l	<__temp
+		lda.h	#\1
+		sta.h	<__temp
+		call	__copy_mem
+		.endm
+
+; **************
+; A constant-size copy that is short enough to be done with a single TII.
+
+__tii		.macro
+		tii	\1, \2, \3
+		.endm
+
+; **************
+; A constant-size copy that is too long to be done with a few TII.
+
+__copy.mm	.macro
+		lda.l	#\1
+		sta.l	ram_tii_src
+		lda.h	#\1
+		sta.h	ram_tii_src
+		lda.l	#\2
+		sta.l	ram_tii_dst
+		lda.h	#\2
+		sta.h	ram_tii_dst
+		lda.l	#\3
+		sta.l	<__temp
+		lda.h	#\3
+		sta.h	<__temp
+		call	__copy_mem
+		.endm
+
+; **************
+; Copy __temp bytes (which must not be zero) from ram_tii_src to ram_tii_dst.
+;
+; The length is not passed in Y:A because the .proc trampoline uses A.
+;
+; Like load_vram_x, the TII is split into TII_XFER_SIZE chunks so that the
+; interrupts are not delayed for too long.
+
+	.ifndef	TII_XFER_SIZE
+TII_XFER_SIZE	=	16
+	.endif
+
+__copy_mem	.proc
+
+		stz.h	ram_tii_len
+
+.chunk_loop:	lda	#TII_XFER_SIZE		; Copy the next chunk, or
+		ldy.h	<__temp			; whatever is left.
+		bne	!+
+		cmp.l	<__temp
+		bcc	!+
+		lda.l	<__temp
+!:		sta.l	ram_tii_len
+		jsr	ram_tii
+
+		clc				; Move on to the next chunk.
+		adc.l	ram_tii_src
+		sta.l	ram_tii_src
+		bcc	!+
+		inc.h	ram_tii_src
+!:		lda.l	ram_tii_len
+		clc
+		adc.l	ram_tii_dst
+		sta.l	ram_tii_dst
+		bcc	!+
+		inc.h	ram_tii_dst
+
+!:		sec				; Until there's nothing left.
+		lda.l	<__temp
+		sbc.l	ram_tii_len
+		sta.l	<__temp
+		bcs	!+
+		dec.h	<__temp
+!:		ora.h	<__temp
+		bne	.chunk_loop
+
+		leave
+
+		.endp
+
+
+
 ; ***************************************************************************
 ; ***************************************************************************
 ; i-codes for extending the primary register
@@ -6931,6 +7093,114 @@ __udiv.ui	.macro
 		jsr	__divuchar
 		.endm
 
+; **************
+; A = A / divisor, using the reciprocal from the compiler
+; \1 = 9-bit magic, \2 = shift, Y:A = (A * magic) >> (8 + shift)
+
+__udiv.uiq	.macro
+		sta	<__temp
+		cla
+	.if	((\1) & $01)
+		clc
+		adc	<__temp
+		ror	a
+	.endif
+	.if	((\1) & $02)
+		clc
+		adc	<__temp
+		ror	a
+	.else
+	.if	((\1) & $01)
+		lsr	a
+	.endif
+	.endif
+	.if	((\1) & $04)
+		clc
+		adc	<__temp
+		ror	a
+	.else
+	.if	((\1) & $03)
+		lsr	a
+	.endif
+	.endif
+	.if	((\1) & $08)
+		clc
+		adc	<__temp
+		ror	a
+	.else
+	.if	((\1) & $07)
+		lsr	a
+	.endif
+	.endif
+	.if	((\1) & $10)
+		clc
+		adc	<__temp
+		ror	a
+	.else
+	.if	((\1) & $0F)
+		lsr	a
+	.endif
+	.endif
+	.if	((\1) & $20)
+		clc
+		adc	<__temp
+		ror	a
+	.else
+	.if	((\1) & $1F)
+		lsr	a
+	.endif
+	.endif
+	.if	((\1) & $40)
+		clc
+		adc	<__temp
+		ror	a
+	.else
+	.if	((\1) & $3F)
+		lsr	a
+	.endif
+	.endif
+	.if	((\1) & $80)
+		clc
+		adc	<__temp
+		ror	a
+	.else
+	.if	((\1) & $7F)
+		lsr	a
+	.endif
+	.endif
+	.if	((\1) & $100)
+		clc
+		adc	<__temp
+		ror	a
+	.else
+	.if	((\2) >= 1)
+		lsr	a
+	.endif
+	.endif
+	.if	((\2) >= 2)
+		lsr	a
+	.endif
+	.if	((\2) >= 3)
+		lsr	a
+	.endif
+	.if	((\2) >= 4)
+		lsr	a
+	.endif
+	.if	((\2) >= 5)
+		lsr	a
+	.endif
+	.if	((\2) >= 6)
+		lsr	a
+	.endif
+	.if	((\2) >= 7)
+		lsr	a
+	.endif
+	.if	((\2) >= 8)
+		lsr	a
+	.endif
+		cly
+		.endm
+
 ; **************
 ; Y:A = stacked-value % Y:A
 
@@ -6980,6 +7250,63 @@ __umod.ui	.macro
 		jsr	__moduchar
 		.endm
 
+; **************
+; A = A % divisor, using the reciprocal from the compiler
+; \1 = divisor, \2 = 9-bit magic, \3 = shift
+;
+; the quotient * divisor cannot overflow, so the carry is always
+; clear after each "asl"
+
+__umod.uiq	.macro
+		__udiv.uiq	\2, \3
+		sta	<__temp + 1
+	.if	((\1) >= $80)
+		asl	a
+	.if	((\1) & $40)
+		adc	<__temp + 1
+	.endif
+	.endif
+	.if	((\1) >= $40)
+		asl	a
+	.if	((\1) & $20)
+		adc	<__temp + 1
+	.endif
+	.endif
+	.if	((\1) >= $20)
+		asl	a
+	.if	((\1) & $10)
+		adc	<__temp + 1
+	.endif
+	.endif
+	.if	((\1) >= $10)
+		asl	a
+	.if	((\1) & $08)
+		adc	<__temp + 1
+	.endif
+	.endif
+	.if	((\1) >= $08)
+		asl	a
+	.if	((\1) & $04)
+		adc	<__temp + 1
+	.endif
+	.endif
+	.if	((\1) >= $04)
+		asl	a
+	.if	((\1) & $02)
+		adc	<__temp + 1
+	.endif
+	.endif
+	.if	((\1) >= $02)
+		asl	a
+	.if	((\1) & $01)
+		adc	<__temp + 1
+	.endif
+	.endif
+		eor	#$FF
+		sec
+		adc	<__temp
+		.endm
+
 
 
 ; ***************************************************************************
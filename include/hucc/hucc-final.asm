@@ -108,6 +108,48 @@ leaf_stack:
 
 
 
+; ***************************************************************************
+; ***************************************************************************
+;
+; Put the C variables that HuCC's "-fauto-zp" found to be the most used into
+; whatever zero page is still free, and the rest into the BSS.
+;
+; HuCC lists them in the order of the cycles that they save per byte, which
+; are an estimate, with each loop assumed to run 8 times.
+;
+
+	.ifdef	HUCC_AUTO_ZP
+
+__auto_zp_top	.set	zpg_sys_top
+	.if	USING_PSGDRIVER && (zpg_psg_top < zpg_sys_top)
+__auto_zp_top	.set	zpg_psg_top
+	.endif
+
+__auto_zp_bytes	.set	0
+__auto_zp_cycles .set	0
+
+auto_zp_var	.macro				; label, size, bytes, cycles
+		.zp
+	.if	(* + \2) <= __auto_zp_top
+\1:		ds	\2
+__auto_zp_bytes	.set	__auto_zp_bytes + \3
+__auto_zp_cycles .set	__auto_zp_cycles + \4
+		.out	"-fauto-zp: \1 (size ", \2, ") saves ~", \3, " bytes and ~", \4, " cycles"
+	.else
+		.bss
+\1:		ds	\2
+	.endif
+		.endm
+
+		__auto_zp
+
+		.zp
+		.out	"-fauto-zp: saved ~", __auto_zp_bytes, " bytes and ~", __auto_zp_cycles, " cycles, ", __auto_zp_top - *, " bytes of zero page are free"
+
+	.endif	HUCC_AUTO_ZP
+
+
+
 ; ***************************************************************************
 ; ***************************************************************************
 ;
@@ -53,6 +53,63 @@ __divsint_PARM_2 =	divisor
 ;
 ; N.B. signed and unsigned multiply only differ in the top 16 of the 32bits!
 
+	.if	FAST_MULTIPLY
+
+; Table-of-squares version, which takes 95..175 cycles instead of 500..800.
+;
+; Only the bottom 16-bits of the product are returned, so only 3 of the 4
+; partial products are needed, and the hi-byte products are skipped if the
+; hi-byte of either parameter is zero.
+
+__mulint:	sty	<multiplicand + 1	; Preserve multiplicand hi-byte.
+
+		sta	<mul_sqrplus_lo		; Multiplicand lo-byte *
+		sta	<mul_sqrplus_hi		; multiplier lo-byte.
+		eor	#$FF
+		sta	<mul_sqrminus_lo
+		sta	<mul_sqrminus_hi
+		ldy.l	<multiplier
+		sec
+		lda	[mul_sqrplus_lo], y
+		sbc	[mul_sqrminus_lo], y
+		sta	<multiplicand + 0
+		lda	[mul_sqrplus_hi], y
+		sbc	[mul_sqrminus_hi], y
+		tax				; X = product hi-byte.
+
+		ldy.h	<multiplier		; Multiplicand lo-byte *
+		beq	!+			; multiplier hi-byte.
+		sec
+		lda	[mul_sqrplus_lo], y
+		sbc	[mul_sqrminus_lo], y
+		sta	<multiplicand + 2
+		txa
+		clc
+		adc	<multiplicand + 2
+		tax
+
+!:		lda	<multiplicand + 1	; Multiplicand hi-byte *
+		beq	!+			; multiplier lo-byte.
+		sta	<mul_sqrplus_lo
+		eor	#$FF
+		sta	<mul_sqrminus_lo
+		ldy.l	<multiplier
+		sec
+		lda	[mul_sqrplus_lo], y
+		sbc	[mul_sqrminus_lo], y
+		sta	<multiplicand + 2
+		txa
+		clc
+		adc	<multiplicand + 2
+		tax
+
+!:		txa				; Return the bottom 16-bits of
+		tay				; the product.
+		lda	<multiplicand + 0
+		rts
+
+	.else
+
 __mulint:	sta	<multiplicand + 0
 		sty	<multiplicand + 1
 
@@ -89,6 +146,8 @@ __mulint:	sta	<multiplicand + 0
 
 		rts
 
+	.endif	FAST_MULTIPLY
+
 
 
 ; ***************************************************************************
@@ -182,6 +241,9 @@ divmoduint:	lda.l	<divisor		; Check for a divide-by-zero.
 		ora.h	<divisor
 .zero:		beq	.zero
 
+		lda.h	<divisor		; Use the faster division if
+		beq	divmodu16_8		; the divisor is only 8-bit.
+
 		ldx	#16 + 1
 
 		cly				; Clear remainder.
@@ -230,6 +292,56 @@ divmoduint:	lda.l	<divisor		; Check for a divide-by-zero.
 
 
 
+; ***************************************************************************
+; divmodu16_8 - Divide a 16-bit dividend by an 8-bit divisor.
+;
+; Args: dividend = 16-bit unsigned dividend.
+; Args: divisor  = 8-bit unsigned divisor (1..255).
+;
+; Returns: Y:A = 16-bit remainder, quotient in dividend.
+;
+; This is two 8-bit divisions, so it takes around half the time of the
+; 16-bit loop, and the hi-byte is skipped completely if it is less than
+; the divisor, which is common when dividing by a small constant.
+
+divmodu16_8:	lda.h	<dividend		; Is the quotient hi-byte zero?
+		cmp.l	<divisor
+		bcc	.lo_byte
+
+		asl	a			; Rotate dividend, MSB -> C.
+		sta.h	<dividend
+
+		ldx	#8
+		cla				; Clear remainder.
+.hi_loop:	rol	a			; Rotate C into remainder.
+		cmp.l	<divisor		; Test divisor.
+		bcc	.hi_skip		; CC if divisor > remainder.
+		sbc.l	<divisor		; Subtract divisor.
+.hi_skip:	rol.h	<dividend		; Quotient bit -> dividend MSB.
+		dex
+		bne	.hi_loop
+		bra	.lo_start
+
+.lo_byte:	stz.h	<dividend		; Clear quotient hi-byte.
+
+.lo_start:	asl.l	<dividend		; Rotate dividend, MSB -> C.
+
+		ldx	#8
+.lo_loop:	rol	a			; Rotate C into remainder.
+		bcs	.lo_sub			; CS if remainder is 9-bit.
+		cmp.l	<divisor		; Test divisor.
+		bcc	.lo_skip		; CC if divisor > remainder.
+.lo_sub:	sbc.l	<divisor		; Subtract divisor.
+		sec
+.lo_skip:	rol.l	<dividend		; Quotient bit -> dividend LSB.
+		dex
+		bne	.lo_loop
+
+		cly				; Clear hi-byte of remainder.
+		rts
+
+
+
 ; ***************************************************************************
 ; int
 ; _divsint (int x, int y)
@@ -310,6 +422,29 @@ __modsint:	sty.h	<dividend
 ; 2nd parameter in Y (unsigned multiplier)
 ; result in Y:A
 
+	.if	FAST_MULTIPLY
+
+; Table-of-squares version, which takes 65 cycles instead of 130..180.
+
+muluchar_a:	ldy	<multiplier
+
+__muluchar:	sta	<mul_sqrplus_lo
+		sta	<mul_sqrplus_hi
+		eor	#$FF
+		sta	<mul_sqrminus_lo
+		sta	<mul_sqrminus_hi
+		sec
+		lda	[mul_sqrplus_lo], y
+		sbc	[mul_sqrminus_lo], y
+		sta	<multiplicand
+		lda	[mul_sqrplus_hi], y
+		sbc	[mul_sqrminus_hi], y
+		tay				; Return the 16-bit product.
+		lda	<multiplicand
+		rts
+
+	.else
+
 __muluchar:	sty	<multiplier
 
 muluchar_a:	ldy	#8			; Loop 8 times.
@@ -335,6 +470,8 @@ muluchar_a:	ldy	#8			; Loop 8 times.
 
 		rts
 
+	.endif	FAST_MULTIPLY
+
 
 
 ; ***************************************************************************
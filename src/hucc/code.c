@@ -18,6 +18,12 @@
 #include "io.h"
 #include "main.h"
 #include "optimize.h"
+#include "zpage.h"
+
+#ifdef _MSC_VER
+ #include <intrin.h>
+ #define __builtin_popcount __popcnt
+#endif
 
 /* locals */
 int segment;
@@ -221,6 +227,8 @@ void gen_ins (INS *tmp)
 	static unsigned sequence = 0;
 	tmp->sequence = sequence++;
 
+	zp_count(tmp);
+
 	if (optimize)
 		push_ins(tmp);
 	else {
@@ -293,6 +301,218 @@ static void out_addr (int type, intptr_t data)
 	}
 }
 
+/* an address with a displacement */
+static void out_offset (int type, intptr_t data, int offset)
+{
+	out_addr(type, data);
+	if (offset) {
+		outbyte('+');
+		outdec(offset);
+	}
+}
+
+/*
+ *	output a block copy of a constant size between constant addresses
+ *
+ *	a short copy is split into TII instructions of TII_CHUNK bytes, so
+ *	that an interrupt is never delayed by more than one of them, and a
+ *	longer copy calls "__copy_mem" to split it up at runtime instead,
+ *	the same way as "load_vram_x" does for a TIA to the VDC
+ *
+ */
+static void out_tii (INS *src, int src_offset, INS *dst, int dst_offset, int size)
+{
+	int offset;
+
+	if (size > TII_CHUNK * TII_INLINE) {
+		ot("__copy.mm\t");
+		out_offset(src->ins_type, src->ins_data, src_offset);
+		outstr(", ");
+		out_offset(dst->imm_type, dst->imm_data, dst_offset);
+		outstr(", ");
+		outdec(size);
+		nl();
+		return;
+	}
+
+	for (offset = 0; offset < size; offset += TII_CHUNK) {
+		ot("__tii\t\t");
+		out_offset(src->ins_type, src->ins_data, src_offset + offset);
+		outstr(", ");
+		out_offset(dst->imm_type, dst->imm_data, dst_offset + offset);
+		outstr(", ");
+		outdec((size - offset < TII_CHUNK) ? size - offset : TII_CHUNK);
+		nl();
+	}
+}
+
+/*
+ *	find the reciprocal that turns an unsigned char divide by
+ *	a constant into a multiply, so that (x * magic) >> (8 + shift)
+ *	is the same as (x / divisor) for every value of x
+ *
+ *	the magic is limited to 9-bits, which is all that is needed
+ *
+ */
+static bool udiv_magic (int divisor, int *magic, int *shift)
+{
+	int m, s, x;
+
+	if (divisor < 3 || divisor > 255 || (divisor & (divisor - 1)) == 0)
+		return (false);
+
+	for (s = 0; s <= 8; s++) {
+		m = ((1 << (8 + s)) + divisor - 1) / divisor;
+		if (m > 511 || (m > 255 && s == 0))
+			break;
+		for (x = 0; x < 256; x++) {
+			if (((x * m) >> (8 + s)) != (x / divisor))
+				break;
+		}
+		if (x == 256) {
+			*magic = m;
+			*shift = s;
+			return (true);
+		}
+	}
+	return (false);
+}
+
+/*
+ *	the cycles that the __asl.wi macro takes for a shift
+ *
+ */
+static int asl_cycles (int shift)
+{
+	if (shift <= 0)
+		return (0);
+	if (shift <= 2)
+		return (10 * shift);
+	if (shift <= 4)
+		return (22 + 8 * shift);
+	if (shift <= 6)
+		return (28 + 8 * (8 - shift));
+	if (shift == 7)
+		return (16);
+	if (shift == 8)
+		return (4);
+	if (shift <= 15)
+		return (18 + 2 * (shift - 8));
+	return (4);
+}
+
+/*
+ *	split a constant multiplier into digits, either binary, or
+ *	the non-adjacent form with -1 digits, and return the cycles
+ *	that the chain of shifts and adds takes, or -1 if it cannot
+ *	be done that way
+ *
+ *	the chain starts with the top digit, then shifts and adds or
+ *	subtracts the original value for each of the other digits
+ *
+ */
+static int mul_digits (int value, bool naf, signed char *digit)
+{
+	int i, last, cycles;
+
+	for (i = 0; i <= 16; i++) {
+		digit[i] = 0;
+		if (value & 1) {
+			digit[i] = naf ? 2 - (value & 3) : 1;
+			value -= digit[i];
+		}
+		value >>= 1;
+	}
+
+	/* the top digit must be a +1 below bit 16 */
+	for (i = 16; i >= 0 && digit[i] == 0; i--)
+		;
+	if (i < 0 || i == 16 || digit[i] != 1)
+		return (-1);
+
+	/* save the original value, if it is added or subtracted */
+	cycles = 0;
+	for (last = i--; i >= 0; i--) {
+		if (digit[i]) {
+			cycles += asl_cycles(last - i) + 16 + (cycles ? 0 : 8);
+			last = i;
+		}
+	}
+	return (cycles + asl_cycles(last));
+}
+
+/*
+ *	multiply the primary register by a constant with whichever is
+ *	the fastest of the binary or the signed-digit chain of shifts
+ *	and adds, or else by calling __mulint
+ *
+ *	__mulint takes around 480 cycles plus 20 for each bit that is
+ *	set in the multiplier, which means that a chain is always faster
+ *	for a 16-bit multiply, but it is still checked
+ *
+ *	with FAST_MULTIPLY, which is only known when the code is
+ *	assembled, the table of squares takes around 120 cycles with
+ *	the call, plus 40 for each hi-byte that isn't zero, so a long
+ *	chain is only used if FAST_MULTIPLY isn't set
+ *
+ */
+static void out_mul_wi (int value)
+{
+	signed char binary[17], naf[17];
+	signed char *digit;
+	int cycles, i, last, mulint, fastmul;
+
+	value &= 0xFFFF;
+	mulint = 480 + 20 * __builtin_popcount((unsigned int)value);
+	fastmul = (value & 0xFF00) ? 200 : 160;
+
+	cycles = mul_digits(value, false, binary);
+	digit = binary;
+	i = mul_digits(value, true, naf);
+	if (i >= 0 && (cycles < 0 || i < cycles)) {
+		cycles = i;
+		digit = naf;
+	}
+
+	if (cycles < 0 || cycles >= mulint) {
+		ot("__mul.wi\t");
+		outdec(value);
+		nl();
+		return;
+	}
+
+	if (cycles >= fastmul) {
+		ol(".if\tFAST_MULTIPLY");
+		ot("__mul.wi\t");
+		outdec(value);
+		nl();
+		ol(".else");
+	}
+
+	for (i = 16; digit[i] == 0; i--)
+		;
+	if (__builtin_popcount((unsigned int)value) != 1)
+		ol("__st.wm\t<multiplicand");
+
+	for (last = i--; i >= 0; i--) {
+		if (digit[i]) {
+			ot("__asl.wi\t");
+			outdec(last - i);
+			nl();
+			ol(digit[i] > 0 ? "__add.wm\t<multiplicand" : "__sub.wm\t<multiplicand");
+			last = i;
+		}
+	}
+	if (last) {
+		ot("__asl.wi\t");
+		outdec(last);
+		nl();
+	}
+
+	if (cycles >= fastmul)
+		ol(".endif");
+}
+
 void dump_ins (INS *tmp)
 {
 	INS copy = *tmp;
@@ -318,6 +538,7 @@ char gen_code (INS *tmp)
 	intptr_t data;
 	int imm_type;
 	intptr_t imm_data;
+	int magic, shift;
 
 	code = tmp->ins_code;
 	type = tmp->ins_type;
@@ -582,6 +803,22 @@ char gen_code (INS *tmp)
 		nl();
 		break;
 
+	case I_SWITCH_T_WR:
+		ot("__switch_t.wr\t");
+		outdec((int)data);
+		outstr(", ");
+		outlabel((int)imm_data);
+		nl();
+		break;
+
+	case I_SWITCH_T_UR:
+		ot("__switch_t.ur\t");
+		outdec((int)data);
+		outstr(", ");
+		outlabel((int)imm_data);
+		nl();
+		break;
+
 	case I_DEFAULT:
 		ol("__default");
 		break;
@@ -1195,6 +1432,14 @@ char gen_code (INS *tmp)
 		nl();
 		break;
 
+	case X_TAX:
+		ol("__tax");
+		break;
+
+	case X_TXA:
+		ol("__txa");
+		break;
+
 	case I_LD_WP:
 		ot("__ld.wp\t\t");
 		out_addr(type, data);
@@ -2239,6 +2484,39 @@ char gen_code (INS *tmp)
 		nl();
 		break;
 
+	/* i-codes for copying memory */
+
+	case I_COPY_WT:
+		ot("__copy.wt\t");
+		outdec((int)data);
+		nl();
+		break;
+
+	case X_COPY_WTQ:
+		ot("__copy.wtq\t");
+		outdec((int)data);
+		nl();
+		break;
+
+	case X_TII:
+		out_tii(tmp, 0, tmp, 0, tmp->size);
+		break;
+
+	case X_FILL:
+		/* store the first byte, and then copy it along the rest */
+		ot("__st.umiq\t");
+		out_type(imm_type, imm_data);
+		outstr(", ");
+		out_type(type, data);
+		nl();
+		if (tmp->size > 1) {
+			INS dst = *tmp;
+			dst.imm_type = type;
+			dst.imm_data = data;
+			out_tii(tmp, 0, &dst, 1, tmp->size - 1);
+		}
+		break;
+
 	/* i-codes for extending a byte to a word */
 
 	case I_EXT_BR:
@@ -2826,6 +3104,10 @@ char gen_code (INS *tmp)
 		break;
 
 	case I_MUL_WI:
+		if (type == T_VALUE) {
+			out_mul_wi((int)data);
+			break;
+		}
 		ot("__mul.wi\t");
 		out_type(type, data);
 		nl();
@@ -2852,6 +3134,14 @@ char gen_code (INS *tmp)
 		break;
 
 	case I_UDIV_UI:
+		if (type == T_VALUE && udiv_magic((int)data, &magic, &shift)) {
+			ot("__udiv.uiq\t");
+			outdec(magic);
+			outstr(", ");
+			outdec(shift);
+			nl();
+			break;
+		}
 		ot("__udiv.ui\t");
 		out_type(type, data);
 		nl();
@@ -2878,6 +3168,16 @@ char gen_code (INS *tmp)
 		break;
 
 	case I_UMOD_UI:
+		if (type == T_VALUE && udiv_magic((int)data, &magic, &shift)) {
+			ot("__umod.uiq\t");
+			outdec((int)data);
+			outstr(", ");
+			outdec(magic);
+			outstr(", ");
+			outdec(shift);
+			nl();
+			break;
+		}
 		ot("__umod.ui\t");
 		out_type(type, data);
 		nl();
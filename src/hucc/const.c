@@ -16,6 +16,7 @@
 #include "code.h"
 #include "const.h"
 #include "error.h"
+#include "frame.h"
 #include "io.h"
 #include "lex.h"
 #include "primary.h"
@@ -318,6 +319,8 @@ int add_buffer (char *p, char c, int is_address)
 			}
 		}
 		else if (c != '(') {
+			/* A function's address can be called at any time. */
+			frame_address(p);
 			/* If we want the address, we need an underscore
 			   prefix. */
 			if (const_data_idx < MAX_CONST_DATA)
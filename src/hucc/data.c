@@ -7,6 +7,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include "defs.h"
+#include "inline.h"
 
 /* constant arrays storage */
 
@@ -118,6 +119,11 @@ int user_signed_char = 0;
 int user_far_arrays = 1;
 
 int leaf_size = 0;
+int overlay_frames = 0;
+int auto_zp = 0;
+int inline_functions = 0;
+int inline_limit = INLINE_LIMIT;
+int inline_declared = 0;
 
 INITIALS initials_table[NUMGLBS];
 char initials_data_table[INITIALS_SIZE];	// 5kB space for initialisation data
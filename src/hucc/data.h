@@ -114,6 +114,11 @@ extern int user_signed_char;
 extern int user_far_arrays;
 
 extern int leaf_size;
+extern int overlay_frames;
+extern int auto_zp;
+extern int inline_functions;
+extern int inline_limit;
+extern int inline_declared;
 
 extern INITIALS initials_table[NUMGLBS];
 extern char initials_data_table[INITIALS_SIZE];		// 5kB space for initialisation data
@@ -70,6 +70,8 @@ enum ICODE {
 	I_SWITCH_C_UR,
 	I_SWITCH_R_WR,
 	I_SWITCH_R_UR,
+	I_SWITCH_T_WR,
+	I_SWITCH_T_UR,
 	I_DEFAULT,
 	I_CASE,
 	I_ENDCASE,
@@ -183,6 +185,9 @@ enum ICODE {
 	X_LDY_BMQ,
 	X_LDY_UMQ,
 
+	X_TAX,
+	X_TXA,
+
 	I_LD_WP,
 	I_LD_BP,
 	I_LD_UP,
@@ -398,6 +403,13 @@ enum ICODE {
 	X_ST_WAXIQ,
 	X_ST_UAXIQ,
 
+	/* i-codes for copying memory */
+
+	I_COPY_WT,
+	X_COPY_WTQ,
+	X_TII,
+	X_FILL,
+
 	/* i-codes for extending the primary register */
 
 	I_EXT_BR,
@@ -748,6 +760,9 @@ enum ICOMPARE {
 #define STARTLOC (NUMGLBS)
 #define ENDLOC   (SYMTBSZ - 1)
 
+/* number of hash chains for the global and local symbols */
+#define SYMHASHSZ 1024
+
 /* symbol table entry format */
 /* N.B. nasty hack to allow space beyond NAMEMAX (see "copysym") */
 
@@ -820,6 +835,7 @@ struct tag_symbol {
 
 #define STORAGE 15 /* bitmask for the storage type */
 
+#define VOLATILE 16
 #define ZEROPAGE 32
 #define WASAUTO  64
 #define WRITTEN 128
@@ -853,7 +869,7 @@ struct tag_symbol {
 
 /* "switch" label stack size */
 
-#define SWST_COUNT  256
+#define SWST_COUNT  1024
 
 /* literal pool */
 
@@ -916,8 +932,15 @@ typedef struct {
 	intptr_t imm_data;
 	const char *arg[3];
 	SYMBOL *sym;
+	int size;	/* the number of bytes for X_TII and X_FILL */
 } INS;
 
+/* X_TII and X_FILL are split into TIIs of up to TII_CHUNK bytes, unless */
+/* they need more than TII_INLINE of them, see out_tii() */
+
+#define TII_CHUNK	16
+#define TII_INLINE	4
+
 /* constant array struct */
 
 #define MAX_CONST         4096
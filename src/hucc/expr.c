@@ -12,6 +12,7 @@
 #include "code.h"
 #include "error.h"
 #include "expr.h"
+#include "frame.h"
 #include "function.h"
 #include "gen.h"
 #include "io.h"
@@ -115,6 +116,20 @@ static void gen_scale_right (LVALUE *lval, LVALUE *lval2)
 	}
 }
 
+/*
+ * is it an assignment of one struct to another of the same size, which
+ * needs all of its bytes to be copied instead of just the first word?
+ */
+static bool is_struct_copy (LVALUE *lval, LVALUE *lval2)
+{
+	return (lval->indirect == CSTRUCT && lval2->indirect == CSTRUCT &&
+		lval->ptr_order == 0 && lval2->ptr_order == 0 &&
+		lval->tagsym && lval2->tagsym &&
+		!lval->symbol2 && !lval2->symbol2 &&
+		lval->tagsym->size == lval2->tagsym->size &&
+		lval->tagsym->size != 2);
+}
+
 static void void_value_error (LVALUE *lval)
 {
 	error("function is declared VOID and does not return a value");
@@ -142,7 +157,15 @@ int heir1 (LVALUE *lval, int comma)
 		if (lval->indirect) {
 			gpush();
 		}
-		if (heir1(lval2, comma))
+		k = heir1(lval2, comma);
+		if ((k || lval2->val_type == CSTRUCT) && is_struct_copy(lval, lval2)) {
+			/* copy the whole struct from the address in the primary register, */
+			/* which is left with the address of the copy for a chained "=" */
+			out_ins(I_COPY_WT, T_VALUE, lval->tagsym->size);
+			lval->val_type = CSTRUCT;
+			return (0);
+		}
+		if (k)
 			rvalue(lval2);
 		if (lval2->val_type == CVOID)
 			void_value_error(lval2);
@@ -1200,6 +1223,7 @@ int heir11 (LVALUE *lval, int comma)
 		return (k);
 
 	if (ptr->identity == FUNCTION) {
+		frame_address(ptr->name);
 		immed(T_SYMBOL, (intptr_t)ptr);
 		return (0);
 	}
@@ -0,0 +1,1272 @@
+/*	File flow.c: function-level i-code buffering and flow analysis
+ *
+ *	With -O3, the i-codes that come out of the peephole optimizer are
+ *	kept until the end of the function instead of being output, and any
+ *	text that is written directly to the .s file in the meantime (switch
+ *	tables and #asm) is kept in order with them.
+ *
+ *	At the end of the function the i-codes are split into basic blocks,
+ *	and passes that need to see the whole function are run on them,
+ *	before everything is fed through the peephole optimizer again and
+ *	finally output.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "defs.h"
+#include "data.h"
+#include "code.h"
+#include "error.h"
+#include "flow.h"
+#include "optimize.h"
+
+/* an entry in the function, either an i-code or some raw text */
+typedef struct {
+	INS ins;
+	bool raw;	/* text from raw_start to raw_end in flow_text */
+	long raw_start;
+	long raw_end;
+} FLOW_ENTRY;
+
+/* the values that are known to be in the primary register */
+#define FLOW_VALUES 4
+
+typedef struct {
+	int count;
+	INS value[FLOW_VALUES];	/* I_LD_WI, I_LD_WM, I_LD_UM or I_LD_BM */
+} FLOW_STATE;
+
+/* a basic block */
+typedef struct {
+	int first;	/* first entry in the block */
+	int last;	/* one past the last entry in the block */
+	int succ[2];	/* successor blocks, or -1 */
+	bool unknown;	/* has successors that are not known, i.e. a jump table */
+	bool exit;	/* returns from the function */
+	bool entry;	/* can be reached from outside the i-code, i.e. a jump table */
+	bool reached;
+	bool in_known;	/* primary register state at the start of the block */
+	FLOW_STATE in;
+	unsigned char *live;	/* live locals at the start of the block */
+} FLOW_BLOCK;
+
+static bool flow_on;
+static FILE *flow_text;
+static FILE *flow_output;
+static long flow_raw;
+
+static FLOW_ENTRY *flow;
+static int flow_nb;
+static int flow_max;
+
+static FLOW_BLOCK *block;
+static int block_nb;
+static int block_max;
+
+static int *label_block;
+static bool *label_ext;
+static int label_min;
+static int label_max;
+
+static int *raw_label;
+static int raw_label_nb;
+static int raw_label_max;
+
+/* ----
+ * helpers for looking at the i-codes
+ * ----
+ */
+
+/* does the i-code generate any code? */
+static bool is_exec (FLOW_ENTRY *e)
+{
+	if (e->raw)
+		return (true);
+
+	switch (e->ins.ins_code) {
+	case I_RETIRED:
+	case I_INFO:
+	case I_LABEL:
+	case I_ALIAS:
+	case I_DEF:
+	case I_CASE:
+	case I_DEFAULT:
+	case I_ENDCASE:
+		return (false);
+	default:
+		return (true);
+	}
+}
+
+/* does the i-code end a basic block? */
+static bool is_end (FLOW_ENTRY *e)
+{
+	if (e->raw)
+		return (false);
+
+	switch (e->ins.ins_code) {
+	case I_BRA:
+	case I_BFALSE:
+	case I_BTRUE:
+	case I_SWITCH_C_WR:
+	case I_SWITCH_C_UR:
+	case I_SWITCH_R_WR:
+	case I_SWITCH_R_UR:
+	case I_SWITCH_T_WR:
+	case I_SWITCH_T_UR:
+	case I_RETURN:
+		return (true);
+	default:
+		return (false);
+	}
+}
+
+/* the label that a branch goes to, or -1 if it is not a branch */
+static int branch_label (INS *ins)
+{
+	switch (ins->ins_code) {
+	case I_BRA:
+	case I_BFALSE:
+	case I_BTRUE:
+		if (ins->ins_type == T_LABEL)
+			return ((int)ins->ins_data);
+		break;
+	case I_SWITCH_T_WR:
+	case I_SWITCH_T_UR:
+		if (ins->imm_type == T_LABEL)
+			return ((int)ins->imm_data);
+		break;
+	default:
+		break;
+	}
+	return (-1);
+}
+
+static void set_branch_label (INS *ins, int label)
+{
+	if (ins->ins_code == I_SWITCH_T_WR || ins->ins_code == I_SWITCH_T_UR)
+		ins->imm_data = label;
+	else
+		ins->ins_data = label;
+}
+
+static int find_label (int label)
+{
+	if (label < label_min || label > label_max)
+		return (-1);
+	return (label_block[label - label_min]);
+}
+
+static void mark_label (int label)
+{
+	if (label >= label_min && label <= label_max)
+		label_ext[label - label_min] = true;
+}
+
+/*
+ * the displacement that the peephole optimizer has added to a symbol,
+ * i.e. the 2 in "_x + 2"
+ */
+static int symbol_offset (SYMBOL *sym)
+{
+	char *p = sym->name;
+	int offset = 0;
+
+	while ((p = strstr(p, " + ")) != NULL) {
+		p += 3;
+		offset += atoi(p);
+	}
+	return (offset);
+}
+
+/* the length of the name without any displacement */
+static size_t symbol_base (SYMBOL *sym)
+{
+	char *p = strstr(sym->name, " + ");
+
+	return (p ? (size_t)(p - sym->name) : strlen(sym->name));
+}
+
+/* is the operand a -fno-recursive local variable that isn't volatile? */
+static SYMBOL *local_symbol (int type, intptr_t data)
+{
+	SYMBOL *sym;
+	size_t len;
+
+	if (type != T_SYMBOL || data == 0)
+		return (NULL);
+	sym = (SYMBOL *)data;
+	if ((sym->storage & STORAGE) != AUTO || sym->offset >= 0)
+		return (NULL);
+	if (sym->storage & VOLATILE)
+		return (NULL);
+
+	/* an inlined function's locals are "_name_end - n" in its own frame */
+	len = strlen(current_fn);
+	if (sym->name[0] != '_' || strncmp(sym->name + 1, current_fn, len) != 0 ||
+	    strncmp(sym->name + 1 + len, "_end - ", 7) != 0)
+		return (NULL);
+	return (sym);
+}
+
+/* ----
+ * buffering
+ * ----
+ */
+
+static FLOW_ENTRY *new_entry (void)
+{
+	if (flow_nb == flow_max) {
+		flow_max = flow_max ? flow_max * 2 : 1024;
+		flow = realloc(flow, flow_max * sizeof(FLOW_ENTRY));
+		if (flow == NULL) {
+			error("out of memory buffering the function");
+			exit(1);
+		}
+	}
+	memset(&flow[flow_nb], 0, sizeof(FLOW_ENTRY));
+	return (&flow[flow_nb++]);
+}
+
+/* keep any text that has been written since the last i-code */
+static void flow_grab_raw (void)
+{
+	long pos = ftell(flow_text);
+
+	if (pos > flow_raw) {
+		FLOW_ENTRY *e = new_entry();
+		e->raw = true;
+		e->raw_start = flow_raw;
+		e->raw_end = pos;
+		flow_raw = pos;
+	}
+}
+
+bool flow_active (void)
+{
+	return (flow_on);
+}
+
+/*
+ * start buffering the function, with the output to the .s file going
+ * into a temporary file until the end of the function
+ */
+void flow_begin (void)
+{
+	if (flow_text == NULL) {
+		flow_text = tmpfile();
+		if (flow_text == NULL)
+			return;
+	}
+	rewind(flow_text);
+
+	flow_raw = 0;
+	flow_nb = 0;
+	raw_label_nb = 0;
+	flow_output = output;
+	output = flow_text;
+	flow_on = true;
+}
+
+/* add an i-code that has been through the peephole optimizer */
+void flow_add (INS *ins)
+{
+	if (ins->ins_code == I_RETIRED)
+		return;
+	flow_grab_raw();
+	new_entry()->ins = *ins;
+}
+
+/* remember the labels that are in the raw text, i.e. in a jump table */
+void flow_label (int label)
+{
+	if (!flow_on)
+		return;
+	if (raw_label_nb == raw_label_max) {
+		raw_label_max = raw_label_max ? raw_label_max * 2 : 256;
+		raw_label = realloc(raw_label, raw_label_max * sizeof(int));
+		if (raw_label == NULL) {
+			error("out of memory buffering the function");
+			exit(1);
+		}
+	}
+	raw_label[raw_label_nb++] = label;
+}
+
+/* ----
+ * basic blocks
+ * ----
+ */
+
+static int new_block (int first)
+{
+	if (block_nb == block_max) {
+		block_max = block_max ? block_max * 2 : 256;
+		block = realloc(block, block_max * sizeof(FLOW_BLOCK));
+		if (block == NULL) {
+			error("out of memory buffering the function");
+			exit(1);
+		}
+	}
+	memset(&block[block_nb], 0, sizeof(FLOW_BLOCK));
+	block[block_nb].first = first;
+	block[block_nb].last = first;
+	block[block_nb].succ[0] = -1;
+	block[block_nb].succ[1] = -1;
+	return (block_nb++);
+}
+
+static void flow_blocks (void)
+{
+	FLOW_ENTRY *e;
+	FLOW_BLOCK *b;
+	int i, n, label;
+	bool code;
+
+	/* find the labels that are defined in the function */
+	label_min = INT_MAX;
+	label_max = INT_MIN;
+	for (i = 0; i < flow_nb; i++) {
+		if (!flow[i].raw && flow[i].ins.ins_code == I_LABEL) {
+			label = (int)flow[i].ins.ins_data;
+			if (label_min > label)
+				label_min = label;
+			if (label_max < label)
+				label_max = label;
+		}
+	}
+	free(label_block);
+	free(label_ext);
+	label_block = NULL;
+	label_ext = NULL;
+	if (label_min <= label_max) {
+		n = label_max - label_min + 1;
+		label_block = malloc(n * sizeof(int));
+		label_ext = calloc(n, sizeof(bool));
+		if (label_block == NULL || label_ext == NULL) {
+			error("out of memory buffering the function");
+			exit(1);
+		}
+		for (i = 0; i < n; i++)
+			label_block[i] = -1;
+	}
+
+	/* split the function into basic blocks */
+	for (i = 0; i < block_nb; i++)
+		free(block[i].live);
+	block_nb = 0;
+	n = new_block(0);
+	code = false;
+	for (i = 0; i < flow_nb; i++) {
+		e = &flow[i];
+		if (!e->raw && e->ins.ins_code == I_LABEL) {
+			if (code) {
+				block[n].last = i;
+				n = new_block(i);
+				code = false;
+			}
+			label_block[(int)e->ins.ins_data - label_min] = n;
+		}
+		if (is_exec(e))
+			code = true;
+		if (is_end(e)) {
+			block[n].last = i + 1;
+			n = new_block(i + 1);
+			code = false;
+		}
+	}
+	block[n].last = flow_nb;
+
+	/* find the successors of each block */
+	for (n = 0; n < block_nb; n++) {
+		b = &block[n];
+		e = (b->last > b->first) ? &flow[b->last - 1] : NULL;
+		if (e == NULL || !is_end(e)) {
+			if (n + 1 < block_nb)
+				b->succ[0] = n + 1;
+			else
+				b->unknown = true;
+			continue;
+		}
+		switch (e->ins.ins_code) {
+		case I_RETURN:
+			b->exit = true;
+			break;
+		case I_SWITCH_C_WR:
+		case I_SWITCH_C_UR:
+		case I_SWITCH_R_WR:
+		case I_SWITCH_R_UR:
+			b->unknown = true;
+			break;
+		case I_BRA:
+			label = branch_label(&e->ins);
+			b->succ[0] = (label < 0) ? -1 : find_label(label);
+			b->unknown = (b->succ[0] < 0);
+			break;
+		default:
+			label = branch_label(&e->ins);
+			b->succ[0] = (label < 0) ? -1 : find_label(label);
+			b->unknown = (b->succ[0] < 0);
+			if (n + 1 < block_nb)
+				b->succ[1] = n + 1;
+			else
+				b->unknown = true;
+			break;
+		}
+	}
+
+	/*
+	 * find the labels that can be reached from somewhere that is not
+	 * a branch i-code, such as a jump table or an address in an i-code
+	 */
+	for (i = 0; i < raw_label_nb; i++)
+		mark_label(raw_label[i]);
+	for (i = 0; i < flow_nb; i++) {
+		e = &flow[i];
+		if (e->raw || e->ins.ins_code == I_RETIRED || e->ins.ins_code == I_LABEL)
+			continue;
+		if (e->ins.ins_code == I_ALIAS) {
+			mark_label((int)e->ins.ins_data);
+			mark_label((int)e->ins.imm_data);
+			continue;
+		}
+		label = branch_label(&e->ins);
+		if (e->ins.ins_type == T_LABEL && e->ins.ins_data != label)
+			mark_label((int)e->ins.ins_data);
+		if (e->ins.imm_type == T_LABEL && e->ins.imm_data != label)
+			mark_label((int)e->ins.imm_data);
+	}
+	for (i = label_min; i <= label_max; i++) {
+		if (label_ext[i - label_min] && label_block[i - label_min] >= 0)
+			block[label_block[i - label_min]].entry = true;
+	}
+
+	/* find the blocks that can be reached */
+	block[0].entry = true;
+	for (n = 0; n < block_nb; n++)
+		block[n].reached = block[n].entry;
+	do {
+		code = false;
+		for (n = 0; n < block_nb; n++) {
+			if (!block[n].reached)
+				continue;
+			for (i = 0; i < 2; i++) {
+				int s = block[n].succ[i];
+				if (s >= 0 && !block[s].reached) {
+					block[s].reached = true;
+					code = true;
+				}
+			}
+		}
+	} while (code);
+}
+
+/* ----
+ * branch threading
+ * ----
+ * A branch to a label that is followed by "__bra" is changed to go
+ * straight to the final label, and a "__bra" to the label that it
+ * falls through to is removed.
+ */
+static bool flow_thread (void)
+{
+	FLOW_ENTRY *e;
+	bool changed = false;
+	int i, j, label, next, hops;
+
+	for (i = 0; i < flow_nb; i++) {
+		e = &flow[i];
+		if (e->raw || (label = branch_label(&e->ins)) < 0)
+			continue;
+
+		for (hops = 0; hops < 16; hops++) {
+			int n = find_label(label);
+			if (n < 0)
+				break;
+			for (j = block[n].first; j < block[n].last && !is_exec(&flow[j]); j++)
+				;
+			if (j == block[n].last || flow[j].raw || flow[j].ins.ins_code != I_BRA)
+				break;
+			next = branch_label(&flow[j].ins);
+			if (next < 0 || next == label)
+				break;
+			label = next;
+		}
+		if (label != branch_label(&e->ins)) {
+			set_branch_label(&e->ins, label);
+			changed = true;
+		}
+
+		if (e->ins.ins_code == I_BRA) {
+			for (j = i + 1; j < flow_nb && !is_exec(&flow[j]); j++) {
+				if (!flow[j].raw && flow[j].ins.ins_code == I_LABEL &&
+				    (int)flow[j].ins.ins_data == label) {
+					e->ins.ins_code = I_RETIRED;
+					changed = true;
+					break;
+				}
+			}
+		}
+	}
+	return (changed);
+}
+
+/* ----
+ * unreachable code
+ * ----
+ */
+static void flow_unreachable (void)
+{
+	FLOW_ENTRY *e;
+	int i, n;
+
+	for (n = 0; n < block_nb; n++) {
+		if (block[n].reached)
+			continue;
+		for (i = block[n].first; i < block[n].last; i++) {
+			e = &flow[i];
+			if (e->raw || !is_exec(e))
+				continue;
+			if (e->ins.ins_code == I_ENTER || e->ins.ins_code == I_RETURN)
+				continue;
+			e->ins.ins_code = I_RETIRED;
+		}
+	}
+}
+
+/* ----
+ * redundant loads of the primary register
+ * ----
+ * This tracks the values that the primary register is known to hold
+ * across the branches and labels, so that a load of a value that is
+ * already in the register can be removed, such as after an "if/else"
+ * that stores the same variable on both paths.
+ *
+ * Nothing is kept across a function call, a store through a pointer,
+ * or #asm, and a "volatile" variable is never tracked at all.
+ */
+
+static bool same_operand (int type, intptr_t a, intptr_t b)
+{
+	if (a == b)
+		return (true);
+	if (a == 0 || b == 0)
+		return (false);
+	if (type == T_SYMBOL)
+		return (strcmp(((SYMBOL *)a)->name, ((SYMBOL *)b)->name) == 0);
+	if (type == T_LITERAL)
+		return (strcmp((char *)a, (char *)b) == 0);
+	return (false);
+}
+
+static bool same_value (INS *a, INS *b)
+{
+	return (a->ins_code == b->ins_code &&
+		a->ins_type == b->ins_type &&
+		a->imm_type == b->imm_type &&
+		a->imm_data == b->imm_data &&
+		same_operand(a->ins_type, a->ins_data, b->ins_data));
+}
+
+static bool has_value (FLOW_STATE *s, INS *ins)
+{
+	int i;
+
+	for (i = 0; i < s->count; i++) {
+		if (same_value(&s->value[i], ins))
+			return (true);
+	}
+	return (false);
+}
+
+static void add_value (FLOW_STATE *s, int code, INS *ins)
+{
+	if (s->count < FLOW_VALUES) {
+		s->value[s->count] = *ins;
+		s->value[s->count].ins_code = code;
+		s->count++;
+	}
+}
+
+/* can a store to this operand change the memory that is in the value? */
+static bool overlaps (INS *store, int width, INS *value)
+{
+	SYMBOL *a, *b;
+	int size;
+
+	if (value->ins_code == I_LD_WI)
+		return (false);
+	if (store->ins_type == T_PTR)
+		return (false);
+	if (store->ins_type != T_SYMBOL)
+		return (true);
+
+	if (is_volatile(store))
+		return (true);
+
+	a = (SYMBOL *)store->ins_data;
+	b = (SYMBOL *)value->ins_data;
+	if (local_symbol(T_SYMBOL, store->ins_data) && local_symbol(T_SYMBOL, value->ins_data)) {
+		int oa = a->offset + symbol_offset(a);
+		int ob = b->offset + symbol_offset(b);
+		size = (value->ins_code == I_LD_WM) ? 2 : 1;
+		return (oa < ob + size && ob < oa + width);
+	}
+	return (symbol_base(a) == symbol_base(b) &&
+		strncmp(a->name, b->name, symbol_base(a)) == 0);
+}
+
+static void kill_values (FLOW_STATE *s, INS *store, int width)
+{
+	int i, j;
+
+	for (i = j = 0; i < s->count; i++) {
+		if (!overlaps(store, width, &s->value[i]))
+			s->value[j++] = s->value[i];
+	}
+	s->count = j;
+}
+
+static bool is_load (INS *ins)
+{
+	switch (ins->ins_code) {
+	case I_LD_WI:
+		return (true);
+	case I_LD_WM:
+	case I_LD_UM:
+	case I_LD_BM:
+		return (ins->ins_type == T_SYMBOL && !is_volatile(ins));
+	default:
+		return (false);
+	}
+}
+
+static void flow_value (FLOW_ENTRY *e, FLOW_STATE *s)
+{
+	INS *ins = &e->ins;
+
+	if (e->raw) {
+		s->count = 0;
+		return;
+	}
+
+	switch (ins->ins_code) {
+	case I_RETIRED:
+	case I_INFO:
+	case I_LABEL:
+	case I_ALIAS:
+	case I_DEF:
+	case I_CASE:
+	case I_DEFAULT:
+	case I_ENDCASE:
+	case I_BRA:
+		break;
+
+	case I_LD_WI:
+	case I_LD_WM:
+	case I_LD_UM:
+	case I_LD_BM:
+		s->count = 0;
+		if (is_load(ins))
+			add_value(s, ins->ins_code, ins);
+		break;
+
+	case I_ST_WM:
+		kill_values(s, ins, 2);
+		if (ins->ins_type == T_SYMBOL && !is_volatile(ins))
+			add_value(s, I_LD_WM, ins);
+		break;
+
+	case I_ST_UM:
+		kill_values(s, ins, 1);
+		break;
+
+	default:
+		s->count = 0;
+		break;
+	}
+}
+
+static void meet (FLOW_STATE *s, FLOW_STATE *in)
+{
+	int i, j;
+
+	for (i = j = 0; i < s->count; i++) {
+		if (has_value(in, &s->value[i]))
+			s->value[j++] = s->value[i];
+	}
+	s->count = j;
+}
+
+static bool same_state (FLOW_STATE *a, FLOW_STATE *b)
+{
+	int i;
+
+	if (a->count != b->count)
+		return (false);
+	for (i = 0; i < a->count; i++) {
+		if (!has_value(b, &a->value[i]))
+			return (false);
+	}
+	return (true);
+}
+
+static void flow_loads (void)
+{
+	FLOW_STATE s, t;
+	FLOW_ENTRY *e;
+	bool changed;
+	int i, n, k;
+
+	for (n = 0; n < block_nb; n++) {
+		block[n].in_known = block[n].entry;
+		block[n].in.count = 0;
+	}
+
+	do {
+		changed = false;
+		for (n = 0; n < block_nb; n++) {
+			if (!block[n].reached || !block[n].in_known)
+				continue;
+			s = block[n].in;
+			for (i = block[n].first; i < block[n].last; i++)
+				flow_value(&flow[i], &s);
+			for (k = 0; k < 2; k++) {
+				int m = block[n].succ[k];
+				if (m < 0 || block[m].entry)
+					continue;
+				if (!block[m].in_known) {
+					block[m].in = s;
+					block[m].in_known = true;
+					changed = true;
+				} else {
+					t = block[m].in;
+					meet(&t, &s);
+					if (!same_state(&t, &block[m].in)) {
+						block[m].in = t;
+						changed = true;
+					}
+				}
+			}
+		}
+	} while (changed);
+
+	for (n = 0; n < block_nb; n++) {
+		if (!block[n].reached || !block[n].in_known)
+			continue;
+		s = block[n].in;
+		for (i = block[n].first; i < block[n].last; i++) {
+			e = &flow[i];
+			if (!e->raw && is_load(&e->ins) && has_value(&s, &e->ins))
+				e->ins.ins_code = I_RETIRED;
+			else
+				flow_value(e, &s);
+		}
+	}
+}
+
+/* ----
+ * dead stores to -fno-recursive locals
+ * ----
+ * The locals of a function that is compiled with -fno-recursive are
+ * at fixed addresses, and they are dead when the function returns, so
+ * a store to a local that is not read again before it is overwritten
+ * or the function returns can be removed.
+ *
+ * Any local whose address is taken, or that is volatile, is never touched.
+ */
+
+static int frame;		/* size of the locals in bytes */
+static unsigned char *escaped;	/* locals that are accessed by pointer */
+
+/* the local that an i-code stores, and how many bytes */
+static SYMBOL *local_store (INS *ins, int *width)
+{
+	switch (ins->ins_code) {
+	case I_ST_WM:
+	case X_ST_WMQ:
+	case I_ST_WMIQ:
+		*width = 2;
+		break;
+	case I_ST_UM:
+	case X_ST_UMQ:
+	case I_ST_UMIQ:
+		*width = 1;
+		break;
+	default:
+		return (NULL);
+	}
+	return (local_symbol(ins->ins_type, ins->ins_data));
+}
+
+static void set_range (unsigned char *live, SYMBOL *sym, int width, unsigned char value)
+{
+	int offset = sym->offset + symbol_offset(sym);
+	int i;
+
+	for (i = offset; i < offset + width && i < 0; i++) {
+		if (i >= -frame)
+			live[frame + i] = value;
+	}
+}
+
+/* mark the whole of a local, from its start to past any displacement */
+static void set_local (unsigned char *live, SYMBOL *sym)
+{
+	int size = (sym->alloc_size > 2) ? sym->alloc_size : 2;
+	int i;
+
+	for (i = sym->offset; i < sym->offset + symbol_offset(sym) + size && i < 0; i++) {
+		if (i >= -frame)
+			live[frame + i] = 1;
+	}
+}
+
+/* the effect of an i-code on the live locals, going backwards */
+static void flow_live (FLOW_ENTRY *e, unsigned char *live)
+{
+	SYMBOL *sym;
+	int width;
+
+	if (e->raw) {
+		memset(live, 1, frame);
+		return;
+	}
+	if (e->ins.ins_code == I_RETIRED)
+		return;
+
+	if ((sym = local_store(&e->ins, &width)) != NULL) {
+		set_range(live, sym, width, 0);
+		if ((sym = local_symbol(e->ins.imm_type, e->ins.imm_data)) != NULL)
+			set_local(live, sym);
+		return;
+	}
+
+	switch (e->ins.ins_code) {
+	case I_LD_WM:
+		width = 2;
+		break;
+	case I_LD_UM:
+	case I_LD_BM:
+		width = 1;
+		break;
+	default:
+		width = 0;
+		break;
+	}
+	if ((sym = local_symbol(e->ins.ins_type, e->ins.ins_data)) != NULL) {
+		if (width)
+			set_range(live, sym, width, 1);
+		else
+			set_local(live, sym);
+	}
+	if ((sym = local_symbol(e->ins.imm_type, e->ins.imm_data)) != NULL)
+		set_local(live, sym);
+}
+
+/* is every byte of a store dead, and not accessed by pointer? */
+static bool is_dead (unsigned char *live, SYMBOL *sym, int width)
+{
+	int offset = sym->offset + symbol_offset(sym);
+	int i;
+
+	for (i = offset; i < offset + width; i++) {
+		if (i >= 0 || i < -frame || live[frame + i] || escaped[frame + i])
+			return (false);
+	}
+	return (true);
+}
+
+static void flow_out (int n, unsigned char *live)
+{
+	int k;
+
+	if (block[n].unknown) {
+		memset(live, 1, frame);
+		return;
+	}
+	memset(live, 0, frame);
+	for (k = 0; k < 2; k++) {
+		int m = block[n].succ[k];
+		int i;
+		if (m < 0)
+			continue;
+		for (i = 0; i < frame; i++)
+			live[i] |= block[m].live[i];
+	}
+}
+
+static void flow_stores (void)
+{
+	unsigned char *live;
+	FLOW_ENTRY *e;
+	SYMBOL *sym;
+	bool changed;
+	int i, n, width;
+
+	/* find the size of the locals */
+	frame = 0;
+	for (i = 0; i < flow_nb; i++) {
+		e = &flow[i];
+		if (e->raw)
+			continue;
+		if ((sym = local_symbol(e->ins.ins_type, e->ins.ins_data)) != NULL && frame < -sym->offset)
+			frame = -sym->offset;
+		if ((sym = local_symbol(e->ins.imm_type, e->ins.imm_data)) != NULL && frame < -sym->offset)
+			frame = -sym->offset;
+	}
+	if (frame == 0)
+		return;
+
+	/* find the locals whose address is taken */
+	escaped = calloc(frame, 1);
+	live = malloc(frame);
+	if (escaped == NULL || live == NULL) {
+		error("out of memory buffering the function");
+		exit(1);
+	}
+	for (i = 0; i < flow_nb; i++) {
+		e = &flow[i];
+		if (e->raw || e->ins.ins_code == I_RETIRED)
+			continue;
+		if (local_store(&e->ins, &width) != NULL) {
+			if ((sym = local_symbol(e->ins.imm_type, e->ins.imm_data)) != NULL)
+				set_local(escaped, sym);
+			continue;
+		}
+		switch (e->ins.ins_code) {
+		case I_LD_WM:
+		case I_LD_UM:
+		case I_LD_BM:
+			break;
+		default:
+			if ((sym = local_symbol(e->ins.ins_type, e->ins.ins_data)) != NULL)
+				set_local(escaped, sym);
+			if ((sym = local_symbol(e->ins.imm_type, e->ins.imm_data)) != NULL)
+				set_local(escaped, sym);
+			break;
+		}
+	}
+
+	/* find the live locals at the start of each block */
+	for (n = 0; n < block_nb; n++) {
+		block[n].live = calloc(frame, 1);
+		if (block[n].live == NULL) {
+			error("out of memory buffering the function");
+			exit(1);
+		}
+	}
+	do {
+		changed = false;
+		for (n = block_nb; n-- > 0;) {
+			flow_out(n, live);
+			for (i = block[n].last; i-- > block[n].first;)
+				flow_live(&flow[i], live);
+			if (memcmp(live, block[n].live, frame) != 0) {
+				memcpy(block[n].live, live, frame);
+				changed = true;
+			}
+		}
+	} while (changed);
+
+	/* remove the stores to locals that are dead */
+	for (n = 0; n < block_nb; n++) {
+		if (!block[n].reached)
+			continue;
+		flow_out(n, live);
+		for (i = block[n].last; i-- > block[n].first;) {
+			e = &flow[i];
+			if (!e->raw && (sym = local_store(&e->ins, &width)) != NULL &&
+			    is_dead(live, sym, width))
+				e->ins.ins_code = I_RETIRED;
+			else
+				flow_live(e, live);
+		}
+	}
+
+	free(live);
+	free(escaped);
+	escaped = NULL;
+}
+
+/* ----
+ * block transfers
+ * ----
+ * A loop that copies or fills an array of bytes, with an unsigned char
+ * index that counts up from zero to a constant, i.e.
+ *
+ *	for (i = 0; i < n; i++) dst[i] = src[i];
+ *	for (i = 0; i < n; i++) dst[i] = value;
+ *
+ * is changed into a block transfer, followed by a store of the index's
+ * final value and a branch to the end of the loop.
+ *
+ * The loop itself is left to be removed as unreachable code, so nothing
+ * goes wrong if there is a "goto" into it.
+ */
+
+/* the next i-code that generates code */
+static int next_exec (int i)
+{
+	while (i < flow_nb && !is_exec(&flow[i]))
+		i++;
+	return (i);
+}
+
+/* the next i-code that is executed, following any "__bra" */
+static int next_run (int i)
+{
+	int hops, n;
+
+	for (hops = 0; hops < 16; hops++) {
+		i = next_exec(i);
+		if (i == flow_nb || flow[i].raw || flow[i].ins.ins_code != I_BRA)
+			break;
+		if ((n = find_label(branch_label(&flow[i].ins))) < 0)
+			break;
+		i = block[n].first;
+	}
+	return (i);
+}
+
+static INS *run_ins (int i)
+{
+	return ((i < flow_nb && !flow[i].raw) ? &flow[i].ins : NULL);
+}
+
+/*
+ * the i-codes that access the loop's index, for an unsigned char or an
+ * int, on the stack or in memory
+ */
+enum { INDEX_INIT, INDEX_TEST, INDEX_TEST2, INDEX_LDX, INDEX_LDX2, INDEX_INC, INDEX_INC2, INDEX_CODES };
+
+static const enum ICODE index_codes[][INDEX_CODES] = {
+	{ I_ST_USIQ, X_LD_USQ, X_LD_USQ, X_LDX_USQ, X_LDX_US, X_INC_USQ, X_INC_USQ },
+	{ I_ST_UMIQ, X_LD_UMQ, X_LD_UMQ, X_LDX_UMQ, X_LDX_UMQ, X_INC_UMQ, X_INC_UMQ },
+	{ I_ST_WSIQ, X_LD_WS, X_LD_WSQ, X_LDX_WSQ, X_LDX_WS, X_INC_WSQ, X_INC_WSQ },
+	{ I_ST_WMIQ, I_LD_WM, X_LD_WMQ, X_LDX_WMQ, X_LDX_WMQ, X_INC_WMQ, X_INC_WMQ }
+};
+
+static int index_type (INS *init)
+{
+	int n;
+
+	for (n = 0; n < (int)(sizeof(index_codes) / sizeof(index_codes[0])); n++) {
+		if (init->ins_code == index_codes[n][INDEX_INIT])
+			return (n);
+	}
+	return (-1);
+}
+
+/* is it the index, accessed by the i-code in the column, or the next one? */
+static bool is_index (INS *ins, INS *init, int code)
+{
+	const enum ICODE *codes = index_codes[index_type(init)];
+
+	if (ins == NULL || (ins->ins_code != codes[code] && ins->ins_code != codes[code + 1]))
+		return (false);
+	if (init->ins_code == I_ST_USIQ || init->ins_code == I_ST_WSIQ)
+		return (ins->ins_data == init->ins_data);
+	return (ins->ins_type == T_SYMBOL &&
+		same_operand(T_SYMBOL, ins->ins_data, init->ins_data));
+}
+
+/* can two byte arrays overlap? */
+static bool same_array (INS *a, INS *b)
+{
+	SYMBOL *sa = (SYMBOL *)a->ins_data;
+	SYMBOL *sb = (SYMBOL *)b->ins_data;
+
+	return (symbol_base(sa) == symbol_base(sb) &&
+		strncmp(sa->name, sb->name, symbol_base(sa)) == 0);
+}
+
+/* match the loop that starts with the index being set to zero */
+static bool match_blkcopy (int i, INS *xfer, int *done)
+{
+	INS *init = &flow[i].ins;
+	INS *ins, *src;
+	int test, j, size;
+
+	/* the test, "i < n" */
+	test = next_run(i + 1);
+	if (!is_index(run_ins(test), init, INDEX_TEST))
+		return (false);
+	j = next_exec(test + 1);
+	ins = run_ins(j);
+	if (ins == NULL || ins->ins_type != T_VALUE || ins->ins_data < 1 || ins->ins_data > 255)
+		return (false);
+	if (init->ins_code == I_ST_USIQ || init->ins_code == I_ST_UMIQ) {
+		if (ins->ins_code != X_CMP_UIQ || ins->cmp_type != CMP_ULT)
+			return (false);
+	} else {
+		if (ins->ins_code != X_CMP_WI || (ins->cmp_type != CMP_SLT && ins->cmp_type != CMP_ULT))
+			return (false);
+	}
+	size = (int)ins->ins_data;
+
+	/* the branches into the loop and out of it */
+	j = next_exec(j + 1);
+	ins = run_ins(j);
+	if (ins == NULL)
+		return (false);
+	if (ins->ins_code == I_BTRUE) {
+		INS *bra = run_ins(next_exec(j + 1));
+		if (bra == NULL || bra->ins_code != I_BRA || find_label(branch_label(ins)) < 0)
+			return (false);
+		*done = branch_label(bra);
+		j = next_run(block[find_label(branch_label(ins))].first);
+	}
+	else
+	if (ins->ins_code == I_BFALSE) {
+		*done = branch_label(ins);
+		j = next_run(j + 1);
+	}
+	else
+		return (false);
+	if (*done < 0)
+		return (false);
+
+	/* the body, "dst[i] = src[i]" or "dst[i] = value" */
+	if (!is_index(run_ins(j), init, INDEX_LDX))
+		return (false);
+	j = next_run(j + 1);
+	src = run_ins(j);
+	if (src && (src->ins_code == X_LD_UAX || src->ins_code == X_LD_BAX) &&
+	    src->ins_type == T_SYMBOL) {
+		j = next_run(j + 1);
+		if (is_index(run_ins(j), init, INDEX_LDX))
+			j = next_run(j + 1);
+		ins = run_ins(j);
+		if (ins == NULL || ins->ins_code != X_ST_UAXQ ||
+		    ins->ins_type != T_SYMBOL || same_array(src, ins))
+			return (false);
+		memset(xfer, 0, sizeof(INS));
+		xfer->ins_code = X_TII;
+		xfer->ins_type = T_SYMBOL;
+		xfer->ins_data = src->ins_data;
+		xfer->imm_type = T_SYMBOL;
+		xfer->imm_data = ins->ins_data;
+	}
+	else
+	if (src && src->ins_code == X_ST_UAXIQ && src->ins_type == T_SYMBOL &&
+	    src->imm_type == T_VALUE) {
+		memset(xfer, 0, sizeof(INS));
+		xfer->ins_code = X_FILL;
+		xfer->ins_type = T_SYMBOL;
+		xfer->ins_data = src->ins_data;
+		xfer->imm_type = T_VALUE;
+		xfer->imm_data = src->imm_data;
+	}
+	else
+		return (false);
+	xfer->size = size;
+
+	/* the increment, "i++", and back to the test */
+	j = next_run(j + 1);
+	if (!is_index(run_ins(j), init, INDEX_INC))
+		return (false);
+	return (next_run(j + 1) == test);
+}
+
+static bool flow_blkcopy (void)
+{
+	INS init, xfer;
+	bool changed = false;
+	int i, done;
+
+	for (i = 0; i < flow_nb; i++) {
+		if (flow[i].raw)
+			continue;
+		init = flow[i].ins;
+		if (index_type(&init) < 0 || init.imm_type != T_VALUE || init.imm_data != 0)
+			continue;
+		if ((init.ins_code == I_ST_UMIQ || init.ins_code == I_ST_WMIQ) && init.ins_type != T_SYMBOL)
+			continue;
+		if (!match_blkcopy(i, &xfer, &done))
+			continue;
+
+		/* the transfer, "i = n", and out of the loop */
+		new_entry();
+		new_entry();
+		memmove(&flow[i + 3], &flow[i + 1], (flow_nb - i - 3) * sizeof(FLOW_ENTRY));
+		flow[i].ins = xfer;
+		memset(&flow[i + 1], 0, sizeof(FLOW_ENTRY));
+		flow[i + 1].ins = init;
+		flow[i + 1].ins.imm_data = xfer.size;
+		memset(&flow[i + 2], 0, sizeof(FLOW_ENTRY));
+		flow[i + 2].ins.ins_code = I_BRA;
+		flow[i + 2].ins.ins_type = T_LABEL;
+		flow[i + 2].ins.ins_data = done;
+		changed = true;
+
+		/* the blocks are out of date now */
+		flow_blocks();
+	}
+	return (changed);
+}
+
+/* ----
+ * the end of the function
+ * ----
+ */
+static void flow_optimize (void)
+{
+	flow_blocks();
+	if (flow_thread())
+		flow_blocks();
+	if (flow_blkcopy()) {
+		flow_unreachable();
+		if (flow_thread())
+			flow_blocks();
+	}
+	flow_unreachable();
+	flow_loads();
+	if (norecurse)
+		flow_stores();
+}
+
+/*
+ * run the passes on the whole function, and then send everything
+ * through the peephole optimizer again to output it
+ */
+void flow_end (void)
+{
+	char buffer[1024];
+	FLOW_ENTRY *e;
+	long size;
+	size_t n;
+	int i;
+
+	if (!flow_on)
+		return;
+
+	flow_grab_raw();
+	output = flow_output;
+	flow_on = false;
+
+	flow_optimize();
+
+	for (i = 0; i < flow_nb; i++) {
+		e = &flow[i];
+		if (e->raw) {
+			flush_ins();
+			fseek(flow_text, e->raw_start, SEEK_SET);
+			for (size = e->raw_end - e->raw_start; size > 0; size -= n) {
+				n = fread(buffer, 1, (size < (long)sizeof(buffer)) ? (size_t)size : sizeof(buffer), flow_text);
+				if (n == 0)
+					break;
+				fwrite(buffer, 1, n, output);
+			}
+		}
+		else
+		if (e->ins.ins_code != I_RETIRED)
+			push_ins(&e->ins);
+	}
+	flush_ins();
+	fseek(flow_text, 0, SEEK_END);
+}
@@ -0,0 +1,12 @@
+/*	File flow.h: function-level i-code buffering and flow analysis */
+
+#ifndef _FLOW_H
+#define _FLOW_H
+
+bool flow_active (void);
+void flow_begin (void);
+void flow_add (INS *ins);
+void flow_label (int label);
+void flow_end (void);
+
+#endif
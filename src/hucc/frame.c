@@ -0,0 +1,304 @@
+/*	File frame.c: overlaying the -fno-recursive locals
+ *
+ *	With -fno-recursive, the locals of each function that calls other
+ *	functions are given their own fixed address in the .bss section.
+ *
+ *	With -foverlay-frames as well, those frames are given an offset in
+ *	a single area that is shared by all of them, using the call graph
+ *	of the whole program, so that a function's frame is always above
+ *	the frames of any function that can call it, and functions that
+ *	can never be active at the same time share the same memory.
+ *
+ *	A function whose address is taken can be called at any time, i.e.
+ *	from an interrupt handler, so it, and everything that it calls, keep
+ *	a frame of their own.
+ *
+ *	The calls that are made from #asm are not in the call graph, so a
+ *	function that has #asm in it, and a function whose "_name" appears
+ *	in #asm anywhere, are treated in the same way.  Code that is pulled
+ *	in with #incasm(), or from another source file, is not seen, and it
+ *	must only call C functions whose address is taken.
+ *
+ *	With -fauto-zp, the whole overlay is a single candidate for zero
+ *	page, with the references to all of the frames in it counted, and
+ *	each of the frames of their own is a candidate as usual.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "defs.h"
+#include "data.h"
+#include "code.h"
+#include "error.h"
+#include "frame.h"
+#include "io.h"
+#include "lex.h"
+#include "zpage.h"
+
+typedef struct {
+	char name[NAMESIZE];
+	int size;		/* size of the frame, or 0 if it has none */
+	int offset;		/* offset of the frame in the overlay */
+	bool address;		/* its address is taken */
+	bool uses_asm;		/* it has #asm in it */
+	bool private;		/* needs a frame of its own */
+	int *callee;
+	int callee_nb;
+	int callee_max;
+} FRAME;
+
+static FRAME *frame;
+static int frame_nb;
+static int frame_max;
+
+static int find_frame (const char *name)
+{
+	int i;
+
+	for (i = 0; i < frame_nb; i++) {
+		if (strcmp(frame[i].name, name) == 0)
+			return (i);
+	}
+
+	if (frame_nb == frame_max) {
+		frame_max = frame_max ? frame_max * 2 : 256;
+		frame = realloc(frame, frame_max * sizeof(FRAME));
+		if (frame == NULL) {
+			error("out of memory for the call graph");
+			exit(1);
+		}
+	}
+	memset(&frame[frame_nb], 0, sizeof(FRAME));
+	strncpy(frame[frame_nb].name, name, NAMESIZE - 1);
+	return (frame_nb++);
+}
+
+/* remember that the current function calls another one */
+void frame_call (const char *name)
+{
+	FRAME *f;
+	int caller, callee, i;
+
+	if (!overlay_frames || current_fn[0] == '\0')
+		return;
+
+	caller = find_frame(current_fn);
+	callee = find_frame(name);
+	f = &frame[caller];
+
+	for (i = 0; i < f->callee_nb; i++) {
+		if (f->callee[i] == callee)
+			return;
+	}
+	if (f->callee_nb == f->callee_max) {
+		f->callee_max = f->callee_max ? f->callee_max * 2 : 8;
+		f->callee = realloc(f->callee, f->callee_max * sizeof(int));
+		if (f->callee == NULL) {
+			error("out of memory for the call graph");
+			exit(1);
+		}
+	}
+	f->callee[f->callee_nb++] = callee;
+}
+
+/* remember that a function's address is taken */
+void frame_address (const char *name)
+{
+	int i;
+
+	if (overlay_frames) {
+		i = find_frame(name);
+		frame[i].address = true;
+	}
+}
+
+/* look at a line of #asm, for the functions that it might call */
+void frame_asm (const char *text)
+{
+	char name[NAMESIZE];
+	const char *p = text;
+	int i, n;
+
+	if (!overlay_frames)
+		return;
+
+	if (fexitlab) {
+		i = find_frame(current_fn);
+		frame[i].uses_asm = true;
+	}
+
+	while (*p && *p != ';') {
+		if (*p != '_' || (p != text && alphanum(p[-1]))) {
+			++p;
+			continue;
+		}
+		for (n = 0, ++p; alphanum(*p); p++) {
+			if (n < NAMESIZE - 1)
+				name[n++] = *p;
+		}
+		name[n] = '\0';
+		if (n && alpha(name[0]))
+			frame_address(name);
+	}
+}
+
+/*
+ * give the current function a frame in the overlay, the address is
+ * decided by dumpframes() once the whole program has been compiled
+ */
+bool frame_define (int size)
+{
+	int i;
+
+	if (!overlay_frames)
+		return (false);
+
+	i = find_frame(current_fn);
+	frame[i].size = size;
+	return (true);
+}
+
+static void set_private (int i)
+{
+	int j;
+
+	if (frame[i].private)
+		return;
+	frame[i].private = true;
+	for (j = 0; j < frame[i].callee_nb; j++)
+		set_private(frame[i].callee[j]);
+}
+
+static void outpad (int number, int width)
+{
+	char buffer[16];
+
+	sprintf(buffer, "%*d", width, number);
+	outstr(buffer);
+}
+
+static void private_frame (FRAME *f)
+{
+	if (zp_frame(f->name, f->size))
+		return;
+	defstorage();
+	outdec(f->size);
+	nl();
+	outstr("__"); outstr(f->name); outstr("_end:\n");
+}
+
+/*
+ * place the frames in the overlay, and output the addresses, with a
+ * report of where each one is
+ */
+void dumpframes (void)
+{
+	bool changed;
+	int i, j, pass;
+	int total, saved;
+	bool zp;
+
+	if (!overlay_frames || frame_nb == 0)
+		return;
+
+	for (i = 0; i < frame_nb; i++) {
+		if (frame[i].address || frame[i].uses_asm)
+			set_private(i);
+	}
+
+	/* a frame must be above the frames of everything that calls it */
+	pass = 0;
+	do {
+		changed = false;
+		for (i = 0; i < frame_nb; i++) {
+			FRAME *f = &frame[i];
+			int end = f->offset + (f->private ? 0 : f->size);
+			for (j = 0; j < f->callee_nb; j++) {
+				FRAME *c = &frame[f->callee[j]];
+				if (c->offset < end) {
+					c->offset = end;
+					changed = true;
+				}
+			}
+		}
+	} while (changed && ++pass <= frame_nb);
+
+	if (changed) {
+		/* there is recursion, so nothing can be overlaid */
+		for (i = 0; i < frame_nb; i++)
+			frame[i].private = true;
+	}
+
+	total = saved = 0;
+	for (i = 0; i < frame_nb; i++) {
+		if (frame[i].private || frame[i].size == 0)
+			continue;
+		if (total < frame[i].offset + frame[i].size)
+			total = frame[i].offset + frame[i].size;
+		saved += frame[i].size;
+		zp_overlaid(frame[i].name, frame[i].offset + frame[i].size);
+	}
+	saved -= total;
+	zp = total && zp_overlay(total);
+
+	nl();
+	outstr(";***********************\n");
+	outstr("; -foverlay-frames\n");
+	if (changed)
+		outstr("; recursion in the call graph, the frames are not overlaid\n");
+	outstr(";\n;  offset  size  function\n");
+	for (i = 0; i < frame_nb; i++) {
+		if (frame[i].size == 0)
+			continue;
+		outstr(";  ");
+		if (frame[i].private)
+			outstr("   ---");
+		else
+			outpad(frame[i].offset, 6);
+		outstr("  ");
+		outpad(frame[i].size, 4);
+		outstr("  _");
+		outstr(frame[i].name);
+		if (frame[i].address)
+			outstr(" (address taken)");
+		else
+		if (frame[i].uses_asm)
+			outstr(" (has #asm)");
+		else
+		if (frame[i].private && !changed)
+			outstr(" (called from a frame of its own)");
+		nl();
+	}
+	outstr(";\n; ");
+	outdec(total);
+	outstr(" bytes overlaid, ");
+	outdec(saved);
+	outstr(" bytes saved\n");
+	if (zp)
+		outstr("; the overlay is left for -fauto-zp to place\n");
+	outstr(";***********************\n");
+
+	gbss();
+	if (total && !zp) {
+		outstr("__overlay_frames:\n");
+		defstorage();
+		outdec(total);
+		nl();
+	}
+	for (i = 0; i < frame_nb; i++) {
+		if (frame[i].size == 0)
+			continue;
+		if (frame[i].private)
+			private_frame(&frame[i]);
+		else
+		if (!zp) {
+			outstr("__"); outstr(frame[i].name); outstr("_end\t=\t__overlay_frames + ");
+			outdec(frame[i].offset + frame[i].size);
+			nl();
+		}
+	}
+	gtext();
+}
@@ -0,0 +1,12 @@
+/*	File frame.h: overlaying the -fno-recursive locals */
+
+#ifndef _FRAME_H
+#define _FRAME_H
+
+void frame_call (const char *name);
+void frame_address (const char *name);
+void frame_asm (const char *text);
+bool frame_define (int size);
+void dumpframes (void);
+
+#endif
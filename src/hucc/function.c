@@ -14,8 +14,11 @@
 #include "error.h"
 #include "expr.h"
 #include "fastcall.h"
+#include "flow.h"
+#include "frame.h"
 #include "function.h"
 #include "gen.h"
+#include "inline.h"
 #include "io.h"
 #include "lex.h"
 #include "optimize.h"
@@ -25,6 +28,7 @@
 #include "stmt.h"
 #include "sym.h"
 #include "struct.h"
+#include "zpage.h"
 
 /* locals */
 static INS arg_queue[Q_SIZE];
@@ -71,6 +75,7 @@ void newfunc (const char *sname, int ret_ptr_order, int ret_type, int ret_otag,
 	SYMBOL *ptr;
 	int nbarg = 0;
 	int save_norecurse = norecurse;
+	bool is_inline = inline_declared;
 	struct fastcall *fc;
 	int hash;
 	int fc_args;
@@ -391,8 +396,13 @@ void newfunc (const char *sname, int ret_ptr_order, int ret_type, int ret_otag,
 	outstr(current_fn);
 	nl();
 
+	/* with -O3, keep the function's code for the flow analysis */
+	if (optimize >= 3)
+		flow_begin();
+
 	/* generate the function prolog */
 	out_ins(I_ENTER, T_SYMBOL, (intptr_t)ptr);
+	inline_begin(is_inline);
 
 #if ULI_NORECURSE
 	/* When using fixed-address locals, local_offset is used to
@@ -418,6 +428,8 @@ void newfunc (const char *sname, int ret_ptr_order, int ret_type, int ret_otag,
 	}
 	out_ins(I_RETURN, T_VALUE, ret_type != CVOID || ret_ptr_order != 0); /* generate the return statement */
 	flush_ins();		/* David, optimize.c related */
+	flow_end();
+	inline_end(nbarg);
 
 	ol(".dbg\tclear");
 	ol(".endp");	/* David, .endp directive support */
@@ -431,7 +443,8 @@ void newfunc (const char *sname, int ret_ptr_order, int ret_type, int ret_otag,
 				leaf_size = -local_offset;
 			outstr("__"); outstr(current_fn); outstr("_end\t.alias\tleaf_stack\n");
 		}
-		else {
+		else
+		if (!frame_define(-local_offset) && !zp_frame(current_fn, -local_offset)) {
 			defstorage();
 			outdec(-local_offset);
 			nl();
@@ -586,6 +599,7 @@ void callfunction (SYMBOL *ptr)
 	int spilled_arg_sizes[MAX_FASTCALL_ARGS];
 	int sparg_idx = 0;	/* index into spilled_arg_names[] */
 	int uses_acc = 0;	/* does callee use acc? */
+	bool inlined = false;
 	static bool using_funcptr = false;
 
 	/* cumulative total of function calls within the list of arguments */
@@ -862,7 +876,7 @@ void callfunction (SYMBOL *ptr)
 		// Else not a NOP or MACRO fastcall
 		else if (is_fc)
 			gcall(ptr->name, argcnt);
-		else
+		else if (!(inlined = inline_call(ptr->name, argcnt)))
 			gcall(ptr->name, 0);
 	} else {
 		/* invoke saved function-ptr for call indirect */
@@ -877,8 +891,9 @@ void callfunction (SYMBOL *ptr)
 		/* calculations during the peephole optimization phase, but the */
 		/* T_NOP stops the code-output from writing it to the .S file.  */
 		/* The function that is called is actually the one responsible  */
-		/* for removing the arguments from the stack. */
-		if (!is_fc)
+		/* for removing the arguments from the stack, and an inlined */
+		/* function's epilog has already done that. */
+		if (!is_fc && !inlined)
 			out_ins(I_MODSP, T_NOP, argsiz);
 	}
 }
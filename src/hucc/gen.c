@@ -20,6 +20,7 @@
 #include "expr.h"
 #include "const.h"
 #include "error.h"
+#include "frame.h"
 #include "io.h"
 
 /*
@@ -202,6 +203,7 @@ void gpop (void)
  */
 void gcall (char *sname, int nargs)
 {
+	frame_call(sname);
 	out_ins_ex(I_CALL, T_LITERAL, (intptr_t)sname, T_VALUE, nargs);
 }
 
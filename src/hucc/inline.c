@@ -0,0 +1,249 @@
+/*	File inline.c: inlining small functions
+ *
+ *	The i-codes of a function that is declared "inline", or of any other
+ *	function with -finline-functions, are kept as they come out of the
+ *	optimizer, as long as there are no more of them than -finline-limit
+ *	allows (half of that without "inline").
+ *
+ *	A later call to the function is then replaced by those i-codes, with
+ *	new numbers for their labels, once the arguments have been pushed.
+ *	They go through the peephole optimizer again together with the code
+ *	of the caller, and there is no __enter, __return, jsr or bank thunk.
+ *
+ *	The arguments are still passed on the stack, and the function's own
+ *	epilog removes them, so the stack offsets in the i-codes are exactly
+ *	the same as they are in the function itself.
+ *
+ *	Functions that contain #asm, a switch or a goto to a label further
+ *	on are never inlined, because they write text to the .s file that
+ *	is not in the i-codes.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "defs.h"
+#include "data.h"
+#include "code.h"
+#include "error.h"
+#include "frame.h"
+#include "gen.h"
+#include "inline.h"
+#include "sym.h"
+
+extern int arg_stack_flag;
+
+typedef struct {
+	char name[NAMESIZE];
+	int arg_count;
+	INS *ins;
+	int ins_nb;
+	int *label;		/* the labels that are defined in the i-codes */
+	int label_nb;
+} INLINE_FN;
+
+static INLINE_FN *inl;
+static int inl_nb;
+static int inl_max;
+
+/* the function that is being kept */
+static bool recording;
+static bool returned;
+static int budget;
+static INS *rec;
+static int rec_nb;
+static int rec_max;
+
+static int find_inline (const char *name)
+{
+	int i;
+
+	for (i = 0; i < inl_nb; i++) {
+		if (strcmp(inl[i].name, name) == 0)
+			return (i);
+	}
+	return (-1);
+}
+
+/* the locals are reused by the next function, so keep a copy */
+static SYMBOL *keep_symbol (SYMBOL *sym)
+{
+	if (sym == NULL || (sym >= symtab && sym < &symtab[STARTLOC]))
+		return (sym);
+
+	sym = copysym(sym);
+	if (sym->linked && sym->linked >= &symtab[STARTLOC] && sym->linked <= &symtab[ENDLOC])
+		sym->linked = copysym(sym->linked);
+	return (sym);
+}
+
+/* start keeping the i-codes of the function after its __enter */
+void inline_begin (bool declared)
+{
+	recording = false;
+	if (!optimize || (!declared && !inline_functions) || strcmp(current_fn, "main") == 0)
+		return;
+
+	recording = true;
+	returned = false;
+	budget = declared ? inline_limit : inline_limit / 2;
+	rec_nb = 0;
+}
+
+void inline_add (INS *ins)
+{
+	INS *copy;
+
+	if (!recording)
+		return;
+
+	switch (ins->ins_code) {
+	case I_INFO:
+	case I_ENTER:
+		return;
+
+	case I_RETURN:
+		returned = true;
+		return;
+
+	case I_DEF:
+	case I_SWITCH_C_WR:
+	case I_SWITCH_C_UR:
+	case I_SWITCH_R_WR:
+	case I_SWITCH_R_UR:
+	case I_SWITCH_T_WR:
+	case I_SWITCH_T_UR:
+		recording = false;
+		return;
+
+	case I_LABEL:
+	case I_ALIAS:
+		break;
+
+	default:
+		if (returned || --budget < 0) {
+			recording = false;
+			return;
+		}
+		break;
+	}
+
+	if (rec_nb == rec_max) {
+		rec_max = rec_max ? rec_max * 2 : 256;
+		rec = realloc(rec, rec_max * sizeof(INS));
+		if (rec == NULL) {
+			error("out of memory for the inline functions");
+			exit(1);
+		}
+	}
+	copy = &rec[rec_nb++];
+	*copy = *ins;
+	copy->sym = keep_symbol(copy->sym);
+	if (copy->ins_type == T_SYMBOL)
+		copy->ins_data = (intptr_t)keep_symbol((SYMBOL *)copy->ins_data);
+	if (copy->imm_type == T_SYMBOL)
+		copy->imm_data = (intptr_t)keep_symbol((SYMBOL *)copy->imm_data);
+}
+
+/* the function writes something that isn't an i-code, i.e. #asm */
+void inline_reject (void)
+{
+	recording = false;
+}
+
+/* keep the function's i-codes, which must end with its only __return */
+void inline_end (int nbarg)
+{
+	INLINE_FN *fn;
+	int i;
+
+	if (!recording || !returned)
+		return;
+	recording = false;
+
+	if (find_inline(current_fn) >= 0)
+		return;
+
+	if (inl_nb == inl_max) {
+		inl_max = inl_max ? inl_max * 2 : 64;
+		inl = realloc(inl, inl_max * sizeof(INLINE_FN));
+		if (inl == NULL) {
+			error("out of memory for the inline functions");
+			exit(1);
+		}
+	}
+	fn = &inl[inl_nb++];
+	memset(fn, 0, sizeof(INLINE_FN));
+	strcpy(fn->name, current_fn);
+	fn->arg_count = nbarg;
+	fn->ins_nb = rec_nb;
+	fn->ins = malloc(rec_nb * sizeof(INS) + 1);
+	fn->label = malloc(rec_nb * sizeof(int) + 1);
+	if (fn->ins == NULL || fn->label == NULL) {
+		error("out of memory for the inline functions");
+		exit(1);
+	}
+	memcpy(fn->ins, rec, rec_nb * sizeof(INS));
+	for (i = 0; i < rec_nb; i++) {
+		if (rec[i].ins_code == I_LABEL || rec[i].ins_code == I_ALIAS)
+			fn->label[fn->label_nb++] = (int)rec[i].ins_data;
+	}
+}
+
+/* the new number for one of the function's labels */
+static int new_label (INLINE_FN *fn, int *map, int label)
+{
+	int i;
+
+	for (i = 0; i < fn->label_nb; i++) {
+		if (fn->label[i] == label)
+			return (map[i]);
+	}
+	return (label);
+}
+
+/*
+ * output the i-codes of an inline function instead of calling it, once
+ * its arguments have been pushed
+ */
+bool inline_call (const char *name, int argcnt)
+{
+	INLINE_FN *fn;
+	INS tmp;
+	int *map;
+	int i;
+
+	/* the arguments of a __fastcall are moved after they're generated */
+	if (arg_stack_flag || strcmp(name, current_fn) == 0)
+		return (false);
+
+	if ((i = find_inline(name)) < 0)
+		return (false);
+	fn = &inl[i];
+	if (fn->arg_count != argcnt)
+		return (false);
+
+	map = malloc(fn->label_nb * sizeof(int) + 1);
+	if (map == NULL) {
+		error("out of memory for the inline functions");
+		exit(1);
+	}
+	for (i = 0; i < fn->label_nb; i++)
+		map[i] = getlabel();
+
+	/* it's still called as far as the -foverlay-frames call graph is concerned */
+	frame_call(name);
+
+	for (i = 0; i < fn->ins_nb; i++) {
+		tmp = fn->ins[i];
+		if (tmp.ins_code == I_LABEL || tmp.ins_code == I_ALIAS || tmp.ins_type == T_LABEL)
+			tmp.ins_data = new_label(fn, map, (int)tmp.ins_data);
+		if (tmp.imm_type == T_LABEL)
+			tmp.imm_data = new_label(fn, map, (int)tmp.imm_data);
+		gen_ins(&tmp);
+	}
+	free(map);
+	return (true);
+}
@@ -0,0 +1,15 @@
+/*	File inline.h: inlining small functions */
+
+#ifndef _INLINE_H
+#define _INLINE_H
+
+/* the default for -finline-limit */
+#define INLINE_LIMIT 32
+
+void inline_begin (bool declared);
+void inline_add (INS *ins);
+void inline_reject (void);
+void inline_end (int nbarg);
+bool inline_call (const char *name, int argcnt);
+
+#endif
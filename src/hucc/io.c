@@ -10,6 +10,7 @@
 #include <string.h>
 #include "defs.h"
 #include "data.h"
+#include "flow.h"
 #include "io.h"
 #include "optimize.h"
 #include "preproc.h"
@@ -477,6 +478,7 @@ void outconst (int label)
  */
 void outlabel (int label)
 {
+	flow_label(label);
 	outstr(".LL");
 	outdec(label);
 }
@@ -27,9 +27,11 @@
 #include "const.h"
 #include "enum.h"
 #include "error.h"
+#include "frame.h"
 #include "function.h"
 #include "gen.h"
 #include "initials.h"
+#include "inline.h"
 #include "io.h"
 #include "lex.h"
 #include "main.h"
@@ -40,6 +42,7 @@
 #include "pseudo.h"
 #include "sym.h"
 #include "struct.h"
+#include "zpage.h"
 
 static char **link_libs = 0;
 static int link_lib_ptr;
@@ -193,6 +196,23 @@ int main (int argc, char *argv[])
 						user_norecurse = 0;
 						p += 8;
 					}
+					else if (!strcmp(p, "overlay-frames")) {
+						user_norecurse = 1;
+						overlay_frames = 1;
+						p += 13;
+					}
+					else if (!strcmp(p, "auto-zp")) {
+						auto_zp = 1;
+						p += 6;
+					}
+					else if (!strcmp(p, "inline-functions")) {
+						inline_functions = 1;
+						p += 15;
+					}
+					else if (!strncmp(p, "inline-limit=", 13)) {
+						inline_limit = atoi(p + 13);
+						p += strlen(p) - 1;
+					}
 					else if (!strcmp(p, "no-short-enums")) {
 						user_short_enums = 0;
 						p += 13;
@@ -471,6 +491,8 @@ unknown_option:
 			infile_ptr++;
 		first = 0;
 	}
+	dumpframes();
+	dumpzp();
 	fclose(output);
 	if (!errs && !sflag) {
 		if (user_outfile[0])
@@ -489,8 +511,13 @@ void usage (char *exename)
 	fprintf(stderr, "\nCompiler options:\n");
 	fprintf(stderr, "-Dsym[=val]       Define symbol 'sym' when compiling\n");
 	fprintf(stderr, "-O[val]           Invoke optimization (level <value>)\n");
+	fprintf(stderr, "-O3               Also optimize across the branches in a function\n");
 	fprintf(stderr, "-fno-far-arrays   Disable deprecated __far array syntax\n");
 	fprintf(stderr, "-fno-recursive    Optimize assuming non-recursive code\n");
+	fprintf(stderr, "-foverlay-frames  Also share the locals' memory between functions\n");
+	fprintf(stderr, "-fauto-zp         Put the most used variables in any free zero page\n");
+	fprintf(stderr, "-finline-functions Also inline small functions not declared \"inline\"\n");
+	fprintf(stderr, "-finline-limit=n  Inline functions of up to n i-codes (default %d)\n", INLINE_LIMIT);
 	fprintf(stderr, "-fno-short-enums  Always use signed int for enums\n");
 	fprintf(stderr, "-funsigned-char   Make \"char\" unsigned (the default)\n");
 	fprintf(stderr, "-fsigned-char     Make \"char\" signed\n");
@@ -544,9 +571,17 @@ void parse (void)
 			continue;
 		}
 
+		/* the next function can be inlined */
+		if (amatch("inline", 6) || amatch("__inline", 8)) {
+			inline_declared = 1;
+			continue;
+		}
+
 		if (amatch("extern", 6))
 			dodcls(EXTERN, NULL_TAG, 0);
 		else if (amatch("static", 6)) {
+			if (amatch("inline", 6) || amatch("__inline", 8))
+				inline_declared = 1;
 			if (amatch("const", 5)) {
 				/* XXX: what about the static part? */
 				dodcls(CONST, NULL_TAG, 0);
@@ -569,6 +604,7 @@ void parse (void)
 			dopsddef();
 		else
 			newfunc(NULL, 0, 0, 0, 0);
+		inline_declared = 0;
 	}
 	if (optimize)
 		flush_ins();
@@ -598,6 +634,8 @@ int dodcls (int stclass, TAG_SYMBOL *mtag, int is_struct)
 				t.otag = define_enum(t.sname, stclass & ~ZEROPAGE);
 			t.type_type = enum_types[t.otag].base;
 		}
+		if ((t.flags & F_VOLATILE) && (stclass & STORAGE) != CONST)
+			stclass |= VOLATILE;
 		err = declglb(t.type_type, stclass, mtag, t.otag, is_struct);
 	}
 	else if (stclass == PUBLIC)
@@ -821,6 +859,11 @@ void dumpglbs (void)
 				/* symbol is uninitialized */
 				if (pass == 0 && !(cptr->storage & ZEROPAGE))
 					continue;
+				/* -fauto-zp decides where it goes at the end */
+				if (zp_variable(cptr)) {
+					cptr->storage |= WRITTEN;
+					continue;
+				}
 				/* define space in bss */
 				if (i) {
 					i = 0;
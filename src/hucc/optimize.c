@@ -20,6 +20,8 @@
 #include "optimize.h"
 #include "io.h"
 #include "error.h"
+#include "flow.h"
+#include "inline.h"
 
 #ifdef _MSC_VER
  #include <intrin.h>
@@ -86,7 +88,7 @@ unsigned char icode_flags[] = {
 	/* I_ENTER              */	0,
 	/* I_RETURN             */	0,
 	/* I_MODSP              */	0,
-	/* I_PUSHARG_WR         */	IS_USEPR,
+	/* I_PUSHARG_WR         */	IS_USEPR + IS_PUSHWT,
 	/* I_PUSH_WR            */	IS_USEPR + IS_PUSHWT,
 	/* I_POP_WR             */	IS_POPWT,
 
@@ -103,6 +105,8 @@ unsigned char icode_flags[] = {
 	/* I_SWITCH_C_UR        */	IS_USEPR,
 	/* I_SWITCH_R_WR        */	IS_USEPR,
 	/* I_SWITCH_R_UR        */	IS_USEPR,
+	/* I_SWITCH_T_WR        */	IS_USEPR,
+	/* I_SWITCH_T_UR        */	IS_USEPR,
 	/* I_DEFAULT            */	0,
 	/* I_CASE               */	0,
 	/* I_ENDCASE            */	0,
@@ -216,6 +220,9 @@ unsigned char icode_flags[] = {
 	/* X_LDY_BMQ            */	0,
 	/* X_LDY_UMQ            */	0,
 
+	/* X_TAX                */	IS_USEPR,
+	/* X_TXA                */	0,
+
 	/* I_LD_WP              */	0,
 	/* I_LD_BP              */	IS_SBYTE,
 	/* I_LD_UP              */	IS_UBYTE,
@@ -431,6 +438,13 @@ unsigned char icode_flags[] = {
 	/* X_ST_WAXIQ           */	IS_USEPR + IS_STORE + IS_SHORT,
 	/* X_ST_UAXIQ           */	IS_USEPR + IS_STORE + IS_SHORT,
 
+	// i-codes for copying memory
+
+	/* I_COPY_WT            */	IS_USEPR + IS_POPWT,
+	/* X_COPY_WTQ           */	IS_USEPR + IS_POPWT,
+	/* X_TII                */	0,
+	/* X_FILL               */	0,
+
 	// i-codes for extending the primary register
 
 	/* I_EXT_BR             */	IS_USEPR,
@@ -768,6 +782,8 @@ enum ICODE short_icode[] = {
 	/* I_SWITCH_C_UR        */	0,
 	/* I_SWITCH_R_WR        */	0,
 	/* I_SWITCH_R_UR        */	0,
+	/* I_SWITCH_T_WR        */	0,
+	/* I_SWITCH_T_UR        */	0,
 	/* I_DEFAULT            */	0,
 	/* I_CASE               */	0,
 	/* I_ENDCASE            */	0,
@@ -881,6 +897,9 @@ enum ICODE short_icode[] = {
 	/* X_LDY_BMQ            */	0,
 	/* X_LDY_UMQ            */	0,
 
+	/* X_TAX                */	0,
+	/* X_TXA                */	0,
+
 	/* I_LD_WP              */	0,
 	/* I_LD_BP              */	0,
 	/* I_LD_UP              */	0,
@@ -1096,6 +1115,13 @@ enum ICODE short_icode[] = {
 	/* X_ST_WAXIQ           */	0,
 	/* X_ST_UAXIQ           */	0,
 
+	// i-codes for copying memory
+
+	/* I_COPY_WT            */	0,
+	/* X_COPY_WTQ           */	0,
+	/* X_TII                */	0,
+	/* X_FILL               */	0,
+
 	// i-codes for extending the primary register
 
 	/* I_EXT_BR             */	0,
@@ -1457,6 +1483,307 @@ bool is_zp_pointer (SYMBOL *sym)
 	return (sym->identity == POINTER && (sym->storage & ZEROPAGE));
 }
 
+/* is the operand a "volatile" variable that must always be reloaded? */
+bool is_volatile (INS *ins)
+{
+	return (ins->ins_type == T_SYMBOL && ins->ins_data != 0 &&
+		(((SYMBOL *)ins->ins_data)->storage & VOLATILE));
+}
+
+/* ----
+ * register tracking
+ * ----
+ * As each i-code leaves the instruction queue, keep track of the values
+ * that are known to be in the primary register (Y:A), in the A register
+ * on its own, and in the X register, so that loads of a value that is
+ * already there can be removed, even when the load is a long way from
+ * the instruction that put the value there.
+ *
+ * A byte that is wanted in A or X when it is already in the other is
+ * copied with a "tax" or "txa", and whether Y is known to be zero is
+ * tracked so that an unsigned char that is already in A isn't reloaded.
+ *
+ * Any i-code that isn't known to leave a register alone forgets all that
+ * is known about it, and so does a label, or any text that has been
+ * written to the output without going through here, such as "#asm".
+ * That includes every call and every store through a pointer, so even
+ * a variable whose address is taken is safe to track in between them,
+ * but a "volatile" variable can change at any time, and is never kept.
+ */
+
+#define REG_KEYS 4
+
+typedef struct {
+	int nb;
+	INS key[REG_KEYS];	/* I_LD_WI, I_LD_WM, I_LD_UM, I_LD_BM, X_LD_UIQ or X_LD_UMQ */
+} REG_VALUE;
+
+static REG_VALUE reg_pr;	/* Y:A */
+static REG_VALUE reg_a;		/* A */
+static REG_VALUE reg_x;		/* X */
+static bool reg_y_zero;
+static long reg_output = -1;
+
+static void reg_forget (REG_VALUE *reg)
+{
+	reg->nb = 0;
+}
+
+static bool reg_holds (REG_VALUE *reg, INS *key)
+{
+	int i;
+
+	for (i = 0; i < reg->nb; i++) {
+		if (reg->key[i].ins_code == key->ins_code && cmp_operands(&reg->key[i], key))
+			return (true);
+	}
+	return (false);
+}
+
+static void reg_add (REG_VALUE *reg, INS *key)
+{
+	if (reg->nb < REG_KEYS && !reg_holds(reg, key))
+		reg->key[reg->nb++] = *key;
+}
+
+static void reg_set (REG_VALUE *reg, INS *key)
+{
+	reg->nb = 0;
+	reg_add(reg, key);
+}
+
+/* the key for the value that an i-code loads or stores */
+static INS *reg_key (INS *ins, int code)
+{
+	static INS key;
+
+	memset(&key, 0, sizeof(INS));
+	key.ins_code = code;
+	key.ins_type = ins->ins_type;
+	key.ins_data = ins->ins_data;
+	if (code == X_LD_UIQ && key.ins_type == T_VALUE)
+		key.ins_data &= 0xFF;
+	return (&key);
+}
+
+/* the key for the low byte of a value in the primary register */
+static INS *reg_low (INS *key)
+{
+	return (reg_key(key, (key->ins_code == I_LD_WI) ? X_LD_UIQ : X_LD_UMQ));
+}
+
+/* set the primary register, and the A register with its low byte */
+static void reg_load (INS *key)
+{
+	reg_set(&reg_pr, key);
+	reg_set(&reg_a, reg_low(key));
+}
+
+/*
+ * forget the values in memory that a store can change, symbols with
+ * an offset from the same base are assumed to overlap, as are all of
+ * the -fno-recursive locals
+ */
+static bool reg_overlap (INS *store, INS *key)
+{
+	SYMBOL *a, *b;
+	char *p;
+	size_t n;
+
+	if (key->ins_code == I_LD_WI || key->ins_code == X_LD_UIQ)
+		return (false);
+	if (store->ins_type != T_SYMBOL || key->ins_type != T_SYMBOL)
+		return (true);
+
+	a = (SYMBOL *)store->ins_data;
+	b = (SYMBOL *)key->ins_data;
+	if ((a->storage & STORAGE) == AUTO && (b->storage & STORAGE) == AUTO)
+		return (true);
+
+	p = strstr(a->name, " + ");
+	n = p ? (size_t)(p - a->name) : strlen(a->name);
+	return (strncmp(a->name, b->name, n) == 0 &&
+		(b->name[n] == '\0' || b->name[n] == ' '));
+}
+
+static void reg_store (REG_VALUE *reg, INS *store)
+{
+	int i, j;
+
+	for (i = j = 0; i < reg->nb; i++) {
+		if (!reg_overlap(store, &reg->key[i]))
+			reg->key[j++] = reg->key[i];
+	}
+	reg->nb = j;
+}
+
+static void reg_memory (INS *store)
+{
+	reg_store(&reg_pr, store);
+	reg_store(&reg_a, store);
+	reg_store(&reg_x, store);
+}
+
+/* output an i-code, unless it loads a value that is already there */
+static void reg_gen_code (INS *ins)
+{
+	INS *key;
+	long pos;
+
+	inline_add(ins);
+
+	if (optimize < 2) {
+		gen_code(ins);
+		return;
+	}
+
+	/* was something else written to the output? */
+	pos = ftell(output);
+	if (pos < 0 || pos != reg_output) {
+		reg_forget(&reg_pr);
+		reg_forget(&reg_a);
+		reg_forget(&reg_x);
+		reg_y_zero = false;
+	}
+
+	switch (ins->ins_code) {
+	case I_INFO:
+	case I_FENCE:
+	case I_SHORT:
+	case I_DEF:
+		break;
+
+	case I_LD_WI:
+		key = reg_key(ins, I_LD_WI);
+		if (reg_holds(&reg_pr, key))
+			return;
+		reg_load(key);
+		reg_y_zero = (ins->ins_type == T_VALUE && (ins->ins_data & 0xFF00) == 0);
+		break;
+
+	case I_LD_WM:
+	case I_LD_UM:
+	case I_LD_BM:
+		if (ins->ins_type != T_SYMBOL || is_volatile(ins)) {
+			reg_forget(&reg_pr);
+			reg_forget(&reg_a);
+			reg_y_zero = (ins->ins_code == I_LD_UM);
+			break;
+		}
+		key = reg_key(ins, ins->ins_code);
+		if (reg_holds(&reg_pr, key))
+			return;
+		if (ins->ins_code == I_LD_UM && reg_y_zero && reg_holds(&reg_a, reg_low(key))) {
+			reg_add(&reg_pr, key);
+			return;
+		}
+		reg_load(key);
+		reg_y_zero = (ins->ins_code == I_LD_UM);
+		break;
+
+	case X_LD_UIQ:
+	case X_LD_WMQ:
+	case X_LD_BMQ:
+	case X_LD_UMQ:
+		reg_forget(&reg_pr);
+		if (ins->ins_code != X_LD_UIQ && (ins->ins_type != T_SYMBOL || is_volatile(ins))) {
+			reg_forget(&reg_a);
+			break;
+		}
+		key = reg_key(ins, (ins->ins_code == X_LD_UIQ) ? X_LD_UIQ : X_LD_UMQ);
+		if (reg_holds(&reg_a, key))
+			return;
+		if (reg_holds(&reg_x, key)) {
+			ins->ins_code = X_TXA;
+			ins->ins_type = 0;
+			ins->ins_data = 0;
+		}
+		reg_set(&reg_a, key);
+		break;
+
+	case X_LDX_WMQ:
+	case X_LDX_BMQ:
+	case X_LDX_UMQ:
+		if (ins->ins_type != T_SYMBOL || is_volatile(ins)) {
+			reg_forget(&reg_x);
+			break;
+		}
+		key = reg_key(ins, X_LD_UMQ);
+		if (reg_holds(&reg_x, key))
+			return;
+		reg_set(&reg_x, key);
+		if (reg_holds(&reg_a, key)) {
+			ins->ins_code = X_TAX;
+			ins->ins_type = 0;
+			ins->ins_data = 0;
+		}
+		break;
+
+	case I_ST_WM:
+	case X_ST_WMQ:
+		reg_memory(ins);
+		if (ins->ins_type == T_SYMBOL && !is_volatile(ins)) {
+			reg_add(&reg_pr, reg_key(ins, I_LD_WM));
+			reg_add(&reg_a, reg_key(ins, X_LD_UMQ));
+		}
+		break;
+
+	case I_ST_UM:
+	case X_ST_UMQ:
+		reg_memory(ins);
+		if (ins->ins_type == T_SYMBOL && !is_volatile(ins)) {
+			reg_add(&reg_a, reg_key(ins, X_LD_UMQ));
+			if (reg_y_zero)
+				reg_add(&reg_pr, reg_key(ins, I_LD_UM));
+		}
+		break;
+
+	case I_ST_WMIQ:
+	case I_ST_UMIQ:
+		reg_memory(ins);
+		reg_forget(&reg_pr);
+		reg_forget(&reg_a);
+		break;
+
+	case X_LD_WAX:
+	case X_LD_BAX:
+	case X_LD_UAX:
+		reg_forget(&reg_pr);
+		reg_forget(&reg_a);
+		reg_y_zero = (ins->ins_code == X_LD_UAX);
+		break;
+
+	case X_LD_UAXQ:
+		reg_forget(&reg_pr);
+		reg_forget(&reg_a);
+		break;
+
+	case X_ST_WAX:
+	case X_ST_UAX:
+	case X_ST_UAXQ:
+		reg_memory(ins);
+		break;
+
+	case X_ST_WAXQ:
+	case X_ST_WAXIQ:
+	case X_ST_UAXIQ:
+		reg_memory(ins);
+		reg_forget(&reg_pr);
+		reg_forget(&reg_a);
+		break;
+
+	default:
+		reg_forget(&reg_pr);
+		reg_forget(&reg_a);
+		reg_forget(&reg_x);
+		reg_y_zero = false;
+		break;
+	}
+
+	gen_code(ins);
+	reg_output = ftell(output);
+}
+
 /* ----
  * push_ins()
  * ----
@@ -1475,7 +1802,10 @@ void push_ins (INS *ins)
 		if (arg_stack_flag)
 			arg_push_ins(&q_ins[q_rd]);
 		else
-			gen_code(&q_ins[q_rd]);
+		if (flow_active())
+			flow_add(&q_ins[q_rd]);
+		else
+			reg_gen_code(&q_ins[q_rd]);
 
 		/* advance queue read pointer */
 		q_rd++;
@@ -1924,6 +2254,44 @@ lv1_loop:
 				}
 			}
 
+			/*
+			 *  __ld.wi		dst	-->	__tii		src, dst, size
+			 *  __push.wr
+			 *  __ld.wi		src
+			 *  __copy.wt		size
+			 *  __fence
+			 *
+			 *  __copy.wt		size	-->	__copy.wtq	size
+			 *  __fence
+			 *
+			 *  this optimizes a struct assignment.
+			 */
+			else if
+			((p_nb >= 2) &&
+			 (p[1]->ins_code == I_COPY_WT)
+			) {
+				/* replace code */
+				if
+				((p_nb >= 5) &&
+				 (p[2]->ins_code == I_LD_WI) &&
+				 (p[2]->ins_type == T_SYMBOL || p[2]->ins_type == T_VALUE) &&
+				 (p[3]->ins_code == I_PUSH_WR) &&
+				 (p[4]->ins_code == I_LD_WI) &&
+				 (p[4]->ins_type == T_SYMBOL || p[4]->ins_type == T_VALUE)
+				) {
+					p[4]->ins_code = X_TII;
+					p[4]->imm_type = p[4]->ins_type;
+					p[4]->imm_data = p[4]->ins_data;
+					p[4]->ins_type = p[2]->ins_type;
+					p[4]->ins_data = p[2]->ins_data;
+					p[4]->size = (int)p[1]->ins_data;
+					remove = 4;
+				} else {
+					p[1]->ins_code = X_COPY_WTQ;
+					remove = 1;
+				}
+			}
+
 			/*
 			 *  __st.{w/u}m		symbol	-->	__st.{w/u}mq	symbol
 			 *  __fence
@@ -6559,7 +6927,10 @@ void flush_ins (void)
 		if (arg_stack_flag)
 			arg_push_ins(&q_ins[q_rd]);
 		else
-			gen_code(&q_ins[q_rd]);
+		if (flow_active())
+			flow_add(&q_ins[q_rd]);
+		else
+			reg_gen_code(&q_ins[q_rd]);
 
 		/* advance and wrap queue read pointer */
 		--q_nb;
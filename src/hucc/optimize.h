@@ -30,6 +30,7 @@ extern int q_wr;
 extern int q_nb;
 
 bool is_small_array (SYMBOL *sym);
+bool is_volatile (INS *ins);
 void push_ins (INS *ins);
 void try_swap_order (int linst, int lseqn, INS *operation);
 void flush_ins (void);
@@ -21,6 +21,8 @@
 #include "defs.h"
 #include "data.h"
 #include "error.h"
+#include "frame.h"
+#include "inline.h"
 #include "io.h"
 #include "lex.h"
 #include "optimize.h"
@@ -269,6 +271,7 @@ void doasm (void)
 {
 	char * source;
 	flush_ins();	/* David - optimize.c related */
+	inline_reject();
 	ol(".dbg\tclear");
 	cmode = 0;
 	FOREVER {
@@ -277,6 +280,7 @@ void doasm (void)
 			break;
 		if (feof(input))
 			break;
+		frame_asm(line);
 #if 1
 		source = line;
 		if (source[0] == ' ' || source[0] == '\t') {
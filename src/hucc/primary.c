@@ -13,6 +13,7 @@
 #include "enum.h"
 #include "error.h"
 #include "expr.h"
+#include "frame.h"
 #include "gen.h"
 #include "io.h"
 #include "lex.h"
@@ -360,6 +361,7 @@ int primary (LVALUE *lval, int comma, bool *deferred)
 			if (ptr && (ptr->identity == FUNCTION)) {
 				lval->symbol = ptr;
 				lval->indirect = 0;
+				frame_address(ptr->name);
 				immed(T_SYMBOL, (intptr_t)ptr);
 				return (0);
 			}
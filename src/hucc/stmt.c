@@ -88,7 +88,6 @@ int doldcls (int stclass)
 	}
 	blanks();
 
-	/* we don't do optimizations that would require "volatile" */
 	if (match_type(&t, NO, YES)) {
 #if ULI_NORECURSE == 0
 		if (norecurse && (stclass & STORAGE) != LSTATIC)
@@ -109,6 +108,9 @@ int doldcls (int stclass)
 				t.otag = define_enum(t.sname, stclass & ~ZEROPAGE);
 			t.type_type = enum_types[t.otag].base;
 		}
+		/* the optimizer won't reuse a "volatile" value that is in a register */
+		if (t.flags & F_VOLATILE)
+			stclass |= VOLATILE;
 		declloc(t.type_type, stclass, t.otag);
 	}
 	else
@@ -611,8 +613,112 @@ void dogoto (void)
 }
 
 /*
- *	dump switch table (only if at least one case)
+ *	switch() lowering
+ *
+ * A switch() is turned into either a single jump table for a dense range
+ * of cases, a single compare scan, or a binary tree of unsigned compares
+ * whose leaves are small jump tables and compare scans.
  *
+ * The choice is made with a simple cost model that estimates the average
+ * cycles to reach a case, and the bytes of code and tables. A byte of ROM
+ * is considered to be worth 1/SW_WEIGHT of a cycle.
+ */
+#define SW_WEIGHT	8
+
+typedef struct {
+	int value;	/* case value, or its unsigned bit-pattern in a tree */
+	int source;	/* case value as written in the source */
+	int label;
+	int order;	/* position of the case in the source */
+} SWCASE;
+
+typedef struct {
+	int first;	/* index of the first case in the leaf */
+	int count;
+	bool range;	/* jump table, or compare scan */
+} SWLEAF;
+
+static SWCASE sw_case[SWST_COUNT];
+static SWLEAF sw_leaf[SWST_COUNT];
+static bool sw_byte;
+static int sw_default;
+
+static int sw_by_value (const void *a, const void *b)
+{
+	const SWCASE *p = a;
+	const SWCASE *q = b;
+
+	if (p->value != q->value)
+		return ((p->value < q->value) ? -1 : 1);
+	return (p->order - q->order);
+}
+
+static int sw_by_order (const void *a, const void *b)
+{
+	return (((const SWCASE *)b)->order - ((const SWCASE *)a)->order);
+}
+
+/* cycles for a leaf to dispatch an average case */
+static int sw_leaf_cycles (int count, bool range)
+{
+	if (range)
+		return (sw_byte ? 23 : 32);
+	return (sw_byte ? 15 + 13 * (count + 1) / 2 : 9 + 15 * (count + 1) / 2);
+}
+
+/* bytes of code and table for a leaf */
+static int sw_leaf_bytes (int first, int count, bool range)
+{
+	if (range)
+		return ((sw_byte ? 16 : 22) + 2 * (sw_case[first + count - 1].value - sw_case[first].value + 2));
+	return (sw_byte ? 16 + 3 * count + 2 : 21 + 4 * count + 2);
+}
+
+/* cycles and bytes for each __switch_t node in the tree */
+#define SW_NODE_CYCLES	(sw_byte ? 7 : 10)
+#define SW_NODE_BYTES	(sw_byte ? 7 : 11)
+
+/* the jump table and scan loop both index the table with 8-bit X */
+#define SW_RANGE_MAX	127
+#define SW_SCAN_MAX	(sw_byte ? 127 : 126)
+
+/* split a run of leaves so that each side has about half of the cases */
+static int sw_split (int lo, int hi)
+{
+	int total = 0;
+	int left = 0;
+	int mid;
+
+	for (mid = lo; mid <= hi; mid++)
+		total += sw_leaf[mid].count;
+	for (mid = lo + 1; mid < hi; mid++) {
+		if (2 * (left + sw_leaf[mid - 1].count) >= total) {
+			/* split on whichever side of the half-way point is closer */
+			if (mid > lo + 1 && (total - 2 * left) < (2 * (left + sw_leaf[mid - 1].count) - total))
+				--mid;
+			break;
+		}
+		left += sw_leaf[mid - 1].count;
+	}
+	return (mid);
+}
+
+/* total cycles to dispatch every case in a run of leaves */
+static long sw_tree_cycles (int lo, int hi)
+{
+	long cycles = 0;
+	int mid, i;
+
+	if (lo == hi)
+		return ((long)sw_leaf[lo].count * sw_leaf_cycles(sw_leaf[lo].count, sw_leaf[lo].range));
+
+	for (i = lo; i <= hi; i++)
+		cycles += sw_leaf[i].count * SW_NODE_CYCLES;
+	mid = sw_split(lo, hi);
+	return (cycles + sw_tree_cycles(lo, mid - 1) + sw_tree_cycles(mid, hi));
+}
+
+/*
  * Table format for 16-bit comparisons:
  *
  * !table:	dw	val3		; +01 x=2
@@ -633,6 +739,59 @@ void dogoto (void)
  *		dw	jmp2            ; +78 x=2
  *		dw	jmp1            ; +9A x=3
  *
+ * The scan starts at the end of the table, so the cases are put into
+ * the table in reverse order to test them in the order of the source.
+ */
+static void sw_scan (int first, int count)
+{
+	SWCASE scan[SWST_COUNT];
+	int j, column;
+
+	memcpy(scan, &sw_case[first], count * sizeof(SWCASE));
+	qsort(scan, count, sizeof(SWCASE), sw_by_order);
+
+	out_ins(sw_byte ? I_SWITCH_C_UR : I_SWITCH_C_WR, T_VALUE, count);
+	flush_ins();
+	outstr("\n!table:");
+
+	j = 0;
+	while (j < count) {
+		if (sw_byte)
+			defbyte();
+		else
+			defword();
+		column = 8;
+		while (column--) {
+			outdec(scan[j++].source);
+			if ((column == 0) || (j == count)) {
+				nl();
+				break;
+			}
+			outstr(", ");
+		}
+	}
+
+	defword();
+	outlabel(sw_default);
+	nl();
+
+	j = 0;
+	while (j < count) {
+		defword();
+		column = 8;
+		while (column--) {
+			outlabel(scan[j++].label);
+			if ((column == 0) | (j == count)) {
+				nl();
+				break;
+			}
+			outstr(", ");
+		}
+	}
+	nl();
+}
+
+/*
  * Table format for min-max ranges:
  *
  * !table:	dw	jmp1		; +01 x=\1
@@ -641,119 +800,176 @@ void dogoto (void)
  *		dw	jmp4		; +67 x=\2
  *		dw	jmpdefault	; +89 x=\2+1
  */
-void dumpswitch (int *ws)
+static void sw_range (int first, int count)
 {
-	int i, j, column;
-	int mincase = 131072;
-	int maxcase = -65536;
+	int label[SW_RANGE_MAX + 2];
+	int mincase = sw_case[first].value;
+	int maxcase = sw_case[first + count - 1].value;
 	int numcases;
-	bool do_range;
-	bool is_byte;
-	int label[128];
-
-	is_byte = (ws[WS_SWITCH_TYPE] == CCHAR || ws[WS_SWITCH_TYPE] == CUCHAR);
+	int j, column;
 
-	i = ws[WS_CASE_INDEX];
-	j = swstp;
-	numcases = j - i;
-	while (j-- > i) {
-		if (mincase > swstcase[j])
-			mincase = swstcase[j];
-		if (maxcase < swstcase[j])
-			maxcase = swstcase[j];
+	numcases = (maxcase - mincase) + 1;
+	if ((mincase == 2) && (numcases < 126)) {
+		/* this makes the code a bit smaller and faster */
+		mincase = 0; numcases += 2;
 	}
-	if (numcases == 0) {
-		error("no case statements in switch()!");
-		return;
+	if ((mincase == 1) && (numcases < 127)) {
+		/* this makes the code a bit smaller and faster */
+		mincase = 0; numcases += 1;
+	}
+
+	out_ins_ex(sw_byte ? I_SWITCH_R_UR : I_SWITCH_R_WR, T_VALUE, mincase, T_VALUE, maxcase);
+	flush_ins();
+	outstr("\n!table:");
+
+	for (j = 0; j < numcases; ++j)
+		label[j] = sw_default;
+	for (j = first + count; j-- > first;)
+		label[(sw_case[j].value - mincase)] = sw_case[j].label;
+
+	j = 0;
+	while (j < numcases) {
+		defword();
+		column = 8;
+		while (column--) {
+			outlabel(label[j++]);
+			if ((column == 0) || (j == numcases)) {
+				nl();
+				break;
+			}
+			outstr(", ");
+		}
 	}
-	if (numcases > 127) {
-		error("too many case statements in switch(), there must be less than 127");
+
+	defword();
+	outlabel(sw_default);
+	nl();
+}
+
+/* emit a balanced tree of compares down to the leaves */
+static void sw_tree (int lo, int hi)
+{
+	int mid, label;
+
+	if (lo == hi) {
+		if (sw_leaf[lo].range)
+			sw_range(sw_leaf[lo].first, sw_leaf[lo].count);
+		else
+			sw_scan(sw_leaf[lo].first, sw_leaf[lo].count);
 		return;
 	}
 
-	/* is it beneficial to encode this switch() as a range? */
-	do_range = (maxcase + 1 - mincase) <= (numcases * 2);
+	mid = sw_split(lo, hi);
+	label = getlabel();
+	out_ins_ex(sw_byte ? I_SWITCH_T_UR : I_SWITCH_T_WR,
+		T_VALUE, sw_case[sw_leaf[mid].first].value, T_LABEL, label);
+	sw_tree(lo, mid - 1);
+	gnlabel(label);
+	sw_tree(mid, hi);
+}
 
-	/* create the array of labels for each entry in the range */
-	if (do_range) {
-		numcases = (maxcase - mincase) + 1;
-		if ((mincase == 2) && (numcases < 126)) {
-			/* this makes the code a bit smaller and faster */
-			mincase = 0; numcases += 2;
-		}
-		if ((mincase == 1) && (numcases < 127)) {
-			/* this makes the code a bit smaller and faster */
-			mincase = 0; numcases += 1;
-		}
+/*
+ *	dump switch table (only if at least one case)
+ */
+void dumpswitch (int *ws)
+{
+	long cost[SWST_COUNT + 1];
+	int from[SWST_COUNT + 1];
+	bool range[SWST_COUNT + 1];
+	long tree, scan, c;
+	int numcases, numleaves;
+	int i, j, n, count;
+
+	sw_byte = (ws[WS_SWITCH_TYPE] == CCHAR || ws[WS_SWITCH_TYPE] == CUCHAR);
+	sw_default = ws[WS_DEFAULT_LABEL];
 
-		out_ins_ex(is_byte ? I_SWITCH_R_UR : I_SWITCH_R_WR, T_VALUE, mincase, T_VALUE, maxcase);
-		flush_ins();
-		outstr("\n!table:");
+	numcases = swstp - ws[WS_CASE_INDEX];
+	if (numcases == 0) {
+		error("no case statements in switch()!");
+		return;
+	}
 
-		for (j = 0; j < numcases; ++j)
-			label[j] = ws[WS_DEFAULT_LABEL];
-		j = swstp;
-		while (j-- > ws[WS_CASE_INDEX])
-			label[(swstcase[j] - mincase)] = swstlabel[j];
+	/* sort the cases, and drop duplicates after the first in the source */
+	for (i = 0; i < numcases; i++) {
+		sw_case[i].value = swstcase[ws[WS_CASE_INDEX] + i];
+		sw_case[i].source = sw_case[i].value;
+		sw_case[i].label = swstlabel[ws[WS_CASE_INDEX] + i];
+		sw_case[i].order = i;
+	}
+	qsort(sw_case, numcases, sizeof(SWCASE), sw_by_value);
+	for (i = n = 1; i < numcases; i++) {
+		if (sw_case[i].value != sw_case[n - 1].value)
+			sw_case[n++] = sw_case[i];
+	}
+	numcases = n;
 
-		j = 0;
-		while (j < numcases) {
-			defword();
-			column = 8;
-			while (column--) {
-				outlabel(label[j++]);
-				if ((column == 0) || (j == numcases)) {
-					nl();
-					break;
+	/* is it beneficial to encode this switch() as a single range? */
+	j = sw_case[numcases - 1].value - sw_case[0].value;
+	if (j < SW_RANGE_MAX && (j + 1) <= (numcases * 2)) {
+		sw_range(0, numcases);
+		return;
+	}
+
+	/* the tree compares unsigned bit-patterns, the leaves are exact */
+	for (i = 0; i < numcases; i++)
+		sw_case[i].value &= (sw_byte ? 0xFF : 0xFFFF);
+	qsort(sw_case, numcases, sizeof(SWCASE), sw_by_value);
+
+	/*
+	 * Find the cheapest way to split the sorted cases into leaves,
+	 * where cost[j] is for the first j cases and the leaf that ends
+	 * at case j starts at from[j].
+	 */
+	cost[0] = 0;
+	for (j = 1; j <= numcases; j++) {
+		cost[j] = LONG_MAX;
+		for (i = j - 1; i >= 0; i--) {
+			count = j - i;
+			if (count > SW_SCAN_MAX &&
+			    (sw_case[j - 1].value - sw_case[i].value) >= SW_RANGE_MAX)
+				break;
+			if (count <= SW_SCAN_MAX) {
+				c = cost[i] + (long)numcases * (sw_leaf_bytes(i, count, false) + SW_NODE_BYTES) +
+					(long)SW_WEIGHT * count * sw_leaf_cycles(count, false);
+				if (c < cost[j]) {
+					cost[j] = c; from[j] = i; range[j] = false;
 				}
-				outstr(", ");
 			}
-		}
-
-		defword();
-		outlabel(ws[WS_DEFAULT_LABEL]);
-		nl();
-	} else {
-		out_ins(is_byte ? I_SWITCH_C_UR : I_SWITCH_C_WR, T_VALUE, numcases);
-		flush_ins();
-		outstr("\n!table:");
-
-		j = swstp;
-		while (j > ws[WS_CASE_INDEX]) {
-			if (is_byte)
-				defbyte();
-			else
-				defword();
-			column = 8;
-			while (column--) {
-				outdec(swstcase[--j]);
-				if ((column == 0) || (j == ws[WS_CASE_INDEX])) {
-					nl();
-					break;
+			if ((sw_case[j - 1].value - sw_case[i].value) < SW_RANGE_MAX) {
+				c = cost[i] + (long)numcases * (sw_leaf_bytes(i, count, true) + SW_NODE_BYTES) +
+					(long)SW_WEIGHT * count * sw_leaf_cycles(count, true);
+				if (c < cost[j]) {
+					cost[j] = c; from[j] = i; range[j] = true;
 				}
-				outstr(", ");
 			}
 		}
+	}
 
-		defword();
-		outlabel(ws[WS_DEFAULT_LABEL]);
-		nl();
-
-		j = swstp;
-		while (j > ws[WS_CASE_INDEX]) {
-			defword();
-			column = 8;
-			while (column--) {
-				outlabel(swstlabel[--j]);
-				if ((column == 0) | (j == ws[WS_CASE_INDEX])) {
-					nl();
-					break;
-				}
-				outstr(", ");
-			}
+	numleaves = 0;
+	for (j = numcases; j > 0; j = from[j])
+		numleaves++;
+	for (i = numleaves, j = numcases; j > 0; j = from[j]) {
+		--i;
+		sw_leaf[i].first = from[j];
+		sw_leaf[i].count = j - from[j];
+		sw_leaf[i].range = range[j];
+	}
+
+	/* is a single compare scan still cheaper than the tree? */
+	if (numleaves > 1 && numcases <= SW_SCAN_MAX) {
+		tree = SW_WEIGHT * sw_tree_cycles(0, numleaves - 1) + (long)numcases * (numleaves - 1) * SW_NODE_BYTES;
+		for (i = 0; i < numleaves; i++)
+			tree += (long)numcases * sw_leaf_bytes(sw_leaf[i].first, sw_leaf[i].count, sw_leaf[i].range);
+		scan = (long)numcases * (SW_WEIGHT * sw_leaf_cycles(numcases, false) + sw_leaf_bytes(0, numcases, false));
+		if (scan <= tree) {
+			sw_leaf[0].first = 0;
+			sw_leaf[0].count = numcases;
+			sw_leaf[0].range = false;
+			numleaves = 1;
 		}
-		nl();
 	}
+
+	sw_tree(0, numleaves - 1);
 }
 
 /*
@@ -349,6 +349,9 @@ void declloc (char typ, char stclass, int otag)
 	int elements = 0;
 	char sname[NAMESIZE];
 	int totalk = 0;
+	char vol = stclass & VOLATILE;
+
+	stclass &= ~VOLATILE;
 
 	for (;;) {
 		SYMBOL * sym = NULL;
@@ -426,6 +429,8 @@ void declloc (char typ, char stclass, int otag)
 				if (typ == CSTRUCT)
 					loc->tagidx = otag;
 				loc->ptr_order = ptr_order;
+				sym->storage |= vol;
+				loc->storage |= vol;
 
 				/* link the local and global symbols together */
 				sym->linked = loc;
@@ -447,6 +452,7 @@ void declloc (char typ, char stclass, int otag)
 				if (typ == CSTRUCT)
 					sym->tagidx = otag;
 				sym->ptr_order = ptr_order;
+				sym->storage |= vol;
 			}
 			break;
 		}
@@ -581,16 +587,72 @@ int needarguments (void)
 	return arg_count;
 }
 
+/*
+ *	hash chains for findglb() and findloc()
+ *
+ *	symbols are always added at the top of their part of the symtab,
+ *	so each chain is in descending order, and the symbols that were
+ *	dropped when glbsym_index or locsym_index was reset are always at
+ *	the head of a chain, where they are trimmed off before any search
+ */
+static SYMBOL *glb_hash[SYMHASHSZ];
+static SYMBOL *loc_hash[SYMHASHSZ];
+static SYMBOL *sym_next[SYMTBSZ];
+static short sym_chain[SYMTBSZ];
+
+/*
+ *	hash the same part of a name that astreq() compares
+ *
+ */
+static int sym_hash (const char *sname)
+{
+	unsigned hash = 0;
+	int k;
+
+	for (k = 0; k < NAMEMAX && alphanum(sname[k]); k++)
+		hash = (hash << 5) + hash + (unsigned char)sname[k];
+
+	return (int)(hash & (SYMHASHSZ - 1));
+}
+
+/*
+ *	remove the symbols at or above "end" from the head of a chain
+ *
+ */
+static SYMBOL *sym_trim (SYMBOL **chain, SYMBOL *end)
+{
+	while (*chain && *chain >= end)
+		*chain = sym_next[*chain - symtab];
+	return (*chain);
+}
+
+/*
+ *	add a new symbol, which is always at "end", to its chain
+ *
+ */
+static void sym_link (SYMBOL **table, SYMBOL *ptr)
+{
+	int hash = sym_hash(ptr->name);
+
+	/* the slot may still be on the chain of the symbol that it held */
+	sym_trim(&table[sym_chain[ptr - symtab]], ptr);
+	sym_trim(&table[hash], ptr);
+
+	sym_chain[ptr - symtab] = hash;
+	sym_next[ptr - symtab] = table[hash];
+	table[hash] = ptr;
+}
+
 SYMBOL *findglb (char *sname)
 {
 	SYMBOL *ptr;
 
-	ptr = symtab + STARTGLB;
-	while (ptr != (symtab + glbsym_index)) {
+	ptr = sym_trim(&glb_hash[sym_hash(sname)], symtab + glbsym_index);
+	while (ptr) {
 		if (astreq(sname, ptr->name, NAMEMAX))
 			return (ptr);
 
-		ptr++;
+		ptr = sym_next[ptr - symtab];
 	}
 	return (NULL);
 }
@@ -599,11 +661,12 @@ SYMBOL *findloc (char *sname)
 {
 	SYMBOL *ptr;
 
-	ptr = symtab + locsym_index;
-	while (ptr != (symtab + STARTLOC)) {
-		ptr--;
+	ptr = sym_trim(&loc_hash[sym_hash(sname)], symtab + locsym_index);
+	while (ptr) {
 		if (astreq(sname, ptr->name, NAMEMAX))
 			return (ptr);
+
+		ptr = sym_next[ptr - symtab];
 	}
 	return (NULL);
 }
@@ -646,6 +709,9 @@ SYMBOL *addglb (char *sname, char id, char typ, int value, char stor, SYMBOL *re
 	cptr->ptr_order = 0;
 	cptr->funcptr_order = 0;
 
+	if (!replace)
+		sym_link(glb_hash, cptr);
+
 	if (id == FUNCTION)
 		cptr->alloc_size = 0;
 	else if (id == POINTER)
@@ -695,6 +761,7 @@ SYMBOL *addloc (char *sname, char id, char typ, int value, char stclass, int siz
 	cptr->alloc_size = size;
 	cptr->linked = NULL;
 	cptr->arg_count = -1;
+	sym_link(loc_hash, cptr);
 	locsym_index++;
 	return (cptr);
 }
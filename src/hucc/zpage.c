@@ -0,0 +1,376 @@
+/*	File zpage.c: moving the most used variables into zero page
+ *
+ *	With -fauto-zp, every reference to a static variable, or to the
+ *	locals of a -fno-recursive function, is counted as the code is
+ *	generated, and weighted by how deeply it is nested in loops.
+ *
+ *	The uninitialized variables, and the functions' frames (or the one
+ *	area that -foverlay-frames shares between them), are then
+ *	output at the end of the compile, ordered by how much they would
+ *	gain per byte of zero page, so that the assembler can put as many
+ *	of them as it can fit into whatever zero page is still free after
+ *	the libraries have been included (see "hucc-final.asm").
+ *
+ *	Only the variables' addresses change, so the code is the same if
+ *	they end up in the BSS instead.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "defs.h"
+#include "data.h"
+#include "code.h"
+#include "error.h"
+#include "io.h"
+#include "optimize.h"
+#include "zpage.h"
+
+/* bigger variables are left in the BSS */
+#define ZP_MAX_SIZE 8
+
+/* loops that are nested deeper than this are weighted as this deep */
+#define ZP_MAX_DEPTH 4
+
+typedef struct {
+	char label[NAMEALLOC + 16];	/* its label in the output */
+	char name[NAMEALLOC * 2 + 16];	/* its name in the report */
+	int size;		/* its size, or 0 if it isn't a candidate */
+	int bytes;		/* the code bytes that zero page would save */
+	int cycles;		/* the cycles, weighted by the loop depth */
+	bool frame;		/* it holds a function's locals */
+	int end;		/* the end of its locals in the overlay */
+} ZPVAR;
+
+static ZPVAR *zpvar;
+static int zpvar_nb;
+static int zpvar_max;
+
+static int find_zpvar (const char *label)
+{
+	int i;
+
+	for (i = 0; i < zpvar_nb; i++) {
+		if (strcmp(zpvar[i].label, label) == 0)
+			return (i);
+	}
+
+	if (zpvar_nb == zpvar_max) {
+		zpvar_max = zpvar_max ? zpvar_max * 2 : 256;
+		zpvar = realloc(zpvar, zpvar_max * sizeof(ZPVAR));
+		if (zpvar == NULL) {
+			error("out of memory for the zero page variables");
+			exit(1);
+		}
+	}
+	memset(&zpvar[zpvar_nb], 0, sizeof(ZPVAR));
+	strncpy(zpvar[zpvar_nb].label, label, sizeof(zpvar[0].label) - 1);
+	strncpy(zpvar[zpvar_nb].name, label, sizeof(zpvar[0].name) - 1);
+	return (zpvar_nb++);
+}
+
+static int loop_depth (void)
+{
+	int *ptr;
+	int depth = 0;
+
+	for (ptr = ws; ptr != wsptr; ptr += WS_COUNT) {
+		if (ptr[WS_TYPE] != WS_SWITCH)
+			depth++;
+	}
+	return (depth < ZP_MAX_DEPTH ? depth : ZP_MAX_DEPTH);
+}
+
+/*
+ * the function that owns a -fno-recursive local, which is named
+ * "_name_end - n", and isn't current_fn if it was inlined
+ */
+static void local_owner (SYMBOL *sym, char *owner)
+{
+	char *p = strstr(sym->name, "_end - ");
+	size_t len;
+
+	if (sym->name[0] != '_' || p == NULL) {
+		strcpy(owner, current_fn);
+		return;
+	}
+	len = p - (sym->name + 1);
+	memcpy(owner, sym->name + 1, len);
+	owner[len] = '\0';
+}
+
+/* the C name of a variable, for the report */
+static void zp_name (ZPVAR *var, SYMBOL *sym, const char *owner)
+{
+	switch (sym->storage & STORAGE) {
+	case AUTO:
+		sprintf(var->name, "%s() locals", owner);
+		break;
+	case LSTATIC:
+		/* the label is "SLn", the local symbol has the C name */
+		if (sym->linked == NULL)
+			break;
+		if (owner)
+			sprintf(var->name, "%s (static in %s())", sym->linked->name, owner);
+		else
+			sprintf(var->name, "%s (static)", sym->linked->name);
+		break;
+	default:
+		strcpy(var->name, sym->name);
+		break;
+	}
+}
+
+/* count a reference to a variable in an i-code */
+void zp_count (INS *ins)
+{
+	SYMBOL *sym;
+	char label[NAMEALLOC + 16];
+	char owner[NAMEALLOC];
+	int i, n;
+
+	if (!auto_zp || ins->ins_type != T_SYMBOL)
+		return;
+
+	sym = (SYMBOL *)ins->ins_data;
+	if (sym->identity == FUNCTION || (sym->storage & ZEROPAGE))
+		return;
+
+	switch (sym->storage & STORAGE) {
+	case AUTO:
+		/* only a -fno-recursive local has a label */
+		if (!norecurse)
+			return;
+		local_owner(sym, owner);
+		sprintf(label, "__%s_locals", owner);
+		break;
+	case LSTATIC:
+		strcpy(label, sym->name);
+		break;
+	case PUBLIC:
+	case EXTERN:
+	case STATIC:
+		sprintf(label, "_%s", sym->name);
+		break;
+	default:
+		return;
+	}
+
+	i = find_zpvar(label);
+	if (zpvar[i].bytes == 0)
+		zp_name(&zpvar[i], sym, ((sym->storage & STORAGE) == AUTO) ? owner : current_fn);
+
+	/* a word is usually accessed by two instructions, and a loop */
+	/* is assumed to run 8 times, so each level multiplies by 8 */
+	n = (icode_flags[ins->ins_code] & (IS_UBYTE | IS_SBYTE)) ? 1 : 2;
+	zpvar[i].bytes += n;
+	zpvar[i].cycles += n << (3 * loop_depth());
+}
+
+/*
+ * leave an uninitialized variable for dumpzp() to output, if it could
+ * go into zero page
+ */
+bool zp_variable (SYMBOL *sym)
+{
+	char label[NAMEALLOC + 16];
+	int i;
+
+	/* the variables in "globals.h" are shared with the CD overlays */
+	if (!auto_zp || globals_h_in_process ||
+	    (sym->identity != VARIABLE && sym->identity != POINTER) ||
+	    sym->alloc_size > ZP_MAX_SIZE)
+		return (false);
+
+	if ((sym->storage & STORAGE) == LSTATIC)
+		strcpy(label, sym->name);
+	else
+		sprintf(label, "_%s", sym->name);
+
+	i = find_zpvar(label);
+	zpvar[i].size = sym->alloc_size;
+	if (strcmp(zpvar[i].name, label) == 0)
+		zp_name(&zpvar[i], sym, NULL);
+	return (true);
+}
+
+/* leave a function's -fno-recursive frame for dumpzp() */
+bool zp_frame (const char *fn, int size)
+{
+	char label[NAMEALLOC + 16];
+	int i;
+
+	if (!auto_zp)
+		return (false);
+
+	sprintf(label, "__%s_locals", fn);
+	i = find_zpvar(label);
+	if (zpvar[i].bytes == 0)
+		return (false);
+
+	zpvar[i].size = size;
+	zpvar[i].frame = true;
+	return (true);
+}
+
+/* count the references to an overlaid frame as ones to the overlay */
+void zp_overlaid (const char *fn, int end)
+{
+	char label[NAMEALLOC + 16];
+	int i, j;
+
+	if (!auto_zp)
+		return;
+
+	sprintf(label, "__%s_locals", fn);
+	i = find_zpvar(label);
+	j = find_zpvar("__overlay_frames");
+	zpvar[j].bytes += zpvar[i].bytes;
+	zpvar[j].cycles += zpvar[i].cycles;
+	zpvar[i].bytes = 0;
+	zpvar[i].cycles = 0;
+	zpvar[i].end = end;
+}
+
+/* leave the -foverlay-frames area for dumpzp() */
+bool zp_overlay (int size)
+{
+	int i;
+
+	if (!auto_zp)
+		return (false);
+
+	i = find_zpvar("__overlay_frames");
+	if (zpvar[i].bytes == 0)
+		return (false);
+
+	strcpy(zpvar[i].name, "overlaid locals");
+	zpvar[i].size = size;
+	return (true);
+}
+
+/* the most cycles saved per byte of zero page first */
+static int compare_zpvar (const void *a, const void *b)
+{
+	const ZPVAR *va = *(const ZPVAR **)a;
+	const ZPVAR *vb = *(const ZPVAR **)b;
+	long long ga = (long long)va->cycles * vb->size;
+	long long gb = (long long)vb->cycles * va->size;
+
+	if (ga != gb)
+		return (ga < gb ? 1 : -1);
+	if (va->bytes != vb->bytes)
+		return (va->bytes < vb->bytes ? 1 : -1);
+	return (strcmp(va->label, vb->label));
+}
+
+static void frame_end (ZPVAR *v)
+{
+	char label[NAMEALLOC + 16];
+
+	/* "__name_locals" -> "__name_end" */
+	strcpy(label, v->label);
+	strcpy(label + strlen(label) - 6, "end");
+	outstr(label);
+	outstr("\t=\t");
+	outstr(v->label);
+	outstr(" + ");
+	outdec(v->size);
+	nl();
+}
+
+/* the overlaid frames' "__name_end" must follow the overlay's label */
+static void overlay_ends (void)
+{
+	char label[NAMEALLOC + 16];
+	int i;
+
+	for (i = 0; i < zpvar_nb; i++) {
+		if (zpvar[i].end == 0)
+			continue;
+		strcpy(label, zpvar[i].label);
+		strcpy(label + strlen(label) - 6, "end");
+		outstr(label);
+		outstr("\t=\t__overlay_frames + ");
+		outdec(zpvar[i].end);
+		nl();
+	}
+}
+
+/*
+ * output the variables, with the ones that could be in zero page in the
+ * order that the assembler should try them, and a report of how much
+ * each one is expected to gain
+ */
+void dumpzp (void)
+{
+	ZPVAR **order;
+	char line[NAMEALLOC * 2 + 64];
+	int i, n, nb;
+
+	if (!auto_zp)
+		return;
+
+	order = malloc((zpvar_nb + 1) * sizeof(ZPVAR *));
+	if (order == NULL) {
+		error("out of memory for the zero page variables");
+		exit(1);
+	}
+	for (i = nb = 0; i < zpvar_nb; i++) {
+		if (zpvar[i].size && zpvar[i].bytes)
+			order[nb++] = &zpvar[i];
+	}
+	qsort(order, nb, sizeof(ZPVAR *), compare_zpvar);
+
+	if (nb) {
+		nl();
+		outstr(";***********************\n");
+		outstr("; -fauto-zp\n");
+		outstr(";\n;    cycles  bytes  size  variable\n");
+		for (i = 0; i < nb; i++) {
+			snprintf(line, sizeof(line), ";  %8d  %5d  %4d  %s\n",
+				order[i]->cycles, order[i]->bytes, order[i]->size, order[i]->name);
+			outstr(line);
+		}
+		outstr(";\n; cycles are weighted by the loop depth\n");
+		outstr(";***********************\n");
+		nl();
+		outstr("HUCC_AUTO_ZP\t=\t1\n\n");
+		outstr("__auto_zp\t.macro\n");
+		for (i = 0; i < nb; i++) {
+			ot("auto_zp_var\t");
+			outstr(order[i]->label);
+			outstr(", ");
+			outdec(order[i]->size);
+			outstr(", ");
+			outdec(order[i]->bytes);
+			outstr(", ");
+			outdec(order[i]->cycles);
+			nl();
+			if (order[i]->frame)
+				frame_end(order[i]);
+			if (strcmp(order[i]->label, "__overlay_frames") == 0)
+				overlay_ends();
+		}
+		ol(".endm");
+	}
+
+	/* the variables that are never used stay in the BSS */
+	for (i = n = 0; i < zpvar_nb; i++) {
+		if (zpvar[i].size == 0 || zpvar[i].bytes)
+			continue;
+		if (n++ == 0) {
+			nl();
+			gbss();
+		}
+		outstr(zpvar[i].label);
+		outstr(":\n");
+		defstorage();
+		outdec(zpvar[i].size);
+		nl();
+	}
+	gtext();
+	free(order);
+}
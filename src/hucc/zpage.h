@@ -0,0 +1,13 @@
+/*	File zpage.h: moving the most used variables into zero page */
+
+#ifndef _ZPAGE_H
+#define _ZPAGE_H
+
+void zp_count (INS *ins);
+bool zp_variable (SYMBOL *sym);
+bool zp_frame (const char *fn, int size);
+void zp_overlaid (const char *fn, int end);
+bool zp_overlay (int size);
+void dumpzp (void);
+
+#endif
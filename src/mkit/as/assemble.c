@@ -30,6 +30,7 @@ assemble(int do_label)
 	char c;
 	int flag;
 	int ip, i, j;			/* prlnbuf pointer */
+	int start;			/* location of the instruction */
 
 	/* init variables */
 	lablptr = NULL;
@@ -294,8 +295,13 @@ assemble(int do_label)
 	}
 
 	/* generate code */
-	if (opflg == PSEUDO)
+	start = loccnt;
+
+	if (opflg == PSEUDO) {
+		/* "call" generates an instruction */
+		in_opcode = (opval == P_CALL);
 		do_pseudo(&ip);
+	}
 	else if (labldef(LOCATION) == -1)
 		return;
 	else {
@@ -307,11 +313,18 @@ assemble(int do_label)
 			fatal_error("Instructions are not allowed in this section!");
 
 		/* generate code */
+		in_opcode = 1;
 		opproc(&ip);
 
 		/* reset last label pointer */
 		lastlabl = NULL;
 	}
+
+	/* add the instruction to the procedure's cycle count */
+	if (in_opcode) {
+		code_cycles(start);
+		in_opcode = 0;
+	}
 }
 
 
@@ -50,6 +50,7 @@ struct t_machine fuji = {
 	fuji_pack_8x8_tile,	/* pack_8x8_tile */
 	NULL,			/* pack_16x16_tile */
 	NULL,			/* pack_16x16_sprite */
-	fuji_write_header	/* write_header */
+	fuji_write_header,	/* write_header */
+	NULL			/* cycles */
 };
 
@@ -101,7 +101,8 @@ unsigned short pseudo_allowed[] = {
 /* P_FLAGMAP     */	IN_CODE + IN_HOME + IN_DATA,
 /* P_MASKMAP     */	IN_CODE + IN_HOME + IN_DATA,
 /* P_OVERMAP     */	IN_CODE + IN_HOME + IN_DATA,
-/* P_SWIZZLE     */	ANYWHERE
+/* P_SWIZZLE     */	ANYWHERE,
+/* P_OUT         */	ANYWHERE
 };
 
 
@@ -1213,6 +1214,8 @@ do_incbin(int *ip)
 			uint32_t info, *fill_a;
 			uint8_t *fill_b;
 
+			rom_use(bank, loccnt, size);
+
 			fread(&rom[bank][loccnt], 1, size, fp);
 
 			if (section == S_DATA && asm_opt[OPT_DATAPAGE] != 0)
@@ -1672,6 +1675,8 @@ do_ds(int *ip)
 		}
 
 		if (section_flags[section] & S_IS_ROM) {
+			rom_use(bank, loccnt, nbytes);
+
 			memset(&rom[bank][loccnt], filler, nbytes);
 
 			if (section == S_DATA && asm_opt[OPT_DATAPAGE] != 0)
@@ -1762,6 +1767,70 @@ do_fail(int *ip)
 }
 
 
+/* ----
+ * do_out()
+ * ----
+ * .out pseudo - print a message in the last pass
+ *
+ * .out "text" [, expression | "text" ...]
+ */
+
+void
+do_out(int *ip)
+{
+	char message[256];
+	char text[256];
+	int length = 0;
+	char c;
+
+	/* define label */
+	labldef(LOCATION);
+
+	/* build the message from the strings and values */
+	for (;;) {
+		/* skip spaces */
+		while (isspace(prlnbuf[*ip]))
+			(*ip)++;
+
+		if (prlnbuf[*ip] == '\"') {
+			if (!getstring(ip, text, sizeof(text) - 1))
+				return;
+		}
+		else {
+			if (!evaluate(ip, 0, 0))
+				return;
+			snprintf(text, sizeof(text), "%d", (int)value);
+		}
+
+		if (length + strlen(text) >= sizeof(message)) {
+			error("Message too long!");
+			return;
+		}
+		strcpy(message + length, text);
+		length += (int)strlen(text);
+
+		/* check if there's another part */
+		c = prlnbuf[(*ip)++];
+
+		if (c != ',')
+			break;
+	}
+
+	/* check error */
+	if (c != ';' && c != '\0') {
+		error("Syntax error!");
+		return;
+	}
+
+	/* output message and line on last pass */
+	if (pass == LAST_PASS) {
+		printf("%s\n", message);
+		loadlc(loccnt, 0);
+		println();
+	}
+}
+
+
 /* ----
  * do_section()
  * ----
@@ -1916,6 +1985,7 @@ do_incchr(int *ip)
 
 				/* putbuffer only copies on the LAST_PASS and we really need the data */
 				if (pass != LAST_PASS && !stop_pass) {
+					rom_use(bank, loccnt, size);
 					memcpy(tile[nb_tile].data, tile_data, size);
 				}
 				putbuffer(tile_data, size);
@@ -1957,6 +2027,7 @@ do_incchr(int *ip)
 		while (nb_tile != value) {
 			/* putbuffer only copies on the LAST_PASS and we really need the data */
 			if (pass != LAST_PASS && !stop_pass) {
+				rom_use(bank, loccnt, size);
 				memcpy(&rom[bank][loccnt], tile_data, size);
 			}
 			putbuffer(tile_data, size);
@@ -2148,6 +2219,8 @@ do_align(int *ip)
 				uint32_t info, *fill_a;
 				uint8_t *fill_b;
 
+				rom_use(bank, oldloc, loccnt - oldloc);
+
 				memset(&rom[bank][oldloc], 0, loccnt - oldloc);
 				memset(&map[bank][oldloc], section + (page << 5), loccnt - oldloc);
 
@@ -3011,17 +3084,14 @@ set_section(unsigned char new_section)
  * .outzx0 pseudo (optype == 1)
  */
 
-#include "format.h"
-#include "shrink.h"
-
 void
 do_outbin(int *ip)
 {
-	unsigned char *addr = NULL;
 	unsigned offset = 0;
 	unsigned length = 0;
 	unsigned window = 0;
-	unsigned need = 0;
+	unsigned written = 0;
+	long lst_pos = -1;
 	char fname[PATHSZ];
 
 	/* ignore this until the last pass */
@@ -3094,7 +3164,7 @@ do_outbin(int *ip)
 
 		/* close current output file */
 		if (out_fp) {
-			fclose(out_fp);
+			outbin_close(out_fp);
 			out_fp = NULL;
 		}
 
@@ -3113,32 +3183,13 @@ do_outbin(int *ip)
 	if (!check_eol(ip))
 		return;
 
-	/* check end of line */
+	/* queue the data, compressed blocks that are not labelled */
+	/* do not need their length yet, so they can run in parallel */
 	if (length) {
-		/* locate the data */
-		addr = &rom[0][0] + offset;
-
-		/* compress the data */
-		if (optype == 1) {
-			need = salvador_get_max_compressed_size(length);
-			addr = calloc(need, 1);
-			length = salvador_compress(&rom[0][0] + offset, addr, length, need, 0, window, 0, NULL, NULL);
-			if (length > need) {
-				error("Error while compressing the data!");
-				free(addr);
-				return;
-			}
-		}
-
-		/* write the data */
-		if (fwrite(addr, 1, length, out_fp) != length) {
-			fatal_error("Unable to write data to the current output file!");
-		}
-
-		/* do we want to compress the data */
-		if (need) {
-			free(addr);
-		}
+		rom_use(0, offset, length);
+		written = outbin_queue(out_fp, &rom[0][0] + offset, length, window, optype, (optype == 1) && (lablptr != NULL));
+		if (written)
+			length = written;
 	}
 
 	/* assign the output length to the label (if there is one) */
@@ -3149,7 +3200,11 @@ do_outbin(int *ip)
 
 	/* output line */
 	if (pass == LAST_PASS) {
+		if (lst_fp)
+			lst_pos = ftell(lst_fp);
 		loadlc(value, 1);
 		println();
+		if ((optype == 1) && length && !written && lst_fp && ftell(lst_fp) != lst_pos)
+			outbin_listed(lst_pos);
 	}
 }
@@ -55,7 +55,9 @@
 
 /* line buffer length */
 #define LAST_CH_POS	(32768 - 4)
+#define VALUE_FIELD	20
 #define SFIELD		30
+#define CYCLE_FIELD	64
 
 /* symbol name size, including length byte and '\0' */
 /* must be <= 129 if "char" is signed */
@@ -196,6 +198,7 @@
 #define P_MASKMAP	75	// .maskmap
 #define P_OVERMAP	76	// .overmap
 #define P_SWIZZLE	77	// .swizzle
+#define P_OUT		78	// .out
 
 /* symbol type */
 #define UNDEF	1	/* undefined - may be zero page */
@@ -257,6 +260,20 @@
 /* size of various hashing tables */
 #define HASH_COUNT	256
 
+/* initial size of the symbol hash tables (must be a power of two) */
+#define SYM_HASH_INIT	1024
+
+/* memory limit for the decoded .PCX/.PNG/.BMP image cache */
+#define IMAGE_CACHE_SIZE (64 * 1024 * 1024)
+
+/* limits for running .OUTZX0 compression on multiple threads */
+#define MAX_JOBS	64
+#define OUTBIN_JOBS	256
+#define OUTBIN_BYTES	(64 * 1024 * 1024)
+
+/* search limit for each attempt of the --binpack procedure packer */
+#define BINPACK_NODES	1000000
+
 /* size of remembered filename strings */
 #define STR_POOL_SIZE 65536
 
@@ -281,11 +298,14 @@ typedef struct t_file {
 	int number;
 	int included;
 	const char *name;
+	char *text;
+	char **lines;
+	int line_count;
 } t_file;
 
 typedef struct t_input {
 	struct t_file *file;
-	FILE *fp;
+	int line;
 	int lnum;
 	int if_level;
 } t_input;
@@ -308,6 +328,9 @@ typedef struct t_proc {
 	int kickc;
 	int defined;
 	int is_skippable;
+	int instructions;
+	int cycles;
+	int cycles_most;
 } t_proc;
 
 /* update pc_symbol when adding or changing! */
@@ -341,6 +364,8 @@ typedef struct t_symbol {
 	unsigned char type;
 	unsigned char flags;
 	signed char palette;
+	struct t_symbol *link;
+	struct t_symbol *owner;
 } t_symbol;
 
 typedef struct t_branch {
@@ -405,6 +430,7 @@ typedef struct t_machine {
 	int (*pack_16x16_tile)(unsigned char *, void *, int, int);
 	int (*pack_16x16_sprite)(unsigned char *, void *, int, int);
 	void (*write_header)(FILE *, int);
+	int (*cycles)(const unsigned char *, int *);
 } t_machine;
 
 #endif // DEFS_H
@@ -44,7 +44,9 @@ t_symbol pc_symbol = {
 	CONSTANT,       /* reason */
 	DEFABS,         /* type */
 	FLG_RESERVED,   /* flags */
-	0               /* palette */
+	0,              /* palette */
+	NULL,           /* link */
+	NULL            /* owner */
 };
 
 
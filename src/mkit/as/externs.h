@@ -84,7 +84,6 @@ extern int func_idx;
 extern int infile_error;
 extern int infile_num;
 extern FILE *out_fp;                            /* file pointers, output */
-extern FILE *in_fp;                             /* input */
 extern FILE *lst_fp;                            /* listing */
 extern int lst_line;                            /* listing */
 extern t_file *lst_tfile;                       /* listing */
@@ -101,7 +100,10 @@ extern t_machine nes;
 extern t_machine pce;
 extern t_machine fuji;
 extern t_opcode *inst_tbl[HASH_COUNT];          /* instructions hash table */
-extern t_symbol *hash_tbl[HASH_COUNT];          /* label hash table */
+extern t_symbol **hash_tbl;                     /* global label hash table */
+extern t_symbol **local_tbl;                    /* local label hash table */
+extern int hash_size;                           /* number of buckets in hash_tbl */
+extern int local_size;                          /* number of buckets in local_tbl */
 extern t_symbol *lablptr;                       /* label pointer into symbol table */
 extern t_symbol *glablptr;                      /* pointer to the latest defined global symbol */
 extern t_symbol *scopeptr;                      /* pointer to the latest defined scope label */
@@ -151,6 +153,13 @@ extern int in_final;                            /* set when in xxxx-final.asm in
 extern int preproc_inblock;                     /* C-style comment: within block comment */
 extern int preproc_sfield;                      /* C-style comment: SFIELD as a variable */
 extern int preproc_modidx;                      /* C-style comment: offset to modified char */
+extern int stats_opt;                           /* NZ to show internal statistics */
+extern char zx0_cache_dir[PATHSZ];              /* directory for cached .OUTZX0 data */
+extern int jobs_opt;                            /* number of threads for .OUTZX0 */
+extern int binpack_opt;                         /* NZ to search for a tighter .proc packing */
+extern int cluster_opt;                         /* NZ to put .procs that call each other together */
+extern int cycles_opt;                          /* NZ to show instruction cycles in the listing */
+extern int in_opcode;                           /* NZ while assembling an instruction */
 
 /* this is set when suppressing the listing output of stripped procedures */
 /* n.b. fully compatible with 2-pass assembly because code is still built */
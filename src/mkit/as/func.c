@@ -78,7 +78,7 @@ func_look(void)
 	int hash;
 
 	/* search the function in the hash table */
-	hash = symhash();
+	hash = symhash() & (HASH_COUNT - 1);
 	func_ptr = func_tbl[hash];
 	while (func_ptr) {
 		if (!strcmp(symbol, func_ptr->label->name))
@@ -136,7 +136,7 @@ func_install(int ip)
 	}
 	strcpy(func_ptr->line, func_line);
 
-	hash = symhash();
+	hash = symhash() & (HASH_COUNT - 1);
 	func_ptr->next = func_tbl[hash];
 	func_tbl[hash] = func_ptr;
 
@@ -36,6 +36,21 @@ static int incpath_size = 0;
 static int incpath_offset_count = 0;
 static int incpath_count = 0;
 
+/* remember which file each include name was found in */
+typedef struct t_incname {
+	struct t_incname *next;
+	const char *name;
+	t_file *file;
+} t_incname;
+
+static t_incname *incname_hash[HASH_COUNT];
+
+/* source cache statistics for "--stats" */
+static int source_files;
+static int source_lines;
+static long source_bytes;
+static long source_hits;
+
 /* ----
  * void cleanup_path()
  * ----
@@ -303,8 +318,7 @@ start:
 
 	/* get a line */
 	i = SFIELD;
-	c = getc(in_fp);
-	if (c == EOF) {
+	if (input_file[infile_num].line >= input_file[infile_num].file->line_count) {
 		if (close_input()) {
 			if (stop_pass != 0 || ((extra_file == NULL) && (hucc_final == 0) && (kickc_final == 0))) {
 				return (-1);
@@ -330,24 +344,13 @@ start:
 		}
 		goto start;
 	}
-	for (;;) {
-		/* check for the end of line */
-		if (c == '\r') {
-			c = getc(in_fp);
-			if (c == '\n' || c == EOF)
-				break;
-			ungetc(c, in_fp);
-			break;
-		}
-		if (c == '\n' || c == EOF)
-			break;
 
+	/* copy the line from the source cache */
+	ptr = input_file[infile_num].file->lines[input_file[infile_num].line++];
+	while ((c = *ptr++) != '\0') {
 		/* store char in the line buffer */
 		prlnbuf[i] = c;
 		i += (i < LAST_CH_POS) ? 1 : 0;
-
-		/* get next char */
-		c = getc(in_fp);
 	}
 	prlnbuf[i] = '\0';
 
@@ -463,6 +466,9 @@ remember_file(const char *name, int hash)
 	file->name = remember_string(name, strlen(name) + 1);
 	file->number = ++file_count;
 	file->included = 0;
+	file->text = NULL;
+	file->lines = NULL;
+	file->line_count = 0;
 
 	file->next = file_hash[hash];
 	file_hash[hash] = file;
@@ -556,6 +562,162 @@ make_filelist(void)
 }
 
 
+/* ----
+ * load_source()
+ * ----
+ * read a whole source file into memory and split it into lines,
+ * so that later passes never need to read it again
+ */
+
+static int
+load_source(t_file *file, FILE *fp)
+{
+	char *text;
+	char **lines;
+	long size;
+	long i;
+	int count;
+	int line;
+
+	/* get file size */
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	if (size < 0)
+		size = 0;
+
+	/* read the file */
+	if ((text = malloc(size + 1)) == NULL) {
+		fatal_error("Not enough memory to read source file!");
+		return (-1);
+	}
+	if ((long)fread(text, 1, size, fp) != size) {
+		free(text);
+		fatal_error("Unable to read source file!");
+		return (-1);
+	}
+	text[size] = '\0';
+
+	/* count the lines, a final line without an EOL still counts */
+	count = 0;
+	for (i = 0; i < size; i++) {
+		if (text[i] == '\n' || (text[i] == '\r' && text[i + 1] != '\n'))
+			count++;
+	}
+	if (size && text[size - 1] != '\n' && text[size - 1] != '\r')
+		count++;
+
+	if ((lines = malloc((count + 1) * sizeof(char *))) == NULL) {
+		free(text);
+		fatal_error("Not enough memory to read source file!");
+		return (-1);
+	}
+
+	/* split the text into lines at "\n", "\r\n" or "\r" */
+	line = 0;
+	lines[0] = text;
+	for (i = 0; i < size; i++) {
+		if (text[i] == '\r') {
+			text[i] = '\0';
+			if (text[i + 1] == '\n')
+				text[++i] = '\0';
+			lines[++line] = &text[i + 1];
+		}
+		else if (text[i] == '\n') {
+			text[i] = '\0';
+			lines[++line] = &text[i + 1];
+		}
+	}
+
+	file->text = text;
+	file->lines = lines;
+	file->line_count = count;
+
+	source_files++;
+	source_lines += count;
+	source_bytes += size;
+
+	/* ok */
+	return (0);
+}
+
+
+/* ----
+ * find_source()
+ * ----
+ * find the cached source file for an include name, reading
+ * the file from disk only the first time that it is used
+ */
+
+static t_file *
+find_source(const char *name)
+{
+	FILE *fp;
+	int hash;
+	t_file * file;
+	t_incname * incname;
+
+	/* has this name already been found? */
+	hash = filename_crc(name) & (HASH_COUNT - 1);
+	for (incname = incname_hash[hash]; incname != NULL; incname = incname->next) {
+		if (strcmp(incname->name, name) == 0) {
+			source_hits++;
+			strcpy(full_path, incname->file->name);
+			return (incname->file);
+		}
+	}
+
+	/* open the file */
+	if ((fp = open_file(name, "rb")) == NULL)
+		return (NULL);
+
+	/* remember all filenames */
+	file = lookup_file(full_path);
+	if (file == NULL) {
+		fclose(fp);
+		return (NULL);
+	}
+
+	/* two different names can find the same file */
+	if (file->lines == NULL) {
+		if (load_source(file, fp) != 0) {
+			fclose(fp);
+			return (NULL);
+		}
+	}
+	fclose(fp);
+
+	/* remember the name */
+	if ((incname = malloc(sizeof(t_incname))) == NULL) {
+		fatal_error("No memory left to remember filename!");
+		return (NULL);
+	}
+	incname->name = remember_string(name, strlen(name) + 1);
+	incname->file = file;
+	incname->next = incname_hash[hash];
+	incname_hash[hash] = incname;
+
+	return (file);
+}
+
+
+/* ----
+ * source_stats()
+ * ----
+ * show how much file I/O the source cache has saved
+ */
+
+void
+source_stats(FILE *fp)
+{
+	fprintf(fp, "\nSource Cache:\n");
+	fprintf(fp, "  %d files, %d lines, %ld bytes read once\n",
+		source_files, source_lines, source_bytes);
+	fprintf(fp, "  %ld file opens served from memory\n", source_hits);
+}
+
+
 /* ----
  * open_input()
  * ----
@@ -565,7 +727,6 @@ make_filelist(void)
 int
 open_input(const char *name)
 {
-	FILE *fp;
 	char *p;
 	t_file * file;
 	char temp[PATHSZ + 4];
@@ -579,7 +740,6 @@ open_input(const char *name)
 	/* backup current input file infos */
 	if (infile_num) {
 		input_file[infile_num].lnum = slnum;
-		input_file[infile_num].fp = in_fp;
 	}
 
 	/* auto add the .asm file extension */
@@ -590,20 +750,12 @@ open_input(const char *name)
 		name = temp;
 	}
 
-	/* open the file */
-	if ((fp = open_file(name, "r")) == NULL)
-		return (-1);
-
-	/* remember all filenames */
-	file = lookup_file(full_path);
-	if (file == NULL) {
-		fclose(fp);
+	/* find the file in the source cache, or read it */
+	if ((file = find_source(name)) == NULL)
 		return (-1);
-	}
 
 	/* do not include the same file twice in a pass */
 	if (file->included) {
-		fclose(fp);
 		return (0);
 	}
 
@@ -611,10 +763,9 @@ open_input(const char *name)
 	file->included = 1;
 
 	/* update input file infos */
-	in_fp = fp;
 	slnum = 0;
 	infile_num++;
-	input_file[infile_num].fp = fp;
+	input_file[infile_num].line = 0;
 	input_file[infile_num].if_level = if_level;
 	input_file[infile_num].file = file;
 	if ((pass == LAST_PASS) && (xlist) && (list_level)) {
@@ -658,11 +809,9 @@ close_input(void)
 	if (infile_num <= 1)
 		return (-1);
 
-	fclose(in_fp);
 	infile_num--;
 	infile_error = -1;
 	slnum = input_file[infile_num].lnum;
-	in_fp = input_file[infile_num].fp;
 	if ((pass == LAST_PASS) && (xlist) && (list_level)) {
 		fprintf(lst_fp, "%*c", SFIELD-1, ' ');
 		fprintf(lst_fp, "#[%i]   \"%s\"\n", infile_num, input_file[infile_num].file->name);
@@ -676,6 +825,19 @@ close_input(void)
 }
 
 
+/* ----
+ * rewind_input()
+ * ----
+ * restart the main input file for the next pass
+ */
+
+void
+rewind_input(void)
+{
+	input_file[1].line = 0;
+}
+
+
 /* ----
  * open_file()
  * ----
@@ -241,6 +241,7 @@ struct t_opcode base_pseudo[] = {
 	{NULL,  "NOMLIST",      do_nomlist,     PSEUDO, P_NOMLIST, 0},
 	{NULL,  "OPT",          do_opt,         PSEUDO, P_OPT,     0},
 	{NULL,  "ORG",          do_org,         PSEUDO, P_ORG,     0},
+	{NULL,  "OUT",          do_out,         PSEUDO, P_OUT,     0},
 	{NULL,  "OUTBIN",       do_outbin,      PSEUDO, P_OUTBIN,  0},
 	{NULL,  "OUTZX0",       do_outbin,      PSEUDO, P_OUTBIN,  1},
 	{NULL,  "PAGE",         do_page,        PSEUDO, P_PAGE,    0},
@@ -291,6 +292,7 @@ struct t_opcode base_pseudo[] = {
 	{NULL, ".NOMLIST",      do_nomlist,     PSEUDO, P_NOMLIST, 0},
 	{NULL, ".OPT",          do_opt,         PSEUDO, P_OPT,     0},
 	{NULL, ".ORG",          do_org,         PSEUDO, P_ORG,     0},
+	{NULL, ".OUT",          do_out,         PSEUDO, P_OUT,     0},
 	{NULL, ".OUTBIN",       do_outbin,      PSEUDO, P_OUTBIN,  0},
 	{NULL, ".OUTZX0",       do_outbin,      PSEUDO, P_OUTBIN,  1},
 	{NULL, ".PAGE",         do_page,        PSEUDO, P_PAGE,    0},
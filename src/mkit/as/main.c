@@ -54,8 +54,7 @@ char lst_fname[256];	/* listing */
 char sym_fname[256];	/* symbol table */
 char zeroes[2048];	/* CDROM sector full of zeores */
 char *prg_name;		/* program name */
-FILE *in_fp;		/* file pointers, input */
-FILE *lst_fp;		/* listing */
+FILE *lst_fp;		/* file pointers, listing */
 int lst_line = 1;	/* listing */
 t_file * lst_tfile;	/* listing */
 FILE *out_fp;		/* .outbin output */
@@ -341,18 +340,23 @@ main(int argc, char **argv)
 	static t_file *final_source = NULL;
 
 	static int cd_type;
-	static const char *cmd_line_options = "I:OSg:hl:mo:s";
+	static const char *cmd_line_options = "I:OSg:hj:l:mo:s";
 	static const struct option cmd_line_long_options[] = {
 		{"include",     required_argument, 0,           'I'},
 		{"pack",        no_argument,       0,           'O'},
 		{"fullsegment", no_argument,       0,           'S'},
 		{"help",        no_argument,       0,           'h'},
+		{"jobs",        required_argument, 0,           'j'},
 		{"listing",     required_argument, 0,           'l'},
 		{"macro",       no_argument,       0,           'm'},
 		{"output",      required_argument, 0,           'o'},
 		{"segment",     no_argument,       0,           's'},
+		{"zx0-cache",   required_argument, 0,           'z'},
 
+		{"binpack",     no_argument,       &binpack_opt, 1 },
 		{"cd",          no_argument,       &cd_type,     1 },
+		{"cluster",     no_argument,       &cluster_opt, 1 },
+		{"cycles",      no_argument,       &cycles_opt, 1 },
 		{"develo",      no_argument,       &develo_opt,  1 },
 		{"hucc",        no_argument,       &hucc_opt,    1 },
 		{"ipl",         no_argument,       &ipl_opt,     1 },
@@ -367,6 +371,7 @@ main(int argc, char **argv)
 		{"sf2",         no_argument,       &sf2_opt,     1 },
 		{"sgx",         no_argument,       &sgx_opt,     1 },
 		{"srec",        no_argument,       &srec_opt,    1 },
+		{"stats",       no_argument,       &stats_opt,   1 },
 		{"strip",       no_argument,       &strip_opt,   1 },
 		{"trim",        no_argument,       &trim_opt,    1 },
 
@@ -430,6 +435,10 @@ main(int argc, char **argv)
 	strip_opt = 0;
 	kickc_opt = 0;
 	newproc_opt = 0;
+	binpack_opt = 0;
+	cluster_opt = 0;
+	cycles_opt = 0;
+	jobs_opt = 1;
 
 	/* display assembler version message */
 	printf("%s\n\n", machine->asm_title);
@@ -482,6 +491,19 @@ main(int argc, char **argv)
 				help();
 				return (0);
 
+			case 'j':
+				/* optarg can have a leading space on linux/mac */
+				while (*optarg == ' ') { ++optarg; }
+
+				/* get number of threads */
+				jobs_opt = atoi(optarg);
+
+				if ((isdigit(*optarg) == 0) || (jobs_opt < 1) || (jobs_opt > MAX_JOBS)) {
+					fprintf(stderr, "%s: \"-j\" option must be followed by a number from 1 to %d\n", argv[0], MAX_JOBS);
+					return (1);
+				}
+				break;
+
 			case 'l':
 				/* optarg can have a leading space on linux/mac */
 				while (*optarg == ' ') { ++optarg; }
@@ -522,6 +544,21 @@ main(int argc, char **argv)
 				dump_seg = 1;
 				break;
 
+			case 'z':
+				/* optarg can have a leading space on linux/mac */
+				while (*optarg == ' ') { ++optarg; }
+
+				if (*optarg == '-') {
+					fprintf(stderr, "%s: directory name missing after \"--zx0-cache\"\n", argv[0]);
+					return (1);
+				}
+				if (strlen(optarg) >= PATHSZ - 32) {
+					fprintf(stderr, "%s: cache directory name too long, maximum %d characters\n", argv[0], PATHSZ - 33);
+					return (1);
+				}
+				strcpy(zx0_cache_dir, optarg);
+				break;
+
 			/* when a long-option has been processed */
 			case 0:
 				break;
@@ -554,8 +591,16 @@ main(int argc, char **argv)
 		strip_opt = 1;
 	}
 
+	/* with newproc, every call but a jmp goes through a thunk, even */
+	/* within the same bank, so there is nothing for --cluster to do */
+	if (cluster_opt && newproc_opt)
+	{
+		fprintf(stderr, "%s: warning: \"--cluster\" has no effect with \"--newproc\" or \"--hucc\"\n", argv[0]);
+		cluster_opt = 0;
+	}
+
 	/* enable optimized procedure packing if stripping */
-	asm_opt[OPT_OPTIMIZE] |= (newproc_opt | strip_opt);
+	asm_opt[OPT_OPTIMIZE] |= (newproc_opt | strip_opt | binpack_opt | cluster_opt);
 
 	if (machine->type == MACHINE_PCE) {
 		/* Adjust cdrom type values ... */
@@ -673,20 +718,17 @@ main(int argc, char **argv)
 		exit(1);
 	}
 
-	/* clear the ROM array */
-	memset(rom, 0xFF, MAX_BANKS * 8192);
-	memset(map, 0xFF, MAX_BANKS * 8192);
-
 	/* are we creating a custom PCE CDROM IPL? */
 	if (ipl_opt) {
 		/* initialize the ipl */
+		rom_use(0, 2048, 4096);
 		prepare_ipl(&rom[0][2048]);
 		memset(&map[0][2048], S_DATA + (1 << 5), 4096);
 	}
 
 	/* clear symbol hash tables */
+	symtbl_init();
 	for (i = 0; i < HASH_COUNT; i++) {
-		hash_tbl[i] = NULL;
 		macro_tbl[i] = NULL;
 		func_tbl[i] = NULL;
 		inst_tbl[i] = NULL;
@@ -988,15 +1030,25 @@ main(int argc, char **argv)
 		}
 
 		/* rewind input file */
-		rewind(in_fp);
+		rewind_input();
 	}
 
+	/* make sure that every bank that is output has been initialized */
+	rom_use(0, 0, ((call_bank > max_bank) ? call_bank + 1 : max_bank + 1) * 8192);
+
 	/* close .outbin file */
+	outbin_flush();
 	if (out_fp) {
 		fclose(out_fp);
 		out_fp = NULL;
 	}
 
+	/* the deferred .outzx0 jobs can still fail */
+	if (errcnt) {
+		fprintf(ERROUT, "# %d error(s)\n", errcnt);
+		exit(1);
+	}
+
 	/* close listing file */
 	if (lst_fp) {
 		if ((list_level >= 2) && (errcnt == 0)) {
@@ -1005,9 +1057,6 @@ main(int argc, char **argv)
 		fclose(lst_fp);
 	}
 
-	/* close input file */
-	fclose(in_fp);
-
 	/* dump the rom */
 	if (errcnt == 0 && no_rom_file == 0) {
 		/* cd-rom */
@@ -1230,6 +1279,7 @@ main(int argc, char **argv)
 					}
 				} else {
 					/* write the whole rom in one go */
+					rom_use(0, 0, num_banks * 8192);
 					fwrite(rom, 8192, num_banks, fp);
 				}
 
@@ -1238,6 +1288,15 @@ main(int argc, char **argv)
 		}
 	}
 
+	/* show the internal statistics before lablsort() destroys the hash table */
+	if (stats_opt) {
+		symtbl_stats(stdout);
+		source_stats(stdout);
+		image_stats(stdout);
+		rom_stats(stdout);
+		zx0_stats(stdout);
+	}
+
 	/* dump the symbol table */
 	if ((fp = fopen(sym_fname, "w")) != NULL) {
 		/* this reorders the symbols, making them unusable for assembling! */
@@ -1295,10 +1354,14 @@ help(void)
 		printf("-gL        : output .SYM for mesen2 debugging using .LST file\n");
 		printf("-h         : display this help message\n");
 		printf("-I         : add include path\n");
+		printf("-j <1..%d> : number of threads for .outzx0 compression\n", MAX_JOBS);
 		printf("-l <0..3>  : listing file output level (0-3), default is 2\n");
 		printf("-m         : force macro expansion in listing\n");
 		printf("-o         : change output ROM/ISO name and extension\n");
 		printf("-O         : optimize .proc packing (compared to HuC v3.21)\n");
+		printf("--binpack  : search harder for a .proc packing that uses fewer banks\n");
+		printf("--cluster  : put .procs that call each other in the same bank (not with --newproc)\n");
+		printf("--cycles   : show the cycles for each instruction in the listing\n");
 		printf("-s         : show segment usage\n");
 		printf("-S         : show segment usage and contents\n");
 		printf("--hucc     : set all the options needed for HuCC code\n");
@@ -1315,6 +1378,8 @@ help(void)
 		printf("--newproc  : run .proc code in MPR6, instead of MPR5\n");
 		printf("--strip    : strip unused .proc & .procgroup\n");
 		printf("--srec     : create a Motorola S-record file\n");
+		printf("--stats    : show symbol table and cache statistics\n");
+		printf("--zx0-cache <dir> : reuse .outzx0 data compressed by earlier builds\n");
 		printf("--develo   : assemble and run on the Develo Box\n");
 		printf("--mx       : create a Develo MX file\n");
 		printf("infiles    : one or more files to be assembled\n");
@@ -1332,6 +1397,7 @@ help(void)
 		printf("--pad      : pad ROM size to power-of-two\n");
 		printf("--trim     : strip unused head and tail from ROM\n");
 		printf("--srec     : create a Motorola S-record file\n");
+		printf("--stats    : show symbol table and cache statistics\n");
 		printf("infiles    : one or more files to be assembled\n");
 		printf("\n");
 	}
@@ -1550,7 +1616,7 @@ data_reloc(void)
 	set_section(S_CODE);
 
 	/* remap symbols in the .XDATA, .XINIT and .XSTRZ sections */
-	for (i = 0; i < HASH_COUNT; i++) {
+	for (i = 0; i < hash_size; i++) {
 		sym = hash_tbl[i];
 
 		while (sym) {
@@ -62,6 +62,7 @@ struct t_machine nes = {
 	nes_pack_8x8_tile,	/* pack_8x8_tile */
 	NULL,			/* pack_16x16_tile */
 	NULL,			/* pack_16x16_sprite */
-	nes_write_header	/* write_header */
+	nes_write_header,	/* write_header */
+	NULL			/* cycles */
 };
 
@@ -0,0 +1,436 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "defs.h"
+#include "externs.h"
+#include "protos.h"
+#include "format.h"
+#include "shrink.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/* a block of data waiting to be written by .outbin or .outzx0 */
+typedef struct t_outjob {
+	FILE *fp;
+	unsigned char *data;
+	unsigned char *packed;
+	unsigned length;
+	unsigned window;
+	unsigned serial;
+	long lst_pos;
+	t_file *file;		/* the .outzx0 line, for any error */
+	int file_num;
+	int line;
+	char compress;
+	char close;
+	char cached;
+	char failed;
+	char unsaved;
+} t_outjob;
+
+static t_outjob outjob[OUTBIN_JOBS];
+static int outjob_count;
+static int outjob_next;
+static long outjob_bytes;
+static unsigned outjob_serial;
+
+#ifdef _WIN32
+static CRITICAL_SECTION outjob_lock;
+#else
+static pthread_mutex_t outjob_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/* change this whenever salvador is updated, or its output changes, */
+/* so that a new build never reads data that an older one compressed */
+#define ZX0_CACHE_TAG "zx0v2"
+
+static long zx0_hits;
+static long zx0_misses;
+
+
+/* ----
+ * zx0_cache_name()
+ * ----
+ * build the name of the .outzx0 cache file for a block of data,
+ * the name is the FNV-1a hash of the data, its length and window,
+ * with a tag for the version of the compressor
+ */
+
+static void
+zx0_cache_name(char *name, size_t size, const unsigned char *data, unsigned length, unsigned window)
+{
+	unsigned long long hash = 14695981039346656037ull;
+	unsigned i;
+
+	for (i = 0; i < length; i++) {
+		hash ^= data[i];
+		hash *= 1099511628211ull;
+	}
+
+	snprintf(name, size, "%s%s%016llx-%06x-%04x.%s", zx0_cache_dir,
+		PATH_SEPARATOR_STRING, hash, length, window, ZX0_CACHE_TAG);
+}
+
+
+/* ----
+ * zx0_cache_load()
+ * ----
+ * read previously compressed data from the .outzx0 cache, an entry
+ * starts with a copy of the uncompressed data, so that a hash collision
+ * or a directory shared with another project is only a cache miss,
+ * returns the compressed length, or 0 if it is not cached
+ */
+
+static unsigned
+zx0_cache_load(const char *name, const unsigned char *data, unsigned length, unsigned char *dst, unsigned need)
+{
+	unsigned char *copy;
+	FILE *fp;
+	size_t size = 0;
+
+	if ((fp = fopen(name, "rb")) == NULL)
+		return (0);
+
+	/* check that the entry is for exactly the same data */
+	if ((copy = malloc(length ? length : 1)) != NULL) {
+		if ((fread(copy, 1, length, fp) == length) && (memcmp(copy, data, length) == 0))
+			size = fread(dst, 1, need, fp);
+		free(copy);
+	}
+
+	/* reject a truncated or oversized cache file */
+	if (ferror(fp) || (!feof(fp) && fgetc(fp) != EOF))
+		size = 0;
+	fclose(fp);
+
+	/* ok */
+	return ((unsigned)size);
+}
+
+
+/* ----
+ * zx0_cache_save()
+ * ----
+ * store the uncompressed and the compressed data in the .outzx0 cache,
+ * this writes a temporary file first so that an interrupted build never
+ * leaves a bad entry, returns 0 if the cache file could not be written
+ */
+
+static int
+zx0_cache_save(const char *name, const unsigned char *data, unsigned length, const unsigned char *src, unsigned size, unsigned serial)
+{
+	char temp[PATHSZ + 64];
+	FILE *fp;
+	int ok;
+
+	snprintf(temp, sizeof(temp), "%s.%u.tmp", name, serial);
+
+	if ((fp = fopen(temp, "wb")) == NULL)
+		return (0);
+
+	ok = (fwrite(data, 1, length, fp) == length);
+	ok = ok && (fwrite(src, 1, size, fp) == size);
+	ok = (fclose(fp) == 0) && ok;
+
+	remove(name);
+	ok = ok && (rename(temp, name) == 0);
+	if (!ok)
+		remove(temp);
+
+	/* ok */
+	return (ok);
+}
+
+
+/* ----
+ * zx0_stats()
+ * ----
+ * show how many .outzx0 blocks were found in the cache
+ */
+
+void
+zx0_stats(FILE *fp)
+{
+	if (zx0_cache_dir[0] == '\0')
+		return;
+
+	fprintf(fp, "\nZX0 Cache:\n");
+	fprintf(fp, "  %ld hits, %ld misses\n", zx0_hits, zx0_misses);
+}
+
+
+/* ----
+ * outbin_compress()
+ * ----
+ * compress a single job, this can run on any of the worker threads,
+ * so it only touches the job itself and never reports errors directly
+ */
+
+static void
+outbin_compress(t_outjob *job)
+{
+	char cache_name[PATHSZ + 40];
+	unsigned need;
+	size_t size;
+
+	need = (unsigned)salvador_get_max_compressed_size(job->length);
+	if ((job->packed = calloc(need, 1)) == NULL) {
+		job->failed = 1;
+		return;
+	}
+
+	/* has this exact data been compressed before? */
+	if (zx0_cache_dir[0]) {
+		zx0_cache_name(cache_name, sizeof(cache_name), job->data, job->length, job->window);
+		size = zx0_cache_load(cache_name, job->data, job->length, job->packed, need);
+		if (size) {
+			job->cached = 1;
+			job->length = (unsigned)size;
+			return;
+		}
+	}
+
+	size = salvador_compress(job->data, job->packed, job->length, need, 0, job->window, 0, NULL, NULL);
+	if (size > need) {
+		job->failed = 1;
+		return;
+	}
+
+	if (zx0_cache_dir[0]) {
+		if (!zx0_cache_save(cache_name, job->data, job->length, job->packed, (unsigned)size, job->serial))
+			job->unsaved = 1;
+	}
+	job->length = (unsigned)size;
+}
+
+
+/* ----
+ * outbin_worker()
+ * ----
+ * take the next job that needs compressing until there are none left
+ */
+
+#ifdef _WIN32
+static DWORD WINAPI
+outbin_worker(LPVOID arg)
+#else
+static void *
+outbin_worker(void *arg)
+#endif
+{
+	int i;
+
+	for (;;) {
+#ifdef _WIN32
+		EnterCriticalSection(&outjob_lock);
+		i = outjob_next++;
+		LeaveCriticalSection(&outjob_lock);
+#else
+		pthread_mutex_lock(&outjob_lock);
+		i = outjob_next++;
+		pthread_mutex_unlock(&outjob_lock);
+#endif
+		if (i >= outjob_count)
+			break;
+		if (outjob[i].compress)
+			outbin_compress(&outjob[i]);
+	}
+
+	/* ok */
+	return (0);
+}
+
+
+/* ----
+ * outbin_flush()
+ * ----
+ * compress all of the queued jobs, using up to jobs_opt threads, and
+ * then write them to their output files in the order that they were
+ * queued, so that the result is the same whatever the thread count
+ */
+
+void
+outbin_flush(void)
+{
+	t_outjob *job;
+	int i, packs, threads;
+#ifdef _WIN32
+	static int initialized;
+	HANDLE thread[MAX_JOBS];
+#else
+	pthread_t thread[MAX_JOBS];
+#endif
+
+	if (outjob_count == 0)
+		return;
+
+	/* how many threads are worth starting? */
+	for (packs = 0, i = 0; i < outjob_count; i++)
+		packs += outjob[i].compress;
+
+	threads = (packs < jobs_opt) ? packs : jobs_opt;
+	outjob_next = 0;
+
+	/* the main thread is one of the workers */
+#ifdef _WIN32
+	if (!initialized) {
+		InitializeCriticalSection(&outjob_lock);
+		initialized = 1;
+	}
+	for (i = 1; i < threads; i++) {
+		if ((thread[i] = CreateThread(NULL, 0, outbin_worker, NULL, 0, NULL)) == NULL)
+			break;
+	}
+	threads = i;
+	outbin_worker(NULL);
+	for (i = 1; i < threads; i++) {
+		WaitForSingleObject(thread[i], INFINITE);
+		CloseHandle(thread[i]);
+	}
+#else
+	for (i = 1; i < threads; i++) {
+		if (pthread_create(&thread[i], NULL, outbin_worker, NULL) != 0)
+			break;
+	}
+	threads = i;
+	outbin_worker(NULL);
+	for (i = 1; i < threads; i++)
+		pthread_join(thread[i], NULL);
+#endif
+
+	/* write the results in order */
+	for (i = 0; i < outjob_count; i++) {
+		job = &outjob[i];
+
+		if (job->close) {
+			fclose(job->fp);
+			continue;
+		}
+
+		if (job->failed) {
+			error_at(job->file, job->file_num, job->line, "Error while compressing the data!");
+		} else {
+			if (job->compress) {
+				if (job->cached)
+					++zx0_hits;
+				else if (zx0_cache_dir[0])
+					++zx0_misses;
+				if (job->unsaved)
+					warning_at(job->file, job->file_num, job->line, "Unable to write to the .OUTZX0 cache directory!");
+			}
+
+			/* write the data */
+			if (fwrite(job->compress ? job->packed : job->data, 1, job->length, job->fp) != job->length) {
+				fatal_error("Unable to write data to the current output file!");
+			}
+
+			/* fill in the length that the listing did not know */
+			if (job->lst_pos >= 0) {
+				hexcon(4, job->length);
+				fseek(lst_fp, job->lst_pos + VALUE_FIELD, SEEK_SET);
+				fwrite(&hex[1], 1, 4, lst_fp);
+				fseek(lst_fp, 0, SEEK_END);
+			}
+		}
+
+		free(job->data);
+		free(job->packed);
+	}
+
+	outjob_count = 0;
+	outjob_bytes = 0;
+}
+
+
+/* ----
+ * outbin_queue()
+ * ----
+ * queue a copy of a block of rom for writing to an output file,
+ * returns the number of bytes written, or 0 if the block is still
+ * waiting to be compressed when "wait" is not set
+ */
+
+unsigned
+outbin_queue(FILE *fp, const unsigned char *data, unsigned length, unsigned window, int compress, int wait)
+{
+	t_outjob *job;
+
+	if (outjob_count == OUTBIN_JOBS)
+		outbin_flush();
+
+	job = &outjob[outjob_count++];
+	memset(job, 0, sizeof(t_outjob));
+	job->fp = fp;
+	job->length = length;
+	job->window = window;
+	job->compress = compress;
+	job->serial = outjob_serial++;
+	job->lst_pos = -1;
+	job->file = input_file[infile_num].file;
+	job->file_num = infile_num;
+	job->line = slnum;
+
+	if ((job->data = malloc(length)) == NULL) {
+		fatal_error("Not enough memory for the .OUTBIN data!");
+		--outjob_count;
+		return (0);
+	}
+	memcpy(job->data, data, length);
+	outjob_bytes += length;
+
+	/* is the result needed now? */
+	if (wait || jobs_opt <= 1 || outjob_bytes >= OUTBIN_BYTES) {
+		outbin_flush();
+		return (job->length);
+	}
+
+	/* ok */
+	return (0);
+}
+
+
+/* ----
+ * outbin_listed()
+ * ----
+ * remember where the listing of the last queued job is, so that its
+ * compressed length can be filled in when it is known
+ */
+
+void
+outbin_listed(long lst_pos)
+{
+	if (outjob_count)
+		outjob[outjob_count - 1].lst_pos = lst_pos;
+}
+
+
+/* ----
+ * outbin_close()
+ * ----
+ * close an output file once everything queued for it has been written
+ */
+
+void
+outbin_close(FILE *fp)
+{
+	t_outjob *job;
+
+	if (outjob_count == 0) {
+		fclose(fp);
+		return;
+	}
+
+	if (outjob_count == OUTBIN_JOBS)
+		outbin_flush();
+
+	job = &outjob[outjob_count++];
+	memset(job, 0, sizeof(t_outjob));
+	job->fp = fp;
+	job->close = 1;
+	job->lst_pos = -1;
+}
@@ -17,6 +17,7 @@ void
 println(void)
 {
 	int nb, cnt;
+	int least, most;
 	int i;
 
 	/* check if output possible */
@@ -36,6 +37,23 @@ println(void)
 	if (continued_line)
 		strcpy(prlnbuf, tmplnbuf);
 
+	/* show how many cycles the instruction takes */
+	if (cycles_opt && in_opcode && (machine->cycles != NULL) &&
+	    (data_loccnt != -1) && (loccnt > data_loccnt) && (bank <= bank_limit)) {
+		least = machine->cycles(&rom[bank][data_loccnt], &most);
+
+		/* find the column, with tabs every 8 characters */
+		for (nb = 0, i = 0; prlnbuf[i]; i++)
+			nb = (prlnbuf[i] == '\t') ? ((nb + 8) & ~7) : (nb + 1);
+		do {
+			prlnbuf[i++] = ' ';
+		} while (++nb < CYCLE_FIELD);
+		if (least == most)
+			sprintf(&prlnbuf[i], "; %d", least);
+		else
+			sprintf(&prlnbuf[i], "; %d/%d", least, most);
+	}
+
 	/* output */
 	if (data_loccnt == -1) {
 		/* line buffer */
@@ -95,6 +113,31 @@ println(void)
 }
 
 
+/* ----
+ * code_cycles()
+ * ----
+ * add the instruction that was just assembled at "start" to the
+ * totals for the current procedure, these are shown by list_procs()
+ */
+
+void
+code_cycles(int start)
+{
+	int least, most;
+
+	if (!cycles_opt || (machine->cycles == NULL) || (pass != LAST_PASS))
+		return;
+	if ((proc_ptr == NULL) || (loccnt <= start) || (bank > bank_limit))
+		return;
+
+	least = machine->cycles(&rom[bank][start], &most);
+
+	proc_ptr->instructions += 1;
+	proc_ptr->cycles += least;
+	proc_ptr->cycles_most += most;
+}
+
+
 /* ----
  * clearln()
  * ----
@@ -124,7 +167,7 @@ loadlc(int offset, int pos)
 	int i;
 
 	if (pos)
-		i = 20;
+		i = VALUE_FIELD;
 	else
 		i = 7;
 
@@ -184,6 +227,57 @@ hexcon(int digit, int num)
 }
 
 
+/* ----
+ * rom_use()
+ * ----
+ * prepare the banks that hold a range of rom for use
+ *
+ * the rom and map arrays live in .bss, so the OS only commits the
+ * pages that are touched; this fills each bank with $FF the first
+ * time that it is used, instead of filling the whole 8MB at startup
+ */
+
+static unsigned char bank_ready[MAX_BANKS];
+static int banks_used;
+
+void
+rom_use(int which_bank, int offset, int size)
+{
+	int last_bank;
+
+	if (which_bank < 0 || which_bank >= MAX_BANKS)
+		return;
+
+	last_bank = which_bank + ((offset + (size > 0 ? size - 1 : 0)) >> 13);
+	if (last_bank >= MAX_BANKS)
+		last_bank = MAX_BANKS - 1;
+
+	for (; which_bank <= last_bank; which_bank++) {
+		if (bank_ready[which_bank] == 0) {
+			bank_ready[which_bank] = 1;
+			memset(rom[which_bank], 0xFF, 8192);
+			memset(map[which_bank], 0xFF, 8192);
+			banks_used++;
+		}
+	}
+}
+
+
+/* ----
+ * rom_stats()
+ * ----
+ * show how much rom storage was used
+ */
+
+void
+rom_stats(FILE *fp)
+{
+	fprintf(fp, "\nROM Storage:\n");
+	fprintf(fp, "  %d of %d banks used, %d KB\n",
+		banks_used, MAX_BANKS, (banks_used * (8192 + 8192)) >> 10);
+}
+
+
 /* ----
  * putbyte()
  * ----
@@ -215,6 +309,8 @@ putbyte(int offset, int data, int is_code)
 		max_bank = ((addr - 1) >> 13);
 	}
 
+	rom_use(bank, offset, 1);
+
 	rom[bank][offset] = 0xFF & (data);
 
 	if (section == S_DATA && asm_opt[OPT_DATAPAGE] != 0)
@@ -261,6 +357,8 @@ putword(int offset, int data, int is_code)
 		max_bank = ((addr - 1) >> 13);
 	}
 
+	rom_use(bank, offset, 2);
+
 	rom[bank][offset + 0] = 0xFF & (data);
 	rom[bank][offset + 1] = 0xFF & (data >> 8);
 
@@ -311,6 +409,8 @@ putdword(int offset, int data)
 		max_bank = ((addr - 1) >> 13);
 	}
 
+	rom_use(bank, offset, 4);
+
 	rom[bank][offset + 0] = 0xFF & (data);
 	rom[bank][offset + 1] = 0xFF & (data >> 8);
 	rom[bank][offset + 2] = 0xFF & (data >> 16);
@@ -368,6 +468,8 @@ putbuffer(void *data, int size)
 			uint32_t info, *fill_a;
 			uint8_t *fill_b;
 
+			rom_use(bank, loccnt, size);
+
 			if (data)
 				memcpy(&rom[bank][loccnt], data, size);
 			else
@@ -569,6 +671,26 @@ vmessage(const char *msgtype, const char *format, va_list args)
 }
 
 
+/* ----
+ * vmessage_at()
+ * ----
+ * display a message for a line that was assembled earlier, such as an
+ * .outzx0 whose compression only finished after the lines that follow
+ */
+
+static void
+vmessage_at(t_file *file, int file_num, int line, const char *msgtype, const char *format, va_list args)
+{
+	/* the next message must show its own file name again */
+	infile_error = -1;
+	fprintf(ERROUT, "#[%i]   \"%s\"\n", file_num, file->name);
+
+	fprintf(ERROUT, "%5i\n       %s", line, msgtype);
+	vfprintf(ERROUT, format, args);
+	fprintf(ERROUT, "\n");
+}
+
+
 /* ----
  * fatal_error()
  * ----
@@ -621,3 +743,38 @@ warning(const char *format, ...)
 	vmessage("Warning: ", format, args);
 	va_end(args);
 }
+
+
+/* ----
+ * error_at()
+ * ----
+ * error printing routine for an earlier line
+ */
+
+void
+error_at(t_file *file, int file_num, int line, const char *format, ...)
+{
+	va_list args;
+
+	va_start(args, format);
+	vmessage_at(file, file_num, line, "Error: ", format, args);
+	va_end(args);
+	errcnt++;
+}
+
+
+/* ----
+ * warning_at()
+ * ----
+ * warning printing routine for an earlier line
+ */
+
+void
+warning_at(t_file *file, int file_num, int line, const char *format, ...)
+{
+	va_list args;
+
+	va_start(args, format);
+	vmessage_at(file, file_num, line, "Warning: ", format, args);
+	va_end(args);
+}
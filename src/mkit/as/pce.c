@@ -43,6 +43,49 @@ pce_write_header(FILE *f, int banks)
 }
 
 
+/* ----
+ * pce_cycles()
+ * ----
+ * return the cycles that an instruction takes if it doesn't branch,
+ * and set "most" to the cycles that it takes if it does branch
+ */
+
+int
+pce_cycles(const unsigned char *code, int *most)
+{
+	int cycles = huc6280_cycles[code[0]];
+	int length;
+
+	*most = cycles;
+
+	switch (code[0]) {
+	/* bpl, bmi, bvc, bvs, bcc, bcs, bne, beq */
+	case 0x10: case 0x30: case 0x50: case 0x70:
+	case 0x90: case 0xB0: case 0xD0: case 0xF0:
+		*most = cycles + 2;
+		break;
+
+	/* tii, tdd, tin, tia, tai take 6 cycles for each byte */
+	case 0x73: case 0xC3: case 0xD3: case 0xE3: case 0xF3:
+		length = code[5] + (code[6] << 8);
+		if (length == 0)
+			length = 0x10000;
+		cycles += 6 * length;
+		*most = cycles;
+		break;
+
+	default:
+		/* bbr and bbs */
+		if ((code[0] & 0x0F) == 0x0F)
+			*most = cycles + 2;
+		break;
+	}
+
+	/* ok */
+	return (cycles);
+}
+
+
 /* ----
  * scan_8x8_tile()
  * ----
@@ -995,6 +1038,7 @@ pce_incspr(int *ip)
 
 			/* putbuffer only copies on the LAST_PASS and we really need it */
 			if (pass != LAST_PASS && !stop_pass) {
+				rom_use(bank, loccnt, 128);
 				memcpy(tile[nb_sprite].data, spr_data, 128);
 			}
 
@@ -1135,6 +1179,7 @@ pce_incmask(int *ip)
 
 			/* putbuffer only copies on the LAST_PASS and we really need it */
 			if (pass != LAST_PASS && !stop_pass) {
+				rom_use(bank, loccnt, 32);
 				memcpy(tile[nb_mask].data, spr_data, 32);
 			}
 
@@ -1330,6 +1375,8 @@ pce_incblk(int *ip)
 					uint8_t *fill_b;
 					int offset;
 
+					rom_use(bank, oldloc, loccnt - oldloc);
+
 					memset(&rom[bank][oldloc], 0, loccnt - oldloc);
 					memset(&map[bank][oldloc], section + (page << 5), loccnt - oldloc);
 
@@ -1404,6 +1451,7 @@ pce_incblk(int *ip)
 		if (blk_lablptr) {
 			/* expand an existing set of blocks */
 			nb_blks = blk_lablptr->data_count;
+			rom_use(blk_lablptr->rombank, blk_lablptr->value & 0x1FFF, 2048);
 			packed = &rom[blk_lablptr->rombank][blk_lablptr->value & 0x1FFF];
 		} else {
 			/* create a new set of blocks */
@@ -1880,7 +1928,10 @@ pce_incmap(int *ip)
 
 		if (blk_lablptr != expr_lablptr) {
 			/* regenerate the meta-tile hash table from the data in rom */
-			unsigned char *packed = &rom[expr_lablptr->rombank][expr_lablptr->value & 0x1FFF];
+			unsigned char *packed;
+
+			rom_use(expr_lablptr->rombank, expr_lablptr->value & 0x1FFF, 2048);
+			packed = &rom[expr_lablptr->rombank][expr_lablptr->value & 0x1FFF];
 
 			if (expr_lablptr->data_count == -1) {
 				error("Incorrect meta-tile label reference!");
@@ -2102,7 +2153,9 @@ pce_flagmap(int *ip)
 		/* links to identical BLK with different collision flags */
 		unsigned char *nextblk = blklabl->tags->metadata + 256;
 
+		rom_use(blklabl->rombank, blklabl->value & 0x1FFF, blklabl->size);
 		unsigned char *blkdata = &rom[blklabl->rombank][blklabl->value & 0x1FFF];
+		rom_use(maplabl->rombank, maplabl->value & 0x1FFF, maplabl->size);
 		unsigned char *mapdata = &rom[maplabl->rombank][maplabl->value & 0x1FFF];
 
 		unsigned char mask = (chrlabl->data_count > 1024) ? 0x08 : 0x0C;
@@ -2312,6 +2365,7 @@ pce_maskmap(int *ip)
 
 	/* are we expanding a table of flags that was just created? */
 	if (lablptr == NULL && lastlabl != NULL && lastlabl->data_type == P_MASKMAP) {
+		rom_use(lastlabl->rombank, lastlabl->value & 0x1FFF, 256);
 		masktable = &rom[lastlabl->rombank][lastlabl->value & 0x1FFF];
 	} else {
 		masktable = workspace;
@@ -2337,6 +2391,7 @@ pce_maskmap(int *ip)
 		if (!pcx_set_tile(msklabl, msklabl->value))
 			return;
 
+		rom_use(maplabl->rombank, maplabl->value & 0x1FFF, maplabl->size);
 		unsigned char *mapdata = &rom[maplabl->rombank][maplabl->value & 0x1FFF];
 
 		for (i = 0; i < h; i++) {
@@ -2507,6 +2562,7 @@ pce_overmap(int *ip)
 
 	/* are we expanding a table of overlays that was just created? */
 	if (lablptr == NULL && lastlabl != NULL && lastlabl->data_type == P_OVERMAP) {
+		rom_use(lastlabl->rombank, lastlabl->value & 0x1FFF, 256);
 		flagtable = &rom[lastlabl->rombank][lastlabl->value & 0x1FFF];
 	} else {
 		flagtable = workspace;
@@ -2532,6 +2588,7 @@ pce_overmap(int *ip)
 		if (!pcx_set_tile(sprlabl, sprlabl->value))
 			return;
 
+		rom_use(maplabl->rombank, maplabl->value & 0x1FFF, maplabl->size);
 		unsigned char *mapdata = &rom[maplabl->rombank][maplabl->value & 0x1FFF];
 
 		for (i = 0; i < h; i++) {
@@ -2670,6 +2727,7 @@ pce_swizzle(int *ip)
 			return;
 		}
 
+		rom_use(maplabl->rombank, maplabl->value & 0x1FFF, maplabl->size);
 		unsigned char *mapdata = &rom[maplabl->rombank][maplabl->value & 0x1FFF];
 		unsigned char *newdata = malloc(maplabl->data_size);
 		unsigned char *newline = newdata;
@@ -27,6 +27,7 @@ void pce_incchrpal(int *ip);
 void pce_incsprpal(int *ip);
 void pce_inctilepal(int *ip);
 void pce_outpng(int *ip);
+int  pce_cycles(const unsigned char *code, int *most);
 
 /* MML.C */
 int mml_start(unsigned char *buffer);
@@ -123,6 +124,27 @@ struct t_opcode pce_pseudo[43] = {
 	{NULL, ".SWIZZLE",   pce_swizzle,   PSEUDO, P_SWIZZLE,   0},
 	{NULL, NULL, NULL, 0, 0, 0}
 };
+
+/* HuC6280 cycles for each opcode, from tgemu's tblh6280.c, with */
+/* branches not taken and block transfers without their length */
+const unsigned char huc6280_cycles[256] = {
+	 8,  7,  3,  4,  6,  4,  6,  7,  3,  2,  2,  2,  7,  5,  7,  6,	/* 00 */
+	 2,  7,  7,  4,  6,  4,  6,  7,  2,  5,  2,  2,  7,  5,  7,  6,	/* 10 */
+	 7,  7,  3,  4,  4,  4,  6,  7,  4,  2,  2,  2,  5,  5,  7,  6,	/* 20 */
+	 2,  7,  7,  2,  4,  4,  6,  7,  2,  5,  2,  2,  5,  5,  7,  6,	/* 30 */
+	 7,  7,  3,  4,  8,  4,  6,  7,  3,  2,  2,  2,  4,  5,  7,  6,	/* 40 */
+	 2,  7,  7,  5,  2,  4,  6,  7,  2,  5,  3,  2,  2,  5,  7,  6,	/* 50 */
+	 7,  7,  2,  2,  4,  4,  6,  7,  4,  2,  2,  2,  7,  5,  7,  6,	/* 60 */
+	 2,  7,  7, 17,  4,  4,  6,  7,  2,  5,  4,  2,  7,  5,  7,  6,	/* 70 */
+	 4,  7,  2,  7,  4,  4,  4,  7,  2,  2,  2,  2,  5,  5,  5,  6,	/* 80 */
+	 2,  7,  7,  8,  4,  4,  4,  7,  2,  5,  2,  2,  5,  5,  5,  6,	/* 90 */
+	 2,  7,  2,  7,  4,  4,  4,  7,  2,  2,  2,  2,  5,  5,  5,  6,	/* A0 */
+	 2,  7,  7,  8,  4,  4,  4,  7,  2,  5,  2,  2,  5,  5,  5,  6,	/* B0 */
+	 2,  7,  2, 17,  4,  4,  6,  7,  2,  2,  2,  2,  5,  5,  7,  6,	/* C0 */
+	 2,  7,  7, 17,  2,  4,  6,  7,  2,  5,  3,  2,  2,  5,  7,  6,	/* D0 */
+	 2,  7,  2, 17,  4,  4,  6,  7,  2,  2,  2,  2,  5,  5,  7,  6,	/* E0 */
+	 2,  7,  7, 17,  2,  4,  6,  7,  2,  5,  4,  2,  2,  5,  7,  6,	/* F0 */
+};
 /* *INDENT-ON* */
 
 const char defdirs_pce[] =
@@ -160,6 +182,7 @@ struct t_machine pce = {
 	pce_pack_8x8_tile,	/* pack_8x8_tile */
 	pce_pack_16x16_tile,	/* pack_16x16_tile */
 	pce_pack_16x16_sprite,	/* pack_16x16_sprite */
-	pce_write_header	/* write_header */
+	pce_write_header,	/* write_header */
+	pce_cycles		/* cycles */
 };
 
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <sys/stat.h>
 #include "defs.h"
 #include "externs.h"
 #include "protos.h"
@@ -36,6 +37,26 @@ struct PCX_HEADER {			/* pcx file header */
 	unsigned char pad[54];
 } pcx;
 
+/* decoded image cache */
+typedef struct t_image {
+	struct t_image *next;
+	char *name;				/* name used in the directive */
+	char *path;				/* full path that it was found at */
+	time_t mtime;				/* file modification time */
+	off_t fsize;				/* file size */
+	int w, h;				/* picture dimensions */
+	int nb_colors;				/* number of colors (16/256) */
+	unsigned char *buf;			/* decoded pixels */
+	unsigned char pal[256][3];		/* palette */
+} t_image;
+
+static t_image *image_list;		/* most-recently-used first */
+static long image_bytes;		/* memory used by the cache */
+static long image_hits;
+static long image_misses;
+static long image_evicts;
+static int image_owned;			/* pcx_buf isn't in the cache */
+
 /* externs */
 extern struct t_symbol *expr_lablptr;	/* pointer to the lastest label */
 extern int expr_lablcnt;		/* number of label seen in an expression */
@@ -164,6 +185,7 @@ pcx_set_tile(struct t_symbol *ref, unsigned int offset)
 		if (nb > (sizeof(tile) / sizeof(struct t_tile)))
 			nb = (sizeof(tile) / sizeof(struct t_tile));
 
+		rom_use(ref->rombank, ref->value & 0x1FFF, ref->data_count * size);
 		data = &rom[ref->rombank][ref->value & 0x1FFF] + start;
 
 		/* reset tile hash table */
@@ -374,6 +396,157 @@ pcx_parse_args(int i, int nb, int *a, int *b, int *c, int *d, int size)
 }
 
 
+/* ----
+ * image_release()
+ * ----
+ * forget the current picture, and free it if the cache doesn't have it
+ */
+
+static void
+image_release(void)
+{
+	if (image_owned)
+		free(pcx_buf);
+	image_owned = 0;
+	pcx_buf = NULL;
+	pcx_name[0] = '\0';
+}
+
+
+/* ----
+ * image_find()
+ * ----
+ * look for a decoded picture in the image cache, and make it the
+ * current picture if the file has not changed since it was decoded
+ */
+
+int
+image_find(const char *name)
+{
+	struct stat info;
+	t_image *image;
+	t_image *prev;
+
+	prev = NULL;
+	for (image = image_list; image != NULL; prev = image, image = image->next) {
+		if (strcmp(image->name, name) == 0)
+			break;
+	}
+
+	if ((image == NULL) || (stat(image->path, &info) != 0) ||
+	    (info.st_mtime != image->mtime) || (info.st_size != image->fsize)) {
+		image_misses++;
+		return (0);
+	}
+
+	/* move it to the front of the list */
+	if (prev) {
+		prev->next = image->next;
+		image->next = image_list;
+		image_list = image;
+	}
+
+	/* make it the current picture */
+	image_release();
+	pcx_buf = image->buf;
+	pcx_w = image->w;
+	pcx_h = image->h;
+	pcx_nb_colors = image->nb_colors;
+	memcpy(pcx_pal, image->pal, sizeof(pcx_pal));
+	strcpy(pcx_name, name);
+
+	image_hits++;
+	return (1);
+}
+
+
+/* ----
+ * image_add()
+ * ----
+ * put the picture that has just been decoded into the image cache,
+ * the cache takes ownership of pcx_buf
+ */
+
+void
+image_add(const char *name)
+{
+	struct stat info;
+	t_image *image;
+	t_image *prev;
+	t_image **link;
+
+	/* remove any old copy of a file that has changed */
+	for (link = &image_list; (image = *link) != NULL; link = &image->next) {
+		if (strcmp(image->name, name) == 0) {
+			*link = image->next;
+			image_bytes -= (long)image->w * image->h;
+			free(image->buf);
+			free(image->name);
+			free(image->path);
+			free(image);
+			break;
+		}
+	}
+
+	if (stat(full_path, &info) != 0)
+		return;
+
+	if ((image = malloc(sizeof(t_image))) == NULL)
+		return;
+
+	image->name = strdup(name);
+	image->path = strdup(full_path);
+	if ((image->name == NULL) || (image->path == NULL)) {
+		free(image->name);
+		free(image->path);
+		free(image);
+		return;
+	}
+	image->mtime = info.st_mtime;
+	image->fsize = info.st_size;
+	image->w = pcx_w;
+	image->h = pcx_h;
+	image->nb_colors = pcx_nb_colors;
+	image->buf = pcx_buf;
+	memcpy(image->pal, pcx_pal, sizeof(pcx_pal));
+	image_owned = 0;
+
+	image->next = image_list;
+	image_list = image;
+	image_bytes += (long)pcx_w * pcx_h;
+
+	/* evict the least-recently-used pictures, but never the current one */
+	while ((image_bytes > IMAGE_CACHE_SIZE) && (image_list->next != NULL)) {
+		prev = image_list;
+		while (prev->next->next != NULL)
+			prev = prev->next;
+		image = prev->next;
+		prev->next = NULL;
+		image_bytes -= (long)image->w * image->h;
+		free(image->buf);
+		free(image->name);
+		free(image->path);
+		free(image);
+		image_evicts++;
+	}
+}
+
+
+/* ----
+ * image_stats()
+ * ----
+ * show how many pictures were decoded, and how many reused
+ */
+
+void
+image_stats(FILE *fp)
+{
+	fprintf(fp, "\nImage Cache:\n");
+	fprintf(fp, "  %ld hits, %ld misses, %ld evictions, %ld KB in use\n",
+		image_hits, image_misses, image_evicts, (image_bytes + 1023) >> 10);
+}
+
+
 /* ----
  * pcx_load()
  * ----
@@ -385,26 +558,30 @@ pcx_load(char *name)
 {
 	FILE *f;
 	size_t l;
+	int ok;
 
-	/* check if the file is the same as the previously loaded one;
+	/* check if the file has already been decoded;
 	 * if this is the case do not reload it
 	 */
-	if ((name[0] != '\0') && (strcasecmp(pcx_name, name) == 0))
+	if (image_find(name))
 		return (1);
 
 	/* do we want to load a png file instead of a pcx file? */
-	if (((l = strlen(name)) > 4) && (strcasecmp(".png", (name + l - 4)) == 0))
-		return (png_load(name));
+	if (((l = strlen(name)) > 4) && (strcasecmp(".png", (name + l - 4)) == 0)) {
+		if ((ok = png_load(name)) != 0)
+			image_add(name);
+		return (ok);
+	}
 
 	/* do we want to load a bmp file instead of a pcx file? */
-	if (((l = strlen(name)) > 4) && (strcasecmp(".bmp", (name + l - 4)) == 0))
-		return (bmp_load(name));
+	if (((l = strlen(name)) > 4) && (strcasecmp(".bmp", (name + l - 4)) == 0)) {
+		if ((ok = bmp_load(name)) != 0)
+			image_add(name);
+		return (ok);
+	}
 
 	/* no it's a new file - ok let's prepare loading */
-	if (pcx_buf)
-		free(pcx_buf);
-	pcx_buf = NULL;
-	pcx_name[0] = '\0';
+	image_release();
 
 	/* open the file */
 	if ((f = open_file(name, "rb")) == NULL) {
@@ -433,6 +610,7 @@ pcx_load(char *name)
 
 	/* malloc a buffer */
 	pcx_buf = malloc((size_t)pcx_w * pcx_h);
+	image_owned = 1;
 	if (pcx_buf == NULL) {
 		error("Cannot load file, not enough memory!");
 		return (0);
@@ -450,6 +628,7 @@ pcx_load(char *name)
 
 	fclose(f);
 	strcpy(pcx_name, name);
+	image_add(name);
 	return (1);
 }
 
@@ -649,10 +828,7 @@ bmp_load(char *name)
 	unsigned int i;
 	FILE *      pFile      = NULL;
 	/* no it's a new file - ok let's prepare loading */
-	if (pcx_buf)
-		free(pcx_buf);
-	pcx_buf = NULL;
-	pcx_name[0] = '\0';
+	image_release();
 
 	/* open the file */
 	if ((pFile = open_file(name, "rb")) == NULL) {
@@ -678,6 +854,7 @@ bmp_load(char *name)
 
 	/* malloc a buffer */
 	pcx_buf = malloc((size_t)pcx_w * pcx_h);
+	image_owned = 1;
 	if (pcx_buf == NULL) {
 		error("Cannot load file, not enough memory!");
 		goto errorCleanup;
@@ -774,19 +951,8 @@ png_load(char *name)
 	int         iColorType;
 	unsigned    i;
 
-	#if 0
-	/* check if the file is the same as the previously loaded one;
-	 * if this is the case do not reload it
-	 */
-	if ((name[0] != '\0') && (strcasecmp(pcx_name, name) == 0))
-		return (1);
-	#endif
-
 	/* no it's a new file - ok let's prepare loading */
-	if (pcx_buf)
-		free(pcx_buf);
-	pcx_buf = NULL;
-	pcx_name[0] = '\0';
+	image_release();
 
 	/* open the file */
 	if ((pFile = open_file(name, "rb")) == NULL) {
@@ -844,6 +1010,7 @@ png_load(char *name)
 
 	/* malloc a buffer */
 	pcx_buf = malloc((size_t)pcx_w * pcx_h);
+	image_owned = 1;
 	if (pcx_buf == NULL) {
 		error("Cannot load file, not enough memory!");
 		goto errorCleanup;
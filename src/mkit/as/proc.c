@@ -39,6 +39,8 @@ struct t_proc *proc_look(void);
 int            proc_install(void);
 void           poke(int addr, int data);
 void           proc_sortlist(void);
+int *          proc_binpack(int *bank_free, int last_bank, int max_new, int sf2);
+void           proc_addcall(struct t_proc *from, struct t_symbol *to);
 
 
 /* ----
@@ -145,6 +147,12 @@ do_call(int *ip)
 	if (optype == 0 && expr_lablptr != NULL)
 		expr_lablptr->flags |= FLG_FUNC;
 
+	/* remember which procedures call each other (--cluster is */
+	/* turned off with newproc, where a call always needs a thunk) */
+	if (cluster_opt && pass != LAST_PASS && proc_ptr && (expr_lablcnt == 1) &&
+	    (complex_expr == 0) && (expr_lablptr != NULL))
+		proc_addcall(proc_ptr, expr_lablptr);
+
 	/* generate code */
 	if (pass == LAST_PASS) {
 		/* lookup proc table */
@@ -611,7 +619,9 @@ proc_reloc(void)
 	int num_relocated = 0;
 	int i;
 	int *bank_free = NULL;
+	int *plan = NULL;
 	int new_bank = 0;
+	int unit = 0;
 
 	if (proc_nb == 0)
 		return;
@@ -635,6 +645,14 @@ proc_reloc(void)
 		new_bank = max_bank + 1;
 	}
 
+	/* search for a better packing than best-fit */
+	if (binpack_opt || cluster_opt) {
+		int sf2 = (section_flags[S_DATA] & S_IS_SF2) != 0;
+		int top = (bank_limit < 127) ? bank_limit : 127;
+
+		plan = proc_binpack(bank_free, sf2 ? 63 : max_bank, (top > max_bank) ? top - max_bank : 0, sf2);
+	}
+
 	/* alloc memory */
 	proc_ptr = proc_first;
 
@@ -651,6 +669,13 @@ proc_reloc(void)
 				int check_last = 0;
 				int smallest = 0x2000;
 
+				/* use the bank that proc_binpack() chose */
+				if (plan) {
+					reloc_bank = plan[unit++];
+					if (reloc_bank > max_bank && (section_flags[S_DATA] & S_IS_SF2) == 0)
+						max_bank = reloc_bank;
+				}
+
 				while (reloc_bank == -1)
 				{
 					check_bank = (asm_opt[OPT_OPTIMIZE]) ? 0 : max_bank;
@@ -741,9 +766,10 @@ proc_reloc(void)
 
 	free(bank_free);
 	bank_free = NULL;
+	free(plan);
 
 	/* remap proc symbols */
-	for (i = 0; i < HASH_COUNT; i++) {
+	for (i = 0; i < hash_size; i++) {
 		sym = hash_tbl[i];
 
 		while (sym) {
@@ -850,7 +876,7 @@ proc_look(void)
 	int hash;
 
 	/* search the procedure in the hash table */
-	hash = symhash();
+	hash = symhash() & (HASH_COUNT - 1);
 	ptr = proc_tbl[hash];
 	while (ptr) {
 		if (!strcmp(symbol, ptr->label->name))
@@ -883,7 +909,7 @@ proc_install(void)
 	}
 
 	/* initialize it */
-	hash = symhash();
+	hash = symhash() & (HASH_COUNT - 1);
 	ptr->bank = (optype == P_PGROUP)  ? GROUP_BANK : PROC_BANK;
 	ptr->base = proc_ptr ? loccnt : 0;
 	ptr->org = ptr->base;
@@ -892,6 +918,9 @@ proc_install(void)
 	ptr->kickc = kickc_mode;
 	ptr->defined = 0;
 	ptr->is_skippable = 0;
+	ptr->instructions = 0;
+	ptr->cycles = 0;
+	ptr->cycles_most = 0;
 	ptr->link = NULL;
 	ptr->next = proc_tbl[hash];
 	ptr->group = proc_ptr;
@@ -926,6 +955,7 @@ poke(int addr, int data)
 {
 	/* do not overwrite existing data! check_thunks() will report */
 	/* this error later on and show a segment dump to provide help */
+	rom_use(call_bank, addr & 0x1FFF, 1);
 	if ((map[call_bank][(addr & 0x1FFF)] & 0x0F) == 0x0F) {
 		rom[call_bank][(addr & 0x1FFF)] = data;
 		map[call_bank][(addr & 0x1FFF)] = S_PROC + ((addr & 0xE000) >> 8);
@@ -936,55 +966,605 @@ poke(int addr, int data)
 /* ----
  * proc_sortlist()
  * ----
- *
+ * sort the procedures by size (largest first), procedures of the
+ * same size are kept in the order that they were defined
  */
 
+struct t_sortproc {
+	struct t_proc *proc;
+	int order;
+};
+
+static int
+proc_compare(const void *a, const void *b)
+{
+	const struct t_sortproc *pa = a;
+	const struct t_sortproc *pb = b;
+
+	if (pa->proc->size != pb->proc->size)
+		return (pb->proc->size - pa->proc->size);
+
+	return (pa->order - pb->order);
+}
+
 void
 proc_sortlist(void)
 {
-	struct t_proc *unsorted_list = proc_first;
-	struct t_proc *sorted_list = NULL;
-
-	while(unsorted_list)
-	{
-		proc_ptr = unsorted_list;
-		unsorted_list = unsorted_list->link;
-		proc_ptr->link = NULL;
-
-		/* link it */
-		if (sorted_list == NULL)
-		{
-			sorted_list = proc_ptr;
+	struct t_sortproc *list;
+	int i, n;
+
+	for (n = 0, proc_ptr = proc_first; proc_ptr; proc_ptr = proc_ptr->link)
+		++n;
+
+	if (n < 2)
+		return;
+
+	if ((list = malloc(sizeof(struct t_sortproc) * n)) == NULL) {
+		fatal_error("Not enough RAM to sort procedures!");
+		return;
+	}
+
+	for (i = 0, proc_ptr = proc_first; proc_ptr; proc_ptr = proc_ptr->link, i++) {
+		list[i].proc = proc_ptr;
+		list[i].order = i;
+	}
+
+	qsort(list, n, sizeof(struct t_sortproc), proc_compare);
+
+	for (i = 1; i < n; i++)
+		list[i - 1].proc->link = list[i].proc;
+	list[n - 1].proc->link = NULL;
+
+	proc_first = list[0].proc;
+	proc_last = list[n - 1].proc;
+	free(list);
+}
+
+
+/* ----
+ * proc_addcall()
+ * ----
+ * remember a call from one procedure to another, so that --cluster
+ * can try to put them in the same bank and avoid the thunk
+ */
+
+typedef struct t_call {
+	struct t_call *next;
+	struct t_proc *from;
+	struct t_symbol *to;
+	int count;
+	int pass;
+} t_call;
+
+static t_call *call_tbl[HASH_COUNT];
+
+void
+proc_addcall(struct t_proc *from, struct t_symbol *to)
+{
+	t_call *call;
+	int hash;
+
+	hash = (int)((((uintptr_t)from >> 4) ^ ((uintptr_t)to >> 4)) & (HASH_COUNT - 1));
+
+	for (call = call_tbl[hash]; call; call = call->next) {
+		if (call->from == from && call->to == to)
+			break;
+	}
+
+	if (call == NULL) {
+		if ((call = malloc(sizeof(t_call))) == NULL) {
+			fatal_error("Out of memory!");
+			return;
 		}
-		else
-		{
-			int inserted = 0;
-			struct t_proc *list = sorted_list;
-			struct t_proc *previous = NULL;
-			while(!inserted && list)
-			{
-				if (list->size < proc_ptr->size)
-				{
-					if (!previous)
-						sorted_list = proc_ptr;
-					else
-						previous->link = proc_ptr;
-					proc_ptr->link = list;
-					inserted = 1;
-				}
-				else
-				{
-					previous = list;
-					list = list->link;
-				}
+		call->from = from;
+		call->to = to;
+		call->pass = 0;
+		call->next = call_tbl[hash];
+		call_tbl[hash] = call;
+	}
+
+	/* only count the calls from the current pass */
+	if (call->pass != pass_count) {
+		call->pass = pass_count;
+		call->count = 0;
+	}
+	call->count++;
+}
+
+
+/* ----
+ * proc_binpack()
+ * ----
+ * search for a placement of the relocatable procedures that either
+ * needs fewer new banks than the simple best-fit in proc_reloc(), or
+ * that puts procedures that call each other into the same bank
+ *
+ * with --cluster, the procedures that call each other most often are
+ * merged into clusters that must share a bank, as long as that still
+ * fits into as many new banks as best-fit would use
+ *
+ * with --binpack, this then runs a depth-first branch-and-bound over
+ * the clusters, the first placement that it tries for each one is the
+ * best-fit, and it then backtracks to try the other banks, skipping
+ * any that have the same free space as one that was already tried,
+ * and giving up when the free space left cannot hold what is left
+ *
+ * returns an array with a bank for each relocatable procedure, in
+ * list order, or NULL if best-fit cannot be improved upon
+ */
+
+static struct t_proc **bp_proc;		/* the procedures to place */
+static int *bp_link;			/* cluster that each proc is in */
+static int *bp_item;			/* the clusters, largest first */
+static int *bp_size;			/* size of each cluster */
+static int *bp_need;			/* bytes needed from item N onwards */
+static int *bp_free;			/* free bytes in each bin */
+static int *bp_bank;			/* chosen bin for each item */
+static int *bp_cand;			/* candidate bins for each item */
+static int bp_stride;			/* size of each item's candidates */
+static int *bp_undo;			/* copy of the above to undo a merge */
+static int bp_count;			/* number of procedures */
+static int bp_items;			/* number of clusters */
+static int bp_placed;			/* number of clusters in a bin */
+static int bp_bins;			/* number of existing banks */
+static int bp_new;			/* number of new banks allowed */
+static long bp_nodes;			/* search steps left */
+
+static int
+proc_cluster(int i)
+{
+	while (bp_link[i] != i)
+		i = bp_link[i];
+	return (i);
+}
+
+static int
+proc_compare_item(const void *a, const void *b)
+{
+	int ia = *(const int *)a;
+	int ib = *(const int *)b;
+
+	if (bp_size[ia] != bp_size[ib])
+		return (bp_size[ib] - bp_size[ia]);
+
+	return (ia - ib);
+}
+
+static void
+proc_need(void)
+{
+	int i;
+
+	bp_need[bp_items] = 0;
+	for (i = bp_items - 1; i >= 0; i--)
+		bp_need[i] = bp_need[i + 1] + bp_size[bp_item[i]];
+}
+
+static void
+proc_items(void)
+{
+	int i;
+
+	/* each cluster is named after the first proc in it */
+	for (bp_items = 0, i = 0; i < bp_count; i++) {
+		if (bp_link[i] == i)
+			bp_item[bp_items++] = i;
+	}
+
+	qsort(bp_item, bp_items, sizeof(int), proc_compare_item);
+
+	proc_need();
+}
+
+static int
+proc_fitfrom(int i, int max_new, int sf2)
+{
+	int b, bins, best, opened;
+
+	/* the new banks that the earlier items have opened */
+	for (opened = 0, b = 0; b < i; b++) {
+		if (bp_bank[b] >= bp_bins + opened)
+			opened = bp_bank[b] - bp_bins + 1;
+	}
+
+	/* the same search as proc_reloc(), but only counting banks */
+	for (; i < bp_items; i++) {
+		bins = bp_bins + (sf2 ? 0 : opened);
+		best = -1;
+		for (b = 0; b < bins; b++) {
+			if (bp_free[b] != 0 && bp_free[b] >= bp_size[bp_item[i]]) {
+				if (best < 0 || bp_free[b] < bp_free[best])
+					best = b;
+			}
+		}
+		if (best < 0) {
+			if (opened >= max_new) {
+				bp_placed = i;
+				return (-1);
+			}
+			best = bp_bins + opened++;
+			bp_free[best] = 0x2000;
+		}
+		bp_free[best] -= bp_size[bp_item[i]];
+		bp_bank[i] = best;
+	}
+
+	bp_placed = bp_items;
+	return (opened);
+}
+
+static int
+proc_bestfit(int *bank_free, int max_new, int sf2)
+{
+	memcpy(bp_free, bank_free, sizeof(int) * bp_bins);
+
+	return (proc_fitfrom(0, max_new, sf2));
+}
+
+/* merge cluster b into cluster a, and redo the best-fit from the */
+/* first item whose place in the list changes, the items that are */
+/* larger than the new cluster stay where they are */
+
+static int
+proc_merge(int a, int b, int max_new, int sf2)
+{
+	int *undo_item = bp_undo;
+	int *undo_bank = bp_undo + bp_count;
+	int *undo_free = bp_undo + bp_count * 2;
+	int undo_items = bp_items;
+	int undo_placed = bp_placed;
+	int size = bp_size[a] + bp_size[b];
+	int i, j, k, p, q;
+
+	/* where the two parts are, and where the new cluster goes */
+	for (p = bp_items, q = 0, i = 0; i < bp_items; i++) {
+		k = bp_item[i];
+		if (k == a || k == b) {
+			if (p > i)
+				p = i;
+			continue;
+		}
+		if (bp_size[k] > size || (bp_size[k] == size && k < a))
+			++q;
+	}
+	if (p > q)
+		p = q;
+
+	memcpy(undo_item, bp_item, sizeof(int) * bp_items);
+	memcpy(undo_bank, bp_bank, sizeof(int) * bp_items);
+	memcpy(undo_free, bp_free, sizeof(int) * bp_stride);
+
+	/* take everything from there onwards back out of the bins */
+	for (i = p; i < bp_placed; i++)
+		bp_free[bp_bank[i]] += bp_size[bp_item[i]];
+
+	bp_link[b] = a;
+	bp_size[a] = size;
+
+	for (j = 0, i = 0; i < bp_items; i++) {
+		if (bp_item[i] != a && bp_item[i] != b)
+			bp_item[j++] = bp_item[i];
+	}
+	memmove(bp_item + q + 1, bp_item + q, sizeof(int) * (j - q));
+	bp_item[q] = a;
+	bp_items = j + 1;
+
+	if ((k = proc_fitfrom(p, max_new, sf2)) < 0) {
+		bp_link[b] = b;
+		bp_size[a] -= bp_size[b];
+		bp_items = undo_items;
+		bp_placed = undo_placed;
+		memcpy(bp_item, undo_item, sizeof(int) * bp_items);
+		memcpy(bp_bank, undo_bank, sizeof(int) * bp_items);
+		memcpy(bp_free, undo_free, sizeof(int) * bp_stride);
+	}
+
+	return (k);
+}
+
+static int
+proc_binpack_fit(int i, int opened)
+{
+	int *cand = bp_cand + i * bp_stride;
+	int size, room, least, n, b, j, k;
+
+	if (i == bp_items)
+		return (1);
+	if (--bp_nodes < 0)
+		return (0);
+
+	/* is there still enough usable space left? */
+	least = bp_size[bp_item[bp_items - 1]];
+	room = (bp_new - opened) * 0x2000;
+	for (b = 0; b < bp_bins + opened; b++) {
+		if (bp_free[b] != 0 && bp_free[b] >= least)
+			room += bp_free[b];
+	}
+	if (room < bp_need[i])
+		return (0);
+
+	/* don't use a full bank, even if the size is 0 */
+	size = bp_size[bp_item[i]];
+	n = 0;
+	for (b = 0; b < bp_bins + opened; b++) {
+		if (bp_free[b] == 0 || bp_free[b] < size)
+			continue;
+		for (j = 0; j < n; j++) {
+			if (bp_free[cand[j]] == bp_free[b])
+				break;
+		}
+		if (j == n)
+			cand[n++] = b;
+	}
+
+	/* a new bank is only worth trying if no other bank is empty */
+	if (opened < bp_new) {
+		b = bp_bins + opened;
+		for (j = 0; j < n; j++) {
+			if (bp_free[cand[j]] == bp_free[b])
+				break;
+		}
+		if (j == n)
+			cand[n++] = b;
+	}
+
+	/* try the tightest fit first */
+	for (j = 1; j < n; j++) {
+		b = cand[j];
+		for (k = j; k > 0 && bp_free[cand[k - 1]] > bp_free[b]; k--)
+			cand[k] = cand[k - 1];
+		cand[k] = b;
+	}
+
+	for (j = 0; j < n; j++) {
+		b = cand[j];
+		bp_free[b] -= size;
+		bp_bank[i] = b;
+		if (proc_binpack_fit(i + 1, opened + (b == bp_bins + opened)))
+			return (1);
+		bp_free[b] += size;
+		if (bp_nodes < 0)
+			break;
+	}
+
+	/* no placement */
+	return (0);
+}
+
+static int
+proc_unit(struct t_proc *proc)
+{
+	int i;
+
+	while (proc->group)
+		proc = proc->group;
+
+	for (i = 0; i < bp_count; i++) {
+		if (bp_proc[i] == proc)
+			return (i);
+	}
+
+	/* stripped */
+	return (-1);
+}
+
+struct t_unitcall {
+	int from;
+	int to;
+	int count;
+};
+
+static int
+proc_compare_call(const void *a, const void *b)
+{
+	const struct t_unitcall *ca = a;
+	const struct t_unitcall *cb = b;
+
+	if (ca->count != cb->count)
+		return (cb->count - ca->count);
+	if (ca->from != cb->from)
+		return (ca->from - cb->from);
+	return (ca->to - cb->to);
+}
+
+static int
+proc_thunked(struct t_unitcall *calls, int ncalls, int *unit_bank)
+{
+	int i, thunked = 0;
+
+	for (i = 0; i < ncalls; i++) {
+		if (unit_bank[calls[i].from] != unit_bank[calls[i].to])
+			thunked += calls[i].count;
+	}
+
+	return (thunked);
+}
+
+int *
+proc_binpack(int *bank_free, int last_bank, int max_new, int sf2)
+{
+	int *plan = NULL;
+	int *base = NULL;
+	struct t_unitcall *calls = NULL;
+	int ncalls = 0;
+	int merged = 0;
+	int i, j, k, n, best, greedy, banks;
+	t_call *call;
+
+	for (n = 0, proc_ptr = proc_first; proc_ptr; proc_ptr = proc_ptr->link) {
+		if (proc_ptr->group == NULL && proc_ptr->bank != STRIPPED_BANK)
+			++n;
+	}
+
+	if (n == 0)
+		return (NULL);
+
+	bp_count = n;
+	bp_bins = last_bank + 1;
+	bp_proc = malloc(sizeof(struct t_proc *) * n);
+	bp_link = malloc(sizeof(int) * n);
+	bp_item = malloc(sizeof(int) * n);
+	bp_size = malloc(sizeof(int) * n);
+	bp_need = malloc(sizeof(int) * (n + 1));
+	bp_bank = malloc(sizeof(int) * n);
+	bp_free = malloc(sizeof(int) * (bp_bins + max_new + 1));
+	/* each step of the search can try every existing bank, every */
+	/* bank that it has already opened, and then one more new bank */
+	bp_stride = bp_bins + max_new + 1;
+	bp_cand = malloc(sizeof(int) * n * bp_stride);
+	bp_undo = malloc(sizeof(int) * (n * 2 + bp_stride));
+	base = malloc(sizeof(int) * n);
+	plan = malloc(sizeof(int) * n);
+
+	if (!bp_proc || !bp_link || !bp_item || !bp_size || !bp_need ||
+	    !bp_bank || !bp_free || !bp_cand || !bp_undo || !base || !plan) {
+		fatal_error("Not enough RAM to optimize the procedure packing!");
+		free(plan);
+		plan = NULL;
+		goto done;
+	}
+
+	for (i = 0, proc_ptr = proc_first; proc_ptr; proc_ptr = proc_ptr->link) {
+		if (proc_ptr->group == NULL && proc_ptr->bank != STRIPPED_BANK) {
+			bp_proc[i] = proc_ptr;
+			bp_link[i] = i;
+			bp_size[i] = proc_ptr->size;
+			++i;
+		}
+	}
+
+	/* how many new banks does best-fit need? */
+	proc_items();
+	greedy = proc_bestfit(bank_free, max_new, sf2);
+	banks = greedy;
+
+	for (i = 0; i < bp_items; i++)
+		base[bp_item[i]] = bp_bank[i];
+
+	/* merge the procedures that call each other most often */
+	if (cluster_opt) {
+		for (i = 0; i < HASH_COUNT; i++) {
+			for (call = call_tbl[i]; call; call = call->next)
+				++ncalls;
+		}
+		if ((calls = malloc(sizeof(struct t_unitcall) * (ncalls + 1))) == NULL) {
+			fatal_error("Not enough RAM to optimize the procedure packing!");
+			free(plan);
+			plan = NULL;
+			goto done;
+		}
+
+		/* only keep calls between two different relocatable units */
+		for (ncalls = 0, i = 0; i < HASH_COUNT; i++) {
+			for (call = call_tbl[i]; call; call = call->next) {
+				if (call->pass != pass_count || call->to->proc == NULL ||
+				    call->to->proc->label != call->to)
+					continue;
+				calls[ncalls].from = proc_unit(call->from);
+				calls[ncalls].to = proc_unit(call->to->proc);
+				calls[ncalls].count = call->count;
+				if (calls[ncalls].from >= 0 && calls[ncalls].to >= 0 &&
+				    calls[ncalls].from != calls[ncalls].to)
+					++ncalls;
+			}
+		}
+
+		/* most calls first, in an order that doesn't depend on the hash */
+		qsort(calls, ncalls, sizeof(struct t_unitcall), proc_compare_call);
+
+		for (i = 0; i < ncalls; i++) {
+			int a = proc_cluster(calls[i].from);
+			int b = proc_cluster(calls[i].to);
+
+			if (a == b || bp_size[a] + bp_size[b] > 0x2000)
+				continue;
+
+			/* keep the lower index as the name of the cluster */
+			if (b < a) {
+				j = a; a = b; b = j;
 			}
 
-			if (!inserted)
-				previous->link = proc_ptr;
+			/* don't let clustering use more banks than best-fit */
+			/* n.b. the SF2 mapper needs them all in the first 64 */
+			k = sf2 ? 0 : (banks < 0) ? max_new : banks;
+			if ((k = proc_merge(a, b, k, sf2)) >= 0) {
+				banks = k;
+				++merged;
+			}
 		}
+
+		proc_need();
 	}
-	proc_first = sorted_list;
-	return;
+
+	/* try with fewer and fewer new banks, until it fails */
+	/* n.b. the SF2 mapper needs them all in the first 64 */
+	best = -1;
+	if (binpack_opt) {
+		k = (banks < 0) ? max_new : banks - 1;
+		if (sf2 && k > 0)
+			k = 0;
+
+		for (; k >= 0; k--) {
+			memcpy(bp_free, bank_free, sizeof(int) * bp_bins);
+			for (i = 0; i < k; i++)
+				bp_free[bp_bins + i] = 0x2000;
+
+			bp_new = k;
+			bp_nodes = BINPACK_NODES;
+			if (!proc_binpack_fit(0, 0))
+				break;
+
+			best = k;
+			for (i = 0; i < bp_items; i++)
+				plan[bp_item[i]] = bp_bank[i];
+		}
+
+		if (greedy < 0 && best >= 0)
+			printf("Procedure bin-packing fits in %d new bank(s), best-fit did not fit\n", best);
+		else if (greedy >= 0)
+			printf("Procedure bin-packing saved %d bank(s) over best-fit\n", (best < 0) ? 0 : greedy - best);
+	}
+
+	/* the clusters without the branch-and-bound */
+	if (best < 0 && merged) {
+		proc_bestfit(bank_free, max_new, sf2);
+		for (i = 0; i < bp_items; i++)
+			plan[bp_item[i]] = bp_bank[i];
+		best = banks;
+	}
+
+	if (best < 0) {
+		free(plan);
+		plan = NULL;
+	} else {
+		/* every proc goes into the same bank as its cluster */
+		for (i = 0; i < n; i++)
+			plan[i] = plan[proc_cluster(i)];
+		for (i = 0; i < n; i++) {
+			if (plan[i] > last_bank)
+				plan[i] = plan[i] - bp_bins + max_bank + 1;
+		}
+	}
+
+	if (cluster_opt) {
+		k = (greedy < 0) ? 0 : proc_thunked(calls, ncalls, base);
+		printf("Procedure clustering removed %d of %d thunked call(s)\n",
+			(plan && greedy >= 0) ? k - proc_thunked(calls, ncalls, plan) : 0, k);
+	}
+
+done:
+	free(bp_proc);
+	free(bp_link);
+	free(bp_item);
+	free(bp_size);
+	free(bp_need);
+	free(bp_bank);
+	free(bp_free);
+	free(bp_cand);
+	free(bp_undo);
+	free(base);
+	free(calls);
+	return (plan);
 }
 
 
@@ -1011,6 +1591,23 @@ list_procs(void)
 			proc_ptr = proc_ptr->link;
 		}
 	}
+
+	/* the static cost of each procedure, a loop is only counted once */
+	proc_ptr = proc_first;
+
+	if (cycles_opt && (lst_fp != NULL) && (proc_ptr != NULL) && (fprintf(lst_fp, "\nPROCEDURE CYCLES (each instruction counted once):\n\n") > 0)) {
+		++lst_line;
+		while (proc_ptr) {
+			if ((proc_ptr->bank < UNDEFINED_BANK) && (proc_ptr->instructions != 0)) {
+				if (fprintf(lst_fp, "Instructions: %5d, Cycles: %7d, Taken: %7d, %s %s\n", proc_ptr->instructions,
+					proc_ptr->cycles, proc_ptr->cycles_most,
+					(proc_ptr->type == P_PGROUP) ? ".procgroup" : "     .proc" , proc_ptr->label->name + 1) < 0)
+					break;
+				++lst_line;
+			}
+			proc_ptr = proc_ptr->link;
+		}
+	}
 }
 
 
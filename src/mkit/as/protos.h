@@ -52,6 +52,7 @@ void do_rsset(int *ip);
 void do_rs(int *ip);
 void do_ds(int *ip);
 void do_fail(int *ip);
+void do_out(int *ip);
 void do_section(int *ip);
 void do_incchr(int *ip);
 void do_opt(int *ip);
@@ -105,6 +106,8 @@ void  clear_included(void);
 void  make_filelist(void);
 int   open_input(const char *name);
 int   close_input(void);
+void  rewind_input(void);
+void  source_stats(FILE *fp);
 FILE *open_file(const char *fname, const char *mode);
 
 /* MACRO.C */
@@ -126,11 +129,21 @@ void data_reloc(void);
 int pce_load_map(char *fname, int mode);
 int pce_load_stm(char *fname, int mode);
 
+/* OUTBIN.C */
+void outbin_flush(void);
+unsigned outbin_queue(FILE *fp, const unsigned char *data, unsigned length, unsigned window, int compress, int wait);
+void outbin_listed(long lst_pos);
+void outbin_close(FILE *fp);
+void zx0_stats(FILE *fp);
+
 /* OUTPUT.C */
 void println(void);
+void code_cycles(int start);
 void clearln(void);
 void loadlc(int offset, int f);
 void hexcon(int digit, int num);
+void rom_use(int which_bank, int offset, int size);
+void rom_stats(FILE *fp);
 void putbyte(int offset, int data, int is_code);
 void putword(int offset, int data, int is_code);
 void putdword(int offset, int data);
@@ -139,6 +152,8 @@ void write_srec(char *fname, char *ext, int base);
 void error(const char *format, ...);
 void warning(const char *format, ...);
 void fatal_error(const char *format, ...);
+void error_at(t_file *file, int file_num, int line, const char *format, ...);
+void warning_at(t_file *file, int file_num, int line, const char *format, ...);
 
 /* PCX.C */
 int  pcx_pack_8x8_tile(unsigned char *buffer, int x, int y);
@@ -148,6 +163,9 @@ int  pcx_set_tile(struct t_symbol *ref, unsigned int offset);
 int  pcx_search_tile(unsigned char *data, int size);
 int  pcx_get_args(int *ip, unsigned valid);
 int  pcx_parse_args(int i, int nb, int *a, int *b, int *c, int *d, int size);
+int  image_find(const char *name);
+void image_add(const char *name);
+void image_stats(FILE *fp);
 int  pcx_load(char *name);
 void decode_256(FILE *fp, int w, int h);
 void decode_16(FILE *fp, int w, int h);
@@ -167,11 +185,14 @@ int check_thunks(void);
 
 /* SYMBOL.C */
 uint32_t debug_info(int is_code);
-int  symhash(void);
+unsigned int namehash(const char *name);
+unsigned int symhash(void);
+void symtbl_init(void);
+void symtbl_stats(FILE *fp);
 int  addscope(struct t_symbol * curscope, int i);
 int  colsym(int *ip, int flag);
 struct t_symbol *stlook(int flag);
-struct t_symbol *stinstall(int hash, int type);
+struct t_symbol *stinstall(unsigned int hash, int type);
 int  labldef(unsigned char reason);
 void lablset(char *name, int val);
 int  lablexists(char *name);
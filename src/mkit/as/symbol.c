@@ -29,27 +29,186 @@ debug_info(int is_code)
 }
 
 
+/* ----
+ * namehash()
+ * ----
+ * calculate the FNV-1a hash value of a length-prefixed name,
+ * the caller masks it to the size of the table it is using
+ */
+
+unsigned int
+namehash(const char *name)
+{
+	int i;
+	unsigned int hash = 2166136261u;
+
+	/* hash value */
+	for (i = 1; i <= name[0]; i++) {
+		hash ^= (unsigned char)name[i];
+		hash *= 16777619u;
+	}
+
+	/* ok */
+	return (hash);
+}
+
+
 /* ----
  * symhash()
  * ----
  * calculate the hash value of a symbol
  */
 
-int
+unsigned int
 symhash(void)
 {
+	return (namehash(symbol));
+}
+
+
+/* ----
+ * lochash()
+ * ----
+ * calculate the hash value of a local symbol, which also
+ * depends upon the global label that owns it
+ */
+
+static unsigned int
+lochash(unsigned int hash, struct t_symbol *owner)
+{
+	hash ^= (unsigned int)((uintptr_t)owner >> 4);
+	hash *= 16777619u;
+	return (hash);
+}
+
+
+/* symbol table statistics for "--stats" */
+static int global_count;
+static int local_count;
+static unsigned long global_lookups;
+static unsigned long global_probes;
+static unsigned long local_lookups;
+static unsigned long local_probes;
+
+
+/* ----
+ * symtbl_init()
+ * ----
+ * allocate the empty symbol hash tables
+ */
+
+void
+symtbl_init(void)
+{
+	hash_size = SYM_HASH_INIT;
+	local_size = SYM_HASH_INIT;
+
+	hash_tbl = calloc(hash_size, sizeof(struct t_symbol *));
+	local_tbl = calloc(local_size, sizeof(struct t_symbol *));
+
+	if ((hash_tbl == NULL) || (local_tbl == NULL)) {
+		fprintf(ERROUT, "Error: Not enough memory!\n");
+		exit(1);
+	}
+}
+
+
+/* ----
+ * symtbl_grow()
+ * ----
+ * double the number of buckets in a symbol hash table once
+ * the load factor goes above 1, so that chains stay short
+ */
+
+static void
+symtbl_grow(int is_local)
+{
+	struct t_symbol **old_tbl = is_local ? local_tbl : hash_tbl;
+	struct t_symbol **new_tbl;
+	struct t_symbol *sym;
+	struct t_symbol *nextsym;
+	unsigned int hash;
+	int old_size = is_local ? local_size : hash_size;
+	int new_size = old_size * 2;
 	int i;
-	char c;
-	int hash = 0;
 
-	/* hash value */
-	for (i = 1; i <= symbol[0]; i++) {
-		c = symbol[i];
-		hash += c;
+	if ((new_tbl = calloc(new_size, sizeof(struct t_symbol *))) == NULL) {
+		/* not fatal, the chains just get longer */
+		return;
 	}
 
-	/* ok */
-	return (hash & 0xFF);
+	/* rehash every chain into the new table */
+	for (i = 0; i < old_size; i++) {
+		for (sym = old_tbl[i]; sym != NULL; sym = nextsym) {
+			hash = namehash(sym->name);
+			if (is_local) {
+				nextsym = sym->link;
+				hash = lochash(hash, sym->owner) & (new_size - 1);
+				sym->link = new_tbl[hash];
+			} else {
+				nextsym = sym->next;
+				hash = hash & (new_size - 1);
+				sym->next = new_tbl[hash];
+			}
+			new_tbl[hash] = sym;
+		}
+	}
+
+	free(old_tbl);
+
+	if (is_local) {
+		local_tbl = new_tbl;
+		local_size = new_size;
+	} else {
+		hash_tbl = new_tbl;
+		hash_size = new_size;
+	}
+}
+
+
+/* ----
+ * chain_stats()
+ * ----
+ * show the load and chain lengths of one symbol hash table
+ */
+
+static void
+chain_stats(FILE *fp, const char *name, struct t_symbol **tbl, int size, int count, int is_local, unsigned long lookups, unsigned long probes)
+{
+	struct t_symbol *sym;
+	int i, len, used, longest;
+
+	used = 0;
+	longest = 0;
+	for (i = 0; i < size; i++) {
+		len = 0;
+		for (sym = tbl[i]; sym != NULL; sym = is_local ? sym->link : sym->next)
+			len++;
+		if (len)
+			used++;
+		if (longest < len)
+			longest = len;
+	}
+
+	fprintf(fp, "  %-6s  %7d symbols  %7d buckets  load %.2f  used %.2f  longest chain %d\n",
+		name, count, size, (double)count / size, (double)used / size, longest);
+	fprintf(fp, "  %-6s  %7lu lookups  %.2f probes per lookup\n",
+		"", lookups, lookups ? (double)probes / lookups : 0.0);
+}
+
+
+/* ----
+ * symtbl_stats()
+ * ----
+ * show the symbol hash table load and probe lengths
+ */
+
+void
+symtbl_stats(FILE *fp)
+{
+	fprintf(fp, "\nSymbol Table:\n");
+	chain_stats(fp, "global", hash_tbl, hash_size, global_count, 0, global_lookups, global_probes);
+	chain_stats(fp, "local", local_tbl, local_size, local_count, 1, local_lookups, local_probes);
 }
 
 
@@ -201,23 +360,26 @@ struct t_symbol *
 stlook(int type)
 {
 	struct t_symbol *sym;
-	int hash;
+	unsigned int hash;
 
 	/* local symbol */
 	if (symbol[1] == '.' || symbol[1] == '@') {
 		if (glablptr) {
-			/* search the symbol in the local list */
-			sym = glablptr->local;
+			/* search the symbol in the local hash table */
+			hash = lochash(symhash(), glablptr);
+			sym = local_tbl[hash & (local_size - 1)];
+			local_lookups++;
 
 			while (sym) {
-				if (!strcmp(symbol, sym->name))
+				local_probes++;
+				if ((sym->owner == glablptr) && !strcmp(symbol, sym->name))
 					break;
-				sym = sym->next;
+				sym = sym->link;
 			}
 
 			/* new symbol */
 			if ((sym == NULL) && (type != SYM_CHK)) {
-				sym = stinstall(0, 1);
+				sym = stinstall(hash, 1);
 			}
 		}
 		else {
@@ -231,8 +393,11 @@ stlook(int type)
 	else {
 		/* search symbol */
 		hash = symhash();
-		sym = hash_tbl[hash];
+		sym = hash_tbl[hash & (hash_size - 1)];
+		global_lookups++;
+
 		while (sym) {
+			global_probes++;
 			if (!strcmp(symbol, sym->name))
 				break;
 			sym = sym->next;
@@ -267,7 +432,7 @@ stlook(int type)
  */
 
 struct t_symbol *
-stinstall(int hash, int type)
+stinstall(unsigned int hash, int type)
 {
 	struct t_symbol *sym;
 
@@ -306,17 +471,30 @@ stinstall(int hash, int type)
 	sym->type = if_expr ? IFUNDEF : UNDEF;
 	sym->flags = 0;
 	sym->palette = -1;
+	sym->link = NULL;
+	sym->owner = NULL;
 
 	/* add the symbol to the hash table */
 	if (type) {
 		/* local */
 		sym->next = glablptr->local;
 		glablptr->local = sym;
+
+		/* local hash table */
+		sym->owner = glablptr;
+		sym->link = local_tbl[hash & (local_size - 1)];
+		local_tbl[hash & (local_size - 1)] = sym;
+
+		if (++local_count > local_size)
+			symtbl_grow(1);
 	}
 	else {
 		/* global */
-		sym->next = hash_tbl[hash];
-		hash_tbl[hash] = sym;
+		sym->next = hash_tbl[hash & (hash_size - 1)];
+		hash_tbl[hash & (hash_size - 1)] = sym;
+
+		if (++global_count > hash_size)
+			symtbl_grow(0);
 	}
 
 	/* ok */
@@ -586,7 +764,7 @@ lablremap(void)
 	int i;
 
 	/* browse the symbol table */
-	for (i = 0; i < HASH_COUNT; i++) {
+	for (i = 0; i < hash_size; i++) {
 		sym = hash_tbl[i];
 		while (sym) {
 			/* remap the bank */
@@ -637,7 +815,7 @@ lablsort(void)
 	memset(sort_tbl, 0, HASH_COUNT * sizeof(struct t_symbol *));
 
 	/* insertion-sort the symbol table */
-	for (i = 0; i < HASH_COUNT; i++) {
+	for (i = 0; i < hash_size; i++) {
 		for (newsym = hash_tbl[i]; newsym != NULL; newsym = nextsym) {
 			nextsym = newsym->next;
 
@@ -722,6 +900,7 @@ lablsort(void)
 		}
 	}
 
+	memset(hash_tbl, 0, hash_size * sizeof(struct t_symbol *));
 	memcpy(hash_tbl, sort_tbl, HASH_COUNT * sizeof(struct t_symbol *));
 }
 
@@ -746,7 +925,7 @@ labldump(FILE *fp)
 	fprintf(fp, "----\t----\t-----\n");
 
 	/* browse the symbol table */
-	for (i = 0; i < HASH_COUNT; i++) {
+	for (i = 0; i < hash_size; i++) {
 		for (sym = hash_tbl[i]; sym != NULL; sym = sym->next) {
 			/* skip undefined symbols and stripped symbols */
 			if ((sym->type != DEFABS) || (sym->mprbank == STRIPPED_BANK) || (sym->name[1] == '!'))
@@ -865,7 +1044,7 @@ debugdump(FILE *fp)
 
 	/* output the [symbols] section */
 	fprintf(fp, "\n[symbols]\n");
-	for (i = 0; i < HASH_COUNT; i++) {
+	for (i = 0; i < hash_size; i++) {
 		for (sym = hash_tbl[i]; sym != NULL; sym = sym->next) {
 			/* skip undefined symbols and stripped symbols */
 			if (sym->fileinfo == NULL || sym->mprbank < 0 || sym->mprbank >= UNDEFINED_BANK)
@@ -934,11 +1113,9 @@ debugdump(FILE *fp)
 
 			/* start SFII mapper banks at bank $100 */
 			if (bank < 0x80) {
-				bank += bank_base;
-				fprintf(fp, "%2.2x:%4.4x ", bank, ((map[bank][addr] >> 5) << 13) + addr);
+				fprintf(fp, "%2.2x:%4.4x ", bank + bank_base, ((map[bank][addr] >> 5) << 13) + addr);
 			} else {
-				bank += 0x80;
-				fprintf(fp, "%3.3x:%4.4x ", bank, ((map[bank][addr] >> 5) << 13) + addr);
+				fprintf(fp, "%3.3x:%4.4x ", bank + 0x80, ((map[bank][addr] >> 5) << 13) + addr);
 			}
 
 			fprintf(fp, "%8.8x ", (code << 30) + size);
@@ -961,7 +1138,7 @@ lablstartpass(void)
 	int i;
 
 	/* browse the symbol table */
-	for (i = 0; i < HASH_COUNT; i++) {
+	for (i = 0; i < hash_size; i++) {
 		sym = hash_tbl[i];
 		while (sym) {
 			sym->deflastpass = sym->defthispass;
@@ -48,10 +48,20 @@ int in_final;                                   /* set when in xxxx-final.asm in
 int preproc_inblock;                            /* C-style comment: within block comment */
 int preproc_sfield;                             /* C-style comment: SFIELD as a variable */
 int preproc_modidx;                             /* C-style comment: offset to modified char */
+int stats_opt;                                  /* NZ to show internal statistics */
+char zx0_cache_dir[PATHSZ];                     /* directory for cached .OUTZX0 data */
+int jobs_opt;                                   /* number of threads for .OUTZX0 */
+int binpack_opt;                                /* NZ to search for a tighter .proc packing */
+int cluster_opt;                                /* NZ to put .procs that call each other together */
+int cycles_opt;                                 /* NZ to show instruction cycles in the listing */
+int in_opcode;                                  /* NZ while assembling an instruction */
 
 t_machine *machine;
 t_opcode *inst_tbl[HASH_COUNT];                 /* instructions hash table */
-t_symbol *hash_tbl[HASH_COUNT];                 /* label hash table */
+t_symbol **hash_tbl;                            /* global label hash table */
+t_symbol **local_tbl;                           /* local label hash table */
+int hash_size;                                  /* number of buckets in hash_tbl */
+int local_size;                                 /* number of buckets in local_tbl */
 t_symbol *lablptr;                              /* label pointer into symbol table */
 t_symbol *glablptr;                             /* pointer to the latest defined global label */
 t_symbol *scopeptr;                             /* pointer to the latest defined scope label */
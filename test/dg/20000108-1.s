@@ -0,0 +1,119 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/20000108-1.c", 1; /* Copyright (C) 2000  Free Software Foundation.
+	.dbg	line,	"dg/20000108-1.c", 3; by Alexandre Oliva  <oliva@lsd.ic.unicamp.br>  */
+	.dbg	line,	"dg/20000108-1.c", 5; /* { dg-do run } */
+	.dbg	line,	"dg/20000108-1.c", 6; /* { dg-options "-O3" } */
+	.dbg	line,	"dg/20000108-1.c", 8; extern void abort (void);
+	.dbg	line,	"dg/20000108-1.c", 10; void foo () {} /* unused, but essential to trigger the bug */
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/20000108-1.c", 12; int main () {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/20000108-1.c", 13; int i;
+
+	.dbg	line,	"dg/20000108-1.c", 14; /* use asms to prevent optimizations */
+
+	.dbg	line,	"dg/20000108-1.c", 15; i = -1; //*/ asm ("" : "=r" (i) : "0" (-1));
+
+	.dbg	line,	"dg/20000108-1.c", 16; i =  1; //*/ asm ("" : "=r" (i) : "0" (i ? 1 : 2));
+	__st.wmiq	1, __main_end - 2  /* i */
+
+	.dbg	line,	"dg/20000108-1.c", 17; if (i != 1)
+	__ld.wm		__main_end - 2  /* i */
+	__neq_w.wi	1
+	__bfalse	.LL4
+
+	.dbg	line,	"dg/20000108-1.c", 18; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/20000108-1.c", 19; return 0;
+.LL4:
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"dg/20000108-1.c", 20; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
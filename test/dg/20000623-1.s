@@ -0,0 +1,146 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/20000623-1.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/20000623-1.c", 2; /* { dg-options "-O3 -fno-strict-aliasing" } */
+	.dbg	line,	"dg/20000623-1.c", 4; extern void exit (int);
+	.dbg	line,	"dg/20000623-1.c", 5; extern void abort (void);
+	.dbg	line,	"dg/20000623-1.c", 7; struct foos { int l; }; 
+	.dbg	line,	"dg/20000623-1.c", 8; int foo;
+	.dbg	line,	"dg/20000623-1.c", 9; static struct foos *getfoo(void);
+	.dbg	line,	"dg/20000623-1.c", 10; int main (void)
+	.dbg	line,	"dg/20000623-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/20000623-1.c", 12; struct foos *f;f = getfoo();
+	__call		_getfoo
+	__st.wmq	__main_end - 2  /* f */
+
+	.dbg	line,	"dg/20000623-1.c", 13; f->l = 1;
+	__push.wr
+	__ld.wi		1
+	__st.wtq
+
+	.dbg	line,	"dg/20000623-1.c", 14; foo = 2;
+	__st.wmiq	2, _foo
+
+	.dbg	line,	"dg/20000623-1.c", 15; if (f->l == 1)
+	__ld.wm		__main_end - 2  /* f */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__equ_w.wi	1
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/20000623-1.c", 16; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/20000623-1.c", 17; exit(0);
+.LL3:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"dg/20000623-1.c", 18; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"dg/20000623-1.c", 19; static struct foos *getfoo(void) 
+	.dbg	line,	"dg/20000623-1.c", 20; { return /*(struct foos *)*/&foo; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_getfoo
+	__enter		_getfoo
+	__ld.wi		_foo
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  overlaid locals
+;         4      4     2  foo
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 6
+__main_end	=	__overlay_frames + 2
+	auto_zp_var	_foo, 2, 4, 4
+	.endm
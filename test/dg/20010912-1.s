@@ -0,0 +1,313 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/20010912-1.c", 1; /* { dg-do run { target fpic } } */
+	.dbg	line,	"dg/20010912-1.c", 2; /* { dg-options "-O2 -fpic" } */
+	.dbg	line,	"dg/20010912-1.c", 3; /* { dg-bogus "\[Uu\]nresolved symbol .(_GLOBAL_OFFSET_TABLE_|\[_.A-Za-z\]\[_.0-9A-Za-z\]*@(PLT|GOT|GOTOFF))" "PIC unsupported" { xfail *-*-netware* } 0 } */
+	.dbg	line,	"dg/20010912-1.c", 5; extern void abort (void);
+	.dbg	line,	"dg/20010912-1.c", 6; extern void exit (int);
+	.dbg	line,	"dg/20010912-1.c", 8; int bar (int x, char **y)
+	.dbg	line,	"dg/20010912-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"dg/20010912-1.c", 10; if (x != 56)
+	__ld.ws		2  /* x */
+	__neq_w.wi	56
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/20010912-1.c", 11; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/20010912-1.c", 12; if (**y != 'a')
+.LL3:
+	__ld.ws		0  /* y */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	97
+	__bfalse	.LL4
+
+	.dbg	line,	"dg/20010912-1.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/20010912-1.c", 14; *y = "def";
+.LL4:
+	__ld.ws		0  /* y */
+	__push.wr
+	__ld.wi		__const1+0
+	__st.wtq
+
+	.dbg	line,	"dg/20010912-1.c", 15; return 1;
+	__ld.wi		1
+.LL2:
+
+	.dbg	line,	"dg/20010912-1.c", 16; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/20010912-1.c", 18; int baz (int x, char **y)
+	.dbg	line,	"dg/20010912-1.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_baz
+	__enter		_baz
+
+	.dbg	line,	"dg/20010912-1.c", 20; if (x != 56)
+	__ld.ws		2  /* x */
+	__neq_w.wi	56
+	__bfalse	.LL6
+
+	.dbg	line,	"dg/20010912-1.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/20010912-1.c", 22; if (**y != 'a')
+.LL6:
+	__ld.ws		0  /* y */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	97
+	__bfalse	.LL7
+
+	.dbg	line,	"dg/20010912-1.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/20010912-1.c", 24; return 26;
+.LL7:
+	__ld.wi		26
+.LL5:
+
+	.dbg	line,	"dg/20010912-1.c", 25; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/20010912-1.c", 27; int foo (int x, char *y)
+	.dbg	line,	"dg/20010912-1.c", 28; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"dg/20010912-1.c", 29; int a;
+
+	.dbg	line,	"dg/20010912-1.c", 30; char *b;b = y;
+	__ld.ws		0  /* y */
+	__st.wmq	__foo_end - 4  /* b */
+
+	.dbg	line,	"dg/20010912-1.c", 31; a = bar (x, &y);
+	__ld.ws		2  /* x */
+	__pusharg.wr
+	__lea.s		2  /* y */
+	__pusharg.wr
+	__call		_bar
+	__st.wmq	__foo_end - 2  /* a */
+
+	.dbg	line,	"dg/20010912-1.c", 32; if (a)
+	__tst.wm	__foo_end - 2  /* a */
+	__bfalse	.LL9
+
+	.dbg	line,	"dg/20010912-1.c", 33; {
+
+	.dbg	line,	"dg/20010912-1.c", 34; y = b;
+	__ld.wm		__foo_end - 4  /* b */
+	__st.wsq	0  /* y */
+
+	.dbg	line,	"dg/20010912-1.c", 35; a = baz (x, &y);
+	__ld.ws		2  /* x */
+	__pusharg.wr
+	__lea.s		2  /* y */
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__neq_w.wi	56
+	__bfalse	.LL10
+	__call		_abort
+.LL10:
+	__ld.ws		0  /* y */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	97
+	__bfalse	.LL11
+	__call		_abort
+.LL11:
+	__ld.wi		26
+.LL12:
+	__modsp		4
+	__st.wmq	__foo_end - 2  /* a */
+
+	.dbg	line,	"dg/20010912-1.c", 36; }
+
+	.dbg	line,	"dg/20010912-1.c", 37; if (a)
+.LL9:
+	__tst.wm	__foo_end - 2  /* a */
+	__bfalse	.LL13
+
+	.dbg	line,	"dg/20010912-1.c", 38; return a;
+	__ld.wm		__foo_end - 2  /* a */
+	__bra		.LL8
+
+	.dbg	line,	"dg/20010912-1.c", 40; baz (x, &y);
+.LL13:
+	__ld.ws		2  /* x */
+	__pusharg.wr
+	__lea.s		2  /* y */
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__neq_w.wi	56
+	__bfalse	.LL14
+	__call		_abort
+.LL14:
+	__ld.ws		0  /* y */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	97
+	__bfalse	.LL15
+	__call		_abort
+.LL15:
+	__ld.wi		26
+.LL16:
+	__modsp		4
+
+	.dbg	line,	"dg/20010912-1.c", 41; return 0;
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"dg/20010912-1.c", 42; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"dg/20010912-1.c", 44; int main ()
+	.dbg	line,	"dg/20010912-1.c", 45; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/20010912-1.c", 46; if (foo (56, "abc") != 26)
+	__ld.wi		56
+	__pusharg.wr
+	__ld.wi		__const1+4
+	__pusharg.wr
+	__call		_foo
+	__neq_w.wi	26
+	__bfalse	.LL18
+
+	.dbg	line,	"dg/20010912-1.c", 47; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/20010912-1.c", 48; exit (0);
+.LL18:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"dg/20010912-1.c", 49; }
+.LL17:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'd','e','f',$00,'a','b','c',$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:8
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _foo
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        14     14     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 14, 14
+__foo_end	=	__overlay_frames + 4
+	.endm
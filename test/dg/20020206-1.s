@@ -0,0 +1,205 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/20020206-1.c", 1; /* This code is from the beginning of combine_reloads in reload.c in
+	.dbg	line,	"dg/20020206-1.c", 2; GCC 3.1-20020117, with simplifications.  It compiled incorrectly
+	.dbg	line,	"dg/20020206-1.c", 3; for -O2 -fprefetch-loop-arrays for ix86 targets.  */
+	.dbg	line,	"dg/20020206-1.c", 5; /* { dg-do run } */
+	.dbg	line,	"dg/20020206-1.c", 6; /* { dg-options "-O2 -fprefetch-loop-arrays -w" } */
+	.dbg	line,	"dg/20020206-1.c", 7; /* { dg-options "-O2 -fprefetch-loop-arrays -mtune=pentium3 -w" { target { { i?86-*-* x86_64-*-* } && ilp32 } } } */
+	.dbg	line,	"dg/20020206-1.c", 10; struct reload
+	.dbg	line,	"dg/20020206-1.c", 11; {
+	.dbg	line,	"dg/20020206-1.c", 12; int first_member;
+	.dbg	line,	"dg/20020206-1.c", 13; int out;
+	.dbg	line,	"dg/20020206-1.c", 14; int final_member;
+	.dbg	line,	"dg/20020206-1.c", 15; };
+	.dbg	line,	"dg/20020206-1.c", 17; int n_reloads;
+	.dbg	line,	"dg/20020206-1.c", 18; struct reload rld[10];
+	.dbg	line,	"dg/20020206-1.c", 20; static int
+	.dbg	line,	"dg/20020206-1.c", 21; combine_reloads ()
+	.dbg	line,	"dg/20020206-1.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_combine_reloads
+	__enter		_combine_reloads
+
+	.dbg	line,	"dg/20020206-1.c", 23; int i;
+
+	.dbg	line,	"dg/20020206-1.c", 24; int output_reload = -1;
+	__st.wmiq	-1, __combine_reloads_end - 4  /* output_reload */
+
+	.dbg	line,	"dg/20020206-1.c", 25; int secondary_out = -1;
+	__st.wmiq	-1, __combine_reloads_end - 6  /* secondary_out */
+
+	.dbg	line,	"dg/20020206-1.c", 27; for (i = 0; i < n_reloads; i++)
+	__st.wmiq	0, __combine_reloads_end - 2  /* i */
+.LL3:
+	__ld.wm		__combine_reloads_end - 2  /* i */
+	__slt_w.wm	_n_reloads
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__combine_reloads_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"dg/20020206-1.c", 28; if (rld[i].out != 0)
+	__ld.wm		__combine_reloads_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wi	_rld + 2
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__bfalse	.LL7
+
+	.dbg	line,	"dg/20020206-1.c", 29; {
+
+	.dbg	line,	"dg/20020206-1.c", 30; if (output_reload >= 0)
+	__ld.wm		__combine_reloads_end - 4  /* output_reload */
+	__sge_w.wi	0
+	__bfalse	.LL8
+
+	.dbg	line,	"dg/20020206-1.c", 31; return output_reload;
+	__ld.wm		__combine_reloads_end - 4  /* output_reload */
+	__bra		.LL2
+
+	.dbg	line,	"dg/20020206-1.c", 32; output_reload = i;
+.LL8:
+	__ld.wm		__combine_reloads_end - 2  /* i */
+	__st.wmq	__combine_reloads_end - 4  /* output_reload */
+
+	.dbg	line,	"dg/20020206-1.c", 33; }
+
+	.dbg	line,	"dg/20020206-1.c", 34; return output_reload;
+.LL7	.alias		.LL4
+	__bra		.LL4
+.LL6:
+	__ld.wm		__combine_reloads_end - 4  /* output_reload */
+.LL2:
+
+	.dbg	line,	"dg/20020206-1.c", 35; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__combine_reloads_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/20020206-1.c", 37; int
+	.dbg	line,	"dg/20020206-1.c", 38; main ()
+	.dbg	line,	"dg/20020206-1.c", 39; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/20020206-1.c", 40; n_reloads = 4;
+	__st.wmiq	4, _n_reloads
+
+	.dbg	line,	"dg/20020206-1.c", 41; rld[2].out = 2;
+	__st.wmiq	2, _rld + 12 + 2
+
+	.dbg	line,	"dg/20020206-1.c", 42; if (combine_reloads () != 2)
+	__call		_combine_reloads
+	__neq_w.wi	2
+	__bfalse	.LL10
+
+	.dbg	line,	"dg/20020206-1.c", 43; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/20020206-1.c", 44; exit (0);
+.LL10:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"dg/20020206-1.c", 45; }
+.LL9:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_rld:
+		ds	60
+
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        18      4     2  n_reloads
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_n_reloads, 2, 4, 18
+	.endm
@@ -0,0 +1,181 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/20020210-1.c", 1; /* This used to fail on H8/300 due to incorrect specification of pushi1.  */
+	.dbg	line,	"dg/20020210-1.c", 3; /* { dg-do run } */
+	.dbg	line,	"dg/20020210-1.c", 4; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/20020210-1.c", 5; /* { dg-options "-O2 -fomit-frame-pointer" { target h8300-*-* } } */
+	.dbg	line,	"dg/20020210-1.c", 7; extern void abort (void);
+	.dbg	line,	"dg/20020210-1.c", 8; extern void exit (int);
+	.dbg	line,	"dg/20020210-1.c", 10; void
+	.dbg	line,	"dg/20020210-1.c", 11; bar (int a, int b, int c, int d, int e)
+	.dbg	line,	"dg/20020210-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"dg/20020210-1.c", 13; if (d != 1)
+	__ld.ws		2  /* d */
+	__neq_w.wi	1
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/20020210-1.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/20020210-1.c", 15; }
+.LL3:
+.LL2:
+	__modsp		10
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/20020210-1.c", 17; void
+	.dbg	line,	"dg/20020210-1.c", 18; foo (int a, int b, int c, int d, int e)
+	.dbg	line,	"dg/20020210-1.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"dg/20020210-1.c", 20; bar (a, b, c, d, e);
+	__ld.ws		8  /* a */
+	__pusharg.wr
+	__ld.ws		8  /* b */
+	__pusharg.wr
+	__ld.ws		8  /* c */
+	__pusharg.wr
+	__ld.ws		8  /* d */
+	__pusharg.wr
+	__ld.ws		8  /* e */
+	__pusharg.wr
+	__ld.ws		2  /* d */
+	__neq_w.wi	1
+	__bfalse	.LL5
+	__call		_abort
+.LL5:
+.LL6:
+	__modsp		10
+
+	.dbg	line,	"dg/20020210-1.c", 21; }
+.LL4:
+	__modsp		10
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/20020210-1.c", 23; int
+	.dbg	line,	"dg/20020210-1.c", 24; main ()
+	.dbg	line,	"dg/20020210-1.c", 25; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/20020210-1.c", 26; foo (0, 0, 0, 1, 2);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		8  /* a */
+	__pusharg.wr
+	__ld.ws		8  /* b */
+	__pusharg.wr
+	__ld.ws		8  /* c */
+	__pusharg.wr
+	__ld.ws		8  /* d */
+	__pusharg.wr
+	__ld.ws		8  /* e */
+	__pusharg.wr
+	__ld.ws		2  /* d */
+	__neq_w.wi	1
+	__bfalse	.LL8
+	__call		_abort
+.LL8:
+.LL9:
+	__modsp		10
+.LL10:
+	__modsp		10
+
+	.dbg	line,	"dg/20020210-1.c", 27; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"dg/20020210-1.c", 28; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,164 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/20021014-1.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/20021014-1.c", 2; /* { dg-require-profiling "-p" } */
+	.dbg	line,	"dg/20021014-1.c", 3; /* { dg-options "-O2 -p" } */
+	.dbg	line,	"dg/20021014-1.c", 4; /* { dg-options "-O2 -p -static" { target hppa*-*-hpux* } } */
+	.dbg	line,	"dg/20021014-1.c", 5; /* { dg-error "profiler" "No profiler support" { target xstormy16-*-* } 0 } */
+	.dbg	line,	"dg/20021014-1.c", 6; /* { dg-error "" "consider using `-pg' instead of `-p' with gprof(1)" { target *-*-freebsd* } 0 } */
+	.dbg	line,	"dg/20021014-1.c", 8; extern void abort (void);
+	.dbg	line,	"dg/20021014-1.c", 9; extern void exit (int);
+	.dbg	line,	"dg/20021014-1.c", 11; int bar (int x)
+	.dbg	line,	"dg/20021014-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"dg/20021014-1.c", 13; return x + 3;
+	__ld.ws		0  /* x */
+	__add.wi	3
+.LL2:
+
+	.dbg	line,	"dg/20021014-1.c", 14; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/20021014-1.c", 15; int foo (void)
+	.dbg	line,	"dg/20021014-1.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"dg/20021014-1.c", 17; return bar (1) + bar (2);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	3
+.LL4:
+	__modsp		2
+	__push.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	3
+.LL5:
+	__modsp		2
+	__add.wt
+.LL3:
+
+	.dbg	line,	"dg/20021014-1.c", 18; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/20021014-1.c", 20; int main (void)
+	.dbg	line,	"dg/20021014-1.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/20021014-1.c", 22; if (foo () != 9)
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	3
+.LL8:
+	__modsp		2
+	__push.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	3
+.LL9:
+	__modsp		2
+	__add.wt
+.LL10:
+	__neq_w.wi	9
+	__bfalse	.LL7
+
+	.dbg	line,	"dg/20021014-1.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/20021014-1.c", 24; exit (0);
+.LL7:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"dg/20021014-1.c", 25; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/20021014-1.c", 27; /* { dg-final { cleanup-profile-file } } */
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
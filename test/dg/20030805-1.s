@@ -0,0 +1,183 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/20030805-1.c", 1; /* Test that gcc understands that the call to g might clobber i.  */
+	.dbg	line,	"dg/20030805-1.c", 3; /* { dg-do run } */
+	.dbg	line,	"dg/20030805-1.c", 4; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/20030805-1.c", 6; /*__inline*/ int f ()
+	.dbg	line,	"dg/20030805-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"dg/20030805-1.c", 8; static int i;
+
+	.dbg	line,	"dg/20030805-1.c", 9; int i2;i2 = i;
+	__ld.wm		SL3  /* i */
+	__st.wmq	__f_end - 2  /* i2 */
+
+	.dbg	line,	"dg/20030805-1.c", 10; i = i2 + 1;
+	__add.wi	1
+	__st.wmq	SL3  /* i */
+
+	.dbg	line,	"dg/20030805-1.c", 11; return i;
+.LL2:
+
+	.dbg	line,	"dg/20030805-1.c", 12; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/20030805-1.c", 14; int g () { return f (); }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+	__ld.wm		SL3  /* i */
+	__st.wmq	__f_end - 2  /* i2 */
+	__add.wi	1
+	__st.wmq	SL3  /* i */
+.LL5	.alias		.LL4
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/20030805-1.c", 16; int main ()
+	.dbg	line,	"dg/20030805-1.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/20030805-1.c", 18; if (f() != 1
+	__ld.wm		SL3  /* i */
+	__st.wmq	__f_end - 2  /* i2 */
+	__add.wi	1
+	__st.wmq	SL3  /* i */
+.LL8:
+	__neq_w.wi	1
+
+	.dbg	line,	"dg/20030805-1.c", 19; || g() != 2
+	__btrue		.LL9
+	__ld.wm		SL3  /* i */
+	__st.wmq	__f_end - 2  /* i2 */
+	__add.wi	1
+	__st.wmq	SL3  /* i */
+.LL10	.alias		.LL11
+.LL11:
+	__neq_w.wi	2
+
+	.dbg	line,	"dg/20030805-1.c", 20; || f() != 3)
+.LL9:
+	__btrue		.LL12
+	__ld.wm		SL3  /* i */
+	__st.wmq	__f_end - 2  /* i2 */
+	__add.wi	1
+	__st.wmq	SL3  /* i */
+.LL13:
+	__neq_w.wi	3
+.LL12:
+	__bfalse	.LL7
+
+	.dbg	line,	"dg/20030805-1.c", 21; return 1;
+	__ld.wi		1
+	__bra		.LL6
+
+	.dbg	line,	"dg/20030805-1.c", 22; return 0;
+.LL7:
+	__ld.wi		0
+.LL6:
+
+	.dbg	line,	"dg/20030805-1.c", 23; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        30     30     2  i (static in f())
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	SL3, 2, 30, 30
+	.endm
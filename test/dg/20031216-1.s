@@ -0,0 +1,201 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/20031216-1.c", 1; /* This used to abort due to a loop bug on s390*.  */
+	.dbg	line,	"dg/20031216-1.c", 3; /* { dg-do run } */
+	.dbg	line,	"dg/20031216-1.c", 4; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/20031216-1.c", 5; /* { dg-options "-O2 -fPIC" { target s390*-*-* } } */
+	.dbg	line,	"dg/20031216-1.c", 7; extern void abort (void);
+	.dbg	line,	"dg/20031216-1.c", 9; int count;// = 0;
+	.dbg	line,	"dg/20031216-1.c", 10; char *str;
+	.dbg	line,	"dg/20031216-1.c", 12; void test (int flag)
+	.dbg	line,	"dg/20031216-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"dg/20031216-1.c", 14; char *p;
+
+	.dbg	line,	"dg/20031216-1.c", 16; for (;;)
+.LL3:
+.LL4:
+.LL5:
+
+	.dbg	line,	"dg/20031216-1.c", 17; {
+
+	.dbg	line,	"dg/20031216-1.c", 18; if (count > 5)
+	__ld.wm		_count
+	__sgt_w.wi	5
+	__bfalse	.LL7
+
+	.dbg	line,	"dg/20031216-1.c", 19; return;
+	__bra		.LL2
+
+	.dbg	line,	"dg/20031216-1.c", 21; p = "test";
+.LL7:
+	__ld.wi		__const1+0
+	__st.wmq	__test_end - 2  /* p */
+
+	.dbg	line,	"dg/20031216-1.c", 23; if (flag)
+	__tst.ws	0  /* flag */
+	__bfalse	.LL8
+
+	.dbg	line,	"dg/20031216-1.c", 24; count++;
+	__inc.wmq	_count
+
+	.dbg	line,	"dg/20031216-1.c", 26; str = p;
+.LL8:
+	__ld.wm		__test_end - 2  /* p */
+	__st.wmq	_str
+
+	.dbg	line,	"dg/20031216-1.c", 27; }
+	__bra		.LL5
+.LL6:
+
+	.dbg	line,	"dg/20031216-1.c", 28; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__test_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/20031216-1.c", 30; int main (void)
+	.dbg	line,	"dg/20031216-1.c", 31; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/20031216-1.c", 32; test (1);
+	__ld.wi		1
+	__pusharg.wr
+.LL10:
+.LL11:
+.LL12:
+	__ld.wm		_count
+	__sgt_w.wi	5
+	__bfalse	.LL13
+	__bra		.LL16
+.LL13:
+	__ld.wi		__const1+0
+	__st.wmq	__test_end - 2  /* p */
+	__tst.ws	0  /* flag */
+	__bfalse	.LL14
+	__inc.wmq	_count
+.LL14:
+	__ld.wm		__test_end - 2  /* p */
+	__st.wmq	_str
+	__bra		.LL12
+.LL15:
+.LL16:
+	__modsp		2
+
+	.dbg	line,	"dg/20031216-1.c", 34; if (str[0] != 't')
+	__ld.wm		_str
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	116
+	__bfalse	.LL17
+
+	.dbg	line,	"dg/20031216-1.c", 35; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/20031216-1.c", 37; return 0;
+.LL17:
+	__ld.wi		0
+.LL9:
+
+	.dbg	line,	"dg/20031216-1.c", 38; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	't','e','s','t',$00
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:5
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        52     10     2  count
+;        20      6     2  str
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_count, 2, 10, 52
+	auto_zp_var	_str, 2, 6, 20
+	.endm
@@ -0,0 +1,658 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/980523-1.c", 1; /* { dg-do run { target fpic } } */
+	.dbg	line,	"dg/980523-1.c", 2; /* { dg-options "-O2 -fpic" } */
+	.dbg	line,	"dg/980523-1.c", 4; extern void exit (int);
+	.dbg	line,	"dg/980523-1.c", 6; void foo1(int a, char *b, int c)
+	.dbg	line,	"dg/980523-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo1
+	__enter		_foo1
+
+	.dbg	line,	"dg/980523-1.c", 8; c =a+c+234;
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+
+	.dbg	line,	"dg/980523-1.c", 9; }
+.LL2:
+	__modsp		6
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/980523-1.c", 11; int foo2(int d)
+	.dbg	line,	"dg/980523-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo2
+	__enter		_foo2
+
+	.dbg	line,	"dg/980523-1.c", 13; return d*d;
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL3:
+
+	.dbg	line,	"dg/980523-1.c", 14; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/980523-1.c", 16; int bar1, bar2, bar3;
+	.dbg	line,	"dg/980523-1.c", 17; char * bar4;
+	.dbg	line,	"dg/980523-1.c", 19; int main(void) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/980523-1.c", 20; int h;
+
+	.dbg	line,	"dg/980523-1.c", 21; bar1 = foo2(1);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL5:
+	__modsp		2
+	__st.wmq	_bar1
+
+	.dbg	line,	"dg/980523-1.c", 22; bar2 = foo2(1);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL6:
+	__modsp		2
+	__st.wmq	_bar2
+
+	.dbg	line,	"dg/980523-1.c", 24; h = foo2(1);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL7:
+	__modsp		2
+
+	.dbg	line,	"dg/980523-1.c", 25; foo1(1, "a", foo2(1));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+0
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL8:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL9:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 26; foo1(bar1, "a", foo2(1));
+	__ld.wm		_bar1
+	__pusharg.wr
+	__ld.wi		__const1+2
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL10:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL11:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 27; foo2(1);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL12:
+	__modsp		2
+
+	.dbg	line,	"dg/980523-1.c", 29; h = foo2(1);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL13:
+	__modsp		2
+	__st.wmq	__main_end - 2  /* h */
+
+	.dbg	line,	"dg/980523-1.c", 30; bar3 = 1;
+	__st.wmiq	1, _bar3
+
+	.dbg	line,	"dg/980523-1.c", 31; bar4 = "a";
+	__ld.wi		__const1+4
+	__st.wmq	_bar4
+
+	.dbg	line,	"dg/980523-1.c", 32; foo1(1, "n", foo2(1));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+6
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL14:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL15:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 33; foo1(1, "o", foo2(1));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+8
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL16:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL17:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 34; foo1(1, "p", foo2(1));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+10
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL18:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL19:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 35; foo1(bar1, "a", foo2(1));
+	__ld.wm		_bar1
+	__pusharg.wr
+	__ld.wi		__const1+12
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL20:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL21:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 37; bar3 = h;
+	__ld.wm		__main_end - 2  /* h */
+	__st.wmq	_bar3
+
+	.dbg	line,	"dg/980523-1.c", 38; bar4 = "b";  foo1(bar1, "b", foo2(1));
+	__ld.wi		__const1+14
+	__st.wmq	_bar4
+	__ld.wm		_bar1
+	__pusharg.wr
+	__ld.wi		__const1+16
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL22:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL23:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 39; foo1(1, "q", foo2(1));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+18
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL24:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL25:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 40; bar4 = "c";  foo1(1, "c", foo2(1));
+	__ld.wi		__const1+20
+	__st.wmq	_bar4
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+22
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL26:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL27:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 41; bar4 = "d";  foo1(1, "d", foo2(1));
+	__ld.wi		__const1+24
+	__st.wmq	_bar4
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+26
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL28:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL29:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 42; bar4 = "e";  foo1(1, "e", foo2(1));
+	__ld.wi		__const1+28
+	__st.wmq	_bar4
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+30
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL30:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL31:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 43; bar4 = "f";  foo1(1, "f", foo2(1));
+	__ld.wi		__const1+32
+	__st.wmq	_bar4
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+34
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL32:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL33:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 44; bar4 = "g";  foo1(1, "g", foo2(1));
+	__ld.wi		__const1+36
+	__st.wmq	_bar4
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+38
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL34:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL35:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 45; bar4 = "h";  foo1(1, "h", foo2(1));
+	__ld.wi		__const1+40
+	__st.wmq	_bar4
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+42
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL36:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL37:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 46; bar4 = "i";  foo1(1, "i", foo2(1));
+	__ld.wi		__const1+44
+	__st.wmq	_bar4
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+46
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL38:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL39:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 47; bar4 = "j";  foo1(1, "j", foo2(1));
+	__ld.wi		__const1+48
+	__st.wmq	_bar4
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+50
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL40:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL41:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 48; bar4 = "k";  foo1(1, "k", foo2(1));
+	__ld.wi		__const1+52
+	__st.wmq	_bar4
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+54
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL42:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL43:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 49; bar4 = "l";  foo1(1, "l", foo2(1));
+	__ld.wi		__const1+56
+	__st.wmq	_bar4
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__const1+58
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL44:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL45:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 50; bar4 = "m";
+	__ld.wi		__const1+60
+	__st.wmq	_bar4
+
+	.dbg	line,	"dg/980523-1.c", 51; foo1(bar2, "m", foo2(1));
+	__ld.wm		_bar2
+	__pusharg.wr
+	__ld.wi		__const1+62
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.ws		0  /* d */
+	__mul.wt
+.LL46:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		4  /* a */
+	__add.ws	0  /* c */
+	__add.wi	234
+	__st.wsq	0  /* c */
+.LL47:
+	__modsp		6
+
+	.dbg	line,	"dg/980523-1.c", 52; exit(0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"dg/980523-1.c", 53; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'a',$00,'a',$00,'a',$00,'n',$00
+		db	'o',$00,'p',$00,'a',$00,'b',$00
+		db	'b',$00,'q',$00,'c',$00,'c',$00
+		db	'd',$00,'d',$00,'e',$00,'e',$00
+		db	'f',$00,'f',$00,'g',$00,'g',$00
+		db	'h',$00,'h',$00,'i',$00,'i',$00
+		db	'j',$00,'j',$00,'k',$00,'k',$00
+		db	'l',$00,'l',$00,'m',$00,'m',$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:64
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        26     26     2  bar4
+;         8      8     2  bar1
+;         6      6     2  overlaid locals
+;         4      4     2  bar2
+;         4      4     2  bar3
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_bar4, 2, 26, 26
+	auto_zp_var	_bar1, 2, 8, 8
+	auto_zp_var	__overlay_frames, 2, 6, 6
+__main_end	=	__overlay_frames + 2
+	auto_zp_var	_bar2, 2, 4, 4
+	auto_zp_var	_bar3, 2, 4, 4
+	.endm
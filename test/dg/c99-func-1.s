@@ -0,0 +1,186 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/c99-func-1.c", 1; /* Test for C99 __func__.  */
+	.dbg	line,	"dg/c99-func-1.c", 2; /* Origin: Joseph Myers <jsm28@cam.ac.uk> */
+	.dbg	line,	"dg/c99-func-1.c", 3; /* { dg-do run } */
+	.dbg	line,	"dg/c99-func-1.c", 4; /* { dg-options "-std=iso9899:1999 -pedantic-errors" } */
+	.dbg	line,	"dg/c99-func-1.c", 6; #include <string.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 3; #endif
+	.dbg	line,	"dg/c99-func-1.c", 8; extern void abort (void);
+	.dbg	line,	"dg/c99-func-1.c", 9; extern void exit (int);
+	.dbg	line,	"dg/c99-func-1.c", 11; int
+	.dbg	line,	"dg/c99-func-1.c", 12; main (void)
+	.dbg	line,	"dg/c99-func-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/c99-func-1.c", 14; if (strcmp (__func__, "main") || sizeof (__func__) != 5)
+	__ld.wi		__const1+0
+	__st.wmq	_di
+	__ld.wi		__const1+5
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__btrue		.LL4
+	__ld.wi		5
+	__neq_w.wi	5
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/c99-func-1.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/c99-func-1.c", 16; else
+	__bra		.LL5
+.LL3:
+
+	.dbg	line,	"dg/c99-func-1.c", 17; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+.LL5:
+
+	.dbg	line,	"dg/c99-func-1.c", 18; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'm','a','i','n',$00,'m','a','i'
+		db	'n',$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:10
+;	constant pool:0
+;	global pool:20
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,103 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/c99-func-3.c", 1; /* Test for C99 __func__: not merging with string literals.  */
+	.dbg	line,	"dg/c99-func-3.c", 2; /* Origin: Joseph Myers <jsm28@cam.ac.uk> */
+	.dbg	line,	"dg/c99-func-3.c", 3; /* { dg-do run } */
+	.dbg	line,	"dg/c99-func-3.c", 4; /* { dg-options "-std=iso9899:1999 -pedantic-errors" } */
+	.dbg	line,	"dg/c99-func-3.c", 6; extern void abort (void);
+	.dbg	line,	"dg/c99-func-3.c", 7; extern void exit (int);
+	.dbg	line,	"dg/c99-func-3.c", 9; int
+	.dbg	line,	"dg/c99-func-3.c", 10; main (void)
+	.dbg	line,	"dg/c99-func-3.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/c99-func-3.c", 12; if ("main" == __func__)
+	__ld.wi		__const1+0
+	__equ_w.wi	__const1+5
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/c99-func-3.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/c99-func-3.c", 14; else
+	__bra		.LL4
+.LL3:
+
+	.dbg	line,	"dg/c99-func-3.c", 15; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+.LL4:
+
+	.dbg	line,	"dg/c99-func-3.c", 16; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'm','a','i','n',$00,'m','a','i'
+		db	'n',$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:10
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
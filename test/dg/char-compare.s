@@ -0,0 +1,155 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/char-compare.c", 1; /* PR rtl-optimization/23241 */
+	.dbg	line,	"dg/char-compare.c", 2; /* Origin: Josh Conner <jconner@apple.com> */
+	.dbg	line,	"dg/char-compare.c", 4; /* { dg-do run } */
+	.dbg	line,	"dg/char-compare.c", 5; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/char-compare.c", 7; extern void abort(void);
+	.dbg	line,	"dg/char-compare.c", 9; struct fbs {
+	.dbg	line,	"dg/char-compare.c", 10; unsigned char uc;
+	.dbg	line,	"dg/char-compare.c", 11; }; struct fbs fbs1;// = {255};
+	.dbg	line,	"dg/char-compare.c", 13; void fn(struct fbs *fbs_ptr)
+	.dbg	line,	"dg/char-compare.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_fn
+	__enter		_fn
+
+	.dbg	line,	"dg/char-compare.c", 15; if ((fbs_ptr->uc != 255) && (fbs_ptr->uc != 0))
+	__ld.ws		0  /* fbs_ptr */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	255
+	__bfalse	.LL4
+	__ld.ws		0  /* fbs_ptr */
+	__st.wm		__ptr
+	__tst.up	__ptr
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/char-compare.c", 16; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/char-compare.c", 17; }
+.LL3:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/char-compare.c", 19; int main(void)
+	.dbg	line,	"dg/char-compare.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/char-compare.c", 21; fbs1.uc = 255;
+	__st.umiq	255, _fbs1
+
+	.dbg	line,	"dg/char-compare.c", 22; fn(&fbs1); 
+	__ld.wi		_fbs1
+	__pusharg.wr
+	__ld.ws		0  /* fbs_ptr */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	255
+	__bfalse	.LL6
+	__ld.ws		0  /* fbs_ptr */
+	__st.wm		__ptr
+	__tst.up	__ptr
+.LL6:
+	__bfalse	.LL7
+	__call		_abort
+.LL7:
+.LL8:
+	__modsp		2
+
+	.dbg	line,	"dg/char-compare.c", 23; return 0;
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"dg/char-compare.c", 24; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     1  fbs1
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_fbs1, 1, 4, 4
+	.endm
@@ -0,0 +1,149 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/doloop-2.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/doloop-2.c", 2; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/doloop-2.c", 3; extern void abort (void);
+	.dbg	line,	"dg/doloop-2.c", 4; unsigned global_iters;
+	.dbg	line,	"dg/doloop-2.c", 6; void bi_reverse(int len)
+	.dbg	line,	"dg/doloop-2.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bi_reverse
+	__enter		_bi_reverse
+
+	.dbg	line,	"dg/doloop-2.c", 8; do {
+.LL3:
+
+	.dbg	line,	"dg/doloop-2.c", 9; global_iters++;
+	__inc.wmq	_global_iters
+
+	.dbg	line,	"dg/doloop-2.c", 10; } while (--len > 0);
+.LL4:
+	__decld.ws	0  /* len */
+	__sgt_w.wi	0
+	__btrue		.LL3
+.LL5:
+
+	.dbg	line,	"dg/doloop-2.c", 11; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/doloop-2.c", 13; int main()
+	.dbg	line,	"dg/doloop-2.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/doloop-2.c", 15; bi_reverse(5);
+	__ld.wi		5
+	__pusharg.wr
+.LL7:
+	__inc.wmq	_global_iters
+.LL8:
+	__decld.ws	0  /* len */
+	__sgt_w.wi	0
+	__btrue		.LL7
+.LL9:
+.LL10:
+	__modsp		2
+
+	.dbg	line,	"dg/doloop-2.c", 16; if (global_iters != 5)
+	__ld.wm		_global_iters
+	__neq_w.wi	5
+	__bfalse	.LL11
+
+	.dbg	line,	"dg/doloop-2.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/doloop-2.c", 18; return 0;
+.LL11:
+	__ld.wi		0
+.LL6:
+
+	.dbg	line,	"dg/doloop-2.c", 19; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        36      8     2  global_iters
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_global_iters, 2, 8, 36
+	.endm
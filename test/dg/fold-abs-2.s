@@ -0,0 +1,148 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/fold-abs-2.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/fold-abs-2.c", 2; /* { dg-options "-O1 -fwrapv" } */
+	.dbg	line,	"dg/fold-abs-2.c", 3; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"dg/fold-abs-2.c", 4; void exit (int);
+	.dbg	line,	"dg/fold-abs-2.c", 5; void abort ();
+	.dbg	line,	"dg/fold-abs-2.c", 6; //#define ABS(x) (x > 0 ? x : -x)
+	.dbg	line,	"dg/fold-abs-2.c", 7; #define ABS abs
+	.dbg	line,	"dg/fold-abs-2.c", 8; int f (int a) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"dg/fold-abs-2.c", 9; if (ABS(a) >= 0) return 1;
+	__ld.ws		0  /* a */
+	__pusharg.wr
+	__call		_abs
+	__sge_w.wi	0
+	__bfalse	.LL3
+	__ld.wi		1
+	__bra		.LL2
+
+	.dbg	line,	"dg/fold-abs-2.c", 10; else return 0;
+.LL3:
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"dg/fold-abs-2.c", 11; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/fold-abs-2.c", 13; int main (int argc, char *argv[]) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/fold-abs-2.c", 14; if (f(INT_MIN))
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__pusharg.wr
+	__call		_abs
+	__sge_w.wi	0
+	__bfalse	.LL7
+	__ld.wi		1
+	__bra		.LL9
+.LL7:
+	__ld.wi		0
+.LL8:
+.LL9:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"dg/fold-abs-2.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/fold-abs-2.c", 16; else
+	__bra		.LL10
+.LL6:
+
+	.dbg	line,	"dg/fold-abs-2.c", 17; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+.LL10:
+
+	.dbg	line,	"dg/fold-abs-2.c", 18; }
+.LL5:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:13
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,157 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/ftrapv-1.c", 1; /* Copyright (C) 2004 Free Software Foundation.
+	.dbg	line,	"dg/ftrapv-1.c", 3; PR other/15526
+	.dbg	line,	"dg/ftrapv-1.c", 4; Verify correct overflow checking with -ftrapv.
+	.dbg	line,	"dg/ftrapv-1.c", 6; Written by Falk Hueffner, 20th May 2004.  */
+	.dbg	line,	"dg/ftrapv-1.c", 8; /* { dg-do run } */
+	.dbg	line,	"dg/ftrapv-1.c", 9; /* { dg-options "-ftrapv" } */
+	.dbg	line,	"dg/ftrapv-1.c", 11; /*__attribute__((noinline))*/ int
+	.dbg	line,	"dg/ftrapv-1.c", 12; mulv(int a, int b)
+	.dbg	line,	"dg/ftrapv-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_mulv
+	__enter		_mulv
+
+	.dbg	line,	"dg/ftrapv-1.c", 14; return a * b;
+	__ld.ws		2  /* a */
+	__push.wr
+	__ld.ws		0  /* b */
+	__mul.wt
+.LL2:
+
+	.dbg	line,	"dg/ftrapv-1.c", 15; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/ftrapv-1.c", 17; int
+	.dbg	line,	"dg/ftrapv-1.c", 18; main()
+	.dbg	line,	"dg/ftrapv-1.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/ftrapv-1.c", 20; mulv( 0,  0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__push.wr
+	__ld.ws		0  /* b */
+	__mul.wt
+.LL4:
+	__modsp		4
+
+	.dbg	line,	"dg/ftrapv-1.c", 21; mulv( 0, -1);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__push.wr
+	__ld.ws		0  /* b */
+	__mul.wt
+.LL5:
+	__modsp		4
+
+	.dbg	line,	"dg/ftrapv-1.c", 22; mulv(-1,  0);
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__push.wr
+	__ld.ws		0  /* b */
+	__mul.wt
+.LL6:
+	__modsp		4
+
+	.dbg	line,	"dg/ftrapv-1.c", 23; mulv(-1, -1);
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__push.wr
+	__ld.ws		0  /* b */
+	__mul.wt
+.LL7:
+	__modsp		4
+
+	.dbg	line,	"dg/ftrapv-1.c", 24; return 0;
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"dg/ftrapv-1.c", 25; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,152 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/fwrapv-1.c", 1; /* Copyright (C) 2003 Free Software Foundation.
+	.dbg	line,	"dg/fwrapv-1.c", 3; Test that the -fwrapv command line option is accepted and disables
+	.dbg	line,	"dg/fwrapv-1.c", 4; "unsafe" optimizations that rely on undefined arithmetic overflow.
+	.dbg	line,	"dg/fwrapv-1.c", 6; Written by Roger Sayle, 24th March 2003.  */
+	.dbg	line,	"dg/fwrapv-1.c", 8; /* { dg-do run } */
+	.dbg	line,	"dg/fwrapv-1.c", 9; /* { dg-options "-O2 -fwrapv" } */
+	.dbg	line,	"dg/fwrapv-1.c", 11; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"dg/fwrapv-1.c", 13; extern void abort ();
+	.dbg	line,	"dg/fwrapv-1.c", 15; int test(int x)
+	.dbg	line,	"dg/fwrapv-1.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"dg/fwrapv-1.c", 17; return (2*x)/2;
+	__ld.ws		0  /* x */
+	__asl.wi	1
+	__sdiv.wi	2
+.LL2:
+
+	.dbg	line,	"dg/fwrapv-1.c", 18; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/fwrapv-1.c", 20; main()
+	.dbg	line,	"dg/fwrapv-1.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/fwrapv-1.c", 22; int x = INT_MAX;
+	__st.wmiq	32767, __main_end - 2  /* x */
+
+	.dbg	line,	"dg/fwrapv-1.c", 24; if (test(x) == x)
+	__ld.wm		__main_end - 2  /* x */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__asl.wi	1
+	__sdiv.wi	2
+.LL5:
+	__modsp		2
+	__equ_w.wm	__main_end - 2  /* x */
+	__bfalse	.LL4
+
+	.dbg	line,	"dg/fwrapv-1.c", 25; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/fwrapv-1.c", 26; return 0;
+.LL4:
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"dg/fwrapv-1.c", 27; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 6
+__main_end	=	__overlay_frames + 2
+	.endm
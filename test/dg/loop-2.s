@@ -0,0 +1,165 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/loop-2.c", 1; /* PR optimization/10171 */
+	.dbg	line,	"dg/loop-2.c", 2; /* Bug: unroll_loop misoptimized the function so that we got
+	.dbg	line,	"dg/loop-2.c", 3; 0 iterations of the loop rather than the correct 1.  */
+	.dbg	line,	"dg/loop-2.c", 4; /* { dg-do run } */
+	.dbg	line,	"dg/loop-2.c", 6; extern void abort (void);
+	.dbg	line,	"dg/loop-2.c", 7; extern void exit (int);
+	.dbg	line,	"dg/loop-2.c", 9; /*__inline__*/ int tag() { return 0; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_tag
+	__enter		_tag
+	__ld.wi		0
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/loop-2.c", 11; void f ();
+	.dbg	line,	"dg/loop-2.c", 13; int main() {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/loop-2.c", 14; int i;
+
+	.dbg	line,	"dg/loop-2.c", 15; for (i = 0; i < (tag() ? 2 : 1); i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL4:
+	__ld.wi		0
+.LL8:
+	__tst.wr
+	__bfalse	.LL9
+	__ld.wi		2
+	__bra		.LL10
+.LL9:
+	__ld.wi		1
+.LL10:
+	__sgt_w.wm	__main_end - 2  /* i */
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"dg/loop-2.c", 16; f();
+	__call		_f
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"dg/loop-2.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/loop-2.c", 18; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"dg/loop-2.c", 20; void f ()
+	.dbg	line,	"dg/loop-2.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"dg/loop-2.c", 22; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"dg/loop-2.c", 23; }
+.LL11:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        48      6     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 48
+__main_end	=	__overlay_frames + 2
+	.endm
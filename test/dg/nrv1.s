@@ -0,0 +1,140 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/nrv1.c", 1; /* Test that the NRV optimization doesn't cause a1 to change too soon.  This
+	.dbg	line,	"dg/nrv1.c", 2; is equivalent to c++/19317.  */
+	.dbg	line,	"dg/nrv1.c", 3; /* { dg-do run } */
+	.dbg	line,	"dg/nrv1.c", 5; void abort (void);
+	.dbg	line,	"dg/nrv1.c", 7; struct A
+	.dbg	line,	"dg/nrv1.c", 8; {
+	.dbg	line,	"dg/nrv1.c", 9; int i[100];
+	.dbg	line,	"dg/nrv1.c", 10; };
+	.dbg	line,	"dg/nrv1.c", 12; struct A a1;
+	.dbg	line,	"dg/nrv1.c", 14; struct A f ()
+	.dbg	line,	"dg/nrv1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"dg/nrv1.c", 16; struct A a2;
+
+	.dbg	line,	"dg/nrv1.c", 17; a2.i[0] = 42;
+	__st.wmiq	42, __f_end - 200  /* a2 */
+
+	.dbg	line,	"dg/nrv1.c", 18; /* a1.i[0] should still be 0 until we return. */
+
+	.dbg	line,	"dg/nrv1.c", 19; if (a1.i[0] != 0)
+	__tst.wm	_a1
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/nrv1.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/nrv1.c", 21; return a2;
+.LL3:
+	__ld.wm		__f_end - 200  /* a2 */
+.LL2:
+
+	.dbg	line,	"dg/nrv1.c", 22; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/nrv1.c", 24; int main()
+	.dbg	line,	"dg/nrv1.c", 25; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/nrv1.c", 26; a1 = f();
+	__st.wmiq	42, __f_end - 200  /* a2 */
+	__tst.wm	_a1
+	__bfalse	.LL5
+	__call		_abort
+.LL5:
+	__ld.wm		__f_end - 200  /* a2 */
+.LL6:
+	__st.wmq	_a1
+
+	.dbg	line,	"dg/nrv1.c", 27; return 0;
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"dg/nrv1.c", 28; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_a1:
+		ds	200
+
+	.code
+	.if		leaf_needs < 200
+leaf_needs	.set	200
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
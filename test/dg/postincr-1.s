@@ -0,0 +1,160 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/postincr-1.c", 1; /* Simple test for proper postincrement semantics.  */
+	.dbg	line,	"dg/postincr-1.c", 2; /* { dg-do run } */
+	.dbg	line,	"dg/postincr-1.c", 4; extern void abort (void);
+	.dbg	line,	"dg/postincr-1.c", 6; int i;
+	.dbg	line,	"dg/postincr-1.c", 7; int c;
+	.dbg	line,	"dg/postincr-1.c", 8; int *f ()
+	.dbg	line,	"dg/postincr-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"dg/postincr-1.c", 10; ++c;
+	__inc.wmq	_c
+
+	.dbg	line,	"dg/postincr-1.c", 11; return &i;
+	__ld.wi		_i
+.LL2:
+
+	.dbg	line,	"dg/postincr-1.c", 12; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/postincr-1.c", 14; int main ()
+	.dbg	line,	"dg/postincr-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/postincr-1.c", 16; int r;
+
+	.dbg	line,	"dg/postincr-1.c", 17; r = (*f())++;
+	__inc.wmq	_c
+	__ld.wi		_i
+.LL4:
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	1
+	__st.wt
+	__sub.wi	1
+	__st.wmq	__main_end - 2  /* r */
+
+	.dbg	line,	"dg/postincr-1.c", 18; if (!(r == 0 && i == 1 && c == 1))
+	__not.wm	__main_end - 2  /* r */
+	__bfalse	.LL6
+	__ld.wm		_i
+	__equ_w.wi	1
+.LL6:
+	__bfalse	.LL7
+	__ld.wm		_c
+	__equ_w.wi	1
+.LL7:
+	__not.cf
+	__bfalse	.LL5
+
+	.dbg	line,	"dg/postincr-1.c", 19; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/postincr-1.c", 20; return 0;
+.LL5:
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"dg/postincr-1.c", 21; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     2  c
+;         6      6     2  i
+;         4      4     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_c, 2, 8, 8
+	auto_zp_var	_i, 2, 6, 6
+	auto_zp_var	__overlay_frames, 2, 4, 4
+__main_end	=	__overlay_frames + 2
+	.endm
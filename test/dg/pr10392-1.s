@@ -0,0 +1,299 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr10392-1.c", 1; /* PR optimization/10392
+	.dbg	line,	"dg/pr10392-1.c", 2; * Reporter: marcus@mc.pp.se
+	.dbg	line,	"dg/pr10392-1.c", 3; * Summary: [3.3/3.4 regression] [SH] optimizer generates faulty array indexing
+	.dbg	line,	"dg/pr10392-1.c", 4; * Description:
+	.dbg	line,	"dg/pr10392-1.c", 5; * The address calculation of an index operation on an array on the stack 
+	.dbg	line,	"dg/pr10392-1.c", 6; * can _under some conditions_ get messed up completely
+	.dbg	line,	"dg/pr10392-1.c", 7; *
+	.dbg	line,	"dg/pr10392-1.c", 8; * Testcase tweaked by dank@kegel.com
+	.dbg	line,	"dg/pr10392-1.c", 9; * Problem only happens with -O2 -m4, so it should only happen on sh4,
+	.dbg	line,	"dg/pr10392-1.c", 10; * but what the heck, let's test other architectures, too.
+	.dbg	line,	"dg/pr10392-1.c", 11; * Not marked as xfail since it's a regression.
+	.dbg	line,	"dg/pr10392-1.c", 12; */
+	.dbg	line,	"dg/pr10392-1.c", 13; /* { dg-do run } */
+	.dbg	line,	"dg/pr10392-1.c", 14; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/pr10392-1.c", 15; /* { dg-options "-O2 -m4" { target sh4-*-* } } */
+	.dbg	line,	"dg/pr10392-1.c", 16; extern void abort (void);
+	.dbg	line,	"dg/pr10392-1.c", 17; const char *dont_optimize_function_away;
+	.dbg	line,	"dg/pr10392-1.c", 19; const char *use(const char *str)
+	.dbg	line,	"dg/pr10392-1.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_use
+	__enter		_use
+
+	.dbg	line,	"dg/pr10392-1.c", 21; dont_optimize_function_away = str;
+	__ld.ws		0  /* str */
+	__st.wmq	_dont_optimize_function_away
+
+	.dbg	line,	"dg/pr10392-1.c", 22; if (str[0] != 'v')
+	__ld.ws		0  /* str */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	118
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/pr10392-1.c", 23; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr10392-1.c", 24; if (str[1] < '1' || str[1] > '6')
+.LL3:
+	__ld.ws		0  /* str */
+	__add.wi	1
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__ult_b.uiq	49
+	__btrue		.LL5
+	__ld.ws		0  /* str */
+	__add.wi	1
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__ugt_b.uiq	54
+.LL5:
+	__bfalse	.LL4
+
+	.dbg	line,	"dg/pr10392-1.c", 25; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr10392-1.c", 26; if (str[2])
+.LL4:
+	__ld.ws		0  /* str */
+	__add.wi	2
+	__st.wm		__ptr
+	__tst.up	__ptr
+	__bfalse	.LL6
+
+	.dbg	line,	"dg/pr10392-1.c", 27; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr10392-1.c", 28; return str[2] ? "notused" : "v6";
+.LL6:
+	__ld.ws		0  /* str */
+	__add.wi	2
+	__st.wm		__ptr
+	__tst.up	__ptr
+	__bfalse	.LL7
+	__ld.wi		__const1+0
+	__bra		.LL8
+.LL7:
+	__ld.wi		__const1+8
+.LL8	.alias		.LL2
+.LL2:
+
+	.dbg	line,	"dg/pr10392-1.c", 29; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr10392-1.c", 31; const char *func(char *a, char *b)
+	.dbg	line,	"dg/pr10392-1.c", 32; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func
+	__enter		_func
+
+	.dbg	line,	"dg/pr10392-1.c", 33; char buf[64];
+
+	.dbg	line,	"dg/pr10392-1.c", 34; unsigned char i;
+
+	.dbg	line,	"dg/pr10392-1.c", 35; /*const*/ char *result;
+
+	.dbg	line,	"dg/pr10392-1.c", 37; char *item[2];/* = {
+
+	.dbg	line,	"dg/pr10392-1.c", 38; "v1",
+
+	.dbg	line,	"dg/pr10392-1.c", 39; "v2",
+
+	.dbg	line,	"dg/pr10392-1.c", 40; };*/
+
+	.dbg	line,	"dg/pr10392-1.c", 41; item[0] = "v1";
+	__ld.wi		__const1+11
+	__st.wmq	__func_end - 71  /* item */
+
+	.dbg	line,	"dg/pr10392-1.c", 42; item[1] = "v2";
+	__ld.wi		__const1+14
+	__st.wmq	__func_end - 71 + 2  /* item */
+
+	.dbg	line,	"dg/pr10392-1.c", 44; buf[0] = 'v';
+	__st.umiq	118, __func_end - 64  /* buf */
+
+	.dbg	line,	"dg/pr10392-1.c", 45; buf[1] = '3';
+	__st.umiq	51, __func_end - 64 + 1  /* buf */
+
+	.dbg	line,	"dg/pr10392-1.c", 46; buf[2] = 0;
+	__st.umiq	0, __func_end - 64 + 2  /* buf */
+
+	.dbg	line,	"dg/pr10392-1.c", 48; for (i = 0; i < 2; i++) {
+	__st.umiq	0, __func_end - 65  /* i */
+.LL10:
+	__ld.umq	__func_end - 65  /* i */
+	__ult_b.uiq	2
+	__btrue		.LL12
+	__bra		.LL13
+.LL11:
+	__inc.umq	__func_end - 65  /* i */
+	__bra		.LL10
+.LL12:
+
+	.dbg	line,	"dg/pr10392-1.c", 49; /* bug is: following line passes wild pointer to use() on sh4 -O2 */
+
+	.dbg	line,	"dg/pr10392-1.c", 50; result = use(item[i]);
+	__ld2x.umq	__func_end - 65  /* i */
+	__ld.wax	__func_end - 71  /* item */
+	__pusharg.wr
+	__call		_use
+	__st.wmq	__func_end - 67  /* result */
+
+	.dbg	line,	"dg/pr10392-1.c", 52; use(buf);
+	__ld.wi		__func_end - 64  /* buf */
+	__pusharg.wr
+	__call		_use
+
+	.dbg	line,	"dg/pr10392-1.c", 53; use(a);
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__call		_use
+
+	.dbg	line,	"dg/pr10392-1.c", 54; use(b);
+	__ld.ws		0  /* b */
+	__pusharg.wr
+	__call		_use
+
+	.dbg	line,	"dg/pr10392-1.c", 55; result = use(result);
+	__ld.wm		__func_end - 67  /* result */
+	__pusharg.wr
+	__call		_use
+	__st.wmq	__func_end - 67  /* result */
+
+	.dbg	line,	"dg/pr10392-1.c", 56; }
+	__bra		.LL11
+.LL13:
+
+	.dbg	line,	"dg/pr10392-1.c", 57; return result;
+	__ld.wm		__func_end - 67  /* result */
+.LL9:
+
+	.dbg	line,	"dg/pr10392-1.c", 58; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"dg/pr10392-1.c", 60; int main()
+	.dbg	line,	"dg/pr10392-1.c", 61; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr10392-1.c", 62; func("v4", "v5");
+	__ld.wi		__const1+17
+	__pusharg.wr
+	__ld.wi		__const1+20
+	__pusharg.wr
+	__call		_func
+
+	.dbg	line,	"dg/pr10392-1.c", 63; return 0;
+	__ld.wi		0
+.LL14:
+
+	.dbg	line,	"dg/pr10392-1.c", 64; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'n','o','t','u','s','e','d',$00
+		db	'v','6',$00,'v','1',$00,'v','2'
+		db	$00,'v','4',$00,'v','5',$00
+_dont_optimize_function_away:
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:23
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    71  _func
+;
+; 71 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       156     30    71  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 71, 30, 156
+__func_end	=	__overlay_frames + 71
+	.endm
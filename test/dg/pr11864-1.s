@@ -0,0 +1,193 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr11864-1.c", 1; /* PR optimization/11864
+	.dbg	line,	"dg/pr11864-1.c", 2; * Reporter: Kazumoto Kojima <kkojima@gcc.gnu.org>
+	.dbg	line,	"dg/pr11864-1.c", 3; * Summary: [3.3/3.4 regression] miscompiles zero extension and test
+	.dbg	line,	"dg/pr11864-1.c", 4; * Description:
+	.dbg	line,	"dg/pr11864-1.c", 5; * gcc-3.3/3.4 -O2 for sh target may miscompile the combination of zero extension
+	.dbg	line,	"dg/pr11864-1.c", 6; * and test if it's zero.
+	.dbg	line,	"dg/pr11864-1.c", 7; *
+	.dbg	line,	"dg/pr11864-1.c", 8; * Testcase tweaked by dank@kegel.com.  Not marked as xfail because it's a regression.
+	.dbg	line,	"dg/pr11864-1.c", 9; */
+	.dbg	line,	"dg/pr11864-1.c", 10; /* { dg-do run } */
+	.dbg	line,	"dg/pr11864-1.c", 11; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/pr11864-1.c", 13; extern void abort(void);
+	.dbg	line,	"dg/pr11864-1.c", 15; const int val = 0xff00;
+	.dbg	line,	"dg/pr11864-1.c", 17; int f(void)
+	.dbg	line,	"dg/pr11864-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"dg/pr11864-1.c", 19; return val;
+	__ld.wi		0xff00
+.LL2:
+
+	.dbg	line,	"dg/pr11864-1.c", 20; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr11864-1.c", 22; unsigned char a[1];
+	.dbg	line,	"dg/pr11864-1.c", 24; void foo(void)
+	.dbg	line,	"dg/pr11864-1.c", 25; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"dg/pr11864-1.c", 26; a[0] = f() & 255;
+	__ld.wi		0xff00
+.LL4:
+	__and.wi	255
+	__st.umq	_a
+
+	.dbg	line,	"dg/pr11864-1.c", 28; if (!a[0])
+	__not.um	_a
+	__bfalse	.LL5
+
+	.dbg	line,	"dg/pr11864-1.c", 29; a[0] = f() & 255;
+	__ld.wi		0xff00
+.LL6:
+	__and.wi	255
+	__st.umq	_a
+
+	.dbg	line,	"dg/pr11864-1.c", 31; if (!a[0])
+.LL5:
+	__not.um	_a
+	__bfalse	.LL7
+
+	.dbg	line,	"dg/pr11864-1.c", 32; a[0] = 1 + (f() & 127);
+	__ld.wi		0xff00
+.LL8:
+	__and.wi	127
+	__add.wi	1
+	__st.umq	_a
+
+	.dbg	line,	"dg/pr11864-1.c", 33; }
+.LL7:
+.LL3:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr11864-1.c", 35; int main(int argc, char **argv)
+	.dbg	line,	"dg/pr11864-1.c", 36; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr11864-1.c", 37; foo();
+	__ld.wi		0xff00
+.LL10:
+	__and.wi	255
+	__st.umq	_a
+	__not.um	_a
+	__bfalse	.LL12
+	__ld.wi		0xff00
+.LL11:
+	__and.wi	255
+	__st.umq	_a
+.LL12:
+	__not.um	_a
+	__bfalse	.LL14
+	__ld.wi		0xff00
+.LL13:
+	__and.wi	127
+	__add.wi	1
+	__st.umq	_a
+.LL14:
+.LL15:
+
+	.dbg	line,	"dg/pr11864-1.c", 38; if (!a[0])
+	__not.um	_a
+	__bfalse	.LL16
+
+	.dbg	line,	"dg/pr11864-1.c", 39; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr11864-1.c", 41; return 0;
+.LL16:
+	__ld.wi		0
+.LL9:
+
+	.dbg	line,	"dg/pr11864-1.c", 42; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_val:
+		dw	0xff00
+
+	.bss
+_a:
+		ds	1
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:2
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
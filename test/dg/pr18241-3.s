@@ -0,0 +1,202 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr18241-3.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/pr18241-3.c", 2; /* { dg-options "-O1" } */ 
+	.dbg	line,	"dg/pr18241-3.c", 4; void abort (void);
+	.dbg	line,	"dg/pr18241-3.c", 6; void radix_tree_tag_clear (int *node)
+	.dbg	line,	"dg/pr18241-3.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_radix_tree_tag_clear
+	__enter		_radix_tree_tag_clear
+
+	.dbg	line,	"dg/pr18241-3.c", 8; int *path[2], **pathp/* = path*/, height;
+
+	.dbg	line,	"dg/pr18241-3.c", 9; volatile int *addr;
+
+	.dbg	line,	"dg/pr18241-3.c", 10; pathp = path;
+	__ld.wi		__radix_tree_tag_clear_end - 4  /* path */
+	__st.wmq	__radix_tree_tag_clear_end - 6  /* pathp */
+
+	.dbg	line,	"dg/pr18241-3.c", 11; 
+
+	.dbg	line,	"dg/pr18241-3.c", 12; height = 1;
+	__st.wmiq	1, __radix_tree_tag_clear_end - 8  /* height */
+
+	.dbg	line,	"dg/pr18241-3.c", 13; pathp[0] = node;
+	__ld.wm		__radix_tree_tag_clear_end - 6  /* pathp */
+	__push.wr
+	__ld.ws		0  /* node */
+	__st.wtq
+
+	.dbg	line,	"dg/pr18241-3.c", 14; 
+
+	.dbg	line,	"dg/pr18241-3.c", 15; while (height > 0) {
+.LL3:
+	__ld.wm		__radix_tree_tag_clear_end - 8  /* height */
+	__sgt_w.wi	0
+	__bfalse	.LL4
+
+	.dbg	line,	"dg/pr18241-3.c", 16; pathp[1] = pathp[0];
+	__ld.wm		__radix_tree_tag_clear_end - 6  /* pathp */
+	__add.wi	2
+	__push.wr
+	__ld.wm		__radix_tree_tag_clear_end - 6  /* pathp */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wtq
+
+	.dbg	line,	"dg/pr18241-3.c", 17; pathp++;
+	__ld.wm		__radix_tree_tag_clear_end - 6  /* pathp */
+	__add.wi	2
+	__st.wm		__radix_tree_tag_clear_end - 6  /* pathp */
+
+	.dbg	line,	"dg/pr18241-3.c", 18; height--;
+	__dec.wmq	__radix_tree_tag_clear_end - 8  /* height */
+
+	.dbg	line,	"dg/pr18241-3.c", 19; }
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"dg/pr18241-3.c", 20; 
+
+	.dbg	line,	"dg/pr18241-3.c", 21; addr = pathp[0];
+	__ld.wm		__radix_tree_tag_clear_end - 6  /* pathp */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__radix_tree_tag_clear_end - 10  /* addr */
+
+	.dbg	line,	"dg/pr18241-3.c", 22; *addr = 1;
+	__ld.wm		__radix_tree_tag_clear_end - 10  /* addr */
+	__push.wr
+	__ld.wi		1
+	__st.wtq
+
+	.dbg	line,	"dg/pr18241-3.c", 23; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__radix_tree_tag_clear_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/pr18241-3.c", 25; int main ()
+	.dbg	line,	"dg/pr18241-3.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr18241-3.c", 27; int n;
+
+	.dbg	line,	"dg/pr18241-3.c", 28; radix_tree_tag_clear (&n);
+	__ld.wi		__main_end - 2  /* n */
+	__pusharg.wr
+	__call		_radix_tree_tag_clear
+
+	.dbg	line,	"dg/pr18241-3.c", 29; if (n != 1)
+	__ld.wm		__main_end - 2  /* n */
+	__neq_w.wi	1
+	__bfalse	.LL6
+
+	.dbg	line,	"dg/pr18241-3.c", 30; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/pr18241-3.c", 31; return 0;
+.LL6:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"dg/pr18241-3.c", 32; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 10
+leaf_needs	.set	10
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 4, 4
+__main_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,149 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr18241-4.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/pr18241-4.c", 2; /* { dg-options "-O1" } */ 
+	.dbg	line,	"dg/pr18241-4.c", 4; void abort (void);
+	.dbg	line,	"dg/pr18241-4.c", 6; int f(int i1243)
+	.dbg	line,	"dg/pr18241-4.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"dg/pr18241-4.c", 8; volatile int *i2;
+
+	.dbg	line,	"dg/pr18241-4.c", 9; int i[2], *i1; i1 = i;
+	__ld.wi		__f_end - 6  /* i */
+	__st.wmq	__f_end - 8  /* i1 */
+
+	.dbg	line,	"dg/pr18241-4.c", 10; i[0] = 1;
+	__st.wmiq	1, __f_end - 6  /* i */
+
+	.dbg	line,	"dg/pr18241-4.c", 11; /*volatile int **/i2 = i1;
+	__ld.wm		__f_end - 8  /* i1 */
+	__st.wmq	__f_end - 2  /* i2 */
+
+	.dbg	line,	"dg/pr18241-4.c", 12; i2[1] = 1;
+	__ld.wm		__f_end - 2  /* i2 */
+	__add.wi	2
+	__push.wr
+	__ld.wi		1
+	__st.wtq
+
+	.dbg	line,	"dg/pr18241-4.c", 13; i1243 = 0;
+	__st.wsiq	0, 0  /* i1243 */
+
+	.dbg	line,	"dg/pr18241-4.c", 14; return i2[1]+i2[0];
+	__ld.wm		__f_end - 2  /* i2 */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.wm		__f_end - 2  /* i2 */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wt
+.LL2:
+
+	.dbg	line,	"dg/pr18241-4.c", 15; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/pr18241-4.c", 18; int main(void)
+	.dbg	line,	"dg/pr18241-4.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr18241-4.c", 20; if( f(100) != 2)
+	__ld.wi		100
+	__pusharg.wr
+	__call		_f
+	__neq_w.wi	2
+	__bfalse	.LL4
+
+	.dbg	line,	"dg/pr18241-4.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/pr18241-4.c", 22; return 0;
+.LL4:
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"dg/pr18241-4.c", 23; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 8
+leaf_needs	.set	8
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,107 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr18241-5.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/pr18241-5.c", 2; /* { dg-options "-O1" } */ 
+	.dbg	line,	"dg/pr18241-5.c", 4; void abort (void);
+	.dbg	line,	"dg/pr18241-5.c", 6; int main ()
+	.dbg	line,	"dg/pr18241-5.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr18241-5.c", 8; int a;
+
+	.dbg	line,	"dg/pr18241-5.c", 9; volatile int *b;b = &a;
+	__ld.wi		__main_end - 2  /* a */
+	__st.wmq	__main_end - 4  /* b */
+
+	.dbg	line,	"dg/pr18241-5.c", 10; a = 1;
+	__st.wmiq	1, __main_end - 2  /* a */
+
+	.dbg	line,	"dg/pr18241-5.c", 11; if (*b != 1)
+	__ld.wm		__main_end - 4  /* b */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	1
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/pr18241-5.c", 12; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/pr18241-5.c", 13; return 0;
+.LL3:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"dg/pr18241-5.c", 14; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,145 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr18921-1.c", 1; /* PR middle-end/18921 */
+	.dbg	line,	"dg/pr18921-1.c", 2; /* { dg-do run } */
+	.dbg	line,	"dg/pr18921-1.c", 3; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/pr18921-1.c", 5; extern void abort (void);
+	.dbg	line,	"dg/pr18921-1.c", 7; int foo (int k)
+	.dbg	line,	"dg/pr18921-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"dg/pr18921-1.c", 9; unsigned char j = 0;
+	__st.umiq	0, __foo_end - 1  /* j */
+
+	.dbg	line,	"dg/pr18921-1.c", 10; (k ? 0 : j++) == -1;
+	__tst.ws	0  /* k */
+	__bfalse	.LL3
+	__ld.wi		0
+	__bra		.LL4
+.LL3:
+	__ldinc.um	__foo_end - 1  /* j */
+.LL4:
+	__equ_w.wi	-1
+	__bool
+
+	.dbg	line,	"dg/pr18921-1.c", 11; return j;
+	__ld.um		__foo_end - 1  /* j */
+.LL2:
+
+	.dbg	line,	"dg/pr18921-1.c", 12; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/pr18921-1.c", 14; int main ()
+	.dbg	line,	"dg/pr18921-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr18921-1.c", 16; if (!foo (0))
+	__ld.wi		0
+	__pusharg.wr
+	__st.umiq	0, __foo_end - 1  /* j */
+	__tst.ws	0  /* k */
+	__bfalse	.LL7
+	__ld.wi		0
+	__bra		.LL8
+.LL7:
+	__ldinc.um	__foo_end - 1  /* j */
+.LL8:
+	__equ_w.wi	-1
+	__bool
+	__ld.um		__foo_end - 1  /* j */
+.LL9:
+	__modsp		2
+	__not.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"dg/pr18921-1.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/pr18921-1.c", 18; return 0;
+.LL6:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"dg/pr18921-1.c", 19; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 1
+leaf_needs	.set	1
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,211 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr20100.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/pr20100.c", 2; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/pr20100.c", 4; //int func_pure (void) __attribute__ ((pure));
+	.dbg	line,	"dg/pr20100.c", 5; void func_other (int);
+	.dbg	line,	"dg/pr20100.c", 6; int global_int;
+	.dbg	line,	"dg/pr20100.c", 7; void abort ();
+	.dbg	line,	"dg/pr20100.c", 8; void func_other(int a)
+	.dbg	line,	"dg/pr20100.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func_other
+	__enter		_func_other
+
+	.dbg	line,	"dg/pr20100.c", 10; if (a != global_int)
+	__ld.ws		0  /* a */
+	__neq_w.wm	_global_int
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/pr20100.c", 11; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/pr20100.c", 12; global_int++;
+.LL3:
+	__inc.wmq	_global_int
+
+	.dbg	line,	"dg/pr20100.c", 13; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr20100.c", 15; int func_pure(void)
+	.dbg	line,	"dg/pr20100.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func_pure
+	__enter		_func_pure
+
+	.dbg	line,	"dg/pr20100.c", 17; return global_int;
+	__ld.wm		_global_int
+.LL4:
+
+	.dbg	line,	"dg/pr20100.c", 18; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr20100.c", 20; int
+	.dbg	line,	"dg/pr20100.c", 21; func_loop (int arg)
+	.dbg	line,	"dg/pr20100.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func_loop
+	__enter		_func_loop
+
+	.dbg	line,	"dg/pr20100.c", 23; // global_int ++;
+
+	.dbg	line,	"dg/pr20100.c", 24; while (arg--)
+.LL6:
+	__lddec.ws	0  /* arg */
+	__tst.wr
+	__bfalse	.LL7
+
+	.dbg	line,	"dg/pr20100.c", 25; func_other (func_pure ());
+	__ld.wm		_global_int
+.LL8:
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__neq_w.wm	_global_int
+	__bfalse	.LL9
+	__call		_abort
+.LL9:
+	__inc.wmq	_global_int
+.LL10:
+	__modsp		2
+	__bra		.LL6
+.LL7:
+
+	.dbg	line,	"dg/pr20100.c", 26; }
+.LL5:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr20100.c", 28; int main(void)
+	.dbg	line,	"dg/pr20100.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr20100.c", 30; func_loop(10);
+	__ld.wi		10
+	__pusharg.wr
+.LL12:
+	__lddec.ws	0  /* arg */
+	__tst.wr
+	__bfalse	.LL16
+	__ld.wm		_global_int
+.LL13:
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__neq_w.wm	_global_int
+	__bfalse	.LL14
+	__call		_abort
+.LL14:
+	__inc.wmq	_global_int
+.LL15:
+	__modsp		2
+	__bra		.LL12
+.LL16:
+.LL17:
+	__modsp		2
+
+	.dbg	line,	"dg/pr20100.c", 31; return 0;
+	__ld.wi		0
+.LL11:
+
+	.dbg	line,	"dg/pr20100.c", 32; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        62     20     2  global_int
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_global_int, 2, 20, 62
+	.endm
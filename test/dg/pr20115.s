@@ -0,0 +1,204 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr20115.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/pr20115.c", 2; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/pr20115.c", 4; int func_pure (void);
+	.dbg	line,	"dg/pr20115.c", 5; void func_other (int);
+	.dbg	line,	"dg/pr20115.c", 6; int global_int;
+	.dbg	line,	"dg/pr20115.c", 7; int func_pure (void) { return global_int; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func_pure
+	__enter		_func_pure
+	__ld.wm		_global_int
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr20115.c", 8; void func_other (int a)
+	.dbg	line,	"dg/pr20115.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func_other
+	__enter		_func_other
+
+	.dbg	line,	"dg/pr20115.c", 10; global_int = a + 1;
+	__ld.ws		0  /* a */
+	__add.wi	1
+	__st.wmq	_global_int
+
+	.dbg	line,	"dg/pr20115.c", 11; }
+.LL3:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr20115.c", 12; int f(void)
+	.dbg	line,	"dg/pr20115.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"dg/pr20115.c", 14; int a;
+
+	.dbg	line,	"dg/pr20115.c", 15; a = func_pure();
+	__ld.wm		_global_int
+.LL5:
+	__st.wmq	__f_end - 2  /* a */
+
+	.dbg	line,	"dg/pr20115.c", 16; func_other (a);
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__add.wi	1
+	__st.wmq	_global_int
+.LL6:
+	__modsp		2
+
+	.dbg	line,	"dg/pr20115.c", 17; a = func_pure (); // We were removing this function call
+	__ld.wm		_global_int
+.LL7:
+	__st.wmq	__f_end - 2  /* a */
+
+	.dbg	line,	"dg/pr20115.c", 18; return a;
+.LL4:
+
+	.dbg	line,	"dg/pr20115.c", 19; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"dg/pr20115.c", 20; void abort (void);
+	.dbg	line,	"dg/pr20115.c", 22; int main(void)
+	.dbg	line,	"dg/pr20115.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr20115.c", 24; global_int = 10;
+	__st.wmiq	10, _global_int
+
+	.dbg	line,	"dg/pr20115.c", 25; if (f() != 11)
+	__ld.wm		_global_int
+.LL10:
+	__st.wmq	__f_end - 2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__add.wi	1
+	__st.wmq	_global_int
+.LL11:
+	__modsp		2
+	__ld.wm		_global_int
+.LL12:
+	__st.wmq	__f_end - 2  /* a */
+.LL13:
+	__neq_w.wi	11
+	__bfalse	.LL9
+
+	.dbg	line,	"dg/pr20115.c", 26; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/pr20115.c", 27; return 0;
+.LL9:
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"dg/pr20115.c", 28; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _f
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        18     18     2  global_int
+;        16     16     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_global_int, 2, 18, 18
+	auto_zp_var	__overlay_frames, 2, 16, 16
+__f_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,127 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr26729-1.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/pr26729-1.c", 2; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/pr26729-1.c", 4; void abort(void);
+	.dbg	line,	"dg/pr26729-1.c", 6; //__attribute__((noinline))
+	.dbg	line,	"dg/pr26729-1.c", 7; int f (unsigned short word) {  
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"dg/pr26729-1.c", 8; return (word & 0x1) && ((/*(unsigned short)*/ (word & 0x8000)) == 0x8000);
+	__ld.ws		0  /* word */
+	__tand.wi	1
+	__bfalse	.LL3
+	__ld.ws		0  /* word */
+	__and.wi	32768
+	__equ_w.wi	32768
+.LL3:
+.LL2:
+	__bool
+
+	.dbg	line,	"dg/pr26729-1.c", 9; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr26729-1.c", 11; int main(void) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr26729-1.c", 12; if (!f(0x8001))
+	__ld.wi		32769
+	__pusharg.wr
+	__ld.ws		0  /* word */
+	__tand.wi	1
+	__bfalse	.LL6
+	__ld.ws		0  /* word */
+	__and.wi	32768
+	__equ_w.wi	32768
+.LL6:
+.LL7:
+	__bool
+	__modsp		2
+	__not.wr
+	__bfalse	.LL5
+
+	.dbg	line,	"dg/pr26729-1.c", 13; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr26729-1.c", 14; return 0;
+.LL5:
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"dg/pr26729-1.c", 15; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
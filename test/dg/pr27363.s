@@ -0,0 +1,194 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr27363.c", 1; /* PR27363.  CSE was breaking on the arm store multiple insn used for
+	.dbg	line,	"dg/pr27363.c", 2; structure copies.  */
+	.dbg	line,	"dg/pr27363.c", 3; /* { dg-do run } */
+	.dbg	line,	"dg/pr27363.c", 4; /* { dg-options "-Os" } */
+	.dbg	line,	"dg/pr27363.c", 5; extern void abort (void);
+	.dbg	line,	"dg/pr27363.c", 7; struct snd_mask {
+	.dbg	line,	"dg/pr27363.c", 8; unsigned int bits[6];
+	.dbg	line,	"dg/pr27363.c", 9; };
+	.dbg	line,	"dg/pr27363.c", 11; static int //__attribute__((noinline))
+	.dbg	line,	"dg/pr27363.c", 12; snd_mask_refine(struct snd_mask *mask)
+	.dbg	line,	"dg/pr27363.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_snd_mask_refine
+	__enter		_snd_mask_refine
+
+	.dbg	line,	"dg/pr27363.c", 14; struct snd_mask old;
+
+	.dbg	line,	"dg/pr27363.c", 16; old = *mask;
+	__ld.wi		__snd_mask_refine_end - 12  /* old */
+	__push.wr
+	__ld.ws		0  /* mask */
+	__copy.wtq	12
+
+	.dbg	line,	"dg/pr27363.c", 17; if (mask->bits[0]==0 && mask->bits[1]==0)
+	__ld.ws		0  /* mask */
+	__st.wm		__ptr
+	__not.wp	__ptr
+	__bfalse	.LL4
+	__ld.ws		0  /* mask */
+	__add.wi	2
+	__st.wm		__ptr
+	__not.wp	__ptr
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/pr27363.c", 18; return 1;
+	__ld.wi		1
+	__bra		.LL2
+
+	.dbg	line,	"dg/pr27363.c", 20; return old.bits[0] != mask->bits[0];
+.LL3:
+	__ld.ws		0  /* mask */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wm	__snd_mask_refine_end - 12  /* old */
+.LL2:
+	__bool
+
+	.dbg	line,	"dg/pr27363.c", 21; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__snd_mask_refine_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/pr27363.c", 23; int main(int argc, char *argv[])
+	.dbg	line,	"dg/pr27363.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr27363.c", 25; struct snd_mask mask;
+
+	.dbg	line,	"dg/pr27363.c", 28; mask.bits[0] = 23;
+	__st.wmiq	23, __main_end - 12  /* mask */
+
+	.dbg	line,	"dg/pr27363.c", 29; mask.bits[1] = 42;
+	__st.wmiq	42, __main_end - 12 + 2  /* mask */
+
+	.dbg	line,	"dg/pr27363.c", 30; mask.bits[2] = 0;
+	__st.wmiq	0, __main_end - 12 + 4  /* mask */
+
+	.dbg	line,	"dg/pr27363.c", 31; mask.bits[3] = 0;
+	__st.wmiq	0, __main_end - 12 + 6  /* mask */
+
+	.dbg	line,	"dg/pr27363.c", 32; mask.bits[4] = 0; 
+	__st.wmiq	0, __main_end - 12 + 8  /* mask */
+
+	.dbg	line,	"dg/pr27363.c", 33; mask.bits[5] = 0;
+	__st.wmiq	0, __main_end - 12 + 10  /* mask */
+
+	.dbg	line,	"dg/pr27363.c", 36; if (snd_mask_refine(&mask))
+	__ld.wi		__main_end - 12  /* mask */
+	__pusharg.wr
+	__call		_snd_mask_refine
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"dg/pr27363.c", 37; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr27363.c", 38; return 0;
+.LL6:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"dg/pr27363.c", 39; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 12
+leaf_needs	.set	12
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    12  _main
+;
+; 12 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        14     14    12  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 12, 14, 14
+__main_end	=	__overlay_frames + 12
+	.endm
@@ -0,0 +1,281 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr29581-4.c", 1; /* PR tree-optimization/29581 */
+	.dbg	line,	"dg/pr29581-4.c", 2; /* Origin: gcc.dg/vect/vect-88.c */
+	.dbg	line,	"dg/pr29581-4.c", 3; /* { dg-do run } */
+	.dbg	line,	"dg/pr29581-4.c", 4; /* { dg-options "-O2 -ftree-loop-linear" } */
+	.dbg	line,	"dg/pr29581-4.c", 6; extern void abort (void);
+	.dbg	line,	"dg/pr29581-4.c", 8; #define N 16
+	.dbg	line,	"dg/pr29581-4.c", 10; int main1 (int n, int *a)
+	.dbg	line,	"dg/pr29581-4.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main1
+	__enter		_main1
+
+	.dbg	line,	"dg/pr29581-4.c", 12; int i, j, k;
+
+	.dbg	line,	"dg/pr29581-4.c", 13; int b[N];
+
+	.dbg	line,	"dg/pr29581-4.c", 15; for (i = 0; i < n; i++)
+	__st.wmiq	0, __main1_end - 2  /* i */
+.LL3:
+	__ld.wm		__main1_end - 2  /* i */
+	__slt_w.ws	2  /* n */
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__main1_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"dg/pr29581-4.c", 16; {
+
+	.dbg	line,	"dg/pr29581-4.c", 17; for (j = 0; j < n; j++)
+	__st.wmiq	0, __main1_end - 4  /* j */
+.LL7:
+	__ld.wm		__main1_end - 4  /* j */
+	__slt_w.ws	2  /* n */
+	__btrue		.LL9
+	__bra		.LL10
+.LL8:
+	__inc.wmq	__main1_end - 4  /* j */
+	__bra		.LL7
+.LL9:
+
+	.dbg	line,	"dg/pr29581-4.c", 18; {
+
+	.dbg	line,	"dg/pr29581-4.c", 19; k = i + n;
+	__ld.wm		__main1_end - 2  /* i */
+	__add.ws	2  /* n */
+	__st.wmq	__main1_end - 6  /* k */
+
+	.dbg	line,	"dg/pr29581-4.c", 20; a[j] = k;
+	__ld.wm		__main1_end - 4  /* j */
+	__asl.wr
+	__add.ws	0  /* a */
+	__push.wr
+	__ld.wm		__main1_end - 6  /* k */
+	__st.wtq
+
+	.dbg	line,	"dg/pr29581-4.c", 21; }
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"dg/pr29581-4.c", 22; b[i] = k;
+	__ld2x.wmq	__main1_end - 2  /* i */
+	__ld.wm		__main1_end - 6  /* k */
+	__st.waxq	__main1_end - 38  /* b */
+
+	.dbg	line,	"dg/pr29581-4.c", 23; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"dg/pr29581-4.c", 26; for (j = 0; j < n; j++)
+	__st.wmiq	0, __main1_end - 4  /* j */
+.LL11:
+	__ld.wm		__main1_end - 4  /* j */
+	__slt_w.ws	2  /* n */
+	__btrue		.LL13
+	__bra		.LL14
+.LL12:
+	__inc.wmq	__main1_end - 4  /* j */
+	__bra		.LL11
+.LL13:
+
+	.dbg	line,	"dg/pr29581-4.c", 27; if (a[j] != i + n - 1)
+	__ld.wm		__main1_end - 4  /* j */
+	__asl.wr
+	__add.ws	0  /* a */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.wm		__main1_end - 2  /* i */
+	__add.ws	2  /* n */
+	__sub.wi	1
+	__neq_w.wt
+	__bfalse	.LL15
+
+	.dbg	line,	"dg/pr29581-4.c", 28; abort();	
+	__call		_abort
+
+	.dbg	line,	"dg/pr29581-4.c", 30; for (j = 0; j < n; j++)
+.LL15	.alias		.LL12
+	__bra		.LL12
+.LL14:
+	__st.wmiq	0, __main1_end - 4  /* j */
+.LL16:
+	__ld.wm		__main1_end - 4  /* j */
+	__slt_w.ws	2  /* n */
+	__btrue		.LL18
+	__bra		.LL19
+.LL17:
+	__inc.wmq	__main1_end - 4  /* j */
+	__bra		.LL16
+.LL18:
+
+	.dbg	line,	"dg/pr29581-4.c", 31; if (b[j] != j + n)
+	__ld.wm		__main1_end - 4  /* j */
+	__add.ws	2  /* n */
+	__ld2x.wm	__main1_end - 4  /* j */
+	__neq_w.wax	__main1_end - 38  /* b */
+	__bfalse	.LL20
+
+	.dbg	line,	"dg/pr29581-4.c", 32; abort();	
+	__call		_abort
+
+	.dbg	line,	"dg/pr29581-4.c", 34; return 0;
+.LL20	.alias		.LL17
+	__bra		.LL17
+.LL19:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"dg/pr29581-4.c", 35; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main1_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/pr29581-4.c", 37; int main (void)
+	.dbg	line,	"dg/pr29581-4.c", 38; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr29581-4.c", 39; int a[N+1]/* __attribute__ ((__aligned__(16)))*/;
+
+	.dbg	line,	"dg/pr29581-4.c", 41; main1 (N, a+1);
+	__ld.wi		16
+	__pusharg.wr
+	__ld.wi		__main_end - 34 + 2  /* a */
+	__pusharg.wr
+	__call		_main1
+
+	.dbg	line,	"dg/pr29581-4.c", 42; main1 (0, a+1);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		__main_end - 34 + 2  /* a */
+	__pusharg.wr
+	__call		_main1
+
+	.dbg	line,	"dg/pr29581-4.c", 43; main1 (1, a+1);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		__main_end - 34 + 2  /* a */
+	__pusharg.wr
+	__call		_main1
+
+	.dbg	line,	"dg/pr29581-4.c", 44; main1 (2, a+1);
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		__main_end - 34 + 2  /* a */
+	__pusharg.wr
+	__call		_main1
+
+	.dbg	line,	"dg/pr29581-4.c", 45; main1 (N-1, a+1);
+	__ld.wi		15
+	__pusharg.wr
+	__ld.wi		__main_end - 34 + 2  /* a */
+	__pusharg.wr
+	__call		_main1
+
+	.dbg	line,	"dg/pr29581-4.c", 47; return 0;
+	__ld.wi		0
+.LL21:
+
+	.dbg	line,	"dg/pr29581-4.c", 48; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 38
+leaf_needs	.set	38
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    34  _main
+;
+; 34 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10    34  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 34, 10, 10
+__main_end	=	__overlay_frames + 34
+	.endm
@@ -0,0 +1,167 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr32450.c", 1; /* Contributed by Joost VandeVondele  <jv244@cam.ac.uk> */
+	.dbg	line,	"dg/pr32450.c", 3; /* { dg-do run } */
+	.dbg	line,	"dg/pr32450.c", 4; /* { dg-require-profiling "-pg" } */
+	.dbg	line,	"dg/pr32450.c", 5; /* { dg-options "-O2 -pg" } */
+	.dbg	line,	"dg/pr32450.c", 6; /* { dg-options "-O2 -pg -mtune=core2" { target { i?86-*-* x86_64-*-* } } } */
+	.dbg	line,	"dg/pr32450.c", 7; /* { dg-options "-O2 -pg -static" { target hppa*-*-hpux* } } */
+	.dbg	line,	"dg/pr32450.c", 9; extern void abort (void);
+	.dbg	line,	"dg/pr32450.c", 11; int stack_pointer;
+	.dbg	line,	"dg/pr32450.c", 13; void
+	.dbg	line,	"dg/pr32450.c", 14; //__attribute__((noinline))
+	.dbg	line,	"dg/pr32450.c", 15; mystop ()
+	.dbg	line,	"dg/pr32450.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_mystop
+	__enter		_mystop
+
+	.dbg	line,	"dg/pr32450.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/pr32450.c", 18; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr32450.c", 20; void
+	.dbg	line,	"dg/pr32450.c", 21; //__attribute__((noinline))
+	.dbg	line,	"dg/pr32450.c", 22; add ()
+	.dbg	line,	"dg/pr32450.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_add
+	__enter		_add
+
+	.dbg	line,	"dg/pr32450.c", 24; if (stack_pointer + 1 > 10)
+	__ld.wm		_stack_pointer
+	__add.wi	1
+	__sgt_w.wi	10
+	__bfalse	.LL4
+
+	.dbg	line,	"dg/pr32450.c", 25; mystop ();
+	__call		_abort
+.LL5:
+
+	.dbg	line,	"dg/pr32450.c", 27; stack_pointer = stack_pointer + 1;
+.LL4:
+	__inc.wmq	_stack_pointer
+
+	.dbg	line,	"dg/pr32450.c", 28; }
+.LL3:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr32450.c", 30; int main ()
+	.dbg	line,	"dg/pr32450.c", 31; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr32450.c", 32; add ();
+	__ld.wm		_stack_pointer
+	__add.wi	1
+	__sgt_w.wi	10
+	__bfalse	.LL8
+	__call		_abort
+.LL7:
+.LL8:
+	__inc.wmq	_stack_pointer
+.LL9:
+
+	.dbg	line,	"dg/pr32450.c", 33; return stack_pointer - 1;
+	__ld.wm		_stack_pointer
+	__sub.wi	1
+.LL6:
+
+	.dbg	line,	"dg/pr32450.c", 34; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr32450.c", 36; /* { dg-final { cleanup-profile-file } } */
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        12     12     2  stack_pointer
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_stack_pointer, 2, 12, 12
+	.endm
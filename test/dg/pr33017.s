@@ -0,0 +1,295 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr33017.c", 1; /* PR tree-optimization/33017 */
+	.dbg	line,	"dg/pr33017.c", 2; /* { dg-do run } */
+	.dbg	line,	"dg/pr33017.c", 3; /* { dg-options "-O2 -ftree-vectorize" } */
+	.dbg	line,	"dg/pr33017.c", 5; #include <string.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 3; #endif
+	.dbg	line,	"dg/pr33017.c", 7; #define __SIZE_TYPE__ unsigned int
+	.dbg	line,	"dg/pr33017.c", 9; extern void abort (void);
+	.dbg	line,	"dg/pr33017.c", 11; char *
+	.dbg	line,	"dg/pr33017.c", 12; //__attribute__((noinline))
+	.dbg	line,	"dg/pr33017.c", 13; foo (const char *string)
+	.dbg	line,	"dg/pr33017.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"dg/pr33017.c", 15; int len;
+
+	.dbg	line,	"dg/pr33017.c", 16; static char var[0x104];
+
+	.dbg	line,	"dg/pr33017.c", 17; int off;
+
+	.dbg	line,	"dg/pr33017.c", 18; len = strlen (string);
+	__ld.ws		0  /* string */
+	__st.wmq	_bp
+	__call		_strlen.1
+	__st.wmq	__foo_end - 2  /* len */
+
+	.dbg	line,	"dg/pr33017.c", 19; for (off = 0; off < 64; off++)
+	__st.wmiq	0, __foo_end - 4  /* off */
+.LL4:
+	__ld.wm		__foo_end - 4  /* off */
+	__slt_w.wi	64
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__foo_end - 4  /* off */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"dg/pr33017.c", 20; var[len + off + 2] = 0x57;
+	__ld.wm		__foo_end - 2  /* len */
+	__add.wm	__foo_end - 4  /* off */
+	__add.wi	2
+	__add.wi	SL3  /* var */
+	__push.wr
+	__ld.wi		87
+	__st.utq
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"dg/pr33017.c", 21; return var;
+	__ld.wi		SL3  /* var */
+.LL2:
+
+	.dbg	line,	"dg/pr33017.c", 22; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/pr33017.c", 24; int
+	.dbg	line,	"dg/pr33017.c", 25; main (void)
+	.dbg	line,	"dg/pr33017.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr33017.c", 27; int i;
+
+	.dbg	line,	"dg/pr33017.c", 28; char *p;p = foo ("abcd");
+	__ld.wi		__const1+0
+	__pusharg.wr
+	__call		_foo
+	__st.wmq	__main_end - 4  /* p */
+
+	.dbg	line,	"dg/pr33017.c", 29; for (i = 0; i < 0x104; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL9:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	260
+	__btrue		.LL11
+	__bra		.LL12
+.LL10:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL9
+.LL11:
+
+	.dbg	line,	"dg/pr33017.c", 30; if (p[i] != ((i >= 6 && i < 70) ? 0x57 : 0))
+	__ld.wm		__main_end - 4  /* p */
+	__add.wm	__main_end - 2  /* i */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sge_w.wi	6
+	__bfalse	.LL14
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	70
+.LL14:
+	__bfalse	.LL15
+	__ld.wi		87
+	__bra		.LL16
+.LL15:
+	__ld.wi		0
+.LL16:
+	__neq_w.wt
+	__bfalse	.LL13
+
+	.dbg	line,	"dg/pr33017.c", 31; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/pr33017.c", 32; return 0;
+.LL13	.alias		.LL10
+	__bra		.LL10
+.LL12:
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"dg/pr33017.c", 33; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'a','b','c','d',$00
+
+	.bss
+SL3:
+		ds	260
+
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:5
+;	constant pool:0
+;	global pool:21
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       114     16     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 16, 114
+__main_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,291 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr33676.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/pr33676.c", 2; /* { dg-options "-O0 -mtune=i386 -fomit-frame-pointer" { target { { i?86-*-* x86_64-*-* } && ilp32 } } } */
+	.dbg	line,	"dg/pr33676.c", 4; /*__attribute__((noreturn,noinline))*/ void abrt (const char *fi, const char *fu)
+	.dbg	line,	"dg/pr33676.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_abrt
+	__enter		_abrt
+
+	.dbg	line,	"dg/pr33676.c", 6; /*__builtin_*/abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/pr33676.c", 7; }
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr33676.c", 9; /*__attribute__((noinline))*/ int f (int k)
+	.dbg	line,	"dg/pr33676.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"dg/pr33676.c", 11; return k;
+	__ld.ws		0  /* k */
+.LL3:
+
+	.dbg	line,	"dg/pr33676.c", 12; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr33676.c", 14; /*__attribute__((noinline))*/ int g (int t, int k)
+	.dbg	line,	"dg/pr33676.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"dg/pr33676.c", 16; int b;
+
+	.dbg	line,	"dg/pr33676.c", 18; switch (t)
+	__ld.ws		2  /* t */
+	__bra		.LL5
+
+	.dbg	line,	"dg/pr33676.c", 19; {
+
+	.dbg	line,	"dg/pr33676.c", 20; case 0:
+.LL7:
+	__case		0
+
+	.dbg	line,	"dg/pr33676.c", 21; abrt (__FILE__, __FUNCTION__);
+	__ld.wi		__const1+0
+	__pusharg.wr
+	__ld.wi		__const1+13
+	__pusharg.wr
+	__call		_abort
+.LL8:
+	__modsp		4
+
+	.dbg	line,	"dg/pr33676.c", 23; case 1:
+	__endcase
+.LL9:
+	__case		1
+
+	.dbg	line,	"dg/pr33676.c", 24; b = f (k);
+	__ld.ws		0  /* k */
+	__pusharg.wr
+	__ld.ws		0  /* k */
+.LL10:
+	__modsp		2
+	__st.wmq	__g_end - 2  /* b */
+
+	.dbg	line,	"dg/pr33676.c", 25; break;
+	__bra		.LL6
+
+	.dbg	line,	"dg/pr33676.c", 27; case 2:
+.LL11:
+	__case		2
+
+	.dbg	line,	"dg/pr33676.c", 28; b = f (k);
+	__ld.ws		0  /* k */
+	__pusharg.wr
+	__ld.ws		0  /* k */
+.LL12:
+	__modsp		2
+	__st.wmq	__g_end - 2  /* b */
+
+	.dbg	line,	"dg/pr33676.c", 29; break;
+	__bra		.LL6
+
+	.dbg	line,	"dg/pr33676.c", 31; case 3:
+.LL13:
+	__case		3
+
+	.dbg	line,	"dg/pr33676.c", 32; b = f (k);
+	__ld.ws		0  /* k */
+	__pusharg.wr
+	__ld.ws		0  /* k */
+.LL14:
+	__modsp		2
+	__st.wmq	__g_end - 2  /* b */
+
+	.dbg	line,	"dg/pr33676.c", 33; break;
+	__bra		.LL6
+
+	.dbg	line,	"dg/pr33676.c", 35; case 4:
+.LL15:
+	__case		4
+
+	.dbg	line,	"dg/pr33676.c", 36; b = f (k);
+	__ld.ws		0  /* k */
+	__pusharg.wr
+	__ld.ws		0  /* k */
+.LL16:
+	__modsp		2
+	__st.wmq	__g_end - 2  /* b */
+
+	.dbg	line,	"dg/pr33676.c", 37; break;
+	__bra		.LL6
+
+	.dbg	line,	"dg/pr33676.c", 39; default:
+.LL17:
+	__default
+
+	.dbg	line,	"dg/pr33676.c", 40; abrt (__FILE__, __FUNCTION__);
+	__ld.wi		__const1+15
+	__pusharg.wr
+	__ld.wi		__const1+28
+	__pusharg.wr
+	__call		_abort
+.LL18:
+	__modsp		4
+
+	.dbg	line,	"dg/pr33676.c", 41; }
+	__bra		.LL6
+.LL5:
+	__switch_r.wr	0, 4
+
+!table:		dw	.LL7, .LL9, .LL11, .LL13, .LL15
+		dw	.LL17
+.LL6:
+
+	.dbg	line,	"dg/pr33676.c", 43; return b;
+	__ld.wm		__g_end - 2  /* b */
+.LL4:
+
+	.dbg	line,	"dg/pr33676.c", 44; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"dg/pr33676.c", 46; int main (void)
+	.dbg	line,	"dg/pr33676.c", 47; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr33676.c", 48; if (g (3, 1337) != 1337)
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		1337
+	__pusharg.wr
+	__call		_g
+	__neq_w.wi	1337
+	__bfalse	.LL20
+
+	.dbg	line,	"dg/pr33676.c", 49; abrt (__FILE__, __FUNCTION__);
+	__ld.wi		__const1+30
+	__pusharg.wr
+	__ld.wi		__const1+43
+	__pusharg.wr
+	__call		_abort
+.LL21:
+	__modsp		4
+
+	.dbg	line,	"dg/pr33676.c", 50; return 0;
+.LL20:
+	__ld.wi		0
+.LL19:
+
+	.dbg	line,	"dg/pr33676.c", 51; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'd','g','/','p','r','3','3','6'
+		db	'7','6','.','c',$00,'g',$00,'d'
+		db	'g','/','p','r','3','3','6','7'
+		db	'6','.','c',$00,'g',$00,'d','g'
+		db	'/','p','r','3','3','6','7','6'
+		db	'.','c',$00,'m','a','i','n',$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:48
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _g
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 10, 10
+__g_end	=	__overlay_frames + 2
+	.endm
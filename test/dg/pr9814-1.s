@@ -0,0 +1,718 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/pr9814-1.c", 1; /* PR tree-optimization/9814  */
+	.dbg	line,	"dg/pr9814-1.c", 2; /* { dg-do run } */
+	.dbg	line,	"dg/pr9814-1.c", 3; /* { dg-options "-O2" } */
+	.dbg	line,	"dg/pr9814-1.c", 5; extern void abort(void);
+	.dbg	line,	"dg/pr9814-1.c", 7; int test1(int x)
+	.dbg	line,	"dg/pr9814-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"dg/pr9814-1.c", 9; if (x & 2)
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL3
+
+	.dbg	line,	"dg/pr9814-1.c", 10; x |= 2;
+	__ld.wi		2
+	__or_st.wsq	0  /* x */
+
+	.dbg	line,	"dg/pr9814-1.c", 11; return x;
+.LL3:
+	__ld.ws		0  /* x */
+.LL2:
+
+	.dbg	line,	"dg/pr9814-1.c", 12; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr9814-1.c", 14; int test2(int x)
+	.dbg	line,	"dg/pr9814-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"dg/pr9814-1.c", 16; if (!(x & 2))
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL5
+
+	.dbg	line,	"dg/pr9814-1.c", 17; x |= 2;
+	__ld.wi		2
+	__or_st.wsq	0  /* x */
+
+	.dbg	line,	"dg/pr9814-1.c", 18; return x;
+.LL5:
+	__ld.ws		0  /* x */
+.LL4:
+
+	.dbg	line,	"dg/pr9814-1.c", 19; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr9814-1.c", 21; int test3(int x)
+	.dbg	line,	"dg/pr9814-1.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3
+	__enter		_test3
+
+	.dbg	line,	"dg/pr9814-1.c", 23; if (x & 2)
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL7
+
+	.dbg	line,	"dg/pr9814-1.c", 24; x ^= 2;
+	__ld.wi		2
+	__eor_st.wsq	0  /* x */
+
+	.dbg	line,	"dg/pr9814-1.c", 25; return x;
+.LL7:
+	__ld.ws		0  /* x */
+.LL6:
+
+	.dbg	line,	"dg/pr9814-1.c", 26; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr9814-1.c", 28; int test4(int x)
+	.dbg	line,	"dg/pr9814-1.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4
+	__enter		_test4
+
+	.dbg	line,	"dg/pr9814-1.c", 30; if (!(x & 2))
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL9
+
+	.dbg	line,	"dg/pr9814-1.c", 31; x ^= 2;
+	__ld.wi		2
+	__eor_st.wsq	0  /* x */
+
+	.dbg	line,	"dg/pr9814-1.c", 32; return x;
+.LL9:
+	__ld.ws		0  /* x */
+.LL8:
+
+	.dbg	line,	"dg/pr9814-1.c", 33; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr9814-1.c", 35; int test5(int x)
+	.dbg	line,	"dg/pr9814-1.c", 36; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5
+	__enter		_test5
+
+	.dbg	line,	"dg/pr9814-1.c", 37; if (x & 2)
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL11
+
+	.dbg	line,	"dg/pr9814-1.c", 38; x &= ~2;
+	__ld.wi		-3
+	__and_st.wsq	0  /* x */
+
+	.dbg	line,	"dg/pr9814-1.c", 39; return x;
+.LL11:
+	__ld.ws		0  /* x */
+.LL10:
+
+	.dbg	line,	"dg/pr9814-1.c", 40; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr9814-1.c", 42; int test6(int x)
+	.dbg	line,	"dg/pr9814-1.c", 43; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6
+	__enter		_test6
+
+	.dbg	line,	"dg/pr9814-1.c", 44; if (!(x & 2))
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL13
+
+	.dbg	line,	"dg/pr9814-1.c", 45; x &= ~2;
+	__ld.wi		-3
+	__and_st.wsq	0  /* x */
+
+	.dbg	line,	"dg/pr9814-1.c", 46; return x;
+.LL13:
+	__ld.ws		0  /* x */
+.LL12:
+
+	.dbg	line,	"dg/pr9814-1.c", 47; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/pr9814-1.c", 49; int main()
+	.dbg	line,	"dg/pr9814-1.c", 50; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/pr9814-1.c", 51; if (test1(0) != 0)
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL16
+	__ld.wi		2
+	__or_st.wsq	0  /* x */
+.LL16:
+	__ld.ws		0  /* x */
+.LL17:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL15
+
+	.dbg	line,	"dg/pr9814-1.c", 52; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 53; if (test1(2) != 2)
+.LL15:
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL19
+	__ld.wi		2
+	__or_st.wsq	0  /* x */
+.LL19:
+	__ld.ws		0  /* x */
+.LL20:
+	__modsp		2
+	__neq_w.wi	2
+	__bfalse	.LL18
+
+	.dbg	line,	"dg/pr9814-1.c", 54; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 55; if (test1(5) != 5)
+.LL18:
+	__ld.wi		5
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL22
+	__ld.wi		2
+	__or_st.wsq	0  /* x */
+.LL22:
+	__ld.ws		0  /* x */
+.LL23:
+	__modsp		2
+	__neq_w.wi	5
+	__bfalse	.LL21
+
+	.dbg	line,	"dg/pr9814-1.c", 56; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 57; if (test1(7) != 7)
+.LL21:
+	__ld.wi		7
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL25
+	__ld.wi		2
+	__or_st.wsq	0  /* x */
+.LL25:
+	__ld.ws		0  /* x */
+.LL26:
+	__modsp		2
+	__neq_w.wi	7
+	__bfalse	.LL24
+
+	.dbg	line,	"dg/pr9814-1.c", 58; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 60; if (test2(0) != 2)
+.LL24:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL28
+	__ld.wi		2
+	__or_st.wsq	0  /* x */
+.LL28:
+	__ld.ws		0  /* x */
+.LL29:
+	__modsp		2
+	__neq_w.wi	2
+	__bfalse	.LL27
+
+	.dbg	line,	"dg/pr9814-1.c", 61; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 62; if (test2(2) != 2)
+.LL27:
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL31
+	__ld.wi		2
+	__or_st.wsq	0  /* x */
+.LL31:
+	__ld.ws		0  /* x */
+.LL32:
+	__modsp		2
+	__neq_w.wi	2
+	__bfalse	.LL30
+
+	.dbg	line,	"dg/pr9814-1.c", 63; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 64; if (test2(5) != 7)
+.LL30:
+	__ld.wi		5
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL34
+	__ld.wi		2
+	__or_st.wsq	0  /* x */
+.LL34:
+	__ld.ws		0  /* x */
+.LL35:
+	__modsp		2
+	__neq_w.wi	7
+	__bfalse	.LL33
+
+	.dbg	line,	"dg/pr9814-1.c", 65; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 66; if (test2(7) != 7)
+.LL33:
+	__ld.wi		7
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL37
+	__ld.wi		2
+	__or_st.wsq	0  /* x */
+.LL37:
+	__ld.ws		0  /* x */
+.LL38:
+	__modsp		2
+	__neq_w.wi	7
+	__bfalse	.LL36
+
+	.dbg	line,	"dg/pr9814-1.c", 67; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 69; if (test3(0) != 0)
+.LL36:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL40
+	__ld.wi		2
+	__eor_st.wsq	0  /* x */
+.LL40:
+	__ld.ws		0  /* x */
+.LL41:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL39
+
+	.dbg	line,	"dg/pr9814-1.c", 70; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 71; if (test3(2) != 0)
+.LL39:
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL43
+	__ld.wi		2
+	__eor_st.wsq	0  /* x */
+.LL43:
+	__ld.ws		0  /* x */
+.LL44:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL42
+
+	.dbg	line,	"dg/pr9814-1.c", 72; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 73; if (test3(5) != 5)
+.LL42:
+	__ld.wi		5
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL46
+	__ld.wi		2
+	__eor_st.wsq	0  /* x */
+.LL46:
+	__ld.ws		0  /* x */
+.LL47:
+	__modsp		2
+	__neq_w.wi	5
+	__bfalse	.LL45
+
+	.dbg	line,	"dg/pr9814-1.c", 74; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 75; if (test3(7) != 5)
+.LL45:
+	__ld.wi		7
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL49
+	__ld.wi		2
+	__eor_st.wsq	0  /* x */
+.LL49:
+	__ld.ws		0  /* x */
+.LL50:
+	__modsp		2
+	__neq_w.wi	5
+	__bfalse	.LL48
+
+	.dbg	line,	"dg/pr9814-1.c", 76; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 78; if (test4(0) != 2)
+.LL48:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL52
+	__ld.wi		2
+	__eor_st.wsq	0  /* x */
+.LL52:
+	__ld.ws		0  /* x */
+.LL53:
+	__modsp		2
+	__neq_w.wi	2
+	__bfalse	.LL51
+
+	.dbg	line,	"dg/pr9814-1.c", 79; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 80; if (test4(2) != 2)
+.LL51:
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL55
+	__ld.wi		2
+	__eor_st.wsq	0  /* x */
+.LL55:
+	__ld.ws		0  /* x */
+.LL56:
+	__modsp		2
+	__neq_w.wi	2
+	__bfalse	.LL54
+
+	.dbg	line,	"dg/pr9814-1.c", 81; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 82; if (test4(5) != 7)
+.LL54:
+	__ld.wi		5
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL58
+	__ld.wi		2
+	__eor_st.wsq	0  /* x */
+.LL58:
+	__ld.ws		0  /* x */
+.LL59:
+	__modsp		2
+	__neq_w.wi	7
+	__bfalse	.LL57
+
+	.dbg	line,	"dg/pr9814-1.c", 83; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 84; if (test4(7) != 7)
+.LL57:
+	__ld.wi		7
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL61
+	__ld.wi		2
+	__eor_st.wsq	0  /* x */
+.LL61:
+	__ld.ws		0  /* x */
+.LL62:
+	__modsp		2
+	__neq_w.wi	7
+	__bfalse	.LL60
+
+	.dbg	line,	"dg/pr9814-1.c", 85; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 87; if (test5(0) != 0)
+.LL60:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL64
+	__ld.wi		-3
+	__and_st.wsq	0  /* x */
+.LL64:
+	__ld.ws		0  /* x */
+.LL65:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL63
+
+	.dbg	line,	"dg/pr9814-1.c", 88; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 89; if (test5(2) != 0)
+.LL63:
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL67
+	__ld.wi		-3
+	__and_st.wsq	0  /* x */
+.LL67:
+	__ld.ws		0  /* x */
+.LL68:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL66
+
+	.dbg	line,	"dg/pr9814-1.c", 90; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 91; if (test5(5) != 5)
+.LL66:
+	__ld.wi		5
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL70
+	__ld.wi		-3
+	__and_st.wsq	0  /* x */
+.LL70:
+	__ld.ws		0  /* x */
+.LL71:
+	__modsp		2
+	__neq_w.wi	5
+	__bfalse	.LL69
+
+	.dbg	line,	"dg/pr9814-1.c", 92; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 93; if (test5(7) != 5)
+.LL69:
+	__ld.wi		7
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__tand.wi	2
+	__bfalse	.LL73
+	__ld.wi		-3
+	__and_st.wsq	0  /* x */
+.LL73:
+	__ld.ws		0  /* x */
+.LL74:
+	__modsp		2
+	__neq_w.wi	5
+	__bfalse	.LL72
+
+	.dbg	line,	"dg/pr9814-1.c", 94; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 96; if (test6(0) != 0)
+.LL72:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL76
+	__ld.wi		-3
+	__and_st.wsq	0  /* x */
+.LL76:
+	__ld.ws		0  /* x */
+.LL77:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL75
+
+	.dbg	line,	"dg/pr9814-1.c", 97; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 98; if (test6(2) != 2)
+.LL75:
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL79
+	__ld.wi		-3
+	__and_st.wsq	0  /* x */
+.LL79:
+	__ld.ws		0  /* x */
+.LL80:
+	__modsp		2
+	__neq_w.wi	2
+	__bfalse	.LL78
+
+	.dbg	line,	"dg/pr9814-1.c", 99; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 100; if (test6(5) != 5)
+.LL78:
+	__ld.wi		5
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL82
+	__ld.wi		-3
+	__and_st.wsq	0  /* x */
+.LL82:
+	__ld.ws		0  /* x */
+.LL83:
+	__modsp		2
+	__neq_w.wi	5
+	__bfalse	.LL81
+
+	.dbg	line,	"dg/pr9814-1.c", 101; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 102; if (test6(7) != 7)
+.LL81:
+	__ld.wi		7
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__nand.wi	2
+	__bfalse	.LL85
+	__ld.wi		-3
+	__and_st.wsq	0  /* x */
+.LL85:
+	__ld.ws		0  /* x */
+.LL86:
+	__modsp		2
+	__neq_w.wi	7
+	__bfalse	.LL84
+
+	.dbg	line,	"dg/pr9814-1.c", 103; abort();
+	__call		_abort
+
+	.dbg	line,	"dg/pr9814-1.c", 105; return 0;
+.LL84:
+	__ld.wi		0
+.LL14:
+
+	.dbg	line,	"dg/pr9814-1.c", 106; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
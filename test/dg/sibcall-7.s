@@ -0,0 +1,201 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/sibcall-7.c", 1; /* Simple check that tail recursive call optimization is also
+	.dbg	line,	"dg/sibcall-7.c", 2; controlled by -foptimize-sibling-calls.
+	.dbg	line,	"dg/sibcall-7.c", 4; Copyright (C) 2006 Free Software Foundation Inc.
+	.dbg	line,	"dg/sibcall-7.c", 5; Original test by Hans-Peter Nilsson  <hp@bitrange.com>  */
+	.dbg	line,	"dg/sibcall-7.c", 7; /* On IA64 the call frame is allocated on the register stack, not the
+	.dbg	line,	"dg/sibcall-7.c", 8; normal stack.  */
+	.dbg	line,	"dg/sibcall-7.c", 10; /* { dg-do run { target { ! "ia64-*-*" } } } */
+	.dbg	line,	"dg/sibcall-7.c", 11; /* { dg-options "-O2 -fno-optimize-sibling-calls" } */
+	.dbg	line,	"dg/sibcall-7.c", 14; extern void abort (void);
+	.dbg	line,	"dg/sibcall-7.c", 16; extern void recurser_void (int);
+	.dbg	line,	"dg/sibcall-7.c", 17; extern void track (int);
+	.dbg	line,	"dg/sibcall-7.c", 19; int main (void)
+	.dbg	line,	"dg/sibcall-7.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/sibcall-7.c", 21; recurser_void (0);
+	__ld.wi		0
+	__pusharg.wr
+	__call		_recurser_void
+
+	.dbg	line,	"dg/sibcall-7.c", 22; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"dg/sibcall-7.c", 23; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/sibcall-7.c", 25; #pragma recursive
+	.dbg	line,	"dg/sibcall-7.c", 26; void recurser_void (int n)
+	.dbg	line,	"dg/sibcall-7.c", 27; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_recurser_void
+	__enter		_recurser_void
+
+	.dbg	line,	"dg/sibcall-7.c", 28; if (n == 0 || n == 7)
+	__not.ws	0
+	__btrue		.LL5
+	__ld.ws		0  /* n */
+	__equ_w.wi	7
+.LL5:
+	__bfalse	.LL4
+
+	.dbg	line,	"dg/sibcall-7.c", 29; track (n);
+	__ld.ws		0  /* n */
+	__pusharg.wr
+	__call		_track
+
+	.dbg	line,	"dg/sibcall-7.c", 31; if (n == 10)
+.LL4:
+	__ld.ws		0  /* n */
+	__equ_w.wi	10
+	__bfalse	.LL6
+
+	.dbg	line,	"dg/sibcall-7.c", 32; return;
+	__bra		.LL3
+
+	.dbg	line,	"dg/sibcall-7.c", 34; recurser_void (n + 1);
+.LL6:
+	__ld.ws		0  /* n */
+	__add.wi	1
+	__pusharg.wr
+	__call		_recurser_void
+
+	.dbg	line,	"dg/sibcall-7.c", 35; }
+.LL3:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/sibcall-7.c", 37; void *trackpoint;
+	.dbg	line,	"dg/sibcall-7.c", 39; void track (int n)
+	.dbg	line,	"dg/sibcall-7.c", 40; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_track
+	__enter		_track
+
+	.dbg	line,	"dg/sibcall-7.c", 41; char stackpos[1];
+	__modsp		-1
+
+	.dbg	line,	"dg/sibcall-7.c", 43; if (n == 0)
+	__not.ws	1
+	__bfalse	.LL8
+
+	.dbg	line,	"dg/sibcall-7.c", 44; trackpoint = stackpos;
+	__lea.s		0  /* stackpos */
+	__st.wmq	_trackpoint
+
+	.dbg	line,	"dg/sibcall-7.c", 45; else if (n != 7 || trackpoint == stackpos)
+	__bra		.LL9
+.LL8:
+	__ld.ws		1  /* n */
+	__neq_w.wi	7
+	__btrue		.LL11
+	__lea.s		0  /* stackpos */
+	__equ_w.wm	_trackpoint
+.LL11:
+	__bfalse	.LL10
+
+	.dbg	line,	"dg/sibcall-7.c", 46; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/sibcall-7.c", 47; }
+.LL10:
+.LL9:
+.LL7:
+	__modsp		3
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  trackpoint
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_trackpoint, 2, 4, 4
+	.endm
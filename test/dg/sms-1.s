@@ -0,0 +1,204 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/sms-1.c", 1; /* The same test as loop-3c.c.  It failed on ia64
+	.dbg	line,	"dg/sms-1.c", 2; due to not handling of subreg in the lhs that is fixed.  */
+	.dbg	line,	"dg/sms-1.c", 3; /* { dg-do run } */
+	.dbg	line,	"dg/sms-1.c", 4; /* { dg-options "-O2 -fmodulo-sched -fmodulo-sched-allow-regmoves -w" } */
+	.dbg	line,	"dg/sms-1.c", 7; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"dg/sms-1.c", 9; /* void * */ int a[255];
+	.dbg	line,	"dg/sms-1.c", 11; f (unsigned int m)
+	.dbg	line,	"dg/sms-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"dg/sms-1.c", 13; int i;
+
+	.dbg	line,	"dg/sms-1.c", 14; int sh;
+
+	.dbg	line,	"dg/sms-1.c", 15; sh = 0x100;
+	__st.wmiq	256, __f_end - 4  /* sh */
+
+	.dbg	line,	"dg/sms-1.c", 16; i = m;
+	__ld.ws		0  /* m */
+	__st.wmq	__f_end - 2  /* i */
+
+	.dbg	line,	"dg/sms-1.c", 17; do
+.LL3:
+
+	.dbg	line,	"dg/sms-1.c", 18; {
+
+	.dbg	line,	"dg/sms-1.c", 19; a[sh >>= 1] = (/*(unsigned)*/i << 3)  + /*(char*)*/a;
+	__ld.wm		__f_end - 4  /* sh */
+	__asr.wi	1
+	__st.wm		__f_end - 4  /* sh */
+	__asl.wr
+	__add.wi	_a
+	__push.wr
+	__ld.wm		__f_end - 2  /* i */
+	__asl.wi	3
+	__push.wr
+	__ld.wi		_a
+	__double
+	__add.wt
+	__st.wtq
+
+	.dbg	line,	"dg/sms-1.c", 20; i += 4;
+	__add_st.wmiq	4, __f_end - 2  /* i */
+
+	.dbg	line,	"dg/sms-1.c", 21; }
+
+	.dbg	line,	"dg/sms-1.c", 22; while (i < INT_MAX/2 + 1 + 4 * 4);
+.LL4:
+	__ld.wm		__f_end - 2  /* i */
+	__slt_w.wi	16400
+	__btrue		.LL3
+.LL5:
+
+	.dbg	line,	"dg/sms-1.c", 23; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/sms-1.c", 25; main ()
+	.dbg	line,	"dg/sms-1.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/sms-1.c", 27; a[0x10] = 0;
+	__st.wmiq	0, _a + 32
+
+	.dbg	line,	"dg/sms-1.c", 28; a[0x08] = 0;
+	__st.wmiq	0, _a + 16
+
+	.dbg	line,	"dg/sms-1.c", 29; f (INT_MAX/2 + INT_MAX/4 + 2);
+	__ld.wi		24576
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"dg/sms-1.c", 30; if (a[0x10] || a[0x08])
+	__tst.wm	_a + 32
+	__btrue		.LL8
+	__tst.wm	_a + 16
+.LL8:
+	__bfalse	.LL7
+
+	.dbg	line,	"dg/sms-1.c", 31; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/sms-1.c", 32; a[0x10] = 0;
+.LL7:
+	__st.wmiq	0, _a + 32
+
+	.dbg	line,	"dg/sms-1.c", 33; a[0x08] = 0;
+	__st.wmiq	0, _a + 16
+
+	.dbg	line,	"dg/sms-1.c", 34; f (INT_MAX/2 + 1);
+	__ld.wi		16384
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"dg/sms-1.c", 35; if (! a[0x10] || a[0x08])
+	__not.wm	_a + 32
+	__btrue		.LL10
+	__tst.wm	_a + 16
+.LL10:
+	__bfalse	.LL9
+
+	.dbg	line,	"dg/sms-1.c", 36; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/sms-1.c", 37; exit (0);
+.LL9:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"dg/sms-1.c", 38; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_a:
+		ds	510
+
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
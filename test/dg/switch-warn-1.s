@@ -0,0 +1,215 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/switch-warn-1.c", 1; /* { dg-do run } */
+	.dbg	line,	"dg/switch-warn-1.c", 2; /* { dg-options "-O0" } */
+	.dbg	line,	"dg/switch-warn-1.c", 4; extern void abort (void);
+	.dbg	line,	"dg/switch-warn-1.c", 5; extern void exit (int);
+	.dbg	line,	"dg/switch-warn-1.c", 7; /* Check that out-of-bounds case warnings work in the case that the
+	.dbg	line,	"dg/switch-warn-1.c", 8; testing expression is promoted.  */
+	.dbg	line,	"dg/switch-warn-1.c", 9; int
+	.dbg	line,	"dg/switch-warn-1.c", 10; foo1 (unsigned char i)
+	.dbg	line,	"dg/switch-warn-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo1
+	__enter		_foo1
+
+	.dbg	line,	"dg/switch-warn-1.c", 12; switch (i)
+	__ld.usq	0  /* i */
+	__bra		.LL3
+
+	.dbg	line,	"dg/switch-warn-1.c", 13; {
+
+	.dbg	line,	"dg/switch-warn-1.c", 14; #ifndef __HUCC__ /* these are an error, and not a warning in HuCC! */
+
+	.dbg	line,	"dg/switch-warn-1.c", 15; case -1:   /* { dg-warning "case label value is less than minimum value for type" } */
+
+	.dbg	line,	"dg/switch-warn-1.c", 16; return 1;
+
+	.dbg	line,	"dg/switch-warn-1.c", 17; case 256:  /* { dg-warning "case label value exceeds maximum value for type" } */
+
+	.dbg	line,	"dg/switch-warn-1.c", 18; return 2;
+
+	.dbg	line,	"dg/switch-warn-1.c", 19; #endif
+
+	.dbg	line,	"dg/switch-warn-1.c", 20; default:
+.LL5:
+	__default
+
+	.dbg	line,	"dg/switch-warn-1.c", 21; return 3;
+	__ld.wi		3
+
+	.dbg	line,	"dg/switch-warn-1.c", 22; }
+.LL4:
+.LL3	.alias		.LL5
+
+	.dbg	line,	"dg/switch-warn-1.c", 23; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/switch-warn-1.c", 25; /* Like above, but for case ranges that need to be satured.  */
+	.dbg	line,	"dg/switch-warn-1.c", 26; int
+	.dbg	line,	"dg/switch-warn-1.c", 27; foo2 (unsigned char i)
+	.dbg	line,	"dg/switch-warn-1.c", 28; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo2
+	__enter		_foo2
+
+	.dbg	line,	"dg/switch-warn-1.c", 29; switch (i)
+	__ld.usq	0  /* i */
+	__bra		.LL7
+
+	.dbg	line,	"dg/switch-warn-1.c", 30; {
+
+	.dbg	line,	"dg/switch-warn-1.c", 31; //    case -1 ... 1:   /* { dg-warning "lower value in case label range less than minimum value for type" } */
+
+	.dbg	line,	"dg/switch-warn-1.c", 32; //      return 1;
+
+	.dbg	line,	"dg/switch-warn-1.c", 33; //    case 254 ... 256:  /* { dg-warning "upper value in case label range exceeds maximum value for type" } */
+
+	.dbg	line,	"dg/switch-warn-1.c", 34; //      return 2;
+
+	.dbg	line,	"dg/switch-warn-1.c", 35; default:
+.LL9:
+	__default
+
+	.dbg	line,	"dg/switch-warn-1.c", 36; return 3;
+	__ld.wi		3
+
+	.dbg	line,	"dg/switch-warn-1.c", 37; }
+.LL8:
+.LL7	.alias		.LL9
+
+	.dbg	line,	"dg/switch-warn-1.c", 38; }
+.LL6:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/switch-warn-1.c", 40; int
+	.dbg	line,	"dg/switch-warn-1.c", 41; main (void)
+	.dbg	line,	"dg/switch-warn-1.c", 42; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/switch-warn-1.c", 43; if (foo1 (10) != 3)
+	__ld.wi		10
+	__pusharg.wr
+	__ld.usq	0  /* i */
+	__bra		.LL14
+.LL12:
+	__default
+	__ld.wi		3
+.LL13:
+.LL14	.alias		.LL12
+.LL15:
+	__modsp		2
+	__neq_w.wi	3
+	__bfalse	.LL11
+
+	.dbg	line,	"dg/switch-warn-1.c", 44; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/switch-warn-1.c", 45; if (foo2 (10) != 3)
+.LL11:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.usq	0  /* i */
+	__bra		.LL19
+.LL17:
+	__default
+	__ld.wi		3
+.LL18:
+.LL19	.alias		.LL17
+.LL20:
+	__modsp		2
+	__neq_w.wi	3
+	__bfalse	.LL16
+
+	.dbg	line,	"dg/switch-warn-1.c", 46; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/switch-warn-1.c", 47; exit (0);
+.LL16:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"dg/switch-warn-1.c", 48; }
+.LL10:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,144 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/switch-warn-2.c", 1; /* This should not warn about the case label being out of range.  */
+	.dbg	line,	"dg/switch-warn-2.c", 2; /* { dg-do run } */
+	.dbg	line,	"dg/switch-warn-2.c", 3; /* { dg-options "-O0" } */
+	.dbg	line,	"dg/switch-warn-2.c", 5; extern void abort (void);
+	.dbg	line,	"dg/switch-warn-2.c", 6; extern void exit (int);
+	.dbg	line,	"dg/switch-warn-2.c", 8; int
+	.dbg	line,	"dg/switch-warn-2.c", 9; foo (unsigned int i)
+	.dbg	line,	"dg/switch-warn-2.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"dg/switch-warn-2.c", 11; switch (i)
+	__ld.ws		0  /* i */
+	__bra		.LL3
+
+	.dbg	line,	"dg/switch-warn-2.c", 12; {
+
+	.dbg	line,	"dg/switch-warn-2.c", 13; case 34561: /* { dg-warning "large integer implicitly truncated to unsigned type" } */
+.LL5:
+	__case		34561
+
+	.dbg	line,	"dg/switch-warn-2.c", 14; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"dg/switch-warn-2.c", 15; default:
+.LL6:
+	__default
+
+	.dbg	line,	"dg/switch-warn-2.c", 16; return 3;
+	__ld.wi		3
+	__bra		.LL2
+
+	.dbg	line,	"dg/switch-warn-2.c", 17; }
+.LL3:
+	__switch_r.wr	34561, 34561
+
+!table:		dw	.LL5
+		dw	.LL6
+.LL4:
+
+	.dbg	line,	"dg/switch-warn-2.c", 18; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"dg/switch-warn-2.c", 20; int
+	.dbg	line,	"dg/switch-warn-2.c", 21; main (void)
+	.dbg	line,	"dg/switch-warn-2.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/switch-warn-2.c", 23; if (foo (10) != 3)
+	__ld.wi		10
+	__pusharg.wr
+	__call		_foo
+	__neq_w.wi	3
+	__bfalse	.LL8
+
+	.dbg	line,	"dg/switch-warn-2.c", 24; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/switch-warn-2.c", 25; exit (0);
+.LL8:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"dg/switch-warn-2.c", 26; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,178 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"dg/unroll-1.c", 1; /* PR optimization/8599 */
+	.dbg	line,	"dg/unroll-1.c", 2; /* { dg-do run } */
+	.dbg	line,	"dg/unroll-1.c", 3; /* { dg-options "-O2 -funroll-loops" } */
+	.dbg	line,	"dg/unroll-1.c", 4; /* { dg-options "-mtune=k6 -O2 -funroll-loops" { target { { i?86-*-* x86_64-*-* } && ilp32 } } } */
+	.dbg	line,	"dg/unroll-1.c", 7; extern void abort (void);
+	.dbg	line,	"dg/unroll-1.c", 9; int array[6] = { 1,2,3,4,5,6 };
+	.dbg	line,	"dg/unroll-1.c", 11; void foo()
+	.dbg	line,	"dg/unroll-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"dg/unroll-1.c", 13; int i;
+
+	.dbg	line,	"dg/unroll-1.c", 15; for (i = 0; i < 5; i++)
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL3:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.wi	5
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"dg/unroll-1.c", 16; array[i] = 0;
+	__ld2x.wmq	__foo_end - 2  /* i */
+	__st.waxiq	0, _array
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"dg/unroll-1.c", 17; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"dg/unroll-1.c", 19; int main()
+	.dbg	line,	"dg/unroll-1.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"dg/unroll-1.c", 21; foo();
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL8:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.wi	5
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL8
+.LL10:
+	__ld2x.wmq	__foo_end - 2  /* i */
+	__st.waxiq	0, _array
+	__bra		.LL9
+.LL11:
+.LL12:
+
+	.dbg	line,	"dg/unroll-1.c", 22; if (array[0] || array [1] || array[2] || array[3] || array[4])
+	__tst.wm	_array
+	__btrue		.LL14
+	__tst.wm	_array + 2
+.LL14:
+	__btrue		.LL15
+	__tst.wm	_array + 4
+.LL15:
+	__btrue		.LL16
+	__tst.wm	_array + 6
+.LL16:
+	__btrue		.LL17
+	__tst.wm	_array + 8
+.LL17:
+	__bfalse	.LL13
+
+	.dbg	line,	"dg/unroll-1.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/unroll-1.c", 24; if (array[5] != 6)
+.LL13:
+	__ld.wm		_array + 10
+	__neq_w.wi	6
+	__bfalse	.LL18
+
+	.dbg	line,	"dg/unroll-1.c", 25; abort ();
+	__call		_abort
+
+	.dbg	line,	"dg/unroll-1.c", 26; return 0;
+.LL18:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"dg/unroll-1.c", 27; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.xdata
+_array:
+		ds	12
+
+	.xinit
+
+		dw	1,2,3,4,5,6
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -18,6 +18,9 @@ fi
 
 echo exesuffix="$exesuffix"
 
+# the same limit as "tgemu --batch", so a ROM that hangs fails the test
+frames=3600
+
 for d in large small norec noopt
 do
 	fails=0
@@ -29,6 +32,8 @@ do
 	test "$d" = "noopt" && opt="-DSTACK_SIZE=1024 -O0 -DNOOPT"
 	echo "testing $d"
 	echo opt="$opt"
+	roms=
+	nroms=0
 	for i in $tests
 	do
 		echo "HuC Type: $d   Test: $i"
@@ -39,18 +44,48 @@ do
 #			nocompiles=$((nocompiles + 1))
 #			continue
 		fi
-		if ../tgemu/tgemu${exesuffix} "${i%.c}.pce" 2>/dev/null >/dev/null ; then
-			echo PASS
+		roms="$roms ${i%.c}.pce"
+		nroms=$((nroms + 1))
+	done
+
+	# run all the ROMs of this mode at once, one "rom result exit" line each
+	report=tgemu-$d.txt
+	if [ "$OS" = "Windows_NT" ]; then
+		: > $report
+		for rom in $roms
+		do
+			../tgemu/tgemu${exesuffix} --frames=$frames "$rom" 2>/dev/null >/dev/null
+			code=$?
+			result=PASS
+			test $code != 0 && result=FAIL
+			printf "%s\t%s\t%s\n" "$rom" $result $code >> $report
+		done
+	else
+		../tgemu/tgemu --batch --frames=$frames $roms > $report
+		status=$?
+		# an exit code of 1 only means that some of the ROMs failed
+		reported=`wc -l < $report`
+		if [ $status -gt 1 ] || [ $reported -ne $nroms ]; then
+			echo "tgemu --batch failed (exit code $status), $reported of $nroms ROMs reported"
+			rm -f $report
+			exit 1
+		fi
+	fi
+	while IFS="	" read rom result code rest
+	do
+		if [ "$result" = "PASS" ] ; then
 			passes=$((passes + 1))
 		else
-			echo "FAIL (exit code $?)"
-			../tgemu/tgemu${exesuffix} "${i%.c}.pce"
-			exit
+			echo "$rom: FAIL (exit code $code)"
+			../tgemu/tgemu${exesuffix} --frames=$frames "$rom"
+			rm -f $report
+			exit 1
 #			mkdir -p failtraces
-#			mv "${i%.c}".{sym,s,pce} failtraces/
+#			mv "${rom%.pce}".{sym,s,pce} failtraces/
 #			fails=$((fails + 1))
 		fi
-	done
+	done < $report
+	rm -f $report
 	echo "$d passes: $passes; fails: $fails, nocompiles: $nocompiles"
 	total_fails=$((total_fails + fails))
 	total_nocompiles=$((total_nocompiles + nocompiles))
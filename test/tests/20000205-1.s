@@ -0,0 +1,141 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000205-1.c", 1; static int f (int a)
+	.dbg	line,	"tests/20000205-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/20000205-1.c", 3; if (a == 0)
+	__not.ws	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20000205-1.c", 4; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/20000205-1.c", 5; do
+.LL3:
+.LL4:
+
+	.dbg	line,	"tests/20000205-1.c", 6; if (a & 128)
+	__ld.ws		0  /* a */
+	__tand.wi	128
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20000205-1.c", 7; return 1;
+	__ld.wi		1
+	__bra		.LL2
+
+	.dbg	line,	"tests/20000205-1.c", 8; while (f (0));
+.LL7:
+.LL5:
+	__ld.wi		0
+	__pusharg.wr
+	__call		_f
+	__tst.wr
+	__btrue		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20000205-1.c", 9; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20000205-1.c", 10; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000205-1.c", 12; int main(void)
+	.dbg	line,	"tests/20000205-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000205-1.c", 14; if (f (~128))
+	__ld.wi		-129
+	__pusharg.wr
+	__call		_f
+	__tst.wr
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20000205-1.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000205-1.c", 16; exit (0);
+.LL9:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000205-1.c", 17; }
+.LL8:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,159 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000217-1.c", 1; unsigned short int showbug(unsigned short int *a, unsigned short int *b)
+	.dbg	line,	"tests/20000217-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_showbug
+	__enter		_showbug
+
+	.dbg	line,	"tests/20000217-1.c", 3; *a += *b -8;
+	__ld.ws		2  /* a */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* b */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__sub.wi	8
+	__add.wt
+	__st.wtq
+
+	.dbg	line,	"tests/20000217-1.c", 4; return (*a >= 8);
+	__ld.ws		2  /* a */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__uge_w.wi	8
+.LL2:
+	__bool
+
+	.dbg	line,	"tests/20000217-1.c", 5; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000217-1.c", 7; int main()
+	.dbg	line,	"tests/20000217-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000217-1.c", 9; unsigned short int x;
+
+	.dbg	line,	"tests/20000217-1.c", 10; unsigned short int y;
+
+	.dbg	line,	"tests/20000217-1.c", 11; x = 0;
+	__st.wmiq	0, __main_end - 2  /* x */
+
+	.dbg	line,	"tests/20000217-1.c", 12; y = 10;
+	__st.wmiq	10, __main_end - 4  /* y */
+
+	.dbg	line,	"tests/20000217-1.c", 14; if (showbug(&x, &y) != 0)
+	__ld.wi		__main_end - 2  /* x */
+	__pusharg.wr
+	__ld.wi		__main_end - 4  /* y */
+	__pusharg.wr
+	__call		_showbug
+	__tst.wr
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20000217-1.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000217-1.c", 17; exit (0);
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000217-1.c", 18; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 8, 8
+__main_end	=	__overlay_frames + 4
+	.endm
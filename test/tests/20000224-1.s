@@ -0,0 +1,188 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000224-1.c", 1; const int loop_1 = 100;
+	.dbg	line,	"tests/20000224-1.c", 2; const int loop_2 = 7;
+	.dbg	line,	"tests/20000224-1.c", 3; int flag;
+	.dbg	line,	"tests/20000224-1.c", 5; int test (void)
+	.dbg	line,	"tests/20000224-1.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/20000224-1.c", 7; int i;
+
+	.dbg	line,	"tests/20000224-1.c", 8; int counter;
+
+	.dbg	line,	"tests/20000224-1.c", 9; counter = 0;
+	__st.wmiq	0, __test_end - 4  /* counter */
+
+	.dbg	line,	"tests/20000224-1.c", 11; while (loop_1 > counter) {
+.LL3:
+	__ld.wi		100
+	__sgt_w.wm	__test_end - 4  /* counter */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20000224-1.c", 12; if (flag & 1) {
+	__ld.wm		_flag
+	__tand.wi	1
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20000224-1.c", 13; for (i = 0; i < loop_2; i++) {
+	__st.wmiq	0, __test_end - 2  /* i */
+.LL6:
+	__ld.wm		__test_end - 2  /* i */
+	__slt_w.wi	7
+	__btrue		.LL8
+	__bra		.LL9
+.LL7:
+	__inc.wmq	__test_end - 2  /* i */
+	__bra		.LL6
+.LL8:
+
+	.dbg	line,	"tests/20000224-1.c", 14; counter++;
+	__inc.wmq	__test_end - 4  /* counter */
+
+	.dbg	line,	"tests/20000224-1.c", 15; }
+	__bra		.LL7
+.LL9:
+
+	.dbg	line,	"tests/20000224-1.c", 16; }
+
+	.dbg	line,	"tests/20000224-1.c", 17; flag++;
+.LL5:
+	__inc.wmq	_flag
+
+	.dbg	line,	"tests/20000224-1.c", 18; }
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/20000224-1.c", 19; return 1;
+	__ld.wi		1
+.LL2:
+
+	.dbg	line,	"tests/20000224-1.c", 20; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000224-1.c", 22; int main()
+	.dbg	line,	"tests/20000224-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000224-1.c", 24; flag = 0;
+	__st.wmiq	0, _flag
+
+	.dbg	line,	"tests/20000224-1.c", 25; if (test () != 1)
+	__call		_test
+	__neq_w.wi	1
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/20000224-1.c", 26; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000224-1.c", 27; 
+
+	.dbg	line,	"tests/20000224-1.c", 28; exit (0);
+.LL11:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000224-1.c", 29; }
+.LL10:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_loop_1:
+		dw	100
+_loop_2:
+		dw	7
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:4
+;	global pool:7
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        50      8     2  flag
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_flag, 2, 8, 50
+	.endm
@@ -0,0 +1,136 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000225-1.c", 1; int main ()
+	.dbg	line,	"tests/20000225-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000225-1.c", 3; int nResult;
+
+	.dbg	line,	"tests/20000225-1.c", 4; int b;
+
+	.dbg	line,	"tests/20000225-1.c", 5; int i;
+
+	.dbg	line,	"tests/20000225-1.c", 6; b = 0;
+	__st.wmiq	0, __main_end - 4  /* b */
+
+	.dbg	line,	"tests/20000225-1.c", 7; i = -1;
+	__st.wmiq	-1, __main_end - 6  /* i */
+
+	.dbg	line,	"tests/20000225-1.c", 9; do
+.LL3:
+
+	.dbg	line,	"tests/20000225-1.c", 10; {
+
+	.dbg	line,	"tests/20000225-1.c", 11; if (b!=0) {
+	__tst.wm	__main_end - 4  /* b */
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20000225-1.c", 12; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000225-1.c", 13; nResult=1;
+
+	.dbg	line,	"tests/20000225-1.c", 14; } else {
+	__bra		.LL7
+.LL6:
+
+	.dbg	line,	"tests/20000225-1.c", 15; nResult=0;
+
+	.dbg	line,	"tests/20000225-1.c", 16; }
+.LL7:
+
+	.dbg	line,	"tests/20000225-1.c", 17; i++;
+	__inc.wmq	__main_end - 6  /* i */
+
+	.dbg	line,	"tests/20000225-1.c", 18; b=(i+2)*4;
+	__ld.wm		__main_end - 6  /* i */
+	__add.wi	2
+	__asl.wi	2
+	__st.wmq	__main_end - 4  /* b */
+
+	.dbg	line,	"tests/20000225-1.c", 19; } while (i < 0);
+.LL4:
+	__ld.wm		__main_end - 6  /* i */
+	__slt_w.wi	0
+	__btrue		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20000225-1.c", 20; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000225-1.c", 21; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
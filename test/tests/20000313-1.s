@@ -0,0 +1,181 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000313-1.c", 1; unsigned int buggy (unsigned int *param)
+	.dbg	line,	"tests/20000313-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_buggy
+	__enter		_buggy
+
+	.dbg	line,	"tests/20000313-1.c", 3; unsigned int accu, zero, borrow;
+
+	.dbg	line,	"tests/20000313-1.c", 4; zero = 0;
+	__st.wmiq	0, __buggy_end - 4  /* zero */
+
+	.dbg	line,	"tests/20000313-1.c", 5; accu    = - *param;
+	__ld.ws		0  /* param */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neg.wr
+	__st.wmq	__buggy_end - 2  /* accu */
+
+	.dbg	line,	"tests/20000313-1.c", 6; borrow  = - (accu > zero);
+	__ugt_w.wm	__buggy_end - 4  /* zero */
+	__bool
+	__neg.wr
+	__st.wmq	__buggy_end - 6  /* borrow */
+
+	.dbg	line,	"tests/20000313-1.c", 7; *param += accu;
+	__ld.ws		0  /* param */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wm	__buggy_end - 2  /* accu */
+	__st.wtq
+
+	.dbg	line,	"tests/20000313-1.c", 8; return borrow;
+	__ld.wm		__buggy_end - 6  /* borrow */
+.LL2:
+
+	.dbg	line,	"tests/20000313-1.c", 9; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__buggy_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000313-1.c", 11; int main (void)
+	.dbg	line,	"tests/20000313-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000313-1.c", 13; unsigned int param;
+
+	.dbg	line,	"tests/20000313-1.c", 14; unsigned int borrow;
+
+	.dbg	line,	"tests/20000313-1.c", 15; param = 1;
+	__st.wmiq	1, __main_end - 2  /* param */
+
+	.dbg	line,	"tests/20000313-1.c", 16; borrow = buggy (&param);
+	__ld.wi		__main_end - 2  /* param */
+	__pusharg.wr
+	__call		_buggy
+	__st.wmq	__main_end - 4  /* borrow */
+
+	.dbg	line,	"tests/20000313-1.c", 18; if (param != 0)
+	__tst.wm	__main_end - 2  /* param */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20000313-1.c", 19; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000313-1.c", 20; if (borrow + 1 != 0)
+.LL4:
+	__ld.wm		__main_end - 4  /* borrow */
+	__add.wi	1
+	__tst.wr
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20000313-1.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000313-1.c", 22; return 0;
+.LL5:
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/20000313-1.c", 23; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 10, 10
+__main_end	=	__overlay_frames + 4
+	.endm
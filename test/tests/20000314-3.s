@@ -0,0 +1,205 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000314-3.c", 1; extern void abort (void);
+	.dbg	line,	"tests/20000314-3.c", 3; static const char *arg0 = "arg0";
+	.dbg	line,	"tests/20000314-3.c", 4; static const char *arg1 = "arg1";
+	.dbg	line,	"tests/20000314-3.c", 6; static void attr_rtx		(char *, char *);
+	.dbg	line,	"tests/20000314-3.c", 7; static char *attr_string        (char *);
+	.dbg	line,	"tests/20000314-3.c", 8; static void attr_eq		(char *, char *);
+	.dbg	line,	"tests/20000314-3.c", 10; static void 
+	.dbg	line,	"tests/20000314-3.c", 11; attr_rtx (char *varg0, char *varg1)
+	.dbg	line,	"tests/20000314-3.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_attr_rtx
+	__enter		_attr_rtx
+
+	.dbg	line,	"tests/20000314-3.c", 13; if (varg0 != arg0)
+	__ld.ws		2  /* varg0 */
+	__neq_w.wm	_arg0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20000314-3.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000314-3.c", 16; if (varg1 != arg1)
+.LL3:
+	__ld.ws		0  /* varg1 */
+	__neq_w.wm	_arg1
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20000314-3.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000314-3.c", 19; return;
+.LL4	.alias		.LL2
+.LL2:
+
+	.dbg	line,	"tests/20000314-3.c", 20; }
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000314-3.c", 22; static void 
+	.dbg	line,	"tests/20000314-3.c", 23; attr_eq (name, value)
+	.dbg	line,	"tests/20000314-3.c", 24; char *name, *value;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_attr_eq
+	__enter		_attr_eq
+
+	.dbg	line,	"tests/20000314-3.c", 25; {
+
+	.dbg	line,	"tests/20000314-3.c", 26; return attr_rtx (attr_string (name),
+	__ld.ws		2  /* name */
+	__pusharg.wr
+	__call		_attr_string
+	__pusharg.wr
+
+	.dbg	line,	"tests/20000314-3.c", 27; attr_string (value));
+	__ld.ws		2  /* value */
+	__pusharg.wr
+	__call		_attr_string
+	__pusharg.wr
+	__ld.ws		2  /* varg0 */
+	__neq_w.wm	_arg0
+	__bfalse	.LL6
+	__call		_abort
+.LL6:
+	__ld.ws		0  /* varg1 */
+	__neq_w.wm	_arg1
+	__bfalse	.LL7
+	__call		_abort
+.LL7	.alias		.LL8
+.LL8:
+	__modsp		4
+.LL5:
+
+	.dbg	line,	"tests/20000314-3.c", 28; }
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000314-3.c", 30; static char *
+	.dbg	line,	"tests/20000314-3.c", 31; attr_string (str)
+	.dbg	line,	"tests/20000314-3.c", 32; char *str;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_attr_string
+	__enter		_attr_string
+
+	.dbg	line,	"tests/20000314-3.c", 33; {
+
+	.dbg	line,	"tests/20000314-3.c", 34; return str;
+	__ld.ws		0  /* str */
+.LL9:
+
+	.dbg	line,	"tests/20000314-3.c", 35; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000314-3.c", 37; int main()
+	.dbg	line,	"tests/20000314-3.c", 38; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000314-3.c", 39; attr_eq (arg0, arg1);
+	__ld.wm		_arg0
+	__pusharg.wr
+	__ld.wm		_arg1
+	__pusharg.wr
+	__call		_attr_eq
+
+	.dbg	line,	"tests/20000314-3.c", 40; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000314-3.c", 41; }
+.LL10:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'a','r','g','0',$00,'a','r','g'
+		db	'1',$00
+_arg0:
+		dw	__const1+0
+_arg1:
+		dw	__const1+5
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:10
+;	constant pool:4
+;	global pool:8
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,339 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000412-1.c", 1; const short int i = -1;
+	.dbg	line,	"tests/20000412-1.c", 2; const char * /*const*/ wordlist[207];
+	.dbg	line,	"tests/20000412-1.c", 4; const char * /*const*/ *
+	.dbg	line,	"tests/20000412-1.c", 5; foo(void)
+	.dbg	line,	"tests/20000412-1.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20000412-1.c", 7; register /*const*/ char * /*const*/ *wordptr; wordptr = &wordlist[207/*u*/ + i];
+	__ld.wi		207
+	__add.wi	-1
+	__asl.wr
+	__add.wi	_wordlist
+	__st.wmq	__foo_end - 2  /* wordptr */
+
+	.dbg	line,	"tests/20000412-1.c", 8; return wordptr;
+.LL2:
+
+	.dbg	line,	"tests/20000412-1.c", 9; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000412-1.c", 11; int
+	.dbg	line,	"tests/20000412-1.c", 12; main()
+	.dbg	line,	"tests/20000412-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000412-1.c", 14; if (foo() != &wordlist[206])
+	__ld.wi		207
+	__add.wi	-1
+	__asl.wr
+	__add.wi	_wordlist
+	__st.wmq	__foo_end - 2  /* wordptr */
+.LL5:
+	__neq_w.wi	_wordlist + 412
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20000412-1.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000412-1.c", 16; exit(0);
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000412-1.c", 17; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_i:
+		dw	-1
+_wordlist:
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+		dw	0
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:416
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
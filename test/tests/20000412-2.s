@@ -0,0 +1,137 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000412-2.c", 1; #pragma recursive
+	.dbg	line,	"tests/20000412-2.c", 2; int f(int a,int *y)
+	.dbg	line,	"tests/20000412-2.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/20000412-2.c", 4; int x;
+	__modsp		-2
+
+	.dbg	line,	"tests/20000412-2.c", 5; x = a;
+	__ld.ws		4  /* a */
+	__st.wsq	0  /* x */
+
+	.dbg	line,	"tests/20000412-2.c", 7; if (a==0)
+	__not.ws	4
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20000412-2.c", 8; return *y;
+	__ld.ws		2  /* y */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__bra		.LL2
+
+	.dbg	line,	"tests/20000412-2.c", 10; return f(a-1,&x);
+.LL3:
+	__ld.ws		4  /* a */
+	__sub.wi	1
+	__pusharg.wr
+	__lea.s		2  /* x */
+	__pusharg.wr
+	__call		_f
+.LL2:
+
+	.dbg	line,	"tests/20000412-2.c", 11; }
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000412-2.c", 13; int main(int argc,char *argv[])
+	.dbg	line,	"tests/20000412-2.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000412-2.c", 15; if (f (10, 0) != 1)
+	__ld.wi		10
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_f
+	__neq_w.wi	1
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20000412-2.c", 16; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000412-2.c", 17; exit (0);
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000412-2.c", 18; }
+.LL4:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
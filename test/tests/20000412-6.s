@@ -0,0 +1,156 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000412-6.c", 1; unsigned bug (unsigned short value, unsigned short *buffer,
+	.dbg	line,	"tests/20000412-6.c", 2; unsigned short *bufend);
+	.dbg	line,	"tests/20000412-6.c", 4; const unsigned short buf[] = {1, 4, 16, 64, 256};
+	.dbg	line,	"tests/20000412-6.c", 5; int main()
+	.dbg	line,	"tests/20000412-6.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000412-6.c", 7; if (bug (512, buf, buf + 3) != 491)
+	__ld.wi		512
+	__pusharg.wr
+	__ld.wi		_buf
+	__pusharg.wr
+	__ld.wi		_buf + 6
+	__pusharg.wr
+	__call		_bug
+	__neq_w.wi	491
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20000412-6.c", 8; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000412-6.c", 10; exit (0);
+.LL3:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000412-6.c", 11; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000412-6.c", 13; unsigned
+	.dbg	line,	"tests/20000412-6.c", 14; bug (unsigned short value, unsigned short *buffer, unsigned short *bufend)
+	.dbg	line,	"tests/20000412-6.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bug
+	__enter		_bug
+
+	.dbg	line,	"tests/20000412-6.c", 16; unsigned short *tmp;
+
+	.dbg	line,	"tests/20000412-6.c", 18; for (tmp = buffer; tmp < bufend; tmp++)
+	__ld.ws		2  /* buffer */
+	__st.wmq	__bug_end - 2  /* tmp */
+.LL5:
+	__ld.wm		__bug_end - 2  /* tmp */
+	__ult_w.ws	0  /* bufend */
+	__btrue		.LL7
+	__bra		.LL8
+.LL6:
+	__ld.wm		__bug_end - 2  /* tmp */
+	__add.wi	2
+	__st.wm		__bug_end - 2  /* tmp */
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/20000412-6.c", 19; value -= *tmp;
+	__ld.wm		__bug_end - 2  /* tmp */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__isub_st.wsq	4  /* value */
+	__bra		.LL6
+.LL8:
+
+	.dbg	line,	"tests/20000412-6.c", 21; return value;
+	__ld.ws		4  /* value */
+.LL4:
+
+	.dbg	line,	"tests/20000412-6.c", 22; }
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__bug_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_buf:
+		dw	1
+		dw	4
+		dw	16
+		dw	64
+		dw	256
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:10
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
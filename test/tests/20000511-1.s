@@ -0,0 +1,556 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000511-1.c", 1; void f (int value, int expect)
+	.dbg	line,	"tests/20000511-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/20000511-1.c", 3; if (value != expect)
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20000511-1.c", 4; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000511-1.c", 5; }
+.LL3:
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000511-1.c", 7; int main()
+	.dbg	line,	"tests/20000511-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000511-1.c", 9; int a, b, c, d, e;
+
+	.dbg	line,	"tests/20000511-1.c", 10; a = 7; b = 6; c = 4; d = 7; e = 2;
+	__st.wmiq	7, __main_end - 2  /* a */
+	__st.wmiq	6, __main_end - 4  /* b */
+	__st.wmiq	4, __main_end - 6  /* c */
+	__st.wmiq	7, __main_end - 8  /* d */
+	__st.wmiq	2, __main_end - 10  /* e */
+
+	.dbg	line,	"tests/20000511-1.c", 11; 
+
+	.dbg	line,	"tests/20000511-1.c", 12; f (a||b%c,   1);
+	__tst.wm	__main_end - 2  /* a */
+	__btrue		.LL5
+	__ld.wm		__main_end - 4  /* b */
+	__push.wr
+	__ld.wm		__main_end - 6  /* c */
+	__smod.wt
+	__tst.wr
+.LL5:
+	__bool
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL6
+	__call		_abort
+.LL6:
+.LL7:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 13; f (a?b%c:0,  2);
+	__tst.wm	__main_end - 2  /* a */
+	__bfalse	.LL8
+	__ld.wm		__main_end - 4  /* b */
+	__push.wr
+	__ld.wm		__main_end - 6  /* c */
+	__smod.wt
+	__bra		.LL9
+.LL8:
+	__ld.wi		0
+.LL9:
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL10
+	__call		_abort
+.LL10:
+.LL11:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 14; f (a=b%c,    2);
+	__ld.wm		__main_end - 4  /* b */
+	__push.wr
+	__ld.wm		__main_end - 6  /* c */
+	__smod.wt
+	__st.wm		__main_end - 2  /* a */
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL12
+	__call		_abort
+.LL12:
+.LL13:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 15; f (a*=b%c,   4);
+	__ld.wm		__main_end - 2  /* a */
+	__push.wr
+	__ld.wm		__main_end - 4  /* b */
+	__push.wr
+	__ld.wm		__main_end - 6  /* c */
+	__smod.wt
+	__mul.wt
+	__st.wm		__main_end - 2  /* a */
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL14
+	__call		_abort
+.LL14:
+.LL15:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 16; f (a/=b%c,   2);
+	__ld.wm		__main_end - 2  /* a */
+	__push.wr
+	__ld.wm		__main_end - 4  /* b */
+	__push.wr
+	__ld.wm		__main_end - 6  /* c */
+	__smod.wt
+	__sdiv.wt
+	__st.wm		__main_end - 2  /* a */
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL16
+	__call		_abort
+.LL16:
+.LL17:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 17; f (a%=b%c,   0);
+	__ld.wm		__main_end - 2  /* a */
+	__push.wr
+	__ld.wm		__main_end - 4  /* b */
+	__push.wr
+	__ld.wm		__main_end - 6  /* c */
+	__smod.wt
+	__smod.wt
+	__st.wm		__main_end - 2  /* a */
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL18
+	__call		_abort
+.LL18:
+.LL19:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 18; f (a+=b%c,   2);
+	__ld.wm		__main_end - 4  /* b */
+	__push.wr
+	__ld.wm		__main_end - 6  /* c */
+	__smod.wt
+	__add.wm	__main_end - 2  /* a */
+	__st.wm		__main_end - 2  /* a */
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL20
+	__call		_abort
+.LL20:
+.LL21:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 19; f (d||c&&e,  1);
+	__tst.wm	__main_end - 8  /* d */
+	__btrue		.LL22
+	__tst.wm	__main_end - 6  /* c */
+	__bfalse	.LL23
+	__tst.wm	__main_end - 10  /* e */
+.LL23:
+.LL22:
+	__bool
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL24
+	__call		_abort
+.LL24:
+.LL25:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 20; f (d?c&&e:0, 1);
+	__tst.wm	__main_end - 8  /* d */
+	__bfalse	.LL26
+	__tst.wm	__main_end - 6  /* c */
+	__bfalse	.LL27
+	__tst.wm	__main_end - 10  /* e */
+.LL27:
+	__bool
+	__bra		.LL28
+.LL26:
+	__ld.wi		0
+.LL28:
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL29
+	__call		_abort
+.LL29:
+.LL30:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 21; f (d=c&&e,   1);
+	__tst.wm	__main_end - 6  /* c */
+	__bfalse	.LL31
+	__tst.wm	__main_end - 10  /* e */
+.LL31:
+	__bool
+	__st.wm		__main_end - 8  /* d */
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL32
+	__call		_abort
+.LL32:
+.LL33:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 22; f (d*=c&&e,  1);
+	__ld.wm		__main_end - 8  /* d */
+	__push.wr
+	__tst.wm	__main_end - 6  /* c */
+	__bfalse	.LL34
+	__tst.wm	__main_end - 10  /* e */
+.LL34:
+	__bool
+	__mul.wt
+	__st.wm		__main_end - 8  /* d */
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL35
+	__call		_abort
+.LL35:
+.LL36:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 23; f (d%=c&&e,  0);
+	__ld.wm		__main_end - 8  /* d */
+	__push.wr
+	__tst.wm	__main_end - 6  /* c */
+	__bfalse	.LL37
+	__tst.wm	__main_end - 10  /* e */
+.LL37:
+	__bool
+	__smod.wt
+	__st.wm		__main_end - 8  /* d */
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL38
+	__call		_abort
+.LL38:
+.LL39:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 24; f (d+=c&&e,  1);
+	__tst.wm	__main_end - 6  /* c */
+	__bfalse	.LL40
+	__tst.wm	__main_end - 10  /* e */
+.LL40:
+	__bool
+	__add.wm	__main_end - 8  /* d */
+	__st.wm		__main_end - 8  /* d */
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL41
+	__call		_abort
+.LL41:
+.LL42:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 25; f (d-=c&&e,  0);
+	__tst.wm	__main_end - 6  /* c */
+	__bfalse	.LL43
+	__tst.wm	__main_end - 10  /* e */
+.LL43:
+	__bool
+	__isub.wm	__main_end - 8  /* d */
+	__st.wm		__main_end - 8  /* d */
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL44
+	__call		_abort
+.LL44:
+.LL45:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 26; f (d||c||e,  1);
+	__tst.wm	__main_end - 8  /* d */
+	__btrue		.LL46
+	__tst.wm	__main_end - 6  /* c */
+.LL46:
+	__btrue		.LL47
+	__tst.wm	__main_end - 10  /* e */
+.LL47:
+	__bool
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL48
+	__call		_abort
+.LL48:
+.LL49:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 27; f (d?c||e:0, 0);
+	__tst.wm	__main_end - 8  /* d */
+	__bfalse	.LL50
+	__tst.wm	__main_end - 6  /* c */
+	__btrue		.LL51
+	__tst.wm	__main_end - 10  /* e */
+.LL51:
+	__bool
+	__bra		.LL52
+.LL50:
+	__ld.wi		0
+.LL52:
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL53
+	__call		_abort
+.LL53:
+.LL54:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 28; f (d=c||e,   1);
+	__tst.wm	__main_end - 6  /* c */
+	__btrue		.LL55
+	__tst.wm	__main_end - 10  /* e */
+.LL55:
+	__bool
+	__st.wm		__main_end - 8  /* d */
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL56
+	__call		_abort
+.LL56:
+.LL57:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 29; f (d*=c||e,  1);
+	__ld.wm		__main_end - 8  /* d */
+	__push.wr
+	__tst.wm	__main_end - 6  /* c */
+	__btrue		.LL58
+	__tst.wm	__main_end - 10  /* e */
+.LL58:
+	__bool
+	__mul.wt
+	__st.wm		__main_end - 8  /* d */
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL59
+	__call		_abort
+.LL59:
+.LL60:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 30; f (d%=c||e,  0);
+	__ld.wm		__main_end - 8  /* d */
+	__push.wr
+	__tst.wm	__main_end - 6  /* c */
+	__btrue		.LL61
+	__tst.wm	__main_end - 10  /* e */
+.LL61:
+	__bool
+	__smod.wt
+	__st.wm		__main_end - 8  /* d */
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL62
+	__call		_abort
+.LL62:
+.LL63:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 31; f (d+=c||e,  1);
+	__tst.wm	__main_end - 6  /* c */
+	__btrue		.LL64
+	__tst.wm	__main_end - 10  /* e */
+.LL64:
+	__bool
+	__add.wm	__main_end - 8  /* d */
+	__st.wm		__main_end - 8  /* d */
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL65
+	__call		_abort
+.LL65:
+.LL66:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 32; f (d-=c||e,  0);
+	__tst.wm	__main_end - 6  /* c */
+	__btrue		.LL67
+	__tst.wm	__main_end - 10  /* e */
+.LL67:
+	__bool
+	__isub.wm	__main_end - 8  /* d */
+	__st.wm		__main_end - 8  /* d */
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* value */
+	__neq_w.ws	0  /* expect */
+	__bfalse	.LL68
+	__call		_abort
+.LL68:
+.LL69:
+	__modsp		4
+
+	.dbg	line,	"tests/20000511-1.c", 33; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000511-1.c", 34; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    10  _main
+;
+; 10 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       136    136    10  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 10, 136, 136
+__main_end	=	__overlay_frames + 10
+	.endm
@@ -0,0 +1,176 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000605-2.c", 1; struct F { int i; };
+	.dbg	line,	"tests/20000605-2.c", 3; void f1(struct F *x, struct F *y)
+	.dbg	line,	"tests/20000605-2.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f1
+	__enter		_f1
+
+	.dbg	line,	"tests/20000605-2.c", 5; int timeout;
+
+	.dbg	line,	"tests/20000605-2.c", 6; timeout = 0;
+	__st.wmiq	0, __f1_end - 2  /* timeout */
+
+	.dbg	line,	"tests/20000605-2.c", 7; for (; x->i < y->i ; x->i++)
+.LL3:
+	__ld.ws		2  /* x */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* y */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__slt_w.wt
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__ld.ws		2  /* x */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	1
+	__st.wt
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20000605-2.c", 8; if (++timeout > 5)
+	__incld.wm	__f1_end - 2  /* timeout */
+	__sgt_w.wi	5
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20000605-2.c", 9; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000605-2.c", 10; }
+.LL7	.alias		.LL4
+	__bra		.LL4
+.LL6:
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__f1_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000605-2.c", 12; main()
+	.dbg	line,	"tests/20000605-2.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000605-2.c", 14; struct F x, y;
+
+	.dbg	line,	"tests/20000605-2.c", 15; x.i = 0;
+	__st.wmiq	0, __main_end - 2  /* x */
+
+	.dbg	line,	"tests/20000605-2.c", 16; y.i = 1;
+	__st.wmiq	1, __main_end - 4  /* y */
+
+	.dbg	line,	"tests/20000605-2.c", 17; f1 (&x, &y);
+	__ld.wi		__main_end - 2  /* x */
+	__pusharg.wr
+	__ld.wi		__main_end - 4  /* y */
+	__pusharg.wr
+	__call		_f1
+
+	.dbg	line,	"tests/20000605-2.c", 18; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000605-2.c", 19; }
+.LL8:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 8, 8
+__main_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,199 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000706-3.c", 1; extern void abort(void);
+	.dbg	line,	"tests/20000706-3.c", 2; extern void exit(int);
+	.dbg	line,	"tests/20000706-3.c", 4; int c;
+	.dbg	line,	"tests/20000706-3.c", 6; void baz(int *p)
+	.dbg	line,	"tests/20000706-3.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_baz
+	__enter		_baz
+
+	.dbg	line,	"tests/20000706-3.c", 8; c = *p;
+	__ld.ws		0  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_c
+
+	.dbg	line,	"tests/20000706-3.c", 9; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000706-3.c", 11; void bar(int b)
+	.dbg	line,	"tests/20000706-3.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20000706-3.c", 13; if (c != 1 || b != 2)
+	__ld.wm		_c
+	__neq_w.wi	1
+	__btrue		.LL5
+	__ld.ws		0  /* b */
+	__neq_w.wi	2
+.LL5:
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20000706-3.c", 14; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20000706-3.c", 15; }
+.LL4:
+.LL3:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000706-3.c", 17; void foo(int a, int b)
+	.dbg	line,	"tests/20000706-3.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20000706-3.c", 19; baz(&a);
+	__lea.s		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_c
+.LL7:
+	__modsp		2
+
+	.dbg	line,	"tests/20000706-3.c", 20; bar(b);
+	__ld.ws		0  /* b */
+	__pusharg.wr
+	__ld.wm		_c
+	__neq_w.wi	1
+	__btrue		.LL8
+	__ld.ws		0  /* b */
+	__neq_w.wi	2
+.LL8:
+	__bfalse	.LL9
+	__call		_abort
+.LL9:
+.LL10:
+	__modsp		2
+
+	.dbg	line,	"tests/20000706-3.c", 21; }
+.LL6:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000706-3.c", 23; int main()
+	.dbg	line,	"tests/20000706-3.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000706-3.c", 25; foo(1, 2);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20000706-3.c", 26; exit(0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000706-3.c", 27; }
+.LL11:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:7
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     2  c
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_c, 2, 8, 8
+	.endm
@@ -0,0 +1,528 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000715-1.c", 1; void abort(void);
+	.dbg	line,	"tests/20000715-1.c", 2; void exit(int);
+	.dbg	line,	"tests/20000715-1.c", 4; void
+	.dbg	line,	"tests/20000715-1.c", 5; test1(void)
+	.dbg	line,	"tests/20000715-1.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"tests/20000715-1.c", 7; int x, y;
+
+	.dbg	line,	"tests/20000715-1.c", 8; x = 3;
+	__st.wmiq	3, __test1_end - 2  /* x */
+
+	.dbg	line,	"tests/20000715-1.c", 9; y = 2;
+	__st.wmiq	2, __test1_end - 4  /* y */
+
+	.dbg	line,	"tests/20000715-1.c", 11; if ((x < y ? x++ : y++) != 2)
+	__ld.wm		__test1_end - 2  /* x */
+	__slt_w.wm	__test1_end - 4  /* y */
+	__bfalse	.LL4
+	__ldinc.wm	__test1_end - 2  /* x */
+	__bra		.LL5
+.LL4:
+	__ldinc.wm	__test1_end - 4  /* y */
+.LL5:
+	__neq_w.wi	2
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20000715-1.c", 12; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 14; if (x != 3)
+.LL3:
+	__ld.wm		__test1_end - 2  /* x */
+	__neq_w.wi	3
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20000715-1.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 17; if (y != 3)
+.LL6:
+	__ld.wm		__test1_end - 4  /* y */
+	__neq_w.wi	3
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20000715-1.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 19; }
+.LL7:
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__test1_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000715-1.c", 21; void
+	.dbg	line,	"tests/20000715-1.c", 22; test2(void)
+	.dbg	line,	"tests/20000715-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"tests/20000715-1.c", 24; int x, y, z;
+
+	.dbg	line,	"tests/20000715-1.c", 25; x = 3;
+	__st.wmiq	3, __test2_end - 2  /* x */
+
+	.dbg	line,	"tests/20000715-1.c", 26; y = 2;
+	__st.wmiq	2, __test2_end - 4  /* y */
+
+	.dbg	line,	"tests/20000715-1.c", 28; z = (x < y) ? x++ : y++;
+	__ld.wm		__test2_end - 2  /* x */
+	__slt_w.wm	__test2_end - 4  /* y */
+	__bfalse	.LL9
+	__ldinc.wm	__test2_end - 2  /* x */
+	__bra		.LL10
+.LL9:
+	__ldinc.wm	__test2_end - 4  /* y */
+.LL10:
+	__st.wmq	__test2_end - 6  /* z */
+
+	.dbg	line,	"tests/20000715-1.c", 29; if (z != 2)
+	__neq_w.wi	2
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/20000715-1.c", 30; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 32; if (x != 3)
+.LL11:
+	__ld.wm		__test2_end - 2  /* x */
+	__neq_w.wi	3
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/20000715-1.c", 33; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 35; if (y != 3)
+.LL12:
+	__ld.wm		__test2_end - 4  /* y */
+	__neq_w.wi	3
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/20000715-1.c", 36; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 37; }
+.LL13:
+.LL8:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__test2_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000715-1.c", 39; void
+	.dbg	line,	"tests/20000715-1.c", 40; test3(void)
+	.dbg	line,	"tests/20000715-1.c", 41; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3
+	__enter		_test3
+
+	.dbg	line,	"tests/20000715-1.c", 42; int x, y, xx, yy;
+
+	.dbg	line,	"tests/20000715-1.c", 43; x = 3; y = 2;
+	__st.wmiq	3, __test3_end - 2  /* x */
+	__st.wmiq	2, __test3_end - 4  /* y */
+
+	.dbg	line,	"tests/20000715-1.c", 44; xx = 3; yy = 2;
+	__st.wmiq	3, __test3_end - 6  /* xx */
+	__st.wmiq	2, __test3_end - 8  /* yy */
+
+	.dbg	line,	"tests/20000715-1.c", 46; if ((xx < yy ? x++ : y++) != 2)
+	__ld.wm		__test3_end - 6  /* xx */
+	__slt_w.wm	__test3_end - 8  /* yy */
+	__bfalse	.LL16
+	__ldinc.wm	__test3_end - 2  /* x */
+	__bra		.LL17
+.LL16:
+	__ldinc.wm	__test3_end - 4  /* y */
+.LL17:
+	__neq_w.wi	2
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/20000715-1.c", 47; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 49; if (x != 3)
+.LL15:
+	__ld.wm		__test3_end - 2  /* x */
+	__neq_w.wi	3
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/20000715-1.c", 50; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 52; if (y != 3)
+.LL18:
+	__ld.wm		__test3_end - 4  /* y */
+	__neq_w.wi	3
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/20000715-1.c", 53; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 54; }
+.LL19:
+.LL14:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__test3_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000715-1.c", 56; int x, y;
+	.dbg	line,	"tests/20000715-1.c", 58; static void
+	.dbg	line,	"tests/20000715-1.c", 59; init_xy(void)
+	.dbg	line,	"tests/20000715-1.c", 60; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_init_xy
+	__enter		_init_xy
+
+	.dbg	line,	"tests/20000715-1.c", 61; x = 3;
+	__st.wmiq	3, _x
+
+	.dbg	line,	"tests/20000715-1.c", 62; y = 2;
+	__st.wmiq	2, _y
+
+	.dbg	line,	"tests/20000715-1.c", 63; }
+.LL20:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000715-1.c", 65; void
+	.dbg	line,	"tests/20000715-1.c", 66; test4(void)
+	.dbg	line,	"tests/20000715-1.c", 67; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4
+	__enter		_test4
+
+	.dbg	line,	"tests/20000715-1.c", 68; init_xy();
+	__st.wmiq	3, _x
+	__st.wmiq	2, _y
+.LL22:
+
+	.dbg	line,	"tests/20000715-1.c", 69; if ((x < y ? x++ : y++) != 2)
+	__ld.wm		_x
+	__slt_w.wm	_y
+	__bfalse	.LL24
+	__ldinc.wm	_x
+	__bra		.LL25
+.LL24:
+	__ldinc.wm	_y
+.LL25:
+	__neq_w.wi	2
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/20000715-1.c", 70; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 72; if (x != 3)
+.LL23:
+	__ld.wm		_x
+	__neq_w.wi	3
+	__bfalse	.LL26
+
+	.dbg	line,	"tests/20000715-1.c", 73; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 75; if (y != 3)
+.LL26:
+	__ld.wm		_y
+	__neq_w.wi	3
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/20000715-1.c", 76; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 77; }
+.LL27:
+.LL21:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000715-1.c", 79; void
+	.dbg	line,	"tests/20000715-1.c", 80; test5(void)
+	.dbg	line,	"tests/20000715-1.c", 81; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5
+	__enter		_test5
+
+	.dbg	line,	"tests/20000715-1.c", 82; int z;
+
+	.dbg	line,	"tests/20000715-1.c", 84; init_xy();
+	__st.wmiq	3, _x
+	__st.wmiq	2, _y
+.LL29:
+
+	.dbg	line,	"tests/20000715-1.c", 85; z = (x < y) ? x++ : y++;
+	__ld.wm		_x
+	__slt_w.wm	_y
+	__bfalse	.LL30
+	__ldinc.wm	_x
+	__bra		.LL31
+.LL30:
+	__ldinc.wm	_y
+.LL31:
+	__st.wmq	__test5_end - 2  /* z */
+
+	.dbg	line,	"tests/20000715-1.c", 86; if (z != 2)
+	__neq_w.wi	2
+	__bfalse	.LL32
+
+	.dbg	line,	"tests/20000715-1.c", 87; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 89; if (x != 3)
+.LL32:
+	__ld.wm		_x
+	__neq_w.wi	3
+	__bfalse	.LL33
+
+	.dbg	line,	"tests/20000715-1.c", 90; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 92; if (y != 3)
+.LL33:
+	__ld.wm		_y
+	__neq_w.wi	3
+	__bfalse	.LL34
+
+	.dbg	line,	"tests/20000715-1.c", 93; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 94; }
+.LL34:
+.LL28:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000715-1.c", 96; void
+	.dbg	line,	"tests/20000715-1.c", 97; test6(void)
+	.dbg	line,	"tests/20000715-1.c", 98; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6
+	__enter		_test6
+
+	.dbg	line,	"tests/20000715-1.c", 99; int xx, yy;
+
+	.dbg	line,	"tests/20000715-1.c", 100; int z;
+
+	.dbg	line,	"tests/20000715-1.c", 101; xx = 3; yy = 2;
+	__st.wmiq	3, __test6_end - 2  /* xx */
+
+	.dbg	line,	"tests/20000715-1.c", 103; init_xy();
+	__st.wmiq	3, _x
+	__st.wmiq	2, _y
+.LL36:
+
+	.dbg	line,	"tests/20000715-1.c", 104; z = (xx < y) ? x++ : y++;
+	__ld.wm		__test6_end - 2  /* xx */
+	__slt_w.wm	_y
+	__bfalse	.LL37
+	__ldinc.wm	_x
+	__bra		.LL38
+.LL37:
+	__ldinc.wm	_y
+.LL38:
+	__st.wmq	__test6_end - 6  /* z */
+
+	.dbg	line,	"tests/20000715-1.c", 105; if (z != 2)
+	__neq_w.wi	2
+	__bfalse	.LL39
+
+	.dbg	line,	"tests/20000715-1.c", 106; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 108; if (x != 3)
+.LL39:
+	__ld.wm		_x
+	__neq_w.wi	3
+	__bfalse	.LL40
+
+	.dbg	line,	"tests/20000715-1.c", 109; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 111; if (y != 3)
+.LL40:
+	__ld.wm		_y
+	__neq_w.wi	3
+	__bfalse	.LL41
+
+	.dbg	line,	"tests/20000715-1.c", 112; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000715-1.c", 113; }
+.LL41:
+.LL35:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000715-1.c", 115; int
+	.dbg	line,	"tests/20000715-1.c", 116; main(){
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000715-1.c", 117; test1 ();
+	__call		_test1
+
+	.dbg	line,	"tests/20000715-1.c", 118; test2 ();
+	__call		_test2
+
+	.dbg	line,	"tests/20000715-1.c", 119; test3 ();
+	__call		_test3
+
+	.dbg	line,	"tests/20000715-1.c", 120; test4 ();
+	__call		_test4
+
+	.dbg	line,	"tests/20000715-1.c", 121; test5 ();
+	__call		_test5
+
+	.dbg	line,	"tests/20000715-1.c", 122; test6 ();
+	__call		_test6
+
+	.dbg	line,	"tests/20000715-1.c", 123; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000715-1.c", 124; }
+.LL42:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 8
+leaf_needs	.set	8
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:12
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _test5
+;       0     6  _test6
+;
+; 6 bytes overlaid, 2 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        32     32     2  y
+;        30     30     2  x
+;        14     14     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_y, 2, 32, 32
+	auto_zp_var	_x, 2, 30, 30
+	auto_zp_var	__overlay_frames, 6, 14, 14
+__test5_end	=	__overlay_frames + 2
+__test6_end	=	__overlay_frames + 6
+	.endm
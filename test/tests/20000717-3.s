@@ -0,0 +1,194 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000717-3.c", 1; const int c = -1;
+	.dbg	line,	"tests/20000717-3.c", 3; foo (p)
+	.dbg	line,	"tests/20000717-3.c", 4; int *p;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20000717-3.c", 5; {
+
+	.dbg	line,	"tests/20000717-3.c", 6; int x;
+
+	.dbg	line,	"tests/20000717-3.c", 7; int a;
+
+	.dbg	line,	"tests/20000717-3.c", 9; a = p[0];
+	__ld.ws		0  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__foo_end - 4  /* a */
+
+	.dbg	line,	"tests/20000717-3.c", 10; x = a + 5;
+	__add.wi	5
+	__st.wmq	__foo_end - 2  /* x */
+
+	.dbg	line,	"tests/20000717-3.c", 11; a = c;
+	__ld.wi		-1
+	__st.wmq	__foo_end - 4  /* a */
+
+	.dbg	line,	"tests/20000717-3.c", 12; p[0] = x - 15;
+	__ld.ws		0  /* p */
+	__push.wr
+	__ld.wm		__foo_end - 2  /* x */
+	__sub.wi	15
+	__st.wtq
+
+	.dbg	line,	"tests/20000717-3.c", 13; return a;
+	__ld.wm		__foo_end - 4  /* a */
+.LL2:
+
+	.dbg	line,	"tests/20000717-3.c", 14; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000717-3.c", 16; int main()
+	.dbg	line,	"tests/20000717-3.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000717-3.c", 18; int b, a;
+
+	.dbg	line,	"tests/20000717-3.c", 19; b = 1;
+	__st.wmiq	1, __main_end - 2  /* b */
+
+	.dbg	line,	"tests/20000717-3.c", 20; a = foo(&b);
+	__ld.wi		__main_end - 2  /* b */
+	__pusharg.wr
+	__ld.ws		0  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__foo_end - 4  /* a */
+	__add.wi	5
+	__st.wmq	__foo_end - 2  /* x */
+	__ld.wi		-1
+	__st.wmq	__foo_end - 4  /* a */
+	__ld.ws		0  /* p */
+	__push.wr
+	__ld.wm		__foo_end - 2  /* x */
+	__sub.wi	15
+	__st.wtq
+	__ld.wm		__foo_end - 4  /* a */
+.LL4:
+	__modsp		2
+	__st.wmq	__main_end - 4  /* a */
+
+	.dbg	line,	"tests/20000717-3.c", 22; if (a != -1 || b != (1 + 5 - 15))
+	__neq_w.wi	-1
+	__btrue		.LL6
+	__ld.wm		__main_end - 2  /* b */
+	__neq_w.wi	-9
+.LL6:
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20000717-3.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000717-3.c", 25; exit (0);
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000717-3.c", 26; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_c:
+		dw	-1
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:2
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 10, 10
+__main_end	=	__overlay_frames + 4
+	.endm
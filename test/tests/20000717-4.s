@@ -0,0 +1,119 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000717-4.c", 1; /* Extracted from gas.  Incorrectly generated non-pic code at -O0 for
+	.dbg	line,	"tests/20000717-4.c", 2; IA-64, which produces linker errors on some operating systems.  */
+	.dbg	line,	"tests/20000717-4.c", 4; struct
+	.dbg	line,	"tests/20000717-4.c", 5; {
+	.dbg	line,	"tests/20000717-4.c", 6; int offset;
+	.dbg	line,	"tests/20000717-4.c", 7; struct slot
+	.dbg	line,	"tests/20000717-4.c", 8; {
+	.dbg	line,	"tests/20000717-4.c", 9; int field[6];
+	.dbg	line,	"tests/20000717-4.c", 10; }
+	.dbg	line,	"tests/20000717-4.c", 11; slot[4];
+	.dbg	line,	"tests/20000717-4.c", 12; } s;
+	.dbg	line,	"tests/20000717-4.c", 14; int
+	.dbg	line,	"tests/20000717-4.c", 15; x ()
+	.dbg	line,	"tests/20000717-4.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_x
+	__enter		_x
+
+	.dbg	line,	"tests/20000717-4.c", 17; int toggle = 0;
+	__st.wmiq	0, __x_end - 2  /* toggle */
+
+	.dbg	line,	"tests/20000717-4.c", 18; int r; r = s.slot[0].field[!toggle];
+	__boolnot.wm	__x_end - 2  /* toggle */
+	__asl.wr
+	__add.wi	_s + 2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__x_end - 4  /* r */
+
+	.dbg	line,	"tests/20000717-4.c", 19; return r;
+.LL2:
+
+	.dbg	line,	"tests/20000717-4.c", 20; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__x_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000717-4.c", 22; int
+	.dbg	line,	"tests/20000717-4.c", 23; main ()
+	.dbg	line,	"tests/20000717-4.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000717-4.c", 25; return 0;
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/20000717-4.c", 26; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_s:
+		ds	50
+
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
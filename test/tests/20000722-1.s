@@ -0,0 +1,178 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000722-1.c", 1; struct s { char *p; int t; };
+	.dbg	line,	"tests/20000722-1.c", 3; extern void bar (void);
+	.dbg	line,	"tests/20000722-1.c", 4; extern void foo (struct s *);
+	.dbg	line,	"tests/20000722-1.c", 6; int main(void)
+	.dbg	line,	"tests/20000722-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000722-1.c", 8; bar ();
+	__call		_bar
+
+	.dbg	line,	"tests/20000722-1.c", 9; bar ();
+	__call		_bar
+
+	.dbg	line,	"tests/20000722-1.c", 10; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000722-1.c", 11; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000722-1.c", 13; void 
+	.dbg	line,	"tests/20000722-1.c", 14; bar (void)
+	.dbg	line,	"tests/20000722-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20000722-1.c", 16; struct s ss;
+
+	.dbg	line,	"tests/20000722-1.c", 17; ss.p = "hi";
+	__ld.wi		__const1+0
+	__st.wmq	__bar_end - 4  /* ss */
+
+	.dbg	line,	"tests/20000722-1.c", 18; ss.t = 1;
+	__st.wmiq	1, __bar_end - 4 + 2  /* ss */
+
+	.dbg	line,	"tests/20000722-1.c", 19; foo (&ss);
+	__ld.wi		__bar_end - 4  /* ss */
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20000722-1.c", 20; }
+.LL3:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000722-1.c", 22; void foo (struct s *p)
+	.dbg	line,	"tests/20000722-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20000722-1.c", 24; if (p->t != 1)
+	__ld.ws		0  /* p */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	1
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20000722-1.c", 25; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20000722-1.c", 26; p->t = 2;
+.LL5:
+	__ld.ws		0  /* p */
+	__add.wi	2
+	__push.wr
+	__ld.wi		2
+	__st.wtq
+
+	.dbg	line,	"tests/20000722-1.c", 27; }
+.LL4:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'h','i',$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:3
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _bar
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 6, 6
+__bar_end	=	__overlay_frames + 4
+	.endm
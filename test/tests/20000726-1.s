@@ -0,0 +1,178 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000726-1.c", 1; void adjust_xy (short *, short *);
+	.dbg	line,	"tests/20000726-1.c", 3; struct adjust_template
+	.dbg	line,	"tests/20000726-1.c", 4; {
+	.dbg	line,	"tests/20000726-1.c", 5; short kx_x;
+	.dbg	line,	"tests/20000726-1.c", 6; short kx_y;
+	.dbg	line,	"tests/20000726-1.c", 7; short kx;
+	.dbg	line,	"tests/20000726-1.c", 8; short kz;
+	.dbg	line,	"tests/20000726-1.c", 9; };
+	.dbg	line,	"tests/20000726-1.c", 11; static struct adjust_template adjust = {0, 0, 1, 1};
+	.dbg	line,	"tests/20000726-1.c", 13; main ()
+	.dbg	line,	"tests/20000726-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000726-1.c", 15; short x = 1, y = 1;
+	__st.wmiq	1, __main_end - 2  /* x */
+	__st.wmiq	1, __main_end - 4  /* y */
+
+	.dbg	line,	"tests/20000726-1.c", 17; adjust_xy (&x, &y);
+	__ld.wi		__main_end - 2  /* x */
+	__pusharg.wr
+	__ld.wi		__main_end - 4  /* y */
+	__pusharg.wr
+	__call		_adjust_xy
+
+	.dbg	line,	"tests/20000726-1.c", 19; if (x != 1)
+	__ld.wm		__main_end - 2  /* x */
+	__neq_w.wi	1
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20000726-1.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000726-1.c", 22; exit (0);
+.LL3:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000726-1.c", 23; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000726-1.c", 25; void
+	.dbg	line,	"tests/20000726-1.c", 26; adjust_xy (x, y)
+	.dbg	line,	"tests/20000726-1.c", 27; short  *x;
+	.dbg	line,	"tests/20000726-1.c", 28; short  *y;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_adjust_xy
+	__enter		_adjust_xy
+
+	.dbg	line,	"tests/20000726-1.c", 29; {
+
+	.dbg	line,	"tests/20000726-1.c", 30; *x = adjust.kx_x * *x + adjust.kx_y * *y + adjust.kx;
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.wm		_adjust
+	__push.wr
+	__ld.ws		2  /* x */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__mul.wt
+	__push.wr
+	__ld.wm		_adjust + 2
+	__push.wr
+	__ld.ws		0  /* y */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__mul.wt
+	__add.wt
+	__add.wm	_adjust + 4
+	__st.wtq
+
+	.dbg	line,	"tests/20000726-1.c", 31; }
+.LL4:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.xdata
+_adjust:
+		ds	8
+
+	.xinit
+		dw	0
+		dw	0
+		dw	1
+		dw	1
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 10, 10
+__main_end	=	__overlay_frames + 4
+	.endm
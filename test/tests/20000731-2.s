@@ -0,0 +1,125 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000731-2.c", 1; int
+	.dbg	line,	"tests/20000731-2.c", 2; main()
+	.dbg	line,	"tests/20000731-2.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000731-2.c", 4; int i, j;
+
+	.dbg	line,	"tests/20000731-2.c", 5; i = 1;
+	__st.wmiq	1, __main_end - 2  /* i */
+
+	.dbg	line,	"tests/20000731-2.c", 6; j = 0;
+	__st.wmiq	0, __main_end - 4  /* j */
+
+	.dbg	line,	"tests/20000731-2.c", 8; while (i != 1024 || j <= 0) {
+.LL3:
+	__ld.wm		__main_end - 2  /* i */
+	__neq_w.wi	1024
+	__btrue		.LL5
+	__ld.wm		__main_end - 4  /* j */
+	__sle_w.wi	0
+.LL5:
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20000731-2.c", 9; i *= 2;
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	1
+	__st.wmq	__main_end - 2  /* i */
+
+	.dbg	line,	"tests/20000731-2.c", 10; ++ j;
+	__inc.wmq	__main_end - 4  /* j */
+
+	.dbg	line,	"tests/20000731-2.c", 11; }
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/20000731-2.c", 13; if (j != 10)
+	__ld.wm		__main_end - 4  /* j */
+	__neq_w.wi	10
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20000731-2.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000731-2.c", 16; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000731-2.c", 17; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,237 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000801-1.c", 1; extern void abort(void);
+	.dbg	line,	"tests/20000801-1.c", 2; extern void exit(int);
+	.dbg	line,	"tests/20000801-1.c", 4; void
+	.dbg	line,	"tests/20000801-1.c", 5; foo (char *bp, unsigned int n)
+	.dbg	line,	"tests/20000801-1.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20000801-1.c", 7; register char c;
+
+	.dbg	line,	"tests/20000801-1.c", 8; register char *ep;
+
+	.dbg	line,	"tests/20000801-1.c", 9; register char *sp;
+
+	.dbg	line,	"tests/20000801-1.c", 10; ep = bp + n;
+	__ld.ws		2  /* bp */
+	__add.ws	0  /* n */
+	__st.wmq	__foo_end - 3  /* ep */
+
+	.dbg	line,	"tests/20000801-1.c", 12; while (bp < ep)
+.LL3:
+	__ld.ws		2  /* bp */
+	__ult_w.wm	__foo_end - 3  /* ep */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20000801-1.c", 13; {
+
+	.dbg	line,	"tests/20000801-1.c", 14; sp = bp + 3;
+	__ld.ws		2  /* bp */
+	__add.wi	3
+	__st.wmq	__foo_end - 5  /* sp */
+
+	.dbg	line,	"tests/20000801-1.c", 15; c = *sp;
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__st.umq	__foo_end - 1  /* c */
+
+	.dbg	line,	"tests/20000801-1.c", 16; *sp = *bp;
+	__ld.wm		__foo_end - 5  /* sp */
+	__push.wr
+	__ld.ws		2  /* bp */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__st.utq
+
+	.dbg	line,	"tests/20000801-1.c", 17; *bp++ = c;
+	__ldinc.ws	2  /* bp */
+	__push.wr
+	__ld.um		__foo_end - 1  /* c */
+	__st.utq
+
+	.dbg	line,	"tests/20000801-1.c", 18; sp = bp + 1;
+	__ld.ws		2  /* bp */
+	__add.wi	1
+	__st.wmq	__foo_end - 5  /* sp */
+
+	.dbg	line,	"tests/20000801-1.c", 19; c = *sp;
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__st.umq	__foo_end - 1  /* c */
+
+	.dbg	line,	"tests/20000801-1.c", 20; *sp = *bp;
+	__ld.wm		__foo_end - 5  /* sp */
+	__push.wr
+	__ld.ws		2  /* bp */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__st.utq
+
+	.dbg	line,	"tests/20000801-1.c", 21; *bp++ = c;
+	__ldinc.ws	2  /* bp */
+	__push.wr
+	__ld.um		__foo_end - 1  /* c */
+	__st.utq
+
+	.dbg	line,	"tests/20000801-1.c", 22; bp += 2;
+	__add_st.wsiq	2, 2  /* bp */
+
+	.dbg	line,	"tests/20000801-1.c", 23; }
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/20000801-1.c", 24; }
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000801-1.c", 26; int main(void)
+	.dbg	line,	"tests/20000801-1.c", 27; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000801-1.c", 28; int one;
+
+	.dbg	line,	"tests/20000801-1.c", 29; one = 1;
+	__st.wmiq	1, __main_end - 2  /* one */
+
+	.dbg	line,	"tests/20000801-1.c", 31; if (sizeof(int) != 4 * sizeof(char))
+	__ld.wi		2
+	__neq_w.wi	4
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20000801-1.c", 32; exit(0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000801-1.c", 34; foo(/*(char *)*/&one, sizeof(one));
+.LL6:
+	__ld.wi		__main_end - 2  /* one */
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20000801-1.c", 35; foo(/*(char *)*/&one, sizeof(one));
+	__ld.wi		__main_end - 2  /* one */
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20000801-1.c", 37; if (one != 1)
+	__ld.wm		__main_end - 2  /* one */
+	__neq_w.wi	1
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20000801-1.c", 38; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20000801-1.c", 40; exit(0);
+.LL7:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000801-1.c", 41; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 5
+leaf_needs	.set	5
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 8, 8
+__main_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,235 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000801-2.c", 1; extern void abort(void);
+	.dbg	line,	"tests/20000801-2.c", 2; extern void exit(int);
+	.dbg	line,	"tests/20000801-2.c", 3; int bar(void);
+	.dbg	line,	"tests/20000801-2.c", 4; int baz(void);
+	.dbg	line,	"tests/20000801-2.c", 6; struct foo {
+	.dbg	line,	"tests/20000801-2.c", 7; struct foo *next;
+	.dbg	line,	"tests/20000801-2.c", 8; };
+	.dbg	line,	"tests/20000801-2.c", 10; struct foo *test(struct foo *node)
+	.dbg	line,	"tests/20000801-2.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/20000801-2.c", 12; while (node) {
+.LL3:
+	__tst.ws	0  /* node */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20000801-2.c", 13; if (bar() && !baz())
+	__call		_bar
+	__tst.wr
+	__bfalse	.LL6
+	__call		_baz
+	__not.wr
+.LL6:
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20000801-2.c", 14; break;
+	__bra		.LL4
+
+	.dbg	line,	"tests/20000801-2.c", 15; node = node->next;
+.LL5:
+	__ld.ws		0  /* node */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wsq	0  /* node */
+
+	.dbg	line,	"tests/20000801-2.c", 16; }
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/20000801-2.c", 17; return node;
+	__ld.ws		0  /* node */
+.LL2:
+
+	.dbg	line,	"tests/20000801-2.c", 18; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000801-2.c", 20; int bar (void)
+	.dbg	line,	"tests/20000801-2.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20000801-2.c", 22; return 0;
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/20000801-2.c", 23; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000801-2.c", 25; int baz (void)
+	.dbg	line,	"tests/20000801-2.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_baz
+	__enter		_baz
+
+	.dbg	line,	"tests/20000801-2.c", 27; return 0;
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"tests/20000801-2.c", 28; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000801-2.c", 30; int main(void)
+	.dbg	line,	"tests/20000801-2.c", 31; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000801-2.c", 32; struct foo a, b, *c;
+
+	.dbg	line,	"tests/20000801-2.c", 34; a.next = &b;
+	__ld.wi		__main_end - 4  /* b */
+	__st.wmq	__main_end - 2  /* a */
+
+	.dbg	line,	"tests/20000801-2.c", 35; b.next = (struct foo *)0;
+	__st.wmiq	0, __main_end - 4  /* b */
+
+	.dbg	line,	"tests/20000801-2.c", 36; c = test(&a);
+	__ld.wi		__main_end - 2  /* a */
+	__pusharg.wr
+.LL10:
+	__tst.ws	0  /* node */
+	__bfalse	.LL13
+	__call		_bar
+	__tst.wr
+	__bfalse	.LL11
+	__call		_baz
+	__not.wr
+.LL11:
+	__bfalse	.LL12
+	__bra		.LL13
+.LL12:
+	__ld.ws		0  /* node */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wsq	0  /* node */
+	__bra		.LL10
+.LL13:
+	__ld.ws		0  /* node */
+.LL14:
+	__modsp		2
+	__st.wmq	__main_end - 6  /* c */
+
+	.dbg	line,	"tests/20000801-2.c", 37; if (c)
+	__tst.wm	__main_end - 6  /* c */
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/20000801-2.c", 38; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20000801-2.c", 39; exit (0);
+.LL15:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000801-2.c", 40; }
+.LL9:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _main
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        12     12     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 12, 12
+__main_end	=	__overlay_frames + 6
+	.endm
@@ -0,0 +1,278 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000818-1.c", 1; /* Copyright (C) 2000  Free Software Foundation.
+	.dbg	line,	"tests/20000818-1.c", 3; by Manfred Hollstein <manfredh@redhat.com>  */
+	.dbg	line,	"tests/20000818-1.c", 5; void *temporary_obstack;
+	.dbg	line,	"tests/20000818-1.c", 7; static int input (void);
+	.dbg	line,	"tests/20000818-1.c", 8; static int ISALNUM (int ch);
+	.dbg	line,	"tests/20000818-1.c", 9; static void obstack_1grow (void */***/ptr, int ch);
+	.dbg	line,	"tests/20000818-1.c", 11; int yylex (void);
+	.dbg	line,	"tests/20000818-1.c", 12; int main (void);
+	.dbg	line,	"tests/20000818-1.c", 14; int main (void)
+	.dbg	line,	"tests/20000818-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000818-1.c", 16; int ch;
+
+	.dbg	line,	"tests/20000818-1.c", 17; ch = yylex ();
+	__call		_yylex
+
+	.dbg	line,	"tests/20000818-1.c", 19; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000818-1.c", 20; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000818-1.c", 22; int yylex (void)
+	.dbg	line,	"tests/20000818-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_yylex
+	__enter		_yylex
+
+	.dbg	line,	"tests/20000818-1.c", 24; int ch;
+
+	.dbg	line,	"tests/20000818-1.c", 26; #ifndef WORK_AROUND
+
+	.dbg	line,	"tests/20000818-1.c", 27; for (;;)
+.LL4:
+.LL5:
+.LL6:
+
+	.dbg	line,	"tests/20000818-1.c", 28; {
+
+	.dbg	line,	"tests/20000818-1.c", 29; ch = input ();
+	__call		_input
+	__st.wmq	__yylex_end - 2  /* ch */
+
+	.dbg	line,	"tests/20000818-1.c", 30; if (ISALNUM (ch))
+	__pusharg.wr
+	__call		_ISALNUM
+	__tst.wr
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20000818-1.c", 31; obstack_1grow (&temporary_obstack, ch);
+	__ld.wi		_temporary_obstack
+	__pusharg.wr
+	__ld.wm		__yylex_end - 2  /* ch */
+	__pusharg.wr
+	__call		_obstack_1grow
+
+	.dbg	line,	"tests/20000818-1.c", 32; else if (ch != '_')
+	__bra		.LL9
+.LL8:
+	__ld.wm		__yylex_end - 2  /* ch */
+	__neq_w.wi	95
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/20000818-1.c", 33; break;
+	__bra		.LL7
+
+	.dbg	line,	"tests/20000818-1.c", 34; }
+.LL10	.alias		.LL6
+.LL9	.alias		.LL6
+.LL7:
+
+	.dbg	line,	"tests/20000818-1.c", 35; #else
+
+	.dbg	line,	"tests/20000818-1.c", 36; do
+
+	.dbg	line,	"tests/20000818-1.c", 37; {
+
+	.dbg	line,	"tests/20000818-1.c", 38; ch = input ();
+
+	.dbg	line,	"tests/20000818-1.c", 39; if (ISALNUM (ch))
+
+	.dbg	line,	"tests/20000818-1.c", 40; obstack_1grow (&temporary_obstack, ch);
+
+	.dbg	line,	"tests/20000818-1.c", 41; } while (ch == '_');
+
+	.dbg	line,	"tests/20000818-1.c", 42; #endif
+
+	.dbg	line,	"tests/20000818-1.c", 44; return ch;
+	__ld.wm		__yylex_end - 2  /* ch */
+.LL3:
+
+	.dbg	line,	"tests/20000818-1.c", 45; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000818-1.c", 47; static int input (void)
+	.dbg	line,	"tests/20000818-1.c", 48; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_input
+	__enter		_input
+
+	.dbg	line,	"tests/20000818-1.c", 49; return 0;
+	__ld.wi		0
+.LL11:
+
+	.dbg	line,	"tests/20000818-1.c", 50; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000818-1.c", 52; static int ISALNUM (int ch)
+	.dbg	line,	"tests/20000818-1.c", 53; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ISALNUM
+	__enter		_ISALNUM
+
+	.dbg	line,	"tests/20000818-1.c", 54; return ((ch >= 'A' && ch <= 'Z')
+	__ld.ws		0  /* ch */
+	__sge_w.wi	65
+	__bfalse	.LL13
+	__ld.ws		0  /* ch */
+	__sle_w.wi	90
+.LL13:
+	__btrue		.LL14
+
+	.dbg	line,	"tests/20000818-1.c", 55; || (ch >= 'a' && ch <= 'z')
+	__ld.ws		0  /* ch */
+	__sge_w.wi	97
+	__bfalse	.LL15
+	__ld.ws		0  /* ch */
+	__sle_w.wi	122
+.LL15:
+.LL14:
+
+	.dbg	line,	"tests/20000818-1.c", 56; || (ch >= '0' && ch <= '0'));
+	__btrue		.LL16
+	__ld.ws		0  /* ch */
+	__sge_w.wi	48
+	__bfalse	.LL17
+	__ld.ws		0  /* ch */
+	__sle_w.wi	48
+.LL17:
+.LL16:
+.LL12:
+	__bool
+
+	.dbg	line,	"tests/20000818-1.c", 57; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000818-1.c", 59; static void obstack_1grow (void */***/ptr, int ch)
+	.dbg	line,	"tests/20000818-1.c", 60; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_obstack_1grow
+	__enter		_obstack_1grow
+
+	.dbg	line,	"tests/20000818-1.c", 61; }
+.LL18:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:7
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;       2     2  _yylex
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        68     12     4  overlaid locals
+;        16      2     2  temporary_obstack
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 12, 68
+__main_end	=	__overlay_frames + 2
+__yylex_end	=	__overlay_frames + 4
+	auto_zp_var	_temporary_obstack, 2, 2, 16
+	.endm
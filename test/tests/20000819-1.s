@@ -0,0 +1,149 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000819-1.c", 1; const int a[2] = { 2, 0 };
+	.dbg	line,	"tests/20000819-1.c", 3; void foo(int *sp, int cnt)
+	.dbg	line,	"tests/20000819-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20000819-1.c", 5; int *p, *top;
+
+	.dbg	line,	"tests/20000819-1.c", 7; top = sp; sp -= cnt;
+	__ld.ws		2  /* sp */
+	__st.wmq	__foo_end - 4  /* top */
+	__ld.ws		0  /* cnt */
+	__asl.wr
+	__isub_st.wsq	2  /* sp */
+
+	.dbg	line,	"tests/20000819-1.c", 9; for(p = sp; p <= top; p++)
+	__ld.ws		2  /* sp */
+	__st.wmq	__foo_end - 2  /* p */
+.LL3:
+	__ld.wm		__foo_end - 2  /* p */
+	__ule_w.wm	__foo_end - 4  /* top */
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__ld.wm		__foo_end - 2  /* p */
+	__add.wi	2
+	__st.wm		__foo_end - 2  /* p */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20000819-1.c", 10; if (*p < 2) exit(0);
+	__ld.wm		__foo_end - 2  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__slt_w.wi	2
+	__bfalse	.LL7
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000819-1.c", 11; }
+.LL7	.alias		.LL4
+	__bra		.LL4
+.LL6:
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000819-1.c", 13; int main()
+	.dbg	line,	"tests/20000819-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000819-1.c", 15; foo(a + 1, 1);
+	__ld.wi		_a + 2
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20000819-1.c", 16; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20000819-1.c", 17; }
+.LL8:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_a:
+		dw	2
+		dw	0
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:4
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,203 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20000910-1.c", 1; /* Copyright (C) 2000  Free Software Foundation  */
+	.dbg	line,	"tests/20000910-1.c", 2; /* by Alexandre Oliva <aoliva@redhat.com> */
+	.dbg	line,	"tests/20000910-1.c", 4; /* #include <stdlib.h> */
+	.dbg	line,	"tests/20000910-1.c", 6; void bar (int);
+	.dbg	line,	"tests/20000910-1.c", 7; void foo (int *);
+	.dbg	line,	"tests/20000910-1.c", 9; const int a[] = { 0, 1, 2 };
+	.dbg	line,	"tests/20000910-1.c", 10; int main () {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20000910-1.c", 11; int *i;
+
+	.dbg	line,	"tests/20000910-1.c", 12; i = &a[sizeof(a)/sizeof(/* *a */ int)];
+	__ld.wi		_a + 6
+	__st.wmq	__main_end - 2  /* i */
+
+	.dbg	line,	"tests/20000910-1.c", 13; 
+
+	.dbg	line,	"tests/20000910-1.c", 14; while (i-- > a)
+.LL3:
+	__ld.wm		__main_end - 2  /* i */
+	__sub.wi	2
+	__st.wm		__main_end - 2  /* i */
+	__add.wi	2
+	__ugt_w.wi	_a
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20000910-1.c", 15; foo (i);
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__call		_foo
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/20000910-1.c", 17; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20000910-1.c", 18; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20000910-1.c", 20; void baz (int, int);
+	.dbg	line,	"tests/20000910-1.c", 22; void bar (int i) { baz (i, i); }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+	__ld.ws		0  /* i */
+	__pusharg.wr
+	__ld.ws		2  /* i */
+	__pusharg.wr
+	__call		_baz
+.LL5:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000910-1.c", 23; void foo (int *i) { bar (*i); }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+	__ld.ws		0  /* i */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__pusharg.wr
+	__ld.ws		0  /* i */
+	__pusharg.wr
+	__ld.ws		2  /* i */
+	__pusharg.wr
+	__call		_baz
+.LL7:
+	__modsp		2
+.LL6:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20000910-1.c", 25; void baz (int i, int j) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_baz
+	__enter		_baz
+
+	.dbg	line,	"tests/20000910-1.c", 26; if (i != j)
+	__ld.ws		2  /* i */
+	__neq_w.ws	0  /* j */
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20000910-1.c", 27; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20000910-1.c", 28; }
+.LL9:
+.LL8:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_a:
+		dw	0
+		dw	1
+		dw	2
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:6
+;	global pool:7
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        34      6     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 34
+__main_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,137 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20001009-1.c", 1; int a,b;
+	.dbg	line,	"tests/20001009-1.c", 2; main()
+	.dbg	line,	"tests/20001009-1.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20001009-1.c", 4; int c=-2;
+	__st.wmiq	-2, __main_end - 2  /* c */
+
+	.dbg	line,	"tests/20001009-1.c", 5; int d=0xfe;
+	__st.wmiq	254, __main_end - 4  /* d */
+
+	.dbg	line,	"tests/20001009-1.c", 6; int e,f;e=a&1;
+	__ld.wm		_a
+	__and.wi	1
+	__st.wmq	__main_end - 6  /* e */
+
+	.dbg	line,	"tests/20001009-1.c", 7; /*int*/ f=b&2;
+	__ld.wm		_b
+	__and.wi	2
+	__st.wmq	__main_end - 8  /* f */
+
+	.dbg	line,	"tests/20001009-1.c", 8; if ((char)(c|(e&f)) == (char)d)
+	__ld.wm		__main_end - 6  /* e */
+	__and.wm	__main_end - 8  /* f */
+	__or.wm		__main_end - 2  /* c */
+	__ext.ur
+	__push.wr
+	__ld.wm		__main_end - 4  /* d */
+	__ext.ur
+	__equ_w.wt
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20001009-1.c", 9; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/20001009-1.c", 10; else
+.LL3:
+
+	.dbg	line,	"tests/20001009-1.c", 11; abort();
+	__call		_abort
+.LL4:
+
+	.dbg	line,	"tests/20001009-1.c", 12; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 8
+leaf_needs	.set	8
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         2      2     2  a
+;         2      2     2  b
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_a, 2, 2, 2
+	auto_zp_var	_b, 2, 2, 2
+	.endm
@@ -0,0 +1,186 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20001009-2.c", 1; int b;//=1;
+	.dbg	line,	"tests/20001009-2.c", 2; int foo()
+	.dbg	line,	"tests/20001009-2.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20001009-2.c", 4; int a;
+
+	.dbg	line,	"tests/20001009-2.c", 5; int c;
+
+	.dbg	line,	"tests/20001009-2.c", 6; a=0xff;
+	__st.wmiq	255, __foo_end - 2  /* a */
+
+	.dbg	line,	"tests/20001009-2.c", 7; for (;b;b--)
+.LL3:
+	__tst.wm	_b
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__dec.wmq	_b
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20001009-2.c", 8; {
+
+	.dbg	line,	"tests/20001009-2.c", 9; c=1;
+
+	.dbg	line,	"tests/20001009-2.c", 10; //asm(""::"r"(c));
+
+	.dbg	line,	"tests/20001009-2.c", 11; c=(signed char)a;
+	__ld.wm		__foo_end - 2  /* a */
+	__ext.br
+	__st.wmq	__foo_end - 4  /* c */
+
+	.dbg	line,	"tests/20001009-2.c", 12; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20001009-2.c", 13; if (c!=-1)
+	__ld.wm		__foo_end - 4  /* c */
+	__neq_w.wi	-1
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20001009-2.c", 14; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20001009-2.c", 15; return c;
+.LL7:
+	__ld.wm		__foo_end - 4  /* c */
+.LL2:
+
+	.dbg	line,	"tests/20001009-2.c", 16; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20001009-2.c", 17; int main()
+	.dbg	line,	"tests/20001009-2.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20001009-2.c", 19; b=1;
+	__st.wmiq	1, _b
+
+	.dbg	line,	"tests/20001009-2.c", 20; foo();
+	__st.wmiq	255, __foo_end - 2  /* a */
+.LL9:
+	__tst.wm	_b
+	__btrue		.LL11
+	__bra		.LL12
+.LL10:
+	__dec.wmq	_b
+	__bra		.LL9
+.LL11:
+	__ld.wm		__foo_end - 2  /* a */
+	__ext.br
+	__st.wmq	__foo_end - 4  /* c */
+	__bra		.LL10
+.LL12:
+	__ld.wm		__foo_end - 4  /* c */
+	__neq_w.wi	-1
+	__bfalse	.LL13
+	__call		_abort
+.LL13:
+	__ld.wm		__foo_end - 4  /* c */
+.LL14:
+
+	.dbg	line,	"tests/20001009-2.c", 21; return 0;
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"tests/20001009-2.c", 22; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        54     12     2  b
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_b, 2, 12, 54
+	.endm
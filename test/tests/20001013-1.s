@@ -0,0 +1,160 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20001013-1.c", 1; struct x {
+	.dbg	line,	"tests/20001013-1.c", 2; int a, b;
+	.dbg	line,	"tests/20001013-1.c", 3; };
+	.dbg	line,	"tests/20001013-1.c", 4; struct x z;
+	.dbg	line,	"tests/20001013-1.c", 6; int foo(struct x *p, int y)
+	.dbg	line,	"tests/20001013-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20001013-1.c", 8; if ((y & 0xff) != y || -p->b >= p->a)
+	__ld.ws		0  /* y */
+	__and.wi	255
+	__neq_w.ws	0  /* y */
+	__btrue		.LL4
+	__ld.ws		2  /* p */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neg.wr
+	__push.wr
+	__ld.ws		2  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__sge_w.wt
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20001013-1.c", 9; return 1;
+	__ld.wi		1
+	__bra		.LL2
+
+	.dbg	line,	"tests/20001013-1.c", 10; return 0;
+.LL3:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20001013-1.c", 11; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20001013-1.c", 13; main()
+	.dbg	line,	"tests/20001013-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20001013-1.c", 15; z.a = -4028;
+	__st.wmiq	-4028, _z
+
+	.dbg	line,	"tests/20001013-1.c", 16; z.b = 4096;
+	__st.wmiq	4096, _z + 2
+
+	.dbg	line,	"tests/20001013-1.c", 17; if (foo (&z, 10))
+	__ld.wi		_z
+	__pusharg.wr
+	__ld.wi		10
+	__pusharg.wr
+	__call		_foo
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20001013-1.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20001013-1.c", 19; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20001013-1.c", 20; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     4  z
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_z, 4, 6, 6
+	.endm
@@ -0,0 +1,133 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20001027-1.c", 1; int x;
+	.dbg	line,	"tests/20001027-1.c", 2; int *p;
+	.dbg	line,	"tests/20001027-1.c", 4; int main()
+	.dbg	line,	"tests/20001027-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20001027-1.c", 6; int i;
+
+	.dbg	line,	"tests/20001027-1.c", 7; p = &x;
+	__ld.wi		_x
+	__st.wmq	_p
+
+	.dbg	line,	"tests/20001027-1.c", 8; i=0;
+	__st.wmiq	0, __main_end - 2  /* i */
+
+	.dbg	line,	"tests/20001027-1.c", 9; x=1;
+	__st.wmiq	1, _x
+
+	.dbg	line,	"tests/20001027-1.c", 10; p[i]=2;
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wr
+	__add.wm	_p
+	__push.wr
+	__ld.wi		2
+	__st.wtq
+
+	.dbg	line,	"tests/20001027-1.c", 11; if (x != 2)
+	__ld.wm		_x
+	__neq_w.wi	2
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20001027-1.c", 12; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20001027-1.c", 13; exit (0);
+.LL3:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20001027-1.c", 14; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  x
+;         4      4     2  p
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_x, 2, 6, 6
+	auto_zp_var	_p, 2, 4, 4
+	.endm
@@ -0,0 +1,148 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20001130-1.c", 1; static /* inline */ int bar(void) { return 1; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+	__ld.wi		1
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20001130-1.c", 2; static int mem[3];
+	.dbg	line,	"tests/20001130-1.c", 4; static int foo(int x)
+	.dbg	line,	"tests/20001130-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20001130-1.c", 6; if (x != 0)
+	__tst.ws	0  /* x */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20001130-1.c", 7; return x;
+	__ld.ws		0  /* x */
+	__bra		.LL3
+
+	.dbg	line,	"tests/20001130-1.c", 9; mem[x++] = foo(bar());
+.LL4:
+	__ldinc.ws	0  /* x */
+	__index.wr	_mem
+	__ld.wi		1
+.LL5:
+	__pusharg.wr
+	__call		_foo
+	__st.watq	_mem
+
+	.dbg	line,	"tests/20001130-1.c", 11; if (x != 1)
+	__ld.ws		0  /* x */
+	__neq_w.wi	1
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20001130-1.c", 12; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20001130-1.c", 14; return 0;
+.LL6:
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/20001130-1.c", 15; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20001130-1.c", 17; int main()
+	.dbg	line,	"tests/20001130-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20001130-1.c", 19; foo(0);
+	__ld.wi		0
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20001130-1.c", 20; return 0;
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/20001130-1.c", 21; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_mem:
+		ds	6
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,207 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20001130-2.c", 1; static const int which_alternative = 3;
+	.dbg	line,	"tests/20001130-2.c", 3; static const char *i960_output_ldconst (void);
+	.dbg	line,	"tests/20001130-2.c", 5; static const char *
+	.dbg	line,	"tests/20001130-2.c", 6; output_25 (void)
+	.dbg	line,	"tests/20001130-2.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_output_25
+	__enter		_output_25
+
+	.dbg	line,	"tests/20001130-2.c", 8; switch (which_alternative)
+	__ld.wi		3
+	__bra		.LL3
+
+	.dbg	line,	"tests/20001130-2.c", 9; {
+
+	.dbg	line,	"tests/20001130-2.c", 10; case 0:
+.LL5:
+	__case		0
+
+	.dbg	line,	"tests/20001130-2.c", 11; return "mov	%1,%0";
+	__ld.wi		__const1+0
+	__bra		.LL2
+
+	.dbg	line,	"tests/20001130-2.c", 12; case 1:
+.LL6:
+	__case		1
+
+	.dbg	line,	"tests/20001130-2.c", 13; return i960_output_ldconst ();
+	__call		_i960_output_ldconst
+	__bra		.LL2
+
+	.dbg	line,	"tests/20001130-2.c", 14; case 2:
+.LL7:
+	__case		2
+
+	.dbg	line,	"tests/20001130-2.c", 15; return "ld	%1,%0";
+	__ld.wi		__const1+10
+	__bra		.LL2
+
+	.dbg	line,	"tests/20001130-2.c", 16; case 3:
+.LL8:
+	__case		3
+
+	.dbg	line,	"tests/20001130-2.c", 17; return "st	%1,%0";      
+	__ld.wi		__const1+19
+	__bra		.LL2
+
+	.dbg	line,	"tests/20001130-2.c", 18; }
+.LL3:
+	__switch_r.wr	0, 3
+
+!table:		dw	.LL5, .LL6, .LL7, .LL8
+		dw	.LL4
+.LL4:
+
+	.dbg	line,	"tests/20001130-2.c", 19; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20001130-2.c", 21; static const char *i960_output_ldconst (void)
+	.dbg	line,	"tests/20001130-2.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_i960_output_ldconst
+	__enter		_i960_output_ldconst
+
+	.dbg	line,	"tests/20001130-2.c", 23; return "foo";
+	__ld.wi		__const1+28
+.LL9:
+
+	.dbg	line,	"tests/20001130-2.c", 24; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20001130-2.c", 25; int main(void)
+	.dbg	line,	"tests/20001130-2.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20001130-2.c", 27; /* const */ char *s;
+
+	.dbg	line,	"tests/20001130-2.c", 28; s = output_25 () ;
+	__call		_output_25
+	__st.wmq	__main_end - 2  /* s */
+
+	.dbg	line,	"tests/20001130-2.c", 29; if (s[0] != 's')
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	115
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/20001130-2.c", 30; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20001130-2.c", 31; exit (0);
+.LL11:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20001130-2.c", 32; }
+.LL10:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'm','o','v',$09,'%','1',',','%'
+		db	'0',$00,'l','d',$09,'%','1',','
+		db	'%','0',$00,'s','t',$09,'%','1'
+		db	',','%','0',$00,'f','o','o',$00
+_which_alternative:
+		dw	3
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:32
+;	constant pool:2
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 4, 4
+__main_end	=	__overlay_frames + 2
+	.endm
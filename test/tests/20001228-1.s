@@ -0,0 +1,159 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:06 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20001228-1.c", 1; union ut {
+	.dbg	line,	"tests/20001228-1.c", 2; char a[2];
+	.dbg	line,	"tests/20001228-1.c", 3; unsigned int b;
+	.dbg	line,	"tests/20001228-1.c", 4; };
+	.dbg	line,	"tests/20001228-1.c", 5; int foo1(void)
+	.dbg	line,	"tests/20001228-1.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo1
+	__enter		_foo1
+
+	.dbg	line,	"tests/20001228-1.c", 7; union ut u;
+
+	.dbg	line,	"tests/20001228-1.c", 8; u.b = 0x01;
+	__st.wmiq	1, __foo1_end - 2  /* u */
+
+	.dbg	line,	"tests/20001228-1.c", 9; return u.a[0];
+	__ld.um		__foo1_end - 2  /* u */
+.LL2:
+
+	.dbg	line,	"tests/20001228-1.c", 10; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo1_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20001228-1.c", 12; union ut2 {
+	.dbg	line,	"tests/20001228-1.c", 13; char a[/* sizeof (unsigned) */ 2];
+	.dbg	line,	"tests/20001228-1.c", 14; unsigned b;
+	.dbg	line,	"tests/20001228-1.c", 15; };
+	.dbg	line,	"tests/20001228-1.c", 17; int foo2(void)
+	.dbg	line,	"tests/20001228-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo2
+	__enter		_foo2
+
+	.dbg	line,	"tests/20001228-1.c", 19; /* volatile */ union ut2 u;
+
+	.dbg	line,	"tests/20001228-1.c", 20; u.b = 0x01;
+	__st.wmiq	1, __foo2_end - 2  /* u */
+
+	.dbg	line,	"tests/20001228-1.c", 21; return u.a[0];
+	__ld.um		__foo2_end - 2  /* u */
+.LL3:
+
+	.dbg	line,	"tests/20001228-1.c", 22; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo2_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20001228-1.c", 24; int main(void)
+	.dbg	line,	"tests/20001228-1.c", 25; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20001228-1.c", 26; if (foo1() != foo2())
+	__st.wmiq	1, __foo1_end - 2  /* u */
+	__ld.um		__foo1_end - 2  /* u */
+.LL6:
+	__push.wr
+	__st.wmiq	1, __foo2_end - 2  /* u */
+	__ld.um		__foo2_end - 2  /* u */
+.LL7:
+	__neq_w.wt
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20001228-1.c", 27; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20001228-1.c", 28; exit (0);
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20001228-1.c", 29; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
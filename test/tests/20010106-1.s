@@ -0,0 +1,185 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010106-1.c", 1; /* Copyright 2001 Free Software Foundation
+	.dbg	line,	"tests/20010106-1.c", 2; Contributed by Alexandre Oliva <aoliva@redhat.com> */
+	.dbg	line,	"tests/20010106-1.c", 4; int f(int i) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/20010106-1.c", 5; switch (i)
+	__ld.ws		0  /* i */
+	__bra		.LL3
+
+	.dbg	line,	"tests/20010106-1.c", 6; {
+
+	.dbg	line,	"tests/20010106-1.c", 7; case -2:
+.LL5:
+	__case		-2
+
+	.dbg	line,	"tests/20010106-1.c", 8; return 33;
+	__ld.wi		33
+	__bra		.LL2
+
+	.dbg	line,	"tests/20010106-1.c", 9; case -1:
+.LL6:
+	__case		-1
+
+	.dbg	line,	"tests/20010106-1.c", 10; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/20010106-1.c", 11; case 0:
+.LL7:
+	__case		0
+
+	.dbg	line,	"tests/20010106-1.c", 12; return 7;
+	__ld.wi		7
+	__bra		.LL2
+
+	.dbg	line,	"tests/20010106-1.c", 13; case 1:
+.LL8:
+	__case		1
+
+	.dbg	line,	"tests/20010106-1.c", 14; return 4;
+	__ld.wi		4
+	__bra		.LL2
+
+	.dbg	line,	"tests/20010106-1.c", 15; case 2:
+.LL9:
+	__case		2
+
+	.dbg	line,	"tests/20010106-1.c", 16; return 3;
+	__ld.wi		3
+	__bra		.LL2
+
+	.dbg	line,	"tests/20010106-1.c", 17; case 3:
+.LL10:
+	__case		3
+
+	.dbg	line,	"tests/20010106-1.c", 18; return 15;
+	__ld.wi		15
+	__bra		.LL2
+
+	.dbg	line,	"tests/20010106-1.c", 19; case 4:
+.LL11:
+	__case		4
+
+	.dbg	line,	"tests/20010106-1.c", 20; return 9;
+	__ld.wi		9
+	__bra		.LL2
+
+	.dbg	line,	"tests/20010106-1.c", 21; default:
+.LL12:
+	__default
+
+	.dbg	line,	"tests/20010106-1.c", 22; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010106-1.c", 23; }
+	__bra		.LL4
+.LL3:
+	__switch_r.wr	-2, 4
+
+!table:		dw	.LL5, .LL6, .LL7, .LL8, .LL9, .LL10, .LL11
+		dw	.LL12
+.LL4:
+
+	.dbg	line,	"tests/20010106-1.c", 24; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010106-1.c", 26; int main() {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010106-1.c", 27; if (f(-1))
+	__ld.wi		-1
+	__pusharg.wr
+	__call		_f
+	__tst.wr
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/20010106-1.c", 28; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010106-1.c", 29; exit (0);
+.LL14:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010106-1.c", 30; }
+.LL13:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,192 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010116-1.c", 1; /* Distilled from optimization/863.  */
+	.dbg	line,	"tests/20010116-1.c", 3; extern void abort (void);
+	.dbg	line,	"tests/20010116-1.c", 4; extern void exit (int);
+	.dbg	line,	"tests/20010116-1.c", 5; extern void ok (int);
+	.dbg	line,	"tests/20010116-1.c", 7; struct Data
+	.dbg	line,	"tests/20010116-1.c", 8; {
+	.dbg	line,	"tests/20010116-1.c", 9; int x, y, z;
+	.dbg	line,	"tests/20010116-1.c", 10; };
+	.dbg	line,	"tests/20010116-1.c", 12; void find (struct Data *first, struct Data *last)
+	.dbg	line,	"tests/20010116-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_find
+	__enter		_find
+
+	.dbg	line,	"tests/20010116-1.c", 14; int i;
+
+	.dbg	line,	"tests/20010116-1.c", 15; for (i = (last - first) >> 2; i > 0; --i)
+	__ld.ws		0  /* last */
+	__sub.ws	2  /* first */
+	__udiv.wi	6
+	__asr.wi	2
+	__st.wmq	__find_end - 2  /* i */
+.LL3:
+	__ld.wm		__find_end - 2  /* i */
+	__sgt_w.wi	0
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__dec.wmq	__find_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20010116-1.c", 16; ok(i);
+	__ld.wm		__find_end - 2  /* i */
+	__pusharg.wr
+	__call		_ok
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20010116-1.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010116-1.c", 18; }
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20010116-1.c", 20; void ok(int i)
+	.dbg	line,	"tests/20010116-1.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ok
+	__enter		_ok
+
+	.dbg	line,	"tests/20010116-1.c", 22; if (i != 1)
+	__ld.ws		0  /* i */
+	__neq_w.wi	1
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20010116-1.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010116-1.c", 24; exit (0);
+.LL8:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010116-1.c", 25; }
+.LL7:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010116-1.c", 27; int
+	.dbg	line,	"tests/20010116-1.c", 28; main ()
+	.dbg	line,	"tests/20010116-1.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010116-1.c", 30; struct Data DataList[4];
+
+	.dbg	line,	"tests/20010116-1.c", 31; find (DataList + 0, DataList + 4);
+	__ld.wi		__main_end - 24  /* DataList */
+	__pusharg.wr
+	__ld.wi		__main_end - 24 + 24  /* DataList */
+	__pusharg.wr
+	__call		_find
+
+	.dbg	line,	"tests/20010116-1.c", 32; }
+.LL9:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;      24     2  _find
+;       0    24  _main
+;
+; 26 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        68     12    26  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 26, 12, 68
+__find_end	=	__overlay_frames + 26
+__main_end	=	__overlay_frames + 24
+	.endm
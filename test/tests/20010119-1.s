@@ -0,0 +1,116 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010119-1.c", 1; #ifdef __OPTIMIZE__
+	.dbg	line,	"tests/20010119-1.c", 2; extern void undef (void);
+	.dbg	line,	"tests/20010119-1.c", 4; void bar (unsigned x) { }
+	.dbg	line,	"tests/20010119-1.c", 5; void baz (unsigned x) { }
+	.dbg	line,	"tests/20010119-1.c", 7; extern inline void foo (int a, int b)
+	.dbg	line,	"tests/20010119-1.c", 8; {
+	.dbg	line,	"tests/20010119-1.c", 9; int c = 0;
+	.dbg	line,	"tests/20010119-1.c", 10; while (c++ < b)
+	.dbg	line,	"tests/20010119-1.c", 11; (__builtin_constant_p (a) ? ((a) > 20000 ? undef () : bar (a)) : baz (a));
+	.dbg	line,	"tests/20010119-1.c", 12; }
+	.dbg	line,	"tests/20010119-1.c", 13; #else
+	.dbg	line,	"tests/20010119-1.c", 14; void foo (int a, int b)
+	.dbg	line,	"tests/20010119-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20010119-1.c", 16; }
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010119-1.c", 17; #endif
+	.dbg	line,	"tests/20010119-1.c", 19; int main (void)
+	.dbg	line,	"tests/20010119-1.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010119-1.c", 21; foo(10, 100);
+	__ld.wi		10
+	__pusharg.wr
+	__ld.wi		100
+	__pusharg.wr
+.LL4:
+	__modsp		4
+
+	.dbg	line,	"tests/20010119-1.c", 22; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010119-1.c", 23; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,140 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010206-1.c", 1; int foo (void)
+	.dbg	line,	"tests/20010206-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20010206-1.c", 3; int i;
+
+	.dbg	line,	"tests/20010206-1.c", 4; //#line 1 "20010206-1.c"
+
+	.dbg	line,	"tests/20010206-1.c", 5; if (0) i = 1; else i
+	__ld.wi		0
+	__tst.wr
+	__bfalse	.LL3
+	__st.wmiq	1, __foo_end - 2  /* i */
+	__bra		.LL4
+.LL3:
+
+	.dbg	line,	"tests/20010206-1.c", 6; //#line 1 "20010206-1.c"
+
+	.dbg	line,	"tests/20010206-1.c", 7; = 26;
+	__st.wmiq	26, __foo_end - 2  /* i */
+.LL4:
+
+	.dbg	line,	"tests/20010206-1.c", 8; return i;
+	__ld.wm		__foo_end - 2  /* i */
+.LL2:
+
+	.dbg	line,	"tests/20010206-1.c", 9; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20010206-1.c", 11; int main ()
+	.dbg	line,	"tests/20010206-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010206-1.c", 13; if (foo () != 26)
+	__ld.wi		0
+	__tst.wr
+	__bfalse	.LL7
+	__st.wmiq	1, __foo_end - 2  /* i */
+	__bra		.LL8
+.LL7:
+	__st.wmiq	26, __foo_end - 2  /* i */
+.LL8:
+	__ld.wm		__foo_end - 2  /* i */
+.LL9:
+	__neq_w.wi	26
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20010206-1.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010206-1.c", 15; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010206-1.c", 16; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,137 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010221-1.c", 2; const int n = 2;
+	.dbg	line,	"tests/20010221-1.c", 4; main ()
+	.dbg	line,	"tests/20010221-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010221-1.c", 6; int i, x;
+
+	.dbg	line,	"tests/20010221-1.c", 7; x = 45;
+	__st.wmiq	45, __main_end - 4  /* x */
+
+	.dbg	line,	"tests/20010221-1.c", 9; for (i = 0; i < n; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL3:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	2
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20010221-1.c", 10; {
+
+	.dbg	line,	"tests/20010221-1.c", 11; if (i != 0)
+	__tst.wm	__main_end - 2  /* i */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20010221-1.c", 12; x = ( i > 0 ) ? i : 0;
+	__ld.wm		__main_end - 2  /* i */
+	__sgt_w.wi	0
+	__bfalse	.LL8
+	__ld.wm		__main_end - 2  /* i */
+	__bra		.LL9
+.LL8:
+	__ld.wi		0
+.LL9:
+	__st.wmq	__main_end - 4  /* x */
+
+	.dbg	line,	"tests/20010221-1.c", 13; }
+.LL7	.alias		.LL4
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20010221-1.c", 15; if (x != 1)
+	__ld.wm		__main_end - 4  /* x */
+	__neq_w.wi	1
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/20010221-1.c", 16; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010221-1.c", 17; exit (0);
+.LL10:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010221-1.c", 18; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_n:
+		dw	2
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:2
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,144 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010222-1.c", 1; const int a[2] = { 18, 6 };
+	.dbg	line,	"tests/20010222-1.c", 3; int main ()
+	.dbg	line,	"tests/20010222-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010222-1.c", 5; int b;
+
+	.dbg	line,	"tests/20010222-1.c", 6; b = (-3 * a[0] -3 * a[1]) / 12;
+	__ld.wm		_a
+	.if	FAST_MULTIPLY
+	__mul.wi	65533
+	.else
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	.endif
+	__push.wr
+	__ld.wm		_a + 2
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__sub.wt
+	__sdiv.wi	12
+	__st.wmq	__main_end - 2  /* b */
+
+	.dbg	line,	"tests/20010222-1.c", 7; if (b != -6)
+	__neq_w.wi	-6
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20010222-1.c", 8; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010222-1.c", 9; exit (0);
+.LL3:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010222-1.c", 10; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_a:
+		dw	18
+		dw	6
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:4
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,240 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010224-1.c", 1; extern void abort (void);
+	.dbg	line,	"tests/20010224-1.c", 3; typedef signed short int16_t;
+	.dbg	line,	"tests/20010224-1.c", 4; typedef unsigned short uint16_t;
+	.dbg	line,	"tests/20010224-1.c", 6; int16_t logadd (int16_t *a, int16_t *b);
+	.dbg	line,	"tests/20010224-1.c", 7; void ba_compute_psd (int16_t start);
+	.dbg	line,	"tests/20010224-1.c", 9; int16_t masktab[6] = { 1, 2, 3, 4, 5};
+	.dbg	line,	"tests/20010224-1.c", 10; int16_t psd[6] = { 50, 40, 30, 20, 10};
+	.dbg	line,	"tests/20010224-1.c", 11; int16_t bndpsd[6] = { 1, 2, 3, 4, 5};
+	.dbg	line,	"tests/20010224-1.c", 13; void ba_compute_psd (int16_t start)
+	.dbg	line,	"tests/20010224-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ba_compute_psd
+	__enter		_ba_compute_psd
+
+	.dbg	line,	"tests/20010224-1.c", 15; int i,j,k;
+
+	.dbg	line,	"tests/20010224-1.c", 16; int16_t lastbin = 4;
+	__st.wmiq	4, __ba_compute_psd_end - 8  /* lastbin */
+
+	.dbg	line,	"tests/20010224-1.c", 18; j = start; 
+	__ld.ws		0  /* start */
+	__st.wmq	__ba_compute_psd_end - 4  /* j */
+
+	.dbg	line,	"tests/20010224-1.c", 19; k = masktab[start]; 
+	__ld2x.wsq	0  /* start */
+	__ld.wax	_masktab
+	__st.wmq	__ba_compute_psd_end - 6  /* k */
+
+	.dbg	line,	"tests/20010224-1.c", 21; bndpsd[k] = psd[j]; 
+	__ld2x.wmq	__ba_compute_psd_end - 4  /* j */
+	__ld.wax	_psd
+	__ld2x.wm	__ba_compute_psd_end - 6  /* k */
+	__st.waxq	_bndpsd
+
+	.dbg	line,	"tests/20010224-1.c", 22; j++; 
+	__inc.wmq	__ba_compute_psd_end - 4  /* j */
+
+	.dbg	line,	"tests/20010224-1.c", 24; for (i = j; i < lastbin; i++) { 
+	__ld.wm		__ba_compute_psd_end - 4  /* j */
+	__st.wmq	__ba_compute_psd_end - 2  /* i */
+.LL3:
+	__ld.wm		__ba_compute_psd_end - 2  /* i */
+	__slt_w.wm	__ba_compute_psd_end - 8  /* lastbin */
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__ba_compute_psd_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20010224-1.c", 25; bndpsd[k] = logadd(&bndpsd[k], &psd[j]);
+	__ld.wm		__ba_compute_psd_end - 6  /* k */
+	__asl.wr
+	__add.wi	_bndpsd
+	__pusharg.wr
+	__ld.wm		__ba_compute_psd_end - 4  /* j */
+	__asl.wr
+	__add.wi	_psd
+	__pusharg.wr
+	__call		_logadd
+	__ld2x.wm	__ba_compute_psd_end - 6  /* k */
+	__st.waxq	_bndpsd
+
+	.dbg	line,	"tests/20010224-1.c", 26; j++; 
+	__inc.wmq	__ba_compute_psd_end - 4  /* j */
+
+	.dbg	line,	"tests/20010224-1.c", 27; } 
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20010224-1.c", 28; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20010224-1.c", 30; int16_t logadd (int16_t *a, int16_t *b)
+	.dbg	line,	"tests/20010224-1.c", 31; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_logadd
+	__enter		_logadd
+
+	.dbg	line,	"tests/20010224-1.c", 32; return *a + *b;
+	__ld.ws		2  /* a */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* b */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wt
+.LL7:
+
+	.dbg	line,	"tests/20010224-1.c", 33; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010224-1.c", 35; int main (void)
+	.dbg	line,	"tests/20010224-1.c", 36; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010224-1.c", 37; int i;
+
+	.dbg	line,	"tests/20010224-1.c", 39; ba_compute_psd (0);
+	__ld.wi		0
+	__pusharg.wr
+	__call		_ba_compute_psd
+
+	.dbg	line,	"tests/20010224-1.c", 41; if (bndpsd[1] != 140) exit(bndpsd[1]);//abort ();
+	__ld.wm		_bndpsd + 2
+	__neq_w.wi	140
+	__bfalse	.LL9
+	__ld.wm		_bndpsd + 2
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010224-1.c", 42; return 0;
+.LL9:
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"tests/20010224-1.c", 43; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20010224-1.c", 44; 
+	.dbg	clear
+
+	.xdata
+_masktab:
+		ds	12
+_psd:
+		ds	12
+_bndpsd:
+		ds	12
+
+	.xinit
+
+		dw	1,2,3,4,5,0
+
+		dw	50,40,30,20,10,0
+
+		dw	1,2,3,4,5,0
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       2     8  _ba_compute_psd
+;       0     2  _main
+;
+; 10 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       156     30    10  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 10, 30, 156
+__ba_compute_psd_end	=	__overlay_frames + 10
+__main_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,230 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010403-1.c", 1; void b (int *);
+	.dbg	line,	"tests/20010403-1.c", 2; void c (int, int);
+	.dbg	line,	"tests/20010403-1.c", 3; void d (int);
+	.dbg	line,	"tests/20010403-1.c", 5; int e;
+	.dbg	line,	"tests/20010403-1.c", 7; void a (int x, int y)
+	.dbg	line,	"tests/20010403-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_a
+	__enter		_a
+
+	.dbg	line,	"tests/20010403-1.c", 9; int f, z;
+
+	.dbg	line,	"tests/20010403-1.c", 10; f = x ? e : 0;
+	__tst.ws	2  /* x */
+	__bfalse	.LL3
+	__ld.wm		_e
+	__bra		.LL4
+.LL3:
+	__ld.wi		0
+.LL4:
+	__st.wmq	__a_end - 2  /* f */
+
+	.dbg	line,	"tests/20010403-1.c", 11; z = y;
+	__ld.ws		0  /* y */
+	__st.wmq	__a_end - 4  /* z */
+
+	.dbg	line,	"tests/20010403-1.c", 13; b (&y);
+	__lea.s		0  /* y */
+	__pusharg.wr
+	__call		_b
+
+	.dbg	line,	"tests/20010403-1.c", 14; c (z, y);
+	__ld.wm		__a_end - 4  /* z */
+	__pusharg.wr
+	__ld.ws		2  /* y */
+	__pusharg.wr
+	__call		_c
+
+	.dbg	line,	"tests/20010403-1.c", 15; d (f);
+	__ld.wm		__a_end - 2  /* f */
+	__pusharg.wr
+	__call		_d
+
+	.dbg	line,	"tests/20010403-1.c", 16; }
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20010403-1.c", 18; void b (int *y)
+	.dbg	line,	"tests/20010403-1.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_b
+	__enter		_b
+
+	.dbg	line,	"tests/20010403-1.c", 20; (*y)++;
+	__ld.ws		0  /* y */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	1
+	__st.wt
+
+	.dbg	line,	"tests/20010403-1.c", 21; }
+.LL5:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010403-1.c", 23; void c (int x, int y)
+	.dbg	line,	"tests/20010403-1.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_c
+	__enter		_c
+
+	.dbg	line,	"tests/20010403-1.c", 25; if (x == y)
+	__ld.ws		2  /* x */
+	__equ_w.ws	0  /* y */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20010403-1.c", 26; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010403-1.c", 27; }
+.LL7:
+.LL6:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010403-1.c", 29; void d (int x)
+	.dbg	line,	"tests/20010403-1.c", 30; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_d
+	__enter		_d
+
+	.dbg	line,	"tests/20010403-1.c", 31; }
+.LL8:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010403-1.c", 33; int main (void)
+	.dbg	line,	"tests/20010403-1.c", 34; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010403-1.c", 35; a (0, 0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_a
+
+	.dbg	line,	"tests/20010403-1.c", 36; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010403-1.c", 37; }
+.LL9:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _a
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     4  overlaid locals
+;         2      2     2  e
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 8, 8
+__a_end	=	__overlay_frames + 4
+	auto_zp_var	_e, 2, 2, 2
+	.endm
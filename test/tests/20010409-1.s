@@ -0,0 +1,375 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010409-1.c", 1; #include <string.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 3; #endif
+	.dbg	line,	"tests/20010409-1.c", 3; //typedef __SIZE_TYPE__ size_t;
+	.dbg	line,	"tests/20010409-1.c", 4; #define size_t unsigned int
+	.dbg	line,	"tests/20010409-1.c", 6; /*typedef*/ struct A_s {
+	.dbg	line,	"tests/20010409-1.c", 7; int a, b;
+	.dbg	line,	"tests/20010409-1.c", 8; };// A;
+	.dbg	line,	"tests/20010409-1.c", 9; #define A struct A_s
+	.dbg	line,	"tests/20010409-1.c", 11; /*typedef*/ struct B_s {
+	.dbg	line,	"tests/20010409-1.c", 12; struct A_s **a;
+	.dbg	line,	"tests/20010409-1.c", 13; int b;
+	.dbg	line,	"tests/20010409-1.c", 14; };// B;
+	.dbg	line,	"tests/20010409-1.c", 15; #define B struct B_s
+	.dbg	line,	"tests/20010409-1.c", 17; A *a;
+	.dbg	line,	"tests/20010409-1.c", 18; int b /*= 1*/, c;
+	.dbg	line,	"tests/20010409-1.c", 19; B d[1];
+	.dbg	line,	"tests/20010409-1.c", 21; void foo (A *x, const char *y, int z)
+	.dbg	line,	"tests/20010409-1.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20010409-1.c", 23; c = y[4] + z * 25;
+	__ld.ws		2  /* y */
+	__add.wi	4
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__push.wr
+	__ld.ws		0  /* z */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__add.wt
+	__st.wmq	_c
+
+	.dbg	line,	"tests/20010409-1.c", 24; }
+.LL2:
+	__modsp		6
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010409-1.c", 26; A *bar (const char *v, int w, int x, const char *y, int z)
+	.dbg	line,	"tests/20010409-1.c", 27; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20010409-1.c", 28; if (w)
+	__tst.ws	6  /* w */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20010409-1.c", 29; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010409-1.c", 30; exit (0);
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010409-1.c", 31; }
+.LL3:
+	__modsp		10
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010409-1.c", 33; void test (const char *x, int *y)
+	.dbg	line,	"tests/20010409-1.c", 34; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/20010409-1.c", 35; foo (d->a[d->b], "test", 200);
+	__ld.wm		_d + 2
+	__asl.wr
+	__add.wm	_d
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__pusharg.wr
+	__ld.wi		__const1+0
+	__pusharg.wr
+	__ld.wi		200
+	__pusharg.wr
+	__ld.ws		2  /* y */
+	__add.wi	4
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__push.wr
+	__ld.ws		0  /* z */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__add.wt
+	__st.wmq	_c
+.LL6:
+	__modsp		6
+
+	.dbg	line,	"tests/20010409-1.c", 36; d->a[d->b] = bar (x, b ? 0 : 65536, strlen (x), "test", 201);
+	__ld.wm		_d + 2
+	__asl.wr
+	__add.wm	_d
+	__push.wr
+	__ld.ws		2  /* x */
+	__pusharg.wr
+	__tst.wm	_b
+	__bfalse	.LL7
+	__ld.wi		0
+	__bra		.LL8
+.LL7:
+	__ld.wi		65536
+.LL8:
+	__pusharg.wr
+	__ld.ws		6  /* x */
+	__st.wmq	_bp
+	__call		_strlen.1
+	__pusharg.wr
+	__ld.wi		__const1+5
+	__pusharg.wr
+	__ld.wi		201
+	__pusharg.wr
+	__tst.ws	6  /* w */
+	__bfalse	.LL9
+	__call		_abort
+.LL9:
+	__ld.wi		0
+	__call		_exit.1
+.LL10:
+	__modsp		10
+	__st.wtq
+
+	.dbg	line,	"tests/20010409-1.c", 37; d->a[d->b]->a++;
+	__ld.wm		_d + 2
+	__asl.wr
+	__add.wm	_d
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	1
+	__st.wt
+
+	.dbg	line,	"tests/20010409-1.c", 38; if (y)
+	__tst.ws	0  /* y */
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/20010409-1.c", 39; d->a[d->b]->b = *y;
+	__ld.wm		_d + 2
+	__asl.wr
+	__add.wm	_d
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__push.wr
+	__ld.ws		0  /* y */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wtq
+
+	.dbg	line,	"tests/20010409-1.c", 40; }
+.LL11:
+.LL5:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010409-1.c", 42; int main ()
+	.dbg	line,	"tests/20010409-1.c", 43; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010409-1.c", 44; b = 1;
+	__st.wmiq	1, _b
+
+	.dbg	line,	"tests/20010409-1.c", 45; d->b = 0;
+	__st.wmiq	0, _d + 2
+
+	.dbg	line,	"tests/20010409-1.c", 46; d->a = &a;
+	__ld.wi		_a
+	__st.wmq	_d
+
+	.dbg	line,	"tests/20010409-1.c", 47; test ("", 0);
+	__ld.wi		__const1+10
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20010409-1.c", 48; }
+.LL12:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	't','e','s','t',$00,'t','e','s'
+		db	't',$00,$00
+
+	.bss
+_d:
+		ds	4
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:11
+;	constant pool:0
+;	global pool:27
+;	Macro pool:10
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  b
+;         4      4     2  c
+;         2      2     2  a
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_b, 2, 4, 4
+	auto_zp_var	_c, 2, 4, 4
+	auto_zp_var	_a, 2, 2, 2
+	.endm
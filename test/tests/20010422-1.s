@@ -0,0 +1,136 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010422-1.c", 1; unsigned int foo(unsigned int x)
+	.dbg	line,	"tests/20010422-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20010422-1.c", 3; if (x < 5)
+	__ld.ws		0  /* x */
+	__ult_w.wi	5
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20010422-1.c", 4; x = 4;
+	__st.wsiq	4, 0  /* x */
+
+	.dbg	line,	"tests/20010422-1.c", 5; else
+	__bra		.LL4
+.LL3:
+
+	.dbg	line,	"tests/20010422-1.c", 6; x = 8;
+	__st.wsiq	8, 0  /* x */
+.LL4:
+
+	.dbg	line,	"tests/20010422-1.c", 7; return x;
+	__ld.ws		0  /* x */
+.LL2:
+
+	.dbg	line,	"tests/20010422-1.c", 8; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010422-1.c", 10; int main(void)
+	.dbg	line,	"tests/20010422-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010422-1.c", 12; if (foo (8) != 8)
+	__ld.wi		8
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__ult_w.wi	5
+	__bfalse	.LL7
+	__st.wsiq	4, 0  /* x */
+	__bra		.LL8
+.LL7:
+	__st.wsiq	8, 0  /* x */
+.LL8:
+	__ld.ws		0  /* x */
+.LL9:
+	__modsp		2
+	__neq_w.wi	8
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20010422-1.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010422-1.c", 14; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010422-1.c", 15; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,175 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010518-1.c", 1; /* Leaf functions with many arguments.  */
+	.dbg	line,	"tests/20010518-1.c", 3; int
+	.dbg	line,	"tests/20010518-1.c", 4; add (int a,
+	.dbg	line,	"tests/20010518-1.c", 5; int b,
+	.dbg	line,	"tests/20010518-1.c", 6; int c,
+	.dbg	line,	"tests/20010518-1.c", 7; int d,
+	.dbg	line,	"tests/20010518-1.c", 8; int e,
+	.dbg	line,	"tests/20010518-1.c", 9; int f,
+	.dbg	line,	"tests/20010518-1.c", 10; int g,
+	.dbg	line,	"tests/20010518-1.c", 11; int h,
+	.dbg	line,	"tests/20010518-1.c", 12; int i,
+	.dbg	line,	"tests/20010518-1.c", 13; int j,
+	.dbg	line,	"tests/20010518-1.c", 14; int k,
+	.dbg	line,	"tests/20010518-1.c", 15; int l,
+	.dbg	line,	"tests/20010518-1.c", 16; int m)
+	.dbg	line,	"tests/20010518-1.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_add
+	__enter		_add
+
+	.dbg	line,	"tests/20010518-1.c", 18; return a+b+c+d+e+f+g+h+i+j+k+l+m;
+	__ld.ws		24  /* a */
+	__add.ws	22  /* b */
+	__add.ws	20  /* c */
+	__add.ws	18  /* d */
+	__add.ws	16  /* e */
+	__add.ws	14  /* f */
+	__add.ws	12  /* g */
+	__add.ws	10  /* h */
+	__add.ws	8  /* i */
+	__add.ws	6  /* j */
+	__add.ws	4  /* k */
+	__add.ws	2  /* l */
+	__add.ws	0  /* m */
+.LL2:
+
+	.dbg	line,	"tests/20010518-1.c", 19; }
+	__modsp		26
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010518-1.c", 21; int
+	.dbg	line,	"tests/20010518-1.c", 22; main(void)
+	.dbg	line,	"tests/20010518-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010518-1.c", 24; if (add (1,2,3,4,5,6,7,8,9,10,11,12,13) != 91)
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		7
+	__pusharg.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		9
+	__pusharg.wr
+	__ld.wi		10
+	__pusharg.wr
+	__ld.wi		11
+	__pusharg.wr
+	__ld.wi		12
+	__pusharg.wr
+	__ld.wi		13
+	__pusharg.wr
+	__ld.ws		24  /* a */
+	__add.ws	22  /* b */
+	__add.ws	20  /* c */
+	__add.ws	18  /* d */
+	__add.ws	16  /* e */
+	__add.ws	14  /* f */
+	__add.ws	12  /* g */
+	__add.ws	10  /* h */
+	__add.ws	8  /* i */
+	__add.ws	6  /* j */
+	__add.ws	4  /* k */
+	__add.ws	2  /* l */
+	__add.ws	0  /* m */
+.LL5:
+	__modsp		26
+	__neq_w.wi	91
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20010518-1.c", 25; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010518-1.c", 27; exit (0);
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010518-1.c", 28; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,292 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010910-1.c", 1; /* Test case contributed by Ingo Rohloff <rohloff@in.tum.de>.
+	.dbg	line,	"tests/20010910-1.c", 2; Code distilled from Linux kernel.  */
+	.dbg	line,	"tests/20010910-1.c", 4; /* Compile this program with a gcc-2.95.2 using
+	.dbg	line,	"tests/20010910-1.c", 5; "gcc -O2" and run it. The result will be that
+	.dbg	line,	"tests/20010910-1.c", 6; rx_ring[1].next == 0   (it should be == 14)
+	.dbg	line,	"tests/20010910-1.c", 7; and
+	.dbg	line,	"tests/20010910-1.c", 8; ep.skbuff[4] == 5      (it should be 0)
+	.dbg	line,	"tests/20010910-1.c", 9; */
+	.dbg	line,	"tests/20010910-1.c", 11; extern void abort(void);
+	.dbg	line,	"tests/20010910-1.c", 13; struct epic_rx_desc 
+	.dbg	line,	"tests/20010910-1.c", 14; {
+	.dbg	line,	"tests/20010910-1.c", 15; unsigned int next;
+	.dbg	line,	"tests/20010910-1.c", 16; };
+	.dbg	line,	"tests/20010910-1.c", 18; struct epic_private 
+	.dbg	line,	"tests/20010910-1.c", 19; {
+	.dbg	line,	"tests/20010910-1.c", 20; struct epic_rx_desc *rx_ring;
+	.dbg	line,	"tests/20010910-1.c", 21; unsigned int rx_skbuff[5];
+	.dbg	line,	"tests/20010910-1.c", 22; };
+	.dbg	line,	"tests/20010910-1.c", 24; static void epic_init_ring(struct epic_private *ep)
+	.dbg	line,	"tests/20010910-1.c", 25; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_epic_init_ring
+	__enter		_epic_init_ring
+
+	.dbg	line,	"tests/20010910-1.c", 26; int i;
+
+	.dbg	line,	"tests/20010910-1.c", 28; for (i = 0; i < 5; i++) 
+	__st.wmiq	0, __epic_init_ring_end - 2  /* i */
+.LL3:
+	__ld.wm		__epic_init_ring_end - 2  /* i */
+	__slt_w.wi	5
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__epic_init_ring_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20010910-1.c", 29; {
+
+	.dbg	line,	"tests/20010910-1.c", 30; ep->rx_ring[i].next = 10 + (i+1)*2;
+	__ld.ws		0  /* ep */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.wm		__epic_init_ring_end - 2  /* i */
+	__asl.wr
+	__add.wt
+	__push.wr
+	__ld.wm		__epic_init_ring_end - 2  /* i */
+	__add.wi	1
+	__asl.wi	1
+	__add.wi	10
+	__st.wtq
+
+	.dbg	line,	"tests/20010910-1.c", 31; ep->rx_skbuff[i] = 0;
+	__ld.ws		0  /* ep */
+	__add.wi	2
+	__push.wr
+	__ld.wm		__epic_init_ring_end - 2  /* i */
+	__asl.wr
+	__add.wt
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+
+	.dbg	line,	"tests/20010910-1.c", 32; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20010910-1.c", 33; ep->rx_ring[i-1].next = 10;
+	__ld.ws		0  /* ep */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.wm		__epic_init_ring_end - 2  /* i */
+	__sub.wi	1
+	__asl.wr
+	__add.wt
+	__push.wr
+	__ld.wi		10
+	__st.wtq
+
+	.dbg	line,	"tests/20010910-1.c", 34; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__epic_init_ring_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20010910-1.c", 36; static const int check_rx_ring[5] = { 12,14,16,18,10 };
+	.dbg	line,	"tests/20010910-1.c", 38; int main(void)
+	.dbg	line,	"tests/20010910-1.c", 39; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010910-1.c", 40; struct epic_private ep;
+
+	.dbg	line,	"tests/20010910-1.c", 41; struct epic_rx_desc rx_ring[5];
+
+	.dbg	line,	"tests/20010910-1.c", 42; int i;
+
+	.dbg	line,	"tests/20010910-1.c", 44; for (i=0;i<5;i++)
+	__st.wmiq	0, __main_end - 24  /* i */
+.LL8:
+	__ld.wm		__main_end - 24  /* i */
+	__slt_w.wi	5
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+	__inc.wmq	__main_end - 24  /* i */
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/20010910-1.c", 45; {
+
+	.dbg	line,	"tests/20010910-1.c", 46; rx_ring[i].next=0;
+	__ld2x.wmq	__main_end - 24  /* i */
+	__st.waxiq	0, __main_end - 22  /* rx_ring */
+
+	.dbg	line,	"tests/20010910-1.c", 47; ep.rx_skbuff[i]=5;
+	__ld.wm		__main_end - 24  /* i */
+	__asl.wr
+	__add.wi	__main_end - 12 + 2  /* ep */
+	__push.wr
+	__ld.wi		5
+	__st.wtq
+
+	.dbg	line,	"tests/20010910-1.c", 48; }
+	__bra		.LL9
+.LL11:
+
+	.dbg	line,	"tests/20010910-1.c", 49; 
+
+	.dbg	line,	"tests/20010910-1.c", 50; ep.rx_ring=rx_ring;
+	__ld.wi		__main_end - 22  /* rx_ring */
+	__st.wmq	__main_end - 12  /* ep */
+
+	.dbg	line,	"tests/20010910-1.c", 51; epic_init_ring(&ep);
+	__ld.wi		__main_end - 12  /* ep */
+	__pusharg.wr
+	__call		_epic_init_ring
+
+	.dbg	line,	"tests/20010910-1.c", 52; 
+
+	.dbg	line,	"tests/20010910-1.c", 53; for (i=0;i<5;i++)
+	__st.wmiq	0, __main_end - 24  /* i */
+.LL12:
+	__ld.wm		__main_end - 24  /* i */
+	__slt_w.wi	5
+	__btrue		.LL14
+	__bra		.LL15
+.LL13:
+	__inc.wmq	__main_end - 24  /* i */
+	__bra		.LL12
+.LL14:
+
+	.dbg	line,	"tests/20010910-1.c", 54; {
+
+	.dbg	line,	"tests/20010910-1.c", 55; if ( rx_ring[i].next != check_rx_ring[i] ) abort();
+	__ld2x.wmq	__main_end - 24  /* i */
+	__ld.wax	__main_end - 22  /* rx_ring */
+	__ld2x.wm	__main_end - 24  /* i */
+	__neq_w.wax	_check_rx_ring
+	__bfalse	.LL16
+	__call		_abort
+
+	.dbg	line,	"tests/20010910-1.c", 56; if ( ep.rx_skbuff[i] != 0 ) abort();
+.LL16:
+	__ld.wm		__main_end - 24  /* i */
+	__asl.wr
+	__add.wi	__main_end - 12 + 2  /* ep */
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__bfalse	.LL17
+	__call		_abort
+
+	.dbg	line,	"tests/20010910-1.c", 57; }
+.LL17	.alias		.LL13
+	__bra		.LL13
+.LL15:
+
+	.dbg	line,	"tests/20010910-1.c", 58; return 0;
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/20010910-1.c", 59; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_check_rx_ring:
+		dw	12
+		dw	14
+		dw	16
+		dw	18
+		dw	10
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:10
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    24  _main
+;
+; 24 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       246     36    24  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 24, 36, 246
+__main_end	=	__overlay_frames + 24
+	.endm
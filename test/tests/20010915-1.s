@@ -0,0 +1,504 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20010915-1.c", 1; #include <string.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 3; #endif
+	.dbg	line,	"tests/20010915-1.c", 3; /* Bug in reorg.c, deleting the "++" in the last loop in main.
+	.dbg	line,	"tests/20010915-1.c", 4; Origin: <hp@axis.com>.  */
+	.dbg	line,	"tests/20010915-1.c", 6; extern void f (void);
+	.dbg	line,	"tests/20010915-1.c", 7; extern int x (int, char **);
+	.dbg	line,	"tests/20010915-1.c", 8; extern int r (const char *);
+	.dbg	line,	"tests/20010915-1.c", 9; extern char *s (char *, char **);
+	.dbg	line,	"tests/20010915-1.c", 10; extern char *m (char *);
+	.dbg	line,	"tests/20010915-1.c", 11; char *u;
+	.dbg	line,	"tests/20010915-1.c", 12; char *h;
+	.dbg	line,	"tests/20010915-1.c", 13; int check;// = 0;
+	.dbg	line,	"tests/20010915-1.c", 14; int o;// = 0;
+	.dbg	line,	"tests/20010915-1.c", 16; const  char *args[] = {"a", "b", "c", "d", "e"};
+	.dbg	line,	"tests/20010915-1.c", 17; int main (int argc, char **argv)
+	.dbg	line,	"tests/20010915-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20010915-1.c", 19; if (x (5, args) != 0 || check != 2 || o != 5)
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		_args
+	__pusharg.wr
+	__call		_x
+	__tst.wr
+	__btrue		.LL4
+	__ld.wm		_check
+	__neq_w.wi	2
+.LL4:
+	__btrue		.LL5
+	__ld.wm		_o
+	__neq_w.wi	5
+.LL5:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20010915-1.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010915-1.c", 21; exit (0);
+.LL3:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20010915-1.c", 22; }
+.LL2:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010915-1.c", 24; int x (int argc, char **argv)
+	.dbg	line,	"tests/20010915-1.c", 25; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_x
+	__enter		_x
+
+	.dbg	line,	"tests/20010915-1.c", 26; int opt = 0;
+	__st.wmiq	0, __x_end - 2  /* opt */
+
+	.dbg	line,	"tests/20010915-1.c", 27; char *g = 0;
+	__st.wmiq	0, __x_end - 4  /* g */
+
+	.dbg	line,	"tests/20010915-1.c", 28; char *p = 0;
+	__st.wmiq	0, __x_end - 6  /* p */
+
+	.dbg	line,	"tests/20010915-1.c", 30; if (argc > o && argc > 2 && argv[o])
+	__ld.ws		2  /* argc */
+	__sgt_w.wm	_o
+	__bfalse	.LL8
+	__ld.ws		2  /* argc */
+	__sgt_w.wi	2
+.LL8:
+	__bfalse	.LL9
+	__ld.wm		_o
+	__asl.wr
+	__add.ws	0  /* argv */
+	__st.wm		__ptr
+	__tst.wp	__ptr
+.LL9:
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20010915-1.c", 31; {
+
+	.dbg	line,	"tests/20010915-1.c", 32; g = s (argv[o], &p);
+	__ld.wm		_o
+	__asl.wr
+	__add.ws	0  /* argv */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__pusharg.wr
+	__ld.wi		__x_end - 6  /* p */
+	__pusharg.wr
+	__call		_s
+	__st.wmq	__x_end - 4  /* g */
+
+	.dbg	line,	"tests/20010915-1.c", 33; if (g)
+	__tst.wm	__x_end - 4  /* g */
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/20010915-1.c", 34; {
+
+	.dbg	line,	"tests/20010915-1.c", 35; *g++ = '\0';
+	__ldinc.wm	__x_end - 4  /* g */
+	__push.wr
+	__ld.wi		0
+	__st.utq
+
+	.dbg	line,	"tests/20010915-1.c", 36; h = s (g, &p);
+	__ld.wm		__x_end - 4  /* g */
+	__pusharg.wr
+	__ld.wi		__x_end - 6  /* p */
+	__pusharg.wr
+	__call		_s
+	__st.wmq	_h
+
+	.dbg	line,	"tests/20010915-1.c", 37; if (g == p)
+	__ld.wm		__x_end - 4  /* g */
+	__equ_w.wm	__x_end - 6  /* p */
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/20010915-1.c", 38; h = m (g);
+	__ld.wm		__x_end - 4  /* g */
+	__pusharg.wr
+	__call		_m
+	__st.wmq	_h
+
+	.dbg	line,	"tests/20010915-1.c", 39; }
+.LL11:
+
+	.dbg	line,	"tests/20010915-1.c", 40; u = s (argv[o], &p);
+.LL10:
+	__ld.wm		_o
+	__asl.wr
+	__add.ws	0  /* argv */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__pusharg.wr
+	__ld.wi		__x_end - 6  /* p */
+	__pusharg.wr
+	__call		_s
+	__st.wmq	_u
+
+	.dbg	line,	"tests/20010915-1.c", 41; if (argv[o] == p)
+	__ld.wm		_o
+	__asl.wr
+	__add.ws	0  /* argv */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__equ_w.wm	__x_end - 6  /* p */
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/20010915-1.c", 42; u = m (argv[o]);
+	__ld.wm		_o
+	__asl.wr
+	__add.ws	0  /* argv */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__pusharg.wr
+	__call		_m
+	__st.wmq	_u
+
+	.dbg	line,	"tests/20010915-1.c", 43; }
+.LL12	.alias		.LL13
+
+	.dbg	line,	"tests/20010915-1.c", 44; else
+	__bra		.LL13
+.LL7:
+
+	.dbg	line,	"tests/20010915-1.c", 45; abort ();
+	__call		_abort
+.LL13:
+
+	.dbg	line,	"tests/20010915-1.c", 47; while (++o < argc)
+.LL14:
+	__incld.wm	_o
+	__slt_w.ws	2  /* argc */
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/20010915-1.c", 48; if (r (argv[o]) == 0)
+	__ld.wm		_o
+	__asl.wr
+	__add.ws	0  /* argv */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__pusharg.wr
+	__call		_r
+	__not.wr
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/20010915-1.c", 49; return 1;
+	__ld.wi		1
+	__bra		.LL6
+
+	.dbg	line,	"tests/20010915-1.c", 51; return 0;
+.LL16	.alias		.LL14
+.LL15:
+	__ld.wi		0
+.LL6:
+
+	.dbg	line,	"tests/20010915-1.c", 52; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20010915-1.c", 54; char *m (char *x) { abort (); }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_m
+	__enter		_m
+	__call		_abort
+.LL17:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010915-1.c", 55; char *s (char *v, char **pp)
+	.dbg	line,	"tests/20010915-1.c", 56; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_s
+	__enter		_s
+
+	.dbg	line,	"tests/20010915-1.c", 57; if (strcmp (v, "a") != 0 || check++ > 1)
+	__ld.ws		2  /* v */
+	__st.wmq	_di
+	__ld.wi		__const1+10
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__btrue		.LL20
+	__ldinc.wm	_check
+	__sgt_w.wi	1
+.LL20:
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/20010915-1.c", 58; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010915-1.c", 59; *pp = v+1;
+.LL19:
+	__ld.ws		0  /* pp */
+	__push.wr
+	__ld.ws		2  /* v */
+	__add.wi	1
+	__st.wtq
+
+	.dbg	line,	"tests/20010915-1.c", 60; return 0;
+	__ld.wi		0
+.LL18:
+
+	.dbg	line,	"tests/20010915-1.c", 61; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20010915-1.c", 63; int r (const char *f)
+	.dbg	line,	"tests/20010915-1.c", 64; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_r
+	__enter		_r
+
+	.dbg	line,	"tests/20010915-1.c", 65; static char c[2] = "b";
+
+	.dbg	line,	"tests/20010915-1.c", 66; static int cnt = 0;
+
+	.dbg	line,	"tests/20010915-1.c", 68; if (*f != *c || f[1] != c[1] || cnt > 3)
+	__ld.ws		0  /* f */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.umq	SL22  /* c */
+	__btrue		.LL25
+	__ld.ws		0  /* f */
+	__add.wi	1
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.umq	SL22 + 1  /* c */
+.LL25:
+	__btrue		.LL26
+	__ld.wm		SL23  /* cnt */
+	__sgt_w.wi	3
+.LL26:
+	__bfalse	.LL24
+
+	.dbg	line,	"tests/20010915-1.c", 69; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20010915-1.c", 70; c[0]++;
+.LL24:
+	__inc.umq	SL22  /* c */
+
+	.dbg	line,	"tests/20010915-1.c", 71; cnt++;
+	__inc.wmq	SL23  /* cnt */
+
+	.dbg	line,	"tests/20010915-1.c", 72; return 1;
+	__ld.wi		1
+.LL21:
+
+	.dbg	line,	"tests/20010915-1.c", 73; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'a',$00,'b',$00,'c',$00,'d',$00
+		db	'e',$00,'a',$00,'b',$00
+_args:
+		dw	__const1+0
+		dw	__const1+2
+		dw	__const1+4
+		dw	__const1+6
+		dw	__const1+8
+
+	.xdata
+SL22:
+		ds	2
+
+	.xinit
+
+		db	98,0
+	.code
+
+;0 error(s) in compilation
+;	literal pool:14
+;	constant pool:10
+;	global pool:32
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _x
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        62     20     2  o
+;        28     28     6  overlaid locals
+;         6      6     2  cnt (static in r())
+;         6      6     2  check
+;         4      4     2  h
+;         4      4     2  u
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_o, 2, 20, 62
+	auto_zp_var	__overlay_frames, 6, 28, 28
+__x_end	=	__overlay_frames + 6
+	auto_zp_var	SL23, 2, 6, 6
+	auto_zp_var	_check, 2, 6, 6
+	auto_zp_var	_h, 2, 4, 4
+	auto_zp_var	_u, 2, 4, 4
+	.endm
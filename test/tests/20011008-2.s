@@ -0,0 +1,132 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20011008-2.c", 1; /* { dg-do run } */
+	.dbg	line,	"tests/20011008-2.c", 2; /* { dg-options "-O0" } */
+	.dbg	line,	"tests/20011008-2.c", 4; extern void abort (void);
+	.dbg	line,	"tests/20011008-2.c", 5; extern void exit (int);
+	.dbg	line,	"tests/20011008-2.c", 7; struct { union {int x; int y;} z; int q; } b;
+	.dbg	line,	"tests/20011008-2.c", 8; union { struct {int x;} z; int q; } e;
+	.dbg	line,	"tests/20011008-2.c", 10; main()
+	.dbg	line,	"tests/20011008-2.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20011008-2.c", 12; b.z.y = 10;
+	__st.wmiq	10, _b
+
+	.dbg	line,	"tests/20011008-2.c", 13; b.z.x = 15;
+	__st.wmiq	15, _b
+
+	.dbg	line,	"tests/20011008-2.c", 14; if (b.z.y != 15)
+	__ld.wm		_b
+	__neq_w.wi	15
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20011008-2.c", 15; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20011008-2.c", 17; e.z.x = 10;
+.LL3:
+	__st.wmiq	10, _e
+
+	.dbg	line,	"tests/20011008-2.c", 18; e.q = 15;
+	__st.wmiq	15, _e
+
+	.dbg	line,	"tests/20011008-2.c", 19; if (e.z.x != 15)
+	__ld.wm		_e
+	__neq_w.wi	15
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20011008-2.c", 20; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20011008-2.c", 22; exit(0);
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20011008-2.c", 23; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  e
+;         6      6     4  b
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_e, 2, 6, 6
+	auto_zp_var	_b, 4, 6, 6
+	.endm
@@ -0,0 +1,131 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20011109-2.c", 1; int main(void)
+	.dbg	line,	"tests/20011109-2.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20011109-2.c", 3; char *c1, *c2;
+
+	.dbg	line,	"tests/20011109-2.c", 4; int i;
+
+	.dbg	line,	"tests/20011109-2.c", 5; c1 = "foo";
+	__ld.wi		__const1+0
+	__st.wmq	__main_end - 2  /* c1 */
+
+	.dbg	line,	"tests/20011109-2.c", 6; c2 = "foo";
+	__ld.wi		__const1+4
+	__st.wmq	__main_end - 4  /* c2 */
+
+	.dbg	line,	"tests/20011109-2.c", 7; for (i = 0; i < 3; i++)
+	__st.wmiq	0, __main_end - 6  /* i */
+.LL3:
+	__ld.wm		__main_end - 6  /* i */
+	__slt_w.wi	3
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__main_end - 6  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20011109-2.c", 8; if (c1[i] != c2[i])
+	__ld.wm		__main_end - 2  /* c1 */
+	__add.wm	__main_end - 6  /* i */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__push.wr
+	__ld.wm		__main_end - 4  /* c2 */
+	__add.wm	__main_end - 6  /* i */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__neq_w.wt
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20011109-2.c", 9; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20011109-2.c", 10; exit (0);
+.LL7	.alias		.LL4
+	__bra		.LL4
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20011109-2.c", 11; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'f','o','o',$00,'f','o','o',$00
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:8
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
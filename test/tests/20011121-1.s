@@ -0,0 +1,112 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20011121-1.c", 1; struct s
+	.dbg	line,	"tests/20011121-1.c", 2; {
+	.dbg	line,	"tests/20011121-1.c", 3; int i[18];
+	.dbg	line,	"tests/20011121-1.c", 4; char f;
+	.dbg	line,	"tests/20011121-1.c", 5; char b[2];
+	.dbg	line,	"tests/20011121-1.c", 6; };
+	.dbg	line,	"tests/20011121-1.c", 8; struct s s1;
+	.dbg	line,	"tests/20011121-1.c", 10; int
+	.dbg	line,	"tests/20011121-1.c", 11; main()
+	.dbg	line,	"tests/20011121-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20011121-1.c", 13; struct s s2;
+
+	.dbg	line,	"tests/20011121-1.c", 14; s2.b[0] = 100;
+	__st.umiq	100, __main_end - 39 + 37  /* s2 */
+
+	.dbg	line,	"tests/20011121-1.c", 15; //__builtin_memcpy(&s2, &s1, ((unsigned int) &((struct s *)0)->b));
+
+	.dbg	line,	"tests/20011121-1.c", 16; if (s2.b[0] != 100)
+	__ld.umq	__main_end - 39 + 37  /* s2 */
+	__neq_b.uiq	100
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20011121-1.c", 17; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20011121-1.c", 18; exit(0);
+.LL3:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20011121-1.c", 19; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_s1:
+		ds	39
+
+	.code
+	.if		leaf_needs < 39
+leaf_needs	.set	39
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,218 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20011126-2.c", 1; /* Problem originally visible on ia64.
+	.dbg	line,	"tests/20011126-2.c", 3; There is a partial redundancy of "in + 1" that makes GCSE want to
+	.dbg	line,	"tests/20011126-2.c", 4; transform the final while loop to 
+	.dbg	line,	"tests/20011126-2.c", 6; p = in + 1;
+	.dbg	line,	"tests/20011126-2.c", 7; tmp = p;
+	.dbg	line,	"tests/20011126-2.c", 8; ...
+	.dbg	line,	"tests/20011126-2.c", 9; goto start;
+	.dbg	line,	"tests/20011126-2.c", 10; top:
+	.dbg	line,	"tests/20011126-2.c", 11; tmp = tmp + 1;
+	.dbg	line,	"tests/20011126-2.c", 12; start:
+	.dbg	line,	"tests/20011126-2.c", 13; in = tmp;
+	.dbg	line,	"tests/20011126-2.c", 14; if (in < p) goto top;
+	.dbg	line,	"tests/20011126-2.c", 16; We miscalculate the number of loop iterations as (p - tmp) = 0
+	.dbg	line,	"tests/20011126-2.c", 17; instead of (p - in) = 1, which results in overflow in the doloop
+	.dbg	line,	"tests/20011126-2.c", 18; optimization.  */
+	.dbg	line,	"tests/20011126-2.c", 20; static const char *
+	.dbg	line,	"tests/20011126-2.c", 21; test (const char *in, char *out)
+	.dbg	line,	"tests/20011126-2.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/20011126-2.c", 23; while (1)
+.LL3:
+	__ld.wi		1
+	__tst.wr
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20011126-2.c", 24; {
+
+	.dbg	line,	"tests/20011126-2.c", 25; if (*in == 'a')
+	__ld.ws		2  /* in */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	97
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20011126-2.c", 26; {
+
+	.dbg	line,	"tests/20011126-2.c", 27; /* const */ char *p; p = in + 1;
+	__ld.ws		2  /* in */
+	__add.wi	1
+	__st.wmq	__test_end - 2  /* p */
+
+	.dbg	line,	"tests/20011126-2.c", 28; while (*p == 'x')
+.LL6:
+	__ld.wm		__test_end - 2  /* p */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	120
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20011126-2.c", 29; ++p;
+	__inc.wmq	__test_end - 2  /* p */
+	__bra		.LL6
+.LL7:
+
+	.dbg	line,	"tests/20011126-2.c", 30; if (*p == 'b')
+	__ld.wm		__test_end - 2  /* p */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	98
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20011126-2.c", 31; return p;
+	__ld.wm		__test_end - 2  /* p */
+	__bra		.LL2
+
+	.dbg	line,	"tests/20011126-2.c", 32; while (in < p)
+.LL8:
+.LL9:
+	__ld.ws		2  /* in */
+	__ult_w.wm	__test_end - 2  /* p */
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/20011126-2.c", 33; *out++ = *in++;
+	__ldinc.ws	0  /* out */
+	__push.wr
+	__ldinc.ws	2  /* in */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__st.utq
+	__bra		.LL9
+.LL10	.alias		.LL3
+
+	.dbg	line,	"tests/20011126-2.c", 34; }
+
+	.dbg	line,	"tests/20011126-2.c", 35; }
+.LL5	.alias		.LL3
+.LL4:
+
+	.dbg	line,	"tests/20011126-2.c", 36; }
+.LL2:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20011126-2.c", 38; int main ()
+	.dbg	line,	"tests/20011126-2.c", 39; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20011126-2.c", 40; char out[4];
+
+	.dbg	line,	"tests/20011126-2.c", 41; test ("aab", out);
+	__ld.wi		__const1+0
+	__pusharg.wr
+	__ld.wi		__main_end - 4  /* out */
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20011126-2.c", 42; return 0;
+	__ld.wi		0
+.LL11:
+
+	.dbg	line,	"tests/20011126-2.c", 43; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'a','a','b',$00
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:4
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         2      2     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 2, 2
+__main_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,132 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20011223-1.c", 1; /* Origin: Joseph Myers <jsm28@cam.ac.uk>.  */
+	.dbg	line,	"tests/20011223-1.c", 2; /* Case labels in a switch statement are converted to the promoted
+	.dbg	line,	"tests/20011223-1.c", 3; type of the controlling expression, not an unpromoted version.
+	.dbg	line,	"tests/20011223-1.c", 4; Reported as PR c/2454 by
+	.dbg	line,	"tests/20011223-1.c", 5; Andreas Krakowczyk <Andreas.Krakowczyk@fujitsu-siemens.com>.  */
+	.dbg	line,	"tests/20011223-1.c", 7; extern void exit (int);
+	.dbg	line,	"tests/20011223-1.c", 8; extern void abort (void);
+	.dbg	line,	"tests/20011223-1.c", 10; static int i;
+	.dbg	line,	"tests/20011223-1.c", 12; int
+	.dbg	line,	"tests/20011223-1.c", 13; main (void)
+	.dbg	line,	"tests/20011223-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20011223-1.c", 15; i = -1;
+	__st.wmiq	-1, _i
+
+	.dbg	line,	"tests/20011223-1.c", 16; switch ((signed char) i) {
+	__ld.wm		_i
+	__ext.br
+	__bra		.LL3
+
+	.dbg	line,	"tests/20011223-1.c", 17; case 255:
+.LL5:
+	__case		255
+
+	.dbg	line,	"tests/20011223-1.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20011223-1.c", 19; default:
+	__endcase
+.LL6:
+	__default
+
+	.dbg	line,	"tests/20011223-1.c", 20; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20011223-1.c", 21; }
+	__bra		.LL4
+.LL3:
+	__switch_r.wr	255, 255
+
+!table:		dw	.LL5
+		dw	.LL6
+.LL4:
+
+	.dbg	line,	"tests/20011223-1.c", 22; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  i
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_i, 2, 4, 4
+	.endm
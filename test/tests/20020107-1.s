@@ -0,0 +1,157 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020107-1.c", 1; /* This testcase failed because - 1 - buf was simplified into ~buf and when
+	.dbg	line,	"tests/20020107-1.c", 2; later expanding it back into - buf + -1, -1 got lost.  */
+	.dbg	line,	"tests/20020107-1.c", 4; extern void abort (void);
+	.dbg	line,	"tests/20020107-1.c", 5; extern void exit (int);
+	.dbg	line,	"tests/20020107-1.c", 7; static void
+	.dbg	line,	"tests/20020107-1.c", 8; bar (int x)
+	.dbg	line,	"tests/20020107-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20020107-1.c", 10; if (!x)
+	__not.ws	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20020107-1.c", 11; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20020107-1.c", 12; }
+.LL3:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20020107-1.c", 14; char buf[10];
+	.dbg	line,	"tests/20020107-1.c", 16; /* inline */ char *
+	.dbg	line,	"tests/20020107-1.c", 17; foo (char *tmp)
+	.dbg	line,	"tests/20020107-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20020107-1.c", 19; //asm ("" : "=r" (tmp) : "0" (tmp));
+
+	.dbg	line,	"tests/20020107-1.c", 20; return tmp + 2;
+	__ld.ws		0  /* tmp */
+	__add.wi	2
+.LL4:
+
+	.dbg	line,	"tests/20020107-1.c", 21; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20020107-1.c", 23; int
+	.dbg	line,	"tests/20020107-1.c", 24; main (void)
+	.dbg	line,	"tests/20020107-1.c", 25; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020107-1.c", 26; bar ((foo (buf) - 1 - buf) == 1);
+	__ld.wi		_buf
+	__pusharg.wr
+	__ld.ws		0  /* tmp */
+	__add.wi	2
+.LL6:
+	__modsp		2
+	__sub.wi	1
+	__sub.wi	_buf
+	__equ_w.wi	1
+	__bool
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL7
+	__call		_abort
+.LL7:
+.LL8:
+	__modsp		2
+
+	.dbg	line,	"tests/20020107-1.c", 27; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020107-1.c", 28; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_buf:
+		ds	10
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
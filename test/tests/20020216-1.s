@@ -0,0 +1,165 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020216-1.c", 1; /* PR c/3444
+	.dbg	line,	"tests/20020216-1.c", 2; This used to fail because bitwise xor was improperly computed in char type
+	.dbg	line,	"tests/20020216-1.c", 3; and sign extended to int type.  */
+	.dbg	line,	"tests/20020216-1.c", 5; extern void abort ();
+	.dbg	line,	"tests/20020216-1.c", 6; extern void exit (int);
+	.dbg	line,	"tests/20020216-1.c", 8; signed char c;// = (signed char) 0xffffffff;
+	.dbg	line,	"tests/20020216-1.c", 10; int foo (void)
+	.dbg	line,	"tests/20020216-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20020216-1.c", 12; return (unsigned short) c ^ (signed char) 0x99999999;
+	__ld.bm		_c
+	__push.wr
+	__ld.wi		-1717986919
+	__ext.br
+	__eor.wt
+.LL2:
+
+	.dbg	line,	"tests/20020216-1.c", 13; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20020216-1.c", 15; int main (void)
+	.dbg	line,	"tests/20020216-1.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020216-1.c", 17; c = (signed char) 0xffffffff;
+	__ld.wi		-1
+	__ext.br
+	__st.umq	_c
+
+	.dbg	line,	"tests/20020216-1.c", 18; if ((unsigned char) -1 != 0xff
+	__ld.wi		-1
+	__ext.ur
+	__neq_w.wi	255
+
+	.dbg	line,	"tests/20020216-1.c", 19; || sizeof (short) != 2
+	__btrue		.LL5
+	__ld.wi		2
+	__neq_w.wi	2
+
+	.dbg	line,	"tests/20020216-1.c", 20; || sizeof (int) != 4)
+.LL5:
+	__btrue		.LL6
+	__ld.wi		2
+	__neq_w.wi	4
+.LL6:
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20020216-1.c", 21; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020216-1.c", 22; if (foo () != (int) 0xffff0066)
+.LL4:
+	__ld.bm		_c
+	__push.wr
+	__ld.wi		-1717986919
+	__ext.br
+	__eor.wt
+.LL8:
+	__neq_w.wi	-65434
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20020216-1.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20020216-1.c", 24; exit (0);
+.LL7:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020216-1.c", 25; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     1  c
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_c, 1, 4, 4
+	.endm
@@ -0,0 +1,173 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020328-1.c", 1; const int b = 0;
+	.dbg	line,	"tests/20020328-1.c", 3; func () { }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func
+	__enter		_func
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20020328-1.c", 5; void
+	.dbg	line,	"tests/20020328-1.c", 6; testit(int x)
+	.dbg	line,	"tests/20020328-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_testit
+	__enter		_testit
+
+	.dbg	line,	"tests/20020328-1.c", 8; if (x != 20)
+	__ld.ws		0  /* x */
+	__neq_w.wi	20
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20020328-1.c", 9; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20020328-1.c", 10; }
+.LL4:
+.LL3:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20020328-1.c", 12; int
+	.dbg	line,	"tests/20020328-1.c", 13; main()
+	.dbg	line,	"tests/20020328-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020328-1.c", 16; int a; a = 0;
+	__st.wmiq	0, __main_end - 2  /* a */
+
+	.dbg	line,	"tests/20020328-1.c", 18; if (b)
+	__ld.wi		0
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20020328-1.c", 19; func();
+.LL7:
+
+	.dbg	line,	"tests/20020328-1.c", 21; /* simplify_and_const_int would incorrectly omit the mask in
+
+	.dbg	line,	"tests/20020328-1.c", 22; the line below.  */
+
+	.dbg	line,	"tests/20020328-1.c", 23; testit ((a + 23) & 0xfffffffc);
+.LL6:
+	__ld.wm		__main_end - 2  /* a */
+	__add.wi	23
+	__and.wi	-4
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__neq_w.wi	20
+	__bfalse	.LL8
+	__call		_abort
+.LL8:
+.LL9:
+	__modsp		2
+
+	.dbg	line,	"tests/20020328-1.c", 24; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020328-1.c", 25; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_b:
+		dw	0
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:2
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 4, 4
+__main_end	=	__overlay_frames + 2
+	.endm
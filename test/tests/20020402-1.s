@@ -0,0 +1,231 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020402-1.c", 1; /* derived from PR c/2100 */
+	.dbg	line,	"tests/20020402-1.c", 3; extern void abort ();
+	.dbg	line,	"tests/20020402-1.c", 4; extern void exit (int);
+	.dbg	line,	"tests/20020402-1.c", 6; #define SMALL_N  2
+	.dbg	line,	"tests/20020402-1.c", 7; #define NUM_ELEM 4
+	.dbg	line,	"tests/20020402-1.c", 8; const  int listElem[NUM_ELEM]={30,2,10,5};
+	.dbg	line,	"tests/20020402-1.c", 10; int main(void)
+	.dbg	line,	"tests/20020402-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020402-1.c", 12; int listSmall[SMALL_N];
+
+	.dbg	line,	"tests/20020402-1.c", 13; int i, j;
+
+	.dbg	line,	"tests/20020402-1.c", 14; int posGreatest, greatest;
+
+	.dbg	line,	"tests/20020402-1.c", 15; posGreatest=-1; greatest=-1;
+	__st.wmiq	-1, __main_end - 10  /* posGreatest */
+	__st.wmiq	-1, __main_end - 12  /* greatest */
+
+	.dbg	line,	"tests/20020402-1.c", 17; for (i=0; i<SMALL_N; i++) { 
+	__st.wmiq	0, __main_end - 6  /* i */
+.LL3:
+	__ld.wm		__main_end - 6  /* i */
+	__slt_w.wi	2
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__main_end - 6  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20020402-1.c", 18; listSmall[i] = listElem[i];
+	__ld2x.wmq	__main_end - 6  /* i */
+	__ld.wax	_listElem
+	__ld2x.wm	__main_end - 6  /* i */
+	__st.waxq	__main_end - 4  /* listSmall */
+
+	.dbg	line,	"tests/20020402-1.c", 19; if (listElem[i] > greatest) {
+	__ld2x.wmq	__main_end - 6  /* i */
+	__ld.wax	_listElem
+	__sgt_w.wm	__main_end - 12  /* greatest */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20020402-1.c", 20; posGreatest = i;
+	__ld.wm		__main_end - 6  /* i */
+	__st.wmq	__main_end - 10  /* posGreatest */
+
+	.dbg	line,	"tests/20020402-1.c", 21; greatest = listElem[i];
+	__ld2x.wmq	__main_end - 6  /* i */
+	__ld.wax	_listElem
+	__st.wmq	__main_end - 12  /* greatest */
+
+	.dbg	line,	"tests/20020402-1.c", 22; }
+
+	.dbg	line,	"tests/20020402-1.c", 23; }
+.LL7	.alias		.LL4
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20020402-1.c", 24; 
+
+	.dbg	line,	"tests/20020402-1.c", 25; for (i=SMALL_N; i<NUM_ELEM; i++) { 
+	__st.wmiq	2, __main_end - 6  /* i */
+.LL8:
+	__ld.wm		__main_end - 6  /* i */
+	__slt_w.wi	4
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+	__inc.wmq	__main_end - 6  /* i */
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/20020402-1.c", 26; if (listElem[i] < greatest) {
+	__ld2x.wmq	__main_end - 6  /* i */
+	__ld.wax	_listElem
+	__slt_w.wm	__main_end - 12  /* greatest */
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/20020402-1.c", 27; listSmall[posGreatest] = listElem[i];
+	__ld2x.wmq	__main_end - 6  /* i */
+	__ld.wax	_listElem
+	__ld2x.wm	__main_end - 10  /* posGreatest */
+	__st.waxq	__main_end - 4  /* listSmall */
+
+	.dbg	line,	"tests/20020402-1.c", 28; posGreatest = 0;
+	__st.wmiq	0, __main_end - 10  /* posGreatest */
+
+	.dbg	line,	"tests/20020402-1.c", 29; greatest = listSmall[0];
+	__ld.wm		__main_end - 4  /* listSmall */
+	__st.wmq	__main_end - 12  /* greatest */
+
+	.dbg	line,	"tests/20020402-1.c", 30; for (j=1; j<SMALL_N; j++) 
+	__st.wmiq	1, __main_end - 8  /* j */
+.LL13:
+	__ld.wm		__main_end - 8  /* j */
+	__slt_w.wi	2
+	__btrue		.LL15
+	__bra		.LL16
+.LL14:
+	__inc.wmq	__main_end - 8  /* j */
+	__bra		.LL13
+.LL15:
+
+	.dbg	line,	"tests/20020402-1.c", 31; if (listSmall[j] > greatest) {
+	__ld2x.wmq	__main_end - 8  /* j */
+	__ld.wax	__main_end - 4  /* listSmall */
+	__sgt_w.wm	__main_end - 12  /* greatest */
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/20020402-1.c", 32; posGreatest = j;
+	__ld.wm		__main_end - 8  /* j */
+	__st.wmq	__main_end - 10  /* posGreatest */
+
+	.dbg	line,	"tests/20020402-1.c", 33; greatest = listSmall[j];
+	__ld2x.wmq	__main_end - 8  /* j */
+	__ld.wax	__main_end - 4  /* listSmall */
+	__st.wmq	__main_end - 12  /* greatest */
+
+	.dbg	line,	"tests/20020402-1.c", 34; }
+
+	.dbg	line,	"tests/20020402-1.c", 35; }
+.LL17	.alias		.LL14
+	__bra		.LL14
+.LL16	.alias		.LL9
+
+	.dbg	line,	"tests/20020402-1.c", 36; }
+.LL12	.alias		.LL9
+.LL11:
+
+	.dbg	line,	"tests/20020402-1.c", 38; if (listSmall[0] != 5 || listSmall[1] != 2)
+	__ld.wm		__main_end - 4  /* listSmall */
+	__neq_w.wi	5
+	__btrue		.LL19
+	__ld.wm		__main_end - 4 + 2  /* listSmall */
+	__neq_w.wi	2
+.LL19:
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/20020402-1.c", 39; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20020402-1.c", 40; exit (0);
+.LL18:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020402-1.c", 41; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_listElem:
+		dw	30
+		dw	2
+		dw	10
+		dw	5
+
+	.bss
+	.code
+	.if		leaf_needs < 12
+leaf_needs	.set	12
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:8
+;	global pool:4
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,164 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020418-1.c", 1; /* ifcvt accidently deletes a referenced label while generating
+	.dbg	line,	"tests/20020418-1.c", 2; conditional traps on machines having such patterns */
+	.dbg	line,	"tests/20020418-1.c", 4; #define __builtin_expect(a, b) (a)
+	.dbg	line,	"tests/20020418-1.c", 5; #define __builtin_trap() abort()
+	.dbg	line,	"tests/20020418-1.c", 7; struct foo { int a; };
+	.dbg	line,	"tests/20020418-1.c", 9; void gcc_crash(struct foo *p)
+	.dbg	line,	"tests/20020418-1.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_gcc_crash
+	__enter		_gcc_crash
+
+	.dbg	line,	"tests/20020418-1.c", 11; if (__builtin_expect(p->a < 52, 0))
+	__ld.ws		0  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__slt_w.wi	52
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20020418-1.c", 12; __builtin_trap();
+	__call		_abort
+
+	.dbg	line,	"tests/20020418-1.c", 13; top:
+.LL3:
+.LL4:
+
+	.dbg	line,	"tests/20020418-1.c", 14; p->a++;
+	__ld.ws		0  /* p */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	1
+	__st.wtq
+
+	.dbg	line,	"tests/20020418-1.c", 15; if (p->a >= 62)
+	__ld.ws		0  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__sge_w.wi	62
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20020418-1.c", 16; goto top;
+	__bra		.LL4
+
+	.dbg	line,	"tests/20020418-1.c", 17; }
+.LL5:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20020418-1.c", 19; int main(void)
+	.dbg	line,	"tests/20020418-1.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020418-1.c", 21; struct foo x;
+
+	.dbg	line,	"tests/20020418-1.c", 23; x.a = 53;
+	__st.wmiq	53, __main_end - 2  /* x */
+
+	.dbg	line,	"tests/20020418-1.c", 24; gcc_crash(&x);
+	__ld.wi		__main_end - 2  /* x */
+	__pusharg.wr
+	__call		_gcc_crash
+
+	.dbg	line,	"tests/20020418-1.c", 26; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020418-1.c", 27; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 4, 4
+__main_end	=	__overlay_frames + 2
+	.endm
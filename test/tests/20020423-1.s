@@ -0,0 +1,176 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020423-1.c", 1; /* PR c/5430 */
+	.dbg	line,	"tests/20020423-1.c", 2; /* Verify that the multiplicative folding code is not fooled
+	.dbg	line,	"tests/20020423-1.c", 3; by the mix between signed variables and unsigned constants. */
+	.dbg	line,	"tests/20020423-1.c", 5; extern void abort (void);
+	.dbg	line,	"tests/20020423-1.c", 6; extern void exit (int);
+	.dbg	line,	"tests/20020423-1.c", 8; int main (void)
+	.dbg	line,	"tests/20020423-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020423-1.c", 10; int my_int;// = 924;
+
+	.dbg	line,	"tests/20020423-1.c", 11; unsigned int result;
+
+	.dbg	line,	"tests/20020423-1.c", 12; my_int = 924;
+	__st.wmiq	924, __main_end - 2  /* my_int */
+
+	.dbg	line,	"tests/20020423-1.c", 14; result = ((my_int*2 + 4) - 8/*U*/) / 2;
+	__ld.wm		__main_end - 2  /* my_int */
+	__asl.wi	1
+	__sub.wi	4
+	__sdiv.wi	2
+	__st.wmq	__main_end - 4  /* result */
+
+	.dbg	line,	"tests/20020423-1.c", 15; if (result != 922/*U*/)
+	__neq_w.wi	922
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20020423-1.c", 16; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20020423-1.c", 17; 
+
+	.dbg	line,	"tests/20020423-1.c", 18; result = ((my_int*2 - 4/*U*/) + 2) / 2;
+.LL3:
+	__ld.wm		__main_end - 2  /* my_int */
+	__asl.wi	1
+	__sub.wi	2
+	__sdiv.wi	2
+	__st.wmq	__main_end - 4  /* result */
+
+	.dbg	line,	"tests/20020423-1.c", 19; if (result != 923/*U*/)
+	__neq_w.wi	923
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20020423-1.c", 20; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20020423-1.c", 22; result = (((my_int + 2) * 2) - 8/*U*/ - 4) / 2;
+.LL4:
+	__ld.wm		__main_end - 2  /* my_int */
+	__add.wi	2
+	__asl.wi	1
+	__sub.wi	12
+	__sdiv.wi	2
+	__st.wmq	__main_end - 4  /* result */
+
+	.dbg	line,	"tests/20020423-1.c", 23; if (result != 920/*U*/)
+	__neq_w.wi	920
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20020423-1.c", 24; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20020423-1.c", 25; result = (((my_int + 2) * 2) - (8/*U*/ + 4)) / 2;
+.LL5:
+	__ld.wm		__main_end - 2  /* my_int */
+	__add.wi	2
+	__asl.wi	1
+	__sub.wi	12
+	__sdiv.wi	2
+	__st.wmq	__main_end - 4  /* result */
+
+	.dbg	line,	"tests/20020423-1.c", 26; if (result != 920/*U*/)
+	__neq_w.wi	920
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20020423-1.c", 27; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20020423-1.c", 29; result = ((my_int*4 + 2/*U*/) - 4/*U*/) / 2;
+.LL6:
+	__ld.wm		__main_end - 2  /* my_int */
+	__asl.wi	2
+	__sub.wi	2
+	__sdiv.wi	2
+	__st.wmq	__main_end - 4  /* result */
+
+	.dbg	line,	"tests/20020423-1.c", 30; if (result != 1847/*U*/)
+	__neq_w.wi	1847
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20020423-1.c", 31; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20020423-1.c", 33; exit(0);
+.LL7:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020423-1.c", 34; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,160 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020517-1.c", 1; /* This testcase caused ICE in do_SUBST on IA-32, because 0xf6 constant
+	.dbg	line,	"tests/20020517-1.c", 2; was not sign-extended for QImode.  */
+	.dbg	line,	"tests/20020517-1.c", 3; /* { dg-do run } */
+	.dbg	line,	"tests/20020517-1.c", 4; /* { dg-options "-O2" } */
+	.dbg	line,	"tests/20020517-1.c", 5; /* { dg-options "-O2 -mtune=i686" { target { { i?86-*-* x86_64-*-* } && ilp32 } } } */
+	.dbg	line,	"tests/20020517-1.c", 7; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/20020517-1.c", 9; void abort (void);
+	.dbg	line,	"tests/20020517-1.c", 10; void exit (int);
+	.dbg	line,	"tests/20020517-1.c", 12; void foo (void)
+	.dbg	line,	"tests/20020517-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20020517-1.c", 14; int i;
+
+	.dbg	line,	"tests/20020517-1.c", 15; char *p;
+
+	.dbg	line,	"tests/20020517-1.c", 17; p = (char *) &i;
+	__ld.wi		__foo_end - 2  /* i */
+	__st.wmq	__foo_end - 4  /* p */
+
+	.dbg	line,	"tests/20020517-1.c", 18; *p = -10;
+	__push.wr
+	__ld.wi		-10
+	__st.utq
+
+	.dbg	line,	"tests/20020517-1.c", 19; if (* (unsigned char *) p != 0x100 - 10)
+	__ld.wm		__foo_end - 4  /* p */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	246
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20020517-1.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20020517-1.c", 21; }
+.LL3:
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20020517-1.c", 23; int main (void)
+	.dbg	line,	"tests/20020517-1.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020517-1.c", 25; if (UCHAR_MAX == 255)
+	__ld.wi		255
+	__equ_w.wi	255
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20020517-1.c", 26; foo ();
+	__ld.wi		__foo_end - 2  /* i */
+	__st.wmq	__foo_end - 4  /* p */
+	__push.wr
+	__ld.wi		-10
+	__st.utq
+	__ld.wm		__foo_end - 4  /* p */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	246
+	__bfalse	.LL6
+	__call		_abort
+.LL6:
+.LL7:
+
+	.dbg	line,	"tests/20020517-1.c", 27; exit (0);
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020517-1.c", 28; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,347 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020529-1.c", 1; /* PR target/6838 from cato@df.lth.se.
+	.dbg	line,	"tests/20020529-1.c", 2; cris-elf got an ICE with -O2: the insn matching
+	.dbg	line,	"tests/20020529-1.c", 3; (insn 49 48 52 (parallel[ 
+	.dbg	line,	"tests/20020529-1.c", 4; (set (mem/s:HI (plus:SI (reg/v/f:SI 0 r0 [24])
+	.dbg	line,	"tests/20020529-1.c", 5; (const_int 8 [0x8])) [5 <variable>.c+0 S2 A8])
+	.dbg	line,	"tests/20020529-1.c", 6; (reg:HI 2 r2 [27]))
+	.dbg	line,	"tests/20020529-1.c", 7; (set (reg/f:SI 2 r2 [31])
+	.dbg	line,	"tests/20020529-1.c", 8; (plus:SI (reg/v/f:SI 0 r0 [24])
+	.dbg	line,	"tests/20020529-1.c", 9; (const_int 8 [0x8])))
+	.dbg	line,	"tests/20020529-1.c", 10; ] ) 24 {*mov_sidehi_mem} (nil)
+	.dbg	line,	"tests/20020529-1.c", 11; (nil))
+	.dbg	line,	"tests/20020529-1.c", 12; forced a splitter through the output pattern "#", but there was no
+	.dbg	line,	"tests/20020529-1.c", 13; matching splitter.  */
+	.dbg	line,	"tests/20020529-1.c", 15; struct xx
+	.dbg	line,	"tests/20020529-1.c", 16; {
+	.dbg	line,	"tests/20020529-1.c", 17; int a;
+	.dbg	line,	"tests/20020529-1.c", 18; struct xx *b;
+	.dbg	line,	"tests/20020529-1.c", 19; short c;
+	.dbg	line,	"tests/20020529-1.c", 20; };
+	.dbg	line,	"tests/20020529-1.c", 22; int f1 (struct xx *);
+	.dbg	line,	"tests/20020529-1.c", 23; void f2 (void);
+	.dbg	line,	"tests/20020529-1.c", 25; int
+	.dbg	line,	"tests/20020529-1.c", 26; foo (struct xx *p, int b, int c, int d)
+	.dbg	line,	"tests/20020529-1.c", 27; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20020529-1.c", 28; int a;
+
+	.dbg	line,	"tests/20020529-1.c", 30; for (;;)
+.LL3:
+.LL4:
+.LL5:
+
+	.dbg	line,	"tests/20020529-1.c", 31; {
+
+	.dbg	line,	"tests/20020529-1.c", 32; a = f1(p);
+	__ld.ws		6  /* p */
+	__pusharg.wr
+	__call		_f1
+	__st.wmq	__foo_end - 2  /* a */
+
+	.dbg	line,	"tests/20020529-1.c", 33; if (a)
+	__tst.wm	__foo_end - 2  /* a */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20020529-1.c", 34; return (0);
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/20020529-1.c", 35; if (b)
+.LL7:
+	__tst.ws	4  /* b */
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20020529-1.c", 36; continue;
+	__bra		.LL5
+
+	.dbg	line,	"tests/20020529-1.c", 37; p->c = d;
+.LL8:
+	__ld.ws		6  /* p */
+	__add.wi	4
+	__push.wr
+	__ld.ws		0  /* d */
+	__st.wtq
+
+	.dbg	line,	"tests/20020529-1.c", 38; if (p->a)
+	__ld.ws		6  /* p */
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20020529-1.c", 39; f2 ();
+	__call		_f2
+
+	.dbg	line,	"tests/20020529-1.c", 40; if (c)
+.LL9:
+	__tst.ws	2  /* c */
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/20020529-1.c", 41; f2 ();
+	__call		_f2
+
+	.dbg	line,	"tests/20020529-1.c", 42; d = p->c;
+.LL10:
+	__ld.ws		6  /* p */
+	__add.wi	4
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wsq	0  /* d */
+
+	.dbg	line,	"tests/20020529-1.c", 43; switch (a)
+	__ld.wm		__foo_end - 2  /* a */
+	__bra		.LL11
+
+	.dbg	line,	"tests/20020529-1.c", 44; {
+
+	.dbg	line,	"tests/20020529-1.c", 45; case 1:
+.LL13:
+	__case		1
+
+	.dbg	line,	"tests/20020529-1.c", 46; if (p->b)
+	__ld.ws		6  /* p */
+	__add.wi	2
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/20020529-1.c", 47; f2 ();
+	__call		_f2
+
+	.dbg	line,	"tests/20020529-1.c", 48; if (c)
+.LL14:
+	__tst.ws	2  /* c */
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/20020529-1.c", 49; f2 ();
+	__call		_f2
+
+	.dbg	line,	"tests/20020529-1.c", 50; default:
+.LL15:
+	__endcase
+.LL16:
+	__default
+
+	.dbg	line,	"tests/20020529-1.c", 51; break;
+	__bra		.LL12
+
+	.dbg	line,	"tests/20020529-1.c", 52; }
+.LL11:
+	__switch_r.wr	0, 1
+
+!table:		dw	.LL16, .LL13
+		dw	.LL16
+.LL12	.alias		.LL5
+
+	.dbg	line,	"tests/20020529-1.c", 53; }
+.LL6:
+
+	.dbg	line,	"tests/20020529-1.c", 54; return d;
+.LL2:
+
+	.dbg	line,	"tests/20020529-1.c", 55; }
+	__modsp		8
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20020529-1.c", 57; int main (void)
+	.dbg	line,	"tests/20020529-1.c", 58; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020529-1.c", 59; struct xx s;// = {0, &s, 23};
+
+	.dbg	line,	"tests/20020529-1.c", 60; s.a = 0; s.b = &s; s.c = 23;
+	__st.wmiq	0, __main_end - 6  /* s */
+	__ld.wi		__main_end - 6  /* s */
+	__st.wmq	__main_end - 6 + 2  /* s */
+	__st.wmiq	23, __main_end - 6 + 4  /* s */
+
+	.dbg	line,	"tests/20020529-1.c", 61; if (foo (&s, 0, 0, 0) != 0 || s.a != 0 || s.b != &s || s.c != 0)
+	__ld.wi		__main_end - 6  /* s */
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_foo
+	__tst.wr
+	__btrue		.LL19
+	__tst.wm	__main_end - 6  /* s */
+.LL19:
+	__btrue		.LL20
+	__ld.wm		__main_end - 6 + 2  /* s */
+	__neq_w.wi	__main_end - 6  /* s */
+.LL20:
+	__btrue		.LL21
+	__tst.wm	__main_end - 6 + 4  /* s */
+.LL21:
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/20020529-1.c", 62; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20020529-1.c", 63; exit (0);
+.LL18:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020529-1.c", 64; }
+.LL17:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20020529-1.c", 66; int
+	.dbg	line,	"tests/20020529-1.c", 67; f1 (struct xx *p)
+	.dbg	line,	"tests/20020529-1.c", 68; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f1
+	__enter		_f1
+
+	.dbg	line,	"tests/20020529-1.c", 69; static int beenhere;// = 0;
+
+	.dbg	line,	"tests/20020529-1.c", 70; if (beenhere++ > 1)
+	__ldinc.wm	SL23  /* beenhere */
+	__sgt_w.wi	1
+	__bfalse	.LL24
+
+	.dbg	line,	"tests/20020529-1.c", 71; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20020529-1.c", 72; return beenhere > 1;
+.LL24:
+	__ld.wm		SL23  /* beenhere */
+	__sgt_w.wi	1
+.LL22:
+	__bool
+
+	.dbg	line,	"tests/20020529-1.c", 73; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20020529-1.c", 75; void
+	.dbg	line,	"tests/20020529-1.c", 76; f2 (void)
+	.dbg	line,	"tests/20020529-1.c", 77; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f2
+	__enter		_f2
+
+	.dbg	line,	"tests/20020529-1.c", 78; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20020529-1.c", 79; }
+.LL25:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:7
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       6     2  _foo
+;       0     6  _main
+;
+; 8 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        66     24     8  overlaid locals
+;         6      6     2  beenhere (static in f1())
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 8, 24, 66
+__foo_end	=	__overlay_frames + 8
+__main_end	=	__overlay_frames + 6
+	auto_zp_var	SL23, 2, 6, 6
+	.endm
@@ -0,0 +1,171 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020614-1.c", 1; /* PR c/6677 */
+	.dbg	line,	"tests/20020614-1.c", 2; /* Verify that GCC doesn't perform illegal simplifications
+	.dbg	line,	"tests/20020614-1.c", 3; when folding constants.  */
+	.dbg	line,	"tests/20020614-1.c", 5; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/20020614-1.c", 7; extern void abort (void);
+	.dbg	line,	"tests/20020614-1.c", 8; extern void exit (int);
+	.dbg	line,	"tests/20020614-1.c", 10; int main (void)
+	.dbg	line,	"tests/20020614-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020614-1.c", 12; int i;
+
+	.dbg	line,	"tests/20020614-1.c", 13; signed char j;
+
+	.dbg	line,	"tests/20020614-1.c", 14; unsigned char k;
+
+	.dbg	line,	"tests/20020614-1.c", 16; i = SCHAR_MAX;
+	__st.wmiq	127, __main_end - 2  /* i */
+
+	.dbg	line,	"tests/20020614-1.c", 18; j = ((signed char) (i << 1)) / 2;
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	1
+	__ext.br
+	__sdiv.wi	2
+	__st.umq	__main_end - 3  /* j */
+
+	.dbg	line,	"tests/20020614-1.c", 20; if (j != -1)
+	__ld.bm		__main_end - 3  /* j */
+	__neq_w.wi	-1
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20020614-1.c", 21; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20020614-1.c", 23; j = ((signed char) (i * 2)) / 2;
+.LL3:
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	1
+	__ext.br
+	__sdiv.wi	2
+	__st.umq	__main_end - 3  /* j */
+
+	.dbg	line,	"tests/20020614-1.c", 25; if (j != -1)
+	__ld.bm		__main_end - 3  /* j */
+	__neq_w.wi	-1
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20020614-1.c", 26; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20020614-1.c", 28; i = UCHAR_MAX;
+.LL4:
+	__st.wmiq	255, __main_end - 2  /* i */
+
+	.dbg	line,	"tests/20020614-1.c", 30; k = ((unsigned char) (i << 1)) / 2;
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	1
+	__ext.ur
+	__sdiv.wi	2
+	__st.umq	__main_end - 4  /* k */
+
+	.dbg	line,	"tests/20020614-1.c", 32; if (k != UCHAR_MAX/2)
+	__neq_b.uiq	127
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20020614-1.c", 33; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20020614-1.c", 35; k = ((unsigned char) (i * 2)) / 2;
+.LL5:
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	1
+	__ext.ur
+	__sdiv.wi	2
+	__st.umq	__main_end - 4  /* k */
+
+	.dbg	line,	"tests/20020614-1.c", 37; if (k != UCHAR_MAX/2)
+	__neq_b.uiq	127
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20020614-1.c", 38; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20020614-1.c", 40; exit(0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020614-1.c", 41; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,200 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020716-1.c", 1; extern void abort (void);
+	.dbg	line,	"tests/20020716-1.c", 2; extern void exit (int);
+	.dbg	line,	"tests/20020716-1.c", 4; int sub1 (int val)
+	.dbg	line,	"tests/20020716-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_sub1
+	__enter		_sub1
+
+	.dbg	line,	"tests/20020716-1.c", 6; return val;
+	__ld.ws		0  /* val */
+.LL2:
+
+	.dbg	line,	"tests/20020716-1.c", 7; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20020716-1.c", 9; int testcond (int val)
+	.dbg	line,	"tests/20020716-1.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_testcond
+	__enter		_testcond
+
+	.dbg	line,	"tests/20020716-1.c", 11; int flag1;
+
+	.dbg	line,	"tests/20020716-1.c", 13; {
+
+	.dbg	line,	"tests/20020716-1.c", 14; int t1; t1 = val;
+	__ld.ws		0  /* val */
+	__st.wmq	__testcond_end - 4  /* t1 */
+
+	.dbg	line,	"tests/20020716-1.c", 15; {
+
+	.dbg	line,	"tests/20020716-1.c", 16; int t2; t2 = t1;
+	__st.wmq	__testcond_end - 6  /* t2 */
+
+	.dbg	line,	"tests/20020716-1.c", 17; {
+
+	.dbg	line,	"tests/20020716-1.c", 18; flag1 = sub1 (t2) ==0;
+	__pusharg.wr
+	__ld.ws		0  /* val */
+.LL4:
+	__modsp		2
+	__boolnot.wr
+	__st.wmq	__testcond_end - 2  /* flag1 */
+
+	.dbg	line,	"tests/20020716-1.c", 19; goto lab1;
+	__modsp_goto	.LL5_stkp
+
+	.dbg	line,	"tests/20020716-1.c", 20; };
+
+	.dbg	line,	"tests/20020716-1.c", 21; }
+
+	.dbg	line,	"tests/20020716-1.c", 22; lab1: ;
+.LL5_stkp	=	0
+.LL5:
+
+	.dbg	line,	"tests/20020716-1.c", 23; }
+
+	.dbg	line,	"tests/20020716-1.c", 25; if (flag1 != 0)
+	__tst.wm	__testcond_end - 2  /* flag1 */
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20020716-1.c", 26; return 0x4d00;
+	__ld.wi		19712
+	__bra		.LL3
+
+	.dbg	line,	"tests/20020716-1.c", 27; else
+.LL6:
+
+	.dbg	line,	"tests/20020716-1.c", 28; return 0;
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/20020716-1.c", 29; }
+.LL3:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20020716-1.c", 31; int main (void)
+	.dbg	line,	"tests/20020716-1.c", 32; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020716-1.c", 33; if (testcond (1))
+	__ld.wi		1
+	__pusharg.wr
+	__call		_testcond
+	__tst.wr
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20020716-1.c", 34; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20020716-1.c", 35; exit (0);
+.LL9:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020716-1.c", 36; }
+.LL8:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _testcond
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        12     12     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 12, 12
+__testcond_end	=	__overlay_frames + 6
+	.endm
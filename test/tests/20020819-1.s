@@ -0,0 +1,178 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020819-1.c", 1; foo ()
+	.dbg	line,	"tests/20020819-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20020819-1.c", 3; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20020819-1.c", 4; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20020819-1.c", 6; main()
+	.dbg	line,	"tests/20020819-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020819-1.c", 8; int i, j, k, ccp_bad; ccp_bad = 0;
+	__st.wmiq	0, __main_end - 8  /* ccp_bad */
+
+	.dbg	line,	"tests/20020819-1.c", 10; for (i = 0; i < 10; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL4:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	10
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20020819-1.c", 11; {
+
+	.dbg	line,	"tests/20020819-1.c", 12; for (j = 0; j < 10; j++)
+	__st.wmiq	0, __main_end - 4  /* j */
+.LL8:
+	__ld.wm		__main_end - 4  /* j */
+	__slt_w.wi	10
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+	__inc.wmq	__main_end - 4  /* j */
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/20020819-1.c", 13; if (foo ())
+	__ld.wi		0
+.LL13:
+	__tst.wr
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/20020819-1.c", 14; ccp_bad = 1;
+	__st.wmiq	1, __main_end - 8  /* ccp_bad */
+
+	.dbg	line,	"tests/20020819-1.c", 15; 
+
+	.dbg	line,	"tests/20020819-1.c", 16; k = ccp_bad != 0;
+.LL12	.alias		.LL9
+	__bra		.LL9
+.LL11:
+	__tst.wm	__main_end - 8  /* ccp_bad */
+	__bool
+	__st.wmq	__main_end - 6  /* k */
+
+	.dbg	line,	"tests/20020819-1.c", 17; if (k)
+	__tst.wm	__main_end - 6  /* k */
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/20020819-1.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20020819-1.c", 19; }
+.LL14	.alias		.LL5
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/20020819-1.c", 21; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20020819-1.c", 22; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     8  _main
+;
+; 8 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       610     22     8  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 8, 22, 610
+__main_end	=	__overlay_frames + 8
+	.endm
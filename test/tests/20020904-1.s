@@ -0,0 +1,139 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020904-1.c", 1; /* PR c/7102 */
+	.dbg	line,	"tests/20020904-1.c", 3; /* Verify that GCC zero-extends integer constants
+	.dbg	line,	"tests/20020904-1.c", 4; in unsigned binary operations. */
+	.dbg	line,	"tests/20020904-1.c", 6; //typedef unsigned char u8;
+	.dbg	line,	"tests/20020904-1.c", 7; #define u8 unsigned char
+	.dbg	line,	"tests/20020904-1.c", 9; u8 fun(u8 y)
+	.dbg	line,	"tests/20020904-1.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_fun
+	__enter		_fun
+
+	.dbg	line,	"tests/20020904-1.c", 11; u8 x;x=((u8)255)/y;
+	__ld.wi		255
+	__ext.ur
+	__push.wr
+	__ld.us		0  /* y */
+	__sdiv.wt
+	__st.umq	__fun_end - 1  /* x */
+
+	.dbg	line,	"tests/20020904-1.c", 12; return x;
+	__ld.um		__fun_end - 1  /* x */
+.LL2:
+
+	.dbg	line,	"tests/20020904-1.c", 13; }
+	__modsp		2
+	__ext.ur
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__fun_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20020904-1.c", 15; int main(void)
+	.dbg	line,	"tests/20020904-1.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020904-1.c", 17; if (fun((u8)2) != 127)
+	__ld.wi		2
+	__ext.ur
+	__pusharg.wr
+	__ld.wi		255
+	__ext.ur
+	__push.wr
+	__ld.us		0  /* y */
+	__sdiv.wt
+	__st.umq	__fun_end - 1  /* x */
+	__ld.um		__fun_end - 1  /* x */
+.LL5:
+	__modsp		2
+	__ext.ur
+	__neq_w.wi	127
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20020904-1.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20020904-1.c", 19; return 0;
+.LL4:
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/20020904-1.c", 20; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 1
+leaf_needs	.set	1
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,149 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20020916-1.c", 1; /* Distilled from try_pre_increment in flow.c.  If-conversion inserted
+	.dbg	line,	"tests/20020916-1.c", 2; new instructions at the wrong place on ppc.  */
+	.dbg	line,	"tests/20020916-1.c", 4; int foo(int a)
+	.dbg	line,	"tests/20020916-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20020916-1.c", 6; int x;
+
+	.dbg	line,	"tests/20020916-1.c", 7; x = 0;
+	__st.wmiq	0, __foo_end - 2  /* x */
+
+	.dbg	line,	"tests/20020916-1.c", 8; if (a > 0) x = 1;
+	__ld.ws		0  /* a */
+	__sgt_w.wi	0
+	__bfalse	.LL3
+	__st.wmiq	1, __foo_end - 2  /* x */
+
+	.dbg	line,	"tests/20020916-1.c", 9; if (a < 0) x = 1;
+.LL3:
+	__ld.ws		0  /* a */
+	__slt_w.wi	0
+	__bfalse	.LL4
+	__st.wmiq	1, __foo_end - 2  /* x */
+
+	.dbg	line,	"tests/20020916-1.c", 10; return x;
+.LL4:
+	__ld.wm		__foo_end - 2  /* x */
+.LL2:
+
+	.dbg	line,	"tests/20020916-1.c", 11; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20020916-1.c", 13; int main()
+	.dbg	line,	"tests/20020916-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20020916-1.c", 15; if (foo(1) != 1)
+	__ld.wi		1
+	__pusharg.wr
+	__st.wmiq	0, __foo_end - 2  /* x */
+	__ld.ws		0  /* a */
+	__sgt_w.wi	0
+	__bfalse	.LL7
+	__st.wmiq	1, __foo_end - 2  /* x */
+.LL7:
+	__ld.ws		0  /* a */
+	__slt_w.wi	0
+	__bfalse	.LL8
+	__st.wmiq	1, __foo_end - 2  /* x */
+.LL8:
+	__ld.wm		__foo_end - 2  /* x */
+.LL9:
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20020916-1.c", 16; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20020916-1.c", 17; return 0;
+.LL6:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/20020916-1.c", 18; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,157 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20021010-1.c", 1; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/20021010-1.c", 3; int
+	.dbg	line,	"tests/20021010-1.c", 4; sub ()
+	.dbg	line,	"tests/20021010-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_sub
+	__enter		_sub
+
+	.dbg	line,	"tests/20021010-1.c", 6; int dummy, a;
+
+	.dbg	line,	"tests/20021010-1.c", 7; dummy = 0; a = 16;
+	__st.wmiq	16, __sub_end - 4  /* a */
+
+	.dbg	line,	"tests/20021010-1.c", 9; if (a / INT_MAX / 16 == 0)
+	__ld.wm		__sub_end - 4  /* a */
+	__sdiv.wi	32767
+	__sdiv.wi	16
+	__not.wr
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20021010-1.c", 10; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/20021010-1.c", 11; else
+.LL3:
+
+	.dbg	line,	"tests/20021010-1.c", 12; return a / INT_MAX / 16;
+	__ld.wm		__sub_end - 4  /* a */
+	__sdiv.wi	32767
+	__sdiv.wi	16
+.LL4:
+
+	.dbg	line,	"tests/20021010-1.c", 13; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__sub_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20021010-1.c", 15; int
+	.dbg	line,	"tests/20021010-1.c", 16; main ()
+	.dbg	line,	"tests/20021010-1.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20021010-1.c", 18; if (sub () != 0)
+	__st.wmiq	16, __sub_end - 4  /* a */
+	__ld.wm		__sub_end - 4  /* a */
+	__sdiv.wi	32767
+	__sdiv.wi	16
+	__not.wr
+	__bfalse	.LL7
+	__ld.wi		0
+	__bra		.LL9
+.LL7:
+	__ld.wm		__sub_end - 4  /* a */
+	__sdiv.wi	32767
+	__sdiv.wi	16
+.LL8:
+.LL9:
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20021010-1.c", 19; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20021010-1.c", 21; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20021010-1.c", 22; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
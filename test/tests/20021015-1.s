@@ -0,0 +1,207 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20021015-1.c", 1; /* PR opt/7409.  */
+	.dbg	line,	"tests/20021015-1.c", 3; extern void abort (void);
+	.dbg	line,	"tests/20021015-1.c", 5; char g_list[1];// = { '1' };
+	.dbg	line,	"tests/20021015-1.c", 7; void g (void *p, char *list, int length, char **elementPtr, char **nextPtr)
+	.dbg	line,	"tests/20021015-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/20021015-1.c", 9; if (*nextPtr != g_list)
+	__ld.ws		0  /* nextPtr */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	_g_list
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20021015-1.c", 10; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20021015-1.c", 12; **nextPtr = 0;
+.LL3:
+	__ld.ws		0  /* nextPtr */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.wi		0
+	__st.utq
+
+	.dbg	line,	"tests/20021015-1.c", 13; }
+.LL2:
+	__modsp		10
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20021015-1.c", 15; int main (void)
+	.dbg	line,	"tests/20021015-1.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20021015-1.c", 17; char *element;
+
+	.dbg	line,	"tests/20021015-1.c", 18; int i, length = 100;
+	__st.wmiq	100, __main_end - 6  /* length */
+
+	.dbg	line,	"tests/20021015-1.c", 19; char *list; list = g_list;
+	__ld.wi		_g_list
+	__st.wmq	__main_end - 10  /* list */
+
+	.dbg	line,	"tests/20021015-1.c", 20; g_list[0] = '1';
+	__st.umiq	49, _g_list
+
+	.dbg	line,	"tests/20021015-1.c", 22; for (i = 0; *list != 0; i++) 
+	__st.wmiq	0, __main_end - 4  /* i */
+.LL5:
+	__ld.wm		__main_end - 10  /* list */
+	__st.wm		__ptr
+	__tst.up	__ptr
+	__btrue		.LL7
+	__bra		.LL8
+.LL6:
+	__inc.wmq	__main_end - 4  /* i */
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/20021015-1.c", 23; {
+
+	.dbg	line,	"tests/20021015-1.c", 24; char *prevList; prevList = list;
+	__ld.wm		__main_end - 10  /* list */
+	__st.wmq	__main_end - 12  /* prevList */
+
+	.dbg	line,	"tests/20021015-1.c", 25; g (0, list, length, &element, &list);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wm		__main_end - 10  /* list */
+	__pusharg.wr
+	__ld.wm		__main_end - 6  /* length */
+	__pusharg.wr
+	__ld.wi		__main_end - 2  /* element */
+	__pusharg.wr
+	__ld.wi		__main_end - 10  /* list */
+	__pusharg.wr
+	__ld.ws		0  /* nextPtr */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	_g_list
+	__bfalse	.LL9
+	__call		_abort
+.LL9:
+	__ld.ws		0  /* nextPtr */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.wi		0
+	__st.utq
+.LL10:
+	__modsp		10
+
+	.dbg	line,	"tests/20021015-1.c", 26; length -= (list - prevList);
+	__ld.wm		__main_end - 10  /* list */
+	__sub.wm	__main_end - 12  /* prevList */
+	__isub_st.wmq	__main_end - 6  /* length */
+
+	.dbg	line,	"tests/20021015-1.c", 27; }
+	__bra		.LL6
+.LL8:
+
+	.dbg	line,	"tests/20021015-1.c", 29; return 0;
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"tests/20021015-1.c", 30; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_g_list:
+		ds	1
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    12  _main
+;
+; 12 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       196     28    12  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 12, 28, 196
+__main_end	=	__overlay_frames + 12
+	.endm
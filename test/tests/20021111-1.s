@@ -0,0 +1,175 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20021111-1.c", 1; /* Origin: PR c/8467 */
+	.dbg	line,	"tests/20021111-1.c", 3; extern void abort (void);
+	.dbg	line,	"tests/20021111-1.c", 4; extern void exit (int);
+	.dbg	line,	"tests/20021111-1.c", 6; int aim_callhandler(int sess, int conn, unsigned short family, unsigned short type);
+	.dbg	line,	"tests/20021111-1.c", 8; int aim_callhandler(int sess, int conn, unsigned short family, unsigned short type)
+	.dbg	line,	"tests/20021111-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_aim_callhandler
+	__enter		_aim_callhandler
+
+	.dbg	line,	"tests/20021111-1.c", 10; static int i; i = 0;
+	__st.wmiq	0, SL3  /* i */
+
+	.dbg	line,	"tests/20021111-1.c", 12; if (!conn)
+	__not.ws	4
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20021111-1.c", 13; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/20021111-1.c", 15; if (type == 0xffff)
+.LL4:
+	__ld.ws		0  /* type */
+	__equ_w.wi	65535
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20021111-1.c", 16; {
+
+	.dbg	line,	"tests/20021111-1.c", 17; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/20021111-1.c", 18; }
+
+	.dbg	line,	"tests/20021111-1.c", 20; if (i >= 1)
+.LL5:
+	__ld.wm		SL3  /* i */
+	__sge_w.wi	1
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20021111-1.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20021111-1.c", 23; i++;
+.LL6:
+	__inc.wmq	SL3  /* i */
+
+	.dbg	line,	"tests/20021111-1.c", 24; return aim_callhandler(sess, conn, family, /*(unsigned short)*/ 0xffff);
+	__ld.ws		6  /* sess */
+	__pusharg.wr
+	__ld.ws		6  /* conn */
+	__pusharg.wr
+	__ld.ws		6  /* family */
+	__pusharg.wr
+	__ld.wi		65535
+	__pusharg.wr
+	__call		_aim_callhandler
+.LL2:
+
+	.dbg	line,	"tests/20021111-1.c", 25; }
+	__modsp		8
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20021111-1.c", 27; int main (void)
+	.dbg	line,	"tests/20021111-1.c", 28; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20021111-1.c", 29; aim_callhandler (0, 1, 0, 0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_aim_callhandler
+
+	.dbg	line,	"tests/20021111-1.c", 30; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20021111-1.c", 31; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     2  i (static in aim_callhandler())
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	SL3, 2, 8, 8
+	.endm
@@ -0,0 +1,155 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20021118-3.c", 1; extern void abort (void);
+	.dbg	line,	"tests/20021118-3.c", 2; extern void exit (int);
+	.dbg	line,	"tests/20021118-3.c", 4; int
+	.dbg	line,	"tests/20021118-3.c", 5; foo (int x)
+	.dbg	line,	"tests/20021118-3.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20021118-3.c", 7; if (x == -2 || -x - 100 >= 0)
+	__ld.ws		0  /* x */
+	__equ_w.wi	-2
+	__btrue		.LL4
+	__ld.ws		0  /* x */
+	__neg.wr
+	__sub.wi	100
+	__sge_w.wi	0
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20021118-3.c", 8; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20021118-3.c", 9; return 0;
+.LL3:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20021118-3.c", 10; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20021118-3.c", 11; 
+	.dbg	line,	"tests/20021118-3.c", 12; int
+	.dbg	line,	"tests/20021118-3.c", 13; main ()
+	.dbg	line,	"tests/20021118-3.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20021118-3.c", 15; foo (-3);
+	__ld.wi		-3
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__equ_w.wi	-2
+	__btrue		.LL6
+	__ld.ws		0  /* x */
+	__neg.wr
+	__sub.wi	100
+	__sge_w.wi	0
+.LL6:
+	__bfalse	.LL7
+	__call		_abort
+.LL7:
+	__ld.wi		0
+.LL8:
+	__modsp		2
+
+	.dbg	line,	"tests/20021118-3.c", 16; foo (-99);
+	__ld.wi		-99
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__equ_w.wi	-2
+	__btrue		.LL9
+	__ld.ws		0  /* x */
+	__neg.wr
+	__sub.wi	100
+	__sge_w.wi	0
+.LL9:
+	__bfalse	.LL10
+	__call		_abort
+.LL10:
+	__ld.wi		0
+.LL11:
+	__modsp		2
+
+	.dbg	line,	"tests/20021118-3.c", 17; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20021118-3.c", 18; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,187 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20021120-2.c", 1; int g1, g2;
+	.dbg	line,	"tests/20021120-2.c", 3; void foo (int x)
+	.dbg	line,	"tests/20021120-2.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20021120-2.c", 5; int y;
+
+	.dbg	line,	"tests/20021120-2.c", 7; if (x)
+	__tst.ws	0  /* x */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20021120-2.c", 8; y = 793;
+	__st.wmiq	793, __foo_end - 2  /* y */
+
+	.dbg	line,	"tests/20021120-2.c", 9; else
+	__bra		.LL4
+.LL3:
+
+	.dbg	line,	"tests/20021120-2.c", 10; y = 793;
+	__st.wmiq	793, __foo_end - 2  /* y */
+.LL4:
+
+	.dbg	line,	"tests/20021120-2.c", 11; g1 = 7930 / y;
+	__ld.wi		7930
+	__push.wr
+	__ld.wm		__foo_end - 2  /* y */
+	__sdiv.wt
+	__st.wmq	_g1
+
+	.dbg	line,	"tests/20021120-2.c", 12; g2 = 7930 / x;
+	__ld.wi		7930
+	__push.wr
+	__ld.ws		0  /* x */
+	__sdiv.wt
+	__st.wmq	_g2
+
+	.dbg	line,	"tests/20021120-2.c", 13; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20021120-2.c", 15; int main ()
+	.dbg	line,	"tests/20021120-2.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20021120-2.c", 17; foo (793);
+	__ld.wi		793
+	__pusharg.wr
+	__tst.ws	0  /* x */
+	__bfalse	.LL6
+	__st.wmiq	793, __foo_end - 2  /* y */
+	__bra		.LL7
+.LL6:
+	__st.wmiq	793, __foo_end - 2  /* y */
+.LL7:
+	__ld.wi		7930
+	__push.wr
+	__ld.wm		__foo_end - 2  /* y */
+	__sdiv.wt
+	__st.wmq	_g1
+	__ld.wi		7930
+	__push.wr
+	__ld.ws		0  /* x */
+	__sdiv.wt
+	__st.wmq	_g2
+.LL8:
+	__modsp		2
+
+	.dbg	line,	"tests/20021120-2.c", 18; if (g1 != 10 || g2 != 10)
+	__ld.wm		_g1
+	__neq_w.wi	10
+	__btrue		.LL10
+	__ld.wm		_g2
+	__neq_w.wi	10
+.LL10:
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20021120-2.c", 19; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20021120-2.c", 20; exit (0);
+.LL9:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20021120-2.c", 21; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  g1
+;         6      6     2  g2
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_g1, 2, 6, 6
+	auto_zp_var	_g2, 2, 6, 6
+	.endm
@@ -0,0 +1,168 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20021204-1.c", 1; /* This test was miscompiled when using sibling call optimization,
+	.dbg	line,	"tests/20021204-1.c", 2; because X ? Y : Y - 1 optimization changed X into !X in place
+	.dbg	line,	"tests/20021204-1.c", 3; and haven't reverted it if do_store_flag was successful, so
+	.dbg	line,	"tests/20021204-1.c", 4; when expanding the expression the second time it was
+	.dbg	line,	"tests/20021204-1.c", 5; !X ? Y : Y - 1.  */
+	.dbg	line,	"tests/20021204-1.c", 7; extern void abort (void);
+	.dbg	line,	"tests/20021204-1.c", 8; extern void exit (int);
+	.dbg	line,	"tests/20021204-1.c", 10; void foo (int x)
+	.dbg	line,	"tests/20021204-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20021204-1.c", 12; if (x != 1)
+	__ld.ws		0  /* x */
+	__neq_w.wi	1
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20021204-1.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20021204-1.c", 14; }
+.LL3:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20021204-1.c", 16; int z;
+	.dbg	line,	"tests/20021204-1.c", 18; int main (int argc, char *argv[])
+	.dbg	line,	"tests/20021204-1.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20021204-1.c", 20; char *a, *b; a = "test";
+	__ld.wi		__const1+0
+	__st.wmq	__main_end - 2  /* a */
+
+	.dbg	line,	"tests/20021204-1.c", 21; b = a + 2;
+	__add.wi	2
+	__st.wmq	__main_end - 4  /* b */
+
+	.dbg	line,	"tests/20021204-1.c", 23; foo (z > 0 ? b - a : b - a - 1);
+	__ld.wm		_z
+	__sgt_w.wi	0
+	__bfalse	.LL5
+	__ld.wm		__main_end - 4  /* b */
+	__sub.wm	__main_end - 2  /* a */
+	__bra		.LL6
+.LL5:
+	__ld.wm		__main_end - 4  /* b */
+	__sub.wm	__main_end - 2  /* a */
+	__sub.wi	1
+.LL6:
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__neq_w.wi	1
+	__bfalse	.LL7
+	__call		_abort
+.LL7:
+.LL8:
+	__modsp		2
+
+	.dbg	line,	"tests/20021204-1.c", 24; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20021204-1.c", 25; }
+.LL4:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	't','e','s','t',$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:5
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        14     14     4  overlaid locals
+;         2      2     2  z
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 14, 14
+__main_end	=	__overlay_frames + 4
+	auto_zp_var	_z, 2, 2, 2
+	.endm
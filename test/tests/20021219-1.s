@@ -0,0 +1,159 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20021219-1.c", 1; /* PR optimization/8988 */
+	.dbg	line,	"tests/20021219-1.c", 2; /* Contributed by Kevin Easton */
+	.dbg	line,	"tests/20021219-1.c", 4; void foo(char *p1, /* char ** */ void *p2)
+	.dbg	line,	"tests/20021219-1.c", 5; {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20021219-1.c", 6; 
+	.dbg	line,	"tests/20021219-1.c", 7; int main(void)
+	.dbg	line,	"tests/20021219-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20021219-1.c", 9; char *str, *ptr; str = "foo { xx }";
+	__ld.wi		__const1+0
+	__st.wmq	__main_end - 2  /* str */
+
+	.dbg	line,	"tests/20021219-1.c", 10; ptr = str + 5;
+	__add.wi	5
+	__st.wmq	__main_end - 4  /* ptr */
+
+	.dbg	line,	"tests/20021219-1.c", 12; foo(ptr, &ptr);
+	__pusharg.wr
+	__ld.wi		__main_end - 4  /* ptr */
+	__pusharg.wr
+.LL4:
+	__modsp		4
+
+	.dbg	line,	"tests/20021219-1.c", 14; while (*ptr && (*ptr == 13 || *ptr == 32))
+.LL5:
+	__ld.wm		__main_end - 4  /* ptr */
+	__st.wm		__ptr
+	__tst.up	__ptr
+	__bfalse	.LL7
+	__ld.wm		__main_end - 4  /* ptr */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	13
+	__btrue		.LL8
+	__ld.wm		__main_end - 4  /* ptr */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	32
+.LL8:
+.LL7:
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20021219-1.c", 15; ptr++;
+	__inc.wmq	__main_end - 4  /* ptr */
+	__bra		.LL5
+.LL6:
+
+	.dbg	line,	"tests/20021219-1.c", 17; return 0;
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/20021219-1.c", 18; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'f','o','o',' ','{',' ','x','x'
+		db	' ','}',$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:11
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        74     18     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 18, 74
+__main_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,167 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030105-1.c", 1; const int a[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+	.dbg	line,	"tests/20030105-1.c", 2; int /* __attribute__ ((noinline)) */
+	.dbg	line,	"tests/20030105-1.c", 3; foo ()
+	.dbg	line,	"tests/20030105-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20030105-1.c", 5; int i, sum;
+
+	.dbg	line,	"tests/20030105-1.c", 7; sum = 0;
+	__st.wmiq	0, __foo_end - 4  /* sum */
+
+	.dbg	line,	"tests/20030105-1.c", 8; for (i = 0; i < sizeof (a) / sizeof (/* *a */ int); i++)
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL3:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.wi	8
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20030105-1.c", 9; sum += a[i];
+	__ld2x.wmq	__foo_end - 2  /* i */
+	__ld.wax	_a
+	__add_st.wmq	__foo_end - 4  /* sum */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20030105-1.c", 11; return sum;
+	__ld.wm		__foo_end - 4  /* sum */
+.LL2:
+
+	.dbg	line,	"tests/20030105-1.c", 12; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20030105-1.c", 14; int
+	.dbg	line,	"tests/20030105-1.c", 15; main ()
+	.dbg	line,	"tests/20030105-1.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030105-1.c", 17; if (foo () != 28)
+	__st.wmiq	0, __foo_end - 4  /* sum */
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL9:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.wi	8
+	__btrue		.LL11
+	__bra		.LL12
+.LL10:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL9
+.LL11:
+	__ld2x.wmq	__foo_end - 2  /* i */
+	__ld.wax	_a
+	__add_st.wmq	__foo_end - 4  /* sum */
+	__bra		.LL10
+.LL12:
+	__ld.wm		__foo_end - 4  /* sum */
+.LL13:
+	__neq_w.wi	28
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20030105-1.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20030105-1.c", 19; exit (0);
+.LL8:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20030105-1.c", 20; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_a:
+		dw	0
+		dw	1
+		dw	2
+		dw	3
+		dw	4
+		dw	5
+		dw	6
+		dw	7
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:16
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
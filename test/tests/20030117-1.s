@@ -0,0 +1,174 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030117-1.c", 1; int foo (int, int, int);
+	.dbg	line,	"tests/20030117-1.c", 2; int bar (int, int, int);
+	.dbg	line,	"tests/20030117-1.c", 4; int main (void)
+	.dbg	line,	"tests/20030117-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030117-1.c", 6; if (foo (5, 10, 21) != 12)
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		10
+	__pusharg.wr
+	__ld.wi		21
+	__pusharg.wr
+	__call		_foo
+	__neq_w.wi	12
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20030117-1.c", 7; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20030117-1.c", 9; if (bar (9, 12, 15) != 150)
+.LL3:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.wi		12
+	__pusharg.wr
+	__ld.wi		15
+	__pusharg.wr
+	__call		_bar
+	__neq_w.wi	150
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20030117-1.c", 10; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20030117-1.c", 12; exit (0);
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20030117-1.c", 13; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20030117-1.c", 15; int foo (int x, int y, int z)
+	.dbg	line,	"tests/20030117-1.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20030117-1.c", 17; return (x + y + z) / 3;
+	__ld.ws		4  /* x */
+	__add.ws	2  /* y */
+	__add.ws	0  /* z */
+	__sdiv.wi	3
+.LL5:
+
+	.dbg	line,	"tests/20030117-1.c", 18; }
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20030117-1.c", 20; int bar (int x, int y, int z)
+	.dbg	line,	"tests/20030117-1.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20030117-1.c", 22; return foo (x * x, y * y, z * z);
+	__ld.ws		4  /* x */
+	__push.wr
+	__ld.ws		4  /* x */
+	__mul.wt
+	__pusharg.wr
+	__ld.ws		4  /* y */
+	__push.wr
+	__ld.ws		4  /* y */
+	__mul.wt
+	__pusharg.wr
+	__ld.ws		4  /* z */
+	__push.wr
+	__ld.ws		4  /* z */
+	__mul.wt
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__add.ws	2  /* y */
+	__add.ws	0  /* z */
+	__sdiv.wi	3
+.LL7:
+	__modsp		6
+.LL6:
+
+	.dbg	line,	"tests/20030117-1.c", 23; }
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
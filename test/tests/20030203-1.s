@@ -0,0 +1,181 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030203-1.c", 1; void f(int);
+	.dbg	line,	"tests/20030203-1.c", 2; int do_layer3(int single)
+	.dbg	line,	"tests/20030203-1.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_do_layer3
+	__enter		_do_layer3
+
+	.dbg	line,	"tests/20030203-1.c", 4; int stereo1;
+
+	.dbg	line,	"tests/20030203-1.c", 6; if(single >= 0) /* stream is stereo, but force to mono */
+	__ld.ws		0  /* single */
+	__sge_w.wi	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20030203-1.c", 7; stereo1 = 1;
+	__st.wmiq	1, __do_layer3_end - 2  /* stereo1 */
+
+	.dbg	line,	"tests/20030203-1.c", 8; else
+	__bra		.LL4
+.LL3:
+
+	.dbg	line,	"tests/20030203-1.c", 9; stereo1 = 2;
+	__st.wmiq	2, __do_layer3_end - 2  /* stereo1 */
+.LL4:
+
+	.dbg	line,	"tests/20030203-1.c", 10; f(single);
+	__ld.ws		0  /* single */
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/20030203-1.c", 12; return stereo1;
+	__ld.wm		__do_layer3_end - 2  /* stereo1 */
+.LL2:
+
+	.dbg	line,	"tests/20030203-1.c", 13; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20030203-1.c", 15; extern void abort ();
+	.dbg	line,	"tests/20030203-1.c", 16; int main()
+	.dbg	line,	"tests/20030203-1.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030203-1.c", 18; if (do_layer3(-1) != 2)
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* single */
+	__sge_w.wi	0
+	__bfalse	.LL7
+	__st.wmiq	1, __do_layer3_end - 2  /* stereo1 */
+	__bra		.LL8
+.LL7:
+	__st.wmiq	2, __do_layer3_end - 2  /* stereo1 */
+.LL8:
+	__ld.ws		0  /* single */
+	__pusharg.wr
+	__call		_f
+	__ld.wm		__do_layer3_end - 2  /* stereo1 */
+.LL9:
+	__modsp		2
+	__neq_w.wi	2
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20030203-1.c", 19; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20030203-1.c", 20; return 0;
+.LL6:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/20030203-1.c", 21; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20030203-1.c", 23; void f(int i) {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+.LL10:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _do_layer3
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        12     12     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 12, 12
+__do_layer3_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,159 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030323-1.c", 1; /* { dg-do run } */
+	.dbg	line,	"tests/20030323-1.c", 3; /* PR c/8224 */
+	.dbg	line,	"tests/20030323-1.c", 4; /* Contributed by Mikulas Patocka <mikulas@artax.karlin.mff.cuni.cz> */
+	.dbg	line,	"tests/20030323-1.c", 6; extern void abort (void);
+	.dbg	line,	"tests/20030323-1.c", 8; unsigned f (int x)
+	.dbg	line,	"tests/20030323-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/20030323-1.c", 10; return (unsigned) (x / 2) / 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	2
+	__lsr.wi	1
+.LL2:
+
+	.dbg	line,	"tests/20030323-1.c", 11; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20030323-1.c", 13; unsigned f1 (int x)
+	.dbg	line,	"tests/20030323-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f1
+	__enter		_f1
+
+	.dbg	line,	"tests/20030323-1.c", 15; unsigned xx; xx = x / 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	2
+	__st.wmq	__f1_end - 2  /* xx */
+
+	.dbg	line,	"tests/20030323-1.c", 16; return xx / 2;
+	__lsr.wi	1
+.LL3:
+
+	.dbg	line,	"tests/20030323-1.c", 17; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f1_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20030323-1.c", 19; int main ()
+	.dbg	line,	"tests/20030323-1.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030323-1.c", 21; if (f1 (-5) != f (-5))
+	__ld.wi		-5
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	2
+	__st.wmq	__f1_end - 2  /* xx */
+	__lsr.wi	1
+.LL6:
+	__modsp		2
+	__push.wr
+	__ld.wi		-5
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	2
+	__lsr.wi	1
+.LL7:
+	__modsp		2
+	__neq_w.wt
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20030323-1.c", 22; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20030323-1.c", 23; return 0;
+.LL5:
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"tests/20030323-1.c", 24; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,191 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030401-1.c", 1; /* Testcase for PR fortran/9974.  This was a miscompilation of the g77
+	.dbg	line,	"tests/20030401-1.c", 2; front-end caused by the jump bypassing optimizations not handling
+	.dbg	line,	"tests/20030401-1.c", 3; instructions inserted on CFG edges.  */
+	.dbg	line,	"tests/20030401-1.c", 5; extern void abort ();
+	.dbg	line,	"tests/20030401-1.c", 7; int bar ()
+	.dbg	line,	"tests/20030401-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20030401-1.c", 9; return 1;
+	__ld.wi		1
+.LL2:
+
+	.dbg	line,	"tests/20030401-1.c", 10; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20030401-1.c", 12; void foo (int x)
+	.dbg	line,	"tests/20030401-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20030401-1.c", 14; unsigned char error; error = 0;
+	__st.umiq	0, __foo_end - 1  /* error */
+
+	.dbg	line,	"tests/20030401-1.c", 16; if (! (error = ((x == 0) || bar ())))
+	__not.ws	0
+	__btrue		.LL5
+	__ld.wi		1
+.LL6:
+	__tst.wr
+.LL5:
+	__bool
+	__st.um		__foo_end - 1  /* error */
+	__not.wr
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20030401-1.c", 17; bar ();
+	__ld.wi		1
+.LL7:
+
+	.dbg	line,	"tests/20030401-1.c", 18; if (! error)
+.LL4:
+	__not.um	__foo_end - 1  /* error */
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20030401-1.c", 19; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20030401-1.c", 20; }
+.LL8:
+.LL3:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20030401-1.c", 22; int main()
+	.dbg	line,	"tests/20030401-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030401-1.c", 24; foo (1);
+	__ld.wi		1
+	__pusharg.wr
+	__st.umiq	0, __foo_end - 1  /* error */
+	__not.ws	0
+	__btrue		.LL11
+	__ld.wi		1
+.LL10:
+	__tst.wr
+.LL11:
+	__bool
+	__st.um		__foo_end - 1  /* error */
+	__not.wr
+	__bfalse	.LL13
+	__ld.wi		1
+.LL12:
+.LL13:
+	__not.um	__foo_end - 1  /* error */
+	__bfalse	.LL14
+	__call		_abort
+.LL14:
+.LL15:
+	__modsp		2
+
+	.dbg	line,	"tests/20030401-1.c", 25; return 0;
+	__ld.wi		0
+.LL9:
+
+	.dbg	line,	"tests/20030401-1.c", 26; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20030401-1.c", 27; 
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     1  _foo
+;
+; 1 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        12     12     1  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 1, 12, 12
+__foo_end	=	__overlay_frames + 1
+	.endm
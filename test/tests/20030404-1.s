@@ -0,0 +1,133 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030404-1.c", 1; /* This exposed a bug in tree-ssa-ccp.c.  Since 'j' and 'i' are never
+	.dbg	line,	"tests/20030404-1.c", 2; defined, CCP was not traversing the edges out of the if(), which caused
+	.dbg	line,	"tests/20030404-1.c", 3; the PHI node for 'k' at the top of the while to only be visited once.
+	.dbg	line,	"tests/20030404-1.c", 4; This ended up causing CCP to think that 'k' was the constant '1'.  */
+	.dbg	line,	"tests/20030404-1.c", 5; main()
+	.dbg	line,	"tests/20030404-1.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030404-1.c", 7; int i, j, k;
+
+	.dbg	line,	"tests/20030404-1.c", 9; k = 0;
+	__st.wmiq	0, __main_end - 6  /* k */
+
+	.dbg	line,	"tests/20030404-1.c", 10; while (k < 10)
+.LL3:
+	__ld.wm		__main_end - 6  /* k */
+	__slt_w.wi	10
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20030404-1.c", 11; {
+
+	.dbg	line,	"tests/20030404-1.c", 12; k++;
+	__inc.wmq	__main_end - 6  /* k */
+
+	.dbg	line,	"tests/20030404-1.c", 13; if (j > i)
+	__ld.wm		__main_end - 4  /* j */
+	__sgt_w.wm	__main_end - 2  /* i */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20030404-1.c", 14; j = 5;
+	__st.wmiq	5, __main_end - 4  /* j */
+
+	.dbg	line,	"tests/20030404-1.c", 15; else
+	__bra		.LL6
+.LL5:
+
+	.dbg	line,	"tests/20030404-1.c", 16; j =3;
+	__st.wmiq	3, __main_end - 4  /* j */
+.LL6	.alias		.LL3
+
+	.dbg	line,	"tests/20030404-1.c", 17; }
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/20030404-1.c", 19; if (k != 10)
+	__ld.wm		__main_end - 6  /* k */
+	__neq_w.wi	10
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20030404-1.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20030404-1.c", 22; return 0;
+.LL7:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20030404-1.c", 23; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,143 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030828-2.c", 1; struct rtx_def
+	.dbg	line,	"tests/20030828-2.c", 2; {
+	.dbg	line,	"tests/20030828-2.c", 3; int code;
+	.dbg	line,	"tests/20030828-2.c", 4; };
+	.dbg	line,	"tests/20030828-2.c", 6; main()
+	.dbg	line,	"tests/20030828-2.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030828-2.c", 8; int tmp[2];
+
+	.dbg	line,	"tests/20030828-2.c", 9; struct rtx_def *r, s;
+
+	.dbg	line,	"tests/20030828-2.c", 10; int *p, *q;
+
+	.dbg	line,	"tests/20030828-2.c", 12; /* The alias analyzer was creating the same memory tag for r, p and q
+
+	.dbg	line,	"tests/20030828-2.c", 13; because 'struct rtx_def *' is type-compatible with 'int *'.  However,
+
+	.dbg	line,	"tests/20030828-2.c", 14; the alias set of 'int[2]' is not the same as 'int *', so variable
+
+	.dbg	line,	"tests/20030828-2.c", 15; 'tmp' was deemed not aliased with anything.  */
+
+	.dbg	line,	"tests/20030828-2.c", 16; r = &s;
+	__ld.wi		__main_end - 8  /* s */
+	__st.wmq	__main_end - 6  /* r */
+
+	.dbg	line,	"tests/20030828-2.c", 17; r->code = 39;
+	__push.wr
+	__ld.wi		39
+	__st.wtq
+
+	.dbg	line,	"tests/20030828-2.c", 19; /* If 'r' wasn't declared, then q and tmp would have had the same memory
+
+	.dbg	line,	"tests/20030828-2.c", 20; tag.  */
+
+	.dbg	line,	"tests/20030828-2.c", 21; p = tmp;
+	__ld.wi		__main_end - 4  /* tmp */
+	__st.wmq	__main_end - 10  /* p */
+
+	.dbg	line,	"tests/20030828-2.c", 22; q = p + 1;
+	__add.wi	2
+	__st.wmq	__main_end - 12  /* q */
+
+	.dbg	line,	"tests/20030828-2.c", 23; *q = 0;
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+
+	.dbg	line,	"tests/20030828-2.c", 24; tmp[1] = 39;
+	__st.wmiq	39, __main_end - 4 + 2  /* tmp */
+
+	.dbg	line,	"tests/20030828-2.c", 25; if (*q != 39)
+	__ld.wm		__main_end - 12  /* q */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	39
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20030828-2.c", 26; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20030828-2.c", 27; exit (0);
+.LL3:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20030828-2.c", 28; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 12
+leaf_needs	.set	12
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
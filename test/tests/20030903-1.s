@@ -0,0 +1,163 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030903-1.c", 1; /* Test that we don't let stmt.c think that the enumeration's values are
+	.dbg	line,	"tests/20030903-1.c", 2; the entire set of possibilities.  Such an assumption is false for C,
+	.dbg	line,	"tests/20030903-1.c", 3; but true for other languages.  */
+	.dbg	line,	"tests/20030903-1.c", 5; enum X { X1 = 1, X2, X3, X4 };
+	.dbg	line,	"tests/20030903-1.c", 6; static volatile enum X test;// = 0;
+	.dbg	line,	"tests/20030903-1.c", 7; static void y(int);
+	.dbg	line,	"tests/20030903-1.c", 9; int main()
+	.dbg	line,	"tests/20030903-1.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030903-1.c", 11; test = 0;
+	__st.umiq	0, _test
+
+	.dbg	line,	"tests/20030903-1.c", 12; switch (test)
+	__ld.umq	_test
+	__bra		.LL3
+
+	.dbg	line,	"tests/20030903-1.c", 13; {
+
+	.dbg	line,	"tests/20030903-1.c", 14; case X1: y(1); break;
+.LL5:
+	__case		1
+	__ld.wi		1
+	__pusharg.wr
+	__call		_y
+	__bra		.LL4
+
+	.dbg	line,	"tests/20030903-1.c", 15; case X2: y(2); break;
+.LL6:
+	__case		2
+	__ld.wi		2
+	__pusharg.wr
+	__call		_y
+	__bra		.LL4
+
+	.dbg	line,	"tests/20030903-1.c", 16; case X3: y(3); break;
+.LL7:
+	__case		3
+	__ld.wi		3
+	__pusharg.wr
+	__call		_y
+	__bra		.LL4
+
+	.dbg	line,	"tests/20030903-1.c", 17; case X4: y(4); break;
+.LL8:
+	__case		4
+	__ld.wi		4
+	__pusharg.wr
+	__call		_y
+	__bra		.LL4
+
+	.dbg	line,	"tests/20030903-1.c", 18; }
+.LL3:
+	__switch_r.ur	0, 4
+
+!table:		dw	.LL4, .LL5, .LL6, .LL7, .LL8
+		dw	.LL4
+.LL4:
+
+	.dbg	line,	"tests/20030903-1.c", 19; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20030903-1.c", 20; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20030903-1.c", 22; static void y(int x) { abort (); }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_y
+	__enter		_y
+	__call		_abort
+.LL9:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         3      3     1  test
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_test, 1, 3, 3
+	.endm
@@ -0,0 +1,190 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030909-1.c", 1; void abort ();
+	.dbg	line,	"tests/20030909-1.c", 2; void exit (int);
+	.dbg	line,	"tests/20030909-1.c", 4; void test(int x, int y)
+	.dbg	line,	"tests/20030909-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/20030909-1.c", 6; if (x == y)
+	__ld.ws		2  /* x */
+	__equ_w.ws	0  /* y */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20030909-1.c", 7; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20030909-1.c", 8; }
+.LL3:
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20030909-1.c", 10; void foo(int x, int y)
+	.dbg	line,	"tests/20030909-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20030909-1.c", 12; if (x == y)
+	__ld.ws		2  /* x */
+	__equ_w.ws	0  /* y */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20030909-1.c", 13; goto a;
+	__modsp_goto	.LL6_stkp
+
+	.dbg	line,	"tests/20030909-1.c", 14; else
+.LL5:
+
+	.dbg	line,	"tests/20030909-1.c", 15; {
+
+	.dbg	line,	"tests/20030909-1.c", 16; a:;
+.LL6_stkp	=	0
+.LL6:
+
+	.dbg	line,	"tests/20030909-1.c", 17; if (x == y)
+	__ld.ws		2  /* x */
+	__equ_w.ws	0  /* y */
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20030909-1.c", 18; goto b;
+	__modsp_goto	.LL9_stkp
+
+	.dbg	line,	"tests/20030909-1.c", 19; else
+.LL8:
+
+	.dbg	line,	"tests/20030909-1.c", 20; {
+
+	.dbg	line,	"tests/20030909-1.c", 21; b:;
+.LL9_stkp	=	0
+.LL9:
+
+	.dbg	line,	"tests/20030909-1.c", 22; if (x != y)
+	__ld.ws		2  /* x */
+	__neq_w.ws	0  /* y */
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/20030909-1.c", 23; test (x, y);
+	__ld.ws		2  /* x */
+	__pusharg.wr
+	__ld.ws		2  /* y */
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__equ_w.ws	0  /* y */
+	__bfalse	.LL12
+	__call		_abort
+.LL12:
+.LL13:
+	__modsp		4
+
+	.dbg	line,	"tests/20030909-1.c", 24; }
+.LL11:
+.LL10:
+
+	.dbg	line,	"tests/20030909-1.c", 25; }
+.LL7:
+
+	.dbg	line,	"tests/20030909-1.c", 26; }
+.LL4:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20030909-1.c", 28; int main(void)
+	.dbg	line,	"tests/20030909-1.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030909-1.c", 30; foo (0, 0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20030909-1.c", 32; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20030909-1.c", 33; }
+.LL14:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,191 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030913-1.c", 1; /* Assignments via pointers pointing to global variables were being killed
+	.dbg	line,	"tests/20030913-1.c", 2; by SSA-DCE.  Test contributed by Paul Brook <paul@nowt.org>  */
+	.dbg	line,	"tests/20030913-1.c", 4; int glob; 
+	.dbg	line,	"tests/20030913-1.c", 5; 
+	.dbg	line,	"tests/20030913-1.c", 6; void 
+	.dbg	line,	"tests/20030913-1.c", 7; fn2(int ** q) 
+	.dbg	line,	"tests/20030913-1.c", 8; { 
+;***********************
+;***********************
+
+	.hucc
+	.proc		_fn2
+	__enter		_fn2
+
+	.dbg	line,	"tests/20030913-1.c", 9; *q = &glob; 
+	__ld.ws		0  /* q */
+	__push.wr
+	__ld.wi		_glob
+	__st.wtq
+
+	.dbg	line,	"tests/20030913-1.c", 10; } 
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20030913-1.c", 11; 
+	.dbg	line,	"tests/20030913-1.c", 12; void test() 
+	.dbg	line,	"tests/20030913-1.c", 13; { 
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/20030913-1.c", 14; int *p; 
+
+	.dbg	line,	"tests/20030913-1.c", 15; 
+
+	.dbg	line,	"tests/20030913-1.c", 16; fn2(&p); 
+	__ld.wi		__test_end - 2  /* p */
+	__pusharg.wr
+	__ld.ws		0  /* q */
+	__push.wr
+	__ld.wi		_glob
+	__st.wtq
+.LL4:
+	__modsp		2
+
+	.dbg	line,	"tests/20030913-1.c", 17; 
+
+	.dbg	line,	"tests/20030913-1.c", 18; *p=42; 
+	__ld.wm		__test_end - 2  /* p */
+	__push.wr
+	__ld.wi		42
+	__st.wtq
+
+	.dbg	line,	"tests/20030913-1.c", 19; } 
+.LL3:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20030913-1.c", 20; 
+	.dbg	line,	"tests/20030913-1.c", 21; int main() 
+	.dbg	line,	"tests/20030913-1.c", 22; { 
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030913-1.c", 23; test(); 
+	__ld.wi		__test_end - 2  /* p */
+	__pusharg.wr
+	__ld.ws		0  /* q */
+	__push.wr
+	__ld.wi		_glob
+	__st.wtq
+.LL6:
+	__modsp		2
+	__ld.wm		__test_end - 2  /* p */
+	__push.wr
+	__ld.wi		42
+	__st.wtq
+.LL7:
+
+	.dbg	line,	"tests/20030913-1.c", 24; if (glob != 42) abort(); 
+	__ld.wm		_glob
+	__neq_w.wi	42
+	__bfalse	.LL8
+	__call		_abort
+
+	.dbg	line,	"tests/20030913-1.c", 25; exit (0); 
+.LL8:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20030913-1.c", 26; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _test
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     2  overlaid locals
+;         8      8     2  glob
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 8, 8
+__test_end	=	__overlay_frames + 2
+	auto_zp_var	_glob, 2, 8, 8
+	.endm
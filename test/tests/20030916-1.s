@@ -0,0 +1,230 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030916-1.c", 1; /* "i" overflows in f().  Check that x[i] is not treated as a giv.  */
+	.dbg	line,	"tests/20030916-1.c", 2; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/20030916-1.c", 4; //#if CHAR_BIT == 8
+	.dbg	line,	"tests/20030916-1.c", 6; void f (unsigned int *x)
+	.dbg	line,	"tests/20030916-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/20030916-1.c", 8; unsigned char i;
+
+	.dbg	line,	"tests/20030916-1.c", 9; int j;
+
+	.dbg	line,	"tests/20030916-1.c", 11; i = 0x10;
+	__st.umiq	16, __f_end - 1  /* i */
+
+	.dbg	line,	"tests/20030916-1.c", 12; for (j = 0; j < 0x10; j++)
+	__st.wmiq	0, __f_end - 3  /* j */
+.LL3:
+	__ld.wm		__f_end - 3  /* j */
+	__slt_w.wi	16
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__f_end - 3  /* j */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20030916-1.c", 13; {
+
+	.dbg	line,	"tests/20030916-1.c", 14; i += 0xe8;
+	__add_st.umiq	232, __f_end - 1  /* i */
+
+	.dbg	line,	"tests/20030916-1.c", 15; x[i] = 0;
+	__ld.um		__f_end - 1  /* i */
+	__asl.wr
+	__add.ws	0  /* x */
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+
+	.dbg	line,	"tests/20030916-1.c", 16; i -= 0xe7;
+	__sub_st.umiq	231, __f_end - 1  /* i */
+
+	.dbg	line,	"tests/20030916-1.c", 17; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20030916-1.c", 18; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20030916-1.c", 20; int main ()
+	.dbg	line,	"tests/20030916-1.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030916-1.c", 22; unsigned int x[STACK_SIZE / 4];
+
+	.dbg	line,	"tests/20030916-1.c", 23; int i;
+
+	.dbg	line,	"tests/20030916-1.c", 25; for (i = 0; i < STACK_SIZE / 4; i++)
+	__st.wmiq	0, __main_end - 66  /* i */
+.LL8:
+	__ld.wm		__main_end - 66  /* i */
+	__slt_w.wi	32
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+	__inc.wmq	__main_end - 66  /* i */
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/20030916-1.c", 26; x[i] = 1;
+	__ld2x.wmq	__main_end - 66  /* i */
+	__st.waxiq	1, __main_end - 64  /* x */
+	__bra		.LL9
+.LL11:
+
+	.dbg	line,	"tests/20030916-1.c", 27; f (x);
+	__ld.wi		__main_end - 64  /* x */
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/20030916-1.c", 28; for (i = 0; i < STACK_SIZE / 4; i++)
+	__st.wmiq	0, __main_end - 66  /* i */
+.LL12:
+	__ld.wm		__main_end - 66  /* i */
+	__slt_w.wi	32
+	__btrue		.LL14
+	__bra		.LL15
+.LL13:
+	__inc.wmq	__main_end - 66  /* i */
+	__bra		.LL12
+.LL14:
+
+	.dbg	line,	"tests/20030916-1.c", 29; if (x[i] != (i >= 0x08 && i < 0xf8))
+	__ld.wm		__main_end - 66  /* i */
+	__sge_w.wi	8
+	__bfalse	.LL17
+	__ld.wm		__main_end - 66  /* i */
+	__slt_w.wi	248
+.LL17:
+	__bool
+	__ld2x.wm	__main_end - 66  /* i */
+	__neq_w.wax	__main_end - 64  /* x */
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/20030916-1.c", 30; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20030916-1.c", 31; exit (0);
+.LL16	.alias		.LL13
+	__bra		.LL13
+.LL15:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20030916-1.c", 32; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20030916-1.c", 33; //#else
+	.dbg	line,	"tests/20030916-1.c", 34; //int main () { exit (0); }
+	.dbg	line,	"tests/20030916-1.c", 35; //#endif
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 3
+leaf_needs	.set	3
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    66  _main
+;
+; 66 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       194     26    66  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 66, 26, 194
+__main_end	=	__overlay_frames + 66
+	.endm
@@ -0,0 +1,132 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20030920-1.c", 1; extern void abort (void);
+	.dbg	line,	"tests/20030920-1.c", 3; const  char *str = "\x7f\xff";
+	.dbg	line,	"tests/20030920-1.c", 4; int main()
+	.dbg	line,	"tests/20030920-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20030920-1.c", 6; int hicount = 0;
+	__st.wmiq	0, __main_end - 2  /* hicount */
+
+	.dbg	line,	"tests/20030920-1.c", 7; unsigned char *c;
+
+	.dbg	line,	"tests/20030920-1.c", 8; for (c = (unsigned char *)str; *c ; c++) {
+	__ld.wm		_str
+	__st.wmq	__main_end - 4  /* c */
+.LL3:
+	__ld.wm		__main_end - 4  /* c */
+	__st.wm		__ptr
+	__tst.up	__ptr
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__main_end - 4  /* c */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20030920-1.c", 9; if (!(((unsigned int)(*c)) < 0x80)) hicount++;
+	__ld.wm		__main_end - 4  /* c */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__uge_b.uiq	128
+	__bfalse	.LL7
+	__inc.wmq	__main_end - 2  /* hicount */
+
+	.dbg	line,	"tests/20030920-1.c", 10; }
+.LL7	.alias		.LL4
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20030920-1.c", 11; if (hicount != 1)
+	__ld.wm		__main_end - 2  /* hicount */
+	__neq_w.wi	1
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20030920-1.c", 12; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20030920-1.c", 13; return 0;
+.LL8:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20030920-1.c", 14; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	$7F,$FF,$00
+_str:
+		dw	__const1+0
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:3
+;	constant pool:2
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
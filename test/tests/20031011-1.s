@@ -0,0 +1,202 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20031011-1.c", 1; /* Check that MAX_EXPR and MIN_EXPR are working properly.  */
+	.dbg	line,	"tests/20031011-1.c", 3; #define MAX(X,Y) ((X) > (Y) ? (X) : (Y))
+	.dbg	line,	"tests/20031011-1.c", 4; #define MIN(X,Y) ((X) < (Y) ? (X) : (Y))
+	.dbg	line,	"tests/20031011-1.c", 6; extern void abort (void);
+	.dbg	line,	"tests/20031011-1.c", 8; int main()
+	.dbg	line,	"tests/20031011-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20031011-1.c", 10; int ll_bitsize, ll_bitpos;
+
+	.dbg	line,	"tests/20031011-1.c", 11; int rl_bitsize, rl_bitpos;
+
+	.dbg	line,	"tests/20031011-1.c", 12; int end_bit;
+
+	.dbg	line,	"tests/20031011-1.c", 14; ll_bitpos = 32;  ll_bitsize = 32;
+	__st.wmiq	32, __main_end - 4  /* ll_bitpos */
+	__st.wmiq	32, __main_end - 2  /* ll_bitsize */
+
+	.dbg	line,	"tests/20031011-1.c", 15; rl_bitpos = 0;   rl_bitsize = 32;
+	__st.wmiq	0, __main_end - 8  /* rl_bitpos */
+	__st.wmiq	32, __main_end - 6  /* rl_bitsize */
+
+	.dbg	line,	"tests/20031011-1.c", 17; end_bit = MAX (ll_bitpos + ll_bitsize, rl_bitpos + rl_bitsize);
+	__ld.wm		__main_end - 4  /* ll_bitpos */
+	__add.wm	__main_end - 2  /* ll_bitsize */
+	__push.wr
+	__ld.wm		__main_end - 8  /* rl_bitpos */
+	__add.wm	__main_end - 6  /* rl_bitsize */
+	__sgt_w.wt
+	__bfalse	.LL3
+	__ld.wm		__main_end - 4  /* ll_bitpos */
+	__add.wm	__main_end - 2  /* ll_bitsize */
+	__bra		.LL4
+.LL3:
+	__ld.wm		__main_end - 8  /* rl_bitpos */
+	__add.wm	__main_end - 6  /* rl_bitsize */
+.LL4:
+	__st.wmq	__main_end - 10  /* end_bit */
+
+	.dbg	line,	"tests/20031011-1.c", 18; if (end_bit != 64)
+	__neq_w.wi	64
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20031011-1.c", 19; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20031011-1.c", 20; end_bit = MAX (rl_bitpos + rl_bitsize, ll_bitpos + ll_bitsize);
+.LL5:
+	__ld.wm		__main_end - 8  /* rl_bitpos */
+	__add.wm	__main_end - 6  /* rl_bitsize */
+	__push.wr
+	__ld.wm		__main_end - 4  /* ll_bitpos */
+	__add.wm	__main_end - 2  /* ll_bitsize */
+	__sgt_w.wt
+	__bfalse	.LL6
+	__ld.wm		__main_end - 8  /* rl_bitpos */
+	__add.wm	__main_end - 6  /* rl_bitsize */
+	__bra		.LL7
+.LL6:
+	__ld.wm		__main_end - 4  /* ll_bitpos */
+	__add.wm	__main_end - 2  /* ll_bitsize */
+.LL7:
+	__st.wmq	__main_end - 10  /* end_bit */
+
+	.dbg	line,	"tests/20031011-1.c", 21; if (end_bit != 64)
+	__neq_w.wi	64
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20031011-1.c", 22; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20031011-1.c", 23; end_bit = MIN (ll_bitpos + ll_bitsize, rl_bitpos + rl_bitsize);
+.LL8:
+	__ld.wm		__main_end - 4  /* ll_bitpos */
+	__add.wm	__main_end - 2  /* ll_bitsize */
+	__push.wr
+	__ld.wm		__main_end - 8  /* rl_bitpos */
+	__add.wm	__main_end - 6  /* rl_bitsize */
+	__slt_w.wt
+	__bfalse	.LL9
+	__ld.wm		__main_end - 4  /* ll_bitpos */
+	__add.wm	__main_end - 2  /* ll_bitsize */
+	__bra		.LL10
+.LL9:
+	__ld.wm		__main_end - 8  /* rl_bitpos */
+	__add.wm	__main_end - 6  /* rl_bitsize */
+.LL10:
+	__st.wmq	__main_end - 10  /* end_bit */
+
+	.dbg	line,	"tests/20031011-1.c", 24; if (end_bit != 32)
+	__neq_w.wi	32
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/20031011-1.c", 25; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20031011-1.c", 26; end_bit = MIN (rl_bitpos + rl_bitsize, ll_bitpos + ll_bitsize);
+.LL11:
+	__ld.wm		__main_end - 8  /* rl_bitpos */
+	__add.wm	__main_end - 6  /* rl_bitsize */
+	__push.wr
+	__ld.wm		__main_end - 4  /* ll_bitpos */
+	__add.wm	__main_end - 2  /* ll_bitsize */
+	__slt_w.wt
+	__bfalse	.LL12
+	__ld.wm		__main_end - 8  /* rl_bitpos */
+	__add.wm	__main_end - 6  /* rl_bitsize */
+	__bra		.LL13
+.LL12:
+	__ld.wm		__main_end - 4  /* ll_bitpos */
+	__add.wm	__main_end - 2  /* ll_bitsize */
+.LL13:
+	__st.wmq	__main_end - 10  /* end_bit */
+
+	.dbg	line,	"tests/20031011-1.c", 27; if (end_bit != 32)
+	__neq_w.wi	32
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/20031011-1.c", 28; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20031011-1.c", 29; return 0;
+.LL14:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20031011-1.c", 30; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 10
+leaf_needs	.set	10
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
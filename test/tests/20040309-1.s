@@ -0,0 +1,228 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20040309-1.c", 1; extern void abort ();
+	.dbg	line,	"tests/20040309-1.c", 3; int foo(unsigned short x)
+	.dbg	line,	"tests/20040309-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20040309-1.c", 5; unsigned short y;
+
+	.dbg	line,	"tests/20040309-1.c", 6; y = x > 32767 ? x - 32768 : 0;
+	__ld.ws		0  /* x */
+	__ugt_w.wi	32767
+	__bfalse	.LL3
+	__ld.ws		0  /* x */
+	__sub.wi	32768
+	__bra		.LL4
+.LL3:
+	__ld.wi		0
+.LL4:
+	__st.wmq	__foo_end - 2  /* y */
+
+	.dbg	line,	"tests/20040309-1.c", 7; return y;
+.LL2:
+
+	.dbg	line,	"tests/20040309-1.c", 8; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040309-1.c", 10; int main()
+	.dbg	line,	"tests/20040309-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20040309-1.c", 12; if (foo (0) != 0)
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__ugt_w.wi	32767
+	__bfalse	.LL7
+	__ld.ws		0  /* x */
+	__sub.wi	32768
+	__bra		.LL8
+.LL7:
+	__ld.wi		0
+.LL8:
+	__st.wmq	__foo_end - 2  /* y */
+.LL9:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20040309-1.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040309-1.c", 14; if (foo (32767) != 0)
+.LL6:
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__ugt_w.wi	32767
+	__bfalse	.LL11
+	__ld.ws		0  /* x */
+	__sub.wi	32768
+	__bra		.LL12
+.LL11:
+	__ld.wi		0
+.LL12:
+	__st.wmq	__foo_end - 2  /* y */
+.LL13:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/20040309-1.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040309-1.c", 16; if (foo (32768) != 0)
+.LL10:
+	__ld.wi		32768
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__ugt_w.wi	32767
+	__bfalse	.LL15
+	__ld.ws		0  /* x */
+	__sub.wi	32768
+	__bra		.LL16
+.LL15:
+	__ld.wi		0
+.LL16:
+	__st.wmq	__foo_end - 2  /* y */
+.LL17:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/20040309-1.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040309-1.c", 18; if (foo (32769) != 1)
+.LL14:
+	__ld.wi		32769
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__ugt_w.wi	32767
+	__bfalse	.LL19
+	__ld.ws		0  /* x */
+	__sub.wi	32768
+	__bra		.LL20
+.LL19:
+	__ld.wi		0
+.LL20:
+	__st.wmq	__foo_end - 2  /* y */
+.LL21:
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/20040309-1.c", 19; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040309-1.c", 20; if (foo (65535) != 32767)
+.LL18:
+	__ld.wi		65535
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__ugt_w.wi	32767
+	__bfalse	.LL23
+	__ld.ws		0  /* x */
+	__sub.wi	32768
+	__bra		.LL24
+.LL23:
+	__ld.wi		0
+.LL24:
+	__st.wmq	__foo_end - 2  /* y */
+.LL25:
+	__modsp		2
+	__neq_w.wi	32767
+	__bfalse	.LL22
+
+	.dbg	line,	"tests/20040309-1.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040309-1.c", 22; return 0;
+.LL22:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/20040309-1.c", 23; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,393 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20040311-1.c", 1; /* Copyright (C) 2004 Free Software Foundation.
+	.dbg	line,	"tests/20040311-1.c", 3; Check that constant folding and RTL simplification of -(x >> y) doesn't
+	.dbg	line,	"tests/20040311-1.c", 4; break anything and produces the expected results.
+	.dbg	line,	"tests/20040311-1.c", 6; Written by Roger Sayle, 11th March 2004.  */
+	.dbg	line,	"tests/20040311-1.c", 8; extern void abort (void);
+	.dbg	line,	"tests/20040311-1.c", 10; #define INT_BITS  (sizeof(int)*8)
+	.dbg	line,	"tests/20040311-1.c", 12; int test1(int x)
+	.dbg	line,	"tests/20040311-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"tests/20040311-1.c", 14; return -(x >> (INT_BITS-1));
+	__ld.ws		0  /* x */
+	__asr.wi	15
+	__neg.wr
+.LL2:
+
+	.dbg	line,	"tests/20040311-1.c", 15; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040311-1.c", 17; int test2(unsigned int x)
+	.dbg	line,	"tests/20040311-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"tests/20040311-1.c", 19; return -(/*(int)*/(x >> (INT_BITS-1)));
+	__ld.ws		0  /* x */
+	__lsr.wi	15
+	__neg.wr
+.LL3:
+
+	.dbg	line,	"tests/20040311-1.c", 20; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040311-1.c", 22; int test3(int x)
+	.dbg	line,	"tests/20040311-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3
+	__enter		_test3
+
+	.dbg	line,	"tests/20040311-1.c", 24; int y;
+
+	.dbg	line,	"tests/20040311-1.c", 25; y = INT_BITS-1;
+	__st.wmiq	15, __test3_end - 2  /* y */
+
+	.dbg	line,	"tests/20040311-1.c", 26; return -(x >> y);
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wm		__test3_end - 2  /* y */
+	__asr.wt
+	__neg.wr
+.LL4:
+
+	.dbg	line,	"tests/20040311-1.c", 27; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test3_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040311-1.c", 29; int test4(unsigned int x)
+	.dbg	line,	"tests/20040311-1.c", 30; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4
+	__enter		_test4
+
+	.dbg	line,	"tests/20040311-1.c", 31; int y;
+
+	.dbg	line,	"tests/20040311-1.c", 32; y = INT_BITS-1;
+	__st.wmiq	15, __test4_end - 2  /* y */
+
+	.dbg	line,	"tests/20040311-1.c", 33; return -(/*(int)*/(x >> y));
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wm		__test4_end - 2  /* y */
+	__lsr.wt
+	__neg.wr
+.LL5:
+
+	.dbg	line,	"tests/20040311-1.c", 34; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test4_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040311-1.c", 36; int main()
+	.dbg	line,	"tests/20040311-1.c", 37; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20040311-1.c", 38; if (test1(0) != 0)
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__asr.wi	15
+	__neg.wr
+.LL8:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20040311-1.c", 39; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 40; if (test1(1) != 0)
+.LL7:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__asr.wi	15
+	__neg.wr
+.LL10:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20040311-1.c", 41; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 42; if (test1(-1) != 1)
+.LL9:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__asr.wi	15
+	__neg.wr
+.LL12:
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/20040311-1.c", 43; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 45; if (test2(0) != 0)
+.LL11:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__lsr.wi	15
+	__neg.wr
+.LL14:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/20040311-1.c", 46; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 47; if (test2(1) != 0)
+.LL13:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__lsr.wi	15
+	__neg.wr
+.LL16:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/20040311-1.c", 48; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 49; if (test2(/*(unsigned int)*/-1) != -1)
+.LL15:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__lsr.wi	15
+	__neg.wr
+.LL18:
+	__modsp		2
+	__neq_w.wi	-1
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/20040311-1.c", 50; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 52; if (test3(0) != 0)
+.LL17:
+	__ld.wi		0
+	__pusharg.wr
+	__st.wmiq	15, __test3_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wm		__test3_end - 2  /* y */
+	__asr.wt
+	__neg.wr
+.LL20:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/20040311-1.c", 53; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 54; if (test3(1) != 0)
+.LL19:
+	__ld.wi		1
+	__pusharg.wr
+	__st.wmiq	15, __test3_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wm		__test3_end - 2  /* y */
+	__asr.wt
+	__neg.wr
+.LL22:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL21
+
+	.dbg	line,	"tests/20040311-1.c", 55; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 56; if (test3(-1) != 1)
+.LL21:
+	__ld.wi		-1
+	__pusharg.wr
+	__st.wmiq	15, __test3_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wm		__test3_end - 2  /* y */
+	__asr.wt
+	__neg.wr
+.LL24:
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/20040311-1.c", 57; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 59; if (test4(0) != 0)
+.LL23:
+	__ld.wi		0
+	__pusharg.wr
+	__st.wmiq	15, __test4_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wm		__test4_end - 2  /* y */
+	__lsr.wt
+	__neg.wr
+.LL26:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL25
+
+	.dbg	line,	"tests/20040311-1.c", 60; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 61; if (test4(1) != 0)
+.LL25:
+	__ld.wi		1
+	__pusharg.wr
+	__st.wmiq	15, __test4_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wm		__test4_end - 2  /* y */
+	__lsr.wt
+	__neg.wr
+.LL28:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/20040311-1.c", 62; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 63; if (test4(/*(unsigned int)*/-1) != -1)
+.LL27:
+	__ld.wi		-1
+	__pusharg.wr
+	__st.wmiq	15, __test4_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wm		__test4_end - 2  /* y */
+	__lsr.wt
+	__neg.wr
+.LL30:
+	__modsp		2
+	__neq_w.wi	-1
+	__bfalse	.LL29
+
+	.dbg	line,	"tests/20040311-1.c", 64; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040311-1.c", 66; return 0;
+.LL29:
+	__ld.wi		0
+.LL6:
+
+	.dbg	line,	"tests/20040311-1.c", 67; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
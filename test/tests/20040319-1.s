@@ -0,0 +1,161 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20040319-1.c", 1; int
+	.dbg	line,	"tests/20040319-1.c", 2; blah (int zzz)
+	.dbg	line,	"tests/20040319-1.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_blah
+	__enter		_blah
+
+	.dbg	line,	"tests/20040319-1.c", 4; int foo;
+
+	.dbg	line,	"tests/20040319-1.c", 5; if (zzz >= 0)
+	__ld.ws		0  /* zzz */
+	__sge_w.wi	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20040319-1.c", 6; return 1;
+	__ld.wi		1
+	__bra		.LL2
+
+	.dbg	line,	"tests/20040319-1.c", 7; foo = (zzz >= 0 ? (zzz) : -(zzz));
+.LL3:
+	__ld.ws		0  /* zzz */
+	__sge_w.wi	0
+	__bfalse	.LL4
+	__ld.ws		0  /* zzz */
+	__bra		.LL5
+.LL4:
+	__ld.ws		0  /* zzz */
+	__neg.wr
+.LL5:
+	__st.wmq	__blah_end - 2  /* foo */
+
+	.dbg	line,	"tests/20040319-1.c", 8; return foo;
+.LL2:
+
+	.dbg	line,	"tests/20040319-1.c", 9; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__blah_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040319-1.c", 11; main()
+	.dbg	line,	"tests/20040319-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20040319-1.c", 13; if (blah (-1) != 1)
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* zzz */
+	__sge_w.wi	0
+	__bfalse	.LL8
+	__ld.wi		1
+	__bra		.LL11
+.LL8:
+	__ld.ws		0  /* zzz */
+	__sge_w.wi	0
+	__bfalse	.LL9
+	__ld.ws		0  /* zzz */
+	__bra		.LL10
+.LL9:
+	__ld.ws		0  /* zzz */
+	__neg.wr
+.LL10:
+	__st.wmq	__blah_end - 2  /* foo */
+.LL11:
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20040319-1.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040319-1.c", 15; else
+	__bra		.LL12
+.LL7:
+
+	.dbg	line,	"tests/20040319-1.c", 16; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+.LL12:
+
+	.dbg	line,	"tests/20040319-1.c", 17; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
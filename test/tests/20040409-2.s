@@ -0,0 +1,1259 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20040409-2.c", 1; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/20040409-2.c", 3; extern void abort ();
+	.dbg	line,	"tests/20040409-2.c", 5; int test1(int x)
+	.dbg	line,	"tests/20040409-2.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"tests/20040409-2.c", 7; return (x ^ INT_MIN) ^ 0x1234;
+	__ld.ws		0  /* x */
+	__eor.wi	-32768
+	__eor.wi	4660
+.LL2:
+
+	.dbg	line,	"tests/20040409-2.c", 8; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 10; unsigned int test1u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1u
+	__enter		_test1u
+
+	.dbg	line,	"tests/20040409-2.c", 12; return (x ^ (unsigned int)INT_MIN) ^ 0x1234;
+	__ld.ws		0  /* x */
+	__eor.wi	-32768
+	__eor.wi	4660
+.LL3:
+
+	.dbg	line,	"tests/20040409-2.c", 13; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 15; int test2(int x)
+	.dbg	line,	"tests/20040409-2.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"tests/20040409-2.c", 17; return (x ^ 0x1234) ^ INT_MIN;
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__eor.wi	-32768
+.LL4:
+
+	.dbg	line,	"tests/20040409-2.c", 18; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 20; unsigned int test2u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2u
+	__enter		_test2u
+
+	.dbg	line,	"tests/20040409-2.c", 22; return (x ^ 0x1234) ^ (unsigned int)INT_MIN;
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__eor.wi	-32768
+.LL5:
+
+	.dbg	line,	"tests/20040409-2.c", 23; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 25; int test3(int x)
+	.dbg	line,	"tests/20040409-2.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3
+	__enter		_test3
+
+	.dbg	line,	"tests/20040409-2.c", 27; return (x + INT_MIN) ^ 0x1234;
+	__ld.ws		0  /* x */
+	__add.wi	-32768
+	__eor.wi	4660
+.LL6:
+
+	.dbg	line,	"tests/20040409-2.c", 28; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 30; unsigned int test3u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 31; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3u
+	__enter		_test3u
+
+	.dbg	line,	"tests/20040409-2.c", 32; return (x + (unsigned int)INT_MIN) ^ 0x1234;
+	__ld.ws		0  /* x */
+	__add.wi	-32768
+	__eor.wi	4660
+.LL7:
+
+	.dbg	line,	"tests/20040409-2.c", 33; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 35; int test4(int x)
+	.dbg	line,	"tests/20040409-2.c", 36; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4
+	__enter		_test4
+
+	.dbg	line,	"tests/20040409-2.c", 37; return (x ^ 0x1234) + INT_MIN;
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__add.wi	-32768
+.LL8:
+
+	.dbg	line,	"tests/20040409-2.c", 38; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 40; unsigned int test4u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 41; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4u
+	__enter		_test4u
+
+	.dbg	line,	"tests/20040409-2.c", 42; return (x ^ 0x1234) + (unsigned int)INT_MIN;
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__add.wi	-32768
+.LL9:
+
+	.dbg	line,	"tests/20040409-2.c", 43; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 45; int test5(int x)
+	.dbg	line,	"tests/20040409-2.c", 46; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5
+	__enter		_test5
+
+	.dbg	line,	"tests/20040409-2.c", 47; return (x - INT_MIN) ^ 0x1234;
+	__ld.ws		0  /* x */
+	__sub.wi	-32768
+	__eor.wi	4660
+.LL10:
+
+	.dbg	line,	"tests/20040409-2.c", 48; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 50; unsigned int test5u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 51; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5u
+	__enter		_test5u
+
+	.dbg	line,	"tests/20040409-2.c", 52; return (x - (unsigned int)INT_MIN) ^ 0x1234;
+	__ld.ws		0  /* x */
+	__sub.wi	-32768
+	__eor.wi	4660
+.LL11:
+
+	.dbg	line,	"tests/20040409-2.c", 53; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 55; int test6(int x)
+	.dbg	line,	"tests/20040409-2.c", 56; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6
+	__enter		_test6
+
+	.dbg	line,	"tests/20040409-2.c", 57; return (x ^ 0x1234) - INT_MIN;
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__sub.wi	-32768
+.LL12:
+
+	.dbg	line,	"tests/20040409-2.c", 58; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 60; unsigned int test6u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 61; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6u
+	__enter		_test6u
+
+	.dbg	line,	"tests/20040409-2.c", 62; return (x ^ 0x1234) - (unsigned int)INT_MIN;
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__sub.wi	-32768
+.LL13:
+
+	.dbg	line,	"tests/20040409-2.c", 63; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 65; int test7(int x)
+	.dbg	line,	"tests/20040409-2.c", 66; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test7
+	__enter		_test7
+
+	.dbg	line,	"tests/20040409-2.c", 67; int y = INT_MIN;
+	__st.wmiq	-32768, __test7_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 68; int z = 0x1234;
+	__st.wmiq	4660, __test7_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 69; return (x ^ y) ^ z;
+	__ld.ws		0  /* x */
+	__eor.wm	__test7_end - 2  /* y */
+	__eor.wm	__test7_end - 4  /* z */
+.LL14:
+
+	.dbg	line,	"tests/20040409-2.c", 70; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test7_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 72; unsigned int test7u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 73; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test7u
+	__enter		_test7u
+
+	.dbg	line,	"tests/20040409-2.c", 74; unsigned int y = (unsigned int)INT_MIN;
+	__st.wmiq	32768, __test7u_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 75; unsigned int z = 0x1234;
+	__st.wmiq	4660, __test7u_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 76; return (x ^ y) ^ z;
+	__ld.ws		0  /* x */
+	__eor.wm	__test7u_end - 2  /* y */
+	__eor.wm	__test7u_end - 4  /* z */
+.LL15:
+
+	.dbg	line,	"tests/20040409-2.c", 77; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test7u_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 79; int test8(int x)
+	.dbg	line,	"tests/20040409-2.c", 80; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test8
+	__enter		_test8
+
+	.dbg	line,	"tests/20040409-2.c", 81; int y = 0x1234;
+	__st.wmiq	4660, __test8_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 82; int z = INT_MIN;
+	__st.wmiq	-32768, __test8_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 83; return (x ^ y) ^ z;
+	__ld.ws		0  /* x */
+	__eor.wm	__test8_end - 2  /* y */
+	__eor.wm	__test8_end - 4  /* z */
+.LL16:
+
+	.dbg	line,	"tests/20040409-2.c", 84; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test8_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 86; unsigned int test8u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 87; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test8u
+	__enter		_test8u
+
+	.dbg	line,	"tests/20040409-2.c", 88; unsigned int y = 0x1234;
+	__st.wmiq	4660, __test8u_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 89; unsigned int z = (unsigned int)INT_MIN;
+	__st.wmiq	32768, __test8u_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 90; return (x ^ y) ^ z;
+	__ld.ws		0  /* x */
+	__eor.wm	__test8u_end - 2  /* y */
+	__eor.wm	__test8u_end - 4  /* z */
+.LL17:
+
+	.dbg	line,	"tests/20040409-2.c", 91; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test8u_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 93; int test9(int x)
+	.dbg	line,	"tests/20040409-2.c", 94; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test9
+	__enter		_test9
+
+	.dbg	line,	"tests/20040409-2.c", 95; int y = INT_MIN;
+	__st.wmiq	-32768, __test9_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 96; int z = 0x1234;
+	__st.wmiq	4660, __test9_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 97; return (x + y) ^ z;
+	__ld.ws		0  /* x */
+	__add.wm	__test9_end - 2  /* y */
+	__eor.wm	__test9_end - 4  /* z */
+.LL18:
+
+	.dbg	line,	"tests/20040409-2.c", 98; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test9_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 100; unsigned int test9u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 101; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test9u
+	__enter		_test9u
+
+	.dbg	line,	"tests/20040409-2.c", 102; unsigned int y = (unsigned int)INT_MIN;
+	__st.wmiq	32768, __test9u_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 103; unsigned int z = 0x1234;
+	__st.wmiq	4660, __test9u_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 104; return (x + y) ^ z;
+	__ld.ws		0  /* x */
+	__add.wm	__test9u_end - 2  /* y */
+	__eor.wm	__test9u_end - 4  /* z */
+.LL19:
+
+	.dbg	line,	"tests/20040409-2.c", 105; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test9u_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 107; int test10(int x)
+	.dbg	line,	"tests/20040409-2.c", 108; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test10
+	__enter		_test10
+
+	.dbg	line,	"tests/20040409-2.c", 109; int y = 0x1234;
+	__st.wmiq	4660, __test10_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 110; int z = INT_MIN;
+	__st.wmiq	-32768, __test10_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 111; return (x ^ y) + z;
+	__ld.ws		0  /* x */
+	__eor.wm	__test10_end - 2  /* y */
+	__add.wm	__test10_end - 4  /* z */
+.LL20:
+
+	.dbg	line,	"tests/20040409-2.c", 112; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test10_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 114; unsigned int test10u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 115; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test10u
+	__enter		_test10u
+
+	.dbg	line,	"tests/20040409-2.c", 116; unsigned int y = 0x1234;
+	__st.wmiq	4660, __test10u_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 117; unsigned int z = (unsigned int)INT_MIN;
+	__st.wmiq	32768, __test10u_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 118; return (x ^ y) + z;
+	__ld.ws		0  /* x */
+	__eor.wm	__test10u_end - 2  /* y */
+	__add.wm	__test10u_end - 4  /* z */
+.LL21:
+
+	.dbg	line,	"tests/20040409-2.c", 119; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test10u_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 121; int test11(int x)
+	.dbg	line,	"tests/20040409-2.c", 122; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test11
+	__enter		_test11
+
+	.dbg	line,	"tests/20040409-2.c", 123; int y = INT_MIN;
+	__st.wmiq	-32768, __test11_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 124; int z = 0x1234;
+	__st.wmiq	4660, __test11_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 125; return (x - y) ^ z;
+	__ld.ws		0  /* x */
+	__sub.wm	__test11_end - 2  /* y */
+	__eor.wm	__test11_end - 4  /* z */
+.LL22:
+
+	.dbg	line,	"tests/20040409-2.c", 126; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test11_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 128; unsigned int test11u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 129; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test11u
+	__enter		_test11u
+
+	.dbg	line,	"tests/20040409-2.c", 130; unsigned int y = (unsigned int)INT_MIN;
+	__st.wmiq	32768, __test11u_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 131; unsigned int z = 0x1234;
+	__st.wmiq	4660, __test11u_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 132; return (x - y) ^ z;
+	__ld.ws		0  /* x */
+	__sub.wm	__test11u_end - 2  /* y */
+	__eor.wm	__test11u_end - 4  /* z */
+.LL23:
+
+	.dbg	line,	"tests/20040409-2.c", 133; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test11u_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 135; int test12(int x)
+	.dbg	line,	"tests/20040409-2.c", 136; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test12
+	__enter		_test12
+
+	.dbg	line,	"tests/20040409-2.c", 137; int y = 0x1234;
+	__st.wmiq	4660, __test12_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 138; int z = INT_MIN;
+	__st.wmiq	-32768, __test12_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 139; return (x ^ y) - z;
+	__ld.ws		0  /* x */
+	__eor.wm	__test12_end - 2  /* y */
+	__sub.wm	__test12_end - 4  /* z */
+.LL24:
+
+	.dbg	line,	"tests/20040409-2.c", 140; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test12_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 142; unsigned int test12u(unsigned int x)
+	.dbg	line,	"tests/20040409-2.c", 143; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test12u
+	__enter		_test12u
+
+	.dbg	line,	"tests/20040409-2.c", 144; unsigned int y = 0x1234;
+	__st.wmiq	4660, __test12u_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-2.c", 145; unsigned int z = (unsigned int)INT_MIN;
+	__st.wmiq	32768, __test12u_end - 4  /* z */
+
+	.dbg	line,	"tests/20040409-2.c", 146; return (x ^ y) - z;
+	__ld.ws		0  /* x */
+	__eor.wm	__test12u_end - 2  /* y */
+	__sub.wm	__test12u_end - 4  /* z */
+.LL25:
+
+	.dbg	line,	"tests/20040409-2.c", 147; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test12u_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 150; void test(int a, int b)
+	.dbg	line,	"tests/20040409-2.c", 151; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/20040409-2.c", 152; if (test1(a) != b)
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__eor.wi	-32768
+	__eor.wi	4660
+.LL28:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/20040409-2.c", 153; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 154; if (test2(a) != b)
+.LL27:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__eor.wi	-32768
+.LL30:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL29
+
+	.dbg	line,	"tests/20040409-2.c", 155; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 156; if (test3(a) != b)
+.LL29:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	-32768
+	__eor.wi	4660
+.LL32:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL31
+
+	.dbg	line,	"tests/20040409-2.c", 157; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 158; if (test4(a) != b)
+.LL31:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__add.wi	-32768
+.LL34:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL33
+
+	.dbg	line,	"tests/20040409-2.c", 159; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 160; if (test5(a) != b)
+.LL33:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sub.wi	-32768
+	__eor.wi	4660
+.LL36:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL35
+
+	.dbg	line,	"tests/20040409-2.c", 161; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 162; if (test6(a) != b)
+.LL35:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__sub.wi	-32768
+.LL38:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL37
+
+	.dbg	line,	"tests/20040409-2.c", 163; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 164; if (test7(a) != b)
+.LL37:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	-32768, __test7_end - 2  /* y */
+	__st.wmiq	4660, __test7_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__eor.wm	__test7_end - 2  /* y */
+	__eor.wm	__test7_end - 4  /* z */
+.LL40:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL39
+
+	.dbg	line,	"tests/20040409-2.c", 165; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 166; if (test8(a) != b)
+.LL39:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	4660, __test8_end - 2  /* y */
+	__st.wmiq	-32768, __test8_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__eor.wm	__test8_end - 2  /* y */
+	__eor.wm	__test8_end - 4  /* z */
+.LL42:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL41
+
+	.dbg	line,	"tests/20040409-2.c", 167; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 168; if (test9(a) != b)
+.LL41:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	-32768, __test9_end - 2  /* y */
+	__st.wmiq	4660, __test9_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__add.wm	__test9_end - 2  /* y */
+	__eor.wm	__test9_end - 4  /* z */
+.LL44:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL43
+
+	.dbg	line,	"tests/20040409-2.c", 169; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 170; if (test10(a) != b)
+.LL43:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	4660, __test10_end - 2  /* y */
+	__st.wmiq	-32768, __test10_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__eor.wm	__test10_end - 2  /* y */
+	__add.wm	__test10_end - 4  /* z */
+.LL46:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL45
+
+	.dbg	line,	"tests/20040409-2.c", 171; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 172; if (test11(a) != b)
+.LL45:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	-32768, __test11_end - 2  /* y */
+	__st.wmiq	4660, __test11_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__sub.wm	__test11_end - 2  /* y */
+	__eor.wm	__test11_end - 4  /* z */
+.LL48:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL47
+
+	.dbg	line,	"tests/20040409-2.c", 173; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 174; if (test12(a) != b)
+.LL47:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	4660, __test12_end - 2  /* y */
+	__st.wmiq	-32768, __test12_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__eor.wm	__test12_end - 2  /* y */
+	__sub.wm	__test12_end - 4  /* z */
+.LL50:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL49
+
+	.dbg	line,	"tests/20040409-2.c", 175; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 176; }
+.LL49:
+.LL26:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 178; void testu(unsigned int a, unsigned int b)
+	.dbg	line,	"tests/20040409-2.c", 179; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_testu
+	__enter		_testu
+
+	.dbg	line,	"tests/20040409-2.c", 180; if (test1u(a) != b)
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__eor.wi	-32768
+	__eor.wi	4660
+.LL53:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL52
+
+	.dbg	line,	"tests/20040409-2.c", 181; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 182; if (test2u(a) != b)
+.LL52:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__eor.wi	-32768
+.LL55:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL54
+
+	.dbg	line,	"tests/20040409-2.c", 183; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 184; if (test3u(a) != b)
+.LL54:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	-32768
+	__eor.wi	4660
+.LL57:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL56
+
+	.dbg	line,	"tests/20040409-2.c", 185; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 186; if (test4u(a) != b)
+.LL56:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__add.wi	-32768
+.LL59:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL58
+
+	.dbg	line,	"tests/20040409-2.c", 187; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 188; if (test5u(a) != b)
+.LL58:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sub.wi	-32768
+	__eor.wi	4660
+.LL61:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL60
+
+	.dbg	line,	"tests/20040409-2.c", 189; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 190; if (test6u(a) != b)
+.LL60:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__eor.wi	4660
+	__sub.wi	-32768
+.LL63:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL62
+
+	.dbg	line,	"tests/20040409-2.c", 191; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 192; if (test7u(a) != b)
+.LL62:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	32768, __test7u_end - 2  /* y */
+	__st.wmiq	4660, __test7u_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__eor.wm	__test7u_end - 2  /* y */
+	__eor.wm	__test7u_end - 4  /* z */
+.LL65:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL64
+
+	.dbg	line,	"tests/20040409-2.c", 193; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 194; if (test8u(a) != b)
+.LL64:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	4660, __test8u_end - 2  /* y */
+	__st.wmiq	32768, __test8u_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__eor.wm	__test8u_end - 2  /* y */
+	__eor.wm	__test8u_end - 4  /* z */
+.LL67:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL66
+
+	.dbg	line,	"tests/20040409-2.c", 195; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 196; if (test9u(a) != b)
+.LL66:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	32768, __test9u_end - 2  /* y */
+	__st.wmiq	4660, __test9u_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__add.wm	__test9u_end - 2  /* y */
+	__eor.wm	__test9u_end - 4  /* z */
+.LL69:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL68
+
+	.dbg	line,	"tests/20040409-2.c", 197; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 198; if (test10u(a) != b)
+.LL68:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	4660, __test10u_end - 2  /* y */
+	__st.wmiq	32768, __test10u_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__eor.wm	__test10u_end - 2  /* y */
+	__add.wm	__test10u_end - 4  /* z */
+.LL71:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL70
+
+	.dbg	line,	"tests/20040409-2.c", 199; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 200; if (test11u(a) != b)
+.LL70:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	32768, __test11u_end - 2  /* y */
+	__st.wmiq	4660, __test11u_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__sub.wm	__test11u_end - 2  /* y */
+	__eor.wm	__test11u_end - 4  /* z */
+.LL73:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL72
+
+	.dbg	line,	"tests/20040409-2.c", 201; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 202; if (test12u(a) != b)
+.LL72:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	4660, __test12u_end - 2  /* y */
+	__st.wmiq	32768, __test12u_end - 4  /* z */
+	__ld.ws		0  /* x */
+	__eor.wm	__test12u_end - 2  /* y */
+	__sub.wm	__test12u_end - 4  /* z */
+.LL75:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL74
+
+	.dbg	line,	"tests/20040409-2.c", 203; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-2.c", 204; }
+.LL74:
+.LL51:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-2.c", 207; int main()
+	.dbg	line,	"tests/20040409-2.c", 208; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20040409-2.c", 209; #if INT_MAX == 2147483647
+
+	.dbg	line,	"tests/20040409-2.c", 210; test(0x00000000,0x80001234);
+
+	.dbg	line,	"tests/20040409-2.c", 211; test(0x00001234,0x80000000);
+
+	.dbg	line,	"tests/20040409-2.c", 212; test(0x80000000,0x00001234);
+
+	.dbg	line,	"tests/20040409-2.c", 213; test(0x80001234,0x00000000);
+
+	.dbg	line,	"tests/20040409-2.c", 214; test(0x7fffffff,0xffffedcb);
+
+	.dbg	line,	"tests/20040409-2.c", 215; test(0xffffffff,0x7fffedcb);
+
+	.dbg	line,	"tests/20040409-2.c", 217; testu(0x00000000,0x80001234);
+
+	.dbg	line,	"tests/20040409-2.c", 218; testu(0x00001234,0x80000000);
+
+	.dbg	line,	"tests/20040409-2.c", 219; testu(0x80000000,0x00001234);
+
+	.dbg	line,	"tests/20040409-2.c", 220; testu(0x80001234,0x00000000);
+
+	.dbg	line,	"tests/20040409-2.c", 221; testu(0x7fffffff,0xffffedcb);
+
+	.dbg	line,	"tests/20040409-2.c", 222; testu(0xffffffff,0x7fffedcb);
+
+	.dbg	line,	"tests/20040409-2.c", 223; #endif
+
+	.dbg	line,	"tests/20040409-2.c", 225; #if INT_MAX == 32767
+
+	.dbg	line,	"tests/20040409-2.c", 226; test(0x0000,0x9234);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		37428
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-2.c", 227; test(0x1234,0x8000);
+	__ld.wi		4660
+	__pusharg.wr
+	__ld.wi		32768
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-2.c", 228; test(0x8000,0x1234);
+	__ld.wi		32768
+	__pusharg.wr
+	__ld.wi		4660
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-2.c", 229; test(0x9234,0x0000);
+	__ld.wi		37428
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-2.c", 230; test(0x7fff,0xedcb);
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		60875
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-2.c", 231; test(0xffff,0x6dcb);
+	__ld.wi		65535
+	__pusharg.wr
+	__ld.wi		28107
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-2.c", 233; testu(0x0000,0x9234);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		37428
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-2.c", 234; testu(0x8000,0x1234);
+	__ld.wi		32768
+	__pusharg.wr
+	__ld.wi		4660
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-2.c", 235; testu(0x1234,0x8000);
+	__ld.wi		4660
+	__pusharg.wr
+	__ld.wi		32768
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-2.c", 236; testu(0x9234,0x0000);
+	__ld.wi		37428
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-2.c", 237; testu(0x7fff,0xedcb);
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		60875
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-2.c", 238; testu(0xffff,0x6dcb);
+	__ld.wi		65535
+	__pusharg.wr
+	__ld.wi		28107
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-2.c", 239; #endif
+
+	.dbg	line,	"tests/20040409-2.c", 241; return 0;
+	__ld.wi		0
+.LL76:
+
+	.dbg	line,	"tests/20040409-2.c", 242; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:28
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,725 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20040409-3.c", 1; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/20040409-3.c", 3; extern void abort ();
+	.dbg	line,	"tests/20040409-3.c", 5; int test1(int x)
+	.dbg	line,	"tests/20040409-3.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"tests/20040409-3.c", 7; return ~(x ^ INT_MIN);
+	__ld.ws		0  /* x */
+	__eor.wi	-32768
+	__com.wr
+.LL2:
+
+	.dbg	line,	"tests/20040409-3.c", 8; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 10; unsigned int test1u(unsigned int x)
+	.dbg	line,	"tests/20040409-3.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1u
+	__enter		_test1u
+
+	.dbg	line,	"tests/20040409-3.c", 12; return ~(x ^ (unsigned int)INT_MIN);
+	__ld.ws		0  /* x */
+	__eor.wi	-32768
+	__com.wr
+.LL3:
+
+	.dbg	line,	"tests/20040409-3.c", 13; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 15; int test2(int x)
+	.dbg	line,	"tests/20040409-3.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"tests/20040409-3.c", 17; return ~(x + INT_MIN);
+	__ld.ws		0  /* x */
+	__add.wi	-32768
+	__com.wr
+.LL4:
+
+	.dbg	line,	"tests/20040409-3.c", 18; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 20; unsigned int test2u(unsigned int x)
+	.dbg	line,	"tests/20040409-3.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2u
+	__enter		_test2u
+
+	.dbg	line,	"tests/20040409-3.c", 22; return ~(x + (unsigned int)INT_MIN);
+	__ld.ws		0  /* x */
+	__add.wi	-32768
+	__com.wr
+.LL5:
+
+	.dbg	line,	"tests/20040409-3.c", 23; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 25; int test3(int x)
+	.dbg	line,	"tests/20040409-3.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3
+	__enter		_test3
+
+	.dbg	line,	"tests/20040409-3.c", 27; return ~(x - INT_MIN);
+	__ld.ws		0  /* x */
+	__sub.wi	-32768
+	__com.wr
+.LL6:
+
+	.dbg	line,	"tests/20040409-3.c", 28; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 30; unsigned int test3u(unsigned int x)
+	.dbg	line,	"tests/20040409-3.c", 31; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3u
+	__enter		_test3u
+
+	.dbg	line,	"tests/20040409-3.c", 32; return ~(x - (unsigned int)INT_MIN);
+	__ld.ws		0  /* x */
+	__sub.wi	-32768
+	__com.wr
+.LL7:
+
+	.dbg	line,	"tests/20040409-3.c", 33; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 35; int test4(int x)
+	.dbg	line,	"tests/20040409-3.c", 36; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4
+	__enter		_test4
+
+	.dbg	line,	"tests/20040409-3.c", 37; int y = INT_MIN;
+	__st.wmiq	-32768, __test4_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-3.c", 38; return ~(x ^ y);
+	__ld.ws		0  /* x */
+	__eor.wm	__test4_end - 2  /* y */
+	__com.wr
+.LL8:
+
+	.dbg	line,	"tests/20040409-3.c", 39; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test4_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 41; unsigned int test4u(unsigned int x)
+	.dbg	line,	"tests/20040409-3.c", 42; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4u
+	__enter		_test4u
+
+	.dbg	line,	"tests/20040409-3.c", 43; unsigned int y; y = (unsigned int)INT_MIN;
+	__st.wmiq	-32768, __test4u_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-3.c", 44; return ~(x ^ y);
+	__ld.ws		0  /* x */
+	__eor.wm	__test4u_end - 2  /* y */
+	__com.wr
+.LL9:
+
+	.dbg	line,	"tests/20040409-3.c", 45; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test4u_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 47; int test5(int x)
+	.dbg	line,	"tests/20040409-3.c", 48; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5
+	__enter		_test5
+
+	.dbg	line,	"tests/20040409-3.c", 49; int y = INT_MIN;
+	__st.wmiq	-32768, __test5_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-3.c", 50; return ~(x + y);
+	__ld.ws		0  /* x */
+	__add.wm	__test5_end - 2  /* y */
+	__com.wr
+.LL10:
+
+	.dbg	line,	"tests/20040409-3.c", 51; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test5_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 53; unsigned int test5u(unsigned int x)
+	.dbg	line,	"tests/20040409-3.c", 54; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5u
+	__enter		_test5u
+
+	.dbg	line,	"tests/20040409-3.c", 55; unsigned int y; y = (unsigned int)INT_MIN;
+	__st.wmiq	-32768, __test5u_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-3.c", 56; return ~(x + y);
+	__ld.ws		0  /* x */
+	__add.wm	__test5u_end - 2  /* y */
+	__com.wr
+.LL11:
+
+	.dbg	line,	"tests/20040409-3.c", 57; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test5u_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 59; int test6(int x)
+	.dbg	line,	"tests/20040409-3.c", 60; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6
+	__enter		_test6
+
+	.dbg	line,	"tests/20040409-3.c", 61; int y = INT_MIN;
+	__st.wmiq	-32768, __test6_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-3.c", 62; return ~(x - y);
+	__ld.ws		0  /* x */
+	__sub.wm	__test6_end - 2  /* y */
+	__com.wr
+.LL12:
+
+	.dbg	line,	"tests/20040409-3.c", 63; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test6_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 65; unsigned int test6u(unsigned int x)
+	.dbg	line,	"tests/20040409-3.c", 66; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6u
+	__enter		_test6u
+
+	.dbg	line,	"tests/20040409-3.c", 67; unsigned int y; y = (unsigned int)INT_MIN;
+	__st.wmiq	-32768, __test6u_end - 2  /* y */
+
+	.dbg	line,	"tests/20040409-3.c", 68; return ~(x - y);
+	__ld.ws		0  /* x */
+	__sub.wm	__test6u_end - 2  /* y */
+	__com.wr
+.LL13:
+
+	.dbg	line,	"tests/20040409-3.c", 69; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test6u_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 73; void test(int a, int b)
+	.dbg	line,	"tests/20040409-3.c", 74; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/20040409-3.c", 75; if (test1(a) != b)
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__eor.wi	-32768
+	__com.wr
+.LL16:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/20040409-3.c", 76; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 77; if (test2(a) != b)
+.LL15:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	-32768
+	__com.wr
+.LL18:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/20040409-3.c", 78; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 79; if (test3(a) != b)
+.LL17:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sub.wi	-32768
+	__com.wr
+.LL20:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/20040409-3.c", 80; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 81; if (test4(a) != b)
+.LL19:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	-32768, __test4_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__eor.wm	__test4_end - 2  /* y */
+	__com.wr
+.LL22:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL21
+
+	.dbg	line,	"tests/20040409-3.c", 82; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 83; if (test5(a) != b)
+.LL21:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	-32768, __test5_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__add.wm	__test5_end - 2  /* y */
+	__com.wr
+.LL24:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/20040409-3.c", 84; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 85; if (test6(a) != b)
+.LL23:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	-32768, __test6_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__sub.wm	__test6_end - 2  /* y */
+	__com.wr
+.LL26:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL25
+
+	.dbg	line,	"tests/20040409-3.c", 86; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 87; }
+.LL25:
+.LL14:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 89; void testu(unsigned int a, unsigned int b)
+	.dbg	line,	"tests/20040409-3.c", 90; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_testu
+	__enter		_testu
+
+	.dbg	line,	"tests/20040409-3.c", 91; if (test1u(a) != b)
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__eor.wi	-32768
+	__com.wr
+.LL29:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL28
+
+	.dbg	line,	"tests/20040409-3.c", 92; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 93; if (test2u(a) != b)
+.LL28:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	-32768
+	__com.wr
+.LL31:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL30
+
+	.dbg	line,	"tests/20040409-3.c", 94; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 95; if (test3u(a) != b)
+.LL30:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sub.wi	-32768
+	__com.wr
+.LL33:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL32
+
+	.dbg	line,	"tests/20040409-3.c", 96; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 97; if (test4u(a) != b)
+.LL32:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	-32768, __test4u_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__eor.wm	__test4u_end - 2  /* y */
+	__com.wr
+.LL35:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL34
+
+	.dbg	line,	"tests/20040409-3.c", 98; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 99; if (test5u(a) != b)
+.LL34:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	-32768, __test5u_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__add.wm	__test5u_end - 2  /* y */
+	__com.wr
+.LL37:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL36
+
+	.dbg	line,	"tests/20040409-3.c", 100; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 101; if (test6u(a) != b)
+.LL36:
+	__ld.ws		2  /* a */
+	__pusharg.wr
+	__st.wmiq	-32768, __test6u_end - 2  /* y */
+	__ld.ws		0  /* x */
+	__sub.wm	__test6u_end - 2  /* y */
+	__com.wr
+.LL39:
+	__modsp		2
+	__neq_w.ws	0  /* b */
+	__bfalse	.LL38
+
+	.dbg	line,	"tests/20040409-3.c", 102; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20040409-3.c", 103; }
+.LL38:
+.LL27:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040409-3.c", 106; int main()
+	.dbg	line,	"tests/20040409-3.c", 107; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20040409-3.c", 108; #if INT_MAX == 2147483647
+
+	.dbg	line,	"tests/20040409-3.c", 109; test(0x00000000,0x7fffffff);
+
+	.dbg	line,	"tests/20040409-3.c", 110; test(0x80000000,0xffffffff);
+
+	.dbg	line,	"tests/20040409-3.c", 111; test(0x12345678,0x6dcba987);
+
+	.dbg	line,	"tests/20040409-3.c", 112; test(0x92345678,0xedcba987);
+
+	.dbg	line,	"tests/20040409-3.c", 113; test(0x7fffffff,0x00000000);
+
+	.dbg	line,	"tests/20040409-3.c", 114; test(0xffffffff,0x80000000);
+
+	.dbg	line,	"tests/20040409-3.c", 116; testu(0x00000000,0x7fffffff);
+
+	.dbg	line,	"tests/20040409-3.c", 117; testu(0x80000000,0xffffffff);
+
+	.dbg	line,	"tests/20040409-3.c", 118; testu(0x12345678,0x6dcba987);
+
+	.dbg	line,	"tests/20040409-3.c", 119; testu(0x92345678,0xedcba987);
+
+	.dbg	line,	"tests/20040409-3.c", 120; testu(0x7fffffff,0x00000000);
+
+	.dbg	line,	"tests/20040409-3.c", 121; testu(0xffffffff,0x80000000);
+
+	.dbg	line,	"tests/20040409-3.c", 122; #endif
+
+	.dbg	line,	"tests/20040409-3.c", 124; #if INT_MAX == 32767
+
+	.dbg	line,	"tests/20040409-3.c", 125; test(0x0000,0x7fff);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-3.c", 126; test(0x8000,0xffff);
+	__ld.wi		32768
+	__pusharg.wr
+	__ld.wi		65535
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-3.c", 127; test(0x1234,0x6dcb);
+	__ld.wi		4660
+	__pusharg.wr
+	__ld.wi		28107
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-3.c", 128; test(0x9234,0xedcb);
+	__ld.wi		37428
+	__pusharg.wr
+	__ld.wi		60875
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-3.c", 129; test(0x7fff,0x0000);
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-3.c", 130; test(0xffff,0x8000);
+	__ld.wi		65535
+	__pusharg.wr
+	__ld.wi		32768
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040409-3.c", 132; testu(0x0000,0x7fff);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-3.c", 133; testu(0x8000,0xffff);
+	__ld.wi		32768
+	__pusharg.wr
+	__ld.wi		65535
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-3.c", 134; testu(0x1234,0x6dcb);
+	__ld.wi		4660
+	__pusharg.wr
+	__ld.wi		28107
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-3.c", 135; testu(0x9234,0xedcb);
+	__ld.wi		37428
+	__pusharg.wr
+	__ld.wi		60875
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-3.c", 136; testu(0x7fff,0x0000);
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-3.c", 137; testu(0xffff,0x8000);
+	__ld.wi		65535
+	__pusharg.wr
+	__ld.wi		32768
+	__pusharg.wr
+	__call		_testu
+
+	.dbg	line,	"tests/20040409-3.c", 138; #endif
+
+	.dbg	line,	"tests/20040409-3.c", 140; return 0;
+	__ld.wi		0
+.LL40:
+
+	.dbg	line,	"tests/20040409-3.c", 141; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:16
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,161 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:07 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20040625-1.c", 1; /* From PR target/16176 */
+	.dbg	line,	"tests/20040625-1.c", 2; struct s { struct s *next; } /*__attribute__ ((packed))*/;
+	.dbg	line,	"tests/20040625-1.c", 4; struct s * /*__attribute__ ((noinline))*/
+	.dbg	line,	"tests/20040625-1.c", 5; maybe_next (struct s *s, int t)
+	.dbg	line,	"tests/20040625-1.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_maybe_next
+	__enter		_maybe_next
+
+	.dbg	line,	"tests/20040625-1.c", 7; if (t)
+	__tst.ws	0  /* t */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20040625-1.c", 8; s = s->next;
+	__ld.ws		2  /* s */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wsq	2  /* s */
+
+	.dbg	line,	"tests/20040625-1.c", 9; return s;
+.LL3:
+	__ld.ws		2  /* s */
+.LL2:
+
+	.dbg	line,	"tests/20040625-1.c", 10; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040625-1.c", 12; int main ()
+	.dbg	line,	"tests/20040625-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20040625-1.c", 14; struct s s1, s2;
+
+	.dbg	line,	"tests/20040625-1.c", 16; s1.next = &s2;
+	__ld.wi		__main_end - 4  /* s2 */
+	__st.wmq	__main_end - 2  /* s1 */
+
+	.dbg	line,	"tests/20040625-1.c", 17; if (maybe_next (&s1, 1) != &s2)
+	__ld.wi		__main_end - 2  /* s1 */
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__tst.ws	0  /* t */
+	__bfalse	.LL6
+	__ld.ws		2  /* s */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wsq	2  /* s */
+.LL6:
+	__ld.ws		2  /* s */
+.LL7:
+	__modsp		4
+	__neq_w.wi	__main_end - 4  /* s2 */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20040625-1.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040625-1.c", 19; exit (0);
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20040625-1.c", 20; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 8, 8
+__main_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,161 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20040820-1.c", 1; /* PR rtl-optimization/17099 */
+	.dbg	line,	"tests/20040820-1.c", 3; extern void exit (int);
+	.dbg	line,	"tests/20040820-1.c", 4; extern void abort (void);
+	.dbg	line,	"tests/20040820-1.c", 6; void
+	.dbg	line,	"tests/20040820-1.c", 7; check (int a)
+	.dbg	line,	"tests/20040820-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_check
+	__enter		_check
+
+	.dbg	line,	"tests/20040820-1.c", 9; if (a != 1)
+	__ld.ws		0  /* a */
+	__neq_w.wi	1
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20040820-1.c", 10; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040820-1.c", 11; }
+.LL3:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040820-1.c", 13; void
+	.dbg	line,	"tests/20040820-1.c", 14; test (int a, int b)
+	.dbg	line,	"tests/20040820-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/20040820-1.c", 16; check ((a ? 1 : 0) | (b ? 2 : 0));
+	__tst.ws	2  /* a */
+	__bfalse	.LL5
+	__ld.wi		1
+	__bra		.LL6
+.LL5:
+	__ld.wi		0
+.LL6:
+	__push.wr
+	__tst.ws	0  /* b */
+	__bfalse	.LL7
+	__ld.wi		2
+	__bra		.LL8
+.LL7:
+	__ld.wi		0
+.LL8:
+	__or.wt
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__neq_w.wi	1
+	__bfalse	.LL9
+	__call		_abort
+.LL9:
+.LL10:
+	__modsp		2
+
+	.dbg	line,	"tests/20040820-1.c", 17; }
+.LL4:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040820-1.c", 19; int
+	.dbg	line,	"tests/20040820-1.c", 20; main (void)
+	.dbg	line,	"tests/20040820-1.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20040820-1.c", 22; test (1, 0);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/20040820-1.c", 23; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20040820-1.c", 24; }
+.LL11:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,161 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20040917-1.c", 1; /* submitted by kenneth zadeck */
+	.dbg	line,	"tests/20040917-1.c", 3; static int test_var;
+	.dbg	line,	"tests/20040917-1.c", 5; /* the idea here is that not only is inlinable, inlinable but since it
+	.dbg	line,	"tests/20040917-1.c", 6; is static, the cgraph node will not be marked as output.  The
+	.dbg	line,	"tests/20040917-1.c", 7; current version of the code ignores these cgraph nodes.  */
+	.dbg	line,	"tests/20040917-1.c", 9; //void not_inlinable()  __attribute__((noinline));
+	.dbg	line,	"tests/20040917-1.c", 11; static void  
+	.dbg	line,	"tests/20040917-1.c", 12; inlinable ()
+	.dbg	line,	"tests/20040917-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_inlinable
+	__enter		_inlinable
+
+	.dbg	line,	"tests/20040917-1.c", 14; test_var = -10;
+	__st.wmiq	-10, _test_var
+
+	.dbg	line,	"tests/20040917-1.c", 15; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040917-1.c", 17; void 
+	.dbg	line,	"tests/20040917-1.c", 18; not_inlinable ()
+	.dbg	line,	"tests/20040917-1.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_not_inlinable
+	__enter		_not_inlinable
+
+	.dbg	line,	"tests/20040917-1.c", 20; inlinable();
+	__st.wmiq	-10, _test_var
+.LL4:
+
+	.dbg	line,	"tests/20040917-1.c", 21; }
+.LL3:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20040917-1.c", 23; main ()
+	.dbg	line,	"tests/20040917-1.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20040917-1.c", 25; test_var = 10;
+	__st.wmiq	10, _test_var
+
+	.dbg	line,	"tests/20040917-1.c", 26; /* Variable test_var should be considered call-clobbered by the call
+
+	.dbg	line,	"tests/20040917-1.c", 27; to not_inlinable().  */
+
+	.dbg	line,	"tests/20040917-1.c", 28; not_inlinable ();
+	__st.wmiq	-10, _test_var
+.LL6:
+.LL7:
+
+	.dbg	line,	"tests/20040917-1.c", 29; if (test_var == 10)
+	__ld.wm		_test_var
+	__equ_w.wi	10
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20040917-1.c", 30; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20040917-1.c", 31; return 0;
+.LL8:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/20040917-1.c", 32; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     2  test_var
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_test_var, 2, 10, 10
+	.endm
@@ -0,0 +1,274 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20041019-1.c", 1; test_store_ccp (int i)
+	.dbg	line,	"tests/20041019-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test_store_ccp
+	__enter		_test_store_ccp
+
+	.dbg	line,	"tests/20041019-1.c", 3; int *p, a, b, c;
+
+	.dbg	line,	"tests/20041019-1.c", 5; if (i < 5)
+	__ld.ws		0  /* i */
+	__slt_w.wi	5
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20041019-1.c", 6; p = &a;
+	__ld.wi		__test_store_ccp_end - 4  /* a */
+	__st.wmq	__test_store_ccp_end - 2  /* p */
+
+	.dbg	line,	"tests/20041019-1.c", 7; else if (i > 8)
+	__bra		.LL4
+.LL3:
+	__ld.ws		0  /* i */
+	__sgt_w.wi	8
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20041019-1.c", 8; p = &b;
+	__ld.wi		__test_store_ccp_end - 6  /* b */
+	__st.wmq	__test_store_ccp_end - 2  /* p */
+
+	.dbg	line,	"tests/20041019-1.c", 9; else
+	__bra		.LL6
+.LL5:
+
+	.dbg	line,	"tests/20041019-1.c", 10; p = &c;
+	__ld.wi		__test_store_ccp_end - 8  /* c */
+	__st.wmq	__test_store_ccp_end - 2  /* p */
+.LL6:
+.LL4:
+
+	.dbg	line,	"tests/20041019-1.c", 12; *p = 10;
+	__ld.wm		__test_store_ccp_end - 2  /* p */
+	__push.wr
+	__ld.wi		10
+	__st.wtq
+
+	.dbg	line,	"tests/20041019-1.c", 13; b = 3;
+	__st.wmiq	3, __test_store_ccp_end - 6  /* b */
+
+	.dbg	line,	"tests/20041019-1.c", 15; /* STORE-CCP was wrongfully propagating 10 into *p.  */
+
+	.dbg	line,	"tests/20041019-1.c", 16; return *p + 2;
+	__ld.wm		__test_store_ccp_end - 2  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+.LL2:
+
+	.dbg	line,	"tests/20041019-1.c", 17; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test_store_ccp_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20041019-1.c", 20; test_store_copy_prop (int i)
+	.dbg	line,	"tests/20041019-1.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test_store_copy_prop
+	__enter		_test_store_copy_prop
+
+	.dbg	line,	"tests/20041019-1.c", 22; int *p, a, b, c;
+
+	.dbg	line,	"tests/20041019-1.c", 24; if (i < 5)
+	__ld.ws		0  /* i */
+	__slt_w.wi	5
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20041019-1.c", 25; p = &a;
+	__ld.wi		__test_store_copy_prop_end - 4  /* a */
+	__st.wmq	__test_store_copy_prop_end - 2  /* p */
+
+	.dbg	line,	"tests/20041019-1.c", 26; else if (i > 8)
+	__bra		.LL9
+.LL8:
+	__ld.ws		0  /* i */
+	__sgt_w.wi	8
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/20041019-1.c", 27; p = &b;
+	__ld.wi		__test_store_copy_prop_end - 6  /* b */
+	__st.wmq	__test_store_copy_prop_end - 2  /* p */
+
+	.dbg	line,	"tests/20041019-1.c", 28; else
+	__bra		.LL11
+.LL10:
+
+	.dbg	line,	"tests/20041019-1.c", 29; p = &c;
+	__ld.wi		__test_store_copy_prop_end - 8  /* c */
+	__st.wmq	__test_store_copy_prop_end - 2  /* p */
+.LL11:
+.LL9:
+
+	.dbg	line,	"tests/20041019-1.c", 31; *p = i;
+	__ld.wm		__test_store_copy_prop_end - 2  /* p */
+	__push.wr
+	__ld.ws		0  /* i */
+	__st.wtq
+
+	.dbg	line,	"tests/20041019-1.c", 32; b = i + 1;
+	__ld.ws		0  /* i */
+	__add.wi	1
+	__st.wmq	__test_store_copy_prop_end - 6  /* b */
+
+	.dbg	line,	"tests/20041019-1.c", 34; /* STORE-COPY-PROP was wrongfully propagating i into *p.  */
+
+	.dbg	line,	"tests/20041019-1.c", 35; return *p;
+	__ld.wm		__test_store_copy_prop_end - 2  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+.LL7:
+
+	.dbg	line,	"tests/20041019-1.c", 36; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test_store_copy_prop_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20041019-1.c", 39; main()
+	.dbg	line,	"tests/20041019-1.c", 40; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20041019-1.c", 41; int x;
+
+	.dbg	line,	"tests/20041019-1.c", 42; 
+
+	.dbg	line,	"tests/20041019-1.c", 43; x = test_store_ccp (10);
+	__ld.wi		10
+	__pusharg.wr
+	__call		_test_store_ccp
+	__st.wmq	__main_end - 2  /* x */
+
+	.dbg	line,	"tests/20041019-1.c", 44; if (x == 12)
+	__equ_w.wi	12
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/20041019-1.c", 45; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20041019-1.c", 46; 
+
+	.dbg	line,	"tests/20041019-1.c", 47; x = test_store_copy_prop (9);
+.LL13:
+	__ld.wi		9
+	__pusharg.wr
+	__call		_test_store_copy_prop
+	__st.wmq	__main_end - 2  /* x */
+
+	.dbg	line,	"tests/20041019-1.c", 48; if (x == 9)
+	__equ_w.wi	9
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/20041019-1.c", 49; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20041019-1.c", 51; return 0;
+.LL14:
+	__ld.wi		0
+.LL12:
+
+	.dbg	line,	"tests/20041019-1.c", 52; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 8
+leaf_needs	.set	8
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 8, 8
+__main_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,203 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20041112-1.c", 1; /* This was failing on Alpha because the comparison (p != -1) was rewritten
+	.dbg	line,	"tests/20041112-1.c", 2; as (p+1 != 0) and p+1 isn't allowed to wrap for pointers.  */
+	.dbg	line,	"tests/20041112-1.c", 4; extern void abort(void);
+	.dbg	line,	"tests/20041112-1.c", 6; //typedef __SIZE_TYPE__ size_t;
+	.dbg	line,	"tests/20041112-1.c", 7; #define __SIZE_TYPE__ unsigned int
+	.dbg	line,	"tests/20041112-1.c", 9; int global;
+	.dbg	line,	"tests/20041112-1.c", 11; static void *foo(int p)
+	.dbg	line,	"tests/20041112-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20041112-1.c", 13; if (p == 0)
+	__not.ws	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20041112-1.c", 14; {
+
+	.dbg	line,	"tests/20041112-1.c", 15; global++;
+	__inc.wmq	_global
+
+	.dbg	line,	"tests/20041112-1.c", 16; return &global;
+	__ld.wi		_global
+	__bra		.LL2
+
+	.dbg	line,	"tests/20041112-1.c", 17; }
+
+	.dbg	line,	"tests/20041112-1.c", 19; return /*(void *)(size_t)*/-1;
+.LL3:
+	__ld.wi		-1
+.LL2:
+
+	.dbg	line,	"tests/20041112-1.c", 20; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20041112-1.c", 22; int bar(void)
+	.dbg	line,	"tests/20041112-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20041112-1.c", 24; void *p;
+
+	.dbg	line,	"tests/20041112-1.c", 26; p = foo(global);
+	__ld.wm		_global
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL5
+	__inc.wmq	_global
+	__ld.wi		_global
+	__bra		.LL6
+.LL5:
+	__ld.wi		-1
+.LL6:
+	__modsp		2
+	__st.wmq	__bar_end - 2  /* p */
+
+	.dbg	line,	"tests/20041112-1.c", 27; if (p != /*(void *)(size_t)*/-1)
+	__neq_w.wi	-1
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20041112-1.c", 28; return 1;
+	__ld.wi		1
+	__bra		.LL4
+
+	.dbg	line,	"tests/20041112-1.c", 30; global++;
+.LL7:
+	__inc.wmq	_global
+
+	.dbg	line,	"tests/20041112-1.c", 31; return 0;
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"tests/20041112-1.c", 32; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20041112-1.c", 34; int main(void)
+	.dbg	line,	"tests/20041112-1.c", 35; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20041112-1.c", 36; global = 1;
+	__st.wmiq	1, _global
+
+	.dbg	line,	"tests/20041112-1.c", 37; if (bar () != 0)
+	__call		_bar
+	__tst.wr
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20041112-1.c", 38; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20041112-1.c", 39; 
+
+	.dbg	line,	"tests/20041112-1.c", 40; return 0;
+.LL9:
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"tests/20041112-1.c", 41; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _bar
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        18     18     2  global
+;         4      4     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_global, 2, 18, 18
+	auto_zp_var	__overlay_frames, 2, 4, 4
+__bar_end	=	__overlay_frames + 2
+	.endm
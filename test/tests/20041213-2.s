@@ -0,0 +1,167 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20041213-2.c", 1; /* PR tree-optimization/18694
+	.dbg	line,	"tests/20041213-2.c", 3; The dominator optimization didn't take the PHI evaluation order
+	.dbg	line,	"tests/20041213-2.c", 4; into account when threading an edge.  */
+	.dbg	line,	"tests/20041213-2.c", 6; //extern void abort (void) __attribute__((noreturn));
+	.dbg	line,	"tests/20041213-2.c", 7; //extern void exit (int) __attribute__((noreturn));
+	.dbg	line,	"tests/20041213-2.c", 9; void //__attribute__((noinline))
+	.dbg	line,	"tests/20041213-2.c", 10; foo (int i)
+	.dbg	line,	"tests/20041213-2.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20041213-2.c", 12; int next_n, j;
+
+	.dbg	line,	"tests/20041213-2.c", 13; next_n = 1;
+	__st.wmiq	1, __foo_end - 2  /* next_n */
+
+	.dbg	line,	"tests/20041213-2.c", 14; j = 0;
+	__st.wmiq	0, __foo_end - 4  /* j */
+
+	.dbg	line,	"tests/20041213-2.c", 16; for (; i != 0; i--)
+.LL3:
+	__tst.ws	0  /* i */
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__dec.wsq	0  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20041213-2.c", 17; {
+
+	.dbg	line,	"tests/20041213-2.c", 18; int n;
+
+	.dbg	line,	"tests/20041213-2.c", 20; for (n = next_n; j < n; j++)
+	__ld.wm		__foo_end - 2  /* next_n */
+	__st.wmq	__foo_end - 6  /* n */
+.LL7:
+	__ld.wm		__foo_end - 4  /* j */
+	__slt_w.wm	__foo_end - 6  /* n */
+	__btrue		.LL9
+	__bra		.LL10
+.LL8:
+	__inc.wmq	__foo_end - 4  /* j */
+	__bra		.LL7
+.LL9:
+
+	.dbg	line,	"tests/20041213-2.c", 21; next_n++;
+	__inc.wmq	__foo_end - 2  /* next_n */
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/20041213-2.c", 23; if (j != n)
+	__ld.wm		__foo_end - 4  /* j */
+	__neq_w.wm	__foo_end - 6  /* n */
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/20041213-2.c", 24; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20041213-2.c", 25; }
+.LL11	.alias		.LL4
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20041213-2.c", 26; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20041213-2.c", 28; int
+	.dbg	line,	"tests/20041213-2.c", 29; main (void)
+	.dbg	line,	"tests/20041213-2.c", 30; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20041213-2.c", 31; foo (2);
+	__ld.wi		2
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20041213-2.c", 32; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20041213-2.c", 33; }
+.LL12:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
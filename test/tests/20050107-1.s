@@ -0,0 +1,170 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20050107-1.c", 1; typedef enum { C = 1, D = 2 } B;
+	.dbg	line,	"tests/20050107-1.c", 2; extern void abort (void);
+	.dbg	line,	"tests/20050107-1.c", 4; struct S
+	.dbg	line,	"tests/20050107-1.c", 5; {
+	.dbg	line,	"tests/20050107-1.c", 6; B a;//__attribute__ ((mode (byte))) a;
+	.dbg	line,	"tests/20050107-1.c", 7; B b;//__attribute__ ((mode (byte))) b;
+	.dbg	line,	"tests/20050107-1.c", 8; };
+	.dbg	line,	"tests/20050107-1.c", 10; void
+	.dbg	line,	"tests/20050107-1.c", 11; foo (struct S *x)
+	.dbg	line,	"tests/20050107-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20050107-1.c", 13; if (x->a != C || x->b != D)
+	__ld.ws		0  /* x */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	1
+	__btrue		.LL4
+	__ld.ws		0  /* x */
+	__add.wi	1
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	2
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20050107-1.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050107-1.c", 15; }
+.LL3:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20050107-1.c", 17; int
+	.dbg	line,	"tests/20050107-1.c", 18; main (void)
+	.dbg	line,	"tests/20050107-1.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20050107-1.c", 20; struct S s;
+
+	.dbg	line,	"tests/20050107-1.c", 21; s.a = C;
+	__st.umiq	1, __main_end - 2  /* s */
+
+	.dbg	line,	"tests/20050107-1.c", 22; s.b = D;
+	__st.umiq	2, __main_end - 2 + 1  /* s */
+
+	.dbg	line,	"tests/20050107-1.c", 23; foo (&s);
+	__ld.wi		__main_end - 2  /* s */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	1
+	__btrue		.LL6
+	__ld.ws		0  /* x */
+	__add.wi	1
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	2
+.LL6:
+	__bfalse	.LL7
+	__call		_abort
+.LL7:
+.LL8:
+	__modsp		2
+
+	.dbg	line,	"tests/20050107-1.c", 24; return 0;
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/20050107-1.c", 25; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 6
+__main_end	=	__overlay_frames + 2
+	.endm
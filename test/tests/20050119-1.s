@@ -0,0 +1,192 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20050119-1.c", 1; /* PR c/19342 */
+	.dbg	line,	"tests/20050119-1.c", 2; //typedef enum { A, B, C, D } E;
+	.dbg	line,	"tests/20050119-1.c", 3; #define E int
+	.dbg	line,	"tests/20050119-1.c", 4; #define A 0
+	.dbg	line,	"tests/20050119-1.c", 5; #define B 1
+	.dbg	line,	"tests/20050119-1.c", 6; #define C 2
+	.dbg	line,	"tests/20050119-1.c", 7; #define D 3
+	.dbg	line,	"tests/20050119-1.c", 9; struct S {
+	.dbg	line,	"tests/20050119-1.c", 10; E /*__attribute__ ((mode (__byte__)))*/ a;
+	.dbg	line,	"tests/20050119-1.c", 11; E /*__attribute__ ((mode (__byte__)))*/ b;
+	.dbg	line,	"tests/20050119-1.c", 12; E /*__attribute__ ((mode (__byte__)))*/ c;
+	.dbg	line,	"tests/20050119-1.c", 13; E /*__attribute__ ((mode (__byte__)))*/ d;
+	.dbg	line,	"tests/20050119-1.c", 14; };
+	.dbg	line,	"tests/20050119-1.c", 16; extern void abort (void);
+	.dbg	line,	"tests/20050119-1.c", 17; extern void exit (int);
+	.dbg	line,	"tests/20050119-1.c", 19; void
+	.dbg	line,	"tests/20050119-1.c", 20; foo (struct S *s)
+	.dbg	line,	"tests/20050119-1.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20050119-1.c", 22; if (s->a != s->b)
+	__ld.ws		0  /* s */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* s */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wt
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20050119-1.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050119-1.c", 24; if (s->c != C)
+.LL3:
+	__ld.ws		0  /* s */
+	__add.wi	4
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	2
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20050119-1.c", 25; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050119-1.c", 26; }
+.LL4:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20050119-1.c", 28; int
+	.dbg	line,	"tests/20050119-1.c", 29; main (void)
+	.dbg	line,	"tests/20050119-1.c", 30; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20050119-1.c", 31; struct S s[2];
+
+	.dbg	line,	"tests/20050119-1.c", 32; s[0].a = B;
+	__st.wmiq	1, __main_end - 16  /* s */
+
+	.dbg	line,	"tests/20050119-1.c", 33; s[0].b = B;
+	__st.wmiq	1, __main_end - 16 + 2  /* s */
+
+	.dbg	line,	"tests/20050119-1.c", 34; s[0].c = C;
+	__st.wmiq	2, __main_end - 16 + 4  /* s */
+
+	.dbg	line,	"tests/20050119-1.c", 35; s[0].d = D;
+	__st.wmiq	3, __main_end - 16 + 6  /* s */
+
+	.dbg	line,	"tests/20050119-1.c", 36; s[1].a = D;
+	__st.wmiq	3, __main_end - 16 + 8  /* s */
+
+	.dbg	line,	"tests/20050119-1.c", 37; s[1].b = C;
+	__st.wmiq	2, __main_end - 16 + 8 + 2  /* s */
+
+	.dbg	line,	"tests/20050119-1.c", 38; s[1].c = B;
+	__st.wmiq	1, __main_end - 16 + 8 + 4  /* s */
+
+	.dbg	line,	"tests/20050119-1.c", 39; s[1].d = A;
+	__st.wmiq	0, __main_end - 16 + 8 + 6  /* s */
+
+	.dbg	line,	"tests/20050119-1.c", 40; foo (s);
+	__ld.wi		__main_end - 16  /* s */
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20050119-1.c", 41; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20050119-1.c", 42; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:11
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    16  _main
+;
+; 16 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        18     18    16  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 16, 18, 18
+__main_end	=	__overlay_frames + 16
+	.endm
@@ -0,0 +1,200 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20050119-2.c", 1; /* PR middle-end/19874 */
+	.dbg	line,	"tests/20050119-2.c", 2; typedef enum { A, B, C, D } E;
+	.dbg	line,	"tests/20050119-2.c", 4; struct S {
+	.dbg	line,	"tests/20050119-2.c", 5; E a;//__attribute__ ((mode (__byte__))) a;
+	.dbg	line,	"tests/20050119-2.c", 6; E b;//__attribute__ ((mode (__byte__))) b;
+	.dbg	line,	"tests/20050119-2.c", 7; E c;//__attribute__ ((mode (__byte__))) c;
+	.dbg	line,	"tests/20050119-2.c", 8; E d;//__attribute__ ((mode (__byte__))) d;
+	.dbg	line,	"tests/20050119-2.c", 9; };
+	.dbg	line,	"tests/20050119-2.c", 11; extern void abort (void);
+	.dbg	line,	"tests/20050119-2.c", 12; extern void exit (int);
+	.dbg	line,	"tests/20050119-2.c", 14; E
+	.dbg	line,	"tests/20050119-2.c", 15; foo (struct S *s)
+	.dbg	line,	"tests/20050119-2.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20050119-2.c", 17; if (s->a != s->b)
+	__ld.ws		0  /* s */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__push.wr
+	__ld.ws		0  /* s */
+	__add.wi	1
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__neq_w.wt
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20050119-2.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050119-2.c", 19; if (s->c != C)
+.LL3:
+	__ld.ws		0  /* s */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	2
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20050119-2.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050119-2.c", 21; return s->d;
+.LL4:
+	__ld.ws		0  /* s */
+	__add.wi	3
+	__st.wm		__ptr
+	__ld.up		__ptr
+.LL2:
+
+	.dbg	line,	"tests/20050119-2.c", 22; }
+	__modsp		2
+	__ext.ur
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20050119-2.c", 24; int
+	.dbg	line,	"tests/20050119-2.c", 25; main (void)
+	.dbg	line,	"tests/20050119-2.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20050119-2.c", 27; struct S s[2];
+
+	.dbg	line,	"tests/20050119-2.c", 28; s[0].a = B;
+	__st.umiq	1, __main_end - 8  /* s */
+
+	.dbg	line,	"tests/20050119-2.c", 29; s[0].b = B;
+	__st.umiq	1, __main_end - 8 + 1  /* s */
+
+	.dbg	line,	"tests/20050119-2.c", 30; s[0].c = C;
+	__st.umiq	2, __main_end - 8 + 2  /* s */
+
+	.dbg	line,	"tests/20050119-2.c", 31; s[0].d = D;
+	__st.umiq	3, __main_end - 8 + 3  /* s */
+
+	.dbg	line,	"tests/20050119-2.c", 32; s[1].a = D;
+	__st.umiq	3, __main_end - 8 + 4  /* s */
+
+	.dbg	line,	"tests/20050119-2.c", 33; s[1].b = C;
+	__st.umiq	2, __main_end - 8 + 4 + 1  /* s */
+
+	.dbg	line,	"tests/20050119-2.c", 34; s[1].c = B;
+	__st.umiq	1, __main_end - 8 + 4 + 2  /* s */
+
+	.dbg	line,	"tests/20050119-2.c", 35; s[1].d = A;
+	__st.umiq	0, __main_end - 8 + 4 + 3  /* s */
+
+	.dbg	line,	"tests/20050119-2.c", 36; if (foo (s) != D)
+	__ld.wi		__main_end - 8  /* s */
+	__pusharg.wr
+	__call		_foo
+	__neq_w.wi	3
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20050119-2.c", 37; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050119-2.c", 38; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20050119-2.c", 39; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     8  _main
+;
+; 8 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        18     18     8  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 8, 18, 18
+__main_end	=	__overlay_frames + 8
+	.endm
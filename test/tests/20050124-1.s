@@ -0,0 +1,406 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20050124-1.c", 1; /* PR rtl-optimization/19579 */
+	.dbg	line,	"tests/20050124-1.c", 3; extern void abort (void);
+	.dbg	line,	"tests/20050124-1.c", 5; int
+	.dbg	line,	"tests/20050124-1.c", 6; foo (int i, int j)
+	.dbg	line,	"tests/20050124-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20050124-1.c", 8; int k; k = i + 1;
+	__ld.ws		2  /* i */
+	__add.wi	1
+	__st.wmq	__foo_end - 2  /* k */
+
+	.dbg	line,	"tests/20050124-1.c", 10; if (j)
+	__tst.ws	0  /* j */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20050124-1.c", 11; {
+
+	.dbg	line,	"tests/20050124-1.c", 12; if (k > 0)
+	__ld.wm		__foo_end - 2  /* k */
+	__sgt_w.wi	0
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20050124-1.c", 13; k++;
+	__inc.wmq	__foo_end - 2  /* k */
+
+	.dbg	line,	"tests/20050124-1.c", 14; else if (k < 0)
+	__bra		.LL5
+.LL4:
+	__ld.wm		__foo_end - 2  /* k */
+	__slt_w.wi	0
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20050124-1.c", 15; k--;
+	__dec.wmq	__foo_end - 2  /* k */
+
+	.dbg	line,	"tests/20050124-1.c", 16; }
+.LL6:
+.LL5:
+
+	.dbg	line,	"tests/20050124-1.c", 18; return k;
+.LL3:
+	__ld.wm		__foo_end - 2  /* k */
+.LL2:
+
+	.dbg	line,	"tests/20050124-1.c", 19; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20050124-1.c", 21; int
+	.dbg	line,	"tests/20050124-1.c", 22; main (void)
+	.dbg	line,	"tests/20050124-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20050124-1.c", 24; if (foo (-2, 0) != -1)
+	__ld.wi		-2
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* i */
+	__add.wi	1
+	__st.wmq	__foo_end - 2  /* k */
+	__tst.ws	0  /* j */
+	__bfalse	.LL12
+	__ld.wm		__foo_end - 2  /* k */
+	__sgt_w.wi	0
+	__bfalse	.LL9
+	__inc.wmq	__foo_end - 2  /* k */
+	__bra		.LL11
+.LL9:
+	__ld.wm		__foo_end - 2  /* k */
+	__slt_w.wi	0
+	__bfalse	.LL10
+	__dec.wmq	__foo_end - 2  /* k */
+.LL10:
+.LL11:
+.LL12:
+	__ld.wm		__foo_end - 2  /* k */
+.LL13:
+	__modsp		4
+	__neq_w.wi	-1
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20050124-1.c", 25; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050124-1.c", 26; if (foo (-1, 0) != 0)
+.LL8:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* i */
+	__add.wi	1
+	__st.wmq	__foo_end - 2  /* k */
+	__tst.ws	0  /* j */
+	__bfalse	.LL18
+	__ld.wm		__foo_end - 2  /* k */
+	__sgt_w.wi	0
+	__bfalse	.LL15
+	__inc.wmq	__foo_end - 2  /* k */
+	__bra		.LL17
+.LL15:
+	__ld.wm		__foo_end - 2  /* k */
+	__slt_w.wi	0
+	__bfalse	.LL16
+	__dec.wmq	__foo_end - 2  /* k */
+.LL16:
+.LL17:
+.LL18:
+	__ld.wm		__foo_end - 2  /* k */
+.LL19:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/20050124-1.c", 27; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050124-1.c", 28; if (foo (0, 0) != 1)
+.LL14:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* i */
+	__add.wi	1
+	__st.wmq	__foo_end - 2  /* k */
+	__tst.ws	0  /* j */
+	__bfalse	.LL24
+	__ld.wm		__foo_end - 2  /* k */
+	__sgt_w.wi	0
+	__bfalse	.LL21
+	__inc.wmq	__foo_end - 2  /* k */
+	__bra		.LL23
+.LL21:
+	__ld.wm		__foo_end - 2  /* k */
+	__slt_w.wi	0
+	__bfalse	.LL22
+	__dec.wmq	__foo_end - 2  /* k */
+.LL22:
+.LL23:
+.LL24:
+	__ld.wm		__foo_end - 2  /* k */
+.LL25:
+	__modsp		4
+	__neq_w.wi	1
+	__bfalse	.LL20
+
+	.dbg	line,	"tests/20050124-1.c", 29; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050124-1.c", 30; if (foo (1, 0) != 2)
+.LL20:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* i */
+	__add.wi	1
+	__st.wmq	__foo_end - 2  /* k */
+	__tst.ws	0  /* j */
+	__bfalse	.LL30
+	__ld.wm		__foo_end - 2  /* k */
+	__sgt_w.wi	0
+	__bfalse	.LL27
+	__inc.wmq	__foo_end - 2  /* k */
+	__bra		.LL29
+.LL27:
+	__ld.wm		__foo_end - 2  /* k */
+	__slt_w.wi	0
+	__bfalse	.LL28
+	__dec.wmq	__foo_end - 2  /* k */
+.LL28:
+.LL29:
+.LL30:
+	__ld.wm		__foo_end - 2  /* k */
+.LL31:
+	__modsp		4
+	__neq_w.wi	2
+	__bfalse	.LL26
+
+	.dbg	line,	"tests/20050124-1.c", 31; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050124-1.c", 32; if (foo (-2, 1) != -2)
+.LL26:
+	__ld.wi		-2
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* i */
+	__add.wi	1
+	__st.wmq	__foo_end - 2  /* k */
+	__tst.ws	0  /* j */
+	__bfalse	.LL36
+	__ld.wm		__foo_end - 2  /* k */
+	__sgt_w.wi	0
+	__bfalse	.LL33
+	__inc.wmq	__foo_end - 2  /* k */
+	__bra		.LL35
+.LL33:
+	__ld.wm		__foo_end - 2  /* k */
+	__slt_w.wi	0
+	__bfalse	.LL34
+	__dec.wmq	__foo_end - 2  /* k */
+.LL34:
+.LL35:
+.LL36:
+	__ld.wm		__foo_end - 2  /* k */
+.LL37:
+	__modsp		4
+	__neq_w.wi	-2
+	__bfalse	.LL32
+
+	.dbg	line,	"tests/20050124-1.c", 33; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050124-1.c", 34; if (foo (-1, 1) != 0)
+.LL32:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* i */
+	__add.wi	1
+	__st.wmq	__foo_end - 2  /* k */
+	__tst.ws	0  /* j */
+	__bfalse	.LL42
+	__ld.wm		__foo_end - 2  /* k */
+	__sgt_w.wi	0
+	__bfalse	.LL39
+	__inc.wmq	__foo_end - 2  /* k */
+	__bra		.LL41
+.LL39:
+	__ld.wm		__foo_end - 2  /* k */
+	__slt_w.wi	0
+	__bfalse	.LL40
+	__dec.wmq	__foo_end - 2  /* k */
+.LL40:
+.LL41:
+.LL42:
+	__ld.wm		__foo_end - 2  /* k */
+.LL43:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL38
+
+	.dbg	line,	"tests/20050124-1.c", 35; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050124-1.c", 36; if (foo (0, 1) != 2)
+.LL38:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* i */
+	__add.wi	1
+	__st.wmq	__foo_end - 2  /* k */
+	__tst.ws	0  /* j */
+	__bfalse	.LL48
+	__ld.wm		__foo_end - 2  /* k */
+	__sgt_w.wi	0
+	__bfalse	.LL45
+	__inc.wmq	__foo_end - 2  /* k */
+	__bra		.LL47
+.LL45:
+	__ld.wm		__foo_end - 2  /* k */
+	__slt_w.wi	0
+	__bfalse	.LL46
+	__dec.wmq	__foo_end - 2  /* k */
+.LL46:
+.LL47:
+.LL48:
+	__ld.wm		__foo_end - 2  /* k */
+.LL49:
+	__modsp		4
+	__neq_w.wi	2
+	__bfalse	.LL44
+
+	.dbg	line,	"tests/20050124-1.c", 37; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050124-1.c", 38; if (foo (1, 1) != 3)
+.LL44:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* i */
+	__add.wi	1
+	__st.wmq	__foo_end - 2  /* k */
+	__tst.ws	0  /* j */
+	__bfalse	.LL54
+	__ld.wm		__foo_end - 2  /* k */
+	__sgt_w.wi	0
+	__bfalse	.LL51
+	__inc.wmq	__foo_end - 2  /* k */
+	__bra		.LL53
+.LL51:
+	__ld.wm		__foo_end - 2  /* k */
+	__slt_w.wi	0
+	__bfalse	.LL52
+	__dec.wmq	__foo_end - 2  /* k */
+.LL52:
+.LL53:
+.LL54:
+	__ld.wm		__foo_end - 2  /* k */
+.LL55:
+	__modsp		4
+	__neq_w.wi	3
+	__bfalse	.LL50
+
+	.dbg	line,	"tests/20050124-1.c", 39; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050124-1.c", 40; return 0;
+.LL50:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/20050124-1.c", 41; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,223 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20050125-1.c", 1; /* Verify that the CALL sideeffect isn't optimized away.  */
+	.dbg	line,	"tests/20050125-1.c", 2; /* Contributed by Greg Parker  25 Jan 2005  <gparker@apple.com> */
+	.dbg	line,	"tests/20050125-1.c", 4; #include <stdlib.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 1; #ifndef _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 2; #define _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 4; #define RAND_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 6; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 7; extern int __fastcall abs( int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 8; #endif
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 10; #endif // _hucc_stdlib_h
+	.dbg	line,	"tests/20050125-1.c", 5; //#include <stdio.h>
+	.dbg	line,	"tests/20050125-1.c", 7; struct parse {
+	.dbg	line,	"tests/20050125-1.c", 8; char *next;
+	.dbg	line,	"tests/20050125-1.c", 9; char *end;
+	.dbg	line,	"tests/20050125-1.c", 10; int error;
+	.dbg	line,	"tests/20050125-1.c", 11; };
+	.dbg	line,	"tests/20050125-1.c", 13; int seterr(struct parse *p, int err)
+	.dbg	line,	"tests/20050125-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_seterr
+	__enter		_seterr
+
+	.dbg	line,	"tests/20050125-1.c", 15; p->error = err;
+	__ld.ws		2  /* p */
+	__add.wi	4
+	__push.wr
+	__ld.ws		0  /* err */
+	__st.wtq
+
+	.dbg	line,	"tests/20050125-1.c", 16; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20050125-1.c", 17; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20050125-1.c", 19; void bracket_empty(struct parse *p)
+	.dbg	line,	"tests/20050125-1.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bracket_empty
+	__enter		_bracket_empty
+
+	.dbg	line,	"tests/20050125-1.c", 21; if (((p->next < p->end) && (*p->next++) == ']')  ||  seterr(p, 7)) { }
+	__ld.ws		0  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* p */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__ult_w.wt
+	__bfalse	.LL5
+	__ld.ws		0  /* p */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	1
+	__st.wt
+	__sub.wi	1
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	93
+.LL5:
+	__btrue		.LL6
+	__ld.ws		0  /* p */
+	__pusharg.wr
+	__ld.wi		7
+	__pusharg.wr
+	__ld.ws		2  /* p */
+	__add.wi	4
+	__push.wr
+	__ld.ws		0  /* err */
+	__st.wtq
+	__ld.wi		0
+.LL7:
+	__modsp		4
+	__tst.wr
+.LL6:
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20050125-1.c", 22; }
+.LL4:
+.LL3:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20050125-1.c", 24; int main(int argc /*__attribute__((unused))*/, char *argv[] /*__attribute__((unused))*/)
+	.dbg	line,	"tests/20050125-1.c", 25; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20050125-1.c", 26; struct parse p;
+
+	.dbg	line,	"tests/20050125-1.c", 27; p.next = p.end = /*(char *)*/0x12345;
+	__ld.wi		74565
+	__st.wm		__main_end - 6 + 2  /* p */
+	__st.wmq	__main_end - 6  /* p */
+
+	.dbg	line,	"tests/20050125-1.c", 29; p.error = 0;
+	__st.wmiq	0, __main_end - 6 + 4  /* p */
+
+	.dbg	line,	"tests/20050125-1.c", 30; bracket_empty(&p);
+	__ld.wi		__main_end - 6  /* p */
+	__pusharg.wr
+	__call		_bracket_empty
+
+	.dbg	line,	"tests/20050125-1.c", 31; if (p.error != 7)
+	__ld.wm		__main_end - 6 + 4  /* p */
+	__neq_w.wi	7
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20050125-1.c", 32; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050125-1.c", 34; return 0;
+.LL9:
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"tests/20050125-1.c", 35; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _main
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 10, 10
+__main_end	=	__overlay_frames + 6
+	.endm
@@ -0,0 +1,139 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20050131-1.c", 1; /* Verify that we do not lose side effects on a MOD expression.  */
+	.dbg	line,	"tests/20050131-1.c", 3; #include <stdlib.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 1; #ifndef _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 2; #define _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 4; #define RAND_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 6; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 7; extern int __fastcall abs( int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 8; #endif
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 10; #endif // _hucc_stdlib_h
+	.dbg	line,	"tests/20050131-1.c", 4; //#include <stdio.h>
+	.dbg	line,	"tests/20050131-1.c", 6; int
+	.dbg	line,	"tests/20050131-1.c", 7; foo (int a)
+	.dbg	line,	"tests/20050131-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20050131-1.c", 9; int x; x = 0 % a++;
+	__ld.wi		0
+	__push.wr
+	__ldinc.ws	0  /* a */
+	__smod.wt
+
+	.dbg	line,	"tests/20050131-1.c", 10; return a;
+	__ld.ws		0  /* a */
+.LL2:
+
+	.dbg	line,	"tests/20050131-1.c", 11; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20050131-1.c", 13; main()
+	.dbg	line,	"tests/20050131-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20050131-1.c", 15; if (foo (9) != 10)
+	__ld.wi		9
+	__pusharg.wr
+	__ld.wi		0
+	__push.wr
+	__ldinc.ws	0  /* a */
+	__smod.wt
+	__ld.ws		0  /* a */
+.LL5:
+	__modsp		2
+	__neq_w.wi	10
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/20050131-1.c", 16; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050131-1.c", 17; exit (0);
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20050131-1.c", 18; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,196 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20050203-1.c", 1; /* Reduced testcase extracted from Samba source code.  */
+	.dbg	line,	"tests/20050203-1.c", 3; #include <stdlib.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 1; #ifndef _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 2; #define _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 4; #define RAND_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 6; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 7; extern int __fastcall abs( int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 8; #endif
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 10; #endif // _hucc_stdlib_h
+	.dbg	line,	"tests/20050203-1.c", 5; static void //__attribute__((__noinline__))
+	.dbg	line,	"tests/20050203-1.c", 6; foo (unsigned char *p) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20050203-1.c", 7; *p = 0x81;
+	__ld.ws		0  /* p */
+	__push.wr
+	__ld.wi		129
+	__st.utq
+
+	.dbg	line,	"tests/20050203-1.c", 8; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20050203-1.c", 10; static void //__attribute__((__noinline__))
+	.dbg	line,	"tests/20050203-1.c", 11; bar (int x) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20050203-1.c", 12; //  asm ("");
+
+	.dbg	line,	"tests/20050203-1.c", 13; }
+.LL3:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20050203-1.c", 15; int main() {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20050203-1.c", 16; unsigned char b;
+
+	.dbg	line,	"tests/20050203-1.c", 18; foo(&b);
+	__ld.wi		__main_end - 1  /* b */
+	__pusharg.wr
+	__ld.ws		0  /* p */
+	__push.wr
+	__ld.wi		129
+	__st.utq
+.LL5:
+	__modsp		2
+
+	.dbg	line,	"tests/20050203-1.c", 19; if (b & 0x80)
+	__ld.um		__main_end - 1  /* b */
+	__tand.wi	128
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20050203-1.c", 20; {
+
+	.dbg	line,	"tests/20050203-1.c", 21; bar (b & 0x7f);
+	__ld.um		__main_end - 1  /* b */
+	__and.uiq	127
+	__pusharg.wr
+.LL7:
+	__modsp		2
+
+	.dbg	line,	"tests/20050203-1.c", 22; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20050203-1.c", 23; }
+
+	.dbg	line,	"tests/20050203-1.c", 24; else
+	__bra		.LL8
+.LL6:
+
+	.dbg	line,	"tests/20050203-1.c", 25; {
+
+	.dbg	line,	"tests/20050203-1.c", 26; bar (b & 1);
+	__ld.um		__main_end - 1  /* b */
+	__and.uiq	1
+	__pusharg.wr
+.LL9:
+	__modsp		2
+
+	.dbg	line,	"tests/20050203-1.c", 27; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050203-1.c", 28; }
+.LL8:
+
+	.dbg	line,	"tests/20050203-1.c", 29; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     1  _main
+;
+; 1 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     1  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 1, 8, 8
+__main_end	=	__overlay_frames + 1
+	.endm
@@ -0,0 +1,371 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20050502-2.c", 1; /* PR target/21297 */
+	.dbg	line,	"tests/20050502-2.c", 2; //typedef __SIZE_TYPE__ size_t;
+	.dbg	line,	"tests/20050502-2.c", 4; #include <string.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 3; #endif
+	.dbg	line,	"tests/20050502-2.c", 5; #define size_t unsigned int
+	.dbg	line,	"tests/20050502-2.c", 6; extern void abort ();
+	.dbg	line,	"tests/20050502-2.c", 8; void
+	.dbg	line,	"tests/20050502-2.c", 9; foo (char *x)
+	.dbg	line,	"tests/20050502-2.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20050502-2.c", 11; int i;
+
+	.dbg	line,	"tests/20050502-2.c", 12; for (i = 0; i < 2; i++);
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL3:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.wi	2
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL3
+.LL5	.alias		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20050502-2.c", 13; x[i + i] = '\0';
+	__ld.wm		__foo_end - 2  /* i */
+	__add.wm	__foo_end - 2  /* i */
+	__add.ws	0  /* x */
+	__push.wr
+	__ld.wi		0
+	__st.utq
+
+	.dbg	line,	"tests/20050502-2.c", 14; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20050502-2.c", 16; void
+	.dbg	line,	"tests/20050502-2.c", 17; bar (char *x)
+	.dbg	line,	"tests/20050502-2.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20050502-2.c", 19; int i;
+
+	.dbg	line,	"tests/20050502-2.c", 20; for (i = 0; i < 2; i++);
+	__st.wmiq	0, __bar_end - 2  /* i */
+.LL8:
+	__ld.wm		__bar_end - 2  /* i */
+	__slt_w.wi	2
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+	__inc.wmq	__bar_end - 2  /* i */
+	__bra		.LL8
+.LL10	.alias		.LL9
+.LL11:
+
+	.dbg	line,	"tests/20050502-2.c", 21; x[i + i + i + i] = '\0';
+	__ld.wm		__bar_end - 2  /* i */
+	__add.wm	__bar_end - 2  /* i */
+	__add.wm	__bar_end - 2  /* i */
+	__add.wm	__bar_end - 2  /* i */
+	__add.ws	0  /* x */
+	__push.wr
+	__ld.wi		0
+	__st.utq
+
+	.dbg	line,	"tests/20050502-2.c", 22; }
+.LL7:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__bar_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20050502-2.c", 24; const char *x_ro = "IJKLMNOPQR";
+	.dbg	line,	"tests/20050502-2.c", 26; int
+	.dbg	line,	"tests/20050502-2.c", 27; main (void)
+	.dbg	line,	"tests/20050502-2.c", 28; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20050502-2.c", 29; //char x[] = "IJKLMNOPQR";
+
+	.dbg	line,	"tests/20050502-2.c", 30; char x[11];
+
+	.dbg	line,	"tests/20050502-2.c", 31; strcpy(x, x_ro);
+	__ld.wi		__main_end - 11  /* x */
+	__st.wmq	_di
+	__ld.wm		_x_ro
+	__st.wmq	_bp
+	__call		_strcpy.2
+
+	.dbg	line,	"tests/20050502-2.c", 32; foo (x);
+	__ld.wi		__main_end - 11  /* x */
+	__pusharg.wr
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL13:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.wi	2
+	__btrue		.LL15
+	__bra		.LL16
+.LL14:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL13
+.LL15	.alias		.LL14
+.LL16:
+	__ld.wm		__foo_end - 2  /* i */
+	__add.wm	__foo_end - 2  /* i */
+	__add.ws	0  /* x */
+	__push.wr
+	__ld.wi		0
+	__st.utq
+.LL17:
+	__modsp		2
+
+	.dbg	line,	"tests/20050502-2.c", 33; if (memcmp (x, "IJKL\0NOPQR", /*sizeof x*/11) != 0)
+	__ld.wi		__main_end - 11  /* x */
+	__st.wmq	_di
+	__ld.wi		__const1+11
+	__st.wmq	_bp
+	__ld.wi		11
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/20050502-2.c", 34; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050502-2.c", 35; x[4] = 'M';
+.LL18:
+	__st.umiq	77, __main_end - 11 + 4  /* x */
+
+	.dbg	line,	"tests/20050502-2.c", 36; bar (x);
+	__ld.wi		__main_end - 11  /* x */
+	__pusharg.wr
+	__st.wmiq	0, __bar_end - 2  /* i */
+.LL19:
+	__ld.wm		__bar_end - 2  /* i */
+	__slt_w.wi	2
+	__btrue		.LL21
+	__bra		.LL22
+.LL20:
+	__inc.wmq	__bar_end - 2  /* i */
+	__bra		.LL19
+.LL21	.alias		.LL20
+.LL22:
+	__ld.wm		__bar_end - 2  /* i */
+	__add.wm	__bar_end - 2  /* i */
+	__add.wm	__bar_end - 2  /* i */
+	__add.wm	__bar_end - 2  /* i */
+	__add.ws	0  /* x */
+	__push.wr
+	__ld.wi		0
+	__st.utq
+.LL23:
+	__modsp		2
+
+	.dbg	line,	"tests/20050502-2.c", 37; if (memcmp (x, "IJKLMNOP\0R", /*sizeof x*/11) != 0)
+	__ld.wi		__main_end - 11  /* x */
+	__st.wmq	_di
+	__ld.wi		__const1+22
+	__st.wmq	_bp
+	__ld.wi		11
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL24
+
+	.dbg	line,	"tests/20050502-2.c", 38; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050502-2.c", 39; return 0;
+.LL24:
+	__ld.wi		0
+.LL12:
+
+	.dbg	line,	"tests/20050502-2.c", 40; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'I','J','K','L','M','N','O','P'
+		db	'Q','R',$00,'I','J','K','L',$00
+		db	'N','O','P','Q','R',$00,'I','J'
+		db	'K','L','M','N','O','P',$00,'R'
+		db	$00
+_x_ro:
+		dw	__const1+0
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:33
+;	constant pool:2
+;	global pool:22
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    11  _main
+;
+; 11 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        18     18    11  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 11, 18, 18
+__main_end	=	__overlay_frames + 11
+	.endm
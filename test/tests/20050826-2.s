@@ -0,0 +1,388 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20050826-2.c", 1; /* PR rtl-optimization/23560 */
+	.dbg	line,	"tests/20050826-2.c", 3; struct rtattr
+	.dbg	line,	"tests/20050826-2.c", 4; {
+	.dbg	line,	"tests/20050826-2.c", 5; unsigned short rta_len;
+	.dbg	line,	"tests/20050826-2.c", 6; unsigned short rta_type;
+	.dbg	line,	"tests/20050826-2.c", 7; };
+	.dbg	line,	"tests/20050826-2.c", 9; //__attribute__ ((noinline))
+	.dbg	line,	"tests/20050826-2.c", 10; int inet_check_attr (void *r, struct rtattr *rta[])
+	.dbg	line,	"tests/20050826-2.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_inet_check_attr
+	__enter		_inet_check_attr
+
+	.dbg	line,	"tests/20050826-2.c", 12; int i;
+
+	.dbg	line,	"tests/20050826-2.c", 14; for (i = 1; i <= 14; i++)
+	__st.wmiq	1, __inet_check_attr_end - 2  /* i */
+.LL3:
+	__ld.wm		__inet_check_attr_end - 2  /* i */
+	__sle_w.wi	14
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__inet_check_attr_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20050826-2.c", 15; {
+
+	.dbg	line,	"tests/20050826-2.c", 16; struct rtattr *attr; attr = rta[i - 1];
+	__ld.wm		__inet_check_attr_end - 2  /* i */
+	__sub.wi	1
+	__asl.wr
+	__add.ws	0  /* rta */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__inet_check_attr_end - 4  /* attr */
+
+	.dbg	line,	"tests/20050826-2.c", 17; if (attr)
+	__tst.wm	__inet_check_attr_end - 4  /* attr */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20050826-2.c", 18; {
+
+	.dbg	line,	"tests/20050826-2.c", 19; if (attr->rta_len - sizeof (struct rtattr) < 4)
+	__ld.wm		__inet_check_attr_end - 4  /* attr */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__sub.wi	4
+	__ult_w.wi	4
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20050826-2.c", 20; return -22;
+	__ld.wi		-22
+	__bra		.LL2
+
+	.dbg	line,	"tests/20050826-2.c", 21; if (i != 9 && i != 8)
+.LL8:
+	__ld.wm		__inet_check_attr_end - 2  /* i */
+	__neq_w.wi	9
+	__bfalse	.LL10
+	__ld.wm		__inet_check_attr_end - 2  /* i */
+	__neq_w.wi	8
+.LL10:
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20050826-2.c", 22; rta[i - 1] = attr + 1;
+	__ld.wm		__inet_check_attr_end - 2  /* i */
+	__sub.wi	1
+	__asl.wr
+	__add.ws	0  /* rta */
+	__push.wr
+	__ld.wm		__inet_check_attr_end - 4  /* attr */
+	__add.wi	4
+	__st.wtq
+
+	.dbg	line,	"tests/20050826-2.c", 23; }
+.LL9	.alias		.LL4
+
+	.dbg	line,	"tests/20050826-2.c", 24; }
+.LL7	.alias		.LL4
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20050826-2.c", 25; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20050826-2.c", 26; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__inet_check_attr_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20050826-2.c", 28; extern void abort (void);
+	.dbg	line,	"tests/20050826-2.c", 30; int
+	.dbg	line,	"tests/20050826-2.c", 31; main (void)
+	.dbg	line,	"tests/20050826-2.c", 32; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20050826-2.c", 33; struct rtattr rt[2];
+
+	.dbg	line,	"tests/20050826-2.c", 34; struct rtattr *rta[14];
+
+	.dbg	line,	"tests/20050826-2.c", 35; int i;
+
+	.dbg	line,	"tests/20050826-2.c", 37; rt[0].rta_len = sizeof (struct rtattr) + 8;
+	__st.wmiq	12, __main_end - 8  /* rt */
+
+	.dbg	line,	"tests/20050826-2.c", 38; rt[0].rta_type = 0;
+	__st.wmiq	0, __main_end - 8 + 2  /* rt */
+
+	.dbg	line,	"tests/20050826-2.c", 39; rt[1] = rt[0];
+	__tii		__main_end - 8  /* rt */, __main_end - 8 + 4  /* rt */, 4
+
+	.dbg	line,	"tests/20050826-2.c", 40; for (i = 0; i < 14; i++)
+	__st.wmiq	0, __main_end - 38  /* i */
+.LL12:
+	__ld.wm		__main_end - 38  /* i */
+	__slt_w.wi	14
+	__btrue		.LL14
+	__bra		.LL15
+.LL13:
+	__inc.wmq	__main_end - 38  /* i */
+	__bra		.LL12
+.LL14:
+
+	.dbg	line,	"tests/20050826-2.c", 41; rta[i] = &rt[0];
+	__ld2x.wmq	__main_end - 38  /* i */
+	__ld.wi		__main_end - 8  /* rt */
+	__st.waxq	__main_end - 36  /* rta */
+	__bra		.LL13
+.LL15:
+
+	.dbg	line,	"tests/20050826-2.c", 42; if (inet_check_attr (0, rta) != 0)
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		__main_end - 36  /* rta */
+	__pusharg.wr
+	__call		_inet_check_attr
+	__tst.wr
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/20050826-2.c", 43; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050826-2.c", 44; for (i = 0; i < 14; i++)
+.LL16:
+	__st.wmiq	0, __main_end - 38  /* i */
+.LL17:
+	__ld.wm		__main_end - 38  /* i */
+	__slt_w.wi	14
+	__btrue		.LL19
+	__bra		.LL20
+.LL18:
+	__inc.wmq	__main_end - 38  /* i */
+	__bra		.LL17
+.LL19:
+
+	.dbg	line,	"tests/20050826-2.c", 45; if (rta[i] != &rt[i != 7 && i != 8])
+	__ld.wm		__main_end - 38  /* i */
+	__neq_w.wi	7
+	__bfalse	.LL22
+	__ld.wm		__main_end - 38  /* i */
+	__neq_w.wi	8
+.LL22:
+	__bool
+	__asl.wi	2
+	__add.wi	__main_end - 8  /* rt */
+	__ld2x.wm	__main_end - 38  /* i */
+	__neq_w.wax	__main_end - 36  /* rta */
+	__bfalse	.LL21
+
+	.dbg	line,	"tests/20050826-2.c", 46; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050826-2.c", 47; for (i = 0; i < 14; i++)
+.LL21	.alias		.LL18
+	__bra		.LL18
+.LL20:
+	__st.wmiq	0, __main_end - 38  /* i */
+.LL23:
+	__ld.wm		__main_end - 38  /* i */
+	__slt_w.wi	14
+	__btrue		.LL25
+	__bra		.LL26
+.LL24:
+	__inc.wmq	__main_end - 38  /* i */
+	__bra		.LL23
+.LL25:
+
+	.dbg	line,	"tests/20050826-2.c", 48; rta[i] = &rt[0];
+	__ld2x.wmq	__main_end - 38  /* i */
+	__ld.wi		__main_end - 8  /* rt */
+	__st.waxq	__main_end - 36  /* rta */
+	__bra		.LL24
+.LL26:
+
+	.dbg	line,	"tests/20050826-2.c", 49; rta[1] = 0;
+	__st.wmiq	0, __main_end - 36 + 2  /* rta */
+
+	.dbg	line,	"tests/20050826-2.c", 50; rt[1].rta_len -= 8;
+	__sub_st.wmiq	8, __main_end - 8 + 4  /* rt */
+
+	.dbg	line,	"tests/20050826-2.c", 51; rta[5] = &rt[1];
+	__ld.wi		__main_end - 8 + 4  /* rt */
+	__st.wmq	__main_end - 36 + 10  /* rta */
+
+	.dbg	line,	"tests/20050826-2.c", 52; if (inet_check_attr (0, rta) != -22)
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		__main_end - 36  /* rta */
+	__pusharg.wr
+	__call		_inet_check_attr
+	__neq_w.wi	-22
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/20050826-2.c", 53; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050826-2.c", 54; for (i = 0; i < 14; i++)
+.LL27:
+	__st.wmiq	0, __main_end - 38  /* i */
+.LL28:
+	__ld.wm		__main_end - 38  /* i */
+	__slt_w.wi	14
+	__btrue		.LL30
+	__bra		.LL31
+.LL29:
+	__inc.wmq	__main_end - 38  /* i */
+	__bra		.LL28
+.LL30:
+
+	.dbg	line,	"tests/20050826-2.c", 55; if (i == 1 && rta[i] != 0)
+	__ld.wm		__main_end - 38  /* i */
+	__equ_w.wi	1
+	__bfalse	.LL33
+	__ld2x.wmq	__main_end - 38  /* i */
+	__tst.wax	__main_end - 36  /* rta */
+.LL33:
+	__bfalse	.LL32
+
+	.dbg	line,	"tests/20050826-2.c", 56; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050826-2.c", 57; else if (i != 1 && i <= 5 && rta[i] != &rt[1])
+	__bra		.LL34
+.LL32:
+	__ld.wm		__main_end - 38  /* i */
+	__neq_w.wi	1
+	__bfalse	.LL36
+	__ld.wm		__main_end - 38  /* i */
+	__sle_w.wi	5
+.LL36:
+	__bfalse	.LL37
+	__ld2x.wmq	__main_end - 38  /* i */
+	__ld.wax	__main_end - 36  /* rta */
+	__neq_w.wi	__main_end - 8 + 4  /* rt */
+.LL37:
+	__bfalse	.LL35
+
+	.dbg	line,	"tests/20050826-2.c", 58; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050826-2.c", 59; else if (i > 5 && rta[i] != &rt[0])
+	__bra		.LL38
+.LL35:
+	__ld.wm		__main_end - 38  /* i */
+	__sgt_w.wi	5
+	__bfalse	.LL40
+	__ld2x.wmq	__main_end - 38  /* i */
+	__ld.wax	__main_end - 36  /* rta */
+	__neq_w.wi	__main_end - 8  /* rt */
+.LL40:
+	__bfalse	.LL39
+
+	.dbg	line,	"tests/20050826-2.c", 60; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20050826-2.c", 61; return 0;
+.LL39	.alias		.LL29
+.LL38	.alias		.LL29
+.LL34	.alias		.LL29
+	__bra		.LL29
+.LL31:
+	__ld.wi		0
+.LL11:
+
+	.dbg	line,	"tests/20050826-2.c", 62; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    38  _main
+;
+; 38 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       580     90    38  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 38, 90, 580
+__main_end	=	__overlay_frames + 38
+	.endm
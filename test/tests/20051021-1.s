@@ -0,0 +1,172 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20051021-1.c", 1; /* Verify that TRUTH_AND_EXPR is not wrongly changed to TRUTH_ANDIF_EXPR.  */
+	.dbg	line,	"tests/20051021-1.c", 3; extern void abort (void);
+	.dbg	line,	"tests/20051021-1.c", 5; int count;// = 0;
+	.dbg	line,	"tests/20051021-1.c", 7; int foo1(void)
+	.dbg	line,	"tests/20051021-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo1
+	__enter		_foo1
+
+	.dbg	line,	"tests/20051021-1.c", 9; count++;
+	__inc.wmq	_count
+
+	.dbg	line,	"tests/20051021-1.c", 10; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20051021-1.c", 11; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20051021-1.c", 13; int foo2(void)
+	.dbg	line,	"tests/20051021-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo2
+	__enter		_foo2
+
+	.dbg	line,	"tests/20051021-1.c", 15; count++;
+	__inc.wmq	_count
+
+	.dbg	line,	"tests/20051021-1.c", 16; return 0;
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/20051021-1.c", 17; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20051021-1.c", 19; int main(void)
+	.dbg	line,	"tests/20051021-1.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20051021-1.c", 21; count = 0;
+	__st.wmiq	0, _count
+
+	.dbg	line,	"tests/20051021-1.c", 22; if ((foo1() == 1) & (foo2() == 1))
+	__inc.wmq	_count
+	__ld.wi		0
+.LL6:
+	__equ_w.wi	1
+	__bool
+	__push.wr
+	__inc.wmq	_count
+	__ld.wi		0
+.LL7:
+	__equ_w.wi	1
+	__bool
+	__and.wt
+	__tst.wr
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20051021-1.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20051021-1.c", 25; if (count != 2)
+.LL5:
+	__ld.wm		_count
+	__neq_w.wi	2
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20051021-1.c", 26; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20051021-1.c", 28; return 0;
+.LL8:
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"tests/20051021-1.c", 29; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        16     16     2  count
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_count, 2, 16, 16
+	.endm
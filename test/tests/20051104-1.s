@@ -0,0 +1,114 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20051104-1.c", 1; /* PR rtl-optimization/23567 */
+	.dbg	line,	"tests/20051104-1.c", 3; struct st
+	.dbg	line,	"tests/20051104-1.c", 4; {
+	.dbg	line,	"tests/20051104-1.c", 5; int len;
+	.dbg	line,	"tests/20051104-1.c", 6; char *name;
+	.dbg	line,	"tests/20051104-1.c", 7; }; struct st s;
+	.dbg	line,	"tests/20051104-1.c", 9; int
+	.dbg	line,	"tests/20051104-1.c", 10; main (void)
+	.dbg	line,	"tests/20051104-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20051104-1.c", 12; s.len = 0;
+	__st.wmiq	0, _s
+
+	.dbg	line,	"tests/20051104-1.c", 13; s.name = "";
+	__ld.wi		__const1+0
+	__st.wmq	_s + 2
+
+	.dbg	line,	"tests/20051104-1.c", 14; if (s.name [s.len] != 0)
+	__add.wm	_s
+	__st.wm		__ptr
+	__tst.up	__ptr
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20051104-1.c", 15; s.name [s.len] = 0;
+	__ld.wm		_s + 2
+	__add.wm	_s
+	__push.wr
+	__ld.wi		0
+	__st.utq
+
+	.dbg	line,	"tests/20051104-1.c", 16; return 0;
+.LL3:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/20051104-1.c", 17; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:1
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        12     12     4  s
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_s, 4, 12, 12
+	.endm
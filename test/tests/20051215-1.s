@@ -0,0 +1,179 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20051215-1.c", 1; /* PR rtl-optimization/24899 */
+	.dbg	line,	"tests/20051215-1.c", 3; extern void abort (void);
+	.dbg	line,	"tests/20051215-1.c", 5; /*__attribute__ ((noinline))*/ int
+	.dbg	line,	"tests/20051215-1.c", 6; foo (int x, int y, int *z)
+	.dbg	line,	"tests/20051215-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20051215-1.c", 8; int a, b, c, d;
+
+	.dbg	line,	"tests/20051215-1.c", 10; a = b = 0;
+	__ld.wi		0
+	__st.wm		__foo_end - 4  /* b */
+	__st.wmq	__foo_end - 2  /* a */
+
+	.dbg	line,	"tests/20051215-1.c", 11; for (d = 0; d < y; d++)
+	__st.wmiq	0, __foo_end - 8  /* d */
+.LL3:
+	__ld.wm		__foo_end - 8  /* d */
+	__slt_w.ws	2  /* y */
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__foo_end - 8  /* d */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/20051215-1.c", 12; {
+
+	.dbg	line,	"tests/20051215-1.c", 13; if (z)
+	__tst.ws	0  /* z */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20051215-1.c", 14; b = d * *z;
+	__ld.wm		__foo_end - 8  /* d */
+	__push.wr
+	__ld.ws		0  /* z */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__mul.wt
+	__st.wmq	__foo_end - 4  /* b */
+
+	.dbg	line,	"tests/20051215-1.c", 15; for (c = 0; c < x; c++)
+.LL7:
+	__st.wmiq	0, __foo_end - 6  /* c */
+.LL8:
+	__ld.wm		__foo_end - 6  /* c */
+	__slt_w.ws	4  /* x */
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+	__inc.wmq	__foo_end - 6  /* c */
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/20051215-1.c", 16; a += b;
+	__ld.wm		__foo_end - 4  /* b */
+	__add_st.wmq	__foo_end - 2  /* a */
+	__bra		.LL9
+.LL11	.alias		.LL4
+
+	.dbg	line,	"tests/20051215-1.c", 17; }
+.LL6:
+
+	.dbg	line,	"tests/20051215-1.c", 19; return a;
+	__ld.wm		__foo_end - 2  /* a */
+.LL2:
+
+	.dbg	line,	"tests/20051215-1.c", 20; }
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20051215-1.c", 22; int
+	.dbg	line,	"tests/20051215-1.c", 23; main (void)
+	.dbg	line,	"tests/20051215-1.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20051215-1.c", 25; if (foo (3, 2, 0) != 0)
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_foo
+	__tst.wr
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/20051215-1.c", 26; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20051215-1.c", 27; return 0;
+.LL13:
+	__ld.wi		0
+.LL12:
+
+	.dbg	line,	"tests/20051215-1.c", 28; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 8
+leaf_needs	.set	8
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,151 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20060102-1.c", 1; extern void abort ();
+	.dbg	line,	"tests/20060102-1.c", 3; int f(int x)
+	.dbg	line,	"tests/20060102-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/20060102-1.c", 5; return (x >> (sizeof (x) * /*__CHAR_BIT__*/ 8 - 1)) ? -1 : 1;
+	__ld.ws		0  /* x */
+	__asr.wi	15
+	__tst.wr
+	__bfalse	.LL3
+	__ld.wi		-1
+	__bra		.LL4
+.LL3:
+	__ld.wi		1
+.LL4	.alias		.LL2
+.LL2:
+
+	.dbg	line,	"tests/20060102-1.c", 6; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20060102-1.c", 8; /* volatile */ const int one = 1;
+	.dbg	line,	"tests/20060102-1.c", 9; int main (void)
+	.dbg	line,	"tests/20060102-1.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20060102-1.c", 11; /* Test that the function above returns different values for
+
+	.dbg	line,	"tests/20060102-1.c", 12; different signs.  */
+
+	.dbg	line,	"tests/20060102-1.c", 13; if (f(one) == f(-one))
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__asr.wi	15
+	__tst.wr
+	__bfalse	.LL7
+	__ld.wi		-1
+	__bra		.LL8
+.LL7:
+	__ld.wi		1
+.LL8	.alias		.LL9
+.LL9:
+	__modsp		2
+	__push.wr
+	__ld.wi		1
+	__neg.wr
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__asr.wi	15
+	__tst.wr
+	__bfalse	.LL10
+	__ld.wi		-1
+	__bra		.LL11
+.LL10:
+	__ld.wi		1
+.LL11	.alias		.LL12
+.LL12:
+	__modsp		2
+	__equ_w.wt
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20060102-1.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20060102-1.c", 15; return 0;
+.LL6:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/20060102-1.c", 16; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_one:
+		dw	1
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:2
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,231 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20060910-1.c", 1; /* PR rtl-optimization/28636 */
+	.dbg	line,	"tests/20060910-1.c", 2; /* Origin: Andreas Schwab <schwab@suse.de> */
+	.dbg	line,	"tests/20060910-1.c", 4; extern void abort(void);
+	.dbg	line,	"tests/20060910-1.c", 6; struct input_ty
+	.dbg	line,	"tests/20060910-1.c", 7; {
+	.dbg	line,	"tests/20060910-1.c", 8; unsigned char *buffer_position;
+	.dbg	line,	"tests/20060910-1.c", 9; unsigned char *buffer_end;
+	.dbg	line,	"tests/20060910-1.c", 10; };
+	.dbg	line,	"tests/20060910-1.c", 12; int input_getc_complicated (struct input_ty *x) { return 0; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_input_getc_complicated
+	__enter		_input_getc_complicated
+	__ld.wi		0
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20060910-1.c", 14; int check_header (struct input_ty *deeper)
+	.dbg	line,	"tests/20060910-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_check_header
+	__enter		_check_header
+
+	.dbg	line,	"tests/20060910-1.c", 16; unsigned len;
+
+	.dbg	line,	"tests/20060910-1.c", 17; for (len = 0; len < 6; len++)
+	__st.wmiq	0, __check_header_end - 2  /* len */
+.LL4:
+	__ld.wm		__check_header_end - 2  /* len */
+	__ult_w.wi	6
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__check_header_end - 2  /* len */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20060910-1.c", 18; if (((deeper)->buffer_position < (deeper)->buffer_end
+	__ld.ws		0  /* deeper */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* deeper */
+	__add.wi	2
+
+	.dbg	line,	"tests/20060910-1.c", 19; ? *((deeper)->buffer_position)++
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__ult_w.wt
+	__bfalse	.LL9
+	__ld.ws		0  /* deeper */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	1
+	__st.wt
+	__sub.wi	1
+
+	.dbg	line,	"tests/20060910-1.c", 20; : input_getc_complicated((deeper))) < 0)
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__bra		.LL10
+.LL9:
+	__ld.ws		0  /* deeper */
+	__pusharg.wr
+	__ld.wi		0
+.LL11:
+	__modsp		2
+.LL10:
+	__slt_w.wi	0
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20060910-1.c", 21; return 0;
+	__ld.wi		0
+	__bra		.LL3
+
+	.dbg	line,	"tests/20060910-1.c", 22; return 1;
+.LL8	.alias		.LL5
+.LL7:
+	__ld.wi		1
+.LL3:
+
+	.dbg	line,	"tests/20060910-1.c", 23; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20060910-1.c", 25; struct input_ty s;
+	.dbg	line,	"tests/20060910-1.c", 26; unsigned char b[6];
+	.dbg	line,	"tests/20060910-1.c", 28; int main (void)
+	.dbg	line,	"tests/20060910-1.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20060910-1.c", 30; s.buffer_position = b;
+	__ld.wi		_b
+	__st.wmq	_s
+
+	.dbg	line,	"tests/20060910-1.c", 31; s.buffer_end = b + sizeof b;
+	__ld.wi		_b + 6
+	__st.wmq	_s + 2
+
+	.dbg	line,	"tests/20060910-1.c", 32; if (!check_header(&s))
+	__ld.wi		_s
+	__pusharg.wr
+	__call		_check_header
+	__not.wr
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/20060910-1.c", 33; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20060910-1.c", 34; if (s.buffer_position != s.buffer_end)
+.LL13:
+	__ld.wm		_s
+	__neq_w.wm	_s + 2
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/20060910-1.c", 35; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/20060910-1.c", 36; return 0;
+.LL14:
+	__ld.wi		0
+.LL12:
+
+	.dbg	line,	"tests/20060910-1.c", 37; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_b:
+		ds	6
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _check_header
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        48      6     2  overlaid locals
+;        10     10     4  s
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 48
+__check_header_end	=	__overlay_frames + 2
+	auto_zp_var	_s, 4, 10, 10
+	.endm
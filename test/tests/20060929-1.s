@@ -0,0 +1,317 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20060929-1.c", 1; /* PR c/29154 */
+	.dbg	line,	"tests/20060929-1.c", 3; extern void abort (void);
+	.dbg	line,	"tests/20060929-1.c", 5; void
+	.dbg	line,	"tests/20060929-1.c", 6; foo (int **p, int *q)
+	.dbg	line,	"tests/20060929-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20060929-1.c", 8; *(*p++)++ = *q++;
+	__ld.ws		2  /* p */
+	__add.wi	2
+	__st.ws		2  /* p */
+	__sub.wi	2
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wt
+	__sub.wi	2
+	__push.wr
+	__ld.ws		0  /* q */
+	__add.wi	2
+	__st.ws		0  /* q */
+	__sub.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wtq
+
+	.dbg	line,	"tests/20060929-1.c", 9; }
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20060929-1.c", 11; void
+	.dbg	line,	"tests/20060929-1.c", 12; bar (int **p, int *q)
+	.dbg	line,	"tests/20060929-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20060929-1.c", 14; **p = *q++;
+	__ld.ws		2  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* q */
+	__add.wi	2
+	__st.ws		0  /* q */
+	__sub.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wtq
+
+	.dbg	line,	"tests/20060929-1.c", 15; *(*p++)++;
+	__ld.ws		2  /* p */
+	__add.wi	2
+	__st.ws		2  /* p */
+	__sub.wi	2
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wt
+	__sub.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+
+	.dbg	line,	"tests/20060929-1.c", 16; }
+.LL3:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20060929-1.c", 18; void
+	.dbg	line,	"tests/20060929-1.c", 19; baz (int **p, int *q)
+	.dbg	line,	"tests/20060929-1.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_baz
+	__enter		_baz
+
+	.dbg	line,	"tests/20060929-1.c", 21; **p = *q++;
+	__ld.ws		2  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* q */
+	__add.wi	2
+	__st.ws		0  /* q */
+	__sub.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wtq
+
+	.dbg	line,	"tests/20060929-1.c", 22; (*p++)++;
+	__ld.ws		2  /* p */
+	__add.wi	2
+	__st.ws		2  /* p */
+	__sub.wi	2
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wt
+
+	.dbg	line,	"tests/20060929-1.c", 23; }
+.LL4:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20060929-1.c", 25; int
+	.dbg	line,	"tests/20060929-1.c", 26; main (void)
+	.dbg	line,	"tests/20060929-1.c", 27; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20060929-1.c", 28; int i,j, *p; i = 42; j = 0;
+	__st.wmiq	42, __main_end - 2  /* i */
+	__st.wmiq	0, __main_end - 4  /* j */
+
+	.dbg	line,	"tests/20060929-1.c", 29; p = &i;
+	__ld.wi		__main_end - 2  /* i */
+	__st.wmq	__main_end - 6  /* p */
+
+	.dbg	line,	"tests/20060929-1.c", 30; foo (&p, &j);
+	__ld.wi		__main_end - 6  /* p */
+	__pusharg.wr
+	__ld.wi		__main_end - 4  /* j */
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20060929-1.c", 31; if (p - 1 != &i || j != 0 || i != 0)
+	__ld.wm		__main_end - 6  /* p */
+	__sub.wi	2
+	__neq_w.wi	__main_end - 2  /* i */
+	__btrue		.LL7
+	__tst.wm	__main_end - 4  /* j */
+.LL7:
+	__btrue		.LL8
+	__tst.wm	__main_end - 2  /* i */
+.LL8:
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20060929-1.c", 32; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20060929-1.c", 33; i = 43;
+.LL6:
+	__st.wmiq	43, __main_end - 2  /* i */
+
+	.dbg	line,	"tests/20060929-1.c", 34; p = &i;
+	__ld.wi		__main_end - 2  /* i */
+	__st.wmq	__main_end - 6  /* p */
+
+	.dbg	line,	"tests/20060929-1.c", 35; bar (&p, &j);
+	__ld.wi		__main_end - 6  /* p */
+	__pusharg.wr
+	__ld.wi		__main_end - 4  /* j */
+	__pusharg.wr
+	__call		_bar
+
+	.dbg	line,	"tests/20060929-1.c", 36; if (p - 1 != &i || j != 0 || i != 0)
+	__ld.wm		__main_end - 6  /* p */
+	__sub.wi	2
+	__neq_w.wi	__main_end - 2  /* i */
+	__btrue		.LL10
+	__tst.wm	__main_end - 4  /* j */
+.LL10:
+	__btrue		.LL11
+	__tst.wm	__main_end - 2  /* i */
+.LL11:
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20060929-1.c", 37; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20060929-1.c", 38; i = 44;
+.LL9:
+	__st.wmiq	44, __main_end - 2  /* i */
+
+	.dbg	line,	"tests/20060929-1.c", 39; p = &i;
+	__ld.wi		__main_end - 2  /* i */
+	__st.wmq	__main_end - 6  /* p */
+
+	.dbg	line,	"tests/20060929-1.c", 40; baz (&p, &j);
+	__ld.wi		__main_end - 6  /* p */
+	__pusharg.wr
+	__ld.wi		__main_end - 4  /* j */
+	__pusharg.wr
+	__call		_baz
+
+	.dbg	line,	"tests/20060929-1.c", 41; if (p - 1 != &i || j != 0 || i != 0)
+	__ld.wm		__main_end - 6  /* p */
+	__sub.wi	2
+	__neq_w.wi	__main_end - 2  /* i */
+	__btrue		.LL13
+	__tst.wm	__main_end - 4  /* j */
+.LL13:
+	__btrue		.LL14
+	__tst.wm	__main_end - 2  /* i */
+.LL14:
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/20060929-1.c", 42; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20060929-1.c", 43; return 0;
+.LL12:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/20060929-1.c", 44; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _main
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        56     56     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 56, 56
+__main_end	=	__overlay_frames + 6
+	.endm
@@ -0,0 +1,229 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20060930-1.c", 1; /* PR rtl-optimization/28096 */
+	.dbg	line,	"tests/20060930-1.c", 2; /* Origin: Jan Stein <jan@gatespacetelematics.com> */
+	.dbg	line,	"tests/20060930-1.c", 4; extern void abort (void);
+	.dbg	line,	"tests/20060930-1.c", 6; int bar (int, int);// __attribute__((noinline));
+	.dbg	line,	"tests/20060930-1.c", 7; int bar (int a, int b)
+	.dbg	line,	"tests/20060930-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20060930-1.c", 9; if (b != 1)
+	__ld.ws		0  /* b */
+	__neq_w.wi	1
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20060930-1.c", 10; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20060930-1.c", 11; }
+.LL3:
+.LL2:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20060930-1.c", 13; void foo(int, int);// __attribute__((noinline));
+	.dbg	line,	"tests/20060930-1.c", 14; void foo (int e, int n)
+	.dbg	line,	"tests/20060930-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20060930-1.c", 16; int i, bb2, bb5;
+
+	.dbg	line,	"tests/20060930-1.c", 18; if (e > 0)
+	__ld.ws		2  /* e */
+	__sgt_w.wi	0
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20060930-1.c", 19; e = -e;
+	__ld.ws		2  /* e */
+	__neg.wr
+	__st.wsq	2  /* e */
+
+	.dbg	line,	"tests/20060930-1.c", 21; for (i = 0; i < n; i++)
+.LL5:
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL6:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.ws	0  /* n */
+	__btrue		.LL8
+	__bra		.LL9
+.LL7:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL6
+.LL8:
+
+	.dbg	line,	"tests/20060930-1.c", 22; {
+
+	.dbg	line,	"tests/20060930-1.c", 23; if (e >= 0)
+	__ld.ws		2  /* e */
+	__sge_w.wi	0
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/20060930-1.c", 24; {
+
+	.dbg	line,	"tests/20060930-1.c", 25; bb2 = 0;
+	__st.wmiq	0, __foo_end - 4  /* bb2 */
+
+	.dbg	line,	"tests/20060930-1.c", 26; bb5 = 0;
+	__st.wmiq	0, __foo_end - 6  /* bb5 */
+
+	.dbg	line,	"tests/20060930-1.c", 27; }
+
+	.dbg	line,	"tests/20060930-1.c", 28; else
+	__bra		.LL11
+.LL10:
+
+	.dbg	line,	"tests/20060930-1.c", 29; {
+
+	.dbg	line,	"tests/20060930-1.c", 30; bb5 = -e;
+	__ld.ws		2  /* e */
+	__neg.wr
+	__st.wmq	__foo_end - 6  /* bb5 */
+
+	.dbg	line,	"tests/20060930-1.c", 31; bb2 = bb5;
+	__st.wmq	__foo_end - 4  /* bb2 */
+
+	.dbg	line,	"tests/20060930-1.c", 32; }
+.LL11:
+
+	.dbg	line,	"tests/20060930-1.c", 34; bar (bb5, bb2);
+	__ld.wm		__foo_end - 6  /* bb5 */
+	__pusharg.wr
+	__ld.wm		__foo_end - 4  /* bb2 */
+	__pusharg.wr
+	__ld.ws		0  /* b */
+	__neq_w.wi	1
+	__bfalse	.LL12
+	__call		_abort
+.LL12:
+.LL13:
+	__modsp		4
+
+	.dbg	line,	"tests/20060930-1.c", 35; }
+	__bra		.LL7
+.LL9:
+
+	.dbg	line,	"tests/20060930-1.c", 36; }
+.LL4:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20060930-1.c", 38; int main(void)
+	.dbg	line,	"tests/20060930-1.c", 39; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20060930-1.c", 40; foo (1, 1);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20060930-1.c", 41; return 0;
+	__ld.wi		0
+.LL14:
+
+	.dbg	line,	"tests/20060930-1.c", 42; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _foo
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       160     20     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 20, 160
+__foo_end	=	__overlay_frames + 6
+	.endm
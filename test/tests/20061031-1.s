@@ -0,0 +1,190 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20061031-1.c", 1; /* PR rtl-optimization/29631 */
+	.dbg	line,	"tests/20061031-1.c", 2; /* Origin: Falk Hueffner <falk@debian.org> */
+	.dbg	line,	"tests/20061031-1.c", 4; const signed char nunmap[] = { 17, -1, 1 };
+	.dbg	line,	"tests/20061031-1.c", 6; //__attribute__((noinline))
+	.dbg	line,	"tests/20061031-1.c", 7; void ff(int i) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ff
+	__enter		_ff
+
+	.dbg	line,	"tests/20061031-1.c", 8; //asm volatile("");
+
+	.dbg	line,	"tests/20061031-1.c", 9; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20061031-1.c", 11; //__attribute__((noinline))
+	.dbg	line,	"tests/20061031-1.c", 12; void f(short delta)
+	.dbg	line,	"tests/20061031-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/20061031-1.c", 14; short p0 = 2, s;
+	__st.wmiq	2, __f_end - 2  /* p0 */
+
+	.dbg	line,	"tests/20061031-1.c", 15; for (s = 0; s < 2; s++)
+	__st.wmiq	0, __f_end - 4  /* s */
+.LL4:
+	__ld.wm		__f_end - 4  /* s */
+	__slt_w.wi	2
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__f_end - 4  /* s */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/20061031-1.c", 16; {
+
+	.dbg	line,	"tests/20061031-1.c", 17; p0 += delta;
+	__ld.ws		0  /* delta */
+	__add_st.wmq	__f_end - 2  /* p0 */
+
+	.dbg	line,	"tests/20061031-1.c", 18; ff(s);
+	__ld.wm		__f_end - 4  /* s */
+	__pusharg.wr
+.LL8:
+	__modsp		2
+
+	.dbg	line,	"tests/20061031-1.c", 19; if (nunmap[p0] == 17) {
+	__ldx.wmq	__f_end - 2  /* p0 */
+	__ld.bax	_nunmap
+	__equ_w.wi	17
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20061031-1.c", 20; //asm volatile("");
+
+	.dbg	line,	"tests/20061031-1.c", 21; }
+
+	.dbg	line,	"tests/20061031-1.c", 22; }
+.LL9	.alias		.LL5
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/20061031-1.c", 23; }
+.LL3:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20061031-1.c", 25; int main(void)
+	.dbg	line,	"tests/20061031-1.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20061031-1.c", 27; f(-1);
+	__ld.wi		-1
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/20061031-1.c", 28; return 0;
+	__ld.wi		0
+.LL10:
+
+	.dbg	line,	"tests/20061031-1.c", 29; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_nunmap:
+		db	17
+		db	-1
+		db	1
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:3
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _f
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        98     14     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 14, 98
+__f_end	=	__overlay_frames + 4
+	.endm
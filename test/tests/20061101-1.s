@@ -0,0 +1,203 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20061101-1.c", 1; /* PR rtl-optimization/28970 */
+	.dbg	line,	"tests/20061101-1.c", 2; /* Origin: Peter Bergner <bergner@vnet.ibm.com> */
+	.dbg	line,	"tests/20061101-1.c", 4; extern void abort (void);
+	.dbg	line,	"tests/20061101-1.c", 6; int tar (int i)
+	.dbg	line,	"tests/20061101-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_tar
+	__enter		_tar
+
+	.dbg	line,	"tests/20061101-1.c", 8; if (i != 36863)
+	__ld.ws		0  /* i */
+	__neq_w.wi	36863
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20061101-1.c", 9; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20061101-1.c", 11; return -1;
+.LL3:
+	__ld.wi		-1
+.LL2:
+
+	.dbg	line,	"tests/20061101-1.c", 12; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20061101-1.c", 14; void bug(int q, int bcount)
+	.dbg	line,	"tests/20061101-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bug
+	__enter		_bug
+
+	.dbg	line,	"tests/20061101-1.c", 16; int j = 0;
+	__st.wmiq	0, __bug_end - 2  /* j */
+
+	.dbg	line,	"tests/20061101-1.c", 17; int outgo = 0;
+	__st.wmiq	0, __bug_end - 4  /* outgo */
+
+	.dbg	line,	"tests/20061101-1.c", 19; while(j != -1)
+.LL5:
+	__ld.wm		__bug_end - 2  /* j */
+	__neq_w.wi	-1
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20061101-1.c", 20; {
+
+	.dbg	line,	"tests/20061101-1.c", 21; outgo++;
+	__inc.wmq	__bug_end - 4  /* outgo */
+
+	.dbg	line,	"tests/20061101-1.c", 22; if (outgo > q-1)
+	__ld.ws		2  /* q */
+	__sub.wi	1
+	__slt_w.wm	__bug_end - 4  /* outgo */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/20061101-1.c", 23; outgo = q-1;
+	__ld.ws		2  /* q */
+	__sub.wi	1
+	__st.wmq	__bug_end - 4  /* outgo */
+
+	.dbg	line,	"tests/20061101-1.c", 24; j = tar (outgo*bcount);
+.LL7:
+	__ld.wm		__bug_end - 4  /* outgo */
+	__push.wr
+	__ld.ws		0  /* bcount */
+	__mul.wt
+	__pusharg.wr
+	__ld.ws		0  /* i */
+	__neq_w.wi	36863
+	__bfalse	.LL8
+	__call		_abort
+.LL8:
+	__ld.wi		-1
+.LL9:
+	__modsp		2
+	__st.wmq	__bug_end - 2  /* j */
+
+	.dbg	line,	"tests/20061101-1.c", 25; }
+	__bra		.LL5
+.LL6:
+
+	.dbg	line,	"tests/20061101-1.c", 26; }
+.LL4:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20061101-1.c", 28; int main(void)
+	.dbg	line,	"tests/20061101-1.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20061101-1.c", 30; bug(5, 36863);
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		36863
+	__pusharg.wr
+	__call		_bug
+
+	.dbg	line,	"tests/20061101-1.c", 31; return 0;
+	__ld.wi		0
+.LL10:
+
+	.dbg	line,	"tests/20061101-1.c", 32; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _bug
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       100     16     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 16, 100
+__bug_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,195 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20070212-1.c", 1; struct f
+	.dbg	line,	"tests/20070212-1.c", 2; {
+	.dbg	line,	"tests/20070212-1.c", 3; int i;
+	.dbg	line,	"tests/20070212-1.c", 4; };
+	.dbg	line,	"tests/20070212-1.c", 6; int g(int i, int c, struct f *ff, int *p)
+	.dbg	line,	"tests/20070212-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/20070212-1.c", 8; int *t;
+
+	.dbg	line,	"tests/20070212-1.c", 9; if (c)
+	__tst.ws	4  /* c */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20070212-1.c", 10; t = &i;
+	__lea.s		6  /* i */
+	__st.wmq	__g_end - 2  /* t */
+
+	.dbg	line,	"tests/20070212-1.c", 11; else
+	__bra		.LL4
+.LL3:
+
+	.dbg	line,	"tests/20070212-1.c", 12; t = &ff->i;
+	__ld.ws		2  /* ff */
+	__st.wmq	__g_end - 2  /* t */
+.LL4:
+
+	.dbg	line,	"tests/20070212-1.c", 13; *p = 0;
+	__ld.ws		0  /* p */
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+
+	.dbg	line,	"tests/20070212-1.c", 14; return *t;
+	__ld.wm		__g_end - 2  /* t */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+.LL2:
+
+	.dbg	line,	"tests/20070212-1.c", 15; }
+	__modsp		8
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__g_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20070212-1.c", 17; extern void abort(void);
+	.dbg	line,	"tests/20070212-1.c", 19; int main()
+	.dbg	line,	"tests/20070212-1.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20070212-1.c", 21; struct f f;
+
+	.dbg	line,	"tests/20070212-1.c", 22; f.i = 1;
+	__st.wmiq	1, __main_end - 2  /* f */
+
+	.dbg	line,	"tests/20070212-1.c", 23; if (g(5, 0, &f, &f.i) != 0)
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		__main_end - 2  /* f */
+	__pusharg.wr
+	__ld.wi		__main_end - 2  /* f */
+	__pusharg.wr
+	__tst.ws	4  /* c */
+	__bfalse	.LL7
+	__lea.s		6  /* i */
+	__st.wmq	__g_end - 2  /* t */
+	__bra		.LL8
+.LL7:
+	__ld.ws		2  /* ff */
+	__st.wmq	__g_end - 2  /* t */
+.LL8:
+	__ld.ws		0  /* p */
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+	__ld.wm		__g_end - 2  /* t */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+.LL9:
+	__modsp		8
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20070212-1.c", 24; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20070212-1.c", 25; return 0;
+.LL6:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/20070212-1.c", 26; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 6
+__main_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,158 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20070212-2.c", 1; int f(int k, int i1, int j1)
+	.dbg	line,	"tests/20070212-2.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/20070212-2.c", 3; int *f1;
+
+	.dbg	line,	"tests/20070212-2.c", 4; if(k)
+	__tst.ws	4  /* k */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20070212-2.c", 5; f1 = &i1;
+	__lea.s		2  /* i1 */
+	__st.wmq	__f_end - 2  /* f1 */
+
+	.dbg	line,	"tests/20070212-2.c", 6; else
+	__bra		.LL4
+.LL3:
+
+	.dbg	line,	"tests/20070212-2.c", 7; f1 = &j1;
+	__lea.s		0  /* j1 */
+	__st.wmq	__f_end - 2  /* f1 */
+.LL4:
+
+	.dbg	line,	"tests/20070212-2.c", 8; i1 = 0;
+	__st.wsiq	0, 2  /* i1 */
+
+	.dbg	line,	"tests/20070212-2.c", 9; return *f1;
+	__ld.wm		__f_end - 2  /* f1 */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+.LL2:
+
+	.dbg	line,	"tests/20070212-2.c", 10; }
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20070212-2.c", 12; extern void abort (void);
+	.dbg	line,	"tests/20070212-2.c", 14; int main()
+	.dbg	line,	"tests/20070212-2.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20070212-2.c", 16; if (f(1, 1, 2) != 0)
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__tst.ws	4  /* k */
+	__bfalse	.LL7
+	__lea.s		2  /* i1 */
+	__st.wmq	__f_end - 2  /* f1 */
+	__bra		.LL8
+.LL7:
+	__lea.s		0  /* j1 */
+	__st.wmq	__f_end - 2  /* f1 */
+.LL8:
+	__st.wsiq	0, 2  /* i1 */
+	__ld.wm		__f_end - 2  /* f1 */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+.LL9:
+	__modsp		6
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20070212-2.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20070212-2.c", 18; return 0;
+.LL6:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/20070212-2.c", 19; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
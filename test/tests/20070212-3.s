@@ -0,0 +1,205 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20070212-3.c", 1; struct foo { int i; int j; };
+	.dbg	line,	"tests/20070212-3.c", 3; int bar (struct foo *k, int k2, int f, int f2)
+	.dbg	line,	"tests/20070212-3.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/20070212-3.c", 5; int *p, *q;
+
+	.dbg	line,	"tests/20070212-3.c", 6; int res;
+
+	.dbg	line,	"tests/20070212-3.c", 7; if (f)
+	__tst.ws	2  /* f */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20070212-3.c", 8; p = &k->i;
+	__ld.ws		6  /* k */
+	__st.wmq	__bar_end - 2  /* p */
+
+	.dbg	line,	"tests/20070212-3.c", 9; else
+	__bra		.LL4
+.LL3:
+
+	.dbg	line,	"tests/20070212-3.c", 10; p = &k->j;
+	__ld.ws		6  /* k */
+	__add.wi	2
+	__st.wmq	__bar_end - 2  /* p */
+.LL4:
+
+	.dbg	line,	"tests/20070212-3.c", 11; res = *p;
+	__ld.wm		__bar_end - 2  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__bar_end - 6  /* res */
+
+	.dbg	line,	"tests/20070212-3.c", 12; k->i = 1;
+	__ld.ws		6  /* k */
+	__push.wr
+	__ld.wi		1
+	__st.wtq
+
+	.dbg	line,	"tests/20070212-3.c", 13; if (f2)
+	__tst.ws	0  /* f2 */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20070212-3.c", 14; q = p;
+	__ld.wm		__bar_end - 2  /* p */
+	__st.wmq	__bar_end - 4  /* q */
+
+	.dbg	line,	"tests/20070212-3.c", 15; else
+	__bra		.LL6
+.LL5:
+
+	.dbg	line,	"tests/20070212-3.c", 16; q = &k2;
+	__lea.s		4  /* k2 */
+	__st.wmq	__bar_end - 4  /* q */
+.LL6:
+
+	.dbg	line,	"tests/20070212-3.c", 17; return res + *q;
+	__ld.wm		__bar_end - 4  /* q */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wm	__bar_end - 6  /* res */
+.LL2:
+
+	.dbg	line,	"tests/20070212-3.c", 18; }
+	__modsp		8
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__bar_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20070212-3.c", 20; extern void abort (void);
+	.dbg	line,	"tests/20070212-3.c", 22; int main()
+	.dbg	line,	"tests/20070212-3.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20070212-3.c", 24; struct foo k;
+
+	.dbg	line,	"tests/20070212-3.c", 25; k.i = 0;
+	__st.wmiq	0, __main_end - 4  /* k */
+
+	.dbg	line,	"tests/20070212-3.c", 26; k.j = 1;
+	__st.wmiq	1, __main_end - 4 + 2  /* k */
+
+	.dbg	line,	"tests/20070212-3.c", 27; if (bar (&k, 1, 1, 1) != 1)
+	__ld.wi		__main_end - 4  /* k */
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__call		_bar
+	__neq_w.wi	1
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20070212-3.c", 28; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/20070212-3.c", 29; return 0;
+.LL8:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/20070212-3.c", 30; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 6, 6
+__main_end	=	__overlay_frames + 4
+	.endm
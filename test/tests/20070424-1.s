@@ -0,0 +1,174 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20070424-1.c", 1; extern void abort (void);
+	.dbg	line,	"tests/20070424-1.c", 2; extern void exit (int);
+	.dbg	line,	"tests/20070424-1.c", 4; void do_exit (void) { exit (0); }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_do_exit
+	__enter		_do_exit
+	__ld.wi		0
+	__call		_exit.1
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070424-1.c", 5; void do_abort (void) { abort (); }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_do_abort
+	__enter		_do_abort
+	__call		_abort
+.LL3:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070424-1.c", 7; void foo (int x, int a)
+	.dbg	line,	"tests/20070424-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/20070424-1.c", 9; if (x < a)
+	__ld.ws		2  /* x */
+	__slt_w.ws	0  /* a */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/20070424-1.c", 10; goto doit;
+	__modsp_goto	.LL6_stkp
+	__bra		.LL6
+
+	.dbg	line,	"tests/20070424-1.c", 11; do_exit ();
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+.LL7:
+
+	.dbg	line,	"tests/20070424-1.c", 12; if (x != a)
+	__ld.ws		2  /* x */
+	__neq_w.ws	0  /* a */
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/20070424-1.c", 13; goto doit;
+	__bra		.LL6
+
+	.dbg	line,	"tests/20070424-1.c", 15; /* else */
+
+	.dbg	line,	"tests/20070424-1.c", 16; do_abort ();
+.LL8:
+	__call		_abort
+.LL9	.alias		.LL4
+
+	.dbg	line,	"tests/20070424-1.c", 17; return;
+	__bra		.LL4
+
+	.dbg	line,	"tests/20070424-1.c", 19; doit:
+.LL6_stkp	=	0
+.LL6:
+
+	.dbg	line,	"tests/20070424-1.c", 20; do_abort ();
+	__call		_abort
+.LL10:
+
+	.dbg	line,	"tests/20070424-1.c", 21; }
+.LL4:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070424-1.c", 23; int main()
+	.dbg	line,	"tests/20070424-1.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20070424-1.c", 25; foo (1, 0);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/20070424-1.c", 26; return 0;
+	__ld.wi		0
+.LL11:
+
+	.dbg	line,	"tests/20070424-1.c", 27; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
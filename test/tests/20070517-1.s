@@ -0,0 +1,232 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20070517-1.c", 1; /* PR rtl-optimization/31691 */
+	.dbg	line,	"tests/20070517-1.c", 2; /* Origin: Chi-Hua Chen <stephaniechc-gccbug@yahoo.com> */
+	.dbg	line,	"tests/20070517-1.c", 4; extern void abort (void);
+	.dbg	line,	"tests/20070517-1.c", 6; //static int get_kind(int) __attribute__ ((noinline));
+	.dbg	line,	"tests/20070517-1.c", 8; static int get_kind(int v)
+	.dbg	line,	"tests/20070517-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_get_kind
+	__enter		_get_kind
+
+	.dbg	line,	"tests/20070517-1.c", 10; volatile int k; k = v;
+	__ld.ws		0  /* v */
+	__st.wmq	__get_kind_end - 2  /* k */
+
+	.dbg	line,	"tests/20070517-1.c", 11; return k;
+	__ld.wm		__get_kind_end - 2  /* k */
+.LL2:
+
+	.dbg	line,	"tests/20070517-1.c", 12; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__get_kind_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20070517-1.c", 14; //static int some_call(void) __attribute__ ((noinline));
+	.dbg	line,	"tests/20070517-1.c", 16; static int some_call(void)
+	.dbg	line,	"tests/20070517-1.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_some_call
+	__enter		_some_call
+
+	.dbg	line,	"tests/20070517-1.c", 18; return 0;
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/20070517-1.c", 19; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070517-1.c", 21; static void example (int arg)
+	.dbg	line,	"tests/20070517-1.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_example
+	__enter		_example
+
+	.dbg	line,	"tests/20070517-1.c", 23; int tmp, kind; kind = get_kind (arg);
+	__ld.ws		0  /* arg */
+	__pusharg.wr
+	__ld.ws		0  /* v */
+	__st.wmq	__get_kind_end - 2  /* k */
+	__ld.wm		__get_kind_end - 2  /* k */
+.LL5:
+	__modsp		2
+	__st.wmq	__example_end - 4  /* kind */
+
+	.dbg	line,	"tests/20070517-1.c", 25; if (kind == 9 || kind == 10 || kind == 5)
+	__equ_w.wi	9
+	__btrue		.LL7
+	__ld.wm		__example_end - 4  /* kind */
+	__equ_w.wi	10
+.LL7:
+	__btrue		.LL8
+	__ld.wm		__example_end - 4  /* kind */
+	__equ_w.wi	5
+.LL8:
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/20070517-1.c", 26; {
+
+	.dbg	line,	"tests/20070517-1.c", 27; if (some_call() == 0)
+	__ld.wi		0
+.LL10:
+	__not.wr
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/20070517-1.c", 28; {
+
+	.dbg	line,	"tests/20070517-1.c", 29; if (kind == 9 || kind == 10)
+	__ld.wm		__example_end - 4  /* kind */
+	__equ_w.wi	9
+	__btrue		.LL12
+	__ld.wm		__example_end - 4  /* kind */
+	__equ_w.wi	10
+.LL12:
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/20070517-1.c", 30; tmp = arg;
+	__ld.ws		0  /* arg */
+
+	.dbg	line,	"tests/20070517-1.c", 31; else
+	__bra		.LL13
+.LL11:
+
+	.dbg	line,	"tests/20070517-1.c", 32; abort();
+	__call		_abort
+.LL13:
+
+	.dbg	line,	"tests/20070517-1.c", 33; }
+
+	.dbg	line,	"tests/20070517-1.c", 34; }
+.LL9:
+
+	.dbg	line,	"tests/20070517-1.c", 35; } 
+.LL6:
+.LL4:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/20070517-1.c", 37; int main(void)
+	.dbg	line,	"tests/20070517-1.c", 38; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20070517-1.c", 39; example(10);
+	__ld.wi		10
+	__pusharg.wr
+	__call		_example
+
+	.dbg	line,	"tests/20070517-1.c", 40; return 0;
+	__ld.wi		0
+.LL14:
+
+	.dbg	line,	"tests/20070517-1.c", 41; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _example
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        14     14     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 14, 14
+__example_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,588 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20070623-1.c", 1; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/20070623-1.c", 3; int /*__attribute__((noinline))*/ nge(int a, int b) {return -(a >= b);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_nge
+	__enter		_nge
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL2:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070623-1.c", 4; int /*__attribute__((noinline))*/ ngt(int a, int b) {return -(a > b);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ngt
+	__enter		_ngt
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL3:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070623-1.c", 5; int /*__attribute__((noinline))*/ nle(int a, int b) {return -(a <= b);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_nle
+	__enter		_nle
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL4:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070623-1.c", 6; int /*__attribute__((noinline))*/ nlt(int a, int b) {return -(a < b);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_nlt
+	__enter		_nlt
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL5:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070623-1.c", 7; int /*__attribute__((noinline))*/ neq(int a, int b) {return -(a == b);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_neq
+	__enter		_neq
+	__ld.ws		2  /* a */
+	__equ_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL6:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070623-1.c", 8; int /*__attribute__((noinline))*/ nne(int a, int b) {return -(a != b);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_nne
+	__enter		_nne
+	__ld.ws		2  /* a */
+	__neq_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL7:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070623-1.c", 9; int /*__attribute__((noinline))*/ ngeu(unsigned a, unsigned b) {return -(a >= b);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ngeu
+	__enter		_ngeu
+	__ld.ws		2  /* a */
+	__uge_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL8:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070623-1.c", 10; int /*__attribute__((noinline))*/ ngtu(unsigned a, unsigned b) {return -(a > b);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ngtu
+	__enter		_ngtu
+	__ld.ws		2  /* a */
+	__ugt_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL9:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070623-1.c", 11; int /*__attribute__((noinline))*/ nleu(unsigned a, unsigned b) {return -(a <= b);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_nleu
+	__enter		_nleu
+	__ld.ws		2  /* a */
+	__ule_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL10:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070623-1.c", 12; int /*__attribute__((noinline))*/ nltu(unsigned a, unsigned b) {return -(a < b);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_nltu
+	__enter		_nltu
+	__ld.ws		2  /* a */
+	__ult_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL11:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/20070623-1.c", 15; int main()
+	.dbg	line,	"tests/20070623-1.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20070623-1.c", 17; if (nge(INT_MIN, INT_MAX) !=  0) abort();
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL14:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL13
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 18; if (nge(INT_MAX, INT_MIN) != -1) abort();
+.LL13:
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL16:
+	__modsp		4
+	__neq_w.wi	-1
+	__bfalse	.LL15
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 19; if (ngt(INT_MIN, INT_MAX) !=  0) abort();
+.LL15:
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL18:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL17
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 20; if (ngt(INT_MAX, INT_MIN) != -1) abort();
+.LL17:
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL20:
+	__modsp		4
+	__neq_w.wi	-1
+	__bfalse	.LL19
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 21; if (nle(INT_MIN, INT_MAX) != -1) abort();
+.LL19:
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL22:
+	__modsp		4
+	__neq_w.wi	-1
+	__bfalse	.LL21
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 22; if (nle(INT_MAX, INT_MIN) !=  0) abort();
+.LL21:
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL24:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL23
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 23; if (nlt(INT_MIN, INT_MAX) != -1) abort();
+.LL23:
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL26:
+	__modsp		4
+	__neq_w.wi	-1
+	__bfalse	.LL25
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 24; if (nlt(INT_MAX, INT_MIN) !=  0) abort();
+.LL25:
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL28:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL27
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 26; if (neq(INT_MIN, INT_MAX) !=  0) abort();
+.LL27:
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__equ_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL30:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL29
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 27; if (neq(INT_MAX, INT_MIN) !=  0) abort();
+.LL29:
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__equ_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL32:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL31
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 28; if (nne(INT_MIN, INT_MAX) != -1) abort();
+.LL31:
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__neq_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL34:
+	__modsp		4
+	__neq_w.wi	-1
+	__bfalse	.LL33
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 29; if (nne(INT_MAX, INT_MIN) != -1) abort();
+.LL33:
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__neq_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL36:
+	__modsp		4
+	__neq_w.wi	-1
+	__bfalse	.LL35
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 31; if (ngeu(0, ~0/*U*/) !=  0) abort();
+.LL35:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__uge_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL38:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL37
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 32; if (ngeu(~0/*U*/, 0) != -1) abort();
+.LL37:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__uge_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL40:
+	__modsp		4
+	__neq_w.wi	-1
+	__bfalse	.LL39
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 33; if (ngtu(0, ~0/*U*/) !=  0) abort();
+.LL39:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__ugt_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL42:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL41
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 34; if (ngtu(~0/*U*/, 0) != -1) abort();
+.LL41:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__ugt_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL44:
+	__modsp		4
+	__neq_w.wi	-1
+	__bfalse	.LL43
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 35; if (nleu(0, ~0/*U*/) != -1) abort();
+.LL43:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__ule_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL46:
+	__modsp		4
+	__neq_w.wi	-1
+	__bfalse	.LL45
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 36; if (nleu(~0/*U*/, 0) !=  0) abort();
+.LL45:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__ule_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL48:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL47
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 37; if (nltu(0, ~0/*U*/) != -1) abort();
+.LL47:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__ult_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL50:
+	__modsp		4
+	__neq_w.wi	-1
+	__bfalse	.LL49
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 38; if (nltu(~0/*U*/, 0) !=  0) abort();
+.LL49:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__ult_w.ws	0  /* b */
+	__bool
+	__neg.wr
+.LL52:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL51
+	__call		_abort
+
+	.dbg	line,	"tests/20070623-1.c", 39; 
+
+	.dbg	line,	"tests/20070623-1.c", 40; exit(0);
+.LL51:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20070623-1.c", 41; }
+.LL12:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:13
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,126 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20200414.c", 1; extern void abort(void);
+	.dbg	line,	"tests/20200414.c", 5; #pragma fastcall test_1_aa(word __ax) macro;
+	.dbg	line,	"tests/20200414.c", 9; char aa;
+	.dbg	line,	"tests/20200414.c", 13; #asm
+	.dbg	clear
+_test_1_aa.1 .macro
+		lda #2
+		sta [__ax]
+		.endm
+
+	.dbg	line,	"tests/20200414.c", 29; #endasm
+	.dbg	line,	"tests/20200414.c", 33; int main()
+	.dbg	line,	"tests/20200414.c", 35; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20200414.c", 37; aa = 1;
+	__st.umiq	1, _aa
+
+	.dbg	line,	"tests/20200414.c", 39; test_1_aa(&aa);
+	__ld.wi		_aa
+	__st.wmq	__ax
+	 _test_1_aa.1
+
+	.dbg	line,	"tests/20200414.c", 43; if (aa == 2)
+	__ld.umq	_aa
+	__equ_b.uiq	2
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20200414.c", 45; exit(0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20200414.c", 49; abort();
+.LL3:
+	__call		_abort
+
+	.dbg	line,	"tests/20200414.c", 53; exit(0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20200414.c", 55; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         7      7     1  aa
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_aa, 1, 7, 7
+	.endm
@@ -0,0 +1,132 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/20200415.c", 1; extern void abort(void);
+	.dbg	line,	"tests/20200415.c", 5; #incasmlabel(test1, "./tests/20200415_asm1.asm");
+
+	.data
+	.opt		d-
+	.page		2
+_test1:	.include	"./tests/20200415_asm1.asm"
+	.page		3
+	.opt		d+
+	.code
+
+	.dbg	line,	"tests/20200415.c", 7; #incasmlabel(test2, "./tests/20200415_asm2.asm", 3);
+
+	.data
+	.opt		d-
+	.page		3
+_test2:	.include	"./tests/20200415_asm2.asm"
+	.page		3
+	.opt		d+
+	.code
+
+	.dbg	line,	"tests/20200415.c", 9; #incasmlabel(test3, "./tests/20200415_asm3.asm", 2000);
+
+	.data
+	.opt		d-
+	.page		0
+_test3:	.include	"./tests/20200415_asm3.asm"
+	.page		3
+	.opt		d+
+	.code
+
+	.dbg	line,	"tests/20200415.c", 13; int main()
+	.dbg	line,	"tests/20200415.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/20200415.c", 17; char aa = 1;
+	__st.umiq	1, __main_end - 1  /* aa */
+
+	.dbg	line,	"tests/20200415.c", 19; if (aa == 1)
+	__ld.umq	__main_end - 1  /* aa */
+	__equ_b.uiq	1
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/20200415.c", 21; exit(0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20200415.c", 25; abort();
+.LL3:
+	__call		_abort
+
+	.dbg	line,	"tests/20200415.c", 29; exit(0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/20200415.c", 31; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 1
+leaf_needs	.set	1
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,149 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/920202-1.c", 1; static int rule_text_needs_stack_pop;// = 0;
+	.dbg	line,	"tests/920202-1.c", 2; static const int input_stack_pos = 1;
+	.dbg	line,	"tests/920202-1.c", 4; f (void)
+	.dbg	line,	"tests/920202-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/920202-1.c", 6; rule_text_needs_stack_pop = 1;
+	__st.wmiq	1, _rule_text_needs_stack_pop
+
+	.dbg	line,	"tests/920202-1.c", 8; if (input_stack_pos <= 0)
+	__ld.wi		1
+	__sle_w.wi	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/920202-1.c", 9; return 1;
+	__ld.wi		1
+	__bra		.LL2
+
+	.dbg	line,	"tests/920202-1.c", 10; else
+.LL3:
+
+	.dbg	line,	"tests/920202-1.c", 11; return 0;
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"tests/920202-1.c", 12; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/920202-1.c", 14; main ()
+	.dbg	line,	"tests/920202-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/920202-1.c", 16; rule_text_needs_stack_pop = 0;
+	__st.wmiq	0, _rule_text_needs_stack_pop
+
+	.dbg	line,	"tests/920202-1.c", 17; f ();
+	__st.wmiq	1, _rule_text_needs_stack_pop
+	__ld.wi		1
+	__sle_w.wi	0
+	__bfalse	.LL6
+	__ld.wi		1
+	__bra		.LL8
+.LL6:
+	__ld.wi		0
+.LL7:
+.LL8:
+
+	.dbg	line,	"tests/920202-1.c", 18; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/920202-1.c", 19; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_input_stack_pos:
+		dw	1
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:2
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  rule_text_needs_stack_pop
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_rule_text_needs_stack_pop, 2, 6, 6
+	.endm
@@ -0,0 +1,129 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/920428-1.c", 1; x(const char*s){char a[1];/*const*/ char*ss; ss=s;a[*s++]|=1;return /*(int)*/ss+1==/*(int)*/s;}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_x
+	__enter		_x
+	__ld.ws		0  /* s */
+	__st.wmq	__x_end - 3  /* ss */
+	__ldinc.ws	0  /* s */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__index.ur	__x_end - 1  /* a */
+	__ld.wi		1
+	__or_st.uatq	__x_end - 1  /* a */
+	__ld.wm		__x_end - 3  /* ss */
+	__add.wi	1
+	__equ_w.ws	0  /* s */
+.LL2:
+	__bool
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__x_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/920428-1.c", 2; main(){if(x("")!=1)abort();exit(0);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+	__ld.wi		__const1+0
+	__pusharg.wr
+	__ld.ws		0  /* s */
+	__st.wmq	__x_end - 3  /* ss */
+	__ldinc.ws	0  /* s */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__index.ur	__x_end - 1  /* a */
+	__ld.wi		1
+	__or_st.uatq	__x_end - 1  /* a */
+	__ld.wm		__x_end - 3  /* ss */
+	__add.wi	1
+	__equ_w.ws	0  /* s */
+.LL5:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL4
+	__call		_abort
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	$00
+
+	.bss
+	.code
+	.if		leaf_needs < 3
+leaf_needs	.set	3
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:1
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
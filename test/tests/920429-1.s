@@ -0,0 +1,152 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/920429-1.c", 1; #define t unsigned char
+	.dbg	line,	"tests/920429-1.c", 2; /*typedef unsigned char t;*/int i,j;
+	.dbg	line,	"tests/920429-1.c", 3; t*f(t*p){t c;c=*p++;i=((c&2)?1:0);j=(c&7)+1;return p;}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+	__ldinc.ws	0  /* p */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__st.umq	__f_end - 1  /* c */
+	__ld.um		__f_end - 1  /* c */
+	__tand.wi	2
+	__bfalse	.LL3
+	__ld.wi		1
+	__bra		.LL4
+.LL3:
+	__ld.wi		0
+.LL4:
+	__st.wmq	_i
+	__ld.um		__f_end - 1  /* c */
+	__and.uiq	7
+	__add.wi	1
+	__st.wmq	_j
+	__ld.ws		0  /* p */
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/920429-1.c", 4; main(){t*p0,*p1;p0="ab";p1=f(p0);if(p0+1!=p1)abort();exit(0);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+	__ld.wi		__const1+0
+	__st.wmq	__main_end - 2  /* p0 */
+	__pusharg.wr
+	__call		_f
+	__st.wmq	__main_end - 4  /* p1 */
+	__ld.wm		__main_end - 2  /* p0 */
+	__add.wi	1
+	__neq_w.wm	__main_end - 4  /* p1 */
+	__bfalse	.LL6
+	__call		_abort
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'a','b',$00
+
+	.bss
+	.code
+	.if		leaf_needs < 1
+leaf_needs	.set	1
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:3
+;	constant pool:0
+;	global pool:6
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     4  overlaid locals
+;         2      2     2  i
+;         2      2     2  j
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 10, 10
+__main_end	=	__overlay_frames + 4
+	auto_zp_var	_i, 2, 2, 2
+	auto_zp_var	_j, 2, 2, 2
+	.endm
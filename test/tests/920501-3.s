@@ -0,0 +1,215 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/920501-3.c", 1; int tab[9];
+	.dbg	line,	"tests/920501-3.c", 2; execute(oip, ip)
+	.dbg	line,	"tests/920501-3.c", 3; unsigned short *oip, *ip;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_execute
+	__enter		_execute
+
+	.dbg	line,	"tests/920501-3.c", 4; {
+
+	.dbg	line,	"tests/920501-3.c", 5; #ifndef NO_LABEL_VALUES
+
+	.dbg	line,	"tests/920501-3.c", 6; int x = 0;
+
+	.dbg	line,	"tests/920501-3.c", 7; int *xp = tab;
+
+	.dbg	line,	"tests/920501-3.c", 8; base:
+
+	.dbg	line,	"tests/920501-3.c", 9; x++;
+
+	.dbg	line,	"tests/920501-3.c", 10; if (x == 4)
+
+	.dbg	line,	"tests/920501-3.c", 11; {
+
+	.dbg	line,	"tests/920501-3.c", 12; *xp = 0;
+
+	.dbg	line,	"tests/920501-3.c", 13; return;
+
+	.dbg	line,	"tests/920501-3.c", 14; }
+
+	.dbg	line,	"tests/920501-3.c", 15; *xp++ = ip - oip;
+
+	.dbg	line,	"tests/920501-3.c", 16; goto *(&&base + *ip++);
+
+	.dbg	line,	"tests/920501-3.c", 17; #else
+
+	.dbg	line,	"tests/920501-3.c", 18; tab[0] = 0;
+	__st.wmiq	0, _tab
+
+	.dbg	line,	"tests/920501-3.c", 19; tab[1] = 1;
+	__st.wmiq	1, _tab + 2
+
+	.dbg	line,	"tests/920501-3.c", 20; tab[2] = 2;
+	__st.wmiq	2, _tab + 4
+
+	.dbg	line,	"tests/920501-3.c", 21; tab[3] = 0;
+	__st.wmiq	0, _tab + 6
+
+	.dbg	line,	"tests/920501-3.c", 22; #endif
+
+	.dbg	line,	"tests/920501-3.c", 23; }
+.LL2:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/920501-3.c", 25; main()
+	.dbg	line,	"tests/920501-3.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/920501-3.c", 27; unsigned short ip[10];
+
+	.dbg	line,	"tests/920501-3.c", 28; int i;
+
+	.dbg	line,	"tests/920501-3.c", 29; for (i = 0; i < 10; i++)
+	__st.wmiq	0, __main_end - 22  /* i */
+.LL4:
+	__ld.wm		__main_end - 22  /* i */
+	__slt_w.wi	10
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__main_end - 22  /* i */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/920501-3.c", 30; ip[i] = 0;
+	__ld2x.wmq	__main_end - 22  /* i */
+	__st.waxiq	0, __main_end - 20  /* ip */
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/920501-3.c", 31; execute(ip, ip);
+	__ld.wi		__main_end - 20  /* ip */
+	__pusharg.wr
+	__ld.wi		__main_end - 20  /* ip */
+	__pusharg.wr
+	__st.wmiq	0, _tab
+	__st.wmiq	1, _tab + 2
+	__st.wmiq	2, _tab + 4
+	__st.wmiq	0, _tab + 6
+.LL8:
+	__modsp		4
+
+	.dbg	line,	"tests/920501-3.c", 32; if (tab[0] != 0 || tab[1] != 1 || tab[2] != 2 || tab[3] != 0)
+	__tst.wm	_tab
+	__btrue		.LL10
+	__ld.wm		_tab + 2
+	__neq_w.wi	1
+.LL10:
+	__btrue		.LL11
+	__ld.wm		_tab + 4
+	__neq_w.wi	2
+.LL11:
+	__btrue		.LL12
+	__tst.wm	_tab + 6
+.LL12:
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/920501-3.c", 33; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/920501-3.c", 34; exit(0);
+.LL9:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/920501-3.c", 35; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_tab:
+		ds	18
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    22  _main
+;
+; 22 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        84     14    22  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 22, 14, 84
+__main_end	=	__overlay_frames + 22
+	.endm
@@ -0,0 +1,212 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/920520-1.c", 1; foo(int *bar)
+	.dbg	line,	"tests/920520-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/920520-1.c", 3; *bar = 8;
+	__ld.ws		0  /* bar */
+	__push.wr
+	__ld.wi		8
+	__st.wtq
+
+	.dbg	line,	"tests/920520-1.c", 4; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/920520-1.c", 6; bugger()
+	.dbg	line,	"tests/920520-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bugger
+	__enter		_bugger
+
+	.dbg	line,	"tests/920520-1.c", 8; int oldDepth, newDepth;
+
+	.dbg	line,	"tests/920520-1.c", 10; foo(&oldDepth);
+	__ld.wi		__bugger_end - 2  /* oldDepth */
+	__pusharg.wr
+	__ld.ws		0  /* bar */
+	__push.wr
+	__ld.wi		8
+	__st.wtq
+.LL4:
+	__modsp		2
+
+	.dbg	line,	"tests/920520-1.c", 12; switch (oldDepth)
+	__ld.wm		__bugger_end - 2  /* oldDepth */
+	__bra		.LL5
+
+	.dbg	line,	"tests/920520-1.c", 13; {
+
+	.dbg	line,	"tests/920520-1.c", 14; case 8:
+.LL7:
+.LL8:
+
+	.dbg	line,	"tests/920520-1.c", 15; case 500:
+	__case		500
+
+	.dbg	line,	"tests/920520-1.c", 16; newDepth = 8;
+	__st.wmiq	8, __bugger_end - 4  /* newDepth */
+
+	.dbg	line,	"tests/920520-1.c", 17; break;
+	__bra		.LL6
+
+	.dbg	line,	"tests/920520-1.c", 19; case 5000:
+.LL9:
+	__case		5000
+
+	.dbg	line,	"tests/920520-1.c", 20; newDepth = 500;
+	__st.wmiq	500, __bugger_end - 4  /* newDepth */
+
+	.dbg	line,	"tests/920520-1.c", 21; break;
+	__bra		.LL6
+
+	.dbg	line,	"tests/920520-1.c", 23; default:
+.LL10:
+	__default
+
+	.dbg	line,	"tests/920520-1.c", 24; newDepth = 17;
+	__st.wmiq	17, __bugger_end - 4  /* newDepth */
+
+	.dbg	line,	"tests/920520-1.c", 25; break;
+	__bra		.LL6
+
+	.dbg	line,	"tests/920520-1.c", 26; }
+.LL5:
+	__switch_c.wr	3
+
+!table:		dw	5000, 500, 8
+		dw	.LL10
+		dw	.LL9, .LL8, .LL7
+
+.LL6:
+
+	.dbg	line,	"tests/920520-1.c", 28; return newDepth - oldDepth;
+	__ld.wm		__bugger_end - 4  /* newDepth */
+	__sub.wm	__bugger_end - 2  /* oldDepth */
+.LL3:
+
+	.dbg	line,	"tests/920520-1.c", 29; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/920520-1.c", 31; main()
+	.dbg	line,	"tests/920520-1.c", 32; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/920520-1.c", 33; if (bugger() != 0)
+	__call		_bugger
+	__tst.wr
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/920520-1.c", 34; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/920520-1.c", 35; exit (0);
+.LL12:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/920520-1.c", 36; }
+.LL11:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _bugger
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        14     14     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 14, 14
+__bugger_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,153 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/920612-2.c", 1; int i;// = 0;
+	.dbg	line,	"tests/920612-2.c", 2; int a (int x)
+	.dbg	line,	"tests/920612-2.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_a
+	__enter		_a
+
+	.dbg	line,	"tests/920612-2.c", 4; while (x)
+.LL3:
+	__tst.ws	0  /* x */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/920612-2.c", 5; i++, x--;
+	__inc.wmq	_i
+	__dec.wsq	0  /* x */
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/920612-2.c", 6; return x;
+	__ld.ws		0  /* x */
+.LL2:
+
+	.dbg	line,	"tests/920612-2.c", 7; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/920612-2.c", 8; main ()
+	.dbg	line,	"tests/920612-2.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/920612-2.c", 10; i = 0;
+	__st.wmiq	0, _i
+
+	.dbg	line,	"tests/920612-2.c", 11; #ifndef NO_TRAMPOLINES
+
+	.dbg	line,	"tests/920612-2.c", 12; if (a (2) != 0)
+	__ld.wi		2
+	__pusharg.wr
+.LL7:
+	__tst.ws	0  /* x */
+	__bfalse	.LL8
+	__inc.wmq	_i
+	__dec.wsq	0  /* x */
+	__bra		.LL7
+.LL8:
+	__ld.ws		0  /* x */
+.LL9:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/920612-2.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/920612-2.c", 14; #endif
+
+	.dbg	line,	"tests/920612-2.c", 15; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/920612-2.c", 16; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        36      8     2  i
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_i, 2, 8, 36
+	.endm
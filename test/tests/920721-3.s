@@ -0,0 +1,245 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/920721-3.c", 1; static /*inline*/ fu (unsigned short data)
+	.dbg	line,	"tests/920721-3.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_fu
+	__enter		_fu
+
+	.dbg	line,	"tests/920721-3.c", 3; return data;
+	__ld.ws		0  /* data */
+.LL2:
+
+	.dbg	line,	"tests/920721-3.c", 4; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/920721-3.c", 5; ru(int i)
+	.dbg	line,	"tests/920721-3.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ru
+	__enter		_ru
+
+	.dbg	line,	"tests/920721-3.c", 7; if(fu(i++)!=5)abort();
+	__ldinc.ws	0  /* i */
+	__pusharg.wr
+	__ld.ws		0  /* data */
+.LL5:
+	__modsp		2
+	__neq_w.wi	5
+	__bfalse	.LL4
+	__call		_abort
+
+	.dbg	line,	"tests/920721-3.c", 8; if(fu(++i)!=7)abort();
+.LL4:
+	__incld.ws	0  /* i */
+	__pusharg.wr
+	__ld.ws		0  /* data */
+.LL7:
+	__modsp		2
+	__neq_w.wi	7
+	__bfalse	.LL6
+	__call		_abort
+
+	.dbg	line,	"tests/920721-3.c", 9; }
+.LL6:
+.LL3:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/920721-3.c", 10; static /*inline*/ fs (signed short data)
+	.dbg	line,	"tests/920721-3.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_fs
+	__enter		_fs
+
+	.dbg	line,	"tests/920721-3.c", 12; return data;
+	__ld.ws		0  /* data */
+.LL8:
+
+	.dbg	line,	"tests/920721-3.c", 13; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/920721-3.c", 14; rs(int i)
+	.dbg	line,	"tests/920721-3.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_rs
+	__enter		_rs
+
+	.dbg	line,	"tests/920721-3.c", 16; if(fs(i++)!=5)abort();
+	__ldinc.ws	0  /* i */
+	__pusharg.wr
+	__ld.ws		0  /* data */
+.LL11:
+	__modsp		2
+	__neq_w.wi	5
+	__bfalse	.LL10
+	__call		_abort
+
+	.dbg	line,	"tests/920721-3.c", 17; if(fs(++i)!=7)abort();
+.LL10:
+	__incld.ws	0  /* i */
+	__pusharg.wr
+	__ld.ws		0  /* data */
+.LL13:
+	__modsp		2
+	__neq_w.wi	7
+	__bfalse	.LL12
+	__call		_abort
+
+	.dbg	line,	"tests/920721-3.c", 18; }
+.LL12:
+.LL9:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/920721-3.c", 21; main()
+	.dbg	line,	"tests/920721-3.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/920721-3.c", 23; ru(5);
+	__ld.wi		5
+	__pusharg.wr
+	__ldinc.ws	0  /* i */
+	__pusharg.wr
+	__ld.ws		0  /* data */
+.LL15:
+	__modsp		2
+	__neq_w.wi	5
+	__bfalse	.LL16
+	__call		_abort
+.LL16:
+	__incld.ws	0  /* i */
+	__pusharg.wr
+	__ld.ws		0  /* data */
+.LL17:
+	__modsp		2
+	__neq_w.wi	7
+	__bfalse	.LL18
+	__call		_abort
+.LL18:
+.LL19:
+	__modsp		2
+
+	.dbg	line,	"tests/920721-3.c", 24; rs(5);
+	__ld.wi		5
+	__pusharg.wr
+	__ldinc.ws	0  /* i */
+	__pusharg.wr
+	__ld.ws		0  /* data */
+.LL20:
+	__modsp		2
+	__neq_w.wi	5
+	__bfalse	.LL21
+	__call		_abort
+.LL21:
+	__incld.ws	0  /* i */
+	__pusharg.wr
+	__ld.ws		0  /* data */
+.LL22:
+	__modsp		2
+	__neq_w.wi	7
+	__bfalse	.LL23
+	__call		_abort
+.LL23:
+.LL24:
+	__modsp		2
+
+	.dbg	line,	"tests/920721-3.c", 25; exit(0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/920721-3.c", 26; }
+.LL14:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:7
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,232 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/920730-1.c", 1; /* 920730-1.c */
+	.dbg	line,	"tests/920730-1.c", 2; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/920730-1.c", 3; f1()
+	.dbg	line,	"tests/920730-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f1
+	__enter		_f1
+
+	.dbg	line,	"tests/920730-1.c", 5; int b=INT_MIN;
+	__st.wmiq	-32768, __f1_end - 2  /* b */
+
+	.dbg	line,	"tests/920730-1.c", 6; return b>=INT_MIN;
+	__ld.wm		__f1_end - 2  /* b */
+	__uge_w.wi	-32768
+.LL2:
+	__bool
+
+	.dbg	line,	"tests/920730-1.c", 7; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f1_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/920730-1.c", 9; f2()
+	.dbg	line,	"tests/920730-1.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f2
+	__enter		_f2
+
+	.dbg	line,	"tests/920730-1.c", 11; int b=INT_MIN+1;
+	__st.wmiq	-32767, __f2_end - 2  /* b */
+
+	.dbg	line,	"tests/920730-1.c", 12; return b>= /*(unsigned)*/(INT_MAX+2);
+	__ld.wm		__f2_end - 2  /* b */
+	__sge_w.wi	32769
+.LL3:
+	__bool
+
+	.dbg	line,	"tests/920730-1.c", 13; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f2_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/920730-1.c", 15; f3()
+	.dbg	line,	"tests/920730-1.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f3
+	__enter		_f3
+
+	.dbg	line,	"tests/920730-1.c", 17; int b=INT_MAX;
+	__st.wmiq	32767, __f3_end - 2  /* b */
+
+	.dbg	line,	"tests/920730-1.c", 18; return b>=INT_MAX;
+	__ld.wm		__f3_end - 2  /* b */
+	__sge_w.wi	32767
+.LL4:
+	__bool
+
+	.dbg	line,	"tests/920730-1.c", 19; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f3_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/920730-1.c", 21; f4()
+	.dbg	line,	"tests/920730-1.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f4
+	__enter		_f4
+
+	.dbg	line,	"tests/920730-1.c", 23; int b=-1;
+	__st.wmiq	-1, __f4_end - 2  /* b */
+
+	.dbg	line,	"tests/920730-1.c", 24; return b>=UINT_MAX;
+	__ld.wm		__f4_end - 2  /* b */
+	__uge_w.wi	65535
+.LL5:
+	__bool
+
+	.dbg	line,	"tests/920730-1.c", 25; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f4_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/920730-1.c", 27; main ()
+	.dbg	line,	"tests/920730-1.c", 28; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/920730-1.c", 29; if((f1()&f2()&f3()&f4())!=1)
+	__st.wmiq	-32768, __f1_end - 2  /* b */
+	__ld.wm		__f1_end - 2  /* b */
+	__uge_w.wi	-32768
+.LL8:
+	__bool
+	__push.wr
+	__st.wmiq	-32767, __f2_end - 2  /* b */
+	__ld.wm		__f2_end - 2  /* b */
+	__sge_w.wi	32769
+.LL9:
+	__bool
+	__and.wt
+	__push.wr
+	__st.wmiq	32767, __f3_end - 2  /* b */
+	__ld.wm		__f3_end - 2  /* b */
+	__sge_w.wi	32767
+.LL10:
+	__bool
+	__and.wt
+	__push.wr
+	__st.wmiq	-1, __f4_end - 2  /* b */
+	__ld.wm		__f4_end - 2  /* b */
+	__uge_w.wi	65535
+.LL11:
+	__bool
+	__and.wt
+	__neq_w.wi	1
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/920730-1.c", 30; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/920730-1.c", 31; exit(0);
+.LL7:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/920730-1.c", 32; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:7
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
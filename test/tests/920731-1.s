@@ -0,0 +1,140 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/920731-1.c", 1; f(int x){int i;for(i=0;i<8&&(x&1)==0;x>>=1,i++);return i;}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+	__st.wmiq	0, __f_end - 2  /* i */
+.LL3:
+	__ld.wm		__f_end - 2  /* i */
+	__slt_w.wi	8
+	__bfalse	.LL7
+	__ld.ws		0  /* x */
+	__nand.wi	1
+.LL7:
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__ld.ws		0  /* x */
+	__asr.wi	1
+	__st.wsq	0  /* x */
+	__inc.wmq	__f_end - 2  /* i */
+	__bra		.LL3
+.LL5	.alias		.LL4
+.LL6:
+	__ld.wm		__f_end - 2  /* i */
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/920731-1.c", 2; main(){if(f(4)!=2)abort();exit(0);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+	__ld.wi		4
+	__pusharg.wr
+	__st.wmiq	0, __f_end - 2  /* i */
+.LL10:
+	__ld.wm		__f_end - 2  /* i */
+	__slt_w.wi	8
+	__bfalse	.LL11
+	__ld.ws		0  /* x */
+	__nand.wi	1
+.LL11:
+	__btrue		.LL13
+	__bra		.LL14
+.LL12:
+	__ld.ws		0  /* x */
+	__asr.wi	1
+	__st.wsq	0  /* x */
+	__inc.wmq	__f_end - 2  /* i */
+	__bra		.LL10
+.LL13	.alias		.LL12
+.LL14:
+	__ld.wm		__f_end - 2  /* i */
+.LL15:
+	__modsp		2
+	__neq_w.wi	2
+	__bfalse	.LL9
+	__call		_abort
+.LL9:
+	__ld.wi		0
+	__call		_exit.1
+.LL8:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,105 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/920810-1.c", 1; #ifdef __HUCC__
+	.dbg	line,	"tests/920810-1.c", 3; // malloc() is not supported in HuCC at this time.
+	.dbg	line,	"tests/920810-1.c", 4; main()
+	.dbg	line,	"tests/920810-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/920810-1.c", 6; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/920810-1.c", 7; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/920810-1.c", 9; #else
+	.dbg	line,	"tests/920810-1.c", 11; //#include <stdio.h>
+	.dbg	line,	"tests/920810-1.c", 12; #include <string.h>
+	.dbg	line,	"tests/920810-1.c", 13; #include <stdlib.h>
+	.dbg	line,	"tests/920810-1.c", 15; typedef struct{void*super;int name;int size;}t;
+	.dbg	line,	"tests/920810-1.c", 16; t*f(t*clas,int size)
+	.dbg	line,	"tests/920810-1.c", 17; {
+	.dbg	line,	"tests/920810-1.c", 18; t*child;child=(t*)malloc(size);
+	.dbg	line,	"tests/920810-1.c", 19; memcpy(child,clas,clas->size);
+	.dbg	line,	"tests/920810-1.c", 20; child->super=clas;
+	.dbg	line,	"tests/920810-1.c", 21; child->name=0;
+	.dbg	line,	"tests/920810-1.c", 22; child->size=size;
+	.dbg	line,	"tests/920810-1.c", 23; return child;
+	.dbg	line,	"tests/920810-1.c", 24; }
+	.dbg	line,	"tests/920810-1.c", 25; main()
+	.dbg	line,	"tests/920810-1.c", 26; {
+	.dbg	line,	"tests/920810-1.c", 27; t foo,*bar;
+	.dbg	line,	"tests/920810-1.c", 28; memset(&foo,37,sizeof(t));
+	.dbg	line,	"tests/920810-1.c", 29; foo.size=sizeof(t);
+	.dbg	line,	"tests/920810-1.c", 30; bar=f(&foo,sizeof(t));
+	.dbg	line,	"tests/920810-1.c", 31; if(bar->super!=&foo||bar->name!=0||bar->size!=sizeof(t))abort();
+	.dbg	line,	"tests/920810-1.c", 32; exit(0);
+	.dbg	line,	"tests/920810-1.c", 33; }
+	.dbg	line,	"tests/920810-1.c", 35; #endif // __HUCC__
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,134 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/920909-1.c", 1; f(int a){switch(a){case 0x402:return a+1;case 0x403:return a+2;case 0x404:return a+3;case 0x405:return a+4;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+	__ld.ws		0  /* a */
+	__bra		.LL3
+.LL5:
+	__case		1026
+	__ld.ws		0  /* a */
+	__add.wi	1
+	__bra		.LL2
+.LL6:
+	__case		1027
+	__ld.ws		0  /* a */
+	__add.wi	2
+	__bra		.LL2
+.LL7:
+	__case		1028
+	__ld.ws		0  /* a */
+	__add.wi	3
+	__bra		.LL2
+.LL8:
+	__case		1029
+	__ld.ws		0  /* a */
+	__add.wi	4
+	__bra		.LL2
+
+	.dbg	line,	"tests/920909-1.c", 2; case 0x406:return 1;case 0x407:return 4;}return 0;}
+.LL9:
+	__case		1030
+	__ld.wi		1
+	__bra		.LL2
+.LL10:
+	__case		1031
+	__ld.wi		4
+	__bra		.LL2
+.LL3:
+	__switch_r.wr	1026, 1031
+
+!table:		dw	.LL5, .LL6, .LL7, .LL8, .LL9, .LL10
+		dw	.LL4
+.LL4:
+	__ld.wi		0
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/920909-1.c", 3; main(){if(f(1))abort();exit(0);}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+	__ld.wi		1
+	__pusharg.wr
+	__call		_f
+	__tst.wr
+	__bfalse	.LL12
+	__call		_abort
+.LL12:
+	__ld.wi		0
+	__call		_exit.1
+.LL11:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
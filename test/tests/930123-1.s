@@ -0,0 +1,161 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/930123-1.c", 1; f(int *x)
+	.dbg	line,	"tests/930123-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/930123-1.c", 3; *x = 0;
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+
+	.dbg	line,	"tests/930123-1.c", 4; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930123-1.c", 6; main()
+	.dbg	line,	"tests/930123-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/930123-1.c", 8; int s, c, x;
+
+	.dbg	line,	"tests/930123-1.c", 9; char a[2]; a[0] = 'c'; a[1] = 0;
+	__st.umiq	99, __main_end - 8  /* a */
+	__st.umiq	0, __main_end - 8 + 1  /* a */
+
+	.dbg	line,	"tests/930123-1.c", 11; f(&s);
+	__ld.wi		__main_end - 2  /* s */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+.LL4:
+	__modsp		2
+
+	.dbg	line,	"tests/930123-1.c", 12; a[c = 0] = s == 0 ? (x=1, 'a') : (x=2, 'b');
+	__ld.wi		0
+	__st.wm		__main_end - 4  /* c */
+	__index.ur	__main_end - 8  /* a */
+	__not.wm	__main_end - 2  /* s */
+	__bfalse	.LL5
+	__ld.wi		97
+	__bra		.LL6
+.LL5:
+	__ld.wi		98
+.LL6:
+	__st.uatq	__main_end - 8  /* a */
+
+	.dbg	line,	"tests/930123-1.c", 13; if (a[c] != 'a')
+	__ldx.wmq	__main_end - 4  /* c */
+	__ld.uaxq	__main_end - 8  /* a */
+	__neq_b.uiq	97
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/930123-1.c", 14; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/930123-1.c", 15; exit (0);
+.LL7:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/930123-1.c", 16; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     8  _main
+;
+; 8 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        20     20     8  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 8, 20, 20
+__main_end	=	__overlay_frames + 8
+	.endm
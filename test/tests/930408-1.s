@@ -0,0 +1,163 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/930408-1.c", 1; typedef enum foo E;
+	.dbg	line,	"tests/930408-1.c", 2; enum foo { e0, e1 };
+	.dbg	line,	"tests/930408-1.c", 4; struct {
+	.dbg	line,	"tests/930408-1.c", 5; E eval;
+	.dbg	line,	"tests/930408-1.c", 6; } s;
+	.dbg	line,	"tests/930408-1.c", 8; p()
+	.dbg	line,	"tests/930408-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_p
+	__enter		_p
+
+	.dbg	line,	"tests/930408-1.c", 10; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/930408-1.c", 11; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930408-1.c", 13; f()
+	.dbg	line,	"tests/930408-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/930408-1.c", 15; switch (s.eval)
+	__ld.wm		_s
+	__bra		.LL4
+
+	.dbg	line,	"tests/930408-1.c", 16; {
+
+	.dbg	line,	"tests/930408-1.c", 17; case e0:
+.LL6:
+	__case		0
+
+	.dbg	line,	"tests/930408-1.c", 18; p();
+	__call		_abort
+.LL7	.alias		.LL5
+
+	.dbg	line,	"tests/930408-1.c", 19; }
+	__bra		.LL5
+.LL4:
+	__switch_r.wr	0, 0
+
+!table:		dw	.LL6
+		dw	.LL5
+.LL5:
+
+	.dbg	line,	"tests/930408-1.c", 20; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930408-1.c", 22; main()
+	.dbg	line,	"tests/930408-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/930408-1.c", 24; s.eval = e1;
+	__st.wmiq	1, _s
+
+	.dbg	line,	"tests/930408-1.c", 25; f();
+	__call		_f
+
+	.dbg	line,	"tests/930408-1.c", 26; exit(0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/930408-1.c", 27; }
+.LL8:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  s
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_s, 2, 4, 4
+	.endm
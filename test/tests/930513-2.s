@@ -0,0 +1,200 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/930513-2.c", 1; sub3 (i)
+	.dbg	line,	"tests/930513-2.c", 2; /*const*/ int *i;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_sub3
+	__enter		_sub3
+
+	.dbg	line,	"tests/930513-2.c", 3; {
+
+	.dbg	line,	"tests/930513-2.c", 4; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930513-2.c", 6; eq (int a, int b)
+	.dbg	line,	"tests/930513-2.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_eq
+	__enter		_eq
+
+	.dbg	line,	"tests/930513-2.c", 8; static int i;// = 0;
+
+	.dbg	line,	"tests/930513-2.c", 9; if (a != i)
+	__ld.ws		2  /* a */
+	__neq_w.wm	SL4  /* i */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/930513-2.c", 10; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930513-2.c", 11; i++;
+.LL5:
+	__inc.wmq	SL4  /* i */
+
+	.dbg	line,	"tests/930513-2.c", 12; }
+.LL3:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930513-2.c", 14; main ()
+	.dbg	line,	"tests/930513-2.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/930513-2.c", 16; int i;
+
+	.dbg	line,	"tests/930513-2.c", 18; for (i = 0; i < 4; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL7:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	4
+	__btrue		.LL9
+	__bra		.LL10
+.LL8:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL7
+.LL9:
+
+	.dbg	line,	"tests/930513-2.c", 19; {
+
+	.dbg	line,	"tests/930513-2.c", 20; /*const*/ int j, k; j = i;
+	__ld.wm		__main_end - 2  /* i */
+	__st.wmq	__main_end - 4  /* j */
+
+	.dbg	line,	"tests/930513-2.c", 21; //int k;
+
+	.dbg	line,	"tests/930513-2.c", 22; sub3 (&j);
+	__ld.wi		__main_end - 4  /* j */
+	__pusharg.wr
+.LL11:
+	__modsp		2
+
+	.dbg	line,	"tests/930513-2.c", 23; k = j;
+	__ld.wm		__main_end - 4  /* j */
+	__st.wmq	__main_end - 6  /* k */
+
+	.dbg	line,	"tests/930513-2.c", 24; eq (k, k);
+	__pusharg.wr
+	__ld.wm		__main_end - 6  /* k */
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__neq_w.wm	SL4  /* k */
+	__bfalse	.LL12
+	__call		_abort
+.LL12:
+	__inc.wmq	SL4  /* k */
+.LL13:
+	__modsp		4
+
+	.dbg	line,	"tests/930513-2.c", 25; }
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/930513-2.c", 26; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/930513-2.c", 27; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _main
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       160     20     6  overlaid locals
+;        38     10     2  i (static in eq())
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 20, 160
+__main_end	=	__overlay_frames + 6
+	auto_zp_var	SL4, 2, 10, 38
+	.endm
@@ -0,0 +1,186 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/930518-1.c", 1; int bar;// = 0;
+	.dbg	line,	"tests/930518-1.c", 3; f (p)
+	.dbg	line,	"tests/930518-1.c", 4; int *p;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/930518-1.c", 5; {
+
+	.dbg	line,	"tests/930518-1.c", 6; int foo = 2;
+	__st.wmiq	2, __f_end - 2  /* foo */
+
+	.dbg	line,	"tests/930518-1.c", 8; while (foo > bar)
+.LL3:
+	__ld.wm		__f_end - 2  /* foo */
+	__sgt_w.wm	_bar
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/930518-1.c", 9; {
+
+	.dbg	line,	"tests/930518-1.c", 10; foo -=  bar;
+	__ld.wm		_bar
+	__isub_st.wmq	__f_end - 2  /* foo */
+
+	.dbg	line,	"tests/930518-1.c", 11; *p++ = foo;
+	__ld.ws		0  /* p */
+	__add.wi	2
+	__st.ws		0  /* p */
+	__sub.wi	2
+	__push.wr
+	__ld.wm		__f_end - 2  /* foo */
+	__st.wtq
+
+	.dbg	line,	"tests/930518-1.c", 12; bar = 1;
+	__st.wmiq	1, _bar
+
+	.dbg	line,	"tests/930518-1.c", 13; }
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/930518-1.c", 14; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/930518-1.c", 16; main ()
+	.dbg	line,	"tests/930518-1.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/930518-1.c", 18; int tab[2];
+
+	.dbg	line,	"tests/930518-1.c", 19; bar = 0;
+	__st.wmiq	0, _bar
+
+	.dbg	line,	"tests/930518-1.c", 20; tab[0] = tab[1] = 0;
+	__ld.wi		0
+	__st.wm		__main_end - 4 + 2  /* tab */
+	__st.wmq	__main_end - 4  /* tab */
+
+	.dbg	line,	"tests/930518-1.c", 21; f (tab);
+	__ld.wi		__main_end - 4  /* tab */
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/930518-1.c", 22; if (tab[0] != 2 || tab[1] != 1)
+	__ld.wm		__main_end - 4  /* tab */
+	__neq_w.wi	2
+	__btrue		.LL7
+	__ld.wm		__main_end - 4 + 2  /* tab */
+	__neq_w.wi	1
+.LL7:
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/930518-1.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930518-1.c", 24; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/930518-1.c", 25; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        50      8     2  bar
+;        10     10     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_bar, 2, 8, 50
+	auto_zp_var	__overlay_frames, 4, 10, 10
+__main_end	=	__overlay_frames + 4
+	.endm
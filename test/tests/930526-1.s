@@ -0,0 +1,144 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/930526-1.c", 1; /*inline*/
+	.dbg	line,	"tests/930526-1.c", 2; f (int x)
+	.dbg	line,	"tests/930526-1.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/930526-1.c", 4; int *p[13];
+
+	.dbg	line,	"tests/930526-1.c", 5; int m[13*3];
+
+	.dbg	line,	"tests/930526-1.c", 6; int i;
+
+	.dbg	line,	"tests/930526-1.c", 8; for (i = 0; i < 13; i++)
+	__st.wmiq	0, __f_end - 106  /* i */
+.LL3:
+	__ld.wm		__f_end - 106  /* i */
+	__slt_w.wi	13
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__f_end - 106  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/930526-1.c", 9; p[i] = m + x*i;
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wm		__f_end - 106  /* i */
+	__mul.wt
+	__asl.wr
+	__add.wi	__f_end - 104  /* m */
+	__ld2x.wm	__f_end - 106  /* i */
+	__st.waxq	__f_end - 26  /* p */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/930526-1.c", 11; p[1][0] = 0;
+	__ld.wm		__f_end - 26 + 2  /* p */
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+
+	.dbg	line,	"tests/930526-1.c", 12; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/930526-1.c", 14; main ()
+	.dbg	line,	"tests/930526-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/930526-1.c", 16; f (3);
+	__ld.wi		3
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/930526-1.c", 17; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/930526-1.c", 18; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 106
+leaf_needs	.set	106
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
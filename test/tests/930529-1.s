@@ -0,0 +1,491 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/930529-1.c", 1; dd (int x,int d) { return x / d; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_dd
+	__enter		_dd
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL2:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930529-1.c", 3; main ()
+	.dbg	line,	"tests/930529-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/930529-1.c", 5; int i;
+
+	.dbg	line,	"tests/930529-1.c", 6; for (i = -3; i <= 3; i++)
+	__st.wmiq	-3, __main_end - 2  /* i */
+.LL4:
+	__ld.wm		__main_end - 2  /* i */
+	__sle_w.wi	3
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/930529-1.c", 7; {
+
+	.dbg	line,	"tests/930529-1.c", 8; if (dd (i, 1) != i / 1)
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL9:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	1
+	__neq_w.wt
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/930529-1.c", 9; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 10; if (dd (i, 2) != i / 2)
+.LL8:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL11:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	2
+	__neq_w.wt
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/930529-1.c", 11; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 12; if (dd (i, 3) != i / 3)
+.LL10:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL13:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	3
+	__neq_w.wt
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/930529-1.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 14; if (dd (i, 4) != i / 4)
+.LL12:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL15:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	4
+	__neq_w.wt
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/930529-1.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 16; if (dd (i, 5) != i / 5)
+.LL14:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		5
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL17:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	5
+	__neq_w.wt
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/930529-1.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 18; if (dd (i, 6) != i / 6)
+.LL16:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL19:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	6
+	__neq_w.wt
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/930529-1.c", 19; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 20; if (dd (i, 7) != i / 7)
+.LL18:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		7
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL21:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	7
+	__neq_w.wt
+	__bfalse	.LL20
+
+	.dbg	line,	"tests/930529-1.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 22; if (dd (i, 8) != i / 8)
+.LL20:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL23:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	8
+	__neq_w.wt
+	__bfalse	.LL22
+
+	.dbg	line,	"tests/930529-1.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 24; }
+.LL22	.alias		.LL5
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/930529-1.c", 25; for (i = (/*(unsigned)*/ ~0 >> 1) - 3; i <= (/*(unsigned)*/ ~0 >> 1) + 3; i++)
+	__st.wmiq	-4, __main_end - 2  /* i */
+.LL24:
+	__ld.wm		__main_end - 2  /* i */
+	__sle_w.wi	2
+	__btrue		.LL26
+	__bra		.LL27
+.LL25:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL24
+.LL26:
+
+	.dbg	line,	"tests/930529-1.c", 26; {
+
+	.dbg	line,	"tests/930529-1.c", 27; if (dd (i, 1) != i / 1)
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL29:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	1
+	__neq_w.wt
+	__bfalse	.LL28
+
+	.dbg	line,	"tests/930529-1.c", 28; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 29; if (dd (i, 2) != i / 2)
+.LL28:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL31:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	2
+	__neq_w.wt
+	__bfalse	.LL30
+
+	.dbg	line,	"tests/930529-1.c", 30; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 31; if (dd (i, 3) != i / 3)
+.LL30:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL33:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	3
+	__neq_w.wt
+	__bfalse	.LL32
+
+	.dbg	line,	"tests/930529-1.c", 32; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 33; if (dd (i, 4) != i / 4)
+.LL32:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL35:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	4
+	__neq_w.wt
+	__bfalse	.LL34
+
+	.dbg	line,	"tests/930529-1.c", 34; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 35; if (dd (i, 5) != i / 5)
+.LL34:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		5
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL37:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	5
+	__neq_w.wt
+	__bfalse	.LL36
+
+	.dbg	line,	"tests/930529-1.c", 36; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 37; if (dd (i, 6) != i / 6)
+.LL36:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL39:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	6
+	__neq_w.wt
+	__bfalse	.LL38
+
+	.dbg	line,	"tests/930529-1.c", 38; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 39; if (dd (i, 7) != i / 7)
+.LL38:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		7
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL41:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	7
+	__neq_w.wt
+	__bfalse	.LL40
+
+	.dbg	line,	"tests/930529-1.c", 40; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 41; if (dd (i, 8) != i / 8)
+.LL40:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* d */
+	__sdiv.wt
+.LL43:
+	__modsp		4
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__sdiv.wi	8
+	__neq_w.wt
+	__bfalse	.LL42
+
+	.dbg	line,	"tests/930529-1.c", 42; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930529-1.c", 43; }
+.LL42	.alias		.LL25
+	__bra		.LL25
+.LL27:
+
+	.dbg	line,	"tests/930529-1.c", 44; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/930529-1.c", 45; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       608     76     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 76, 608
+__main_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,205 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/930622-1.c", 1; int a/* = 1*/, b;
+	.dbg	line,	"tests/930622-1.c", 3; g () { return 0; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+	__ld.wi		0
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930622-1.c", 4; h (int x) {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_h
+	__enter		_h
+.LL3:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930622-1.c", 6; f ()
+	.dbg	line,	"tests/930622-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/930622-1.c", 8; if (g () == -1)
+	__ld.wi		0
+.LL6:
+	__equ_w.wi	-1
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/930622-1.c", 9; return 0;
+	__ld.wi		0
+	__bra		.LL4
+
+	.dbg	line,	"tests/930622-1.c", 10; a = g ();
+.LL5:
+	__ld.wi		0
+.LL7:
+	__st.wmq	_a
+
+	.dbg	line,	"tests/930622-1.c", 11; if (b >= 1)
+	__ld.wm		_b
+	__sge_w.wi	1
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/930622-1.c", 12; h (a);
+	__ld.wm		_a
+	__pusharg.wr
+.LL9:
+	__modsp		2
+
+	.dbg	line,	"tests/930622-1.c", 13; return 0;
+.LL8:
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"tests/930622-1.c", 14; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930622-1.c", 16; main ()
+	.dbg	line,	"tests/930622-1.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/930622-1.c", 18; a = 1;
+	__st.wmiq	1, _a
+
+	.dbg	line,	"tests/930622-1.c", 19; f ();
+	__ld.wi		0
+.LL11:
+	__equ_w.wi	-1
+	__bfalse	.LL12
+	__ld.wi		0
+	__bra		.LL16
+.LL12:
+	__ld.wi		0
+.LL13:
+	__st.wmq	_a
+	__ld.wm		_b
+	__sge_w.wi	1
+	__bfalse	.LL15
+	__ld.wm		_a
+	__pusharg.wr
+.LL14:
+	__modsp		2
+.LL15:
+	__ld.wi		0
+.LL16:
+
+	.dbg	line,	"tests/930622-1.c", 20; if (a != 0)
+	__tst.wm	_a
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/930622-1.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930622-1.c", 22; exit (0);
+.LL17:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/930622-1.c", 23; }
+.LL10:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        12     12     2  a
+;         4      4     2  b
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_a, 2, 12, 12
+	auto_zp_var	_b, 2, 4, 4
+	.endm
@@ -0,0 +1,235 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/930929-1.c", 1; sub1 (i)
+	.dbg	line,	"tests/930929-1.c", 2; int i;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_sub1
+	__enter		_sub1
+
+	.dbg	line,	"tests/930929-1.c", 3; {
+
+	.dbg	line,	"tests/930929-1.c", 4; return i - (5 - i);
+	__ld.wi		5
+	__sub.ws	0  /* i */
+	__isub.ws	0  /* i */
+.LL2:
+
+	.dbg	line,	"tests/930929-1.c", 5; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930929-1.c", 7; sub2 (i)
+	.dbg	line,	"tests/930929-1.c", 8; int i;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_sub2
+	__enter		_sub2
+
+	.dbg	line,	"tests/930929-1.c", 9; {
+
+	.dbg	line,	"tests/930929-1.c", 10; return i + (5 + i);
+	__ld.wi		5
+	__add.ws	0  /* i */
+	__add.ws	0  /* i */
+.LL3:
+
+	.dbg	line,	"tests/930929-1.c", 11; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930929-1.c", 13; sub3 (i)
+	.dbg	line,	"tests/930929-1.c", 14; int i;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_sub3
+	__enter		_sub3
+
+	.dbg	line,	"tests/930929-1.c", 15; {
+
+	.dbg	line,	"tests/930929-1.c", 16; return i - (5 + i);
+	__ld.wi		5
+	__add.ws	0  /* i */
+	__isub.ws	0  /* i */
+.LL4:
+
+	.dbg	line,	"tests/930929-1.c", 17; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930929-1.c", 19; sub4 (i)
+	.dbg	line,	"tests/930929-1.c", 20; int i;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_sub4
+	__enter		_sub4
+
+	.dbg	line,	"tests/930929-1.c", 21; {
+
+	.dbg	line,	"tests/930929-1.c", 22; return i + (5 - i);
+	__ld.wi		5
+	__sub.ws	0  /* i */
+	__add.ws	0  /* i */
+.LL5:
+
+	.dbg	line,	"tests/930929-1.c", 23; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/930929-1.c", 25; main()
+	.dbg	line,	"tests/930929-1.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/930929-1.c", 27; if (sub1 (20) != 35)
+	__ld.wi		20
+	__pusharg.wr
+	__ld.wi		5
+	__sub.ws	0  /* i */
+	__isub.ws	0  /* i */
+.LL8:
+	__modsp		2
+	__neq_w.wi	35
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/930929-1.c", 28; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930929-1.c", 29; if (sub2 (20) != 45)
+.LL7:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.wi		5
+	__add.ws	0  /* i */
+	__add.ws	0  /* i */
+.LL10:
+	__modsp		2
+	__neq_w.wi	45
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/930929-1.c", 30; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930929-1.c", 31; if (sub3 (20) != -5)
+.LL9:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.wi		5
+	__add.ws	0  /* i */
+	__isub.ws	0  /* i */
+.LL12:
+	__modsp		2
+	__neq_w.wi	-5
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/930929-1.c", 32; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930929-1.c", 33; if (sub4 (20) != 5)
+.LL11:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.wi		5
+	__sub.ws	0  /* i */
+	__add.ws	0  /* i */
+.LL14:
+	__modsp		2
+	__neq_w.wi	5
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/930929-1.c", 34; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/930929-1.c", 35; exit (0);
+.LL13:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/930929-1.c", 36; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:7
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,197 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/931009-1.c", 1; main ()
+	.dbg	line,	"tests/931009-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/931009-1.c", 3; f ();
+	__call		_f
+
+	.dbg	line,	"tests/931009-1.c", 4; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/931009-1.c", 5; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/931009-1.c", 7; static
+	.dbg	line,	"tests/931009-1.c", 8; g (out, size, lo, hi)
+	.dbg	line,	"tests/931009-1.c", 9; int *out, size, lo, hi;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/931009-1.c", 10; {
+
+	.dbg	line,	"tests/931009-1.c", 11; int j;
+
+	.dbg	line,	"tests/931009-1.c", 13; for (j = 0; j < size; j++)
+	__st.wmiq	0, __g_end - 2  /* j */
+.LL4:
+	__ld.wm		__g_end - 2  /* j */
+	__slt_w.ws	4  /* size */
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__g_end - 2  /* j */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/931009-1.c", 14; out[j] = j * (hi - lo);
+	__ld.wm		__g_end - 2  /* j */
+	__asl.wr
+	__add.ws	6  /* out */
+	__push.wr
+	__ld.wm		__g_end - 2  /* j */
+	__push.wr
+	__ld.ws		0  /* hi */
+	__sub.ws	2  /* lo */
+	__mul.wt
+	__st.wtq
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/931009-1.c", 15; }
+.LL3:
+	__modsp		8
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__g_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/931009-1.c", 18; f ()
+	.dbg	line,	"tests/931009-1.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/931009-1.c", 20; int a[2];
+
+	.dbg	line,	"tests/931009-1.c", 22; g (a, 2, 0, 1);
+	__ld.wi		__f_end - 4  /* a */
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__call		_g
+
+	.dbg	line,	"tests/931009-1.c", 24; if (a[0] != 0 || a[1] != 1)
+	__tst.wm	__f_end - 4  /* a */
+	__btrue		.LL10
+	__ld.wm		__f_end - 4 + 2  /* a */
+	__neq_w.wi	1
+.LL10:
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/931009-1.c", 25; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/931009-1.c", 26; }
+.LL9:
+.LL8:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _f
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 6, 6
+__f_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,286 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/931017-1.c", 1; int v;
+	.dbg	line,	"tests/931017-1.c", 3; main ()
+	.dbg	line,	"tests/931017-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/931017-1.c", 5; f ();
+	__call		_f
+
+	.dbg	line,	"tests/931017-1.c", 6; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/931017-1.c", 7; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/931017-1.c", 9; h1 ()
+	.dbg	line,	"tests/931017-1.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_h1
+	__enter		_h1
+
+	.dbg	line,	"tests/931017-1.c", 11; return 0;
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/931017-1.c", 12; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/931017-1.c", 14; h2 (e)
+	.dbg	line,	"tests/931017-1.c", 15; int *e;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_h2
+	__enter		_h2
+
+	.dbg	line,	"tests/931017-1.c", 16; {
+
+	.dbg	line,	"tests/931017-1.c", 17; if (e != &v)
+	__ld.ws		0  /* e */
+	__neq_w.wi	_v
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/931017-1.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/931017-1.c", 19; return 0;
+.LL5:
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"tests/931017-1.c", 20; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/931017-1.c", 22; g (c)
+	.dbg	line,	"tests/931017-1.c", 23; char *c;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/931017-1.c", 24; {
+
+	.dbg	line,	"tests/931017-1.c", 25; int i;
+
+	.dbg	line,	"tests/931017-1.c", 26; int b;
+
+	.dbg	line,	"tests/931017-1.c", 28; do
+.LL7:
+
+	.dbg	line,	"tests/931017-1.c", 29; {
+
+	.dbg	line,	"tests/931017-1.c", 30; i = h1 ();
+	__ld.wi		0
+.LL10:
+	__st.wmq	__g_end - 2  /* i */
+
+	.dbg	line,	"tests/931017-1.c", 31; if (i == -1)
+	__equ_w.wi	-1
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/931017-1.c", 32; return 0;
+	__ld.wi		0
+	__bra		.LL6
+
+	.dbg	line,	"tests/931017-1.c", 33; else if (i == 1)
+.LL11:
+	__ld.wm		__g_end - 2  /* i */
+	__equ_w.wi	1
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/931017-1.c", 34; h1 ();
+	__ld.wi		0
+.LL14:
+
+	.dbg	line,	"tests/931017-1.c", 35; }
+.LL13:
+.LL12:
+
+	.dbg	line,	"tests/931017-1.c", 36; while (i == 1);
+.LL8:
+	__ld.wm		__g_end - 2  /* i */
+	__equ_w.wi	1
+	__btrue		.LL7
+.LL9:
+
+	.dbg	line,	"tests/931017-1.c", 38; do
+.LL15:
+
+	.dbg	line,	"tests/931017-1.c", 39; b = h2 (&v);
+	__ld.wi		_v
+	__pusharg.wr
+	__ld.ws		0  /* e */
+	__neq_w.wi	_v
+	__bfalse	.LL18
+	__call		_abort
+.LL18:
+	__ld.wi		0
+.LL19:
+	__modsp		2
+	__st.wmq	__g_end - 4  /* b */
+
+	.dbg	line,	"tests/931017-1.c", 40; while (i == 5);
+.LL16:
+	__ld.wm		__g_end - 2  /* i */
+	__equ_w.wi	5
+	__btrue		.LL15
+.LL17:
+
+	.dbg	line,	"tests/931017-1.c", 42; if (i != 2)
+	__ld.wm		__g_end - 2  /* i */
+	__neq_w.wi	2
+	__bfalse	.LL20
+
+	.dbg	line,	"tests/931017-1.c", 43; return b;
+	__ld.wm		__g_end - 4  /* b */
+	__bra		.LL6
+
+	.dbg	line,	"tests/931017-1.c", 44; *c = 'a';
+.LL20:
+	__ld.ws		0  /* c */
+	__push.wr
+	__ld.wi		97
+	__st.utq
+
+	.dbg	line,	"tests/931017-1.c", 46; return 0;
+	__ld.wi		0
+.LL6:
+
+	.dbg	line,	"tests/931017-1.c", 47; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/931017-1.c", 50; f ()
+	.dbg	line,	"tests/931017-1.c", 51; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/931017-1.c", 52; char c;
+
+	.dbg	line,	"tests/931017-1.c", 53; g (&c);
+	__ld.wi		__f_end - 1  /* c */
+	__pusharg.wr
+	__call		_g
+
+	.dbg	line,	"tests/931017-1.c", 54; }
+.LL21:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     1  _f
+;       1     4  _g
+;
+; 5 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       102     18     5  overlaid locals
+;        34      6     2  v
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 5, 18, 102
+__g_end	=	__overlay_frames + 5
+__f_end	=	__overlay_frames + 1
+	auto_zp_var	_v, 2, 6, 34
+	.endm
@@ -0,0 +1,136 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:08 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/931228-1.c", 1; f (int x)
+	.dbg	line,	"tests/931228-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/931228-1.c", 3; x &= 010000;
+	__ld.wi		4096
+	__and_st.wsq	0  /* x */
+
+	.dbg	line,	"tests/931228-1.c", 4; x &= 007777;
+	__ld.wi		4095
+	__and_st.wsq	0  /* x */
+
+	.dbg	line,	"tests/931228-1.c", 5; x ^= 017777;
+	__ld.wi		8191
+	__eor_st.wsq	0  /* x */
+
+	.dbg	line,	"tests/931228-1.c", 6; x &= 017770;
+	__ld.wi		8184
+	__and_st.wsq	0  /* x */
+
+	.dbg	line,	"tests/931228-1.c", 7; return x;
+	__ld.ws		0  /* x */
+.LL2:
+
+	.dbg	line,	"tests/931228-1.c", 8; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/931228-1.c", 10; main ()
+	.dbg	line,	"tests/931228-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/931228-1.c", 12; if (f (-1) != 017770)
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.wi		4096
+	__and_st.wsq	0  /* x */
+	__ld.wi		4095
+	__and_st.wsq	0  /* x */
+	__ld.wi		8191
+	__eor_st.wsq	0  /* x */
+	__ld.wi		8184
+	__and_st.wsq	0  /* x */
+	__ld.ws		0  /* x */
+.LL5:
+	__modsp		2
+	__neq_w.wi	8184
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/931228-1.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/931228-1.c", 14; exit (0);
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/931228-1.c", 15; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
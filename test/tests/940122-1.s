@@ -0,0 +1,164 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/940122-1.c", 1; const char *a = 0;
+	.dbg	line,	"tests/940122-1.c", 2; const char *b = 0;
+	.dbg	line,	"tests/940122-1.c", 4; g (x)
+	.dbg	line,	"tests/940122-1.c", 5; int x;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/940122-1.c", 6; {
+
+	.dbg	line,	"tests/940122-1.c", 7; if ((!!a) != (!!b))
+	__ld.wi		0
+	__tst.wr
+	__bool
+	__push.wr
+	__ld.wi		0
+	__tst.wr
+	__bool
+	__neq_w.wt
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/940122-1.c", 8; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/940122-1.c", 9; }
+.LL3:
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/940122-1.c", 11; f (x)
+	.dbg	line,	"tests/940122-1.c", 12; int x;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/940122-1.c", 13; {
+
+	.dbg	line,	"tests/940122-1.c", 14; g (x * x);
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.ws		0  /* x */
+	__mul.wt
+	__pusharg.wr
+	__ld.wi		0
+	__tst.wr
+	__bool
+	__push.wr
+	__ld.wi		0
+	__tst.wr
+	__bool
+	__neq_w.wt
+	__bfalse	.LL5
+	__call		_abort
+.LL5:
+.LL6:
+	__modsp		2
+
+	.dbg	line,	"tests/940122-1.c", 15; }
+.LL4:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/940122-1.c", 17; main ()
+	.dbg	line,	"tests/940122-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/940122-1.c", 19; f (100);
+	__ld.wi		100
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/940122-1.c", 20; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/940122-1.c", 21; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_a:
+		dw	0
+_b:
+		dw	0
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:4
+;	global pool:7
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,146 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/941110-1.c", 1; f (const int x)
+	.dbg	line,	"tests/941110-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/941110-1.c", 3; int y = 0;
+	__st.wmiq	0, __f_end - 2  /* y */
+
+	.dbg	line,	"tests/941110-1.c", 4; y = x ? y : -y;
+	__tst.ws	0  /* x */
+	__bfalse	.LL3
+	__ld.wm		__f_end - 2  /* y */
+	__bra		.LL4
+.LL3:
+	__ld.wm		__f_end - 2  /* y */
+	__neg.wr
+.LL4:
+	__st.wmq	__f_end - 2  /* y */
+
+	.dbg	line,	"tests/941110-1.c", 5; {
+
+	.dbg	line,	"tests/941110-1.c", 6; /*const*/ int *p; p = &x;
+
+	.dbg	line,	"tests/941110-1.c", 7; }
+
+	.dbg	line,	"tests/941110-1.c", 8; return y;
+.LL2:
+
+	.dbg	line,	"tests/941110-1.c", 9; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/941110-1.c", 11; main ()
+	.dbg	line,	"tests/941110-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/941110-1.c", 13; if (f (0))
+	__ld.wi		0
+	__pusharg.wr
+	__st.wmiq	0, __f_end - 2  /* y */
+	__tst.ws	0  /* x */
+	__bfalse	.LL7
+	__ld.wm		__f_end - 2  /* y */
+	__bra		.LL8
+.LL7:
+	__ld.wm		__f_end - 2  /* y */
+	__neg.wr
+.LL8:
+	__st.wmq	__f_end - 2  /* y */
+.LL9:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/941110-1.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/941110-1.c", 15; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/941110-1.c", 16; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,195 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/950322-1.c", 1; f (unsigned char *a)
+	.dbg	line,	"tests/950322-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/950322-1.c", 3; int i, j;
+
+	.dbg	line,	"tests/950322-1.c", 4; int x, y;
+
+	.dbg	line,	"tests/950322-1.c", 6; j = a[1];
+	__ld.ws		0  /* a */
+	__add.wi	1
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__st.wmq	__f_end - 4  /* j */
+
+	.dbg	line,	"tests/950322-1.c", 7; i = a[0] - j;
+	__ld.ws		0  /* a */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__sub.wm	__f_end - 4  /* j */
+	__st.wmq	__f_end - 2  /* i */
+
+	.dbg	line,	"tests/950322-1.c", 8; if (i < 0)
+	__slt_w.wi	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/950322-1.c", 9; {
+
+	.dbg	line,	"tests/950322-1.c", 10; x = 1;
+	__st.wmiq	1, __f_end - 6  /* x */
+
+	.dbg	line,	"tests/950322-1.c", 11; y = -i;
+	__ld.wm		__f_end - 2  /* i */
+	__neg.wr
+	__st.wmq	__f_end - 8  /* y */
+
+	.dbg	line,	"tests/950322-1.c", 12; }
+
+	.dbg	line,	"tests/950322-1.c", 13; else
+	__bra		.LL4
+.LL3:
+
+	.dbg	line,	"tests/950322-1.c", 14; {
+
+	.dbg	line,	"tests/950322-1.c", 15; x = 0;
+	__st.wmiq	0, __f_end - 6  /* x */
+
+	.dbg	line,	"tests/950322-1.c", 16; y =  i;
+	__ld.wm		__f_end - 2  /* i */
+	__st.wmq	__f_end - 8  /* y */
+
+	.dbg	line,	"tests/950322-1.c", 17; }
+.LL4:
+
+	.dbg	line,	"tests/950322-1.c", 18; return x + y;
+	__ld.wm		__f_end - 6  /* x */
+	__add.wm	__f_end - 8  /* y */
+.LL2:
+
+	.dbg	line,	"tests/950322-1.c", 19; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/950322-1.c", 22; main ()
+	.dbg	line,	"tests/950322-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/950322-1.c", 24; unsigned char a[2];
+
+	.dbg	line,	"tests/950322-1.c", 25; a[0] = 8;
+	__st.umiq	8, __main_end - 2  /* a */
+
+	.dbg	line,	"tests/950322-1.c", 26; a[1] = 9;
+	__st.umiq	9, __main_end - 2 + 1  /* a */
+
+	.dbg	line,	"tests/950322-1.c", 27; if (f (a) != 2)
+	__ld.wi		__main_end - 2  /* a */
+	__pusharg.wr
+	__call		_f
+	__neq_w.wi	2
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/950322-1.c", 28; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/950322-1.c", 29; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/950322-1.c", 30; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 8
+leaf_needs	.set	8
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 6
+__main_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,173 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/950621-1.c", 1; struct s
+	.dbg	line,	"tests/950621-1.c", 2; {
+	.dbg	line,	"tests/950621-1.c", 3; int a;
+	.dbg	line,	"tests/950621-1.c", 4; int b;
+	.dbg	line,	"tests/950621-1.c", 5; struct s *dummy;
+	.dbg	line,	"tests/950621-1.c", 6; };
+	.dbg	line,	"tests/950621-1.c", 8; f (struct s *sp)
+	.dbg	line,	"tests/950621-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/950621-1.c", 10; return sp && sp->a == -1 && sp->b == -1;
+	__tst.ws	0  /* sp */
+	__bfalse	.LL3
+	__ld.ws		0  /* sp */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__equ_w.wi	-1
+.LL3:
+	__bfalse	.LL4
+	__ld.ws		0  /* sp */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__equ_w.wi	-1
+.LL4:
+.LL2:
+	__bool
+
+	.dbg	line,	"tests/950621-1.c", 11; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/950621-1.c", 13; main ()
+	.dbg	line,	"tests/950621-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/950621-1.c", 15; struct s x;
+
+	.dbg	line,	"tests/950621-1.c", 16; x.a = x.b = -1;
+	__ld.wi		-1
+	__st.wm		__main_end - 6 + 2  /* x */
+	__st.wmq	__main_end - 6  /* x */
+
+	.dbg	line,	"tests/950621-1.c", 17; if (f (&x) == 0)
+	__ld.wi		__main_end - 6  /* x */
+	__pusharg.wr
+	__tst.ws	0  /* sp */
+	__bfalse	.LL7
+	__ld.ws		0  /* sp */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__equ_w.wi	-1
+.LL7:
+	__bfalse	.LL8
+	__ld.ws		0  /* sp */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__equ_w.wi	-1
+.LL8:
+.LL9:
+	__bool
+	__modsp		2
+	__not.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/950621-1.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/950621-1.c", 19; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/950621-1.c", 20; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _main
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 6, 6
+__main_end	=	__overlay_frames + 6
+	.endm
@@ -0,0 +1,156 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/950714-1.c", 1; const int array[10] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+	.dbg	line,	"tests/950714-1.c", 3; main ()
+	.dbg	line,	"tests/950714-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/950714-1.c", 5; int i, j;
+
+	.dbg	line,	"tests/950714-1.c", 6; int *p;
+
+	.dbg	line,	"tests/950714-1.c", 8; for (i = 0; i < 10; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL3:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	10
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/950714-1.c", 9; for (p = &array[0]; p != &array[9]; p++)
+	__ld.wi		_array
+	__st.wmq	__main_end - 6  /* p */
+.LL7:
+	__ld.wm		__main_end - 6  /* p */
+	__neq_w.wi	_array + 18
+	__btrue		.LL9
+	__bra		.LL10
+.LL8:
+	__ld.wm		__main_end - 6  /* p */
+	__add.wi	2
+	__st.wm		__main_end - 6  /* p */
+	__bra		.LL7
+.LL9:
+
+	.dbg	line,	"tests/950714-1.c", 10; if (*p == i)
+	__ld.wm		__main_end - 6  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__equ_w.wm	__main_end - 2  /* i */
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/950714-1.c", 11; goto label;
+	__modsp_goto	.LL12_stkp
+	__bra		.LL12
+
+	.dbg	line,	"tests/950714-1.c", 13; label:
+.LL11	.alias		.LL8
+.LL10	.alias		.LL4
+.LL6:
+.LL12_stkp	=	0
+.LL12:
+
+	.dbg	line,	"tests/950714-1.c", 14; if (i != 1)
+	__ld.wm		__main_end - 2  /* i */
+	__neq_w.wi	1
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/950714-1.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/950714-1.c", 16; exit (0);
+.LL13:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/950714-1.c", 17; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_array:
+		dw	1
+		dw	1
+		dw	1
+		dw	1
+		dw	1
+		dw	1
+		dw	1
+		dw	1
+		dw	1
+		dw	1
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:20
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,247 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/950809-1.c", 1; struct S
+	.dbg	line,	"tests/950809-1.c", 2; {
+	.dbg	line,	"tests/950809-1.c", 3; int *sp, fc, *sc, a[2];
+	.dbg	line,	"tests/950809-1.c", 4; };
+	.dbg	line,	"tests/950809-1.c", 6; f (struct S *x)
+	.dbg	line,	"tests/950809-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/950809-1.c", 8; int *t, t1, t2, t3, a0, a1;
+
+	.dbg	line,	"tests/950809-1.c", 9; /*int * */t = x->sc;
+	__ld.ws		0  /* x */
+	__add.wi	4
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__f_end - 2  /* t */
+
+	.dbg	line,	"tests/950809-1.c", 10; /*int*/ t1 = t[0];
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__f_end - 4  /* t1 */
+
+	.dbg	line,	"tests/950809-1.c", 11; /*int*/ t2 = t[1];
+	__ld.wm		__f_end - 2  /* t */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__f_end - 6  /* t2 */
+
+	.dbg	line,	"tests/950809-1.c", 12; /*int*/ t3 = t[2];
+	__ld.wm		__f_end - 2  /* t */
+	__add.wi	4
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__f_end - 8  /* t3 */
+
+	.dbg	line,	"tests/950809-1.c", 13; /*int*/ a0 = x->a[0];
+	__ld.ws		0  /* x */
+	__add.wi	6
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__f_end - 10  /* a0 */
+
+	.dbg	line,	"tests/950809-1.c", 14; /*int*/ a1 = x->a[1];
+	__ld.ws		0  /* x */
+	__add.wi	8
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__f_end - 12  /* a1 */
+
+	.dbg	line,	"tests/950809-1.c", 15; t[2] = t1;
+	__ld.wm		__f_end - 2  /* t */
+	__add.wi	4
+	__push.wr
+	__ld.wm		__f_end - 4  /* t1 */
+	__st.wtq
+
+	.dbg	line,	"tests/950809-1.c", 16; t[0] = a1;
+	__ld.wm		__f_end - 2  /* t */
+	__push.wr
+	__ld.wm		__f_end - 12  /* a1 */
+	__st.wtq
+
+	.dbg	line,	"tests/950809-1.c", 17; x->a[1] = a0;
+	__ld.ws		0  /* x */
+	__add.wi	8
+	__push.wr
+	__ld.wm		__f_end - 10  /* a0 */
+	__st.wtq
+
+	.dbg	line,	"tests/950809-1.c", 18; x->a[0] = t3;
+	__ld.ws		0  /* x */
+	__add.wi	6
+	__push.wr
+	__ld.wm		__f_end - 8  /* t3 */
+	__st.wtq
+
+	.dbg	line,	"tests/950809-1.c", 19; x->fc = t2;
+	__ld.ws		0  /* x */
+	__add.wi	2
+	__push.wr
+	__ld.wm		__f_end - 6  /* t2 */
+	__st.wtq
+
+	.dbg	line,	"tests/950809-1.c", 20; x->sp = t;
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wm		__f_end - 2  /* t */
+	__st.wtq
+
+	.dbg	line,	"tests/950809-1.c", 21; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/950809-1.c", 23; main ()
+	.dbg	line,	"tests/950809-1.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/950809-1.c", 25; struct S s;
+
+	.dbg	line,	"tests/950809-1.c", 26; static int sc[3];// = {2, 3, 4};
+
+	.dbg	line,	"tests/950809-1.c", 27; sc[0] = 2; sc[1] = 3; sc[2] = 4;
+	__st.wmiq	2, SL4  /* sc */
+	__st.wmiq	3, SL4 + 2  /* sc */
+	__st.wmiq	4, SL4 + 4  /* sc */
+
+	.dbg	line,	"tests/950809-1.c", 28; s.sc = sc;
+	__ld.wi		SL4  /* sc */
+	__st.wmq	__main_end - 10 + 4  /* s */
+
+	.dbg	line,	"tests/950809-1.c", 29; s.a[0] = 10;
+	__st.wmiq	10, __main_end - 10 + 6  /* s */
+
+	.dbg	line,	"tests/950809-1.c", 30; s.a[1] = 11;
+	__st.wmiq	11, __main_end - 10 + 6 + 2  /* s */
+
+	.dbg	line,	"tests/950809-1.c", 31; f (&s);
+	__ld.wi		__main_end - 10  /* s */
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/950809-1.c", 32; if (s.sp[2] != 2)
+	__ld.wm		__main_end - 10  /* s */
+	__add.wi	4
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	2
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/950809-1.c", 33; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/950809-1.c", 34; exit (0);
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/950809-1.c", 35; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+SL4:
+		ds	6
+
+	.code
+	.if		leaf_needs < 12
+leaf_needs	.set	12
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    10  _main
+;
+; 10 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10    10  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 10, 10, 10
+__main_end	=	__overlay_frames + 10
+	.endm
@@ -0,0 +1,191 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/950929-1.c", 1; int f (char *p) { }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/950929-1.c", 3; main ()
+	.dbg	line,	"tests/950929-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/950929-1.c", 5; char c;
+
+	.dbg	line,	"tests/950929-1.c", 6; char c2;
+
+	.dbg	line,	"tests/950929-1.c", 7; int i = 0;
+	__st.wmiq	0, __main_end - 4  /* i */
+
+	.dbg	line,	"tests/950929-1.c", 8; char *pc, *pc2, *pi;
+
+	.dbg	line,	"tests/950929-1.c", 9; /*char **/pc = &c;
+	__ld.wi		__main_end - 2  /* c2 */
+
+	.dbg	line,	"tests/950929-1.c", 10; /*char **/pc2 = &c2;
+	__st.wmq	__main_end - 8  /* pc2 */
+
+	.dbg	line,	"tests/950929-1.c", 11; /*int **/pi = &i;
+	__ld.wi		__main_end - 4  /* i */
+	__st.wmq	__main_end - 10  /* pi */
+
+	.dbg	line,	"tests/950929-1.c", 13; *pc2 = 1;
+	__ld.wm		__main_end - 8  /* pc2 */
+	__push.wr
+	__ld.wi		1
+	__st.utq
+
+	.dbg	line,	"tests/950929-1.c", 14; *pi = 1;
+	__ld.wm		__main_end - 10  /* pi */
+	__push.wr
+	__ld.wi		1
+	__st.utq
+
+	.dbg	line,	"tests/950929-1.c", 15; *pc2 &= *pi;
+	__ld.wm		__main_end - 8  /* pc2 */
+	__push.wr
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__push.wr
+	__ld.wm		__main_end - 10  /* pi */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__and.wt
+	__st.utq
+
+	.dbg	line,	"tests/950929-1.c", 16; f (pc2);
+	__ld.wm		__main_end - 8  /* pc2 */
+	__pusharg.wr
+.LL4:
+	__modsp		2
+
+	.dbg	line,	"tests/950929-1.c", 17; *pc2 = 1;
+	__ld.wm		__main_end - 8  /* pc2 */
+	__push.wr
+	__ld.wi		1
+	__st.utq
+
+	.dbg	line,	"tests/950929-1.c", 18; *pc2 &= *pi;
+	__ld.wm		__main_end - 8  /* pc2 */
+	__push.wr
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__push.wr
+	__ld.wm		__main_end - 10  /* pi */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__and.wt
+	__st.utq
+
+	.dbg	line,	"tests/950929-1.c", 19; if (*pc2 != 1)
+	__ld.wm		__main_end - 8  /* pc2 */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	1
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/950929-1.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/950929-1.c", 21; exit (0);
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/950929-1.c", 22; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    10  _main
+;
+; 10 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        32     32    10  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 10, 32, 32
+__main_end	=	__overlay_frames + 10
+	.endm
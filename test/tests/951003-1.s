@@ -0,0 +1,184 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/951003-1.c", 1; int f (int i) { return 12; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+	__ld.wi		12
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/951003-1.c", 2; int g () { return 0; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+	__ld.wi		0
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/951003-1.c", 4; main ()
+	.dbg	line,	"tests/951003-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/951003-1.c", 6; int i, s;
+
+	.dbg	line,	"tests/951003-1.c", 8; for (i = 0; i < 32; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL5:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	32
+	__btrue		.LL7
+	__bra		.LL8
+.LL6:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/951003-1.c", 9; {
+
+	.dbg	line,	"tests/951003-1.c", 10; s = f (i);
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__ld.wi		12
+.LL9:
+	__modsp		2
+	__st.wmq	__main_end - 4  /* s */
+
+	.dbg	line,	"tests/951003-1.c", 12; if (i == g ())
+	__ld.wi		0
+.LL11:
+	__equ_w.wm	__main_end - 2  /* i */
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/951003-1.c", 13; s = 42;
+	__st.wmiq	42, __main_end - 4  /* s */
+
+	.dbg	line,	"tests/951003-1.c", 14; if (i == 0 || s == 12)
+.LL10:
+	__not.wm	__main_end - 2  /* i */
+	__btrue		.LL13
+	__ld.wm		__main_end - 4  /* s */
+	__equ_w.wi	12
+.LL13:
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/951003-1.c", 15; ;
+
+	.dbg	line,	"tests/951003-1.c", 16; else
+	__bra		.LL14
+.LL12:
+
+	.dbg	line,	"tests/951003-1.c", 17; abort ();
+	__call		_abort
+.LL14	.alias		.LL6
+
+	.dbg	line,	"tests/951003-1.c", 18; }
+	__bra		.LL6
+.LL8:
+
+	.dbg	line,	"tests/951003-1.c", 20; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/951003-1.c", 21; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       144     18     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 18, 144
+__main_end	=	__overlay_frames + 4
+	.endm
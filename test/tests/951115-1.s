@@ -0,0 +1,172 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/951115-1.c", 1; int var;// = 0;
+	.dbg	line,	"tests/951115-1.c", 3; g ()
+	.dbg	line,	"tests/951115-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/951115-1.c", 5; var = 1;
+	__st.wmiq	1, _var
+
+	.dbg	line,	"tests/951115-1.c", 6; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/951115-1.c", 8; f ()
+	.dbg	line,	"tests/951115-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/951115-1.c", 10; int f2 = 0;
+	__st.wmiq	0, __f_end - 2  /* f2 */
+
+	.dbg	line,	"tests/951115-1.c", 12; if (f2 == 0)
+	__not.wm	__f_end - 2  /* f2 */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/951115-1.c", 13; ;
+
+	.dbg	line,	"tests/951115-1.c", 15; g ();
+.LL4:
+	__st.wmiq	1, _var
+.LL5:
+
+	.dbg	line,	"tests/951115-1.c", 16; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/951115-1.c", 18; main ()
+	.dbg	line,	"tests/951115-1.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/951115-1.c", 20; var = 0;
+	__st.wmiq	0, _var
+
+	.dbg	line,	"tests/951115-1.c", 21; f ();
+	__st.wmiq	0, __f_end - 2  /* f2 */
+	__not.wm	__f_end - 2  /* f2 */
+	__bfalse	.LL7
+.LL7:
+	__st.wmiq	1, _var
+.LL8:
+.LL9:
+
+	.dbg	line,	"tests/951115-1.c", 22; if (var != 1)
+	__ld.wm		_var
+	__neq_w.wi	1
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/951115-1.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/951115-1.c", 24; exit (0);
+.LL10:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/951115-1.c", 25; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _f
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     2  var
+;         8      8     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_var, 2, 10, 10
+	auto_zp_var	__overlay_frames, 2, 8, 8
+__f_end	=	__overlay_frames + 2
+	.endm
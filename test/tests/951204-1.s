@@ -0,0 +1,164 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/951204-1.c", 1; f (char *x)
+	.dbg	line,	"tests/951204-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/951204-1.c", 3; *x = 'x';
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wi		120
+	__st.utq
+
+	.dbg	line,	"tests/951204-1.c", 4; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/951204-1.c", 6; main ()
+	.dbg	line,	"tests/951204-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/951204-1.c", 8; int i;
+
+	.dbg	line,	"tests/951204-1.c", 9; char x = '\0';
+	__st.umiq	0, __main_end - 3  /* x */
+
+	.dbg	line,	"tests/951204-1.c", 11; for (i = 0; i < 100; ++i)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL4:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	100
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/951204-1.c", 12; {
+
+	.dbg	line,	"tests/951204-1.c", 13; f (&x);
+	__ld.wi		__main_end - 3  /* x */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__push.wr
+	__ld.wi		120
+	__st.utq
+.LL8:
+	__modsp		2
+
+	.dbg	line,	"tests/951204-1.c", 14; if (*/*(const char *)*/ &x != 'x')
+	__ld.umq	__main_end - 3  /* x */
+	__neq_b.uiq	120
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/951204-1.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/951204-1.c", 16; }
+.LL9	.alias		.LL5
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/951204-1.c", 17; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/951204-1.c", 18; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     3  _main
+;
+; 3 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        82     12     3  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 3, 12, 82
+__main_end	=	__overlay_frames + 3
+	.endm
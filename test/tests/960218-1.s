@@ -0,0 +1,196 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/960218-1.c", 1; int glob;
+	.dbg	line,	"tests/960218-1.c", 3; g (int x)
+	.dbg	line,	"tests/960218-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/960218-1.c", 5; glob = x;
+	__ld.ws		0  /* x */
+	__st.wmq	_glob
+
+	.dbg	line,	"tests/960218-1.c", 6; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/960218-1.c", 7; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/960218-1.c", 9; f (int x)
+	.dbg	line,	"tests/960218-1.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/960218-1.c", 11; int a; a = ~x;
+	__ld.ws		0  /* x */
+	__com.wr
+	__st.wmq	__f_end - 2  /* a */
+
+	.dbg	line,	"tests/960218-1.c", 12; while (a)
+.LL4:
+	__tst.wm	__f_end - 2  /* a */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/960218-1.c", 13; a = g (a);
+	__ld.wm		__f_end - 2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__st.wmq	_glob
+	__ld.wi		0
+.LL6:
+	__modsp		2
+	__st.wmq	__f_end - 2  /* a */
+	__bra		.LL4
+.LL5:
+
+	.dbg	line,	"tests/960218-1.c", 14; }
+.LL3:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/960218-1.c", 16; main ()
+	.dbg	line,	"tests/960218-1.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/960218-1.c", 18; f (3);
+	__ld.wi		3
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__com.wr
+	__st.wmq	__f_end - 2  /* a */
+.LL8:
+	__tst.wm	__f_end - 2  /* a */
+	__bfalse	.LL10
+	__ld.wm		__f_end - 2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__st.wmq	_glob
+	__ld.wi		0
+.LL9:
+	__modsp		2
+	__st.wmq	__f_end - 2  /* a */
+	__bra		.LL8
+.LL10:
+.LL11:
+	__modsp		2
+
+	.dbg	line,	"tests/960218-1.c", 19; if (glob != -4)
+	__ld.wm		_glob
+	__neq_w.wi	-4
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/960218-1.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/960218-1.c", 21; exit (0);
+.LL12:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/960218-1.c", 22; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _f
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        58     16     2  overlaid locals
+;        22      8     2  glob
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 16, 58
+__f_end	=	__overlay_frames + 2
+	auto_zp_var	_glob, 2, 8, 22
+	.endm
@@ -0,0 +1,306 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/960311-1.c", 1; #ifdef DEBUG
+	.dbg	line,	"tests/960311-1.c", 2; #include <stdio.h>
+	.dbg	line,	"tests/960311-1.c", 3; #define abort() printf ("error, line %d\n", __LINE__)
+	.dbg	line,	"tests/960311-1.c", 4; #endif
+	.dbg	line,	"tests/960311-1.c", 6; int count;
+	.dbg	line,	"tests/960311-1.c", 8; void a1() { ++count; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_a1
+	__enter		_a1
+	__inc.wmq	_count
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/960311-1.c", 10; void
+	.dbg	line,	"tests/960311-1.c", 11; b (unsigned char data)
+	.dbg	line,	"tests/960311-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_b
+	__enter		_b
+
+	.dbg	line,	"tests/960311-1.c", 13; if (data & 0x80) a1();
+	__ld.us		0  /* data */
+	__tand.wi	128
+	__bfalse	.LL4
+	__inc.wmq	_count
+.LL5:
+
+	.dbg	line,	"tests/960311-1.c", 14; data <<= 1;
+.LL4:
+	__ld.us		0  /* data */
+	__asl.wi	1
+	__st.usq	0  /* data */
+
+	.dbg	line,	"tests/960311-1.c", 16; if (data & 0x80) a1();
+	__ld.us		0  /* data */
+	__tand.wi	128
+	__bfalse	.LL6
+	__inc.wmq	_count
+.LL7:
+
+	.dbg	line,	"tests/960311-1.c", 17; data <<= 1;
+.LL6:
+	__ld.us		0  /* data */
+	__asl.wi	1
+	__st.usq	0  /* data */
+
+	.dbg	line,	"tests/960311-1.c", 19; if (data & 0x80) a1();
+	__ld.us		0  /* data */
+	__tand.wi	128
+	__bfalse	.LL8
+	__inc.wmq	_count
+.LL9:
+
+	.dbg	line,	"tests/960311-1.c", 20; }
+.LL8:
+.LL3:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/960311-1.c", 22; main ()
+	.dbg	line,	"tests/960311-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/960311-1.c", 24; count = 0;
+	__st.wmiq	0, _count
+
+	.dbg	line,	"tests/960311-1.c", 25; b (0);
+	__ld.wi		0
+	__pusharg.wr
+	__call		_b
+
+	.dbg	line,	"tests/960311-1.c", 26; if (count != 0)
+	__tst.wm	_count
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/960311-1.c", 27; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/960311-1.c", 29; count = 0;
+.LL11:
+	__st.wmiq	0, _count
+
+	.dbg	line,	"tests/960311-1.c", 30; b (0x80);
+	__ld.wi		128
+	__pusharg.wr
+	__call		_b
+
+	.dbg	line,	"tests/960311-1.c", 31; if (count != 1)
+	__ld.wm		_count
+	__neq_w.wi	1
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/960311-1.c", 32; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/960311-1.c", 34; count = 0;
+.LL12:
+	__st.wmiq	0, _count
+
+	.dbg	line,	"tests/960311-1.c", 35; b (0x40);
+	__ld.wi		64
+	__pusharg.wr
+	__call		_b
+
+	.dbg	line,	"tests/960311-1.c", 36; if (count != 1)
+	__ld.wm		_count
+	__neq_w.wi	1
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/960311-1.c", 37; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/960311-1.c", 39; count = 0;
+.LL13:
+	__st.wmiq	0, _count
+
+	.dbg	line,	"tests/960311-1.c", 40; b (0x20);
+	__ld.wi		32
+	__pusharg.wr
+	__call		_b
+
+	.dbg	line,	"tests/960311-1.c", 41; if (count != 1)
+	__ld.wm		_count
+	__neq_w.wi	1
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/960311-1.c", 42; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/960311-1.c", 44; count = 0;
+.LL14:
+	__st.wmiq	0, _count
+
+	.dbg	line,	"tests/960311-1.c", 45; b (0xc0);
+	__ld.wi		192
+	__pusharg.wr
+	__call		_b
+
+	.dbg	line,	"tests/960311-1.c", 46; if (count != 2)
+	__ld.wm		_count
+	__neq_w.wi	2
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/960311-1.c", 47; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/960311-1.c", 49; count = 0;
+.LL15:
+	__st.wmiq	0, _count
+
+	.dbg	line,	"tests/960311-1.c", 50; b (0xa0);
+	__ld.wi		160
+	__pusharg.wr
+	__call		_b
+
+	.dbg	line,	"tests/960311-1.c", 51; if (count != 2)
+	__ld.wm		_count
+	__neq_w.wi	2
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/960311-1.c", 52; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/960311-1.c", 54; count = 0;
+.LL16:
+	__st.wmiq	0, _count
+
+	.dbg	line,	"tests/960311-1.c", 55; b (0x60);
+	__ld.wi		96
+	__pusharg.wr
+	__call		_b
+
+	.dbg	line,	"tests/960311-1.c", 56; if (count != 2)
+	__ld.wm		_count
+	__neq_w.wi	2
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/960311-1.c", 57; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/960311-1.c", 59; count = 0;
+.LL17:
+	__st.wmiq	0, _count
+
+	.dbg	line,	"tests/960311-1.c", 60; b (0xe0);
+	__ld.wi		224
+	__pusharg.wr
+	__call		_b
+
+	.dbg	line,	"tests/960311-1.c", 61; if (count != 3)
+	__ld.wm		_count
+	__neq_w.wi	3
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/960311-1.c", 62; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/960311-1.c", 64; #ifdef DEBUG
+
+	.dbg	line,	"tests/960311-1.c", 65; printf ("Done.\n");
+
+	.dbg	line,	"tests/960311-1.c", 66; #endif
+
+	.dbg	line,	"tests/960311-1.c", 67; exit (0);
+.LL18:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/960311-1.c", 68; }
+.LL10:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        42     42     2  count
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_count, 2, 42, 42
+	.endm
@@ -0,0 +1,165 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/960317-1.c", 1; int
+	.dbg	line,	"tests/960317-1.c", 2; f (unsigned bitcount, int mant)
+	.dbg	line,	"tests/960317-1.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/960317-1.c", 4; int mask; mask = -1 << bitcount;
+	__ld.wi		-1
+	__push.wr
+	__ld.ws		2  /* bitcount */
+	__asl.wt
+	__st.wmq	__f_end - 2  /* mask */
+
+	.dbg	line,	"tests/960317-1.c", 5; {
+
+	.dbg	line,	"tests/960317-1.c", 6; if (! (mant & -mask))
+	__neg.wr
+	__and.ws	0  /* mant */
+	__not.wr
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/960317-1.c", 7; goto ab;
+	__modsp_goto	.LL4_stkp
+	__bra		.LL4
+
+	.dbg	line,	"tests/960317-1.c", 8; if (mant & ~mask)
+.LL3:
+	__ld.wm		__f_end - 2  /* mask */
+	__com.wr
+	__and.ws	0  /* mant */
+	__tst.wr
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/960317-1.c", 9; goto auf;
+	__modsp_goto	.LL6_stkp
+	__bra		.LL6
+
+	.dbg	line,	"tests/960317-1.c", 10; }
+.LL5:
+
+	.dbg	line,	"tests/960317-1.c", 11; ab:
+.LL4_stkp	=	0
+.LL4:
+
+	.dbg	line,	"tests/960317-1.c", 12; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/960317-1.c", 13; auf:
+.LL6_stkp	=	0
+.LL6:
+
+	.dbg	line,	"tests/960317-1.c", 14; return 1;
+	__ld.wi		1
+.LL2:
+
+	.dbg	line,	"tests/960317-1.c", 15; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/960317-1.c", 17; main ()
+	.dbg	line,	"tests/960317-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/960317-1.c", 19; if (f (0, -1))
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		-1
+	__pusharg.wr
+	__call		_f
+	__tst.wr
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/960317-1.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/960317-1.c", 21; exit (0);
+.LL8:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/960317-1.c", 22; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,111 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/960521-1.c", 1; #ifdef __HUCC__
+	.dbg	line,	"tests/960521-1.c", 3; // malloc() is not supported in HuCC at this time.
+	.dbg	line,	"tests/960521-1.c", 4; main()
+	.dbg	line,	"tests/960521-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/960521-1.c", 6; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/960521-1.c", 7; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/960521-1.c", 9; #else
+	.dbg	line,	"tests/960521-1.c", 11; #include <stdlib.h>
+	.dbg	line,	"tests/960521-1.c", 13; int *a, *b;
+	.dbg	line,	"tests/960521-1.c", 14; int n;
+	.dbg	line,	"tests/960521-1.c", 16; #ifdef STACK_SIZE
+	.dbg	line,	"tests/960521-1.c", 17; //#define BLOCK_SIZE (STACK_SIZE / (sizeof (*a) + sizeof (*b)))
+	.dbg	line,	"tests/960521-1.c", 18; #define BLOCK_SIZE 128
+	.dbg	line,	"tests/960521-1.c", 19; #else
+	.dbg	line,	"tests/960521-1.c", 20; #define BLOCK_SIZE 32768
+	.dbg	line,	"tests/960521-1.c", 21; #endif
+	.dbg	line,	"tests/960521-1.c", 22; foo ()
+	.dbg	line,	"tests/960521-1.c", 23; {
+	.dbg	line,	"tests/960521-1.c", 24; int i;
+	.dbg	line,	"tests/960521-1.c", 25; for (i = 0; i < n; i++)
+	.dbg	line,	"tests/960521-1.c", 26; a[i] = -1;
+	.dbg	line,	"tests/960521-1.c", 27; for (i = 0; i < BLOCK_SIZE - 1; i++)
+	.dbg	line,	"tests/960521-1.c", 28; b[i] = -1;
+	.dbg	line,	"tests/960521-1.c", 29; }
+	.dbg	line,	"tests/960521-1.c", 31; main ()
+	.dbg	line,	"tests/960521-1.c", 32; {
+	.dbg	line,	"tests/960521-1.c", 33; n = BLOCK_SIZE;
+	.dbg	line,	"tests/960521-1.c", 34; a = malloc (n * sizeof(int));//*a));
+	.dbg	line,	"tests/960521-1.c", 35; b = malloc (n * sizeof(int));//*b));
+	.dbg	line,	"tests/960521-1.c", 36; *b++ = 0;
+	.dbg	line,	"tests/960521-1.c", 37; foo ();
+	.dbg	line,	"tests/960521-1.c", 38; if (b[-1])
+	.dbg	line,	"tests/960521-1.c", 39; abort ();
+	.dbg	line,	"tests/960521-1.c", 40; exit (0);
+	.dbg	line,	"tests/960521-1.c", 41; }
+	.dbg	line,	"tests/960521-1.c", 43; #endif // __HUCC__
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
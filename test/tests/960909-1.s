@@ -0,0 +1,210 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/960909-1.c", 1; int
+	.dbg	line,	"tests/960909-1.c", 2; ffs (x)
+	.dbg	line,	"tests/960909-1.c", 3; int x;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ffs
+	__enter		_ffs
+
+	.dbg	line,	"tests/960909-1.c", 4; {
+
+	.dbg	line,	"tests/960909-1.c", 5; int bit, mask;
+
+	.dbg	line,	"tests/960909-1.c", 7; if (x == 0)
+	__not.ws	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/960909-1.c", 8; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/960909-1.c", 10; for (bit = 1, mask = 1; !(x & mask); bit++, mask <<= 1)
+.LL3:
+	__st.wmiq	1, __ffs_end - 2  /* bit */
+	__st.wmiq	1, __ffs_end - 4  /* mask */
+.LL4:
+	__ld.ws		0  /* x */
+	__and.wm	__ffs_end - 4  /* mask */
+	__not.wr
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__ffs_end - 2  /* bit */
+	__ld.wm		__ffs_end - 4  /* mask */
+	__asl.wi	1
+	__st.wmq	__ffs_end - 4  /* mask */
+	__bra		.LL4
+.LL6	.alias		.LL5
+
+	.dbg	line,	"tests/960909-1.c", 11; ;
+.LL7:
+
+	.dbg	line,	"tests/960909-1.c", 13; return bit;
+	__ld.wm		__ffs_end - 2  /* bit */
+.LL2:
+
+	.dbg	line,	"tests/960909-1.c", 14; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__ffs_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/960909-1.c", 16; f (x)
+	.dbg	line,	"tests/960909-1.c", 17; int x;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/960909-1.c", 18; {
+
+	.dbg	line,	"tests/960909-1.c", 19; int y;
+
+	.dbg	line,	"tests/960909-1.c", 20; y = ffs (x) - 1;
+	__ld.ws		0  /* x */
+	__pusharg.wr
+	__call		_ffs
+	__sub.wi	1
+	__st.wmq	__f_end - 2  /* y */
+
+	.dbg	line,	"tests/960909-1.c", 21; if (y < 0) 
+	__slt_w.wi	0
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/960909-1.c", 22; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/960909-1.c", 23; }
+.LL9:
+.LL8:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/960909-1.c", 25; main ()
+	.dbg	line,	"tests/960909-1.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/960909-1.c", 27; f (1);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__pusharg.wr
+	__call		_ffs
+	__sub.wi	1
+	__st.wmq	__f_end - 2  /* y */
+	__slt_w.wi	0
+	__bfalse	.LL11
+	__call		_abort
+.LL11:
+.LL12:
+	__modsp		2
+
+	.dbg	line,	"tests/960909-1.c", 28; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/960909-1.c", 29; }
+.LL10:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _f
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 8, 8
+__f_end	=	__overlay_frames + 2
+	.endm
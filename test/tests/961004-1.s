@@ -0,0 +1,158 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/961004-1.c", 1; int k;// = 0;
+	.dbg	line,	"tests/961004-1.c", 3; main()
+	.dbg	line,	"tests/961004-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/961004-1.c", 5; int i;
+
+	.dbg	line,	"tests/961004-1.c", 6; int j;
+
+	.dbg	line,	"tests/961004-1.c", 7; k = 0;
+	__st.wmiq	0, _k
+
+	.dbg	line,	"tests/961004-1.c", 8; for (i = 0; i < 2; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL3:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	2
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/961004-1.c", 9; {
+
+	.dbg	line,	"tests/961004-1.c", 10; if (k)
+	__tst.wm	_k
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/961004-1.c", 11; {
+
+	.dbg	line,	"tests/961004-1.c", 12; if (j != 2)
+	__ld.wm		__main_end - 4  /* j */
+	__neq_w.wi	2
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/961004-1.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/961004-1.c", 14; }
+.LL8	.alias		.LL9
+
+	.dbg	line,	"tests/961004-1.c", 15; else
+	__bra		.LL9
+.LL7:
+
+	.dbg	line,	"tests/961004-1.c", 16; {
+
+	.dbg	line,	"tests/961004-1.c", 17; j = 2;
+	__st.wmiq	2, __main_end - 4  /* j */
+
+	.dbg	line,	"tests/961004-1.c", 18; k++;
+	__inc.wmq	_k
+
+	.dbg	line,	"tests/961004-1.c", 19; }
+.LL9	.alias		.LL4
+
+	.dbg	line,	"tests/961004-1.c", 20; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/961004-1.c", 21; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/961004-1.c", 22; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        50      8     2  k
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_k, 2, 8, 50
+	.endm
@@ -0,0 +1,159 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/961026-1.c", 1; int
+	.dbg	line,	"tests/961026-1.c", 2; test (arg)
+	.dbg	line,	"tests/961026-1.c", 3; int arg;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/961026-1.c", 4; {
+
+	.dbg	line,	"tests/961026-1.c", 5; if (arg > 0 || arg == 0)
+	__ld.ws		0  /* arg */
+	__sgt_w.wi	0
+	__btrue		.LL4
+	__not.ws	0
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/961026-1.c", 6; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/961026-1.c", 7; return -1;
+.LL3:
+	__ld.wi		-1
+.LL2:
+
+	.dbg	line,	"tests/961026-1.c", 8; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/961026-1.c", 10; main ()
+	.dbg	line,	"tests/961026-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/961026-1.c", 12; if (test (0) != 0)
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* arg */
+	__sgt_w.wi	0
+	__btrue		.LL7
+	__not.ws	0
+.LL7:
+	__bfalse	.LL8
+	__ld.wi		0
+	__bra		.LL9
+.LL8:
+	__ld.wi		-1
+.LL9:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/961026-1.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/961026-1.c", 14; if (test (-1) != -1)
+.LL6:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* arg */
+	__sgt_w.wi	0
+	__btrue		.LL11
+	__not.ws	0
+.LL11:
+	__bfalse	.LL12
+	__ld.wi		0
+	__bra		.LL13
+.LL12:
+	__ld.wi		-1
+.LL13:
+	__modsp		2
+	__neq_w.wi	-1
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/961026-1.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/961026-1.c", 16; exit (0);
+.LL10:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/961026-1.c", 17; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
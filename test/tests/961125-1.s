@@ -0,0 +1,234 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/961125-1.c", 1; static char *
+	.dbg	line,	"tests/961125-1.c", 2; begfield (int tab, char *ptr, char *lim, int sword, int schar)
+	.dbg	line,	"tests/961125-1.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_begfield
+	__enter		_begfield
+
+	.dbg	line,	"tests/961125-1.c", 4; if (tab)
+	__tst.ws	8  /* tab */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/961125-1.c", 5; {
+
+	.dbg	line,	"tests/961125-1.c", 6; while (ptr < lim && sword--)
+.LL4:
+	__ld.ws		6  /* ptr */
+	__ult_w.ws	4  /* lim */
+	__bfalse	.LL6
+	__lddec.ws	2  /* sword */
+	__tst.wr
+.LL6:
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/961125-1.c", 7; {
+
+	.dbg	line,	"tests/961125-1.c", 8; while (ptr < lim && *ptr != tab)
+.LL7:
+	__ld.ws		6  /* ptr */
+	__ult_w.ws	4  /* lim */
+	__bfalse	.LL9
+	__ld.ws		6  /* ptr */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__neq_w.ws	8  /* tab */
+.LL9:
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/961125-1.c", 9; ++ptr;
+	__inc.wsq	6  /* ptr */
+	__bra		.LL7
+.LL8:
+
+	.dbg	line,	"tests/961125-1.c", 10; if (ptr < lim)
+	__ld.ws		6  /* ptr */
+	__ult_w.ws	4  /* lim */
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/961125-1.c", 11; ++ptr;
+	__inc.wsq	6  /* ptr */
+
+	.dbg	line,	"tests/961125-1.c", 12; }
+.LL10	.alias		.LL4
+	__bra		.LL4
+.LL5	.alias		.LL11
+
+	.dbg	line,	"tests/961125-1.c", 13; }
+
+	.dbg	line,	"tests/961125-1.c", 14; else
+.LL3:
+
+	.dbg	line,	"tests/961125-1.c", 15; {
+
+	.dbg	line,	"tests/961125-1.c", 16; while (1)
+.LL12:
+	__ld.wi		1
+	__tst.wr
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/961125-1.c", 17; ;
+	__bra		.LL12
+.LL13:
+
+	.dbg	line,	"tests/961125-1.c", 18; }
+.LL11:
+
+	.dbg	line,	"tests/961125-1.c", 20; if (ptr + schar <= lim)
+	__ld.ws		6  /* ptr */
+	__add.ws	0  /* schar */
+	__ule_w.ws	4  /* lim */
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/961125-1.c", 21; ptr += schar;
+	__ld.ws		0  /* schar */
+	__add_st.wsq	6  /* ptr */
+
+	.dbg	line,	"tests/961125-1.c", 23; return ptr;
+.LL14:
+	__ld.ws		6  /* ptr */
+.LL2:
+
+	.dbg	line,	"tests/961125-1.c", 24; }
+	__modsp		10
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/961125-1.c", 26; main ()
+	.dbg	line,	"tests/961125-1.c", 27; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/961125-1.c", 28; char *s, *lim;
+
+	.dbg	line,	"tests/961125-1.c", 29; /*char **/s = ":ab";
+	__ld.wi		__const1+0
+	__st.wmq	__main_end - 2  /* s */
+
+	.dbg	line,	"tests/961125-1.c", 30; /*char **/lim = s + 3;
+	__add.wi	3
+	__st.wmq	__main_end - 4  /* lim */
+
+	.dbg	line,	"tests/961125-1.c", 31; if (begfield (':', s, lim, 1, 1) != s + 2)
+	__ld.wi		58
+	__pusharg.wr
+	__ld.wm		__main_end - 2  /* s */
+	__pusharg.wr
+	__ld.wm		__main_end - 4  /* lim */
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__call		_begfield
+	__push.wr
+	__ld.wm		__main_end - 2  /* s */
+	__add.wi	2
+	__neq_w.wt
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/961125-1.c", 32; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/961125-1.c", 33; exit (0);
+.LL16:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/961125-1.c", 34; }
+.LL15:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	':','a','b',$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:4
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        12     12     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 12, 12
+__main_end	=	__overlay_frames + 4
+	.endm
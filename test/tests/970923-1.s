@@ -0,0 +1,202 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/970923-1.c", 1; int
+	.dbg	line,	"tests/970923-1.c", 2; ts(a)
+	.dbg	line,	"tests/970923-1.c", 3; int a;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ts
+	__enter		_ts
+
+	.dbg	line,	"tests/970923-1.c", 4; {
+
+	.dbg	line,	"tests/970923-1.c", 5; if (a < 1000 && a > 2000)
+	__ld.ws		0  /* a */
+	__slt_w.wi	1000
+	__bfalse	.LL4
+	__ld.ws		0  /* a */
+	__sgt_w.wi	2000
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/970923-1.c", 6; return 1;
+	__ld.wi		1
+	__bra		.LL2
+
+	.dbg	line,	"tests/970923-1.c", 7; else
+.LL3:
+
+	.dbg	line,	"tests/970923-1.c", 8; return 0;
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/970923-1.c", 9; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/970923-1.c", 11; int
+	.dbg	line,	"tests/970923-1.c", 12; tu(a)
+	.dbg	line,	"tests/970923-1.c", 13; unsigned int a;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_tu
+	__enter		_tu
+
+	.dbg	line,	"tests/970923-1.c", 14; {
+
+	.dbg	line,	"tests/970923-1.c", 15; if (a < 1000 && a > 2000)
+	__ld.ws		0  /* a */
+	__ult_w.wi	1000
+	__bfalse	.LL8
+	__ld.ws		0  /* a */
+	__ugt_w.wi	2000
+.LL8:
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/970923-1.c", 16; return 1;
+	__ld.wi		1
+	__bra		.LL6
+
+	.dbg	line,	"tests/970923-1.c", 17; else
+.LL7:
+
+	.dbg	line,	"tests/970923-1.c", 18; return 0;
+	__ld.wi		0
+.LL9:
+
+	.dbg	line,	"tests/970923-1.c", 19; }
+.LL6:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/970923-1.c", 22; main()
+	.dbg	line,	"tests/970923-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/970923-1.c", 24; if (ts (0) || tu (0))
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__slt_w.wi	1000
+	__bfalse	.LL12
+	__ld.ws		0  /* a */
+	__sgt_w.wi	2000
+.LL12:
+	__bfalse	.LL13
+	__ld.wi		1
+	__bra		.LL15
+.LL13:
+	__ld.wi		0
+.LL14:
+.LL15:
+	__modsp		2
+	__tst.wr
+	__btrue		.LL16
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__ult_w.wi	1000
+	__bfalse	.LL17
+	__ld.ws		0  /* a */
+	__ugt_w.wi	2000
+.LL17:
+	__bfalse	.LL18
+	__ld.wi		1
+	__bra		.LL20
+.LL18:
+	__ld.wi		0
+.LL19:
+.LL20:
+	__modsp		2
+	__tst.wr
+.LL16:
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/970923-1.c", 25; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/970923-1.c", 26; exit (0);
+.LL11:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/970923-1.c", 27; }
+.LL10:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
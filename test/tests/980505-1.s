@@ -0,0 +1,144 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/980505-1.c", 1; static int f(int);// __attribute__((const));
+	.dbg	line,	"tests/980505-1.c", 2; int main()
+	.dbg	line,	"tests/980505-1.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/980505-1.c", 4; int f1, f2, x;
+
+	.dbg	line,	"tests/980505-1.c", 5; x = 1; f1 = f(x);
+	__st.wmiq	1, __main_end - 6  /* x */
+	__ld.wm		__main_end - 6  /* x */
+	__pusharg.wr
+	__call		_f
+	__st.wmq	__main_end - 2  /* f1 */
+
+	.dbg	line,	"tests/980505-1.c", 6; x = 2; f2 = f(x);
+	__st.wmiq	2, __main_end - 6  /* x */
+	__ld.wm		__main_end - 6  /* x */
+	__pusharg.wr
+	__call		_f
+	__st.wmq	__main_end - 4  /* f2 */
+
+	.dbg	line,	"tests/980505-1.c", 7; if (f1 != 1 || f2 != 2)
+	__ld.wm		__main_end - 2  /* f1 */
+	__neq_w.wi	1
+	__btrue		.LL4
+	__ld.wm		__main_end - 4  /* f2 */
+	__neq_w.wi	2
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/980505-1.c", 8; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/980505-1.c", 9; exit (0);
+.LL3:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/980505-1.c", 10; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/980505-1.c", 11; static int f(int x) { return x; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+	__ld.ws		0  /* x */
+.LL5:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _main
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        16     16     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 16, 16
+__main_end	=	__overlay_frames + 6
+	.endm
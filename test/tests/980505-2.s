@@ -0,0 +1,140 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/980505-2.c", 1; //typedef unsigned short Uint16;
+	.dbg	line,	"tests/980505-2.c", 2; //typedef unsigned int Uint;
+	.dbg	line,	"tests/980505-2.c", 3; #define Uint16 unsigned short
+	.dbg	line,	"tests/980505-2.c", 4; #define Uint unsigned int
+	.dbg	line,	"tests/980505-2.c", 6; Uint f ()
+	.dbg	line,	"tests/980505-2.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/980505-2.c", 8; Uint16 token;
+
+	.dbg	line,	"tests/980505-2.c", 9; Uint count;
+
+	.dbg	line,	"tests/980505-2.c", 10; static Uint16 values[1]; values[0] = 0x9300;
+	__st.wmiq	37632, SL3  /* values */
+
+	.dbg	line,	"tests/980505-2.c", 12; token = values[0];
+	__ld.wm		SL3  /* values */
+	__st.wmq	__f_end - 2  /* token */
+
+	.dbg	line,	"tests/980505-2.c", 13; count = token >> 8;
+	__lsr.wi	8
+	__st.wmq	__f_end - 4  /* count */
+
+	.dbg	line,	"tests/980505-2.c", 15; return count;
+.LL2:
+
+	.dbg	line,	"tests/980505-2.c", 16; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/980505-2.c", 18; int
+	.dbg	line,	"tests/980505-2.c", 19; main ()
+	.dbg	line,	"tests/980505-2.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/980505-2.c", 21; if (f () != 0x93)
+	__st.wmiq	37632, SL3  /* values */
+	__ld.wm		SL3  /* values */
+	__st.wmq	__f_end - 2  /* token */
+	__lsr.wi	8
+	__st.wmq	__f_end - 4  /* count */
+.LL6:
+	__neq_w.wi	147
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/980505-2.c", 22; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/980505-2.c", 23; exit (0);
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/980505-2.c", 24; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+SL3:
+		ds	2
+
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
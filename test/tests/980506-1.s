@@ -0,0 +1,157 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/980506-1.c", 1; struct decision
+	.dbg	line,	"tests/980506-1.c", 2; {
+	.dbg	line,	"tests/980506-1.c", 3; char enforce_mode;             
+	.dbg	line,	"tests/980506-1.c", 4; struct decision *next;         
+	.dbg	line,	"tests/980506-1.c", 5; };
+	.dbg	line,	"tests/980506-1.c", 8; static void
+	.dbg	line,	"tests/980506-1.c", 9; clear_modes (p)
+	.dbg	line,	"tests/980506-1.c", 10; register struct decision *p;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_clear_modes
+	__enter		_clear_modes
+
+	.dbg	line,	"tests/980506-1.c", 11; {
+
+	.dbg	line,	"tests/980506-1.c", 12; goto blah;
+	__modsp_goto	.LL3_stkp
+	__bra		.LL3
+
+	.dbg	line,	"tests/980506-1.c", 14; foo:
+.LL4:
+
+	.dbg	line,	"tests/980506-1.c", 15; p->enforce_mode = 0;
+	__ld.ws		0  /* p */
+	__push.wr
+	__ld.wi		0
+	__st.utq
+
+	.dbg	line,	"tests/980506-1.c", 16; blah:
+.LL3_stkp	=	0
+.LL3:
+
+	.dbg	line,	"tests/980506-1.c", 17; if (p)
+	__tst.ws	0  /* p */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/980506-1.c", 18; goto foo;
+	__bra		.LL4
+
+	.dbg	line,	"tests/980506-1.c", 19; }
+.LL5:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/980506-1.c", 21; main()
+	.dbg	line,	"tests/980506-1.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/980506-1.c", 23; struct decision *p = 0;
+	__st.wmiq	0, __main_end - 2  /* p */
+
+	.dbg	line,	"tests/980506-1.c", 24; clear_modes (p);
+	__ld.wm		__main_end - 2  /* p */
+	__pusharg.wr
+	__call		_clear_modes
+
+	.dbg	line,	"tests/980506-1.c", 25; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/980506-1.c", 26; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 4, 4
+__main_end	=	__overlay_frames + 2
+	.endm
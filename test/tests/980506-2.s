@@ -0,0 +1,193 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/980506-2.c", 1; static void *self(void *p){ return p; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_self
+	__enter		_self
+	__ld.ws		0  /* p */
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/980506-2.c", 3; struct x { int i;};
+	.dbg	line,	"tests/980506-2.c", 5; int
+	.dbg	line,	"tests/980506-2.c", 6; f()
+	.dbg	line,	"tests/980506-2.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/980506-2.c", 8; struct /*{ int i; }*/ x s, *sp;
+
+	.dbg	line,	"tests/980506-2.c", 9; int *ip; ip = &s.i;
+	__ld.wi		__f_end - 2  /* s */
+	__st.wmq	__f_end - 6  /* ip */
+
+	.dbg	line,	"tests/980506-2.c", 11; s.i = 1;
+	__st.wmiq	1, __f_end - 2  /* s */
+
+	.dbg	line,	"tests/980506-2.c", 12; sp = self(&s);
+	__ld.wi		__f_end - 2  /* s */
+	__pusharg.wr
+	__ld.ws		0  /* p */
+.LL4:
+	__modsp		2
+	__st.wmq	__f_end - 4  /* sp */
+
+	.dbg	line,	"tests/980506-2.c", 13; 
+
+	.dbg	line,	"tests/980506-2.c", 14; *ip = 0;
+	__ld.wm		__f_end - 6  /* ip */
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+
+	.dbg	line,	"tests/980506-2.c", 15; return sp->i+1;
+	__ld.wm		__f_end - 4  /* sp */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	1
+.LL3:
+
+	.dbg	line,	"tests/980506-2.c", 16; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/980506-2.c", 18; main()
+	.dbg	line,	"tests/980506-2.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/980506-2.c", 20; if (f () != 1)
+	__ld.wi		__f_end - 2  /* s */
+	__st.wmq	__f_end - 6  /* ip */
+	__st.wmiq	1, __f_end - 2  /* s */
+	__ld.wi		__f_end - 2  /* s */
+	__pusharg.wr
+	__ld.ws		0  /* p */
+.LL7:
+	__modsp		2
+	__st.wmq	__f_end - 4  /* sp */
+	__ld.wm		__f_end - 6  /* ip */
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+	__ld.wm		__f_end - 4  /* sp */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	1
+.LL8:
+	__neq_w.wi	1
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/980506-2.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/980506-2.c", 22; else
+	__bra		.LL9
+.LL6:
+
+	.dbg	line,	"tests/980506-2.c", 23; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+.LL9:
+
+	.dbg	line,	"tests/980506-2.c", 24; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _f
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        28     28     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 28, 28
+__f_end	=	__overlay_frames + 6
+	.endm
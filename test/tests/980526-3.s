@@ -0,0 +1,174 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/980526-3.c", 1; int compare(x, y)
+	.dbg	line,	"tests/980526-3.c", 2; unsigned int x;
+	.dbg	line,	"tests/980526-3.c", 3; unsigned int y;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_compare
+	__enter		_compare
+
+	.dbg	line,	"tests/980526-3.c", 4; {
+
+	.dbg	line,	"tests/980526-3.c", 5; if (x==y)
+	__ld.ws		2  /* x */
+	__equ_w.ws	0  /* y */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/980526-3.c", 6; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/980526-3.c", 7; else
+.LL3:
+
+	.dbg	line,	"tests/980526-3.c", 8; return 1;
+	__ld.wi		1
+.LL4:
+
+	.dbg	line,	"tests/980526-3.c", 9; }
+.LL2:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/980526-3.c", 10; 
+	.dbg	line,	"tests/980526-3.c", 11; main()
+	.dbg	line,	"tests/980526-3.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/980526-3.c", 13; unsigned int i, j, k, l;
+
+	.dbg	line,	"tests/980526-3.c", 14; i = 5; j = 2; k=0; l=2;
+	__st.wmiq	5, __main_end - 2  /* i */
+	__st.wmiq	2, __main_end - 4  /* j */
+
+	.dbg	line,	"tests/980526-3.c", 15; if (compare(5%(~(unsigned) 2), i%~j) 
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wm		__main_end - 2  /* i */
+	__push.wr
+	__ld.wm		__main_end - 4  /* j */
+	__com.wr
+	__umod.wt
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__equ_w.ws	0  /* y */
+	__bfalse	.LL7
+	__ld.wi		0
+	__bra		.LL9
+.LL7:
+	__ld.wi		1
+.LL8:
+.LL9:
+	__modsp		4
+
+	.dbg	line,	"tests/980526-3.c", 16; /*|| compare(0, k%~l)*/)
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/980526-3.c", 17; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/980526-3.c", 18; else
+	__bra		.LL10
+.LL6:
+
+	.dbg	line,	"tests/980526-3.c", 19; exit(0);
+	__ld.wi		0
+	__call		_exit.1
+.LL10:
+
+	.dbg	line,	"tests/980526-3.c", 20; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     8  _main
+;
+; 8 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        12     12     8  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 8, 12, 12
+__main_end	=	__overlay_frames + 8
+	.endm
@@ -0,0 +1,186 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/980701-1.c", 1; ns_name_skip (unsigned char **x, unsigned char *y)
+	.dbg	line,	"tests/980701-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ns_name_skip
+	__enter		_ns_name_skip
+
+	.dbg	line,	"tests/980701-1.c", 3; *x = 0;
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+
+	.dbg	line,	"tests/980701-1.c", 4; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/980701-1.c", 5; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/980701-1.c", 7; unsigned char a[2];
+	.dbg	line,	"tests/980701-1.c", 9; int dn_skipname(unsigned char *ptr, unsigned char *eom) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_dn_skipname
+	__enter		_dn_skipname
+
+	.dbg	line,	"tests/980701-1.c", 10; unsigned char *saveptr; saveptr = ptr;
+	__ld.ws		2  /* ptr */
+	__st.wmq	__dn_skipname_end - 2  /* saveptr */
+
+	.dbg	line,	"tests/980701-1.c", 12; if (ns_name_skip(&ptr, eom) == -1)
+	__lea.s		2  /* ptr */
+	__pusharg.wr
+	__ld.ws		2  /* eom */
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+	__ld.wi		0
+.LL5:
+	__modsp		4
+	__equ_w.wi	-1
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/980701-1.c", 13; return (-1);
+	__ld.wi		-1
+	__bra		.LL3
+
+	.dbg	line,	"tests/980701-1.c", 14; return (ptr - saveptr);
+.LL4:
+	__ld.ws		2  /* ptr */
+	__sub.wm	__dn_skipname_end - 2  /* saveptr */
+.LL3:
+
+	.dbg	line,	"tests/980701-1.c", 15; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/980701-1.c", 17; main()
+	.dbg	line,	"tests/980701-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/980701-1.c", 19; if (dn_skipname (&a[0], &a[1]) == 0)
+	__ld.wi		_a
+	__pusharg.wr
+	__ld.wi		_a + 1
+	__pusharg.wr
+	__call		_dn_skipname
+	__not.wr
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/980701-1.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/980701-1.c", 21; exit (0);
+.LL7:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/980701-1.c", 22; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_a:
+		ds	2
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _dn_skipname
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 4, 4
+__dn_skipname_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,362 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/980707-1.c", 1; #include <stdlib.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 1; #ifndef _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 2; #define _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 4; #define RAND_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 6; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 7; extern int __fastcall abs( int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 8; #endif
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 10; #endif // _hucc_stdlib_h
+	.dbg	line,	"tests/980707-1.c", 2; #include <string.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 3; #endif
+	.dbg	line,	"tests/980707-1.c", 3; #include <stddef.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/stddef.h", 1; #define NULL (0)
+	.dbg	line,	"tests/980707-1.c", 5; char **
+	.dbg	line,	"tests/980707-1.c", 6; buildargv (char *input)
+	.dbg	line,	"tests/980707-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_buildargv
+	__enter		_buildargv
+
+	.dbg	line,	"tests/980707-1.c", 8; static char *arglist[STACK_SIZE / 4];
+
+	.dbg	line,	"tests/980707-1.c", 9; int numargs = 0;
+	__st.wmiq	0, __buildargv_end - 2  /* numargs */
+
+	.dbg	line,	"tests/980707-1.c", 11; while (1)
+.LL4:
+	__ld.wi		1
+	__tst.wr
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/980707-1.c", 12; {
+
+	.dbg	line,	"tests/980707-1.c", 13; while (*input == ' ')
+.LL6:
+	__ld.ws		0  /* input */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	32
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/980707-1.c", 14; input++;
+	__inc.wsq	0  /* input */
+	__bra		.LL6
+.LL7:
+
+	.dbg	line,	"tests/980707-1.c", 15; if (*input == 0)
+	__ld.ws		0  /* input */
+	__st.wm		__ptr
+	__not.up	__ptr
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/980707-1.c", 16; break;
+	__bra		.LL5
+
+	.dbg	line,	"tests/980707-1.c", 17; arglist [numargs++] = input;
+.LL8:
+	__ldinc.wm	__buildargv_end - 2  /* numargs */
+	__index.wr	SL3  /* arglist */
+	__ld.ws		0  /* input */
+	__st.watq	SL3  /* arglist */
+
+	.dbg	line,	"tests/980707-1.c", 18; while (*input != ' ' && *input != 0)
+.LL9:
+	__ld.ws		0  /* input */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	32
+	__bfalse	.LL11
+	__ld.ws		0  /* input */
+	__st.wm		__ptr
+	__tst.up	__ptr
+.LL11:
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/980707-1.c", 19; input++;
+	__inc.wsq	0  /* input */
+	__bra		.LL9
+.LL10:
+
+	.dbg	line,	"tests/980707-1.c", 20; if (*input == 0)
+	__ld.ws		0  /* input */
+	__st.wm		__ptr
+	__not.up	__ptr
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/980707-1.c", 21; break;
+	__bra		.LL5
+
+	.dbg	line,	"tests/980707-1.c", 22; *(input++) = 0;
+.LL12:
+	__ldinc.ws	0  /* input */
+	__push.wr
+	__ld.wi		0
+	__st.utq
+
+	.dbg	line,	"tests/980707-1.c", 23; }
+	__bra		.LL4
+.LL5:
+
+	.dbg	line,	"tests/980707-1.c", 24; arglist [numargs] = NULL;
+	__ld2x.wmq	__buildargv_end - 2  /* numargs */
+	__st.waxiq	0, SL3  /* arglist */
+
+	.dbg	line,	"tests/980707-1.c", 25; return arglist;
+	__ld.wi		SL3  /* arglist */
+.LL2:
+
+	.dbg	line,	"tests/980707-1.c", 26; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__buildargv_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/980707-1.c", 29; int main()
+	.dbg	line,	"tests/980707-1.c", 30; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/980707-1.c", 31; char **args;
+
+	.dbg	line,	"tests/980707-1.c", 32; char input[STACK_SIZE / 4];
+
+	.dbg	line,	"tests/980707-1.c", 33; int i;
+
+	.dbg	line,	"tests/980707-1.c", 35; strcpy(input, " a b");
+	__ld.wi		__main_end - 34  /* input */
+	__st.wmq	_di
+	__ld.wi		__const1+0
+	__st.wmq	_bp
+	__call		_strcpy.2
+
+	.dbg	line,	"tests/980707-1.c", 36; args = buildargv(input);
+	__ld.wi		__main_end - 34  /* input */
+	__pusharg.wr
+	__call		_buildargv
+	__st.wmq	__main_end - 2  /* args */
+
+	.dbg	line,	"tests/980707-1.c", 38; if (strcmp (args[0], "a"))
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_di
+	__ld.wi		__const1+5
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/980707-1.c", 39; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/980707-1.c", 40; if (strcmp (args[1], "b"))
+.LL14:
+	__ld.wm		__main_end - 2  /* args */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_di
+	__ld.wi		__const1+7
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/980707-1.c", 41; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/980707-1.c", 42; if (args[2] != NULL)
+.LL15:
+	__ld.wm		__main_end - 2  /* args */
+	__add.wi	4
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/980707-1.c", 43; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/980707-1.c", 44; exit (0);
+.LL16:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/980707-1.c", 45; }
+.LL13:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	' ','a',' ','b',$00,'a',$00,'b'
+		db	$00
+
+	.bss
+SL3:
+		ds	32
+
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:9
+;	constant pool:0
+;	global pool:23
+;	Macro pool:10
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    36  _main
+;
+; 36 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        18     18    36  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 36, 18, 18
+__main_end	=	__overlay_frames + 36
+	.endm
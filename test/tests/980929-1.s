@@ -0,0 +1,174 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/980929-1.c", 1; void f(int i)
+	.dbg	line,	"tests/980929-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/980929-1.c", 3; if (i != 1000)
+	__ld.ws		0  /* i */
+	__neq_w.wi	1000
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/980929-1.c", 4; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/980929-1.c", 5; }
+.LL3:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/980929-1.c", 8; int main()
+	.dbg	line,	"tests/980929-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/980929-1.c", 10; int n=1000;
+	__st.wmiq	1000, __main_end - 2  /* n */
+
+	.dbg	line,	"tests/980929-1.c", 11; int i;
+
+	.dbg	line,	"tests/980929-1.c", 13; f(n);
+	__ld.wm		__main_end - 2  /* n */
+	__pusharg.wr
+	__ld.ws		0  /* i */
+	__neq_w.wi	1000
+	__bfalse	.LL5
+	__call		_abort
+.LL5:
+.LL6:
+	__modsp		2
+
+	.dbg	line,	"tests/980929-1.c", 14; for(i=0; i<1; ++i) {
+	__st.wmiq	0, __main_end - 4  /* i */
+.LL7:
+	__ld.wm		__main_end - 4  /* i */
+	__slt_w.wi	1
+	__btrue		.LL9
+	__bra		.LL10
+.LL8:
+	__inc.wmq	__main_end - 4  /* i */
+	__bra		.LL7
+.LL9:
+
+	.dbg	line,	"tests/980929-1.c", 15; f(n);
+	__ld.wm		__main_end - 2  /* n */
+	__pusharg.wr
+	__ld.ws		0  /* i */
+	__neq_w.wi	1000
+	__bfalse	.LL11
+	__call		_abort
+.LL11:
+.LL12:
+	__modsp		2
+
+	.dbg	line,	"tests/980929-1.c", 16; n=666;
+	__st.wmiq	666, __main_end - 2  /* n */
+
+	.dbg	line,	"tests/980929-1.c", 17; &n;
+	__ld.wi		__main_end - 2  /* n */
+
+	.dbg	line,	"tests/980929-1.c", 18; }
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/980929-1.c", 20; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/980929-1.c", 21; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       100     16     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 16, 100
+__main_end	=	__overlay_frames + 4
+	.endm
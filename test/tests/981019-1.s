@@ -0,0 +1,250 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/981019-1.c", 1; extern int f2(void);
+	.dbg	line,	"tests/981019-1.c", 2; extern int f3(void);
+	.dbg	line,	"tests/981019-1.c", 3; extern void f1(void);
+	.dbg	line,	"tests/981019-1.c", 5; void
+	.dbg	line,	"tests/981019-1.c", 6; ff(int fname, int part, int nparts)
+	.dbg	line,	"tests/981019-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ff
+	__enter		_ff
+
+	.dbg	line,	"tests/981019-1.c", 8; if (fname)  /* bb 0 */
+	__tst.ws	4  /* fname */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/981019-1.c", 9; {
+
+	.dbg	line,	"tests/981019-1.c", 10; if (nparts)  /* bb 1 */
+	__tst.ws	0  /* nparts */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/981019-1.c", 11; f1();  /* bb 2 */
+	__call		_f1
+
+	.dbg	line,	"tests/981019-1.c", 12; }
+.LL4	.alias		.LL5
+
+	.dbg	line,	"tests/981019-1.c", 13; else
+	__bra		.LL5
+.LL3:
+
+	.dbg	line,	"tests/981019-1.c", 14; fname = 2; /* bb 3  */
+	__st.wsiq	2, 4  /* fname */
+.LL5:
+
+	.dbg	line,	"tests/981019-1.c", 16; /* bb 4 is the branch to bb 10
+
+	.dbg	line,	"tests/981019-1.c", 17; (bb 10 is physically at the end of the loop) */
+
+	.dbg	line,	"tests/981019-1.c", 18; while (f3() /* bb 10 */)
+.LL6:
+	__call		_f3
+	__tst.wr
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/981019-1.c", 19; {
+
+	.dbg	line,	"tests/981019-1.c", 20; if (nparts /* bb 5 */ && f2() /* bb 6 */)
+	__tst.ws	0  /* nparts */
+	__bfalse	.LL9
+	__call		_f2
+	__tst.wr
+.LL9:
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/981019-1.c", 21; {
+
+	.dbg	line,	"tests/981019-1.c", 22; f1();  /* bb 7 ... */
+	__call		_f1
+
+	.dbg	line,	"tests/981019-1.c", 23; nparts = part;
+	__ld.ws		2  /* part */
+	__st.wsq	0  /* nparts */
+
+	.dbg	line,	"tests/981019-1.c", 24; if (f3())  /* ... bb 7 */
+	__call		_f3
+	__tst.wr
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/981019-1.c", 25; f1();  /* bb 8 */
+	__call		_f1
+
+	.dbg	line,	"tests/981019-1.c", 26; f1(); /* bb 9 */
+.LL10:
+	__call		_f1
+
+	.dbg	line,	"tests/981019-1.c", 27; break;
+	__bra		.LL7
+
+	.dbg	line,	"tests/981019-1.c", 28; }
+
+	.dbg	line,	"tests/981019-1.c", 29; }
+.LL8	.alias		.LL6
+.LL7:
+
+	.dbg	line,	"tests/981019-1.c", 31; if (nparts)  /* bb 11 */
+	__tst.ws	0  /* nparts */
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/981019-1.c", 32; f1(); /* bb 12 */
+	__call		_f1
+
+	.dbg	line,	"tests/981019-1.c", 33; return; /* bb 13 */
+.LL11	.alias		.LL2
+.LL2:
+
+	.dbg	line,	"tests/981019-1.c", 34; }
+	__modsp		6
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/981019-1.c", 36; int main(void)
+	.dbg	line,	"tests/981019-1.c", 37; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/981019-1.c", 38; ff(0, 1, 0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_ff
+
+	.dbg	line,	"tests/981019-1.c", 39; return 0;
+	__ld.wi		0
+.LL12:
+
+	.dbg	line,	"tests/981019-1.c", 40; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/981019-1.c", 42; int f3(void) { static int x/* = 0*/; x = !x; return x; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f3
+	__enter		_f3
+	__boolnot.wm	SL14  /* x */
+	__st.wmq	SL14  /* x */
+.LL13:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/981019-1.c", 43; void f1(void) { abort(); }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f1
+	__enter		_f1
+	__call		_abort
+.LL15:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/981019-1.c", 44; int f2(void) { abort(); }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f2
+	__enter		_f2
+	__call		_abort
+.LL16:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:7
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  x (static in f3())
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	SL14, 2, 6, 6
+	.endm
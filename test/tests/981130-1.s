@@ -0,0 +1,186 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/981130-1.c", 1; struct s { int a; int b;};
+	.dbg	line,	"tests/981130-1.c", 2; struct s s1;
+	.dbg	line,	"tests/981130-1.c", 3; struct s s2 = { 1, 2, };
+	.dbg	line,	"tests/981130-1.c", 5; void
+	.dbg	line,	"tests/981130-1.c", 6; check (a, b)
+	.dbg	line,	"tests/981130-1.c", 7; int a;
+	.dbg	line,	"tests/981130-1.c", 8; int b;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_check
+	__enter		_check
+
+	.dbg	line,	"tests/981130-1.c", 9; {
+
+	.dbg	line,	"tests/981130-1.c", 10; if (a == b)
+	__ld.ws		2  /* a */
+	__equ_w.ws	0  /* b */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/981130-1.c", 11; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/981130-1.c", 12; else
+	__bra		.LL4
+.LL3:
+
+	.dbg	line,	"tests/981130-1.c", 13; abort ();
+	__call		_abort
+.LL4:
+
+	.dbg	line,	"tests/981130-1.c", 14; }
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/981130-1.c", 16; int
+	.dbg	line,	"tests/981130-1.c", 17; main ()
+	.dbg	line,	"tests/981130-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/981130-1.c", 19; int * p;
+
+	.dbg	line,	"tests/981130-1.c", 20; int x;
+
+	.dbg	line,	"tests/981130-1.c", 21; 
+
+	.dbg	line,	"tests/981130-1.c", 22; s1.a = 9;
+	__st.wmiq	9, _s1
+
+	.dbg	line,	"tests/981130-1.c", 23; p    = & s1.a;
+	__ld.wi		_s1
+	__st.wmq	__main_end - 2  /* p */
+
+	.dbg	line,	"tests/981130-1.c", 24; s1   = s2;
+	__tii		_s2, _s1, 4
+
+	.dbg	line,	"tests/981130-1.c", 25; x    = * p;
+	__ld.wm		__main_end - 2  /* p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__main_end - 4  /* x */
+
+	.dbg	line,	"tests/981130-1.c", 26; 
+
+	.dbg	line,	"tests/981130-1.c", 27; check (x, 1);
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__equ_w.ws	0  /* b */
+	__bfalse	.LL6
+	__ld.wi		0
+	__call		_exit.1
+	__bra		.LL7
+.LL6:
+	__call		_abort
+.LL7:
+.LL8:
+	__modsp		4
+
+	.dbg	line,	"tests/981130-1.c", 28; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.xdata
+_s2:
+		ds	4
+
+	.xinit
+		dw	1
+		dw	2
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     4  overlaid locals
+;         6      6     4  s1
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 8, 8
+__main_end	=	__overlay_frames + 4
+	auto_zp_var	_s1, 4, 6, 6
+	.endm
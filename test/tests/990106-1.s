@@ -0,0 +1,164 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/990106-1.c", 1; foo(bufp)
+	.dbg	line,	"tests/990106-1.c", 2; char *bufp;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/990106-1.c", 3; {
+
+	.dbg	line,	"tests/990106-1.c", 4; int x = 80;
+	__st.wmiq	80, __foo_end - 2  /* x */
+
+	.dbg	line,	"tests/990106-1.c", 5; return (*bufp++ = x ? 'a' : 'b');
+	__ldinc.ws	0  /* bufp */
+	__push.wr
+	__tst.wm	__foo_end - 2  /* x */
+	__bfalse	.LL3
+	__ld.wi		97
+	__bra		.LL4
+.LL3:
+	__ld.wi		98
+.LL4:
+	__st.ut
+.LL2:
+
+	.dbg	line,	"tests/990106-1.c", 6; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/990106-1.c", 8; main()
+	.dbg	line,	"tests/990106-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/990106-1.c", 10; char x;
+
+	.dbg	line,	"tests/990106-1.c", 12; if (foo (&x) != 'a')
+	__ld.wi		__main_end - 1  /* x */
+	__pusharg.wr
+	__st.wmiq	80, __foo_end - 2  /* x */
+	__ldinc.ws	0  /* bufp */
+	__push.wr
+	__tst.wm	__foo_end - 2  /* x */
+	__bfalse	.LL7
+	__ld.wi		97
+	__bra		.LL8
+.LL7:
+	__ld.wi		98
+.LL8:
+	__st.ut
+.LL9:
+	__modsp		2
+	__neq_w.wi	97
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/990106-1.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/990106-1.c", 15; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/990106-1.c", 16; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     1  _main
+;
+; 1 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         2      2     1  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 1, 2, 2
+__main_end	=	__overlay_frames + 1
+	.endm
@@ -0,0 +1,186 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/990106-2.c", 1; unsigned calc_mp(unsigned mod)
+	.dbg	line,	"tests/990106-2.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_calc_mp
+	__enter		_calc_mp
+
+	.dbg	line,	"tests/990106-2.c", 3; unsigned a,b,c;
+
+	.dbg	line,	"tests/990106-2.c", 4; c=-1;
+	__st.wmiq	-1, __calc_mp_end - 6  /* c */
+
+	.dbg	line,	"tests/990106-2.c", 5; a=c/mod;
+	__ld.wm		__calc_mp_end - 6  /* c */
+	__push.wr
+	__ld.ws		0  /* mod */
+	__udiv.wt
+	__st.wmq	__calc_mp_end - 2  /* a */
+
+	.dbg	line,	"tests/990106-2.c", 6; b=0-a*mod;
+	__push.wr
+	__ld.ws		0  /* mod */
+	__mul.wt
+	__isub.wi	0
+	__st.wmq	__calc_mp_end - 4  /* b */
+
+	.dbg	line,	"tests/990106-2.c", 7; if (b > mod) { a += 1; b-=mod; }
+	__ugt_w.ws	0  /* mod */
+	__bfalse	.LL3
+	__add_st.wmiq	1, __calc_mp_end - 2  /* a */
+	__ld.ws		0  /* mod */
+	__isub_st.wmq	__calc_mp_end - 4  /* b */
+
+	.dbg	line,	"tests/990106-2.c", 8; return b;
+.LL3:
+	__ld.wm		__calc_mp_end - 4  /* b */
+.LL2:
+
+	.dbg	line,	"tests/990106-2.c", 9; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__calc_mp_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/990106-2.c", 11; int main(int argc, char *argv[])
+	.dbg	line,	"tests/990106-2.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/990106-2.c", 13; unsigned x = 1234;
+	__st.wmiq	1234, __main_end - 2  /* x */
+
+	.dbg	line,	"tests/990106-2.c", 14; unsigned y; y = calc_mp(x);
+	__ld.wm		__main_end - 2  /* x */
+	__pusharg.wr
+	__call		_calc_mp
+	__st.wmq	__main_end - 4  /* y */
+
+	.dbg	line,	"tests/990106-2.c", 16; if ((sizeof (y) == 4 && y != 680)
+	__ld.wi		2
+	__equ_w.wi	4
+	__bfalse	.LL6
+	__ld.wm		__main_end - 4  /* y */
+	__neq_w.wi	680
+.LL6:
+	__btrue		.LL7
+
+	.dbg	line,	"tests/990106-2.c", 17; || (sizeof (y) == 2 && y != 134))
+	__ld.wi		2
+	__equ_w.wi	2
+	__bfalse	.LL8
+	__ld.wm		__main_end - 4  /* y */
+	__neq_w.wi	134
+.LL8:
+.LL7:
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/990106-2.c", 18; exit (y);
+	__ld.wm		__main_end - 4  /* y */
+	__call		_exit.1
+
+	.dbg	line,	"tests/990106-2.c", 19; exit (0);
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/990106-2.c", 20; }
+.LL4:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        14     14     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 14, 14
+__main_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,207 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/990127-1.c", 1; main()
+	.dbg	line,	"tests/990127-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/990127-1.c", 3; int a,b,c;
+
+	.dbg	line,	"tests/990127-1.c", 4; int *pa, *pb, *pc;
+
+	.dbg	line,	"tests/990127-1.c", 5; int **ppa, **ppb, **ppc;
+
+	.dbg	line,	"tests/990127-1.c", 6; int i,j,k,x,y,z;
+
+	.dbg	line,	"tests/990127-1.c", 8; a = 10;
+	__st.wmiq	10, __main_end - 2  /* a */
+
+	.dbg	line,	"tests/990127-1.c", 9; b = 20;
+	__st.wmiq	20, __main_end - 4  /* b */
+
+	.dbg	line,	"tests/990127-1.c", 10; c = 30;
+	__st.wmiq	30, __main_end - 6  /* c */
+
+	.dbg	line,	"tests/990127-1.c", 11; pa = &a; pb = &b; pc = &c;
+	__ld.wi		__main_end - 2  /* a */
+	__st.wmq	__main_end - 8  /* pa */
+	__ld.wi		__main_end - 4  /* b */
+	__st.wmq	__main_end - 10  /* pb */
+	__ld.wi		__main_end - 6  /* c */
+	__st.wmq	__main_end - 12  /* pc */
+
+	.dbg	line,	"tests/990127-1.c", 12; ppa = &pa; ppb = &pb; ppc = &pc;
+	__ld.wi		__main_end - 12  /* pc */
+
+	.dbg	line,	"tests/990127-1.c", 13; x = 0; y = 0; z = 0;
+	__st.wmiq	0, __main_end - 26  /* x */
+
+	.dbg	line,	"tests/990127-1.c", 15; for(i=0;i<10;i++){
+	__st.wmiq	0, __main_end - 20  /* i */
+.LL3:
+	__ld.wm		__main_end - 20  /* i */
+	__slt_w.wi	10
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__main_end - 20  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/990127-1.c", 16; if( pa == &a ) pa = &b;
+	__ld.wm		__main_end - 8  /* pa */
+	__equ_w.wi	__main_end - 2  /* a */
+	__bfalse	.LL7
+	__ld.wi		__main_end - 4  /* b */
+	__st.wmq	__main_end - 8  /* pa */
+
+	.dbg	line,	"tests/990127-1.c", 17; else pa = &a;
+	__bra		.LL8
+.LL7:
+	__ld.wi		__main_end - 2  /* a */
+	__st.wmq	__main_end - 8  /* pa */
+.LL8:
+
+	.dbg	line,	"tests/990127-1.c", 18; while( (*pa)-- ){
+.LL9:
+	__ld.wm		__main_end - 8  /* pa */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__sub.wi	1
+	__st.wt
+	__add.wi	1
+	__tst.wr
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/990127-1.c", 19; x++;
+	__inc.wmq	__main_end - 26  /* x */
+
+	.dbg	line,	"tests/990127-1.c", 20; if( (*pa) < 3 ) break;
+	__ld.wm		__main_end - 8  /* pa */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__slt_w.wi	3
+	__bfalse	.LL11
+	__bra		.LL10
+
+	.dbg	line,	"tests/990127-1.c", 21; else pa = &b;
+.LL11:
+	__ld.wi		__main_end - 4  /* b */
+	__st.wmq	__main_end - 8  /* pa */
+.LL12	.alias		.LL9
+
+	.dbg	line,	"tests/990127-1.c", 22; }
+	__bra		.LL9
+.LL10:
+
+	.dbg	line,	"tests/990127-1.c", 23; x++;
+	__inc.wmq	__main_end - 26  /* x */
+
+	.dbg	line,	"tests/990127-1.c", 24; pa = &b;
+	__ld.wi		__main_end - 4  /* b */
+	__st.wmq	__main_end - 8  /* pa */
+
+	.dbg	line,	"tests/990127-1.c", 25; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/990127-1.c", 27; if ((*pa) != -5 || (*pb) != -5 || x != 43)
+	__ld.wm		__main_end - 8  /* pa */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	-5
+	__btrue		.LL14
+	__ld.wm		__main_end - 10  /* pb */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	-5
+.LL14:
+	__btrue		.LL15
+	__ld.wm		__main_end - 26  /* x */
+	__neq_w.wi	43
+.LL15:
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/990127-1.c", 28; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/990127-1.c", 30; exit (0);
+.LL13:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/990127-1.c", 31; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 30
+leaf_needs	.set	30
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
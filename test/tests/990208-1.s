@@ -0,0 +1,113 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/990208-1.c", 1; /* As a quality of implementation issue, we should not prevent inlining
+	.dbg	line,	"tests/990208-1.c", 2; of function explicitly marked inline just because a label therein had
+	.dbg	line,	"tests/990208-1.c", 3; its address taken.  */
+	.dbg	line,	"tests/990208-1.c", 5; #ifndef NO_LABEL_VALUES
+	.dbg	line,	"tests/990208-1.c", 6; static void *ptr1, *ptr2;
+	.dbg	line,	"tests/990208-1.c", 7; static int i = 1;
+	.dbg	line,	"tests/990208-1.c", 9; static __inline__ void doit(void **pptr, int cond)
+	.dbg	line,	"tests/990208-1.c", 10; {
+	.dbg	line,	"tests/990208-1.c", 11; if (cond) {
+	.dbg	line,	"tests/990208-1.c", 12; here:
+	.dbg	line,	"tests/990208-1.c", 13; *pptr = &&here;
+	.dbg	line,	"tests/990208-1.c", 14; }
+	.dbg	line,	"tests/990208-1.c", 15; }
+	.dbg	line,	"tests/990208-1.c", 17; __attribute__ ((noinline))
+	.dbg	line,	"tests/990208-1.c", 18; static void f(int cond)
+	.dbg	line,	"tests/990208-1.c", 19; {
+	.dbg	line,	"tests/990208-1.c", 20; doit (&ptr1, cond);
+	.dbg	line,	"tests/990208-1.c", 21; }
+	.dbg	line,	"tests/990208-1.c", 23; __attribute__ ((noinline))
+	.dbg	line,	"tests/990208-1.c", 24; static void g(int cond)
+	.dbg	line,	"tests/990208-1.c", 25; {
+	.dbg	line,	"tests/990208-1.c", 26; doit (&ptr2, cond);
+	.dbg	line,	"tests/990208-1.c", 27; }
+	.dbg	line,	"tests/990208-1.c", 29; __attribute__ ((noinline))
+	.dbg	line,	"tests/990208-1.c", 30; void bar(void);
+	.dbg	line,	"tests/990208-1.c", 32; int main()
+	.dbg	line,	"tests/990208-1.c", 33; {
+	.dbg	line,	"tests/990208-1.c", 34; f (i);
+	.dbg	line,	"tests/990208-1.c", 35; bar();
+	.dbg	line,	"tests/990208-1.c", 36; g (i);
+	.dbg	line,	"tests/990208-1.c", 38; #ifdef  __OPTIMIZE__
+	.dbg	line,	"tests/990208-1.c", 39; if (ptr1 == ptr2)
+	.dbg	line,	"tests/990208-1.c", 40; abort ();
+	.dbg	line,	"tests/990208-1.c", 41; #endif
+	.dbg	line,	"tests/990208-1.c", 43; exit (0);
+	.dbg	line,	"tests/990208-1.c", 44; }
+	.dbg	line,	"tests/990208-1.c", 46; void bar(void) { }
+	.dbg	line,	"tests/990208-1.c", 48; #else /* NO_LABEL_VALUES */
+	.dbg	line,	"tests/990208-1.c", 49; int main() { exit(0); }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+	__ld.wi		0
+	__call		_exit.1
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/990208-1.c", 50; #endif
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
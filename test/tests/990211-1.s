@@ -0,0 +1,342 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/990211-1.c", 1; /* Copyright (C) 1999 Free Software Foundation, Inc.
+	.dbg	line,	"tests/990211-1.c", 2; Contributed by Nathan Sidwell 20 Jan 1999 <nathan@acm.org> */
+	.dbg	line,	"tests/990211-1.c", 4; /* check range combining boolean operations work */
+	.dbg	line,	"tests/990211-1.c", 6; extern void abort();
+	.dbg	line,	"tests/990211-1.c", 8; #define N 77
+	.dbg	line,	"tests/990211-1.c", 10; void func(int i)
+	.dbg	line,	"tests/990211-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func
+	__enter		_func
+
+	.dbg	line,	"tests/990211-1.c", 12; /* fold-const does some clever things with range tests. Make sure
+
+	.dbg	line,	"tests/990211-1.c", 13; we get (some of) them right */
+
+	.dbg	line,	"tests/990211-1.c", 14; 
+
+	.dbg	line,	"tests/990211-1.c", 15; /* these must fail, regardless of the value of i */
+
+	.dbg	line,	"tests/990211-1.c", 16; if ((i < 0) && (i >= 0))
+	__ld.ws		0  /* i */
+	__slt_w.wi	0
+	__bfalse	.LL4
+	__ld.ws		0  /* i */
+	__sge_w.wi	0
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/990211-1.c", 17; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 18; if ((i > 0) && (i <= 0))
+.LL3:
+	__ld.ws		0  /* i */
+	__sgt_w.wi	0
+	__bfalse	.LL6
+	__ld.ws		0  /* i */
+	__sle_w.wi	0
+.LL6:
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/990211-1.c", 19; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 20; if ((i >= 0) && (i < 0))
+.LL5:
+	__ld.ws		0  /* i */
+	__sge_w.wi	0
+	__bfalse	.LL8
+	__ld.ws		0  /* i */
+	__slt_w.wi	0
+.LL8:
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/990211-1.c", 21; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 22; if ((i <= 0) && (i > 0))
+.LL7:
+	__ld.ws		0  /* i */
+	__sle_w.wi	0
+	__bfalse	.LL10
+	__ld.ws		0  /* i */
+	__sgt_w.wi	0
+.LL10:
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/990211-1.c", 23; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 25; if ((i < N) && (i >= N))
+.LL9:
+	__ld.ws		0  /* i */
+	__slt_w.wi	77
+	__bfalse	.LL12
+	__ld.ws		0  /* i */
+	__sge_w.wi	77
+.LL12:
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/990211-1.c", 26; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 27; if ((i > N) && (i <= N))
+.LL11:
+	__ld.ws		0  /* i */
+	__sgt_w.wi	77
+	__bfalse	.LL14
+	__ld.ws		0  /* i */
+	__sle_w.wi	77
+.LL14:
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/990211-1.c", 28; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 29; if ((i >= N) && (i < N))
+.LL13:
+	__ld.ws		0  /* i */
+	__sge_w.wi	77
+	__bfalse	.LL16
+	__ld.ws		0  /* i */
+	__slt_w.wi	77
+.LL16:
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/990211-1.c", 30; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 31; if ((i <= N) && (i > N))
+.LL15:
+	__ld.ws		0  /* i */
+	__sle_w.wi	77
+	__bfalse	.LL18
+	__ld.ws		0  /* i */
+	__sgt_w.wi	77
+.LL18:
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/990211-1.c", 32; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 33; 
+
+	.dbg	line,	"tests/990211-1.c", 34; /* these must pass, regardless of the value of i */
+
+	.dbg	line,	"tests/990211-1.c", 35; if (! ((i < 0) || (i >= 0)))
+.LL17:
+	__ld.ws		0  /* i */
+	__slt_w.wi	0
+	__btrue		.LL20
+	__ld.ws		0  /* i */
+	__sge_w.wi	0
+.LL20:
+	__not.cf
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/990211-1.c", 36; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 37; if (! ((i > 0) || (i <= 0)))
+.LL19:
+	__ld.ws		0  /* i */
+	__sgt_w.wi	0
+	__btrue		.LL22
+	__ld.ws		0  /* i */
+	__sle_w.wi	0
+.LL22:
+	__not.cf
+	__bfalse	.LL21
+
+	.dbg	line,	"tests/990211-1.c", 38; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 39; if (! ((i >= 0) || (i < 0)))
+.LL21:
+	__ld.ws		0  /* i */
+	__sge_w.wi	0
+	__btrue		.LL24
+	__ld.ws		0  /* i */
+	__slt_w.wi	0
+.LL24:
+	__not.cf
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/990211-1.c", 40; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 41; if (! ((i <= 0) || (i > 0)))
+.LL23:
+	__ld.ws		0  /* i */
+	__sle_w.wi	0
+	__btrue		.LL26
+	__ld.ws		0  /* i */
+	__sgt_w.wi	0
+.LL26:
+	__not.cf
+	__bfalse	.LL25
+
+	.dbg	line,	"tests/990211-1.c", 42; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 44; if (! ((i < N) || (i >= N)))
+.LL25:
+	__ld.ws		0  /* i */
+	__slt_w.wi	77
+	__btrue		.LL28
+	__ld.ws		0  /* i */
+	__sge_w.wi	77
+.LL28:
+	__not.cf
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/990211-1.c", 45; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 46; if (! ((i > N) || (i <= N)))
+.LL27:
+	__ld.ws		0  /* i */
+	__sgt_w.wi	77
+	__btrue		.LL30
+	__ld.ws		0  /* i */
+	__sle_w.wi	77
+.LL30:
+	__not.cf
+	__bfalse	.LL29
+
+	.dbg	line,	"tests/990211-1.c", 47; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 48; if (! ((i >= N) || (i < N)))
+.LL29:
+	__ld.ws		0  /* i */
+	__sge_w.wi	77
+	__btrue		.LL32
+	__ld.ws		0  /* i */
+	__slt_w.wi	77
+.LL32:
+	__not.cf
+	__bfalse	.LL31
+
+	.dbg	line,	"tests/990211-1.c", 49; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 50; if (! ((i <= N) || (i > N)))
+.LL31:
+	__ld.ws		0  /* i */
+	__sle_w.wi	77
+	__btrue		.LL34
+	__ld.ws		0  /* i */
+	__sgt_w.wi	77
+.LL34:
+	__not.cf
+	__bfalse	.LL33
+
+	.dbg	line,	"tests/990211-1.c", 51; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990211-1.c", 52; 
+
+	.dbg	line,	"tests/990211-1.c", 53; return;
+.LL33	.alias		.LL2
+.LL2:
+
+	.dbg	line,	"tests/990211-1.c", 54; }
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/990211-1.c", 56; int main()
+	.dbg	line,	"tests/990211-1.c", 57; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/990211-1.c", 58; func(0);
+	__ld.wi		0
+	__pusharg.wr
+	__call		_func
+
+	.dbg	line,	"tests/990211-1.c", 59; func(1);
+	__ld.wi		1
+	__pusharg.wr
+	__call		_func
+
+	.dbg	line,	"tests/990211-1.c", 60; return 0;
+	__ld.wi		0
+.LL35:
+
+	.dbg	line,	"tests/990211-1.c", 61; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,134 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/990222-1.c", 1; char line[4];// = { '1', '9', '9', '\0' };
+	.dbg	line,	"tests/990222-1.c", 3; int main()
+	.dbg	line,	"tests/990222-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/990222-1.c", 5; char *ptr;// = line + 3;
+
+	.dbg	line,	"tests/990222-1.c", 6; line[0] = '1'; line[1] = '9'; line[2] = '9'; line[3] = '\0';
+	__st.umiq	49, _line
+	__st.umiq	57, _line + 1
+	__st.umiq	57, _line + 2
+	__st.umiq	0, _line + 3
+
+	.dbg	line,	"tests/990222-1.c", 7; ptr = line + 3;
+	__ld.wi		_line + 3
+	__st.wmq	__main_end - 2  /* ptr */
+
+	.dbg	line,	"tests/990222-1.c", 9; while ((*--ptr += 1) > '9') *ptr = '0';
+.LL3:
+	__decld.wm	__main_end - 2  /* ptr */
+	__push.wr
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__add.wi	1
+	__st.ut
+	__sgt_w.wi	57
+	__bfalse	.LL4
+	__ld.wm		__main_end - 2  /* ptr */
+	__push.wr
+	__ld.wi		48
+	__st.utq
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/990222-1.c", 10; if (line[0] != '2' || line[1] != '0' || line[2] != '0')
+	__ld.umq	_line
+	__neq_b.uiq	50
+	__btrue		.LL6
+	__ld.umq	_line + 1
+	__neq_b.uiq	48
+.LL6:
+	__btrue		.LL7
+	__ld.umq	_line + 2
+	__neq_b.uiq	48
+.LL7:
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/990222-1.c", 11; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/990222-1.c", 12; return 0;
+.LL5:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/990222-1.c", 13; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_line:
+		ds	4
+
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,191 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/990527-1.c", 1; int sum;
+	.dbg	line,	"tests/990527-1.c", 3; void
+	.dbg	line,	"tests/990527-1.c", 4; g (int i)
+	.dbg	line,	"tests/990527-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/990527-1.c", 6; sum += i;
+	__ld.ws		0  /* i */
+	__add_st.wmq	_sum
+
+	.dbg	line,	"tests/990527-1.c", 7; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/990527-1.c", 9; void
+	.dbg	line,	"tests/990527-1.c", 10; f(int j)
+	.dbg	line,	"tests/990527-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/990527-1.c", 12; int i;
+
+	.dbg	line,	"tests/990527-1.c", 14; for (i = 0; i < 9; i++)
+	__st.wmiq	0, __f_end - 2  /* i */
+.LL4:
+	__ld.wm		__f_end - 2  /* i */
+	__slt_w.wi	9
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__f_end - 2  /* i */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/990527-1.c", 15; {
+
+	.dbg	line,	"tests/990527-1.c", 16; j++;
+	__inc.wsq	0  /* j */
+
+	.dbg	line,	"tests/990527-1.c", 17; g (j);
+	__ld.ws		0  /* j */
+	__pusharg.wr
+	__ld.ws		0  /* i */
+	__add_st.wmq	_sum
+.LL8:
+	__modsp		2
+
+	.dbg	line,	"tests/990527-1.c", 18; j = 9;
+	__st.wsiq	9, 0  /* j */
+
+	.dbg	line,	"tests/990527-1.c", 19; }
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/990527-1.c", 20; }
+.LL3:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/990527-1.c", 22; int
+	.dbg	line,	"tests/990527-1.c", 23; main ()
+	.dbg	line,	"tests/990527-1.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/990527-1.c", 25; f (0);
+	__ld.wi		0
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/990527-1.c", 26; if (sum != 81)
+	__ld.wm		_sum
+	__neq_w.wi	81
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/990527-1.c", 27; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/990527-1.c", 28; exit (0);
+.LL10:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/990527-1.c", 29; }
+.LL9:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _f
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        48      6     2  overlaid locals
+;        22      8     2  sum
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 48
+__f_end	=	__overlay_frames + 2
+	auto_zp_var	_sum, 2, 8, 22
+	.endm
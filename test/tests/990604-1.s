@@ -0,0 +1,166 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/990604-1.c", 1; int b;
+	.dbg	line,	"tests/990604-1.c", 2; void f ()
+	.dbg	line,	"tests/990604-1.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/990604-1.c", 4; int i = 0;
+	__st.wmiq	0, __f_end - 2  /* i */
+
+	.dbg	line,	"tests/990604-1.c", 5; if (b == 0)
+	__not.wm	_b
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/990604-1.c", 6; do {
+.LL4:
+
+	.dbg	line,	"tests/990604-1.c", 7; b = i;
+	__ld.wm		__f_end - 2  /* i */
+	__st.wmq	_b
+
+	.dbg	line,	"tests/990604-1.c", 8; i++;
+	__inc.wmq	__f_end - 2  /* i */
+
+	.dbg	line,	"tests/990604-1.c", 9; } while (i < 10);
+.LL5:
+	__ld.wm		__f_end - 2  /* i */
+	__slt_w.wi	10
+	__btrue		.LL4
+.LL6:
+
+	.dbg	line,	"tests/990604-1.c", 10; }
+.LL3:
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/990604-1.c", 12; int main ()
+	.dbg	line,	"tests/990604-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/990604-1.c", 14; f ();
+	__st.wmiq	0, __f_end - 2  /* i */
+	__not.wm	_b
+	__bfalse	.LL11
+.LL8:
+	__ld.wm		__f_end - 2  /* i */
+	__st.wmq	_b
+	__inc.wmq	__f_end - 2  /* i */
+.LL9:
+	__ld.wm		__f_end - 2  /* i */
+	__slt_w.wi	10
+	__btrue		.LL8
+.LL10:
+.LL11:
+.LL12:
+
+	.dbg	line,	"tests/990604-1.c", 15; if (b != 9)
+	__ld.wm		_b
+	__neq_w.wi	9
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/990604-1.c", 16; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/990604-1.c", 17; return 0;
+.LL13:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/990604-1.c", 18; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        24     10     2  b
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_b, 2, 10, 24
+	.endm
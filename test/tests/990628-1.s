@@ -0,0 +1,127 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/990628-1.c", 1; #ifdef __HUCC__
+	.dbg	line,	"tests/990628-1.c", 3; // malloc() is not supported in HuCC at this time.
+	.dbg	line,	"tests/990628-1.c", 4; main()
+	.dbg	line,	"tests/990628-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/990628-1.c", 6; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/990628-1.c", 7; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/990628-1.c", 9; #else
+	.dbg	line,	"tests/990628-1.c", 11; #include <stdlib.h>
+	.dbg	line,	"tests/990628-1.c", 13; struct sqlca_s {
+	.dbg	line,	"tests/990628-1.c", 14; int sqlcode;
+	.dbg	line,	"tests/990628-1.c", 15; }; struct sqlca_s sqlca;
+	.dbg	line,	"tests/990628-1.c", 18; struct data_record {
+	.dbg	line,	"tests/990628-1.c", 19; int dummy;
+	.dbg	line,	"tests/990628-1.c", 20; int a[100];
+	.dbg	line,	"tests/990628-1.c", 21; } *data_ptr, data_tmp;
+	.dbg	line,	"tests/990628-1.c", 24; int
+	.dbg	line,	"tests/990628-1.c", 25; num_records()
+	.dbg	line,	"tests/990628-1.c", 26; {
+	.dbg	line,	"tests/990628-1.c", 27; return 1;
+	.dbg	line,	"tests/990628-1.c", 28; }
+	.dbg	line,	"tests/990628-1.c", 31; void
+	.dbg	line,	"tests/990628-1.c", 32; fetch()
+	.dbg	line,	"tests/990628-1.c", 33; {
+	.dbg	line,	"tests/990628-1.c", 34; static int fetch_count;
+	.dbg	line,	"tests/990628-1.c", 36; memset(&data_tmp, 0x55, sizeof(data_tmp));
+	.dbg	line,	"tests/990628-1.c", 37; sqlca.sqlcode = (++fetch_count > 1 ? 100 : 0);
+	.dbg	line,	"tests/990628-1.c", 38; }
+	.dbg	line,	"tests/990628-1.c", 41; void
+	.dbg	line,	"tests/990628-1.c", 42; load_data() {
+	.dbg	line,	"tests/990628-1.c", 43; struct data_record *p;
+	.dbg	line,	"tests/990628-1.c", 44; int num; num = num_records();
+	.dbg	line,	"tests/990628-1.c", 46; data_ptr = malloc(num * sizeof(struct data_record));
+	.dbg	line,	"tests/990628-1.c", 47; memset(data_ptr, 0xaa, num * sizeof(struct data_record));
+	.dbg	line,	"tests/990628-1.c", 49; fetch();
+	.dbg	line,	"tests/990628-1.c", 50; p = data_ptr;
+	.dbg	line,	"tests/990628-1.c", 51; while (sqlca.sqlcode == 0) {
+	.dbg	line,	"tests/990628-1.c", 52; *p++ = data_tmp;
+	.dbg	line,	"tests/990628-1.c", 53; fetch();
+	.dbg	line,	"tests/990628-1.c", 54; }
+	.dbg	line,	"tests/990628-1.c", 55; }
+	.dbg	line,	"tests/990628-1.c", 58; main()
+	.dbg	line,	"tests/990628-1.c", 59; {
+	.dbg	line,	"tests/990628-1.c", 60; load_data();
+	.dbg	line,	"tests/990628-1.c", 61; if (sizeof (int) == 2 && data_ptr[0].dummy != 0x5555)
+	.dbg	line,	"tests/990628-1.c", 62; abort ();
+	.dbg	line,	"tests/990628-1.c", 63; #ifdef nil
+	.dbg	line,	"tests/990628-1.c", 64; else if (sizeof (int) > 2 && data_ptr[0].dummy != 0x55555555)
+	.dbg	line,	"tests/990628-1.c", 65; abort ();
+	.dbg	line,	"tests/990628-1.c", 66; #endif
+	.dbg	line,	"tests/990628-1.c", 67; exit (0);
+	.dbg	line,	"tests/990628-1.c", 68; }
+	.dbg	line,	"tests/990628-1.c", 70; #endif // __HUCC__
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,177 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/990804-1.c", 1; int gfbyte ( void ) 
+	.dbg	line,	"tests/990804-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_gfbyte
+	__enter		_gfbyte
+
+	.dbg	line,	"tests/990804-1.c", 3; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/990804-1.c", 4; } 
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/990804-1.c", 6; int main( void ) 
+	.dbg	line,	"tests/990804-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/990804-1.c", 8; int i,j,k ;
+
+	.dbg	line,	"tests/990804-1.c", 10; i = gfbyte();
+	__ld.wi		0
+.LL4:
+	__st.wmq	__main_end - 2  /* i */
+
+	.dbg	line,	"tests/990804-1.c", 12; i = i + 1 ;
+	__add.wi	1
+	__st.wmq	__main_end - 2  /* i */
+
+	.dbg	line,	"tests/990804-1.c", 14; if ( i == 0 ) 
+	__not.wm	__main_end - 2  /* i */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/990804-1.c", 15; k = -0 ;
+	__st.wmiq	0, __main_end - 6  /* k */
+
+	.dbg	line,	"tests/990804-1.c", 16; else
+	__bra		.LL6
+.LL5:
+
+	.dbg	line,	"tests/990804-1.c", 17; k = i + 0 ;
+	__ld.wm		__main_end - 2  /* i */
+	__st.wmq	__main_end - 6  /* k */
+.LL6:
+
+	.dbg	line,	"tests/990804-1.c", 19; if (i != 1)
+	__ld.wm		__main_end - 2  /* i */
+	__neq_w.wi	1
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/990804-1.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/990804-1.c", 22; k = 1 ;
+.LL7:
+	__st.wmiq	1, __main_end - 6  /* k */
+
+	.dbg	line,	"tests/990804-1.c", 23; if ( k <= i)
+	__ld.wm		__main_end - 6  /* k */
+	__sle_w.wm	__main_end - 2  /* i */
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/990804-1.c", 24; do 
+.LL9:
+
+	.dbg	line,	"tests/990804-1.c", 25; j = gfbyte () ;
+	__ld.wi		0
+.LL12:
+
+	.dbg	line,	"tests/990804-1.c", 26; while ( k++ < i ) ;
+.LL10:
+	__ldinc.wm	__main_end - 6  /* k */
+	__slt_w.wm	__main_end - 2  /* i */
+	__btrue		.LL9
+.LL11:
+
+	.dbg	line,	"tests/990804-1.c", 28; exit (0);
+.LL8:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/990804-1.c", 29; } 
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _main
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        70     28     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 28, 70
+__main_end	=	__overlay_frames + 6
+	.endm
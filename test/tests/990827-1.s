@@ -0,0 +1,197 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/990827-1.c", 1; unsigned test(unsigned one , unsigned  bit)
+	.dbg	line,	"tests/990827-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/990827-1.c", 3; unsigned val, zero;
+
+	.dbg	line,	"tests/990827-1.c", 4; /*unsigned*/ val=  bit & 1;
+	__ld.ws		0  /* bit */
+	__and.wi	1
+	__st.wmq	__test_end - 2  /* val */
+
+	.dbg	line,	"tests/990827-1.c", 5; /*unsigned*/ zero= one >> 1;
+	__ld.ws		2  /* one */
+	__lsr.wi	1
+	__st.wmq	__test_end - 4  /* zero */
+
+	.dbg	line,	"tests/990827-1.c", 7; val++;
+	__inc.wmq	__test_end - 2  /* val */
+
+	.dbg	line,	"tests/990827-1.c", 8; return zero + ( val>> 1 );
+	__ld.wm		__test_end - 2  /* val */
+	__lsr.wi	1
+	__add.wm	__test_end - 4  /* zero */
+.LL2:
+
+	.dbg	line,	"tests/990827-1.c", 9; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__test_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/990827-1.c", 11; int main()
+	.dbg	line,	"tests/990827-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/990827-1.c", 13; if (test (1,0) != 0)
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* bit */
+	__and.wi	1
+	__st.wmq	__test_end - 2  /* val */
+	__ld.ws		2  /* one */
+	__lsr.wi	1
+	__st.wmq	__test_end - 4  /* zero */
+	__inc.wmq	__test_end - 2  /* val */
+	__ld.wm		__test_end - 2  /* val */
+	__lsr.wi	1
+	__add.wm	__test_end - 4  /* zero */
+.LL5:
+	__modsp		4
+	__tst.wr
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/990827-1.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/990827-1.c", 15; if (test (1,1) != 1)
+.LL4:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* bit */
+	__and.wi	1
+	__st.wmq	__test_end - 2  /* val */
+	__ld.ws		2  /* one */
+	__lsr.wi	1
+	__st.wmq	__test_end - 4  /* zero */
+	__inc.wmq	__test_end - 2  /* val */
+	__ld.wm		__test_end - 2  /* val */
+	__lsr.wi	1
+	__add.wm	__test_end - 4  /* zero */
+.LL7:
+	__modsp		4
+	__neq_w.wi	1
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/990827-1.c", 16; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/990827-1.c", 17; if (test (1,65535) != 1)
+.LL6:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		65535
+	__pusharg.wr
+	__ld.ws		0  /* bit */
+	__and.wi	1
+	__st.wmq	__test_end - 2  /* val */
+	__ld.ws		2  /* one */
+	__lsr.wi	1
+	__st.wmq	__test_end - 4  /* zero */
+	__inc.wmq	__test_end - 2  /* val */
+	__ld.wm		__test_end - 2  /* val */
+	__lsr.wi	1
+	__add.wm	__test_end - 4  /* zero */
+.LL9:
+	__modsp		4
+	__neq_w.wi	1
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/990827-1.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/990827-1.c", 19; exit (0);
+.LL8:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/990827-1.c", 21; return 0;
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/990827-1.c", 22; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,186 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/991023-1.c", 3; int blah;
+	.dbg	line,	"tests/991023-1.c", 4; foo()
+	.dbg	line,	"tests/991023-1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/991023-1.c", 6; int i;
+
+	.dbg	line,	"tests/991023-1.c", 8; for (i=0 ; i< 7 ; i++)
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL3:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.wi	7
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/991023-1.c", 9; {
+
+	.dbg	line,	"tests/991023-1.c", 10; if (i == 7 - 1)
+	__ld.wm		__foo_end - 2  /* i */
+	__equ_w.wi	6
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/991023-1.c", 11; blah = 0xfcc;
+	__st.wmiq	4044, _blah
+
+	.dbg	line,	"tests/991023-1.c", 12; else
+	__bra		.LL8
+.LL7:
+
+	.dbg	line,	"tests/991023-1.c", 13; blah = 0xfee;
+	__st.wmiq	4078, _blah
+.LL8	.alias		.LL4
+
+	.dbg	line,	"tests/991023-1.c", 14; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/991023-1.c", 15; return blah;
+	__ld.wm		_blah
+.LL2:
+
+	.dbg	line,	"tests/991023-1.c", 16; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/991023-1.c", 19; main()
+	.dbg	line,	"tests/991023-1.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/991023-1.c", 21; if (foo () != 0xfcc)
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL11:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.wi	7
+	__btrue		.LL13
+	__bra		.LL16
+.LL12:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL11
+.LL13:
+	__ld.wm		__foo_end - 2  /* i */
+	__equ_w.wi	6
+	__bfalse	.LL14
+	__st.wmiq	4044, _blah
+	__bra		.LL15
+.LL14:
+	__st.wmiq	4078, _blah
+.LL15	.alias		.LL12
+	__bra		.LL12
+.LL16:
+	__ld.wm		_blah
+.LL17:
+	__neq_w.wi	4044
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/991023-1.c", 22; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/991023-1.c", 23; exit (0);
+.LL10:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/991023-1.c", 24; }
+.LL9:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        40     12     2  blah
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_blah, 2, 12, 40
+	.endm
@@ -0,0 +1,170 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/991202-3.c", 2; unsigned int f (unsigned int a)
+	.dbg	line,	"tests/991202-3.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/991202-3.c", 4; return a * 65536 / 8;
+	__ld.ws		0  /* a */
+	__asl.wi	16
+	__lsr.wi	3
+.LL2:
+
+	.dbg	line,	"tests/991202-3.c", 5; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/991202-3.c", 7; unsigned int g (unsigned int a)
+	.dbg	line,	"tests/991202-3.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/991202-3.c", 9; return a * 65536;
+	__ld.ws		0  /* a */
+	__asl.wi	16
+.LL3:
+
+	.dbg	line,	"tests/991202-3.c", 10; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/991202-3.c", 12; unsigned int h (unsigned int a)
+	.dbg	line,	"tests/991202-3.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_h
+	__enter		_h
+
+	.dbg	line,	"tests/991202-3.c", 14; return a / 8;
+	__ld.ws		0  /* a */
+	__lsr.wi	3
+.LL4:
+
+	.dbg	line,	"tests/991202-3.c", 15; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/991202-3.c", 17; int main ()
+	.dbg	line,	"tests/991202-3.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/991202-3.c", 19; if (f (65536) != h (g (65536)))
+	__ld.wi		65536
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__asl.wi	16
+	__lsr.wi	3
+.LL7:
+	__modsp		2
+	__push.wr
+	__ld.wi		65536
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__asl.wi	16
+.LL8:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__lsr.wi	3
+.LL9:
+	__modsp		2
+	__neq_w.wt
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/991202-3.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/991202-3.c", 21; exit (0);
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/991202-3.c", 22; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,161 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/991216-4.c", 1; /* Test against a problem with loop reversal.  */
+	.dbg	line,	"tests/991216-4.c", 2; static void bug(int size, int tries)
+	.dbg	line,	"tests/991216-4.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bug
+	__enter		_bug
+
+	.dbg	line,	"tests/991216-4.c", 4; int i;
+
+	.dbg	line,	"tests/991216-4.c", 5; int num = 0;
+	__st.wmiq	0, __bug_end - 4  /* num */
+
+	.dbg	line,	"tests/991216-4.c", 6; while (num < size)
+.LL3:
+	__ld.wm		__bug_end - 4  /* num */
+	__slt_w.ws	2  /* size */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/991216-4.c", 7; {
+
+	.dbg	line,	"tests/991216-4.c", 8; for (i = 1; i < tries; i++) num++;
+	__st.wmiq	1, __bug_end - 2  /* i */
+.LL5:
+	__ld.wm		__bug_end - 2  /* i */
+	__slt_w.ws	0  /* tries */
+	__btrue		.LL7
+	__bra		.LL8
+.LL6:
+	__inc.wmq	__bug_end - 2  /* i */
+	__bra		.LL5
+.LL7:
+	__inc.wmq	__bug_end - 4  /* num */
+	__bra		.LL6
+.LL8	.alias		.LL3
+
+	.dbg	line,	"tests/991216-4.c", 9; }
+.LL4:
+
+	.dbg	line,	"tests/991216-4.c", 10; }
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__bug_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/991216-4.c", 12; int main()
+	.dbg	line,	"tests/991216-4.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/991216-4.c", 14; bug(5, 10);
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		10
+	__pusharg.wr
+	__st.wmiq	0, __bug_end - 4  /* num */
+.LL10:
+	__ld.wm		__bug_end - 4  /* num */
+	__slt_w.ws	2  /* size */
+	__bfalse	.LL15
+	__st.wmiq	1, __bug_end - 2  /* i */
+.LL11:
+	__ld.wm		__bug_end - 2  /* i */
+	__slt_w.ws	0  /* tries */
+	__btrue		.LL13
+	__bra		.LL14
+.LL12:
+	__inc.wmq	__bug_end - 2  /* i */
+	__bra		.LL11
+.LL13:
+	__inc.wmq	__bug_end - 4  /* num */
+	__bra		.LL12
+.LL14	.alias		.LL10
+.LL15:
+.LL16:
+	__modsp		4
+
+	.dbg	line,	"tests/991216-4.c", 15; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/991216-4.c", 16; }
+.LL9:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
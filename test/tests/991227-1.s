@@ -0,0 +1,162 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/991227-1.c", 1; char* doit(int flag)
+	.dbg	line,	"tests/991227-1.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_doit
+	__enter		_doit
+
+	.dbg	line,	"tests/991227-1.c", 3; return 1 + (flag ? "\0wrong\n" : "\0right\n");
+	__tst.ws	0  /* flag */
+	__bfalse	.LL3
+	__ld.wi		__const1+0
+	__bra		.LL4
+.LL3:
+	__ld.wi		__const1+8
+.LL4:
+	__add.wi	1
+.LL2:
+
+	.dbg	line,	"tests/991227-1.c", 4; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/991227-1.c", 5; int main()
+	.dbg	line,	"tests/991227-1.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/991227-1.c", 7; char *result; result = doit(0);
+	__ld.wi		0
+	__pusharg.wr
+	__tst.ws	0  /* flag */
+	__bfalse	.LL6
+	__ld.wi		__const1+0
+	__bra		.LL7
+.LL6:
+	__ld.wi		__const1+8
+.LL7:
+	__add.wi	1
+.LL8:
+	__modsp		2
+	__st.wmq	__main_end - 2  /* result */
+
+	.dbg	line,	"tests/991227-1.c", 8; if (*result == 'r' && result[1] == 'i')
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	114
+	__bfalse	.LL10
+	__ld.wm		__main_end - 2  /* result */
+	__add.wi	1
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	105
+.LL10:
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/991227-1.c", 9; exit(0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/991227-1.c", 10; abort();
+.LL9:
+	__call		_abort
+
+	.dbg	line,	"tests/991227-1.c", 11; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	$00,'w','r','o','n','g',$0A,$00
+		db	$00,'r','i','g','h','t',$0A,$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:16
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 6
+__main_end	=	__overlay_frames + 2
+	.endm
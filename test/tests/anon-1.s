@@ -0,0 +1,125 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/anon-1.c", 1; /* Copyright (C) 2001 Free Software Foundation, Inc.  */
+	.dbg	line,	"tests/anon-1.c", 3; /* Source: Neil Booth, 4 Nov 2001, derived from PR 2820 - field lookup in
+	.dbg	line,	"tests/anon-1.c", 4; nested anonymous entities was broken.  */
+	.dbg	line,	"tests/anon-1.c", 6; struct foot
+	.dbg	line,	"tests/anon-1.c", 7; {
+	.dbg	line,	"tests/anon-1.c", 8; int x;
+	.dbg	line,	"tests/anon-1.c", 9; struct yyt
+	.dbg	line,	"tests/anon-1.c", 10; {
+	.dbg	line,	"tests/anon-1.c", 11; int a;
+	.dbg	line,	"tests/anon-1.c", 12; union zzt
+	.dbg	line,	"tests/anon-1.c", 13; {
+	.dbg	line,	"tests/anon-1.c", 14; int b;
+	.dbg	line,	"tests/anon-1.c", 15; }; union zzt zz;
+	.dbg	line,	"tests/anon-1.c", 16; }; struct yyt yy;
+	.dbg	line,	"tests/anon-1.c", 17; }; struct foot foo;
+	.dbg	line,	"tests/anon-1.c", 19; int
+	.dbg	line,	"tests/anon-1.c", 20; main(int argc, char *argv[])
+	.dbg	line,	"tests/anon-1.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/anon-1.c", 22; foo.yy.zz.b = 6;
+	__st.wmiq	6, _foo + 2 + 2
+
+	.dbg	line,	"tests/anon-1.c", 23; foo.yy.a = 5;
+	__st.wmiq	5, _foo + 2
+
+	.dbg	line,	"tests/anon-1.c", 25; if (foo.yy.zz.b != 6)
+	__ld.wm		_foo + 2 + 2
+	__neq_w.wi	6
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/anon-1.c", 26; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/anon-1.c", 28; return 0;
+.LL3:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/anon-1.c", 29; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     6  foo
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_foo, 6, 6, 6
+	.endm
@@ -0,0 +1,902 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/compare-1.c", 1; /* Copyright (C) 2002 Free Software Foundation.
+	.dbg	line,	"tests/compare-1.c", 3; Test for correctness of composite comparisons.
+	.dbg	line,	"tests/compare-1.c", 5; Written by Roger Sayle, 3rd June 2002.  */
+	.dbg	line,	"tests/compare-1.c", 7; extern void abort (void);
+	.dbg	line,	"tests/compare-1.c", 9; int ieq (int x, int y, int ok)
+	.dbg	line,	"tests/compare-1.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ieq
+	__enter		_ieq
+
+	.dbg	line,	"tests/compare-1.c", 11; if ((x<=y) && (x>=y))
+	__ld.ws		4  /* x */
+	__sle_w.ws	2  /* y */
+	__bfalse	.LL4
+	__ld.ws		4  /* x */
+	__sge_w.ws	2  /* y */
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/compare-1.c", 12; {
+
+	.dbg	line,	"tests/compare-1.c", 13; if (!ok) abort ();
+	__not.ws	0
+	__bfalse	.LL5
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 14; }
+.LL5	.alias		.LL6
+
+	.dbg	line,	"tests/compare-1.c", 15; else
+	__bra		.LL6
+.LL3:
+
+	.dbg	line,	"tests/compare-1.c", 16; if (ok) abort ();
+	__tst.ws	0  /* ok */
+	__bfalse	.LL7
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 18; if ((x<=y) && (x==y))
+.LL7:
+.LL6:
+	__ld.ws		4  /* x */
+	__sle_w.ws	2  /* y */
+	__bfalse	.LL9
+	__ld.ws		4  /* x */
+	__equ_w.ws	2  /* y */
+.LL9:
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/compare-1.c", 19; {
+
+	.dbg	line,	"tests/compare-1.c", 20; if (!ok) abort ();
+	__not.ws	0
+	__bfalse	.LL10
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 21; }
+.LL10	.alias		.LL11
+
+	.dbg	line,	"tests/compare-1.c", 22; else
+	__bra		.LL11
+.LL8:
+
+	.dbg	line,	"tests/compare-1.c", 23; if (ok) abort ();
+	__tst.ws	0  /* ok */
+	__bfalse	.LL12
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 25; if ((x<=y) && (y<=x))
+.LL12:
+.LL11:
+	__ld.ws		4  /* x */
+	__sle_w.ws	2  /* y */
+	__bfalse	.LL14
+	__ld.ws		2  /* y */
+	__sle_w.ws	4  /* x */
+.LL14:
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/compare-1.c", 26; {
+
+	.dbg	line,	"tests/compare-1.c", 27; if (!ok) abort ();
+	__not.ws	0
+	__bfalse	.LL15
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 28; }
+.LL15	.alias		.LL16
+
+	.dbg	line,	"tests/compare-1.c", 29; else
+	__bra		.LL16
+.LL13:
+
+	.dbg	line,	"tests/compare-1.c", 30; if (ok) abort ();
+	__tst.ws	0  /* ok */
+	__bfalse	.LL17
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 32; if ((y==x) && (x<=y))
+.LL17:
+.LL16:
+	__ld.ws		2  /* y */
+	__equ_w.ws	4  /* x */
+	__bfalse	.LL19
+	__ld.ws		4  /* x */
+	__sle_w.ws	2  /* y */
+.LL19:
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/compare-1.c", 33; {
+
+	.dbg	line,	"tests/compare-1.c", 34; if (!ok) abort ();
+	__not.ws	0
+	__bfalse	.LL20
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 35; }
+.LL20	.alias		.LL21
+
+	.dbg	line,	"tests/compare-1.c", 36; else
+	__bra		.LL21
+.LL18:
+
+	.dbg	line,	"tests/compare-1.c", 37; if (ok) abort ();
+	__tst.ws	0  /* ok */
+	__bfalse	.LL22
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 38; }
+.LL22:
+.LL21:
+.LL2:
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-1.c", 40; int ine (int x, int y, int ok)
+	.dbg	line,	"tests/compare-1.c", 41; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ine
+	__enter		_ine
+
+	.dbg	line,	"tests/compare-1.c", 42; if ((x<y) || (x>y))
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__btrue		.LL25
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+.LL25:
+	__bfalse	.LL24
+
+	.dbg	line,	"tests/compare-1.c", 43; {
+
+	.dbg	line,	"tests/compare-1.c", 44; if (!ok) abort ();
+	__not.ws	0
+	__bfalse	.LL26
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 45; }
+.LL26	.alias		.LL27
+
+	.dbg	line,	"tests/compare-1.c", 46; else
+	__bra		.LL27
+.LL24:
+
+	.dbg	line,	"tests/compare-1.c", 47; if (ok) abort ();
+	__tst.ws	0  /* ok */
+	__bfalse	.LL28
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 48; }
+.LL28:
+.LL27:
+.LL23:
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-1.c", 50; int ilt (int x, int y, int ok)
+	.dbg	line,	"tests/compare-1.c", 51; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ilt
+	__enter		_ilt
+
+	.dbg	line,	"tests/compare-1.c", 52; if ((x<y) && (x!=y))
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__bfalse	.LL31
+	__ld.ws		4  /* x */
+	__neq_w.ws	2  /* y */
+.LL31:
+	__bfalse	.LL30
+
+	.dbg	line,	"tests/compare-1.c", 53; {
+
+	.dbg	line,	"tests/compare-1.c", 54; if (!ok) abort ();
+	__not.ws	0
+	__bfalse	.LL32
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 55; }
+.LL32	.alias		.LL33
+
+	.dbg	line,	"tests/compare-1.c", 56; else
+	__bra		.LL33
+.LL30:
+
+	.dbg	line,	"tests/compare-1.c", 57; if (ok) abort ();
+	__tst.ws	0  /* ok */
+	__bfalse	.LL34
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 58; }
+.LL34:
+.LL33:
+.LL29:
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-1.c", 60; int ile (int x, int y, int ok)
+	.dbg	line,	"tests/compare-1.c", 61; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ile
+	__enter		_ile
+
+	.dbg	line,	"tests/compare-1.c", 62; if ((x<y) || (x==y))
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__btrue		.LL37
+	__ld.ws		4  /* x */
+	__equ_w.ws	2  /* y */
+.LL37:
+	__bfalse	.LL36
+
+	.dbg	line,	"tests/compare-1.c", 63; {
+
+	.dbg	line,	"tests/compare-1.c", 64; if (!ok) abort ();
+	__not.ws	0
+	__bfalse	.LL38
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 65; }
+.LL38	.alias		.LL39
+
+	.dbg	line,	"tests/compare-1.c", 66; else
+	__bra		.LL39
+.LL36:
+
+	.dbg	line,	"tests/compare-1.c", 67; if (ok) abort ();
+	__tst.ws	0  /* ok */
+	__bfalse	.LL40
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 68; }
+.LL40:
+.LL39:
+.LL35:
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-1.c", 70; int igt (int x, int y, int ok)
+	.dbg	line,	"tests/compare-1.c", 71; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_igt
+	__enter		_igt
+
+	.dbg	line,	"tests/compare-1.c", 72; if ((x>y) && (x!=y))
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+	__bfalse	.LL43
+	__ld.ws		4  /* x */
+	__neq_w.ws	2  /* y */
+.LL43:
+	__bfalse	.LL42
+
+	.dbg	line,	"tests/compare-1.c", 73; {
+
+	.dbg	line,	"tests/compare-1.c", 74; if (!ok) abort ();
+	__not.ws	0
+	__bfalse	.LL44
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 75; }
+.LL44	.alias		.LL45
+
+	.dbg	line,	"tests/compare-1.c", 76; else
+	__bra		.LL45
+.LL42:
+
+	.dbg	line,	"tests/compare-1.c", 77; if (ok) abort ();
+	__tst.ws	0  /* ok */
+	__bfalse	.LL46
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 78; }
+.LL46:
+.LL45:
+.LL41:
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-1.c", 80; int ige (int x, int y, int ok)
+	.dbg	line,	"tests/compare-1.c", 81; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ige
+	__enter		_ige
+
+	.dbg	line,	"tests/compare-1.c", 82; if ((x>y) || (x==y))
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+	__btrue		.LL49
+	__ld.ws		4  /* x */
+	__equ_w.ws	2  /* y */
+.LL49:
+	__bfalse	.LL48
+
+	.dbg	line,	"tests/compare-1.c", 83; {
+
+	.dbg	line,	"tests/compare-1.c", 84; if (!ok) abort ();
+	__not.ws	0
+	__bfalse	.LL50
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 85; }
+.LL50	.alias		.LL51
+
+	.dbg	line,	"tests/compare-1.c", 86; else
+	__bra		.LL51
+.LL48:
+
+	.dbg	line,	"tests/compare-1.c", 87; if (ok) abort ();
+	__tst.ws	0  /* ok */
+	__bfalse	.LL52
+	__call		_abort
+
+	.dbg	line,	"tests/compare-1.c", 88; }
+.LL52:
+.LL51:
+.LL47:
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-1.c", 90; int
+	.dbg	line,	"tests/compare-1.c", 91; main ()
+	.dbg	line,	"tests/compare-1.c", 92; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/compare-1.c", 93; ieq (1, 4, 0);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_ieq
+
+	.dbg	line,	"tests/compare-1.c", 94; ieq (3, 3, 1);
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__call		_ieq
+
+	.dbg	line,	"tests/compare-1.c", 95; ieq (5, 2, 0);
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_ieq
+
+	.dbg	line,	"tests/compare-1.c", 97; ine (1, 4, 1);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__btrue		.LL54
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+.LL54:
+	__bfalse	.LL56
+	__not.ws	0
+	__bfalse	.LL55
+	__call		_abort
+.LL55	.alias		.LL58
+	__bra		.LL58
+.LL56:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL57
+	__call		_abort
+.LL57:
+.LL58:
+.LL59:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 98; ine (3, 3, 0);
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__btrue		.LL60
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+.LL60:
+	__bfalse	.LL62
+	__not.ws	0
+	__bfalse	.LL61
+	__call		_abort
+.LL61	.alias		.LL64
+	__bra		.LL64
+.LL62:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL63
+	__call		_abort
+.LL63:
+.LL64:
+.LL65:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 99; ine (5, 2, 1);
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__btrue		.LL66
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+.LL66:
+	__bfalse	.LL68
+	__not.ws	0
+	__bfalse	.LL67
+	__call		_abort
+.LL67	.alias		.LL70
+	__bra		.LL70
+.LL68:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL69
+	__call		_abort
+.LL69:
+.LL70:
+.LL71:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 101; ilt (1, 4, 1);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__bfalse	.LL72
+	__ld.ws		4  /* x */
+	__neq_w.ws	2  /* y */
+.LL72:
+	__bfalse	.LL74
+	__not.ws	0
+	__bfalse	.LL73
+	__call		_abort
+.LL73	.alias		.LL76
+	__bra		.LL76
+.LL74:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL75
+	__call		_abort
+.LL75:
+.LL76:
+.LL77:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 102; ilt (3, 3, 0);
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__bfalse	.LL78
+	__ld.ws		4  /* x */
+	__neq_w.ws	2  /* y */
+.LL78:
+	__bfalse	.LL80
+	__not.ws	0
+	__bfalse	.LL79
+	__call		_abort
+.LL79	.alias		.LL82
+	__bra		.LL82
+.LL80:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL81
+	__call		_abort
+.LL81:
+.LL82:
+.LL83:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 103; ilt (5, 2, 0);
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__bfalse	.LL84
+	__ld.ws		4  /* x */
+	__neq_w.ws	2  /* y */
+.LL84:
+	__bfalse	.LL86
+	__not.ws	0
+	__bfalse	.LL85
+	__call		_abort
+.LL85	.alias		.LL88
+	__bra		.LL88
+.LL86:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL87
+	__call		_abort
+.LL87:
+.LL88:
+.LL89:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 105; ile (1, 4, 1);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__btrue		.LL90
+	__ld.ws		4  /* x */
+	__equ_w.ws	2  /* y */
+.LL90:
+	__bfalse	.LL92
+	__not.ws	0
+	__bfalse	.LL91
+	__call		_abort
+.LL91	.alias		.LL94
+	__bra		.LL94
+.LL92:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL93
+	__call		_abort
+.LL93:
+.LL94:
+.LL95:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 106; ile (3, 3, 1);
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__btrue		.LL96
+	__ld.ws		4  /* x */
+	__equ_w.ws	2  /* y */
+.LL96:
+	__bfalse	.LL98
+	__not.ws	0
+	__bfalse	.LL97
+	__call		_abort
+.LL97	.alias		.LL100
+	__bra		.LL100
+.LL98:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL99
+	__call		_abort
+.LL99:
+.LL100:
+.LL101:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 107; ile (5, 2, 0);
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__slt_w.ws	2  /* y */
+	__btrue		.LL102
+	__ld.ws		4  /* x */
+	__equ_w.ws	2  /* y */
+.LL102:
+	__bfalse	.LL104
+	__not.ws	0
+	__bfalse	.LL103
+	__call		_abort
+.LL103	.alias		.LL106
+	__bra		.LL106
+.LL104:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL105
+	__call		_abort
+.LL105:
+.LL106:
+.LL107:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 109; igt (1, 4, 0);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+	__bfalse	.LL108
+	__ld.ws		4  /* x */
+	__neq_w.ws	2  /* y */
+.LL108:
+	__bfalse	.LL110
+	__not.ws	0
+	__bfalse	.LL109
+	__call		_abort
+.LL109	.alias		.LL112
+	__bra		.LL112
+.LL110:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL111
+	__call		_abort
+.LL111:
+.LL112:
+.LL113:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 110; igt (3, 3, 0);
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+	__bfalse	.LL114
+	__ld.ws		4  /* x */
+	__neq_w.ws	2  /* y */
+.LL114:
+	__bfalse	.LL116
+	__not.ws	0
+	__bfalse	.LL115
+	__call		_abort
+.LL115	.alias		.LL118
+	__bra		.LL118
+.LL116:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL117
+	__call		_abort
+.LL117:
+.LL118:
+.LL119:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 111; igt (5, 2, 1);
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+	__bfalse	.LL120
+	__ld.ws		4  /* x */
+	__neq_w.ws	2  /* y */
+.LL120:
+	__bfalse	.LL122
+	__not.ws	0
+	__bfalse	.LL121
+	__call		_abort
+.LL121	.alias		.LL124
+	__bra		.LL124
+.LL122:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL123
+	__call		_abort
+.LL123:
+.LL124:
+.LL125:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 113; ige (1, 4, 0);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+	__btrue		.LL126
+	__ld.ws		4  /* x */
+	__equ_w.ws	2  /* y */
+.LL126:
+	__bfalse	.LL128
+	__not.ws	0
+	__bfalse	.LL127
+	__call		_abort
+.LL127	.alias		.LL130
+	__bra		.LL130
+.LL128:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL129
+	__call		_abort
+.LL129:
+.LL130:
+.LL131:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 114; ige (3, 3, 1);
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+	__btrue		.LL132
+	__ld.ws		4  /* x */
+	__equ_w.ws	2  /* y */
+.LL132:
+	__bfalse	.LL134
+	__not.ws	0
+	__bfalse	.LL133
+	__call		_abort
+.LL133	.alias		.LL136
+	__bra		.LL136
+.LL134:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL135
+	__call		_abort
+.LL135:
+.LL136:
+.LL137:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 115; ige (5, 2, 1);
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		4  /* x */
+	__sgt_w.ws	2  /* y */
+	__btrue		.LL138
+	__ld.ws		4  /* x */
+	__equ_w.ws	2  /* y */
+.LL138:
+	__bfalse	.LL140
+	__not.ws	0
+	__bfalse	.LL139
+	__call		_abort
+.LL139	.alias		.LL142
+	__bra		.LL142
+.LL140:
+	__tst.ws	0  /* ok */
+	__bfalse	.LL141
+	__call		_abort
+.LL141:
+.LL142:
+.LL143:
+	__modsp		6
+
+	.dbg	line,	"tests/compare-1.c", 117; return 0;
+	__ld.wi		0
+.LL53:
+
+	.dbg	line,	"tests/compare-1.c", 118; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,134 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/compare-2.c", 1; /* Copyright (C) 2002 Free Software Foundation.
+	.dbg	line,	"tests/compare-2.c", 3; Ensure that the composite comparison optimization doesn't misfire
+	.dbg	line,	"tests/compare-2.c", 4; and attempt to combine a signed comparison with an unsigned one.
+	.dbg	line,	"tests/compare-2.c", 6; Written by Roger Sayle, 3rd June 2002.  */
+	.dbg	line,	"tests/compare-2.c", 8; extern void abort (void);
+	.dbg	line,	"tests/compare-2.c", 10; int
+	.dbg	line,	"tests/compare-2.c", 11; foo (int x, int y)
+	.dbg	line,	"tests/compare-2.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/compare-2.c", 13; /* If miscompiled the following may become "x == y".  */
+
+	.dbg	line,	"tests/compare-2.c", 14; return (x<=y) && ((unsigned int)x >= (unsigned int)y);
+	__ld.ws		2  /* x */
+	__sle_w.ws	0  /* y */
+	__bfalse	.LL3
+	__ld.ws		2  /* x */
+	__uge_w.ws	0  /* y */
+.LL3:
+.LL2:
+	__bool
+
+	.dbg	line,	"tests/compare-2.c", 15; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-2.c", 17; int
+	.dbg	line,	"tests/compare-2.c", 18; main ()
+	.dbg	line,	"tests/compare-2.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/compare-2.c", 20; if (! foo (-1,0))
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__sle_w.ws	0  /* y */
+	__bfalse	.LL6
+	__ld.ws		2  /* x */
+	__uge_w.ws	0  /* y */
+.LL6:
+.LL7:
+	__bool
+	__modsp		4
+	__not.wr
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/compare-2.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/compare-2.c", 22; return 0;
+.LL5:
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"tests/compare-2.c", 23; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
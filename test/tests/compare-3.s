@@ -0,0 +1,469 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/compare-3.c", 1; /* Copyright (C) 2002 Free Software Foundation.
+	.dbg	line,	"tests/compare-3.c", 3; Test for composite comparison always true/false optimization.
+	.dbg	line,	"tests/compare-3.c", 5; Written by Roger Sayle, 7th June 2002.  */
+	.dbg	line,	"tests/compare-3.c", 7; extern void link_error0 ();
+	.dbg	line,	"tests/compare-3.c", 8; extern void link_error1 ();
+	.dbg	line,	"tests/compare-3.c", 10; void
+	.dbg	line,	"tests/compare-3.c", 11; test1 (int x, int y)
+	.dbg	line,	"tests/compare-3.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"tests/compare-3.c", 13; if ((x==y) && (x!=y))
+	__ld.ws		2  /* x */
+	__equ_w.ws	0  /* y */
+	__bfalse	.LL4
+	__ld.ws		2  /* x */
+	__neq_w.ws	0  /* y */
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/compare-3.c", 14; link_error0();
+	__call		_link_error0
+
+	.dbg	line,	"tests/compare-3.c", 15; }
+.LL3:
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-3.c", 17; void
+	.dbg	line,	"tests/compare-3.c", 18; test2 (int x, int y)
+	.dbg	line,	"tests/compare-3.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"tests/compare-3.c", 20; if ((x<y) && (x>y))
+	__ld.ws		2  /* x */
+	__slt_w.ws	0  /* y */
+	__bfalse	.LL7
+	__ld.ws		2  /* x */
+	__sgt_w.ws	0  /* y */
+.LL7:
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/compare-3.c", 21; link_error0();
+	__call		_link_error0
+
+	.dbg	line,	"tests/compare-3.c", 22; }
+.LL6:
+.LL5:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-3.c", 24; void
+	.dbg	line,	"tests/compare-3.c", 25; test3 (int x, int y)
+	.dbg	line,	"tests/compare-3.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3
+	__enter		_test3
+
+	.dbg	line,	"tests/compare-3.c", 27; if ((x<y) && (y<x))
+	__ld.ws		2  /* x */
+	__slt_w.ws	0  /* y */
+	__bfalse	.LL10
+	__ld.ws		0  /* y */
+	__slt_w.ws	2  /* x */
+.LL10:
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/compare-3.c", 28; link_error0();
+	__call		_link_error0
+
+	.dbg	line,	"tests/compare-3.c", 29; }
+.LL9:
+.LL8:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-3.c", 31; void 
+	.dbg	line,	"tests/compare-3.c", 32; test4 (int x, int y)
+	.dbg	line,	"tests/compare-3.c", 33; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4
+	__enter		_test4
+
+	.dbg	line,	"tests/compare-3.c", 34; if ((x==y) || (x!=y))
+	__ld.ws		2  /* x */
+	__equ_w.ws	0  /* y */
+	__btrue		.LL13
+	__ld.ws		2  /* x */
+	__neq_w.ws	0  /* y */
+.LL13:
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/compare-3.c", 35; {
+
+	.dbg	line,	"tests/compare-3.c", 36; }
+
+	.dbg	line,	"tests/compare-3.c", 37; else
+	__bra		.LL14
+.LL12:
+
+	.dbg	line,	"tests/compare-3.c", 38; link_error1 ();
+	__call		_link_error1
+.LL14:
+
+	.dbg	line,	"tests/compare-3.c", 39; }
+.LL11:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-3.c", 41; void
+	.dbg	line,	"tests/compare-3.c", 42; test5 (int x, int y)
+	.dbg	line,	"tests/compare-3.c", 43; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5
+	__enter		_test5
+
+	.dbg	line,	"tests/compare-3.c", 44; if ((x>=y) || (x<y))
+	__ld.ws		2  /* x */
+	__sge_w.ws	0  /* y */
+	__btrue		.LL17
+	__ld.ws		2  /* x */
+	__slt_w.ws	0  /* y */
+.LL17:
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/compare-3.c", 45; {
+
+	.dbg	line,	"tests/compare-3.c", 46; }
+
+	.dbg	line,	"tests/compare-3.c", 47; else
+	__bra		.LL18
+.LL16:
+
+	.dbg	line,	"tests/compare-3.c", 48; link_error1 ();
+	__call		_link_error1
+.LL18:
+
+	.dbg	line,	"tests/compare-3.c", 49; }
+.LL15:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-3.c", 51; void
+	.dbg	line,	"tests/compare-3.c", 52; test6 (int x, int y)
+	.dbg	line,	"tests/compare-3.c", 53; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6
+	__enter		_test6
+
+	.dbg	line,	"tests/compare-3.c", 54; if ((x<=y) || (y<x))
+	__ld.ws		2  /* x */
+	__sle_w.ws	0  /* y */
+	__btrue		.LL21
+	__ld.ws		0  /* y */
+	__slt_w.ws	2  /* x */
+.LL21:
+	__bfalse	.LL20
+
+	.dbg	line,	"tests/compare-3.c", 55; {
+
+	.dbg	line,	"tests/compare-3.c", 56; }
+
+	.dbg	line,	"tests/compare-3.c", 57; else
+	__bra		.LL22
+.LL20:
+
+	.dbg	line,	"tests/compare-3.c", 58; link_error1 ();
+	__call		_link_error1
+.LL22:
+
+	.dbg	line,	"tests/compare-3.c", 59; }
+.LL19:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-3.c", 61; void
+	.dbg	line,	"tests/compare-3.c", 62; all_tests (int x, int y)
+	.dbg	line,	"tests/compare-3.c", 63; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_all_tests
+	__enter		_all_tests
+
+	.dbg	line,	"tests/compare-3.c", 64; test1 (x, y);
+	__ld.ws		2  /* x */
+	__pusharg.wr
+	__ld.ws		2  /* y */
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__equ_w.ws	0  /* y */
+	__bfalse	.LL24
+	__ld.ws		2  /* x */
+	__neq_w.ws	0  /* y */
+.LL24:
+	__bfalse	.LL25
+	__call		_link_error0
+.LL25:
+.LL26:
+	__modsp		4
+
+	.dbg	line,	"tests/compare-3.c", 65; test2 (x, y);
+	__ld.ws		2  /* x */
+	__pusharg.wr
+	__ld.ws		2  /* y */
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__slt_w.ws	0  /* y */
+	__bfalse	.LL27
+	__ld.ws		2  /* x */
+	__sgt_w.ws	0  /* y */
+.LL27:
+	__bfalse	.LL28
+	__call		_link_error0
+.LL28:
+.LL29:
+	__modsp		4
+
+	.dbg	line,	"tests/compare-3.c", 66; test3 (x, y);
+	__ld.ws		2  /* x */
+	__pusharg.wr
+	__ld.ws		2  /* y */
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__slt_w.ws	0  /* y */
+	__bfalse	.LL30
+	__ld.ws		0  /* y */
+	__slt_w.ws	2  /* x */
+.LL30:
+	__bfalse	.LL31
+	__call		_link_error0
+.LL31:
+.LL32:
+	__modsp		4
+
+	.dbg	line,	"tests/compare-3.c", 67; test4 (x, y);
+	__ld.ws		2  /* x */
+	__pusharg.wr
+	__ld.ws		2  /* y */
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__equ_w.ws	0  /* y */
+	__btrue		.LL33
+	__ld.ws		2  /* x */
+	__neq_w.ws	0  /* y */
+.LL33:
+	__bfalse	.LL34
+	__bra		.LL35
+.LL34:
+	__call		_link_error1
+.LL35:
+.LL36:
+	__modsp		4
+
+	.dbg	line,	"tests/compare-3.c", 68; test5 (x, y);
+	__ld.ws		2  /* x */
+	__pusharg.wr
+	__ld.ws		2  /* y */
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__sge_w.ws	0  /* y */
+	__btrue		.LL37
+	__ld.ws		2  /* x */
+	__slt_w.ws	0  /* y */
+.LL37:
+	__bfalse	.LL38
+	__bra		.LL39
+.LL38:
+	__call		_link_error1
+.LL39:
+.LL40:
+	__modsp		4
+
+	.dbg	line,	"tests/compare-3.c", 69; test6 (x, y);
+	__ld.ws		2  /* x */
+	__pusharg.wr
+	__ld.ws		2  /* y */
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__sle_w.ws	0  /* y */
+	__btrue		.LL41
+	__ld.ws		0  /* y */
+	__slt_w.ws	2  /* x */
+.LL41:
+	__bfalse	.LL42
+	__bra		.LL43
+.LL42:
+	__call		_link_error1
+.LL43:
+.LL44:
+	__modsp		4
+
+	.dbg	line,	"tests/compare-3.c", 70; }
+.LL23:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-3.c", 72; int
+	.dbg	line,	"tests/compare-3.c", 73; main ()
+	.dbg	line,	"tests/compare-3.c", 74; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/compare-3.c", 75; all_tests (0, 0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_all_tests
+
+	.dbg	line,	"tests/compare-3.c", 76; all_tests (1, 2);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_all_tests
+
+	.dbg	line,	"tests/compare-3.c", 77; all_tests (4, 3);
+	__ld.wi		4
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__call		_all_tests
+
+	.dbg	line,	"tests/compare-3.c", 79; return 0;
+	__ld.wi		0
+.LL45:
+
+	.dbg	line,	"tests/compare-3.c", 80; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-3.c", 82; #ifndef __OPTIMIZE__
+	.dbg	line,	"tests/compare-3.c", 83; void link_error0() {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_link_error0
+	__enter		_link_error0
+.LL46:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-3.c", 84; void link_error1() {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_link_error1
+	__enter		_link_error1
+.LL47:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/compare-3.c", 85; #endif /* ! __OPTIMIZE__ */
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:10
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,143 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/conv-3.c", 1; /* PR middle-end/19100 */
+	.dbg	line,	"tests/conv-3.c", 2; /* { dg-do run } */
+	.dbg	line,	"tests/conv-3.c", 3; /* { dg-options "-O2" } */
+	.dbg	line,	"tests/conv-3.c", 5; void abort (void);
+	.dbg	line,	"tests/conv-3.c", 7; int test (int v)
+	.dbg	line,	"tests/conv-3.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/conv-3.c", 9; return ((signed char) (v ? 0x100 : 0)) ? 17 : 18;
+	__tst.ws	0  /* v */
+	__bfalse	.LL3
+	__ld.wi		256
+	__bra		.LL4
+.LL3:
+	__ld.wi		0
+.LL4:
+	__ext.br
+	__tst.wr
+	__bfalse	.LL5
+	__ld.wi		17
+	__bra		.LL6
+.LL5:
+	__ld.wi		18
+.LL6	.alias		.LL2
+.LL2:
+
+	.dbg	line,	"tests/conv-3.c", 10; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/conv-3.c", 12; int main()
+	.dbg	line,	"tests/conv-3.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/conv-3.c", 14; if (test (2) != 18)
+	__ld.wi		2
+	__pusharg.wr
+	__tst.ws	0  /* v */
+	__bfalse	.LL9
+	__ld.wi		256
+	__bra		.LL10
+.LL9:
+	__ld.wi		0
+.LL10:
+	__ext.br
+	__tst.wr
+	__bfalse	.LL11
+	__ld.wi		17
+	__bra		.LL12
+.LL11:
+	__ld.wi		18
+.LL12	.alias		.LL13
+.LL13:
+	__modsp		2
+	__neq_w.wi	18
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/conv-3.c", 15; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/conv-3.c", 16; return 0;
+.LL8:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/conv-3.c", 17; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
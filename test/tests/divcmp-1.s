@@ -0,0 +1,2313 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/divcmp-1.c", 1; extern void abort(void);
+	.dbg	line,	"tests/divcmp-1.c", 3; int test1(int x)
+	.dbg	line,	"tests/divcmp-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"tests/divcmp-1.c", 5; return x/10 == 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	2
+.LL2:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 6; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 8; int test1u(unsigned int x)
+	.dbg	line,	"tests/divcmp-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1u
+	__enter		_test1u
+
+	.dbg	line,	"tests/divcmp-1.c", 10; return x/10/*U*/ == 2;
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__equ_w.wi	2
+.LL3:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 11; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 13; int test2(int x)
+	.dbg	line,	"tests/divcmp-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"tests/divcmp-1.c", 15; return x/10 == 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL4:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 16; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 18; int test2u(unsigned int x)
+	.dbg	line,	"tests/divcmp-1.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2u
+	__enter		_test2u
+
+	.dbg	line,	"tests/divcmp-1.c", 20; return x/10/*U*/ == 0;
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__not.wr
+.LL5:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 21; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 23; int test3(int x)
+	.dbg	line,	"tests/divcmp-1.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3
+	__enter		_test3
+
+	.dbg	line,	"tests/divcmp-1.c", 25; return x/10 != 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__neq_w.wi	2
+.LL6:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 26; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 28; int test3u(unsigned int x)
+	.dbg	line,	"tests/divcmp-1.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3u
+	__enter		_test3u
+
+	.dbg	line,	"tests/divcmp-1.c", 30; return x/10/*U*/ != 2;
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__neq_w.wi	2
+.LL7:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 31; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 33; int test4(int x)
+	.dbg	line,	"tests/divcmp-1.c", 34; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4
+	__enter		_test4
+
+	.dbg	line,	"tests/divcmp-1.c", 35; return x/10 != 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__tst.wr
+.LL8:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 36; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 38; int test4u(unsigned int x)
+	.dbg	line,	"tests/divcmp-1.c", 39; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4u
+	__enter		_test4u
+
+	.dbg	line,	"tests/divcmp-1.c", 40; return x/10/*U*/ != 0;
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__tst.wr
+.LL9:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 41; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 43; int test5(int x)
+	.dbg	line,	"tests/divcmp-1.c", 44; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5
+	__enter		_test5
+
+	.dbg	line,	"tests/divcmp-1.c", 45; return x/10 < 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	2
+.LL10:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 46; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 48; int test5u(unsigned int x)
+	.dbg	line,	"tests/divcmp-1.c", 49; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5u
+	__enter		_test5u
+
+	.dbg	line,	"tests/divcmp-1.c", 50; return x/10/*U*/ < 2;
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ult_w.wi	2
+.LL11:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 51; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 53; int test6(int x)
+	.dbg	line,	"tests/divcmp-1.c", 54; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6
+	__enter		_test6
+
+	.dbg	line,	"tests/divcmp-1.c", 55; return x/10 < 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	0
+.LL12:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 56; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 58; int test7(int x)
+	.dbg	line,	"tests/divcmp-1.c", 59; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test7
+	__enter		_test7
+
+	.dbg	line,	"tests/divcmp-1.c", 60; return x/10  <= 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	2
+.LL13:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 61; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 63; int test7u(unsigned int x)
+	.dbg	line,	"tests/divcmp-1.c", 64; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test7u
+	__enter		_test7u
+
+	.dbg	line,	"tests/divcmp-1.c", 65; return x/10/*U*/ <= 2;
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	2
+.LL14:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 66; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 68; int test8(int x)
+	.dbg	line,	"tests/divcmp-1.c", 69; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test8
+	__enter		_test8
+
+	.dbg	line,	"tests/divcmp-1.c", 70; return x/10 <= 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	0
+.LL15:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 71; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 73; int test8u(unsigned int x)
+	.dbg	line,	"tests/divcmp-1.c", 74; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test8u
+	__enter		_test8u
+
+	.dbg	line,	"tests/divcmp-1.c", 75; return x/10/*U*/ <= 0;
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	0
+.LL16:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 76; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 78; int test9(int x)
+	.dbg	line,	"tests/divcmp-1.c", 79; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test9
+	__enter		_test9
+
+	.dbg	line,	"tests/divcmp-1.c", 80; return x/10 > 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	2
+.LL17:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 81; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 83; int test9u(unsigned int x)
+	.dbg	line,	"tests/divcmp-1.c", 84; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test9u
+	__enter		_test9u
+
+	.dbg	line,	"tests/divcmp-1.c", 85; return x/10/*U*/ > 2;
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	2
+.LL18:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 86; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 88; int test10(int x)
+	.dbg	line,	"tests/divcmp-1.c", 89; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test10
+	__enter		_test10
+
+	.dbg	line,	"tests/divcmp-1.c", 90; return x/10 > 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	0
+.LL19:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 91; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 93; int test10u(unsigned int x)
+	.dbg	line,	"tests/divcmp-1.c", 94; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test10u
+	__enter		_test10u
+
+	.dbg	line,	"tests/divcmp-1.c", 95; return x/10/*U*/ > 0;
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	0
+.LL20:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 96; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 98; int test11(int x)
+	.dbg	line,	"tests/divcmp-1.c", 99; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test11
+	__enter		_test11
+
+	.dbg	line,	"tests/divcmp-1.c", 100; return x/10 >= 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	2
+.LL21:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 101; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 103; int test11u(unsigned int x)
+	.dbg	line,	"tests/divcmp-1.c", 104; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test11u
+	__enter		_test11u
+
+	.dbg	line,	"tests/divcmp-1.c", 105; return x/10/*U*/ >= 2;
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__uge_w.wi	2
+.LL22:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 106; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 108; int test12(int x)
+	.dbg	line,	"tests/divcmp-1.c", 109; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test12
+	__enter		_test12
+
+	.dbg	line,	"tests/divcmp-1.c", 110; return x/10 >= 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	0
+.LL23:
+	__bool
+
+	.dbg	line,	"tests/divcmp-1.c", 111; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-1.c", 114; int main()
+	.dbg	line,	"tests/divcmp-1.c", 115; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/divcmp-1.c", 116; if (test1(19) != 0)
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	2
+.LL26:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL25
+
+	.dbg	line,	"tests/divcmp-1.c", 117; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 118; if (test1(20) != 1)
+.LL25:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	2
+.LL28:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/divcmp-1.c", 119; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 120; if (test1(29) != 1)
+.LL27:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	2
+.LL30:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL29
+
+	.dbg	line,	"tests/divcmp-1.c", 121; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 122; if (test1(30) != 0)
+.LL29:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	2
+.LL32:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL31
+
+	.dbg	line,	"tests/divcmp-1.c", 123; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 125; if (test1u(19) != 0)
+.LL31:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__equ_w.wi	2
+.LL34:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL33
+
+	.dbg	line,	"tests/divcmp-1.c", 126; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 127; if (test1u(20) != 1)
+.LL33:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__equ_w.wi	2
+.LL36:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL35
+
+	.dbg	line,	"tests/divcmp-1.c", 128; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 129; if (test1u(29) != 1)
+.LL35:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__equ_w.wi	2
+.LL38:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL37
+
+	.dbg	line,	"tests/divcmp-1.c", 130; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 131; if (test1u(30) != 0)
+.LL37:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__equ_w.wi	2
+.LL40:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL39
+
+	.dbg	line,	"tests/divcmp-1.c", 132; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 134; if (test2(0) != 1)
+.LL39:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL42:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL41
+
+	.dbg	line,	"tests/divcmp-1.c", 135; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 136; if (test2(9) != 1)
+.LL41:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL44:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL43
+
+	.dbg	line,	"tests/divcmp-1.c", 137; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 138; if (test2(10) != 0)
+.LL43:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL46:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL45
+
+	.dbg	line,	"tests/divcmp-1.c", 139; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 140; if (test2(-1) != 1)
+.LL45:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL48:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL47
+
+	.dbg	line,	"tests/divcmp-1.c", 141; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 142; if (test2(-9) != 1)
+.LL47:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL50:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL49
+
+	.dbg	line,	"tests/divcmp-1.c", 143; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 144; if (test2(-10) != 0)
+.LL49:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL52:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL51
+
+	.dbg	line,	"tests/divcmp-1.c", 145; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 147; if (test2u(0) != 1)
+.LL51:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__not.wr
+.LL54:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL53
+
+	.dbg	line,	"tests/divcmp-1.c", 148; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 149; if (test2u(9) != 1)
+.LL53:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__not.wr
+.LL56:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL55
+
+	.dbg	line,	"tests/divcmp-1.c", 150; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 151; if (test2u(10) != 0)
+.LL55:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__not.wr
+.LL58:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL57
+
+	.dbg	line,	"tests/divcmp-1.c", 152; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 153; if (test2u(-1) != 0)
+.LL57:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__not.wr
+.LL60:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL59
+
+	.dbg	line,	"tests/divcmp-1.c", 154; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 155; if (test2u(-9) != 0)
+.LL59:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__not.wr
+.LL62:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL61
+
+	.dbg	line,	"tests/divcmp-1.c", 156; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 157; if (test2u(-10) != 0)
+.LL61:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__not.wr
+.LL64:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL63
+
+	.dbg	line,	"tests/divcmp-1.c", 158; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 160; if (test3(19) != 1)
+.LL63:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__neq_w.wi	2
+.LL66:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL65
+
+	.dbg	line,	"tests/divcmp-1.c", 161; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 162; if (test3(20) != 0)
+.LL65:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__neq_w.wi	2
+.LL68:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL67
+
+	.dbg	line,	"tests/divcmp-1.c", 163; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 164; if (test3(29) != 0)
+.LL67:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__neq_w.wi	2
+.LL70:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL69
+
+	.dbg	line,	"tests/divcmp-1.c", 165; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 166; if (test3(30) != 1)
+.LL69:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__neq_w.wi	2
+.LL72:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL71
+
+	.dbg	line,	"tests/divcmp-1.c", 167; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 169; if (test3u(19) != 1)
+.LL71:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__neq_w.wi	2
+.LL74:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL73
+
+	.dbg	line,	"tests/divcmp-1.c", 170; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 171; if (test3u(20) != 0)
+.LL73:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__neq_w.wi	2
+.LL76:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL75
+
+	.dbg	line,	"tests/divcmp-1.c", 172; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 173; if (test3u(29) != 0)
+.LL75:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__neq_w.wi	2
+.LL78:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL77
+
+	.dbg	line,	"tests/divcmp-1.c", 174; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 175; if (test3u(30) != 1)
+.LL77:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__neq_w.wi	2
+.LL80:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL79
+
+	.dbg	line,	"tests/divcmp-1.c", 176; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 178; if (test4(0) != 0)
+.LL79:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__tst.wr
+.LL82:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL81
+
+	.dbg	line,	"tests/divcmp-1.c", 179; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 180; if (test4(9) != 0)
+.LL81:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__tst.wr
+.LL84:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL83
+
+	.dbg	line,	"tests/divcmp-1.c", 181; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 182; if (test4(10) != 1)
+.LL83:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__tst.wr
+.LL86:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL85
+
+	.dbg	line,	"tests/divcmp-1.c", 183; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 184; if (test4(-1) != 0)
+.LL85:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__tst.wr
+.LL88:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL87
+
+	.dbg	line,	"tests/divcmp-1.c", 185; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 186; if (test4(-9) != 0)
+.LL87:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__tst.wr
+.LL90:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL89
+
+	.dbg	line,	"tests/divcmp-1.c", 187; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 188; if (test4(-10) != 1)
+.LL89:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__tst.wr
+.LL92:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL91
+
+	.dbg	line,	"tests/divcmp-1.c", 189; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 191; if (test4u(0) != 0)
+.LL91:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__tst.wr
+.LL94:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL93
+
+	.dbg	line,	"tests/divcmp-1.c", 192; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 193; if (test4u(9) != 0)
+.LL93:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__tst.wr
+.LL96:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL95
+
+	.dbg	line,	"tests/divcmp-1.c", 194; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 195; if (test4u(10) != 1)
+.LL95:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__tst.wr
+.LL98:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL97
+
+	.dbg	line,	"tests/divcmp-1.c", 196; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 197; if (test4u(-1) != 1)
+.LL97:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__tst.wr
+.LL100:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL99
+
+	.dbg	line,	"tests/divcmp-1.c", 198; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 199; if (test4u(-9) != 1)
+.LL99:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__tst.wr
+.LL102:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL101
+
+	.dbg	line,	"tests/divcmp-1.c", 200; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 201; if (test4u(-10) != 1)
+.LL101:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__tst.wr
+.LL104:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL103
+
+	.dbg	line,	"tests/divcmp-1.c", 202; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 204; if (test5(19) != 1)
+.LL103:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	2
+.LL106:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL105
+
+	.dbg	line,	"tests/divcmp-1.c", 205; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 206; if (test5(20) != 0)
+.LL105:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	2
+.LL108:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL107
+
+	.dbg	line,	"tests/divcmp-1.c", 207; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 208; if (test5(29) != 0)
+.LL107:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	2
+.LL110:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL109
+
+	.dbg	line,	"tests/divcmp-1.c", 209; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 210; if (test5(30) != 0)
+.LL109:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	2
+.LL112:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL111
+
+	.dbg	line,	"tests/divcmp-1.c", 211; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 213; if (test5u(19) != 1)
+.LL111:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ult_w.wi	2
+.LL114:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL113
+
+	.dbg	line,	"tests/divcmp-1.c", 214; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 215; if (test5u(20) != 0)
+.LL113:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ult_w.wi	2
+.LL116:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL115
+
+	.dbg	line,	"tests/divcmp-1.c", 216; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 217; if (test5u(29) != 0)
+.LL115:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ult_w.wi	2
+.LL118:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL117
+
+	.dbg	line,	"tests/divcmp-1.c", 218; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 219; if (test5u(30) != 0)
+.LL117:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ult_w.wi	2
+.LL120:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL119
+
+	.dbg	line,	"tests/divcmp-1.c", 220; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 222; if (test6(0) != 0)
+.LL119:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	0
+.LL122:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL121
+
+	.dbg	line,	"tests/divcmp-1.c", 223; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 224; if (test6(9) != 0)
+.LL121:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	0
+.LL124:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL123
+
+	.dbg	line,	"tests/divcmp-1.c", 225; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 226; if (test6(10) != 0)
+.LL123:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	0
+.LL126:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL125
+
+	.dbg	line,	"tests/divcmp-1.c", 227; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 228; if (test6(-1) != 0)
+.LL125:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	0
+.LL128:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL127
+
+	.dbg	line,	"tests/divcmp-1.c", 229; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 230; if (test6(-9) != 0)
+.LL127:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	0
+.LL130:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL129
+
+	.dbg	line,	"tests/divcmp-1.c", 231; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 232; if (test6(-10) != 1)
+.LL129:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__slt_w.wi	0
+.LL132:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL131
+
+	.dbg	line,	"tests/divcmp-1.c", 233; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 235; if (test7(19) != 1)
+.LL131:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	2
+.LL134:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL133
+
+	.dbg	line,	"tests/divcmp-1.c", 236; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 237; if (test7(20) != 1)
+.LL133:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	2
+.LL136:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL135
+
+	.dbg	line,	"tests/divcmp-1.c", 238; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 239; if (test7(29) != 1)
+.LL135:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	2
+.LL138:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL137
+
+	.dbg	line,	"tests/divcmp-1.c", 240; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 241; if (test7(30) != 0)
+.LL137:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	2
+.LL140:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL139
+
+	.dbg	line,	"tests/divcmp-1.c", 242; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 244; if (test7u(19) != 1)
+.LL139:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	2
+.LL142:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL141
+
+	.dbg	line,	"tests/divcmp-1.c", 245; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 246; if (test7u(20) != 1)
+.LL141:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	2
+.LL144:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL143
+
+	.dbg	line,	"tests/divcmp-1.c", 247; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 248; if (test7u(29) != 1)
+.LL143:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	2
+.LL146:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL145
+
+	.dbg	line,	"tests/divcmp-1.c", 249; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 250; if (test7u(30) != 0)
+.LL145:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	2
+.LL148:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL147
+
+	.dbg	line,	"tests/divcmp-1.c", 251; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 253; if (test8(0) != 1)
+.LL147:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	0
+.LL150:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL149
+
+	.dbg	line,	"tests/divcmp-1.c", 254; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 255; if (test8(9) != 1)
+.LL149:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	0
+.LL152:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL151
+
+	.dbg	line,	"tests/divcmp-1.c", 256; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 257; if (test8(10) != 0)
+.LL151:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	0
+.LL154:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL153
+
+	.dbg	line,	"tests/divcmp-1.c", 258; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 259; if (test8(-1) != 1)
+.LL153:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	0
+.LL156:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL155
+
+	.dbg	line,	"tests/divcmp-1.c", 260; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 261; if (test8(-9) != 1)
+.LL155:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	0
+.LL158:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL157
+
+	.dbg	line,	"tests/divcmp-1.c", 262; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 263; if (test8(-10) != 1)
+.LL157:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sle_w.wi	0
+.LL160:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL159
+
+	.dbg	line,	"tests/divcmp-1.c", 264; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 266; if (test8u(0) != 1)
+.LL159:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	0
+.LL162:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL161
+
+	.dbg	line,	"tests/divcmp-1.c", 267; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 268; if (test8u(9) != 1)
+.LL161:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	0
+.LL164:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL163
+
+	.dbg	line,	"tests/divcmp-1.c", 269; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 270; if (test8u(10) != 0)
+.LL163:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	0
+.LL166:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL165
+
+	.dbg	line,	"tests/divcmp-1.c", 271; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 272; if (test8u(-1) != 0)
+.LL165:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	0
+.LL168:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL167
+
+	.dbg	line,	"tests/divcmp-1.c", 273; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 274; if (test8u(-9) != 0)
+.LL167:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	0
+.LL170:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL169
+
+	.dbg	line,	"tests/divcmp-1.c", 275; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 276; if (test8u(-10) != 0)
+.LL169:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ule_w.wi	0
+.LL172:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL171
+
+	.dbg	line,	"tests/divcmp-1.c", 277; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 279; if (test9(19) != 0)
+.LL171:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	2
+.LL174:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL173
+
+	.dbg	line,	"tests/divcmp-1.c", 280; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 281; if (test9(20) != 0)
+.LL173:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	2
+.LL176:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL175
+
+	.dbg	line,	"tests/divcmp-1.c", 282; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 283; if (test9(29) != 0)
+.LL175:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	2
+.LL178:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL177
+
+	.dbg	line,	"tests/divcmp-1.c", 284; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 285; if (test9(30) != 1)
+.LL177:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	2
+.LL180:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL179
+
+	.dbg	line,	"tests/divcmp-1.c", 286; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 288; if (test9u(19) != 0)
+.LL179:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	2
+.LL182:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL181
+
+	.dbg	line,	"tests/divcmp-1.c", 289; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 290; if (test9u(20) != 0)
+.LL181:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	2
+.LL184:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL183
+
+	.dbg	line,	"tests/divcmp-1.c", 291; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 292; if (test9u(29) != 0)
+.LL183:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	2
+.LL186:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL185
+
+	.dbg	line,	"tests/divcmp-1.c", 293; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 294; if (test9u(30) != 1)
+.LL185:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	2
+.LL188:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL187
+
+	.dbg	line,	"tests/divcmp-1.c", 295; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 297; if (test10(0) != 0)
+.LL187:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	0
+.LL190:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL189
+
+	.dbg	line,	"tests/divcmp-1.c", 298; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 299; if (test10(9) != 0)
+.LL189:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	0
+.LL192:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL191
+
+	.dbg	line,	"tests/divcmp-1.c", 300; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 301; if (test10(10) != 1)
+.LL191:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	0
+.LL194:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL193
+
+	.dbg	line,	"tests/divcmp-1.c", 302; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 303; if (test10(-1) != 0)
+.LL193:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	0
+.LL196:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL195
+
+	.dbg	line,	"tests/divcmp-1.c", 304; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 305; if (test10(-9) != 0)
+.LL195:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	0
+.LL198:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL197
+
+	.dbg	line,	"tests/divcmp-1.c", 306; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 307; if (test10(-10) != 0)
+.LL197:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sgt_w.wi	0
+.LL200:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL199
+
+	.dbg	line,	"tests/divcmp-1.c", 308; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 310; if (test10u(0) != 0)
+.LL199:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	0
+.LL202:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL201
+
+	.dbg	line,	"tests/divcmp-1.c", 311; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 312; if (test10u(9) != 0)
+.LL201:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	0
+.LL204:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL203
+
+	.dbg	line,	"tests/divcmp-1.c", 313; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 314; if (test10u(10) != 1)
+.LL203:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	0
+.LL206:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL205
+
+	.dbg	line,	"tests/divcmp-1.c", 315; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 316; if (test10u(-1) != 1)
+.LL205:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	0
+.LL208:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL207
+
+	.dbg	line,	"tests/divcmp-1.c", 317; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 318; if (test10u(-9) != 1)
+.LL207:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	0
+.LL210:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL209
+
+	.dbg	line,	"tests/divcmp-1.c", 319; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 320; if (test10u(-10) != 1)
+.LL209:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__ugt_w.wi	0
+.LL212:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL211
+
+	.dbg	line,	"tests/divcmp-1.c", 321; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 323; if (test11(19) != 0)
+.LL211:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	2
+.LL214:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL213
+
+	.dbg	line,	"tests/divcmp-1.c", 324; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 325; if (test11(20) != 1)
+.LL213:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	2
+.LL216:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL215
+
+	.dbg	line,	"tests/divcmp-1.c", 326; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 327; if (test11(29) != 1)
+.LL215:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	2
+.LL218:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL217
+
+	.dbg	line,	"tests/divcmp-1.c", 328; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 329; if (test11(30) != 1)
+.LL217:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	2
+.LL220:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL219
+
+	.dbg	line,	"tests/divcmp-1.c", 330; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 332; if (test11u(19) != 0)
+.LL219:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__uge_w.wi	2
+.LL222:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL221
+
+	.dbg	line,	"tests/divcmp-1.c", 333; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 334; if (test11u(20) != 1)
+.LL221:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__uge_w.wi	2
+.LL224:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL223
+
+	.dbg	line,	"tests/divcmp-1.c", 335; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 336; if (test11u(29) != 1)
+.LL223:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__uge_w.wi	2
+.LL226:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL225
+
+	.dbg	line,	"tests/divcmp-1.c", 337; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 338; if (test11u(30) != 1)
+.LL225:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__udiv.wi	10
+	__uge_w.wi	2
+.LL228:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL227
+
+	.dbg	line,	"tests/divcmp-1.c", 339; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 341; if (test12(0) != 1)
+.LL227:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	0
+.LL230:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL229
+
+	.dbg	line,	"tests/divcmp-1.c", 342; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 343; if (test12(9) != 1)
+.LL229:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	0
+.LL232:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL231
+
+	.dbg	line,	"tests/divcmp-1.c", 344; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 345; if (test12(10) != 1)
+.LL231:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	0
+.LL234:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL233
+
+	.dbg	line,	"tests/divcmp-1.c", 346; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 347; if (test12(-1) != 1)
+.LL233:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	0
+.LL236:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL235
+
+	.dbg	line,	"tests/divcmp-1.c", 348; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 349; if (test12(-9) != 1)
+.LL235:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	0
+.LL238:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL237
+
+	.dbg	line,	"tests/divcmp-1.c", 350; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 351; if (test12(-10) != 0)
+.LL237:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__sge_w.wi	0
+.LL240:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL239
+
+	.dbg	line,	"tests/divcmp-1.c", 352; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-1.c", 354; return 0;
+.LL239:
+	__ld.wi		0
+.LL24:
+
+	.dbg	line,	"tests/divcmp-1.c", 355; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:24
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,601 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/divcmp-2.c", 1; extern void abort (void);
+	.dbg	line,	"tests/divcmp-2.c", 3; int test1(int x)
+	.dbg	line,	"tests/divcmp-2.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"tests/divcmp-2.c", 5; return x/10 == 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	2
+.LL2:
+	__bool
+
+	.dbg	line,	"tests/divcmp-2.c", 6; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-2.c", 8; int test2(int x)
+	.dbg	line,	"tests/divcmp-2.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"tests/divcmp-2.c", 10; return x/10 == 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL3:
+	__bool
+
+	.dbg	line,	"tests/divcmp-2.c", 11; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-2.c", 13; int test3(int x)
+	.dbg	line,	"tests/divcmp-2.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3
+	__enter		_test3
+
+	.dbg	line,	"tests/divcmp-2.c", 15; return x/10 == -2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	-2
+.LL4:
+	__bool
+
+	.dbg	line,	"tests/divcmp-2.c", 16; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-2.c", 18; int test4(int x)
+	.dbg	line,	"tests/divcmp-2.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4
+	__enter		_test4
+
+	.dbg	line,	"tests/divcmp-2.c", 20; return x/-10 == 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	2
+.LL5:
+	__bool
+
+	.dbg	line,	"tests/divcmp-2.c", 21; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-2.c", 23; int test5(int x)
+	.dbg	line,	"tests/divcmp-2.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5
+	__enter		_test5
+
+	.dbg	line,	"tests/divcmp-2.c", 25; return x/-10 == 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL6:
+	__bool
+
+	.dbg	line,	"tests/divcmp-2.c", 26; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-2.c", 28; int test6(int x)
+	.dbg	line,	"tests/divcmp-2.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6
+	__enter		_test6
+
+	.dbg	line,	"tests/divcmp-2.c", 30; return x/-10 == -2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	-2
+.LL7:
+	__bool
+
+	.dbg	line,	"tests/divcmp-2.c", 31; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-2.c", 34; int main()
+	.dbg	line,	"tests/divcmp-2.c", 35; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/divcmp-2.c", 36; if (test1(19) != 0)
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	2
+.LL10:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/divcmp-2.c", 37; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 38; if (test1(20) != 1)
+.LL9:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	2
+.LL12:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/divcmp-2.c", 39; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 40; if (test1(29) != 1)
+.LL11:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	2
+.LL14:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/divcmp-2.c", 41; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 42; if (test1(30) != 0)
+.LL13:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	2
+.LL16:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/divcmp-2.c", 43; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 45; if (test2(-10) != 0)
+.LL15:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL18:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/divcmp-2.c", 46; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 47; if (test2(-9) != 1)
+.LL17:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL20:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/divcmp-2.c", 48; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 49; if (test2(9) != 1)
+.LL19:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL22:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL21
+
+	.dbg	line,	"tests/divcmp-2.c", 50; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 51; if (test2(10) != 0)
+.LL21:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__not.wr
+.LL24:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/divcmp-2.c", 52; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 54; if (test3(-30) != 0)
+.LL23:
+	__ld.wi		-30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	-2
+.LL26:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL25
+
+	.dbg	line,	"tests/divcmp-2.c", 55; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 56; if (test3(-29) != 1)
+.LL25:
+	__ld.wi		-29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	-2
+.LL28:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/divcmp-2.c", 57; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 58; if (test3(-20) != 1)
+.LL27:
+	__ld.wi		-20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	-2
+.LL30:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL29
+
+	.dbg	line,	"tests/divcmp-2.c", 59; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 60; if (test3(-19) != 0)
+.LL29:
+	__ld.wi		-19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	10
+	__equ_w.wi	-2
+.LL32:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL31
+
+	.dbg	line,	"tests/divcmp-2.c", 61; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 63; if (test4(-30) != 0)
+.LL31:
+	__ld.wi		-30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	2
+.LL34:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL33
+
+	.dbg	line,	"tests/divcmp-2.c", 64; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 65; if (test4(-29) != 1)
+.LL33:
+	__ld.wi		-29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	2
+.LL36:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL35
+
+	.dbg	line,	"tests/divcmp-2.c", 66; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 67; if (test4(-20) != 1)
+.LL35:
+	__ld.wi		-20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	2
+.LL38:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL37
+
+	.dbg	line,	"tests/divcmp-2.c", 68; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 69; if (test4(-19) != 0)
+.LL37:
+	__ld.wi		-19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	2
+.LL40:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL39
+
+	.dbg	line,	"tests/divcmp-2.c", 70; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 72; if (test5(-10) != 0)
+.LL39:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL42:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL41
+
+	.dbg	line,	"tests/divcmp-2.c", 73; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 74; if (test5(-9) != 1)
+.LL41:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL44:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL43
+
+	.dbg	line,	"tests/divcmp-2.c", 75; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 76; if (test5(9) != 1)
+.LL43:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL46:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL45
+
+	.dbg	line,	"tests/divcmp-2.c", 77; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 78; if (test5(10) != 0)
+.LL45:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL48:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL47
+
+	.dbg	line,	"tests/divcmp-2.c", 79; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 81; if (test6(19) != 0)
+.LL47:
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	-2
+.LL50:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL49
+
+	.dbg	line,	"tests/divcmp-2.c", 82; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 83; if (test6(20) != 1)
+.LL49:
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	-2
+.LL52:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL51
+
+	.dbg	line,	"tests/divcmp-2.c", 84; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 85; if (test6(29) != 1)
+.LL51:
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	-2
+.LL54:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL53
+
+	.dbg	line,	"tests/divcmp-2.c", 86; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 87; if (test6(30) != 0)
+.LL53:
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	-2
+.LL56:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL55
+
+	.dbg	line,	"tests/divcmp-2.c", 88; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-2.c", 90; return 0;
+.LL55:
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"tests/divcmp-2.c", 91; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
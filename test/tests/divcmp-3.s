@@ -0,0 +1,587 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/divcmp-3.c", 1; extern void abort(void);
+	.dbg	line,	"tests/divcmp-3.c", 3; int test1(char x)
+	.dbg	line,	"tests/divcmp-3.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"tests/divcmp-3.c", 5; return x/100 == 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__equ_b.uiq	3
+.LL2:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 6; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 8; int test1u(unsigned char x)
+	.dbg	line,	"tests/divcmp-3.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1u
+	__enter		_test1u
+
+	.dbg	line,	"tests/divcmp-3.c", 10; return x/100 == 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__equ_b.uiq	3
+.LL3:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 11; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 13; int test2(char x)
+	.dbg	line,	"tests/divcmp-3.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"tests/divcmp-3.c", 15; return x/100 != 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__neq_b.uiq	3
+.LL4:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 16; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 18; int test2u(unsigned char x)
+	.dbg	line,	"tests/divcmp-3.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2u
+	__enter		_test2u
+
+	.dbg	line,	"tests/divcmp-3.c", 20; return x/100 != 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__neq_b.uiq	3
+.LL5:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 21; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 23; int test3(char x)
+	.dbg	line,	"tests/divcmp-3.c", 24; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3
+	__enter		_test3
+
+	.dbg	line,	"tests/divcmp-3.c", 25; return x/100 < 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ult_b.uiq	3
+.LL6:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 26; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 28; int test3u(unsigned char x)
+	.dbg	line,	"tests/divcmp-3.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3u
+	__enter		_test3u
+
+	.dbg	line,	"tests/divcmp-3.c", 30; return x/100 < 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ult_b.uiq	3
+.LL7:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 31; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 33; int test4(char x)
+	.dbg	line,	"tests/divcmp-3.c", 34; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4
+	__enter		_test4
+
+	.dbg	line,	"tests/divcmp-3.c", 35; return x/100 <= 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ule_b.uiq	3
+.LL8:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 36; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 38; int test4u(unsigned char x)
+	.dbg	line,	"tests/divcmp-3.c", 39; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4u
+	__enter		_test4u
+
+	.dbg	line,	"tests/divcmp-3.c", 40; return x/100 <= 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ule_b.uiq	3
+.LL9:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 41; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 43; int test5(char x)
+	.dbg	line,	"tests/divcmp-3.c", 44; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5
+	__enter		_test5
+
+	.dbg	line,	"tests/divcmp-3.c", 45; return x/100 > 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ugt_b.uiq	3
+.LL10:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 46; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 48; int test5u(unsigned char x)
+	.dbg	line,	"tests/divcmp-3.c", 49; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5u
+	__enter		_test5u
+
+	.dbg	line,	"tests/divcmp-3.c", 50; return x/100 > 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ugt_b.uiq	3
+.LL11:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 51; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 53; int test6(char x)
+	.dbg	line,	"tests/divcmp-3.c", 54; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6
+	__enter		_test6
+
+	.dbg	line,	"tests/divcmp-3.c", 55; return x/100 >= 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__uge_b.uiq	3
+.LL12:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 56; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 58; int test6u(unsigned char x)
+	.dbg	line,	"tests/divcmp-3.c", 59; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6u
+	__enter		_test6u
+
+	.dbg	line,	"tests/divcmp-3.c", 60; return x/100 >= 3;
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__uge_b.uiq	3
+.LL13:
+	__bool
+
+	.dbg	line,	"tests/divcmp-3.c", 61; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-3.c", 64; int main()
+	.dbg	line,	"tests/divcmp-3.c", 65; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/divcmp-3.c", 66; int c;
+
+	.dbg	line,	"tests/divcmp-3.c", 68; for (c=-128; c<256; c++)
+	__st.wmiq	-128, __main_end - 2  /* c */
+.LL15:
+	__ld.wm		__main_end - 2  /* c */
+	__slt_w.wi	256
+	__btrue		.LL17
+	__bra		.LL18
+.LL16:
+	__inc.wmq	__main_end - 2  /* c */
+	__bra		.LL15
+.LL17:
+
+	.dbg	line,	"tests/divcmp-3.c", 69; {
+
+	.dbg	line,	"tests/divcmp-3.c", 70; if (test1(c) != 0)
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__equ_b.uiq	3
+.LL20:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/divcmp-3.c", 71; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 72; if (test1u(c) != 0)
+.LL19:
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__equ_b.uiq	3
+.LL22:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL21
+
+	.dbg	line,	"tests/divcmp-3.c", 73; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 74; if (test2(c) != 1)
+.LL21:
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__neq_b.uiq	3
+.LL24:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/divcmp-3.c", 75; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 76; if (test2u(c) != 1)
+.LL23:
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__neq_b.uiq	3
+.LL26:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL25
+
+	.dbg	line,	"tests/divcmp-3.c", 77; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 78; if (test3(c) != 1)
+.LL25:
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ult_b.uiq	3
+.LL28:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/divcmp-3.c", 79; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 80; if (test3u(c) != 1)
+.LL27:
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ult_b.uiq	3
+.LL30:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL29
+
+	.dbg	line,	"tests/divcmp-3.c", 81; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 82; if (test4(c) != 1)
+.LL29:
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ule_b.uiq	3
+.LL32:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL31
+
+	.dbg	line,	"tests/divcmp-3.c", 83; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 84; if (test4u(c) != 1)
+.LL31:
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ule_b.uiq	3
+.LL34:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL33
+
+	.dbg	line,	"tests/divcmp-3.c", 85; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 86; if (test5(c) != 0)
+.LL33:
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ugt_b.uiq	3
+.LL36:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL35
+
+	.dbg	line,	"tests/divcmp-3.c", 87; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 88; if (test5u(c) != 0)
+.LL35:
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__ugt_b.uiq	3
+.LL38:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL37
+
+	.dbg	line,	"tests/divcmp-3.c", 89; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 90; if (test6(c) != 0)
+.LL37:
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__uge_b.uiq	3
+.LL40:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL39
+
+	.dbg	line,	"tests/divcmp-3.c", 91; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 92; if (test6u(c) != 0)
+.LL39:
+	__ld.wm		__main_end - 2  /* c */
+	__pusharg.wr
+	__ld.us		0  /* x */
+	__udiv.uiq	41, 4
+	__uge_b.uiq	3
+.LL42:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL41
+
+	.dbg	line,	"tests/divcmp-3.c", 93; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-3.c", 94; }
+.LL41	.alias		.LL16
+	__bra		.LL16
+.LL18:
+
+	.dbg	line,	"tests/divcmp-3.c", 95; return 0;
+	__ld.wi		0
+.LL14:
+
+	.dbg	line,	"tests/divcmp-3.c", 96; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:14
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       240     30     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 30, 240
+__main_end	=	__overlay_frames + 2
+	.endm
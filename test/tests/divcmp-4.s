@@ -0,0 +1,1316 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/divcmp-4.c", 1; /* PR middle-end/17894 */
+	.dbg	line,	"tests/divcmp-4.c", 3; extern void abort(void);
+	.dbg	line,	"tests/divcmp-4.c", 5; int test1(int x)
+	.dbg	line,	"tests/divcmp-4.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"tests/divcmp-4.c", 7; return x/-10 == 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	2
+.LL2:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 8; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 10; int test2(int x)
+	.dbg	line,	"tests/divcmp-4.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"tests/divcmp-4.c", 12; return x/-10 == 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL3:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 13; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 15; int test3(int x)
+	.dbg	line,	"tests/divcmp-4.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test3
+	__enter		_test3
+
+	.dbg	line,	"tests/divcmp-4.c", 17; return x/-10 != 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__neq_w.wi	2
+.LL4:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 18; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 20; int test4(int x)
+	.dbg	line,	"tests/divcmp-4.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test4
+	__enter		_test4
+
+	.dbg	line,	"tests/divcmp-4.c", 22; return x/-10 != 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__tst.wr
+.LL5:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 23; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 25; int test5(int x)
+	.dbg	line,	"tests/divcmp-4.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test5
+	__enter		_test5
+
+	.dbg	line,	"tests/divcmp-4.c", 27; return x/-10 < 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	2
+.LL6:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 28; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 30; int test6(int x)
+	.dbg	line,	"tests/divcmp-4.c", 31; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test6
+	__enter		_test6
+
+	.dbg	line,	"tests/divcmp-4.c", 32; return x/-10 < 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	0
+.LL7:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 33; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 35; int test7(int x)
+	.dbg	line,	"tests/divcmp-4.c", 36; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test7
+	__enter		_test7
+
+	.dbg	line,	"tests/divcmp-4.c", 37; return x/-10  <= 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	2
+.LL8:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 38; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 40; int test8(int x)
+	.dbg	line,	"tests/divcmp-4.c", 41; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test8
+	__enter		_test8
+
+	.dbg	line,	"tests/divcmp-4.c", 42; return x/-10 <= 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	0
+.LL9:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 43; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 45; int test9(int x)
+	.dbg	line,	"tests/divcmp-4.c", 46; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test9
+	__enter		_test9
+
+	.dbg	line,	"tests/divcmp-4.c", 47; return x/-10 > 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	2
+.LL10:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 48; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 50; int test10(int x)
+	.dbg	line,	"tests/divcmp-4.c", 51; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test10
+	__enter		_test10
+
+	.dbg	line,	"tests/divcmp-4.c", 52; return x/-10 > 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	0
+.LL11:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 53; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 55; int test11(int x)
+	.dbg	line,	"tests/divcmp-4.c", 56; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test11
+	__enter		_test11
+
+	.dbg	line,	"tests/divcmp-4.c", 57; return x/-10 >= 2;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	2
+.LL12:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 58; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 60; int test12(int x)
+	.dbg	line,	"tests/divcmp-4.c", 61; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test12
+	__enter		_test12
+
+	.dbg	line,	"tests/divcmp-4.c", 62; return x/-10 >= 0;
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	0
+.LL13:
+	__bool
+
+	.dbg	line,	"tests/divcmp-4.c", 63; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-4.c", 66; int main()
+	.dbg	line,	"tests/divcmp-4.c", 67; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/divcmp-4.c", 68; if (test1(-30) != 0)
+	__ld.wi		-30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	2
+.LL16:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/divcmp-4.c", 69; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 70; if (test1(-29) != 1)
+.LL15:
+	__ld.wi		-29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	2
+.LL18:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/divcmp-4.c", 71; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 72; if (test1(-20) != 1)
+.LL17:
+	__ld.wi		-20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	2
+.LL20:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/divcmp-4.c", 73; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 74; if (test1(-19) != 0)
+.LL19:
+	__ld.wi		-19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__equ_w.wi	2
+.LL22:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL21
+
+	.dbg	line,	"tests/divcmp-4.c", 75; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 77; if (test2(0) != 1)
+.LL21:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL24:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/divcmp-4.c", 78; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 79; if (test2(9) != 1)
+.LL23:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL26:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL25
+
+	.dbg	line,	"tests/divcmp-4.c", 80; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 81; if (test2(10) != 0)
+.LL25:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL28:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/divcmp-4.c", 82; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 83; if (test2(-1) != 1)
+.LL27:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL30:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL29
+
+	.dbg	line,	"tests/divcmp-4.c", 84; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 85; if (test2(-9) != 1)
+.LL29:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL32:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL31
+
+	.dbg	line,	"tests/divcmp-4.c", 86; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 87; if (test2(-10) != 0)
+.LL31:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__not.wr
+.LL34:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL33
+
+	.dbg	line,	"tests/divcmp-4.c", 88; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 90; if (test3(-30) != 1)
+.LL33:
+	__ld.wi		-30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__neq_w.wi	2
+.LL36:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL35
+
+	.dbg	line,	"tests/divcmp-4.c", 91; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 92; if (test3(-29) != 0)
+.LL35:
+	__ld.wi		-29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__neq_w.wi	2
+.LL38:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL37
+
+	.dbg	line,	"tests/divcmp-4.c", 93; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 94; if (test3(-20) != 0)
+.LL37:
+	__ld.wi		-20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__neq_w.wi	2
+.LL40:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL39
+
+	.dbg	line,	"tests/divcmp-4.c", 95; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 96; if (test3(-19) != 1)
+.LL39:
+	__ld.wi		-19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__neq_w.wi	2
+.LL42:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL41
+
+	.dbg	line,	"tests/divcmp-4.c", 97; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 99; if (test4(0) != 0)
+.LL41:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__tst.wr
+.LL44:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL43
+
+	.dbg	line,	"tests/divcmp-4.c", 100; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 101; if (test4(9) != 0)
+.LL43:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__tst.wr
+.LL46:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL45
+
+	.dbg	line,	"tests/divcmp-4.c", 102; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 103; if (test4(10) != 1)
+.LL45:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__tst.wr
+.LL48:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL47
+
+	.dbg	line,	"tests/divcmp-4.c", 104; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 105; if (test4(-1) != 0)
+.LL47:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__tst.wr
+.LL50:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL49
+
+	.dbg	line,	"tests/divcmp-4.c", 106; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 107; if (test4(-9) != 0)
+.LL49:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__tst.wr
+.LL52:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL51
+
+	.dbg	line,	"tests/divcmp-4.c", 108; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 109; if (test4(-10) != 1)
+.LL51:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__tst.wr
+.LL54:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL53
+
+	.dbg	line,	"tests/divcmp-4.c", 110; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 112; if (test5(-30) != 0)
+.LL53:
+	__ld.wi		-30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	2
+.LL56:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL55
+
+	.dbg	line,	"tests/divcmp-4.c", 113; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 114; if (test5(-29) != 0)
+.LL55:
+	__ld.wi		-29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	2
+.LL58:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL57
+
+	.dbg	line,	"tests/divcmp-4.c", 115; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 116; if (test5(-20) != 0)
+.LL57:
+	__ld.wi		-20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	2
+.LL60:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL59
+
+	.dbg	line,	"tests/divcmp-4.c", 117; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 118; if (test5(-19) != 1)
+.LL59:
+	__ld.wi		-19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	2
+.LL62:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL61
+
+	.dbg	line,	"tests/divcmp-4.c", 119; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 121; if (test6(0) != 0)
+.LL61:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	0
+.LL64:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL63
+
+	.dbg	line,	"tests/divcmp-4.c", 122; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 123; if (test6(9) != 0)
+.LL63:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	0
+.LL66:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL65
+
+	.dbg	line,	"tests/divcmp-4.c", 124; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 125; if (test6(10) != 1)
+.LL65:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	0
+.LL68:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL67
+
+	.dbg	line,	"tests/divcmp-4.c", 126; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 127; if (test6(-1) != 0)
+.LL67:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	0
+.LL70:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL69
+
+	.dbg	line,	"tests/divcmp-4.c", 128; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 129; if (test6(-9) != 0)
+.LL69:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	0
+.LL72:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL71
+
+	.dbg	line,	"tests/divcmp-4.c", 130; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 131; if (test6(-10) != 0)
+.LL71:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__slt_w.wi	0
+.LL74:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL73
+
+	.dbg	line,	"tests/divcmp-4.c", 132; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 134; if (test7(-30) != 0)
+.LL73:
+	__ld.wi		-30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	2
+.LL76:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL75
+
+	.dbg	line,	"tests/divcmp-4.c", 135; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 136; if (test7(-29) != 1)
+.LL75:
+	__ld.wi		-29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	2
+.LL78:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL77
+
+	.dbg	line,	"tests/divcmp-4.c", 137; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 138; if (test7(-20) != 1)
+.LL77:
+	__ld.wi		-20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	2
+.LL80:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL79
+
+	.dbg	line,	"tests/divcmp-4.c", 139; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 140; if (test7(-19) != 1)
+.LL79:
+	__ld.wi		-19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	2
+.LL82:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL81
+
+	.dbg	line,	"tests/divcmp-4.c", 141; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 143; if (test8(0) != 1)
+.LL81:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	0
+.LL84:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL83
+
+	.dbg	line,	"tests/divcmp-4.c", 144; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 145; if (test8(9) != 1)
+.LL83:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	0
+.LL86:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL85
+
+	.dbg	line,	"tests/divcmp-4.c", 146; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 147; if (test8(10) != 1)
+.LL85:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	0
+.LL88:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL87
+
+	.dbg	line,	"tests/divcmp-4.c", 148; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 149; if (test8(-1) != 1)
+.LL87:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	0
+.LL90:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL89
+
+	.dbg	line,	"tests/divcmp-4.c", 150; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 151; if (test8(-9) != 1)
+.LL89:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	0
+.LL92:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL91
+
+	.dbg	line,	"tests/divcmp-4.c", 152; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 153; if (test8(-10) != 0)
+.LL91:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sle_w.wi	0
+.LL94:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL93
+
+	.dbg	line,	"tests/divcmp-4.c", 154; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 156; if (test9(-30) != 1)
+.LL93:
+	__ld.wi		-30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	2
+.LL96:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL95
+
+	.dbg	line,	"tests/divcmp-4.c", 157; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 158; if (test9(-29) != 0)
+.LL95:
+	__ld.wi		-29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	2
+.LL98:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL97
+
+	.dbg	line,	"tests/divcmp-4.c", 159; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 160; if (test9(-20) != 0)
+.LL97:
+	__ld.wi		-20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	2
+.LL100:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL99
+
+	.dbg	line,	"tests/divcmp-4.c", 161; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 162; if (test9(-19) != 0)
+.LL99:
+	__ld.wi		-19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	2
+.LL102:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL101
+
+	.dbg	line,	"tests/divcmp-4.c", 163; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 165; if (test10(0) != 0)
+.LL101:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	0
+.LL104:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL103
+
+	.dbg	line,	"tests/divcmp-4.c", 166; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 167; if (test10(9) != 0)
+.LL103:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	0
+.LL106:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL105
+
+	.dbg	line,	"tests/divcmp-4.c", 168; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 169; if (test10(10) != 0)
+.LL105:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	0
+.LL108:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL107
+
+	.dbg	line,	"tests/divcmp-4.c", 170; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 171; if (test10(-1) != 0)
+.LL107:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	0
+.LL110:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL109
+
+	.dbg	line,	"tests/divcmp-4.c", 172; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 173; if (test10(-9) != 0)
+.LL109:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	0
+.LL112:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL111
+
+	.dbg	line,	"tests/divcmp-4.c", 174; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 175; if (test10(-10) != 1)
+.LL111:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sgt_w.wi	0
+.LL114:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL113
+
+	.dbg	line,	"tests/divcmp-4.c", 176; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 178; if (test11(-30) != 1)
+.LL113:
+	__ld.wi		-30
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	2
+.LL116:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL115
+
+	.dbg	line,	"tests/divcmp-4.c", 179; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 180; if (test11(-29) != 1)
+.LL115:
+	__ld.wi		-29
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	2
+.LL118:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL117
+
+	.dbg	line,	"tests/divcmp-4.c", 181; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 182; if (test11(-20) != 1)
+.LL117:
+	__ld.wi		-20
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	2
+.LL120:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL119
+
+	.dbg	line,	"tests/divcmp-4.c", 183; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 184; if (test11(-19) != 0)
+.LL119:
+	__ld.wi		-19
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	2
+.LL122:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL121
+
+	.dbg	line,	"tests/divcmp-4.c", 185; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 187; if (test12(0) != 1)
+.LL121:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	0
+.LL124:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL123
+
+	.dbg	line,	"tests/divcmp-4.c", 188; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 189; if (test12(9) != 1)
+.LL123:
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	0
+.LL126:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL125
+
+	.dbg	line,	"tests/divcmp-4.c", 190; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 191; if (test12(10) != 0)
+.LL125:
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	0
+.LL128:
+	__bool
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL127
+
+	.dbg	line,	"tests/divcmp-4.c", 192; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 193; if (test12(-1) != 1)
+.LL127:
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	0
+.LL130:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL129
+
+	.dbg	line,	"tests/divcmp-4.c", 194; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 195; if (test12(-9) != 1)
+.LL129:
+	__ld.wi		-9
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	0
+.LL132:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL131
+
+	.dbg	line,	"tests/divcmp-4.c", 196; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 197; if (test12(-10) != 1)
+.LL131:
+	__ld.wi		-10
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__sdiv.wi	-10
+	__sge_w.wi	0
+.LL134:
+	__bool
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL133
+
+	.dbg	line,	"tests/divcmp-4.c", 198; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-4.c", 200; return 0;
+.LL133:
+	__ld.wi		0
+.LL14:
+
+	.dbg	line,	"tests/divcmp-4.c", 201; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:14
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
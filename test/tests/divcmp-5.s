@@ -0,0 +1,190 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/divcmp-5.c", 1; /* PR middle-end/26561 */
+	.dbg	line,	"tests/divcmp-5.c", 3; extern void abort(void);
+	.dbg	line,	"tests/divcmp-5.c", 5; int always_one_1 (int a)
+	.dbg	line,	"tests/divcmp-5.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_always_one_1
+	__enter		_always_one_1
+
+	.dbg	line,	"tests/divcmp-5.c", 7; if (a/100 >= -9999)
+	__ld.ws		0  /* a */
+	__sdiv.wi	100
+	__sge_w.wi	-9999
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/divcmp-5.c", 8; return 1;
+	__ld.wi		1
+	__bra		.LL2
+
+	.dbg	line,	"tests/divcmp-5.c", 9; else
+.LL3:
+
+	.dbg	line,	"tests/divcmp-5.c", 10; return 0;
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"tests/divcmp-5.c", 11; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-5.c", 13; int always_one_2 (int a)
+	.dbg	line,	"tests/divcmp-5.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_always_one_2
+	__enter		_always_one_2
+
+	.dbg	line,	"tests/divcmp-5.c", 15; if (a/100 < -9999)
+	__ld.ws		0  /* a */
+	__sdiv.wi	100
+	__slt_w.wi	-9999
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/divcmp-5.c", 16; return 0;
+	__ld.wi		0
+	__bra		.LL5
+
+	.dbg	line,	"tests/divcmp-5.c", 17; else
+.LL6:
+
+	.dbg	line,	"tests/divcmp-5.c", 18; return 1;
+	__ld.wi		1
+.LL7:
+
+	.dbg	line,	"tests/divcmp-5.c", 19; }
+.LL5:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divcmp-5.c", 21; int main(void)
+	.dbg	line,	"tests/divcmp-5.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/divcmp-5.c", 23; if (always_one_1 (0) != 1)
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__sdiv.wi	100
+	__sge_w.wi	-9999
+	__bfalse	.LL10
+	__ld.wi		1
+	__bra		.LL12
+.LL10:
+	__ld.wi		0
+.LL11:
+.LL12:
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/divcmp-5.c", 24; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-5.c", 26; if (always_one_2 (0) != 1)
+.LL9:
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__sdiv.wi	100
+	__slt_w.wi	-9999
+	__bfalse	.LL14
+	__ld.wi		0
+	__bra		.LL16
+.LL14:
+	__ld.wi		1
+.LL15:
+.LL16:
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/divcmp-5.c", 27; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divcmp-5.c", 29; return 0;
+.LL13:
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"tests/divcmp-5.c", 30; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
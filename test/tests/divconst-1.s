@@ -0,0 +1,182 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/divconst-1.c", 1; /*typedef*/ struct t1
+	.dbg	line,	"tests/divconst-1.c", 2; {
+	.dbg	line,	"tests/divconst-1.c", 3; unsigned a, b, c, d;
+	.dbg	line,	"tests/divconst-1.c", 4; };// t1;
+	.dbg	line,	"tests/divconst-1.c", 6; f (struct t1 *ps)
+	.dbg	line,	"tests/divconst-1.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/divconst-1.c", 8; ps->a = 10000;
+	__ld.ws		0  /* ps */
+	__push.wr
+	__ld.wi		10000
+	__st.wtq
+
+	.dbg	line,	"tests/divconst-1.c", 9; ps->b = ps->a / 3;
+	__ld.ws		0  /* ps */
+	__add.wi	2
+	__push.wr
+	__ld.ws		0  /* ps */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__udiv.wi	3
+	__st.wtq
+
+	.dbg	line,	"tests/divconst-1.c", 10; ps->c = 10000;
+	__ld.ws		0  /* ps */
+	__add.wi	4
+	__push.wr
+	__ld.wi		10000
+	__st.wtq
+
+	.dbg	line,	"tests/divconst-1.c", 11; ps->d = ps->c / 3;
+	__ld.ws		0  /* ps */
+	__add.wi	6
+	__push.wr
+	__ld.ws		0  /* ps */
+	__add.wi	4
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__udiv.wi	3
+	__st.wtq
+
+	.dbg	line,	"tests/divconst-1.c", 12; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/divconst-1.c", 14; main ()
+	.dbg	line,	"tests/divconst-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/divconst-1.c", 16; struct t1 s;
+
+	.dbg	line,	"tests/divconst-1.c", 17; f (&s);
+	__ld.wi		__main_end - 8  /* s */
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/divconst-1.c", 18; if (s.a != 10000 || s.b != 3333 || s.c != 10000 || s.d != 3333)
+	__ld.wm		__main_end - 8  /* s */
+	__neq_w.wi	10000
+	__btrue		.LL5
+	__ld.wm		__main_end - 8 + 2  /* s */
+	__neq_w.wi	3333
+.LL5:
+	__btrue		.LL6
+	__ld.wm		__main_end - 8 + 4  /* s */
+	__neq_w.wi	10000
+.LL6:
+	__btrue		.LL7
+	__ld.wm		__main_end - 8 + 6  /* s */
+	__neq_w.wi	3333
+.LL7:
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/divconst-1.c", 19; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/divconst-1.c", 20; exit (0);
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/divconst-1.c", 21; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     8  _main
+;
+; 8 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     8  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 8, 10, 10
+__main_end	=	__overlay_frames + 8
+	.endm
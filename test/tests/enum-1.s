@@ -0,0 +1,202 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/enum-1.c", 1; typedef enum
+	.dbg	line,	"tests/enum-1.c", 2; {
+	.dbg	line,	"tests/enum-1.c", 3; END = -1,
+	.dbg	line,	"tests/enum-1.c", 4; EMPTY = (1 << 8 ) ,
+	.dbg	line,	"tests/enum-1.c", 5; BACKREF,
+	.dbg	line,	"tests/enum-1.c", 6; BEGLINE,
+	.dbg	line,	"tests/enum-1.c", 7; ENDLINE,
+	.dbg	line,	"tests/enum-1.c", 8; BEGWORD,
+	.dbg	line,	"tests/enum-1.c", 9; ENDWORD,
+	.dbg	line,	"tests/enum-1.c", 10; LIMWORD,
+	.dbg	line,	"tests/enum-1.c", 11; NOTLIMWORD,
+	.dbg	line,	"tests/enum-1.c", 12; QMARK,
+	.dbg	line,	"tests/enum-1.c", 13; STAR,
+	.dbg	line,	"tests/enum-1.c", 14; PLUS,
+	.dbg	line,	"tests/enum-1.c", 15; REPMN,
+	.dbg	line,	"tests/enum-1.c", 16; CAT,
+	.dbg	line,	"tests/enum-1.c", 17; OR,
+	.dbg	line,	"tests/enum-1.c", 18; ORTOP,
+	.dbg	line,	"tests/enum-1.c", 19; LPAREN,
+	.dbg	line,	"tests/enum-1.c", 20; RPAREN,
+	.dbg	line,	"tests/enum-1.c", 21; CSET
+	.dbg	line,	"tests/enum-1.c", 22; } token;
+	.dbg	line,	"tests/enum-1.c", 24; static token tok;
+	.dbg	line,	"tests/enum-1.c", 26; static int
+	.dbg	line,	"tests/enum-1.c", 27; atom ()
+	.dbg	line,	"tests/enum-1.c", 28; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_atom
+	__enter		_atom
+
+	.dbg	line,	"tests/enum-1.c", 29; if ((tok >= 0 && tok < (1 << 8 ) ) || tok >= CSET || tok == BACKREF
+	__ld.wm		_tok
+	__sge_w.wi	0
+	__bfalse	.LL4
+	__ld.wm		_tok
+	__slt_w.wi	256
+.LL4:
+	__btrue		.LL5
+	__ld.wm		_tok
+	__sge_w.wi	273
+.LL5:
+	__btrue		.LL6
+	__ld.wm		_tok
+	__equ_w.wi	257
+
+	.dbg	line,	"tests/enum-1.c", 30; || tok == BEGLINE || tok == ENDLINE || tok == BEGWORD
+.LL6:
+	__btrue		.LL7
+	__ld.wm		_tok
+	__equ_w.wi	258
+.LL7:
+	__btrue		.LL8
+	__ld.wm		_tok
+	__equ_w.wi	259
+.LL8:
+	__btrue		.LL9
+	__ld.wm		_tok
+	__equ_w.wi	260
+
+	.dbg	line,	"tests/enum-1.c", 31; || tok == ENDWORD || tok == LIMWORD || tok == NOTLIMWORD)
+.LL9:
+	__btrue		.LL10
+	__ld.wm		_tok
+	__equ_w.wi	261
+.LL10:
+	__btrue		.LL11
+	__ld.wm		_tok
+	__equ_w.wi	262
+.LL11:
+	__btrue		.LL12
+	__ld.wm		_tok
+	__equ_w.wi	263
+.LL12:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/enum-1.c", 32; return 1;
+	__ld.wi		1
+	__bra		.LL2
+
+	.dbg	line,	"tests/enum-1.c", 33; else
+.LL3:
+
+	.dbg	line,	"tests/enum-1.c", 34; return 0;
+	__ld.wi		0
+.LL13:
+
+	.dbg	line,	"tests/enum-1.c", 35; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/enum-1.c", 37; main ()
+	.dbg	line,	"tests/enum-1.c", 38; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/enum-1.c", 39; tok = 0;
+	__st.wmiq	0, _tok
+
+	.dbg	line,	"tests/enum-1.c", 40; if (atom () != 1)
+	__call		_atom
+	__neq_w.wi	1
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/enum-1.c", 41; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/enum-1.c", 42; exit (0);
+.LL15:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/enum-1.c", 43; }
+.LL14:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        22     22     2  tok
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_tok, 2, 22, 22
+	.endm
@@ -0,0 +1,119 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/enum-2.c", 1; /* Copyright (C) 2000 Free Software Foundation */
+	.dbg	line,	"tests/enum-2.c", 2; /* by Alexandre Oliva  <aoliva@redhat.com> */
+	.dbg	line,	"tests/enum-2.c", 4; enum foo { FOO, BAR };
+	.dbg	line,	"tests/enum-2.c", 6; /* Even though the underlying type of an enum is unspecified, the type
+	.dbg	line,	"tests/enum-2.c", 7; of enumeration constants is explicitly defined as int (6.4.4.3/2 in
+	.dbg	line,	"tests/enum-2.c", 8; the C99 Standard).  Therefore, `i' must not be promoted to
+	.dbg	line,	"tests/enum-2.c", 9; `unsigned' in the comparison below; we must exit the loop when it
+	.dbg	line,	"tests/enum-2.c", 10; becomes negative. */
+	.dbg	line,	"tests/enum-2.c", 12; int
+	.dbg	line,	"tests/enum-2.c", 13; main ()
+	.dbg	line,	"tests/enum-2.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/enum-2.c", 15; int i;
+
+	.dbg	line,	"tests/enum-2.c", 16; for (i = BAR; i >= FOO; --i)
+	__st.wmiq	1, __main_end - 2  /* i */
+.LL3:
+	__ld.wm		__main_end - 2  /* i */
+	__sge_w.wi	0
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__dec.wmq	__main_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/enum-2.c", 17; if (i == -1)
+	__ld.wm		__main_end - 2  /* i */
+	__equ_w.wi	-1
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/enum-2.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/enum-2.c", 20; exit (0);
+.LL7	.alias		.LL4
+	__bra		.LL4
+.LL6:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/enum-2.c", 21; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
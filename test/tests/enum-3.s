@@ -0,0 +1,144 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/enum-3.c", 1; /* The composite type of int and an enum compatible with int might be
+	.dbg	line,	"tests/enum-3.c", 2; either of the two types, but it isn't an unsigned type.  */
+	.dbg	line,	"tests/enum-3.c", 3; /* Origin: Joseph Myers <jsm@polyomino.org.uk> */
+	.dbg	line,	"tests/enum-3.c", 5; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/enum-3.c", 7; //#include <stdio.h>
+	.dbg	line,	"tests/enum-3.c", 9; extern void abort (void);
+	.dbg	line,	"tests/enum-3.c", 10; extern void exit (int);
+	.dbg	line,	"tests/enum-3.c", 12; enum e { a = INT_MIN };
+	.dbg	line,	"tests/enum-3.c", 14; int *p;
+	.dbg	line,	"tests/enum-3.c", 15; enum e *q;
+	.dbg	line,	"tests/enum-3.c", 16; int
+	.dbg	line,	"tests/enum-3.c", 17; main (void)
+	.dbg	line,	"tests/enum-3.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/enum-3.c", 19; enum e x = a;
+	__st.wmiq	-32768, __main_end - 2  /* x */
+
+	.dbg	line,	"tests/enum-3.c", 20; q = &x;
+	__ld.wi		__main_end - 2  /* x */
+	__st.wmq	_q
+
+	.dbg	line,	"tests/enum-3.c", 21; if (*(1 ? q : p) > 0)
+	__ld.wi		1
+	__tst.wr
+	__bfalse	.LL4
+	__ld.wm		_q
+	__bra		.LL5
+.LL4:
+	__ld.wm		_p
+.LL5:
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__sgt_w.wi	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/enum-3.c", 22; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/enum-3.c", 23; exit (0);
+.LL3:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/enum-3.c", 24; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  q
+;         2      2     2  p
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_q, 2, 4, 4
+	auto_zp_var	_p, 2, 2, 2
+	.endm
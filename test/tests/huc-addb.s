@@ -0,0 +1,162 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:09 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-addb.c", 1; const char a[5] = {4, 3, 2, 1, 0};
+	.dbg	line,	"tests/huc-addb.c", 2; signed char i;
+	.dbg	line,	"tests/huc-addb.c", 4; main()
+	.dbg	line,	"tests/huc-addb.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-addb.c", 6; char *x;
+
+	.dbg	line,	"tests/huc-addb.c", 7; x = a + 2;
+	__ld.wi		_a + 2
+	__st.wmq	__main_end - 2  /* x */
+
+	.dbg	line,	"tests/huc-addb.c", 8; i = 0;
+	__st.umiq	0, _i
+
+	.dbg	line,	"tests/huc-addb.c", 9; if (x[i] != 2)
+	__ld.bm		_i
+	__add.wm	__main_end - 2  /* x */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	2
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-addb.c", 10; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-addb.c", 11; i = 1;
+.LL3:
+	__st.umiq	1, _i
+
+	.dbg	line,	"tests/huc-addb.c", 12; if (x[i] != 1)
+	__ld.bm		_i
+	__add.wm	__main_end - 2  /* x */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	1
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-addb.c", 13; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-addb.c", 14; i = -1;
+.LL4:
+	__st.umiq	-1, _i
+
+	.dbg	line,	"tests/huc-addb.c", 15; if (x[i] != 3)
+	__ld.bm		_i
+	__add.wm	__main_end - 2  /* x */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	3
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-addb.c", 16; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-addb.c", 17; return 0;
+.LL5:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-addb.c", 18; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_a:
+		db	4
+		db	3
+		db	2
+		db	1
+		db	0
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:5
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         9      9     1  i
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_i, 1, 9, 9
+	.endm
@@ -0,0 +1,145 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-addxs.c", 1; const char a[5] = {1, 2, 3, 4, 5};
+	.dbg	line,	"tests/huc-addxs.c", 3; main()
+	.dbg	line,	"tests/huc-addxs.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-addxs.c", 5; unsigned char u = 2;
+	__st.umiq	2, __main_end - 1  /* u */
+
+	.dbg	line,	"tests/huc-addxs.c", 6; signed char s = -1;
+	__st.umiq	-1, __main_end - 2  /* s */
+
+	.dbg	line,	"tests/huc-addxs.c", 7; int i = 1;
+	__st.wmiq	1, __main_end - 4  /* i */
+
+	.dbg	line,	"tests/huc-addxs.c", 8; char *b;
+
+	.dbg	line,	"tests/huc-addxs.c", 9; b = a + 2;
+	__ld.wi		_a + 2
+	__st.wmq	__main_end - 6  /* b */
+
+	.dbg	line,	"tests/huc-addxs.c", 10; if (b[u] != 5)
+	__add.um	__main_end - 1  /* u */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	5
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-addxs.c", 11; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-addxs.c", 12; if (b[s] != 2)
+.LL3:
+	__ld.bm		__main_end - 2  /* s */
+	__add.wm	__main_end - 6  /* b */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	2
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-addxs.c", 13; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-addxs.c", 14; if (b[i] != 4)
+.LL4:
+	__ld.wm		__main_end - 6  /* b */
+	__add.wm	__main_end - 4  /* i */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	4
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-addxs.c", 15; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-addxs.c", 16; return 0;
+.LL5:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-addxs.c", 17; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_a:
+		db	1
+		db	2
+		db	3
+		db	4
+		db	5
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:5
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
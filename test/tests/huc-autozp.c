@@ -0,0 +1,55 @@
+/* variables that -fauto-zp can move into zero page */
+
+struct point {
+  int x;
+  int y;
+};
+
+unsigned char i, j;
+int sum;
+char *p;
+struct point pt;
+int table[20];
+unsigned char unused;
+
+int count(int n)
+{
+  static int calls;
+  int k, t;
+
+  calls++;
+  t = 0;
+  for (k = 0; k < n; k++)
+    t += k;
+  return t + calls;
+}
+
+int main()
+{
+  int k;
+
+  sum = 0;
+  for (i = 0; i < 10; i++)
+    for (j = 0; j < 10; j++)
+      sum += i;
+  if (sum != 450)
+    exit(1);
+
+  p = "hello";
+  if (p[1] != 'e' || *(p + 4) != 'o')
+    exit(2);
+
+  pt.x = 3;
+  pt.y = pt.x * 2;
+  for (k = 0; k < 20; k++)
+    table[k] = k + pt.y;
+  if (table[19] != 25 || pt.y != 6)
+    exit(3);
+
+  k = count(4);
+  k += count(5);
+  if (k != (6 + 1) + (10 + 2))
+    exit(4);
+
+  return 0;
+}
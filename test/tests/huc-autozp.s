@@ -0,0 +1,358 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-autozp.c", 1; /* variables that -fauto-zp can move into zero page */
+	.dbg	line,	"tests/huc-autozp.c", 3; struct point {
+	.dbg	line,	"tests/huc-autozp.c", 4; int x;
+	.dbg	line,	"tests/huc-autozp.c", 5; int y;
+	.dbg	line,	"tests/huc-autozp.c", 6; };
+	.dbg	line,	"tests/huc-autozp.c", 8; unsigned char i, j;
+	.dbg	line,	"tests/huc-autozp.c", 9; int sum;
+	.dbg	line,	"tests/huc-autozp.c", 10; char *p;
+	.dbg	line,	"tests/huc-autozp.c", 11; struct point pt;
+	.dbg	line,	"tests/huc-autozp.c", 12; int table[20];
+	.dbg	line,	"tests/huc-autozp.c", 13; unsigned char unused;
+	.dbg	line,	"tests/huc-autozp.c", 15; int count(int n)
+	.dbg	line,	"tests/huc-autozp.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_count
+	__enter		_count
+
+	.dbg	line,	"tests/huc-autozp.c", 17; static int calls;
+
+	.dbg	line,	"tests/huc-autozp.c", 18; int k, t;
+
+	.dbg	line,	"tests/huc-autozp.c", 20; calls++;
+	__inc.wmq	SL3  /* calls */
+
+	.dbg	line,	"tests/huc-autozp.c", 21; t = 0;
+	__st.wmiq	0, __count_end - 4  /* t */
+
+	.dbg	line,	"tests/huc-autozp.c", 22; for (k = 0; k < n; k++)
+	__st.wmiq	0, __count_end - 2  /* k */
+.LL4:
+	__ld.wm		__count_end - 2  /* k */
+	__slt_w.ws	0  /* n */
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__count_end - 2  /* k */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/huc-autozp.c", 23; t += k;
+	__ld.wm		__count_end - 2  /* k */
+	__add_st.wmq	__count_end - 4  /* t */
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/huc-autozp.c", 24; return t + calls;
+	__ld.wm		__count_end - 4  /* t */
+	__add.wm	SL3  /* calls */
+.LL2:
+
+	.dbg	line,	"tests/huc-autozp.c", 25; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__count_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-autozp.c", 27; int main()
+	.dbg	line,	"tests/huc-autozp.c", 28; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-autozp.c", 29; int k;
+
+	.dbg	line,	"tests/huc-autozp.c", 31; sum = 0;
+	__st.wmiq	0, _sum
+
+	.dbg	line,	"tests/huc-autozp.c", 32; for (i = 0; i < 10; i++)
+	__st.umiq	0, _i
+.LL9:
+	__ld.umq	_i
+	__ult_b.uiq	10
+	__btrue		.LL11
+	__bra		.LL12
+.LL10:
+	__inc.umq	_i
+	__bra		.LL9
+.LL11:
+
+	.dbg	line,	"tests/huc-autozp.c", 33; for (j = 0; j < 10; j++)
+	__st.umiq	0, _j
+.LL13:
+	__ld.umq	_j
+	__ult_b.uiq	10
+	__btrue		.LL15
+	__bra		.LL16
+.LL14:
+	__inc.umq	_j
+	__bra		.LL13
+.LL15:
+
+	.dbg	line,	"tests/huc-autozp.c", 34; sum += i;
+	__ld.um		_i
+	__add_st.wmq	_sum
+	__bra		.LL14
+.LL16	.alias		.LL10
+.LL12:
+
+	.dbg	line,	"tests/huc-autozp.c", 35; if (sum != 450)
+	__ld.wm		_sum
+	__neq_w.wi	450
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/huc-autozp.c", 36; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-autozp.c", 38; p = "hello";
+.LL17:
+	__ld.wi		__const1+0
+	__st.wmq	_p
+
+	.dbg	line,	"tests/huc-autozp.c", 39; if (p[1] != 'e' || *(p + 4) != 'o')
+	__add.wi	1
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	101
+	__btrue		.LL19
+	__ld.wm		_p
+	__add.wi	4
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	111
+.LL19:
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/huc-autozp.c", 40; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-autozp.c", 42; pt.x = 3;
+.LL18:
+	__st.wmiq	3, _pt
+
+	.dbg	line,	"tests/huc-autozp.c", 43; pt.y = pt.x * 2;
+	__ld.wm		_pt
+	__asl.wi	1
+	__st.wmq	_pt + 2
+
+	.dbg	line,	"tests/huc-autozp.c", 44; for (k = 0; k < 20; k++)
+	__st.wmiq	0, __main_end - 2  /* k */
+.LL20:
+	__ld.wm		__main_end - 2  /* k */
+	__slt_w.wi	20
+	__btrue		.LL22
+	__bra		.LL23
+.LL21:
+	__inc.wmq	__main_end - 2  /* k */
+	__bra		.LL20
+.LL22:
+
+	.dbg	line,	"tests/huc-autozp.c", 45; table[k] = k + pt.y;
+	__ld.wm		__main_end - 2  /* k */
+	__add.wm	_pt + 2
+	__ld2x.wm	__main_end - 2  /* k */
+	__st.waxq	_table
+	__bra		.LL21
+.LL23:
+
+	.dbg	line,	"tests/huc-autozp.c", 46; if (table[19] != 25 || pt.y != 6)
+	__ld.wm		_table + 38
+	__neq_w.wi	25
+	__btrue		.LL25
+	__ld.wm		_pt + 2
+	__neq_w.wi	6
+.LL25:
+	__bfalse	.LL24
+
+	.dbg	line,	"tests/huc-autozp.c", 47; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-autozp.c", 49; k = count(4);
+.LL24:
+	__ld.wi		4
+	__pusharg.wr
+	__inc.wmq	SL3  /* calls */
+	__st.wmiq	0, __count_end - 4  /* t */
+	__st.wmiq	0, __count_end - 2  /* k */
+.LL26:
+	__ld.wm		__count_end - 2  /* k */
+	__slt_w.ws	0  /* n */
+	__btrue		.LL28
+	__bra		.LL29
+.LL27:
+	__inc.wmq	__count_end - 2  /* k */
+	__bra		.LL26
+.LL28:
+	__ld.wm		__count_end - 2  /* k */
+	__add_st.wmq	__count_end - 4  /* t */
+	__bra		.LL27
+.LL29:
+	__ld.wm		__count_end - 4  /* t */
+	__add.wm	SL3  /* calls */
+.LL30:
+	__modsp		2
+	__st.wmq	__main_end - 2  /* k */
+
+	.dbg	line,	"tests/huc-autozp.c", 50; k += count(5);
+	__ld.wi		5
+	__pusharg.wr
+	__inc.wmq	SL3  /* calls */
+	__st.wmiq	0, __count_end - 4  /* t */
+	__st.wmiq	0, __count_end - 2  /* k */
+.LL31:
+	__ld.wm		__count_end - 2  /* k */
+	__slt_w.ws	0  /* n */
+	__btrue		.LL33
+	__bra		.LL34
+.LL32:
+	__inc.wmq	__count_end - 2  /* k */
+	__bra		.LL31
+.LL33:
+	__ld.wm		__count_end - 2  /* k */
+	__add_st.wmq	__count_end - 4  /* t */
+	__bra		.LL32
+.LL34:
+	__ld.wm		__count_end - 4  /* t */
+	__add.wm	SL3  /* calls */
+.LL35:
+	__modsp		2
+	__add_st.wmq	__main_end - 2  /* k */
+
+	.dbg	line,	"tests/huc-autozp.c", 51; if (k != (6 + 1) + (10 + 2))
+	__ld.wm		__main_end - 2  /* k */
+	__neq_w.wi	19
+	__bfalse	.LL36
+
+	.dbg	line,	"tests/huc-autozp.c", 52; exit(4);
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-autozp.c", 54; return 0;
+.LL36:
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"tests/huc-autozp.c", 55; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'h','e','l','l','o',$00
+
+	.bss
+_table:
+		ds	40
+
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:6
+;	constant pool:0
+;	global pool:11
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       384      6     1  j
+;       260      8     2  sum
+;       112      7     1  i
+;        86     16     2  overlaid locals
+;        14     14     2  calls (static in count())
+;        24     10     4  pt
+;         6      6     2  p
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_j, 1, 6, 384
+	auto_zp_var	_sum, 2, 8, 260
+	auto_zp_var	_i, 1, 7, 112
+	auto_zp_var	__overlay_frames, 2, 16, 86
+__main_end	=	__overlay_frames + 2
+	auto_zp_var	SL3, 2, 14, 14
+	auto_zp_var	_pt, 4, 10, 24
+	auto_zp_var	_p, 2, 6, 6
+	.endm
+
+	.bss
+_unused:
+		ds	1
+	.code
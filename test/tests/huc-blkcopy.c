@@ -0,0 +1,120 @@
+/* struct assignment, and loops that copy or fill arrays of bytes */
+
+#ifdef __HUCC__
+
+struct small {
+  unsigned char c;
+};
+
+struct point {
+  int x, y, z;
+};
+
+struct big {
+  int id;
+  unsigned char data[100];
+  int tail;
+};
+
+struct small s1, s2;
+struct point p1, p2, p3, pa[3];
+struct big b1, b2;
+unsigned char src[200], dst[200];
+unsigned char gi;
+
+int check (unsigned char *p, unsigned char first, unsigned char step, int n)
+{
+  int k;
+
+  for (k = 0; k < n; k++) {
+    if (p[k] != first)
+      return 1;
+    first += step;
+  }
+  return 0;
+}
+
+int main()
+{
+  struct point local, *pp, *pq;
+  unsigned char i;
+  int k;
+
+  /* struct assignment */
+  s2.c = 9;
+  s1 = s2;
+  if (s1.c != 9)
+    return 1;
+
+  p2.x = 1; p2.y = 2; p2.z = 3;
+  p1 = p2;
+  if (p1.x != 1 || p1.y != 2 || p1.z != 3)
+    return 2;
+
+  p3 = p1 = p2;
+  if (p3.z != 3 || p1.y != 2)
+    return 3;
+
+  local = p2;
+  if (local.x != 1 || local.z != 3)
+    return 4;
+
+  pp = &pa[1];
+  pq = &local;
+  local.y = 20;
+  *pp = *pq;
+  pa[2] = pa[1];
+  if (pa[1].y != 20 || pa[2].x != 1 || pa[2].z != 3)
+    return 5;
+
+  b2.id = 1234;
+  b2.tail = 5678;
+  for (k = 0; k < 100; k++)
+    b2.data[k] = k;
+  b1 = b2;
+  if (b1.id != 1234 || b1.tail != 5678 || check(b1.data, 0, 1, 100))
+    return 6;
+
+  /* copy and fill loops */
+  for (k = 0; k < 200; k++)
+    src[k] = k + 1;
+
+  for (i = 0; i < 40; i++)
+    dst[i] = src[i];
+  if (i != 40 || check(dst, 1, 1, 40) || dst[40] != 0)
+    return 7;
+
+  for (i = 0; i < 200; i++)
+    dst[i] = 0x55;
+  if (i != 200 || check(dst, 0x55, 0, 200))
+    return 8;
+
+  for (gi = 0; gi < 17; gi++)
+    dst[gi] = src[gi];
+  if (gi != 17 || check(dst, 1, 1, 17) || dst[17] != 0x55)
+    return 9;
+
+  for (k = 0; k < 200; k++)
+    dst[k] = src[k];
+  if (k != 200 || check(dst, 1, 1, 200))
+    return 10;
+
+  k = 0;
+  while (k < 3) {
+    dst[k] = 0;
+    k++;
+  }
+  if (k != 3 || check(dst, 0, 0, 3) || dst[3] != 4)
+    return 11;
+
+  return 0;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,592 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-blkcopy.c", 1; /* struct assignment, and loops that copy or fill arrays of bytes */
+	.dbg	line,	"tests/huc-blkcopy.c", 3; #ifdef __HUCC__
+	.dbg	line,	"tests/huc-blkcopy.c", 5; struct small {
+	.dbg	line,	"tests/huc-blkcopy.c", 6; unsigned char c;
+	.dbg	line,	"tests/huc-blkcopy.c", 7; };
+	.dbg	line,	"tests/huc-blkcopy.c", 9; struct point {
+	.dbg	line,	"tests/huc-blkcopy.c", 10; int x, y, z;
+	.dbg	line,	"tests/huc-blkcopy.c", 11; };
+	.dbg	line,	"tests/huc-blkcopy.c", 13; struct big {
+	.dbg	line,	"tests/huc-blkcopy.c", 14; int id;
+	.dbg	line,	"tests/huc-blkcopy.c", 15; unsigned char data[100];
+	.dbg	line,	"tests/huc-blkcopy.c", 16; int tail;
+	.dbg	line,	"tests/huc-blkcopy.c", 17; };
+	.dbg	line,	"tests/huc-blkcopy.c", 19; struct small s1, s2;
+	.dbg	line,	"tests/huc-blkcopy.c", 20; struct point p1, p2, p3, pa[3];
+	.dbg	line,	"tests/huc-blkcopy.c", 21; struct big b1, b2;
+	.dbg	line,	"tests/huc-blkcopy.c", 22; unsigned char src[200], dst[200];
+	.dbg	line,	"tests/huc-blkcopy.c", 23; unsigned char gi;
+	.dbg	line,	"tests/huc-blkcopy.c", 25; int check (unsigned char *p, unsigned char first, unsigned char step, int n)
+	.dbg	line,	"tests/huc-blkcopy.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_check
+	__enter		_check
+
+	.dbg	line,	"tests/huc-blkcopy.c", 27; int k;
+
+	.dbg	line,	"tests/huc-blkcopy.c", 29; for (k = 0; k < n; k++) {
+	__st.wmiq	0, __check_end - 2  /* k */
+.LL3:
+	__ld.wm		__check_end - 2  /* k */
+	__slt_w.ws	0  /* n */
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__check_end - 2  /* k */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 30; if (p[k] != first)
+	__ld.ws		6  /* p */
+	__add.wm	__check_end - 2  /* k */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.usq	4  /* first */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/huc-blkcopy.c", 31; return 1;
+	__ld.wi		1
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-blkcopy.c", 32; first += step;
+.LL7:
+	__ld.us		2  /* step */
+	__add_st.usq	4  /* first */
+
+	.dbg	line,	"tests/huc-blkcopy.c", 33; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 34; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 35; }
+	__modsp		8
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__check_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-blkcopy.c", 37; int main()
+	.dbg	line,	"tests/huc-blkcopy.c", 38; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-blkcopy.c", 39; struct point local, *pp, *pq;
+
+	.dbg	line,	"tests/huc-blkcopy.c", 40; unsigned char i;
+
+	.dbg	line,	"tests/huc-blkcopy.c", 41; int k;
+
+	.dbg	line,	"tests/huc-blkcopy.c", 43; /* struct assignment */
+
+	.dbg	line,	"tests/huc-blkcopy.c", 44; s2.c = 9;
+	__st.umiq	9, _s2
+
+	.dbg	line,	"tests/huc-blkcopy.c", 45; s1 = s2;
+	__tii		_s2, _s1, 1
+
+	.dbg	line,	"tests/huc-blkcopy.c", 46; if (s1.c != 9)
+	__ld.umq	_s1
+	__neq_b.uiq	9
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/huc-blkcopy.c", 47; return 1;
+	__ld.wi		1
+	__bra		.LL8
+
+	.dbg	line,	"tests/huc-blkcopy.c", 49; p2.x = 1; p2.y = 2; p2.z = 3;
+.LL9:
+	__st.wmiq	1, _p2
+	__st.wmiq	2, _p2 + 2
+	__st.wmiq	3, _p2 + 4
+
+	.dbg	line,	"tests/huc-blkcopy.c", 50; p1 = p2;
+	__tii		_p2, _p1, 6
+
+	.dbg	line,	"tests/huc-blkcopy.c", 51; if (p1.x != 1 || p1.y != 2 || p1.z != 3)
+	__ld.wm		_p1
+	__neq_w.wi	1
+	__btrue		.LL11
+	__ld.wm		_p1 + 2
+	__neq_w.wi	2
+.LL11:
+	__btrue		.LL12
+	__ld.wm		_p1 + 4
+	__neq_w.wi	3
+.LL12:
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/huc-blkcopy.c", 52; return 2;
+	__ld.wi		2
+	__bra		.LL8
+
+	.dbg	line,	"tests/huc-blkcopy.c", 54; p3 = p1 = p2;
+.LL10:
+	__ld.wi		_p3
+	__push.wr
+	__ld.wi		_p1
+	__push.wr
+	__ld.wi		_p2
+	__copy.wt	6
+	__copy.wtq	6
+
+	.dbg	line,	"tests/huc-blkcopy.c", 55; if (p3.z != 3 || p1.y != 2)
+	__ld.wm		_p3 + 4
+	__neq_w.wi	3
+	__btrue		.LL14
+	__ld.wm		_p1 + 2
+	__neq_w.wi	2
+.LL14:
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/huc-blkcopy.c", 56; return 3;
+	__ld.wi		3
+	__bra		.LL8
+
+	.dbg	line,	"tests/huc-blkcopy.c", 58; local = p2;
+.LL13:
+	__tii		_p2, __main_end - 6  /* local */, 6
+
+	.dbg	line,	"tests/huc-blkcopy.c", 59; if (local.x != 1 || local.z != 3)
+	__ld.wm		__main_end - 6  /* local */
+	__neq_w.wi	1
+	__btrue		.LL16
+	__ld.wm		__main_end - 6 + 4  /* local */
+	__neq_w.wi	3
+.LL16:
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/huc-blkcopy.c", 60; return 4;
+	__ld.wi		4
+	__bra		.LL8
+
+	.dbg	line,	"tests/huc-blkcopy.c", 62; pp = &pa[1];
+.LL15:
+	__ld.wi		_pa + 6
+	__st.wmq	__main_end - 8  /* pp */
+
+	.dbg	line,	"tests/huc-blkcopy.c", 63; pq = &local;
+	__ld.wi		__main_end - 6  /* local */
+	__st.wmq	__main_end - 10  /* pq */
+
+	.dbg	line,	"tests/huc-blkcopy.c", 64; local.y = 20;
+	__st.wmiq	20, __main_end - 6 + 2  /* local */
+
+	.dbg	line,	"tests/huc-blkcopy.c", 65; *pp = *pq;
+	__ld.wm		__main_end - 8  /* pp */
+	__push.wr
+	__ld.wm		__main_end - 10  /* pq */
+	__copy.wtq	6
+
+	.dbg	line,	"tests/huc-blkcopy.c", 66; pa[2] = pa[1];
+	__tii		_pa + 6, _pa + 12, 6
+
+	.dbg	line,	"tests/huc-blkcopy.c", 67; if (pa[1].y != 20 || pa[2].x != 1 || pa[2].z != 3)
+	__ld.wm		_pa + 6 + 2
+	__neq_w.wi	20
+	__btrue		.LL18
+	__ld.wm		_pa + 12
+	__neq_w.wi	1
+.LL18:
+	__btrue		.LL19
+	__ld.wm		_pa + 12 + 4
+	__neq_w.wi	3
+.LL19:
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/huc-blkcopy.c", 68; return 5;
+	__ld.wi		5
+	__bra		.LL8
+
+	.dbg	line,	"tests/huc-blkcopy.c", 70; b2.id = 1234;
+.LL17:
+	__st.wmiq	1234, _b2
+
+	.dbg	line,	"tests/huc-blkcopy.c", 71; b2.tail = 5678;
+	__st.wmiq	5678, _b2 + 102
+
+	.dbg	line,	"tests/huc-blkcopy.c", 72; for (k = 0; k < 100; k++)
+	__st.wmiq	0, __main_end - 13  /* k */
+.LL20:
+	__ld.wm		__main_end - 13  /* k */
+	__slt_w.wi	100
+	__btrue		.LL22
+	__bra		.LL23
+.LL21:
+	__inc.wmq	__main_end - 13  /* k */
+	__bra		.LL20
+.LL22:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 73; b2.data[k] = k;
+	__ld.wi		_b2 + 2
+	__add.wm	__main_end - 13  /* k */
+	__push.wr
+	__ld.wm		__main_end - 13  /* k */
+	__st.utq
+	__bra		.LL21
+.LL23:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 74; b1 = b2;
+	__copy.mm	_b2, _b1, 104
+
+	.dbg	line,	"tests/huc-blkcopy.c", 75; if (b1.id != 1234 || b1.tail != 5678 || check(b1.data, 0, 1, 100))
+	__ld.wm		_b1
+	__neq_w.wi	1234
+	__btrue		.LL25
+	__ld.wm		_b1 + 102
+	__neq_w.wi	5678
+.LL25:
+	__btrue		.LL26
+	__ld.wi		_b1 + 2
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		100
+	__pusharg.wr
+	__call		_check
+	__tst.wr
+.LL26:
+	__bfalse	.LL24
+
+	.dbg	line,	"tests/huc-blkcopy.c", 76; return 6;
+	__ld.wi		6
+	__bra		.LL8
+
+	.dbg	line,	"tests/huc-blkcopy.c", 78; /* copy and fill loops */
+
+	.dbg	line,	"tests/huc-blkcopy.c", 79; for (k = 0; k < 200; k++)
+.LL24:
+	__st.wmiq	0, __main_end - 13  /* k */
+.LL27:
+	__ld.wm		__main_end - 13  /* k */
+	__slt_w.wi	200
+	__btrue		.LL29
+	__bra		.LL30
+.LL28:
+	__inc.wmq	__main_end - 13  /* k */
+	__bra		.LL27
+.LL29:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 80; src[k] = k + 1;
+	__ld.wm		__main_end - 13  /* k */
+	__add.wi	1
+	__ldx.wmq	__main_end - 13  /* k */
+	__st.uaxq	_src
+	__bra		.LL28
+.LL30:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 82; for (i = 0; i < 40; i++)
+	__tii		_src, _dst, 16
+	__tii		_src+16, _dst+16, 16
+	__tii		_src+32, _dst+32, 8
+	__st.umiq	40, __main_end - 11  /* i */
+.LL31:
+.LL32:
+.LL33:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 83; dst[i] = src[i];
+.LL34:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 84; if (i != 40 || check(dst, 1, 1, 40) || dst[40] != 0)
+	__ld.umq	__main_end - 11  /* i */
+	__neq_b.uiq	40
+	__btrue		.LL36
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		40
+	__pusharg.wr
+	__call		_check
+	__tst.wr
+.LL36:
+	__btrue		.LL37
+	__tst.um	_dst + 40
+.LL37:
+	__bfalse	.LL35
+
+	.dbg	line,	"tests/huc-blkcopy.c", 85; return 7;
+	__ld.wi		7
+	__bra		.LL8
+
+	.dbg	line,	"tests/huc-blkcopy.c", 87; for (i = 0; i < 200; i++)
+.LL35:
+	__st.umiq	85, _dst
+	__copy.mm	_dst, _dst+1, 199
+	__st.umiq	200, __main_end - 11  /* i */
+.LL38:
+.LL39:
+.LL40:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 88; dst[i] = 0x55;
+.LL41:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 89; if (i != 200 || check(dst, 0x55, 0, 200))
+	__ld.umq	__main_end - 11  /* i */
+	__neq_b.uiq	200
+	__btrue		.LL43
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		85
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		200
+	__pusharg.wr
+	__call		_check
+	__tst.wr
+.LL43:
+	__bfalse	.LL42
+
+	.dbg	line,	"tests/huc-blkcopy.c", 90; return 8;
+	__ld.wi		8
+	__bra		.LL8
+
+	.dbg	line,	"tests/huc-blkcopy.c", 92; for (gi = 0; gi < 17; gi++)
+.LL42:
+	__tii		_src, _dst, 16
+	__tii		_src+16, _dst+16, 1
+	__st.umiq	17, _gi
+.LL44:
+.LL45:
+.LL46:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 93; dst[gi] = src[gi];
+.LL47:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 94; if (gi != 17 || check(dst, 1, 1, 17) || dst[17] != 0x55)
+	__ld.umq	_gi
+	__neq_b.uiq	17
+	__btrue		.LL49
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		17
+	__pusharg.wr
+	__call		_check
+	__tst.wr
+.LL49:
+	__btrue		.LL50
+	__ld.umq	_dst + 17
+	__neq_b.uiq	85
+.LL50:
+	__bfalse	.LL48
+
+	.dbg	line,	"tests/huc-blkcopy.c", 95; return 9;
+	__ld.wi		9
+	__bra		.LL8
+
+	.dbg	line,	"tests/huc-blkcopy.c", 97; for (k = 0; k < 200; k++)
+.LL48:
+	__copy.mm	_src, _dst, 200
+	__st.wmiq	200, __main_end - 13  /* k */
+.LL51:
+.LL52:
+.LL53:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 98; dst[k] = src[k];
+.LL54:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 99; if (k != 200 || check(dst, 1, 1, 200))
+	__ld.wm		__main_end - 13  /* k */
+	__neq_w.wi	200
+	__btrue		.LL56
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		200
+	__pusharg.wr
+	__call		_check
+	__tst.wr
+.LL56:
+	__bfalse	.LL55
+
+	.dbg	line,	"tests/huc-blkcopy.c", 100; return 10;
+	__ld.wi		10
+	__bra		.LL8
+
+	.dbg	line,	"tests/huc-blkcopy.c", 102; k = 0;
+.LL55:
+	__st.umiq	0, _dst
+	__tii		_dst, _dst+1, 2
+	__st.wmiq	3, __main_end - 13  /* k */
+
+	.dbg	line,	"tests/huc-blkcopy.c", 103; while (k < 3) {
+.LL57:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 104; dst[k] = 0;
+
+	.dbg	line,	"tests/huc-blkcopy.c", 105; k++;
+
+	.dbg	line,	"tests/huc-blkcopy.c", 106; }
+.LL58:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 107; if (k != 3 || check(dst, 0, 0, 3) || dst[3] != 4)
+	__ld.wm		__main_end - 13  /* k */
+	__neq_w.wi	3
+	__btrue		.LL60
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__call		_check
+	__tst.wr
+.LL60:
+	__btrue		.LL61
+	__ld.umq	_dst + 3
+	__neq_b.uiq	4
+.LL61:
+	__bfalse	.LL59
+
+	.dbg	line,	"tests/huc-blkcopy.c", 108; return 11;
+	__ld.wi		11
+	__bra		.LL8
+
+	.dbg	line,	"tests/huc-blkcopy.c", 110; return 0;
+.LL59:
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"tests/huc-blkcopy.c", 111; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-blkcopy.c", 113; #else
+	.dbg	line,	"tests/huc-blkcopy.c", 115; int main()
+	.dbg	line,	"tests/huc-blkcopy.c", 116; {
+	.dbg	line,	"tests/huc-blkcopy.c", 117; return 0;
+	.dbg	line,	"tests/huc-blkcopy.c", 118; }
+	.dbg	line,	"tests/huc-blkcopy.c", 120; #endif
+	.dbg	clear
+
+	.bss
+_pa:
+		ds	18
+_b1:
+		ds	104
+_b2:
+		ds	104
+_src:
+		ds	200
+_dst:
+		ds	200
+
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:13
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    13  _main
+;
+; 13 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        65      9     1  gi
+;       460     82    13  overlaid locals
+;         4      4     1  s1
+;         4      4     1  s2
+;        12     12     6  p1
+;        12     12     6  p2
+;         4      4     6  p3
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_gi, 1, 9, 65
+	auto_zp_var	__overlay_frames, 13, 82, 460
+__main_end	=	__overlay_frames + 13
+	auto_zp_var	_s1, 1, 4, 4
+	auto_zp_var	_s2, 1, 4, 4
+	auto_zp_var	_p1, 6, 12, 12
+	auto_zp_var	_p2, 6, 12, 12
+	auto_zp_var	_p3, 6, 4, 4
+	.endm
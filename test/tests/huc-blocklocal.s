@@ -0,0 +1,163 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-blocklocal.c", 1; int foo(int a)
+	.dbg	line,	"tests/huc-blocklocal.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/huc-blocklocal.c", 3; for (;;) {
+.LL3:
+.LL4:
+.LL5:
+
+	.dbg	line,	"tests/huc-blocklocal.c", 4; int b;
+
+	.dbg	line,	"tests/huc-blocklocal.c", 5; b = a;
+	__ld.ws		0  /* a */
+	__st.wmq	__foo_end - 2  /* b */
+
+	.dbg	line,	"tests/huc-blocklocal.c", 6; return b;
+
+	.dbg	line,	"tests/huc-blocklocal.c", 7; }
+.LL6:
+
+	.dbg	line,	"tests/huc-blocklocal.c", 8; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-blocklocal.c", 10; int main()
+	.dbg	line,	"tests/huc-blocklocal.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-blocklocal.c", 12; int x;
+
+	.dbg	line,	"tests/huc-blocklocal.c", 13; x = 42;
+	__st.wmiq	42, __main_end - 2  /* x */
+
+	.dbg	line,	"tests/huc-blocklocal.c", 14; foo(23);
+	__ld.wi		23
+	__pusharg.wr
+.LL8:
+.LL9:
+.LL10:
+	__ld.ws		0  /* a */
+	__st.wmq	__foo_end - 2  /* b */
+.LL11:
+.LL12:
+	__modsp		2
+
+	.dbg	line,	"tests/huc-blocklocal.c", 15; if (x != 42)
+	__ld.wm		__main_end - 2  /* x */
+	__neq_w.wi	42
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/huc-blocklocal.c", 16; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-blocklocal.c", 17; return 0;
+.LL13:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/huc-blocklocal.c", 18; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 4, 4
+__main_end	=	__overlay_frames + 2
+	.endm
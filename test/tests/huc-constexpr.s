@@ -0,0 +1,172 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-constexpr.c", 1; main()
+	.dbg	line,	"tests/huc-constexpr.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-constexpr.c", 3; int a = 1 + 42;
+	__st.wmiq	43, __main_end - 2  /* a */
+
+	.dbg	line,	"tests/huc-constexpr.c", 4; int b = 2*23;
+	__st.wmiq	46, __main_end - 4  /* b */
+
+	.dbg	line,	"tests/huc-constexpr.c", 5; int c = 2 * 23 + 1;
+	__st.wmiq	47, __main_end - 6  /* c */
+
+	.dbg	line,	"tests/huc-constexpr.c", 6; int d = 1 + 2 * 23;
+	__st.wmiq	47, __main_end - 8  /* d */
+
+	.dbg	line,	"tests/huc-constexpr.c", 7; int e = -5;
+	__st.wmiq	-5, __main_end - 10  /* e */
+
+	.dbg	line,	"tests/huc-constexpr.c", 8; int f = -5+3;
+	__st.wmiq	-2, __main_end - 12  /* f */
+
+	.dbg	line,	"tests/huc-constexpr.c", 9; int g = 3+-5;
+	__st.wmiq	-2, __main_end - 14  /* g */
+
+	.dbg	line,	"tests/huc-constexpr.c", 10; int h = ~0;
+	__st.wmiq	-1, __main_end - 16  /* h */
+
+	.dbg	line,	"tests/huc-constexpr.c", 12; if (a != 43) exit(1);
+	__ld.wm		__main_end - 2  /* a */
+	__neq_w.wi	43
+	__bfalse	.LL3
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-constexpr.c", 13; if (b != 46) exit(2);
+.LL3:
+	__ld.wm		__main_end - 4  /* b */
+	__neq_w.wi	46
+	__bfalse	.LL4
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-constexpr.c", 14; if (c != 47) exit(3);
+.LL4:
+	__ld.wm		__main_end - 6  /* c */
+	__neq_w.wi	47
+	__bfalse	.LL5
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-constexpr.c", 15; if (d != 47) exit(4);
+.LL5:
+	__ld.wm		__main_end - 8  /* d */
+	__neq_w.wi	47
+	__bfalse	.LL6
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-constexpr.c", 16; if (e != -5) exit(5);
+.LL6:
+	__ld.wm		__main_end - 10  /* e */
+	__neq_w.wi	-5
+	__bfalse	.LL7
+	__ld.wi		5
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-constexpr.c", 17; if (f != -2) exit(6);
+.LL7:
+	__ld.wm		__main_end - 12  /* f */
+	__neq_w.wi	-2
+	__bfalse	.LL8
+	__ld.wi		6
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-constexpr.c", 18; if (g != -2) exit(7);
+.LL8:
+	__ld.wm		__main_end - 14  /* g */
+	__neq_w.wi	-2
+	__bfalse	.LL9
+	__ld.wi		7
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-constexpr.c", 19; if (h != -1) exit(8);
+.LL9:
+	__ld.wm		__main_end - 16  /* h */
+	__neq_w.wi	-1
+	__bfalse	.LL10
+	__ld.wi		8
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-constexpr.c", 20; return 0;
+.LL10:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-constexpr.c", 21; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 16
+leaf_needs	.set	16
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
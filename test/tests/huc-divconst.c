@@ -0,0 +1,89 @@
+/* division and modulo by constants that are not a power of 2 */
+
+#define CHECK_UCHAR(d, n) \
+  for (i = 0; i < 256; i++) { \
+    c = i; \
+    q = c / d; \
+    r = c % d; \
+    if (q * d + r != i || r >= d) \
+      exit(n); \
+  }
+
+#define CHECK_UINT(d, n) \
+  for (u = 0; u < 65535 - 97; u += 97) { \
+    q = u / d; \
+    r = u % d; \
+    if (q * d + r != u || r >= d) \
+      exit(n); \
+  }
+
+#define CHECK_SINT(d, a, n) \
+  for (s = -32000; s < 32000; s += 251) { \
+    t = s / d; \
+    v = s % d; \
+    if (t * (d) + v != s || v <= -a || v >= a) \
+      exit(n); \
+    if ((s < 0 && v > 0) || (s > 0 && v < 0)) \
+      exit(n); \
+  }
+
+unsigned char c;
+unsigned int i, u, q, r;
+int s, t, v;
+
+void check_uchar()
+{
+  CHECK_UCHAR(3, 1);
+  CHECK_UCHAR(5, 2);
+  CHECK_UCHAR(7, 3);
+  CHECK_UCHAR(10, 4);
+  CHECK_UCHAR(12, 5);
+  CHECK_UCHAR(24, 6);
+  CHECK_UCHAR(100, 7);
+  CHECK_UCHAR(129, 8);
+  CHECK_UCHAR(255, 9);
+}
+
+void check_uint()
+{
+
+  CHECK_UINT(3, 11);
+  CHECK_UINT(10, 12);
+  CHECK_UINT(24, 13);
+  CHECK_UINT(200, 14);
+  CHECK_UINT(255, 15);
+  CHECK_UINT(1000, 16);
+}
+
+void check_sint()
+{
+
+  CHECK_SINT(3, 3, 21);
+  CHECK_SINT(10, 10, 22);
+  CHECK_SINT(-7, 7, 23);
+  CHECK_SINT(200, 200, 24);
+  CHECK_SINT(1000, 1000, 25);
+}
+
+int main()
+{
+  check_uchar();
+  check_uint();
+  check_sint();
+
+  u = 65534;
+  if (u / 255 != 256 || u % 255 != 254)
+    exit(31);
+  u = 65535;
+  if (u / 255 != 257 || u % 255 != 0)
+    exit(32);
+
+  c = 255;
+  if (u / c != 257 || u % c != 0)
+    exit(33);
+  c = 254;
+  if (u / c != 258 || u % c != 3)
+    exit(34);
+
+  return 0;
+}
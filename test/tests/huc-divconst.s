@@ -0,0 +1,1135 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-divconst.c", 1; /* division and modulo by constants that are not a power of 2 */
+	.dbg	line,	"tests/huc-divconst.c", 3; #define CHECK_UCHAR(d, n) \
+	.dbg	line,	"tests/huc-divconst.c", 4; for (i = 0; i < 256; i++) { \
+	.dbg	line,	"tests/huc-divconst.c", 5; c = i; \
+	.dbg	line,	"tests/huc-divconst.c", 6; q = c / d; \
+	.dbg	line,	"tests/huc-divconst.c", 7; r = c % d; \
+	.dbg	line,	"tests/huc-divconst.c", 8; if (q * d + r != i || r >= d) \
+	.dbg	line,	"tests/huc-divconst.c", 9; exit(n); \
+	.dbg	line,	"tests/huc-divconst.c", 10; }
+	.dbg	line,	"tests/huc-divconst.c", 12; #define CHECK_UINT(d, n) \
+	.dbg	line,	"tests/huc-divconst.c", 13; for (u = 0; u < 65535 - 97; u += 97) { \
+	.dbg	line,	"tests/huc-divconst.c", 14; q = u / d; \
+	.dbg	line,	"tests/huc-divconst.c", 15; r = u % d; \
+	.dbg	line,	"tests/huc-divconst.c", 16; if (q * d + r != u || r >= d) \
+	.dbg	line,	"tests/huc-divconst.c", 17; exit(n); \
+	.dbg	line,	"tests/huc-divconst.c", 18; }
+	.dbg	line,	"tests/huc-divconst.c", 20; #define CHECK_SINT(d, a, n) \
+	.dbg	line,	"tests/huc-divconst.c", 21; for (s = -32000; s < 32000; s += 251) { \
+	.dbg	line,	"tests/huc-divconst.c", 22; t = s / d; \
+	.dbg	line,	"tests/huc-divconst.c", 23; v = s % d; \
+	.dbg	line,	"tests/huc-divconst.c", 24; if (t * (d) + v != s || v <= -a || v >= a) \
+	.dbg	line,	"tests/huc-divconst.c", 25; exit(n); \
+	.dbg	line,	"tests/huc-divconst.c", 26; if ((s < 0 && v > 0) || (s > 0 && v < 0)) \
+	.dbg	line,	"tests/huc-divconst.c", 27; exit(n); \
+	.dbg	line,	"tests/huc-divconst.c", 28; }
+	.dbg	line,	"tests/huc-divconst.c", 30; unsigned char c;
+	.dbg	line,	"tests/huc-divconst.c", 31; unsigned int i, u, q, r;
+	.dbg	line,	"tests/huc-divconst.c", 32; int s, t, v;
+	.dbg	line,	"tests/huc-divconst.c", 34; void check_uchar()
+	.dbg	line,	"tests/huc-divconst.c", 35; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_check_uchar
+	__enter		_check_uchar
+
+	.dbg	line,	"tests/huc-divconst.c", 36; CHECK_UCHAR(3, 1);
+	__st.wmiq	0, _i
+.LL3:
+	__ld.wm		_i
+	__ult_w.wi	256
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	_i
+	__bra		.LL3
+.LL5:
+	__ld.wm		_i
+	__st.umq	_c
+	__ld.um		_c
+	__udiv.uiq	171, 1
+	__st.wmq	_q
+	__ld.um		_c
+	__umod.uiq	3, 171, 1
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__add.wm	_r
+	__neq_w.wm	_i
+	__btrue		.LL8
+	__ld.wm		_r
+	__uge_w.wi	3
+.LL8:
+	__bfalse	.LL7
+	__ld.wi		1
+	__call		_exit.1
+.LL7	.alias		.LL4
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/huc-divconst.c", 37; CHECK_UCHAR(5, 2);
+	__st.wmiq	0, _i
+.LL9:
+	__ld.wm		_i
+	__ult_w.wi	256
+	__btrue		.LL11
+	__bra		.LL12
+.LL10:
+	__inc.wmq	_i
+	__bra		.LL9
+.LL11:
+	__ld.wm		_i
+	__st.umq	_c
+	__ld.um		_c
+	__udiv.uiq	205, 2
+	__st.wmq	_q
+	__ld.um		_c
+	__umod.uiq	5, 205, 2
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__add.wm	_r
+	__neq_w.wm	_i
+	__btrue		.LL14
+	__ld.wm		_r
+	__uge_w.wi	5
+.LL14:
+	__bfalse	.LL13
+	__ld.wi		2
+	__call		_exit.1
+.LL13	.alias		.LL10
+	__bra		.LL10
+.LL12:
+
+	.dbg	line,	"tests/huc-divconst.c", 38; CHECK_UCHAR(7, 3);
+	__st.wmiq	0, _i
+.LL15:
+	__ld.wm		_i
+	__ult_w.wi	256
+	__btrue		.LL17
+	__bra		.LL18
+.LL16:
+	__inc.wmq	_i
+	__bra		.LL15
+.LL17:
+	__ld.wm		_i
+	__st.umq	_c
+	__ld.um		_c
+	__udiv.uiq	293, 3
+	__st.wmq	_q
+	__ld.um		_c
+	__umod.uiq	7, 293, 3
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__add.wm	_r
+	__neq_w.wm	_i
+	__btrue		.LL20
+	__ld.wm		_r
+	__uge_w.wi	7
+.LL20:
+	__bfalse	.LL19
+	__ld.wi		3
+	__call		_exit.1
+.LL19	.alias		.LL16
+	__bra		.LL16
+.LL18:
+
+	.dbg	line,	"tests/huc-divconst.c", 39; CHECK_UCHAR(10, 4);
+	__st.wmiq	0, _i
+.LL21:
+	__ld.wm		_i
+	__ult_w.wi	256
+	__btrue		.LL23
+	__bra		.LL24
+.LL22:
+	__inc.wmq	_i
+	__bra		.LL21
+.LL23:
+	__ld.wm		_i
+	__st.umq	_c
+	__ld.um		_c
+	__udiv.uiq	205, 3
+	__st.wmq	_q
+	__ld.um		_c
+	__umod.uiq	10, 205, 3
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	_r
+	__neq_w.wm	_i
+	__btrue		.LL26
+	__ld.wm		_r
+	__uge_w.wi	10
+.LL26:
+	__bfalse	.LL25
+	__ld.wi		4
+	__call		_exit.1
+.LL25	.alias		.LL22
+	__bra		.LL22
+.LL24:
+
+	.dbg	line,	"tests/huc-divconst.c", 40; CHECK_UCHAR(12, 5);
+	__st.wmiq	0, _i
+.LL27:
+	__ld.wm		_i
+	__ult_w.wi	256
+	__btrue		.LL29
+	__bra		.LL30
+.LL28:
+	__inc.wmq	_i
+	__bra		.LL27
+.LL29:
+	__ld.wm		_i
+	__st.umq	_c
+	__ld.um		_c
+	__udiv.uiq	171, 3
+	__st.wmq	_q
+	__ld.um		_c
+	__umod.uiq	12, 171, 3
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	_r
+	__neq_w.wm	_i
+	__btrue		.LL32
+	__ld.wm		_r
+	__uge_w.wi	12
+.LL32:
+	__bfalse	.LL31
+	__ld.wi		5
+	__call		_exit.1
+.LL31	.alias		.LL28
+	__bra		.LL28
+.LL30:
+
+	.dbg	line,	"tests/huc-divconst.c", 41; CHECK_UCHAR(24, 6);
+	__st.wmiq	0, _i
+.LL33:
+	__ld.wm		_i
+	__ult_w.wi	256
+	__btrue		.LL35
+	__bra		.LL36
+.LL34:
+	__inc.wmq	_i
+	__bra		.LL33
+.LL35:
+	__ld.wm		_i
+	__st.umq	_c
+	__ld.um		_c
+	__udiv.uiq	171, 4
+	__st.wmq	_q
+	__ld.um		_c
+	__umod.uiq	24, 171, 4
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	_r
+	__neq_w.wm	_i
+	__btrue		.LL38
+	__ld.wm		_r
+	__uge_w.wi	24
+.LL38:
+	__bfalse	.LL37
+	__ld.wi		6
+	__call		_exit.1
+.LL37	.alias		.LL34
+	__bra		.LL34
+.LL36:
+
+	.dbg	line,	"tests/huc-divconst.c", 42; CHECK_UCHAR(100, 7);
+	__st.wmiq	0, _i
+.LL39:
+	__ld.wm		_i
+	__ult_w.wi	256
+	__btrue		.LL41
+	__bra		.LL42
+.LL40:
+	__inc.wmq	_i
+	__bra		.LL39
+.LL41:
+	__ld.wm		_i
+	__st.umq	_c
+	__ld.um		_c
+	__udiv.uiq	41, 4
+	__st.wmq	_q
+	__ld.um		_c
+	__umod.uiq	100, 41, 4
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	_r
+	__neq_w.wm	_i
+	__btrue		.LL44
+	__ld.wm		_r
+	__uge_w.wi	100
+.LL44:
+	__bfalse	.LL43
+	__ld.wi		7
+	__call		_exit.1
+.LL43	.alias		.LL40
+	__bra		.LL40
+.LL42:
+
+	.dbg	line,	"tests/huc-divconst.c", 43; CHECK_UCHAR(129, 8);
+	__st.wmiq	0, _i
+.LL45:
+	__ld.wm		_i
+	__ult_w.wi	256
+	__btrue		.LL47
+	__bra		.LL48
+.LL46:
+	__inc.wmq	_i
+	__bra		.LL45
+.LL47:
+	__ld.wm		_i
+	__st.umq	_c
+	__ld.um		_c
+	__udiv.uiq	255, 7
+	__st.wmq	_q
+	__ld.um		_c
+	__umod.uiq	129, 255, 7
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	7
+	__add.wm	<multiplicand
+	__add.wm	_r
+	__neq_w.wm	_i
+	__btrue		.LL50
+	__ld.wm		_r
+	__uge_w.wi	129
+.LL50:
+	__bfalse	.LL49
+	__ld.wi		8
+	__call		_exit.1
+.LL49	.alias		.LL46
+	__bra		.LL46
+.LL48:
+
+	.dbg	line,	"tests/huc-divconst.c", 44; CHECK_UCHAR(255, 9);
+	__st.wmiq	0, _i
+.LL51:
+	__ld.wm		_i
+	__ult_w.wi	256
+	__btrue		.LL53
+	__bra		.LL54
+.LL52:
+	__inc.wmq	_i
+	__bra		.LL51
+.LL53:
+	__ld.wm		_i
+	__st.umq	_c
+	__ld.um		_c
+	__udiv.uiq	129, 7
+	__st.wmq	_q
+	__ld.um		_c
+	__umod.uiq	255, 129, 7
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	8
+	__sub.wm	<multiplicand
+	__add.wm	_r
+	__neq_w.wm	_i
+	__btrue		.LL56
+	__ld.wm		_r
+	__uge_w.wi	255
+.LL56:
+	__bfalse	.LL55
+	__ld.wi		9
+	__call		_exit.1
+.LL55	.alias		.LL52
+	__bra		.LL52
+.LL54:
+
+	.dbg	line,	"tests/huc-divconst.c", 45; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-divconst.c", 47; void check_uint()
+	.dbg	line,	"tests/huc-divconst.c", 48; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_check_uint
+	__enter		_check_uint
+
+	.dbg	line,	"tests/huc-divconst.c", 50; CHECK_UINT(3, 11);
+	__st.wmiq	0, _u
+.LL58:
+	__ld.wm		_u
+	__ult_w.wi	65438
+	__btrue		.LL60
+	__bra		.LL61
+.LL59:
+	__add_st.wmiq	97, _u
+	__bra		.LL58
+.LL60:
+	__ld.wm		_u
+	__udiv.wi	3
+	__st.wmq	_q
+	__ld.wm		_u
+	__umod.wi	3
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__add.wm	_r
+	__neq_w.wm	_u
+	__btrue		.LL63
+	__ld.wm		_r
+	__uge_w.wi	3
+.LL63:
+	__bfalse	.LL62
+	__ld.wi		11
+	__call		_exit.1
+.LL62	.alias		.LL59
+	__bra		.LL59
+.LL61:
+
+	.dbg	line,	"tests/huc-divconst.c", 51; CHECK_UINT(10, 12);
+	__st.wmiq	0, _u
+.LL64:
+	__ld.wm		_u
+	__ult_w.wi	65438
+	__btrue		.LL66
+	__bra		.LL67
+.LL65:
+	__add_st.wmiq	97, _u
+	__bra		.LL64
+.LL66:
+	__ld.wm		_u
+	__udiv.wi	10
+	__st.wmq	_q
+	__ld.wm		_u
+	__umod.wi	10
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	_r
+	__neq_w.wm	_u
+	__btrue		.LL69
+	__ld.wm		_r
+	__uge_w.wi	10
+.LL69:
+	__bfalse	.LL68
+	__ld.wi		12
+	__call		_exit.1
+.LL68	.alias		.LL65
+	__bra		.LL65
+.LL67:
+
+	.dbg	line,	"tests/huc-divconst.c", 52; CHECK_UINT(24, 13);
+	__st.wmiq	0, _u
+.LL70:
+	__ld.wm		_u
+	__ult_w.wi	65438
+	__btrue		.LL72
+	__bra		.LL73
+.LL71:
+	__add_st.wmiq	97, _u
+	__bra		.LL70
+.LL72:
+	__ld.wm		_u
+	__udiv.wi	24
+	__st.wmq	_q
+	__ld.wm		_u
+	__umod.wi	24
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	_r
+	__neq_w.wm	_u
+	__btrue		.LL75
+	__ld.wm		_r
+	__uge_w.wi	24
+.LL75:
+	__bfalse	.LL74
+	__ld.wi		13
+	__call		_exit.1
+.LL74	.alias		.LL71
+	__bra		.LL71
+.LL73:
+
+	.dbg	line,	"tests/huc-divconst.c", 53; CHECK_UINT(200, 14);
+	__st.wmiq	0, _u
+.LL76:
+	__ld.wm		_u
+	__ult_w.wi	65438
+	__btrue		.LL78
+	__bra		.LL79
+.LL77:
+	__add_st.wmiq	97, _u
+	__bra		.LL76
+.LL78:
+	__ld.wm		_u
+	__udiv.wi	200
+	__st.wmq	_q
+	__ld.wm		_u
+	__umod.wi	200
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	_r
+	__neq_w.wm	_u
+	__btrue		.LL81
+	__ld.wm		_r
+	__uge_w.wi	200
+.LL81:
+	__bfalse	.LL80
+	__ld.wi		14
+	__call		_exit.1
+.LL80	.alias		.LL77
+	__bra		.LL77
+.LL79:
+
+	.dbg	line,	"tests/huc-divconst.c", 54; CHECK_UINT(255, 15);
+	__st.wmiq	0, _u
+.LL82:
+	__ld.wm		_u
+	__ult_w.wi	65438
+	__btrue		.LL84
+	__bra		.LL85
+.LL83:
+	__add_st.wmiq	97, _u
+	__bra		.LL82
+.LL84:
+	__ld.wm		_u
+	__udiv.wi	255
+	__st.wmq	_q
+	__ld.wm		_u
+	__umod.wi	255
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	8
+	__sub.wm	<multiplicand
+	__add.wm	_r
+	__neq_w.wm	_u
+	__btrue		.LL87
+	__ld.wm		_r
+	__uge_w.wi	255
+.LL87:
+	__bfalse	.LL86
+	__ld.wi		15
+	__call		_exit.1
+.LL86	.alias		.LL83
+	__bra		.LL83
+.LL85:
+
+	.dbg	line,	"tests/huc-divconst.c", 55; CHECK_UINT(1000, 16);
+	__st.wmiq	0, _u
+.LL88:
+	__ld.wm		_u
+	__ult_w.wi	65438
+	__btrue		.LL90
+	__bra		.LL91
+.LL89:
+	__add_st.wmiq	97, _u
+	__bra		.LL88
+.LL90:
+	__ld.wm		_u
+	__udiv.wi	1000
+	__st.wmq	_q
+	__ld.wm		_u
+	__umod.wi	1000
+	__st.wmq	_r
+	__ld.wm		_q
+	__st.wm	<multiplicand
+	__asl.wi	5
+	__sub.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	_r
+	__neq_w.wm	_u
+	__btrue		.LL93
+	__ld.wm		_r
+	__uge_w.wi	1000
+.LL93:
+	__bfalse	.LL92
+	__ld.wi		16
+	__call		_exit.1
+.LL92	.alias		.LL89
+	__bra		.LL89
+.LL91:
+
+	.dbg	line,	"tests/huc-divconst.c", 56; }
+.LL57:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-divconst.c", 58; void check_sint()
+	.dbg	line,	"tests/huc-divconst.c", 59; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_check_sint
+	__enter		_check_sint
+
+	.dbg	line,	"tests/huc-divconst.c", 61; CHECK_SINT(3, 3, 21);
+	__st.wmiq	-32000, _s
+.LL95:
+	__ld.wm		_s
+	__slt_w.wi	32000
+	__btrue		.LL97
+	__bra		.LL98
+.LL96:
+	__add_st.wmiq	251, _s
+	__bra		.LL95
+.LL97:
+	__ld.wm		_s
+	__sdiv.wi	3
+	__st.wmq	_t
+	__ld.wm		_s
+	__smod.wi	3
+	__st.wmq	_v
+	__ld.wm		_t
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__add.wm	_v
+	__neq_w.wm	_s
+	__btrue		.LL100
+	__ld.wm		_v
+	__sle_w.wi	-3
+.LL100:
+	__btrue		.LL101
+	__ld.wm		_v
+	__sge_w.wi	3
+.LL101:
+	__bfalse	.LL99
+	__ld.wi		21
+	__call		_exit.1
+.LL99:
+	__ld.wm		_s
+	__slt_w.wi	0
+	__bfalse	.LL103
+	__ld.wm		_v
+	__sgt_w.wi	0
+.LL103:
+	__btrue		.LL104
+	__ld.wm		_s
+	__sgt_w.wi	0
+	__bfalse	.LL105
+	__ld.wm		_v
+	__slt_w.wi	0
+.LL105:
+.LL104:
+	__bfalse	.LL102
+	__ld.wi		21
+	__call		_exit.1
+.LL102	.alias		.LL96
+	__bra		.LL96
+.LL98:
+
+	.dbg	line,	"tests/huc-divconst.c", 62; CHECK_SINT(10, 10, 22);
+	__st.wmiq	-32000, _s
+.LL106:
+	__ld.wm		_s
+	__slt_w.wi	32000
+	__btrue		.LL108
+	__bra		.LL109
+.LL107:
+	__add_st.wmiq	251, _s
+	__bra		.LL106
+.LL108:
+	__ld.wm		_s
+	__sdiv.wi	10
+	__st.wmq	_t
+	__ld.wm		_s
+	__smod.wi	10
+	__st.wmq	_v
+	__ld.wm		_t
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	_v
+	__neq_w.wm	_s
+	__btrue		.LL111
+	__ld.wm		_v
+	__sle_w.wi	-10
+.LL111:
+	__btrue		.LL112
+	__ld.wm		_v
+	__sge_w.wi	10
+.LL112:
+	__bfalse	.LL110
+	__ld.wi		22
+	__call		_exit.1
+.LL110:
+	__ld.wm		_s
+	__slt_w.wi	0
+	__bfalse	.LL114
+	__ld.wm		_v
+	__sgt_w.wi	0
+.LL114:
+	__btrue		.LL115
+	__ld.wm		_s
+	__sgt_w.wi	0
+	__bfalse	.LL116
+	__ld.wm		_v
+	__slt_w.wi	0
+.LL116:
+.LL115:
+	__bfalse	.LL113
+	__ld.wi		22
+	__call		_exit.1
+.LL113	.alias		.LL107
+	__bra		.LL107
+.LL109:
+
+	.dbg	line,	"tests/huc-divconst.c", 63; CHECK_SINT(-7, 7, 23);
+	__st.wmiq	-32000, _s
+.LL117:
+	__ld.wm		_s
+	__slt_w.wi	32000
+	__btrue		.LL119
+	__bra		.LL120
+.LL118:
+	__add_st.wmiq	251, _s
+	__bra		.LL117
+.LL119:
+	__ld.wm		_s
+	__sdiv.wi	-7
+	__st.wmq	_t
+	__ld.wm		_s
+	__smod.wi	-7
+	__st.wmq	_v
+	__ld.wm		_t
+	.if	FAST_MULTIPLY
+	__mul.wi	65529
+	.else
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	.endif
+	__add.wm	_v
+	__neq_w.wm	_s
+	__btrue		.LL122
+	__ld.wm		_v
+	__sle_w.wi	-7
+.LL122:
+	__btrue		.LL123
+	__ld.wm		_v
+	__sge_w.wi	7
+.LL123:
+	__bfalse	.LL121
+	__ld.wi		23
+	__call		_exit.1
+.LL121:
+	__ld.wm		_s
+	__slt_w.wi	0
+	__bfalse	.LL125
+	__ld.wm		_v
+	__sgt_w.wi	0
+.LL125:
+	__btrue		.LL126
+	__ld.wm		_s
+	__sgt_w.wi	0
+	__bfalse	.LL127
+	__ld.wm		_v
+	__slt_w.wi	0
+.LL127:
+.LL126:
+	__bfalse	.LL124
+	__ld.wi		23
+	__call		_exit.1
+.LL124	.alias		.LL118
+	__bra		.LL118
+.LL120:
+
+	.dbg	line,	"tests/huc-divconst.c", 64; CHECK_SINT(200, 200, 24);
+	__st.wmiq	-32000, _s
+.LL128:
+	__ld.wm		_s
+	__slt_w.wi	32000
+	__btrue		.LL130
+	__bra		.LL131
+.LL129:
+	__add_st.wmiq	251, _s
+	__bra		.LL128
+.LL130:
+	__ld.wm		_s
+	__sdiv.wi	200
+	__st.wmq	_t
+	__ld.wm		_s
+	__smod.wi	200
+	__st.wmq	_v
+	__ld.wm		_t
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	_v
+	__neq_w.wm	_s
+	__btrue		.LL133
+	__ld.wm		_v
+	__sle_w.wi	-200
+.LL133:
+	__btrue		.LL134
+	__ld.wm		_v
+	__sge_w.wi	200
+.LL134:
+	__bfalse	.LL132
+	__ld.wi		24
+	__call		_exit.1
+.LL132:
+	__ld.wm		_s
+	__slt_w.wi	0
+	__bfalse	.LL136
+	__ld.wm		_v
+	__sgt_w.wi	0
+.LL136:
+	__btrue		.LL137
+	__ld.wm		_s
+	__sgt_w.wi	0
+	__bfalse	.LL138
+	__ld.wm		_v
+	__slt_w.wi	0
+.LL138:
+.LL137:
+	__bfalse	.LL135
+	__ld.wi		24
+	__call		_exit.1
+.LL135	.alias		.LL129
+	__bra		.LL129
+.LL131:
+
+	.dbg	line,	"tests/huc-divconst.c", 65; CHECK_SINT(1000, 1000, 25);
+	__st.wmiq	-32000, _s
+.LL139:
+	__ld.wm		_s
+	__slt_w.wi	32000
+	__btrue		.LL141
+	__bra		.LL142
+.LL140:
+	__add_st.wmiq	251, _s
+	__bra		.LL139
+.LL141:
+	__ld.wm		_s
+	__sdiv.wi	1000
+	__st.wmq	_t
+	__ld.wm		_s
+	__smod.wi	1000
+	__st.wmq	_v
+	__ld.wm		_t
+	__st.wm	<multiplicand
+	__asl.wi	5
+	__sub.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	_v
+	__neq_w.wm	_s
+	__btrue		.LL144
+	__ld.wm		_v
+	__sle_w.wi	-1000
+.LL144:
+	__btrue		.LL145
+	__ld.wm		_v
+	__sge_w.wi	1000
+.LL145:
+	__bfalse	.LL143
+	__ld.wi		25
+	__call		_exit.1
+.LL143:
+	__ld.wm		_s
+	__slt_w.wi	0
+	__bfalse	.LL147
+	__ld.wm		_v
+	__sgt_w.wi	0
+.LL147:
+	__btrue		.LL148
+	__ld.wm		_s
+	__sgt_w.wi	0
+	__bfalse	.LL149
+	__ld.wm		_v
+	__slt_w.wi	0
+.LL149:
+.LL148:
+	__bfalse	.LL146
+	__ld.wi		25
+	__call		_exit.1
+.LL146	.alias		.LL140
+	__bra		.LL140
+.LL142:
+
+	.dbg	line,	"tests/huc-divconst.c", 66; }
+.LL94:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-divconst.c", 68; int main()
+	.dbg	line,	"tests/huc-divconst.c", 69; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-divconst.c", 70; check_uchar();
+	__call		_check_uchar
+
+	.dbg	line,	"tests/huc-divconst.c", 71; check_uint();
+	__call		_check_uint
+
+	.dbg	line,	"tests/huc-divconst.c", 72; check_sint();
+	__call		_check_sint
+
+	.dbg	line,	"tests/huc-divconst.c", 74; u = 65534;
+	__st.wmiq	65534, _u
+
+	.dbg	line,	"tests/huc-divconst.c", 75; if (u / 255 != 256 || u % 255 != 254)
+	__ld.wm		_u
+	__udiv.wi	255
+	__neq_w.wi	256
+	__btrue		.LL152
+	__ld.wm		_u
+	__umod.wi	255
+	__neq_w.wi	254
+.LL152:
+	__bfalse	.LL151
+
+	.dbg	line,	"tests/huc-divconst.c", 76; exit(31);
+	__ld.wi		31
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-divconst.c", 77; u = 65535;
+.LL151:
+	__st.wmiq	65535, _u
+
+	.dbg	line,	"tests/huc-divconst.c", 78; if (u / 255 != 257 || u % 255 != 0)
+	__ld.wm		_u
+	__udiv.wi	255
+	__neq_w.wi	257
+	__btrue		.LL154
+	__ld.wm		_u
+	__umod.wi	255
+	__tst.wr
+.LL154:
+	__bfalse	.LL153
+
+	.dbg	line,	"tests/huc-divconst.c", 79; exit(32);
+	__ld.wi		32
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-divconst.c", 81; c = 255;
+.LL153:
+	__st.umiq	255, _c
+
+	.dbg	line,	"tests/huc-divconst.c", 82; if (u / c != 257 || u % c != 0)
+	__ld.wm		_u
+	__push.wr
+	__ld.um		_c
+	__udiv.wt
+	__neq_w.wi	257
+	__btrue		.LL156
+	__ld.wm		_u
+	__push.wr
+	__ld.um		_c
+	__umod.wt
+	__tst.wr
+.LL156:
+	__bfalse	.LL155
+
+	.dbg	line,	"tests/huc-divconst.c", 83; exit(33);
+	__ld.wi		33
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-divconst.c", 84; c = 254;
+.LL155:
+	__st.umiq	254, _c
+
+	.dbg	line,	"tests/huc-divconst.c", 85; if (u / c != 258 || u % c != 3)
+	__ld.wm		_u
+	__push.wr
+	__ld.um		_c
+	__udiv.wt
+	__neq_w.wi	258
+	__btrue		.LL158
+	__ld.wm		_u
+	__push.wr
+	__ld.um		_c
+	__umod.wt
+	__neq_w.wi	3
+.LL158:
+	__bfalse	.LL157
+
+	.dbg	line,	"tests/huc-divconst.c", 86; exit(34);
+	__ld.wi		34
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-divconst.c", 88; return 0;
+.LL157:
+	__ld.wi		0
+.LL150:
+
+	.dbg	line,	"tests/huc-divconst.c", 89; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:13
+;	Macro pool:9
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       864    108     2  i
+;       720     90     2  r
+;       720     90     2  s
+;       692    104     2  u
+;       296     44     1  c
+;       480     60     2  q
+;       480     60     2  v
+;       160     20     2  t
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_i, 2, 108, 864
+	auto_zp_var	_r, 2, 90, 720
+	auto_zp_var	_s, 2, 90, 720
+	auto_zp_var	_u, 2, 104, 692
+	auto_zp_var	_c, 1, 44, 296
+	auto_zp_var	_q, 2, 60, 480
+	auto_zp_var	_v, 2, 60, 480
+	auto_zp_var	_t, 2, 20, 160
+	.endm
@@ -0,0 +1,89 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-enum2.c", 1; typedef enum foo x;
+	.dbg	line,	"tests/huc-enum2.c", 2; enum bar {
+	.dbg	line,	"tests/huc-enum2.c", 3; VIER = 4,
+	.dbg	line,	"tests/huc-enum2.c", 4; FUENF,
+	.dbg	line,	"tests/huc-enum2.c", 5; SECHS
+	.dbg	line,	"tests/huc-enum2.c", 6; };
+	.dbg	line,	"tests/huc-enum2.c", 7; enum foo {
+	.dbg	line,	"tests/huc-enum2.c", 8; EINS = 1,
+	.dbg	line,	"tests/huc-enum2.c", 9; ZWEI,
+	.dbg	line,	"tests/huc-enum2.c", 10; DREI
+	.dbg	line,	"tests/huc-enum2.c", 11; };
+	.dbg	line,	"tests/huc-enum2.c", 12; int main()
+	.dbg	line,	"tests/huc-enum2.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-enum2.c", 14; x a = ZWEI;
+	__st.wmiq	2, __main_end - 2  /* a */
+
+	.dbg	line,	"tests/huc-enum2.c", 15; return a - 2;
+	__ld.wm		__main_end - 2  /* a */
+	__sub.wi	2
+.LL2:
+
+	.dbg	line,	"tests/huc-enum2.c", 16; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:1
+;	Macro pool:6
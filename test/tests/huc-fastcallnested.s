@@ -0,0 +1,367 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-fastcallnested.c", 1; #include <string.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 3; #endif
+	.dbg	line,	"tests/huc-fastcallnested.c", 2; char *f() {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 3; #ifdef __HUCC__
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 4; // HuC can't handle this ...
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 5; strcmp("bad","wolf");
+	__ld.wi		__const1+0
+	__st.wmq	_di
+	__ld.wi		__const1+4
+	__st.wmq	_bp
+	__call		_strcmp.2
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 6; #endif
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 7; return "f";
+	__ld.wi		__const1+9
+.LL2:
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 8; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 9; char *g() {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 10; #ifdef __HUCC__
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 11; // HuC can't handle this ...
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 12; strcmp("bad","wolf");
+	__ld.wi		__const1+11
+	__st.wmq	_di
+	__ld.wi		__const1+15
+	__st.wmq	_bp
+	__call		_strcmp.2
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 13; #endif
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 14; return "g";
+	__ld.wi		__const1+20
+.LL3:
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 15; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 16; char *h() {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_h
+	__enter		_h
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 17; strcmp("bad","wolf");
+	__ld.wi		__const1+22
+	__st.wmq	_di
+	__ld.wi		__const1+26
+	__st.wmq	_bp
+	__call		_strcmp.2
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 18; return "h";
+	__ld.wi		__const1+31
+.LL4:
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 19; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 21; #asm
+	.dbg	clear
+_hfc		.proc
+		call	_h
+		.ifdef	HUCC
+		tax
+		.endif
+		leave
+		.endp
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 29; #endasm
+	.dbg	line,	"tests/huc-fastcallnested.c", 31; char * __fastcall hfc(void);
+	.dbg	line,	"tests/huc-fastcallnested.c", 33; main()
+	.dbg	line,	"tests/huc-fastcallnested.c", 34; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 35; if (!strcmp(f(), g()))
+	__call		_f
+	__spill.wr
+	__call		_g
+	__st.wmq	_bp
+	__reload.wr
+	__st.wmq	_di
+	__call		_strcmp.2
+	__not.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 36; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 37; if (strcmp(f(), f()))
+.LL6:
+	__call		_f
+	__spill.wr
+	__call		_f
+	__st.wmq	_bp
+	__reload.wr
+	__st.wmq	_di
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 38; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 39; if (strcmp(f(), "f"))
+.LL7:
+	__call		_f
+	__st.wmq	_di
+	__ld.wi		__const1+33
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 40; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 41; if (!strcmp(g(), "f"))
+.LL8:
+	__call		_g
+	__st.wmq	_di
+	__ld.wi		__const1+35
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__not.wr
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 42; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 43; if (strcmp("f", f()))
+.LL9:
+	__ld.wi		__const1+37
+	__spill.wr
+	__call		_f
+	__st.wmq	_bp
+	__reload.wr
+	__st.wmq	_di
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 44; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 45; if (!strcmp("g", f()))
+.LL10:
+	__ld.wi		__const1+39
+	__spill.wr
+	__call		_f
+	__st.wmq	_bp
+	__reload.wr
+	__st.wmq	_di
+	__call		_strcmp.2
+	__not.wr
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 46; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 47; #ifdef __HUCC__
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 48; // HuC doesn't handle this correctly ...
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 49; if (strcmp("h", hfc()))
+.LL11:
+	__ld.wi		__const1+41
+	__spill.wr
+	__call		_hfc
+	__st.wmq	_bp
+	__reload.wr
+	__st.wmq	_di
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 50; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 51; #endif
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 52; return 0;
+.LL12:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/huc-fastcallnested.c", 53; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'b','a','d',$00,'w','o','l','f'
+		db	$00,'f',$00,'b','a','d',$00,'w'
+		db	'o','l','f',$00,'g',$00,'b','a'
+		db	'd',$00,'w','o','l','f',$00,'h'
+		db	$00,'f',$00,'f',$00,'f',$00,'g'
+		db	$00,'h',$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:43
+;	constant pool:0
+;	global pool:23
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,188 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-ffs.c", 1; #ifdef __HUCC__
+	.dbg	line,	"tests/huc-ffs.c", 2; extern unsigned char __fastcall __builtin_ffs( unsigned int value<__temp> );
+	.dbg	line,	"tests/huc-ffs.c", 3; #endif
+	.dbg	line,	"tests/huc-ffs.c", 5; main()
+	.dbg	line,	"tests/huc-ffs.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-ffs.c", 7; int i;
+
+	.dbg	line,	"tests/huc-ffs.c", 8; if (__builtin_ffs(0x8000) != 16)
+	__st.wmiq	32768, __temp
+	__call		___builtin_ffs.1
+	__neq_w.wi	16
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-ffs.c", 9; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ffs.c", 10; if (__builtin_ffs(0xa5a5) != 1)
+.LL3:
+	__st.wmiq	42405, __temp
+	__call		___builtin_ffs.1
+	__neq_w.wi	1
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-ffs.c", 11; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ffs.c", 12; if (__builtin_ffs(0x5a5a) != 2)
+.LL4:
+	__st.wmiq	23130, __temp
+	__call		___builtin_ffs.1
+	__neq_w.wi	2
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-ffs.c", 13; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ffs.c", 14; if (__builtin_ffs(0x0ca0) != 6)
+.LL5:
+	__st.wmiq	3232, __temp
+	__call		___builtin_ffs.1
+	__neq_w.wi	6
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/huc-ffs.c", 15; exit(4);
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ffs.c", 16; if (__builtin_ffs(0x0c80) != 8)
+.LL6:
+	__st.wmiq	3200, __temp
+	__call		___builtin_ffs.1
+	__neq_w.wi	8
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/huc-ffs.c", 17; exit(5);
+	__ld.wi		5
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ffs.c", 18; if (__builtin_ffs(0x0d00) != 9)
+.LL7:
+	__st.wmiq	3328, __temp
+	__call		___builtin_ffs.1
+	__neq_w.wi	9
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/huc-ffs.c", 19; exit(6);
+	__ld.wi		6
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ffs.c", 20; for (i = 0; i < 16; i++) {
+.LL8:
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL9:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	16
+	__btrue		.LL11
+	__bra		.LL12
+.LL10:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL9
+.LL11:
+
+	.dbg	line,	"tests/huc-ffs.c", 21; if (__builtin_ffs(1 << i) != i+1)
+	__ld.wi		1
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wt
+	__st.wmq	__temp
+	__call		___builtin_ffs.1
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__add.wi	1
+	__neq_w.wt
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/huc-ffs.c", 22; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-ffs.c", 23; }
+.LL13	.alias		.LL10
+	__bra		.LL10
+.LL12:
+
+	.dbg	line,	"tests/huc-ffs.c", 24; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-ffs.c", 25; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
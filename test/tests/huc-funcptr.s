@@ -0,0 +1,1124 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-funcptr.c", 1; #ifdef __HUCC__
+	.dbg	line,	"tests/huc-funcptr.c", 3; unsigned char func1(int a, unsigned char b)
+	.dbg	line,	"tests/huc-funcptr.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func1
+	__enter		_func1
+
+	.dbg	line,	"tests/huc-funcptr.c", 5; return (a + b);
+	__ld.ws		2  /* a */
+	__add.us	0  /* b */
+.LL2:
+
+	.dbg	line,	"tests/huc-funcptr.c", 6; }
+	__modsp		4
+	__ext.ur
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-funcptr.c", 8; unsigned char func2(int a, unsigned char b)
+	.dbg	line,	"tests/huc-funcptr.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func2
+	__enter		_func2
+
+	.dbg	line,	"tests/huc-funcptr.c", 10; return (a - b);
+	__ld.ws		2  /* a */
+	__sub.us	0  /* b */
+.LL3:
+
+	.dbg	line,	"tests/huc-funcptr.c", 11; }
+	__modsp		4
+	__ext.ur
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-funcptr.c", 13; unsigned char func3(int a, unsigned char b)
+	.dbg	line,	"tests/huc-funcptr.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func3
+	__enter		_func3
+
+	.dbg	line,	"tests/huc-funcptr.c", 15; return (a * b);
+	__ld.ws		2  /* a */
+	__push.wr
+	__ld.us		0  /* b */
+	__mul.wt
+.LL4:
+
+	.dbg	line,	"tests/huc-funcptr.c", 16; }
+	__modsp		4
+	__ext.ur
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-funcptr.c", 18; unsigned char func4(int a, unsigned char b)
+	.dbg	line,	"tests/huc-funcptr.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func4
+	__enter		_func4
+
+	.dbg	line,	"tests/huc-funcptr.c", 20; return (a / b);
+	__ld.ws		2  /* a */
+	__push.wr
+	__ld.us		0  /* b */
+	__sdiv.wt
+.LL5:
+
+	.dbg	line,	"tests/huc-funcptr.c", 21; }
+	__modsp		4
+	__ext.ur
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-funcptr.c", 23; unsigned char c;
+	.dbg	line,	"tests/huc-funcptr.c", 24; unsigned char d;
+	.dbg	line,	"tests/huc-funcptr.c", 26; unsigned char *func5(int a, unsigned char b)
+	.dbg	line,	"tests/huc-funcptr.c", 27; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func5
+	__enter		_func5
+
+	.dbg	line,	"tests/huc-funcptr.c", 28; c = (a + b);
+	__ld.ws		2  /* a */
+	__add.us	0  /* b */
+	__st.umq	_c
+
+	.dbg	line,	"tests/huc-funcptr.c", 29; return &c;
+	__ld.wi		_c
+.LL6:
+
+	.dbg	line,	"tests/huc-funcptr.c", 30; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-funcptr.c", 32; unsigned char (*p)(int, unsigned char);
+	.dbg	line,	"tests/huc-funcptr.c", 33; unsigned char (**pp)(int, unsigned char);
+	.dbg	line,	"tests/huc-funcptr.c", 34; unsigned char (***ppp)(int, unsigned char);
+	.dbg	line,	"tests/huc-funcptr.c", 36; const unsigned char (*k)(int, unsigned char) = &func1;
+	.dbg	line,	"tests/huc-funcptr.c", 38; const unsigned char (*fa[])(int, int) = { &func1, &func2 };
+	.dbg	line,	"tests/huc-funcptr.c", 39; const unsigned char (*fb[])(int, int) = { &func3, &func4 };
+	.dbg	line,	"tests/huc-funcptr.c", 40; const unsigned char (**pf[])(int, int) = { &fa, &fb };
+	.dbg	line,	"tests/huc-funcptr.c", 42; unsigned char *(*q)(int, unsigned char);
+	.dbg	line,	"tests/huc-funcptr.c", 43; unsigned char *(**pq)(int, unsigned char);
+	.dbg	line,	"tests/huc-funcptr.c", 45; int main()
+	.dbg	line,	"tests/huc-funcptr.c", 46; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-funcptr.c", 47; p = func2;
+	__ld.wi		_func2
+	__st.wmq	_p
+
+	.dbg	line,	"tests/huc-funcptr.c", 48; q = &func5;
+	__ld.wi		_func5
+	__st.wmq	_q
+
+	.dbg	line,	"tests/huc-funcptr.c", 49; c = 0;
+	__st.umiq	0, _c
+
+	.dbg	line,	"tests/huc-funcptr.c", 50; d = 1;
+	__st.umiq	1, _d
+
+	.dbg	line,	"tests/huc-funcptr.c", 52; if (k(3,4) != 7)
+	__ld.wi		_func1
+	__funcp.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	7
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/huc-funcptr.c", 53; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 55; if (p(4,3) != 1)
+.LL8:
+	__ld.wm		_p
+	__funcp.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__callp
+	__neq_w.wi	1
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/huc-funcptr.c", 56; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 57; if ((*p)(4,3) != 1)
+.LL9:
+	__ld.wm		_p
+	__funcp.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__callp
+	__neq_w.wi	1
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/huc-funcptr.c", 58; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 60; if ((*q)(5,6) != &c)
+.LL10:
+	__ld.wm		_q
+	__funcp.wr
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		6
+	__pusharg.wr
+	__callp
+	__neq_w.wi	_c
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/huc-funcptr.c", 61; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 62; if (*(*q)(5,6) != 11)
+.LL11:
+	__ld.wm		_q
+	__funcp.wr
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		6
+	__pusharg.wr
+	__callp
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	11
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/huc-funcptr.c", 63; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 65; c = 0;
+.LL12:
+	__st.umiq	0, _c
+
+	.dbg	line,	"tests/huc-funcptr.c", 67; if (fa[0](1,2) != 3)
+	__ld.wm		_fa
+	__funcp.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/huc-funcptr.c", 68; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 69; if (fa[c](3,4) != 7)
+.LL13:
+	__ld2x.umq	_c
+	__ld.wax	_fa
+	__funcp.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	7
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/huc-funcptr.c", 70; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 72; c = 1;
+.LL14:
+	__st.umiq	1, _c
+
+	.dbg	line,	"tests/huc-funcptr.c", 74; if ((fa[1])(7,5) != 2)
+	__ld.wm		_fa + 2
+	__funcp.wr
+	__ld.wi		7
+	__pusharg.wr
+	__ld.wi		5
+	__pusharg.wr
+	__callp
+	__neq_w.wi	2
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/huc-funcptr.c", 75; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 76; if ((fa[c])(5,4) != 1)
+.LL15:
+	__ld2x.umq	_c
+	__ld.wax	_fa
+	__funcp.wr
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	1
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/huc-funcptr.c", 77; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 79; c = 1;
+.LL16:
+	__st.umiq	1, _c
+
+	.dbg	line,	"tests/huc-funcptr.c", 81; if ((*fa[1])(7,5) != 2)
+	__ld.wm		_fa + 2
+	__funcp.wr
+	__ld.wi		7
+	__pusharg.wr
+	__ld.wi		5
+	__pusharg.wr
+	__callp
+	__neq_w.wi	2
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/huc-funcptr.c", 82; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 83; if ((*fa[c])(5,4) != 1)
+.LL17:
+	__ld2x.umq	_c
+	__ld.wax	_fa
+	__funcp.wr
+	__ld.wi		5
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	1
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/huc-funcptr.c", 84; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 86; c = 0;
+.LL18:
+	__st.umiq	0, _c
+
+	.dbg	line,	"tests/huc-funcptr.c", 87; p = fa[c];
+	__ld2x.umq	_c
+	__ld.wax	_fa
+	__st.wmq	_p
+
+	.dbg	line,	"tests/huc-funcptr.c", 89; if (p(1,2) != 3)
+	__funcp.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/huc-funcptr.c", 90; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 92; pp = &fa[1];
+.LL19:
+	__ld.wi		_fa + 2
+	__st.wmq	_pp
+
+	.dbg	line,	"tests/huc-funcptr.c", 94; if ((**pp)(8,4) != 4)
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL20
+
+	.dbg	line,	"tests/huc-funcptr.c", 95; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 97; c = 1;
+.LL20:
+	__st.umiq	1, _c
+
+	.dbg	line,	"tests/huc-funcptr.c", 98; pp = &fb[c];
+	__ld.um		_c
+	__asl.wr
+	__add.wi	_fb
+	__st.wmq	_pp
+
+	.dbg	line,	"tests/huc-funcptr.c", 100; if ((**pp)(8,4) != 2)
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	2
+	__bfalse	.LL21
+
+	.dbg	line,	"tests/huc-funcptr.c", 101; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 103; pp = fb;
+.LL21:
+	__ld.wi		_fb
+	__st.wmq	_pp
+
+	.dbg	line,	"tests/huc-funcptr.c", 105; if (pp[1](8,2) != 4)
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL22
+
+	.dbg	line,	"tests/huc-funcptr.c", 106; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 107; if ((pp[1])(8,4) != 2)
+.LL22:
+	__ld.wm		_pp
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	2
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/huc-funcptr.c", 108; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 109; if ((*pp[1])(6,2) != 3)
+.LL23:
+	__ld.wm		_pp
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL24
+
+	.dbg	line,	"tests/huc-funcptr.c", 110; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 112; c = 0;
+.LL24:
+	__st.umiq	0, _c
+
+	.dbg	line,	"tests/huc-funcptr.c", 114; if (pf[c][d](6,2) != 4)
+	__ld.um		_d
+	__asl.wr
+	__ld2x.um	_c
+	__add.wax	_pf
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL25
+
+	.dbg	line,	"tests/huc-funcptr.c", 115; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 116; if ((pf[c][d])(6,2) != 4)
+.LL25:
+	__ld.um		_d
+	__asl.wr
+	__ld2x.um	_c
+	__add.wax	_pf
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL26
+
+	.dbg	line,	"tests/huc-funcptr.c", 117; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 118; if ((*pf[c][d])(6,2) != 4)
+.LL26:
+	__ld.um		_d
+	__asl.wr
+	__ld2x.um	_c
+	__add.wax	_pf
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/huc-funcptr.c", 119; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 121; if (pf[c][1](6,2) != 4)
+.LL27:
+	__ld2x.umq	_c
+	__ld.wax	_pf
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL28
+
+	.dbg	line,	"tests/huc-funcptr.c", 122; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 123; if ((pf[c][1])(6,2) != 4)
+.LL28:
+	__ld2x.umq	_c
+	__ld.wax	_pf
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL29
+
+	.dbg	line,	"tests/huc-funcptr.c", 124; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 125; if ((*pf[c][1])(6,2) != 4)
+.LL29:
+	__ld2x.umq	_c
+	__ld.wax	_pf
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL30
+
+	.dbg	line,	"tests/huc-funcptr.c", 126; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 128; if (pf[1][d](6,2) != 3)
+.LL30:
+	__ld.um		_d
+	__asl.wr
+	__add.wm	_pf + 2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL31
+
+	.dbg	line,	"tests/huc-funcptr.c", 129; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 130; if ((pf[1][d])(6,2) != 3)
+.LL31:
+	__ld.um		_d
+	__asl.wr
+	__add.wm	_pf + 2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL32
+
+	.dbg	line,	"tests/huc-funcptr.c", 131; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 132; if ((*pf[1][d])(6,2) != 3)
+.LL32:
+	__ld.um		_d
+	__asl.wr
+	__add.wm	_pf + 2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL33
+
+	.dbg	line,	"tests/huc-funcptr.c", 133; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 135; if (pf[1][1](6,2) != 3)
+.LL33:
+	__ld.wm		_pf + 2
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL34
+
+	.dbg	line,	"tests/huc-funcptr.c", 136; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 137; if ((pf[1][1])(6,2) != 3)
+.LL34:
+	__ld.wm		_pf + 2
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL35
+
+	.dbg	line,	"tests/huc-funcptr.c", 138; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 139; if ((*pf[1][1])(6,2) != 3)
+.LL35:
+	__ld.wm		_pf + 2
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL36
+
+	.dbg	line,	"tests/huc-funcptr.c", 140; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 142; c = 1;
+.LL36:
+	__st.umiq	1, _c
+
+	.dbg	line,	"tests/huc-funcptr.c", 143; ppp = pf;
+	__ld.wi		_pf
+	__st.wmq	_ppp
+
+	.dbg	line,	"tests/huc-funcptr.c", 145; if ((**ppp)(8,4) != 12)
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	12
+	__bfalse	.LL37
+
+	.dbg	line,	"tests/huc-funcptr.c", 146; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 148; if ((***ppp)(8,4) != 12)
+.LL37:
+	__ld.wm		_ppp
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	12
+	__bfalse	.LL38
+
+	.dbg	line,	"tests/huc-funcptr.c", 149; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 151; if (ppp[c][d](8,2) != 4)
+.LL38:
+	__ld.um		_c
+	__asl.wr
+	__add.wm	_ppp
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.um		_d
+	__asl.wr
+	__add.wt
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL39
+
+	.dbg	line,	"tests/huc-funcptr.c", 152; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 153; if ((ppp[c][d])(8,4) != 2)
+.LL39:
+	__ld.um		_c
+	__asl.wr
+	__add.wm	_ppp
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.um		_d
+	__asl.wr
+	__add.wt
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	2
+	__bfalse	.LL40
+
+	.dbg	line,	"tests/huc-funcptr.c", 154; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 155; if ((*ppp[c][d])(6,2) != 3)
+.LL40:
+	__ld.um		_c
+	__asl.wr
+	__add.wm	_ppp
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.um		_d
+	__asl.wr
+	__add.wt
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL41
+
+	.dbg	line,	"tests/huc-funcptr.c", 156; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 158; if (ppp[c][1](8,2) != 4)
+.LL41:
+	__ld.um		_c
+	__asl.wr
+	__add.wm	_ppp
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL42
+
+	.dbg	line,	"tests/huc-funcptr.c", 159; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 160; if ((ppp[c][1])(8,4) != 2)
+.LL42:
+	__ld.um		_c
+	__asl.wr
+	__add.wm	_ppp
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	2
+	__bfalse	.LL43
+
+	.dbg	line,	"tests/huc-funcptr.c", 161; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 162; if ((*ppp[c][1])(6,2) != 3)
+.LL43:
+	__ld.um		_c
+	__asl.wr
+	__add.wm	_ppp
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL44
+
+	.dbg	line,	"tests/huc-funcptr.c", 163; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 165; if (ppp[1][d](8,2) != 4)
+.LL44:
+	__ld.wm		_ppp
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.um		_d
+	__asl.wr
+	__add.wt
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL45
+
+	.dbg	line,	"tests/huc-funcptr.c", 166; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 167; if ((ppp[1][d])(8,4) != 2)
+.LL45:
+	__ld.wm		_ppp
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.um		_d
+	__asl.wr
+	__add.wt
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	2
+	__bfalse	.LL46
+
+	.dbg	line,	"tests/huc-funcptr.c", 168; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 169; if ((*ppp[1][d])(6,2) != 3)
+.LL46:
+	__ld.wm		_ppp
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.um		_d
+	__asl.wr
+	__add.wt
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL47
+
+	.dbg	line,	"tests/huc-funcptr.c", 170; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 172; if (ppp[1][1](8,2) != 4)
+.LL47:
+	__ld.wm		_ppp
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	4
+	__bfalse	.LL48
+
+	.dbg	line,	"tests/huc-funcptr.c", 173; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 174; if ((ppp[1][1])(8,4) != 2)
+.LL48:
+	__ld.wm		_ppp
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__callp
+	__neq_w.wi	2
+	__bfalse	.LL49
+
+	.dbg	line,	"tests/huc-funcptr.c", 175; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 176; if ((*ppp[1][1])(6,2) != 3)
+.LL49:
+	__ld.wm		_ppp
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__funcp.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	3
+	__bfalse	.LL50
+
+	.dbg	line,	"tests/huc-funcptr.c", 177; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-funcptr.c", 179; return 0;
+.LL50:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/huc-funcptr.c", 180; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-funcptr.c", 182; #else
+	.dbg	line,	"tests/huc-funcptr.c", 184; /* HuC does not support function pointers */
+	.dbg	line,	"tests/huc-funcptr.c", 185; int main()
+	.dbg	line,	"tests/huc-funcptr.c", 186; {
+	.dbg	line,	"tests/huc-funcptr.c", 187; return 0;
+	.dbg	line,	"tests/huc-funcptr.c", 188; }
+	.dbg	line,	"tests/huc-funcptr.c", 190; #endif
+	.dbg	clear
+	.rodata
+_k:
+		dw	_func1
+_fa:
+		dw	_func1
+		dw	_func2
+_fb:
+		dw	_func3
+		dw	_func4
+_pf:
+		dw	_fa
+		dw	_fb
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:14
+;	global pool:18
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        39     39     1  c
+;        30     30     2  ppp
+;        14     14     1  d
+;        16     16     2  pp
+;        10     10     2  p
+;         6      6     2  q
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_c, 1, 39, 39
+	auto_zp_var	_ppp, 2, 30, 30
+	auto_zp_var	_d, 1, 14, 14
+	auto_zp_var	_pp, 2, 16, 16
+	auto_zp_var	_p, 2, 10, 10
+	auto_zp_var	_q, 2, 6, 6
+	.endm
+
+	.bss
+_pq:
+		ds	2
+	.code
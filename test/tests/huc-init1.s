@@ -0,0 +1,122 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-init1.c", 1; int a = 10;
+	.dbg	line,	"tests/huc-init1.c", 2; int b = 11;
+	.dbg	line,	"tests/huc-init1.c", 3; int c = 12;
+	.dbg	line,	"tests/huc-init1.c", 5; int main()
+	.dbg	line,	"tests/huc-init1.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-init1.c", 7; if (b != 11)
+	__ld.wm		_b
+	__neq_w.wi	11
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-init1.c", 8; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-init1.c", 9; if (a != 10)
+.LL3:
+	__ld.wm		_a
+	__neq_w.wi	10
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-init1.c", 10; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-init1.c", 11; if (c != 12)
+.LL4:
+	__ld.wm		_c
+	__neq_w.wi	12
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-init1.c", 12; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-init1.c", 13; return 0;
+.LL5:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-init1.c", 14; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.xdata
+_a:
+		ds	2
+_b:
+		ds	2
+_c:
+		ds	2
+
+	.xinit
+
+		dw	10
+
+		dw	11
+
+		dw	12
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
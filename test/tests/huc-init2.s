@@ -0,0 +1,118 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-init2.c", 1; int a = 3;
+	.dbg	line,	"tests/huc-init2.c", 2; int b[3] = {4, 5, 6};
+	.dbg	line,	"tests/huc-init2.c", 3; int c = 7;
+	.dbg	line,	"tests/huc-init2.c", 5; int main()
+	.dbg	line,	"tests/huc-init2.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-init2.c", 7; if (b[0] != 4 || b[1] != 5 || b[2] != 6)
+	__ld.wm		_b
+	__neq_w.wi	4
+	__btrue		.LL4
+	__ld.wm		_b + 2
+	__neq_w.wi	5
+.LL4:
+	__btrue		.LL5
+	__ld.wm		_b + 4
+	__neq_w.wi	6
+.LL5:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-init2.c", 8; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-init2.c", 9; return a != 3 || c != 7;
+.LL3:
+	__ld.wm		_a
+	__neq_w.wi	3
+	__btrue		.LL6
+	__ld.wm		_c
+	__neq_w.wi	7
+.LL6:
+.LL2:
+	__bool
+
+	.dbg	line,	"tests/huc-init2.c", 10; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.xdata
+_a:
+		ds	2
+_b:
+		ds	6
+_c:
+		ds	2
+
+	.xinit
+
+		dw	3
+
+		dw	4,5,6
+
+		dw	7
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
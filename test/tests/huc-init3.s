@@ -0,0 +1,121 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-init3.c", 1; const int b = 4;
+	.dbg	line,	"tests/huc-init3.c", 2; const int *a = &b;
+	.dbg	line,	"tests/huc-init3.c", 3; const int d = b+1;
+	.dbg	line,	"tests/huc-init3.c", 4; const int e = 1+b;
+	.dbg	line,	"tests/huc-init3.c", 6; int main()
+	.dbg	line,	"tests/huc-init3.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-init3.c", 8; if (d != 5)
+	__ld.wi		4+1
+	__neq_w.wi	5
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-init3.c", 9; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init3.c", 10; if (*a != 4)
+.LL3:
+	__ld.wm		_b
+	__neq_w.wi	4
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-init3.c", 11; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init3.c", 12; if (e != 5)
+.LL4:
+	__ld.wi		1+4
+	__neq_w.wi	5
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-init3.c", 13; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init3.c", 14; return 0;
+.LL5:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-init3.c", 15; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_b:
+		dw	4
+_a:
+		dw	_b
+_d:
+		dw	4+1
+_e:
+		dw	1+4
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:8
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,132 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-init6.c", 1; struct foo {
+	.dbg	line,	"tests/huc-init6.c", 2; int a;
+	.dbg	line,	"tests/huc-init6.c", 3; int b;
+	.dbg	line,	"tests/huc-init6.c", 4; };
+	.dbg	line,	"tests/huc-init6.c", 5; struct foo bar[2] = {{1, 2}, {3,4}};
+	.dbg	line,	"tests/huc-init6.c", 7; int main()
+	.dbg	line,	"tests/huc-init6.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-init6.c", 9; if (bar[1].a != 3)
+	__ld.wm		_bar + 4
+	__neq_w.wi	3
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-init6.c", 10; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init6.c", 11; if (bar[0].b != 2)
+.LL3:
+	__ld.wm		_bar + 2
+	__neq_w.wi	2
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-init6.c", 12; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init6.c", 13; if (bar[1].b != 4)
+.LL4:
+	__ld.wm		_bar + 4 + 2
+	__neq_w.wi	4
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-init6.c", 14; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init6.c", 15; if (bar[0].a != 1)
+.LL5:
+	__ld.wm		_bar
+	__neq_w.wi	1
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/huc-init6.c", 16; exit(4);
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init6.c", 17; return 0;
+.LL6:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-init6.c", 18; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.xdata
+_bar:
+		ds	8
+
+	.xinit
+		dw	1
+		dw	2
+		dw	3
+		dw	4
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
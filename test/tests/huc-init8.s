@@ -0,0 +1,352 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-init8.c", 1; struct foo {
+	.dbg	line,	"tests/huc-init8.c", 2; int a;
+	.dbg	line,	"tests/huc-init8.c", 3; int b;
+	.dbg	line,	"tests/huc-init8.c", 4; };
+	.dbg	line,	"tests/huc-init8.c", 6; int x = 10;
+	.dbg	line,	"tests/huc-init8.c", 7; char y = 11;
+	.dbg	line,	"tests/huc-init8.c", 8; int z[3] = {3, 2, 1};
+	.dbg	line,	"tests/huc-init8.c", 9; struct foo zz = {2, 1};
+	.dbg	line,	"tests/huc-init8.c", 10; struct foo zzz[2] = {{7,6},{5,4}};
+	.dbg	line,	"tests/huc-init8.c", 11; struct foo zzzz[3] = {{23, 24}, {25, 26}, {27, 28}};
+	.dbg	line,	"tests/huc-init8.c", 12; struct foo aaa[2];
+	.dbg	line,	"tests/huc-init8.c", 13; int main()
+	.dbg	line,	"tests/huc-init8.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-init8.c", 15; static int a = 5;
+
+	.dbg	line,	"tests/huc-init8.c", 16; static char b = 3;
+
+	.dbg	line,	"tests/huc-init8.c", 17; static int c[3] = {1, 2, 3};
+
+	.dbg	line,	"tests/huc-init8.c", 18; static struct foo d = {1, 2};
+
+	.dbg	line,	"tests/huc-init8.c", 19; static struct foo e[2] = {{4, 5}, {6, 7}};
+
+	.dbg	line,	"tests/huc-init8.c", 21; if (e[0].a != 4 || e[0].b != 5 || e[1].b != 7 || e[1].a != 6)
+	__ld.wm		SL7  /* e */
+	__neq_w.wi	4
+	__btrue		.LL9
+	__ld.wm		SL7 + 2  /* e */
+	__neq_w.wi	5
+.LL9:
+	__btrue		.LL10
+	__ld.wm		SL7 + 4 + 2  /* e */
+	__neq_w.wi	7
+.LL10:
+	__btrue		.LL11
+	__ld.wm		SL7 + 4  /* e */
+	__neq_w.wi	6
+.LL11:
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/huc-init8.c", 22; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init8.c", 23; if (d.b != 2 || d.a != 1)
+.LL8:
+	__ld.wm		SL6 + 2  /* d */
+	__neq_w.wi	2
+	__btrue		.LL13
+	__ld.wm		SL6  /* d */
+	__neq_w.wi	1
+.LL13:
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/huc-init8.c", 24; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init8.c", 25; if (c[2] != 3 || c[1] != 2 || c[0] != 1)
+.LL12:
+	__ld.wm		SL5 + 4  /* c */
+	__neq_w.wi	3
+	__btrue		.LL15
+	__ld.wm		SL5 + 2  /* c */
+	__neq_w.wi	2
+.LL15:
+	__btrue		.LL16
+	__ld.wm		SL5  /* c */
+	__neq_w.wi	1
+.LL16:
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/huc-init8.c", 26; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init8.c", 27; if (b != 3 || a != 5)
+.LL14:
+	__ld.umq	SL4  /* b */
+	__neq_b.uiq	3
+	__btrue		.LL18
+	__ld.wm		SL3  /* a */
+	__neq_w.wi	5
+.LL18:
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/huc-init8.c", 28; exit(4);
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init8.c", 29; if (aaa[0].a || aaa[0].b || aaa[1].a || aaa[1].b)
+.LL17:
+	__tst.wm	_aaa
+	__btrue		.LL20
+	__tst.wm	_aaa + 2
+.LL20:
+	__btrue		.LL21
+	__tst.wm	_aaa + 4
+.LL21:
+	__btrue		.LL22
+	__tst.wm	_aaa + 4 + 2
+.LL22:
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/huc-init8.c", 30; exit(5);
+	__ld.wi		5
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init8.c", 31; if (zzzz[2].b != 28 || zzzz[2].a != 27 ||
+.LL19:
+	__ld.wm		_zzzz + 8 + 2
+	__neq_w.wi	28
+	__btrue		.LL24
+	__ld.wm		_zzzz + 8
+	__neq_w.wi	27
+.LL24:
+	__btrue		.LL25
+
+	.dbg	line,	"tests/huc-init8.c", 32; zzzz[1].b != 26 || zzzz[1].a != 25 ||
+	__ld.wm		_zzzz + 4 + 2
+	__neq_w.wi	26
+.LL25:
+	__btrue		.LL26
+	__ld.wm		_zzzz + 4
+	__neq_w.wi	25
+.LL26:
+	__btrue		.LL27
+
+	.dbg	line,	"tests/huc-init8.c", 33; zzzz[0].b != 24 || zzzz[0].a != 23)
+	__ld.wm		_zzzz + 2
+	__neq_w.wi	24
+.LL27:
+	__btrue		.LL28
+	__ld.wm		_zzzz
+	__neq_w.wi	23
+.LL28:
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/huc-init8.c", 34; exit(6);
+	__ld.wi		6
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init8.c", 35; if (zzz[1].b != 4 || zzz[1].a != 5 ||
+.LL23:
+	__ld.wm		_zzz + 4 + 2
+	__neq_w.wi	4
+	__btrue		.LL30
+	__ld.wm		_zzz + 4
+	__neq_w.wi	5
+.LL30:
+	__btrue		.LL31
+
+	.dbg	line,	"tests/huc-init8.c", 36; zzz[0].b != 6 || zzz[0].a != 7)
+	__ld.wm		_zzz + 2
+	__neq_w.wi	6
+.LL31:
+	__btrue		.LL32
+	__ld.wm		_zzz
+	__neq_w.wi	7
+.LL32:
+	__bfalse	.LL29
+
+	.dbg	line,	"tests/huc-init8.c", 37; exit(7);
+	__ld.wi		7
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init8.c", 38; if (zz.b != 1 || zz.a != 2)
+.LL29:
+	__ld.wm		_zz + 2
+	__neq_w.wi	1
+	__btrue		.LL34
+	__ld.wm		_zz
+	__neq_w.wi	2
+.LL34:
+	__bfalse	.LL33
+
+	.dbg	line,	"tests/huc-init8.c", 39; exit(8);
+	__ld.wi		8
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init8.c", 40; if (z[2] != 1 || z[1] != 2 || z[0] != 3)
+.LL33:
+	__ld.wm		_z + 4
+	__neq_w.wi	1
+	__btrue		.LL36
+	__ld.wm		_z + 2
+	__neq_w.wi	2
+.LL36:
+	__btrue		.LL37
+	__ld.wm		_z
+	__neq_w.wi	3
+.LL37:
+	__bfalse	.LL35
+
+	.dbg	line,	"tests/huc-init8.c", 41; exit(9);
+	__ld.wi		9
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init8.c", 42; if (y != 11 || x != 10)
+.LL35:
+	__ld.umq	_y
+	__neq_b.uiq	11
+	__btrue		.LL39
+	__ld.wm		_x
+	__neq_w.wi	10
+.LL39:
+	__bfalse	.LL38
+
+	.dbg	line,	"tests/huc-init8.c", 43; exit(10);
+	__ld.wi		10
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-init8.c", 44; return 0;
+.LL38:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-init8.c", 45; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_aaa:
+		ds	8
+
+	.xdata
+_x:
+		ds	2
+_y:
+		ds	1
+_z:
+		ds	6
+_zz:
+		ds	4
+_zzz:
+		ds	8
+_zzzz:
+		ds	12
+SL3:
+		ds	2
+SL4:
+		ds	1
+SL5:
+		ds	6
+SL6:
+		ds	4
+SL7:
+		ds	8
+
+	.xinit
+
+		dw	10
+
+		db	11
+
+		dw	3,2,1
+		dw	2
+		dw	1
+
+		dw	7
+		dw	6
+		dw	5
+		dw	4
+
+		dw	23
+		dw	24
+		dw	25
+		dw	26
+		dw	27
+		dw	28
+
+
+		dw	5
+
+		db	3
+
+		dw	1,2,3
+		dw	1
+		dw	2
+
+		dw	4
+		dw	5
+		dw	6
+		dw	7
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:14
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,110 @@
+/* inline functions */
+
+#ifdef __HUCC__
+
+struct vec {
+  int x;
+  int y;
+};
+
+unsigned char tiles[16];
+int calls;
+
+static inline int clamp(int v, int lo, int hi)
+{
+  if (v < lo)
+    return lo;
+  if (v > hi)
+    return hi;
+  return v;
+}
+
+inline void vadd(struct vec *a, struct vec *b)
+{
+  a->x += b->x;
+  a->y += b->y;
+}
+
+inline unsigned char tile_at(unsigned char x, unsigned char y)
+{
+  return tiles[(y << 2) + x];
+}
+
+inline int sum_to(int n)
+{
+  int i, t;
+
+  t = 0;
+  for (i = 1; i <= n; i++)
+    t += i;
+  return t;
+}
+
+inline void count(void)
+{
+  calls++;
+}
+
+static inline signed char sign(int v)
+{
+  signed char s;
+
+  s = 0;
+  if (v < 0)
+    s = -1;
+  else if (v > 0)
+    s = 1;
+  return s;
+}
+
+int twice(int v)
+{
+  return clamp(v, 0, 100) * 2;
+}
+
+int main()
+{
+  struct vec a, b;
+  unsigned char i;
+  int k;
+
+  if (clamp(-5, 0, 10) != 0 || clamp(50, 0, 10) != 10 || clamp(7, 0, 10) != 7)
+    return 1;
+
+  a.x = 1; a.y = 2; b.x = 10; b.y = 20;
+  vadd(&a, &b);
+  vadd(&a, &b);
+  if (a.x != 21 || a.y != 42)
+    return 2;
+
+  for (i = 0; i < 16; i++)
+    tiles[i] = i * 3;
+  if (tile_at(1, 2) != 27 || tile_at(3, 3) != 45)
+    return 3;
+
+  k = sum_to(10) + sum_to(4);
+  if (k != 65)
+    return 4;
+
+  for (i = 0; i < 5; i++)
+    count();
+  if (calls != 5)
+    return 5;
+
+  if (twice(70) != 140 || twice(300) != 200 || clamp(twice(-3), -1, 1) != 0)
+    return 6;
+
+  if (sign(-300) != -1 || sign(0) != 0 || sign(clamp(9, 1, 2)) != 1)
+    return 7;
+
+  return 0;
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,820 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-inline.c", 1; /* inline functions */
+	.dbg	line,	"tests/huc-inline.c", 3; #ifdef __HUCC__
+	.dbg	line,	"tests/huc-inline.c", 5; struct vec {
+	.dbg	line,	"tests/huc-inline.c", 6; int x;
+	.dbg	line,	"tests/huc-inline.c", 7; int y;
+	.dbg	line,	"tests/huc-inline.c", 8; };
+	.dbg	line,	"tests/huc-inline.c", 10; unsigned char tiles[16];
+	.dbg	line,	"tests/huc-inline.c", 11; int calls;
+	.dbg	line,	"tests/huc-inline.c", 13; static inline int clamp(int v, int lo, int hi)
+	.dbg	line,	"tests/huc-inline.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_clamp
+	__enter		_clamp
+
+	.dbg	line,	"tests/huc-inline.c", 15; if (v < lo)
+	__ld.ws		4  /* v */
+	__slt_w.ws	2  /* lo */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-inline.c", 16; return lo;
+	__ld.ws		2  /* lo */
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-inline.c", 17; if (v > hi)
+.LL3:
+	__ld.ws		4  /* v */
+	__sgt_w.ws	0  /* hi */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-inline.c", 18; return hi;
+	__ld.ws		0  /* hi */
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-inline.c", 19; return v;
+.LL4:
+	__ld.ws		4  /* v */
+.LL2:
+
+	.dbg	line,	"tests/huc-inline.c", 20; }
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-inline.c", 22; inline void vadd(struct vec *a, struct vec *b)
+	.dbg	line,	"tests/huc-inline.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_vadd
+	__enter		_vadd
+
+	.dbg	line,	"tests/huc-inline.c", 24; a->x += b->x;
+	__ld.ws		2  /* a */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* b */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wt
+	__st.wtq
+
+	.dbg	line,	"tests/huc-inline.c", 25; a->y += b->y;
+	__ld.ws		2  /* a */
+	__add.wi	2
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* b */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wt
+	__st.wtq
+
+	.dbg	line,	"tests/huc-inline.c", 26; }
+.LL5:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-inline.c", 28; inline unsigned char tile_at(unsigned char x, unsigned char y)
+	.dbg	line,	"tests/huc-inline.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_tile_at
+	__enter		_tile_at
+
+	.dbg	line,	"tests/huc-inline.c", 30; return tiles[(y << 2) + x];
+	__ld.us		0  /* y */
+	__asl.wi	2
+	__add.us	2  /* x */
+	__ld.uar	_tiles
+.LL6:
+
+	.dbg	line,	"tests/huc-inline.c", 31; }
+	__modsp		4
+	__ext.ur
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-inline.c", 33; inline int sum_to(int n)
+	.dbg	line,	"tests/huc-inline.c", 34; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_sum_to
+	__enter		_sum_to
+
+	.dbg	line,	"tests/huc-inline.c", 35; int i, t;
+
+	.dbg	line,	"tests/huc-inline.c", 37; t = 0;
+	__st.wmiq	0, __sum_to_end - 4  /* t */
+
+	.dbg	line,	"tests/huc-inline.c", 38; for (i = 1; i <= n; i++)
+	__st.wmiq	1, __sum_to_end - 2  /* i */
+.LL8:
+	__ld.wm		__sum_to_end - 2  /* i */
+	__sle_w.ws	0  /* n */
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+	__inc.wmq	__sum_to_end - 2  /* i */
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/huc-inline.c", 39; t += i;
+	__ld.wm		__sum_to_end - 2  /* i */
+	__add_st.wmq	__sum_to_end - 4  /* t */
+	__bra		.LL9
+.LL11:
+
+	.dbg	line,	"tests/huc-inline.c", 40; return t;
+	__ld.wm		__sum_to_end - 4  /* t */
+.LL7:
+
+	.dbg	line,	"tests/huc-inline.c", 41; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__sum_to_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-inline.c", 43; inline void count(void)
+	.dbg	line,	"tests/huc-inline.c", 44; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_count
+	__enter		_count
+
+	.dbg	line,	"tests/huc-inline.c", 45; calls++;
+	__inc.wmq	_calls
+
+	.dbg	line,	"tests/huc-inline.c", 46; }
+.LL12:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-inline.c", 48; static inline signed char sign(int v)
+	.dbg	line,	"tests/huc-inline.c", 49; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_sign
+	__enter		_sign
+
+	.dbg	line,	"tests/huc-inline.c", 50; signed char s;
+
+	.dbg	line,	"tests/huc-inline.c", 52; s = 0;
+	__st.umiq	0, __sign_end - 1  /* s */
+
+	.dbg	line,	"tests/huc-inline.c", 53; if (v < 0)
+	__ld.ws		0  /* v */
+	__slt_w.wi	0
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/huc-inline.c", 54; s = -1;
+	__st.umiq	-1, __sign_end - 1  /* s */
+
+	.dbg	line,	"tests/huc-inline.c", 55; else if (v > 0)
+	__bra		.LL15
+.LL14:
+	__ld.ws		0  /* v */
+	__sgt_w.wi	0
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/huc-inline.c", 56; s = 1;
+	__st.umiq	1, __sign_end - 1  /* s */
+
+	.dbg	line,	"tests/huc-inline.c", 57; return s;
+.LL16:
+.LL15:
+	__ld.bm		__sign_end - 1  /* s */
+.LL13:
+
+	.dbg	line,	"tests/huc-inline.c", 58; }
+	__modsp		2
+	__ext.br
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__sign_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-inline.c", 60; int twice(int v)
+	.dbg	line,	"tests/huc-inline.c", 61; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_twice
+	__enter		_twice
+
+	.dbg	line,	"tests/huc-inline.c", 62; return clamp(v, 0, 100) * 2;
+	__ld.ws		0  /* v */
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		100
+	__pusharg.wr
+	__ld.ws		4  /* v */
+	__slt_w.ws	2  /* lo */
+	__bfalse	.LL18
+	__ld.ws		2  /* lo */
+	__bra		.LL20
+.LL18:
+	__ld.ws		4  /* v */
+	__sgt_w.ws	0  /* hi */
+	__bfalse	.LL19
+	__ld.ws		0  /* hi */
+	__bra		.LL20
+.LL19:
+	__ld.ws		4  /* v */
+.LL20:
+	__modsp		6
+	__asl.wi	1
+.LL17:
+
+	.dbg	line,	"tests/huc-inline.c", 63; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-inline.c", 65; int main()
+	.dbg	line,	"tests/huc-inline.c", 66; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-inline.c", 67; struct vec a, b;
+
+	.dbg	line,	"tests/huc-inline.c", 68; unsigned char i;
+
+	.dbg	line,	"tests/huc-inline.c", 69; int k;
+
+	.dbg	line,	"tests/huc-inline.c", 71; if (clamp(-5, 0, 10) != 0 || clamp(50, 0, 10) != 10 || clamp(7, 0, 10) != 7)
+	__ld.wi		-5
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		4  /* v */
+	__slt_w.ws	2  /* lo */
+	__bfalse	.LL23
+	__ld.ws		2  /* lo */
+	__bra		.LL25
+.LL23:
+	__ld.ws		4  /* v */
+	__sgt_w.ws	0  /* hi */
+	__bfalse	.LL24
+	__ld.ws		0  /* hi */
+	__bra		.LL25
+.LL24:
+	__ld.ws		4  /* v */
+.LL25:
+	__modsp		6
+	__tst.wr
+	__btrue		.LL26
+	__ld.wi		50
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		4  /* v */
+	__slt_w.ws	2  /* lo */
+	__bfalse	.LL27
+	__ld.ws		2  /* lo */
+	__bra		.LL29
+.LL27:
+	__ld.ws		4  /* v */
+	__sgt_w.ws	0  /* hi */
+	__bfalse	.LL28
+	__ld.ws		0  /* hi */
+	__bra		.LL29
+.LL28:
+	__ld.ws		4  /* v */
+.LL29:
+	__modsp		6
+	__neq_w.wi	10
+.LL26:
+	__btrue		.LL30
+	__ld.wi		7
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		4  /* v */
+	__slt_w.ws	2  /* lo */
+	__bfalse	.LL31
+	__ld.ws		2  /* lo */
+	__bra		.LL33
+.LL31:
+	__ld.ws		4  /* v */
+	__sgt_w.ws	0  /* hi */
+	__bfalse	.LL32
+	__ld.ws		0  /* hi */
+	__bra		.LL33
+.LL32:
+	__ld.ws		4  /* v */
+.LL33:
+	__modsp		6
+	__neq_w.wi	7
+.LL30:
+	__bfalse	.LL22
+
+	.dbg	line,	"tests/huc-inline.c", 72; return 1;
+	__ld.wi		1
+	__bra		.LL21
+
+	.dbg	line,	"tests/huc-inline.c", 74; a.x = 1; a.y = 2; b.x = 10; b.y = 20;
+.LL22:
+	__st.wmiq	1, __main_end - 4  /* a */
+	__st.wmiq	2, __main_end - 4 + 2  /* a */
+	__st.wmiq	10, __main_end - 8  /* b */
+	__st.wmiq	20, __main_end - 8 + 2  /* b */
+
+	.dbg	line,	"tests/huc-inline.c", 75; vadd(&a, &b);
+	__ld.wi		__main_end - 4  /* a */
+	__pusharg.wr
+	__ld.wi		__main_end - 8  /* b */
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* b */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wt
+	__st.wtq
+	__ld.ws		2  /* a */
+	__add.wi	2
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* b */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wt
+	__st.wtq
+.LL34:
+	__modsp		4
+
+	.dbg	line,	"tests/huc-inline.c", 76; vadd(&a, &b);
+	__ld.wi		__main_end - 4  /* a */
+	__pusharg.wr
+	__ld.wi		__main_end - 8  /* b */
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* b */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wt
+	__st.wtq
+	__ld.ws		2  /* a */
+	__add.wi	2
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		0  /* b */
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wt
+	__st.wtq
+.LL35:
+	__modsp		4
+
+	.dbg	line,	"tests/huc-inline.c", 77; if (a.x != 21 || a.y != 42)
+	__ld.wm		__main_end - 4  /* a */
+	__neq_w.wi	21
+	__btrue		.LL37
+	__ld.wm		__main_end - 4 + 2  /* a */
+	__neq_w.wi	42
+.LL37:
+	__bfalse	.LL36
+
+	.dbg	line,	"tests/huc-inline.c", 78; return 2;
+	__ld.wi		2
+	__bra		.LL21
+
+	.dbg	line,	"tests/huc-inline.c", 80; for (i = 0; i < 16; i++)
+.LL36:
+	__st.umiq	0, __main_end - 9  /* i */
+.LL38:
+	__ld.umq	__main_end - 9  /* i */
+	__ult_b.uiq	16
+	__btrue		.LL40
+	__bra		.LL41
+.LL39:
+	__inc.umq	__main_end - 9  /* i */
+	__bra		.LL38
+.LL40:
+
+	.dbg	line,	"tests/huc-inline.c", 81; tiles[i] = i * 3;
+	__ld.um		__main_end - 9  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__ldx.umq	__main_end - 9  /* i */
+	__st.uaxq	_tiles
+	__bra		.LL39
+.LL41:
+
+	.dbg	line,	"tests/huc-inline.c", 82; if (tile_at(1, 2) != 27 || tile_at(3, 3) != 45)
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.us		0  /* y */
+	__asl.wi	2
+	__add.us	2  /* x */
+	__ld.uar	_tiles
+.LL43:
+	__modsp		4
+	__ext.ur
+	__neq_w.wi	27
+	__btrue		.LL44
+	__ld.wi		3
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.us		0  /* y */
+	__asl.wi	2
+	__add.us	2  /* x */
+	__ld.uar	_tiles
+.LL45:
+	__modsp		4
+	__ext.ur
+	__neq_w.wi	45
+.LL44:
+	__bfalse	.LL42
+
+	.dbg	line,	"tests/huc-inline.c", 83; return 3;
+	__ld.wi		3
+	__bra		.LL21
+
+	.dbg	line,	"tests/huc-inline.c", 85; k = sum_to(10) + sum_to(4);
+.LL42:
+	__ld.wi		10
+	__pusharg.wr
+	__st.wmiq	0, __sum_to_end - 4  /* t */
+	__st.wmiq	1, __sum_to_end - 2  /* i */
+.LL46:
+	__ld.wm		__sum_to_end - 2  /* i */
+	__sle_w.ws	0  /* n */
+	__btrue		.LL48
+	__bra		.LL49
+.LL47:
+	__inc.wmq	__sum_to_end - 2  /* i */
+	__bra		.LL46
+.LL48:
+	__ld.wm		__sum_to_end - 2  /* i */
+	__add_st.wmq	__sum_to_end - 4  /* t */
+	__bra		.LL47
+.LL49:
+	__ld.wm		__sum_to_end - 4  /* t */
+.LL50:
+	__modsp		2
+	__push.wr
+	__ld.wi		4
+	__pusharg.wr
+	__st.wmiq	0, __sum_to_end - 4  /* t */
+	__st.wmiq	1, __sum_to_end - 2  /* i */
+.LL51:
+	__ld.wm		__sum_to_end - 2  /* i */
+	__sle_w.ws	0  /* n */
+	__btrue		.LL53
+	__bra		.LL54
+.LL52:
+	__inc.wmq	__sum_to_end - 2  /* i */
+	__bra		.LL51
+.LL53:
+	__ld.wm		__sum_to_end - 2  /* i */
+	__add_st.wmq	__sum_to_end - 4  /* t */
+	__bra		.LL52
+.LL54:
+	__ld.wm		__sum_to_end - 4  /* t */
+.LL55:
+	__modsp		2
+	__add.wt
+	__st.wmq	__main_end - 11  /* k */
+
+	.dbg	line,	"tests/huc-inline.c", 86; if (k != 65)
+	__neq_w.wi	65
+	__bfalse	.LL56
+
+	.dbg	line,	"tests/huc-inline.c", 87; return 4;
+	__ld.wi		4
+	__bra		.LL21
+
+	.dbg	line,	"tests/huc-inline.c", 89; for (i = 0; i < 5; i++)
+.LL56:
+	__st.umiq	0, __main_end - 9  /* i */
+.LL57:
+	__ld.umq	__main_end - 9  /* i */
+	__ult_b.uiq	5
+	__btrue		.LL59
+	__bra		.LL60
+.LL58:
+	__inc.umq	__main_end - 9  /* i */
+	__bra		.LL57
+.LL59:
+
+	.dbg	line,	"tests/huc-inline.c", 90; count();
+	__inc.wmq	_calls
+.LL61	.alias		.LL58
+	__bra		.LL58
+.LL60:
+
+	.dbg	line,	"tests/huc-inline.c", 91; if (calls != 5)
+	__ld.wm		_calls
+	__neq_w.wi	5
+	__bfalse	.LL62
+
+	.dbg	line,	"tests/huc-inline.c", 92; return 5;
+	__ld.wi		5
+	__bra		.LL21
+
+	.dbg	line,	"tests/huc-inline.c", 94; if (twice(70) != 140 || twice(300) != 200 || clamp(twice(-3), -1, 1) != 0)
+.LL62:
+	__ld.wi		70
+	__pusharg.wr
+	__call		_twice
+	__neq_w.wi	140
+	__btrue		.LL64
+	__ld.wi		300
+	__pusharg.wr
+	__call		_twice
+	__neq_w.wi	200
+.LL64:
+	__btrue		.LL65
+	__ld.wi		-3
+	__pusharg.wr
+	__call		_twice
+	__pusharg.wr
+	__ld.wi		-1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		4  /* v */
+	__slt_w.ws	2  /* lo */
+	__bfalse	.LL66
+	__ld.ws		2  /* lo */
+	__bra		.LL68
+.LL66:
+	__ld.ws		4  /* v */
+	__sgt_w.ws	0  /* hi */
+	__bfalse	.LL67
+	__ld.ws		0  /* hi */
+	__bra		.LL68
+.LL67:
+	__ld.ws		4  /* v */
+.LL68:
+	__modsp		6
+	__tst.wr
+.LL65:
+	__bfalse	.LL63
+
+	.dbg	line,	"tests/huc-inline.c", 95; return 6;
+	__ld.wi		6
+	__bra		.LL21
+
+	.dbg	line,	"tests/huc-inline.c", 97; if (sign(-300) != -1 || sign(0) != 0 || sign(clamp(9, 1, 2)) != 1)
+.LL63:
+	__ld.wi		-300
+	__pusharg.wr
+	__st.umiq	0, __sign_end - 1  /* s */
+	__ld.ws		0  /* v */
+	__slt_w.wi	0
+	__bfalse	.LL70
+	__st.umiq	-1, __sign_end - 1  /* s */
+	__bra		.LL72
+.LL70:
+	__ld.ws		0  /* v */
+	__sgt_w.wi	0
+	__bfalse	.LL71
+	__st.umiq	1, __sign_end - 1  /* s */
+.LL71:
+.LL72:
+	__ld.bm		__sign_end - 1  /* s */
+.LL73:
+	__modsp		2
+	__ext.br
+	__neq_w.wi	-1
+	__btrue		.LL74
+	__ld.wi		0
+	__pusharg.wr
+	__st.umiq	0, __sign_end - 1  /* s */
+	__ld.ws		0  /* v */
+	__slt_w.wi	0
+	__bfalse	.LL75
+	__st.umiq	-1, __sign_end - 1  /* s */
+	__bra		.LL77
+.LL75:
+	__ld.ws		0  /* v */
+	__sgt_w.wi	0
+	__bfalse	.LL76
+	__st.umiq	1, __sign_end - 1  /* s */
+.LL76:
+.LL77:
+	__ld.bm		__sign_end - 1  /* s */
+.LL78:
+	__modsp		2
+	__ext.br
+	__tst.wr
+.LL74:
+	__btrue		.LL79
+	__ld.wi		9
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		4  /* v */
+	__slt_w.ws	2  /* lo */
+	__bfalse	.LL80
+	__ld.ws		2  /* lo */
+	__bra		.LL82
+.LL80:
+	__ld.ws		4  /* v */
+	__sgt_w.ws	0  /* hi */
+	__bfalse	.LL81
+	__ld.ws		0  /* hi */
+	__bra		.LL82
+.LL81:
+	__ld.ws		4  /* v */
+.LL82:
+	__modsp		6
+	__pusharg.wr
+	__st.umiq	0, __sign_end - 1  /* s */
+	__ld.ws		0  /* v */
+	__slt_w.wi	0
+	__bfalse	.LL83
+	__st.umiq	-1, __sign_end - 1  /* s */
+	__bra		.LL85
+.LL83:
+	__ld.ws		0  /* v */
+	__sgt_w.wi	0
+	__bfalse	.LL84
+	__st.umiq	1, __sign_end - 1  /* s */
+.LL84:
+.LL85:
+	__ld.bm		__sign_end - 1  /* s */
+.LL86:
+	__modsp		2
+	__ext.br
+	__neq_w.wi	1
+.LL79:
+	__bfalse	.LL69
+
+	.dbg	line,	"tests/huc-inline.c", 98; return 7;
+	__ld.wi		7
+	__bra		.LL21
+
+	.dbg	line,	"tests/huc-inline.c", 100; return 0;
+.LL69:
+	__ld.wi		0
+.LL21:
+
+	.dbg	line,	"tests/huc-inline.c", 101; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-inline.c", 103; #else
+	.dbg	line,	"tests/huc-inline.c", 105; int main()
+	.dbg	line,	"tests/huc-inline.c", 106; {
+	.dbg	line,	"tests/huc-inline.c", 107; return 0;
+	.dbg	line,	"tests/huc-inline.c", 108; }
+	.dbg	line,	"tests/huc-inline.c", 110; #endif
+	.dbg	clear
+
+	.bss
+_tiles:
+		ds	16
+
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:10
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    11  _main
+;
+; 11 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       152     40    11  overlaid locals
+;        22      8     2  calls
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 11, 40, 152
+__main_end	=	__overlay_frames + 11
+	auto_zp_var	_calls, 2, 8, 22
+	.endm
@@ -0,0 +1,126 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-macro.c", 1; #define NADA return
+	.dbg	line,	"tests/huc-macro.c", 2; #undef NADA
+	.dbg	line,	"tests/huc-macro.c", 3; #define BAZ return
+	.dbg	line,	"tests/huc-macro.c", 5; #define BLA(x, y) if (y)
+	.dbg	line,	"tests/huc-macro.c", 6; #define FOO(x, y) int x = y
+	.dbg	line,	"tests/huc-macro.c", 7; #define BAR(x) (x+x+x)
+	.dbg	line,	"tests/huc-macro.c", 9; int main()
+	.dbg	line,	"tests/huc-macro.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-macro.c", 11; FOO(a, 1);
+	__st.wmiq	1, __main_end - 2  /* a */
+
+	.dbg	line,	"tests/huc-macro.c", 12; if (1 != a)
+	__ld.wi		1
+	__neq_w.wm	__main_end - 2  /* a */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-macro.c", 13; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-macro.c", 14; a += BAR(4);
+.LL3:
+	__add_st.wmiq	12, __main_end - 2  /* a */
+
+	.dbg	line,	"tests/huc-macro.c", 15; if (a != 13)
+	__ld.wm		__main_end - 2  /* a */
+	__neq_w.wi	13
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-macro.c", 16; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-macro.c", 17; BLA(5, 0)
+.LL4:
+	__ld.wi		0
+	__tst.wr
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-macro.c", 18; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-macro.c", 19; BAZ 0;
+.LL5:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-macro.c", 20; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:11
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
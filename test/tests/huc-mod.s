@@ -0,0 +1,148 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-mod.c", 1; main()
+	.dbg	line,	"tests/huc-mod.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-mod.c", 3; if (1 % 3 != 1)
+	__ld.wi		1
+	__neq_w.wi	1
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-mod.c", 4; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mod.c", 5; if (3 % 1 != 0)
+.LL3:
+	__ld.wi		0
+	__tst.wr
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-mod.c", 6; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mod.c", 7; if (5 % 3 != 2)
+.LL4:
+	__ld.wi		2
+	__neq_w.wi	2
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-mod.c", 8; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mod.c", 9; if (3 % 3 != 0)
+.LL5:
+	__ld.wi		0
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/huc-mod.c", 10; exit(4);
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mod.c", 11; if (-5 % 5 != 0)
+.LL6:
+	__ld.wi		0
+	__tst.wr
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/huc-mod.c", 12; exit(5);
+	__ld.wi		5
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mod.c", 13; if (-5 % 2 != -1)
+.LL7:
+	__ld.wi		-1
+	__neq_w.wi	-1
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/huc-mod.c", 14; exit(6);
+	__ld.wi		6
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mod.c", 15; if (5 % -2 != 1)
+.LL8:
+	__ld.wi		1
+	__neq_w.wi	1
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/huc-mod.c", 16; exit(7);
+	__ld.wi		7
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mod.c", 18; return 0;
+.LL9:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-mod.c", 19; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
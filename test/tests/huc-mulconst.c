@@ -0,0 +1,64 @@
+/* multiplication by constants, checked against repeated addition */
+
+unsigned int i, u, p, s;
+int n, m;
+
+#define CHECK_MUL(c, e) \
+  for (i = 0; i < 600; i += 23) { \
+    u = i * 37; \
+    p = u * (c); \
+    for (s = 0, m = 0; m < (c); m++) \
+      s += u; \
+    if (p != s) \
+      exit(e); \
+  }
+
+void check_small()
+{
+  CHECK_MUL(3, 1);
+  CHECK_MUL(6, 2);
+  CHECK_MUL(7, 3);
+  CHECK_MUL(10, 4);
+  CHECK_MUL(12, 5);
+  CHECK_MUL(20, 6);
+  CHECK_MUL(24, 7);
+}
+
+void check_large()
+{
+  CHECK_MUL(40, 11);
+  CHECK_MUL(65, 12);
+  CHECK_MUL(72, 13);
+  CHECK_MUL(255, 14);
+  CHECK_MUL(320, 15);
+  CHECK_MUL(1000, 16);
+}
+
+int main()
+{
+  check_small();
+  check_large();
+
+  /* the top bits are lost */
+  u = 0x1234;
+  if (u * 0x7FFF != 0xEDCC)
+    exit(21);
+  if (u * 0xFFF0 != 0xDCC0)
+    exit(22);
+  if (u * 0x5555 != 0x4F44)
+    exit(23);
+
+  /* long enough that FAST_MULTIPLY's __mulint would be faster */
+  if (u * 0x6DB7 != 0x272C)
+    exit(24);
+  if (u * 0xB6DB != 0x8A7C)
+    exit(25);
+
+  n = -3;
+  if (n * 40 != -120)
+    exit(31);
+  if (n * -40 != 120)
+    exit(32);
+
+  return 0;
+}
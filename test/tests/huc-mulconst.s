@@ -0,0 +1,976 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-mulconst.c", 1; /* multiplication by constants, checked against repeated addition */
+	.dbg	line,	"tests/huc-mulconst.c", 3; unsigned int i, u, p, s;
+	.dbg	line,	"tests/huc-mulconst.c", 4; int n, m;
+	.dbg	line,	"tests/huc-mulconst.c", 6; #define CHECK_MUL(c, e) \
+	.dbg	line,	"tests/huc-mulconst.c", 7; for (i = 0; i < 600; i += 23) { \
+	.dbg	line,	"tests/huc-mulconst.c", 8; u = i * 37; \
+	.dbg	line,	"tests/huc-mulconst.c", 9; p = u * (c); \
+	.dbg	line,	"tests/huc-mulconst.c", 10; for (s = 0, m = 0; m < (c); m++) \
+	.dbg	line,	"tests/huc-mulconst.c", 11; s += u; \
+	.dbg	line,	"tests/huc-mulconst.c", 12; if (p != s) \
+	.dbg	line,	"tests/huc-mulconst.c", 13; exit(e); \
+	.dbg	line,	"tests/huc-mulconst.c", 14; }
+	.dbg	line,	"tests/huc-mulconst.c", 16; void check_small()
+	.dbg	line,	"tests/huc-mulconst.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_check_small
+	__enter		_check_small
+
+	.dbg	line,	"tests/huc-mulconst.c", 18; CHECK_MUL(3, 1);
+	__st.wmiq	0, _i
+.LL3:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__add_st.wmiq	23, _i
+	__bra		.LL3
+.LL5:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL7:
+	__ld.wm		_m
+	__slt_w.wi	3
+	__btrue		.LL9
+	__bra		.LL10
+.LL8:
+	__inc.wmq	_m
+	__bra		.LL7
+.LL9:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL8
+.LL10:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL11
+	__ld.wi		1
+	__call		_exit.1
+.LL11	.alias		.LL4
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/huc-mulconst.c", 19; CHECK_MUL(6, 2);
+	__st.wmiq	0, _i
+.LL12:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL14
+	__bra		.LL15
+.LL13:
+	__add_st.wmiq	23, _i
+	__bra		.LL12
+.LL14:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL16:
+	__ld.wm		_m
+	__slt_w.wi	6
+	__btrue		.LL18
+	__bra		.LL19
+.LL17:
+	__inc.wmq	_m
+	__bra		.LL16
+.LL18:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL17
+.LL19:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL20
+	__ld.wi		2
+	__call		_exit.1
+.LL20	.alias		.LL13
+	__bra		.LL13
+.LL15:
+
+	.dbg	line,	"tests/huc-mulconst.c", 20; CHECK_MUL(7, 3);
+	__st.wmiq	0, _i
+.LL21:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL23
+	__bra		.LL24
+.LL22:
+	__add_st.wmiq	23, _i
+	__bra		.LL21
+.LL23:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL25:
+	__ld.wm		_m
+	__slt_w.wi	7
+	__btrue		.LL27
+	__bra		.LL28
+.LL26:
+	__inc.wmq	_m
+	__bra		.LL25
+.LL27:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL26
+.LL28:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL29
+	__ld.wi		3
+	__call		_exit.1
+.LL29	.alias		.LL22
+	__bra		.LL22
+.LL24:
+
+	.dbg	line,	"tests/huc-mulconst.c", 21; CHECK_MUL(10, 4);
+	__st.wmiq	0, _i
+.LL30:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL32
+	__bra		.LL33
+.LL31:
+	__add_st.wmiq	23, _i
+	__bra		.LL30
+.LL32:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL34:
+	__ld.wm		_m
+	__slt_w.wi	10
+	__btrue		.LL36
+	__bra		.LL37
+.LL35:
+	__inc.wmq	_m
+	__bra		.LL34
+.LL36:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL35
+.LL37:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL38
+	__ld.wi		4
+	__call		_exit.1
+.LL38	.alias		.LL31
+	__bra		.LL31
+.LL33:
+
+	.dbg	line,	"tests/huc-mulconst.c", 22; CHECK_MUL(12, 5);
+	__st.wmiq	0, _i
+.LL39:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL41
+	__bra		.LL42
+.LL40:
+	__add_st.wmiq	23, _i
+	__bra		.LL39
+.LL41:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL43:
+	__ld.wm		_m
+	__slt_w.wi	12
+	__btrue		.LL45
+	__bra		.LL46
+.LL44:
+	__inc.wmq	_m
+	__bra		.LL43
+.LL45:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL44
+.LL46:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL47
+	__ld.wi		5
+	__call		_exit.1
+.LL47	.alias		.LL40
+	__bra		.LL40
+.LL42:
+
+	.dbg	line,	"tests/huc-mulconst.c", 23; CHECK_MUL(20, 6);
+	__st.wmiq	0, _i
+.LL48:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL50
+	__bra		.LL51
+.LL49:
+	__add_st.wmiq	23, _i
+	__bra		.LL48
+.LL50:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL52:
+	__ld.wm		_m
+	__slt_w.wi	20
+	__btrue		.LL54
+	__bra		.LL55
+.LL53:
+	__inc.wmq	_m
+	__bra		.LL52
+.LL54:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL53
+.LL55:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL56
+	__ld.wi		6
+	__call		_exit.1
+.LL56	.alias		.LL49
+	__bra		.LL49
+.LL51:
+
+	.dbg	line,	"tests/huc-mulconst.c", 24; CHECK_MUL(24, 7);
+	__st.wmiq	0, _i
+.LL57:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL59
+	__bra		.LL60
+.LL58:
+	__add_st.wmiq	23, _i
+	__bra		.LL57
+.LL59:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL61:
+	__ld.wm		_m
+	__slt_w.wi	24
+	__btrue		.LL63
+	__bra		.LL64
+.LL62:
+	__inc.wmq	_m
+	__bra		.LL61
+.LL63:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL62
+.LL64:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL65
+	__ld.wi		7
+	__call		_exit.1
+.LL65	.alias		.LL58
+	__bra		.LL58
+.LL60:
+
+	.dbg	line,	"tests/huc-mulconst.c", 25; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-mulconst.c", 27; void check_large()
+	.dbg	line,	"tests/huc-mulconst.c", 28; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_check_large
+	__enter		_check_large
+
+	.dbg	line,	"tests/huc-mulconst.c", 29; CHECK_MUL(40, 11);
+	__st.wmiq	0, _i
+.LL67:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL69
+	__bra		.LL70
+.LL68:
+	__add_st.wmiq	23, _i
+	__bra		.LL67
+.LL69:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL71:
+	__ld.wm		_m
+	__slt_w.wi	40
+	__btrue		.LL73
+	__bra		.LL74
+.LL72:
+	__inc.wmq	_m
+	__bra		.LL71
+.LL73:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL72
+.LL74:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL75
+	__ld.wi		11
+	__call		_exit.1
+.LL75	.alias		.LL68
+	__bra		.LL68
+.LL70:
+
+	.dbg	line,	"tests/huc-mulconst.c", 30; CHECK_MUL(65, 12);
+	__st.wmiq	0, _i
+.LL76:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL78
+	__bra		.LL79
+.LL77:
+	__add_st.wmiq	23, _i
+	__bra		.LL76
+.LL78:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	6
+	__add.wm	<multiplicand
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL80:
+	__ld.wm		_m
+	__slt_w.wi	65
+	__btrue		.LL82
+	__bra		.LL83
+.LL81:
+	__inc.wmq	_m
+	__bra		.LL80
+.LL82:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL81
+.LL83:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL84
+	__ld.wi		12
+	__call		_exit.1
+.LL84	.alias		.LL77
+	__bra		.LL77
+.LL79:
+
+	.dbg	line,	"tests/huc-mulconst.c", 31; CHECK_MUL(72, 13);
+	__st.wmiq	0, _i
+.LL85:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL87
+	__bra		.LL88
+.LL86:
+	__add_st.wmiq	23, _i
+	__bra		.LL85
+.LL87:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL89:
+	__ld.wm		_m
+	__slt_w.wi	72
+	__btrue		.LL91
+	__bra		.LL92
+.LL90:
+	__inc.wmq	_m
+	__bra		.LL89
+.LL91:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL90
+.LL92:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL93
+	__ld.wi		13
+	__call		_exit.1
+.LL93	.alias		.LL86
+	__bra		.LL86
+.LL88:
+
+	.dbg	line,	"tests/huc-mulconst.c", 32; CHECK_MUL(255, 14);
+	__st.wmiq	0, _i
+.LL94:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL96
+	__bra		.LL97
+.LL95:
+	__add_st.wmiq	23, _i
+	__bra		.LL94
+.LL96:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	8
+	__sub.wm	<multiplicand
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL98:
+	__ld.wm		_m
+	__slt_w.wi	255
+	__btrue		.LL100
+	__bra		.LL101
+.LL99:
+	__inc.wmq	_m
+	__bra		.LL98
+.LL100:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL99
+.LL101:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL102
+	__ld.wi		14
+	__call		_exit.1
+.LL102	.alias		.LL95
+	__bra		.LL95
+.LL97:
+
+	.dbg	line,	"tests/huc-mulconst.c", 33; CHECK_MUL(320, 15);
+	__st.wmiq	0, _i
+.LL103:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL105
+	__bra		.LL106
+.LL104:
+	__add_st.wmiq	23, _i
+	__bra		.LL103
+.LL105:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	6
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL107:
+	__ld.wm		_m
+	__slt_w.wi	320
+	__btrue		.LL109
+	__bra		.LL110
+.LL108:
+	__inc.wmq	_m
+	__bra		.LL107
+.LL109:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL108
+.LL110:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL111
+	__ld.wi		15
+	__call		_exit.1
+.LL111	.alias		.LL104
+	__bra		.LL104
+.LL106:
+
+	.dbg	line,	"tests/huc-mulconst.c", 34; CHECK_MUL(1000, 16);
+	__st.wmiq	0, _i
+.LL112:
+	__ld.wm		_i
+	__ult_w.wi	600
+	__btrue		.LL114
+	__bra		.LL115
+.LL113:
+	__add_st.wmiq	23, _i
+	__bra		.LL112
+.LL114:
+	__ld.wm		_i
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__st.wmq	_u
+	__st.wm	<multiplicand
+	__asl.wi	5
+	__sub.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__st.wmq	_p
+	__st.wmiq	0, _s
+	__st.wmiq	0, _m
+.LL116:
+	__ld.wm		_m
+	__slt_w.wi	1000
+	__btrue		.LL118
+	__bra		.LL119
+.LL117:
+	__inc.wmq	_m
+	__bra		.LL116
+.LL118:
+	__ld.wm		_u
+	__add_st.wmq	_s
+	__bra		.LL117
+.LL119:
+	__ld.wm		_p
+	__neq_w.wm	_s
+	__bfalse	.LL120
+	__ld.wi		16
+	__call		_exit.1
+.LL120	.alias		.LL113
+	__bra		.LL113
+.LL115:
+
+	.dbg	line,	"tests/huc-mulconst.c", 35; }
+.LL66:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-mulconst.c", 37; int main()
+	.dbg	line,	"tests/huc-mulconst.c", 38; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-mulconst.c", 39; check_small();
+	__call		_check_small
+
+	.dbg	line,	"tests/huc-mulconst.c", 40; check_large();
+	__call		_check_large
+
+	.dbg	line,	"tests/huc-mulconst.c", 42; /* the top bits are lost */
+
+	.dbg	line,	"tests/huc-mulconst.c", 43; u = 0x1234;
+	__st.wmiq	4660, _u
+
+	.dbg	line,	"tests/huc-mulconst.c", 44; if (u * 0x7FFF != 0xEDCC)
+	__ld.wm		_u
+	__st.wm	<multiplicand
+	__asl.wi	15
+	__sub.wm	<multiplicand
+	__neq_w.wi	60876
+	__bfalse	.LL122
+
+	.dbg	line,	"tests/huc-mulconst.c", 45; exit(21);
+	__ld.wi		21
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mulconst.c", 46; if (u * 0xFFF0 != 0xDCC0)
+.LL122:
+	__ld.wm		_u
+	.if	FAST_MULTIPLY
+	__mul.wi	65520
+	.else
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	4
+	.endif
+	__neq_w.wi	56512
+	__bfalse	.LL123
+
+	.dbg	line,	"tests/huc-mulconst.c", 47; exit(22);
+	__ld.wi		22
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mulconst.c", 48; if (u * 0x5555 != 0x4F44)
+.LL123:
+	__ld.wm		_u
+	.if	FAST_MULTIPLY
+	__mul.wi	21845
+	.else
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	.endif
+	__neq_w.wi	20292
+	__bfalse	.LL124
+
+	.dbg	line,	"tests/huc-mulconst.c", 49; exit(23);
+	__ld.wi		23
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mulconst.c", 51; /* long enough that FAST_MULTIPLY's __mulint would be faster */
+
+	.dbg	line,	"tests/huc-mulconst.c", 52; if (u * 0x6DB7 != 0x272C)
+.LL124:
+	__ld.wm		_u
+	.if	FAST_MULTIPLY
+	__mul.wi	28087
+	.else
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	.endif
+	__neq_w.wi	10028
+	__bfalse	.LL125
+
+	.dbg	line,	"tests/huc-mulconst.c", 53; exit(24);
+	__ld.wi		24
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mulconst.c", 54; if (u * 0xB6DB != 0x8A7C)
+.LL125:
+	__ld.wm		_u
+	.if	FAST_MULTIPLY
+	__mul.wi	46811
+	.else
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	.endif
+	__neq_w.wi	35452
+	__bfalse	.LL126
+
+	.dbg	line,	"tests/huc-mulconst.c", 55; exit(25);
+	__ld.wi		25
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mulconst.c", 57; n = -3;
+.LL126:
+	__st.wmiq	-3, _n
+
+	.dbg	line,	"tests/huc-mulconst.c", 58; if (n * 40 != -120)
+	__ld.wm		_n
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__neq_w.wi	-120
+	__bfalse	.LL127
+
+	.dbg	line,	"tests/huc-mulconst.c", 59; exit(31);
+	__ld.wi		31
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mulconst.c", 60; if (n * -40 != 120)
+.LL127:
+	__ld.wm		_n
+	.if	FAST_MULTIPLY
+	__mul.wi	65496
+	.else
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	3
+	.endif
+	__neq_w.wi	120
+	__bfalse	.LL128
+
+	.dbg	line,	"tests/huc-mulconst.c", 61; exit(32);
+	__ld.wi		32
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-mulconst.c", 63; return 0;
+.LL128:
+	__ld.wi		0
+.LL121:
+
+	.dbg	line,	"tests/huc-mulconst.c", 64; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:10
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;      6656    104     2  m
+;      5200    104     2  s
+;      2092     90     2  u
+;      1040    130     2  i
+;       416     52     2  p
+;         6      6     2  n
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_m, 2, 104, 6656
+	auto_zp_var	_s, 2, 104, 5200
+	auto_zp_var	_u, 2, 90, 2092
+	auto_zp_var	_i, 2, 130, 1040
+	auto_zp_var	_p, 2, 52, 416
+	auto_zp_var	_n, 2, 6, 6
+	.endm
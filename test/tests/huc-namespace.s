@@ -0,0 +1,156 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-namespace.c", 1; int a,b;
+	.dbg	line,	"tests/huc-namespace.c", 3; struct foo {
+	.dbg	line,	"tests/huc-namespace.c", 4; int a;
+	.dbg	line,	"tests/huc-namespace.c", 5; int b;
+	.dbg	line,	"tests/huc-namespace.c", 6; };
+	.dbg	line,	"tests/huc-namespace.c", 8; int main()
+	.dbg	line,	"tests/huc-namespace.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-namespace.c", 10; struct foo x;
+
+	.dbg	line,	"tests/huc-namespace.c", 11; x.a = 5;
+	__st.wmiq	5, __main_end - 4  /* x */
+
+	.dbg	line,	"tests/huc-namespace.c", 12; x.b = 4;
+	__st.wmiq	4, __main_end - 4 + 2  /* x */
+
+	.dbg	line,	"tests/huc-namespace.c", 13; a = 3;
+	__st.wmiq	3, _a
+
+	.dbg	line,	"tests/huc-namespace.c", 14; b = 2;
+	__st.wmiq	2, _b
+
+	.dbg	line,	"tests/huc-namespace.c", 15; if (x.a != 5)
+	__ld.wm		__main_end - 4  /* x */
+	__neq_w.wi	5
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-namespace.c", 16; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-namespace.c", 17; if (a != 3)
+.LL3:
+	__ld.wm		_a
+	__neq_w.wi	3
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-namespace.c", 18; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-namespace.c", 19; if (b != 2)
+.LL4:
+	__ld.wm		_b
+	__neq_w.wi	2
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-namespace.c", 20; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-namespace.c", 21; if (x.b != 4)
+.LL5:
+	__ld.wm		__main_end - 4 + 2  /* x */
+	__neq_w.wi	4
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/huc-namespace.c", 22; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-namespace.c", 23; return 0;
+.LL6:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-namespace.c", 24; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  a
+;         4      4     2  b
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_a, 2, 4, 4
+	auto_zp_var	_b, 2, 4, 4
+	.endm
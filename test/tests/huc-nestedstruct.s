@@ -0,0 +1,131 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-nestedstruct.c", 1; struct a {
+	.dbg	line,	"tests/huc-nestedstruct.c", 2; int a, b;
+	.dbg	line,	"tests/huc-nestedstruct.c", 3; };
+	.dbg	line,	"tests/huc-nestedstruct.c", 4; struct b {
+	.dbg	line,	"tests/huc-nestedstruct.c", 5; int c;
+	.dbg	line,	"tests/huc-nestedstruct.c", 6; struct a d;
+	.dbg	line,	"tests/huc-nestedstruct.c", 7; };
+	.dbg	line,	"tests/huc-nestedstruct.c", 9; main()
+	.dbg	line,	"tests/huc-nestedstruct.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 11; struct b x;
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 12; x.c = 1;
+	__st.wmiq	1, __main_end - 6  /* x */
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 13; x.d.a = 2;
+	__st.wmiq	2, __main_end - 6 + 2  /* x */
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 14; x.d.b = 3;
+	__st.wmiq	3, __main_end - 6 + 2 + 2  /* x */
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 15; if (x.c != 1)
+	__ld.wm		__main_end - 6  /* x */
+	__neq_w.wi	1
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 16; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 17; x.c = 4;
+.LL3:
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 18; if (x.d.a != 2)
+	__ld.wm		__main_end - 6 + 2  /* x */
+	__neq_w.wi	2
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 19; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 20; if (x.d.b != 3)
+.LL4:
+	__ld.wm		__main_end - 6 + 2 + 2  /* x */
+	__neq_w.wi	3
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 21; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 22; return 0;
+.LL5:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-nestedstruct.c", 23; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
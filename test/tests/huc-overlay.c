@@ -0,0 +1,71 @@
+/* locals of functions that can share memory with -foverlay-frames */
+
+#ifdef __HUCC__
+
+int leaf(int a)
+{
+  int t[2];
+  t[0] = a;
+  t[1] = a + 1;
+  return t[0] + t[1];
+}
+
+int b(int x)
+{
+  int i, s;
+  s = 0;
+  for (i = 0; i < x; i++)
+    s += leaf(i);
+  return s;
+}
+
+int c(int x)
+{
+  int j, k;
+  j = x;
+  k = b(j);
+  return j + k;
+}
+
+int d(int x)
+{
+  int m, n;
+  m = c(x);
+  n = b(x);
+  return m + n;
+}
+
+int e(int x)
+{
+  int q;
+  q = b(x) * 2;
+  return q;
+}
+
+int (*fp)(int);
+
+int main()
+{
+  int r;
+
+  fp = e;
+  r = d(3);
+  if (r != 3 + 9 + 9)
+    exit(1);
+  r = c(4) + d(2);
+  if (r != (4 + 16) + (2 + 4 + 4))
+    exit(2);
+  if (fp(2) != 8)
+    exit(3);
+  return 0;
+}
+
+#else
+
+/* HuC does not support function pointers */
+int main()
+{
+  return 0;
+}
+
+#endif
@@ -0,0 +1,387 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-overlay.c", 1; /* locals of functions that can share memory with -foverlay-frames */
+	.dbg	line,	"tests/huc-overlay.c", 3; #ifdef __HUCC__
+	.dbg	line,	"tests/huc-overlay.c", 5; int leaf(int a)
+	.dbg	line,	"tests/huc-overlay.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_leaf
+	__enter		_leaf
+
+	.dbg	line,	"tests/huc-overlay.c", 7; int t[2];
+
+	.dbg	line,	"tests/huc-overlay.c", 8; t[0] = a;
+	__ld.ws		0  /* a */
+	__st.wmq	__leaf_end - 4  /* t */
+
+	.dbg	line,	"tests/huc-overlay.c", 9; t[1] = a + 1;
+	__ld.ws		0  /* a */
+	__add.wi	1
+	__st.wmq	__leaf_end - 4 + 2  /* t */
+
+	.dbg	line,	"tests/huc-overlay.c", 10; return t[0] + t[1];
+	__ld.wm		__leaf_end - 4  /* t */
+	__add.wm	__leaf_end - 4 + 2  /* t */
+.LL2:
+
+	.dbg	line,	"tests/huc-overlay.c", 11; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__leaf_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-overlay.c", 13; int b(int x)
+	.dbg	line,	"tests/huc-overlay.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_b
+	__enter		_b
+
+	.dbg	line,	"tests/huc-overlay.c", 15; int i, s;
+
+	.dbg	line,	"tests/huc-overlay.c", 16; s = 0;
+	__st.wmiq	0, __b_end - 4  /* s */
+
+	.dbg	line,	"tests/huc-overlay.c", 17; for (i = 0; i < x; i++)
+	__st.wmiq	0, __b_end - 2  /* i */
+.LL4:
+	__ld.wm		__b_end - 2  /* i */
+	__slt_w.ws	0  /* x */
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__b_end - 2  /* i */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/huc-overlay.c", 18; s += leaf(i);
+	__ld.wm		__b_end - 2  /* i */
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__st.wmq	__leaf_end - 4  /* t */
+	__ld.ws		0  /* a */
+	__add.wi	1
+	__st.wmq	__leaf_end - 4 + 2  /* t */
+	__ld.wm		__leaf_end - 4  /* t */
+	__add.wm	__leaf_end - 4 + 2  /* t */
+.LL8:
+	__modsp		2
+	__add_st.wmq	__b_end - 4  /* s */
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/huc-overlay.c", 19; return s;
+	__ld.wm		__b_end - 4  /* s */
+.LL3:
+
+	.dbg	line,	"tests/huc-overlay.c", 20; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-overlay.c", 22; int c(int x)
+	.dbg	line,	"tests/huc-overlay.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_c
+	__enter		_c
+
+	.dbg	line,	"tests/huc-overlay.c", 24; int j, k;
+
+	.dbg	line,	"tests/huc-overlay.c", 25; j = x;
+	__ld.ws		0  /* x */
+	__st.wmq	__c_end - 2  /* j */
+
+	.dbg	line,	"tests/huc-overlay.c", 26; k = b(j);
+	__pusharg.wr
+	__call		_b
+	__st.wmq	__c_end - 4  /* k */
+
+	.dbg	line,	"tests/huc-overlay.c", 27; return j + k;
+	__ld.wm		__c_end - 2  /* j */
+	__add.wm	__c_end - 4  /* k */
+.LL9:
+
+	.dbg	line,	"tests/huc-overlay.c", 28; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-overlay.c", 30; int d(int x)
+	.dbg	line,	"tests/huc-overlay.c", 31; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_d
+	__enter		_d
+
+	.dbg	line,	"tests/huc-overlay.c", 32; int m, n;
+
+	.dbg	line,	"tests/huc-overlay.c", 33; m = c(x);
+	__ld.ws		0  /* x */
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__st.wmq	__c_end - 2  /* j */
+	__pusharg.wr
+	__call		_b
+	__st.wmq	__c_end - 4  /* k */
+	__ld.wm		__c_end - 2  /* j */
+	__add.wm	__c_end - 4  /* k */
+.LL11:
+	__modsp		2
+	__st.wmq	__d_end - 2  /* m */
+
+	.dbg	line,	"tests/huc-overlay.c", 34; n = b(x);
+	__ld.ws		0  /* x */
+	__pusharg.wr
+	__call		_b
+	__st.wmq	__d_end - 4  /* n */
+
+	.dbg	line,	"tests/huc-overlay.c", 35; return m + n;
+	__ld.wm		__d_end - 2  /* m */
+	__add.wm	__d_end - 4  /* n */
+.LL10:
+
+	.dbg	line,	"tests/huc-overlay.c", 36; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-overlay.c", 38; int e(int x)
+	.dbg	line,	"tests/huc-overlay.c", 39; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_e
+	__enter		_e
+
+	.dbg	line,	"tests/huc-overlay.c", 40; int q;
+
+	.dbg	line,	"tests/huc-overlay.c", 41; q = b(x) * 2;
+	__ld.ws		0  /* x */
+	__pusharg.wr
+	__call		_b
+	__asl.wi	1
+	__st.wmq	__e_end - 2  /* q */
+
+	.dbg	line,	"tests/huc-overlay.c", 42; return q;
+.LL12:
+
+	.dbg	line,	"tests/huc-overlay.c", 43; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-overlay.c", 45; int (*fp)(int);
+	.dbg	line,	"tests/huc-overlay.c", 47; int main()
+	.dbg	line,	"tests/huc-overlay.c", 48; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-overlay.c", 49; int r;
+
+	.dbg	line,	"tests/huc-overlay.c", 51; fp = e;
+	__ld.wi		_e
+	__st.wmq	_fp
+
+	.dbg	line,	"tests/huc-overlay.c", 52; r = d(3);
+	__ld.wi		3
+	__pusharg.wr
+	__call		_d
+	__st.wmq	__main_end - 2  /* r */
+
+	.dbg	line,	"tests/huc-overlay.c", 53; if (r != 3 + 9 + 9)
+	__neq_w.wi	21
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/huc-overlay.c", 54; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-overlay.c", 55; r = c(4) + d(2);
+.LL14:
+	__ld.wi		4
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__st.wmq	__c_end - 2  /* j */
+	__pusharg.wr
+	__call		_b
+	__st.wmq	__c_end - 4  /* k */
+	__ld.wm		__c_end - 2  /* j */
+	__add.wm	__c_end - 4  /* k */
+.LL15:
+	__modsp		2
+	__push.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_d
+	__add.wt
+	__st.wmq	__main_end - 2  /* r */
+
+	.dbg	line,	"tests/huc-overlay.c", 56; if (r != (4 + 16) + (2 + 4 + 4))
+	__neq_w.wi	30
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/huc-overlay.c", 57; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-overlay.c", 58; if (fp(2) != 8)
+.LL16:
+	__ld.wm		_fp
+	__funcp.wr
+	__ld.wi		2
+	__pusharg.wr
+	__callp
+	__neq_w.wi	8
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/huc-overlay.c", 59; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-overlay.c", 60; return 0;
+.LL17:
+	__ld.wi		0
+.LL13:
+
+	.dbg	line,	"tests/huc-overlay.c", 61; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-overlay.c", 63; #else
+	.dbg	line,	"tests/huc-overlay.c", 65; /* HuC does not support function pointers */
+	.dbg	line,	"tests/huc-overlay.c", 66; int main()
+	.dbg	line,	"tests/huc-overlay.c", 67; {
+	.dbg	line,	"tests/huc-overlay.c", 68; return 0;
+	.dbg	line,	"tests/huc-overlay.c", 69; }
+	.dbg	line,	"tests/huc-overlay.c", 71; #endif
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:8
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;     ---     4  _b (called from a frame of its own)
+;       6     4  _c
+;       2     4  _d
+;     ---     2  _e (address taken)
+;       0     2  _main
+;
+; 10 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        84     14     4  b() locals
+;        46     46    10  overlaid locals
+;         4      4     2  e() locals
+;         4      4     2  fp
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__b_locals, 4, 14, 84
+__b_end	=	__b_locals + 4
+	auto_zp_var	__overlay_frames, 10, 46, 46
+__c_end	=	__overlay_frames + 10
+__d_end	=	__overlay_frames + 6
+__main_end	=	__overlay_frames + 2
+	auto_zp_var	__e_locals, 2, 4, 4
+__e_end	=	__e_locals + 2
+	auto_zp_var	_fp, 2, 4, 4
+	.endm
@@ -0,0 +1,316 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-preproelif.c", 1; #ifdef VISUAL
+	.dbg	line,	"tests/huc-preproelif.c", 2; #define GOOD(x) put_string("Good", 0, x);
+	.dbg	line,	"tests/huc-preproelif.c", 3; #define BAD(x) put_string("BAD", 5, x);
+	.dbg	line,	"tests/huc-preproelif.c", 4; #else
+	.dbg	line,	"tests/huc-preproelif.c", 5; #define GOOD(x)
+	.dbg	line,	"tests/huc-preproelif.c", 6; #define BAD(x) exit(x);
+	.dbg	line,	"tests/huc-preproelif.c", 7; #endif
+	.dbg	line,	"tests/huc-preproelif.c", 9; int main() {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-preproelif.c", 10; #ifdef VISUAL
+
+	.dbg	line,	"tests/huc-preproelif.c", 11; load_default_font();
+
+	.dbg	line,	"tests/huc-preproelif.c", 12; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 13; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 14; BAD(1)
+
+	.dbg	line,	"tests/huc-preproelif.c", 15; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 16; GOOD(1)
+
+	.dbg	line,	"tests/huc-preproelif.c", 17; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 19; #if 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 20; GOOD(2)
+
+	.dbg	line,	"tests/huc-preproelif.c", 21; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 22; BAD(2)
+
+	.dbg	line,	"tests/huc-preproelif.c", 23; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 25; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 26; BAD(3)
+
+	.dbg	line,	"tests/huc-preproelif.c", 27; #elif 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 28; BAD(3)
+
+	.dbg	line,	"tests/huc-preproelif.c", 29; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 30; GOOD(3)
+
+	.dbg	line,	"tests/huc-preproelif.c", 31; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 33; #if 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 34; GOOD(4)
+
+	.dbg	line,	"tests/huc-preproelif.c", 35; #elif 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 36; BAD(4)
+
+	.dbg	line,	"tests/huc-preproelif.c", 37; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 39; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 40; BAD(5)
+
+	.dbg	line,	"tests/huc-preproelif.c", 41; #elif 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 42; BAD(5)
+
+	.dbg	line,	"tests/huc-preproelif.c", 43; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 44; GOOD(5)
+
+	.dbg	line,	"tests/huc-preproelif.c", 45; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 46; BAD(5)
+
+	.dbg	line,	"tests/huc-preproelif.c", 47; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 49; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 50; BAD(6)
+
+	.dbg	line,	"tests/huc-preproelif.c", 51; #elif 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 52; BAD(6)
+
+	.dbg	line,	"tests/huc-preproelif.c", 53; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 54; GOOD(6)
+
+	.dbg	line,	"tests/huc-preproelif.c", 55; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 56; BAD(6)
+
+	.dbg	line,	"tests/huc-preproelif.c", 57; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 58; BAD(6)
+
+	.dbg	line,	"tests/huc-preproelif.c", 59; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 61; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 62; BAD(7)
+
+	.dbg	line,	"tests/huc-preproelif.c", 63; #elif 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 64; BAD(7)
+
+	.dbg	line,	"tests/huc-preproelif.c", 65; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 66; GOOD(7)
+
+	.dbg	line,	"tests/huc-preproelif.c", 67; #elif 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 68; BAD(7)
+
+	.dbg	line,	"tests/huc-preproelif.c", 69; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 70; BAD(7)
+
+	.dbg	line,	"tests/huc-preproelif.c", 71; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 73; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 74; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 75; BAD(8)
+
+	.dbg	line,	"tests/huc-preproelif.c", 76; #elif 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 77; BAD(8)
+
+	.dbg	line,	"tests/huc-preproelif.c", 78; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 79; BAD(8)
+
+	.dbg	line,	"tests/huc-preproelif.c", 80; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 81; BAD(8)
+
+	.dbg	line,	"tests/huc-preproelif.c", 82; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 83; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 84; GOOD(8)
+
+	.dbg	line,	"tests/huc-preproelif.c", 85; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 87; #if 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 88; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 89; BAD(9)
+
+	.dbg	line,	"tests/huc-preproelif.c", 90; #elif 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 91; BAD(9)
+
+	.dbg	line,	"tests/huc-preproelif.c", 92; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 93; GOOD(9)
+
+	.dbg	line,	"tests/huc-preproelif.c", 94; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 95; BAD(9)
+
+	.dbg	line,	"tests/huc-preproelif.c", 96; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 97; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 98; BAD(9)
+
+	.dbg	line,	"tests/huc-preproelif.c", 99; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 101; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 102; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 103; BAD(10)
+
+	.dbg	line,	"tests/huc-preproelif.c", 104; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 105; BAD(10)
+
+	.dbg	line,	"tests/huc-preproelif.c", 106; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 107; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 108; #if 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 109; GOOD(10)
+
+	.dbg	line,	"tests/huc-preproelif.c", 110; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 111; BAD(10)
+
+	.dbg	line,	"tests/huc-preproelif.c", 112; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 113; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 115; #if 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 116; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 117; BAD(11)
+
+	.dbg	line,	"tests/huc-preproelif.c", 118; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 119; GOOD(11)
+
+	.dbg	line,	"tests/huc-preproelif.c", 120; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 121; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 122; #if 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 123; BAD(11)
+
+	.dbg	line,	"tests/huc-preproelif.c", 124; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 125; BAD(11)
+
+	.dbg	line,	"tests/huc-preproelif.c", 126; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 127; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 129; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 130; BAD(12)
+
+	.dbg	line,	"tests/huc-preproelif.c", 131; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 132; #if 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 133; BAD(12)
+
+	.dbg	line,	"tests/huc-preproelif.c", 134; #elif 0
+
+	.dbg	line,	"tests/huc-preproelif.c", 135; BAD(12)
+
+	.dbg	line,	"tests/huc-preproelif.c", 136; #else
+
+	.dbg	line,	"tests/huc-preproelif.c", 137; GOOD(12)
+
+	.dbg	line,	"tests/huc-preproelif.c", 138; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 139; #elif 1
+
+	.dbg	line,	"tests/huc-preproelif.c", 140; BAD(12)
+
+	.dbg	line,	"tests/huc-preproelif.c", 141; #endif
+
+	.dbg	line,	"tests/huc-preproelif.c", 143; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-preproelif.c", 144; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:1
+;	Macro pool:8
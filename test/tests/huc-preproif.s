@@ -0,0 +1,173 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-preproif.c", 1; int main()
+	.dbg	line,	"tests/huc-preproif.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-preproif.c", 3; int a;
+
+	.dbg	line,	"tests/huc-preproif.c", 4; #if 0
+
+	.dbg	line,	"tests/huc-preproif.c", 5; exit(1);
+
+	.dbg	line,	"tests/huc-preproif.c", 6; #endif
+
+	.dbg	line,	"tests/huc-preproif.c", 7; #define FOO 1
+
+	.dbg	line,	"tests/huc-preproif.c", 8; #if !FOO
+
+	.dbg	line,	"tests/huc-preproif.c", 9; exit(2);
+
+	.dbg	line,	"tests/huc-preproif.c", 10; #endif
+
+	.dbg	line,	"tests/huc-preproif.c", 11; #ifdef NIL
+
+	.dbg	line,	"tests/huc-preproif.c", 12; #ifdef FOO
+
+	.dbg	line,	"tests/huc-preproif.c", 13; exit(42);
+
+	.dbg	line,	"tests/huc-preproif.c", 14; #endif
+
+	.dbg	line,	"tests/huc-preproif.c", 15; exit(43);
+
+	.dbg	line,	"tests/huc-preproif.c", 16; #endif
+
+	.dbg	line,	"tests/huc-preproif.c", 18; #if 0
+
+	.dbg	line,	"tests/huc-preproif.c", 19; #if FOO
+
+	.dbg	line,	"tests/huc-preproif.c", 20; exit(3);
+
+	.dbg	line,	"tests/huc-preproif.c", 21; #endif
+
+	.dbg	line,	"tests/huc-preproif.c", 22; exit(4);
+
+	.dbg	line,	"tests/huc-preproif.c", 23; #endif
+
+	.dbg	line,	"tests/huc-preproif.c", 25; a = 1;
+	__st.wmiq	1, __main_end - 2  /* a */
+
+	.dbg	line,	"tests/huc-preproif.c", 26; #if 1 + FOO
+
+	.dbg	line,	"tests/huc-preproif.c", 27; a = 0;
+	__st.wmiq	0, __main_end - 2  /* a */
+
+	.dbg	line,	"tests/huc-preproif.c", 28; #endif
+
+	.dbg	line,	"tests/huc-preproif.c", 29; if (a)
+	__tst.wm	__main_end - 2  /* a */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-preproif.c", 30; exit(5);
+	__ld.wi		5
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-preproif.c", 31; #if 0
+
+	.dbg	line,	"tests/huc-preproif.c", 32; exit(6);
+
+	.dbg	line,	"tests/huc-preproif.c", 33; #else
+
+	.dbg	line,	"tests/huc-preproif.c", 34; #endif
+
+	.dbg	line,	"tests/huc-preproif.c", 36; #define BAR
+
+	.dbg	line,	"tests/huc-preproif.c", 37; #ifndef BAR
+
+	.dbg	line,	"tests/huc-preproif.c", 38; exit(7);
+
+	.dbg	line,	"tests/huc-preproif.c", 39; #endif
+
+	.dbg	line,	"tests/huc-preproif.c", 40; #undef BAR
+
+	.dbg	line,	"tests/huc-preproif.c", 41; #ifdef BAR
+
+	.dbg	line,	"tests/huc-preproif.c", 42; exit(8);
+
+	.dbg	line,	"tests/huc-preproif.c", 43; #endif
+
+	.dbg	line,	"tests/huc-preproif.c", 44; #ifdef FOO
+
+	.dbg	line,	"tests/huc-preproif.c", 45; return 0;
+.LL3:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-preproif.c", 46; #endif
+
+	.dbg	line,	"tests/huc-preproif.c", 47; return 42;
+
+	.dbg	line,	"tests/huc-preproif.c", 48; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
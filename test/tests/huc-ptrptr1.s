@@ -0,0 +1,193 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-ptrptr1.c", 1; const int a[5] = {1, 2, 3, 4, 5};
+	.dbg	line,	"tests/huc-ptrptr1.c", 2; int *ap[3];
+	.dbg	line,	"tests/huc-ptrptr1.c", 4; main()
+	.dbg	line,	"tests/huc-ptrptr1.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 6; int *b, *c;
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 7; int **d;
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 8; b = a;
+	__ld.wi		_a
+	__st.wmq	__main_end - 2  /* b */
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 9; c = &a[3];
+	__ld.wi		__main_end - 2  /* b */
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 10; d = &b;
+	__st.wmq	__main_end - 6  /* d */
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 11; if (*d != a)
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	_a
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 12; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 13; if (**d != 1)
+.LL3:
+	__ld.wm		__main_end - 6  /* d */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	1
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 14; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 15; (*d)++;
+.LL4:
+	__ld.wm		__main_end - 6  /* d */
+	__push.wr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wt
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 16; if (**d != 2)
+	__ld.wm		__main_end - 6  /* d */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	2
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 17; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 18; ap[0] = a;
+.LL5:
+	__ld.wi		_a
+	__st.wmq	_ap
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 19; ap[1] = b;
+	__ld.wm		__main_end - 2  /* b */
+	__st.wmq	_ap + 2
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 20; ap[2] = 0;
+	__st.wmiq	0, _ap + 4
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 21; d = &ap[0];
+	__ld.wi		_ap
+	__st.wmq	__main_end - 6  /* d */
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 22; if (*d != a)
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	_a
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 23; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 24; d++;
+.LL6:
+	__ld.wm		__main_end - 6  /* d */
+	__add.wi	2
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 25; if (*d++ != b)
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wm	__main_end - 2  /* b */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 26; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 27; return 0;
+.LL7:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-ptrptr1.c", 28; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_a:
+		dw	1
+		dw	2
+		dw	3
+		dw	4
+		dw	5
+
+	.bss
+_ap:
+		ds	6
+
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:10
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
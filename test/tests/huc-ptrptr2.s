@@ -0,0 +1,225 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-ptrptr2.c", 1; struct foo {
+	.dbg	line,	"tests/huc-ptrptr2.c", 2; int b;
+	.dbg	line,	"tests/huc-ptrptr2.c", 3; char *a;
+	.dbg	line,	"tests/huc-ptrptr2.c", 4; };
+	.dbg	line,	"tests/huc-ptrptr2.c", 6; const char *bla = "Blabla";
+	.dbg	line,	"tests/huc-ptrptr2.c", 7; struct foo f[2];
+	.dbg	line,	"tests/huc-ptrptr2.c", 8; struct foo *fp;
+	.dbg	line,	"tests/huc-ptrptr2.c", 10; main()
+	.dbg	line,	"tests/huc-ptrptr2.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 12; char **x;
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 13; struct foo **y;
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 14; x = &bla;
+	__ld.wi		_bla
+	__st.wmq	__main_end - 2  /* x */
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 15; fp = f;
+	__ld.wi		_f
+	__st.wmq	_fp
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 16; f[0].a = bla;
+	__ld.wm		_bla
+	__st.wmq	_f + 2
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 17; if (*x != bla)
+	__ld.wm		__main_end - 2  /* x */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wm	_bla
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 18; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 20; /* Failed to dereference this correctly. */
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 21; if (**x != 'B')
+.LL3:
+	__ld.wm		__main_end - 2  /* x */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	66
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 22; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 24; /* This stuff never failed, but better to check it anyway. */
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 25; y = &fp;
+.LL4:
+	__ld.wi		_fp
+	__st.wmq	__main_end - 4  /* y */
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 26; if (*y != fp)
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wm	_fp
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 27; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 28; if ((*y)->a != bla)
+.LL5:
+	__ld.wm		__main_end - 4  /* y */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wm	_bla
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 29; exit(4);
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 30; if (*(*y)->a != 'B')
+.LL6:
+	__ld.wm		__main_end - 4  /* y */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	66
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 31; exit(5);
+	__ld.wi		5
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 32; if ((*y)->a[1] != 'l')
+.LL7:
+	__ld.wm		__main_end - 4  /* y */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add.wi	1
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	108
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 33; exit(6);
+	__ld.wi		6
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 35; return 0;
+.LL8:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-ptrptr2.c", 36; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'B','l','a','b','l','a',$00
+_bla:
+		dw	__const1+0
+
+	.bss
+_f:
+		ds	8
+
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:7
+;	constant pool:2
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  fp
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_fp, 2, 6, 6
+	.endm
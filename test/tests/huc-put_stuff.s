@@ -0,0 +1,980 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-put_stuff.c", 1; #include <huc.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 1; #ifndef _hucc_legacy_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 2; #define _hucc_legacy_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 7; ; huc.h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 9; ; HuCC wrapper file to include a default set of HuC-compatible functions.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 20; ; When the HuCC compiler is invoked with the "--legacy" option to compile old
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 21; ; projects, then this "huc.h" file is automatically included.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 22; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 23; ; This file includes a set of the individual HuCC headers which correspond to
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 24; ; HuC's built-in functions and MagicKit library.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 25; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 26; ; New HuCC projects should, preferably, include the specific headers that are
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 27; ; needed, which will then allow them to replace parts of the standard library
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 28; ; with newer functions, or they can just manually include this "huc.h" file.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 30; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 31; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 33; #include "hucc-systemcard.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 1; #ifndef _hucc_systemcard_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 2; #define _hucc_systemcard_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 7; ; hucc-systemcard.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 9; ; Macros and library functions for using the System Card.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 20; ; Because these are mainly macros, and so must be included before being used
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 21; ; in compiled code, the actual functions here are written to avoid using any
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 22; ; BSS memory so that HuCC's overlay global-shared-variables are not effected.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 24; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 25; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 27; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 28; // Backup RAM defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 29; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 31; #define  BM_OK             0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 32; #define  BM_NOT_FOUND      1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 33; #define  BM_BAD_CHECKSUM   2
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 34; #define  BM_DIR_CORRUPTED  3
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 35; #define  BM_FILE_EMPTY     4
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 36; #define  BM_FULL           5
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 37; #define  BM_NOT_FORMATED   0xFF			// HuC incorrect spelling.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 38; #define  BM_NOT_FORMATTED  0xFF			// HuCC can use a dictionary!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 40; #define  BRAM_STARTPTR     0x8010
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 42; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 43; // CD defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 44; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 46; #define	CDPLAY_MUTE		0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 47; #define	CDPLAY_REPEAT		1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 48; #define	CDPLAY_NORMAL		2
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 49; #define	CDPLAY_ENDOFDISC	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 51; #define	CDFADE_CANCEL	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 52; #define	CDFADE_PCM6	8
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 53; #define	CDFADE_ADPCM6	10
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 54; #define	CDFADE_PCM2	12
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 55; #define	CDFADE_ADPCM2	14
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 57; #define CDTRK_AUDIO	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 58; #define CDTRK_DATA	4
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 60; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 61; // ADPCM defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 62; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 64; #define	ADPLAY_AUTOSTOP		0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 65; #define	ADPLAY_REPEAT		0x80
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 67; #define ADPLAY_FREQ_16KHZ	0xE
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 68; #define ADPLAY_FREQ_10KHZ	0xD
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 69; #define ADPLAY_FREQ_8KHZ	0xC
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 70; #define ADPLAY_FREQ_6KHZ	0xB
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 71; #define ADPLAY_FREQ_5KHZ	0xA
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 73; #define ADREAD_RAM	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 74; #define ADREAD_VRAM	0xFF
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 76; #define ADWRITE_RAM	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 77; #define ADWRITE_VRAM	0xFF
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 79; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 80; // Functions in hucc-systemcard.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 81; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 83; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 85; #asmdef	HUCC_USES_SYSTEMCARD 1
+HUCC_USES_SYSTEMCARD = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 87; extern void __fastcall __macro cd_boot( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 88; extern unsigned int __fastcall __macro cd_getver( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 89; extern void __fastcall __macro cd_reset( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 90; extern unsigned char __fastcall __macro cd_pause( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 91; extern unsigned char __fastcall cd_unpause( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 92; extern void __fastcall __macro cd_fade( unsigned char type<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 93; extern unsigned char __fastcall cd_playtrk( unsigned char start_track<_bx>, unsigned char end_track<_cx>, unsigned char mode<_dh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 94; extern unsigned char __fastcall cd_playmsf( unsigned char start_minute<_al>,  unsigned char start_second<_ah>,  unsigned char start_frame<_bl>, unsigned char end_minute<_cl>,  unsigned char end_second<_ch>,  unsigned char end_frame<_dl>,  unsigned char mode<_dh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 95; extern unsigned char __fastcall cd_fastvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int sectors<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 96; extern unsigned char __fastcall cd_loadvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 97; extern unsigned char __fastcall cd_loaddata( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char __far *buffer<_bp_bank:_bp>, unsigned int bytes<__ptr> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 98; extern unsigned char __fastcall cd_loadbank( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char bank<_bl>, unsigned int sectors<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 99; extern unsigned char __fastcall __macro cd_status( unsigned char mode<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 101; extern void __fastcall __macro ad_reset( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 102; extern unsigned char __fastcall __macro ad_trans( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char nb_sectors<_dh>, unsigned int ad_addr<_bx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 103; extern void __fastcall __macro ad_read( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 104; extern void __fastcall __macro ad_write( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 105; extern unsigned char __fastcall __macro ad_play( unsigned int ad_addr<_bx>, unsigned int bytes<_ax>, unsigned char freq<_dh>, unsigned char mode<_dl> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 106; extern unsigned char __fastcall __macro ad_cplay( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int nb_sectors<_bx>, unsigned char freq<_dh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 107; extern void __fastcall __macro ad_stop( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 108; extern unsigned char __fastcall __macro ad_stat( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 110; extern unsigned char __fastcall bm_check( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 111; extern unsigned char __fastcall bm_format( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 112; extern unsigned int __fastcall __macro bm_free( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 113; extern unsigned char __fastcall __macro bm_read( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 114; extern unsigned char __fastcall __macro bm_write( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 115; extern unsigned char __fastcall __macro bm_delete( unsigned char *name<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 117; // Deprecated functions ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 119; extern unsigned char __fastcall __macro bm_exist( unsigned char *name<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 120; extern unsigned char __fastcall __macro bm_create( unsigned char *name<_ax>, unsigned int length<_cx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 122; // void __fastcall _xsafe add_sectors( unsigned int sector_offset<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 124; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 126; #endif // _hucc_systemcard_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 34; #include "hucc-baselib.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 1; #ifndef _hucc_baselib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 2; #define _hucc_baselib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 7; ; hucc-baselib.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 9; ; Basic library functions provided as macros.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 18; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 20; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 21; // Joypad defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 22; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 24; #define	JOY_A		0x01
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 25; #define	JOY_I		0x01
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 26; #define	JOY_B		0x02
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 27; #define	JOY_II		0x02
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 28; #define	JOY_SLCT	0x04
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 29; #define	JOY_SEL		0x04
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 30; #define	JOY_STRT	0x08
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 31; #define	JOY_RUN		0x08
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 32; #define	JOY_UP		0x10
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 33; #define	JOY_RGHT	0x20
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 34; #define	JOY_RIGHT	0x20
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 35; #define	JOY_DOWN	0x40
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 36; #define	JOY_LEFT	0x80
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 38; #define	JOY_C		0x0100
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 39; #define	JOY_III		0x0100
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 40; #define	JOY_D		0x0200
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 41; #define	JOY_IV		0x0200
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 42; #define	JOY_E		0x0400
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 43; #define	JOY_V		0x0400
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 44; #define	JOY_F		0x0800
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 45; #define	JOY_VI		0x0800
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 47; #define JOY_SIXBUT	0x8000
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 48; #define JOY_TYPE6	0x8000
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 50; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 51; // SuperGRAFX VPC settings for set_vpc_ctl() ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 52; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 54; #define VPC_SPR1_BKG1_SPR2_BKG2	0x3000 // same as SGX_PARALLAX=0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 55; #define VPC_SPR1_SPR2_BKG1_BKG2	0x7000 // same as SGX_PARALLAX=1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 56; #define VPC_BKG1_BKG2_SPR1_SPR2	0xB000
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 58; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 59; // System Card variables ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 60; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 62; extern unsigned int si;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 63; extern unsigned int di;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 64; extern unsigned int bp;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 66; extern unsigned int ax;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 67; extern unsigned int bx;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 68; extern unsigned int cx;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 69; extern unsigned int dx;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 71; extern unsigned char al;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 72; extern unsigned char ah;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 73; extern unsigned char bl;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 74; extern unsigned char bh;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 75; extern unsigned char cl;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 76; extern unsigned char ch;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 77; extern unsigned char dl;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 78; extern unsigned char dh;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 80; extern unsigned char irq_cnt;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 81; extern unsigned char joynow[5];
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 82; extern unsigned char joytrg[5];
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 83; extern unsigned char joy6now[5];
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 84; extern unsigned char joy6trg[5];
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 85; extern unsigned int  bg_x1;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 86; extern unsigned int  bg_y1;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 87; extern unsigned int  bg_x2;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 88; extern unsigned int  bg_y2;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 90; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 91; // Special macros to get information from PCEAS ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 92; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 94; #define BANK( datasym ) ((unsigned) (&__bank__ ## datasym))
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 95; #define SIZEOF( datasym ) ((unsigned) (&__sizeof__ ## datasym))
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 96; #define COUNTOF( datasym ) ((unsigned) (&__countof__ ## datasym))
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 97; #define OVERLAY( datasym ) ((unsigned) (&__overlay__ ## datasym))
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 100; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 101; // Functions in hucc-baselib.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 102; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 104; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 106; #asmdef	HUCC_USES_BASELIB 1
+HUCC_USES_BASELIB = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 108; #define	_OPTIMIZE 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 111; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 112; // Hardware Detection
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 113; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 115; extern unsigned char __fastcall __macro sgx_detect( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 116; extern unsigned char __fastcall __macro ac_exists( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 119; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 120; // Memory Access
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 121; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 123; extern unsigned char __fastcall __macro peek( unsigned int addr<__ptr> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 124; extern unsigned int  __fastcall __macro peekw( unsigned int addr<__ptr> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 126; extern void __fastcall __macro poke( unsigned int addr<__poke>, unsigned char with<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 127; extern void __fastcall __macro pokew( unsigned int addr<__poke>, unsigned int with<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 129; extern unsigned char __fastcall farpeek( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 130; extern unsigned int  __fastcall farpeekw( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 132; extern void __fastcall __nop set_far_base( unsigned char data_bank<_bp_bank>, unsigned char *data_addr<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 133; extern void __fastcall set_far_offset( unsigned int offset<_bp>, unsigned char data_bank<_bp_bank>, unsigned char *data_addr<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 135; extern unsigned char __fastcall far_peek( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 136; extern unsigned int  __fastcall far_peekw( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 138; extern void __fastcall __macro reset_mpr2( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 139; extern void __fastcall __macro reset_mpr34( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 141; extern void * __fastcall __macro farset_mpr2( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 142; extern void * __fastcall __macro farset_mpr34( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 144; extern void * __fastcall __macro far_set_mpr2( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 145; extern void * __fastcall __macro far_set_mpr34( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 148; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 149; // Clock Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 150; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 152; extern unsigned char __fastcall __macro clock_hh( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 153; extern unsigned char __fastcall __macro clock_mm( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 154; extern unsigned char __fastcall __macro clock_ss( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 155; extern unsigned char __fastcall __macro clock_tt( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 156; extern void __fastcall __macro clock_reset( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 159; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 160; // Joypad Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 161; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 163; extern unsigned int __fastcall __macro joy( unsigned char which<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 164; extern unsigned int __fastcall __macro joytrg( unsigned char which<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 167; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 168; // Number Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 169; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 171; extern void __fastcall __macro srand( unsigned char seed<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 172; extern unsigned int __fastcall rand( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 173; extern unsigned char __fastcall rand8( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 175; // Note: "limit" is 0..255.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 176; extern unsigned char __fastcall random8( unsigned char limit<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 178; // Note: "limit" is 0..128, 129..255 are treated as 128!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 179; extern unsigned char __fastcall random( unsigned char limit<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 182; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 183; // Overlay Execution
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 184; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 186; extern unsigned char __fastcall __macro cd_execoverlay( unsigned char ovl_index<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 189; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 190; // Functions that are only optionally available if configured in your hucc-config.inc
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 191; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 193; extern unsigned int __fastcall __macro joybuf( unsigned char which<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 194; extern unsigned int __fastcall __macro get_joy_events( unsigned char which<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 195; extern void __fastcall __macro clear_joy_events( unsigned char mask<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 198; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 199; // Functions that are only implemented in the TGEMU emulator for unit-testing
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 200; // the compiler, and which should never be used in normal HuCC projects ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 201; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 203; extern void __fastcall dump_screen( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 205; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 207; #endif // _hucc_baselib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 35; #include "hucc-gfx.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 1; #ifndef _hucc_gfx_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 2; #define _hucc_gfx_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 7; ; huc-gfx.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 10; ; other original HuC developers.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 11; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 13; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 17; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 19; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 21; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 22; // Screen defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 23; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 25; #define	SCR_SIZE_32x32	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 26; #define	SCR_SIZE_64x32	1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 27; #define	SCR_SIZE_128x32	2
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 28; #define	SCR_SIZE_32x64	4
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 29; #define	SCR_SIZE_64x64	5
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 30; #define	SCR_SIZE_128x64	6
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 32; #define	XRES_SHARP	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 33; #define	XRES_SOFT	4
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 34; #define	XRES_KEEP	128
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 36; #define VPC_WIN_A	0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 37; #define VPC_WIN_B	0x01
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 38; #define	VPC_WIN_AB	0x02
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 39; #define	VPC_WIN_NONE	0x03
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 40; #define	VPC_NORM	0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 41; #define	VPC_SPR		0x04
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 42; #define	VPC_INV_SPR	0x08
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 43; #define VDC1_ON		0x01
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 44; #define	VDC1_OFF	0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 45; #define VDC2_ON		0x02
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 46; #define	VDC2_OFF	0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 47; #define VDC_ON		0x03
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 48; #define	VDC_OFF		0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 50; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 51; // Functions in hucc-gfx.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 52; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 54; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 56; #asmdef	HUCC_USES_GFX 1
+HUCC_USES_GFX = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 58; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 59; // Color and Palette Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 60; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 62; extern void __fastcall clear_palette( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 64; extern void __fastcall __nop set_color( unsigned int index<VCE_CTA>, unsigned int value<VCE_CTW> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 65; extern void __fastcall set_color_rgb( unsigned int index<VCE_CTA>, unsigned char r<_al>, unsigned char g<_ah>, unsigned char b<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 66; extern unsigned int __fastcall __macro get_color( unsigned int index<VCE_CTA> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 68; extern void __fastcall load_palette( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 69; extern void __fastcall far_load_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 71; extern void __fastcall read_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah>, unsigned int *destination<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 73; extern void __fastcall __macro fade_to_black( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 74; extern void __fastcall __macro fade_to_white( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 75; extern void __fastcall __macro cross_fade_to( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 77; extern void __fastcall __macro far_fade_to_black( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 78; extern void __fastcall __macro far_fade_to_white( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 79; extern void __fastcall __macro far_cross_fade_to( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 83; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 84; // Video Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 85; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 87; extern void __fastcall init_240x208( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 88; extern void __fastcall init_256x224( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 90; extern void __fastcall vsync( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 91; extern void __fastcall vsync( unsigned char count<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 93; extern void __fastcall disp_on( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 94; extern void __fastcall disp_off( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 96; extern void __fastcall set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 98; extern void __fastcall set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 100; extern void __fastcall cls( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 101; extern void __fastcall cls( unsigned int tile<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 103; extern unsigned int __fastcall __macro vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 104; extern unsigned int __fastcall __macro get_vram( unsigned int address<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 105; extern void __fastcall __macro put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 107; extern void __fastcall __macro load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 108; extern void __fastcall __macro far_load_vram( unsigned int vram<_di>,  unsigned int num_words<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 110; extern void __fastcall load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 111; extern void __fastcall far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 113; extern void __fastcall __macro load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 114; extern void __fastcall __macro far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 116; extern void __fastcall vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 119; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 120; // SuperGRAFX Video Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 121; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 123; extern void __fastcall __nop vpc_set_ctl( unsigned int bits<VPC_CR> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 124; extern void __fastcall __nop vpc_set_win1( unsigned int width<VPC_WINDOW1> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 125; extern void __fastcall __nop vpc_set_win2( unsigned int width<VPC_WINDOW2> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 127; extern void __fastcall sgx_set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 129; extern void __fastcall sgx_set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 131; extern void __fastcall sgx_cls( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 132; extern void __fastcall sgx_cls( unsigned int tile<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 134; extern unsigned int __fastcall __macro sgx_vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 135; extern unsigned int __fastcall __macro sgx_get_vram( unsigned int address<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 136; extern void __fastcall __macro sgx_put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 138; extern void __fastcall __macro sgx_load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 139; extern void __fastcall __macro sgx_far_load_vram( unsigned int vram<_di>, unsigned int num_words<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 141; extern void __fastcall sgx_load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 142; extern void __fastcall sgx_far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 144; extern void __fastcall __macro sgx_load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 145; extern void __fastcall __macro sgx_far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 147; extern void __fastcall sgx_vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 150; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 151; // Font Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 152; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 154; extern void __fastcall set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 155; extern void __fastcall set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 157; extern void __fastcall load_font( unsigned char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 158; extern void __fastcall far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 160; extern void __fastcall __nop set_font_color( unsigned char foreground<monofont_fg>, unsigned char background<monofont_bg> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 161; extern void __fastcall __macro load_default_font( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 164; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 165; // SuperGRAFX Font Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 166; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 168; extern void __fastcall sgx_set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 169; extern void __fastcall sgx_set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 171; extern void __fastcall sgx_load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 172; extern void __fastcall sgx_far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 174; extern void __fastcall __macro sgx_load_default_font( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 177; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 178; // Deprecated functions ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 179; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 181; extern void __fastcall __macro set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 182; extern void __fastcall __macro sgx_set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 184; extern void __fastcall load_background( unsigned char __far *tiles<_bp_bank:_bp>, unsigned char __far *palettes<__fbank:__fptr>, unsigned char __far *bat<_cl:_bx>, unsigned char w<_dl>, unsigned char h<_dh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 186; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 187; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 188; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 189; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 191; extern void __fastcall load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 193; extern void __fastcall put_string( unsigned char *string<_bp>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 195; extern void __fastcall put_char( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 196; extern void __fastcall put_digit( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 197; extern void __fastcall put_hex( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 198; extern void __fastcall put_number( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 199; extern void __fastcall put_raw( unsigned int data<_bx>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 201; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 203; #endif // _hucc_gfx_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 36; #include "hucc-old-scroll.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 1; #ifndef _hucc_old_scroll_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 2; #define _hucc_old_scroll_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 7; ; hucc-old-scroll.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 10; ; other original HuC developers.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 11; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 13; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 17; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 19; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 20; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 21; ; HuC's old scrolling library is provided for use with existing HuC projects,
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 22; ; but it should preferably be avoided in new projects because it is slow and
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 23; ; forever limited by its choice to handle gaps between areas, and sorting.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 24; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 25; ; HuCC's new scrolling library puts the responibility for defining both gaps
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 26; ; and the display order into the project's hands, but in return it runs much
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 27; ; faster, using less than 1/6 of the processing time in VBLANK, and far less
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 28; ; time in the RCR interrputs themselves. It also supports the 2nd SuperGRAFX
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 29; ; screen layer, which HuC's old scrolling library ignores.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 30; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 31; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 32; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 34; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 35; // Functions in hucc-old-scroll.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 36; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 38; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 40; #asmdef	HUCC_USES_OLD_SCROLL 1
+HUCC_USES_OLD_SCROLL = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 42; extern void __fastcall scroll( unsigned char num<_al>, unsigned int x<_cx>, unsigned int y<_dx>, unsigned char top<_ah>, unsigned char bottom<_bl>, unsigned char disp<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 43; extern void __fastcall scroll_disable( unsigned char num<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 45; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 47; #endif // _hucc_old_scroll_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 37; #include "hucc-old-spr.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 1; #ifndef _hucc_old_spr_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 2; #define _hucc_old_spr_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 7; ; hucc-old-spr.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 10; ; other original HuC developers.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 11; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 13; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 17; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 19; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 21; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 22; // Sprite defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 23; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 25; #define FLIP_X_MASK 0x08
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 26; #define FLIP_Y_MASK 0x80
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 27; #define FLIP_MAS    0x88
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 28; #define SIZE_MAS    0x31
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 30; #define NO_FLIP     0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 31; #define NO_FLIP_X   0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 32; #define NO_FLIP_Y   0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 33; #define FLIP_X      0x08
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 34; #define FLIP_Y      0x80
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 35; #define SZ_16x16    0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 36; #define SZ_16x32    0x10
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 37; #define SZ_16x64    0x30
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 38; #define SZ_32x16    0x01
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 39; #define SZ_32x32    0x11
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 40; #define	SZ_32x64    0x31
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 42; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 43; // Functions in hucc-old-spr.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 44; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 46; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 48; #asmdef	HUCC_USES_OLD_SPR 1
+HUCC_USES_OLD_SPR = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 50; extern void __fastcall init_satb( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 51; extern void __fastcall reset_satb( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 52; extern void __fastcall satb_update( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 53; extern void __fastcall spr_set( unsigned char num<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 54; extern void __fastcall spr_hide( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 55; extern void __fastcall spr_show( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 56; extern void __fastcall spr_x( unsigned int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 57; extern void __fastcall spr_y( unsigned int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 58; extern void __fastcall spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 59; extern void __fastcall spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 60; extern void __fastcall spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 61; extern void __fastcall spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 63; extern unsigned int __fastcall spr_get_x( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 64; extern unsigned int __fastcall spr_get_y( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 66; extern void __fastcall sgx_init_satb( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 67; extern void __fastcall sgx_reset_satb( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 68; extern void __fastcall sgx_satb_update( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 69; extern void __fastcall sgx_spr_set( unsigned char num<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 70; extern void __fastcall sgx_spr_hide( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 71; extern void __fastcall sgx_spr_show( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 72; extern void __fastcall sgx_spr_x( unsigned int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 73; extern void __fastcall sgx_spr_y( unsigned int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 74; extern void __fastcall sgx_spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 75; extern void __fastcall sgx_spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 76; extern void __fastcall sgx_spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 77; extern void __fastcall sgx_spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 79; extern unsigned int __fastcall sgx_spr_get_x( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 80; extern unsigned int __fastcall sgx_spr_get_y( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 82; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 84; #endif // _hucc_old_spr_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 38; #include "hucc-old-map.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 1; #ifndef _hucc_old_map_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 2; #define _hucc_old_map_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 7; ; hucc-old-map.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 10; ; other original HuC developers.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 11; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 13; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 17; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 19; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 21; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 22; // Functions in hucc-old-map.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 23; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 25; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 27; #asmdef	HUCC_USES_OLD_MAP 1
+HUCC_USES_OLD_MAP = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 29; extern void __fastcall set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 30; extern void __fastcall sgx_set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 32; extern void __fastcall __nop set_tile_data( unsigned char __far *tiles<vdc_tile_bank:vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 33; extern void __fastcall __nop sgx_set_tile_data( unsigned char __far *tiles<sgx_tile_bank:sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 35; extern void __fastcall __nop set_far_tile_data( unsigned char tile_bank<vdc_tile_bank>, unsigned char *tile_addr<vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char palette_table_bank<vdc_attr_bank>, unsigned char *palette_table_addr<vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 36; extern void __fastcall __nop sgx_set_far_tile_data( unsigned char tile_bank<sgx_tile_bank>, unsigned char *tile_addr<sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char palette_table_bank<sgx_attr_bank>, unsigned char *palette_table_addr<sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 38; extern void __fastcall __nop set_map_data( unsigned char __far *map<vdc_map_bank:vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 39; extern void __fastcall __nop sgx_set_map_data( unsigned char __far *map<sgx_map_bank:sgx_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 41; extern void __fastcall __nop set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 42; extern void __fastcall __nop sgx_set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 44; extern void __fastcall load_tile( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 45; extern void __fastcall sgx_load_tile( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 47; extern void __fastcall load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 48; extern void __fastcall sgx_load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 50; extern unsigned char __fastcall map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 51; extern unsigned char __fastcall sgx_map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 53; extern void __fastcall map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 54; extern void __fastcall sgx_map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 56; extern void __fastcall put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 57; extern void __fastcall sgx_put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 59; // Deprecated functions ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 61; extern void __fastcall set_tile_data( unsigned char *tile_ex<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 63; extern void __fastcall __nop set_map_pals( unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 64; extern void __fastcall __nop set_map_tile_type( unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 66; extern void __fastcall __nop sgx_set_map_pals( unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 67; extern void __fastcall __nop sgx_set_map_tile_type( unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 69; extern void __fastcall set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 70; extern void __fastcall sgx_set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 72; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 74; #endif // _hucc_old_map_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 39; #include "hucc-old-line.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 1; #ifndef _hucc_old_line_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 2; #define _hucc_old_line_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 7; ; hucc-old-line.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 10; ; other original HuC developers.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 11; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 13; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 17; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 19; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 21; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 22; // Functions in hucc-old-line.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 23; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 25; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 27; #asmdef	HUCC_USES_OLD_LINE 1
+HUCC_USES_OLD_LINE = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 29; extern void __fastcall gfx_init( unsigned int start_vram_addr<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 30; extern void __fastcall gfx_clear( unsigned int start_vram_addr<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 31; extern void __fastcall gfx_plot( unsigned int x<_gfx_x1>, unsigned int y<_gfx_y1>, char color<_gfx_color> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 32; extern void __fastcall gfx_line( unsigned int x1<_gfx_x1>, unsigned int y1<_gfx_y1>, unsigned int x2<_gfx_x2>, unsigned int y2<_gfx_y2>, unsigned char color<_gfx_color> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 34; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 36; #endif // _hucc_old_line_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 41; #include <stdlib.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 1; #ifndef _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 2; #define _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 4; #define RAND_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 6; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 7; extern int __fastcall abs( int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 8; #endif
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 10; #endif // _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 42; #include <string.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 3; #endif
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 44; #endif // _hucc_legacy_h
+	.dbg	line,	"tests/huc-put_stuff.c", 3; int main()
+	.dbg	line,	"tests/huc-put_stuff.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-put_stuff.c", 5; unsigned char i;
+
+	.dbg	line,	"tests/huc-put_stuff.c", 7; load_default_font();
+	 _load_default_font
+
+	.dbg	line,	"tests/huc-put_stuff.c", 8; set_color(1,0x1FF);
+	__st.wmiq	1, VCE_CTA
+	__st.wmiq	511, VCE_CTW
+
+	.dbg	line,	"tests/huc-put_stuff.c", 9; put_string("Hi", 0, 0);
+	__ld.wi		__const1+0
+	__st.wmq	_bp
+	__st.umiq	0, _dil
+	__st.umiq	0, _dih
+	__call		_put_string.3
+
+	.dbg	line,	"tests/huc-put_stuff.c", 10; 
+
+	.dbg	line,	"tests/huc-put_stuff.c", 11; #ifdef __HUCC__
+
+	.dbg	line,	"tests/huc-put_stuff.c", 13; /* HuCC only supports writing to an X,Y coordinate */
+
+	.dbg	line,	"tests/huc-put_stuff.c", 14; for (i = 0; i < 10; i++)
+	__st.umiq	0, __main_end - 1  /* i */
+.LL3:
+	__ld.umq	__main_end - 1  /* i */
+	__ult_b.uiq	10
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.umq	__main_end - 1  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/huc-put_stuff.c", 15; put_digit(i, i, 1);
+	__ld.um		__main_end - 1  /* i */
+	__st.umq	_bl
+	__ld.um		__main_end - 1  /* i */
+	__st.umq	_dil
+	__st.umiq	1, _dih
+	__call		_put_digit.3
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/huc-put_stuff.c", 16; for (i = 0; i < 26; i++)
+	__st.umiq	0, __main_end - 1  /* i */
+.LL7:
+	__ld.umq	__main_end - 1  /* i */
+	__ult_b.uiq	26
+	__btrue		.LL9
+	__bra		.LL10
+.LL8:
+	__inc.umq	__main_end - 1  /* i */
+	__bra		.LL7
+.LL9:
+
+	.dbg	line,	"tests/huc-put_stuff.c", 17; put_char(i + 'A', i, 3);
+	__ld.um		__main_end - 1  /* i */
+	__add.wi	65
+	__st.umq	_bl
+	__ld.um		__main_end - 1  /* i */
+	__st.umq	_dil
+	__st.umiq	3, _dih
+	__call		_put_char.3
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/huc-put_stuff.c", 18; for (i = 0; i < 26; i++)
+	__st.umiq	0, __main_end - 1  /* i */
+.LL11:
+	__ld.umq	__main_end - 1  /* i */
+	__ult_b.uiq	26
+	__btrue		.LL13
+	__bra		.LL14
+.LL12:
+	__inc.umq	__main_end - 1  /* i */
+	__bra		.LL11
+.LL13:
+
+	.dbg	line,	"tests/huc-put_stuff.c", 19; put_vram(vram_addr(i, 6), i+129);
+	__ld.um		__main_end - 1  /* i */
+	__st.umq	_al
+	__st.umiq	6, _ah
+	 _vram_addr.2
+	__st.wmq	_di
+	__ld.um		__main_end - 1  /* i */
+	__add.wi	129
+	 _put_vram.2
+	__bra		.LL12
+.LL14:
+
+	.dbg	line,	"tests/huc-put_stuff.c", 20; for (i = 0; i < 15; i++)
+	__st.umiq	0, __main_end - 1  /* i */
+.LL15:
+	__ld.umq	__main_end - 1  /* i */
+	__ult_b.uiq	15
+	__btrue		.LL17
+	__bra		.LL18
+.LL16:
+	__inc.umq	__main_end - 1  /* i */
+	__bra		.LL15
+.LL17:
+
+	.dbg	line,	"tests/huc-put_stuff.c", 21; put_number(i, 2, i*2, 8);
+	__ld.um		__main_end - 1  /* i */
+	__st.wmq	_bx
+	__st.umiq	2, _cl
+	__ld.um		__main_end - 1  /* i */
+	__asl.wi	1
+	__st.umq	_dil
+	__st.umiq	8, _dih
+	__call		_put_number.4
+	__bra		.LL16
+.LL18:
+
+	.dbg	line,	"tests/huc-put_stuff.c", 22; put_string("Done", 12, 17);
+	__ld.wi		__const1+3
+	__st.wmq	_bp
+	__st.umiq	12, _dil
+	__st.umiq	17, _dih
+	__call		_put_string.3
+
+	.dbg	line,	"tests/huc-put_stuff.c", 24; #else
+
+	.dbg	line,	"tests/huc-put_stuff.c", 26; for (i = 0; i < 10; i++)
+
+	.dbg	line,	"tests/huc-put_stuff.c", 27; put_digit(i, i, 1);
+
+	.dbg	line,	"tests/huc-put_stuff.c", 28; for (i = 0; i < 10; i++)
+
+	.dbg	line,	"tests/huc-put_stuff.c", 29; put_digit(i, 130 + i);
+
+	.dbg	line,	"tests/huc-put_stuff.c", 30; for (i = 0; i < 26; i++)
+
+	.dbg	line,	"tests/huc-put_stuff.c", 31; put_char(i + 'A', i, 3);
+
+	.dbg	line,	"tests/huc-put_stuff.c", 32; for (i = 0; i < 26; i++)
+
+	.dbg	line,	"tests/huc-put_stuff.c", 33; put_char(i + 'A', 258 + i);
+
+	.dbg	line,	"tests/huc-put_stuff.c", 34; for (i = 0; i < 26; i++)
+
+	.dbg	line,	"tests/huc-put_stuff.c", 35; put_raw(i+129, i, 6);
+
+	.dbg	line,	"tests/huc-put_stuff.c", 36; for (i = 0; i < 26; i++)
+
+	.dbg	line,	"tests/huc-put_stuff.c", 37; put_raw(i+129, 512-64+2+i);
+
+	.dbg	line,	"tests/huc-put_stuff.c", 38; for (i = 0; i < 15; i++)
+
+	.dbg	line,	"tests/huc-put_stuff.c", 39; put_number(i, 2, i*2, 8);
+
+	.dbg	line,	"tests/huc-put_stuff.c", 40; for (i = 0; i < 15; i++)
+
+	.dbg	line,	"tests/huc-put_stuff.c", 41; put_number(i, 2, 512 + 64 + 2 + i*2);
+
+	.dbg	line,	"tests/huc-put_stuff.c", 42; put_string("Done", 1100);
+
+	.dbg	line,	"tests/huc-put_stuff.c", 44; #endif
+
+	.dbg	line,	"tests/huc-put_stuff.c", 46; vsync();
+	__call		_vsync
+
+	.dbg	line,	"tests/huc-put_stuff.c", 47; vsync();
+	__call		_vsync
+
+	.dbg	line,	"tests/huc-put_stuff.c", 48; dump_screen();
+	__call		_dump_screen
+
+	.dbg	line,	"tests/huc-put_stuff.c", 49; for(;;);
+.LL19	.alias		.LL21
+.LL20	.alias		.LL21
+.LL21:
+	__bra		.LL21
+.LL22:
+
+	.dbg	line,	"tests/huc-put_stuff.c", 50; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'H','i',$00,'D','o','n','e',$00
+
+	.bss
+	.code
+	.if		leaf_needs < 1
+leaf_needs	.set	1
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:8
+;	constant pool:0
+;	global pool:233
+;	Macro pool:116
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
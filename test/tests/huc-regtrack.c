@@ -0,0 +1,49 @@
+/* reuse of values that are already in the registers */
+
+unsigned char i, j, k;
+unsigned char arr[10];
+unsigned char brr[10];
+int a, b, c;
+int s[3];
+
+int main()
+{
+  for (i = 0; i < 10; i++)
+    arr[i] = i * 3;
+
+  j = 4;
+  i = j + 1;
+  k = arr[i];
+  brr[i] = k;
+  j = i;
+  if (k != 15 || brr[5] != 15 || j != 5)
+    exit(1);
+
+  k = arr[j];
+  i = k;
+  if (i != 15 || arr[i / 3] != 15)
+    exit(2);
+
+  a = 300;
+  b = a;
+  c = a;
+  if (a != 300 || b != 300 || c != 300)
+    exit(3);
+
+  a = 5;
+  s[1] = a;
+  s[0] = 7;
+  b = s[1];
+  a = 6;
+  c = a;
+  if (b != 5 || c != 6 || s[0] != 7)
+    exit(4);
+
+  k = 200;
+  j = k;
+  a = k;
+  if (j != 200 || a != 200)
+    exit(5);
+
+  return 0;
+}
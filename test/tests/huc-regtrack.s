@@ -0,0 +1,288 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-regtrack.c", 1; /* reuse of values that are already in the registers */
+	.dbg	line,	"tests/huc-regtrack.c", 3; unsigned char i, j, k;
+	.dbg	line,	"tests/huc-regtrack.c", 4; unsigned char arr[10];
+	.dbg	line,	"tests/huc-regtrack.c", 5; unsigned char brr[10];
+	.dbg	line,	"tests/huc-regtrack.c", 6; int a, b, c;
+	.dbg	line,	"tests/huc-regtrack.c", 7; int s[3];
+	.dbg	line,	"tests/huc-regtrack.c", 9; int main()
+	.dbg	line,	"tests/huc-regtrack.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-regtrack.c", 11; for (i = 0; i < 10; i++)
+	__st.umiq	0, _i
+.LL3:
+	__ld.umq	_i
+	__ult_b.uiq	10
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.umq	_i
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/huc-regtrack.c", 12; arr[i] = i * 3;
+	__ld.um		_i
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__ldx.umq	_i
+	__st.uaxq	_arr
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/huc-regtrack.c", 14; j = 4;
+	__st.umiq	4, _j
+
+	.dbg	line,	"tests/huc-regtrack.c", 15; i = j + 1;
+	__ld.um		_j
+	__add.wi	1
+	__st.umq	_i
+
+	.dbg	line,	"tests/huc-regtrack.c", 16; k = arr[i];
+	__tax
+	__ld.uax	_arr
+	__st.umq	_k
+
+	.dbg	line,	"tests/huc-regtrack.c", 17; brr[i] = k;
+	__st.uaxq	_brr
+
+	.dbg	line,	"tests/huc-regtrack.c", 18; j = i;
+	__ld.um		_i
+	__st.umq	_j
+
+	.dbg	line,	"tests/huc-regtrack.c", 19; if (k != 15 || brr[5] != 15 || j != 5)
+	__ld.umq	_k
+	__neq_b.uiq	15
+	__btrue		.LL8
+	__ld.umq	_brr + 5
+	__neq_b.uiq	15
+.LL8:
+	__btrue		.LL9
+	__ld.umq	_j
+	__neq_b.uiq	5
+.LL9:
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/huc-regtrack.c", 20; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-regtrack.c", 22; k = arr[j];
+.LL7:
+	__ldx.umq	_j
+	__ld.uax	_arr
+	__st.umq	_k
+
+	.dbg	line,	"tests/huc-regtrack.c", 23; i = k;
+	__st.umq	_i
+
+	.dbg	line,	"tests/huc-regtrack.c", 24; if (i != 15 || arr[i / 3] != 15)
+	__neq_b.uiq	15
+	__btrue		.LL11
+	__ld.um		_i
+	__udiv.uiq	171, 1
+	__ld.uarq	_arr
+	__neq_b.uiq	15
+.LL11:
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/huc-regtrack.c", 25; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-regtrack.c", 27; a = 300;
+.LL10:
+	__st.wmiq	300, _a
+
+	.dbg	line,	"tests/huc-regtrack.c", 28; b = a;
+	__ld.wm		_a
+	__st.wmq	_b
+
+	.dbg	line,	"tests/huc-regtrack.c", 29; c = a;
+	__st.wmq	_c
+
+	.dbg	line,	"tests/huc-regtrack.c", 30; if (a != 300 || b != 300 || c != 300)
+	__neq_w.wi	300
+	__btrue		.LL13
+	__ld.wm		_b
+	__neq_w.wi	300
+.LL13:
+	__btrue		.LL14
+	__ld.wm		_c
+	__neq_w.wi	300
+.LL14:
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/huc-regtrack.c", 31; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-regtrack.c", 33; a = 5;
+.LL12:
+	__st.wmiq	5, _a
+
+	.dbg	line,	"tests/huc-regtrack.c", 34; s[1] = a;
+	__ld.wm		_a
+	__st.wmq	_s + 2
+
+	.dbg	line,	"tests/huc-regtrack.c", 35; s[0] = 7;
+	__st.wmiq	7, _s
+
+	.dbg	line,	"tests/huc-regtrack.c", 36; b = s[1];
+	__ld.wm		_s + 2
+	__st.wmq	_b
+
+	.dbg	line,	"tests/huc-regtrack.c", 37; a = 6;
+	__st.wmiq	6, _a
+
+	.dbg	line,	"tests/huc-regtrack.c", 38; c = a;
+	__ld.wm		_a
+	__st.wmq	_c
+
+	.dbg	line,	"tests/huc-regtrack.c", 39; if (b != 5 || c != 6 || s[0] != 7)
+	__ld.wm		_b
+	__neq_w.wi	5
+	__btrue		.LL16
+	__ld.wm		_c
+	__neq_w.wi	6
+.LL16:
+	__btrue		.LL17
+	__ld.wm		_s
+	__neq_w.wi	7
+.LL17:
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/huc-regtrack.c", 40; exit(4);
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-regtrack.c", 42; k = 200;
+.LL15:
+	__st.umiq	200, _k
+
+	.dbg	line,	"tests/huc-regtrack.c", 43; j = k;
+	__ld.um		_k
+	__st.umq	_j
+
+	.dbg	line,	"tests/huc-regtrack.c", 44; a = k;
+	__st.wmq	_a
+
+	.dbg	line,	"tests/huc-regtrack.c", 45; if (j != 200 || a != 200)
+	__neq_b.uiq	200
+	__btrue		.LL19
+	__ld.wm		_a
+	__neq_w.wi	200
+.LL19:
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/huc-regtrack.c", 46; exit(5);
+	__ld.wi		5
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-regtrack.c", 48; return 0;
+.LL18:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-regtrack.c", 49; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_arr:
+		ds	10
+_brr:
+		ds	10
+_s:
+		ds	6
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:11
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        73     17     1  i
+;        11     11     1  k
+;        20     20     2  a
+;        10     10     1  j
+;         8      8     2  b
+;         8      8     2  c
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_i, 1, 17, 73
+	auto_zp_var	_k, 1, 11, 11
+	auto_zp_var	_a, 2, 20, 20
+	auto_zp_var	_j, 1, 10, 10
+	auto_zp_var	_b, 2, 8, 8
+	auto_zp_var	_c, 2, 8, 8
+	.endm
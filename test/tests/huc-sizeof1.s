@@ -0,0 +1,270 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-sizeof1.c", 1; struct foo {
+	.dbg	line,	"tests/huc-sizeof1.c", 2; int a;
+	.dbg	line,	"tests/huc-sizeof1.c", 3; int b;
+	.dbg	line,	"tests/huc-sizeof1.c", 4; };
+	.dbg	line,	"tests/huc-sizeof1.c", 6; int x = 10;
+	.dbg	line,	"tests/huc-sizeof1.c", 7; char y = 11;
+	.dbg	line,	"tests/huc-sizeof1.c", 8; int z[3] = {3, 2, 1};
+	.dbg	line,	"tests/huc-sizeof1.c", 9; struct foo zz = {2, 1};
+	.dbg	line,	"tests/huc-sizeof1.c", 10; struct foo zzz[2] = {{7,6},{5,4}};
+	.dbg	line,	"tests/huc-sizeof1.c", 11; struct foo aaa[2];
+	.dbg	line,	"tests/huc-sizeof1.c", 12; int main()
+	.dbg	line,	"tests/huc-sizeof1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-sizeof1.c", 14; static int a = 5;
+
+	.dbg	line,	"tests/huc-sizeof1.c", 15; static char b = 3;
+
+	.dbg	line,	"tests/huc-sizeof1.c", 16; static int c[3] = {1, 2, 3};
+
+	.dbg	line,	"tests/huc-sizeof1.c", 17; static struct foo d = {1, 2};
+
+	.dbg	line,	"tests/huc-sizeof1.c", 18; static struct foo e[2] = {{4, 5}, {6, 7}};
+
+	.dbg	line,	"tests/huc-sizeof1.c", 19; struct foo aa[2];
+
+	.dbg	line,	"tests/huc-sizeof1.c", 20; 
+
+	.dbg	line,	"tests/huc-sizeof1.c", 21; if (sizeof(a) <= 1 || sizeof(x) <= 1)
+	__ld.wi		2
+	__sle_w.wi	1
+	__btrue		.LL9
+	__ld.wi		2
+	__sle_w.wi	1
+.LL9:
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/huc-sizeof1.c", 22; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-sizeof1.c", 23; if (sizeof(b) != 1 || sizeof(y) != 1)
+.LL8:
+	__ld.wi		1
+	__neq_w.wi	1
+	__btrue		.LL11
+	__ld.wi		1
+	__neq_w.wi	1
+.LL11:
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/huc-sizeof1.c", 24; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-sizeof1.c", 25; if (sizeof(c) != sizeof(a) * 3)
+.LL10:
+	__ld.wi		6
+	__neq_w.wi	6
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/huc-sizeof1.c", 26; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-sizeof1.c", 27; if (sizeof(z) != sizeof(a) * 3)
+.LL12:
+	__ld.wi		6
+	__neq_w.wi	6
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/huc-sizeof1.c", 28; exit(4);
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-sizeof1.c", 29; if (sizeof(d) != sizeof(a) * 2)
+.LL13:
+	__ld.wi		4
+	__neq_w.wi	4
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/huc-sizeof1.c", 30; exit(5);
+	__ld.wi		5
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-sizeof1.c", 31; if (sizeof(zz) != sizeof(a) * 2)
+.LL14:
+	__ld.wi		4
+	__neq_w.wi	4
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/huc-sizeof1.c", 32; exit(6);
+	__ld.wi		6
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-sizeof1.c", 33; if (sizeof(e) != sizeof(a) * 4)
+.LL15:
+	__ld.wi		8
+	__neq_w.wi	8
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/huc-sizeof1.c", 34; exit(7);
+	__ld.wi		7
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-sizeof1.c", 35; if (sizeof(zzz) != sizeof(a) * 4)
+.LL16:
+	__ld.wi		8
+	__neq_w.wi	8
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/huc-sizeof1.c", 36; exit(8);
+	__ld.wi		8
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-sizeof1.c", 37; if (sizeof(aa) != sizeof(a) * 4)
+.LL17:
+	__ld.wi		8
+	__neq_w.wi	8
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/huc-sizeof1.c", 38; exit(9);
+	__ld.wi		9
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-sizeof1.c", 39; if (sizeof(aaa) != sizeof(a) * 4)
+.LL18:
+	__ld.wi		8
+	__neq_w.wi	8
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/huc-sizeof1.c", 40; exit(10);
+	__ld.wi		10
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-sizeof1.c", 41; return 0;
+.LL19:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-sizeof1.c", 42; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_aaa:
+		ds	8
+
+	.xdata
+_x:
+		ds	2
+_y:
+		ds	1
+_z:
+		ds	6
+_zz:
+		ds	4
+_zzz:
+		ds	8
+SL3:
+		ds	2
+SL4:
+		ds	1
+SL5:
+		ds	6
+SL6:
+		ds	4
+SL7:
+		ds	8
+
+	.xinit
+
+		dw	10
+
+		db	11
+
+		dw	3,2,1
+		dw	2
+		dw	1
+
+		dw	7
+		dw	6
+		dw	5
+		dw	4
+
+
+		dw	5
+
+		db	3
+
+		dw	1,2,3
+		dw	1
+		dw	2
+
+		dw	4
+		dw	5
+		dw	6
+		dw	7
+
+	.code
+	.if		leaf_needs < 8
+leaf_needs	.set	8
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:13
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,5948 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-sprintf.c", 1; #ifdef __HUCC__
+	.dbg	line,	"tests/huc-sprintf.c", 3; #include <huc.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 1; #ifndef _hucc_legacy_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 2; #define _hucc_legacy_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 7; ; huc.h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 9; ; HuCC wrapper file to include a default set of HuC-compatible functions.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 20; ; When the HuCC compiler is invoked with the "--legacy" option to compile old
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 21; ; projects, then this "huc.h" file is automatically included.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 22; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 23; ; This file includes a set of the individual HuCC headers which correspond to
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 24; ; HuC's built-in functions and MagicKit library.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 25; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 26; ; New HuCC projects should, preferably, include the specific headers that are
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 27; ; needed, which will then allow them to replace parts of the standard library
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 28; ; with newer functions, or they can just manually include this "huc.h" file.
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 30; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 31; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 33; #include "hucc-systemcard.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 1; #ifndef _hucc_systemcard_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 2; #define _hucc_systemcard_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 7; ; hucc-systemcard.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 9; ; Macros and library functions for using the System Card.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 20; ; Because these are mainly macros, and so must be included before being used
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 21; ; in compiled code, the actual functions here are written to avoid using any
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 22; ; BSS memory so that HuCC's overlay global-shared-variables are not effected.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 24; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 25; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 27; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 28; // Backup RAM defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 29; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 31; #define  BM_OK             0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 32; #define  BM_NOT_FOUND      1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 33; #define  BM_BAD_CHECKSUM   2
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 34; #define  BM_DIR_CORRUPTED  3
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 35; #define  BM_FILE_EMPTY     4
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 36; #define  BM_FULL           5
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 37; #define  BM_NOT_FORMATED   0xFF			// HuC incorrect spelling.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 38; #define  BM_NOT_FORMATTED  0xFF			// HuCC can use a dictionary!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 40; #define  BRAM_STARTPTR     0x8010
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 42; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 43; // CD defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 44; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 46; #define	CDPLAY_MUTE		0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 47; #define	CDPLAY_REPEAT		1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 48; #define	CDPLAY_NORMAL		2
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 49; #define	CDPLAY_ENDOFDISC	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 51; #define	CDFADE_CANCEL	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 52; #define	CDFADE_PCM6	8
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 53; #define	CDFADE_ADPCM6	10
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 54; #define	CDFADE_PCM2	12
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 55; #define	CDFADE_ADPCM2	14
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 57; #define CDTRK_AUDIO	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 58; #define CDTRK_DATA	4
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 60; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 61; // ADPCM defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 62; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 64; #define	ADPLAY_AUTOSTOP		0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 65; #define	ADPLAY_REPEAT		0x80
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 67; #define ADPLAY_FREQ_16KHZ	0xE
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 68; #define ADPLAY_FREQ_10KHZ	0xD
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 69; #define ADPLAY_FREQ_8KHZ	0xC
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 70; #define ADPLAY_FREQ_6KHZ	0xB
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 71; #define ADPLAY_FREQ_5KHZ	0xA
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 73; #define ADREAD_RAM	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 74; #define ADREAD_VRAM	0xFF
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 76; #define ADWRITE_RAM	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 77; #define ADWRITE_VRAM	0xFF
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 79; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 80; // Functions in hucc-systemcard.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 81; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 83; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 85; #asmdef	HUCC_USES_SYSTEMCARD 1
+HUCC_USES_SYSTEMCARD = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 87; extern void __fastcall __macro cd_boot( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 88; extern unsigned int __fastcall __macro cd_getver( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 89; extern void __fastcall __macro cd_reset( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 90; extern unsigned char __fastcall __macro cd_pause( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 91; extern unsigned char __fastcall cd_unpause( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 92; extern void __fastcall __macro cd_fade( unsigned char type<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 93; extern unsigned char __fastcall cd_playtrk( unsigned char start_track<_bx>, unsigned char end_track<_cx>, unsigned char mode<_dh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 94; extern unsigned char __fastcall cd_playmsf( unsigned char start_minute<_al>,  unsigned char start_second<_ah>,  unsigned char start_frame<_bl>, unsigned char end_minute<_cl>,  unsigned char end_second<_ch>,  unsigned char end_frame<_dl>,  unsigned char mode<_dh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 95; extern unsigned char __fastcall cd_fastvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int sectors<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 96; extern unsigned char __fastcall cd_loadvram( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int vramaddr<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 97; extern unsigned char __fastcall cd_loaddata( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char __far *buffer<_bp_bank:_bp>, unsigned int bytes<__ptr> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 98; extern unsigned char __fastcall cd_loadbank( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char bank<_bl>, unsigned int sectors<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 99; extern unsigned char __fastcall __macro cd_status( unsigned char mode<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 101; extern void __fastcall __macro ad_reset( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 102; extern unsigned char __fastcall __macro ad_trans( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned char nb_sectors<_dh>, unsigned int ad_addr<_bx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 103; extern void __fastcall __macro ad_read( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 104; extern void __fastcall __macro ad_write( unsigned int ad_addr<_cx>, unsigned char mode<_dh>, unsigned int buf<_bx>, unsigned int bytes<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 105; extern unsigned char __fastcall __macro ad_play( unsigned int ad_addr<_bx>, unsigned int bytes<_ax>, unsigned char freq<_dh>, unsigned char mode<_dl> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 106; extern unsigned char __fastcall __macro ad_cplay( unsigned char ovl_index<_cl>, unsigned int sect_offset<_si>, unsigned int nb_sectors<_bx>, unsigned char freq<_dh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 107; extern void __fastcall __macro ad_stop( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 108; extern unsigned char __fastcall __macro ad_stat( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 110; extern unsigned char __fastcall bm_check( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 111; extern unsigned char __fastcall bm_format( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 112; extern unsigned int __fastcall __macro bm_free( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 113; extern unsigned char __fastcall __macro bm_read( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 114; extern unsigned char __fastcall __macro bm_write( unsigned char *buffer<_bx>, unsigned char *name<_ax>, unsigned int offset<_dx>, unsigned int length<_cx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 115; extern unsigned char __fastcall __macro bm_delete( unsigned char *name<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 117; // Deprecated functions ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 119; extern unsigned char __fastcall __macro bm_exist( unsigned char *name<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 120; extern unsigned char __fastcall __macro bm_create( unsigned char *name<_ax>, unsigned int length<_cx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 122; // void __fastcall _xsafe add_sectors( unsigned int sector_offset<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 124; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-systemcard.h", 126; #endif // _hucc_systemcard_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 34; #include "hucc-baselib.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 1; #ifndef _hucc_baselib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 2; #define _hucc_baselib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 7; ; hucc-baselib.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 9; ; Basic library functions provided as macros.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 18; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 20; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 21; // Joypad defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 22; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 24; #define	JOY_A		0x01
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 25; #define	JOY_I		0x01
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 26; #define	JOY_B		0x02
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 27; #define	JOY_II		0x02
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 28; #define	JOY_SLCT	0x04
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 29; #define	JOY_SEL		0x04
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 30; #define	JOY_STRT	0x08
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 31; #define	JOY_RUN		0x08
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 32; #define	JOY_UP		0x10
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 33; #define	JOY_RGHT	0x20
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 34; #define	JOY_RIGHT	0x20
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 35; #define	JOY_DOWN	0x40
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 36; #define	JOY_LEFT	0x80
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 38; #define	JOY_C		0x0100
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 39; #define	JOY_III		0x0100
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 40; #define	JOY_D		0x0200
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 41; #define	JOY_IV		0x0200
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 42; #define	JOY_E		0x0400
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 43; #define	JOY_V		0x0400
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 44; #define	JOY_F		0x0800
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 45; #define	JOY_VI		0x0800
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 47; #define JOY_SIXBUT	0x8000
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 48; #define JOY_TYPE6	0x8000
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 50; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 51; // SuperGRAFX VPC settings for set_vpc_ctl() ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 52; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 54; #define VPC_SPR1_BKG1_SPR2_BKG2	0x3000 // same as SGX_PARALLAX=0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 55; #define VPC_SPR1_SPR2_BKG1_BKG2	0x7000 // same as SGX_PARALLAX=1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 56; #define VPC_BKG1_BKG2_SPR1_SPR2	0xB000
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 58; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 59; // System Card variables ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 60; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 62; extern unsigned int si;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 63; extern unsigned int di;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 64; extern unsigned int bp;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 66; extern unsigned int ax;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 67; extern unsigned int bx;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 68; extern unsigned int cx;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 69; extern unsigned int dx;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 71; extern unsigned char al;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 72; extern unsigned char ah;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 73; extern unsigned char bl;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 74; extern unsigned char bh;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 75; extern unsigned char cl;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 76; extern unsigned char ch;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 77; extern unsigned char dl;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 78; extern unsigned char dh;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 80; extern unsigned char irq_cnt;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 81; extern unsigned char joynow[5];
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 82; extern unsigned char joytrg[5];
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 83; extern unsigned char joy6now[5];
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 84; extern unsigned char joy6trg[5];
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 85; extern unsigned int  bg_x1;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 86; extern unsigned int  bg_y1;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 87; extern unsigned int  bg_x2;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 88; extern unsigned int  bg_y2;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 90; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 91; // Special macros to get information from PCEAS ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 92; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 94; #define BANK( datasym ) ((unsigned) (&__bank__ ## datasym))
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 95; #define SIZEOF( datasym ) ((unsigned) (&__sizeof__ ## datasym))
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 96; #define COUNTOF( datasym ) ((unsigned) (&__countof__ ## datasym))
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 97; #define OVERLAY( datasym ) ((unsigned) (&__overlay__ ## datasym))
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 100; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 101; // Functions in hucc-baselib.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 102; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 104; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 106; #asmdef	HUCC_USES_BASELIB 1
+HUCC_USES_BASELIB = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 108; #define	_OPTIMIZE 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 111; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 112; // Hardware Detection
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 113; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 115; extern unsigned char __fastcall __macro sgx_detect( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 116; extern unsigned char __fastcall __macro ac_exists( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 119; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 120; // Memory Access
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 121; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 123; extern unsigned char __fastcall __macro peek( unsigned int addr<__ptr> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 124; extern unsigned int  __fastcall __macro peekw( unsigned int addr<__ptr> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 126; extern void __fastcall __macro poke( unsigned int addr<__poke>, unsigned char with<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 127; extern void __fastcall __macro pokew( unsigned int addr<__poke>, unsigned int with<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 129; extern unsigned char __fastcall farpeek( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 130; extern unsigned int  __fastcall farpeekw( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 132; extern void __fastcall __nop set_far_base( unsigned char data_bank<_bp_bank>, unsigned char *data_addr<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 133; extern void __fastcall set_far_offset( unsigned int offset<_bp>, unsigned char data_bank<_bp_bank>, unsigned char *data_addr<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 135; extern unsigned char __fastcall far_peek( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 136; extern unsigned int  __fastcall far_peekw( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 138; extern void __fastcall __macro reset_mpr2( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 139; extern void __fastcall __macro reset_mpr34( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 141; extern void * __fastcall __macro farset_mpr2( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 142; extern void * __fastcall __macro farset_mpr34( void __far *addr<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 144; extern void * __fastcall __macro far_set_mpr2( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 145; extern void * __fastcall __macro far_set_mpr34( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 148; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 149; // Clock Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 150; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 152; extern unsigned char __fastcall __macro clock_hh( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 153; extern unsigned char __fastcall __macro clock_mm( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 154; extern unsigned char __fastcall __macro clock_ss( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 155; extern unsigned char __fastcall __macro clock_tt( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 156; extern void __fastcall __macro clock_reset( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 159; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 160; // Joypad Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 161; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 163; extern unsigned int __fastcall __macro joy( unsigned char which<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 164; extern unsigned int __fastcall __macro joytrg( unsigned char which<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 167; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 168; // Number Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 169; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 171; extern void __fastcall __macro srand( unsigned char seed<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 172; extern unsigned int __fastcall rand( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 173; extern unsigned char __fastcall rand8( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 175; // Note: "limit" is 0..255.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 176; extern unsigned char __fastcall random8( unsigned char limit<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 178; // Note: "limit" is 0..128, 129..255 are treated as 128!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 179; extern unsigned char __fastcall random( unsigned char limit<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 182; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 183; // Overlay Execution
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 184; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 186; extern unsigned char __fastcall __macro cd_execoverlay( unsigned char ovl_index<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 189; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 190; // Functions that are only optionally available if configured in your hucc-config.inc
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 191; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 193; extern unsigned int __fastcall __macro joybuf( unsigned char which<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 194; extern unsigned int __fastcall __macro get_joy_events( unsigned char which<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 195; extern void __fastcall __macro clear_joy_events( unsigned char mask<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 198; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 199; // Functions that are only implemented in the TGEMU emulator for unit-testing
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 200; // the compiler, and which should never be used in normal HuCC projects ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 201; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 203; extern void __fastcall dump_screen( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 205; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-baselib.h", 207; #endif // _hucc_baselib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 35; #include "hucc-gfx.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 1; #ifndef _hucc_gfx_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 2; #define _hucc_gfx_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 7; ; huc-gfx.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 10; ; other original HuC developers.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 11; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 13; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 17; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 19; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 21; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 22; // Screen defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 23; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 25; #define	SCR_SIZE_32x32	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 26; #define	SCR_SIZE_64x32	1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 27; #define	SCR_SIZE_128x32	2
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 28; #define	SCR_SIZE_32x64	4
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 29; #define	SCR_SIZE_64x64	5
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 30; #define	SCR_SIZE_128x64	6
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 32; #define	XRES_SHARP	0
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 33; #define	XRES_SOFT	4
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 34; #define	XRES_KEEP	128
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 36; #define VPC_WIN_A	0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 37; #define VPC_WIN_B	0x01
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 38; #define	VPC_WIN_AB	0x02
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 39; #define	VPC_WIN_NONE	0x03
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 40; #define	VPC_NORM	0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 41; #define	VPC_SPR		0x04
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 42; #define	VPC_INV_SPR	0x08
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 43; #define VDC1_ON		0x01
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 44; #define	VDC1_OFF	0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 45; #define VDC2_ON		0x02
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 46; #define	VDC2_OFF	0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 47; #define VDC_ON		0x03
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 48; #define	VDC_OFF		0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 50; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 51; // Functions in hucc-gfx.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 52; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 54; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 56; #asmdef	HUCC_USES_GFX 1
+HUCC_USES_GFX = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 58; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 59; // Color and Palette Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 60; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 62; extern void __fastcall clear_palette( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 64; extern void __fastcall __nop set_color( unsigned int index<VCE_CTA>, unsigned int value<VCE_CTW> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 65; extern void __fastcall set_color_rgb( unsigned int index<VCE_CTA>, unsigned char r<_al>, unsigned char g<_ah>, unsigned char b<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 66; extern unsigned int __fastcall __macro get_color( unsigned int index<VCE_CTA> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 68; extern void __fastcall load_palette( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 69; extern void __fastcall far_load_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 71; extern void __fastcall read_palette( unsigned char palette<_al>, unsigned char num_palettes<_ah>, unsigned int *destination<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 73; extern void __fastcall __macro fade_to_black( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 74; extern void __fastcall __macro fade_to_white( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 75; extern void __fastcall __macro cross_fade_to( unsigned int __far *from<_bp_bank:_bp>, unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 77; extern void __fastcall __macro far_fade_to_black( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_sub<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 78; extern void __fastcall __macro far_fade_to_white( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char value_to_add<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 79; extern void __fastcall __macro far_cross_fade_to( unsigned int *destination<_di>, unsigned char num_colors<_al>, unsigned char which_component<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 83; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 84; // Video Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 85; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 87; extern void __fastcall init_240x208( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 88; extern void __fastcall init_256x224( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 90; extern void __fastcall vsync( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 91; extern void __fastcall vsync( unsigned char count<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 93; extern void __fastcall disp_on( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 94; extern void __fastcall disp_off( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 96; extern void __fastcall set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 98; extern void __fastcall set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 100; extern void __fastcall cls( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 101; extern void __fastcall cls( unsigned int tile<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 103; extern unsigned int __fastcall __macro vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 104; extern unsigned int __fastcall __macro get_vram( unsigned int address<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 105; extern void __fastcall __macro put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 107; extern void __fastcall __macro load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 108; extern void __fastcall __macro far_load_vram( unsigned int vram<_di>,  unsigned int num_words<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 110; extern void __fastcall load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 111; extern void __fastcall far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 113; extern void __fastcall __macro load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 114; extern void __fastcall __macro far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 116; extern void __fastcall vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 119; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 120; // SuperGRAFX Video Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 121; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 123; extern void __fastcall __nop vpc_set_ctl( unsigned int bits<VPC_CR> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 124; extern void __fastcall __nop vpc_set_win1( unsigned int width<VPC_WINDOW1> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 125; extern void __fastcall __nop vpc_set_win2( unsigned int width<VPC_WINDOW2> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 127; extern void __fastcall sgx_set_screen_size( unsigned char value<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 129; extern void __fastcall sgx_set_xres( unsigned int x_pixels<_ax>, unsigned char blur_flag<_bl> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 131; extern void __fastcall sgx_cls( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 132; extern void __fastcall sgx_cls( unsigned int tile<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 134; extern unsigned int __fastcall __macro sgx_vram_addr( unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 135; extern unsigned int __fastcall __macro sgx_get_vram( unsigned int address<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 136; extern void __fastcall __macro sgx_put_vram( unsigned int address<_di>, unsigned int data<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 138; extern void __fastcall __macro sgx_load_vram( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_words<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 139; extern void __fastcall __macro sgx_far_load_vram( unsigned int vram<_di>, unsigned int num_words<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 141; extern void __fastcall sgx_load_bat( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 142; extern void __fastcall sgx_far_load_bat( unsigned int vram<_di>, unsigned char tiles_w<_al>, unsigned char tiles_h<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 144; extern void __fastcall __macro sgx_load_sprites( unsigned int vram<_di>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_groups<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 145; extern void __fastcall __macro sgx_far_load_sprites( unsigned int vram<_di>, unsigned int num_groups<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 147; extern void __fastcall sgx_vram2vram( unsigned int vram_dst<_ax>, unsigned int vram_src<_bx>, unsigned int word_len<_cx> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 150; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 151; // Font Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 152; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 154; extern void __fastcall set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 155; extern void __fastcall set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 157; extern void __fastcall load_font( unsigned char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 158; extern void __fastcall far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 160; extern void __fastcall __nop set_font_color( unsigned char foreground<monofont_fg>, unsigned char background<monofont_bg> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 161; extern void __fastcall __macro load_default_font( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 164; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 165; // SuperGRAFX Font Functions
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 166; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 168; extern void __fastcall sgx_set_font_addr( unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 169; extern void __fastcall sgx_set_font_pal( unsigned char palette<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 171; extern void __fastcall sgx_load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 172; extern void __fastcall sgx_far_load_font( unsigned char count<_al>, unsigned int vram<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 174; extern void __fastcall __macro sgx_load_default_font( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 177; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 178; // Deprecated functions ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 179; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 181; extern void __fastcall __macro set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 182; extern void __fastcall __macro sgx_set_xres( unsigned int x_pixels<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 184; extern void __fastcall load_background( unsigned char __far *tiles<_bp_bank:_bp>, unsigned char __far *palettes<__fbank:__fptr>, unsigned char __far *bat<_cl:_bx>, unsigned char w<_dl>, unsigned char h<_dh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 186; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 187; extern void __fastcall __macro set_bgpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 188; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 189; extern void __fastcall __macro set_sprpal( unsigned char palette<_al>, unsigned char __far *data<_bp_bank:_bp>, unsigned int num_palettes<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 191; extern void __fastcall load_font( char __far *font<_bp_bank:_bp>, unsigned char count<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 193; extern void __fastcall put_string( unsigned char *string<_bp>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 195; extern void __fastcall put_char( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 196; extern void __fastcall put_digit( unsigned char digit<_bl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 197; extern void __fastcall put_hex( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 198; extern void __fastcall put_number( unsigned int number<_bx>, unsigned char length<_cl>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 199; extern void __fastcall put_raw( unsigned int data<_bx>, unsigned char bat_x<_dil>, unsigned char bat_y<_dih> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 201; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-gfx.h", 203; #endif // _hucc_gfx_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 36; #include "hucc-old-scroll.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 1; #ifndef _hucc_old_scroll_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 2; #define _hucc_old_scroll_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 7; ; hucc-old-scroll.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 10; ; other original HuC developers.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 11; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 13; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 17; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 19; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 20; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 21; ; HuC's old scrolling library is provided for use with existing HuC projects,
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 22; ; but it should preferably be avoided in new projects because it is slow and
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 23; ; forever limited by its choice to handle gaps between areas, and sorting.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 24; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 25; ; HuCC's new scrolling library puts the responibility for defining both gaps
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 26; ; and the display order into the project's hands, but in return it runs much
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 27; ; faster, using less than 1/6 of the processing time in VBLANK, and far less
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 28; ; time in the RCR interrputs themselves. It also supports the 2nd SuperGRAFX
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 29; ; screen layer, which HuC's old scrolling library ignores.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 30; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 31; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 32; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 34; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 35; // Functions in hucc-old-scroll.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 36; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 38; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 40; #asmdef	HUCC_USES_OLD_SCROLL 1
+HUCC_USES_OLD_SCROLL = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 42; extern void __fastcall scroll( unsigned char num<_al>, unsigned int x<_cx>, unsigned int y<_dx>, unsigned char top<_ah>, unsigned char bottom<_bl>, unsigned char disp<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 43; extern void __fastcall scroll_disable( unsigned char num<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 45; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-scroll.h", 47; #endif // _hucc_old_scroll_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 37; #include "hucc-old-spr.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 1; #ifndef _hucc_old_spr_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 2; #define _hucc_old_spr_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 7; ; hucc-old-spr.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 10; ; other original HuC developers.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 11; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 13; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 17; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 19; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 21; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 22; // Sprite defines ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 23; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 25; #define FLIP_X_MASK 0x08
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 26; #define FLIP_Y_MASK 0x80
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 27; #define FLIP_MAS    0x88
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 28; #define SIZE_MAS    0x31
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 30; #define NO_FLIP     0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 31; #define NO_FLIP_X   0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 32; #define NO_FLIP_Y   0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 33; #define FLIP_X      0x08
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 34; #define FLIP_Y      0x80
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 35; #define SZ_16x16    0x00
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 36; #define SZ_16x32    0x10
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 37; #define SZ_16x64    0x30
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 38; #define SZ_32x16    0x01
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 39; #define SZ_32x32    0x11
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 40; #define	SZ_32x64    0x31
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 42; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 43; // Functions in hucc-old-spr.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 44; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 46; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 48; #asmdef	HUCC_USES_OLD_SPR 1
+HUCC_USES_OLD_SPR = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 50; extern void __fastcall init_satb( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 51; extern void __fastcall reset_satb( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 52; extern void __fastcall satb_update( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 53; extern void __fastcall spr_set( unsigned char num<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 54; extern void __fastcall spr_hide( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 55; extern void __fastcall spr_show( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 56; extern void __fastcall spr_x( unsigned int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 57; extern void __fastcall spr_y( unsigned int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 58; extern void __fastcall spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 59; extern void __fastcall spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 60; extern void __fastcall spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 61; extern void __fastcall spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 63; extern unsigned int __fastcall spr_get_x( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 64; extern unsigned int __fastcall spr_get_y( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 66; extern void __fastcall sgx_init_satb( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 67; extern void __fastcall sgx_reset_satb( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 68; extern void __fastcall sgx_satb_update( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 69; extern void __fastcall sgx_spr_set( unsigned char num<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 70; extern void __fastcall sgx_spr_hide( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 71; extern void __fastcall sgx_spr_show( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 72; extern void __fastcall sgx_spr_x( unsigned int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 73; extern void __fastcall sgx_spr_y( unsigned int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 74; extern void __fastcall sgx_spr_pattern( unsigned int vaddr<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 75; extern void __fastcall sgx_spr_ctrl( unsigned char mask<_al>, unsigned char value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 76; extern void __fastcall sgx_spr_pal( unsigned char palette<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 77; extern void __fastcall sgx_spr_pri( unsigned char priority<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 79; extern unsigned int __fastcall sgx_spr_get_x( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 80; extern unsigned int __fastcall sgx_spr_get_y( void );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 82; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-spr.h", 84; #endif // _hucc_old_spr_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 38; #include "hucc-old-map.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 1; #ifndef _hucc_old_map_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 2; #define _hucc_old_map_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 7; ; hucc-old-map.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 10; ; other original HuC developers.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 11; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 13; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 17; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 19; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 21; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 22; // Functions in hucc-old-map.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 23; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 25; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 27; #asmdef	HUCC_USES_OLD_MAP 1
+HUCC_USES_OLD_MAP = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 29; extern void __fastcall set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 30; extern void __fastcall sgx_set_tile_address( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 32; extern void __fastcall __nop set_tile_data( unsigned char __far *tiles<vdc_tile_bank:vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 33; extern void __fastcall __nop sgx_set_tile_data( unsigned char __far *tiles<sgx_tile_bank:sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 35; extern void __fastcall __nop set_far_tile_data( unsigned char tile_bank<vdc_tile_bank>, unsigned char *tile_addr<vdc_tile_addr>, unsigned char num_tiles<vdc_num_tiles>, unsigned char palette_table_bank<vdc_attr_bank>, unsigned char *palette_table_addr<vdc_attr_addr>, unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 36; extern void __fastcall __nop sgx_set_far_tile_data( unsigned char tile_bank<sgx_tile_bank>, unsigned char *tile_addr<sgx_tile_addr>, unsigned char num_tiles<sgx_num_tiles>, unsigned char palette_table_bank<sgx_attr_bank>, unsigned char *palette_table_addr<sgx_attr_addr>, unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 38; extern void __fastcall __nop set_map_data( unsigned char __far *map<vdc_map_bank:vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 39; extern void __fastcall __nop sgx_set_map_data( unsigned char __far *map<sgx_map_bank:sgx_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 41; extern void __fastcall __nop set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<vdc_map_width>, unsigned char h<vdc_map_height> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 42; extern void __fastcall __nop sgx_set_far_map_data( unsigned char map_bank<vdc_map_bank>, unsigned char *map_addr<vdc_map_addr>, unsigned char w<sgx_map_width>, unsigned char h<sgx_map_height> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 44; extern void __fastcall load_tile( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 45; extern void __fastcall sgx_load_tile( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 47; extern void __fastcall load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 48; extern void __fastcall sgx_load_map( unsigned char bat_x<_al>, unsigned char bat_y<_ah>, int map_x<_bx>, int map_y<_dx>, unsigned char tiles_w<_cl>, unsigned char tiles_h<_ch> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 50; extern unsigned char __fastcall map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 51; extern unsigned char __fastcall sgx_map_get_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 53; extern void __fastcall map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 54; extern void __fastcall sgx_map_put_tile( unsigned char map_x<_bl>, unsigned char map_y<_bh>, unsigned char tile<_al> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 56; extern void __fastcall put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 57; extern void __fastcall sgx_put_tile( unsigned char tile<_bl>, unsigned char bat_x<_al>, unsigned char bat_y<_ah> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 59; // Deprecated functions ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 61; extern void __fastcall set_tile_data( unsigned char *tile_ex<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 63; extern void __fastcall __nop set_map_pals( unsigned char __far *palette_table<vdc_attr_bank:vdc_attr_addr> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 64; extern void __fastcall __nop set_map_tile_type( unsigned char tile_type<vdc_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 66; extern void __fastcall __nop sgx_set_map_pals( unsigned char __far *palette_table<sgx_attr_bank:sgx_attr_addr> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 67; extern void __fastcall __nop sgx_set_map_tile_type( unsigned char tile_type<sgx_tile_type> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 69; extern void __fastcall set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 70; extern void __fastcall sgx_set_map_tile_base( unsigned int vram<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 72; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-map.h", 74; #endif // _hucc_old_map_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 39; #include "hucc-old-line.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 1; #ifndef _hucc_old_line_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 2; #define _hucc_old_line_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 7; ; hucc-old-line.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 9; ; Based on the original HuC and MagicKit functions by David Michel and the
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 10; ; other original HuC developers.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 11; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 12; ; Modifications copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 13; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 14; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 15; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 16; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 17; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 19; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 21; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 22; // Functions in hucc-old-line.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 23; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 25; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 27; #asmdef	HUCC_USES_OLD_LINE 1
+HUCC_USES_OLD_LINE = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 29; extern void __fastcall gfx_init( unsigned int start_vram_addr<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 30; extern void __fastcall gfx_clear( unsigned int start_vram_addr<_di> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 31; extern void __fastcall gfx_plot( unsigned int x<_gfx_x1>, unsigned int y<_gfx_y1>, char color<_gfx_color> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 32; extern void __fastcall gfx_line( unsigned int x1<_gfx_x1>, unsigned int y1<_gfx_y1>, unsigned int x2<_gfx_x2>, unsigned int y2<_gfx_y2>, unsigned char color<_gfx_color> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 34; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-old-line.h", 36; #endif // _hucc_old_line_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 41; #include <stdlib.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 1; #ifndef _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 2; #define _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 4; #define RAND_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 6; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 7; extern int __fastcall abs( int value<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 8; #endif
+	.dbg	line,	"/root/repo/test/../include/hucc/stdlib.h", 10; #endif // _hucc_stdlib_h
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 42; #include <string.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 3; #endif
+	.dbg	line,	"/root/repo/test/../include/hucc/huc.h", 44; #endif // _hucc_legacy_h
+	.dbg	line,	"tests/huc-sprintf.c", 4; #include <stdio.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 1; #ifndef _hucc_stdio_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 2; #define _hucc_stdio_h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 7; ; stdio.h
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 9; ; A small and simple printf() and sprintf() implementation for HuCC.
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 11; ; Copyright John Brandwood 2019-2025.
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 20; ; WARNING: This only supports a subset of POSIX printf()/sprintf() behavior!
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 21; ; WARNING: <width>, <precision> and numbers in ESC-sequences must be <= 127!
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 22; ; WARNING: This only supports a maximum of 4 data arguments!
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 23; ; WARNING: sprintf() must output less than 256 characters!
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 24; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 25; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 26; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 27; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 28; ; A format specifier follows this prototype:
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 30; ;   '%' [<flags>] [<width>] ['.' <precision>] [<length>] <specifier>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 31; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 32; ; <flags>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 34; ;   ('-' | '0' | '+' | ' ') = one or more of the following ...
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 35; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 36; ;    '-' to left-justify output within the <width>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 37; ;    '0' to pad to <width> with zero instead of space
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 38; ;    '+' to prepend positive integers with a '+' when "%d" or "%i"
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 39; ;    ' ' to prepend positive integers with a ' ' when "%d", "%i" or "%u"
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 40; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 41; ; <width>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 43; ;   (<decimal-number> | '*') = "1..127" or read value from an argument
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 44; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 45; ; <precision>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 46; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 47; ;   (<decimal-number> | '*') = "1..127" or read value from an argument
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 48; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 49; ; <length>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 50; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 51; ;   ('l') = only "%x" and "%X" : read two 16-bit arguments as a 32-bit value
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 52; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 53; ; <specifier>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 54; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 55; ;   '%' = just print a '%'
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 56; ;   'c' = print an ASCII character <precision> times
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 57; ;   'd' = print a signed integer variable in decimal
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 58; ;   'i' = print a signed integer variable in decimal
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 59; ;   's' = print string, stop at <precision> characters
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 60; ;   'u' = print an unsigned integer variable in decimal
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 61; ;   'x' = print an unsigned binary (or BCD) variable in hex
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 62; ;   'X' = print an unsigned binary (or BCD) variable in hex
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 63; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 64; ; Note:
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 65; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 66; ;   HuCC follows GCC's behavior, except for "%u" with a '+' ...
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 67; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 68; ;     If both '+' and ' ' flags are used, then '+' overrides the ' ' flag.
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 69; ;     "%u" is unsigned-by-definition and treats '+' as ' ' (GCC ignores '+').
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 70; ;     "%x", "%X", "%c" and "%s" ignore the '+' and ' ' flags.
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 71; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 72; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 73; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 74; ; printf() and puts() output accept virtual-terminal control codes:
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 75; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 76; ; <control-code>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 77; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 78; ;   '\n' = move cursor-X to XL, cursor-Y down 1 line.
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 79; ;   '\r' = move cursor-X to XL.
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 80; ;   '\f' = clear-screen + home cursor-X and cursor-Y to (XL, YT)
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 81; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 82; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 83; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 84; ; printf() and puts() output accept virtual-terminal escape sequences:
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 85; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 86; ;   ('\e' | '\x1B') <decimal-number> <escape-code>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 87; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 88; ; <escape-code>
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 89; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 90; ;   'X' = set current X coordinate (0..127)
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 91; ;   'Y' = set current Y coordinate (0..63)
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 92; ;   'L' = set minimum X coordinate (0..127)
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 93; ;   'T' = set minimum Y coordinate (0..63)
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 94; ;   'P' = set current palette (0..15)
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 95; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 96; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 97; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 99; #ifndef NULL
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 100; #define NULL (0)
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 101; #endif
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 103; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 104; // TTY-related variables which can either be set before calling printf() or
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 105; // by using escape codes.
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 106; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 108; extern unsigned char vdc_tty_x_lhs;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 109; extern unsigned char vdc_tty_y_top;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 110; extern unsigned char vdc_tty_x;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 111; extern unsigned char vdc_tty_y;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 113; extern unsigned char sgx_tty_x_lhs;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 114; extern unsigned char sgx_tty_y_top;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 115; extern unsigned char sgx_tty_x;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 116; extern unsigned char sgx_tty_y;
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 118; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 119; // Functions in hucc-printf.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 120; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 122; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 124; #asmdef	HUCC_USES_STDIO 1
+HUCC_USES_STDIO = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 126; extern void __fastcall __macro putchar( unsigned char ascii<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 127; extern void __fastcall __macro sgx_putchar( unsigned char ascii<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 129; extern void __fastcall __macro puts( unsigned char *string<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 130; extern void __fastcall __macro sgx_puts( unsigned char *string<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 132; // This is HuCC/HuC's way of simulating varargs!
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 134; extern int __fastcall sprintf( unsigned char *string<_di>, unsigned char *format<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 135; extern int __fastcall sprintf( unsigned char *string<_di>, unsigned char *format<_bp>, unsigned int vararg1<__vararg1> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 136; extern int __fastcall sprintf( unsigned char *string<_di>, unsigned char *format<_bp>, unsigned int vararg1<__vararg1>, unsigned int vararg2<__vararg2> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 137; extern int __fastcall sprintf( unsigned char *string<_di>, unsigned char *format<_bp>, unsigned int vararg1<__vararg1>, unsigned int vararg2<__vararg2>, unsigned int vararg3<__vararg3> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 138; extern int __fastcall sprintf( unsigned char *string<_di>, unsigned char *format<_bp>, unsigned int vararg1<__vararg1>, unsigned int vararg2<__vararg2>, unsigned int vararg3<__vararg3>, unsigned int vararg4<__vararg4> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 140; extern int __fastcall printf( unsigned char *format<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 141; extern int __fastcall printf( unsigned char *format<_bp>, unsigned int vararg1<__vararg1> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 142; extern int __fastcall printf( unsigned char *format<_bp>, unsigned int vararg1<__vararg1>, unsigned int vararg2<__vararg2> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 143; extern int __fastcall printf( unsigned char *format<_bp>, unsigned int vararg1<__vararg1>, unsigned int vararg2<__vararg2>, unsigned int vararg3<__vararg3> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 144; extern int __fastcall printf( unsigned char *format<_bp>, unsigned int vararg1<__vararg1>, unsigned int vararg2<__vararg2>, unsigned int vararg3<__vararg3>, unsigned int vararg4<__vararg4> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 146; extern int __fastcall sgx_printf( unsigned char *format<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 147; extern int __fastcall sgx_printf( unsigned char *format<_bp>, unsigned int vararg1<__vararg1> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 148; extern int __fastcall sgx_printf( unsigned char *format<_bp>, unsigned int vararg1<__vararg1>, unsigned int vararg2<__vararg2> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 149; extern int __fastcall sgx_printf( unsigned char *format<_bp>, unsigned int vararg1<__vararg1>, unsigned int vararg2<__vararg2>, unsigned int vararg3<__vararg3> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 150; extern int __fastcall sgx_printf( unsigned char *format<_bp>, unsigned int vararg1<__vararg1>, unsigned int vararg2<__vararg2>, unsigned int vararg3<__vararg3>, unsigned int vararg4<__vararg4> );
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 152; #asm
+	.dbg	clear
+		include	"hucc-printf.asm"
+
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 154; #endasm
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 156; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/stdio.h", 158; #endif // _hucc_stdio_h
+	.dbg	line,	"tests/huc-sprintf.c", 6; int which = 0;
+	.dbg	line,	"tests/huc-sprintf.c", 8; unsigned char test[16];
+	.dbg	line,	"tests/huc-sprintf.c", 10; // These are the results that GCC gives, reduced to 16-bit int.
+	.dbg	line,	"tests/huc-sprintf.c", 11; //
+	.dbg	line,	"tests/huc-sprintf.c", 12; // HuCC's code follows GCC's basic rules, except for "%u" with a '+'.
+	.dbg	line,	"tests/huc-sprintf.c", 13; //
+	.dbg	line,	"tests/huc-sprintf.c", 14; // See https://man7.org/linux/man-pages/man3/fprintf.3.html
+	.dbg	line,	"tests/huc-sprintf.c", 15; //
+	.dbg	line,	"tests/huc-sprintf.c", 16; // If both '+' and ' ' flags are used, then '+' overrides the ' ' flag.
+	.dbg	line,	"tests/huc-sprintf.c", 17; //
+	.dbg	line,	"tests/huc-sprintf.c", 18; // "%u" is unsigned and treats '+' as ' ' (GCC just ignores the '+').
+	.dbg	line,	"tests/huc-sprintf.c", 19; //
+	.dbg	line,	"tests/huc-sprintf.c", 20; // "%x", "%X", "%c" and "%s" all ignore the '+' and ' ' flags.
+	.dbg	line,	"tests/huc-sprintf.c", 22; const unsigned char *result[] = {
+	.dbg	line,	"tests/huc-sprintf.c", 23; // Strings.
+	.dbg	line,	"tests/huc-sprintf.c", 25; "=hello=\n",		// "=hello=\n"	"=%s=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 26; "==\n",			// "==\n"	"=%.s=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 27; "=h=\n",		// "=h=\n"	"=%.*s=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 28; "=hello=\n",		// "=helo=\n"	"=%.2s%*.*co=\n"HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 30; // Simple decimal with no <width> or <precision>.
+	.dbg	line,	"tests/huc-sprintf.c", 32; "=-33=\n",		// "=-33=\n"	"=%d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 33; "=33=\n",		// "=33=\n"	"=%d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 34; "=-33=\n",		// "=-33=\n"	"=%+d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 35; "=+33=\n",		// "=+33=\n"	"=%+d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 36; "=-33=\n",		// "=-33=\n"	"=% d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 37; "= 33=\n",		// "= 33=\n"	"=% d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 38; "=-33=\n",		// "=-33=\n"	"=%+ d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 39; "=+33=\n",		// "=+33=\n"	"=% +d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 41; // Signed decimal.
+	.dbg	line,	"tests/huc-sprintf.c", 43; "= -03=\n",		// "= -03=\n"	"=%4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 44; "= +03=\n",		// "= +03=\n"	"=%+4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 45; "= +03=\n",		// "= +03=\n"	"=%+04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 46; "= -03=\n",		// "= -03=\n"	"=% 04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 47; "=  -3=\n",		// "=  -3=\n"	"=%+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 48; "=  +3=\n",		// "=  +3=\n"	"=%+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 49; "=-003=\n",		// "=-003=\n"	"=%+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 50; "=+003=\n",		// "=+003=\n"	"=%+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 51; "= 003=\n",		// "= 003=\n"	"=% 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 52; "=+003=\n",		// "=+003=\n"	"=%+ 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 53; "=+003=\n",		// "=+003=\n"	"=% +04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 54; "=0003=\n",		// "=0003=\n"	"=%04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 56; // Unsigned decimal.
+	.dbg	line,	"tests/huc-sprintf.c", 58; "=65533=\n",		// "=65533=\n"	"=%4.2u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 59; "=  03=\n",		// "=  03=\n"	"=%+4.2u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 60; "=  03=\n",		// "=  03=\n"	"=%+04.2u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 61; "=  03=\n",		// "=  03=\n"	"=% 04.2u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 62; "= 65533=\n",		// "=65533=\n"	"=%+4u=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 63; "=   3=\n",		// "=   3=\n"	"=%+4u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 64; "= 65533=\n",		// "=65533=\n"	"=%+04u=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 65; "= 003=\n",		// "=0003=\n"	"=%+04u=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 66; "= 003=\n",		// "= 003=\n"	"=% 04u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 67; "= 003=\n",		// "= 003=\n"	"=%+ 04u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 68; "= 003=\n",		// "= 003=\n"	"=% +04u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 69; "=0003=\n",		// "=0003=\n"	"=%04u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 71; // Hexadecimal.
+	.dbg	line,	"tests/huc-sprintf.c", 73; "=fffd=\n",		// "=fffd=\n"	"=%4.2x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 74; "=  03=\n",		// "=  03=\n"	"=%+4.2x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 75; "=  03=\n",		// "=  03=\n"	"=%+04.2x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 76; "=  03=\n",		// "=  03=\n"	"=% 04.2x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 77; "=fffd=\n",		// "=fffd=\n"	"=%+4x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 78; "=   3=\n",		// "=   3=\n"	"=%+4x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 79; "=FFFD=\n",		// "=FFFD=\n"	"=%+04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 80; "=0003=\n",		// "=0003=\n"	"=%+04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 81; "=0003=\n",		// "=0003=\n"	"=% 04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 82; "=0003=\n",		// "=0003=\n"	"=%+ 04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 83; "=0003=\n",		// "=0003=\n"	"=% +04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 84; "=0003=\n",		// "=0003=\n"	"=%04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 86; // Characters.
+	.dbg	line,	"tests/huc-sprintf.c", 88; "=   A=\n",		// "=   A=\n"	"=%4c=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 89; "=   A=\n",		// "=   A=\n"	"=%04c=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 90; "= AAA=\n",		// "=   A=\n"	"=%4.3c=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 92; "=   A=\n",		// "=   A=\n"	"=%+4c=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 93; "=   A=\n",		// "=   A=\n"	"=% 04c=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 94; "= AAA=\n",		// "=   A=\n"	"=%+ 4.3c=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 96; // Signed decimal left-justified.
+	.dbg	line,	"tests/huc-sprintf.c", 98; "=-03 =\n",		// "=-03 =\n"	"=%-*.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 99; "=+03 =\n",		// "=+03 =\n"	"=%-+*.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 100; "=+03 =\n",		// "=+03 =\n"	"=%-+0*.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 101; "=-03 =\n",		// "=-03 =\n"	"=%- 0*.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 102; "=-3  =\n",		// "=-3  =\n"	"=%-+*d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 103; "=+3  =\n",		// "=+3  =\n"	"=%-+*d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 104; "=-3  =\n",		// "=-3  =\n"	"=%-+0*d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 105; "=+3  =\n",		// "=+3  =\n"	"=%-+0*d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 106; "= 3  =\n",		// "= 3  =\n"	"=%- 0*d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 107; "=+3  =\n",		// "=+3  =\n"	"=%-+ 0*d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 108; "=+3  =\n",		// "=+3  =\n"	"=%- +0*d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 109; "=3   =\n",		// "=3   =\n"	"=%-0*d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 111; // Unsigned decimal left-justified.
+	.dbg	line,	"tests/huc-sprintf.c", 113; "=65533=\n",		// "=65533=\n"	"=%-4.*u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 114; "= 03 =\n",		// "=03  =\n"	"=%-+4.*u=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 115; "= 03 =\n",		// "=03  =\n"	"=%-+04.*u=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 116; "= 03 =\n",		// "= 03 =\n"	"=%- 04.*u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 117; "= 65533=\n",		// "=65533=\n"	"=%-+4u=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 118; "= 3  =\n",		// "=3   =\n"	"=%-+4u=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 119; "= 65533=\n",		// "=65533=\n"	"=%-+04u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 120; "= 3  =\n",		// "=3   =\n"	"=%-+04u=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 121; "= 3  =\n",		// "= 3  =\n"	"=%- 04u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 122; "= 3  =\n",		// "= 3  =\n"	"=%-+ 04u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 123; "= 3  =\n",		// "= 3  =\n"	"=%- +04u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 124; "=3   =\n",		// "=3   =\n"	"=%-04u=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 126; // Hexadecimal left-justified.
+	.dbg	line,	"tests/huc-sprintf.c", 128; "=fffd=\n",		// "=fffd=\n"	"=%-*.*x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 129; "=03  =\n",		// "=03  =\n"	"=%-+*.*x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 130; "=03  =\n",		// "=03  =\n"	"=%-+0*.*x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 131; "=03  =\n",		// "=03  =\n"	"=%- 0*.*x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 132; "=fffd=\n",		// "=fffd=\n"	"=%-+4x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 133; "=3   =\n",		// "=3   =\n"	"=%-+4x=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 134; "=FFFD=\n",		// "=FFFD=\n"	"=%-+04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 135; "=3   =\n",		// "=3   =\n"	"=%-+04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 136; "=3   =\n",		// "=3   =\n"	"=%- 04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 137; "=3   =\n",		// "=3   =\n"	"=%-+ 04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 138; "=3   =\n",		// "=3   =\n"	"=%- +04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 139; "=3   =\n",		// "=3   =\n"	"=%-04X=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 141; // Characters left-justifie
+	.dbg	line,	"tests/huc-sprintf.c", 143; "=A   =\n",		// "=A   =\n"	"=%-4c=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 144; "=A   =\n",		// "=A   =\n"	"=%-04c=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 145; "=AAA =\n",		// "=A   =\n"	"=%-4.3c=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 147; "=A   =\n",		// "=A   =\n"	"=%-+4c=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 148; "=A   =\n",		// "=A   =\n"	"=%- 04c=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 149; "=AAA =\n",		// "=A   =\n"	"=%-+ 4.3c=\n"	HuCC is different to GCC!
+	.dbg	line,	"tests/huc-sprintf.c", 151; // Stress test printing +/- 123 which is <width>-1 characters.
+	.dbg	line,	"tests/huc-sprintf.c", 153; "=-123=\n",		// "=-123=\n"	"=%4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 154; "=+123=\n",		// "=+123=\n"	"=%+4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 155; "=+123=\n",		// "=+123=\n"	"=%+04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 156; "=-123=\n",		// "=-123=\n"	"=% 04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 157; "=-123=\n",		// "=-123=\n"	"=%+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 158; "=+123=\n",		// "=+123=\n"	"=%+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 159; "=-123=\n",		// "=-123=\n"	"=%+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 160; "=+123=\n",		// "=+123=\n"	"=%+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 161; "= 123=\n",		// "= 123=\n"	"=% 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 162; "=+123=\n",		// "=+123=\n"	"=%+ 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 163; "=+123=\n",		// "=+123=\n"	"=% +04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 164; "=0123=\n",		// "=0123=\n"	"=%04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 166; // Stress test printing +/- 1234 which is <width> characters.
+	.dbg	line,	"tests/huc-sprintf.c", 168; "=-1234=\n",		// "=-1234=\n"	"=%4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 169; "=+1234=\n",		// "=+1234=\n"	"=%+4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 170; "=+1234=\n",		// "=+1234=\n"	"=%+04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 171; "=-1234=\n",		// "=-1234=\n"	"=% 04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 172; "=-1234=\n",		// "=-1234=\n"	"=%+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 173; "=+1234=\n",		// "=+1234=\n"	"=%+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 174; "=-1234=\n",		// "=-1234=\n"	"=%+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 175; "=+1234=\n",		// "=+1234=\n"	"=%+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 176; "= 1234=\n",		// "= 1234=\n"	"=% 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 177; "=+1234=\n",		// "=+1234=\n"	"=%+ 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 178; "=+1234=\n",		// "=+1234=\n"	"=% +04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 179; "=1234=\n",		// "=1234=\n"	"=%04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 181; // Stress test printing +/- 12345 which is <width>+1 characters.
+	.dbg	line,	"tests/huc-sprintf.c", 183; "=-12345=\n",		// "=-12345=\n"	"=%4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 184; "=+12345=\n",		// "=+12345=\n"	"=%+4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 185; "=+12345=\n",		// "=+12345=\n"	"=%+04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 186; "=-12345=\n",		// "=-12345=\n"	"=% 04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 187; "=-12345=\n",		// "=-12345=\n"	"=%+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 188; "=+12345=\n",		// "=+12345=\n"	"=%+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 189; "=-12345=\n",		// "=-12345=\n"	"=%+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 190; "=+12345=\n",		// "=+12345=\n"	"=%+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 191; "= 12345=\n",		// "= 12345=\n"	"=% 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 192; "=+12345=\n",		// "=+12345=\n"	"=%+ 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 193; "=+12345=\n",		// "=+12345=\n"	"=% +04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 194; "=12345=\n",		// "=12345=\n"	"=%04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 196; // Stress test left-justified printing +/- 123 which is <width>-1 characters.
+	.dbg	line,	"tests/huc-sprintf.c", 198; "=-123=\n",		// "=-123=\n"	"=%-4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 199; "=+123=\n",		// "=+123=\n"	"=%-+4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 200; "=+123=\n",		// "=+123=\n"	"=%-+04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 201; "=-123=\n",		// "=-123=\n"	"=%- 04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 202; "=-123=\n",		// "=-123=\n"	"=%-+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 203; "=+123=\n",		// "=+123=\n"	"=%-+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 204; "=-123=\n",		// "=-123=\n"	"=%-+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 205; "=+123=\n",		// "=+123=\n"	"=%-+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 206; "= 123=\n",		// "= 123=\n"	"=%- 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 207; "=+123=\n",		// "=+123=\n"	"=%-+ 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 208; "=+123=\n",		// "=+123=\n"	"=%- +04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 209; "=123 =\n",		// "=123 =\n"	"=%-04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 211; // Stress test left-justified printing +/- 1234 which is <width> characters.
+	.dbg	line,	"tests/huc-sprintf.c", 213; "=-1234=\n",		// "=-1234=\n"	"=%-4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 214; "=+1234=\n",		// "=+1234=\n"	"=%-+4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 215; "=+1234=\n",		// "=+1234=\n"	"=%-+04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 216; "=-1234=\n",		// "=-1234=\n"	"=%- 04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 217; "=-1234=\n",		// "=-1234=\n"	"=%-+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 218; "=+1234=\n",		// "=+1234=\n"	"=%-+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 219; "=-1234=\n",		// "=-1234=\n"	"=%-+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 220; "=+1234=\n",		// "=+1234=\n"	"=%-+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 221; "= 1234=\n",		// "= 1234=\n"	"=%- 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 222; "=+1234=\n",		// "=+1234=\n"	"=%-+ 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 223; "=+1234=\n",		// "=+1234=\n"	"=%- +04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 224; "=1234=\n",		// "=1234=\n"	"=%-04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 226; // Stress test left-justified printing +/- 12345 which is <width>+1 characters.
+	.dbg	line,	"tests/huc-sprintf.c", 228; "=-12345=\n",		// "=-12345=\n"	"=%-4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 229; "=+12345=\n",		// "=+12345=\n"	"=%-+4.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 230; "=+12345=\n",		// "=+12345=\n"	"=%-+04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 231; "=-12345=\n",		// "=-12345=\n"	"=%- 04.2d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 232; "=-12345=\n",		// "=-12345=\n"	"=%-+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 233; "=+12345=\n",		// "=+12345=\n"	"=%-+4d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 234; "=-12345=\n",		// "=-12345=\n"	"=%-+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 235; "=+12345=\n",		// "=+12345=\n"	"=%-+04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 236; "= 12345=\n",		// "= 12345=\n"	"=%- 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 237; "=+12345=\n",		// "=+12345=\n"	"=%-+ 04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 238; "=+12345=\n",		// "=+12345=\n"	"=%- +04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 239; "=12345=\n"		// "=12345=\n"	"=%-04d=\n"
+	.dbg	line,	"tests/huc-sprintf.c", 240; };
+	.dbg	line,	"tests/huc-sprintf.c", 242; //
+	.dbg	line,	"tests/huc-sprintf.c", 244; int test1()
+	.dbg	line,	"tests/huc-sprintf.c", 245; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"tests/huc-sprintf.c", 246; // Signed decimal.
+
+	.dbg	line,	"tests/huc-sprintf.c", 248; if (sprintf(test, "=%4.2d=\n", -3) != strlen(result[which])) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1408
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL3
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 249; if (strcmp(test, result[which++]) != 0) abort();
+.LL3:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL4
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 250; sprintf(test, "=%+4.2d=\n", 3);
+.LL4:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1417
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 251; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL5
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 252; sprintf(test, "=%+04.2d=\n", 3);
+.LL5:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1427
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 253; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL6
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 254; sprintf(test, "=% 04.2d=\n", -3);
+.LL6:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1438
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 255; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL7
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 256; sprintf(test, "=%+4d=\n", -3);
+.LL7:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1449
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 257; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL8
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 258; sprintf(test, "=%+4d=\n", 3);
+.LL8:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1457
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 259; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL9
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 260; sprintf(test, "=%+04d=\n", -3);
+.LL9:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1465
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 261; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL10
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 262; sprintf(test, "=%+04d=\n", 3);
+.LL10:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1474
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 263; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL11
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 264; sprintf(test, "=% 04d=\n", 3);
+.LL11:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1483
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 265; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL12
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 266; sprintf(test, "=%+ 04d=\n", 3);
+.LL12:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1492
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 267; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL13
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 268; sprintf(test, "=% +04d=\n", 3);
+.LL13:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1502
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 269; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL14
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 270; sprintf(test, "=%04d=\n", 3);
+.LL14:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1512
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 271; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL15
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 273; // Unsigned decimal.
+
+	.dbg	line,	"tests/huc-sprintf.c", 275; if (sprintf(test, "=%4.2u=\n", -3) != strlen(result[which])) abort();
+.LL15:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1520
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL16
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 276; if (strcmp(test, result[which++]) != 0) abort();
+.LL16:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL17
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 277; sprintf(test, "=%+4.2u=\n", 3);
+.LL17:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1529
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 278; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL18
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 279; sprintf(test, "=%+04.2u=\n", 3);
+.LL18:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1539
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 280; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL19
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 281; sprintf(test, "=% 04.2u=\n", 3);
+.LL19:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1550
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 282; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL20
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 283; sprintf(test, "=%+4u=\n", -3);
+.LL20:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1561
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 284; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL21
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 285; sprintf(test, "=%+4u=\n", 3);
+.LL21:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1569
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 286; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL22
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 287; sprintf(test, "=%+04u=\n", -3);
+.LL22:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1577
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 288; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL23
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 289; sprintf(test, "=%+04u=\n", 3);
+.LL23:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1586
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 290; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL24
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 291; sprintf(test, "=% 04u=\n", 3);
+.LL24:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1595
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 292; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL25
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 293; sprintf(test, "=%+ 04u=\n", 3);
+.LL25:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1604
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 294; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL26
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 295; sprintf(test, "=% +04u=\n", 3);
+.LL26:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1614
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 296; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL27
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 297; sprintf(test, "=%04u=\n", 3);
+.LL27:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1624
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 298; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL28
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 300; // Hexadecimal.
+
+	.dbg	line,	"tests/huc-sprintf.c", 302; if (sprintf(test, "=%4.2x=\n", -3) != strlen(result[which])) abort();
+.LL28:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1632
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL29
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 303; if (strcmp(test, result[which++]) != 0) abort();
+.LL29:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL30
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 304; sprintf(test, "=%+4.2x=\n", 3);
+.LL30:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1641
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 305; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL31
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 306; sprintf(test, "=%+04.2x=\n", 3);
+.LL31:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1651
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 307; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL32
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 308; sprintf(test, "=% 04.2x=\n", 3);
+.LL32:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1662
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 309; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL33
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 310; sprintf(test, "=%+4x=\n", -3);
+.LL33:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1673
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 311; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL34
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 312; sprintf(test, "=%+4x=\n", 3);
+.LL34:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1681
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 313; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL35
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 314; sprintf(test, "=%+04X=\n", -3);
+.LL35:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1689
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 315; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL36
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 316; sprintf(test, "=%+04X=\n", 3);
+.LL36:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1698
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 317; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL37
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 318; sprintf(test, "=% 04X=\n", 3);
+.LL37:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1707
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 319; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL38
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 320; sprintf(test, "=%+ 04X=\n", 3);
+.LL38:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1716
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 321; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL39
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 322; sprintf(test, "=% +04X=\n", 3);
+.LL39:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1726
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 323; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL40
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 324; sprintf(test, "=%04X=\n", 3);
+.LL40:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1736
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 325; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL41
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 327; // Characters.
+
+	.dbg	line,	"tests/huc-sprintf.c", 329; if (sprintf(test, "=%4c=\n", 'A') != strlen(result[which])) abort();
+.LL41:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1744
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL42
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 330; if (strcmp(test, result[which++]) != 0) abort();
+.LL42:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL43
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 331; sprintf(test, "=%04c=\n", 'A');
+.LL43:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1751
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 332; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL44
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 333; sprintf(test, "=%4.3c=\n", 'A');
+.LL44:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1759
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 334; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL45
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 336; if (sprintf(test, "=%+4c=\n", 'A') != strlen(result[which])) abort();
+.LL45:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1768
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL46
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 337; if (strcmp(test, result[which++]) != 0) abort();
+.LL46:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL47
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 338; sprintf(test, "=% 04c=\n", 'A');
+.LL47:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1776
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 339; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL48
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 340; sprintf(test, "=%+ 4.3c=\n", 'A');
+.LL48:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1785
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 341; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL49
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 343; // Do more tests.
+
+	.dbg	line,	"tests/huc-sprintf.c", 345; return 0;
+.LL49:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-sprintf.c", 346; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-sprintf.c", 348; //
+	.dbg	line,	"tests/huc-sprintf.c", 350; int test2()
+	.dbg	line,	"tests/huc-sprintf.c", 351; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"tests/huc-sprintf.c", 352; // Signed decimal left-justified.
+
+	.dbg	line,	"tests/huc-sprintf.c", 354; if (sprintf(test, "=%-*.2d=\n", 4, -3) != strlen(result[which])) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1796
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	-3, __vararg2
+	__call		_sprintf.4
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL51
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 355; if (strcmp(test, result[which++]) != 0) abort();
+.LL51:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL52
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 356; sprintf(test, "=%-+*.2d=\n", 4, 3);
+.LL52:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1806
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 357; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL53
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 358; sprintf(test, "=%-+0*.2d=\n", 4, 3);
+.LL53:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1817
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 359; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL54
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 360; sprintf(test, "=%- 0*.2d=\n", 4, -3);
+.LL54:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1829
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	-3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 361; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL55
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 362; sprintf(test, "=%-+*d=\n", 4, -3);
+.LL55:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1841
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	-3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 363; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL56
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 364; sprintf(test, "=%-+*d=\n", 4, 3);
+.LL56:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1850
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 365; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL57
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 366; sprintf(test, "=%-+0*d=\n", 4, -3);
+.LL57:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1859
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	-3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 367; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL58
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 368; sprintf(test, "=%-+0*d=\n", 4, 3);
+.LL58:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1869
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 369; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL59
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 370; sprintf(test, "=%- 0*d=\n", 4, 3);
+.LL59:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1879
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 371; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL60
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 372; sprintf(test, "=%-+ 0*d=\n", 4, 3);
+.LL60:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1889
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 373; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL61
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 374; sprintf(test, "=%- +0*d=\n", 4, 3);
+.LL61:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1900
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 375; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL62
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 376; sprintf(test, "=%-0*d=\n", 4, 3);
+.LL62:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1911
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 377; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL63
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 379; // Unsigned decimal left-justified.
+
+	.dbg	line,	"tests/huc-sprintf.c", 381; if (sprintf(test, "=%-4.*u=\n", 2, -3) != strlen(result[which])) abort();
+.LL63:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1920
+	__st.wmq	_bp
+	__st.wmiq	2, __vararg1
+	__st.wmiq	-3, __vararg2
+	__call		_sprintf.4
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL64
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 382; if (strcmp(test, result[which++]) != 0) abort();
+.LL64:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL65
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 383; sprintf(test, "=%-+4.*u=\n", 2, 3);
+.LL65:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1930
+	__st.wmq	_bp
+	__st.wmiq	2, __vararg1
+	__st.wmiq	3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 384; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL66
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 385; sprintf(test, "=%-+04.*u=\n", 2, 3);
+.LL66:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1941
+	__st.wmq	_bp
+	__st.wmiq	2, __vararg1
+	__st.wmiq	3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 386; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL67
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 387; sprintf(test, "=%- 04.*u=\n", 2, 3);
+.LL67:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1953
+	__st.wmq	_bp
+	__st.wmiq	2, __vararg1
+	__st.wmiq	3, __vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 388; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL68
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 389; sprintf(test, "=%-+4u=\n", -3);
+.LL68:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1965
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 390; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL69
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 391; sprintf(test, "=%-+4u=\n", 3);
+.LL69:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1974
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 392; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL70
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 393; sprintf(test, "=%-+04u=\n", -3);
+.LL70:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1983
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 394; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL71
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 395; sprintf(test, "=%-+04u=\n", 3);
+.LL71:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+1993
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 396; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL72
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 397; sprintf(test, "=%- 04u=\n", 3);
+.LL72:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2003
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 398; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL73
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 399; sprintf(test, "=%-+ 04u=\n", 3);
+.LL73:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2013
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 400; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL74
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 401; sprintf(test, "=%- +04u=\n", 3);
+.LL74:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2024
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 402; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL75
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 403; sprintf(test, "=%-04u=\n", 3);
+.LL75:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2035
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 404; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL76
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 406; // Hexadecimal left-justified.
+
+	.dbg	line,	"tests/huc-sprintf.c", 408; if (sprintf(test, "=%-*.*x=\n", 4, 2, -3) != strlen(result[which])) abort();
+.LL76:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2044
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	2, __vararg2
+	__st.wmiq	-3, __vararg3
+	__call		_sprintf.5
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL77
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 409; if (strcmp(test, result[which++]) != 0) abort();
+.LL77:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL78
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 410; sprintf(test, "=%-+*.*x=\n", 4, 2, 3);
+.LL78:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2054
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	2, __vararg2
+	__st.wmiq	3, __vararg3
+	__call		_sprintf.5
+
+	.dbg	line,	"tests/huc-sprintf.c", 411; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL79
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 412; sprintf(test, "=%-+0*.*x=\n", 4, 2, 3);
+.LL79:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2065
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	2, __vararg2
+	__st.wmiq	3, __vararg3
+	__call		_sprintf.5
+
+	.dbg	line,	"tests/huc-sprintf.c", 413; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL80
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 414; sprintf(test, "=%- 0*.*x=\n", 4, 2, 3);
+.LL80:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2077
+	__st.wmq	_bp
+	__st.wmiq	4, __vararg1
+	__st.wmiq	2, __vararg2
+	__st.wmiq	3, __vararg3
+	__call		_sprintf.5
+
+	.dbg	line,	"tests/huc-sprintf.c", 415; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL81
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 416; sprintf(test, "=%-+4x=\n", -3);
+.LL81:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2089
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 417; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL82
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 418; sprintf(test, "=%-+4x=\n", 3);
+.LL82:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2098
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 419; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL83
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 420; sprintf(test, "=%-+04X=\n", -3);
+.LL83:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2107
+	__st.wmq	_bp
+	__st.wmiq	-3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 421; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL84
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 422; sprintf(test, "=%-+04X=\n", 3);
+.LL84:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2117
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 423; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL85
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 424; sprintf(test, "=%- 04X=\n", 3);
+.LL85:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2127
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 425; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL86
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 426; sprintf(test, "=%-+ 04X=\n", 3);
+.LL86:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2137
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 427; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL87
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 428; sprintf(test, "=%- +04X=\n", 3);
+.LL87:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2148
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 429; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL88
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 430; sprintf(test, "=%-04X=\n", 3);
+.LL88:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2159
+	__st.wmq	_bp
+	__st.wmiq	3, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 431; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL89
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 433; // Characters left-justified.
+
+	.dbg	line,	"tests/huc-sprintf.c", 435; if (sprintf(test, "=%-4c=\n", 'A') != strlen(result[which])) abort();
+.LL89:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2168
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL90
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 436; if (strcmp(test, result[which++]) != 0) abort();
+.LL90:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL91
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 437; sprintf(test, "=%-04c=\n", 'A');
+.LL91:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2176
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 438; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL92
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 439; sprintf(test, "=%-4.3c=\n", 'A');
+.LL92:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2185
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 440; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL93
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 442; if (sprintf(test, "=%-+4c=\n", 'A') != strlen(result[which])) abort();
+.LL93:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2195
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL94
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 443; if (strcmp(test, result[which++]) != 0) abort();
+.LL94:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL95
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 444; sprintf(test, "=%- 04c=\n", 'A');
+.LL95:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2204
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 445; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL96
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 446; sprintf(test, "=%-+ 4.3c=\n", 'A');
+.LL96:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2214
+	__st.wmq	_bp
+	__st.wmiq	65, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 447; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL97
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 449; // Do more tests.
+
+	.dbg	line,	"tests/huc-sprintf.c", 451; return 0;
+.LL97:
+	__ld.wi		0
+.LL50:
+
+	.dbg	line,	"tests/huc-sprintf.c", 452; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-sprintf.c", 454; //
+	.dbg	line,	"tests/huc-sprintf.c", 456; int stress_width1()
+	.dbg	line,	"tests/huc-sprintf.c", 457; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_stress_width1
+	__enter		_stress_width1
+
+	.dbg	line,	"tests/huc-sprintf.c", 458; // Stress test printing +/- 123 which is <width>-1 characters.
+
+	.dbg	line,	"tests/huc-sprintf.c", 460; if (sprintf(test, "=%4.2d=\n", -123) != strlen(result[which])) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2226
+	__st.wmq	_bp
+	__st.wmiq	-123, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL99
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 461; if (strcmp(test, result[which++]) != 0) abort();
+.LL99:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL100
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 462; sprintf(test, "=%+4.2d=\n", 123);
+.LL100:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2235
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 463; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL101
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 464; sprintf(test, "=%+04.2d=\n", 123);
+.LL101:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2245
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 465; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL102
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 466; sprintf(test, "=% 04.2d=\n", -123);
+.LL102:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2256
+	__st.wmq	_bp
+	__st.wmiq	-123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 467; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL103
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 468; sprintf(test, "=%+4d=\n", -123);
+.LL103:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2267
+	__st.wmq	_bp
+	__st.wmiq	-123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 469; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL104
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 470; sprintf(test, "=%+4d=\n", 123);
+.LL104:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2275
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 471; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL105
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 472; sprintf(test, "=%+04d=\n", -123);
+.LL105:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2283
+	__st.wmq	_bp
+	__st.wmiq	-123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 473; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL106
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 474; sprintf(test, "=%+04d=\n", 123);
+.LL106:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2292
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 475; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL107
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 476; sprintf(test, "=% 04d=\n", 123);
+.LL107:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2301
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 477; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL108
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 478; sprintf(test, "=%+ 04d=\n", 123);
+.LL108:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2310
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 479; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL109
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 480; sprintf(test, "=% +04d=\n", 123);
+.LL109:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2320
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 481; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL110
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 482; sprintf(test, "=%04d=\n", 123);
+.LL110:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2330
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 483; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL111
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 485; // Stress test printing +/- 1234 which is <width> characters.
+
+	.dbg	line,	"tests/huc-sprintf.c", 487; if (sprintf(test, "=%4.2d=\n", -1234) != strlen(result[which])) abort();
+.LL111:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2338
+	__st.wmq	_bp
+	__st.wmiq	-1234, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL112
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 488; if (strcmp(test, result[which++]) != 0) abort();
+.LL112:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL113
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 489; sprintf(test, "=%+4.2d=\n", 1234);
+.LL113:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2347
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 490; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL114
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 491; sprintf(test, "=%+04.2d=\n", 1234);
+.LL114:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2357
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 492; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL115
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 493; sprintf(test, "=% 04.2d=\n", -1234);
+.LL115:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2368
+	__st.wmq	_bp
+	__st.wmiq	-1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 494; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL116
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 495; sprintf(test, "=%+4d=\n", -1234);
+.LL116:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2379
+	__st.wmq	_bp
+	__st.wmiq	-1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 496; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL117
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 497; sprintf(test, "=%+4d=\n", 1234);
+.LL117:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2387
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 498; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL118
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 499; sprintf(test, "=%+04d=\n", -1234);
+.LL118:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2395
+	__st.wmq	_bp
+	__st.wmiq	-1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 500; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL119
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 501; sprintf(test, "=%+04d=\n", 1234);
+.LL119:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2404
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 502; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL120
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 503; sprintf(test, "=% 04d=\n", 1234);
+.LL120:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2413
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 504; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL121
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 505; sprintf(test, "=%+ 04d=\n", 1234);
+.LL121:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2422
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 506; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL122
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 507; sprintf(test, "=% +04d=\n", 1234);
+.LL122:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2432
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 508; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL123
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 509; sprintf(test, "=%04d=\n", 1234);
+.LL123:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2442
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 510; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL124
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 512; // Stress test printing +/- 12345 which is <width>+1 characters.
+
+	.dbg	line,	"tests/huc-sprintf.c", 514; if (sprintf(test, "=%4.2d=\n", -12345) != strlen(result[which])) abort();
+.LL124:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2450
+	__st.wmq	_bp
+	__st.wmiq	-12345, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL125
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 515; if (strcmp(test, result[which++]) != 0) abort();
+.LL125:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL126
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 516; sprintf(test, "=%+4.2d=\n", 12345);
+.LL126:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2459
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 517; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL127
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 518; sprintf(test, "=%+04.2d=\n", 12345);
+.LL127:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2469
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 519; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL128
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 520; sprintf(test, "=% 04.2d=\n", -12345);
+.LL128:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2480
+	__st.wmq	_bp
+	__st.wmiq	-12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 521; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL129
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 522; sprintf(test, "=%+4d=\n", -12345);
+.LL129:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2491
+	__st.wmq	_bp
+	__st.wmiq	-12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 523; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL130
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 524; sprintf(test, "=%+4d=\n", 12345);
+.LL130:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2499
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 525; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL131
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 526; sprintf(test, "=%+04d=\n", -12345);
+.LL131:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2507
+	__st.wmq	_bp
+	__st.wmiq	-12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 527; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL132
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 528; sprintf(test, "=%+04d=\n", 12345);
+.LL132:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2516
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 529; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL133
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 530; sprintf(test, "=% 04d=\n", 12345);
+.LL133:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2525
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 531; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL134
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 532; sprintf(test, "=%+ 04d=\n", 12345);
+.LL134:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2534
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 533; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL135
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 534; sprintf(test, "=% +04d=\n", 12345);
+.LL135:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2544
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 535; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL136
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 536; sprintf(test, "=%04d=\n", 12345);
+.LL136:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2554
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 537; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL137
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 539; return 0;
+.LL137:
+	__ld.wi		0
+.LL98:
+
+	.dbg	line,	"tests/huc-sprintf.c", 540; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-sprintf.c", 542; //
+	.dbg	line,	"tests/huc-sprintf.c", 544; int stress_width2()
+	.dbg	line,	"tests/huc-sprintf.c", 545; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_stress_width2
+	__enter		_stress_width2
+
+	.dbg	line,	"tests/huc-sprintf.c", 546; // Stress test left-justified printing +/- 123 which is <width>-1 characters.
+
+	.dbg	line,	"tests/huc-sprintf.c", 548; if (sprintf(test, "=%-4.2d=\n", -123) != strlen(result[which])) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2562
+	__st.wmq	_bp
+	__st.wmiq	-123, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL139
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 549; if (strcmp(test, result[which++]) != 0) abort();
+.LL139:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL140
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 550; sprintf(test, "=%-+4.2d=\n", 123);
+.LL140:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2572
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 551; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL141
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 552; sprintf(test, "=%-+04.2d=\n", 123);
+.LL141:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2583
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 553; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL142
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 554; sprintf(test, "=%- 04.2d=\n", -123);
+.LL142:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2595
+	__st.wmq	_bp
+	__st.wmiq	-123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 555; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL143
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 556; sprintf(test, "=%-+4d=\n", -123);
+.LL143:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2607
+	__st.wmq	_bp
+	__st.wmiq	-123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 557; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL144
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 558; sprintf(test, "=%-+4d=\n", 123);
+.LL144:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2616
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 559; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL145
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 560; sprintf(test, "=%-+04d=\n", -123);
+.LL145:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2625
+	__st.wmq	_bp
+	__st.wmiq	-123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 561; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL146
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 562; sprintf(test, "=%-+04d=\n", 123);
+.LL146:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2635
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 563; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL147
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 564; sprintf(test, "=%- 04d=\n", 123);
+.LL147:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2645
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 565; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL148
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 566; sprintf(test, "=%-+ 04d=\n", 123);
+.LL148:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2655
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 567; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL149
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 568; sprintf(test, "=%- +04d=\n", 123);
+.LL149:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2666
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 569; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL150
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 570; sprintf(test, "=%-04d=\n", 123);
+.LL150:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2677
+	__st.wmq	_bp
+	__st.wmiq	123, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 571; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL151
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 573; // Stress test left-justified printing +/- 1234 which is <width> characters.
+
+	.dbg	line,	"tests/huc-sprintf.c", 575; if (sprintf(test, "=%-4.2d=\n", -1234) != strlen(result[which])) abort();
+.LL151:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2686
+	__st.wmq	_bp
+	__st.wmiq	-1234, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL152
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 576; if (strcmp(test, result[which++]) != 0) abort();
+.LL152:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL153
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 577; sprintf(test, "=%-+4.2d=\n", 1234);
+.LL153:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2696
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 578; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL154
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 579; sprintf(test, "=%-+04.2d=\n", 1234);
+.LL154:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2707
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 580; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL155
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 581; sprintf(test, "=%- 04.2d=\n", -1234);
+.LL155:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2719
+	__st.wmq	_bp
+	__st.wmiq	-1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 582; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL156
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 583; sprintf(test, "=%-+4d=\n", -1234);
+.LL156:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2731
+	__st.wmq	_bp
+	__st.wmiq	-1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 584; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL157
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 585; sprintf(test, "=%-+4d=\n", 1234);
+.LL157:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2740
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 586; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL158
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 587; sprintf(test, "=%-+04d=\n", -1234);
+.LL158:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2749
+	__st.wmq	_bp
+	__st.wmiq	-1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 588; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL159
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 589; sprintf(test, "=%-+04d=\n", 1234);
+.LL159:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2759
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 590; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL160
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 591; sprintf(test, "=%- 04d=\n", 1234);
+.LL160:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2769
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 592; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL161
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 593; sprintf(test, "=%-+ 04d=\n", 1234);
+.LL161:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2779
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 594; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL162
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 595; sprintf(test, "=%- +04d=\n", 1234);
+.LL162:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2790
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 596; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL163
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 597; sprintf(test, "=%-04d=\n", 1234);
+.LL163:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2801
+	__st.wmq	_bp
+	__st.wmiq	1234, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 598; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL164
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 600; // Stress test left-justified printing +/- 12345 which is <width>+1 characters.
+
+	.dbg	line,	"tests/huc-sprintf.c", 602; if (sprintf(test, "=%-4.2d=\n", -12345) != strlen(result[which])) abort();
+.LL164:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2810
+	__st.wmq	_bp
+	__st.wmiq	-12345, __vararg1
+	__call		_sprintf.3
+	__push.wr
+	__ld.wm		_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strlen.1
+	__neq_w.wt
+	__bfalse	.LL165
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 603; if (strcmp(test, result[which++]) != 0) abort();
+.LL165:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL166
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 604; sprintf(test, "=%-+4.2d=\n", 12345);
+.LL166:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2820
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 605; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL167
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 606; sprintf(test, "=%-+04.2d=\n", 12345);
+.LL167:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2831
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 607; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL168
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 608; sprintf(test, "=%- 04.2d=\n", -12345);
+.LL168:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2843
+	__st.wmq	_bp
+	__st.wmiq	-12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 609; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL169
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 610; sprintf(test, "=%-+4d=\n", -12345);
+.LL169:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2855
+	__st.wmq	_bp
+	__st.wmiq	-12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 611; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL170
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 612; sprintf(test, "=%-+4d=\n", 12345);
+.LL170:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2864
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 613; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL171
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 614; sprintf(test, "=%-+04d=\n", -12345);
+.LL171:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2873
+	__st.wmq	_bp
+	__st.wmiq	-12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 615; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL172
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 616; sprintf(test, "=%-+04d=\n", 12345);
+.LL172:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2883
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 617; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL173
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 618; sprintf(test, "=%- 04d=\n", 12345);
+.LL173:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2893
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 619; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL174
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 620; sprintf(test, "=%-+ 04d=\n", 12345);
+.LL174:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2903
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 621; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL175
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 622; sprintf(test, "=%- +04d=\n", 12345);
+.LL175:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2914
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 623; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL176
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 624; sprintf(test, "=%-04d=\n", 12345);
+.LL176:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2925
+	__st.wmq	_bp
+	__st.wmiq	12345, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 625; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL177
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 627; return 0;
+.LL177:
+	__ld.wi		0
+.LL138:
+
+	.dbg	line,	"tests/huc-sprintf.c", 628; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-sprintf.c", 630; //
+	.dbg	line,	"tests/huc-sprintf.c", 632; int main()
+	.dbg	line,	"tests/huc-sprintf.c", 633; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-sprintf.c", 634; // Strings.
+
+	.dbg	line,	"tests/huc-sprintf.c", 636; sprintf(test, "=%s=\n", "hello");
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2934
+	__st.wmq	_bp
+	__ld.wi		__const1+2940
+	__st.wmq	__vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 637; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL179
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 638; sprintf(test, "=%.s=\n", "hello");
+.LL179:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2946
+	__st.wmq	_bp
+	__ld.wi		__const1+2953
+	__st.wmq	__vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 639; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL180
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 640; sprintf(test, "=%.*s=\n", 1, "hello");
+.LL180:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2959
+	__st.wmq	_bp
+	__st.wmiq	1, __vararg1
+	__ld.wi		__const1+2967
+	__st.wmq	__vararg2
+	__call		_sprintf.4
+
+	.dbg	line,	"tests/huc-sprintf.c", 641; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL181
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 642; sprintf(test, "=%.2s%*.*co=\n", "hello", 0, 2, 'l');
+.LL181:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2973
+	__st.wmq	_bp
+	__ld.wi		__const1+2987
+	__st.wmq	__vararg1
+	__st.wmiq	0, __vararg2
+	__st.wmiq	2, __vararg3
+	__st.wmiq	108, __vararg4
+	__call		_sprintf.6
+
+	.dbg	line,	"tests/huc-sprintf.c", 643; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL182
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 645; // Simple decimal with no <width> or <precision>.
+
+	.dbg	line,	"tests/huc-sprintf.c", 647; sprintf(test, "=%d=\n", -33);
+.LL182:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2993
+	__st.wmq	_bp
+	__st.wmiq	-33, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 648; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL183
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 649; sprintf(test, "=%d=\n",  33);
+.LL183:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+2999
+	__st.wmq	_bp
+	__st.wmiq	33, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 650; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL184
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 651; sprintf(test, "=%+d=\n", -33);
+.LL184:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+3005
+	__st.wmq	_bp
+	__st.wmiq	-33, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 652; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL185
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 653; sprintf(test, "=%+d=\n",  33);
+.LL185:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+3012
+	__st.wmq	_bp
+	__st.wmiq	33, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 654; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL186
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 655; sprintf(test, "=% d=\n", -33);
+.LL186:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+3019
+	__st.wmq	_bp
+	__st.wmiq	-33, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 656; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL187
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 657; sprintf(test, "=% d=\n",  33);
+.LL187:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+3026
+	__st.wmq	_bp
+	__st.wmiq	33, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 658; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL188
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 659; sprintf(test, "=%+ d=\n", -33);
+.LL188:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+3033
+	__st.wmq	_bp
+	__st.wmiq	-33, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 660; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL189
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 661; sprintf(test, "=% +d=\n",  33);
+.LL189:
+	__ld.wi		_test
+	__st.wmq	_di
+	__ld.wi		__const1+3041
+	__st.wmq	_bp
+	__st.wmiq	33, __vararg1
+	__call		_sprintf.3
+
+	.dbg	line,	"tests/huc-sprintf.c", 662; if (strcmp(test, result[which++]) != 0) abort();
+	__ld.wi		_test
+	__st.wmq	_di
+	__ldinc.wm	_which
+	__asl.wr
+	__add.wi	_result
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	_bp
+	__call		_strcmp.2
+	__tst.wr
+	__bfalse	.LL190
+	__call		_abort
+
+	.dbg	line,	"tests/huc-sprintf.c", 664; // Numbers with <width> and/or <precision>.
+
+	.dbg	line,	"tests/huc-sprintf.c", 666; test1();
+.LL190:
+	__call		_test1
+
+	.dbg	line,	"tests/huc-sprintf.c", 668; // Left-justified numbers with <width> and/or <precision>.
+
+	.dbg	line,	"tests/huc-sprintf.c", 670; test2();
+	__call		_test2
+
+	.dbg	line,	"tests/huc-sprintf.c", 672; // Stress handling numbers that approach <width>.
+
+	.dbg	line,	"tests/huc-sprintf.c", 674; stress_width1();
+	__call		_stress_width1
+
+	.dbg	line,	"tests/huc-sprintf.c", 676; // Stress handling left-justified numbers that approach <width>.
+
+	.dbg	line,	"tests/huc-sprintf.c", 678; stress_width2();
+	__call		_stress_width2
+
+	.dbg	line,	"tests/huc-sprintf.c", 680; // Do more tests.
+
+	.dbg	line,	"tests/huc-sprintf.c", 682; return 0;
+	__ld.wi		0
+.LL178:
+
+	.dbg	line,	"tests/huc-sprintf.c", 683; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-sprintf.c", 685; #else
+	.dbg	line,	"tests/huc-sprintf.c", 687; /* HuC does not support sprintf() */
+	.dbg	line,	"tests/huc-sprintf.c", 688; int main()
+	.dbg	line,	"tests/huc-sprintf.c", 689; {
+	.dbg	line,	"tests/huc-sprintf.c", 690; return 0;
+	.dbg	line,	"tests/huc-sprintf.c", 691; }
+	.dbg	line,	"tests/huc-sprintf.c", 693; #endif
+	.dbg	clear
+	.rodata
+__const1:
+		db	'=','h','e','l','l','o','=',$0A
+		db	$00,'=','=',$0A,$00,'=','h','='
+		db	$0A,$00,'=','h','e','l','l','o'
+		db	'=',$0A,$00,'=','-','3','3','='
+		db	$0A,$00,'=','3','3','=',$0A,$00
+		db	'=','-','3','3','=',$0A,$00,'='
+		db	'+','3','3','=',$0A,$00,'=','-'
+		db	'3','3','=',$0A,$00,'=',' ','3'
+		db	'3','=',$0A,$00,'=','-','3','3'
+		db	'=',$0A,$00,'=','+','3','3','='
+		db	$0A,$00,'=',' ','-','0','3','='
+		db	$0A,$00,'=',' ','+','0','3','='
+		db	$0A,$00,'=',' ','+','0','3','='
+		db	$0A,$00,'=',' ','-','0','3','='
+		db	$0A,$00,'=',' ',' ','-','3','='
+		db	$0A,$00,'=',' ',' ','+','3','='
+		db	$0A,$00,'=','-','0','0','3','='
+		db	$0A,$00,'=','+','0','0','3','='
+		db	$0A,$00,'=',' ','0','0','3','='
+		db	$0A,$00,'=','+','0','0','3','='
+		db	$0A,$00,'=','+','0','0','3','='
+		db	$0A,$00,'=','0','0','0','3','='
+		db	$0A,$00,'=','6','5','5','3','3'
+		db	'=',$0A,$00,'=',' ',' ','0','3'
+		db	'=',$0A,$00,'=',' ',' ','0','3'
+		db	'=',$0A,$00,'=',' ',' ','0','3'
+		db	'=',$0A,$00,'=',' ','6','5','5'
+		db	'3','3','=',$0A,$00,'=',' ',' '
+		db	' ','3','=',$0A,$00,'=',' ','6'
+		db	'5','5','3','3','=',$0A,$00,'='
+		db	' ','0','0','3','=',$0A,$00,'='
+		db	' ','0','0','3','=',$0A,$00,'='
+		db	' ','0','0','3','=',$0A,$00,'='
+		db	' ','0','0','3','=',$0A,$00,'='
+		db	'0','0','0','3','=',$0A,$00,'='
+		db	'f','f','f','d','=',$0A,$00,'='
+		db	' ',' ','0','3','=',$0A,$00,'='
+		db	' ',' ','0','3','=',$0A,$00,'='
+		db	' ',' ','0','3','=',$0A,$00,'='
+		db	'f','f','f','d','=',$0A,$00,'='
+		db	' ',' ',' ','3','=',$0A,$00,'='
+		db	'F','F','F','D','=',$0A,$00,'='
+		db	'0','0','0','3','=',$0A,$00,'='
+		db	'0','0','0','3','=',$0A,$00,'='
+		db	'0','0','0','3','=',$0A,$00,'='
+		db	'0','0','0','3','=',$0A,$00,'='
+		db	'0','0','0','3','=',$0A,$00,'='
+		db	' ',' ',' ','A','=',$0A,$00,'='
+		db	' ',' ',' ','A','=',$0A,$00,'='
+		db	' ','A','A','A','=',$0A,$00,'='
+		db	' ',' ',' ','A','=',$0A,$00,'='
+		db	' ',' ',' ','A','=',$0A,$00,'='
+		db	' ','A','A','A','=',$0A,$00,'='
+		db	'-','0','3',' ','=',$0A,$00,'='
+		db	'+','0','3',' ','=',$0A,$00,'='
+		db	'+','0','3',' ','=',$0A,$00,'='
+		db	'-','0','3',' ','=',$0A,$00,'='
+		db	'-','3',' ',' ','=',$0A,$00,'='
+		db	'+','3',' ',' ','=',$0A,$00,'='
+		db	'-','3',' ',' ','=',$0A,$00,'='
+		db	'+','3',' ',' ','=',$0A,$00,'='
+		db	' ','3',' ',' ','=',$0A,$00,'='
+		db	'+','3',' ',' ','=',$0A,$00,'='
+		db	'+','3',' ',' ','=',$0A,$00,'='
+		db	'3',' ',' ',' ','=',$0A,$00,'='
+		db	'6','5','5','3','3','=',$0A,$00
+		db	'=',' ','0','3',' ','=',$0A,$00
+		db	'=',' ','0','3',' ','=',$0A,$00
+		db	'=',' ','0','3',' ','=',$0A,$00
+		db	'=',' ','6','5','5','3','3','='
+		db	$0A,$00,'=',' ','3',' ',' ','='
+		db	$0A,$00,'=',' ','6','5','5','3'
+		db	'3','=',$0A,$00,'=',' ','3',' '
+		db	' ','=',$0A,$00,'=',' ','3',' '
+		db	' ','=',$0A,$00,'=',' ','3',' '
+		db	' ','=',$0A,$00,'=',' ','3',' '
+		db	' ','=',$0A,$00,'=','3',' ',' '
+		db	' ','=',$0A,$00,'=','f','f','f'
+		db	'd','=',$0A,$00,'=','0','3',' '
+		db	' ','=',$0A,$00,'=','0','3',' '
+		db	' ','=',$0A,$00,'=','0','3',' '
+		db	' ','=',$0A,$00,'=','f','f','f'
+		db	'd','=',$0A,$00,'=','3',' ',' '
+		db	' ','=',$0A,$00,'=','F','F','F'
+		db	'D','=',$0A,$00,'=','3',' ',' '
+		db	' ','=',$0A,$00,'=','3',' ',' '
+		db	' ','=',$0A,$00,'=','3',' ',' '
+		db	' ','=',$0A,$00,'=','3',' ',' '
+		db	' ','=',$0A,$00,'=','3',' ',' '
+		db	' ','=',$0A,$00,'=','A',' ',' '
+		db	' ','=',$0A,$00,'=','A',' ',' '
+		db	' ','=',$0A,$00,'=','A','A','A'
+		db	' ','=',$0A,$00,'=','A',' ',' '
+		db	' ','=',$0A,$00,'=','A',' ',' '
+		db	' ','=',$0A,$00,'=','A','A','A'
+		db	' ','=',$0A,$00,'=','-','1','2'
+		db	'3','=',$0A,$00,'=','+','1','2'
+		db	'3','=',$0A,$00,'=','+','1','2'
+		db	'3','=',$0A,$00,'=','-','1','2'
+		db	'3','=',$0A,$00,'=','-','1','2'
+		db	'3','=',$0A,$00,'=','+','1','2'
+		db	'3','=',$0A,$00,'=','-','1','2'
+		db	'3','=',$0A,$00,'=','+','1','2'
+		db	'3','=',$0A,$00,'=',' ','1','2'
+		db	'3','=',$0A,$00,'=','+','1','2'
+		db	'3','=',$0A,$00,'=','+','1','2'
+		db	'3','=',$0A,$00,'=','0','1','2'
+		db	'3','=',$0A,$00,'=','-','1','2'
+		db	'3','4','=',$0A,$00,'=','+','1'
+		db	'2','3','4','=',$0A,$00,'=','+'
+		db	'1','2','3','4','=',$0A,$00,'='
+		db	'-','1','2','3','4','=',$0A,$00
+		db	'=','-','1','2','3','4','=',$0A
+		db	$00,'=','+','1','2','3','4','='
+		db	$0A,$00,'=','-','1','2','3','4'
+		db	'=',$0A,$00,'=','+','1','2','3'
+		db	'4','=',$0A,$00,'=',' ','1','2'
+		db	'3','4','=',$0A,$00,'=','+','1'
+		db	'2','3','4','=',$0A,$00,'=','+'
+		db	'1','2','3','4','=',$0A,$00,'='
+		db	'1','2','3','4','=',$0A,$00,'='
+		db	'-','1','2','3','4','5','=',$0A
+		db	$00,'=','+','1','2','3','4','5'
+		db	'=',$0A,$00,'=','+','1','2','3'
+		db	'4','5','=',$0A,$00,'=','-','1'
+		db	'2','3','4','5','=',$0A,$00,'='
+		db	'-','1','2','3','4','5','=',$0A
+		db	$00,'=','+','1','2','3','4','5'
+		db	'=',$0A,$00,'=','-','1','2','3'
+		db	'4','5','=',$0A,$00,'=','+','1'
+		db	'2','3','4','5','=',$0A,$00,'='
+		db	' ','1','2','3','4','5','=',$0A
+		db	$00,'=','+','1','2','3','4','5'
+		db	'=',$0A,$00,'=','+','1','2','3'
+		db	'4','5','=',$0A,$00,'=','1','2'
+		db	'3','4','5','=',$0A,$00,'=','-'
+		db	'1','2','3','=',$0A,$00,'=','+'
+		db	'1','2','3','=',$0A,$00,'=','+'
+		db	'1','2','3','=',$0A,$00,'=','-'
+		db	'1','2','3','=',$0A,$00,'=','-'
+		db	'1','2','3','=',$0A,$00,'=','+'
+		db	'1','2','3','=',$0A,$00,'=','-'
+		db	'1','2','3','=',$0A,$00,'=','+'
+		db	'1','2','3','=',$0A,$00,'=',' '
+		db	'1','2','3','=',$0A,$00,'=','+'
+		db	'1','2','3','=',$0A,$00,'=','+'
+		db	'1','2','3','=',$0A,$00,'=','1'
+		db	'2','3',' ','=',$0A,$00,'=','-'
+		db	'1','2','3','4','=',$0A,$00,'='
+		db	'+','1','2','3','4','=',$0A,$00
+		db	'=','+','1','2','3','4','=',$0A
+		db	$00,'=','-','1','2','3','4','='
+		db	$0A,$00,'=','-','1','2','3','4'
+		db	'=',$0A,$00,'=','+','1','2','3'
+		db	'4','=',$0A,$00,'=','-','1','2'
+		db	'3','4','=',$0A,$00,'=','+','1'
+		db	'2','3','4','=',$0A,$00,'=',' '
+		db	'1','2','3','4','=',$0A,$00,'='
+		db	'+','1','2','3','4','=',$0A,$00
+		db	'=','+','1','2','3','4','=',$0A
+		db	$00,'=','1','2','3','4','=',$0A
+		db	$00,'=','-','1','2','3','4','5'
+		db	'=',$0A,$00,'=','+','1','2','3'
+		db	'4','5','=',$0A,$00,'=','+','1'
+		db	'2','3','4','5','=',$0A,$00,'='
+		db	'-','1','2','3','4','5','=',$0A
+		db	$00,'=','-','1','2','3','4','5'
+		db	'=',$0A,$00,'=','+','1','2','3'
+		db	'4','5','=',$0A,$00,'=','-','1'
+		db	'2','3','4','5','=',$0A,$00,'='
+		db	'+','1','2','3','4','5','=',$0A
+		db	$00,'=',' ','1','2','3','4','5'
+		db	'=',$0A,$00,'=','+','1','2','3'
+		db	'4','5','=',$0A,$00,'=','+','1'
+		db	'2','3','4','5','=',$0A,$00,'='
+		db	'1','2','3','4','5','=',$0A,$00
+		db	'=','%','4','.','2','d','=',$0A
+		db	$00,'=','%','+','4','.','2','d'
+		db	'=',$0A,$00,'=','%','+','0','4'
+		db	'.','2','d','=',$0A,$00,'=','%'
+		db	' ','0','4','.','2','d','=',$0A
+		db	$00,'=','%','+','4','d','=',$0A
+		db	$00,'=','%','+','4','d','=',$0A
+		db	$00,'=','%','+','0','4','d','='
+		db	$0A,$00,'=','%','+','0','4','d'
+		db	'=',$0A,$00,'=','%',' ','0','4'
+		db	'd','=',$0A,$00,'=','%','+',' '
+		db	'0','4','d','=',$0A,$00,'=','%'
+		db	' ','+','0','4','d','=',$0A,$00
+		db	'=','%','0','4','d','=',$0A,$00
+		db	'=','%','4','.','2','u','=',$0A
+		db	$00,'=','%','+','4','.','2','u'
+		db	'=',$0A,$00,'=','%','+','0','4'
+		db	'.','2','u','=',$0A,$00,'=','%'
+		db	' ','0','4','.','2','u','=',$0A
+		db	$00,'=','%','+','4','u','=',$0A
+		db	$00,'=','%','+','4','u','=',$0A
+		db	$00,'=','%','+','0','4','u','='
+		db	$0A,$00,'=','%','+','0','4','u'
+		db	'=',$0A,$00,'=','%',' ','0','4'
+		db	'u','=',$0A,$00,'=','%','+',' '
+		db	'0','4','u','=',$0A,$00,'=','%'
+		db	' ','+','0','4','u','=',$0A,$00
+		db	'=','%','0','4','u','=',$0A,$00
+		db	'=','%','4','.','2','x','=',$0A
+		db	$00,'=','%','+','4','.','2','x'
+		db	'=',$0A,$00,'=','%','+','0','4'
+		db	'.','2','x','=',$0A,$00,'=','%'
+		db	' ','0','4','.','2','x','=',$0A
+		db	$00,'=','%','+','4','x','=',$0A
+		db	$00,'=','%','+','4','x','=',$0A
+		db	$00,'=','%','+','0','4','X','='
+		db	$0A,$00,'=','%','+','0','4','X'
+		db	'=',$0A,$00,'=','%',' ','0','4'
+		db	'X','=',$0A,$00,'=','%','+',' '
+		db	'0','4','X','=',$0A,$00,'=','%'
+		db	' ','+','0','4','X','=',$0A,$00
+		db	'=','%','0','4','X','=',$0A,$00
+		db	'=','%','4','c','=',$0A,$00,'='
+		db	'%','0','4','c','=',$0A,$00,'='
+		db	'%','4','.','3','c','=',$0A,$00
+		db	'=','%','+','4','c','=',$0A,$00
+		db	'=','%',' ','0','4','c','=',$0A
+		db	$00,'=','%','+',' ','4','.','3'
+		db	'c','=',$0A,$00,'=','%','-','*'
+		db	'.','2','d','=',$0A,$00,'=','%'
+		db	'-','+','*','.','2','d','=',$0A
+		db	$00,'=','%','-','+','0','*','.'
+		db	'2','d','=',$0A,$00,'=','%','-'
+		db	' ','0','*','.','2','d','=',$0A
+		db	$00,'=','%','-','+','*','d','='
+		db	$0A,$00,'=','%','-','+','*','d'
+		db	'=',$0A,$00,'=','%','-','+','0'
+		db	'*','d','=',$0A,$00,'=','%','-'
+		db	'+','0','*','d','=',$0A,$00,'='
+		db	'%','-',' ','0','*','d','=',$0A
+		db	$00,'=','%','-','+',' ','0','*'
+		db	'd','=',$0A,$00,'=','%','-',' '
+		db	'+','0','*','d','=',$0A,$00,'='
+		db	'%','-','0','*','d','=',$0A,$00
+		db	'=','%','-','4','.','*','u','='
+		db	$0A,$00,'=','%','-','+','4','.'
+		db	'*','u','=',$0A,$00,'=','%','-'
+		db	'+','0','4','.','*','u','=',$0A
+		db	$00,'=','%','-',' ','0','4','.'
+		db	'*','u','=',$0A,$00,'=','%','-'
+		db	'+','4','u','=',$0A,$00,'=','%'
+		db	'-','+','4','u','=',$0A,$00,'='
+		db	'%','-','+','0','4','u','=',$0A
+		db	$00,'=','%','-','+','0','4','u'
+		db	'=',$0A,$00,'=','%','-',' ','0'
+		db	'4','u','=',$0A,$00,'=','%','-'
+		db	'+',' ','0','4','u','=',$0A,$00
+		db	'=','%','-',' ','+','0','4','u'
+		db	'=',$0A,$00,'=','%','-','0','4'
+		db	'u','=',$0A,$00,'=','%','-','*'
+		db	'.','*','x','=',$0A,$00,'=','%'
+		db	'-','+','*','.','*','x','=',$0A
+		db	$00,'=','%','-','+','0','*','.'
+		db	'*','x','=',$0A,$00,'=','%','-'
+		db	' ','0','*','.','*','x','=',$0A
+		db	$00,'=','%','-','+','4','x','='
+		db	$0A,$00,'=','%','-','+','4','x'
+		db	'=',$0A,$00,'=','%','-','+','0'
+		db	'4','X','=',$0A,$00,'=','%','-'
+		db	'+','0','4','X','=',$0A,$00,'='
+		db	'%','-',' ','0','4','X','=',$0A
+		db	$00,'=','%','-','+',' ','0','4'
+		db	'X','=',$0A,$00,'=','%','-',' '
+		db	'+','0','4','X','=',$0A,$00,'='
+		db	'%','-','0','4','X','=',$0A,$00
+		db	'=','%','-','4','c','=',$0A,$00
+		db	'=','%','-','0','4','c','=',$0A
+		db	$00,'=','%','-','4','.','3','c'
+		db	'=',$0A,$00,'=','%','-','+','4'
+		db	'c','=',$0A,$00,'=','%','-',' '
+		db	'0','4','c','=',$0A,$00,'=','%'
+		db	'-','+',' ','4','.','3','c','='
+		db	$0A,$00,'=','%','4','.','2','d'
+		db	'=',$0A,$00,'=','%','+','4','.'
+		db	'2','d','=',$0A,$00,'=','%','+'
+		db	'0','4','.','2','d','=',$0A,$00
+		db	'=','%',' ','0','4','.','2','d'
+		db	'=',$0A,$00,'=','%','+','4','d'
+		db	'=',$0A,$00,'=','%','+','4','d'
+		db	'=',$0A,$00,'=','%','+','0','4'
+		db	'd','=',$0A,$00,'=','%','+','0'
+		db	'4','d','=',$0A,$00,'=','%',' '
+		db	'0','4','d','=',$0A,$00,'=','%'
+		db	'+',' ','0','4','d','=',$0A,$00
+		db	'=','%',' ','+','0','4','d','='
+		db	$0A,$00,'=','%','0','4','d','='
+		db	$0A,$00,'=','%','4','.','2','d'
+		db	'=',$0A,$00,'=','%','+','4','.'
+		db	'2','d','=',$0A,$00,'=','%','+'
+		db	'0','4','.','2','d','=',$0A,$00
+		db	'=','%',' ','0','4','.','2','d'
+		db	'=',$0A,$00,'=','%','+','4','d'
+		db	'=',$0A,$00,'=','%','+','4','d'
+		db	'=',$0A,$00,'=','%','+','0','4'
+		db	'd','=',$0A,$00,'=','%','+','0'
+		db	'4','d','=',$0A,$00,'=','%',' '
+		db	'0','4','d','=',$0A,$00,'=','%'
+		db	'+',' ','0','4','d','=',$0A,$00
+		db	'=','%',' ','+','0','4','d','='
+		db	$0A,$00,'=','%','0','4','d','='
+		db	$0A,$00,'=','%','4','.','2','d'
+		db	'=',$0A,$00,'=','%','+','4','.'
+		db	'2','d','=',$0A,$00,'=','%','+'
+		db	'0','4','.','2','d','=',$0A,$00
+		db	'=','%',' ','0','4','.','2','d'
+		db	'=',$0A,$00,'=','%','+','4','d'
+		db	'=',$0A,$00,'=','%','+','4','d'
+		db	'=',$0A,$00,'=','%','+','0','4'
+		db	'd','=',$0A,$00,'=','%','+','0'
+		db	'4','d','=',$0A,$00,'=','%',' '
+		db	'0','4','d','=',$0A,$00,'=','%'
+		db	'+',' ','0','4','d','=',$0A,$00
+		db	'=','%',' ','+','0','4','d','='
+		db	$0A,$00,'=','%','0','4','d','='
+		db	$0A,$00,'=','%','-','4','.','2'
+		db	'd','=',$0A,$00,'=','%','-','+'
+		db	'4','.','2','d','=',$0A,$00,'='
+		db	'%','-','+','0','4','.','2','d'
+		db	'=',$0A,$00,'=','%','-',' ','0'
+		db	'4','.','2','d','=',$0A,$00,'='
+		db	'%','-','+','4','d','=',$0A,$00
+		db	'=','%','-','+','4','d','=',$0A
+		db	$00,'=','%','-','+','0','4','d'
+		db	'=',$0A,$00,'=','%','-','+','0'
+		db	'4','d','=',$0A,$00,'=','%','-'
+		db	' ','0','4','d','=',$0A,$00,'='
+		db	'%','-','+',' ','0','4','d','='
+		db	$0A,$00,'=','%','-',' ','+','0'
+		db	'4','d','=',$0A,$00,'=','%','-'
+		db	'0','4','d','=',$0A,$00,'=','%'
+		db	'-','4','.','2','d','=',$0A,$00
+		db	'=','%','-','+','4','.','2','d'
+		db	'=',$0A,$00,'=','%','-','+','0'
+		db	'4','.','2','d','=',$0A,$00,'='
+		db	'%','-',' ','0','4','.','2','d'
+		db	'=',$0A,$00,'=','%','-','+','4'
+		db	'd','=',$0A,$00,'=','%','-','+'
+		db	'4','d','=',$0A,$00,'=','%','-'
+		db	'+','0','4','d','=',$0A,$00,'='
+		db	'%','-','+','0','4','d','=',$0A
+		db	$00,'=','%','-',' ','0','4','d'
+		db	'=',$0A,$00,'=','%','-','+',' '
+		db	'0','4','d','=',$0A,$00,'=','%'
+		db	'-',' ','+','0','4','d','=',$0A
+		db	$00,'=','%','-','0','4','d','='
+		db	$0A,$00,'=','%','-','4','.','2'
+		db	'd','=',$0A,$00,'=','%','-','+'
+		db	'4','.','2','d','=',$0A,$00,'='
+		db	'%','-','+','0','4','.','2','d'
+		db	'=',$0A,$00,'=','%','-',' ','0'
+		db	'4','.','2','d','=',$0A,$00,'='
+		db	'%','-','+','4','d','=',$0A,$00
+		db	'=','%','-','+','4','d','=',$0A
+		db	$00,'=','%','-','+','0','4','d'
+		db	'=',$0A,$00,'=','%','-','+','0'
+		db	'4','d','=',$0A,$00,'=','%','-'
+		db	' ','0','4','d','=',$0A,$00,'='
+		db	'%','-','+',' ','0','4','d','='
+		db	$0A,$00,'=','%','-',' ','+','0'
+		db	'4','d','=',$0A,$00,'=','%','-'
+		db	'0','4','d','=',$0A,$00,'=','%'
+		db	's','=',$0A,$00,'h','e','l','l'
+		db	'o',$00,'=','%','.','s','=',$0A
+		db	$00,'h','e','l','l','o',$00,'='
+		db	'%','.','*','s','=',$0A,$00,'h'
+		db	'e','l','l','o',$00,'=','%','.'
+		db	'2','s','%','*','.','*','c','o'
+		db	'=',$0A,$00,'h','e','l','l','o'
+		db	$00,'=','%','d','=',$0A,$00,'='
+		db	'%','d','=',$0A,$00,'=','%','+'
+		db	'd','=',$0A,$00,'=','%','+','d'
+		db	'=',$0A,$00,'=','%',' ','d','='
+		db	$0A,$00,'=','%',' ','d','=',$0A
+		db	$00,'=','%','+',' ','d','=',$0A
+		db	$00,'=','%',' ','+','d','=',$0A
+		db	$00
+_result:
+		dw	__const1+0
+		dw	__const1+9
+		dw	__const1+13
+		dw	__const1+18
+		dw	__const1+27
+		dw	__const1+34
+		dw	__const1+40
+		dw	__const1+47
+		dw	__const1+54
+		dw	__const1+61
+		dw	__const1+68
+		dw	__const1+75
+		dw	__const1+82
+		dw	__const1+90
+		dw	__const1+98
+		dw	__const1+106
+		dw	__const1+114
+		dw	__const1+122
+		dw	__const1+130
+		dw	__const1+138
+		dw	__const1+146
+		dw	__const1+154
+		dw	__const1+162
+		dw	__const1+170
+		dw	__const1+178
+		dw	__const1+187
+		dw	__const1+195
+		dw	__const1+203
+		dw	__const1+211
+		dw	__const1+221
+		dw	__const1+229
+		dw	__const1+239
+		dw	__const1+247
+		dw	__const1+255
+		dw	__const1+263
+		dw	__const1+271
+		dw	__const1+279
+		dw	__const1+287
+		dw	__const1+295
+		dw	__const1+303
+		dw	__const1+311
+		dw	__const1+319
+		dw	__const1+327
+		dw	__const1+335
+		dw	__const1+343
+		dw	__const1+351
+		dw	__const1+359
+		dw	__const1+367
+		dw	__const1+375
+		dw	__const1+383
+		dw	__const1+391
+		dw	__const1+399
+		dw	__const1+407
+		dw	__const1+415
+		dw	__const1+423
+		dw	__const1+431
+		dw	__const1+439
+		dw	__const1+447
+		dw	__const1+455
+		dw	__const1+463
+		dw	__const1+471
+		dw	__const1+479
+		dw	__const1+487
+		dw	__const1+495
+		dw	__const1+503
+		dw	__const1+511
+		dw	__const1+519
+		dw	__const1+528
+		dw	__const1+536
+		dw	__const1+544
+		dw	__const1+552
+		dw	__const1+562
+		dw	__const1+570
+		dw	__const1+580
+		dw	__const1+588
+		dw	__const1+596
+		dw	__const1+604
+		dw	__const1+612
+		dw	__const1+620
+		dw	__const1+628
+		dw	__const1+636
+		dw	__const1+644
+		dw	__const1+652
+		dw	__const1+660
+		dw	__const1+668
+		dw	__const1+676
+		dw	__const1+684
+		dw	__const1+692
+		dw	__const1+700
+		dw	__const1+708
+		dw	__const1+716
+		dw	__const1+724
+		dw	__const1+732
+		dw	__const1+740
+		dw	__const1+748
+		dw	__const1+756
+		dw	__const1+764
+		dw	__const1+772
+		dw	__const1+780
+		dw	__const1+788
+		dw	__const1+796
+		dw	__const1+804
+		dw	__const1+812
+		dw	__const1+820
+		dw	__const1+828
+		dw	__const1+836
+		dw	__const1+844
+		dw	__const1+852
+		dw	__const1+860
+		dw	__const1+869
+		dw	__const1+878
+		dw	__const1+887
+		dw	__const1+896
+		dw	__const1+905
+		dw	__const1+914
+		dw	__const1+923
+		dw	__const1+932
+		dw	__const1+941
+		dw	__const1+950
+		dw	__const1+959
+		dw	__const1+967
+		dw	__const1+977
+		dw	__const1+987
+		dw	__const1+997
+		dw	__const1+1007
+		dw	__const1+1017
+		dw	__const1+1027
+		dw	__const1+1037
+		dw	__const1+1047
+		dw	__const1+1057
+		dw	__const1+1067
+		dw	__const1+1077
+		dw	__const1+1086
+		dw	__const1+1094
+		dw	__const1+1102
+		dw	__const1+1110
+		dw	__const1+1118
+		dw	__const1+1126
+		dw	__const1+1134
+		dw	__const1+1142
+		dw	__const1+1150
+		dw	__const1+1158
+		dw	__const1+1166
+		dw	__const1+1174
+		dw	__const1+1182
+		dw	__const1+1191
+		dw	__const1+1200
+		dw	__const1+1209
+		dw	__const1+1218
+		dw	__const1+1227
+		dw	__const1+1236
+		dw	__const1+1245
+		dw	__const1+1254
+		dw	__const1+1263
+		dw	__const1+1272
+		dw	__const1+1281
+		dw	__const1+1289
+		dw	__const1+1299
+		dw	__const1+1309
+		dw	__const1+1319
+		dw	__const1+1329
+		dw	__const1+1339
+		dw	__const1+1349
+		dw	__const1+1359
+		dw	__const1+1369
+		dw	__const1+1379
+		dw	__const1+1389
+		dw	__const1+1399
+
+	.bss
+_test:
+		ds	16
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:3049
+;	constant pool:336
+;	global pool:256
+;	Macro pool:118
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;      1072   1072     2  which
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_which, 2, 1072, 1072
+	.endm
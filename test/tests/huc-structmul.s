@@ -0,0 +1,507 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-structmul.c", 1; struct eins {
+	.dbg	line,	"tests/huc-structmul.c", 2; char a;
+	.dbg	line,	"tests/huc-structmul.c", 3; };
+	.dbg	line,	"tests/huc-structmul.c", 4; struct zwei {
+	.dbg	line,	"tests/huc-structmul.c", 5; int a;
+	.dbg	line,	"tests/huc-structmul.c", 6; };
+	.dbg	line,	"tests/huc-structmul.c", 7; struct drei {
+	.dbg	line,	"tests/huc-structmul.c", 8; int a;
+	.dbg	line,	"tests/huc-structmul.c", 9; char b;
+	.dbg	line,	"tests/huc-structmul.c", 10; };
+	.dbg	line,	"tests/huc-structmul.c", 11; struct vier {
+	.dbg	line,	"tests/huc-structmul.c", 12; int a;
+	.dbg	line,	"tests/huc-structmul.c", 13; int b;
+	.dbg	line,	"tests/huc-structmul.c", 14; };
+	.dbg	line,	"tests/huc-structmul.c", 15; struct fuenf {
+	.dbg	line,	"tests/huc-structmul.c", 16; int a;
+	.dbg	line,	"tests/huc-structmul.c", 17; int b;
+	.dbg	line,	"tests/huc-structmul.c", 18; char c;
+	.dbg	line,	"tests/huc-structmul.c", 19; };
+	.dbg	line,	"tests/huc-structmul.c", 20; struct sechs {
+	.dbg	line,	"tests/huc-structmul.c", 21; int a;
+	.dbg	line,	"tests/huc-structmul.c", 22; int b;
+	.dbg	line,	"tests/huc-structmul.c", 23; int c;
+	.dbg	line,	"tests/huc-structmul.c", 24; };
+	.dbg	line,	"tests/huc-structmul.c", 25; struct sieben {
+	.dbg	line,	"tests/huc-structmul.c", 26; int a;
+	.dbg	line,	"tests/huc-structmul.c", 27; int b;
+	.dbg	line,	"tests/huc-structmul.c", 28; int c;
+	.dbg	line,	"tests/huc-structmul.c", 29; char d;
+	.dbg	line,	"tests/huc-structmul.c", 30; };
+	.dbg	line,	"tests/huc-structmul.c", 31; struct acht {
+	.dbg	line,	"tests/huc-structmul.c", 32; int a;
+	.dbg	line,	"tests/huc-structmul.c", 33; int b;
+	.dbg	line,	"tests/huc-structmul.c", 34; int c;
+	.dbg	line,	"tests/huc-structmul.c", 35; int d;
+	.dbg	line,	"tests/huc-structmul.c", 36; };
+	.dbg	line,	"tests/huc-structmul.c", 37; struct neun {
+	.dbg	line,	"tests/huc-structmul.c", 38; int a;
+	.dbg	line,	"tests/huc-structmul.c", 39; int b;
+	.dbg	line,	"tests/huc-structmul.c", 40; int c;
+	.dbg	line,	"tests/huc-structmul.c", 41; int d;
+	.dbg	line,	"tests/huc-structmul.c", 42; char e;
+	.dbg	line,	"tests/huc-structmul.c", 43; };
+	.dbg	line,	"tests/huc-structmul.c", 45; struct eins one[3];
+	.dbg	line,	"tests/huc-structmul.c", 46; struct zwei two[3];
+	.dbg	line,	"tests/huc-structmul.c", 47; struct drei three[3];
+	.dbg	line,	"tests/huc-structmul.c", 48; struct vier four[3];
+	.dbg	line,	"tests/huc-structmul.c", 49; struct fuenf five[3];
+	.dbg	line,	"tests/huc-structmul.c", 50; struct sechs six[3];
+	.dbg	line,	"tests/huc-structmul.c", 51; struct sieben seven[3];
+	.dbg	line,	"tests/huc-structmul.c", 52; struct acht eight[3];
+	.dbg	line,	"tests/huc-structmul.c", 53; struct neun nine[3];
+	.dbg	line,	"tests/huc-structmul.c", 55; int main()
+	.dbg	line,	"tests/huc-structmul.c", 56; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-structmul.c", 57; int i;
+
+	.dbg	line,	"tests/huc-structmul.c", 58; for (i = 0; i < 3; i++) {
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL3:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	3
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/huc-structmul.c", 59; one[i].a = 41;
+	__ldx.wmq	__main_end - 2  /* i */
+	__st.uaxiq	41, _one
+
+	.dbg	line,	"tests/huc-structmul.c", 60; two[i].a = 42;
+	__ld2x.wmq	__main_end - 2  /* i */
+	__st.waxiq	42, _two
+
+	.dbg	line,	"tests/huc-structmul.c", 61; three[i].b = 43;
+	__ld.wmq	__main_end - 2  /* i */
+	__mul.uiq	3
+	__index.ur	_three + 2
+	__st.uatiq	43, _three + 2
+
+	.dbg	line,	"tests/huc-structmul.c", 62; four[i].b = 44;
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	2
+	__add.wi	_four + 2
+	__push.wr
+	__ld.wi		44
+	__st.wtq
+
+	.dbg	line,	"tests/huc-structmul.c", 63; five[i].c = 45;
+	__ld.wmq	__main_end - 2  /* i */
+	__mul.uiq	5
+	__index.ur	_five + 4
+	__st.uatiq	45, _five + 4
+
+	.dbg	line,	"tests/huc-structmul.c", 64; six[i].c = 46;
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wi	_six + 4
+	__push.wr
+	__ld.wi		46
+	__st.wtq
+
+	.dbg	line,	"tests/huc-structmul.c", 65; seven[i].d = 47;
+	__ld.wmq	__main_end - 2  /* i */
+	__mul.uiq	7
+	__index.ur	_seven + 6
+	__st.uatiq	47, _seven + 6
+
+	.dbg	line,	"tests/huc-structmul.c", 66; eight[i].d = 48;
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	3
+	__add.wi	_eight + 6
+	__push.wr
+	__ld.wi		48
+	__st.wtq
+
+	.dbg	line,	"tests/huc-structmul.c", 67; nine[i].e = 49;
+	__ld.wmq	__main_end - 2  /* i */
+	__mul.uiq	9
+	__index.ur	_nine + 8
+	__st.uatiq	49, _nine + 8
+
+	.dbg	line,	"tests/huc-structmul.c", 68; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/huc-structmul.c", 69; for (i = 0; i < 3; i++) {
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL7:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	3
+	__btrue		.LL9
+	__bra		.LL10
+.LL8:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL7
+.LL9:
+
+	.dbg	line,	"tests/huc-structmul.c", 70; if (one[i].a != 41)
+	__ldx.wmq	__main_end - 2  /* i */
+	__ld.uaxq	_one
+	__neq_b.uiq	41
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/huc-structmul.c", 71; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-structmul.c", 72; if (two[i].a != 42)
+.LL11:
+	__ld2x.wmq	__main_end - 2  /* i */
+	__ld.wax	_two
+	__neq_w.wi	42
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/huc-structmul.c", 73; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-structmul.c", 74; if (three[i].a != 0 || three[i].b != 43)
+.LL12:
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__add.wi	_three
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__btrue		.LL14
+	__ld.wmq	__main_end - 2  /* i */
+	__mul.uiq	3
+	__ld.uarq	_three + 2
+	__neq_b.uiq	43
+.LL14:
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/huc-structmul.c", 75; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-structmul.c", 76; if (four[i].a != 0 || four[i].b != 44)
+.LL13:
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	2
+	__add.wi	_four
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__btrue		.LL16
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	2
+	__add.wi	_four + 2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	44
+.LL16:
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/huc-structmul.c", 77; exit(4);
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-structmul.c", 78; if (five[i].a != 0 || five[i].b != 0 || five[i].c != 45)
+.LL15:
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__add.wi	_five
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__btrue		.LL18
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__add.wi	_five + 2
+	__st.wm		__ptr
+	__tst.wp	__ptr
+.LL18:
+	__btrue		.LL19
+	__ld.wmq	__main_end - 2  /* i */
+	__mul.uiq	5
+	__ld.uarq	_five + 4
+	__neq_b.uiq	45
+.LL19:
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/huc-structmul.c", 79; exit(5);
+	__ld.wi		5
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-structmul.c", 80; if (six[i].a != 0 || six[i].b != 0 || six[i].c != 46)
+.LL17:
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wi	_six
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__btrue		.LL21
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wi	_six + 2
+	__st.wm		__ptr
+	__tst.wp	__ptr
+.LL21:
+	__btrue		.LL22
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wi	_six + 4
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	46
+.LL22:
+	__bfalse	.LL20
+
+	.dbg	line,	"tests/huc-structmul.c", 81; exit(6);
+	__ld.wi		6
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-structmul.c", 82; if (seven[i].a != 0 || seven[i].b != 0 || seven[i].c != 0 || seven[i].d != 47)
+.LL20:
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__add.wi	_seven
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__btrue		.LL24
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__add.wi	_seven + 2
+	__st.wm		__ptr
+	__tst.wp	__ptr
+.LL24:
+	__btrue		.LL25
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__add.wi	_seven + 4
+	__st.wm		__ptr
+	__tst.wp	__ptr
+.LL25:
+	__btrue		.LL26
+	__ld.wmq	__main_end - 2  /* i */
+	__mul.uiq	7
+	__ld.uarq	_seven + 6
+	__neq_b.uiq	47
+.LL26:
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/huc-structmul.c", 83; exit(7);
+	__ld.wi		7
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-structmul.c", 84; if (eight[i].a != 0 || eight[i].b != 0 || eight[i].c != 0 || eight[i].d != 48)
+.LL23:
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	3
+	__add.wi	_eight
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__btrue		.LL28
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	3
+	__add.wi	_eight + 2
+	__st.wm		__ptr
+	__tst.wp	__ptr
+.LL28:
+	__btrue		.LL29
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	3
+	__add.wi	_eight + 4
+	__st.wm		__ptr
+	__tst.wp	__ptr
+.LL29:
+	__btrue		.LL30
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wi	3
+	__add.wi	_eight + 6
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	48
+.LL30:
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/huc-structmul.c", 85; exit(8);
+	__ld.wi		8
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-structmul.c", 86; if (nine[i].a != 0 || nine[i].b != 0 || nine[i].c != 0 || nine[i].d != 0 || nine[i].e != 49)
+.LL27:
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__add.wi	_nine
+	__st.wm		__ptr
+	__tst.wp	__ptr
+	__btrue		.LL32
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__add.wi	_nine + 2
+	__st.wm		__ptr
+	__tst.wp	__ptr
+.LL32:
+	__btrue		.LL33
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__add.wi	_nine + 4
+	__st.wm		__ptr
+	__tst.wp	__ptr
+.LL33:
+	__btrue		.LL34
+	__ld.wm		__main_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__add.wi	_nine + 6
+	__st.wm		__ptr
+	__tst.wp	__ptr
+.LL34:
+	__btrue		.LL35
+	__ld.wmq	__main_end - 2  /* i */
+	__mul.uiq	9
+	__ld.uarq	_nine + 8
+	__neq_b.uiq	49
+.LL35:
+	__bfalse	.LL31
+
+	.dbg	line,	"tests/huc-structmul.c", 87; exit(9);
+	__ld.wi		9
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-structmul.c", 88; }
+.LL31	.alias		.LL8
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/huc-structmul.c", 89; return 0;
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-structmul.c", 90; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_one:
+		ds	3
+_two:
+		ds	6
+_three:
+		ds	9
+_four:
+		ds	12
+_five:
+		ds	15
+_six:
+		ds	18
+_seven:
+		ds	21
+_eight:
+		ds	24
+_nine:
+		ds	27
+
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:11
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
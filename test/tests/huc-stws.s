@@ -0,0 +1,191 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-stws.c", 1; const char a[10] = {60, 61, 62, 63, 64, 65, 66, 67, 68, 69};
+	.dbg	line,	"tests/huc-stws.c", 3; main()
+	.dbg	line,	"tests/huc-stws.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-stws.c", 5; int  u,v,w;
+
+	.dbg	line,	"tests/huc-stws.c", 6; char x,y,z;
+
+	.dbg	line,	"tests/huc-stws.c", 7; u = 1;
+	__st.wmiq	1, __main_end - 2  /* u */
+
+	.dbg	line,	"tests/huc-stws.c", 8; v = 5;
+	__st.wmiq	5, __main_end - 4  /* v */
+
+	.dbg	line,	"tests/huc-stws.c", 9; w = a[u+v];
+	__ld.wm		__main_end - 2  /* u */
+	__add.wm	__main_end - 4  /* v */
+	__ld.uar	_a
+	__st.wmq	__main_end - 6  /* w */
+
+	.dbg	line,	"tests/huc-stws.c", 10; if (a[u+1] != 62)
+	__ld.wm		__main_end - 2  /* u */
+	__add.wi	1
+	__ld.uarq	_a
+	__neq_b.uiq	62
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-stws.c", 11; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-stws.c", 12; if (a[v] != 65)
+.LL3:
+	__ldx.wmq	__main_end - 4  /* v */
+	__ld.uaxq	_a
+	__neq_b.uiq	65
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-stws.c", 13; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-stws.c", 14; if (w != 66)
+.LL4:
+	__ld.wm		__main_end - 6  /* w */
+	__neq_w.wi	66
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-stws.c", 15; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-stws.c", 16; x = 2;
+.LL5:
+	__st.umiq	2, __main_end - 7  /* x */
+
+	.dbg	line,	"tests/huc-stws.c", 17; y = 3;
+	__st.umiq	3, __main_end - 8  /* y */
+
+	.dbg	line,	"tests/huc-stws.c", 18; z = a[x+y];
+	__ld.um		__main_end - 7  /* x */
+	__add.um	__main_end - 8  /* y */
+	__ld.uar	_a
+	__st.umq	__main_end - 9  /* z */
+
+	.dbg	line,	"tests/huc-stws.c", 19; if (a[x+1] != 63)
+	__ld.um		__main_end - 7  /* x */
+	__add.wi	1
+	__ld.uarq	_a
+	__neq_b.uiq	63
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/huc-stws.c", 20; exit(4);
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-stws.c", 21; if (a[y] != 63)
+.LL6:
+	__ldx.umq	__main_end - 8  /* y */
+	__ld.uaxq	_a
+	__neq_b.uiq	63
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/huc-stws.c", 22; exit(5);
+	__ld.wi		5
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-stws.c", 23; if (z != 65)
+.LL7:
+	__ld.umq	__main_end - 9  /* z */
+	__neq_b.uiq	65
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/huc-stws.c", 24; exit(6);
+	__ld.wi		6
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-stws.c", 25; return 0;
+.LL8:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-stws.c", 26; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_a:
+		db	60
+		db	61
+		db	62
+		db	63
+		db	64
+		db	65
+		db	66
+		db	67
+		db	68
+		db	69
+
+	.bss
+	.code
+	.if		leaf_needs < 9
+leaf_needs	.set	9
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:10
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
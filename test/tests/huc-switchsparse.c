@@ -0,0 +1,153 @@
+/* sparse switch() statements that are split into a tree of tables */
+
+#ifdef __HUCC__
+
+#define C4(k) \
+  case (k) * 37: return (k); \
+  case ((k) + 1) * 37: return ((k) + 1); \
+  case ((k) + 2) * 37: return ((k) + 2); \
+  case ((k) + 3) * 37: return ((k) + 3);
+
+int sparse(int v)
+{
+  switch (v) {
+    C4(0) C4(4)
+    C4(8) C4(12)
+    C4(16) C4(20)
+    C4(24) C4(28)
+    C4(32) C4(36)
+    C4(40) C4(44)
+    C4(48) C4(52)
+    C4(56) C4(60)
+    C4(64) C4(68)
+    C4(72) C4(76)
+    C4(80) C4(84)
+    C4(88) C4(92)
+    C4(96) C4(100)
+    C4(104) C4(108)
+    C4(112) C4(116)
+    C4(120) C4(124)
+    C4(128) C4(132)
+    C4(136) C4(140)
+    C4(144) C4(148)
+    case 30000: return 1000;
+    case 30001: return 1001;
+    case 30002: return 1002;
+    case 30004: return 1004;
+    case 30005: return 1005;
+    case 30007: return 1007;
+    case 30008: return 1008;
+    case -1: return 2001;
+    case -2: return 2002;
+    case -3: return 2003;
+    case -1000: return 3000;
+    case 40000: return 4000;
+  }
+  return -1;
+}
+
+int expect(int v)
+{
+  if (v >= 0 && v < 152 * 37 && (v % 37) == 0)
+    return v / 37;
+  if (v >= 30000 && v <= 30008 && v != 30003 && v != 30006)
+    return v - 29000;
+  if (v >= -3 && v <= -1)
+    return 2000 - v;
+  if (v == -1000)
+    return 3000;
+  if (v == -25536)
+    return 4000;
+  return -1;
+}
+
+int bytes(unsigned char c)
+{
+  switch (c) {
+    case 0: return 1;
+    case 9: return 2;
+    case 20: return 3;
+    case 33: return 4;
+    case 47: return 5;
+    case 60: return 6;
+    case 75: return 7;
+    case 88: return 8;
+    case 100: return 9;
+    case 101: return 10;
+    case 102: return 11;
+    case 103: return 12;
+    case 104: return 13;
+    case 130: return 14;
+    case 170: return 15;
+    case 200: return 16;
+    case 230: return 17;
+    case 255: return 18;
+  }
+  return 0;
+}
+
+int sbytes(signed char c)
+{
+  switch (c) {
+    case -128: return 1;
+    case -100: return 2;
+    case -70: return 3;
+    case -40: return 4;
+    case -10: return 5;
+    case -1: return 6;
+    case 0: return 7;
+    case 1: return 8;
+    case 30: return 9;
+    case 60: return 10;
+    case 90: return 11;
+    case 127: return 12;
+  }
+  return 0;
+}
+
+const unsigned char ulist[] = {0, 9, 20, 33, 47, 60, 75, 88, 100, 101, 102, 103, 104, 130, 170, 200, 230, 255};
+const signed char slist[] = {-128, -100, -70, -40, -10, -1, 0, 1, 30, 60, 90, 127};
+
+int main()
+{
+  int i, j, n;
+
+  for (i = -2000; i < 6000; i++) {
+    if (sparse(i) != expect(i))
+      exit(1);
+  }
+  for (i = 29990; i < 30020; i++) {
+    if (sparse(i) != expect(i))
+      exit(2);
+  }
+  if (sparse(-1000) != 3000 || sparse(40000) != 4000 || sparse(-32768) != -1)
+    exit(3);
+
+  for (i = 0; i < 256; i++) {
+    n = 0;
+    for (j = 0; j < 18; j++)
+      if (ulist[j] == i)
+        n = j + 1;
+    if (bytes(i) != n)
+      exit(4);
+  }
+  for (i = -128; i < 128; i++) {
+    n = 0;
+    for (j = 0; j < 12; j++)
+      if (slist[j] == i)
+        n = j + 1;
+    if (sbytes(i) != n)
+      exit(5);
+  }
+  return 0;
+}
+
+#else
+
+// more than 127 case labels are not supported in HuC.
+main()
+{
+  exit(0);
+}
+
+#endif // __HUCC__
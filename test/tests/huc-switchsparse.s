@@ -0,0 +1,1671 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-switchsparse.c", 1; /* sparse switch() statements that are split into a tree of tables */
+	.dbg	line,	"tests/huc-switchsparse.c", 3; #ifdef __HUCC__
+	.dbg	line,	"tests/huc-switchsparse.c", 5; #define C4(k) \
+	.dbg	line,	"tests/huc-switchsparse.c", 6; case (k) * 37: return (k); \
+	.dbg	line,	"tests/huc-switchsparse.c", 7; case ((k) + 1) * 37: return ((k) + 1); \
+	.dbg	line,	"tests/huc-switchsparse.c", 8; case ((k) + 2) * 37: return ((k) + 2); \
+	.dbg	line,	"tests/huc-switchsparse.c", 9; case ((k) + 3) * 37: return ((k) + 3);
+	.dbg	line,	"tests/huc-switchsparse.c", 11; int sparse(int v)
+	.dbg	line,	"tests/huc-switchsparse.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_sparse
+	__enter		_sparse
+
+	.dbg	line,	"tests/huc-switchsparse.c", 13; switch (v) {
+	__ld.ws		0  /* v */
+	__bra		.LL3
+
+	.dbg	line,	"tests/huc-switchsparse.c", 14; C4(0) C4(4)
+.LL5:
+	__case		0
+	__ld.wi		0
+	__bra		.LL2
+.LL6:
+	__case		37
+	__ld.wi		1
+	__bra		.LL2
+.LL7:
+	__case		74
+	__ld.wi		2
+	__bra		.LL2
+.LL8:
+	__case		111
+	__ld.wi		3
+	__bra		.LL2
+.LL9:
+	__case		148
+	__ld.wi		4
+	__bra		.LL2
+.LL10:
+	__case		185
+	__ld.wi		5
+	__bra		.LL2
+.LL11:
+	__case		222
+	__ld.wi		6
+	__bra		.LL2
+.LL12:
+	__case		259
+	__ld.wi		7
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 15; C4(8) C4(12)
+.LL13:
+	__case		296
+	__ld.wi		8
+	__bra		.LL2
+.LL14:
+	__case		333
+	__ld.wi		9
+	__bra		.LL2
+.LL15:
+	__case		370
+	__ld.wi		10
+	__bra		.LL2
+.LL16:
+	__case		407
+	__ld.wi		11
+	__bra		.LL2
+.LL17:
+	__case		444
+	__ld.wi		12
+	__bra		.LL2
+.LL18:
+	__case		481
+	__ld.wi		13
+	__bra		.LL2
+.LL19:
+	__case		518
+	__ld.wi		14
+	__bra		.LL2
+.LL20:
+	__case		555
+	__ld.wi		15
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 16; C4(16) C4(20)
+.LL21:
+	__case		592
+	__ld.wi		16
+	__bra		.LL2
+.LL22:
+	__case		629
+	__ld.wi		17
+	__bra		.LL2
+.LL23:
+	__case		666
+	__ld.wi		18
+	__bra		.LL2
+.LL24:
+	__case		703
+	__ld.wi		19
+	__bra		.LL2
+.LL25:
+	__case		740
+	__ld.wi		20
+	__bra		.LL2
+.LL26:
+	__case		777
+	__ld.wi		21
+	__bra		.LL2
+.LL27:
+	__case		814
+	__ld.wi		22
+	__bra		.LL2
+.LL28:
+	__case		851
+	__ld.wi		23
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 17; C4(24) C4(28)
+.LL29:
+	__case		888
+	__ld.wi		24
+	__bra		.LL2
+.LL30:
+	__case		925
+	__ld.wi		25
+	__bra		.LL2
+.LL31:
+	__case		962
+	__ld.wi		26
+	__bra		.LL2
+.LL32:
+	__case		999
+	__ld.wi		27
+	__bra		.LL2
+.LL33:
+	__case		1036
+	__ld.wi		28
+	__bra		.LL2
+.LL34:
+	__case		1073
+	__ld.wi		29
+	__bra		.LL2
+.LL35:
+	__case		1110
+	__ld.wi		30
+	__bra		.LL2
+.LL36:
+	__case		1147
+	__ld.wi		31
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 18; C4(32) C4(36)
+.LL37:
+	__case		1184
+	__ld.wi		32
+	__bra		.LL2
+.LL38:
+	__case		1221
+	__ld.wi		33
+	__bra		.LL2
+.LL39:
+	__case		1258
+	__ld.wi		34
+	__bra		.LL2
+.LL40:
+	__case		1295
+	__ld.wi		35
+	__bra		.LL2
+.LL41:
+	__case		1332
+	__ld.wi		36
+	__bra		.LL2
+.LL42:
+	__case		1369
+	__ld.wi		37
+	__bra		.LL2
+.LL43:
+	__case		1406
+	__ld.wi		38
+	__bra		.LL2
+.LL44:
+	__case		1443
+	__ld.wi		39
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 19; C4(40) C4(44)
+.LL45:
+	__case		1480
+	__ld.wi		40
+	__bra		.LL2
+.LL46:
+	__case		1517
+	__ld.wi		41
+	__bra		.LL2
+.LL47:
+	__case		1554
+	__ld.wi		42
+	__bra		.LL2
+.LL48:
+	__case		1591
+	__ld.wi		43
+	__bra		.LL2
+.LL49:
+	__case		1628
+	__ld.wi		44
+	__bra		.LL2
+.LL50:
+	__case		1665
+	__ld.wi		45
+	__bra		.LL2
+.LL51:
+	__case		1702
+	__ld.wi		46
+	__bra		.LL2
+.LL52:
+	__case		1739
+	__ld.wi		47
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 20; C4(48) C4(52)
+.LL53:
+	__case		1776
+	__ld.wi		48
+	__bra		.LL2
+.LL54:
+	__case		1813
+	__ld.wi		49
+	__bra		.LL2
+.LL55:
+	__case		1850
+	__ld.wi		50
+	__bra		.LL2
+.LL56:
+	__case		1887
+	__ld.wi		51
+	__bra		.LL2
+.LL57:
+	__case		1924
+	__ld.wi		52
+	__bra		.LL2
+.LL58:
+	__case		1961
+	__ld.wi		53
+	__bra		.LL2
+.LL59:
+	__case		1998
+	__ld.wi		54
+	__bra		.LL2
+.LL60:
+	__case		2035
+	__ld.wi		55
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 21; C4(56) C4(60)
+.LL61:
+	__case		2072
+	__ld.wi		56
+	__bra		.LL2
+.LL62:
+	__case		2109
+	__ld.wi		57
+	__bra		.LL2
+.LL63:
+	__case		2146
+	__ld.wi		58
+	__bra		.LL2
+.LL64:
+	__case		2183
+	__ld.wi		59
+	__bra		.LL2
+.LL65:
+	__case		2220
+	__ld.wi		60
+	__bra		.LL2
+.LL66:
+	__case		2257
+	__ld.wi		61
+	__bra		.LL2
+.LL67:
+	__case		2294
+	__ld.wi		62
+	__bra		.LL2
+.LL68:
+	__case		2331
+	__ld.wi		63
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 22; C4(64) C4(68)
+.LL69:
+	__case		2368
+	__ld.wi		64
+	__bra		.LL2
+.LL70:
+	__case		2405
+	__ld.wi		65
+	__bra		.LL2
+.LL71:
+	__case		2442
+	__ld.wi		66
+	__bra		.LL2
+.LL72:
+	__case		2479
+	__ld.wi		67
+	__bra		.LL2
+.LL73:
+	__case		2516
+	__ld.wi		68
+	__bra		.LL2
+.LL74:
+	__case		2553
+	__ld.wi		69
+	__bra		.LL2
+.LL75:
+	__case		2590
+	__ld.wi		70
+	__bra		.LL2
+.LL76:
+	__case		2627
+	__ld.wi		71
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 23; C4(72) C4(76)
+.LL77:
+	__case		2664
+	__ld.wi		72
+	__bra		.LL2
+.LL78:
+	__case		2701
+	__ld.wi		73
+	__bra		.LL2
+.LL79:
+	__case		2738
+	__ld.wi		74
+	__bra		.LL2
+.LL80:
+	__case		2775
+	__ld.wi		75
+	__bra		.LL2
+.LL81:
+	__case		2812
+	__ld.wi		76
+	__bra		.LL2
+.LL82:
+	__case		2849
+	__ld.wi		77
+	__bra		.LL2
+.LL83:
+	__case		2886
+	__ld.wi		78
+	__bra		.LL2
+.LL84:
+	__case		2923
+	__ld.wi		79
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 24; C4(80) C4(84)
+.LL85:
+	__case		2960
+	__ld.wi		80
+	__bra		.LL2
+.LL86:
+	__case		2997
+	__ld.wi		81
+	__bra		.LL2
+.LL87:
+	__case		3034
+	__ld.wi		82
+	__bra		.LL2
+.LL88:
+	__case		3071
+	__ld.wi		83
+	__bra		.LL2
+.LL89:
+	__case		3108
+	__ld.wi		84
+	__bra		.LL2
+.LL90:
+	__case		3145
+	__ld.wi		85
+	__bra		.LL2
+.LL91:
+	__case		3182
+	__ld.wi		86
+	__bra		.LL2
+.LL92:
+	__case		3219
+	__ld.wi		87
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 25; C4(88) C4(92)
+.LL93:
+	__case		3256
+	__ld.wi		88
+	__bra		.LL2
+.LL94:
+	__case		3293
+	__ld.wi		89
+	__bra		.LL2
+.LL95:
+	__case		3330
+	__ld.wi		90
+	__bra		.LL2
+.LL96:
+	__case		3367
+	__ld.wi		91
+	__bra		.LL2
+.LL97:
+	__case		3404
+	__ld.wi		92
+	__bra		.LL2
+.LL98:
+	__case		3441
+	__ld.wi		93
+	__bra		.LL2
+.LL99:
+	__case		3478
+	__ld.wi		94
+	__bra		.LL2
+.LL100:
+	__case		3515
+	__ld.wi		95
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 26; C4(96) C4(100)
+.LL101:
+	__case		3552
+	__ld.wi		96
+	__bra		.LL2
+.LL102:
+	__case		3589
+	__ld.wi		97
+	__bra		.LL2
+.LL103:
+	__case		3626
+	__ld.wi		98
+	__bra		.LL2
+.LL104:
+	__case		3663
+	__ld.wi		99
+	__bra		.LL2
+.LL105:
+	__case		3700
+	__ld.wi		100
+	__bra		.LL2
+.LL106:
+	__case		3737
+	__ld.wi		101
+	__bra		.LL2
+.LL107:
+	__case		3774
+	__ld.wi		102
+	__bra		.LL2
+.LL108:
+	__case		3811
+	__ld.wi		103
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 27; C4(104) C4(108)
+.LL109:
+	__case		3848
+	__ld.wi		104
+	__bra		.LL2
+.LL110:
+	__case		3885
+	__ld.wi		105
+	__bra		.LL2
+.LL111:
+	__case		3922
+	__ld.wi		106
+	__bra		.LL2
+.LL112:
+	__case		3959
+	__ld.wi		107
+	__bra		.LL2
+.LL113:
+	__case		3996
+	__ld.wi		108
+	__bra		.LL2
+.LL114:
+	__case		4033
+	__ld.wi		109
+	__bra		.LL2
+.LL115:
+	__case		4070
+	__ld.wi		110
+	__bra		.LL2
+.LL116:
+	__case		4107
+	__ld.wi		111
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 28; C4(112) C4(116)
+.LL117:
+	__case		4144
+	__ld.wi		112
+	__bra		.LL2
+.LL118:
+	__case		4181
+	__ld.wi		113
+	__bra		.LL2
+.LL119:
+	__case		4218
+	__ld.wi		114
+	__bra		.LL2
+.LL120:
+	__case		4255
+	__ld.wi		115
+	__bra		.LL2
+.LL121:
+	__case		4292
+	__ld.wi		116
+	__bra		.LL2
+.LL122:
+	__case		4329
+	__ld.wi		117
+	__bra		.LL2
+.LL123:
+	__case		4366
+	__ld.wi		118
+	__bra		.LL2
+.LL124:
+	__case		4403
+	__ld.wi		119
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 29; C4(120) C4(124)
+.LL125:
+	__case		4440
+	__ld.wi		120
+	__bra		.LL2
+.LL126:
+	__case		4477
+	__ld.wi		121
+	__bra		.LL2
+.LL127:
+	__case		4514
+	__ld.wi		122
+	__bra		.LL2
+.LL128:
+	__case		4551
+	__ld.wi		123
+	__bra		.LL2
+.LL129:
+	__case		4588
+	__ld.wi		124
+	__bra		.LL2
+.LL130:
+	__case		4625
+	__ld.wi		125
+	__bra		.LL2
+.LL131:
+	__case		4662
+	__ld.wi		126
+	__bra		.LL2
+.LL132:
+	__case		4699
+	__ld.wi		127
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 30; C4(128) C4(132)
+.LL133:
+	__case		4736
+	__ld.wi		128
+	__bra		.LL2
+.LL134:
+	__case		4773
+	__ld.wi		129
+	__bra		.LL2
+.LL135:
+	__case		4810
+	__ld.wi		130
+	__bra		.LL2
+.LL136:
+	__case		4847
+	__ld.wi		131
+	__bra		.LL2
+.LL137:
+	__case		4884
+	__ld.wi		132
+	__bra		.LL2
+.LL138:
+	__case		4921
+	__ld.wi		133
+	__bra		.LL2
+.LL139:
+	__case		4958
+	__ld.wi		134
+	__bra		.LL2
+.LL140:
+	__case		4995
+	__ld.wi		135
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 31; C4(136) C4(140)
+.LL141:
+	__case		5032
+	__ld.wi		136
+	__bra		.LL2
+.LL142:
+	__case		5069
+	__ld.wi		137
+	__bra		.LL2
+.LL143:
+	__case		5106
+	__ld.wi		138
+	__bra		.LL2
+.LL144:
+	__case		5143
+	__ld.wi		139
+	__bra		.LL2
+.LL145:
+	__case		5180
+	__ld.wi		140
+	__bra		.LL2
+.LL146:
+	__case		5217
+	__ld.wi		141
+	__bra		.LL2
+.LL147:
+	__case		5254
+	__ld.wi		142
+	__bra		.LL2
+.LL148:
+	__case		5291
+	__ld.wi		143
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 32; C4(144) C4(148)
+.LL149:
+	__case		5328
+	__ld.wi		144
+	__bra		.LL2
+.LL150:
+	__case		5365
+	__ld.wi		145
+	__bra		.LL2
+.LL151:
+	__case		5402
+	__ld.wi		146
+	__bra		.LL2
+.LL152:
+	__case		5439
+	__ld.wi		147
+	__bra		.LL2
+.LL153:
+	__case		5476
+	__ld.wi		148
+	__bra		.LL2
+.LL154:
+	__case		5513
+	__ld.wi		149
+	__bra		.LL2
+.LL155:
+	__case		5550
+	__ld.wi		150
+	__bra		.LL2
+.LL156:
+	__case		5587
+	__ld.wi		151
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 33; case 30000: return 1000;
+.LL157:
+	__case		30000
+	__ld.wi		1000
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 34; case 30001: return 1001;
+.LL158:
+	__case		30001
+	__ld.wi		1001
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 35; case 30002: return 1002;
+.LL159:
+	__case		30002
+	__ld.wi		1002
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 36; case 30004: return 1004;
+.LL160:
+	__case		30004
+	__ld.wi		1004
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 37; case 30005: return 1005;
+.LL161:
+	__case		30005
+	__ld.wi		1005
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 38; case 30007: return 1007;
+.LL162:
+	__case		30007
+	__ld.wi		1007
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 39; case 30008: return 1008;
+.LL163:
+	__case		30008
+	__ld.wi		1008
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 40; case -1: return 2001;
+.LL164:
+	__case		-1
+	__ld.wi		2001
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 41; case -2: return 2002;
+.LL165:
+	__case		-2
+	__ld.wi		2002
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 42; case -3: return 2003;
+.LL166:
+	__case		-3
+	__ld.wi		2003
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 43; case -1000: return 3000;
+.LL167:
+	__case		-1000
+	__ld.wi		3000
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 44; case 40000: return 4000;
+.LL168:
+	__case		40000
+	__ld.wi		4000
+	__bra		.LL2
+
+	.dbg	line,	"tests/huc-switchsparse.c", 45; }
+.LL3:
+	__switch_t.wr	3034, .LL169
+	__switch_t.wr	1554, .LL170
+	__switch_t.wr	814, .LL171
+	__switch_t.wr	407, .LL172
+	__switch_c.wr	11
+
+!table:		dw	370, 333, 296, 259, 222, 185, 148, 111
+		dw	74, 37, 0
+		dw	.LL4
+		dw	.LL15, .LL14, .LL13, .LL12, .LL11, .LL10, .LL9, .LL8
+		dw	.LL7, .LL6, .LL5
+
+.LL172:
+	__switch_c.wr	11
+
+!table:		dw	777, 740, 703, 666, 629, 592, 555, 518
+		dw	481, 444, 407
+		dw	.LL4
+		dw	.LL26, .LL25, .LL24, .LL23, .LL22, .LL21, .LL20, .LL19
+		dw	.LL18, .LL17, .LL16
+
+.LL171:
+	__switch_t.wr	1184, .LL173
+	__switch_c.wr	10
+
+!table:		dw	1147, 1110, 1073, 1036, 999, 962, 925, 888
+		dw	851, 814
+		dw	.LL4
+		dw	.LL36, .LL35, .LL34, .LL33, .LL32, .LL31, .LL30, .LL29
+		dw	.LL28, .LL27
+
+.LL173:
+	__switch_c.wr	10
+
+!table:		dw	1517, 1480, 1443, 1406, 1369, 1332, 1295, 1258
+		dw	1221, 1184
+		dw	.LL4
+		dw	.LL46, .LL45, .LL44, .LL43, .LL42, .LL41, .LL40, .LL39
+		dw	.LL38, .LL37
+
+.LL170:
+	__switch_t.wr	2294, .LL174
+	__switch_t.wr	1924, .LL175
+	__switch_c.wr	10
+
+!table:		dw	1887, 1850, 1813, 1776, 1739, 1702, 1665, 1628
+		dw	1591, 1554
+		dw	.LL4
+		dw	.LL56, .LL55, .LL54, .LL53, .LL52, .LL51, .LL50, .LL49
+		dw	.LL48, .LL47
+
+.LL175:
+	__switch_c.wr	10
+
+!table:		dw	2257, 2220, 2183, 2146, 2109, 2072, 2035, 1998
+		dw	1961, 1924
+		dw	.LL4
+		dw	.LL66, .LL65, .LL64, .LL63, .LL62, .LL61, .LL60, .LL59
+		dw	.LL58, .LL57
+
+.LL174:
+	__switch_t.wr	2664, .LL176
+	__switch_c.wr	10
+
+!table:		dw	2627, 2590, 2553, 2516, 2479, 2442, 2405, 2368
+		dw	2331, 2294
+		dw	.LL4
+		dw	.LL76, .LL75, .LL74, .LL73, .LL72, .LL71, .LL70, .LL69
+		dw	.LL68, .LL67
+
+.LL176:
+	__switch_c.wr	10
+
+!table:		dw	2997, 2960, 2923, 2886, 2849, 2812, 2775, 2738
+		dw	2701, 2664
+		dw	.LL4
+		dw	.LL86, .LL85, .LL84, .LL83, .LL82, .LL81, .LL80, .LL79
+		dw	.LL78, .LL77
+
+.LL169:
+	__switch_t.wr	4514, .LL177
+	__switch_t.wr	3774, .LL178
+	__switch_t.wr	3404, .LL179
+	__switch_c.wr	10
+
+!table:		dw	3367, 3330, 3293, 3256, 3219, 3182, 3145, 3108
+		dw	3071, 3034
+		dw	.LL4
+		dw	.LL96, .LL95, .LL94, .LL93, .LL92, .LL91, .LL90, .LL89
+		dw	.LL88, .LL87
+
+.LL179:
+	__switch_c.wr	10
+
+!table:		dw	3737, 3700, 3663, 3626, 3589, 3552, 3515, 3478
+		dw	3441, 3404
+		dw	.LL4
+		dw	.LL106, .LL105, .LL104, .LL103, .LL102, .LL101, .LL100, .LL99
+		dw	.LL98, .LL97
+
+.LL178:
+	__switch_t.wr	4144, .LL180
+	__switch_c.wr	10
+
+!table:		dw	4107, 4070, 4033, 3996, 3959, 3922, 3885, 3848
+		dw	3811, 3774
+		dw	.LL4
+		dw	.LL116, .LL115, .LL114, .LL113, .LL112, .LL111, .LL110, .LL109
+		dw	.LL108, .LL107
+
+.LL180:
+	__switch_c.wr	10
+
+!table:		dw	4477, 4440, 4403, 4366, 4329, 4292, 4255, 4218
+		dw	4181, 4144
+		dw	.LL4
+		dw	.LL126, .LL125, .LL124, .LL123, .LL122, .LL121, .LL120, .LL119
+		dw	.LL118, .LL117
+
+.LL177:
+	__switch_t.wr	5254, .LL181
+	__switch_t.wr	4884, .LL182
+	__switch_c.wr	10
+
+!table:		dw	4847, 4810, 4773, 4736, 4699, 4662, 4625, 4588
+		dw	4551, 4514
+		dw	.LL4
+		dw	.LL136, .LL135, .LL134, .LL133, .LL132, .LL131, .LL130, .LL129
+		dw	.LL128, .LL127
+
+.LL182:
+	__switch_c.wr	10
+
+!table:		dw	5217, 5180, 5143, 5106, 5069, 5032, 4995, 4958
+		dw	4921, 4884
+		dw	.LL4
+		dw	.LL146, .LL145, .LL144, .LL143, .LL142, .LL141, .LL140, .LL139
+		dw	.LL138, .LL137
+
+.LL181:
+	__switch_t.wr	40000, .LL183
+	__switch_t.wr	30000, .LL184
+	__switch_c.wr	10
+
+!table:		dw	5587, 5550, 5513, 5476, 5439, 5402, 5365, 5328
+		dw	5291, 5254
+		dw	.LL4
+		dw	.LL156, .LL155, .LL154, .LL153, .LL152, .LL151, .LL150, .LL149
+		dw	.LL148, .LL147
+
+.LL184:
+	__switch_r.wr	30000, 30008
+
+!table:		dw	.LL157, .LL158, .LL159, .LL4, .LL160, .LL161, .LL4, .LL162
+		dw	.LL163
+		dw	.LL4
+.LL183:
+	__switch_c.wr	5
+
+!table:		dw	40000, -1000, -3, -2, -1
+		dw	.LL4
+		dw	.LL168, .LL167, .LL166, .LL165, .LL164
+
+.LL4:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 46; return -1;
+	__ld.wi		-1
+.LL2:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 47; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-switchsparse.c", 49; int expect(int v)
+	.dbg	line,	"tests/huc-switchsparse.c", 50; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_expect
+	__enter		_expect
+
+	.dbg	line,	"tests/huc-switchsparse.c", 51; if (v >= 0 && v < 152 * 37 && (v % 37) == 0)
+	__ld.ws		0  /* v */
+	__sge_w.wi	0
+	__bfalse	.LL187
+	__ld.ws		0  /* v */
+	__slt_w.wi	5624
+.LL187:
+	__bfalse	.LL188
+	__ld.ws		0  /* v */
+	__smod.wi	37
+	__not.wr
+.LL188:
+	__bfalse	.LL186
+
+	.dbg	line,	"tests/huc-switchsparse.c", 52; return v / 37;
+	__ld.ws		0  /* v */
+	__sdiv.wi	37
+	__bra		.LL185
+
+	.dbg	line,	"tests/huc-switchsparse.c", 53; if (v >= 30000 && v <= 30008 && v != 30003 && v != 30006)
+.LL186:
+	__ld.ws		0  /* v */
+	__sge_w.wi	30000
+	__bfalse	.LL190
+	__ld.ws		0  /* v */
+	__sle_w.wi	30008
+.LL190:
+	__bfalse	.LL191
+	__ld.ws		0  /* v */
+	__neq_w.wi	30003
+.LL191:
+	__bfalse	.LL192
+	__ld.ws		0  /* v */
+	__neq_w.wi	30006
+.LL192:
+	__bfalse	.LL189
+
+	.dbg	line,	"tests/huc-switchsparse.c", 54; return v - 29000;
+	__ld.ws		0  /* v */
+	__sub.wi	29000
+	__bra		.LL185
+
+	.dbg	line,	"tests/huc-switchsparse.c", 55; if (v >= -3 && v <= -1)
+.LL189:
+	__ld.ws		0  /* v */
+	__sge_w.wi	-3
+	__bfalse	.LL194
+	__ld.ws		0  /* v */
+	__sle_w.wi	-1
+.LL194:
+	__bfalse	.LL193
+
+	.dbg	line,	"tests/huc-switchsparse.c", 56; return 2000 - v;
+	__ld.wi		2000
+	__sub.ws	0  /* v */
+	__bra		.LL185
+
+	.dbg	line,	"tests/huc-switchsparse.c", 57; if (v == -1000)
+.LL193:
+	__ld.ws		0  /* v */
+	__equ_w.wi	-1000
+	__bfalse	.LL195
+
+	.dbg	line,	"tests/huc-switchsparse.c", 58; return 3000;
+	__ld.wi		3000
+	__bra		.LL185
+
+	.dbg	line,	"tests/huc-switchsparse.c", 59; if (v == -25536)
+.LL195:
+	__ld.ws		0  /* v */
+	__equ_w.wi	-25536
+	__bfalse	.LL196
+
+	.dbg	line,	"tests/huc-switchsparse.c", 60; return 4000;
+	__ld.wi		4000
+	__bra		.LL185
+
+	.dbg	line,	"tests/huc-switchsparse.c", 61; return -1;
+.LL196:
+	__ld.wi		-1
+.LL185:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 62; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-switchsparse.c", 64; int bytes(unsigned char c)
+	.dbg	line,	"tests/huc-switchsparse.c", 65; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bytes
+	__enter		_bytes
+
+	.dbg	line,	"tests/huc-switchsparse.c", 66; switch (c) {
+	__ld.usq	0  /* c */
+	__bra		.LL198
+
+	.dbg	line,	"tests/huc-switchsparse.c", 67; case 0: return 1;
+.LL200:
+	__case		0
+	__ld.wi		1
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 68; case 9: return 2;
+.LL201:
+	__case		9
+	__ld.wi		2
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 69; case 20: return 3;
+.LL202:
+	__case		20
+	__ld.wi		3
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 70; case 33: return 4;
+.LL203:
+	__case		33
+	__ld.wi		4
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 71; case 47: return 5;
+.LL204:
+	__case		47
+	__ld.wi		5
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 72; case 60: return 6;
+.LL205:
+	__case		60
+	__ld.wi		6
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 73; case 75: return 7;
+.LL206:
+	__case		75
+	__ld.wi		7
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 74; case 88: return 8;
+.LL207:
+	__case		88
+	__ld.wi		8
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 75; case 100: return 9;
+.LL208:
+	__case		100
+	__ld.wi		9
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 76; case 101: return 10;
+.LL209:
+	__case		101
+	__ld.wi		10
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 77; case 102: return 11;
+.LL210:
+	__case		102
+	__ld.wi		11
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 78; case 103: return 12;
+.LL211:
+	__case		103
+	__ld.wi		12
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 79; case 104: return 13;
+.LL212:
+	__case		104
+	__ld.wi		13
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 80; case 130: return 14;
+.LL213:
+	__case		130
+	__ld.wi		14
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 81; case 170: return 15;
+.LL214:
+	__case		170
+	__ld.wi		15
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 82; case 200: return 16;
+.LL215:
+	__case		200
+	__ld.wi		16
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 83; case 230: return 17;
+.LL216:
+	__case		230
+	__ld.wi		17
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 84; case 255: return 18;
+.LL217:
+	__case		255
+	__ld.wi		18
+	__bra		.LL197
+
+	.dbg	line,	"tests/huc-switchsparse.c", 85; }
+.LL198:
+	__switch_t.ur	100, .LL218
+	__switch_t.ur	75, .LL219
+	__switch_t.ur	33, .LL220
+	__switch_c.ur	3
+
+!table:		db	20, 9, 0
+		dw	.LL199
+		dw	.LL202, .LL201, .LL200
+
+.LL220:
+	__switch_c.ur	3
+
+!table:		db	60, 47, 33
+		dw	.LL199
+		dw	.LL205, .LL204, .LL203
+
+.LL219:
+	__switch_c.ur	2
+
+!table:		db	88, 75
+		dw	.LL199
+		dw	.LL207, .LL206
+
+.LL218:
+	__switch_t.ur	130, .LL221
+	__switch_r.ur	100, 104
+
+!table:		dw	.LL208, .LL209, .LL210, .LL211, .LL212
+		dw	.LL199
+.LL221:
+	__switch_t.ur	230, .LL222
+	__switch_c.ur	3
+
+!table:		db	200, 170, 130
+		dw	.LL199
+		dw	.LL215, .LL214, .LL213
+
+.LL222:
+	__switch_c.ur	2
+
+!table:		db	255, 230
+		dw	.LL199
+		dw	.LL217, .LL216
+
+.LL199:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 86; return 0;
+	__ld.wi		0
+.LL197:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 87; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-switchsparse.c", 89; int sbytes(signed char c)
+	.dbg	line,	"tests/huc-switchsparse.c", 90; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_sbytes
+	__enter		_sbytes
+
+	.dbg	line,	"tests/huc-switchsparse.c", 91; switch (c) {
+	__ld.bs		0  /* c */
+	__bra		.LL224
+
+	.dbg	line,	"tests/huc-switchsparse.c", 92; case -128: return 1;
+.LL226:
+	__case		-128
+	__ld.wi		1
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 93; case -100: return 2;
+.LL227:
+	__case		-100
+	__ld.wi		2
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 94; case -70: return 3;
+.LL228:
+	__case		-70
+	__ld.wi		3
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 95; case -40: return 4;
+.LL229:
+	__case		-40
+	__ld.wi		4
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 96; case -10: return 5;
+.LL230:
+	__case		-10
+	__ld.wi		5
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 97; case -1: return 6;
+.LL231:
+	__case		-1
+	__ld.wi		6
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 98; case 0: return 7;
+.LL232:
+	__case		0
+	__ld.wi		7
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 99; case 1: return 8;
+.LL233:
+	__case		1
+	__ld.wi		8
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 100; case 30: return 9;
+.LL234:
+	__case		30
+	__ld.wi		9
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 101; case 60: return 10;
+.LL235:
+	__case		60
+	__ld.wi		10
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 102; case 90: return 11;
+.LL236:
+	__case		90
+	__ld.wi		11
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 103; case 127: return 12;
+.LL237:
+	__case		127
+	__ld.wi		12
+	__bra		.LL223
+
+	.dbg	line,	"tests/huc-switchsparse.c", 104; }
+.LL224:
+	__switch_t.ur	156, .LL238
+	__switch_t.ur	127, .LL239
+	__switch_t.ur	30, .LL240
+	__switch_r.ur	0, 1
+
+!table:		dw	.LL232, .LL233
+		dw	.LL225
+.LL240:
+	__switch_c.ur	3
+
+!table:		db	90, 60, 30
+		dw	.LL225
+		dw	.LL236, .LL235, .LL234
+
+.LL239:
+	__switch_r.ur	127, 128
+
+!table:		dw	.LL237, .LL226
+		dw	.LL225
+.LL238:
+	__switch_t.ur	246, .LL241
+	__switch_c.ur	3
+
+!table:		db	-40, -70, -100
+		dw	.LL225
+		dw	.LL229, .LL228, .LL227
+
+.LL241:
+	__switch_r.ur	246, 255
+
+!table:		dw	.LL230, .LL225, .LL225, .LL225, .LL225, .LL225, .LL225, .LL225
+		dw	.LL225, .LL231
+		dw	.LL225
+.LL225:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 105; return 0;
+	__ld.wi		0
+.LL223:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 106; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/huc-switchsparse.c", 108; const unsigned char ulist[] = {0, 9, 20, 33, 47, 60, 75, 88, 100, 101, 102, 103, 104, 130, 170, 200, 230, 255};
+	.dbg	line,	"tests/huc-switchsparse.c", 109; const signed char slist[] = {-128, -100, -70, -40, -10, -1, 0, 1, 30, 60, 90, 127};
+	.dbg	line,	"tests/huc-switchsparse.c", 111; int main()
+	.dbg	line,	"tests/huc-switchsparse.c", 112; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-switchsparse.c", 113; int i, j, n;
+
+	.dbg	line,	"tests/huc-switchsparse.c", 115; for (i = -2000; i < 6000; i++) {
+	__st.wmiq	-2000, __main_end - 2  /* i */
+.LL243:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	6000
+	__btrue		.LL245
+	__bra		.LL246
+.LL244:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL243
+.LL245:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 116; if (sparse(i) != expect(i))
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__call		_sparse
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__call		_expect
+	__neq_w.wt
+	__bfalse	.LL247
+
+	.dbg	line,	"tests/huc-switchsparse.c", 117; exit(1);
+	__ld.wi		1
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-switchsparse.c", 118; }
+.LL247	.alias		.LL244
+	__bra		.LL244
+.LL246:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 119; for (i = 29990; i < 30020; i++) {
+	__st.wmiq	29990, __main_end - 2  /* i */
+.LL248:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	30020
+	__btrue		.LL250
+	__bra		.LL251
+.LL249:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL248
+.LL250:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 120; if (sparse(i) != expect(i))
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__call		_sparse
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__call		_expect
+	__neq_w.wt
+	__bfalse	.LL252
+
+	.dbg	line,	"tests/huc-switchsparse.c", 121; exit(2);
+	__ld.wi		2
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-switchsparse.c", 122; }
+.LL252	.alias		.LL249
+	__bra		.LL249
+.LL251:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 123; if (sparse(-1000) != 3000 || sparse(40000) != 4000 || sparse(-32768) != -1)
+	__ld.wi		-1000
+	__pusharg.wr
+	__call		_sparse
+	__neq_w.wi	3000
+	__btrue		.LL254
+	__ld.wi		40000
+	__pusharg.wr
+	__call		_sparse
+	__neq_w.wi	4000
+.LL254:
+	__btrue		.LL255
+	__ld.wi		-32768
+	__pusharg.wr
+	__call		_sparse
+	__neq_w.wi	-1
+.LL255:
+	__bfalse	.LL253
+
+	.dbg	line,	"tests/huc-switchsparse.c", 124; exit(3);
+	__ld.wi		3
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-switchsparse.c", 126; for (i = 0; i < 256; i++) {
+.LL253:
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL256:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	256
+	__btrue		.LL258
+	__bra		.LL259
+.LL257:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL256
+.LL258:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 127; n = 0;
+	__st.wmiq	0, __main_end - 6  /* n */
+
+	.dbg	line,	"tests/huc-switchsparse.c", 128; for (j = 0; j < 18; j++)
+	__st.wmiq	0, __main_end - 4  /* j */
+.LL260:
+	__ld.wm		__main_end - 4  /* j */
+	__slt_w.wi	18
+	__btrue		.LL262
+	__bra		.LL263
+.LL261:
+	__inc.wmq	__main_end - 4  /* j */
+	__bra		.LL260
+.LL262:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 129; if (ulist[j] == i)
+	__ldx.wmq	__main_end - 4  /* j */
+	__ld.uax	_ulist
+	__equ_w.wm	__main_end - 2  /* i */
+	__bfalse	.LL264
+
+	.dbg	line,	"tests/huc-switchsparse.c", 130; n = j + 1;
+	__ld.wm		__main_end - 4  /* j */
+	__add.wi	1
+	__st.wmq	__main_end - 6  /* n */
+
+	.dbg	line,	"tests/huc-switchsparse.c", 131; if (bytes(i) != n)
+.LL264	.alias		.LL261
+	__bra		.LL261
+.LL263:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__call		_bytes
+	__neq_w.wm	__main_end - 6  /* n */
+	__bfalse	.LL265
+
+	.dbg	line,	"tests/huc-switchsparse.c", 132; exit(4);
+	__ld.wi		4
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-switchsparse.c", 133; }
+.LL265	.alias		.LL257
+	__bra		.LL257
+.LL259:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 134; for (i = -128; i < 128; i++) {
+	__st.wmiq	-128, __main_end - 2  /* i */
+.LL266:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	128
+	__btrue		.LL268
+	__bra		.LL269
+.LL267:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL266
+.LL268:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 135; n = 0;
+	__st.wmiq	0, __main_end - 6  /* n */
+
+	.dbg	line,	"tests/huc-switchsparse.c", 136; for (j = 0; j < 12; j++)
+	__st.wmiq	0, __main_end - 4  /* j */
+.LL270:
+	__ld.wm		__main_end - 4  /* j */
+	__slt_w.wi	12
+	__btrue		.LL272
+	__bra		.LL273
+.LL271:
+	__inc.wmq	__main_end - 4  /* j */
+	__bra		.LL270
+.LL272:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 137; if (slist[j] == i)
+	__ldx.wmq	__main_end - 4  /* j */
+	__ld.bax	_slist
+	__equ_w.wm	__main_end - 2  /* i */
+	__bfalse	.LL274
+
+	.dbg	line,	"tests/huc-switchsparse.c", 138; n = j + 1;
+	__ld.wm		__main_end - 4  /* j */
+	__add.wi	1
+	__st.wmq	__main_end - 6  /* n */
+
+	.dbg	line,	"tests/huc-switchsparse.c", 139; if (sbytes(i) != n)
+.LL274	.alias		.LL271
+	__bra		.LL271
+.LL273:
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__call		_sbytes
+	__neq_w.wm	__main_end - 6  /* n */
+	__bfalse	.LL275
+
+	.dbg	line,	"tests/huc-switchsparse.c", 140; exit(5);
+	__ld.wi		5
+	__call		_exit.1
+
+	.dbg	line,	"tests/huc-switchsparse.c", 141; }
+.LL275	.alias		.LL267
+	__bra		.LL267
+.LL269:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 142; return 0;
+	__ld.wi		0
+.LL242:
+
+	.dbg	line,	"tests/huc-switchsparse.c", 143; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-switchsparse.c", 145; #else
+	.dbg	line,	"tests/huc-switchsparse.c", 147; // more than 127 case labels are not supported in HuC.
+	.dbg	line,	"tests/huc-switchsparse.c", 148; main()
+	.dbg	line,	"tests/huc-switchsparse.c", 149; {
+	.dbg	line,	"tests/huc-switchsparse.c", 150; exit(0);
+	.dbg	line,	"tests/huc-switchsparse.c", 151; }
+	.dbg	line,	"tests/huc-switchsparse.c", 153; #endif // __HUCC__
+	.dbg	clear
+	.rodata
+_ulist:
+		db	0
+		db	9
+		db	20
+		db	33
+		db	47
+		db	60
+		db	75
+		db	88
+		db	100
+		db	101
+		db	102
+		db	103
+		db	104
+		db	130
+		db	170
+		db	200
+		db	230
+		db	255
+_slist:
+		db	-128
+		db	-100
+		db	-70
+		db	-40
+		db	-10
+		db	-1
+		db	0
+		db	1
+		db	30
+		db	60
+		db	90
+		db	127
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:30
+;	global pool:8
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _main
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;      2144     72     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 72, 2144
+__main_end	=	__overlay_frames + 6
+	.endm
@@ -0,0 +1,2616 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-symhash.c", 1; /* more globals than there are hash buckets, with locals that shadow them */
+	.dbg	line,	"tests/huc-symhash.c", 3; char g0000, g0001, g0002, g0003, g0004, g0005, g0006, g0007, g0008, g0009;
+	.dbg	line,	"tests/huc-symhash.c", 4; char g0010, g0011, g0012, g0013, g0014, g0015, g0016, g0017, g0018, g0019;
+	.dbg	line,	"tests/huc-symhash.c", 5; char g0020, g0021, g0022, g0023, g0024, g0025, g0026, g0027, g0028, g0029;
+	.dbg	line,	"tests/huc-symhash.c", 6; char g0030, g0031, g0032, g0033, g0034, g0035, g0036, g0037, g0038, g0039;
+	.dbg	line,	"tests/huc-symhash.c", 7; char g0040, g0041, g0042, g0043, g0044, g0045, g0046, g0047, g0048, g0049;
+	.dbg	line,	"tests/huc-symhash.c", 8; char g0050, g0051, g0052, g0053, g0054, g0055, g0056, g0057, g0058, g0059;
+	.dbg	line,	"tests/huc-symhash.c", 9; char g0060, g0061, g0062, g0063, g0064, g0065, g0066, g0067, g0068, g0069;
+	.dbg	line,	"tests/huc-symhash.c", 10; char g0070, g0071, g0072, g0073, g0074, g0075, g0076, g0077, g0078, g0079;
+	.dbg	line,	"tests/huc-symhash.c", 11; char g0080, g0081, g0082, g0083, g0084, g0085, g0086, g0087, g0088, g0089;
+	.dbg	line,	"tests/huc-symhash.c", 12; char g0090, g0091, g0092, g0093, g0094, g0095, g0096, g0097, g0098, g0099;
+	.dbg	line,	"tests/huc-symhash.c", 13; char g0100, g0101, g0102, g0103, g0104, g0105, g0106, g0107, g0108, g0109;
+	.dbg	line,	"tests/huc-symhash.c", 14; char g0110, g0111, g0112, g0113, g0114, g0115, g0116, g0117, g0118, g0119;
+	.dbg	line,	"tests/huc-symhash.c", 15; char g0120, g0121, g0122, g0123, g0124, g0125, g0126, g0127, g0128, g0129;
+	.dbg	line,	"tests/huc-symhash.c", 16; char g0130, g0131, g0132, g0133, g0134, g0135, g0136, g0137, g0138, g0139;
+	.dbg	line,	"tests/huc-symhash.c", 17; char g0140, g0141, g0142, g0143, g0144, g0145, g0146, g0147, g0148, g0149;
+	.dbg	line,	"tests/huc-symhash.c", 18; char g0150, g0151, g0152, g0153, g0154, g0155, g0156, g0157, g0158, g0159;
+	.dbg	line,	"tests/huc-symhash.c", 19; char g0160, g0161, g0162, g0163, g0164, g0165, g0166, g0167, g0168, g0169;
+	.dbg	line,	"tests/huc-symhash.c", 20; char g0170, g0171, g0172, g0173, g0174, g0175, g0176, g0177, g0178, g0179;
+	.dbg	line,	"tests/huc-symhash.c", 21; char g0180, g0181, g0182, g0183, g0184, g0185, g0186, g0187, g0188, g0189;
+	.dbg	line,	"tests/huc-symhash.c", 22; char g0190, g0191, g0192, g0193, g0194, g0195, g0196, g0197, g0198, g0199;
+	.dbg	line,	"tests/huc-symhash.c", 23; char g0200, g0201, g0202, g0203, g0204, g0205, g0206, g0207, g0208, g0209;
+	.dbg	line,	"tests/huc-symhash.c", 24; char g0210, g0211, g0212, g0213, g0214, g0215, g0216, g0217, g0218, g0219;
+	.dbg	line,	"tests/huc-symhash.c", 25; char g0220, g0221, g0222, g0223, g0224, g0225, g0226, g0227, g0228, g0229;
+	.dbg	line,	"tests/huc-symhash.c", 26; char g0230, g0231, g0232, g0233, g0234, g0235, g0236, g0237, g0238, g0239;
+	.dbg	line,	"tests/huc-symhash.c", 27; char g0240, g0241, g0242, g0243, g0244, g0245, g0246, g0247, g0248, g0249;
+	.dbg	line,	"tests/huc-symhash.c", 28; char g0250, g0251, g0252, g0253, g0254, g0255, g0256, g0257, g0258, g0259;
+	.dbg	line,	"tests/huc-symhash.c", 29; char g0260, g0261, g0262, g0263, g0264, g0265, g0266, g0267, g0268, g0269;
+	.dbg	line,	"tests/huc-symhash.c", 30; char g0270, g0271, g0272, g0273, g0274, g0275, g0276, g0277, g0278, g0279;
+	.dbg	line,	"tests/huc-symhash.c", 31; char g0280, g0281, g0282, g0283, g0284, g0285, g0286, g0287, g0288, g0289;
+	.dbg	line,	"tests/huc-symhash.c", 32; char g0290, g0291, g0292, g0293, g0294, g0295, g0296, g0297, g0298, g0299;
+	.dbg	line,	"tests/huc-symhash.c", 33; char g0300, g0301, g0302, g0303, g0304, g0305, g0306, g0307, g0308, g0309;
+	.dbg	line,	"tests/huc-symhash.c", 34; char g0310, g0311, g0312, g0313, g0314, g0315, g0316, g0317, g0318, g0319;
+	.dbg	line,	"tests/huc-symhash.c", 35; char g0320, g0321, g0322, g0323, g0324, g0325, g0326, g0327, g0328, g0329;
+	.dbg	line,	"tests/huc-symhash.c", 36; char g0330, g0331, g0332, g0333, g0334, g0335, g0336, g0337, g0338, g0339;
+	.dbg	line,	"tests/huc-symhash.c", 37; char g0340, g0341, g0342, g0343, g0344, g0345, g0346, g0347, g0348, g0349;
+	.dbg	line,	"tests/huc-symhash.c", 38; char g0350, g0351, g0352, g0353, g0354, g0355, g0356, g0357, g0358, g0359;
+	.dbg	line,	"tests/huc-symhash.c", 39; char g0360, g0361, g0362, g0363, g0364, g0365, g0366, g0367, g0368, g0369;
+	.dbg	line,	"tests/huc-symhash.c", 40; char g0370, g0371, g0372, g0373, g0374, g0375, g0376, g0377, g0378, g0379;
+	.dbg	line,	"tests/huc-symhash.c", 41; char g0380, g0381, g0382, g0383, g0384, g0385, g0386, g0387, g0388, g0389;
+	.dbg	line,	"tests/huc-symhash.c", 42; char g0390, g0391, g0392, g0393, g0394, g0395, g0396, g0397, g0398, g0399;
+	.dbg	line,	"tests/huc-symhash.c", 43; char g0400, g0401, g0402, g0403, g0404, g0405, g0406, g0407, g0408, g0409;
+	.dbg	line,	"tests/huc-symhash.c", 44; char g0410, g0411, g0412, g0413, g0414, g0415, g0416, g0417, g0418, g0419;
+	.dbg	line,	"tests/huc-symhash.c", 45; char g0420, g0421, g0422, g0423, g0424, g0425, g0426, g0427, g0428, g0429;
+	.dbg	line,	"tests/huc-symhash.c", 46; char g0430, g0431, g0432, g0433, g0434, g0435, g0436, g0437, g0438, g0439;
+	.dbg	line,	"tests/huc-symhash.c", 47; char g0440, g0441, g0442, g0443, g0444, g0445, g0446, g0447, g0448, g0449;
+	.dbg	line,	"tests/huc-symhash.c", 48; char g0450, g0451, g0452, g0453, g0454, g0455, g0456, g0457, g0458, g0459;
+	.dbg	line,	"tests/huc-symhash.c", 49; char g0460, g0461, g0462, g0463, g0464, g0465, g0466, g0467, g0468, g0469;
+	.dbg	line,	"tests/huc-symhash.c", 50; char g0470, g0471, g0472, g0473, g0474, g0475, g0476, g0477, g0478, g0479;
+	.dbg	line,	"tests/huc-symhash.c", 51; char g0480, g0481, g0482, g0483, g0484, g0485, g0486, g0487, g0488, g0489;
+	.dbg	line,	"tests/huc-symhash.c", 52; char g0490, g0491, g0492, g0493, g0494, g0495, g0496, g0497, g0498, g0499;
+	.dbg	line,	"tests/huc-symhash.c", 53; char g0500, g0501, g0502, g0503, g0504, g0505, g0506, g0507, g0508, g0509;
+	.dbg	line,	"tests/huc-symhash.c", 54; char g0510, g0511, g0512, g0513, g0514, g0515, g0516, g0517, g0518, g0519;
+	.dbg	line,	"tests/huc-symhash.c", 55; char g0520, g0521, g0522, g0523, g0524, g0525, g0526, g0527, g0528, g0529;
+	.dbg	line,	"tests/huc-symhash.c", 56; char g0530, g0531, g0532, g0533, g0534, g0535, g0536, g0537, g0538, g0539;
+	.dbg	line,	"tests/huc-symhash.c", 57; char g0540, g0541, g0542, g0543, g0544, g0545, g0546, g0547, g0548, g0549;
+	.dbg	line,	"tests/huc-symhash.c", 58; char g0550, g0551, g0552, g0553, g0554, g0555, g0556, g0557, g0558, g0559;
+	.dbg	line,	"tests/huc-symhash.c", 59; char g0560, g0561, g0562, g0563, g0564, g0565, g0566, g0567, g0568, g0569;
+	.dbg	line,	"tests/huc-symhash.c", 60; char g0570, g0571, g0572, g0573, g0574, g0575, g0576, g0577, g0578, g0579;
+	.dbg	line,	"tests/huc-symhash.c", 61; char g0580, g0581, g0582, g0583, g0584, g0585, g0586, g0587, g0588, g0589;
+	.dbg	line,	"tests/huc-symhash.c", 62; char g0590, g0591, g0592, g0593, g0594, g0595, g0596, g0597, g0598, g0599;
+	.dbg	line,	"tests/huc-symhash.c", 63; char g0600, g0601, g0602, g0603, g0604, g0605, g0606, g0607, g0608, g0609;
+	.dbg	line,	"tests/huc-symhash.c", 64; char g0610, g0611, g0612, g0613, g0614, g0615, g0616, g0617, g0618, g0619;
+	.dbg	line,	"tests/huc-symhash.c", 65; char g0620, g0621, g0622, g0623, g0624, g0625, g0626, g0627, g0628, g0629;
+	.dbg	line,	"tests/huc-symhash.c", 66; char g0630, g0631, g0632, g0633, g0634, g0635, g0636, g0637, g0638, g0639;
+	.dbg	line,	"tests/huc-symhash.c", 67; char g0640, g0641, g0642, g0643, g0644, g0645, g0646, g0647, g0648, g0649;
+	.dbg	line,	"tests/huc-symhash.c", 68; char g0650, g0651, g0652, g0653, g0654, g0655, g0656, g0657, g0658, g0659;
+	.dbg	line,	"tests/huc-symhash.c", 69; char g0660, g0661, g0662, g0663, g0664, g0665, g0666, g0667, g0668, g0669;
+	.dbg	line,	"tests/huc-symhash.c", 70; char g0670, g0671, g0672, g0673, g0674, g0675, g0676, g0677, g0678, g0679;
+	.dbg	line,	"tests/huc-symhash.c", 71; char g0680, g0681, g0682, g0683, g0684, g0685, g0686, g0687, g0688, g0689;
+	.dbg	line,	"tests/huc-symhash.c", 72; char g0690, g0691, g0692, g0693, g0694, g0695, g0696, g0697, g0698, g0699;
+	.dbg	line,	"tests/huc-symhash.c", 73; char g0700, g0701, g0702, g0703, g0704, g0705, g0706, g0707, g0708, g0709;
+	.dbg	line,	"tests/huc-symhash.c", 74; char g0710, g0711, g0712, g0713, g0714, g0715, g0716, g0717, g0718, g0719;
+	.dbg	line,	"tests/huc-symhash.c", 75; char g0720, g0721, g0722, g0723, g0724, g0725, g0726, g0727, g0728, g0729;
+	.dbg	line,	"tests/huc-symhash.c", 76; char g0730, g0731, g0732, g0733, g0734, g0735, g0736, g0737, g0738, g0739;
+	.dbg	line,	"tests/huc-symhash.c", 77; char g0740, g0741, g0742, g0743, g0744, g0745, g0746, g0747, g0748, g0749;
+	.dbg	line,	"tests/huc-symhash.c", 78; char g0750, g0751, g0752, g0753, g0754, g0755, g0756, g0757, g0758, g0759;
+	.dbg	line,	"tests/huc-symhash.c", 79; char g0760, g0761, g0762, g0763, g0764, g0765, g0766, g0767, g0768, g0769;
+	.dbg	line,	"tests/huc-symhash.c", 80; char g0770, g0771, g0772, g0773, g0774, g0775, g0776, g0777, g0778, g0779;
+	.dbg	line,	"tests/huc-symhash.c", 81; char g0780, g0781, g0782, g0783, g0784, g0785, g0786, g0787, g0788, g0789;
+	.dbg	line,	"tests/huc-symhash.c", 82; char g0790, g0791, g0792, g0793, g0794, g0795, g0796, g0797, g0798, g0799;
+	.dbg	line,	"tests/huc-symhash.c", 83; char g0800, g0801, g0802, g0803, g0804, g0805, g0806, g0807, g0808, g0809;
+	.dbg	line,	"tests/huc-symhash.c", 84; char g0810, g0811, g0812, g0813, g0814, g0815, g0816, g0817, g0818, g0819;
+	.dbg	line,	"tests/huc-symhash.c", 85; char g0820, g0821, g0822, g0823, g0824, g0825, g0826, g0827, g0828, g0829;
+	.dbg	line,	"tests/huc-symhash.c", 86; char g0830, g0831, g0832, g0833, g0834, g0835, g0836, g0837, g0838, g0839;
+	.dbg	line,	"tests/huc-symhash.c", 87; char g0840, g0841, g0842, g0843, g0844, g0845, g0846, g0847, g0848, g0849;
+	.dbg	line,	"tests/huc-symhash.c", 88; char g0850, g0851, g0852, g0853, g0854, g0855, g0856, g0857, g0858, g0859;
+	.dbg	line,	"tests/huc-symhash.c", 89; char g0860, g0861, g0862, g0863, g0864, g0865, g0866, g0867, g0868, g0869;
+	.dbg	line,	"tests/huc-symhash.c", 90; char g0870, g0871, g0872, g0873, g0874, g0875, g0876, g0877, g0878, g0879;
+	.dbg	line,	"tests/huc-symhash.c", 91; char g0880, g0881, g0882, g0883, g0884, g0885, g0886, g0887, g0888, g0889;
+	.dbg	line,	"tests/huc-symhash.c", 92; char g0890, g0891, g0892, g0893, g0894, g0895, g0896, g0897, g0898, g0899;
+	.dbg	line,	"tests/huc-symhash.c", 93; char g0900, g0901, g0902, g0903, g0904, g0905, g0906, g0907, g0908, g0909;
+	.dbg	line,	"tests/huc-symhash.c", 94; char g0910, g0911, g0912, g0913, g0914, g0915, g0916, g0917, g0918, g0919;
+	.dbg	line,	"tests/huc-symhash.c", 95; char g0920, g0921, g0922, g0923, g0924, g0925, g0926, g0927, g0928, g0929;
+	.dbg	line,	"tests/huc-symhash.c", 96; char g0930, g0931, g0932, g0933, g0934, g0935, g0936, g0937, g0938, g0939;
+	.dbg	line,	"tests/huc-symhash.c", 97; char g0940, g0941, g0942, g0943, g0944, g0945, g0946, g0947, g0948, g0949;
+	.dbg	line,	"tests/huc-symhash.c", 98; char g0950, g0951, g0952, g0953, g0954, g0955, g0956, g0957, g0958, g0959;
+	.dbg	line,	"tests/huc-symhash.c", 99; char g0960, g0961, g0962, g0963, g0964, g0965, g0966, g0967, g0968, g0969;
+	.dbg	line,	"tests/huc-symhash.c", 100; char g0970, g0971, g0972, g0973, g0974, g0975, g0976, g0977, g0978, g0979;
+	.dbg	line,	"tests/huc-symhash.c", 101; char g0980, g0981, g0982, g0983, g0984, g0985, g0986, g0987, g0988, g0989;
+	.dbg	line,	"tests/huc-symhash.c", 102; char g0990, g0991, g0992, g0993, g0994, g0995, g0996, g0997, g0998, g0999;
+	.dbg	line,	"tests/huc-symhash.c", 103; char g1000, g1001, g1002, g1003, g1004, g1005, g1006, g1007, g1008, g1009;
+	.dbg	line,	"tests/huc-symhash.c", 104; char g1010, g1011, g1012, g1013, g1014, g1015, g1016, g1017, g1018, g1019;
+	.dbg	line,	"tests/huc-symhash.c", 105; char g1020, g1021, g1022, g1023, g1024, g1025, g1026, g1027, g1028, g1029;
+	.dbg	line,	"tests/huc-symhash.c", 106; char g1030, g1031, g1032, g1033, g1034, g1035, g1036, g1037, g1038, g1039;
+	.dbg	line,	"tests/huc-symhash.c", 107; char g1040, g1041, g1042, g1043, g1044, g1045, g1046, g1047, g1048, g1049;
+	.dbg	line,	"tests/huc-symhash.c", 108; char g1050, g1051, g1052, g1053, g1054, g1055, g1056, g1057, g1058, g1059;
+	.dbg	line,	"tests/huc-symhash.c", 109; char g1060, g1061, g1062, g1063, g1064, g1065, g1066, g1067, g1068, g1069;
+	.dbg	line,	"tests/huc-symhash.c", 110; char g1070, g1071, g1072, g1073, g1074, g1075, g1076, g1077, g1078, g1079;
+	.dbg	line,	"tests/huc-symhash.c", 111; char g1080, g1081, g1082, g1083, g1084, g1085, g1086, g1087, g1088, g1089;
+	.dbg	line,	"tests/huc-symhash.c", 112; char g1090, g1091, g1092, g1093, g1094, g1095, g1096, g1097, g1098, g1099;
+	.dbg	line,	"tests/huc-symhash.c", 114; int shadow(void)
+	.dbg	line,	"tests/huc-symhash.c", 115; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_shadow
+	__enter		_shadow
+
+	.dbg	line,	"tests/huc-symhash.c", 116; int g0005, g1099;
+
+	.dbg	line,	"tests/huc-symhash.c", 118; g0005 = 300;
+	__st.wmiq	300, __shadow_end - 2  /* g0005 */
+
+	.dbg	line,	"tests/huc-symhash.c", 119; g1099 = 400;
+	__st.wmiq	400, __shadow_end - 4  /* g1099 */
+
+	.dbg	line,	"tests/huc-symhash.c", 120; return g0005 + g1099;
+	__ld.wm		__shadow_end - 2  /* g0005 */
+	__add.wm	__shadow_end - 4  /* g1099 */
+.LL2:
+
+	.dbg	line,	"tests/huc-symhash.c", 121; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__shadow_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-symhash.c", 123; int siblings(int k)
+	.dbg	line,	"tests/huc-symhash.c", 124; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_siblings
+	__enter		_siblings
+
+	.dbg	line,	"tests/huc-symhash.c", 125; int n;
+
+	.dbg	line,	"tests/huc-symhash.c", 127; n = 0;
+	__st.wmiq	0, __siblings_end - 2  /* n */
+
+	.dbg	line,	"tests/huc-symhash.c", 128; if (k) {
+	__tst.ws	0  /* k */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/huc-symhash.c", 129; int a, g0010;
+
+	.dbg	line,	"tests/huc-symhash.c", 130; a = 1;
+	__st.wmiq	1, __siblings_end - 4  /* g0010 */
+
+	.dbg	line,	"tests/huc-symhash.c", 131; g0010 = 1000;
+	__st.wmiq	1000, __siblings_end - 6  /* a */
+
+	.dbg	line,	"tests/huc-symhash.c", 132; n += a + g0010;
+	__ld.wm		__siblings_end - 4  /* g0010 */
+	__add.wm	__siblings_end - 6  /* a */
+	__add_st.wmq	__siblings_end - 2  /* n */
+
+	.dbg	line,	"tests/huc-symhash.c", 133; }
+
+	.dbg	line,	"tests/huc-symhash.c", 134; if (k) {
+.LL4:
+	__tst.ws	0  /* k */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/huc-symhash.c", 135; /* the same names again, once the first block's are trimmed */
+
+	.dbg	line,	"tests/huc-symhash.c", 136; char g0010, a;
+
+	.dbg	line,	"tests/huc-symhash.c", 137; g0010 = 20;
+	__st.umiq	20, __siblings_end - 7  /* g0010 */
+
+	.dbg	line,	"tests/huc-symhash.c", 138; a = 2;
+	__st.umiq	2, __siblings_end - 8  /* a */
+
+	.dbg	line,	"tests/huc-symhash.c", 139; n += a + g0010;
+	__ld.um		__siblings_end - 8  /* a */
+	__add.um	__siblings_end - 7  /* g0010 */
+	__add_st.wmq	__siblings_end - 2  /* n */
+
+	.dbg	line,	"tests/huc-symhash.c", 140; }
+
+	.dbg	line,	"tests/huc-symhash.c", 141; if (k) {
+.LL5:
+	__tst.ws	0  /* k */
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/huc-symhash.c", 142; int g0010;
+
+	.dbg	line,	"tests/huc-symhash.c", 143; g0010 = 300;
+	__st.wmiq	300, __siblings_end - 10  /* g0010 */
+
+	.dbg	line,	"tests/huc-symhash.c", 144; n += g0010;
+	__ld.wm		__siblings_end - 10  /* g0010 */
+	__add_st.wmq	__siblings_end - 2  /* n */
+
+	.dbg	line,	"tests/huc-symhash.c", 145; }
+
+	.dbg	line,	"tests/huc-symhash.c", 146; return n;
+.LL6:
+	__ld.wm		__siblings_end - 2  /* n */
+.LL3:
+
+	.dbg	line,	"tests/huc-symhash.c", 147; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__siblings_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/huc-symhash.c", 149; /* declared after the locals above have gone */
+	.dbg	line,	"tests/huc-symhash.c", 150; int g1100, a;
+	.dbg	line,	"tests/huc-symhash.c", 152; int main()
+	.dbg	line,	"tests/huc-symhash.c", 153; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-symhash.c", 154; g0000 = 1;
+	__st.umiq	1, _g0000
+
+	.dbg	line,	"tests/huc-symhash.c", 155; g0005 = 5;
+	__st.umiq	5, _g0005
+
+	.dbg	line,	"tests/huc-symhash.c", 156; g0010 = 10;
+	__st.umiq	10, _g0010
+
+	.dbg	line,	"tests/huc-symhash.c", 157; g0517 = 17;
+	__st.umiq	17, _g0517
+
+	.dbg	line,	"tests/huc-symhash.c", 158; g1099 = 99;
+	__st.umiq	99, _g1099
+
+	.dbg	line,	"tests/huc-symhash.c", 159; g1100 = 1100;
+	__st.wmiq	1100, _g1100
+
+	.dbg	line,	"tests/huc-symhash.c", 160; a = 7;
+	__st.wmiq	7, _a
+
+	.dbg	line,	"tests/huc-symhash.c", 162; if (shadow() != 700)
+	__st.wmiq	300, __shadow_end - 2  /* g0005 */
+	__st.wmiq	400, __shadow_end - 4  /* g1099 */
+	__ld.wm		__shadow_end - 2  /* g0005 */
+	__add.wm	__shadow_end - 4  /* g1099 */
+.LL9:
+	__neq_w.wi	700
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/huc-symhash.c", 163; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-symhash.c", 164; if (siblings(3) != 1323)
+.LL8:
+	__ld.wi		3
+	__pusharg.wr
+	__call		_siblings
+	__neq_w.wi	1323
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/huc-symhash.c", 165; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-symhash.c", 167; /* the globals are untouched by the locals */
+
+	.dbg	line,	"tests/huc-symhash.c", 168; if (g0000 != 1 || g0005 != 5 || g0010 != 10 || g0517 != 17 || g1099 != 99)
+.LL10:
+	__ld.umq	_g0000
+	__neq_b.uiq	1
+	__btrue		.LL12
+	__ld.umq	_g0005
+	__neq_b.uiq	5
+.LL12:
+	__btrue		.LL13
+	__ld.umq	_g0010
+	__neq_b.uiq	10
+.LL13:
+	__btrue		.LL14
+	__ld.umq	_g0517
+	__neq_b.uiq	17
+.LL14:
+	__btrue		.LL15
+	__ld.umq	_g1099
+	__neq_b.uiq	99
+.LL15:
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/huc-symhash.c", 169; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-symhash.c", 170; if (g1100 != 1100 || a != 7)
+.LL11:
+	__ld.wm		_g1100
+	__neq_w.wi	1100
+	__btrue		.LL17
+	__ld.wm		_a
+	__neq_w.wi	7
+.LL17:
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/huc-symhash.c", 171; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-symhash.c", 172; return 0;
+.LL16:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/huc-symhash.c", 173; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 10
+leaf_needs	.set	10
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:1106
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         3      3     1  g0000
+;         3      3     1  g0005
+;         3      3     1  g0010
+;         3      3     1  g0517
+;         3      3     1  g1099
+;         4      4     2  a
+;         4      4     2  g1100
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_g0000, 1, 3, 3
+	auto_zp_var	_g0005, 1, 3, 3
+	auto_zp_var	_g0010, 1, 3, 3
+	auto_zp_var	_g0517, 1, 3, 3
+	auto_zp_var	_g1099, 1, 3, 3
+	auto_zp_var	_a, 2, 4, 4
+	auto_zp_var	_g1100, 2, 4, 4
+	.endm
+
+	.bss
+_g0001:
+		ds	1
+_g0002:
+		ds	1
+_g0003:
+		ds	1
+_g0004:
+		ds	1
+_g0006:
+		ds	1
+_g0007:
+		ds	1
+_g0008:
+		ds	1
+_g0009:
+		ds	1
+_g0011:
+		ds	1
+_g0012:
+		ds	1
+_g0013:
+		ds	1
+_g0014:
+		ds	1
+_g0015:
+		ds	1
+_g0016:
+		ds	1
+_g0017:
+		ds	1
+_g0018:
+		ds	1
+_g0019:
+		ds	1
+_g0020:
+		ds	1
+_g0021:
+		ds	1
+_g0022:
+		ds	1
+_g0023:
+		ds	1
+_g0024:
+		ds	1
+_g0025:
+		ds	1
+_g0026:
+		ds	1
+_g0027:
+		ds	1
+_g0028:
+		ds	1
+_g0029:
+		ds	1
+_g0030:
+		ds	1
+_g0031:
+		ds	1
+_g0032:
+		ds	1
+_g0033:
+		ds	1
+_g0034:
+		ds	1
+_g0035:
+		ds	1
+_g0036:
+		ds	1
+_g0037:
+		ds	1
+_g0038:
+		ds	1
+_g0039:
+		ds	1
+_g0040:
+		ds	1
+_g0041:
+		ds	1
+_g0042:
+		ds	1
+_g0043:
+		ds	1
+_g0044:
+		ds	1
+_g0045:
+		ds	1
+_g0046:
+		ds	1
+_g0047:
+		ds	1
+_g0048:
+		ds	1
+_g0049:
+		ds	1
+_g0050:
+		ds	1
+_g0051:
+		ds	1
+_g0052:
+		ds	1
+_g0053:
+		ds	1
+_g0054:
+		ds	1
+_g0055:
+		ds	1
+_g0056:
+		ds	1
+_g0057:
+		ds	1
+_g0058:
+		ds	1
+_g0059:
+		ds	1
+_g0060:
+		ds	1
+_g0061:
+		ds	1
+_g0062:
+		ds	1
+_g0063:
+		ds	1
+_g0064:
+		ds	1
+_g0065:
+		ds	1
+_g0066:
+		ds	1
+_g0067:
+		ds	1
+_g0068:
+		ds	1
+_g0069:
+		ds	1
+_g0070:
+		ds	1
+_g0071:
+		ds	1
+_g0072:
+		ds	1
+_g0073:
+		ds	1
+_g0074:
+		ds	1
+_g0075:
+		ds	1
+_g0076:
+		ds	1
+_g0077:
+		ds	1
+_g0078:
+		ds	1
+_g0079:
+		ds	1
+_g0080:
+		ds	1
+_g0081:
+		ds	1
+_g0082:
+		ds	1
+_g0083:
+		ds	1
+_g0084:
+		ds	1
+_g0085:
+		ds	1
+_g0086:
+		ds	1
+_g0087:
+		ds	1
+_g0088:
+		ds	1
+_g0089:
+		ds	1
+_g0090:
+		ds	1
+_g0091:
+		ds	1
+_g0092:
+		ds	1
+_g0093:
+		ds	1
+_g0094:
+		ds	1
+_g0095:
+		ds	1
+_g0096:
+		ds	1
+_g0097:
+		ds	1
+_g0098:
+		ds	1
+_g0099:
+		ds	1
+_g0100:
+		ds	1
+_g0101:
+		ds	1
+_g0102:
+		ds	1
+_g0103:
+		ds	1
+_g0104:
+		ds	1
+_g0105:
+		ds	1
+_g0106:
+		ds	1
+_g0107:
+		ds	1
+_g0108:
+		ds	1
+_g0109:
+		ds	1
+_g0110:
+		ds	1
+_g0111:
+		ds	1
+_g0112:
+		ds	1
+_g0113:
+		ds	1
+_g0114:
+		ds	1
+_g0115:
+		ds	1
+_g0116:
+		ds	1
+_g0117:
+		ds	1
+_g0118:
+		ds	1
+_g0119:
+		ds	1
+_g0120:
+		ds	1
+_g0121:
+		ds	1
+_g0122:
+		ds	1
+_g0123:
+		ds	1
+_g0124:
+		ds	1
+_g0125:
+		ds	1
+_g0126:
+		ds	1
+_g0127:
+		ds	1
+_g0128:
+		ds	1
+_g0129:
+		ds	1
+_g0130:
+		ds	1
+_g0131:
+		ds	1
+_g0132:
+		ds	1
+_g0133:
+		ds	1
+_g0134:
+		ds	1
+_g0135:
+		ds	1
+_g0136:
+		ds	1
+_g0137:
+		ds	1
+_g0138:
+		ds	1
+_g0139:
+		ds	1
+_g0140:
+		ds	1
+_g0141:
+		ds	1
+_g0142:
+		ds	1
+_g0143:
+		ds	1
+_g0144:
+		ds	1
+_g0145:
+		ds	1
+_g0146:
+		ds	1
+_g0147:
+		ds	1
+_g0148:
+		ds	1
+_g0149:
+		ds	1
+_g0150:
+		ds	1
+_g0151:
+		ds	1
+_g0152:
+		ds	1
+_g0153:
+		ds	1
+_g0154:
+		ds	1
+_g0155:
+		ds	1
+_g0156:
+		ds	1
+_g0157:
+		ds	1
+_g0158:
+		ds	1
+_g0159:
+		ds	1
+_g0160:
+		ds	1
+_g0161:
+		ds	1
+_g0162:
+		ds	1
+_g0163:
+		ds	1
+_g0164:
+		ds	1
+_g0165:
+		ds	1
+_g0166:
+		ds	1
+_g0167:
+		ds	1
+_g0168:
+		ds	1
+_g0169:
+		ds	1
+_g0170:
+		ds	1
+_g0171:
+		ds	1
+_g0172:
+		ds	1
+_g0173:
+		ds	1
+_g0174:
+		ds	1
+_g0175:
+		ds	1
+_g0176:
+		ds	1
+_g0177:
+		ds	1
+_g0178:
+		ds	1
+_g0179:
+		ds	1
+_g0180:
+		ds	1
+_g0181:
+		ds	1
+_g0182:
+		ds	1
+_g0183:
+		ds	1
+_g0184:
+		ds	1
+_g0185:
+		ds	1
+_g0186:
+		ds	1
+_g0187:
+		ds	1
+_g0188:
+		ds	1
+_g0189:
+		ds	1
+_g0190:
+		ds	1
+_g0191:
+		ds	1
+_g0192:
+		ds	1
+_g0193:
+		ds	1
+_g0194:
+		ds	1
+_g0195:
+		ds	1
+_g0196:
+		ds	1
+_g0197:
+		ds	1
+_g0198:
+		ds	1
+_g0199:
+		ds	1
+_g0200:
+		ds	1
+_g0201:
+		ds	1
+_g0202:
+		ds	1
+_g0203:
+		ds	1
+_g0204:
+		ds	1
+_g0205:
+		ds	1
+_g0206:
+		ds	1
+_g0207:
+		ds	1
+_g0208:
+		ds	1
+_g0209:
+		ds	1
+_g0210:
+		ds	1
+_g0211:
+		ds	1
+_g0212:
+		ds	1
+_g0213:
+		ds	1
+_g0214:
+		ds	1
+_g0215:
+		ds	1
+_g0216:
+		ds	1
+_g0217:
+		ds	1
+_g0218:
+		ds	1
+_g0219:
+		ds	1
+_g0220:
+		ds	1
+_g0221:
+		ds	1
+_g0222:
+		ds	1
+_g0223:
+		ds	1
+_g0224:
+		ds	1
+_g0225:
+		ds	1
+_g0226:
+		ds	1
+_g0227:
+		ds	1
+_g0228:
+		ds	1
+_g0229:
+		ds	1
+_g0230:
+		ds	1
+_g0231:
+		ds	1
+_g0232:
+		ds	1
+_g0233:
+		ds	1
+_g0234:
+		ds	1
+_g0235:
+		ds	1
+_g0236:
+		ds	1
+_g0237:
+		ds	1
+_g0238:
+		ds	1
+_g0239:
+		ds	1
+_g0240:
+		ds	1
+_g0241:
+		ds	1
+_g0242:
+		ds	1
+_g0243:
+		ds	1
+_g0244:
+		ds	1
+_g0245:
+		ds	1
+_g0246:
+		ds	1
+_g0247:
+		ds	1
+_g0248:
+		ds	1
+_g0249:
+		ds	1
+_g0250:
+		ds	1
+_g0251:
+		ds	1
+_g0252:
+		ds	1
+_g0253:
+		ds	1
+_g0254:
+		ds	1
+_g0255:
+		ds	1
+_g0256:
+		ds	1
+_g0257:
+		ds	1
+_g0258:
+		ds	1
+_g0259:
+		ds	1
+_g0260:
+		ds	1
+_g0261:
+		ds	1
+_g0262:
+		ds	1
+_g0263:
+		ds	1
+_g0264:
+		ds	1
+_g0265:
+		ds	1
+_g0266:
+		ds	1
+_g0267:
+		ds	1
+_g0268:
+		ds	1
+_g0269:
+		ds	1
+_g0270:
+		ds	1
+_g0271:
+		ds	1
+_g0272:
+		ds	1
+_g0273:
+		ds	1
+_g0274:
+		ds	1
+_g0275:
+		ds	1
+_g0276:
+		ds	1
+_g0277:
+		ds	1
+_g0278:
+		ds	1
+_g0279:
+		ds	1
+_g0280:
+		ds	1
+_g0281:
+		ds	1
+_g0282:
+		ds	1
+_g0283:
+		ds	1
+_g0284:
+		ds	1
+_g0285:
+		ds	1
+_g0286:
+		ds	1
+_g0287:
+		ds	1
+_g0288:
+		ds	1
+_g0289:
+		ds	1
+_g0290:
+		ds	1
+_g0291:
+		ds	1
+_g0292:
+		ds	1
+_g0293:
+		ds	1
+_g0294:
+		ds	1
+_g0295:
+		ds	1
+_g0296:
+		ds	1
+_g0297:
+		ds	1
+_g0298:
+		ds	1
+_g0299:
+		ds	1
+_g0300:
+		ds	1
+_g0301:
+		ds	1
+_g0302:
+		ds	1
+_g0303:
+		ds	1
+_g0304:
+		ds	1
+_g0305:
+		ds	1
+_g0306:
+		ds	1
+_g0307:
+		ds	1
+_g0308:
+		ds	1
+_g0309:
+		ds	1
+_g0310:
+		ds	1
+_g0311:
+		ds	1
+_g0312:
+		ds	1
+_g0313:
+		ds	1
+_g0314:
+		ds	1
+_g0315:
+		ds	1
+_g0316:
+		ds	1
+_g0317:
+		ds	1
+_g0318:
+		ds	1
+_g0319:
+		ds	1
+_g0320:
+		ds	1
+_g0321:
+		ds	1
+_g0322:
+		ds	1
+_g0323:
+		ds	1
+_g0324:
+		ds	1
+_g0325:
+		ds	1
+_g0326:
+		ds	1
+_g0327:
+		ds	1
+_g0328:
+		ds	1
+_g0329:
+		ds	1
+_g0330:
+		ds	1
+_g0331:
+		ds	1
+_g0332:
+		ds	1
+_g0333:
+		ds	1
+_g0334:
+		ds	1
+_g0335:
+		ds	1
+_g0336:
+		ds	1
+_g0337:
+		ds	1
+_g0338:
+		ds	1
+_g0339:
+		ds	1
+_g0340:
+		ds	1
+_g0341:
+		ds	1
+_g0342:
+		ds	1
+_g0343:
+		ds	1
+_g0344:
+		ds	1
+_g0345:
+		ds	1
+_g0346:
+		ds	1
+_g0347:
+		ds	1
+_g0348:
+		ds	1
+_g0349:
+		ds	1
+_g0350:
+		ds	1
+_g0351:
+		ds	1
+_g0352:
+		ds	1
+_g0353:
+		ds	1
+_g0354:
+		ds	1
+_g0355:
+		ds	1
+_g0356:
+		ds	1
+_g0357:
+		ds	1
+_g0358:
+		ds	1
+_g0359:
+		ds	1
+_g0360:
+		ds	1
+_g0361:
+		ds	1
+_g0362:
+		ds	1
+_g0363:
+		ds	1
+_g0364:
+		ds	1
+_g0365:
+		ds	1
+_g0366:
+		ds	1
+_g0367:
+		ds	1
+_g0368:
+		ds	1
+_g0369:
+		ds	1
+_g0370:
+		ds	1
+_g0371:
+		ds	1
+_g0372:
+		ds	1
+_g0373:
+		ds	1
+_g0374:
+		ds	1
+_g0375:
+		ds	1
+_g0376:
+		ds	1
+_g0377:
+		ds	1
+_g0378:
+		ds	1
+_g0379:
+		ds	1
+_g0380:
+		ds	1
+_g0381:
+		ds	1
+_g0382:
+		ds	1
+_g0383:
+		ds	1
+_g0384:
+		ds	1
+_g0385:
+		ds	1
+_g0386:
+		ds	1
+_g0387:
+		ds	1
+_g0388:
+		ds	1
+_g0389:
+		ds	1
+_g0390:
+		ds	1
+_g0391:
+		ds	1
+_g0392:
+		ds	1
+_g0393:
+		ds	1
+_g0394:
+		ds	1
+_g0395:
+		ds	1
+_g0396:
+		ds	1
+_g0397:
+		ds	1
+_g0398:
+		ds	1
+_g0399:
+		ds	1
+_g0400:
+		ds	1
+_g0401:
+		ds	1
+_g0402:
+		ds	1
+_g0403:
+		ds	1
+_g0404:
+		ds	1
+_g0405:
+		ds	1
+_g0406:
+		ds	1
+_g0407:
+		ds	1
+_g0408:
+		ds	1
+_g0409:
+		ds	1
+_g0410:
+		ds	1
+_g0411:
+		ds	1
+_g0412:
+		ds	1
+_g0413:
+		ds	1
+_g0414:
+		ds	1
+_g0415:
+		ds	1
+_g0416:
+		ds	1
+_g0417:
+		ds	1
+_g0418:
+		ds	1
+_g0419:
+		ds	1
+_g0420:
+		ds	1
+_g0421:
+		ds	1
+_g0422:
+		ds	1
+_g0423:
+		ds	1
+_g0424:
+		ds	1
+_g0425:
+		ds	1
+_g0426:
+		ds	1
+_g0427:
+		ds	1
+_g0428:
+		ds	1
+_g0429:
+		ds	1
+_g0430:
+		ds	1
+_g0431:
+		ds	1
+_g0432:
+		ds	1
+_g0433:
+		ds	1
+_g0434:
+		ds	1
+_g0435:
+		ds	1
+_g0436:
+		ds	1
+_g0437:
+		ds	1
+_g0438:
+		ds	1
+_g0439:
+		ds	1
+_g0440:
+		ds	1
+_g0441:
+		ds	1
+_g0442:
+		ds	1
+_g0443:
+		ds	1
+_g0444:
+		ds	1
+_g0445:
+		ds	1
+_g0446:
+		ds	1
+_g0447:
+		ds	1
+_g0448:
+		ds	1
+_g0449:
+		ds	1
+_g0450:
+		ds	1
+_g0451:
+		ds	1
+_g0452:
+		ds	1
+_g0453:
+		ds	1
+_g0454:
+		ds	1
+_g0455:
+		ds	1
+_g0456:
+		ds	1
+_g0457:
+		ds	1
+_g0458:
+		ds	1
+_g0459:
+		ds	1
+_g0460:
+		ds	1
+_g0461:
+		ds	1
+_g0462:
+		ds	1
+_g0463:
+		ds	1
+_g0464:
+		ds	1
+_g0465:
+		ds	1
+_g0466:
+		ds	1
+_g0467:
+		ds	1
+_g0468:
+		ds	1
+_g0469:
+		ds	1
+_g0470:
+		ds	1
+_g0471:
+		ds	1
+_g0472:
+		ds	1
+_g0473:
+		ds	1
+_g0474:
+		ds	1
+_g0475:
+		ds	1
+_g0476:
+		ds	1
+_g0477:
+		ds	1
+_g0478:
+		ds	1
+_g0479:
+		ds	1
+_g0480:
+		ds	1
+_g0481:
+		ds	1
+_g0482:
+		ds	1
+_g0483:
+		ds	1
+_g0484:
+		ds	1
+_g0485:
+		ds	1
+_g0486:
+		ds	1
+_g0487:
+		ds	1
+_g0488:
+		ds	1
+_g0489:
+		ds	1
+_g0490:
+		ds	1
+_g0491:
+		ds	1
+_g0492:
+		ds	1
+_g0493:
+		ds	1
+_g0494:
+		ds	1
+_g0495:
+		ds	1
+_g0496:
+		ds	1
+_g0497:
+		ds	1
+_g0498:
+		ds	1
+_g0499:
+		ds	1
+_g0500:
+		ds	1
+_g0501:
+		ds	1
+_g0502:
+		ds	1
+_g0503:
+		ds	1
+_g0504:
+		ds	1
+_g0505:
+		ds	1
+_g0506:
+		ds	1
+_g0507:
+		ds	1
+_g0508:
+		ds	1
+_g0509:
+		ds	1
+_g0510:
+		ds	1
+_g0511:
+		ds	1
+_g0512:
+		ds	1
+_g0513:
+		ds	1
+_g0514:
+		ds	1
+_g0515:
+		ds	1
+_g0516:
+		ds	1
+_g0518:
+		ds	1
+_g0519:
+		ds	1
+_g0520:
+		ds	1
+_g0521:
+		ds	1
+_g0522:
+		ds	1
+_g0523:
+		ds	1
+_g0524:
+		ds	1
+_g0525:
+		ds	1
+_g0526:
+		ds	1
+_g0527:
+		ds	1
+_g0528:
+		ds	1
+_g0529:
+		ds	1
+_g0530:
+		ds	1
+_g0531:
+		ds	1
+_g0532:
+		ds	1
+_g0533:
+		ds	1
+_g0534:
+		ds	1
+_g0535:
+		ds	1
+_g0536:
+		ds	1
+_g0537:
+		ds	1
+_g0538:
+		ds	1
+_g0539:
+		ds	1
+_g0540:
+		ds	1
+_g0541:
+		ds	1
+_g0542:
+		ds	1
+_g0543:
+		ds	1
+_g0544:
+		ds	1
+_g0545:
+		ds	1
+_g0546:
+		ds	1
+_g0547:
+		ds	1
+_g0548:
+		ds	1
+_g0549:
+		ds	1
+_g0550:
+		ds	1
+_g0551:
+		ds	1
+_g0552:
+		ds	1
+_g0553:
+		ds	1
+_g0554:
+		ds	1
+_g0555:
+		ds	1
+_g0556:
+		ds	1
+_g0557:
+		ds	1
+_g0558:
+		ds	1
+_g0559:
+		ds	1
+_g0560:
+		ds	1
+_g0561:
+		ds	1
+_g0562:
+		ds	1
+_g0563:
+		ds	1
+_g0564:
+		ds	1
+_g0565:
+		ds	1
+_g0566:
+		ds	1
+_g0567:
+		ds	1
+_g0568:
+		ds	1
+_g0569:
+		ds	1
+_g0570:
+		ds	1
+_g0571:
+		ds	1
+_g0572:
+		ds	1
+_g0573:
+		ds	1
+_g0574:
+		ds	1
+_g0575:
+		ds	1
+_g0576:
+		ds	1
+_g0577:
+		ds	1
+_g0578:
+		ds	1
+_g0579:
+		ds	1
+_g0580:
+		ds	1
+_g0581:
+		ds	1
+_g0582:
+		ds	1
+_g0583:
+		ds	1
+_g0584:
+		ds	1
+_g0585:
+		ds	1
+_g0586:
+		ds	1
+_g0587:
+		ds	1
+_g0588:
+		ds	1
+_g0589:
+		ds	1
+_g0590:
+		ds	1
+_g0591:
+		ds	1
+_g0592:
+		ds	1
+_g0593:
+		ds	1
+_g0594:
+		ds	1
+_g0595:
+		ds	1
+_g0596:
+		ds	1
+_g0597:
+		ds	1
+_g0598:
+		ds	1
+_g0599:
+		ds	1
+_g0600:
+		ds	1
+_g0601:
+		ds	1
+_g0602:
+		ds	1
+_g0603:
+		ds	1
+_g0604:
+		ds	1
+_g0605:
+		ds	1
+_g0606:
+		ds	1
+_g0607:
+		ds	1
+_g0608:
+		ds	1
+_g0609:
+		ds	1
+_g0610:
+		ds	1
+_g0611:
+		ds	1
+_g0612:
+		ds	1
+_g0613:
+		ds	1
+_g0614:
+		ds	1
+_g0615:
+		ds	1
+_g0616:
+		ds	1
+_g0617:
+		ds	1
+_g0618:
+		ds	1
+_g0619:
+		ds	1
+_g0620:
+		ds	1
+_g0621:
+		ds	1
+_g0622:
+		ds	1
+_g0623:
+		ds	1
+_g0624:
+		ds	1
+_g0625:
+		ds	1
+_g0626:
+		ds	1
+_g0627:
+		ds	1
+_g0628:
+		ds	1
+_g0629:
+		ds	1
+_g0630:
+		ds	1
+_g0631:
+		ds	1
+_g0632:
+		ds	1
+_g0633:
+		ds	1
+_g0634:
+		ds	1
+_g0635:
+		ds	1
+_g0636:
+		ds	1
+_g0637:
+		ds	1
+_g0638:
+		ds	1
+_g0639:
+		ds	1
+_g0640:
+		ds	1
+_g0641:
+		ds	1
+_g0642:
+		ds	1
+_g0643:
+		ds	1
+_g0644:
+		ds	1
+_g0645:
+		ds	1
+_g0646:
+		ds	1
+_g0647:
+		ds	1
+_g0648:
+		ds	1
+_g0649:
+		ds	1
+_g0650:
+		ds	1
+_g0651:
+		ds	1
+_g0652:
+		ds	1
+_g0653:
+		ds	1
+_g0654:
+		ds	1
+_g0655:
+		ds	1
+_g0656:
+		ds	1
+_g0657:
+		ds	1
+_g0658:
+		ds	1
+_g0659:
+		ds	1
+_g0660:
+		ds	1
+_g0661:
+		ds	1
+_g0662:
+		ds	1
+_g0663:
+		ds	1
+_g0664:
+		ds	1
+_g0665:
+		ds	1
+_g0666:
+		ds	1
+_g0667:
+		ds	1
+_g0668:
+		ds	1
+_g0669:
+		ds	1
+_g0670:
+		ds	1
+_g0671:
+		ds	1
+_g0672:
+		ds	1
+_g0673:
+		ds	1
+_g0674:
+		ds	1
+_g0675:
+		ds	1
+_g0676:
+		ds	1
+_g0677:
+		ds	1
+_g0678:
+		ds	1
+_g0679:
+		ds	1
+_g0680:
+		ds	1
+_g0681:
+		ds	1
+_g0682:
+		ds	1
+_g0683:
+		ds	1
+_g0684:
+		ds	1
+_g0685:
+		ds	1
+_g0686:
+		ds	1
+_g0687:
+		ds	1
+_g0688:
+		ds	1
+_g0689:
+		ds	1
+_g0690:
+		ds	1
+_g0691:
+		ds	1
+_g0692:
+		ds	1
+_g0693:
+		ds	1
+_g0694:
+		ds	1
+_g0695:
+		ds	1
+_g0696:
+		ds	1
+_g0697:
+		ds	1
+_g0698:
+		ds	1
+_g0699:
+		ds	1
+_g0700:
+		ds	1
+_g0701:
+		ds	1
+_g0702:
+		ds	1
+_g0703:
+		ds	1
+_g0704:
+		ds	1
+_g0705:
+		ds	1
+_g0706:
+		ds	1
+_g0707:
+		ds	1
+_g0708:
+		ds	1
+_g0709:
+		ds	1
+_g0710:
+		ds	1
+_g0711:
+		ds	1
+_g0712:
+		ds	1
+_g0713:
+		ds	1
+_g0714:
+		ds	1
+_g0715:
+		ds	1
+_g0716:
+		ds	1
+_g0717:
+		ds	1
+_g0718:
+		ds	1
+_g0719:
+		ds	1
+_g0720:
+		ds	1
+_g0721:
+		ds	1
+_g0722:
+		ds	1
+_g0723:
+		ds	1
+_g0724:
+		ds	1
+_g0725:
+		ds	1
+_g0726:
+		ds	1
+_g0727:
+		ds	1
+_g0728:
+		ds	1
+_g0729:
+		ds	1
+_g0730:
+		ds	1
+_g0731:
+		ds	1
+_g0732:
+		ds	1
+_g0733:
+		ds	1
+_g0734:
+		ds	1
+_g0735:
+		ds	1
+_g0736:
+		ds	1
+_g0737:
+		ds	1
+_g0738:
+		ds	1
+_g0739:
+		ds	1
+_g0740:
+		ds	1
+_g0741:
+		ds	1
+_g0742:
+		ds	1
+_g0743:
+		ds	1
+_g0744:
+		ds	1
+_g0745:
+		ds	1
+_g0746:
+		ds	1
+_g0747:
+		ds	1
+_g0748:
+		ds	1
+_g0749:
+		ds	1
+_g0750:
+		ds	1
+_g0751:
+		ds	1
+_g0752:
+		ds	1
+_g0753:
+		ds	1
+_g0754:
+		ds	1
+_g0755:
+		ds	1
+_g0756:
+		ds	1
+_g0757:
+		ds	1
+_g0758:
+		ds	1
+_g0759:
+		ds	1
+_g0760:
+		ds	1
+_g0761:
+		ds	1
+_g0762:
+		ds	1
+_g0763:
+		ds	1
+_g0764:
+		ds	1
+_g0765:
+		ds	1
+_g0766:
+		ds	1
+_g0767:
+		ds	1
+_g0768:
+		ds	1
+_g0769:
+		ds	1
+_g0770:
+		ds	1
+_g0771:
+		ds	1
+_g0772:
+		ds	1
+_g0773:
+		ds	1
+_g0774:
+		ds	1
+_g0775:
+		ds	1
+_g0776:
+		ds	1
+_g0777:
+		ds	1
+_g0778:
+		ds	1
+_g0779:
+		ds	1
+_g0780:
+		ds	1
+_g0781:
+		ds	1
+_g0782:
+		ds	1
+_g0783:
+		ds	1
+_g0784:
+		ds	1
+_g0785:
+		ds	1
+_g0786:
+		ds	1
+_g0787:
+		ds	1
+_g0788:
+		ds	1
+_g0789:
+		ds	1
+_g0790:
+		ds	1
+_g0791:
+		ds	1
+_g0792:
+		ds	1
+_g0793:
+		ds	1
+_g0794:
+		ds	1
+_g0795:
+		ds	1
+_g0796:
+		ds	1
+_g0797:
+		ds	1
+_g0798:
+		ds	1
+_g0799:
+		ds	1
+_g0800:
+		ds	1
+_g0801:
+		ds	1
+_g0802:
+		ds	1
+_g0803:
+		ds	1
+_g0804:
+		ds	1
+_g0805:
+		ds	1
+_g0806:
+		ds	1
+_g0807:
+		ds	1
+_g0808:
+		ds	1
+_g0809:
+		ds	1
+_g0810:
+		ds	1
+_g0811:
+		ds	1
+_g0812:
+		ds	1
+_g0813:
+		ds	1
+_g0814:
+		ds	1
+_g0815:
+		ds	1
+_g0816:
+		ds	1
+_g0817:
+		ds	1
+_g0818:
+		ds	1
+_g0819:
+		ds	1
+_g0820:
+		ds	1
+_g0821:
+		ds	1
+_g0822:
+		ds	1
+_g0823:
+		ds	1
+_g0824:
+		ds	1
+_g0825:
+		ds	1
+_g0826:
+		ds	1
+_g0827:
+		ds	1
+_g0828:
+		ds	1
+_g0829:
+		ds	1
+_g0830:
+		ds	1
+_g0831:
+		ds	1
+_g0832:
+		ds	1
+_g0833:
+		ds	1
+_g0834:
+		ds	1
+_g0835:
+		ds	1
+_g0836:
+		ds	1
+_g0837:
+		ds	1
+_g0838:
+		ds	1
+_g0839:
+		ds	1
+_g0840:
+		ds	1
+_g0841:
+		ds	1
+_g0842:
+		ds	1
+_g0843:
+		ds	1
+_g0844:
+		ds	1
+_g0845:
+		ds	1
+_g0846:
+		ds	1
+_g0847:
+		ds	1
+_g0848:
+		ds	1
+_g0849:
+		ds	1
+_g0850:
+		ds	1
+_g0851:
+		ds	1
+_g0852:
+		ds	1
+_g0853:
+		ds	1
+_g0854:
+		ds	1
+_g0855:
+		ds	1
+_g0856:
+		ds	1
+_g0857:
+		ds	1
+_g0858:
+		ds	1
+_g0859:
+		ds	1
+_g0860:
+		ds	1
+_g0861:
+		ds	1
+_g0862:
+		ds	1
+_g0863:
+		ds	1
+_g0864:
+		ds	1
+_g0865:
+		ds	1
+_g0866:
+		ds	1
+_g0867:
+		ds	1
+_g0868:
+		ds	1
+_g0869:
+		ds	1
+_g0870:
+		ds	1
+_g0871:
+		ds	1
+_g0872:
+		ds	1
+_g0873:
+		ds	1
+_g0874:
+		ds	1
+_g0875:
+		ds	1
+_g0876:
+		ds	1
+_g0877:
+		ds	1
+_g0878:
+		ds	1
+_g0879:
+		ds	1
+_g0880:
+		ds	1
+_g0881:
+		ds	1
+_g0882:
+		ds	1
+_g0883:
+		ds	1
+_g0884:
+		ds	1
+_g0885:
+		ds	1
+_g0886:
+		ds	1
+_g0887:
+		ds	1
+_g0888:
+		ds	1
+_g0889:
+		ds	1
+_g0890:
+		ds	1
+_g0891:
+		ds	1
+_g0892:
+		ds	1
+_g0893:
+		ds	1
+_g0894:
+		ds	1
+_g0895:
+		ds	1
+_g0896:
+		ds	1
+_g0897:
+		ds	1
+_g0898:
+		ds	1
+_g0899:
+		ds	1
+_g0900:
+		ds	1
+_g0901:
+		ds	1
+_g0902:
+		ds	1
+_g0903:
+		ds	1
+_g0904:
+		ds	1
+_g0905:
+		ds	1
+_g0906:
+		ds	1
+_g0907:
+		ds	1
+_g0908:
+		ds	1
+_g0909:
+		ds	1
+_g0910:
+		ds	1
+_g0911:
+		ds	1
+_g0912:
+		ds	1
+_g0913:
+		ds	1
+_g0914:
+		ds	1
+_g0915:
+		ds	1
+_g0916:
+		ds	1
+_g0917:
+		ds	1
+_g0918:
+		ds	1
+_g0919:
+		ds	1
+_g0920:
+		ds	1
+_g0921:
+		ds	1
+_g0922:
+		ds	1
+_g0923:
+		ds	1
+_g0924:
+		ds	1
+_g0925:
+		ds	1
+_g0926:
+		ds	1
+_g0927:
+		ds	1
+_g0928:
+		ds	1
+_g0929:
+		ds	1
+_g0930:
+		ds	1
+_g0931:
+		ds	1
+_g0932:
+		ds	1
+_g0933:
+		ds	1
+_g0934:
+		ds	1
+_g0935:
+		ds	1
+_g0936:
+		ds	1
+_g0937:
+		ds	1
+_g0938:
+		ds	1
+_g0939:
+		ds	1
+_g0940:
+		ds	1
+_g0941:
+		ds	1
+_g0942:
+		ds	1
+_g0943:
+		ds	1
+_g0944:
+		ds	1
+_g0945:
+		ds	1
+_g0946:
+		ds	1
+_g0947:
+		ds	1
+_g0948:
+		ds	1
+_g0949:
+		ds	1
+_g0950:
+		ds	1
+_g0951:
+		ds	1
+_g0952:
+		ds	1
+_g0953:
+		ds	1
+_g0954:
+		ds	1
+_g0955:
+		ds	1
+_g0956:
+		ds	1
+_g0957:
+		ds	1
+_g0958:
+		ds	1
+_g0959:
+		ds	1
+_g0960:
+		ds	1
+_g0961:
+		ds	1
+_g0962:
+		ds	1
+_g0963:
+		ds	1
+_g0964:
+		ds	1
+_g0965:
+		ds	1
+_g0966:
+		ds	1
+_g0967:
+		ds	1
+_g0968:
+		ds	1
+_g0969:
+		ds	1
+_g0970:
+		ds	1
+_g0971:
+		ds	1
+_g0972:
+		ds	1
+_g0973:
+		ds	1
+_g0974:
+		ds	1
+_g0975:
+		ds	1
+_g0976:
+		ds	1
+_g0977:
+		ds	1
+_g0978:
+		ds	1
+_g0979:
+		ds	1
+_g0980:
+		ds	1
+_g0981:
+		ds	1
+_g0982:
+		ds	1
+_g0983:
+		ds	1
+_g0984:
+		ds	1
+_g0985:
+		ds	1
+_g0986:
+		ds	1
+_g0987:
+		ds	1
+_g0988:
+		ds	1
+_g0989:
+		ds	1
+_g0990:
+		ds	1
+_g0991:
+		ds	1
+_g0992:
+		ds	1
+_g0993:
+		ds	1
+_g0994:
+		ds	1
+_g0995:
+		ds	1
+_g0996:
+		ds	1
+_g0997:
+		ds	1
+_g0998:
+		ds	1
+_g0999:
+		ds	1
+_g1000:
+		ds	1
+_g1001:
+		ds	1
+_g1002:
+		ds	1
+_g1003:
+		ds	1
+_g1004:
+		ds	1
+_g1005:
+		ds	1
+_g1006:
+		ds	1
+_g1007:
+		ds	1
+_g1008:
+		ds	1
+_g1009:
+		ds	1
+_g1010:
+		ds	1
+_g1011:
+		ds	1
+_g1012:
+		ds	1
+_g1013:
+		ds	1
+_g1014:
+		ds	1
+_g1015:
+		ds	1
+_g1016:
+		ds	1
+_g1017:
+		ds	1
+_g1018:
+		ds	1
+_g1019:
+		ds	1
+_g1020:
+		ds	1
+_g1021:
+		ds	1
+_g1022:
+		ds	1
+_g1023:
+		ds	1
+_g1024:
+		ds	1
+_g1025:
+		ds	1
+_g1026:
+		ds	1
+_g1027:
+		ds	1
+_g1028:
+		ds	1
+_g1029:
+		ds	1
+_g1030:
+		ds	1
+_g1031:
+		ds	1
+_g1032:
+		ds	1
+_g1033:
+		ds	1
+_g1034:
+		ds	1
+_g1035:
+		ds	1
+_g1036:
+		ds	1
+_g1037:
+		ds	1
+_g1038:
+		ds	1
+_g1039:
+		ds	1
+_g1040:
+		ds	1
+_g1041:
+		ds	1
+_g1042:
+		ds	1
+_g1043:
+		ds	1
+_g1044:
+		ds	1
+_g1045:
+		ds	1
+_g1046:
+		ds	1
+_g1047:
+		ds	1
+_g1048:
+		ds	1
+_g1049:
+		ds	1
+_g1050:
+		ds	1
+_g1051:
+		ds	1
+_g1052:
+		ds	1
+_g1053:
+		ds	1
+_g1054:
+		ds	1
+_g1055:
+		ds	1
+_g1056:
+		ds	1
+_g1057:
+		ds	1
+_g1058:
+		ds	1
+_g1059:
+		ds	1
+_g1060:
+		ds	1
+_g1061:
+		ds	1
+_g1062:
+		ds	1
+_g1063:
+		ds	1
+_g1064:
+		ds	1
+_g1065:
+		ds	1
+_g1066:
+		ds	1
+_g1067:
+		ds	1
+_g1068:
+		ds	1
+_g1069:
+		ds	1
+_g1070:
+		ds	1
+_g1071:
+		ds	1
+_g1072:
+		ds	1
+_g1073:
+		ds	1
+_g1074:
+		ds	1
+_g1075:
+		ds	1
+_g1076:
+		ds	1
+_g1077:
+		ds	1
+_g1078:
+		ds	1
+_g1079:
+		ds	1
+_g1080:
+		ds	1
+_g1081:
+		ds	1
+_g1082:
+		ds	1
+_g1083:
+		ds	1
+_g1084:
+		ds	1
+_g1085:
+		ds	1
+_g1086:
+		ds	1
+_g1087:
+		ds	1
+_g1088:
+		ds	1
+_g1089:
+		ds	1
+_g1090:
+		ds	1
+_g1091:
+		ds	1
+_g1092:
+		ds	1
+_g1093:
+		ds	1
+_g1094:
+		ds	1
+_g1095:
+		ds	1
+_g1096:
+		ds	1
+_g1097:
+		ds	1
+_g1098:
+		ds	1
+	.code
@@ -0,0 +1,149 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:10 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/huc-varptrarr.c", 1; int a, b, c, d;
+	.dbg	line,	"tests/huc-varptrarr.c", 3; int *p[4];
+	.dbg	line,	"tests/huc-varptrarr.c", 5; main()
+	.dbg	line,	"tests/huc-varptrarr.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/huc-varptrarr.c", 7; p[0] = &a; p[1] = &b; p[2] = &c; p[3] = &d;
+	__ld.wi		_a
+	__st.wmq	_p
+	__ld.wi		_b
+	__st.wmq	_p + 2
+	__ld.wi		_c
+	__st.wmq	_p + 4
+	__ld.wi		_d
+	__st.wmq	_p + 6
+
+	.dbg	line,	"tests/huc-varptrarr.c", 8; a = 1; b = 2; c = 3; d = 4;
+	__st.wmiq	1, _a
+	__st.wmiq	2, _b
+	__st.wmiq	3, _c
+	__st.wmiq	4, _d
+
+	.dbg	line,	"tests/huc-varptrarr.c", 9; if (*p[0] != 1 || *p[1] != 2 || *p[2] != 3 || *p[3] != 4)
+	__ld.wm		_p
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	1
+	__btrue		.LL4
+	__ld.wm		_p + 2
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	2
+.LL4:
+	__btrue		.LL5
+	__ld.wm		_p + 4
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	3
+.LL5:
+	__btrue		.LL6
+	__ld.wm		_p + 6
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wi	4
+.LL6:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/huc-varptrarr.c", 10; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/huc-varptrarr.c", 11; return 0;
+.LL3:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/huc-varptrarr.c", 12; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_p:
+		ds	8
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:7
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  a
+;         4      4     2  b
+;         4      4     2  c
+;         4      4     2  d
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_a, 2, 4, 4
+	auto_zp_var	_b, 2, 4, 4
+	auto_zp_var	_c, 2, 4, 4
+	auto_zp_var	_d, 2, 4, 4
+	.endm
@@ -0,0 +1,1109 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/int-compare.c", 1; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/int-compare.c", 3; gt (int a, int b)
+	.dbg	line,	"tests/int-compare.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_gt
+	__enter		_gt
+
+	.dbg	line,	"tests/int-compare.c", 5; return a > b;
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL2:
+	__bool
+
+	.dbg	line,	"tests/int-compare.c", 6; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/int-compare.c", 8; ge (int a, int b)
+	.dbg	line,	"tests/int-compare.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ge
+	__enter		_ge
+
+	.dbg	line,	"tests/int-compare.c", 10; return a >= b;
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL3:
+	__bool
+
+	.dbg	line,	"tests/int-compare.c", 11; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/int-compare.c", 13; lt (int a, int b)
+	.dbg	line,	"tests/int-compare.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_lt
+	__enter		_lt
+
+	.dbg	line,	"tests/int-compare.c", 15; return a < b;
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL4:
+	__bool
+
+	.dbg	line,	"tests/int-compare.c", 16; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/int-compare.c", 18; le (int a, int b)
+	.dbg	line,	"tests/int-compare.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_le
+	__enter		_le
+
+	.dbg	line,	"tests/int-compare.c", 20; return a <= b;
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL5:
+	__bool
+
+	.dbg	line,	"tests/int-compare.c", 21; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/int-compare.c", 23; void
+	.dbg	line,	"tests/int-compare.c", 24; true (int c)
+	.dbg	line,	"tests/int-compare.c", 25; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_true
+	__enter		_true
+
+	.dbg	line,	"tests/int-compare.c", 26; if (!c)
+	__not.ws	0
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/int-compare.c", 27; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/int-compare.c", 28; }
+.LL7:
+.LL6:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/int-compare.c", 30; void
+	.dbg	line,	"tests/int-compare.c", 31; false (int c)
+	.dbg	line,	"tests/int-compare.c", 32; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_false
+	__enter		_false
+
+	.dbg	line,	"tests/int-compare.c", 33; if (c)
+	__tst.ws	0  /* c */
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/int-compare.c", 34; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/int-compare.c", 35; }
+.LL9:
+.LL8:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/int-compare.c", 37; f ()
+	.dbg	line,	"tests/int-compare.c", 38; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/int-compare.c", 39; true (gt (2, 1));
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL11:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL12
+	__call		_abort
+.LL12:
+.LL13:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 40; false (gt (1, 2));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL14:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL15
+	__call		_abort
+.LL15:
+.LL16:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 42; true (gt (INT_MAX, 0));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL17:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL18
+	__call		_abort
+.LL18:
+.LL19:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 43; false (gt (0, INT_MAX));
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL20:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL21
+	__call		_abort
+.LL21:
+.LL22:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 44; true (gt (INT_MAX, 1));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL23:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL24
+	__call		_abort
+.LL24:
+.LL25:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 45; false (gt (1, INT_MAX));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL26:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL27
+	__call		_abort
+.LL27:
+.LL28:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 47; false (gt (INT_MIN, 0));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL29:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL30
+	__call		_abort
+.LL30:
+.LL31:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 48; true (gt (0, INT_MIN));
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL32:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL33
+	__call		_abort
+.LL33:
+.LL34:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 49; false (gt (INT_MIN, 1));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL35:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL36
+	__call		_abort
+.LL36:
+.LL37:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 50; true (gt (1, INT_MIN));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL38:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL39
+	__call		_abort
+.LL39:
+.LL40:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 52; true (gt (INT_MAX, INT_MIN));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL41:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL42
+	__call		_abort
+.LL42:
+.LL43:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 53; false (gt (INT_MIN, INT_MAX));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+.LL44:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL45
+	__call		_abort
+.LL45:
+.LL46:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 55; true (ge (2, 1));
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL47:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL48
+	__call		_abort
+.LL48:
+.LL49:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 56; false (ge (1, 2));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL50:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL51
+	__call		_abort
+.LL51:
+.LL52:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 58; true (ge (INT_MAX, 0));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL53:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL54
+	__call		_abort
+.LL54:
+.LL55:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 59; false (ge (0, INT_MAX));
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL56:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL57
+	__call		_abort
+.LL57:
+.LL58:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 60; true (ge (INT_MAX, 1));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL59:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL60
+	__call		_abort
+.LL60:
+.LL61:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 61; false (ge (1, INT_MAX));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL62:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL63
+	__call		_abort
+.LL63:
+.LL64:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 63; false (ge (INT_MIN, 0));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL65:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL66
+	__call		_abort
+.LL66:
+.LL67:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 64; true (ge (0, INT_MIN));
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL68:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL69
+	__call		_abort
+.LL69:
+.LL70:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 65; false (ge (INT_MIN, 1));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL71:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL72
+	__call		_abort
+.LL72:
+.LL73:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 66; true (ge (1, INT_MIN));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL74:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL75
+	__call		_abort
+.LL75:
+.LL76:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 68; true (ge (INT_MAX, INT_MIN));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL77:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL78
+	__call		_abort
+.LL78:
+.LL79:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 69; false (ge (INT_MIN, INT_MAX));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sge_w.ws	0  /* b */
+.LL80:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL81
+	__call		_abort
+.LL81:
+.LL82:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 71; false (lt (2, 1));
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL83:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL84
+	__call		_abort
+.LL84:
+.LL85:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 72; true (lt (1, 2));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL86:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL87
+	__call		_abort
+.LL87:
+.LL88:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 74; false (lt (INT_MAX, 0));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL89:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL90
+	__call		_abort
+.LL90:
+.LL91:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 75; true (lt (0, INT_MAX));
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL92:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL93
+	__call		_abort
+.LL93:
+.LL94:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 76; false (lt (INT_MAX, 1));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL95:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL96
+	__call		_abort
+.LL96:
+.LL97:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 77; true (lt (1, INT_MAX));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL98:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL99
+	__call		_abort
+.LL99:
+.LL100:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 79; true (lt (INT_MIN, 0));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL101:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL102
+	__call		_abort
+.LL102:
+.LL103:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 80; false (lt (0, INT_MIN));
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL104:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL105
+	__call		_abort
+.LL105:
+.LL106:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 81; true (lt (INT_MIN, 1));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL107:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL108
+	__call		_abort
+.LL108:
+.LL109:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 82; false (lt (1, INT_MIN));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL110:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL111
+	__call		_abort
+.LL111:
+.LL112:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 84; false (lt (INT_MAX, INT_MIN));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL113:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL114
+	__call		_abort
+.LL114:
+.LL115:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 85; true (lt (INT_MIN, INT_MAX));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+.LL116:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL117
+	__call		_abort
+.LL117:
+.LL118:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 87; false (le (2, 1));
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL119:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL120
+	__call		_abort
+.LL120:
+.LL121:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 88; true (le (1, 2));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL122:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL123
+	__call		_abort
+.LL123:
+.LL124:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 90; false (le (INT_MAX, 0));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL125:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL126
+	__call		_abort
+.LL126:
+.LL127:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 91; true (le (0, INT_MAX));
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL128:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL129
+	__call		_abort
+.LL129:
+.LL130:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 92; false (le (INT_MAX, 1));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL131:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL132
+	__call		_abort
+.LL132:
+.LL133:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 93; true (le (1, INT_MAX));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL134:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL135
+	__call		_abort
+.LL135:
+.LL136:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 95; true (le (INT_MIN, 0));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL137:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL138
+	__call		_abort
+.LL138:
+.LL139:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 96; false (le (0, INT_MIN));
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL140:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL141
+	__call		_abort
+.LL141:
+.LL142:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 97; true (le (INT_MIN, 1));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL143:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL144
+	__call		_abort
+.LL144:
+.LL145:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 98; false (le (1, INT_MIN));
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL146:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL147
+	__call		_abort
+.LL147:
+.LL148:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 100; false (le (INT_MAX, INT_MIN));
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL149:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__tst.ws	0  /* c */
+	__bfalse	.LL150
+	__call		_abort
+.LL150:
+.LL151:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 101; true (le (INT_MIN, INT_MAX));
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__sle_w.ws	0  /* b */
+.LL152:
+	__bool
+	__modsp		4
+	__pusharg.wr
+	__not.ws	0
+	__bfalse	.LL153
+	__call		_abort
+.LL153:
+.LL154:
+	__modsp		2
+
+	.dbg	line,	"tests/int-compare.c", 102; }
+.LL10:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/int-compare.c", 104; main ()
+	.dbg	line,	"tests/int-compare.c", 105; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/int-compare.c", 106; f ();
+	__call		_f
+
+	.dbg	line,	"tests/int-compare.c", 107; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/int-compare.c", 108; }
+.LL155:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:10
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,181 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-10.c", 1; /* Reduced from PR optimization/5076, PR optimization/2847 */
+	.dbg	line,	"tests/loop-10.c", 3; static int count;// = 0;
+	.dbg	line,	"tests/loop-10.c", 5; static void
+	.dbg	line,	"tests/loop-10.c", 6; inc (void)
+	.dbg	line,	"tests/loop-10.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_inc
+	__enter		_inc
+
+	.dbg	line,	"tests/loop-10.c", 8; count++;
+	__inc.wmq	_count
+
+	.dbg	line,	"tests/loop-10.c", 9; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/loop-10.c", 11; int
+	.dbg	line,	"tests/loop-10.c", 12; main (void)
+	.dbg	line,	"tests/loop-10.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-10.c", 14; int iNbr = 1;
+	__st.wmiq	1, __main_end - 2  /* iNbr */
+
+	.dbg	line,	"tests/loop-10.c", 15; int test = 0;
+	__st.wmiq	0, __main_end - 4  /* test */
+
+	.dbg	line,	"tests/loop-10.c", 16; count = 0;
+	__st.wmiq	0, _count
+
+	.dbg	line,	"tests/loop-10.c", 17; while (test == 0)
+.LL4:
+	__not.wm	__main_end - 4  /* test */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/loop-10.c", 18; {
+
+	.dbg	line,	"tests/loop-10.c", 19; inc ();
+	__inc.wmq	_count
+.LL6:
+
+	.dbg	line,	"tests/loop-10.c", 20; if (iNbr == 0)
+	__not.wm	__main_end - 2  /* iNbr */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/loop-10.c", 21; break;
+	__bra		.LL5
+
+	.dbg	line,	"tests/loop-10.c", 22; else
+.LL7:
+
+	.dbg	line,	"tests/loop-10.c", 23; {
+
+	.dbg	line,	"tests/loop-10.c", 24; inc ();
+	__inc.wmq	_count
+.LL9:
+
+	.dbg	line,	"tests/loop-10.c", 25; iNbr--;
+	__dec.wmq	__main_end - 2  /* iNbr */
+
+	.dbg	line,	"tests/loop-10.c", 26; }
+.LL8:
+
+	.dbg	line,	"tests/loop-10.c", 27; test = 1;
+	__st.wmiq	1, __main_end - 4  /* test */
+
+	.dbg	line,	"tests/loop-10.c", 28; }
+	__bra		.LL4
+.LL5:
+
+	.dbg	line,	"tests/loop-10.c", 29; if (count != 2)
+	__ld.wm		_count
+	__neq_w.wi	2
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/loop-10.c", 30; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-10.c", 31; return 0;
+.LL10:
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/loop-10.c", 32; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        40     12     2  count
+;        68     12     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_count, 2, 12, 40
+	auto_zp_var	__overlay_frames, 4, 12, 68
+__main_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,200 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-11.c", 1; static int a[199];
+	.dbg	line,	"tests/loop-11.c", 3; static void
+	.dbg	line,	"tests/loop-11.c", 4; foo ()
+	.dbg	line,	"tests/loop-11.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/loop-11.c", 6; int i;
+
+	.dbg	line,	"tests/loop-11.c", 7; for (i = 198; i >= 0; i--)
+	__st.wmiq	198, __foo_end - 2  /* i */
+.LL3:
+	__ld.wm		__foo_end - 2  /* i */
+	__sge_w.wi	0
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__dec.wmq	__foo_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/loop-11.c", 8; a[i] = i;
+	__ld.wm		__foo_end - 2  /* i */
+	__asl.wr
+	__add.wi	_a
+	__push.wr
+	__ld.wm		__foo_end - 2  /* i */
+	__st.wtq
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/loop-11.c", 9; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/loop-11.c", 11; int
+	.dbg	line,	"tests/loop-11.c", 12; main ()
+	.dbg	line,	"tests/loop-11.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-11.c", 14; int i;
+
+	.dbg	line,	"tests/loop-11.c", 15; foo ();
+	__st.wmiq	198, __foo_end - 2  /* i */
+.LL8:
+	__ld.wm		__foo_end - 2  /* i */
+	__sge_w.wi	0
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+	__dec.wmq	__foo_end - 2  /* i */
+	__bra		.LL8
+.LL10:
+	__ld.wm		__foo_end - 2  /* i */
+	__asl.wr
+	__add.wi	_a
+	__push.wr
+	__ld.wm		__foo_end - 2  /* i */
+	__st.wtq
+	__bra		.LL9
+.LL11:
+.LL12:
+
+	.dbg	line,	"tests/loop-11.c", 16; for (i = 0; i < 199; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL13:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	199
+	__btrue		.LL15
+	__bra		.LL16
+.LL14:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL13
+.LL15:
+
+	.dbg	line,	"tests/loop-11.c", 17; if (a[i] != i)
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wr
+	__add.wi	_a
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__neq_w.wm	__main_end - 2  /* i */
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/loop-11.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-11.c", 19; return 0;
+.LL17	.alias		.LL14
+	__bra		.LL14
+.LL16:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/loop-11.c", 20; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_a:
+		ds	398
+
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        80     10     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 10, 80
+__main_end	=	__overlay_frames + 2
+	.endm
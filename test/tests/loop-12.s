@@ -0,0 +1,189 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-12.c", 1; /* Checks that pure functions are not treated as const.  */
+	.dbg	line,	"tests/loop-12.c", 3; char *p;
+	.dbg	line,	"tests/loop-12.c", 5; static int //__attribute__ ((pure))
+	.dbg	line,	"tests/loop-12.c", 6; is_end_of_statement (void)
+	.dbg	line,	"tests/loop-12.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_is_end_of_statement
+	__enter		_is_end_of_statement
+
+	.dbg	line,	"tests/loop-12.c", 8; return *p == '\n' || *p == ';' || *p == '!';
+	__ld.wm		_p
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	10
+	__btrue		.LL3
+	__ld.wm		_p
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	59
+.LL3:
+	__btrue		.LL4
+	__ld.wm		_p
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	33
+.LL4:
+.LL2:
+	__bool
+
+	.dbg	line,	"tests/loop-12.c", 9; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/loop-12.c", 11; void foo (void)
+	.dbg	line,	"tests/loop-12.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/loop-12.c", 13; /* The is_end_of_statement call was moved out of the loop at one stage,
+
+	.dbg	line,	"tests/loop-12.c", 14; resulting in an endless loop.  */
+
+	.dbg	line,	"tests/loop-12.c", 15; while (!is_end_of_statement ())
+.LL6:
+	__ld.wm		_p
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	10
+	__btrue		.LL8
+	__ld.wm		_p
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	59
+.LL8:
+	__btrue		.LL9
+	__ld.wm		_p
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	33
+.LL9:
+.LL10:
+	__not.cf
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/loop-12.c", 16; p++;
+	__inc.wmq	_p
+	__bra		.LL6
+.LL7:
+
+	.dbg	line,	"tests/loop-12.c", 17; }
+.LL5:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/loop-12.c", 19; int
+	.dbg	line,	"tests/loop-12.c", 20; main (void)
+	.dbg	line,	"tests/loop-12.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-12.c", 22; p = "abc\n";
+	__ld.wi		__const1+0
+	__st.wmq	_p
+
+	.dbg	line,	"tests/loop-12.c", 23; foo ();
+	__call		_foo
+
+	.dbg	line,	"tests/loop-12.c", 24; return 0;
+	__ld.wi		0
+.LL11:
+
+	.dbg	line,	"tests/loop-12.c", 25; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'a','b','c',$0A,$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:5
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        88     18     2  p
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_p, 2, 18, 88
+	.endm
@@ -0,0 +1,170 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-14.c", 1; int a3[3];
+	.dbg	line,	"tests/loop-14.c", 3; void f(int *a)
+	.dbg	line,	"tests/loop-14.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/loop-14.c", 5; int i;
+
+	.dbg	line,	"tests/loop-14.c", 7; for (i=3; --i;)
+	__st.wmiq	3, __f_end - 2  /* i */
+.LL3:
+	__decld.wm	__f_end - 2  /* i */
+	__tst.wr
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+.LL5:
+
+	.dbg	line,	"tests/loop-14.c", 8; a[i] = 42 / i;
+	__ld.wm		__f_end - 2  /* i */
+	__asl.wr
+	__add.ws	0  /* a */
+	__push.wr
+	__ld.wi		42
+	__push.wr
+	__ld.wm		__f_end - 2  /* i */
+	__sdiv.wt
+	__st.wtq
+	__bra		.LL3
+.LL6:
+
+	.dbg	line,	"tests/loop-14.c", 9; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/loop-14.c", 11; int
+	.dbg	line,	"tests/loop-14.c", 12; main ()
+	.dbg	line,	"tests/loop-14.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-14.c", 14; f(a3);
+	__ld.wi		_a3
+	__pusharg.wr
+	__st.wmiq	3, __f_end - 2  /* i */
+.LL8:
+	__decld.wm	__f_end - 2  /* i */
+	__tst.wr
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+.LL10:
+	__ld.wm		__f_end - 2  /* i */
+	__asl.wr
+	__add.ws	0  /* a */
+	__push.wr
+	__ld.wi		42
+	__push.wr
+	__ld.wm		__f_end - 2  /* i */
+	__sdiv.wt
+	__st.wtq
+	__bra		.LL8
+.LL11:
+.LL12:
+	__modsp		2
+
+	.dbg	line,	"tests/loop-14.c", 16; if (a3[1] != 42 || a3[2] != 21)
+	__ld.wm		_a3 + 2
+	__neq_w.wi	42
+	__btrue		.LL14
+	__ld.wm		_a3 + 4
+	__neq_w.wi	21
+.LL14:
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/loop-14.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-14.c", 19; exit (0);
+.LL13:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/loop-14.c", 20; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_a3:
+		ds	6
+
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,179 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-2b.c", 1; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/loop-2b.c", 3; int a[2];
+	.dbg	line,	"tests/loop-2b.c", 5; f (int i)
+	.dbg	line,	"tests/loop-2b.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/loop-2b.c", 7; for (; i < INT_MAX; i++)
+.LL3:
+	__ld.ws		0  /* i */
+	__slt_w.wi	32767
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wsq	0  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/loop-2b.c", 8; {
+
+	.dbg	line,	"tests/loop-2b.c", 9; a[i] = -2;
+	__ld2x.wsq	0  /* i */
+	__st.waxiq	-2, _a
+
+	.dbg	line,	"tests/loop-2b.c", 10; if (&a[i] == &a[1])
+	__ld.ws		0  /* i */
+	__asl.wr
+	__add.wi	_a
+	__equ_w.wi	_a + 2
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/loop-2b.c", 11; break;
+	__bra		.LL6
+
+	.dbg	line,	"tests/loop-2b.c", 12; }
+.LL7	.alias		.LL4
+.LL6:
+
+	.dbg	line,	"tests/loop-2b.c", 13; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/loop-2b.c", 15; main ()
+	.dbg	line,	"tests/loop-2b.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-2b.c", 17; a[0] = a[1] = 0;
+	__ld.wi		0
+	__st.wm		_a + 2
+	__st.wmq	_a
+
+	.dbg	line,	"tests/loop-2b.c", 18; f (0);
+	__pusharg.wr
+.LL9:
+	__ld.ws		0  /* i */
+	__slt_w.wi	32767
+	__btrue		.LL11
+	__bra		.LL13
+.LL10:
+	__inc.wsq	0  /* i */
+	__bra		.LL9
+.LL11:
+	__ld2x.wsq	0  /* i */
+	__st.waxiq	-2, _a
+	__ld.ws		0  /* i */
+	__asl.wr
+	__add.wi	_a
+	__equ_w.wi	_a + 2
+	__bfalse	.LL12
+.LL12	.alias		.LL10
+.LL13:
+.LL14:
+	__modsp		2
+
+	.dbg	line,	"tests/loop-2b.c", 19; if (a[0] != -2 || a[1] != -2)
+	__ld.wm		_a
+	__neq_w.wi	-2
+	__btrue		.LL16
+	__ld.wm		_a + 2
+	__neq_w.wi	-2
+.LL16:
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/loop-2b.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-2b.c", 21; exit (0);
+.LL15:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/loop-2b.c", 22; }
+.LL8:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_a:
+		ds	4
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
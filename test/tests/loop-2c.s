@@ -0,0 +1,192 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-2c.c", 1; int a[2];
+	.dbg	line,	"tests/loop-2c.c", 3; /*__inline__*/ f (int b, int o)
+	.dbg	line,	"tests/loop-2c.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/loop-2c.c", 5; unsigned int i;
+
+	.dbg	line,	"tests/loop-2c.c", 6; int *p;
+
+	.dbg	line,	"tests/loop-2c.c", 7; for (p = &a[b], i = b; --i < ~0; )
+	__ld.ws		2  /* b */
+	__asl.wr
+	__add.wi	_a
+	__st.wmq	__f_end - 4  /* p */
+	__ld.ws		2  /* b */
+	__st.wmq	__f_end - 2  /* i */
+.LL3:
+	__decld.wm	__f_end - 2  /* i */
+	__ult_w.wi	-1
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+.LL5:
+
+	.dbg	line,	"tests/loop-2c.c", 8; *--p = i * 3 + o;
+	__ld.wm		__f_end - 4  /* p */
+	__sub.wi	2
+	__st.wm		__f_end - 4  /* p */
+	__push.wr
+	__ld.wm		__f_end - 2  /* i */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__add.ws	0  /* o */
+	__st.wtq
+	__bra		.LL3
+.LL6:
+
+	.dbg	line,	"tests/loop-2c.c", 9; }
+.LL2:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/loop-2c.c", 11; g(int b)
+	.dbg	line,	"tests/loop-2c.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/loop-2c.c", 13; f (b, (int)a);
+	__ld.ws		0  /* b */
+	__pusharg.wr
+	__ld.wi		_a
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/loop-2c.c", 14; }
+.LL7:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/loop-2c.c", 16; main ()
+	.dbg	line,	"tests/loop-2c.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-2c.c", 18; a[0] = a[1] = 0;
+	__ld.wi		0
+	__st.wm		_a + 2
+	__st.wmq	_a
+
+	.dbg	line,	"tests/loop-2c.c", 19; g (2);
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		0  /* b */
+	__pusharg.wr
+	__ld.wi		_a
+	__pusharg.wr
+	__call		_f
+.LL9:
+	__modsp		2
+
+	.dbg	line,	"tests/loop-2c.c", 20; if (a[0] != (int)a || a[1] != (int)a + 3)
+	__ld.wm		_a
+	__neq_w.wi	_a
+	__btrue		.LL11
+	__ld.wm		_a + 2
+	__neq_w.wi	_a + 3
+.LL11:
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/loop-2c.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-2c.c", 22; exit (0);
+.LL10:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/loop-2c.c", 23; }
+.LL8:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_a:
+		ds	4
+
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,211 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-2g.c", 1; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/loop-2g.c", 3; #ifdef __unix__ /* ??? Is that good enough? */
+	.dbg	line,	"tests/loop-2g.c", 4; #include <sys/types.h>
+	.dbg	line,	"tests/loop-2g.c", 5; #include <sys/mman.h>
+	.dbg	line,	"tests/loop-2g.c", 6; #include <sys/stat.h>
+	.dbg	line,	"tests/loop-2g.c", 7; #include <fcntl.h>
+	.dbg	line,	"tests/loop-2g.c", 8; #ifndef MAP_ANON
+	.dbg	line,	"tests/loop-2g.c", 9; #ifdef MAP_ANONYMOUS
+	.dbg	line,	"tests/loop-2g.c", 10; #define MAP_ANON MAP_ANONYMOUS
+	.dbg	line,	"tests/loop-2g.c", 11; #else
+	.dbg	line,	"tests/loop-2g.c", 12; #define MAP_ANON MAP_FILE
+	.dbg	line,	"tests/loop-2g.c", 13; #endif
+	.dbg	line,	"tests/loop-2g.c", 14; #endif
+	.dbg	line,	"tests/loop-2g.c", 15; #ifndef MAP_FILE
+	.dbg	line,	"tests/loop-2g.c", 16; #define MAP_FILE 0
+	.dbg	line,	"tests/loop-2g.c", 17; #endif
+	.dbg	line,	"tests/loop-2g.c", 18; #ifndef MAP_FIXED
+	.dbg	line,	"tests/loop-2g.c", 19; #define MAP_FIXED 0
+	.dbg	line,	"tests/loop-2g.c", 20; #endif
+	.dbg	line,	"tests/loop-2g.c", 21; #endif
+	.dbg	line,	"tests/loop-2g.c", 23; #define MAP_START (void *)0x7fff8000
+	.dbg	line,	"tests/loop-2g.c", 24; #define MAP_LEN 0x10000
+	.dbg	line,	"tests/loop-2g.c", 26; #define OFFSET (MAP_LEN/2 - 2 * sizeof (char));
+	.dbg	line,	"tests/loop-2g.c", 28; f (int s, char *p)
+	.dbg	line,	"tests/loop-2g.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/loop-2g.c", 30; int i;
+
+	.dbg	line,	"tests/loop-2g.c", 31; for (i = s; &p[i] < &p[40] && i >= 0; i++)
+	__ld.ws		2  /* s */
+	__st.wmq	__f_end - 2  /* i */
+.LL3:
+	__ld.ws		0  /* p */
+	__add.wm	__f_end - 2  /* i */
+	__push.wr
+	__ld.ws		0  /* p */
+	__add.wi	40
+	__ult_w.wt
+	__bfalse	.LL7
+	__ld.wm		__f_end - 2  /* i */
+	__sge_w.wi	0
+.LL7:
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__f_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/loop-2g.c", 32; {
+
+	.dbg	line,	"tests/loop-2g.c", 33; p[i] = -2;
+	__ld.ws		0  /* p */
+	__add.wm	__f_end - 2  /* i */
+	__push.wr
+	__ld.wi		-2
+	__st.utq
+
+	.dbg	line,	"tests/loop-2g.c", 34; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/loop-2g.c", 35; }
+.LL2:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/loop-2g.c", 37; main ()
+	.dbg	line,	"tests/loop-2g.c", 38; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-2g.c", 39; #ifdef MAP_ANON
+
+	.dbg	line,	"tests/loop-2g.c", 40; char *p;
+
+	.dbg	line,	"tests/loop-2g.c", 41; int dev_zero;
+
+	.dbg	line,	"tests/loop-2g.c", 43; dev_zero = open ("/dev/zero", O_RDONLY);
+
+	.dbg	line,	"tests/loop-2g.c", 44; /* -1 is OK when we have MAP_ANON; else mmap will flag an error.  */
+
+	.dbg	line,	"tests/loop-2g.c", 45; if (INT_MAX != 0x7fffffffL || sizeof (char *) != sizeof (int))
+
+	.dbg	line,	"tests/loop-2g.c", 46; exit (0);
+
+	.dbg	line,	"tests/loop-2g.c", 47; p = mmap (MAP_START, MAP_LEN, PROT_READ|PROT_WRITE,
+
+	.dbg	line,	"tests/loop-2g.c", 48; MAP_ANON|MAP_FIXED|MAP_PRIVATE, dev_zero, 0);
+
+	.dbg	line,	"tests/loop-2g.c", 49; if (p != (char *)-1)
+
+	.dbg	line,	"tests/loop-2g.c", 50; {
+
+	.dbg	line,	"tests/loop-2g.c", 51; p += OFFSET;
+
+	.dbg	line,	"tests/loop-2g.c", 52; p[39] = 0;
+
+	.dbg	line,	"tests/loop-2g.c", 53; f (0, p);
+
+	.dbg	line,	"tests/loop-2g.c", 54; if (p[39] != (char)-2)
+
+	.dbg	line,	"tests/loop-2g.c", 55; abort ();
+
+	.dbg	line,	"tests/loop-2g.c", 56; p[39] = 0;
+
+	.dbg	line,	"tests/loop-2g.c", 57; f (-1, p);
+
+	.dbg	line,	"tests/loop-2g.c", 58; if (p[39] != 0)
+
+	.dbg	line,	"tests/loop-2g.c", 59; abort ();
+
+	.dbg	line,	"tests/loop-2g.c", 60; }
+
+	.dbg	line,	"tests/loop-2g.c", 61; #endif
+
+	.dbg	line,	"tests/loop-2g.c", 62; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/loop-2g.c", 63; }
+.LL8:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:15
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
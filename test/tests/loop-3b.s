@@ -0,0 +1,207 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-3b.c", 1; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/loop-3b.c", 3; int n;// = 0;
+	.dbg	line,	"tests/loop-3b.c", 5; g (int i)
+	.dbg	line,	"tests/loop-3b.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/loop-3b.c", 7; n++;
+	__inc.wmq	_n
+
+	.dbg	line,	"tests/loop-3b.c", 8; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/loop-3b.c", 10; f (int m)
+	.dbg	line,	"tests/loop-3b.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/loop-3b.c", 12; int i;
+
+	.dbg	line,	"tests/loop-3b.c", 13; i = m;
+	__ld.ws		0  /* m */
+	__st.wmq	__f_end - 2  /* i */
+
+	.dbg	line,	"tests/loop-3b.c", 14; do
+.LL4:
+
+	.dbg	line,	"tests/loop-3b.c", 15; {
+
+	.dbg	line,	"tests/loop-3b.c", 16; g (i * 4);
+	__ld.wm		__f_end - 2  /* i */
+	__asl.wi	2
+	__pusharg.wr
+	__inc.wmq	_n
+.LL7:
+	__modsp		2
+
+	.dbg	line,	"tests/loop-3b.c", 17; i -= INT_MAX / 8;
+	__sub_st.wmiq	4095, __f_end - 2  /* i */
+
+	.dbg	line,	"tests/loop-3b.c", 18; }
+
+	.dbg	line,	"tests/loop-3b.c", 19; while (i > 0);
+.LL5:
+	__ld.wm		__f_end - 2  /* i */
+	__sgt_w.wi	0
+	__btrue		.LL4
+.LL6:
+
+	.dbg	line,	"tests/loop-3b.c", 20; }
+.LL3:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/loop-3b.c", 22; main ()
+	.dbg	line,	"tests/loop-3b.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-3b.c", 24; f (INT_MAX/8*4);
+	__ld.wi		16380
+	__pusharg.wr
+	__ld.ws		0  /* m */
+	__st.wmq	__f_end - 2  /* i */
+.LL9:
+	__ld.wm		__f_end - 2  /* i */
+	__asl.wi	2
+	__pusharg.wr
+	__inc.wmq	_n
+.LL10:
+	__modsp		2
+	__sub_st.wmiq	4095, __f_end - 2  /* i */
+.LL11:
+	__ld.wm		__f_end - 2  /* i */
+	__sgt_w.wi	0
+	__btrue		.LL9
+.LL12:
+.LL13:
+	__modsp		2
+
+	.dbg	line,	"tests/loop-3b.c", 25; if (n != 4)
+	__ld.wm		_n
+	__neq_w.wi	4
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/loop-3b.c", 26; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-3b.c", 27; exit (0);
+.LL14:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/loop-3b.c", 28; }
+.LL8:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _f
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        58     16     2  overlaid locals
+;        24     10     2  n
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 16, 58
+__f_end	=	__overlay_frames + 2
+	auto_zp_var	_n, 2, 10, 24
+	.endm
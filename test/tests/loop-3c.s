@@ -0,0 +1,198 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-3c.c", 1; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/loop-3c.c", 3; void * a[255];
+	.dbg	line,	"tests/loop-3c.c", 5; f (int m)
+	.dbg	line,	"tests/loop-3c.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/loop-3c.c", 7; int i;
+
+	.dbg	line,	"tests/loop-3c.c", 8; int sh = 0x100;
+	__st.wmiq	256, __f_end - 4  /* sh */
+
+	.dbg	line,	"tests/loop-3c.c", 9; i = m;
+	__ld.ws		0  /* m */
+	__st.wmq	__f_end - 2  /* i */
+
+	.dbg	line,	"tests/loop-3c.c", 10; do
+.LL3:
+
+	.dbg	line,	"tests/loop-3c.c", 11; {
+
+	.dbg	line,	"tests/loop-3c.c", 12; a[sh >>= 1] = (/*(unsigned)*/i << 3)  + /*(char*)*/a;
+	__ld.wm		__f_end - 4  /* sh */
+	__asr.wi	1
+	__st.wm		__f_end - 4  /* sh */
+	__asl.wr
+	__add.wi	_a
+	__push.wr
+	__ld.wm		__f_end - 2  /* i */
+	__asl.wi	3
+	__push.wr
+	__ld.wi		_a
+	__double
+	__add.wt
+	__st.wtq
+
+	.dbg	line,	"tests/loop-3c.c", 13; i += 4;
+	__add_st.wmiq	4, __f_end - 2  /* i */
+
+	.dbg	line,	"tests/loop-3c.c", 14; }
+
+	.dbg	line,	"tests/loop-3c.c", 15; while (i < INT_MAX/2 + 1 + 4 * 4);
+.LL4:
+	__ld.wm		__f_end - 2  /* i */
+	__slt_w.wi	16400
+	__btrue		.LL3
+.LL5:
+
+	.dbg	line,	"tests/loop-3c.c", 16; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/loop-3c.c", 18; main ()
+	.dbg	line,	"tests/loop-3c.c", 19; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-3c.c", 20; a[0x10] = 0;
+	__st.wmiq	0, _a + 32
+
+	.dbg	line,	"tests/loop-3c.c", 21; a[0x08] = 0;
+	__st.wmiq	0, _a + 16
+
+	.dbg	line,	"tests/loop-3c.c", 22; f (INT_MAX/2 + INT_MAX/4 + 2);
+	__ld.wi		24576
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/loop-3c.c", 23; if (a[0x10] || a[0x08])
+	__tst.wm	_a + 32
+	__btrue		.LL8
+	__tst.wm	_a + 16
+.LL8:
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/loop-3c.c", 24; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-3c.c", 25; a[0x10] = 0;
+.LL7:
+	__st.wmiq	0, _a + 32
+
+	.dbg	line,	"tests/loop-3c.c", 26; a[0x08] = 0;
+	__st.wmiq	0, _a + 16
+
+	.dbg	line,	"tests/loop-3c.c", 27; f (INT_MAX/2 + 1);
+	__ld.wi		16384
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/loop-3c.c", 28; if (! a[0x10] || a[0x08])
+	__not.wm	_a + 32
+	__btrue		.LL10
+	__tst.wm	_a + 16
+.LL10:
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/loop-3c.c", 29; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-3c.c", 30; exit (0);
+.LL9:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/loop-3c.c", 31; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_a:
+		ds	510
+
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,249 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-5.c", 1; static int ap(int i);
+	.dbg	line,	"tests/loop-5.c", 2; const int ir[4] = {0,1,2,3};
+	.dbg	line,	"tests/loop-5.c", 3; static void testit(void){
+;***********************
+;***********************
+
+	.hucc
+	.proc		_testit
+	__enter		_testit
+
+	.dbg	line,	"tests/loop-5.c", 4; //int ir[4] = {0,1,2,3};
+
+	.dbg	line,	"tests/loop-5.c", 5; int ix,n,m;
+
+	.dbg	line,	"tests/loop-5.c", 6; n=1; m=3;
+	__st.wmiq	1, __testit_end - 4  /* n */
+
+	.dbg	line,	"tests/loop-5.c", 7; for (ix=1;ix<=4;ix++) {
+	__st.wmiq	1, __testit_end - 2  /* ix */
+.LL3:
+	__ld.wm		__testit_end - 2  /* ix */
+	__sle_w.wi	4
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__testit_end - 2  /* ix */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/loop-5.c", 8; if (n == 1) m = 4;
+	__ld.wm		__testit_end - 4  /* n */
+	__equ_w.wi	1
+	__bfalse	.LL7
+	__st.wmiq	4, __testit_end - 6  /* m */
+
+	.dbg	line,	"tests/loop-5.c", 9; else        m = n-1;
+	__bra		.LL8
+.LL7:
+	__ld.wm		__testit_end - 4  /* n */
+	__sub.wi	1
+	__st.wmq	__testit_end - 6  /* m */
+.LL8:
+
+	.dbg	line,	"tests/loop-5.c", 10; ap(ir[n-1]);
+	__ld.wm		__testit_end - 4  /* n */
+	__sub.wi	1
+	__ld.war	_ir
+	__pusharg.wr
+	__call		_ap
+
+	.dbg	line,	"tests/loop-5.c", 11; n = m;
+	__ld.wm		__testit_end - 6  /* m */
+	__st.wmq	__testit_end - 4  /* n */
+
+	.dbg	line,	"tests/loop-5.c", 12; }
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/loop-5.c", 13; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/loop-5.c", 15; static int t;// = 0;
+	.dbg	line,	"tests/loop-5.c", 16; static int a[4];
+	.dbg	line,	"tests/loop-5.c", 18; static int ap(int i){
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ap
+	__enter		_ap
+
+	.dbg	line,	"tests/loop-5.c", 19; if (t > 3)
+	__ld.wm		_t
+	__sgt_w.wi	3
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/loop-5.c", 20; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-5.c", 21; a[t++] = i;
+.LL10:
+	__ldinc.wm	_t
+	__index.wr	_a
+	__ld.ws		0  /* i */
+	__st.watq	_a
+
+	.dbg	line,	"tests/loop-5.c", 22; return 1;
+	__ld.wi		1
+.LL9:
+
+	.dbg	line,	"tests/loop-5.c", 23; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/loop-5.c", 25; int main(void)
+	.dbg	line,	"tests/loop-5.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-5.c", 27; testit();
+	__call		_testit
+
+	.dbg	line,	"tests/loop-5.c", 28; if (a[0] != 0)
+	__tst.wm	_a
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/loop-5.c", 29; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-5.c", 30; if (a[1] != 3)
+.LL12:
+	__ld.wm		_a + 2
+	__neq_w.wi	3
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/loop-5.c", 31; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-5.c", 32; if (a[2] != 2)
+.LL13:
+	__ld.wm		_a + 4
+	__neq_w.wi	2
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/loop-5.c", 33; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-5.c", 34; if (a[3] != 1)
+.LL14:
+	__ld.wm		_a + 6
+	__neq_w.wi	1
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/loop-5.c", 35; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-5.c", 36; exit(0);
+.LL15:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/loop-5.c", 37; }
+.LL11:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_ir:
+		dw	0
+		dw	1
+		dw	2
+		dw	3
+
+	.bss
+_a:
+		ds	8
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:8
+;	global pool:8
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _testit
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       164     24     6  overlaid locals
+;         6      6     2  t
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 24, 164
+__testit_end	=	__overlay_frames + 6
+	auto_zp_var	_t, 2, 6, 6
+	.endm
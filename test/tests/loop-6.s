@@ -0,0 +1,134 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-6.c", 1; main()
+	.dbg	line,	"tests/loop-6.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-6.c", 3; char c;
+
+	.dbg	line,	"tests/loop-6.c", 4; char d;
+
+	.dbg	line,	"tests/loop-6.c", 5; int nbits;
+
+	.dbg	line,	"tests/loop-6.c", 6; c = -1;
+	__st.umiq	-1, __main_end - 1  /* c */
+
+	.dbg	line,	"tests/loop-6.c", 7; for (nbits = 1 ; nbits < 100; nbits++) {
+	__st.wmiq	1, __main_end - 4  /* nbits */
+.LL3:
+	__ld.wm		__main_end - 4  /* nbits */
+	__slt_w.wi	100
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__main_end - 4  /* nbits */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/loop-6.c", 8; d = (1 << nbits) - 1;
+	__ld.wi		1
+	__push.wr
+	__ld.wm		__main_end - 4  /* nbits */
+	__asl.wt
+	__sub.wi	1
+	__st.umq	__main_end - 2  /* d */
+
+	.dbg	line,	"tests/loop-6.c", 9; if (d == c)
+	__equ_b.umq	__main_end - 1  /* c */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/loop-6.c", 10; break;
+	__bra		.LL6
+
+	.dbg	line,	"tests/loop-6.c", 11; }
+.LL7	.alias		.LL4
+.LL6:
+
+	.dbg	line,	"tests/loop-6.c", 12; if (nbits == 100)
+	__ld.wm		__main_end - 4  /* nbits */
+	__equ_w.wi	100
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/loop-6.c", 13; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-6.c", 14; exit(0);
+.LL8:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/loop-6.c", 15; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,154 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-7.c", 1; void foo (unsigned int n)
+	.dbg	line,	"tests/loop-7.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/loop-7.c", 3; int i, j = -1;
+	__st.wmiq	-1, __foo_end - 4  /* j */
+
+	.dbg	line,	"tests/loop-7.c", 5; for (i = 0; i < 10 && j < 0; i++)
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL3:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.wi	10
+	__bfalse	.LL7
+	__ld.wm		__foo_end - 4  /* j */
+	__slt_w.wi	0
+.LL7:
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/loop-7.c", 6; {
+
+	.dbg	line,	"tests/loop-7.c", 7; if ((1/*UL*/ << i) == n)
+	__ld.wi		1
+	__push.wr
+	__ld.wm		__foo_end - 2  /* i */
+	__asl.wt
+	__equ_w.ws	0  /* n */
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/loop-7.c", 8; j = i;
+	__ld.wm		__foo_end - 2  /* i */
+	__st.wmq	__foo_end - 4  /* j */
+
+	.dbg	line,	"tests/loop-7.c", 9; }
+.LL8	.alias		.LL4
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/loop-7.c", 11; if (j < 0)
+	__ld.wm		__foo_end - 4  /* j */
+	__slt_w.wi	0
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/loop-7.c", 12; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-7.c", 13; }
+.LL9:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/loop-7.c", 15; main()
+	.dbg	line,	"tests/loop-7.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-7.c", 17; foo (64);
+	__ld.wi		64
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/loop-7.c", 18; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/loop-7.c", 19; }
+.LL10:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
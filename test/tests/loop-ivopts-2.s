@@ -0,0 +1,285 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/loop-ivopts-2.c", 1; /* PR rtl-optimization/20290  */
+	.dbg	line,	"tests/loop-ivopts-2.c", 2; 
+	.dbg	line,	"tests/loop-ivopts-2.c", 3; /* We used to mis-optimize the second loop in main on at least ppc and
+	.dbg	line,	"tests/loop-ivopts-2.c", 4; arm, because tree loop would change the loop to something like:
+	.dbg	line,	"tests/loop-ivopts-2.c", 6; ivtmp.65 = &l[i];
+	.dbg	line,	"tests/loop-ivopts-2.c", 7; ivtmp.16 = 113;
+	.dbg	line,	"tests/loop-ivopts-2.c", 8; goto <bb 4> (<L4>);
+	.dbg	line,	"tests/loop-ivopts-2.c", 10; <L3>:;
+	.dbg	line,	"tests/loop-ivopts-2.c", 11; *(ivtmp.65 + 4294967292B) = 9;
+	.dbg	line,	"tests/loop-ivopts-2.c", 12; i = i + 1;
+	.dbg	line,	"tests/loop-ivopts-2.c", 14; <L4>:;
+	.dbg	line,	"tests/loop-ivopts-2.c", 15; ivtmp.16 = ivtmp.16 - 1;
+	.dbg	line,	"tests/loop-ivopts-2.c", 16; ivtmp.65 = ivtmp.65 + 4B;
+	.dbg	line,	"tests/loop-ivopts-2.c", 17; if (ivtmp.16 != 0) goto <L3>; 
+	.dbg	line,	"tests/loop-ivopts-2.c", 19; We used to consider the increment of i as executed in every
+	.dbg	line,	"tests/loop-ivopts-2.c", 20; iteration, so we'd miscompute the final value.  */
+	.dbg	line,	"tests/loop-ivopts-2.c", 22; extern void abort (void);
+	.dbg	line,	"tests/loop-ivopts-2.c", 24; void
+	.dbg	line,	"tests/loop-ivopts-2.c", 25; check (unsigned int *l)
+	.dbg	line,	"tests/loop-ivopts-2.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_check
+	__enter		_check
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 27; int i;
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 28; for (i = 0; i < 288; i++)
+	__st.wmiq	0, __check_end - 2  /* i */
+.LL3:
+	__ld.wm		__check_end - 2  /* i */
+	__slt_w.wi	288
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__check_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 29; if (l[i] != 7 + (i < 256 || i >= 280) + (i >= 144 && i < 256))
+	__ld.wm		__check_end - 2  /* i */
+	__asl.wr
+	__add.ws	0  /* l */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.wm		__check_end - 2  /* i */
+	__slt_w.wi	256
+	__btrue		.LL8
+	__ld.wm		__check_end - 2  /* i */
+	__sge_w.wi	280
+.LL8:
+	__bool
+	__add.wi	7
+	__push.wr
+	__ld.wm		__check_end - 2  /* i */
+	__sge_w.wi	144
+	__bfalse	.LL9
+	__ld.wm		__check_end - 2  /* i */
+	__slt_w.wi	256
+.LL9:
+	__bool
+	__add.wt
+	__neq_w.wt
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 30; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 31; }
+.LL7	.alias		.LL4
+	__bra		.LL4
+.LL6:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__check_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 33; int
+	.dbg	line,	"tests/loop-ivopts-2.c", 34; main (void)
+	.dbg	line,	"tests/loop-ivopts-2.c", 35; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 36; #ifdef NORECURSE
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 37; int i;
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 38; unsigned int l[288];
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 40; for (i = 0; i < 144; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL11:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	144
+	__btrue		.LL13
+	__bra		.LL14
+.LL12:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL11
+.LL13:
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 41; l[i] = 8;
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wr
+	__add.wi	__main_end - 578  /* l */
+	__push.wr
+	__ld.wi		8
+	__st.wtq
+	__bra		.LL12
+.LL14:
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 42; for (; i < 256; i++)
+.LL15:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	256
+	__btrue		.LL17
+	__bra		.LL18
+.LL16:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL15
+.LL17:
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 43; l[i] = 9;
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wr
+	__add.wi	__main_end - 578  /* l */
+	__push.wr
+	__ld.wi		9
+	__st.wtq
+	__bra		.LL16
+.LL18:
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 44; for (; i < 280; i++)
+.LL19:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	280
+	__btrue		.LL21
+	__bra		.LL22
+.LL20:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL19
+.LL21:
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 45; l[i] = 7;
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wr
+	__add.wi	__main_end - 578  /* l */
+	__push.wr
+	__ld.wi		7
+	__st.wtq
+	__bra		.LL20
+.LL22:
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 46; for (; i < 288; i++)
+.LL23:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	288
+	__btrue		.LL25
+	__bra		.LL26
+.LL24:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL23
+.LL25:
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 47; l[i] = 8;
+	__ld.wm		__main_end - 2  /* i */
+	__asl.wr
+	__add.wi	__main_end - 578  /* l */
+	__push.wr
+	__ld.wi		8
+	__st.wtq
+	__bra		.LL24
+.LL26:
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 48; check (l);
+	__ld.wi		__main_end - 578  /* l */
+	__pusharg.wr
+	__call		_check
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 49; #endif
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 50; return 0;
+	__ld.wi		0
+.LL10:
+
+	.dbg	line,	"tests/loop-ivopts-2.c", 51; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0   578  _main
+;
+; 578 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       274     36   578  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 578, 36, 274
+__main_end	=	__overlay_frames + 578
+	.endm
@@ -0,0 +1,115 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/mayalias-1.c", 1; /* Tests that the may_alias attribute works as expected.
+	.dbg	line,	"tests/mayalias-1.c", 2; Author: Osku Salerma <osku@iki.fi> Apr 2002.  */
+	.dbg	line,	"tests/mayalias-1.c", 3; 
+	.dbg	line,	"tests/mayalias-1.c", 4; extern void abort(void);
+	.dbg	line,	"tests/mayalias-1.c", 5; extern void exit(int);
+	.dbg	line,	"tests/mayalias-1.c", 7; //typedef char __attribute__((__may_alias__)) short_a;
+	.dbg	line,	"tests/mayalias-1.c", 8; #define short_a char
+	.dbg	line,	"tests/mayalias-1.c", 10; int
+	.dbg	line,	"tests/mayalias-1.c", 11; main (void)
+	.dbg	line,	"tests/mayalias-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/mayalias-1.c", 13; int a = 0x1234;
+	__st.wmiq	4660, __main_end - 2  /* a */
+
+	.dbg	line,	"tests/mayalias-1.c", 14; short_a *b; b = /*(short_a*)*/ &a;
+	__ld.wi		__main_end - 2  /* a */
+	__st.wmq	__main_end - 4  /* b */
+
+	.dbg	line,	"tests/mayalias-1.c", 16; b[1] = 0;
+	__add.wi	1
+	__push.wr
+	__ld.wi		0
+	__st.utq
+
+	.dbg	line,	"tests/mayalias-1.c", 18; if (a == 0x1234)
+	__ld.wm		__main_end - 2  /* a */
+	__equ_w.wi	4660
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/mayalias-1.c", 19; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/mayalias-1.c", 21; exit(0);
+.LL3:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/mayalias-1.c", 22; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,132 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/mayalias-2.c", 1; struct S { short x; };
+	.dbg	line,	"tests/mayalias-2.c", 2; //typedef struct S __attribute__((__may_alias__)) test;
+	.dbg	line,	"tests/mayalias-2.c", 3; #define test struct S
+	.dbg	line,	"tests/mayalias-2.c", 5; int f() {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/mayalias-2.c", 6; int a=10;
+	__st.wmiq	10, __f_end - 2  /* a */
+
+	.dbg	line,	"tests/mayalias-2.c", 7; test *p; p =/*(test *)*/&a;
+	__ld.wi		__f_end - 2  /* a */
+	__st.wmq	__f_end - 4  /* p */
+
+	.dbg	line,	"tests/mayalias-2.c", 8; p->x = 1;
+	__push.wr
+	__ld.wi		1
+	__st.wtq
+
+	.dbg	line,	"tests/mayalias-2.c", 9; return a;
+	__ld.wm		__f_end - 2  /* a */
+.LL2:
+
+	.dbg	line,	"tests/mayalias-2.c", 10; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/mayalias-2.c", 12; int main() {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/mayalias-2.c", 13; if (f() == 10)
+	__st.wmiq	10, __f_end - 2  /* a */
+	__ld.wi		__f_end - 2  /* a */
+	__st.wmq	__f_end - 4  /* p */
+	__push.wr
+	__ld.wi		1
+	__st.wtq
+	__ld.wm		__f_end - 2  /* a */
+.LL5:
+	__equ_w.wi	10
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/mayalias-2.c", 14; /*__builtin_*/abort();
+	__call		_abort
+
+	.dbg	line,	"tests/mayalias-2.c", 15; return 0;
+.LL4:
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/mayalias-2.c", 16; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
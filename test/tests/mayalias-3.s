@@ -0,0 +1,191 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/mayalias-3.c", 1; struct S { short x; };
+	.dbg	line,	"tests/mayalias-3.c", 2; //typedef struct S __attribute__((__may_alias__)) test;
+	.dbg	line,	"tests/mayalias-3.c", 3; #define test struct S
+	.dbg	line,	"tests/mayalias-3.c", 5; test *p;
+	.dbg	line,	"tests/mayalias-3.c", 7; int g(int *a)
+	.dbg	line,	"tests/mayalias-3.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/mayalias-3.c", 9; p = /*(test*)*/a;
+	__ld.ws		0  /* a */
+	__st.wmq	_p
+
+	.dbg	line,	"tests/mayalias-3.c", 10; }
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/mayalias-3.c", 12; int f()
+	.dbg	line,	"tests/mayalias-3.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/mayalias-3.c", 14; int a;
+
+	.dbg	line,	"tests/mayalias-3.c", 15; test s;
+
+	.dbg	line,	"tests/mayalias-3.c", 16; g(&a);
+	__ld.wi		__f_end - 2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__st.wmq	_p
+.LL4:
+	__modsp		2
+
+	.dbg	line,	"tests/mayalias-3.c", 17; a = 10;
+	__st.wmiq	10, __f_end - 2  /* a */
+
+	.dbg	line,	"tests/mayalias-3.c", 18; //test s={1};
+
+	.dbg	line,	"tests/mayalias-3.c", 19; s.x = 1;
+	__st.wmiq	1, __f_end - 4  /* s */
+
+	.dbg	line,	"tests/mayalias-3.c", 20; *p=s;
+	__ld.wm		_p
+	__push.wr
+	__ld.wm		__f_end - 4  /* s */
+	__st.wtq
+
+	.dbg	line,	"tests/mayalias-3.c", 21; return a;
+	__ld.wm		__f_end - 2  /* a */
+.LL3:
+
+	.dbg	line,	"tests/mayalias-3.c", 22; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/mayalias-3.c", 24; int main() {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/mayalias-3.c", 25; if (f() == 10)
+	__ld.wi		__f_end - 2  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__st.wmq	_p
+.LL7:
+	__modsp		2
+	__st.wmiq	10, __f_end - 2  /* a */
+	__st.wmiq	1, __f_end - 4  /* s */
+	__ld.wm		_p
+	__push.wr
+	__ld.wm		__f_end - 4  /* s */
+	__st.wtq
+	__ld.wm		__f_end - 2  /* a */
+.LL8:
+	__equ_w.wi	10
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/mayalias-3.c", 26; /*__builtin_*/abort();
+	__call		_abort
+
+	.dbg	line,	"tests/mayalias-3.c", 27; return 0;
+.LL6:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/mayalias-3.c", 28; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:7
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _f
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        20     20     4  overlaid locals
+;        10     10     2  p
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 20, 20
+__f_end	=	__overlay_frames + 4
+	auto_zp_var	_p, 2, 10, 10
+	.endm
@@ -0,0 +1,185 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/medce-1.c", 2; extern void abort (void);
+	.dbg	line,	"tests/medce-1.c", 3; extern void link_error (void);
+	.dbg	line,	"tests/medce-1.c", 5; static int ok;// = 0;
+	.dbg	line,	"tests/medce-1.c", 7; void bar (void)
+	.dbg	line,	"tests/medce-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/medce-1.c", 9; ok = 1;
+	__st.wmiq	1, _ok
+
+	.dbg	line,	"tests/medce-1.c", 10; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/medce-1.c", 12; void foo(int x)
+	.dbg	line,	"tests/medce-1.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/medce-1.c", 14; switch (x)
+	__ld.ws		0  /* x */
+	__bra		.LL4
+
+	.dbg	line,	"tests/medce-1.c", 15; {
+
+	.dbg	line,	"tests/medce-1.c", 16; case 0:
+.LL6:
+	__case		0
+
+	.dbg	line,	"tests/medce-1.c", 17; if (0)
+	__ld.wi		0
+	__tst.wr
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/medce-1.c", 18; {
+
+	.dbg	line,	"tests/medce-1.c", 19; //link_error();
+
+	.dbg	line,	"tests/medce-1.c", 20; case 1:
+	__endcase
+.LL8:
+	__case		1
+
+	.dbg	line,	"tests/medce-1.c", 21; bar();
+	__st.wmiq	1, _ok
+.LL9	.alias		.LL5
+
+	.dbg	line,	"tests/medce-1.c", 22; }
+
+	.dbg	line,	"tests/medce-1.c", 23; }
+.LL7	.alias		.LL5
+	__bra		.LL5
+.LL4:
+	__switch_r.wr	0, 1
+
+!table:		dw	.LL6, .LL8
+		dw	.LL5
+.LL5:
+
+	.dbg	line,	"tests/medce-1.c", 24; }
+.LL3:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/medce-1.c", 26; int main()
+	.dbg	line,	"tests/medce-1.c", 27; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/medce-1.c", 28; foo (1);
+	__ld.wi		1
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/medce-1.c", 29; if (!ok)
+	__not.wm	_ok
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/medce-1.c", 30; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/medce-1.c", 31; return 0;
+.LL11:
+	__ld.wi		0
+.LL10:
+
+	.dbg	line,	"tests/medce-1.c", 32; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  ok
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_ok, 2, 6, 6
+	.endm
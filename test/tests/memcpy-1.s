@@ -0,0 +1,481 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/memcpy-1.c", 1; #include <string.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 3; #endif
+	.dbg	line,	"tests/memcpy-1.c", 3; #ifdef __HUCC__
+	.dbg	line,	"tests/memcpy-1.c", 4; #ifdef NORECURSE
+	.dbg	line,	"tests/memcpy-1.c", 5; #define MEMCPY_SIZE 512 //(1 << 17)
+	.dbg	line,	"tests/memcpy-1.c", 6; #else
+	.dbg	line,	"tests/memcpy-1.c", 7; #define MEMCPY_SIZE (STACK_SIZE / 3)
+	.dbg	line,	"tests/memcpy-1.c", 8; #endif
+	.dbg	line,	"tests/memcpy-1.c", 9; #else
+	.dbg	line,	"tests/memcpy-1.c", 10; //#if defined (STACK_SIZE)
+	.dbg	line,	"tests/memcpy-1.c", 11; //#define MEMCPY_SIZE (STACK_SIZE / 3)
+	.dbg	line,	"tests/memcpy-1.c", 12; //#else
+	.dbg	line,	"tests/memcpy-1.c", 13; #define MEMCPY_SIZE 512 //(1 << 17)
+	.dbg	line,	"tests/memcpy-1.c", 14; //#endif
+	.dbg	line,	"tests/memcpy-1.c", 15; #endif
+	.dbg	line,	"tests/memcpy-1.c", 17; void *copy (void *o, const void *i, unsigned l)
+	.dbg	line,	"tests/memcpy-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_copy
+	__enter		_copy
+
+	.dbg	line,	"tests/memcpy-1.c", 19; return memcpy (o, i, l);
+	__ld.ws		4  /* o */
+	__st.wmq	ram_tii_dst
+	__ld.ws		2  /* i */
+	__st.wmq	ram_tii_src
+	__ld.ws		0  /* l */
+	__call		_memcpy.3
+.LL2:
+
+	.dbg	line,	"tests/memcpy-1.c", 20; }
+	__modsp		6
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/memcpy-1.c", 22; main ()
+	.dbg	line,	"tests/memcpy-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/memcpy-1.c", 24; unsigned i;
+
+	.dbg	line,	"tests/memcpy-1.c", 25; unsigned char src[MEMCPY_SIZE];
+
+	.dbg	line,	"tests/memcpy-1.c", 26; unsigned char dst[MEMCPY_SIZE];
+
+	.dbg	line,	"tests/memcpy-1.c", 28; for (i = 0; i < MEMCPY_SIZE; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL4:
+	__ld.wm		__main_end - 2  /* i */
+	__ult_w.wi	512
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/memcpy-1.c", 29; src[i] = (unsigned char) i,  dst[i] = 0;
+	__ld.wm		__main_end - 2  /* i */
+	__add.wi	__main_end - 514  /* src */
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__ext.ur
+	__st.utq
+	__ld.wm		__main_end - 2  /* i */
+	__add.wi	__main_end - 1026  /* dst */
+	__push.wr
+	__ld.wi		0
+	__st.utq
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/memcpy-1.c", 31; /*(void)*/ memcpy (dst, src, MEMCPY_SIZE / 128);
+	__ld.wi		__main_end - 1026  /* dst */
+	__st.wmq	ram_tii_dst
+	__ld.wi		__main_end - 514  /* src */
+	__st.wmq	ram_tii_src
+	__ld.wi		4
+	__call		_memcpy.3
+
+	.dbg	line,	"tests/memcpy-1.c", 33; for (i = 0; i < MEMCPY_SIZE / 128; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL8:
+	__ld.wm		__main_end - 2  /* i */
+	__ult_w.wi	4
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL8
+.LL10:
+
+	.dbg	line,	"tests/memcpy-1.c", 34; if (dst[i] != (unsigned char) i)
+	__ld.wm		__main_end - 2  /* i */
+	__add.wi	__main_end - 1026  /* dst */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__ext.ur
+	__neq_w.wt
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/memcpy-1.c", 35; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/memcpy-1.c", 37; /*(void)*/ memset (dst, 1, MEMCPY_SIZE / 128);
+.LL12	.alias		.LL9
+	__bra		.LL9
+.LL11:
+	__ld.wi		__main_end - 1026  /* dst */
+	__st.wmq	ram_tii_src
+	__st.umiq	1, _al
+	__ld.wi		4
+	__call		_memset.3
+
+	.dbg	line,	"tests/memcpy-1.c", 39; for (i = 0; i < MEMCPY_SIZE / 128; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL13:
+	__ld.wm		__main_end - 2  /* i */
+	__ult_w.wi	4
+	__btrue		.LL15
+	__bra		.LL16
+.LL14:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL13
+.LL15:
+
+	.dbg	line,	"tests/memcpy-1.c", 40; if (dst[i] != 1)
+	__ld.wm		__main_end - 2  /* i */
+	__add.wi	__main_end - 1026  /* dst */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__neq_b.uiq	1
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/memcpy-1.c", 41; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/memcpy-1.c", 43; /*(void)*/ memcpy (dst, src, MEMCPY_SIZE);
+.LL17	.alias		.LL14
+	__bra		.LL14
+.LL16:
+	__ld.wi		__main_end - 1026  /* dst */
+	__st.wmq	ram_tii_dst
+	__ld.wi		__main_end - 514  /* src */
+	__st.wmq	ram_tii_src
+	__ld.wi		512
+	__call		_memcpy.3
+
+	.dbg	line,	"tests/memcpy-1.c", 45; for (i = 0; i < MEMCPY_SIZE; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL18:
+	__ld.wm		__main_end - 2  /* i */
+	__ult_w.wi	512
+	__btrue		.LL20
+	__bra		.LL21
+.LL19:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL18
+.LL20:
+
+	.dbg	line,	"tests/memcpy-1.c", 46; if (dst[i] != (unsigned char) i)
+	__ld.wm		__main_end - 2  /* i */
+	__add.wi	__main_end - 1026  /* dst */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__ext.ur
+	__neq_w.wt
+	__bfalse	.LL22
+
+	.dbg	line,	"tests/memcpy-1.c", 47; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/memcpy-1.c", 49; /*(void)*/ memset (dst, 0, MEMCPY_SIZE);
+.LL22	.alias		.LL19
+	__bra		.LL19
+.LL21:
+	__ld.wi		__main_end - 1026  /* dst */
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		512
+	__call		_memset.3
+
+	.dbg	line,	"tests/memcpy-1.c", 51; for (i = 0; i < MEMCPY_SIZE; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL23:
+	__ld.wm		__main_end - 2  /* i */
+	__ult_w.wi	512
+	__btrue		.LL25
+	__bra		.LL26
+.LL24:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL23
+.LL25:
+
+	.dbg	line,	"tests/memcpy-1.c", 52; if (dst[i] != 0)
+	__ld.wm		__main_end - 2  /* i */
+	__add.wi	__main_end - 1026  /* dst */
+	__st.wm		__ptr
+	__tst.up	__ptr
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/memcpy-1.c", 53; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/memcpy-1.c", 55; /*(void)*/ copy (dst, src, MEMCPY_SIZE / 128);
+.LL27	.alias		.LL24
+	__bra		.LL24
+.LL26:
+	__ld.wi		__main_end - 1026  /* dst */
+	__pusharg.wr
+	__ld.wi		__main_end - 514  /* src */
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.ws		4  /* o */
+	__st.wmq	ram_tii_dst
+	__ld.ws		2  /* i */
+	__st.wmq	ram_tii_src
+	__ld.ws		0  /* l */
+	__call		_memcpy.3
+.LL28:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-1.c", 57; for (i = 0; i < MEMCPY_SIZE / 128; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL29:
+	__ld.wm		__main_end - 2  /* i */
+	__ult_w.wi	4
+	__btrue		.LL31
+	__bra		.LL32
+.LL30:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL29
+.LL31:
+
+	.dbg	line,	"tests/memcpy-1.c", 58; if (dst[i] != (unsigned char) i)
+	__ld.wm		__main_end - 2  /* i */
+	__add.wi	__main_end - 1026  /* dst */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__ext.ur
+	__neq_w.wt
+	__bfalse	.LL33
+
+	.dbg	line,	"tests/memcpy-1.c", 59; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/memcpy-1.c", 61; /*(void)*/ memset (dst, 0, MEMCPY_SIZE);
+.LL33	.alias		.LL30
+	__bra		.LL30
+.LL32:
+	__ld.wi		__main_end - 1026  /* dst */
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		512
+	__call		_memset.3
+
+	.dbg	line,	"tests/memcpy-1.c", 63; /*(void)*/ copy (dst, src, MEMCPY_SIZE);
+	__ld.wi		__main_end - 1026  /* dst */
+	__pusharg.wr
+	__ld.wi		__main_end - 514  /* src */
+	__pusharg.wr
+	__ld.wi		512
+	__pusharg.wr
+	__ld.ws		4  /* o */
+	__st.wmq	ram_tii_dst
+	__ld.ws		2  /* i */
+	__st.wmq	ram_tii_src
+	__ld.ws		0  /* l */
+	__call		_memcpy.3
+.LL34:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-1.c", 65; for (i = 0; i < MEMCPY_SIZE; i++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL35:
+	__ld.wm		__main_end - 2  /* i */
+	__ult_w.wi	512
+	__btrue		.LL37
+	__bra		.LL38
+.LL36:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL35
+.LL37:
+
+	.dbg	line,	"tests/memcpy-1.c", 66; if (dst[i] != (unsigned char) i)
+	__ld.wm		__main_end - 2  /* i */
+	__add.wi	__main_end - 1026  /* dst */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__push.wr
+	__ld.wm		__main_end - 2  /* i */
+	__ext.ur
+	__neq_w.wt
+	__bfalse	.LL39
+
+	.dbg	line,	"tests/memcpy-1.c", 67; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/memcpy-1.c", 69; exit (0);
+.LL39	.alias		.LL36
+	__bra		.LL36
+.LL38:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/memcpy-1.c", 70; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:21
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0  1026  _main
+;
+; 1026 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       708    120  1026  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 1026, 120, 708
+__main_end	=	__overlay_frames + 1026
+	.endm
@@ -0,0 +1,2659 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/memcpy-bi.c", 1; /* Test builtin-memcpy (which may emit different code for different N).  */
+	.dbg	line,	"tests/memcpy-bi.c", 3; #include <string.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 1; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 2; #include "hucc-string.h"
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 1; #ifndef _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 2; #define _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 4; /****************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 5; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 6; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 7; ; hucc-string.h
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 8; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 9; ; Not-quite-standard, but fast, replacements for <string.h>.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 10; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 11; ; Copyright John Brandwood 2024.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 12; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 13; ; Distributed under the Boost Software License, Version 1.0.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 14; ; (See accompanying file LICENSE_1_0.txt or copy at
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 15; ;  http://www.boost.org/LICENSE_1_0.txt)
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 16; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 17; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 18; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 19; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 20; ; !!! WARNING : non-standard return values !!!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 21; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 22; ; Strings are limited to a maximum of 255 characters (+ the terminator)!
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 23; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 24; ; The memcpy(), strcpy() and strcat() functions do NOT return the destination
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 25; ; address, and they are declared "void" to check that the value is not used.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 26; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 27; ; mempcpy() is provided which returns the end address instead of the starting
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 28; ; address, because this is typically more useful.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 29; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 30; ; Please note that both memcpy() and memset() are implemented using a TII for
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 31; ; speed, and so the length should be < 16 bytes if used in time-critical bits
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 32; ; of code (such as when using a split screen) because they delay interrupts.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 33; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 34; ; strncpy() and strncat() are not provided, because strncpy() was not created
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 35; ; for the purpose of avoiding string overruns, and strncat() is just a poorly
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 36; ; designed function IMHO.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 37; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 38; ; POSIX strlcpy() and strlcat() are provided instead, but once again they are
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 39; ; slightly non-standard in that the return value when there is an overflow is
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 40; ; the buffer size (so that the overflow can be detected), instead of the full
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 41; ; size of the destination string that was too big to fit in the buffer.
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 42; ;
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 43; ; ***************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 44; ; **************************************************************************/
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 46; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 47; // Functions in hucc-string.asm ...
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 48; // *************
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 50; #ifdef __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 52; #asmdef	HUCC_USES_STRING 1
+HUCC_USES_STRING = 1
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 54; extern void __fastcall strcpy( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 55; extern void __fastcall strcat( char *destination<_di>, char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 57; extern unsigned int __fastcall strlen( char *source<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 59; extern unsigned int __fastcall strlcpy( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 60; extern unsigned int __fastcall strlcat( char *destination<_di>, char *source<_bp>, unsigned char size<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 62; extern void __fastcall memcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 63; extern void __fastcall farmemcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 64; extern void __fastcall far_memcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 66; extern unsigned char * __fastcall mempcpy( unsigned char *destination<ram_tii_dst>, unsigned char *source<ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 67; extern unsigned char * __fastcall farmempcpy( unsigned char *destination<ram_tii_dst>, unsigned char __far *source<_bp_bank:ram_tii_src>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 68; extern unsigned char * __fastcall far_mempcpy( unsigned char *destination<ram_tii_dst>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 70; extern void __fastcall memset( unsigned char *destination<ram_tii_src>, unsigned char value<_al>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 72; //  0 	if strings are equal
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 73; //  1 	if the first non-matching character in string1 > string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 74; // -1 	if the first non-matching character in string1 < string2 (in ASCII).
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 76; extern int __fastcall strcmp( char *string1<_di>, char *string2<_bp> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 77; extern int __fastcall strncmp( char *string1<_di>, char *string2<_bp>, unsigned int count<_ax> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 79; extern int __fastcall __macro memcmp( unsigned char *string1<_di>, unsigned char *string2<_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 80; extern int __fastcall farmemcmp( unsigned char *string1<_di>, unsigned char __far *string2<_bp_bank:_bp>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 81; extern int __fastcall far_memcmp( unsigned char *string1<_di>, unsigned int count<acc> );
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 83; #endif // __HUCC__
+	.dbg	line,	"/root/repo/test/../include/hucc/hucc-string.h", 85; #endif // _hucc_string_h
+	.dbg	line,	"/root/repo/test/../include/hucc/string.h", 3; #endif
+	.dbg	line,	"tests/memcpy-bi.c", 5; #define TESTSIZE 80
+	.dbg	line,	"tests/memcpy-bi.c", 7; char src[TESTSIZE];// __attribute__ ((aligned));
+	.dbg	line,	"tests/memcpy-bi.c", 8; char dst[TESTSIZE];// __attribute__ ((aligned));
+	.dbg	line,	"tests/memcpy-bi.c", 10; void
+	.dbg	line,	"tests/memcpy-bi.c", 11; check (char *test, char *match, int n)
+	.dbg	line,	"tests/memcpy-bi.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_check
+	__enter		_check
+
+	.dbg	line,	"tests/memcpy-bi.c", 13; if (memcmp (test, match, n))
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/memcpy-bi.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/memcpy-bi.c", 15; }
+.LL3:
+.LL2:
+	__modsp		6
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/memcpy-bi.c", 17; #define TN(n) \
+	.dbg	line,	"tests/memcpy-bi.c", 18; { memset (dst, 0, n); memcpy (dst, src, n); check (dst, src, n); }
+	.dbg	line,	"tests/memcpy-bi.c", 19; #define T(n) \
+	.dbg	line,	"tests/memcpy-bi.c", 20; TN (n) \
+	.dbg	line,	"tests/memcpy-bi.c", 21; TN ((n) + 1) \
+	.dbg	line,	"tests/memcpy-bi.c", 22; TN ((n) + 2) \
+	.dbg	line,	"tests/memcpy-bi.c", 23; TN ((n) + 3)
+	.dbg	line,	"tests/memcpy-bi.c", 25; #ifndef SMALL
+	.dbg	line,	"tests/memcpy-bi.c", 26; main2 ()
+	.dbg	line,	"tests/memcpy-bi.c", 27; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main2
+	__enter		_main2
+
+	.dbg	line,	"tests/memcpy-bi.c", 28; T (40);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		40
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		40
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		40
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL5
+	__call		_abort
+.LL5:
+.LL6:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		41
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		41
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		41
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL7
+	__call		_abort
+.LL7:
+.LL8:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		42
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		42
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		42
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL9
+	__call		_abort
+.LL9:
+.LL10:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		43
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		43
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		43
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL11
+	__call		_abort
+.LL11:
+.LL12:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 29; T (44);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		44
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		44
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		44
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL13
+	__call		_abort
+.LL13:
+.LL14:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		45
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		45
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		45
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL15
+	__call		_abort
+.LL15:
+.LL16:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		46
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		46
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		46
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL17
+	__call		_abort
+.LL17:
+.LL18:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		47
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		47
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		47
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL19
+	__call		_abort
+.LL19:
+.LL20:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 30; T (48);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		48
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		48
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		48
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL21
+	__call		_abort
+.LL21:
+.LL22:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		49
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		49
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		49
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL23
+	__call		_abort
+.LL23:
+.LL24:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		50
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		50
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		50
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL25
+	__call		_abort
+.LL25:
+.LL26:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		51
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		51
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		51
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL27
+	__call		_abort
+.LL27:
+.LL28:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 31; T (52);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		52
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		52
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		52
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL29
+	__call		_abort
+.LL29:
+.LL30:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		53
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		53
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		53
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL31
+	__call		_abort
+.LL31:
+.LL32:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		54
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		54
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		54
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL33
+	__call		_abort
+.LL33:
+.LL34:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		55
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		55
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		55
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL35
+	__call		_abort
+.LL35:
+.LL36:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 32; T (56);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		56
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		56
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		56
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL37
+	__call		_abort
+.LL37:
+.LL38:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		57
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		57
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		57
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL39
+	__call		_abort
+.LL39:
+.LL40:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		58
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		58
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		58
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL41
+	__call		_abort
+.LL41:
+.LL42:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		59
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		59
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		59
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL43
+	__call		_abort
+.LL43:
+.LL44:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 33; #ifndef NOOPT
+
+	.dbg	line,	"tests/memcpy-bi.c", 34; T (60);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		60
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		60
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		60
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL45
+	__call		_abort
+.LL45:
+.LL46:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		61
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		61
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		61
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL47
+	__call		_abort
+.LL47:
+.LL48:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		62
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		62
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		62
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL49
+	__call		_abort
+.LL49:
+.LL50:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		63
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		63
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		63
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL51
+	__call		_abort
+.LL51:
+.LL52:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 35; T (64);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		64
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		64
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		64
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL53
+	__call		_abort
+.LL53:
+.LL54:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		65
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		65
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		65
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL55
+	__call		_abort
+.LL55:
+.LL56:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		66
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		66
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		66
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL57
+	__call		_abort
+.LL57:
+.LL58:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		67
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		67
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		67
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL59
+	__call		_abort
+.LL59:
+.LL60:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 36; T (68);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		68
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		68
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		68
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL61
+	__call		_abort
+.LL61:
+.LL62:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		69
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		69
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		69
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL63
+	__call		_abort
+.LL63:
+.LL64:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		70
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		70
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		70
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL65
+	__call		_abort
+.LL65:
+.LL66:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		71
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		71
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		71
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL67
+	__call		_abort
+.LL67:
+.LL68:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 37; T (72);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		72
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		72
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		72
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL69
+	__call		_abort
+.LL69:
+.LL70:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		73
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		73
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		73
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL71
+	__call		_abort
+.LL71:
+.LL72:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		74
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		74
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		74
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL73
+	__call		_abort
+.LL73:
+.LL74:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		75
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		75
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		75
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL75
+	__call		_abort
+.LL75:
+.LL76:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 38; T (76);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		76
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		76
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		76
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL77
+	__call		_abort
+.LL77:
+.LL78:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		77
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		77
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		77
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL79
+	__call		_abort
+.LL79:
+.LL80:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		78
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		78
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		78
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL81
+	__call		_abort
+.LL81:
+.LL82:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		79
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		79
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		79
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL83
+	__call		_abort
+.LL83:
+.LL84:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 39; #endif
+
+	.dbg	line,	"tests/memcpy-bi.c", 40; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/memcpy-bi.c", 41; #endif
+	.dbg	line,	"tests/memcpy-bi.c", 43; main ()
+	.dbg	line,	"tests/memcpy-bi.c", 44; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/memcpy-bi.c", 45; int i,j;
+
+	.dbg	line,	"tests/memcpy-bi.c", 47; for (i = 0; i < sizeof (src); ++i)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL86:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	80
+	__btrue		.LL88
+	__bra		.LL89
+.LL87:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL86
+.LL88:
+
+	.dbg	line,	"tests/memcpy-bi.c", 48; src[i] = 'a' + i % 26;
+	__ld.wm		__main_end - 2  /* i */
+	__smod.wi	26
+	__add.wi	97
+	__ldx.wmq	__main_end - 2  /* i */
+	__st.uaxq	_src
+	__bra		.LL87
+.LL89:
+
+	.dbg	line,	"tests/memcpy-bi.c", 50; T (0);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		0
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		0
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL90
+	__call		_abort
+.LL90:
+.LL91:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		1
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		1
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL92
+	__call		_abort
+.LL92:
+.LL93:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		2
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		2
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL94
+	__call		_abort
+.LL94:
+.LL95:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		3
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		3
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		3
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL96
+	__call		_abort
+.LL96:
+.LL97:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 51; T (4);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		4
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		4
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL98
+	__call		_abort
+.LL98:
+.LL99:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		5
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		5
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		5
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL100
+	__call		_abort
+.LL100:
+.LL101:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		6
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		6
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		6
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL102
+	__call		_abort
+.LL102:
+.LL103:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		7
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		7
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		7
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL104
+	__call		_abort
+.LL104:
+.LL105:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 52; T (8);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		8
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		8
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		8
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL106
+	__call		_abort
+.LL106:
+.LL107:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		9
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		9
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		9
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL108
+	__call		_abort
+.LL108:
+.LL109:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		10
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		10
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		10
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL110
+	__call		_abort
+.LL110:
+.LL111:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		11
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		11
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		11
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL112
+	__call		_abort
+.LL112:
+.LL113:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 53; T (12);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		12
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		12
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		12
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL114
+	__call		_abort
+.LL114:
+.LL115:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		13
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		13
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		13
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL116
+	__call		_abort
+.LL116:
+.LL117:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		14
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		14
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		14
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL118
+	__call		_abort
+.LL118:
+.LL119:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		15
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		15
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		15
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL120
+	__call		_abort
+.LL120:
+.LL121:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 54; T (16);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		16
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		16
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		16
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL122
+	__call		_abort
+.LL122:
+.LL123:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		17
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		17
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		17
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL124
+	__call		_abort
+.LL124:
+.LL125:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		18
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		18
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		18
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL126
+	__call		_abort
+.LL126:
+.LL127:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		19
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		19
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		19
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL128
+	__call		_abort
+.LL128:
+.LL129:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 55; T (20);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		20
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		20
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		20
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL130
+	__call		_abort
+.LL130:
+.LL131:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		21
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		21
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		21
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL132
+	__call		_abort
+.LL132:
+.LL133:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		22
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		22
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		22
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL134
+	__call		_abort
+.LL134:
+.LL135:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		23
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		23
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		23
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL136
+	__call		_abort
+.LL136:
+.LL137:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 56; #ifndef NOOPT
+
+	.dbg	line,	"tests/memcpy-bi.c", 57; T (24);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		24
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		24
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		24
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL138
+	__call		_abort
+.LL138:
+.LL139:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		25
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		25
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		25
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL140
+	__call		_abort
+.LL140:
+.LL141:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		26
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		26
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		26
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL142
+	__call		_abort
+.LL142:
+.LL143:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		27
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		27
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		27
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL144
+	__call		_abort
+.LL144:
+.LL145:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 58; T (28);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		28
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		28
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		28
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL146
+	__call		_abort
+.LL146:
+.LL147:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		29
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		29
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		29
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL148
+	__call		_abort
+.LL148:
+.LL149:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		30
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		30
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		30
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL150
+	__call		_abort
+.LL150:
+.LL151:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		31
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		31
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		31
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL152
+	__call		_abort
+.LL152:
+.LL153:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 59; T (32);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		32
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		32
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		32
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL154
+	__call		_abort
+.LL154:
+.LL155:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		33
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		33
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		33
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL156
+	__call		_abort
+.LL156:
+.LL157:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		34
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		34
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		34
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL158
+	__call		_abort
+.LL158:
+.LL159:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		35
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		35
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		35
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL160
+	__call		_abort
+.LL160:
+.LL161:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 60; T (36);
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		36
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		36
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		36
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL162
+	__call		_abort
+.LL162:
+.LL163:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		37
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		37
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		37
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL164
+	__call		_abort
+.LL164:
+.LL165:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		38
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		38
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		38
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL166
+	__call		_abort
+.LL166:
+.LL167:
+	__modsp		6
+	__ld.wi		_dst
+	__st.wmq	ram_tii_src
+	__st.umiq	0, _al
+	__ld.wi		39
+	__call		_memset.3
+	__ld.wi		_dst
+	__st.wmq	ram_tii_dst
+	__ld.wi		_src
+	__st.wmq	ram_tii_src
+	__ld.wi		39
+	__call		_memcpy.3
+	__ld.wi		_dst
+	__pusharg.wr
+	__ld.wi		_src
+	__pusharg.wr
+	__ld.wi		39
+	__pusharg.wr
+	__ld.ws		4  /* test */
+	__st.wmq	_di
+	__ld.ws		2  /* match */
+	__st.wmq	_bp
+	__ld.ws		0  /* n */
+	 _memcmp.3
+	__tst.wr
+	__bfalse	.LL168
+	__call		_abort
+.LL168:
+.LL169:
+	__modsp		6
+
+	.dbg	line,	"tests/memcpy-bi.c", 61; #ifdef SMALL
+
+	.dbg	line,	"tests/memcpy-bi.c", 62; T (40);
+
+	.dbg	line,	"tests/memcpy-bi.c", 63; T (44);
+
+	.dbg	line,	"tests/memcpy-bi.c", 64; T (48);
+
+	.dbg	line,	"tests/memcpy-bi.c", 65; T (52);
+
+	.dbg	line,	"tests/memcpy-bi.c", 66; T (56);
+
+	.dbg	line,	"tests/memcpy-bi.c", 67; T (60);
+
+	.dbg	line,	"tests/memcpy-bi.c", 68; T (64);
+
+	.dbg	line,	"tests/memcpy-bi.c", 69; T (68);
+
+	.dbg	line,	"tests/memcpy-bi.c", 70; T (72);
+
+	.dbg	line,	"tests/memcpy-bi.c", 71; T (76);
+
+	.dbg	line,	"tests/memcpy-bi.c", 72; #else
+
+	.dbg	line,	"tests/memcpy-bi.c", 73; main2();
+	__call		_main2
+
+	.dbg	line,	"tests/memcpy-bi.c", 74; #endif
+
+	.dbg	line,	"tests/memcpy-bi.c", 75; #endif
+
+	.dbg	line,	"tests/memcpy-bi.c", 76; return 0;
+	__ld.wi		0
+.LL85:
+
+	.dbg	line,	"tests/memcpy-bi.c", 77; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_src:
+		ds	80
+_dst:
+		ds	80
+
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:23
+;	Macro pool:10
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        80     10     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 10, 80
+__main_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,519 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/minmax-1.c", 1; /* { dg-do run } */
+	.dbg	line,	"tests/minmax-1.c", 2; /* { dg-options "-fdump-tree-original" } */
+	.dbg	line,	"tests/minmax-1.c", 4; /* Check that MIN-MAX and MAX-MIN combinations are folded.  */
+	.dbg	line,	"tests/minmax-1.c", 6; extern void abort (void);
+	.dbg	line,	"tests/minmax-1.c", 8; #define MIN(a,b) ((a) < (b) ? (a) : (b))
+	.dbg	line,	"tests/minmax-1.c", 9; #define MAX(a,b) ((a) > (b) ? (a) : (b))
+	.dbg	line,	"tests/minmax-1.c", 11; int f1(int a, int b)
+	.dbg	line,	"tests/minmax-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f1
+	__enter		_f1
+
+	.dbg	line,	"tests/minmax-1.c", 13; return MIN (MAX (a, b), b); /* == b */
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+	__bfalse	.LL3
+	__ld.ws		2  /* a */
+	__bra		.LL4
+.LL3:
+	__ld.ws		0  /* b */
+.LL4:
+	__slt_w.ws	0  /* b */
+	__bfalse	.LL5
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+	__bfalse	.LL6
+	__ld.ws		2  /* a */
+	__bra		.LL7
+.LL6:
+	__ld.ws		0  /* b */
+.LL7	.alias		.LL8
+	__bra		.LL8
+.LL5:
+	__ld.ws		0  /* b */
+.LL8	.alias		.LL2
+.LL2:
+
+	.dbg	line,	"tests/minmax-1.c", 14; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/minmax-1.c", 16; int f2(int a, int b)
+	.dbg	line,	"tests/minmax-1.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f2
+	__enter		_f2
+
+	.dbg	line,	"tests/minmax-1.c", 18; return MAX (MIN (a, b), b); /* == b */
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+	__bfalse	.LL10
+	__ld.ws		2  /* a */
+	__bra		.LL11
+.LL10:
+	__ld.ws		0  /* b */
+.LL11:
+	__sgt_w.ws	0  /* b */
+	__bfalse	.LL12
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+	__bfalse	.LL13
+	__ld.ws		2  /* a */
+	__bra		.LL14
+.LL13:
+	__ld.ws		0  /* b */
+.LL14	.alias		.LL15
+	__bra		.LL15
+.LL12:
+	__ld.ws		0  /* b */
+.LL15	.alias		.LL9
+.LL9:
+
+	.dbg	line,	"tests/minmax-1.c", 19; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/minmax-1.c", 21; int f3(int a, int b)
+	.dbg	line,	"tests/minmax-1.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f3
+	__enter		_f3
+
+	.dbg	line,	"tests/minmax-1.c", 23; return MIN (MAX (b, a), b); /* == b */
+	__ld.ws		0  /* b */
+	__sgt_w.ws	2  /* a */
+	__bfalse	.LL17
+	__ld.ws		0  /* b */
+	__bra		.LL18
+.LL17:
+	__ld.ws		2  /* a */
+.LL18:
+	__slt_w.ws	0  /* b */
+	__bfalse	.LL19
+	__ld.ws		0  /* b */
+	__sgt_w.ws	2  /* a */
+	__bfalse	.LL20
+	__ld.ws		0  /* b */
+	__bra		.LL21
+.LL20:
+	__ld.ws		2  /* a */
+.LL21	.alias		.LL22
+	__bra		.LL22
+.LL19:
+	__ld.ws		0  /* b */
+.LL22	.alias		.LL16
+.LL16:
+
+	.dbg	line,	"tests/minmax-1.c", 24; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/minmax-1.c", 26; int f4(int a, int b)
+	.dbg	line,	"tests/minmax-1.c", 27; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f4
+	__enter		_f4
+
+	.dbg	line,	"tests/minmax-1.c", 28; return MAX (MIN (b, a), b); /* == b */
+	__ld.ws		0  /* b */
+	__slt_w.ws	2  /* a */
+	__bfalse	.LL24
+	__ld.ws		0  /* b */
+	__bra		.LL25
+.LL24:
+	__ld.ws		2  /* a */
+.LL25:
+	__sgt_w.ws	0  /* b */
+	__bfalse	.LL26
+	__ld.ws		0  /* b */
+	__slt_w.ws	2  /* a */
+	__bfalse	.LL27
+	__ld.ws		0  /* b */
+	__bra		.LL28
+.LL27:
+	__ld.ws		2  /* a */
+.LL28	.alias		.LL29
+	__bra		.LL29
+.LL26:
+	__ld.ws		0  /* b */
+.LL29	.alias		.LL23
+.LL23:
+
+	.dbg	line,	"tests/minmax-1.c", 29; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/minmax-1.c", 32; int g1(int a, int b)
+	.dbg	line,	"tests/minmax-1.c", 33; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g1
+	__enter		_g1
+
+	.dbg	line,	"tests/minmax-1.c", 34; return MIN (a, MAX (a, b)); /* == a */
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+	__bfalse	.LL31
+	__ld.ws		2  /* a */
+	__bra		.LL32
+.LL31:
+	__ld.ws		0  /* b */
+.LL32:
+	__sgt_w.ws	2  /* a */
+	__bfalse	.LL33
+	__ld.ws		2  /* a */
+	__bra		.LL34
+.LL33:
+	__ld.ws		2  /* a */
+	__sgt_w.ws	0  /* b */
+	__bfalse	.LL35
+	__ld.ws		2  /* a */
+	__bra		.LL36
+.LL35:
+	__ld.ws		0  /* b */
+.LL36	.alias		.LL30
+.LL34	.alias		.LL30
+.LL30:
+
+	.dbg	line,	"tests/minmax-1.c", 35; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/minmax-1.c", 37; int g2(int a, int b)
+	.dbg	line,	"tests/minmax-1.c", 38; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g2
+	__enter		_g2
+
+	.dbg	line,	"tests/minmax-1.c", 39; return MAX (a, MIN (a, b)); /* == a */
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+	__bfalse	.LL38
+	__ld.ws		2  /* a */
+	__bra		.LL39
+.LL38:
+	__ld.ws		0  /* b */
+.LL39:
+	__slt_w.ws	2  /* a */
+	__bfalse	.LL40
+	__ld.ws		2  /* a */
+	__bra		.LL41
+.LL40:
+	__ld.ws		2  /* a */
+	__slt_w.ws	0  /* b */
+	__bfalse	.LL42
+	__ld.ws		2  /* a */
+	__bra		.LL43
+.LL42:
+	__ld.ws		0  /* b */
+.LL43	.alias		.LL37
+.LL41	.alias		.LL37
+.LL37:
+
+	.dbg	line,	"tests/minmax-1.c", 40; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/minmax-1.c", 42; int g3(int a, int b)
+	.dbg	line,	"tests/minmax-1.c", 43; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g3
+	__enter		_g3
+
+	.dbg	line,	"tests/minmax-1.c", 44; return MIN (a, MAX (b, a)); /* == a */
+	__ld.ws		0  /* b */
+	__sgt_w.ws	2  /* a */
+	__bfalse	.LL45
+	__ld.ws		0  /* b */
+	__bra		.LL46
+.LL45:
+	__ld.ws		2  /* a */
+.LL46:
+	__sgt_w.ws	2  /* a */
+	__bfalse	.LL47
+	__ld.ws		2  /* a */
+	__bra		.LL48
+.LL47:
+	__ld.ws		0  /* b */
+	__sgt_w.ws	2  /* a */
+	__bfalse	.LL49
+	__ld.ws		0  /* b */
+	__bra		.LL50
+.LL49:
+	__ld.ws		2  /* a */
+.LL50	.alias		.LL44
+.LL48	.alias		.LL44
+.LL44:
+
+	.dbg	line,	"tests/minmax-1.c", 45; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/minmax-1.c", 47; int g4(int a, int b)
+	.dbg	line,	"tests/minmax-1.c", 48; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g4
+	__enter		_g4
+
+	.dbg	line,	"tests/minmax-1.c", 49; return MAX (a, MIN (b, a)); /* == a */
+	__ld.ws		0  /* b */
+	__slt_w.ws	2  /* a */
+	__bfalse	.LL52
+	__ld.ws		0  /* b */
+	__bra		.LL53
+.LL52:
+	__ld.ws		2  /* a */
+.LL53:
+	__slt_w.ws	2  /* a */
+	__bfalse	.LL54
+	__ld.ws		2  /* a */
+	__bra		.LL55
+.LL54:
+	__ld.ws		0  /* b */
+	__slt_w.ws	2  /* a */
+	__bfalse	.LL56
+	__ld.ws		0  /* b */
+	__bra		.LL57
+.LL56:
+	__ld.ws		2  /* a */
+.LL57	.alias		.LL51
+.LL55	.alias		.LL51
+.LL51:
+
+	.dbg	line,	"tests/minmax-1.c", 50; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/minmax-1.c", 52; int main(void)
+	.dbg	line,	"tests/minmax-1.c", 53; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/minmax-1.c", 54; if (f1 (1, 2) != 2)
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_f1
+	__neq_w.wi	2
+	__bfalse	.LL59
+
+	.dbg	line,	"tests/minmax-1.c", 55; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/minmax-1.c", 57; if (f2 (1, 2) != 2)
+.LL59:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_f2
+	__neq_w.wi	2
+	__bfalse	.LL60
+
+	.dbg	line,	"tests/minmax-1.c", 58; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/minmax-1.c", 60; if (f3 (1, 2) != 2)
+.LL60:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_f3
+	__neq_w.wi	2
+	__bfalse	.LL61
+
+	.dbg	line,	"tests/minmax-1.c", 61; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/minmax-1.c", 63; if (f4 (1, 2) != 2)
+.LL61:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_f4
+	__neq_w.wi	2
+	__bfalse	.LL62
+
+	.dbg	line,	"tests/minmax-1.c", 64; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/minmax-1.c", 66; if (g1 (1, 2) != 1)
+.LL62:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_g1
+	__neq_w.wi	1
+	__bfalse	.LL63
+
+	.dbg	line,	"tests/minmax-1.c", 67; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/minmax-1.c", 69; if (g2 (1, 2) != 1)
+.LL63:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_g2
+	__neq_w.wi	1
+	__bfalse	.LL64
+
+	.dbg	line,	"tests/minmax-1.c", 70; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/minmax-1.c", 72; if (g3 (1, 2) != 1)
+.LL64:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_g3
+	__neq_w.wi	1
+	__bfalse	.LL65
+
+	.dbg	line,	"tests/minmax-1.c", 73; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/minmax-1.c", 75; if (g4 (1, 2) != 1)
+.LL65:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_g4
+	__neq_w.wi	1
+	__bfalse	.LL66
+
+	.dbg	line,	"tests/minmax-1.c", 76; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/minmax-1.c", 78; return 0;
+.LL66:
+	__ld.wi		0
+.LL58:
+
+	.dbg	line,	"tests/minmax-1.c", 79; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/minmax-1.c", 81; /* { dg-final { scan-tree-dump-times "MIN_EXPR" 0 "original"} } */
+	.dbg	line,	"tests/minmax-1.c", 82; /* { dg-final { scan-tree-dump-times "MAX_EXPR" 0 "original"} } */
+	.dbg	line,	"tests/minmax-1.c", 83; /* { dg-final { cleanup-tree-dump "original" } } */
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:10
+;	Macro pool:8
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,206 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pending-4.c", 2; void dummy (x, y)
+	.dbg	line,	"tests/pending-4.c", 3; int *x;
+	.dbg	line,	"tests/pending-4.c", 4; int y;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_dummy
+	__enter		_dummy
+
+	.dbg	line,	"tests/pending-4.c", 5; {}
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pending-4.c", 7; int
+	.dbg	line,	"tests/pending-4.c", 8; main (argc, argv)
+	.dbg	line,	"tests/pending-4.c", 9; int argc;
+	.dbg	line,	"tests/pending-4.c", 10; char **argv;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pending-4.c", 11; {
+
+	.dbg	line,	"tests/pending-4.c", 12; int number_columns=9;
+	__st.wmiq	9, __main_end - 2  /* number_columns */
+
+	.dbg	line,	"tests/pending-4.c", 13; int cnt0 = 0;
+	__st.wmiq	0, __main_end - 4  /* cnt0 */
+
+	.dbg	line,	"tests/pending-4.c", 14; int cnt1 = 0;
+	__st.wmiq	0, __main_end - 6  /* cnt1 */
+
+	.dbg	line,	"tests/pending-4.c", 15; int i,A1;
+
+	.dbg	line,	"tests/pending-4.c", 17; for (i = number_columns-1; i != 0; i--)
+	__ld.wm		__main_end - 2  /* number_columns */
+	__sub.wi	1
+	__st.wmq	__main_end - 8  /* i */
+.LL4:
+	__tst.wm	__main_end - 8  /* i */
+	__btrue		.LL6
+	__bra		.LL7
+.LL5:
+	__dec.wmq	__main_end - 8  /* i */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/pending-4.c", 18; {         
+
+	.dbg	line,	"tests/pending-4.c", 19; if (i == 1)
+	__ld.wm		__main_end - 8  /* i */
+	__equ_w.wi	1
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/pending-4.c", 20; {
+
+	.dbg	line,	"tests/pending-4.c", 21; dummy(&A1, i);
+	__ld.wi		__main_end - 10  /* A1 */
+	__pusharg.wr
+	__ld.wm		__main_end - 8  /* i */
+	__pusharg.wr
+.LL9:
+	__modsp		4
+
+	.dbg	line,	"tests/pending-4.c", 22; cnt0++;
+	__inc.wmq	__main_end - 4  /* cnt0 */
+
+	.dbg	line,	"tests/pending-4.c", 23; }
+
+	.dbg	line,	"tests/pending-4.c", 24; else
+	__bra		.LL10
+.LL8:
+
+	.dbg	line,	"tests/pending-4.c", 25; {
+
+	.dbg	line,	"tests/pending-4.c", 26; dummy(&A1, i-1);
+	__ld.wi		__main_end - 10  /* A1 */
+	__pusharg.wr
+	__ld.wm		__main_end - 8  /* i */
+	__sub.wi	1
+	__pusharg.wr
+.LL11:
+	__modsp		4
+
+	.dbg	line,	"tests/pending-4.c", 27; cnt1++;
+	__inc.wmq	__main_end - 6  /* cnt1 */
+
+	.dbg	line,	"tests/pending-4.c", 28; }
+.LL10	.alias		.LL5
+
+	.dbg	line,	"tests/pending-4.c", 29; }
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/pending-4.c", 30; if (cnt0 != 1 || cnt1 != 7)
+	__ld.wm		__main_end - 4  /* cnt0 */
+	__neq_w.wi	1
+	__btrue		.LL13
+	__ld.wm		__main_end - 6  /* cnt1 */
+	__neq_w.wi	7
+.LL13:
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/pending-4.c", 31; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pending-4.c", 32; exit (0);
+.LL12:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pending-4.c", 33; }
+.LL3:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    10  _main
+;
+; 10 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       186     32    10  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 10, 32, 186
+__main_end	=	__overlay_frames + 10
+	.endm
@@ -0,0 +1,239 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr16790-1.c", 1; /* PR middle-end/16790.  */
+	.dbg	line,	"tests/pr16790-1.c", 3; extern void abort ();
+	.dbg	line,	"tests/pr16790-1.c", 5; static void test1(unsigned int u1)
+	.dbg	line,	"tests/pr16790-1.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test1
+	__enter		_test1
+
+	.dbg	line,	"tests/pr16790-1.c", 7; unsigned int y_final_1;
+
+	.dbg	line,	"tests/pr16790-1.c", 8; signed short y_middle;
+
+	.dbg	line,	"tests/pr16790-1.c", 9; unsigned int y_final_2;
+
+	.dbg	line,	"tests/pr16790-1.c", 11; y_final_1 = /*(unsigned int)*/( /*(signed short)*/(u1 * 2) * 3 );
+	__ld.ws		0  /* u1 */
+	__asl.wi	1
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__st.wmq	__test1_end - 2  /* y_final_1 */
+
+	.dbg	line,	"tests/pr16790-1.c", 12; y_middle  =                 /*(signed short)*/(u1 * 2);
+	__ld.ws		0  /* u1 */
+	__asl.wi	1
+	__st.wmq	__test1_end - 4  /* y_middle */
+
+	.dbg	line,	"tests/pr16790-1.c", 13; y_final_2 = /*(unsigned int)*/( y_middle * 3 );
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__st.wmq	__test1_end - 6  /* y_final_2 */
+
+	.dbg	line,	"tests/pr16790-1.c", 15; if (y_final_1 != y_final_2)
+	__ld.wm		__test1_end - 2  /* y_final_1 */
+	__neq_w.wm	__test1_end - 6  /* y_final_2 */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr16790-1.c", 16; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr16790-1.c", 17; }
+.LL3:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__test1_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr16790-1.c", 20; static void test2(unsigned int u1)
+	.dbg	line,	"tests/pr16790-1.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test2
+	__enter		_test2
+
+	.dbg	line,	"tests/pr16790-1.c", 22; unsigned int y_final_1;
+
+	.dbg	line,	"tests/pr16790-1.c", 23; signed short y_middle;
+
+	.dbg	line,	"tests/pr16790-1.c", 24; unsigned int y_final_2;
+
+	.dbg	line,	"tests/pr16790-1.c", 26; y_final_1 = /*(unsigned int)*/( /*(signed short)*/(u1 << 1) * 3 );
+	__ld.ws		0  /* u1 */
+	__asl.wi	1
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__st.wmq	__test2_end - 2  /* y_final_1 */
+
+	.dbg	line,	"tests/pr16790-1.c", 27; y_middle  =                 /*(signed short)*/(u1 << 1);
+	__ld.ws		0  /* u1 */
+	__asl.wi	1
+	__st.wmq	__test2_end - 4  /* y_middle */
+
+	.dbg	line,	"tests/pr16790-1.c", 28; y_final_2 = /*(unsigned int)*/( y_middle * 3 );
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__st.wmq	__test2_end - 6  /* y_final_2 */
+
+	.dbg	line,	"tests/pr16790-1.c", 30; if (y_final_1 != y_final_2)
+	__ld.wm		__test2_end - 2  /* y_final_1 */
+	__neq_w.wm	__test2_end - 6  /* y_final_2 */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/pr16790-1.c", 31; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr16790-1.c", 32; }
+.LL5:
+.LL4:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__test2_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr16790-1.c", 35; int main()
+	.dbg	line,	"tests/pr16790-1.c", 36; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr16790-1.c", 37; test1(0x4000/*U*/);
+	__ld.wi		16384
+	__pusharg.wr
+	__ld.ws		0  /* u1 */
+	__asl.wi	1
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__st.wmq	__test1_end - 2  /* y_final_1 */
+	__ld.ws		0  /* u1 */
+	__asl.wi	1
+	__st.wmq	__test1_end - 4  /* y_middle */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__st.wmq	__test1_end - 6  /* y_final_2 */
+	__ld.wm		__test1_end - 2  /* y_final_1 */
+	__neq_w.wm	__test1_end - 6  /* y_final_2 */
+	__bfalse	.LL7
+	__call		_abort
+.LL7:
+.LL8:
+	__modsp		2
+
+	.dbg	line,	"tests/pr16790-1.c", 38; test2(0x4000/*U*/);
+	__ld.wi		16384
+	__pusharg.wr
+	__ld.ws		0  /* u1 */
+	__asl.wi	1
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__st.wmq	__test2_end - 2  /* y_final_1 */
+	__ld.ws		0  /* u1 */
+	__asl.wi	1
+	__st.wmq	__test2_end - 4  /* y_middle */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__st.wmq	__test2_end - 6  /* y_final_2 */
+	__ld.wm		__test2_end - 2  /* y_final_1 */
+	__neq_w.wm	__test2_end - 6  /* y_final_2 */
+	__bfalse	.LL9
+	__call		_abort
+.LL9:
+.LL10:
+	__modsp		2
+
+	.dbg	line,	"tests/pr16790-1.c", 39; return 0;
+	__ld.wi		0
+.LL6:
+
+	.dbg	line,	"tests/pr16790-1.c", 40; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
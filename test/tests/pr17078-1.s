@@ -0,0 +1,170 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr17078-1.c", 1; extern void abort(void);
+	.dbg	line,	"tests/pr17078-1.c", 3; void test(int *ptr)
+	.dbg	line,	"tests/pr17078-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/pr17078-1.c", 5; int i = 1;
+
+	.dbg	line,	"tests/pr17078-1.c", 6; goto useless;
+	__modsp_goto	.LL3_stkp
+	__bra		.LL3
+
+	.dbg	line,	"tests/pr17078-1.c", 7; if (0)
+
+	.dbg	line,	"tests/pr17078-1.c", 8; {
+
+	.dbg	line,	"tests/pr17078-1.c", 9; useless:
+.LL3_stkp	=	0
+.LL3:
+
+	.dbg	line,	"tests/pr17078-1.c", 10; i = 0;
+	__st.wmiq	0, __test_end - 2  /* i */
+
+	.dbg	line,	"tests/pr17078-1.c", 11; }
+
+	.dbg	line,	"tests/pr17078-1.c", 12; else
+	__bra		.LL5
+.LL4:
+
+	.dbg	line,	"tests/pr17078-1.c", 13; i = 1;
+.LL5:
+
+	.dbg	line,	"tests/pr17078-1.c", 14; *ptr = i;
+	__ld.ws		0  /* ptr */
+	__push.wr
+	__ld.wm		__test_end - 2  /* i */
+	__st.wtq
+
+	.dbg	line,	"tests/pr17078-1.c", 15; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__test_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr17078-1.c", 17; int main()
+	.dbg	line,	"tests/pr17078-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr17078-1.c", 19; int i = 1;
+	__st.wmiq	1, __main_end - 2  /* i */
+
+	.dbg	line,	"tests/pr17078-1.c", 20; test(&i);
+	__ld.wi		__main_end - 2  /* i */
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/pr17078-1.c", 21; if (i)
+	__tst.wm	__main_end - 2  /* i */
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/pr17078-1.c", 22; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr17078-1.c", 23; return 0;
+.LL7:
+	__ld.wi		0
+.LL6:
+
+	.dbg	line,	"tests/pr17078-1.c", 24; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 6
+__main_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,178 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr17133.c", 1; extern void abort (void);
+	.dbg	line,	"tests/pr17133.c", 3; int foo;// = 0;
+	.dbg	line,	"tests/pr17133.c", 4; void *bar;// = 0;
+	.dbg	line,	"tests/pr17133.c", 5; unsigned int baz;// = 100;
+	.dbg	line,	"tests/pr17133.c", 7; void *pure_alloc ()
+	.dbg	line,	"tests/pr17133.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_pure_alloc
+	__enter		_pure_alloc
+
+	.dbg	line,	"tests/pr17133.c", 9; void *res;
+
+	.dbg	line,	"tests/pr17133.c", 10; 
+
+	.dbg	line,	"tests/pr17133.c", 11; while (1)
+.LL3:
+	__ld.wi		1
+	__tst.wr
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/pr17133.c", 12; {
+
+	.dbg	line,	"tests/pr17133.c", 13; res = /*(void *)*/ (((/*(unsigned int)*/ (foo + bar))) & ~1);
+	__ld.wm		_foo
+	__push.wr
+	__ld.wm		_bar
+	__double
+	__add.wt
+	__and.wi	-2
+	__st.wmq	__pure_alloc_end - 2  /* res */
+
+	.dbg	line,	"tests/pr17133.c", 14; foo += 2;
+	__add_st.wmiq	2, _foo
+
+	.dbg	line,	"tests/pr17133.c", 15; if (foo < baz)
+	__ld.wm		_foo
+	__ult_w.wm	_baz
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/pr17133.c", 16; return res;
+	__ld.wm		__pure_alloc_end - 2  /* res */
+	__bra		.LL2
+
+	.dbg	line,	"tests/pr17133.c", 17; foo = 0;
+.LL5:
+	__st.wmiq	0, _foo
+
+	.dbg	line,	"tests/pr17133.c", 18; }
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/pr17133.c", 19; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__pure_alloc_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr17133.c", 21; int main ()
+	.dbg	line,	"tests/pr17133.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr17133.c", 23; baz = 100;
+	__st.wmiq	100, _baz
+
+	.dbg	line,	"tests/pr17133.c", 24; pure_alloc ();
+	__call		_pure_alloc
+
+	.dbg	line,	"tests/pr17133.c", 25; if (!foo)
+	__not.wm	_foo
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/pr17133.c", 26; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr17133.c", 27; return 0;
+.LL7:
+	__ld.wi		0
+.LL6:
+
+	.dbg	line,	"tests/pr17133.c", 28; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        82     12     2  foo
+;        18      4     2  baz
+;        16      2     2  bar
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_foo, 2, 12, 82
+	auto_zp_var	_baz, 2, 4, 18
+	auto_zp_var	_bar, 2, 2, 16
+	.endm
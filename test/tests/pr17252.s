@@ -0,0 +1,126 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr17252.c", 1; /* PR 17252.  When a char * pointer P takes its own address, storing
+	.dbg	line,	"tests/pr17252.c", 2; into *P changes P itself.  */
+	.dbg	line,	"tests/pr17252.c", 4; char *a;
+	.dbg	line,	"tests/pr17252.c", 6; main ()
+	.dbg	line,	"tests/pr17252.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr17252.c", 8; /* Make 'a' point to itself.  */
+
+	.dbg	line,	"tests/pr17252.c", 9; a = /*(char *)*/&a;
+	__ld.wi		_a
+	__st.wmq	_a
+
+	.dbg	line,	"tests/pr17252.c", 11; /* Change what 'a' is pointing to.  */
+
+	.dbg	line,	"tests/pr17252.c", 12; a[0]++;
+	__push.wr
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__add.wi	1
+	__st.ut
+
+	.dbg	line,	"tests/pr17252.c", 14; /* If a's memory tag does not contain 'a' in its alias set, we will
+
+	.dbg	line,	"tests/pr17252.c", 15; think that this predicate is superfluous and change it to
+
+	.dbg	line,	"tests/pr17252.c", 16; 'if (1)'.  */
+
+	.dbg	line,	"tests/pr17252.c", 17; if (a == /*(char *)*/&a)
+	__ld.wm		_a
+	__equ_w.wi	_a
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr17252.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr17252.c", 20; return 0;
+.LL3:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/pr17252.c", 21; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     2  a
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_a, 2, 10, 10
+	.endm
@@ -0,0 +1,248 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr19005.c", 1; /* PR target/19005 */
+	.dbg	line,	"tests/pr19005.c", 2; extern void abort (void);
+	.dbg	line,	"tests/pr19005.c", 4; int v, s;
+	.dbg	line,	"tests/pr19005.c", 6; void
+	.dbg	line,	"tests/pr19005.c", 7; bar (int a, int b)
+	.dbg	line,	"tests/pr19005.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/pr19005.c", 9; unsigned char x; x = v;
+	__ld.wm		_v
+	__st.umq	__bar_end - 1  /* x */
+
+	.dbg	line,	"tests/pr19005.c", 11; if (!s)
+	__not.wm	_s
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr19005.c", 12; {
+
+	.dbg	line,	"tests/pr19005.c", 13; if (a != x || b != (unsigned char) (x + 1))
+	__ld.ws		2  /* a */
+	__neq_w.um	__bar_end - 1  /* x */
+	__btrue		.LL5
+	__ld.um		__bar_end - 1  /* x */
+	__add.wi	1
+	__ext.ur
+	__neq_w.ws	0  /* b */
+.LL5:
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/pr19005.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr19005.c", 15; }
+.LL4	.alias		.LL6
+
+	.dbg	line,	"tests/pr19005.c", 16; else if (a != (unsigned char) (x + 1) || b != x)
+	__bra		.LL6
+.LL3:
+	__ld.um		__bar_end - 1  /* x */
+	__add.wi	1
+	__ext.ur
+	__neq_w.ws	2  /* a */
+	__btrue		.LL8
+	__ld.ws		0  /* b */
+	__neq_w.um	__bar_end - 1  /* x */
+.LL8:
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/pr19005.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr19005.c", 18; s ^= 1;
+.LL7:
+.LL6:
+	__ld.wi		1
+	__eor_st.wmq	_s
+
+	.dbg	line,	"tests/pr19005.c", 19; }
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__bar_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr19005.c", 21; int
+	.dbg	line,	"tests/pr19005.c", 22; foo (int x)
+	.dbg	line,	"tests/pr19005.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/pr19005.c", 24; unsigned char a,b; a = x; b = x + 1;
+	__ld.ws		0  /* x */
+	__st.umq	__foo_end - 1  /* a */
+	__ld.ws		0  /* x */
+	__add.wi	1
+	__st.umq	__foo_end - 2  /* b */
+
+	.dbg	line,	"tests/pr19005.c", 26; bar (a, b);
+	__ld.um		__foo_end - 1  /* a */
+	__pusharg.wr
+	__ld.um		__foo_end - 2  /* b */
+	__pusharg.wr
+	__call		_bar
+
+	.dbg	line,	"tests/pr19005.c", 27; a ^= b; b ^= a; a ^= b;
+	__ld.um		__foo_end - 2  /* b */
+	__eor_st.umq	__foo_end - 1  /* a */
+	__ld.um		__foo_end - 1  /* a */
+	__eor_st.umq	__foo_end - 2  /* b */
+	__ld.um		__foo_end - 2  /* b */
+	__eor_st.umq	__foo_end - 1  /* a */
+
+	.dbg	line,	"tests/pr19005.c", 28; bar (a, b);
+	__ld.um		__foo_end - 1  /* a */
+	__pusharg.wr
+	__ld.um		__foo_end - 2  /* b */
+	__pusharg.wr
+	__call		_bar
+
+	.dbg	line,	"tests/pr19005.c", 29; return 0;
+	__ld.wi		0
+.LL9:
+
+	.dbg	line,	"tests/pr19005.c", 30; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr19005.c", 32; int
+	.dbg	line,	"tests/pr19005.c", 33; main (void)
+	.dbg	line,	"tests/pr19005.c", 34; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr19005.c", 35; for (v = -10; v < 266; v++)
+	__st.wmiq	-10, _v
+.LL11:
+	__ld.wm		_v
+	__slt_w.wi	266
+	__btrue		.LL13
+	__bra		.LL14
+.LL12:
+	__inc.wmq	_v
+	__bra		.LL11
+.LL13:
+
+	.dbg	line,	"tests/pr19005.c", 36; foo (v);
+	__ld.wm		_v
+	__pusharg.wr
+	__call		_foo
+	__bra		.LL12
+.LL14:
+
+	.dbg	line,	"tests/pr19005.c", 37; return 0;
+	__ld.wi		0
+.LL10:
+
+	.dbg	line,	"tests/pr19005.c", 38; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 1
+leaf_needs	.set	1
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _foo
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        82     12     2  v
+;        24     24     2  overlaid locals
+;         6      6     2  s
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_v, 2, 12, 82
+	auto_zp_var	__overlay_frames, 2, 24, 24
+__foo_end	=	__overlay_frames + 2
+	auto_zp_var	_s, 2, 6, 6
+	.endm
@@ -0,0 +1,182 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr19606.c", 1; /* PR c/19606
+	.dbg	line,	"tests/pr19606.c", 2; The C front end used to shorten the type of a division to a type
+	.dbg	line,	"tests/pr19606.c", 3; that does not preserve the semantics of the original computation.
+	.dbg	line,	"tests/pr19606.c", 4; Make sure that won't happen.  */
+	.dbg	line,	"tests/pr19606.c", 6; signed char a;// = -4;
+	.dbg	line,	"tests/pr19606.c", 8; int
+	.dbg	line,	"tests/pr19606.c", 9; foo (void)
+	.dbg	line,	"tests/pr19606.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/pr19606.c", 11; return (/*(unsigned int) (signed int)*/ a) / 2/*LL*/;
+	__ld.bm		_a
+	__sdiv.wi	2
+.LL2:
+
+	.dbg	line,	"tests/pr19606.c", 12; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr19606.c", 14; int
+	.dbg	line,	"tests/pr19606.c", 15; bar (void)
+	.dbg	line,	"tests/pr19606.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/pr19606.c", 17; return (/*(unsigned int) (signed int)*/ a) % 5/*LL*/;
+	__ld.bm		_a
+	__smod.wi	5
+.LL3:
+
+	.dbg	line,	"tests/pr19606.c", 18; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr19606.c", 20; int
+	.dbg	line,	"tests/pr19606.c", 21; main (void)
+	.dbg	line,	"tests/pr19606.c", 22; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr19606.c", 23; int r;
+
+	.dbg	line,	"tests/pr19606.c", 24; a = -4;
+	__st.umiq	-4, _a
+
+	.dbg	line,	"tests/pr19606.c", 26; r = foo ();
+	__ld.bm		_a
+	__sdiv.wi	2
+.LL5:
+	__st.wmq	__main_end - 2  /* r */
+
+	.dbg	line,	"tests/pr19606.c", 27; if (r != (/*(unsigned int) (signed int)*/ /*(signed char)*/ -4) / 2/*LL*/)
+	__neq_w.wi	-2
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/pr19606.c", 28; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr19606.c", 30; r = bar ();
+.LL6:
+	__ld.bm		_a
+	__smod.wi	5
+.LL7:
+	__st.wmq	__main_end - 2  /* r */
+
+	.dbg	line,	"tests/pr19606.c", 31; if (r != (/*(unsigned int) (signed int)*/ /*(signed char)*/ -4) % 5/*LL*/)
+	__neq_w.wi	-4
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/pr19606.c", 32; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr19606.c", 34; exit (0);
+.LL8:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr19606.c", 35; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:6
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     1  a
+;         8      8     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_a, 1, 6, 6
+	auto_zp_var	__overlay_frames, 2, 8, 8
+__main_end	=	__overlay_frames + 2
+	.endm
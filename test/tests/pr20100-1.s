@@ -0,0 +1,422 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr20100-1.c", 1; /* PR tree-optimization/20100
+	.dbg	line,	"tests/pr20100-1.c", 2; Pure function being treated as const.
+	.dbg	line,	"tests/pr20100-1.c", 3; Author: Hans-Peter Nilsson.  */
+	.dbg	line,	"tests/pr20100-1.c", 5; static unsigned short g;// = 0;
+	.dbg	line,	"tests/pr20100-1.c", 6; static unsigned short p;// = 0;
+	.dbg	line,	"tests/pr20100-1.c", 7; unsigned char e;
+	.dbg	line,	"tests/pr20100-1.c", 9; static unsigned short
+	.dbg	line,	"tests/pr20100-1.c", 10; next_g (void)
+	.dbg	line,	"tests/pr20100-1.c", 11; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_next_g
+	__enter		_next_g
+
+	.dbg	line,	"tests/pr20100-1.c", 12; return g == e - 1 ? 0 : g + 1;
+	__ld.um		_e
+	__sub.wi	1
+	__equ_w.wm	_g
+	__bfalse	.LL3
+	__ld.wi		0
+	__bra		.LL4
+.LL3:
+	__ld.wm		_g
+	__add.wi	1
+.LL4	.alias		.LL2
+.LL2:
+
+	.dbg	line,	"tests/pr20100-1.c", 13; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr20100-1.c", 15; static unsigned short
+	.dbg	line,	"tests/pr20100-1.c", 16; curr_p (void)
+	.dbg	line,	"tests/pr20100-1.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_curr_p
+	__enter		_curr_p
+
+	.dbg	line,	"tests/pr20100-1.c", 18; return p;
+	__ld.wm		_p
+.LL5:
+
+	.dbg	line,	"tests/pr20100-1.c", 19; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr20100-1.c", 21; static unsigned short
+	.dbg	line,	"tests/pr20100-1.c", 22; inc_g (void)
+	.dbg	line,	"tests/pr20100-1.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_inc_g
+	__enter		_inc_g
+
+	.dbg	line,	"tests/pr20100-1.c", 24; return g = next_g ();
+	__ld.um		_e
+	__sub.wi	1
+	__equ_w.wm	_g
+	__bfalse	.LL7
+	__ld.wi		0
+	__bra		.LL8
+.LL7:
+	__ld.wm		_g
+	__add.wi	1
+.LL8	.alias		.LL9
+.LL9:
+	__st.wm		_g
+.LL6:
+
+	.dbg	line,	"tests/pr20100-1.c", 25; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr20100-1.c", 27; static unsigned short
+	.dbg	line,	"tests/pr20100-1.c", 28; curr_g (void)
+	.dbg	line,	"tests/pr20100-1.c", 29; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_curr_g
+	__enter		_curr_g
+
+	.dbg	line,	"tests/pr20100-1.c", 30; return g;
+	__ld.wm		_g
+.LL10:
+
+	.dbg	line,	"tests/pr20100-1.c", 31; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr20100-1.c", 33; static char
+	.dbg	line,	"tests/pr20100-1.c", 34; ring_empty (void)
+	.dbg	line,	"tests/pr20100-1.c", 35; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_ring_empty
+	__enter		_ring_empty
+
+	.dbg	line,	"tests/pr20100-1.c", 36; if (curr_p () == curr_g ())
+	__ld.wm		_p
+.LL13:
+	__push.wr
+	__ld.wm		_g
+.LL14:
+	__equ_w.wt
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/pr20100-1.c", 37; return 1;
+	__ld.wi		1
+	__bra		.LL11
+
+	.dbg	line,	"tests/pr20100-1.c", 38; else
+.LL12:
+
+	.dbg	line,	"tests/pr20100-1.c", 39; return 0;
+	__ld.wi		0
+.LL15:
+
+	.dbg	line,	"tests/pr20100-1.c", 40; }
+.LL11:
+	__ext.ur
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr20100-1.c", 42; char
+	.dbg	line,	"tests/pr20100-1.c", 43; frob (unsigned short a, unsigned short b)
+	.dbg	line,	"tests/pr20100-1.c", 44; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_frob
+	__enter		_frob
+
+	.dbg	line,	"tests/pr20100-1.c", 45; g = a;
+	__ld.ws		2  /* a */
+	__st.wmq	_g
+
+	.dbg	line,	"tests/pr20100-1.c", 46; p = b;
+	__ld.ws		0  /* b */
+	__st.wmq	_p
+
+	.dbg	line,	"tests/pr20100-1.c", 47; inc_g ();
+	__ld.um		_e
+	__sub.wi	1
+	__equ_w.wm	_g
+	__bfalse	.LL17
+	__ld.wi		0
+	__bra		.LL18
+.LL17:
+	__ld.wm		_g
+	__add.wi	1
+.LL18	.alias		.LL19
+.LL19:
+	__st.wm		_g
+.LL20:
+
+	.dbg	line,	"tests/pr20100-1.c", 48; return ring_empty ();
+	__ld.wm		_p
+.LL21:
+	__push.wr
+	__ld.wm		_g
+.LL22:
+	__equ_w.wt
+	__bfalse	.LL23
+	__ld.wi		1
+	__bra		.LL25
+.LL23:
+	__ld.wi		0
+.LL24:
+.LL25:
+	__ext.ur
+.LL16:
+
+	.dbg	line,	"tests/pr20100-1.c", 49; }
+	__modsp		4
+	__ext.ur
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr20100-1.c", 51; unsigned short
+	.dbg	line,	"tests/pr20100-1.c", 52; get_n (void)
+	.dbg	line,	"tests/pr20100-1.c", 53; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_get_n
+	__enter		_get_n
+
+	.dbg	line,	"tests/pr20100-1.c", 54; unsigned short n = 0;
+	__st.wmiq	0, __get_n_end - 2  /* n */
+
+	.dbg	line,	"tests/pr20100-1.c", 55; unsigned short org_g;
+
+	.dbg	line,	"tests/pr20100-1.c", 56; org_g = curr_g ();
+	__ld.wm		_g
+.LL27:
+	__st.wmq	__get_n_end - 4  /* org_g */
+
+	.dbg	line,	"tests/pr20100-1.c", 57; while (!ring_empty () && n < 5)
+.LL28:
+	__ld.wm		_p
+.LL30:
+	__push.wr
+	__ld.wm		_g
+.LL31:
+	__equ_w.wt
+	__bfalse	.LL32
+	__ld.wi		1
+	__bra		.LL34
+.LL32:
+	__ld.wi		0
+.LL33:
+.LL34:
+	__ext.ur
+	__not.wr
+	__bfalse	.LL35
+	__ld.wm		__get_n_end - 2  /* n */
+	__ult_w.wi	5
+.LL35:
+	__bfalse	.LL29
+
+	.dbg	line,	"tests/pr20100-1.c", 58; {
+
+	.dbg	line,	"tests/pr20100-1.c", 59; inc_g ();
+	__ld.um		_e
+	__sub.wi	1
+	__equ_w.wm	_g
+	__bfalse	.LL36
+	__ld.wi		0
+	__bra		.LL37
+.LL36:
+	__ld.wm		_g
+	__add.wi	1
+.LL37	.alias		.LL38
+.LL38:
+	__st.wm		_g
+.LL39:
+
+	.dbg	line,	"tests/pr20100-1.c", 60; n++;
+	__inc.wmq	__get_n_end - 2  /* n */
+
+	.dbg	line,	"tests/pr20100-1.c", 61; }
+	__bra		.LL28
+.LL29:
+
+	.dbg	line,	"tests/pr20100-1.c", 63; return n;
+	__ld.wm		__get_n_end - 2  /* n */
+.LL26:
+
+	.dbg	line,	"tests/pr20100-1.c", 64; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr20100-1.c", 66; void abort (void);
+	.dbg	line,	"tests/pr20100-1.c", 67; void exit (int);
+	.dbg	line,	"tests/pr20100-1.c", 68; int main (void)
+	.dbg	line,	"tests/pr20100-1.c", 69; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr20100-1.c", 70; e = 3;
+	__st.umiq	3, _e
+
+	.dbg	line,	"tests/pr20100-1.c", 71; if (frob (0, 2) != 0 || g != 1 || p != 2 || e != 3
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_frob
+	__tst.wr
+	__btrue		.LL42
+	__ld.wm		_g
+	__neq_w.wi	1
+.LL42:
+	__btrue		.LL43
+	__ld.wm		_p
+	__neq_w.wi	2
+.LL43:
+	__btrue		.LL44
+	__ld.umq	_e
+	__neq_b.uiq	3
+
+	.dbg	line,	"tests/pr20100-1.c", 72; || get_n () != 1 /*
+
+	.dbg	line,	"tests/pr20100-1.c", 73; || g != 2 || p != 2 */)
+.LL44:
+	__btrue		.LL45
+	__call		_get_n
+	__neq_w.wi	1
+.LL45:
+	__bfalse	.LL41
+
+	.dbg	line,	"tests/pr20100-1.c", 74; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr20100-1.c", 75; exit (0);
+.LL41:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr20100-1.c", 76; }
+.LL40:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:13
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _get_n
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        92     36     2  g
+;        14      7     1  e
+;        26     12     2  p
+;        38     10     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_g, 2, 36, 92
+	auto_zp_var	_e, 1, 7, 14
+	auto_zp_var	_p, 2, 12, 26
+	auto_zp_var	__overlay_frames, 4, 10, 38
+__get_n_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,218 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr20466-1.c", 1; //int f (int **, int *, int *, int **, int **) __attribute__ ((__noinline__));
+	.dbg	line,	"tests/pr20466-1.c", 2; int
+	.dbg	line,	"tests/pr20466-1.c", 3; f (int **ipp, int *i1p, int *i2p, int **i3, int **i4)
+	.dbg	line,	"tests/pr20466-1.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/pr20466-1.c", 5; **ipp = *i1p;
+	__ld.ws		8  /* ipp */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.ws		6  /* i1p */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wtq
+
+	.dbg	line,	"tests/pr20466-1.c", 6; *ipp = i2p;
+	__ld.ws		8  /* ipp */
+	__push.wr
+	__ld.ws		4  /* i2p */
+	__st.wtq
+
+	.dbg	line,	"tests/pr20466-1.c", 7; *i3 = *i4;
+	__ld.ws		2  /* i3 */
+	__push.wr
+	__ld.ws		0  /* i4 */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wtq
+
+	.dbg	line,	"tests/pr20466-1.c", 8; **ipp = 99;
+	__ld.ws		8  /* ipp */
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__push.wr
+	__ld.wi		99
+	__st.wtq
+
+	.dbg	line,	"tests/pr20466-1.c", 9; return 3;
+	__ld.wi		3
+.LL2:
+
+	.dbg	line,	"tests/pr20466-1.c", 10; }
+	__modsp		10
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr20466-1.c", 12; extern void exit (int);
+	.dbg	line,	"tests/pr20466-1.c", 13; extern void abort (void);
+	.dbg	line,	"tests/pr20466-1.c", 15; int main (void)
+	.dbg	line,	"tests/pr20466-1.c", 16; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr20466-1.c", 17; int i = 42, i1 = 66, i2 = 1, i3 = -1, i4 = 55;
+	__st.wmiq	42, __main_end - 2  /* i */
+	__st.wmiq	66, __main_end - 4  /* i1 */
+	__st.wmiq	1, __main_end - 6  /* i2 */
+	__st.wmiq	-1, __main_end - 8  /* i3 */
+	__st.wmiq	55, __main_end - 10  /* i4 */
+
+	.dbg	line,	"tests/pr20466-1.c", 18; int *ip, *i3p, *i4p;
+
+	.dbg	line,	"tests/pr20466-1.c", 19; ip = &i;
+	__ld.wi		__main_end - 2  /* i */
+	__st.wmq	__main_end - 12  /* ip */
+
+	.dbg	line,	"tests/pr20466-1.c", 20; i3p = &i3;
+	__ld.wi		__main_end - 8  /* i3 */
+	__st.wmq	__main_end - 14  /* i3p */
+
+	.dbg	line,	"tests/pr20466-1.c", 21; i4p = &i4;
+	__ld.wi		__main_end - 10  /* i4 */
+	__st.wmq	__main_end - 16  /* i4p */
+
+	.dbg	line,	"tests/pr20466-1.c", 23; f (&ip, &i1, &i2, &i3p, &i4p);
+	__ld.wi		__main_end - 12  /* ip */
+	__pusharg.wr
+	__ld.wi		__main_end - 4  /* i1 */
+	__pusharg.wr
+	__ld.wi		__main_end - 6  /* i2 */
+	__pusharg.wr
+	__ld.wi		__main_end - 14  /* i3p */
+	__pusharg.wr
+	__ld.wi		__main_end - 16  /* i4p */
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/pr20466-1.c", 24; if (i != 66 || ip != &i2 || i2 != 99 || i3 != -1 || i3p != i4p || i4 != 55)
+	__ld.wm		__main_end - 2  /* i */
+	__neq_w.wi	66
+	__btrue		.LL5
+	__ld.wm		__main_end - 12  /* ip */
+	__neq_w.wi	__main_end - 6  /* i2 */
+.LL5:
+	__btrue		.LL6
+	__ld.wm		__main_end - 6  /* i2 */
+	__neq_w.wi	99
+.LL6:
+	__btrue		.LL7
+	__ld.wm		__main_end - 8  /* i3 */
+	__neq_w.wi	-1
+.LL7:
+	__btrue		.LL8
+	__ld.wm		__main_end - 14  /* i3p */
+	__neq_w.wm	__main_end - 16  /* i4p */
+.LL8:
+	__btrue		.LL9
+	__ld.wm		__main_end - 10  /* i4 */
+	__neq_w.wi	55
+.LL9:
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/pr20466-1.c", 25; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr20466-1.c", 26; exit (0);
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr20466-1.c", 27; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    16  _main
+;
+; 16 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        48     48    16  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 16, 48, 48
+__main_end	=	__overlay_frames + 16
+	.endm
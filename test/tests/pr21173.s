@@ -0,0 +1,200 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr21173.c", 1; void abort (void);
+	.dbg	line,	"tests/pr21173.c", 3; char q;
+	.dbg	line,	"tests/pr21173.c", 4; void *a[2];
+	.dbg	line,	"tests/pr21173.c", 6; void foo (char *p)
+	.dbg	line,	"tests/pr21173.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/pr21173.c", 8; int i;
+
+	.dbg	line,	"tests/pr21173.c", 9; for (i = 0; i < 2; i++)
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL3:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.wi	2
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/pr21173.c", 10; a[i] += p - &q;
+	__ld.ws		0  /* p */
+	__sub.wi	_q
+	__asl.wr
+	__ld2x.wm	__foo_end - 2  /* i */
+	__add_st.waxq	_a
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/pr21173.c", 11; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr21173.c", 13; int main (void)
+	.dbg	line,	"tests/pr21173.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr21173.c", 15; int i;
+
+	.dbg	line,	"tests/pr21173.c", 16; foo (&q);
+	__ld.wi		_q
+	__pusharg.wr
+	__st.wmiq	0, __foo_end - 2  /* i */
+.LL8:
+	__ld.wm		__foo_end - 2  /* i */
+	__slt_w.wi	2
+	__btrue		.LL10
+	__bra		.LL11
+.LL9:
+	__inc.wmq	__foo_end - 2  /* i */
+	__bra		.LL8
+.LL10:
+	__ld.ws		0  /* p */
+	__sub.wi	_q
+	__asl.wr
+	__ld2x.wm	__foo_end - 2  /* i */
+	__add_st.waxq	_a
+	__bra		.LL9
+.LL11:
+.LL12:
+	__modsp		2
+
+	.dbg	line,	"tests/pr21173.c", 17; for (i = 0; i < 2; i ++)
+	__st.wmiq	0, __main_end - 2  /* i */
+.LL13:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	2
+	__btrue		.LL15
+	__bra		.LL16
+.LL14:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL13
+.LL15:
+
+	.dbg	line,	"tests/pr21173.c", 18; if (a[i])
+	__ld2x.wmq	__main_end - 2  /* i */
+	__tst.wax	_a
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/pr21173.c", 19; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr21173.c", 20; return 0;
+.LL17	.alias		.LL14
+	__bra		.LL14
+.LL16:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/pr21173.c", 21; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+_a:
+		ds	4
+
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        64      8     2  overlaid locals
+;        20      6     1  q
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 8, 64
+__main_end	=	__overlay_frames + 2
+	auto_zp_var	_q, 1, 6, 20
+	.endm
@@ -0,0 +1,133 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr21964-1.c", 1; void
+	.dbg	line,	"tests/pr21964-1.c", 2; foo (int n, int m)
+	.dbg	line,	"tests/pr21964-1.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/pr21964-1.c", 4; if (m == 0)
+	__not.ws	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr21964-1.c", 5; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr21964-1.c", 6; else if (n != 0)
+	__bra		.LL4
+.LL3:
+	__tst.ws	2  /* n */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/pr21964-1.c", 7; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr21964-1.c", 8; else
+	__bra		.LL6
+.LL5:
+
+	.dbg	line,	"tests/pr21964-1.c", 9; foo (n++, m - 1);
+	__ldinc.ws	2  /* n */
+	__pusharg.wr
+	__ld.ws		2  /* m */
+	__sub.wi	1
+	__pusharg.wr
+	__call		_foo
+.LL6:
+.LL4:
+
+	.dbg	line,	"tests/pr21964-1.c", 10; }
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr21964-1.c", 11; 
+	.dbg	line,	"tests/pr21964-1.c", 12; int
+	.dbg	line,	"tests/pr21964-1.c", 13; main (void)
+	.dbg	line,	"tests/pr21964-1.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr21964-1.c", 15; foo (0, 4);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		4
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/pr21964-1.c", 16; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
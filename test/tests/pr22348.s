@@ -0,0 +1,155 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr22348.c", 1; void abort (void);
+	.dbg	line,	"tests/pr22348.c", 2; void f(int i)
+	.dbg	line,	"tests/pr22348.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/pr22348.c", 4; if (i>4 + 3 * 16)
+	__ld.ws		0  /* i */
+	__sgt_w.wi	52
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr22348.c", 5; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/pr22348.c", 6; }
+.LL3:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr22348.c", 8; int main()
+	.dbg	line,	"tests/pr22348.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr22348.c", 10; unsigned int buflen, i;
+
+	.dbg	line,	"tests/pr22348.c", 11; buflen = 4 + 3 * 16;
+	__st.wmiq	52, __main_end - 2  /* buflen */
+
+	.dbg	line,	"tests/pr22348.c", 12; for (i = 4; i < buflen; i+= 3)
+	__st.wmiq	4, __main_end - 4  /* i */
+.LL5:
+	__ld.wm		__main_end - 4  /* i */
+	__ult_w.wm	__main_end - 2  /* buflen */
+	__btrue		.LL7
+	__bra		.LL8
+.LL6:
+	__add_st.wmiq	3, __main_end - 4  /* i */
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/pr22348.c", 13; f(i);
+	__ld.wm		__main_end - 4  /* i */
+	__pusharg.wr
+	__ld.ws		0  /* i */
+	__sgt_w.wi	52
+	__bfalse	.LL9
+	__call		_abort
+.LL9:
+.LL10:
+	__modsp		2
+	__bra		.LL6
+.LL8:
+
+	.dbg	line,	"tests/pr22348.c", 14; return 0;
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"tests/pr22348.c", 15; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        82     12     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 12, 82
+__main_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,172 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr22630.c", 1; void abort (void);
+	.dbg	line,	"tests/pr22630.c", 3; int j;
+	.dbg	line,	"tests/pr22630.c", 5; void bla (int *r)
+	.dbg	line,	"tests/pr22630.c", 6; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bla
+	__enter		_bla
+
+	.dbg	line,	"tests/pr22630.c", 7; int *p, *q;
+
+	.dbg	line,	"tests/pr22630.c", 9; p = q = r;
+	__ld.ws		0  /* r */
+	__st.wm		__bla_end - 4  /* q */
+	__st.wmq	__bla_end - 2  /* p */
+
+	.dbg	line,	"tests/pr22630.c", 10; if (!p)
+	__not.wm	__bla_end - 2  /* p */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr22630.c", 11; p = &j;
+	__ld.wi		_j
+	__st.wmq	__bla_end - 2  /* p */
+
+	.dbg	line,	"tests/pr22630.c", 12; 
+
+	.dbg	line,	"tests/pr22630.c", 13; if (p != q)
+.LL3:
+	__ld.wm		__bla_end - 2  /* p */
+	__neq_w.wm	__bla_end - 4  /* q */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/pr22630.c", 14; j = 1;
+	__st.wmiq	1, _j
+
+	.dbg	line,	"tests/pr22630.c", 15; }
+.LL4:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__bla_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr22630.c", 17; int main (void)
+	.dbg	line,	"tests/pr22630.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr22630.c", 19; bla (0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* r */
+	__st.wm		__bla_end - 4  /* q */
+	__st.wmq	__bla_end - 2  /* p */
+	__not.wm	__bla_end - 2  /* p */
+	__bfalse	.LL6
+	__ld.wi		_j
+	__st.wmq	__bla_end - 2  /* p */
+.LL6:
+	__ld.wm		__bla_end - 2  /* p */
+	__neq_w.wm	__bla_end - 4  /* q */
+	__bfalse	.LL7
+	__st.wmiq	1, _j
+.LL7:
+.LL8:
+	__modsp		2
+
+	.dbg	line,	"tests/pr22630.c", 20; if (!j)
+	__not.wm	_j
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/pr22630.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr22630.c", 22; return 0;
+.LL9:
+	__ld.wi		0
+.LL5:
+
+	.dbg	line,	"tests/pr22630.c", 23; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 4
+leaf_needs	.set	4
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     2  j
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_j, 2, 10, 10
+	.endm
@@ -0,0 +1,152 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr23047.c", 1; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/pr23047.c", 2; extern void abort ();
+	.dbg	line,	"tests/pr23047.c", 3; extern void exit (int);
+	.dbg	line,	"tests/pr23047.c", 4; void f(int i)
+	.dbg	line,	"tests/pr23047.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/pr23047.c", 6; i = i > 0 ? i : -i;
+	__ld.ws		0  /* i */
+	__sgt_w.wi	0
+	__bfalse	.LL3
+	__ld.ws		0  /* i */
+	__bra		.LL4
+.LL3:
+	__ld.ws		0  /* i */
+	__neg.wr
+.LL4:
+	__st.wsq	0  /* i */
+
+	.dbg	line,	"tests/pr23047.c", 7; if (i<0)
+	__ld.ws		0  /* i */
+	__slt_w.wi	0
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/pr23047.c", 8; return;
+	__bra		.LL2
+
+	.dbg	line,	"tests/pr23047.c", 9; abort ();
+.LL5:
+	__call		_abort
+
+	.dbg	line,	"tests/pr23047.c", 10; }
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr23047.c", 12; int main(int argc, char *argv[])
+	.dbg	line,	"tests/pr23047.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr23047.c", 14; f(INT_MIN);
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		0  /* i */
+	__sgt_w.wi	0
+	__bfalse	.LL7
+	__ld.ws		0  /* i */
+	__bra		.LL8
+.LL7:
+	__ld.ws		0  /* i */
+	__neg.wr
+.LL8:
+	__st.wsq	0  /* i */
+	__ld.ws		0  /* i */
+	__slt_w.wi	0
+	__bfalse	.LL9
+	__bra		.LL10
+.LL9:
+	__call		_abort
+.LL10:
+	__modsp		2
+
+	.dbg	line,	"tests/pr23047.c", 15; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr23047.c", 16; }
+.LL6:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
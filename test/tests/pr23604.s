@@ -0,0 +1,166 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr23604.c", 1; extern void abort (void);
+	.dbg	line,	"tests/pr23604.c", 3; int g(int i, int j)
+	.dbg	line,	"tests/pr23604.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/pr23604.c", 5; if (i>-1)
+	__ld.ws		2  /* i */
+	__sgt_w.wi	-1
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr23604.c", 6; if (i<2)
+	__ld.ws		2  /* i */
+	__slt_w.wi	2
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/pr23604.c", 7; {
+
+	.dbg	line,	"tests/pr23604.c", 8; if (i != j)
+	__ld.ws		2  /* i */
+	__neq_w.ws	0  /* j */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/pr23604.c", 9; {
+
+	.dbg	line,	"tests/pr23604.c", 10; if (j != 0)
+	__tst.ws	0  /* j */
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/pr23604.c", 11; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/pr23604.c", 12; }
+.LL6:
+
+	.dbg	line,	"tests/pr23604.c", 13; }
+.LL5:
+
+	.dbg	line,	"tests/pr23604.c", 14; return 1;
+.LL4:
+.LL3:
+	__ld.wi		1
+.LL2:
+
+	.dbg	line,	"tests/pr23604.c", 15; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr23604.c", 17; int main(void)
+	.dbg	line,	"tests/pr23604.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr23604.c", 19; if (!g(1, 0))
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		2  /* i */
+	__sgt_w.wi	-1
+	__bfalse	.LL12
+	__ld.ws		2  /* i */
+	__slt_w.wi	2
+	__bfalse	.LL11
+	__ld.ws		2  /* i */
+	__neq_w.ws	0  /* j */
+	__bfalse	.LL10
+	__tst.ws	0  /* j */
+	__bfalse	.LL9
+	__ld.wi		0
+	__bra		.LL13
+.LL9:
+.LL10:
+.LL11:
+.LL12:
+	__ld.wi		1
+.LL13:
+	__modsp		4
+	__not.wr
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/pr23604.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr23604.c", 21; return 0;
+.LL8:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/pr23604.c", 22; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
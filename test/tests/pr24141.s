@@ -0,0 +1,201 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr24141.c", 1; // reduced testcase, compile with -O2. Also, with --disable-checking
+	.dbg	line,	"tests/pr24141.c", 2; // gcc produces wrong code.
+	.dbg	line,	"tests/pr24141.c", 4; void abort (void);
+	.dbg	line,	"tests/pr24141.c", 5; int i;
+	.dbg	line,	"tests/pr24141.c", 7; void g (void)
+	.dbg	line,	"tests/pr24141.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_g
+	__enter		_g
+
+	.dbg	line,	"tests/pr24141.c", 9; i = 1;
+	__st.wmiq	1, _i
+
+	.dbg	line,	"tests/pr24141.c", 10; }
+.LL2:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr24141.c", 12; void f (int a, int b)
+	.dbg	line,	"tests/pr24141.c", 13; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/pr24141.c", 14; int c = 0;
+	__st.wmiq	0, __f_end - 2  /* c */
+
+	.dbg	line,	"tests/pr24141.c", 15; if (a == 0)
+	__not.ws	2
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/pr24141.c", 16; c = 1;
+	__st.wmiq	1, __f_end - 2  /* c */
+
+	.dbg	line,	"tests/pr24141.c", 17; if (c)
+.LL4:
+	__tst.wm	__f_end - 2  /* c */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/pr24141.c", 18; return;
+	__bra		.LL3
+
+	.dbg	line,	"tests/pr24141.c", 19; if (c == 1)
+.LL5:
+	__ld.wm		__f_end - 2  /* c */
+	__equ_w.wi	1
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/pr24141.c", 20; c = 0;
+	__st.wmiq	0, __f_end - 2  /* c */
+
+	.dbg	line,	"tests/pr24141.c", 21; if (b == 0)
+.LL6:
+	__not.ws	0
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/pr24141.c", 22; c = 1;
+	__st.wmiq	1, __f_end - 2  /* c */
+
+	.dbg	line,	"tests/pr24141.c", 23; if (c)
+.LL7:
+	__tst.wm	__f_end - 2  /* c */
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/pr24141.c", 24; g ();
+	__st.wmiq	1, _i
+.LL9:
+
+	.dbg	line,	"tests/pr24141.c", 25; }
+.LL8:
+.LL3:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr24141.c", 27; int main (void)
+	.dbg	line,	"tests/pr24141.c", 28; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr24141.c", 29; f (1, 0);
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_f
+
+	.dbg	line,	"tests/pr24141.c", 30; if (i != 1)
+	__ld.wm		_i
+	__neq_w.wi	1
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/pr24141.c", 31; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr24141.c", 32; return 0;
+.LL11:
+	__ld.wi		0
+.LL10:
+
+	.dbg	line,	"tests/pr24141.c", 33; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _f
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        14     14     2  overlaid locals
+;         6      6     2  i
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 14, 14
+__f_end	=	__overlay_frames + 2
+	auto_zp_var	_i, 2, 6, 6
+	.endm
@@ -0,0 +1,154 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr24142.c", 1; void abort (void);
+	.dbg	line,	"tests/pr24142.c", 3; int f (int a, int b)
+	.dbg	line,	"tests/pr24142.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/pr24142.c", 5; if (a == 1)
+	__ld.ws		2  /* a */
+	__equ_w.wi	1
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr24142.c", 6; a = 0;
+	__st.wsiq	0, 2  /* a */
+
+	.dbg	line,	"tests/pr24142.c", 7; if (b == 0)
+.LL3:
+	__not.ws	0
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/pr24142.c", 8; a = 1;
+	__st.wsiq	1, 2  /* a */
+
+	.dbg	line,	"tests/pr24142.c", 9; if (a != 0)
+.LL4:
+	__tst.ws	2  /* a */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/pr24142.c", 10; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/pr24142.c", 11; return 1;
+.LL5:
+	__ld.wi		1
+.LL2:
+
+	.dbg	line,	"tests/pr24142.c", 12; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr24142.c", 14; int main (void)
+	.dbg	line,	"tests/pr24142.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr24142.c", 16; if (f (1, 1) != 1)
+	__ld.wi		1
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__equ_w.wi	1
+	__bfalse	.LL8
+	__st.wsiq	0, 2  /* a */
+.LL8:
+	__not.ws	0
+	__bfalse	.LL9
+	__st.wsiq	1, 2  /* a */
+.LL9:
+	__tst.ws	2  /* a */
+	__bfalse	.LL10
+	__ld.wi		0
+	__bra		.LL11
+.LL10:
+	__ld.wi		1
+.LL11:
+	__modsp		4
+	__neq_w.wi	1
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/pr24142.c", 17; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr24142.c", 18; return 0;
+.LL7:
+	__ld.wi		0
+.LL6:
+
+	.dbg	line,	"tests/pr24142.c", 19; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
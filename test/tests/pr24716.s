@@ -0,0 +1,276 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr24716.c", 1; /* PR24716, scalar evolution returning the wrong result
+	.dbg	line,	"tests/pr24716.c", 2; for pdest.  */
+	.dbg	line,	"tests/pr24716.c", 4; const int Link[] = { -1 };
+	.dbg	line,	"tests/pr24716.c", 5; const int W[] = { 2 };
+	.dbg	line,	"tests/pr24716.c", 7; extern void abort (void);
+	.dbg	line,	"tests/pr24716.c", 9; int f (int k, int p)
+	.dbg	line,	"tests/pr24716.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/pr24716.c", 11; int pdest, j, D1361;
+
+	.dbg	line,	"tests/pr24716.c", 12; j = 0;
+	__st.wmiq	0, __f_end - 4  /* j */
+
+	.dbg	line,	"tests/pr24716.c", 13; pdest = 0;
+	__st.wmiq	0, __f_end - 2  /* pdest */
+
+	.dbg	line,	"tests/pr24716.c", 14; for (;;) {
+.LL3:
+.LL4:
+.LL5:
+
+	.dbg	line,	"tests/pr24716.c", 15; if (pdest > 2)
+	__ld.wm		__f_end - 2  /* pdest */
+	__sgt_w.wi	2
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/pr24716.c", 16; do
+.LL8:
+
+	.dbg	line,	"tests/pr24716.c", 17; j--, pdest++;
+	__dec.wmq	__f_end - 4  /* j */
+	__inc.wmq	__f_end - 2  /* pdest */
+
+	.dbg	line,	"tests/pr24716.c", 18; while (j > 2);
+.LL9:
+	__ld.wm		__f_end - 4  /* j */
+	__sgt_w.wi	2
+	__btrue		.LL8
+.LL10:
+
+	.dbg	line,	"tests/pr24716.c", 20; if (j == 1)
+.LL7:
+	__ld.wm		__f_end - 4  /* j */
+	__equ_w.wi	1
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/pr24716.c", 21; break;
+	__bra		.LL6
+
+	.dbg	line,	"tests/pr24716.c", 23; while (pdest > p)
+.LL11:
+.LL12:
+	__ld.wm		__f_end - 2  /* pdest */
+	__sgt_w.ws	0  /* p */
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/pr24716.c", 24; if (j == p)
+	__ld.wm		__f_end - 4  /* j */
+	__equ_w.ws	0  /* p */
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/pr24716.c", 25; pdest++;
+	__inc.wmq	__f_end - 2  /* pdest */
+
+	.dbg	line,	"tests/pr24716.c", 27; do
+.LL14	.alias		.LL12
+	__bra		.LL12
+.LL13:
+.LL15:
+
+	.dbg	line,	"tests/pr24716.c", 28; {
+
+	.dbg	line,	"tests/pr24716.c", 29; D1361 = W[k];
+	__ld2x.wsq	2  /* k */
+	__ld.wax	_W
+	__st.wmq	__f_end - 6  /* D1361 */
+
+	.dbg	line,	"tests/pr24716.c", 30; do
+.LL18:
+
+	.dbg	line,	"tests/pr24716.c", 31; if (D1361 != 0)
+	__tst.wm	__f_end - 6  /* D1361 */
+	__bfalse	.LL21
+
+	.dbg	line,	"tests/pr24716.c", 32; pdest = 1, W[k] = D1361 = 0;
+	__st.wmiq	1, __f_end - 2  /* pdest */
+	__ld.wi		0
+	__st.wm		__f_end - 6  /* D1361 */
+	__ld2x.ws	2  /* k */
+	__st.waxq	_W
+
+	.dbg	line,	"tests/pr24716.c", 33; while (p < 1);
+.LL21:
+.LL19:
+	__ld.ws		0  /* p */
+	__slt_w.wi	1
+	__btrue		.LL18
+.LL20:
+
+	.dbg	line,	"tests/pr24716.c", 34; } while (k > 0);
+.LL16:
+	__ld.ws		2  /* k */
+	__sgt_w.wi	0
+	__btrue		.LL15
+.LL17:
+
+	.dbg	line,	"tests/pr24716.c", 36; do
+.LL22:
+
+	.dbg	line,	"tests/pr24716.c", 37; {
+
+	.dbg	line,	"tests/pr24716.c", 38; p = 0;
+	__st.wsiq	0, 0  /* p */
+
+	.dbg	line,	"tests/pr24716.c", 39; k = Link[k];
+	__ld2x.wsq	2  /* k */
+	__ld.wax	_Link
+	__st.wsq	2  /* k */
+
+	.dbg	line,	"tests/pr24716.c", 40; while (p < j)
+.LL25:
+	__ld.ws		0  /* p */
+	__slt_w.wm	__f_end - 4  /* j */
+	__bfalse	.LL26
+
+	.dbg	line,	"tests/pr24716.c", 41; if (k != -1)
+	__ld.ws		2  /* k */
+	__neq_w.wi	-1
+	__bfalse	.LL27
+
+	.dbg	line,	"tests/pr24716.c", 42; pdest++, p++;
+	__inc.wmq	__f_end - 2  /* pdest */
+	__inc.wsq	0  /* p */
+
+	.dbg	line,	"tests/pr24716.c", 43; }
+.LL27	.alias		.LL25
+	__bra		.LL25
+.LL26:
+
+	.dbg	line,	"tests/pr24716.c", 44; while (k != -1);
+.LL23:
+	__ld.ws		2  /* k */
+	__neq_w.wi	-1
+	__btrue		.LL22
+.LL24:
+
+	.dbg	line,	"tests/pr24716.c", 45; j = 1;
+	__st.wmiq	1, __f_end - 4  /* j */
+
+	.dbg	line,	"tests/pr24716.c", 46; }
+	__bra		.LL5
+.LL6:
+
+	.dbg	line,	"tests/pr24716.c", 48; /* The correct return value should be pdest (1 in the call from main).
+
+	.dbg	line,	"tests/pr24716.c", 49; DOM3 is mistaken and propagates a 0 here.  */
+
+	.dbg	line,	"tests/pr24716.c", 50; return pdest;
+	__ld.wm		__f_end - 2  /* pdest */
+.LL2:
+
+	.dbg	line,	"tests/pr24716.c", 51; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr24716.c", 53; int main ()
+	.dbg	line,	"tests/pr24716.c", 54; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr24716.c", 55; if (!f (0, 2))
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_f
+	__not.wr
+	__bfalse	.LL29
+
+	.dbg	line,	"tests/pr24716.c", 56; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr24716.c", 57; return 0;
+.LL29:
+	__ld.wi		0
+.LL28:
+
+	.dbg	line,	"tests/pr24716.c", 58; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+	.rodata
+_Link:
+		dw	-1
+_W:
+		dw	2
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:4
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
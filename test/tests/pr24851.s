@@ -0,0 +1,108 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr24851.c", 1; /* We used to handle pointer addition wrongly
+	.dbg	line,	"tests/pr24851.c", 2; at the time of recombining to an ARRAY_REF
+	.dbg	line,	"tests/pr24851.c", 3; in the case of
+	.dbg	line,	"tests/pr24851.c", 4; p + -4B
+	.dbg	line,	"tests/pr24851.c", 5; where -4B is represented as unsigned.  */
+	.dbg	line,	"tests/pr24851.c", 7; void abort(void);
+	.dbg	line,	"tests/pr24851.c", 8; int main()
+	.dbg	line,	"tests/pr24851.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr24851.c", 10; int a[10], *p, *q;
+
+	.dbg	line,	"tests/pr24851.c", 11; q = &a[1];
+	__ld.wi		__main_end - 20 + 2  /* a */
+	__st.wmq	__main_end - 24  /* q */
+
+	.dbg	line,	"tests/pr24851.c", 12; p = &q[-1];
+	__add.wi	-2
+	__st.wmq	__main_end - 22  /* p */
+
+	.dbg	line,	"tests/pr24851.c", 13; if (p >= &a[9])
+	__uge_w.wi	__main_end - 20 + 18  /* a */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr24851.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr24851.c", 15; return 0;
+.LL3:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/pr24851.c", 16; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__main_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 24
+leaf_needs	.set	24
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:2
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
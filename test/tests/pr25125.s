@@ -0,0 +1,163 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr25125.c", 1; extern void exit (int);
+	.dbg	line,	"tests/pr25125.c", 2; extern void abort (void);
+	.dbg	line,	"tests/pr25125.c", 3; //extern unsigned short f (short a) __attribute__((__noinline__));
+	.dbg	line,	"tests/pr25125.c", 5; unsigned short
+	.dbg	line,	"tests/pr25125.c", 6; f (short a)
+	.dbg	line,	"tests/pr25125.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/pr25125.c", 8; short b;
+
+	.dbg	line,	"tests/pr25125.c", 10; if (a > 0)
+	__ld.ws		0  /* a */
+	__sgt_w.wi	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr25125.c", 11; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/pr25125.c", 12; b = (/*(int)*/ a) + - /*(int)*/ 32768;
+.LL3:
+	__ld.ws		0  /* a */
+	__add.wi	-32768
+	__st.wmq	__f_end - 2  /* b */
+
+	.dbg	line,	"tests/pr25125.c", 13; return b;
+.LL2:
+
+	.dbg	line,	"tests/pr25125.c", 14; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr25125.c", 16; int
+	.dbg	line,	"tests/pr25125.c", 17; main (void)
+	.dbg	line,	"tests/pr25125.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr25125.c", 19; if (sizeof (short) < 2
+	__ld.wi		2
+	__slt_w.wi	2
+
+	.dbg	line,	"tests/pr25125.c", 20; || sizeof (short) >= sizeof (int))
+	__btrue		.LL6
+	__ld.wi		2
+	__sge_w.wi	2
+.LL6:
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/pr25125.c", 21; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr25125.c", 23; if (f (-32767) != 1)
+.LL5:
+	__ld.wi		-32767
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__sgt_w.wi	0
+	__bfalse	.LL8
+	__ld.wi		0
+	__bra		.LL9
+.LL8:
+	__ld.ws		0  /* a */
+	__add.wi	-32768
+	__st.wmq	__f_end - 2  /* b */
+.LL9:
+	__modsp		2
+	__neq_w.wi	1
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/pr25125.c", 24; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr25125.c", 26; exit (0);
+.LL7:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr25125.c", 27; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
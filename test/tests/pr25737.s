@@ -0,0 +1,152 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr25737.c", 1; extern void abort (void);
+	.dbg	line,	"tests/pr25737.c", 3; struct delay_block {
+	.dbg	line,	"tests/pr25737.c", 4; struct delay_block *succ;
+	.dbg	line,	"tests/pr25737.c", 5; };
+	.dbg	line,	"tests/pr25737.c", 7; static struct delay_block Timer_Queue;
+	.dbg	line,	"tests/pr25737.c", 9; struct delay_block* time_enqueue (struct delay_block *d)
+	.dbg	line,	"tests/pr25737.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_time_enqueue
+	__enter		_time_enqueue
+
+	.dbg	line,	"tests/pr25737.c", 11; struct delay_block *q; q = Timer_Queue.succ; 
+	__ld.ws		0  /* d */
+
+	.dbg	line,	"tests/pr25737.c", 12; d->succ =  /*(void *)*/0;
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+
+	.dbg	line,	"tests/pr25737.c", 13; return Timer_Queue.succ;
+	__ld.wm		_Timer_Queue
+.LL2:
+
+	.dbg	line,	"tests/pr25737.c", 14; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__time_enqueue_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr25737.c", 16; int main(void)
+	.dbg	line,	"tests/pr25737.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr25737.c", 18; Timer_Queue.succ = &Timer_Queue;
+	__ld.wi		_Timer_Queue
+	__st.wmq	_Timer_Queue
+
+	.dbg	line,	"tests/pr25737.c", 19; if (time_enqueue (&Timer_Queue) != /*(void*)*/0)
+	__pusharg.wr
+	__ld.ws		0  /* d */
+	__push.wr
+	__ld.wi		0
+	__st.wtq
+	__ld.wm		_Timer_Queue
+.LL5:
+	__modsp		2
+	__tst.wr
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/pr25737.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr25737.c", 21; return 0;
+.LL4:
+	__ld.wi		0
+.LL3:
+
+	.dbg	line,	"tests/pr25737.c", 22; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        12     12     2  Timer_Queue
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_Timer_Queue, 2, 12, 12
+	.endm
@@ -0,0 +1,242 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr27073.c", 1; void //__attribute__((noinline))
+	.dbg	line,	"tests/pr27073.c", 2; foo (int *p, int d1, int d2, int d3,
+	.dbg	line,	"tests/pr27073.c", 3; short count, int s1, int s2, int s3, int s4, int s5)
+	.dbg	line,	"tests/pr27073.c", 4; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/pr27073.c", 5; int n; n = count;
+	__ld.ws		10  /* count */
+	__st.wmq	__foo_end - 2  /* n */
+
+	.dbg	line,	"tests/pr27073.c", 6; while (n--)
+.LL3:
+	__lddec.wm	__foo_end - 2  /* n */
+	__tst.wr
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/pr27073.c", 7; {
+
+	.dbg	line,	"tests/pr27073.c", 8; *p++ = s1;
+	__ld.ws		18  /* p */
+	__add.wi	2
+	__st.ws		18  /* p */
+	__sub.wi	2
+	__push.wr
+	__ld.ws		8  /* s1 */
+	__st.wtq
+
+	.dbg	line,	"tests/pr27073.c", 9; *p++ = s2;
+	__ld.ws		18  /* p */
+	__add.wi	2
+	__st.ws		18  /* p */
+	__sub.wi	2
+	__push.wr
+	__ld.ws		6  /* s2 */
+	__st.wtq
+
+	.dbg	line,	"tests/pr27073.c", 10; *p++ = s3;
+	__ld.ws		18  /* p */
+	__add.wi	2
+	__st.ws		18  /* p */
+	__sub.wi	2
+	__push.wr
+	__ld.ws		4  /* s3 */
+	__st.wtq
+
+	.dbg	line,	"tests/pr27073.c", 11; *p++ = s4;
+	__ld.ws		18  /* p */
+	__add.wi	2
+	__st.ws		18  /* p */
+	__sub.wi	2
+	__push.wr
+	__ld.ws		2  /* s4 */
+	__st.wtq
+
+	.dbg	line,	"tests/pr27073.c", 12; *p++ = s5;
+	__ld.ws		18  /* p */
+	__add.wi	2
+	__st.ws		18  /* p */
+	__sub.wi	2
+	__push.wr
+	__ld.ws		0  /* s5 */
+	__st.wtq
+
+	.dbg	line,	"tests/pr27073.c", 13; }
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/pr27073.c", 14; }
+.LL2:
+	__modsp		20
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr27073.c", 16; int main()
+	.dbg	line,	"tests/pr27073.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr27073.c", 18; int x[10], i;
+
+	.dbg	line,	"tests/pr27073.c", 20; foo (x, 0, 0, 0, 2, 100, 200, 300, 400, 500);
+	__ld.wi		__main_end - 20  /* x */
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		100
+	__pusharg.wr
+	__ld.wi		200
+	__pusharg.wr
+	__ld.wi		300
+	__pusharg.wr
+	__ld.wi		400
+	__pusharg.wr
+	__ld.wi		500
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/pr27073.c", 21; for (i = 0; i < 10; i++)
+	__st.wmiq	0, __main_end - 22  /* i */
+.LL6:
+	__ld.wm		__main_end - 22  /* i */
+	__slt_w.wi	10
+	__btrue		.LL8
+	__bra		.LL9
+.LL7:
+	__inc.wmq	__main_end - 22  /* i */
+	__bra		.LL6
+.LL8:
+
+	.dbg	line,	"tests/pr27073.c", 22; if (x[i] != (i % 5 + 1) * 100)
+	__ld.wm		__main_end - 22  /* i */
+	__smod.wi	5
+	__add.wi	1
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	__asl.wi	2
+	__ld2x.wm	__main_end - 22  /* i */
+	__neq_w.wax	__main_end - 20  /* x */
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/pr27073.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr27073.c", 24; exit (0);
+.LL10	.alias		.LL7
+	__bra		.LL7
+.LL9:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr27073.c", 25; }
+.LL5:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    22  _main
+;
+; 22 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        98     14    22  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 22, 14, 98
+__main_end	=	__overlay_frames + 22
+	.endm
@@ -0,0 +1,258 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr27285.c", 1; /* PR tree-optimization/27285 */
+	.dbg	line,	"tests/pr27285.c", 3; extern void abort (void);
+	.dbg	line,	"tests/pr27285.c", 5; struct S { unsigned char a, b, c, d[16]; };
+	.dbg	line,	"tests/pr27285.c", 7; void //__attribute__ ((noinline))
+	.dbg	line,	"tests/pr27285.c", 8; foo (struct S *x, struct S *y)
+	.dbg	line,	"tests/pr27285.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/pr27285.c", 10; int a, b;
+
+	.dbg	line,	"tests/pr27285.c", 11; unsigned char c, *d, *e;
+
+	.dbg	line,	"tests/pr27285.c", 13; b = x->b;
+	__ld.ws		2  /* x */
+	__add.wi	1
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__st.wmq	__foo_end - 4  /* b */
+
+	.dbg	line,	"tests/pr27285.c", 14; d = x->d;
+	__ld.ws		2  /* x */
+	__add.wi	3
+	__st.wmq	__foo_end - 7  /* d */
+
+	.dbg	line,	"tests/pr27285.c", 15; e = y->d;
+	__ld.ws		0  /* y */
+	__add.wi	3
+	__st.wmq	__foo_end - 9  /* e */
+
+	.dbg	line,	"tests/pr27285.c", 16; a = 0;
+	__st.wmiq	0, __foo_end - 2  /* a */
+
+	.dbg	line,	"tests/pr27285.c", 17; while (b)
+.LL3:
+	__tst.wm	__foo_end - 4  /* b */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/pr27285.c", 18; {
+
+	.dbg	line,	"tests/pr27285.c", 19; if (b >= 8)
+	__ld.wm		__foo_end - 4  /* b */
+	__sge_w.wi	8
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/pr27285.c", 20; {
+
+	.dbg	line,	"tests/pr27285.c", 21; c = 0xff;
+	__st.umiq	255, __foo_end - 5  /* c */
+
+	.dbg	line,	"tests/pr27285.c", 22; b -= 8;
+	__sub_st.wmiq	8, __foo_end - 4  /* b */
+
+	.dbg	line,	"tests/pr27285.c", 23; }
+
+	.dbg	line,	"tests/pr27285.c", 24; else
+	__bra		.LL6
+.LL5:
+
+	.dbg	line,	"tests/pr27285.c", 25; {
+
+	.dbg	line,	"tests/pr27285.c", 26; c = 0xff << (8 - b);
+	__ld.wi		255
+	__push.wr
+	__ld.wi		8
+	__sub.wm	__foo_end - 4  /* b */
+	__asl.wt
+	__st.umq	__foo_end - 5  /* c */
+
+	.dbg	line,	"tests/pr27285.c", 27; b = 0;
+	__st.wmiq	0, __foo_end - 4  /* b */
+
+	.dbg	line,	"tests/pr27285.c", 28; }
+.LL6:
+
+	.dbg	line,	"tests/pr27285.c", 30; e[a] = d[a] & c;
+	__ld.wm		__foo_end - 9  /* e */
+	__add.wm	__foo_end - 2  /* a */
+	__push.wr
+	__ld.wm		__foo_end - 7  /* d */
+	__add.wm	__foo_end - 2  /* a */
+	__st.wm		__ptr
+	__ld.up		__ptr
+	__and.um	__foo_end - 5  /* c */
+	__st.utq
+
+	.dbg	line,	"tests/pr27285.c", 31; a++;
+	__inc.wmq	__foo_end - 2  /* a */
+
+	.dbg	line,	"tests/pr27285.c", 32; }
+	__bra		.LL3
+.LL4:
+
+	.dbg	line,	"tests/pr27285.c", 33; }
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr27285.c", 35; int
+	.dbg	line,	"tests/pr27285.c", 36; main (void)
+	.dbg	line,	"tests/pr27285.c", 37; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr27285.c", 38; struct S x, y; x.a = 0; x.b = 25; x.c = 0; x.d[0] = 0xaa; x.d[1] = 0xbb ; x.d[2] = 0xcc; x.d[3] = 0xdd;// = { 0, 25, 0, { 0xaa, 0xbb, 0xcc, 0xdd }};
+	__st.umiq	0, __main_end - 19  /* x */
+	__st.umiq	25, __main_end - 19 + 1  /* x */
+	__st.umiq	0, __main_end - 19 + 2  /* x */
+	__st.umiq	170, __main_end - 19 + 3  /* x */
+	__st.umiq	187, __main_end - 19 + 3 + 1  /* x */
+	__st.umiq	204, __main_end - 19 + 3 + 2  /* x */
+	__st.umiq	221, __main_end - 19 + 3 + 3  /* x */
+
+	.dbg	line,	"tests/pr27285.c", 39; //struct S y = { 0, 0, 0, { 0 }};
+
+	.dbg	line,	"tests/pr27285.c", 40; y.a = 0; y.b = 0; y.c = 0; y.d[0] = 0;
+	__st.umiq	0, __main_end - 38  /* y */
+	__st.umiq	0, __main_end - 38 + 1  /* y */
+	__st.umiq	0, __main_end - 38 + 2  /* y */
+	__st.umiq	0, __main_end - 38 + 3  /* y */
+
+	.dbg	line,	"tests/pr27285.c", 42; foo (&x, &y);
+	__ld.wi		__main_end - 19  /* x */
+	__pusharg.wr
+	__ld.wi		__main_end - 38  /* y */
+	__pusharg.wr
+	__call		_foo
+
+	.dbg	line,	"tests/pr27285.c", 43; if (x.d[0] != y.d[0] || x.d[1] != y.d[1]
+	__ld.umq	__main_end - 19 + 3  /* x */
+	__neq_b.umq	__main_end - 38 + 3  /* y */
+	__btrue		.LL9
+	__ld.umq	__main_end - 19 + 3 + 1  /* x */
+	__neq_b.umq	__main_end - 38 + 3 + 1  /* y */
+
+	.dbg	line,	"tests/pr27285.c", 44; || x.d[2] != y.d[2] || (x.d[3] & 0x80) != y.d[3])
+.LL9:
+	__btrue		.LL10
+	__ld.umq	__main_end - 19 + 3 + 2  /* x */
+	__neq_b.umq	__main_end - 38 + 3 + 2  /* y */
+.LL10:
+	__btrue		.LL11
+	__ld.um		__main_end - 19 + 3 + 3  /* x */
+	__and.uiq	128
+	__neq_b.umq	__main_end - 38 + 3 + 3  /* y */
+.LL11:
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/pr27285.c", 45; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr27285.c", 46; return 0;
+.LL8:
+	__ld.wi		0
+.LL7:
+
+	.dbg	line,	"tests/pr27285.c", 47; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 9
+leaf_needs	.set	9
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    38  _main
+;
+; 38 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        42     42    38  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 38, 42, 42
+__main_end	=	__overlay_frames + 38
+	.endm
@@ -0,0 +1,160 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr27364.c", 1; int f(unsigned number_of_digits_to_use)
+	.dbg	line,	"tests/pr27364.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/pr27364.c", 3; if (number_of_digits_to_use >1294)
+	__ld.ws		0  /* number_of_digits_to_use */
+	__ugt_w.wi	1294
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr27364.c", 4; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/pr27364.c", 5; return (number_of_digits_to_use * 3321 / 1000 + 1) /16;
+.LL3:
+	__ld.ws		0  /* number_of_digits_to_use */
+	.if	FAST_MULTIPLY
+	__mul.wi	3321
+	.else
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__sub.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	5
+	__sub.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	.endif
+	__udiv.wi	1000
+	__add.wi	1
+	__lsr.wi	4
+.LL2:
+
+	.dbg	line,	"tests/pr27364.c", 6; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr27364.c", 8; int main(void)
+	.dbg	line,	"tests/pr27364.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr27364.c", 10; if (f(11) != 2)
+	__ld.wi		11
+	__pusharg.wr
+	__ld.ws		0  /* number_of_digits_to_use */
+	__ugt_w.wi	1294
+	__bfalse	.LL6
+	__ld.wi		0
+	__bra		.LL7
+.LL6:
+	__ld.ws		0  /* number_of_digits_to_use */
+	.if	FAST_MULTIPLY
+	__mul.wi	3321
+	.else
+	__st.wm	<multiplicand
+	__asl.wi	2
+	__sub.wm	<multiplicand
+	__asl.wi	2
+	__add.wm	<multiplicand
+	__asl.wi	5
+	__sub.wm	<multiplicand
+	__asl.wi	3
+	__add.wm	<multiplicand
+	.endif
+	__udiv.wi	1000
+	__add.wi	1
+	__lsr.wi	4
+.LL7:
+	__modsp		2
+	__neq_w.wi	2
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/pr27364.c", 11; /*__builtin_*/abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr27364.c", 12; exit (0);
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr27364.c", 13; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,137 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr27671-1.c", 1; /* PR rtl-optimization/27671.
+	.dbg	line,	"tests/pr27671-1.c", 2; The combiner used to simplify "a ^ b == a" to "a" via
+	.dbg	line,	"tests/pr27671-1.c", 3; simplify_relational_operation_1 in simplify-rtx.c.  */
+	.dbg	line,	"tests/pr27671-1.c", 5; //extern void abort (void) __attribute__ ((noreturn));
+	.dbg	line,	"tests/pr27671-1.c", 6; //extern void exit (int) __attribute__ ((noreturn));
+	.dbg	line,	"tests/pr27671-1.c", 8; static int //__attribute__((noinline))
+	.dbg	line,	"tests/pr27671-1.c", 9; foo (int a, int b)
+	.dbg	line,	"tests/pr27671-1.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/pr27671-1.c", 11; int c; c = a ^ b;
+	__ld.ws		2  /* a */
+	__eor.ws	0  /* b */
+	__st.wmq	__foo_end - 2  /* c */
+
+	.dbg	line,	"tests/pr27671-1.c", 12; if (c == a)
+	__equ_w.ws	2  /* a */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr27671-1.c", 13; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr27671-1.c", 14; }
+.LL3:
+.LL2:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__foo_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr27671-1.c", 16; int
+	.dbg	line,	"tests/pr27671-1.c", 17; main (void)
+	.dbg	line,	"tests/pr27671-1.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr27671-1.c", 19; foo (0, 1);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__eor.ws	0  /* b */
+	__st.wmq	__foo_end - 2  /* c */
+	__equ_w.ws	2  /* a */
+	__bfalse	.LL5
+	__call		_abort
+.LL5:
+.LL6:
+	__modsp		4
+
+	.dbg	line,	"tests/pr27671-1.c", 20; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr27671-1.c", 21; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
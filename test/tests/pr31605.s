@@ -0,0 +1,136 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr31605.c", 1; void put_field (unsigned int start, unsigned int len)
+	.dbg	line,	"tests/pr31605.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_put_field
+	__enter		_put_field
+
+	.dbg	line,	"tests/pr31605.c", 3; int cur_bitshift; cur_bitshift = ((start + len) % 8) - 8;
+	__ld.ws		2  /* start */
+	__add.ws	0  /* len */
+	__and.wi	7
+	__sub.wi	8
+	__st.wmq	__put_field_end - 2  /* cur_bitshift */
+
+	.dbg	line,	"tests/pr31605.c", 4; if (cur_bitshift > -8)
+	__sgt_w.wi	-8
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pr31605.c", 5; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr31605.c", 6; }
+.LL3:
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__put_field_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pr31605.c", 8; int
+	.dbg	line,	"tests/pr31605.c", 9; main ()
+	.dbg	line,	"tests/pr31605.c", 10; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr31605.c", 11; put_field (0, 1);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		2  /* start */
+	__add.ws	0  /* len */
+	__and.wi	7
+	__sub.wi	8
+	__st.wmq	__put_field_end - 2  /* cur_bitshift */
+	__sgt_w.wi	-8
+	__bfalse	.LL5
+	__ld.wi		0
+	__call		_exit.1
+.LL5:
+.LL6:
+	__modsp		4
+
+	.dbg	line,	"tests/pr31605.c", 12; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr31605.c", 13; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,198 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr32500.c", 1; extern void abort(void);
+	.dbg	line,	"tests/pr32500.c", 2; extern void exit(int);
+	.dbg	line,	"tests/pr32500.c", 3; //void foo(int) __attribute__((noinline));
+	.dbg	line,	"tests/pr32500.c", 4; //void bar(void) __attribute__((noinline));
+	.dbg	line,	"tests/pr32500.c", 6; /* Make sure foo is not inlined or considered pure/const.  */
+	.dbg	line,	"tests/pr32500.c", 7; int x;
+	.dbg	line,	"tests/pr32500.c", 8; void foo(int i) { x = i; }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+	__ld.ws		0  /* i */
+	__st.wmq	_x
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr32500.c", 9; void bar(void) { exit(0); }
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+	__ld.wi		0
+	__call		_exit.1
+.LL3:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr32500.c", 11; const int numbers[4] = { 0xdead, 0xbeef, 0x1337, 0x4242 };
+	.dbg	line,	"tests/pr32500.c", 12; int
+	.dbg	line,	"tests/pr32500.c", 13; main(int argc, char *argv[])
+	.dbg	line,	"tests/pr32500.c", 14; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr32500.c", 15; int i;
+
+	.dbg	line,	"tests/pr32500.c", 16; //	int numbers[4] = { 0xdead, 0xbeef, 0x1337, 0x4242 };
+
+	.dbg	line,	"tests/pr32500.c", 18; for (i = 1; i <= 12; i++) {
+	__st.wmiq	1, __main_end - 2  /* i */
+.LL5:
+	__ld.wm		__main_end - 2  /* i */
+	__sle_w.wi	12
+	__btrue		.LL7
+	__bra		.LL8
+.LL6:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL5
+.LL7:
+
+	.dbg	line,	"tests/pr32500.c", 19; if (i <= 4)
+	__ld.wm		__main_end - 2  /* i */
+	__sle_w.wi	4
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/pr32500.c", 20; foo(numbers[i]);
+	__ld2x.wmq	__main_end - 2  /* i */
+	__ld.wax	_numbers
+	__pusharg.wr
+	__ld.ws		0  /* i */
+	__st.wmq	_x
+.LL10:
+	__modsp		2
+
+	.dbg	line,	"tests/pr32500.c", 21; else if (i >= 7 && i <= 9)
+	__bra		.LL11
+.LL9:
+	__ld.wm		__main_end - 2  /* i */
+	__sge_w.wi	7
+	__bfalse	.LL13
+	__ld.wm		__main_end - 2  /* i */
+	__sle_w.wi	9
+.LL13:
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/pr32500.c", 22; bar();
+	__ld.wi		0
+	__call		_exit.1
+.LL14	.alias		.LL6
+
+	.dbg	line,	"tests/pr32500.c", 23; }
+.LL12	.alias		.LL6
+.LL11	.alias		.LL6
+	__bra		.LL6
+.LL8:
+
+	.dbg	line,	"tests/pr32500.c", 25; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/pr32500.c", 26; }
+.LL4:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+_numbers:
+		dw	0xdead
+		dw	0xbeef
+		dw	0x1337
+		dw	0x4242
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:8
+;	global pool:7
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       112     14     2  overlaid locals
+;        18      4     2  x
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 14, 112
+__main_end	=	__overlay_frames + 2
+	auto_zp_var	_x, 2, 4, 18
+	.endm
@@ -0,0 +1,143 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pr7284-1.c", 1; /* Signed left-shift is implementation-defined in C89 (and see
+	.dbg	line,	"tests/pr7284-1.c", 2; DR#081), not undefined.  Bug 7284 from Al Grant (AlGrant at
+	.dbg	line,	"tests/pr7284-1.c", 3; myrealbox.com).  */
+	.dbg	line,	"tests/pr7284-1.c", 5; /* { dg-options "-std=c89" } */
+	.dbg	line,	"tests/pr7284-1.c", 7; extern void abort (void);
+	.dbg	line,	"tests/pr7284-1.c", 8; extern void exit (int);
+	.dbg	line,	"tests/pr7284-1.c", 10; int
+	.dbg	line,	"tests/pr7284-1.c", 11; f (int n)
+	.dbg	line,	"tests/pr7284-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/pr7284-1.c", 13; return (n << 8) / (1 << 7);
+	__ld.ws		0  /* n */
+	__asl.wi	8
+	__sdiv.wi	128
+.LL2:
+
+	.dbg	line,	"tests/pr7284-1.c", 14; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pr7284-1.c", 16; volatile int x;// = 128;
+	.dbg	line,	"tests/pr7284-1.c", 18; int
+	.dbg	line,	"tests/pr7284-1.c", 19; main (void)
+	.dbg	line,	"tests/pr7284-1.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pr7284-1.c", 21; x = 128;
+	__st.wmiq	128, _x
+
+	.dbg	line,	"tests/pr7284-1.c", 22; if (f(x) != -256)
+	__ld.wm		_x
+	__pusharg.wr
+	__ld.ws		0  /* n */
+	__asl.wi	8
+	__sdiv.wi	128
+.LL5:
+	__modsp		2
+	__neq_w.wi	-256
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/pr7284-1.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pr7284-1.c", 24; exit (0);
+.LL4:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/pr7284-1.c", 25; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         4      4     2  x
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	_x, 2, 4, 4
+	.endm
@@ -0,0 +1,114 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pragma-pack-3.c", 1; /* PR c++/25294 */
+	.dbg	line,	"tests/pragma-pack-3.c", 2; /* { dg-options "-std=gnu99" } */
+	.dbg	line,	"tests/pragma-pack-3.c", 3; /* { dg-do run } */
+	.dbg	line,	"tests/pragma-pack-3.c", 5; extern void abort (void);
+	.dbg	line,	"tests/pragma-pack-3.c", 7; struct S
+	.dbg	line,	"tests/pragma-pack-3.c", 8; {
+	.dbg	line,	"tests/pragma-pack-3.c", 9; char a[3];
+	.dbg	line,	"tests/pragma-pack-3.c", 10; /*#pragma pack(1) /* A block comment
+	.dbg	line,	"tests/pragma-pack-3.c", 11; that ends on the next line.  */
+	.dbg	line,	"tests/pragma-pack-3.c", 12; struct T
+	.dbg	line,	"tests/pragma-pack-3.c", 13; {
+	.dbg	line,	"tests/pragma-pack-3.c", 14; char b;
+	.dbg	line,	"tests/pragma-pack-3.c", 15; int c;
+	.dbg	line,	"tests/pragma-pack-3.c", 16; } d;
+	.dbg	line,	"tests/pragma-pack-3.c", 17; //#pragma pack /*/ */ () // C++ comment
+	.dbg	line,	"tests/pragma-pack-3.c", 18; int e;
+	.dbg	line,	"tests/pragma-pack-3.c", 19; } s;
+	.dbg	line,	"tests/pragma-pack-3.c", 21; int
+	.dbg	line,	"tests/pragma-pack-3.c", 22; main ()
+	.dbg	line,	"tests/pragma-pack-3.c", 23; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pragma-pack-3.c", 24; if (sizeof (int) == 2 && sizeof (s) != 8)
+	__ld.wi		2
+	__equ_w.wi	2
+	__bfalse	.LL4
+	__ld.wi		8
+	__neq_w.wi	8
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/pragma-pack-3.c", 25; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/pragma-pack-3.c", 26; return 0;
+.LL3:
+	__ld.wi		0
+.LL2:
+
+	.dbg	line,	"tests/pragma-pack-3.c", 27; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
+
+	.bss
+_s:
+		ds	8
+	.code
@@ -0,0 +1,151 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/ptr-arith-1.c", 1; char *
+	.dbg	line,	"tests/ptr-arith-1.c", 2; f (char *s, unsigned int i)
+	.dbg	line,	"tests/ptr-arith-1.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/ptr-arith-1.c", 4; return &s[i + 3 - 1];
+	__ld.ws		0  /* i */
+	__add.wi	2
+	__add.ws	2  /* s */
+.LL2:
+
+	.dbg	line,	"tests/ptr-arith-1.c", 5; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/ptr-arith-1.c", 7; main ()
+	.dbg	line,	"tests/ptr-arith-1.c", 8; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/ptr-arith-1.c", 9; char *str, *x2; str = "abcdefghijkl";
+	__ld.wi		__const1+0
+	__st.wmq	__main_end - 2  /* str */
+
+	.dbg	line,	"tests/ptr-arith-1.c", 10; /*char **/x2 = f (str, 12);
+	__pusharg.wr
+	__ld.wi		12
+	__pusharg.wr
+	__ld.ws		0  /* i */
+	__add.wi	2
+	__add.ws	2  /* s */
+.LL4:
+	__modsp		4
+	__st.wmq	__main_end - 4  /* x2 */
+
+	.dbg	line,	"tests/ptr-arith-1.c", 11; if (str + 14 != x2)
+	__ld.wm		__main_end - 2  /* str */
+	__add.wi	14
+	__neq_w.wm	__main_end - 4  /* x2 */
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/ptr-arith-1.c", 12; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/ptr-arith-1.c", 13; exit (0);
+.LL5:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/ptr-arith-1.c", 14; }
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+	.rodata
+__const1:
+		db	'a','b','c','d','e','f','g','h'
+		db	'i','j','k','l',$00
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:13
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        10     10     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 10, 10
+__main_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,541 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/pure-1.c", 2; /* Origin: Kaveh Ghazi <ghazi@caip.rutgers.edu> 2002-05-27.  */
+	.dbg	line,	"tests/pure-1.c", 4; /* Use a different function for each test so the link failures
+	.dbg	line,	"tests/pure-1.c", 5; indicate which one is broken.  */
+	.dbg	line,	"tests/pure-1.c", 6; extern void link_error0 (void);
+	.dbg	line,	"tests/pure-1.c", 7; extern void link_error1 (void);
+	.dbg	line,	"tests/pure-1.c", 8; extern void link_error2 (void);
+	.dbg	line,	"tests/pure-1.c", 9; extern void link_error3 (void);
+	.dbg	line,	"tests/pure-1.c", 10; extern void link_error4 (void);
+	.dbg	line,	"tests/pure-1.c", 11; extern void link_error5 (void);
+	.dbg	line,	"tests/pure-1.c", 12; extern void link_error6 (void);
+	.dbg	line,	"tests/pure-1.c", 13; extern void link_error7 (void);
+	.dbg	line,	"tests/pure-1.c", 15; extern int i;
+	.dbg	line,	"tests/pure-1.c", 17; //extern int func0 (int) __attribute__ ((__pure__));
+	.dbg	line,	"tests/pure-1.c", 18; //extern int func1 (int) __attribute__ ((__const__));
+	.dbg	line,	"tests/pure-1.c", 20; /* GCC should automatically detect attributes for these functions.
+	.dbg	line,	"tests/pure-1.c", 21; At -O3 They'll be inlined, but that's ok.  */
+	.dbg	line,	"tests/pure-1.c", 22; static int func2 (int a) { return i + a; } /* pure */
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func2
+	__enter		_func2
+	__ld.wm		_i
+	__add.ws	0  /* a */
+.LL2:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 23; static int func3 (int a) { return a * 3; } /* const */
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func3
+	__enter		_func3
+	__ld.ws		0  /* a */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+.LL3:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 24; static int func4 (int a) { return func0(a) + a; } /* pure */
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func4
+	__enter		_func4
+	__ld.ws		0  /* a */
+	__pusharg.wr
+	__call		_func0
+	__add.ws	0  /* a */
+.LL4:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 25; static int func5 (int a) { return a + func1(a); } /* const */
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func5
+	__enter		_func5
+	__ld.ws		0  /* a */
+	__pusharg.wr
+	__call		_func1
+	__add.ws	0  /* a */
+.LL5:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 26; static int func6 (int a) { return func2(a) + a; } /* pure */
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func6
+	__enter		_func6
+	__ld.ws		0  /* a */
+	__pusharg.wr
+	__ld.wm		_i
+	__add.ws	0  /* a */
+.LL7:
+	__modsp		2
+	__add.ws	0  /* a */
+.LL6:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 27; static int func7 (int a) { return a + func3(a); } /* const */
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func7
+	__enter		_func7
+	__ld.ws		0  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+.LL9:
+	__modsp		2
+	__add.ws	0  /* a */
+.LL8:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 29; int main ()
+	.dbg	line,	"tests/pure-1.c", 30; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/pure-1.c", 31; int i[10], r;
+
+	.dbg	line,	"tests/pure-1.c", 33; i[0] = 0;
+	__st.wmiq	0, __main_end - 20  /* i */
+
+	.dbg	line,	"tests/pure-1.c", 34; r = func0(0);
+	__ld.wi		0
+	__pusharg.wr
+	__call		_func0
+
+	.dbg	line,	"tests/pure-1.c", 35; if (i[0])
+	__tst.wm	__main_end - 20  /* i */
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/pure-1.c", 36; link_error0();
+	__call		_link_error0
+
+	.dbg	line,	"tests/pure-1.c", 38; i[1] = 0;
+.LL11:
+	__st.wmiq	0, __main_end - 20 + 2  /* i */
+
+	.dbg	line,	"tests/pure-1.c", 39; r = func1(0);
+	__ld.wi		0
+	__pusharg.wr
+	__call		_func1
+
+	.dbg	line,	"tests/pure-1.c", 40; if (i[1])
+	__tst.wm	__main_end - 20 + 2  /* i */
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/pure-1.c", 41; link_error1();
+	__call		_link_error1
+
+	.dbg	line,	"tests/pure-1.c", 43; i[2] = 0;
+.LL12:
+	__st.wmiq	0, __main_end - 20 + 4  /* i */
+
+	.dbg	line,	"tests/pure-1.c", 44; r = func2(0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.wm		_i
+	__add.ws	0  /* a */
+.LL13:
+	__modsp		2
+
+	.dbg	line,	"tests/pure-1.c", 45; if (i[2])
+	__tst.wm	__main_end - 20 + 4  /* i */
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/pure-1.c", 46; link_error2();
+	__call		_link_error2
+
+	.dbg	line,	"tests/pure-1.c", 48; i[3] = 0;
+.LL14:
+	__st.wmiq	0, __main_end - 20 + 6  /* i */
+
+	.dbg	line,	"tests/pure-1.c", 49; r = func3(0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+.LL15:
+	__modsp		2
+
+	.dbg	line,	"tests/pure-1.c", 50; if (i[3])
+	__tst.wm	__main_end - 20 + 6  /* i */
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/pure-1.c", 51; link_error3();
+	__call		_link_error3
+
+	.dbg	line,	"tests/pure-1.c", 53; i[4] = 0;
+.LL16:
+	__st.wmiq	0, __main_end - 20 + 8  /* i */
+
+	.dbg	line,	"tests/pure-1.c", 54; r = func4(0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__pusharg.wr
+	__call		_func0
+	__add.ws	0  /* a */
+.LL17:
+	__modsp		2
+
+	.dbg	line,	"tests/pure-1.c", 55; if (i[4])
+	__tst.wm	__main_end - 20 + 8  /* i */
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/pure-1.c", 56; link_error4();
+	__call		_link_error4
+
+	.dbg	line,	"tests/pure-1.c", 58; i[5] = 0;
+.LL18:
+	__st.wmiq	0, __main_end - 20 + 10  /* i */
+
+	.dbg	line,	"tests/pure-1.c", 59; r = func5(0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__pusharg.wr
+	__call		_func1
+	__add.ws	0  /* a */
+.LL19:
+	__modsp		2
+
+	.dbg	line,	"tests/pure-1.c", 60; if (i[5])
+	__tst.wm	__main_end - 20 + 10  /* i */
+	__bfalse	.LL20
+
+	.dbg	line,	"tests/pure-1.c", 61; link_error5();
+	__call		_link_error5
+
+	.dbg	line,	"tests/pure-1.c", 63; i[6] = 0;
+.LL20:
+	__st.wmiq	0, __main_end - 20 + 12  /* i */
+
+	.dbg	line,	"tests/pure-1.c", 64; r = func6(0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__pusharg.wr
+	__ld.wm		_i
+	__add.ws	0  /* a */
+.LL21:
+	__modsp		2
+	__add.ws	0  /* a */
+.LL22:
+	__modsp		2
+
+	.dbg	line,	"tests/pure-1.c", 65; if (i[6])
+	__tst.wm	__main_end - 20 + 12  /* i */
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/pure-1.c", 66; link_error6();
+	__call		_link_error6
+
+	.dbg	line,	"tests/pure-1.c", 68; i[7] = 0;
+.LL23:
+	__st.wmiq	0, __main_end - 20 + 14  /* i */
+
+	.dbg	line,	"tests/pure-1.c", 69; r = func7(0);
+	__ld.wi		0
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__pusharg.wr
+	__ld.ws		0  /* a */
+	__st.wm	<multiplicand
+	__asl.wi	1
+	__add.wm	<multiplicand
+.LL24:
+	__modsp		2
+	__add.ws	0  /* a */
+.LL25:
+	__modsp		2
+	__st.wmq	__main_end - 22  /* r */
+
+	.dbg	line,	"tests/pure-1.c", 70; if (i[7])
+	__tst.wm	__main_end - 20 + 14  /* i */
+	__bfalse	.LL26
+
+	.dbg	line,	"tests/pure-1.c", 71; link_error7();
+	__call		_link_error7
+
+	.dbg	line,	"tests/pure-1.c", 73; return r;
+.LL26:
+	__ld.wm		__main_end - 22  /* r */
+.LL10:
+
+	.dbg	line,	"tests/pure-1.c", 74; }
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 76; int func0 (int a) { return a - i; } /* pure */
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func0
+	__enter		_func0
+	__ld.ws		0  /* a */
+	__sub.wm	_i
+.LL27:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 77; int func1 (int a) { return a - a; } /* const */
+;***********************
+;***********************
+
+	.hucc
+	.proc		_func1
+	__enter		_func1
+	__ld.ws		0  /* a */
+	__sub.ws	0  /* a */
+.LL28:
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 79; int i = 2;
+	.dbg	line,	"tests/pure-1.c", 81; #ifndef __OPTIMIZE__
+	.dbg	line,	"tests/pure-1.c", 82; /* Avoid link failures when not optimizing. */
+	.dbg	line,	"tests/pure-1.c", 83; void link_error0() {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_link_error0
+	__enter		_link_error0
+.LL29:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 84; void link_error1() {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_link_error1
+	__enter		_link_error1
+.LL30:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 85; void link_error2() {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_link_error2
+	__enter		_link_error2
+.LL31:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 86; void link_error3() {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_link_error3
+	__enter		_link_error3
+.LL32:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 87; void link_error4() {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_link_error4
+	__enter		_link_error4
+.LL33:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 88; void link_error5() {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_link_error5
+	__enter		_link_error5
+.LL34:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 89; void link_error6() {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_link_error6
+	__enter		_link_error6
+.LL35:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 90; void link_error7() {}
+;***********************
+;***********************
+
+	.hucc
+	.proc		_link_error7
+	__enter		_link_error7
+.LL36:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/pure-1.c", 91; #endif /* ! __OPTIMIZE__ */
+	.dbg	clear
+
+	.xdata
+_i:
+		ds	2
+
+	.xinit
+
+		dw	2
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:18
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0    22  _main
+;
+; 22 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        50     50    22  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 22, 50, 50
+__main_end	=	__overlay_frames + 22
+	.endm
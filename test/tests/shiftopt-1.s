@@ -0,0 +1,294 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/shiftopt-1.c", 1; /* Copyright (C) 2002  Free Software Foundation
+	.dbg	line,	"tests/shiftopt-1.c", 3; Check that constant folding of shift operations is working.
+	.dbg	line,	"tests/shiftopt-1.c", 5; Roger Sayle, 10th October 2002.  */
+	.dbg	line,	"tests/shiftopt-1.c", 7; extern void abort (void);
+	.dbg	line,	"tests/shiftopt-1.c", 8; extern void link_error (void);
+	.dbg	line,	"tests/shiftopt-1.c", 10; void
+	.dbg	line,	"tests/shiftopt-1.c", 11; utest (unsigned int x)
+	.dbg	line,	"tests/shiftopt-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_utest
+	__enter		_utest
+
+	.dbg	line,	"tests/shiftopt-1.c", 13; if (x >> 0 != x)
+	__ld.ws		0  /* x */
+	__neq_w.ws	0  /* x */
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/shiftopt-1.c", 14; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 16; if (x << 0 != x)
+.LL3:
+	__ld.ws		0  /* x */
+	__neq_w.ws	0  /* x */
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/shiftopt-1.c", 17; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 19; if (0 << x != 0)
+.LL4:
+	__ld.wi		0
+	__push.wr
+	__ld.ws		0  /* x */
+	__asl.wt
+	__tst.wr
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/shiftopt-1.c", 20; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 22; if (0 >> x != 0)
+.LL5:
+	__ld.wi		0
+	__push.wr
+	__ld.ws		0  /* x */
+	__asr.wt
+	__tst.wr
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/shiftopt-1.c", 23; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 25; if (-1 >> x != -1)
+.LL6:
+	__ld.wi		-1
+	__push.wr
+	__ld.ws		0  /* x */
+	__asr.wt
+	__neq_w.wi	-1
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/shiftopt-1.c", 26; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 28; if (~0 >> x != ~0)
+.LL7:
+	__ld.wi		-1
+	__push.wr
+	__ld.ws		0  /* x */
+	__asr.wt
+	__neq_w.wi	-1
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/shiftopt-1.c", 29; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 30; }
+.LL8:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/shiftopt-1.c", 32; void
+	.dbg	line,	"tests/shiftopt-1.c", 33; stest (int x)
+	.dbg	line,	"tests/shiftopt-1.c", 34; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_stest
+	__enter		_stest
+
+	.dbg	line,	"tests/shiftopt-1.c", 35; if (x >> 0 != x)
+	__ld.ws		0  /* x */
+	__neq_w.ws	0  /* x */
+	__bfalse	.LL10
+
+	.dbg	line,	"tests/shiftopt-1.c", 36; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 38; if (x << 0 != x)
+.LL10:
+	__ld.ws		0  /* x */
+	__neq_w.ws	0  /* x */
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/shiftopt-1.c", 39; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 41; if (0 << x != 0)
+.LL11:
+	__ld.wi		0
+	__push.wr
+	__ld.ws		0  /* x */
+	__asl.wt
+	__tst.wr
+	__bfalse	.LL12
+
+	.dbg	line,	"tests/shiftopt-1.c", 42; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 44; if (0 >> x != 0)
+.LL12:
+	__ld.wi		0
+	__push.wr
+	__ld.ws		0  /* x */
+	__asr.wt
+	__tst.wr
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/shiftopt-1.c", 45; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 47; if (-1 >> x != -1)
+.LL13:
+	__ld.wi		-1
+	__push.wr
+	__ld.ws		0  /* x */
+	__asr.wt
+	__neq_w.wi	-1
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/shiftopt-1.c", 48; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 50; if (~0 >> x != ~0)
+.LL14:
+	__ld.wi		-1
+	__push.wr
+	__ld.ws		0  /* x */
+	__asr.wt
+	__neq_w.wi	-1
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/shiftopt-1.c", 51; link_error ();
+	__call		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 52; }
+.LL15:
+.LL9:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/shiftopt-1.c", 54; int
+	.dbg	line,	"tests/shiftopt-1.c", 55; main ()
+	.dbg	line,	"tests/shiftopt-1.c", 56; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/shiftopt-1.c", 57; utest(9);
+	__ld.wi		9
+	__pusharg.wr
+	__call		_utest
+
+	.dbg	line,	"tests/shiftopt-1.c", 58; utest(0);
+	__ld.wi		0
+	__pusharg.wr
+	__call		_utest
+
+	.dbg	line,	"tests/shiftopt-1.c", 60; stest(9);
+	__ld.wi		9
+	__pusharg.wr
+	__call		_stest
+
+	.dbg	line,	"tests/shiftopt-1.c", 61; stest(0);
+	__ld.wi		0
+	__pusharg.wr
+	__call		_stest
+
+	.dbg	line,	"tests/shiftopt-1.c", 63; return 0;
+	__ld.wi		0
+.LL16:
+
+	.dbg	line,	"tests/shiftopt-1.c", 64; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/shiftopt-1.c", 66; #ifndef __OPTIMIZE__
+	.dbg	line,	"tests/shiftopt-1.c", 67; void
+	.dbg	line,	"tests/shiftopt-1.c", 68; link_error ()
+	.dbg	line,	"tests/shiftopt-1.c", 69; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_link_error
+	__enter		_link_error
+
+	.dbg	line,	"tests/shiftopt-1.c", 70; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/shiftopt-1.c", 71; }
+.LL17:
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/shiftopt-1.c", 72; #endif
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
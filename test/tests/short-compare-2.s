@@ -0,0 +1,124 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/short-compare-2.c", 1; /* PR rtl-optimization/19296 */
+	.dbg	line,	"tests/short-compare-2.c", 2; /* Origin: Falk Hueffner <falk@debian.org> */
+	.dbg	line,	"tests/short-compare-2.c", 3; /* Testcase by Andrew Pinski <pinskia@gcc.gnu.org> */
+	.dbg	line,	"tests/short-compare-2.c", 5; /* { dg-do run } */
+	.dbg	line,	"tests/short-compare-2.c", 6; /* { dg-options "-O" } */
+	.dbg	line,	"tests/short-compare-2.c", 7; /* { dg-options "-O -mtune=i686" { target { { i?86-*-* x86_64-*-* } && ilp32 } } } */
+	.dbg	line,	"tests/short-compare-2.c", 9; extern void abort();
+	.dbg	line,	"tests/short-compare-2.c", 11; void f(unsigned short ad)
+	.dbg	line,	"tests/short-compare-2.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/short-compare-2.c", 13; if ((short) (ad - 0x4000) >= 0)
+	__ld.ws		0  /* ad */
+	__sub.wi	16384
+	__sge_w.wi	0
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/short-compare-2.c", 14; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/short-compare-2.c", 15; }
+.LL3:
+.LL2:
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/short-compare-2.c", 17; int main(void)
+	.dbg	line,	"tests/short-compare-2.c", 18; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/short-compare-2.c", 19; f(0xc000);
+	__ld.wi		49152
+	__pusharg.wr
+	__ld.ws		0  /* ad */
+	__sub.wi	16384
+	__sge_w.wi	0
+	__bfalse	.LL5
+	__call		_abort
+.LL5:
+.LL6:
+	__modsp		2
+
+	.dbg	line,	"tests/short-compare-2.c", 20; return 0;
+	__ld.wi		0
+.LL4:
+
+	.dbg	line,	"tests/short-compare-2.c", 21; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
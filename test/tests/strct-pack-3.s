@@ -0,0 +1,197 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/strct-pack-3.c", 1; /*typedef*/ struct At
+	.dbg	line,	"tests/strct-pack-3.c", 2; {
+	.dbg	line,	"tests/strct-pack-3.c", 3; short i;// __attribute__ ((aligned (2),packed));
+	.dbg	line,	"tests/strct-pack-3.c", 4; int f[2];// __attribute__ ((aligned (2),packed));
+	.dbg	line,	"tests/strct-pack-3.c", 5; };// A;
+	.dbg	line,	"tests/strct-pack-3.c", 7; f (ap)
+	.dbg	line,	"tests/strct-pack-3.c", 8; struct At *ap;
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/strct-pack-3.c", 9; {
+
+	.dbg	line,	"tests/strct-pack-3.c", 10; short i, j = 1;
+	__st.wmiq	1, __f_end - 4  /* j */
+
+	.dbg	line,	"tests/strct-pack-3.c", 12; i = ap->f[1];
+	__ld.ws		0  /* ap */
+	__add.wi	4
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wmq	__f_end - 2  /* i */
+
+	.dbg	line,	"tests/strct-pack-3.c", 13; i += ap->f[j];
+	__ld.ws		0  /* ap */
+	__add.wi	2
+	__push.wr
+	__ld.wm		__f_end - 4  /* j */
+	__asl.wr
+	__add.wt
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add_st.wmq	__f_end - 2  /* i */
+
+	.dbg	line,	"tests/strct-pack-3.c", 14; for (j = 0; j < 2; j++)
+	__st.wmiq	0, __f_end - 4  /* j */
+.LL3:
+	__ld.wm		__f_end - 4  /* j */
+	__slt_w.wi	2
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__f_end - 4  /* j */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/strct-pack-3.c", 15; i += ap->f[j];
+	__ld.ws		0  /* ap */
+	__add.wi	2
+	__push.wr
+	__ld.wm		__f_end - 4  /* j */
+	__asl.wr
+	__add.wt
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__add_st.wmq	__f_end - 2  /* i */
+	__bra		.LL4
+.LL6:
+
+	.dbg	line,	"tests/strct-pack-3.c", 17; return i;
+	__ld.wm		__f_end - 2  /* i */
+.LL2:
+
+	.dbg	line,	"tests/strct-pack-3.c", 18; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__f_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/strct-pack-3.c", 20; main ()
+	.dbg	line,	"tests/strct-pack-3.c", 21; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/strct-pack-3.c", 22; struct At a;
+
+	.dbg	line,	"tests/strct-pack-3.c", 23; a.f[0] = 100;
+	__st.wmiq	100, __main_end - 6 + 2  /* a */
+
+	.dbg	line,	"tests/strct-pack-3.c", 24; a.f[1] = 13;
+	__st.wmiq	13, __main_end - 6 + 2 + 2  /* a */
+
+	.dbg	line,	"tests/strct-pack-3.c", 25; if (f (&a) != 139)
+	__ld.wi		__main_end - 6  /* a */
+	__pusharg.wr
+	__call		_f
+	__neq_w.wi	139
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/strct-pack-3.c", 26; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/strct-pack-3.c", 27; exit (0);
+.LL8:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/strct-pack-3.c", 28; }
+.LL7:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     6  _main
+;
+; 6 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     6  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 6, 6, 6
+__main_end	=	__overlay_frames + 6
+	.endm
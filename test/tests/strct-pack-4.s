@@ -0,0 +1,171 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/strct-pack-4.c", 1; /*typedef*/ struct three_char_s
+	.dbg	line,	"tests/strct-pack-4.c", 2; {
+	.dbg	line,	"tests/strct-pack-4.c", 3; unsigned char a;// __attribute__((packed));
+	.dbg	line,	"tests/strct-pack-4.c", 4; unsigned short b;// __attribute__((packed));
+	.dbg	line,	"tests/strct-pack-4.c", 5; };// three_char_t;
+	.dbg	line,	"tests/strct-pack-4.c", 7; unsigned char
+	.dbg	line,	"tests/strct-pack-4.c", 8; my_set_a (void)
+	.dbg	line,	"tests/strct-pack-4.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_my_set_a
+	__enter		_my_set_a
+
+	.dbg	line,	"tests/strct-pack-4.c", 10; return 0xab;
+	__ld.wi		171
+.LL2:
+
+	.dbg	line,	"tests/strct-pack-4.c", 11; }
+	__ext.ur
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/strct-pack-4.c", 13; unsigned short
+	.dbg	line,	"tests/strct-pack-4.c", 14; my_set_b (void)
+	.dbg	line,	"tests/strct-pack-4.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_my_set_b
+	__enter		_my_set_b
+
+	.dbg	line,	"tests/strct-pack-4.c", 16; return 0x1234;
+	__ld.wi		4660
+.LL3:
+
+	.dbg	line,	"tests/strct-pack-4.c", 17; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/strct-pack-4.c", 19; main ()
+	.dbg	line,	"tests/strct-pack-4.c", 20; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/strct-pack-4.c", 21; struct three_char_s three_char;
+
+	.dbg	line,	"tests/strct-pack-4.c", 23; three_char.a = my_set_a ();
+	__ld.wi		171
+.LL5:
+	__ext.ur
+	__st.umq	__main_end - 3  /* three_char */
+
+	.dbg	line,	"tests/strct-pack-4.c", 24; three_char.b = my_set_b ();
+	__ld.wi		4660
+.LL6:
+	__st.wmq	__main_end - 3 + 1  /* three_char */
+
+	.dbg	line,	"tests/strct-pack-4.c", 25; if (three_char.a != 0xab || three_char.b != 0x1234)
+	__ld.umq	__main_end - 3  /* three_char */
+	__neq_b.uiq	171
+	__btrue		.LL8
+	__ld.wm		__main_end - 3 + 1  /* three_char */
+	__neq_w.wi	4660
+.LL8:
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/strct-pack-4.c", 26; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/strct-pack-4.c", 27; exit (0);
+.LL7:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/strct-pack-4.c", 28; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     3  _main
+;
+; 3 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     3  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 3, 8, 8
+__main_end	=	__overlay_frames + 3
+	.endm
@@ -0,0 +1,276 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/switch-1.c", 1; /* Copyright (C) 2003  Free Software Foundation.
+	.dbg	line,	"tests/switch-1.c", 3; Test that switch statements suitable using case bit tests are
+	.dbg	line,	"tests/switch-1.c", 4; implemented correctly.
+	.dbg	line,	"tests/switch-1.c", 6; Written by Roger Sayle, 01/25/2001.  */
+	.dbg	line,	"tests/switch-1.c", 8; extern void abort (void);
+	.dbg	line,	"tests/switch-1.c", 10; int
+	.dbg	line,	"tests/switch-1.c", 11; foo (int x)
+	.dbg	line,	"tests/switch-1.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/switch-1.c", 13; switch (x)
+	__ld.ws		0  /* x */
+	__bra		.LL3
+
+	.dbg	line,	"tests/switch-1.c", 14; {
+
+	.dbg	line,	"tests/switch-1.c", 15; case 4:
+.LL5:
+.LL6:
+
+	.dbg	line,	"tests/switch-1.c", 16; case 6:
+.LL7:
+
+	.dbg	line,	"tests/switch-1.c", 17; case 9:
+.LL8:
+
+	.dbg	line,	"tests/switch-1.c", 18; case 11:
+	__case		11
+
+	.dbg	line,	"tests/switch-1.c", 19; return 30;
+	__ld.wi		30
+	__bra		.LL2
+
+	.dbg	line,	"tests/switch-1.c", 20; }
+.LL3:
+	__switch_r.wr	4, 11
+
+!table:		dw	.LL5, .LL4, .LL6, .LL4, .LL4, .LL7, .LL4, .LL8
+		dw	.LL4
+.LL4:
+
+	.dbg	line,	"tests/switch-1.c", 21; return 31;
+	__ld.wi		31
+.LL2:
+
+	.dbg	line,	"tests/switch-1.c", 22; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/switch-1.c", 24; int
+	.dbg	line,	"tests/switch-1.c", 25; main (int argc)
+	.dbg	line,	"tests/switch-1.c", 26; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/switch-1.c", 27; int i, r;
+
+	.dbg	line,	"tests/switch-1.c", 29; for (i=-1; i<66; i++)
+	__st.wmiq	-1, __main_end - 2  /* i */
+.LL10:
+	__ld.wm		__main_end - 2  /* i */
+	__slt_w.wi	66
+	__btrue		.LL12
+	__bra		.LL13
+.LL11:
+	__inc.wmq	__main_end - 2  /* i */
+	__bra		.LL10
+.LL12:
+
+	.dbg	line,	"tests/switch-1.c", 30; {
+
+	.dbg	line,	"tests/switch-1.c", 31; r = foo (i);
+	__ld.wm		__main_end - 2  /* i */
+	__pusharg.wr
+	__call		_foo
+	__st.wmq	__main_end - 4  /* r */
+
+	.dbg	line,	"tests/switch-1.c", 32; if (i == 4)
+	__ld.wm		__main_end - 2  /* i */
+	__equ_w.wi	4
+	__bfalse	.LL14
+
+	.dbg	line,	"tests/switch-1.c", 33; {
+
+	.dbg	line,	"tests/switch-1.c", 34; if (r != 30)
+	__ld.wm		__main_end - 4  /* r */
+	__neq_w.wi	30
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/switch-1.c", 35; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/switch-1.c", 36; }
+.LL15	.alias		.LL16
+
+	.dbg	line,	"tests/switch-1.c", 37; else if (i == 6)
+	__bra		.LL16
+.LL14:
+	__ld.wm		__main_end - 2  /* i */
+	__equ_w.wi	6
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/switch-1.c", 38; {
+
+	.dbg	line,	"tests/switch-1.c", 39; if (r != 30)
+	__ld.wm		__main_end - 4  /* r */
+	__neq_w.wi	30
+	__bfalse	.LL18
+
+	.dbg	line,	"tests/switch-1.c", 40; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/switch-1.c", 41; }
+.LL18	.alias		.LL19
+
+	.dbg	line,	"tests/switch-1.c", 42; else if (i == 9)
+	__bra		.LL19
+.LL17:
+	__ld.wm		__main_end - 2  /* i */
+	__equ_w.wi	9
+	__bfalse	.LL20
+
+	.dbg	line,	"tests/switch-1.c", 43; {
+
+	.dbg	line,	"tests/switch-1.c", 44; if (r != 30)
+	__ld.wm		__main_end - 4  /* r */
+	__neq_w.wi	30
+	__bfalse	.LL21
+
+	.dbg	line,	"tests/switch-1.c", 45; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/switch-1.c", 46; }
+.LL21	.alias		.LL22
+
+	.dbg	line,	"tests/switch-1.c", 47; else if (i == 11)
+	__bra		.LL22
+.LL20:
+	__ld.wm		__main_end - 2  /* i */
+	__equ_w.wi	11
+	__bfalse	.LL23
+
+	.dbg	line,	"tests/switch-1.c", 48; {
+
+	.dbg	line,	"tests/switch-1.c", 49; if (r != 30)
+	__ld.wm		__main_end - 4  /* r */
+	__neq_w.wi	30
+	__bfalse	.LL24
+
+	.dbg	line,	"tests/switch-1.c", 50; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/switch-1.c", 51; }
+.LL24	.alias		.LL25
+
+	.dbg	line,	"tests/switch-1.c", 52; else if (r != 31)
+	__bra		.LL25
+.LL23:
+	__ld.wm		__main_end - 4  /* r */
+	__neq_w.wi	31
+	__bfalse	.LL26
+
+	.dbg	line,	"tests/switch-1.c", 53; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/switch-1.c", 54; }
+.LL26	.alias		.LL11
+.LL25	.alias		.LL11
+.LL22	.alias		.LL11
+.LL19	.alias		.LL11
+.LL16	.alias		.LL11
+	__bra		.LL11
+.LL13:
+
+	.dbg	line,	"tests/switch-1.c", 55; return 0;
+	__ld.wi		0
+.LL9:
+
+	.dbg	line,	"tests/switch-1.c", 56; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     4  _main
+;
+; 4 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;       224     28     4  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 4, 28, 224
+__main_end	=	__overlay_frames + 4
+	.endm
@@ -0,0 +1,174 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/unaligned-1.c", 1; /* PR middle-end/7847 */
+	.dbg	line,	"tests/unaligned-1.c", 2; /* Originator: <jk@tools.de> */
+	.dbg	line,	"tests/unaligned-1.c", 3; /* { dg-do run } */
+	.dbg	line,	"tests/unaligned-1.c", 5; /* This used to fail on SPARC at runtime because of
+	.dbg	line,	"tests/unaligned-1.c", 6; an unaligned memory access.  */
+	.dbg	line,	"tests/unaligned-1.c", 8; typedef char int8_t;
+	.dbg	line,	"tests/unaligned-1.c", 9; typedef short int16_t;
+	.dbg	line,	"tests/unaligned-1.c", 10; typedef int int32_t;
+	.dbg	line,	"tests/unaligned-1.c", 11; typedef unsigned char uint8_t;
+	.dbg	line,	"tests/unaligned-1.c", 12; typedef unsigned short uint16_t;
+	.dbg	line,	"tests/unaligned-1.c", 13; typedef unsigned int uint32_t;
+	.dbg	line,	"tests/unaligned-1.c", 15; typedef struct {
+	.dbg	line,	"tests/unaligned-1.c", 16; uint32_t address;
+	.dbg	line,	"tests/unaligned-1.c", 17; uint16_t size;
+	.dbg	line,	"tests/unaligned-1.c", 18; } /*__attribute__ ((packed))*/ sml_agl_data_t;
+	.dbg	line,	"tests/unaligned-1.c", 20; typedef struct {
+	.dbg	line,	"tests/unaligned-1.c", 21; sml_agl_data_t data[9];
+	.dbg	line,	"tests/unaligned-1.c", 22; } /*__attribute__ ((packed))*/ sml_agli_t;
+	.dbg	line,	"tests/unaligned-1.c", 24; typedef struct {
+	.dbg	line,	"tests/unaligned-1.c", 25; sml_agli_t sml_agli;
+	.dbg	line,	"tests/unaligned-1.c", 26; } /*__attribute__ ((packed))*/ dsi_t;
+	.dbg	line,	"tests/unaligned-1.c", 28; typedef struct {
+	.dbg	line,	"tests/unaligned-1.c", 29; int a;
+	.dbg	line,	"tests/unaligned-1.c", 30; dsi_t dsi_pack;
+	.dbg	line,	"tests/unaligned-1.c", 31; } dvd_priv_t;
+	.dbg	line,	"tests/unaligned-1.c", 33; int dvd_read_sector(dvd_priv_t *d, unsigned char* data)
+	.dbg	line,	"tests/unaligned-1.c", 34; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_dvd_read_sector
+	__enter		_dvd_read_sector
+
+	.dbg	line,	"tests/unaligned-1.c", 35; int i, skip=0;
+	__st.wmiq	0, __dvd_read_sector_end - 4  /* skip */
+
+	.dbg	line,	"tests/unaligned-1.c", 37; for (i=0; i < 9; i++)
+	__st.wmiq	0, __dvd_read_sector_end - 2  /* i */
+.LL3:
+	__ld.wm		__dvd_read_sector_end - 2  /* i */
+	__slt_w.wi	9
+	__btrue		.LL5
+	__bra		.LL6
+.LL4:
+	__inc.wmq	__dvd_read_sector_end - 2  /* i */
+	__bra		.LL3
+.LL5:
+
+	.dbg	line,	"tests/unaligned-1.c", 38; if ((skip=d->dsi_pack.sml_agli.data[i].address) != 0)
+	__ld.ws		2  /* d */
+	__add.wi	2
+	__push.wr
+	__ld.wm		__dvd_read_sector_end - 2  /* i */
+	__asl.wi	2
+	__add.wt
+	__st.wm		__ptr
+	__ld.wp		__ptr
+	__st.wm		__dvd_read_sector_end - 4  /* skip */
+	__tst.wr
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/unaligned-1.c", 39; break;
+	__bra		.LL6
+
+	.dbg	line,	"tests/unaligned-1.c", 41; return skip;
+.LL7	.alias		.LL4
+.LL6:
+	__ld.wm		__dvd_read_sector_end - 4  /* skip */
+.LL2:
+
+	.dbg	line,	"tests/unaligned-1.c", 42; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+__dvd_read_sector_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/unaligned-1.c", 44; int main(void)
+	.dbg	line,	"tests/unaligned-1.c", 45; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/unaligned-1.c", 46; static dvd_priv_t dvd_priv;
+
+	.dbg	line,	"tests/unaligned-1.c", 47; dvd_read_sector(&dvd_priv, 0);
+	__ld.wi		SL9  /* dvd_priv */
+	__pusharg.wr
+	__ld.wi		0
+	__pusharg.wr
+	__call		_dvd_read_sector
+
+	.dbg	line,	"tests/unaligned-1.c", 48; return 0;
+	__ld.wi		0
+.LL8:
+
+	.dbg	line,	"tests/unaligned-1.c", 49; }
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+SL9:
+		ds	38
+
+	.code
+	.if		leaf_needs < 6
+leaf_needs	.set	6
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:3
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,203 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/unroll-1.c", 1; /*inline*/ int
+	.dbg	line,	"tests/unroll-1.c", 2; f (int x)
+	.dbg	line,	"tests/unroll-1.c", 3; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/unroll-1.c", 4; return (x + 1);
+	__ld.ws		0  /* x */
+	__add.wi	1
+.LL2:
+
+	.dbg	line,	"tests/unroll-1.c", 5; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/unroll-1.c", 6; 
+	.dbg	line,	"tests/unroll-1.c", 7; int
+	.dbg	line,	"tests/unroll-1.c", 8; main (void)
+	.dbg	line,	"tests/unroll-1.c", 9; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/unroll-1.c", 10; int a = 0 ;
+	__st.wmiq	0, __main_end - 2  /* a */
+
+	.dbg	line,	"tests/unroll-1.c", 11; 
+
+	.dbg	line,	"tests/unroll-1.c", 12; while ( (f(f(f(f(f(f(f(f(f(f(1))))))))))) + a < 12 )
+.LL4:
+	__ld.wi		1
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	1
+.LL6:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	1
+.LL7:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	1
+.LL8:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	1
+.LL9:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	1
+.LL10:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	1
+.LL11:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	1
+.LL12:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	1
+.LL13:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	1
+.LL14:
+	__modsp		2
+	__pusharg.wr
+	__ld.ws		0  /* x */
+	__add.wi	1
+.LL15:
+	__modsp		2
+	__add.wm	__main_end - 2  /* a */
+	__slt_w.wi	12
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/unroll-1.c", 13; {
+
+	.dbg	line,	"tests/unroll-1.c", 14; a++;
+	__inc.wmq	__main_end - 2  /* a */
+
+	.dbg	line,	"tests/unroll-1.c", 15; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/unroll-1.c", 16; }
+	__bra		.LL4
+.LL5:
+
+	.dbg	line,	"tests/unroll-1.c", 17; if (a != 1)
+	__ld.wm		__main_end - 2  /* a */
+	__neq_w.wi	1
+	__bfalse	.LL16
+
+	.dbg	line,	"tests/unroll-1.c", 18; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/unroll-1.c", 19; }
+.LL16:
+.LL3:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;        36      8     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 8, 36
+__main_end	=	__overlay_frames + 2
+	.endm
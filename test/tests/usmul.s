@@ -0,0 +1,269 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:11 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/usmul.c", 1; int /*__attribute__ ((noinline))*/ foo (short x, unsigned short y)
+	.dbg	line,	"tests/usmul.c", 2; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_foo
+	__enter		_foo
+
+	.dbg	line,	"tests/usmul.c", 3; return x * y;
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* y */
+	__mul.wt
+.LL2:
+
+	.dbg	line,	"tests/usmul.c", 4; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/usmul.c", 6; int /*__attribute__ ((noinline))*/ bar (unsigned short x, short y)
+	.dbg	line,	"tests/usmul.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_bar
+	__enter		_bar
+
+	.dbg	line,	"tests/usmul.c", 8; return x * y;
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* y */
+	__mul.wt
+.LL3:
+
+	.dbg	line,	"tests/usmul.c", 9; }
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/usmul.c", 11; int main ()
+	.dbg	line,	"tests/usmul.c", 12; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/usmul.c", 13; if (foo (-2, 0xffff) != -131070)
+	__ld.wi		-2
+	__pusharg.wr
+	__ld.wi		65535
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* y */
+	__mul.wt
+.LL6:
+	__modsp		4
+	__neq_w.wi	-131070
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/usmul.c", 14; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/usmul.c", 15; if (foo (2, 0xffff) != 131070)
+.LL5:
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		65535
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* y */
+	__mul.wt
+.LL8:
+	__modsp		4
+	__neq_w.wi	131070
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/usmul.c", 16; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/usmul.c", 17; if (foo (-32768, 0x8000) != -1073741824)
+.LL7:
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.wi		32768
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* y */
+	__mul.wt
+.LL10:
+	__modsp		4
+	__neq_w.wi	-1073741824
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/usmul.c", 18; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/usmul.c", 19; if (foo (32767, 0x8000) != 1073709056)
+.LL9:
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.wi		32768
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* y */
+	__mul.wt
+.LL12:
+	__modsp		4
+	__neq_w.wi	1073709056
+	__bfalse	.LL11
+
+	.dbg	line,	"tests/usmul.c", 20; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/usmul.c", 22; if (bar (0xffff, -2) != -131070)
+.LL11:
+	__ld.wi		65535
+	__pusharg.wr
+	__ld.wi		-2
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* y */
+	__mul.wt
+.LL14:
+	__modsp		4
+	__neq_w.wi	-131070
+	__bfalse	.LL13
+
+	.dbg	line,	"tests/usmul.c", 23; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/usmul.c", 24; if (bar (0xffff, 2) != 131070)
+.LL13:
+	__ld.wi		65535
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* y */
+	__mul.wt
+.LL16:
+	__modsp		4
+	__neq_w.wi	131070
+	__bfalse	.LL15
+
+	.dbg	line,	"tests/usmul.c", 25; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/usmul.c", 26; if (bar (0x8000, -32768) != -1073741824)
+.LL15:
+	__ld.wi		32768
+	__pusharg.wr
+	__ld.wi		-32768
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* y */
+	__mul.wt
+.LL18:
+	__modsp		4
+	__neq_w.wi	-1073741824
+	__bfalse	.LL17
+
+	.dbg	line,	"tests/usmul.c", 27; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/usmul.c", 28; if (bar (0x8000, 32767) != 1073709056)
+.LL17:
+	__ld.wi		32768
+	__pusharg.wr
+	__ld.wi		32767
+	__pusharg.wr
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* y */
+	__mul.wt
+.LL20:
+	__modsp		4
+	__neq_w.wi	1073709056
+	__bfalse	.LL19
+
+	.dbg	line,	"tests/usmul.c", 29; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/usmul.c", 31; exit (0);
+.LL19:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/usmul.c", 32; }
+.LL4:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
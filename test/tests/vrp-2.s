@@ -0,0 +1,145 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/vrp-2.c", 1; extern void abort ();
+	.dbg	line,	"tests/vrp-2.c", 2; extern void exit (int);
+	.dbg	line,	"tests/vrp-2.c", 4; int f (int a) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_f
+	__enter		_f
+
+	.dbg	line,	"tests/vrp-2.c", 5; if (a != 2) {
+	__ld.ws		0  /* a */
+	__neq_w.wi	2
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/vrp-2.c", 6; a = a > 0 ? a : -a;
+	__ld.ws		0  /* a */
+	__sgt_w.wi	0
+	__bfalse	.LL4
+	__ld.ws		0  /* a */
+	__bra		.LL5
+.LL4:
+	__ld.ws		0  /* a */
+	__neg.wr
+.LL5:
+	__st.wsq	0  /* a */
+
+	.dbg	line,	"tests/vrp-2.c", 7; if (a == 2)
+	__ld.ws		0  /* a */
+	__equ_w.wi	2
+	__bfalse	.LL6
+
+	.dbg	line,	"tests/vrp-2.c", 8; return 0;
+	__ld.wi		0
+	__bra		.LL2
+
+	.dbg	line,	"tests/vrp-2.c", 9; return 1;
+.LL6:
+	__ld.wi		1
+	__bra		.LL2
+
+	.dbg	line,	"tests/vrp-2.c", 10; }
+
+	.dbg	line,	"tests/vrp-2.c", 11; return 1;
+.LL3:
+	__ld.wi		1
+.LL2:
+
+	.dbg	line,	"tests/vrp-2.c", 12; }
+	__modsp		2
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/vrp-2.c", 14; int main (int argc, char *argv[]) {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/vrp-2.c", 15; if (f (-2))
+	__ld.wi		-2
+	__pusharg.wr
+	__call		_f
+	__tst.wr
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/vrp-2.c", 16; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/vrp-2.c", 17; exit (0);
+.LL8:
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/vrp-2.c", 18; }
+.LL7:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
@@ -0,0 +1,140 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/vrp-4.c", 1; extern void exit (int);
+	.dbg	line,	"tests/vrp-4.c", 2; extern void abort ();
+	.dbg	line,	"tests/vrp-4.c", 4; void test(int x, int y)
+	.dbg	line,	"tests/vrp-4.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/vrp-4.c", 6; int c;
+
+	.dbg	line,	"tests/vrp-4.c", 8; if (x == 1) abort();
+	__ld.ws		2  /* x */
+	__equ_w.wi	1
+	__bfalse	.LL3
+	__call		_abort
+
+	.dbg	line,	"tests/vrp-4.c", 9; if (y == 1) abort();
+.LL3:
+	__ld.ws		0  /* y */
+	__equ_w.wi	1
+	__bfalse	.LL4
+	__call		_abort
+
+	.dbg	line,	"tests/vrp-4.c", 11; c = x / y;
+.LL4:
+	__ld.ws		2  /* x */
+	__push.wr
+	__ld.ws		0  /* y */
+	__sdiv.wt
+	__st.wmq	__test_end - 2  /* c */
+
+	.dbg	line,	"tests/vrp-4.c", 13; if (c != 1) abort();
+	__neq_w.wi	1
+	__bfalse	.LL5
+	__call		_abort
+
+	.dbg	line,	"tests/vrp-4.c", 14; }
+.LL5:
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.bss
+__test_end	.alias	leaf_stack
+	.code
+	.pceas
+
+	.dbg	line,	"tests/vrp-4.c", 16; int main()
+	.dbg	line,	"tests/vrp-4.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/vrp-4.c", 18; test(2, 2);
+	__ld.wi		2
+	__pusharg.wr
+	__ld.wi		2
+	__pusharg.wr
+	__call		_test
+
+	.dbg	line,	"tests/vrp-4.c", 19; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/vrp-4.c", 20; }
+.LL6:
+	__return	1
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+	.if		leaf_needs < 2
+leaf_needs	.set	2
+	.endif
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;
+; 0 bytes overlaid, 0 bytes saved
+;***********************
+	.bss
+	.code
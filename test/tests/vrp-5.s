@@ -0,0 +1,174 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/vrp-5.c", 1; extern void exit (int);
+	.dbg	line,	"tests/vrp-5.c", 2; extern void abort ();
+	.dbg	line,	"tests/vrp-5.c", 4; void test(unsigned int a, unsigned int b)
+	.dbg	line,	"tests/vrp-5.c", 5; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test
+	__enter		_test
+
+	.dbg	line,	"tests/vrp-5.c", 6; if (a < 5)
+	__ld.ws		2  /* a */
+	__ult_w.wi	5
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/vrp-5.c", 7; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/vrp-5.c", 8; if (b < 5)
+.LL3:
+	__ld.ws		0  /* b */
+	__ult_w.wi	5
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/vrp-5.c", 9; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/vrp-5.c", 10; if (a + b != 0/*U*/)
+.LL4:
+	__ld.ws		2  /* a */
+	__add.ws	0  /* b */
+	__tst.wr
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/vrp-5.c", 11; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/vrp-5.c", 12; }
+.LL5:
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/vrp-5.c", 14; int main(int argc, char *argv[])
+	.dbg	line,	"tests/vrp-5.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/vrp-5.c", 16; unsigned int x = 0x8000;
+	__st.wmiq	32768, __main_end - 2  /* x */
+
+	.dbg	line,	"tests/vrp-5.c", 17; test(x, x);
+	__ld.wm		__main_end - 2  /* x */
+	__pusharg.wr
+	__ld.wm		__main_end - 2  /* x */
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__ult_w.wi	5
+	__bfalse	.LL7
+	__call		_abort
+.LL7:
+	__ld.ws		0  /* b */
+	__ult_w.wi	5
+	__bfalse	.LL8
+	__call		_abort
+.LL8:
+	__ld.ws		2  /* a */
+	__add.ws	0  /* b */
+	__tst.wr
+	__bfalse	.LL9
+	__call		_abort
+.LL9:
+.LL10:
+	__modsp		4
+
+	.dbg	line,	"tests/vrp-5.c", 18; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/vrp-5.c", 19; }
+.LL6:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:4
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 6
+__main_end	=	__overlay_frames + 2
+	.endm
@@ -0,0 +1,243 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/vrp-6.c", 1; #include <limits.h>
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 1; #define INT_MAX 32767
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 2; #define INT_MIN -32768
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 3; #define UINT_MAX 65535
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 4; #define __CHAR_BIT__ 8
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 5; #define UCHAR_MAX 255
+	.dbg	line,	"/root/repo/test/../include/hucc/limits.h", 6; #define SCHAR_MAX 127
+	.dbg	line,	"tests/vrp-6.c", 3; extern void exit (int);
+	.dbg	line,	"tests/vrp-6.c", 4; extern void abort ();
+	.dbg	line,	"tests/vrp-6.c", 6; void test01(unsigned int a, unsigned int b)
+	.dbg	line,	"tests/vrp-6.c", 7; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test01
+	__enter		_test01
+
+	.dbg	line,	"tests/vrp-6.c", 8; if (a < 5)
+	__ld.ws		2  /* a */
+	__ult_w.wi	5
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/vrp-6.c", 9; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/vrp-6.c", 10; if (b < 5)
+.LL3:
+	__ld.ws		0  /* b */
+	__ult_w.wi	5
+	__bfalse	.LL4
+
+	.dbg	line,	"tests/vrp-6.c", 11; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/vrp-6.c", 12; if (a - b != 5)
+.LL4:
+	__ld.ws		2  /* a */
+	__sub.ws	0  /* b */
+	__neq_w.wi	5
+	__bfalse	.LL5
+
+	.dbg	line,	"tests/vrp-6.c", 13; abort();
+	__call		_abort
+
+	.dbg	line,	"tests/vrp-6.c", 14; }
+.LL5:
+.LL2:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/vrp-6.c", 16; void test02(unsigned int a, unsigned int b)
+	.dbg	line,	"tests/vrp-6.c", 17; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_test02
+	__enter		_test02
+
+	.dbg	line,	"tests/vrp-6.c", 18; if (a >= 12)
+	__ld.ws		2  /* a */
+	__uge_w.wi	12
+	__bfalse	.LL7
+
+	.dbg	line,	"tests/vrp-6.c", 19; if (b > 15)
+	__ld.ws		0  /* b */
+	__ugt_w.wi	15
+	__bfalse	.LL8
+
+	.dbg	line,	"tests/vrp-6.c", 20; if (a - b < UINT_MAX - 15/*U*/)
+	__ld.ws		2  /* a */
+	__sub.ws	0  /* b */
+	__ult_w.wi	65520
+	__bfalse	.LL9
+
+	.dbg	line,	"tests/vrp-6.c", 21; abort ();
+	__call		_abort
+
+	.dbg	line,	"tests/vrp-6.c", 22; }
+.LL9:
+.LL8:
+.LL7:
+.LL6:
+	__modsp		4
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	line,	"tests/vrp-6.c", 24; int main(int argc, char *argv[])
+	.dbg	line,	"tests/vrp-6.c", 25; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/vrp-6.c", 26; unsigned x = 0x8000;
+	__st.wmiq	32768, __main_end - 2  /* x */
+
+	.dbg	line,	"tests/vrp-6.c", 27; test01(x + 5, x);
+	__ld.wm		__main_end - 2  /* x */
+	__add.wi	5
+	__pusharg.wr
+	__ld.wm		__main_end - 2  /* x */
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__ult_w.wi	5
+	__bfalse	.LL11
+	__call		_abort
+.LL11:
+	__ld.ws		0  /* b */
+	__ult_w.wi	5
+	__bfalse	.LL12
+	__call		_abort
+.LL12:
+	__ld.ws		2  /* a */
+	__sub.ws	0  /* b */
+	__neq_w.wi	5
+	__bfalse	.LL13
+	__call		_abort
+.LL13:
+.LL14:
+	__modsp		4
+
+	.dbg	line,	"tests/vrp-6.c", 28; test02(14, 16);
+	__ld.wi		14
+	__pusharg.wr
+	__ld.wi		16
+	__pusharg.wr
+	__ld.ws		2  /* a */
+	__uge_w.wi	12
+	__bfalse	.LL17
+	__ld.ws		0  /* b */
+	__ugt_w.wi	15
+	__bfalse	.LL16
+	__ld.ws		2  /* a */
+	__sub.ws	0  /* b */
+	__ult_w.wi	65520
+	__bfalse	.LL15
+	__call		_abort
+.LL15:
+.LL16:
+.LL17:
+.LL18:
+	__modsp		4
+
+	.dbg	line,	"tests/vrp-6.c", 29; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/vrp-6.c", 30; }
+.LL10:
+	__modsp		4
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:12
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         6      6     2  overlaid locals
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 6, 6
+__main_end	=	__overlay_frames + 2
+	.endm
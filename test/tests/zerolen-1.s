@@ -0,0 +1,174 @@
+; Small-C HuC6280 (1997-Nov-08)
+; became HuC      (2000-Feb-22)
+; became HuCC     (2024-May-01)
+;
+; This file generated by HuCC (def25f6, 2026-10-17)
+; on Sat Oct 17 11:20:12 2026
+;
+
+HUC		=	1
+HUCC		=	1
+
+	.include	"hucc.asm"
+	.opt		@+
+	.code
+
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 1; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 2; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 3; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 4; // globals.h
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 5; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 6; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 7; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 8; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 9; // The idea is that you, a PCE developer, copy this file from the ../include/
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 10; // directory and into your project's directory, and then define the variables
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 11; // that you want to have shared access to in all overlay programs on your CD.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 12; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 13; // Because PCEAS searches the current (i.e. project) directory for an include
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 14; // file first, then it will find your customized copy of the file rather than
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 15; // the original copy in the ../include/ directory.
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 16; //
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 17; // **************************************************************************
+	.dbg	line,	"/root/repo/test/../include/hucc/globals.h", 18; // **************************************************************************
+	.dbg	clear
+	.bss
+huc_globals:
+
+huc_globals_end:
+	.code
+	.dbg	line,	"tests/zerolen-1.c", 1; extern void abort (void);
+	.dbg	line,	"tests/zerolen-1.c", 2; extern void exit (int);
+	.dbg	line,	"tests/zerolen-1.c", 4; union iso_directory_record {
+	.dbg	line,	"tests/zerolen-1.c", 5; char carr[4];
+	.dbg	line,	"tests/zerolen-1.c", 6; struct {
+	.dbg	line,	"tests/zerolen-1.c", 7; unsigned char name_len [1];
+	.dbg	line,	"tests/zerolen-1.c", 8; char name [0];
+	.dbg	line,	"tests/zerolen-1.c", 9; } u;
+	.dbg	line,	"tests/zerolen-1.c", 10; } entry;
+	.dbg	line,	"tests/zerolen-1.c", 12; void set(union iso_directory_record *);
+	.dbg	line,	"tests/zerolen-1.c", 14; int main (void)
+	.dbg	line,	"tests/zerolen-1.c", 15; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_main
+	__enter		_main
+
+	.dbg	line,	"tests/zerolen-1.c", 16; union iso_directory_record *de;
+
+	.dbg	line,	"tests/zerolen-1.c", 18; de = &entry;
+	__ld.wi		_entry
+	__st.wmq	__main_end - 2  /* de */
+
+	.dbg	line,	"tests/zerolen-1.c", 19; set(de);
+	__pusharg.wr
+	__call		_set
+
+	.dbg	line,	"tests/zerolen-1.c", 21; if (de->u.name_len[0] == 1 && de->u.name[0] == 0)
+	__ld.wm		__main_end - 2  /* de */
+	__st.wm		__ptr
+	__ld.upq	__ptr
+	__equ_b.uiq	1
+	__bfalse	.LL4
+	__ld.wm		__main_end - 2  /* de */
+	__add.wi	1
+	__st.wm		__ptr
+	__not.up	__ptr
+.LL4:
+	__bfalse	.LL3
+
+	.dbg	line,	"tests/zerolen-1.c", 22; exit (0);
+	__ld.wi		0
+	__call		_exit.1
+
+	.dbg	line,	"tests/zerolen-1.c", 23; else
+	__bra		.LL5
+.LL3:
+
+	.dbg	line,	"tests/zerolen-1.c", 24; abort ();
+	__call		_abort
+.LL5:
+
+	.dbg	line,	"tests/zerolen-1.c", 25; }
+.LL2:
+	__return	1
+	.dbg	clear
+	.endp
+	.bss
+	.code
+	.pceas
+
+	.dbg	line,	"tests/zerolen-1.c", 27; void set (union iso_directory_record *p)
+	.dbg	line,	"tests/zerolen-1.c", 28; {
+;***********************
+;***********************
+
+	.hucc
+	.proc		_set
+	__enter		_set
+
+	.dbg	line,	"tests/zerolen-1.c", 29; p->carr[0] = 1;
+	__ld.ws		0  /* p */
+	__push.wr
+	__ld.wi		1
+	__st.utq
+
+	.dbg	line,	"tests/zerolen-1.c", 30; p->carr[1] = 0;
+	__ld.ws		0  /* p */
+	__add.wi	1
+	__push.wr
+	__ld.wi		0
+	__st.utq
+
+	.dbg	line,	"tests/zerolen-1.c", 31; return;
+.LL6:
+
+	.dbg	line,	"tests/zerolen-1.c", 32; }
+	__modsp		2
+	__return	0
+	.dbg	clear
+	.endp
+	.pceas
+
+	.dbg	clear
+
+	.bss
+	.code
+
+;0 error(s) in compilation
+;	literal pool:0
+;	constant pool:0
+;	global pool:5
+;	Macro pool:6
+
+;***********************
+; -foverlay-frames
+;
+;  offset  size  function
+;       0     2  _main
+;
+; 2 bytes overlaid, 0 bytes saved
+; the overlay is left for -fauto-zp to place
+;***********************
+	.bss
+	.code
+
+;***********************
+; -fauto-zp
+;
+;    cycles  bytes  size  variable
+;         8      8     2  overlaid locals
+;         2      2     4  entry
+;
+; cycles are weighted by the loop depth
+;***********************
+
+HUCC_AUTO_ZP	=	1
+
+__auto_zp	.macro
+	auto_zp_var	__overlay_frames, 2, 8, 8
+__main_end	=	__overlay_frames + 2
+	auto_zp_var	_entry, 4, 2, 2
+	.endm
@@ -3,14 +3,34 @@
 #include <string.h>
 #include <stdlib.h>
 #include <unistd.h>
+#ifndef _WIN32
+#include <sys/wait.h>
+#endif
 
 #include "shared.h"
+#include "profile.h"
 #define SCR_W 320
 #define SCR_H 240
 
 unsigned char *pixels;
 char *rom_name;
 
+/* Draw every line of every frame, instead of only drawing the screen
+   when the program asks for a dump_screen(). */
+int full_render = 0;
+
+/* Write "rom.prof" with the cycles that were run at each address. */
+int profile = 0;
+
+/* Stop a ROM that is still running after this many frames, 0 = never. */
+uint32 frame_budget = 0;
+
+/* Exit code for a ROM that ran out of frames. */
+#define EXIT_TIMEOUT 124
+
+/* The batch worker's end of the pipe to the parent, or -1. */
+int report_fd = -1;
+
 void fint(FILE *fp, int v)
 {
     v = swap32(v);
@@ -37,6 +57,10 @@ void dump_screen(void)
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 , 0x00, 0x00,
     };
 
+    /* The lines haven't been drawn, so draw them now. */
+    if (!full_render)
+        system_render_frame();
+
     char *scrname = strcpy( malloc( strlen(rom_name)+10), rom_name);
     char *nameext = strrchr(scrname, '.');
     if (nameext) *nameext = '\0';
@@ -84,18 +108,19 @@ void dump_screen(void)
     exit(0);
 }
 
-int main(int argc, char **argv)
+/* The profile goes next to the ROM, like the reference screen. */
+void start_profile(void)
+{
+    char *profname = strcpy( malloc( strlen(rom_name)+10), rom_name);
+    char *nameext = strrchr(profname, '.');
+    if (nameext) *nameext = '\0';
+    strcat(profname, ".prof");
+    profile_start(profname);
+    free(profname);
+}
+
+void setup_bitmap(void)
 {
-    int res;
-    if (argc != 2)
-        abort();
-    fprintf(stderr, "loading ROM\n");
-    rom_name = argv[1];
-    res = load_rom(rom_name, 0, 0);
-    if (res != 1) {
-        fprintf(stderr, "failed to load ROM: %d\n", res);
-        return -1;
-    }
     pixels = calloc(SCR_W * SCR_H * 2, 1);
     bitmap.width = SCR_W;
     bitmap.height = SCR_H;
@@ -107,15 +132,279 @@ int main(int argc, char **argv)
     bitmap.viewport.h = 240;
     bitmap.viewport.x = 0x20;
     bitmap.viewport.y = 0x00;
-    
+}
+
+void run_rom(void)
+{
+    while (frame_budget == 0 || frame_count < frame_budget) {
+        bitmap.data = pixels;
+        system_frame(!full_render);
+    }
+    fprintf(stderr, "%s: still running after %u frames\n", rom_name, frame_budget);
+    exit(EXIT_TIMEOUT);
+}
+
+#ifndef _WIN32
+/* The test ends with an exit() from the CPU, so tell the parent how long
+   it ran from here. */
+void report_progress(void)
+{
+    char buf[64];
+    unsigned long long cycles;
+    int len;
+
+    cycles = ((unsigned long long)frame_count * 262 + frame_line) * 455 + (455 - h6280_ICount);
+    len = snprintf(buf, sizeof(buf), "%u %llu\n", frame_count, cycles);
+    if (write(report_fd, buf, len) != len)
+        _exit(EXIT_FAILURE);
+}
+
+typedef struct
+{
+    char *name;
+    int status;         /* from waitpid(), or -1 if it didn't start */
+    uint32 frames;
+    unsigned long long cycles;
+} t_result;
+
+/* Read a manifest with one ROM name per line. */
+int read_manifest(const char *filename, char ***list, int *count, int *max)
+{
+    char line[1024];
+    FILE *fp = fopen(filename, "r");
+    if (!fp) {
+        fprintf(stderr, "cannot open manifest \"%s\"\n", filename);
+        return 0;
+    }
+    while (fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0' || line[0] == '#')
+            continue;
+        if (*count == *max) {
+            *max = *max ? *max * 2 : 256;
+            *list = realloc(*list, *max * sizeof(char *));
+        }
+        (*list)[(*count)++] = strdup(line);
+    }
+    fclose(fp);
+    return 1;
+}
+
+/* Start a worker process for one ROM, which gets its own copy of the
+   emulator state that the parent has initialized. */
+pid_t start_worker(char *name, int *fd)
+{
+    int pipefd[2];
+    pid_t pid;
+    int res;
+
+    if (pipe(pipefd) < 0)
+        return -1;
+    fflush(NULL);
+    pid = fork();
+    if (pid < 0) {
+        close(pipefd[0]);
+        close(pipefd[1]);
+        return -1;
+    }
+    if (pid > 0) {
+        close(pipefd[1]);
+        *fd = pipefd[0];
+        return pid;
+    }
+
+    close(pipefd[0]);
+    rom_name = name;
+    res = load_rom(rom_name, 0, 0);
+    if (res != 1) {
+        fprintf(stderr, "%s: failed to load ROM: %d\n", rom_name, res);
+        _exit(EXIT_FAILURE);
+    }
+    report_fd = pipefd[1];
+    atexit(report_progress);
+    system_reset();
+    if (profile)
+        start_profile();
+    run_rom();
+    return 0;
+}
+
+/*
+ * Run a list of ROMs on "jobs" worker processes, and print a line for each
+ * one with its name, PASS/FAIL/TIMEOUT/CRASH, exit code, frames and cycles.
+ */
+int run_batch(char **list, int count, int jobs)
+{
+    t_result *result = calloc(count, sizeof(t_result));
+    pid_t *pid = calloc(jobs, sizeof(pid_t));
+    int *fd = calloc(jobs, sizeof(int));
+    int *index = calloc(jobs, sizeof(int));
+    int next = 0, running = 0, fails = 0;
+    int i, status;
+
+    for (i = 0; i < count; i++) {
+        result[i].name = list[i];
+        result[i].status = -1;
+    }
+
+    while (next < count || running) {
+        /* Fill the free slots */
+        for (i = 0; i < jobs && next < count; i++) {
+            if (pid[i] > 0)
+                continue;
+            index[i] = next++;
+            pid[i] = start_worker(list[index[i]], &fd[i]);
+            if (pid[i] < 0) {
+                fprintf(stderr, "%s: cannot start a worker\n", list[index[i]]);
+                pid[i] = 0;
+                continue;
+            }
+            running++;
+        }
+        if (!running)
+            break;
+
+        /* Wait for any of them to finish */
+        pid_t done = waitpid(-1, &status, 0);
+        if (done < 0)
+            break;
+        for (i = 0; i < jobs; i++) {
+            if (pid[i] == done) {
+                char buf[64];
+                int len = read(fd[i], buf, sizeof(buf) - 1);
+                t_result *r = &result[index[i]];
+                if (len > 0) {
+                    buf[len] = '\0';
+                    sscanf(buf, "%u %llu", &r->frames, &r->cycles);
+                }
+                r->status = status;
+                close(fd[i]);
+                pid[i] = 0;
+                running--;
+                break;
+            }
+        }
+    }
+
+    for (i = 0; i < count; i++) {
+        t_result *r = &result[i];
+        const char *verdict;
+        int code = -1;
+
+        if (r->status == -1)
+            verdict = "CRASH";
+        else if (WIFSIGNALED(r->status)) {
+            verdict = "CRASH";
+            code = 128 + WTERMSIG(r->status);
+        } else {
+            code = WEXITSTATUS(r->status);
+            verdict = code == 0 ? "PASS" : code == EXIT_TIMEOUT ? "TIMEOUT" : "FAIL";
+        }
+        if (code != 0)
+            fails++;
+        printf("%s\t%s\t%d\t%u\t%llu\n", r->name, verdict, code, r->frames, r->cycles);
+    }
+    fflush(stdout);
+
+    free(result);
+    free(pid);
+    free(fd);
+    free(index);
+    return fails;
+}
+#endif
+
+void usage(const char *exename)
+{
+    fprintf(stderr, "usage: %s [options] rom.pce\n", exename);
+    fprintf(stderr, "       %s --batch [options] rom.pce|@manifest...\n\n", exename);
+    fprintf(stderr, "--render      Draw every frame, for raster effects in a dump_screen()\n");
+    fprintf(stderr, "--profile     Write the cycles run at each address to rom.prof, for tgprof\n");
+    fprintf(stderr, "--frames=n    Give up on a ROM after n frames (exit code %d)\n", EXIT_TIMEOUT);
+    fprintf(stderr, "--batch       Run all the ROMs, and print \"rom result exit frames cycles\"\n");
+    fprintf(stderr, "              for each one, tab separated (default --frames=%d)\n", 60 * 60);
+    fprintf(stderr, "-jn           Run n ROMs at the same time in batch mode\n");
+    fprintf(stderr, "@manifest     A file with the names of the ROMs, one per line\n");
+}
+
+int main(int argc, char **argv)
+{
+    char **list = NULL;
+    int count = 0, max = 0;
+    int batch = 0, jobs = 0;
+    int frames_set = 0;
+    int i, res;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--render") == 0)
+            full_render = 1;
+        else if (strcmp(argv[i], "--profile") == 0)
+            profile = 1;
+        else if (strcmp(argv[i], "--batch") == 0)
+            batch = 1;
+        else if (strncmp(argv[i], "--frames=", 9) == 0) {
+            frame_budget = strtoul(argv[i] + 9, NULL, 10);
+            frames_set = 1;
+        }
+        else if (strncmp(argv[i], "-j", 2) == 0)
+            jobs = atoi(argv[i] + 2);
+        else if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return -1;
+        }
+        else if (argv[i][0] == '@') {
+            if (!read_manifest(argv[i] + 1, &list, &count, &max))
+                return -1;
+        }
+        else {
+            if (count == max) {
+                max = max ? max * 2 : 256;
+                list = realloc(list, max * sizeof(char *));
+            }
+            list[count++] = argv[i];
+        }
+    }
+    if (count == 0 || (!batch && count != 1)) {
+        usage(argv[0]);
+        return -1;
+    }
+
+    setup_bitmap();
+
+    if (batch) {
+#ifdef _WIN32
+        fprintf(stderr, "--batch is not supported on Windows\n");
+        return -1;
+#else
+        if (!frames_set)
+            frame_budget = 60 * 60;
+        if (jobs <= 0)
+            jobs = sysconf(_SC_NPROCESSORS_ONLN);
+        if (jobs <= 0)
+            jobs = 1;
+
+        /* Build the lookup tables once, the workers inherit them */
+        system_init(44100);
+        res = run_batch(list, count, jobs);
+        return res ? 1 : 0;
+#endif
+    }
+
+    fprintf(stderr, "loading ROM\n");
+    rom_name = list[0];
+    res = load_rom(rom_name, 0, 0);
+    if (res != 1) {
+        fprintf(stderr, "failed to load ROM: %d\n", res);
+        return -1;
+    }
+
     fprintf(stderr, "system_init\n");
     system_init(44100);
     fprintf(stderr, "system_reset\n");
     system_reset();
-    
-    while (1) {
-        bitmap.data = pixels;
-        system_frame(0);
-    }
+    if (profile)
+        start_profile();
+
+    run_rom();
     return 0;
 }
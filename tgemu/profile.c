@@ -0,0 +1,158 @@
+/*
+ * Count the instructions and cycles that are run at each (bank, PC) and in
+ * each interrupt context, and write them to a file when the program exits.
+ *
+ * The file is read by tgprof, which turns the addresses back into labels,
+ * C functions and source lines with the help of the pceas .sym file.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "shared.h"
+#include "profile.h"
+
+#define MAX_NESTING 16
+
+typedef struct
+{
+    uint32_t insns[CONTEXT_COUNT][0x2000];
+    uint64_t cycles[CONTEXT_COUNT][0x2000];
+    uint8_t slot[0x2000];       /* The MPR that the bank was last run from */
+} t_bank_profile;
+
+static const char *context_name[CONTEXT_COUNT] = {
+    "main", "irq1", "irq2", "timer", "nmi"
+};
+
+static char *profile_name;
+static t_bank_profile *bank_profile[0x100];
+
+static int context_stack[MAX_NESTING];
+static int context_depth;
+static int context;
+
+static uint64_t context_insns[CONTEXT_COUNT];
+static uint64_t context_cycles[CONTEXT_COUNT];
+static uint64_t idle_cycles;
+
+
+/* The context that the next instruction runs in, the CPU core reads this */
+/* before the instruction because a CLI, PLP or RTI can change it */
+int profile_context(void)
+{
+    return context;
+}
+
+
+void profile_insn(int where, int bank, int pc, int cycles)
+{
+    t_bank_profile *p = bank_profile[bank];
+    int offset = pc & 0x1FFF;
+
+    if (!p) {
+        p = bank_profile[bank] = calloc(1, sizeof(t_bank_profile));
+        if (!p) {
+            fprintf(stderr, "out of memory for the profile\n");
+            exit(1);
+        }
+    }
+    p->insns[where][offset] += 1;
+    p->cycles[where][offset] += cycles;
+    p->slot[offset] = pc >> 13;
+
+    context_insns[where] += 1;
+    context_cycles[where] += cycles;
+}
+
+
+/* The cycles that are skipped when the CPU is stuck in a tight loop */
+void profile_idle(int cycles)
+{
+    idle_cycles += cycles;
+}
+
+
+/* The cycles are those taken to enter the interrupt, BRK counts its own */
+void profile_irq(int vector, int cycles)
+{
+    /* Keep counting past the end of the stack, so RTI stays in step */
+    if (context_depth < MAX_NESTING)
+        context_stack[context_depth] = context;
+    context_depth++;
+
+    switch (vector) {
+        case H6280_IRQ1_VEC:  context = CONTEXT_IRQ1;  break;
+        case H6280_IRQ2_VEC:  context = CONTEXT_IRQ2;  break;
+        case H6280_TIMER_VEC: context = CONTEXT_TIMER; break;
+        default:              context = CONTEXT_NMI;   break;
+    }
+
+    /* Taking the interrupt */
+    context_cycles[context] += cycles;
+}
+
+
+void profile_rti(void)
+{
+    if (context_depth > 0 && --context_depth < MAX_NESTING)
+        context = context_stack[context_depth];
+}
+
+
+static void profile_write(void)
+{
+    FILE *fp;
+    uint64_t insns = 0, cycles = 0;
+    int bank, offset, i;
+
+    fp = fopen(profile_name, "w");
+    if (!fp) {
+        fprintf(stderr, "cannot write the profile \"%s\"\n", profile_name);
+        return;
+    }
+
+    for (i = 0; i < CONTEXT_COUNT; i++) {
+        insns += context_insns[i];
+        cycles += context_cycles[i];
+    }
+
+    fprintf(fp, "; tgemu profile\n");
+    fprintf(fp, "total %llu %llu\n", (unsigned long long)insns, (unsigned long long)cycles);
+    fprintf(fp, "idle %llu\n", (unsigned long long)idle_cycles);
+    for (i = 0; i < CONTEXT_COUNT; i++) {
+        fprintf(fp, "context %s %llu %llu\n", context_name[i],
+            (unsigned long long)context_insns[i], (unsigned long long)context_cycles[i]);
+    }
+
+    /* context bank:address instructions cycles */
+    fprintf(fp, "\n[samples]\n");
+    for (bank = 0; bank < 0x100; bank++) {
+        t_bank_profile *p = bank_profile[bank];
+        if (!p)
+            continue;
+        for (offset = 0; offset < 0x2000; offset++) {
+            for (i = 0; i < CONTEXT_COUNT; i++) {
+                if (p->insns[i][offset] == 0)
+                    continue;
+                fprintf(fp, "%s %2.2x:%4.4x %u %llu\n", context_name[i],
+                    bank, (p->slot[offset] << 13) | offset,
+                    p->insns[i][offset], (unsigned long long)p->cycles[i][offset]);
+            }
+        }
+    }
+    fclose(fp);
+}
+
+
+/* Start counting, and write the profile to "filename" at exit(). */
+void profile_start(const char *filename)
+{
+    profile_name = strdup(filename);
+    context = CONTEXT_MAIN;
+    context_depth = 0;
+    atexit(profile_write);
+    h6280_profiling = 1;
+}
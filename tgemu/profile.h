@@ -0,0 +1,21 @@
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+
+/* Where the CPU is running when it executes an instruction */
+#define CONTEXT_MAIN    (0)
+#define CONTEXT_IRQ1    (1)     /* VDC interrupt */
+#define CONTEXT_IRQ2    (2)     /* IRQ2 or BRK */
+#define CONTEXT_TIMER   (3)
+#define CONTEXT_NMI     (4)
+#define CONTEXT_COUNT   (5)
+
+void profile_start(const char *filename);
+
+/* Called by the CPU core while h6280_profiling is set */
+int profile_context(void);
+void profile_insn(int where, int bank, int pc, int cycles);
+void profile_idle(int cycles);
+void profile_irq(int vector, int cycles);
+void profile_rti(void);
+
+#endif /* _PROFILE_H_ */
@@ -47,7 +47,9 @@
 		Fixed B flag setting on BRK.
 		Assumed CSH & CSL to take 2 cycles each.
 
-		Todo:  Performance could be improved by precalculating timer fire position.
+    Changelog, tgemu:
+        The timer's fire position is precalculated as an h6280_ICount
+        deadline, and it is only brought up to date when it is accessed.
 
 	Changelog, version 1.06, 4/5/00 - last opcode bug found?
 		JMP indirect was doing a EAL++; instead of EAD++; - Obviously causing
@@ -73,8 +75,15 @@
 /* Default state of HuC6280 clock (1=7.16MHz, 0=3.58MHz) */
 int h6280_speed = 1;
 int h6280_ICount = 0;
+int h6280_profiling = 0;
 static  h6280_Regs  h6280;
 
+/* The timer's value is only brought up to date at these points, so the
+   loop in h6280_execute() only has to watch for event_icount. */
+static int timer_icount;    /* h6280_ICount when timer_value was correct */
+static int insn_icount;     /* h6280_ICount at the start of the instruction */
+static int event_icount;    /* stop when h6280_ICount gets down to this */
+
 #include "h6280ops.h"
 #include "tblh6280.c"
 
@@ -105,6 +114,8 @@ void h6280_reset(void *param __attribute__ ((unused)))
 	for (i = 0; i < 3; i++)
 		h6280.irq_state[i] = CLEAR_LINE;
 
+	timer_icount = insn_icount = event_icount = 0;
+
     h6280_speed = 1; /* default = 7.16MHz (?) */
 }
 
@@ -113,47 +124,85 @@ void h6280_exit(void)
 	/* nothing */
 }
 
+/* Count the cycles since the timer was last brought up to date. */
+static void timer_sync(int icount)
+{
+	if(h6280.timer_status)
+		h6280.timer_value -= timer_icount - icount;
+	timer_icount = icount;
+}
+
+/* Work out when the timer will fire, if it can. */
+static void timer_schedule(void)
+{
+	event_icount = 0;
+	if(h6280.timer_status && h6280.timer_ack==1)
+	{
+		int deadline = timer_icount - h6280.timer_value;
+		if(deadline > 0) event_icount = deadline;
+	}
+}
+
+/* Bring the timer up to date at the end of an instruction, and fire it. */
+static void timer_event(void)
+{
+	timer_sync(h6280_ICount);
+	if(h6280.timer_status && h6280.timer_value<=0 && h6280.timer_ack==1)
+	{
+		h6280.timer_ack=h6280.timer_status=0;
+		h6280_set_irq_line(2,ASSERT_LINE);
+	}
+	timer_schedule();
+}
+
 int h6280_execute(int cycles)
 {
-	int in,lastcycle,deltacycle;
+	int in, where = 0;
 	h6280_ICount = cycles;
 
     /* Subtract cycles used for taking an interrupt */
     h6280_ICount -= h6280.extra_cycles;
 	h6280.extra_cycles = 0;
-	lastcycle = h6280_ICount;
+	timer_icount = h6280_ICount;
+	timer_schedule();
 
 	/* Execute instructions */
 	do
     {
-		h6280.ppc = h6280.pc;
+		do
+		{
+			h6280.ppc = h6280.pc;
+			insn_icount = h6280_ICount;
+			if (h6280_profiling)
+				where = profile_context();
 
 // printf("Executing $%02X:%02X\n", h6280.mmr[PCW >> 13], PCW);
-		/* Execute 1 instruction */
-		in=RDOP();
-		PCW++;
-		insnh6280[in]();
+			/* Execute 1 instruction */
+			in=RDOP();
+			PCW++;
+			insnh6280[in]();
 
-		/* Check internal timer */
-		if(h6280.timer_status)
-		{
-			deltacycle = lastcycle - h6280_ICount;
-			h6280.timer_value -= deltacycle;
-			if(h6280.timer_value<=0 && h6280.timer_ack==1)
+			if (h6280_profiling)
+				profile_insn(where, h6280.mmr[h6280.ppc.w.l >> 13], h6280.ppc.w.l, insn_icount - h6280_ICount);
+
+			/* If PC has not changed we are stuck in a tight loop, may as well finish */
+			if( h6280.pc.d == h6280.ppc.d )
 			{
-				h6280.timer_ack=h6280.timer_status=0;
-				h6280_set_irq_line(2,ASSERT_LINE);
+				/* ... unless the timer fires now */
+				timer_event();
+				if( h6280.pc.d == h6280.ppc.d )
+				{
+					if (h6280_profiling && h6280_ICount > 0)
+						profile_idle(h6280_ICount);
+					if (h6280_ICount > 0) h6280_ICount=0;
+					h6280.extra_cycles = 0;
+					return cycles;
+				}
 			}
-		}
-		lastcycle = h6280_ICount;
+		} while (h6280_ICount > event_icount);
 
-		/* If PC has not changed we are stuck in a tight loop, may as well finish */
-		if( h6280.pc.d == h6280.ppc.d )
-		{
-			if (h6280_ICount > 0) h6280_ICount=0;
-			h6280.extra_cycles = 0;
-			return cycles;
-		}
+		/* Check internal timer */
+		timer_event();
 
 	} while (h6280_ICount > 0);
 
@@ -312,14 +361,17 @@ void H6280_irq_status_w (int offset, int data)
 			break;
 
 		case 1: /* Timer irq ack - timer is reloaded here */
+			timer_sync(insn_icount);
 			h6280.timer_value = h6280.timer_load;
 			h6280.timer_ack=1; /* Timer can't refire until ack'd */
+			timer_schedule();
 			break;
 	}
 }
 
 int H6280_timer_r (int offset)
 {
+	timer_sync(insn_icount);
 	switch (offset) {
 		case 0: /* Counter value */
 			return (h6280.timer_value/1024)&127;
@@ -333,10 +385,11 @@ int H6280_timer_r (int offset)
 
 void H6280_timer_w (int offset, int data)
 {
+	timer_sync(insn_icount);
 	switch (offset) {
 		case 0: /* Counter preload */
 			h6280.timer_load=h6280.timer_value=((data&127)+1)*1024;
-			return;
+			break;
 
 		case 1: /* Counter enable */
 			if(data&1)
@@ -344,8 +397,9 @@ void H6280_timer_w (int offset, int data)
 				if(h6280.timer_status==0) h6280.timer_value=h6280.timer_load;
 			}
 			h6280.timer_status=data&1;
-			return;
+			break;
 	}
+	timer_schedule();
 }
 
 /*****************************************************************************/
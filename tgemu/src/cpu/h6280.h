@@ -38,6 +38,7 @@ extern int h6280_speed;
 #define H6280_IRQ2_VEC	0xfff6			/* Aka BRK vector */
 
 extern int h6280_ICount;				/* cycle count */
+extern int h6280_profiling;				/* call the profile_*() hooks */
 
 extern void h6280_reset(void *param);			/* Reset registers to the initial values */
 extern void h6280_exit(void);					/* Shut down CPU */
@@ -59,8 +59,17 @@
 #define PCW h6280.pc.w.l
 #define PCD h6280.pc.d
 
+/* The profiler follows the interrupts, see tgemu's profile.c */
+extern int h6280_profiling;
+extern int profile_context(void);
+extern void profile_insn(int where, int bank, int pc, int cycles);
+extern void profile_idle(int cycles);
+extern void profile_irq(int vector, int cycles);
+extern void profile_rti(void);
+
 #define DO_INTERRUPT(vector)									\
 {																\
+	if (h6280_profiling) profile_irq(vector, 7);				\
 	h6280.extra_cycles += 7;	/* 7 cycles for an int */		\
 	PUSH(PCH);													\
 	PUSH(PCL);													\
@@ -109,7 +118,7 @@ extern void io_page_w(int address, int value);
 extern int io_page_r(int address);
 
 #define cpu_readop21_fast(addr)         read_ptr[(addr) >> 13][(addr) & 0x1FFF]
-#define cpu_readmem21_fast(addr)        (read_ptr[(addr) >> 13] == 0) ? io_page_r((addr) & 0x1FFF) : read_ptr[(addr) >> 13][(addr) & 0x1FFF]
+#define cpu_readmem21_fast(addr)        ((read_ptr[(addr) >> 13] == 0) ? io_page_r((addr) & 0x1FFF) : read_ptr[(addr) >> 13][(addr) & 0x1FFF])
 #define cpu_writemem21_fast(addr,value) if(write_ptr[(addr) >> 13] == 0) io_page_w((addr) & 0x1FFF, value); else (write_ptr[(addr) >> 13][(addr) & 0x1FFF] = value)
 
 #define RDMEMZ(addr)        ram[addr & 0x1FFF];
@@ -504,6 +513,7 @@ extern int io_page_r(int address);
  *	set I flag, reset D flag and jump via IRQ vector
  ***************************************************************/
 #define BRK 													\
+	if (h6280_profiling) profile_irq(H6280_IRQ2_VEC, 0);		\
 	PCW++;														\
 	PUSH(PCH);													\
 	PUSH(PCL);													\
@@ -831,6 +841,7 @@ extern int io_page_r(int address);
 #if LAZY_FLAGS
 
 #define RTI 													\
+	if (h6280_profiling) profile_rti();							\
 	PULL(P);													\
 	NZ = ((P & _fN) << 8) | 									\
 		 ((P & _fZ) ^ _fZ); 									\
@@ -840,6 +851,7 @@ extern int io_page_r(int address);
 #else
 
 #define RTI 													\
+	if (h6280_profiling) profile_rti();							\
 	PULL(P);													\
 	PULL(PCL);													\
 	PULL(PCH);													\
@@ -1109,7 +1121,6 @@ extern void bank_set(int bank, int value);
                 h6280.mmr[shift] = A;                           \
                 bank_set(shift, A);                             \
             }                                                   \
-            if(tmp & (1 << shift)) break;                       \
         }                                                       \
     }                                                           
 
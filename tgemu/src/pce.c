@@ -7,8 +7,11 @@ uint8 cdram[0x10000];   /* CD unit RAM (64k) */
 uint8 bram[0x2000];     /* Backup RAM (8K) */
 uint8 rom[0x100000];    /* HuCard ROM (1MB) */
 uint8 save_bram;        /* 1= BRAM registers were accessed */
+uint8 dummy[0x2000];    /* Dummy block for writes to ROM or unknown pages, never read */
+uint8 unmapped[0x2000]; /* Reads from unknown pages, always $FF */
+uint8 *page_read[0x100];    /* Physical page read pointers, NULL= I/O */
+uint8 *page_write[0x100];   /* Physical page write pointers, NULL= I/O */
 #ifdef FAST_MEM
-uint8 dummy[0x2000];    /* Dummy block for unknown access */
 uint8 *read_ptr[8];     /* Memory read pointers */
 uint8 *write_ptr[8];    /* Memory write pointers */
 #endif
@@ -25,6 +28,7 @@ uint8 joy_cnt = 0;
 
 int pce_init(void)
 {
+    page_reset();
 #ifdef FAST_MEM
     bank_reset();
 #endif
@@ -38,8 +42,8 @@ void pce_reset(void)
     joy_sel = joy_clr = joy_cnt = 0;
     memset(ram, 0, 0x8000);
     memset(cdram, 0, 0x10000);
-#ifdef FAST_MEM
     memset(dummy, 0, 0x2000);
+#ifdef FAST_MEM
     bank_reset();
 #endif
     load_file("pce.brm", (char *) bram, 0x2000);
@@ -68,64 +72,21 @@ void cpu_writeport16(int port, int data)
 
 void cpu_writemem21(int address, int data)
 {
-    uint8 page = (address >> 13) & 0xFF;
-
-    /* RAM (F8) */
-    if(page == 0xF8 || page == 0xF9 || page == 0xFA || page == 0xFB) {
-        ram[(address & 0x7FFF)] = data;
-        return;
-    }
+    uint8 *ptr = page_write[(address >> 13) & 0xFF];
 
-    /* I/O (FF) */
-    if(page == 0xFF) {
+    if(ptr)
+        ptr[address & 0x1FFF] = data;
+    else
         io_page_w(address & 0x1FFF, data);
-        return;
-    }
-
-    /* CD RAM */
-    if((page >= 0x80) && (page <= 0x87)) {
-        cdram[(address & 0xFFFF)] = data;
-        return;
-    }
-
-    /* Backup RAM (F7) */
-    if(page == 0xF7) {
-        bram[(address & 0x1FFF)] = data;
-        return;
-    }
-
-#ifdef DEBUG
-    error("write %02X to %02X:%04X (%08X)\n", data, page, address & 0x1fff, h6280_get_reg(H6280_PC));
-#endif
 }
 
 int cpu_readmem21(int address)
 {
-    uint8 page;
-
-    if(address <= 0x0FFFFF) return (rom[(address)]);
-
-    page = (address >> 13) & 0xFF;
-
-    /* ROM (00-7F) */
-    if(page <= 0x7F) return (rom[(address)]);
-
-    /* RAM (F8) */
-    if(page == 0xF8 || page == 0xF9 || page == 0xFA || page == 0xFB) return (ram[(address & 0x7FFF)]);
+    uint8 *ptr = page_read[(address >> 13) & 0xFF];
 
-    /* I/O (FF) */
-    if(page == 0xFF) return (io_page_r(address & 0x1FFF));
-
-    /* CD RAM */
-    if((page >= 0x80) && (page <= 0x87)) return (cdram[(address & 0xFFFF)]);
-
-    /* Backup RAM (F7) */
-    if(page == 0xF7) return (bram[(address & 0x1FFF)]);
-
-#ifdef DEBUG
-    error("read %02X:%04X (%08X)\n", page, address & 0x1fff, h6280_get_reg(H6280_PC));
-#endif
-    return (0xFF);
+    if(ptr)
+        return (ptr[address & 0x1FFF]);
+    return (io_page_r(address & 0x1FFF));
 }
 
 #endif
@@ -259,6 +220,50 @@ uint8 input_r(void)
     return (temp);
 }
 
+/* Point each of the 256 physical pages at the memory behind it, so that
+   an access only has to look up its page. */
+void page_reset(void)
+{
+    int page;
+
+    for(page = 0; page < 0x100; page += 1)
+    {
+        /* ROM */
+        if(page <= 0x7F) {
+            page_read[page] = &rom[(page << 13)];
+            page_write[page] = &dummy[0x0000];
+        }
+        else
+        /* CD RAM */
+        if((page >= 0x80) && (page <= 0x87)) {
+            page_read[page] = page_write[page] = &cdram[(page & 0x07) << 13];
+        }
+        else
+        /* RAM */
+        if((page >= 0xF8) && (page <= 0xFB)) {
+            page_read[page] = page_write[page] = &ram[(page & 0x03) << 13];
+        }
+        else
+        /* Backup RAM */
+        if(page == 0xF7) {
+            page_read[page] = page_write[page] = &bram[0x0000];
+        }
+        else
+        /* I/O page */
+        if(page == 0xFF) {
+            page_read[page] = page_write[page] = NULL;
+        }
+        else
+        /* Unknown page */
+        {
+            page_read[page] = &unmapped[0x0000];
+            page_write[page] = &dummy[0x0000];
+        }
+    }
+
+    memset(unmapped, 0xFF, 0x2000);
+}
+
 #ifdef FAST_MEM
 
 void bank_reset(void)
@@ -266,50 +271,15 @@ void bank_reset(void)
     int i;
     for(i = 0; i < 8; i += 1)
     {
-        read_ptr[i] = &rom[0x0000];
-        write_ptr[i] = &dummy[0x0000];
+        read_ptr[i] = page_read[0x00];
+        write_ptr[i] = page_write[0x00];
     }
 }
 
 void bank_set(int bank, int value)
 {
-    /* ROM */
-    if(value <= 0x7F) {
-        read_ptr[bank] = &rom[(value << 13)];
-        write_ptr[bank] = &dummy[0x0000];
-        return;
-    }
-
-    /* CD RAM */
-    if((value >= 0x80) && (value <= 0x87)) {
-        read_ptr[bank] = write_ptr[bank] = &cdram[(value & 0x07) << 13];
-        return;
-    }
-
-    /* RAM */
-    if((value >= 0xF8) && (value <= 0xFB)) {
-        read_ptr[bank] = write_ptr[bank] = &ram[(value & 0x03) << 13];
-        return;
-    }
-
-    /* Backup RAM */
-    if(value == 0xF7) {
-        read_ptr[bank] = write_ptr[bank] = &bram[0x0000];
-        return;
-    }
-
-    /* I/O page */
-    if(value == 0xFF) {
-        read_ptr[bank] = write_ptr[bank] = NULL;
-        return;
-    }
-
-    /* Unknown page */
-#ifdef DEBUG
-    error("Map unknown page %02X to MMR #%d\n", value, bank);
-#endif
-    read_ptr[bank] = write_ptr[bank] = &dummy[0x0000];
+    read_ptr[bank] = page_read[value & 0xFF];
+    write_ptr[bank] = page_write[value & 0xFF];
 }
 
 #endif
-
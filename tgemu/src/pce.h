@@ -7,8 +7,11 @@ extern uint8 ram[0x8000];
 extern uint8 cdram[0x10000];
 extern uint8 bram[0x2000];
 extern uint8 rom[0x100000];
-#ifdef FAST_MEM
 extern uint8 dummy[0x2000];
+extern uint8 unmapped[0x2000];
+extern uint8 *page_read[0x100];
+extern uint8 *page_write[0x100];
+#ifdef FAST_MEM
 extern uint8 *read_ptr[8];
 extern uint8 *write_ptr[8];
 #endif
@@ -27,6 +30,7 @@ void io_page_w(int address, int data);
 int io_page_r(int address);
 void input_w(uint8 data);
 uint8 input_r(void);
+void page_reset(void);
 void bank_reset(void);
 void bank_set(int bank, int value);
 
@@ -22,6 +22,10 @@ t_bitmap bitmap;
 t_input input;
 t_snd snd;
 
+/* How far the emulation has got since the last reset */
+uint32 frame_count;
+int frame_line;
+
 
 /* Pass 0 for no sound, or 8000-44100 for desired sample rate */
 /* No error checking at the moment... */
@@ -110,6 +114,7 @@ void system_frame(int skip)
         }
 
         /* 7.16 MHz = 455 cycles per line */
+        frame_line = line;
         h6280_execute(455); 
 
         /* Render a line of the display */
@@ -121,13 +126,34 @@ void system_frame(int skip)
 
     }
 
+    frame_count += 1;
+
     /* Update audio */
     if(snd.enabled) psg_update(snd.buffer[0], snd.buffer[1], snd.buffer_size);
 }
 
 
+/* Draw the whole display from the current VDC/VCE state, for when
+   system_frame() has been skipping the lines. Raster effects are lost. */
+void system_render_frame(void)
+{
+    int line;
+    uint32 save_y_offset = y_offset;
+
+    for(y_offset = byr, line = 0; (line < disp_height) && (line < 262); line += 1)
+    {
+        render_line(line);
+        y_offset = (y_offset + 1) & playfield_col_mask;
+    }
+
+    y_offset = save_y_offset;
+}
+
+
 void system_reset(void)
 {
+    frame_count = 0;
+    frame_line = 0;
     pce_reset();
     vdc_reset();
     psg_reset();
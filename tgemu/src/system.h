@@ -64,11 +64,14 @@ typedef struct
 extern t_bitmap bitmap;
 extern t_input input;
 extern t_snd snd;
+extern uint32 frame_count;
+extern int frame_line;
 
 /* Function prototypes */
 int system_init(int sample_rate);
 void audio_init(int rate);
 void system_frame(int skip);
+void system_render_frame(void);
 void system_reset(void);
 void system_shutdown(void);
 
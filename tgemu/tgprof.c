@@ -0,0 +1,557 @@
+/*
+ * tgprof - print a flat profile from the "rom.prof" file that tgemu
+ * writes with --profile.
+ *
+ * The addresses are looked up in the pceas .sym file of the ROM.  The
+ * default .sym file only has labels, so the profile is by label, with
+ * each .proc's thunk followed to the code that it calls.  With a .sym
+ * file from "hucc -gC" there are also profiles by C function and by C
+ * source line.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#define MAX_LINE 1024
+
+/* A linear ROM address, so that bank + 1 follows on from bank */
+#define LINEAR(bank, addr) (((bank) << 13) | ((addr) & 0x1FFF))
+
+typedef struct
+{
+    uint32_t where;             /* LINEAR() */
+    int proc;                   /* 1= found through a .proc thunk */
+    char *name;
+} t_label;
+
+typedef struct
+{
+    uint32_t where;             /* LINEAR() */
+    uint32_t size;
+    int file;
+    int line;
+} t_range;
+
+typedef struct
+{
+    int file;
+    int line;
+    char *name;
+} t_func;
+
+typedef struct
+{
+    char *name;
+    uint64_t insns;
+    uint64_t cycles;
+} t_entry;
+
+typedef struct
+{
+    t_entry *entry;
+    int count;
+    int max;
+} t_table;
+
+static t_label *labels;
+static int label_count, label_max;
+
+static t_range *ranges;
+static int range_count, range_max;
+
+static t_func *funcs;
+static int func_count, func_max;
+
+static char **files;
+static int file_max;
+
+static uint8_t *rom;
+static long rom_size;
+
+static char sym_dir[MAX_LINE];
+
+static void *grow(void *list, int *max, int count, size_t size)
+{
+    if (count < *max)
+        return list;
+    *max = *max ? *max * 2 : 256;
+    list = realloc(list, *max * size);
+    if (!list) {
+        fprintf(stderr, "tgprof: out of memory\n");
+        exit(1);
+    }
+    return list;
+}
+
+static char *replace_ext(const char *name, const char *ext)
+{
+    char *copy = malloc(strlen(name) + strlen(ext) + 1);
+    char *dot;
+
+    strcpy(copy, name);
+    dot = strrchr(copy, '.');
+    if (dot && !strchr(dot, '/'))
+        *dot = '\0';
+    strcat(copy, ext);
+    return copy;
+}
+
+/*--------------------------------------------------------------------------*/
+/* The ROM and the .sym file                                                */
+/*--------------------------------------------------------------------------*/
+
+static void load_rom(const char *name)
+{
+    FILE *fp = fopen(name, "rb");
+    if (!fp)
+        return;
+    fseek(fp, 0, SEEK_END);
+    rom_size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    rom = malloc(rom_size);
+    if (!rom || fread(rom, 1, rom_size, fp) != (size_t)rom_size) {
+        free(rom);
+        rom = NULL;
+        rom_size = 0;
+    }
+    fclose(fp);
+
+    /* Skip a 512-byte header, like tgemu does */
+    if (rom && ((rom_size / 512) & 1)) {
+        memmove(rom, rom + 512, rom_size - 512);
+        rom_size -= 512;
+    }
+}
+
+static int rom_byte(uint32_t where)
+{
+    return (rom && where < (uint32_t)rom_size) ? rom[where] : -1;
+}
+
+/*
+ * A .proc's label is moved to its thunk, so follow the thunk to the code.
+ *
+ * HuCC:  tma #6, pha, lda #bank, tam #6, jmp addr
+ * HuC:   tay, tma #5, pha, lda #bank, tam #5, tya, jsr addr
+ */
+static uint32_t follow_thunk(uint32_t where)
+{
+    static const int hucc[] = { 0x43, 0x40, 0x48, 0xA9, -1, 0x53, 0x40, 0x4C };
+    static const int huc[] = { 0xA8, 0x43, 0x20, 0x48, 0xA9, -1, 0x53, 0x20, 0x98, 0x20 };
+    const int *code;
+    int length, i;
+
+    if (rom_byte(where) == 0x43) {
+        code = hucc;
+        length = 8;
+    } else {
+        code = huc;
+        length = 10;
+    }
+    for (i = 0; i < length; i++) {
+        if (code[i] >= 0 && rom_byte(where + i) != code[i])
+            return where;
+    }
+    if (rom_byte(where + length + 1) < 0)
+        return where;
+
+    /* the bank is the operand of the "lda #" */
+    return LINEAR(rom_byte(where + length - (code == hucc ? 4 : 5)),
+                  rom_byte(where + length) | (rom_byte(where + length + 1) << 8));
+}
+
+static void add_label(int bank, int addr, const char *name)
+{
+    uint32_t where = LINEAR(bank, addr);
+
+    labels = grow(labels, &label_max, label_count, sizeof(t_label));
+    labels[label_count].where = follow_thunk(where);
+    labels[label_count].proc = labels[label_count].where != where;
+    labels[label_count].name = strdup(name);
+    label_count++;
+}
+
+static int compare_label(const void *a, const void *b)
+{
+    const t_label *la = a, *lb = b;
+    if (la->where != lb->where)
+        return la->where < lb->where ? -1 : 1;
+
+    /* a .proc wins over any other label at the start of its code */
+    if (la->proc != lb->proc)
+        return la->proc - lb->proc;
+    return strcmp(la->name, lb->name);
+}
+
+static int compare_range(const void *a, const void *b)
+{
+    const t_range *ra = a, *rb = b;
+    if (ra->where != rb->where)
+        return ra->where < rb->where ? -1 : 1;
+    return 0;
+}
+
+/* "Bank Addr Label" lines, from pceas without -g */
+static void read_label_line(char *line)
+{
+    char *addr, *name;
+    unsigned bank;
+
+    /* skip constants and overlays */
+    if (line[3] == '-' || line[1] == ':' || sscanf(line, "%x", &bank) != 1 || bank > 0xFF)
+        return;
+
+    /* skip the local labels, which have an empty first label column */
+    addr = strchr(line, '\t');
+    name = addr ? strchr(addr + 1, '\t') : NULL;
+    if (!name || name[1] == '\t')
+        return;
+    name = strtok(name + 1, "\t\r\n");
+    if (name)
+        add_label(bank, strtol(addr + 1, NULL, 16), name);
+}
+
+/* The mesen2 sections, from pceas -gC, -gA or -gL */
+static void read_debug_line(const char *section, char *line)
+{
+    unsigned bank, addr, flags, file, fline, column;
+    char name[MAX_LINE];
+
+    if (strcmp(section, "source-files") == 0) {
+        char *start = strchr(line, '"');
+        char *end = start ? strchr(start + 1, '"') : NULL;
+        if (end && sscanf(line, "%x", &file) == 1) {
+            while ((int)file >= file_max) {
+                int old = file_max;
+                files = grow(files, &file_max, file_max, sizeof(char *));
+                memset(files + old, 0, (file_max - old) * sizeof(char *));
+            }
+            *end = '\0';
+            files[file] = strdup(start + 1);
+        }
+    }
+    else if (strcmp(section, "symbols") == 0) {
+        if (sscanf(line, "%x:%x %x %x:%x:%x %s", &bank, &addr, &flags, &file, &fline, &column, name) != 7)
+            return;
+        if (bank > 0xFF || !(flags & 0x80000000))
+            return;
+        add_label(bank, addr, name);
+
+        /* the C functions */
+        if (flags & 0x40000000) {
+            funcs = grow(funcs, &func_max, func_count, sizeof(t_func));
+            funcs[func_count].file = file;
+            funcs[func_count].line = fline;
+            funcs[func_count].name = strdup(name);
+            func_count++;
+        }
+    }
+    else if (strcmp(section, "bank-to-source") == 0) {
+        if (sscanf(line, "%x:%x %x %x:%x:%x", &bank, &addr, &flags, &file, &fline, &column) != 6)
+            return;
+        if (bank > 0xFF)
+            return;
+        ranges = grow(ranges, &range_max, range_count, sizeof(t_range));
+        ranges[range_count].where = LINEAR(bank, addr);
+        ranges[range_count].size = flags & 0x3FFFFFFF;
+        ranges[range_count].file = file;
+        ranges[range_count].line = fline;
+        range_count++;
+    }
+}
+
+static int load_sym(const char *name)
+{
+    char line[MAX_LINE];
+    char section[64] = "";
+    int debug = 0;
+    char *slash;
+    FILE *fp;
+
+    fp = fopen(name, "r");
+    if (!fp)
+        return 0;
+
+    strcpy(sym_dir, name);
+    slash = strrchr(sym_dir, '/');
+    if (slash)
+        slash[1] = '\0';
+    else
+        sym_dir[0] = '\0';
+
+    while (fgets(line, sizeof(line), fp)) {
+        if (line[0] == ';') {
+            debug = 1;
+            continue;
+        }
+        if (line[0] == '[') {
+            sscanf(line, "[%63[^]]", section);
+            continue;
+        }
+        if (debug)
+            read_debug_line(section, line);
+        else if (strncmp(line, "Bank", 4) && strncmp(line, "----", 4))
+            read_label_line(line);
+    }
+    fclose(fp);
+
+    qsort(labels, label_count, sizeof(t_label), compare_label);
+    qsort(ranges, range_count, sizeof(t_range), compare_range);
+    return 1;
+}
+
+static const t_label *find_label(uint32_t where)
+{
+    int lo = 0, hi = label_count - 1, found = -1;
+
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (labels[mid].where <= where) {
+            found = mid;
+            lo = mid + 1;
+        } else
+            hi = mid - 1;
+    }
+    if (found < 0 || (labels[found].where >> 13) != (where >> 13))
+        return NULL;
+    return &labels[found];
+}
+
+static const t_range *find_range(uint32_t where)
+{
+    int lo = 0, hi = range_count - 1, found = -1;
+
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (ranges[mid].where <= where) {
+            found = mid;
+            lo = mid + 1;
+        } else
+            hi = mid - 1;
+    }
+    if (found < 0 || where >= ranges[found].where + ranges[found].size)
+        return NULL;
+    return &ranges[found];
+}
+
+static const char *file_name(int file)
+{
+    return (file < file_max && files[file]) ? files[file] : "?";
+}
+
+/* The C function that a line is in, or else the name of the file */
+static const char *find_func(int file, int line)
+{
+    const t_func *best = NULL;
+    int i;
+
+    for (i = 0; i < func_count; i++) {
+        if (funcs[i].file == file && funcs[i].line <= line && line > 0)
+            if (!best || funcs[i].line > best->line)
+                best = &funcs[i];
+    }
+    return best ? best->name : file_name(file);
+}
+
+/*--------------------------------------------------------------------------*/
+/* The tables                                                               */
+/*--------------------------------------------------------------------------*/
+
+static void add_entry(t_table *table, const char *name, uint64_t insns, uint64_t cycles)
+{
+    int i;
+
+    for (i = 0; i < table->count; i++) {
+        if (strcmp(table->entry[i].name, name) == 0)
+            break;
+    }
+    if (i == table->count) {
+        table->entry = grow(table->entry, &table->max, table->count, sizeof(t_entry));
+        table->entry[i].name = strdup(name);
+        table->entry[i].insns = 0;
+        table->entry[i].cycles = 0;
+        table->count++;
+    }
+    table->entry[i].insns += insns;
+    table->entry[i].cycles += cycles;
+}
+
+static int compare_entry(const void *a, const void *b)
+{
+    const t_entry *ea = a, *eb = b;
+    if (ea->cycles != eb->cycles)
+        return ea->cycles > eb->cycles ? -1 : 1;
+    return strcmp(ea->name, eb->name);
+}
+
+/* The text of a source line, if the file can be found */
+static const char *source_text(const char *name, int line)
+{
+    static char text[MAX_LINE];
+    char path[2 * MAX_LINE];
+    FILE *fp;
+    int n = 0;
+
+    fp = fopen(name, "r");
+    if (!fp && name[0] != '/') {
+        snprintf(path, sizeof(path), "%s%s", sym_dir, name);
+        fp = fopen(path, "r");
+    }
+    if (!fp)
+        return "";
+    text[0] = '\0';
+    while (fgets(text, sizeof(text), fp)) {
+        if (++n == line)
+            break;
+        text[0] = '\0';
+    }
+    fclose(fp);
+    text[strcspn(text, "\r\n")] = '\0';
+    return text + strspn(text, " \t");
+}
+
+static void print_table(const char *title, t_table *table, uint64_t total, int limit, int lines)
+{
+    int i;
+
+    if (table->count == 0)
+        return;
+    qsort(table->entry, table->count, sizeof(t_entry), compare_entry);
+
+    printf("\n%s\n\n", title);
+    printf("  cycles      %%      insns  name\n");
+    for (i = 0; i < table->count && i < limit; i++) {
+        t_entry *e = &table->entry[i];
+        printf("%8llu %6.2f %10llu  %s", (unsigned long long)e->cycles,
+            total ? 100.0 * e->cycles / total : 0.0, (unsigned long long)e->insns, e->name);
+        if (lines) {
+            char file[MAX_LINE];
+            int line;
+            if (sscanf(e->name, "%[^:]:%d", file, &line) == 2)
+                printf("  %s", source_text(file, line));
+        }
+        printf("\n");
+    }
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: tgprof [-n count] [-c context] rom.prof [rom.sym [rom.pce]]\n\n");
+    fprintf(stderr, "-n count    Show the top count entries of each table (default 30)\n");
+    fprintf(stderr, "-c context  Only count main, irq1, irq2, timer or nmi\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    char line[MAX_LINE];
+    const char *prof_name = NULL, *sym_name = NULL, *rom_name = NULL;
+    const char *only = NULL;
+    int limit = 30;
+    int samples = 0;
+    uint64_t total_cycles = 0, total_insns = 0, idle = 0, shown = 0;
+    t_table by_label = { 0 }, by_func = { 0 }, by_line = { 0 };
+    FILE *fp;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            limit = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+            only = argv[++i];
+        else if (argv[i][0] == '-')
+            usage();
+        else if (!prof_name)
+            prof_name = argv[i];
+        else if (!sym_name)
+            sym_name = argv[i];
+        else if (!rom_name)
+            rom_name = argv[i];
+        else
+            usage();
+    }
+    if (!prof_name)
+        usage();
+    if (!sym_name)
+        sym_name = replace_ext(prof_name, ".sym");
+    if (!rom_name)
+        rom_name = replace_ext(sym_name, ".pce");
+
+    fp = fopen(prof_name, "r");
+    if (!fp) {
+        fprintf(stderr, "tgprof: cannot open \"%s\"\n", prof_name);
+        return 1;
+    }
+
+    /* The thunks have to be read before the labels are moved */
+    load_rom(rom_name);
+    if (!load_sym(sym_name))
+        fprintf(stderr, "tgprof: cannot open \"%s\", there are no names\n", sym_name);
+
+    printf("Profile %s\n\n", prof_name);
+    while (fgets(line, sizeof(line), fp)) {
+        char context[32];
+        unsigned long long insns, cycles;
+        unsigned bank, addr;
+
+        if (line[0] == ';' || line[0] == '\n')
+            continue;
+        if (line[0] == '[') {
+            samples = strncmp(line, "[samples]", 9) == 0;
+            continue;
+        }
+        if (!samples) {
+            if (sscanf(line, "total %llu %llu", &insns, &cycles) == 2) {
+                total_insns = insns;
+                total_cycles = cycles;
+            }
+            else if (sscanf(line, "idle %llu", &cycles) == 1)
+                idle = cycles;
+            else if (sscanf(line, "context %31s %llu %llu", context, &insns, &cycles) == 3)
+                printf("%-8s %12llu cycles %6.2f%% %12llu insns\n", context, cycles,
+                    total_cycles ? 100.0 * cycles / total_cycles : 0.0, insns);
+            continue;
+        }
+
+        if (sscanf(line, "%31s %x:%x %llu %llu", context, &bank, &addr, &insns, &cycles) != 5)
+            continue;
+        if (only && strcmp(context, only) != 0)
+            continue;
+        shown += cycles;
+
+        {
+            uint32_t where = LINEAR(bank, addr);
+            const t_label *label = find_label(where);
+            const t_range *range = find_range(where);
+            char name[MAX_LINE];
+
+            if (label)
+                snprintf(name, sizeof(name), "%s", label->name);
+            else
+                snprintf(name, sizeof(name), "%2.2x:%4.4x", bank, addr);
+            add_entry(&by_label, name, insns, cycles);
+
+            if (range) {
+                add_entry(&by_func, find_func(range->file, range->line), insns, cycles);
+                if (range->line > 0)
+                    snprintf(name, sizeof(name), "%s:%d", file_name(range->file), range->line);
+                else
+                    snprintf(name, sizeof(name), "%s", file_name(range->file));
+                add_entry(&by_line, name, insns, cycles);
+            }
+        }
+    }
+    fclose(fp);
+
+    printf("%-8s %12llu cycles skipped in tight loops\n", "idle", (unsigned long long)idle);
+    printf("%-8s %12llu cycles %12llu insns\n", "total",
+        (unsigned long long)total_cycles, (unsigned long long)total_insns);
+
+    print_table("By label (.proc)", &by_label, shown, limit, 0);
+    print_table("By C function", &by_func, shown, limit, 0);
+    print_table("By source line", &by_line, shown, limit, 1);
+
+    return 0;
+}